@@ -1,6 +1,7 @@
 @echo off
+rem Extra arguments are passed on to cmake, e.g. emscripten.cmd -DCF_FRAMEWORK_EMSCRIPTEN_THREADS=ON
 if not exist build_emscripten mkdir build_emscripten
 pushd build_emscripten
-call emcmake cmake ..
+call emcmake cmake .. %*
 call emmake make
-popd
\ No newline at end of file
+popd
@@ -32,6 +32,7 @@
 #include "cute_array.h"
 #include "cute_audio.h"
 #include "cute_base64.h"
+#include "cute_bitstream.h"
 #include "cute_clipboard.h"
 #include "cute_color.h"
 #include "cute_multithreading.h"
@@ -49,11 +50,22 @@
 #include "cute_input.h"
 #include "cute_joypad.h"
 #include "cute_json.h"
+#include "cute_log.h"
+#include "cute_manifest.h"
 #include "cute_math.h"
 #include "cute_networking.h"
+#include "cute_replay.h"
+#include "cute_replication.h"
+#include "cute_interest.h"
 #include "cute_noise.h"
+#include "cute_particles.h"
+#include "cute_tilemap.h"
 #include "cute_png_cache.h"
+#include "cute_profile.h"
 #include "cute_rnd.h"
+#include "cute_spatial_hash.h"
+#include "cute_contact_cache.h"
+#include "cute_physics.h"
 #include "cute_sprite.h"
 #include "cute_string.h"
 #include "cute_time.h"
@@ -10,6 +10,7 @@
 #define CF_A_STAR_H
 
 #include "cute_defines.h"
+#include "cute_multithreading.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -22,7 +23,7 @@ extern "C" {
  * @struct   CF_AStarGrid
  * @category pathfinding
  * @brief    An opaque handle representing a grid for calculating shortest paths. See `cf_make_a_star_grid` for more details.
- * @related  cf_make_a_star_grid cf_destroy_a_star_grid cf_a_star_grid_set_cost cf_a_star_grid_get_cost cf_a_star
+ * @related  cf_make_a_star_grid cf_destroy_a_star_grid cf_a_star_grid_set_cost cf_a_star_grid_get_cost cf_a_star cf_a_star_batch cf_a_star_grid_enable_hierarchy cf_a_star_grid_enable_path_cache cf_a_star_grid_enable_jump_points cf_make_a_star_flow_field
  */
 typedef struct CF_AStarGrid { uint64_t id; } CF_AStarGrid;
 // @end
@@ -59,10 +60,57 @@ CF_API float CF_CALL cf_a_star_grid_get_cost(CF_AStarGrid grid, int x, int y);
  * @param    x          The x position of the grid cell.
  * @param    y          The y position of the grid cell.
  * @param    cost       The cost of the grid cell.
+ * @remarks  Grids using `cf_a_star_grid_enable_hierarchy`, `cf_a_star_grid_enable_path_cache` or `cf_a_star_grid_enable_jump_points`
+ *           must change costs with this function rather than writing to `cell_costs` directly, so only the affected clusters and
+ *           cached paths are refreshed.
  * @related  cf_make_a_star_grid cf_destroy_a_star_grid cf_a_star_grid_get_cost cf_a_star
  */
 CF_API void CF_CALL cf_a_star_grid_set_cost(CF_AStarGrid grid, int x, int y, float cost);
 
+/**
+ * @function cf_a_star_grid_enable_hierarchy
+ * @category pathfinding
+ * @brief    Speeds up long paths on big grids with hierarchical path-finding (HPA*).
+ * @param    grid          The grid.
+ * @param    cluster_size  The width and height of each cluster in cells, 16 is a good start. Zero turns the hierarchy off.
+ * @remarks  The grid is split into square clusters linked by entrances along their borders. `cf_a_star` then plans long paths over
+ *           the entrances, and only searches cells within the clusters along the way, which is far cheaper than searching every
+ *           cell in between. Paths found this way are near-optimal rather than the very shortest. Paths between the same or
+ *           neighboring clusters still search cells directly. The hierarchy is built by the first query, and `cf_a_star_grid_set_cost`
+ *           only rebuilds clusters around the changed cell. Alternating between diagonal and non-diagonal queries rebuilds everything,
+ *           so stick to one kind per grid.
+ * @related  cf_a_star cf_a_star_grid_set_cost cf_a_star_grid_enable_path_cache
+ */
+CF_API void CF_CALL cf_a_star_grid_enable_hierarchy(CF_AStarGrid grid, int cluster_size);
+
+/**
+ * @function cf_a_star_grid_enable_path_cache
+ * @category pathfinding
+ * @brief    Remembers the results of recent calls to `cf_a_star`.
+ * @param    grid          The grid.
+ * @param    capacity      How many paths to remember. The least recently used path is forgotten to make room. Zero turns the cache off.
+ * @remarks  Many agents often path between the same spots, such as to a shared goal. Repeating a query returns a copy of the
+ *           remembered path without searching. `cf_a_star_grid_set_cost` forgets paths through a cell that got more expensive, and
+ *           forgets all paths if a cell got cheaper, as any path could now be shorter.
+ * @related  cf_a_star cf_a_star_grid_set_cost cf_a_star_grid_enable_hierarchy
+ */
+CF_API void CF_CALL cf_a_star_grid_enable_path_cache(CF_AStarGrid grid, int capacity);
+
+/**
+ * @function cf_a_star_grid_enable_jump_points
+ * @category pathfinding
+ * @brief    Speeds up diagonal queries on grids where every open cell costs 1.0f with jump point search (JPS).
+ * @param    grid          The grid.
+ * @param    enable        True to use jump point search where it applies, false to turn it off.
+ * @remarks  When all cells cost the same, many paths are equally short, and plain A* wastes time exploring all of them. Jump point
+ *           search instead skips along straight and diagonal runs of open cells, only stopping where walls force a path to turn.
+ *           Paths are exactly as short as without it. It only applies to queries with `allow_diagonal_movement`, and is skipped
+ *           while any open cell costs something other than 1.0f. Costs are checked here, and then kept track of by
+ *           `cf_a_star_grid_set_cost`. With `cf_a_star_grid_enable_hierarchy`, long paths still go through the hierarchy.
+ * @related  cf_a_star cf_a_star_grid_set_cost cf_a_star_grid_enable_hierarchy
+ */
+CF_API void CF_CALL cf_a_star_grid_enable_jump_points(CF_AStarGrid grid, bool enable);
+
 /**
  * @function cf_destroy_a_star_grid
  * @category pathfinding
@@ -104,12 +152,127 @@ typedef struct CF_AStarOutput
  * @param    allow_diagonal_movement  True to allow diagonal movements on the grid. False for only up/down/left/right movements.
  * @param    out                      `CF_AStarOutput` containing the calculated shortest path. Free it up with `cf_free_a_star_output` when done.
  * @return   Returns true if a path was calculated, false if no valid path is possible.
- * @remarks  Call `cf_make_a_star_grid` to make a `CF_AStarGrid` before calling this function. The grid is treated as read-only, so you can freely
- *           make multithreaded calls to `cf_a_star` with the same grid, as long as you don't modify the grid cell costs in the meantime.
- * @related  CF_AStarGrid cf_free_a_star_output
+ * @remarks  Call `cf_make_a_star_grid` to make a `CF_AStarGrid` before calling this function. Only nodes the search reaches are touched,
+ *           so short paths stay cheap on big grids. The grid holds scratch memory for searches, so don't make multithreaded calls to
+ *           `cf_a_star` with the same grid. To find many paths at once use `cf_a_star_batch` instead, which spreads them across threads.
+ * @related  CF_AStarGrid cf_free_a_star_output cf_a_star_batch cf_a_star_grid_enable_hierarchy cf_a_star_grid_enable_path_cache
  */
 CF_API bool CF_CALL cf_a_star(CF_AStarGrid grid, int start_x, int start_y, int end_x, int end_y, bool allow_diagonal_movement, CF_AStarOutput* out);
 
+/**
+ * @struct   CF_AStarQuery
+ * @category pathfinding
+ * @brief    One path to find with `cf_a_star_batch`.
+ * @related  cf_a_star_batch cf_a_star
+ */
+typedef struct CF_AStarQuery
+{
+	/* @member The starting x-position of the path. */
+	int start_x;
+
+	/* @member The starting y-position of the path. */
+	int start_y;
+
+	/* @member The ending x-position of the path. */
+	int end_x;
+
+	/* @member The ending y-position of the path. */
+	int end_y;
+
+	/* @member True to allow diagonal movements on the grid. False for only up/down/left/right movements. */
+	bool allow_diagonal_movement;
+} CF_AStarQuery;
+// @end
+
+/**
+ * @function cf_a_star_batch
+ * @category pathfinding
+ * @brief    Calculates many shortest paths along a grid at once, same as calling `cf_a_star` for each query.
+ * @param    grid       The `CF_AStarGrid` for calculating the shortest paths along.
+ * @param    queries    Array of `count` paths to find, see `CF_AStarQuery`.
+ * @param    count      The number of queries.
+ * @param    outs       Array of `count` outputs. Each path goes into the output at the same index as its query. Queries with no valid
+ *                      path get a `count` of zero. Free each one with `cf_free_a_star_output` when done.
+ * @param    pool       Can be `NULL`. A threadpool to spread the searches across, see `cf_make_threadpool`.
+ * @return   Returns the number of queries a path was found for.
+ * @remarks  Searches only read the grid, and each thread searches with its own scratch memory. That's one node per cell, so the grid
+ *           keeps an extra copy for each thread the first time a batch is big enough to use it. The path cache and hierarchy are
+ *           consulted and updated on the calling thread, before and after the searches. The hierarchy only works for one setting of
+ *           `allow_diagonal_movement` at a time, so in a batch mixing both, queries with the other setting search the grid directly.
+ * @related  CF_AStarGrid CF_AStarQuery cf_a_star cf_free_a_star_output
+ */
+CF_API int CF_CALL cf_a_star_batch(CF_AStarGrid grid, const CF_AStarQuery* queries, int count, CF_AStarOutput* outs, CF_Threadpool* pool);
+
+/**
+ * @struct   CF_AStarFlowField
+ * @category pathfinding
+ * @brief    An opaque handle representing a flow field, the way to a single goal from every cell of a grid. See `cf_make_a_star_flow_field`.
+ * @related  cf_make_a_star_flow_field cf_destroy_a_star_flow_field cf_a_star_flow_field_next cf_a_star_flow_field_cost
+ */
+typedef struct CF_AStarFlowField { uint64_t id; } CF_AStarFlowField;
+// @end
+
+/**
+ * @function cf_make_a_star_flow_field
+ * @category pathfinding
+ * @brief    Finds the shortest path from every cell of a grid to one goal.
+ * @param    grid                     The `CF_AStarGrid` to find paths along. It must outlive the flow field.
+ * @param    goal_x                   The x-position of the goal.
+ * @param    goal_y                   The y-position of the goal.
+ * @param    allow_diagonal_movement  True to allow diagonal movements on the grid. False for only up/down/left/right movements.
+ * @return   Returns a `CF_AStarFlowField`. Free it with `cf_destroy_a_star_flow_field` when done.
+ * @remarks  When many agents head to the same goal, such as a rally point, one flow field is far cheaper than a `cf_a_star` call
+ *           per agent. Building it costs about as much as one search across the whole grid, and then each agent looks up its next
+ *           step with `cf_a_star_flow_field_next` in constant time, from wherever it happens to be. Call `cf_a_star_flow_field_update`
+ *           after changing cell costs. Like `cf_a_star`, this uses the grid's scratch memory, so don't build flow fields for the
+ *           same grid from more than one thread at a time. Looking up steps is safe from any thread.
+ * @related  CF_AStarFlowField cf_destroy_a_star_flow_field cf_a_star_flow_field_update cf_a_star_flow_field_next cf_a_star_flow_field_cost
+ */
+CF_API CF_AStarFlowField CF_CALL cf_make_a_star_flow_field(CF_AStarGrid grid, int goal_x, int goal_y, bool allow_diagonal_movement);
+
+/**
+ * @function cf_destroy_a_star_flow_field
+ * @category pathfinding
+ * @brief    Frees up all resources used by a flow field.
+ * @param    field      The flow field.
+ * @related  CF_AStarFlowField cf_make_a_star_flow_field
+ */
+CF_API void CF_CALL cf_destroy_a_star_flow_field(CF_AStarFlowField field);
+
+/**
+ * @function cf_a_star_flow_field_update
+ * @category pathfinding
+ * @brief    Recalculates a flow field after the costs of its grid changed.
+ * @param    field      The flow field.
+ * @related  CF_AStarFlowField cf_make_a_star_flow_field cf_a_star_grid_set_cost
+ */
+CF_API void CF_CALL cf_a_star_flow_field_update(CF_AStarFlowField field);
+
+/**
+ * @function cf_a_star_flow_field_next
+ * @category pathfinding
+ * @brief    Looks up the next cell along the shortest path from a cell to the goal.
+ * @param    field      The flow field.
+ * @param    x          The x-position of the cell.
+ * @param    y          The y-position of the cell.
+ * @param    next_x     Can be `NULL`. Set to the x-position of the next cell.
+ * @param    next_y     Can be `NULL`. Set to the y-position of the next cell.
+ * @return   Returns false if (x, y) is the goal itself, or the goal can't be reached from there.
+ * @related  CF_AStarFlowField cf_make_a_star_flow_field cf_a_star_flow_field_cost
+ */
+CF_API bool CF_CALL cf_a_star_flow_field_next(CF_AStarFlowField field, int x, int y, int* next_x, int* next_y);
+
+/**
+ * @function cf_a_star_flow_field_cost
+ * @category pathfinding
+ * @brief    Returns the cost of the shortest path from a cell to the goal, or -1.0f if the goal can't be reached from there.
+ * @param    field      The flow field.
+ * @param    x          The x-position of the cell.
+ * @param    y          The y-position of the cell.
+ * @related  CF_AStarFlowField cf_make_a_star_flow_field cf_a_star_flow_field_next
+ */
+CF_API float CF_CALL cf_a_star_flow_field_cost(CF_AStarFlowField field, int x, int y);
+
 /**
  * @function cf_free_a_star_output
  * @category pathfinding
@@ -135,10 +298,21 @@ namespace Cute
 
 using AStarGrid = CF_AStarGrid;
 using AStarOutput = CF_AStarOutput;
+using AStarQuery = CF_AStarQuery;
+using AStarFlowField = CF_AStarFlowField;
 
 CF_INLINE AStarGrid make_a_star_grid(int w, int h, float* cell_costs) { return cf_make_a_star_grid(w, h, cell_costs); }
 CF_INLINE void destroy_a_star_grid(AStarGrid grid) { cf_destroy_a_star_grid(grid); }
+CF_INLINE void a_star_grid_enable_hierarchy(AStarGrid grid, int cluster_size = 16) { cf_a_star_grid_enable_hierarchy(grid, cluster_size); }
+CF_INLINE void a_star_grid_enable_path_cache(AStarGrid grid, int capacity) { cf_a_star_grid_enable_path_cache(grid, capacity); }
+CF_INLINE void a_star_grid_enable_jump_points(AStarGrid grid, bool enable = true) { cf_a_star_grid_enable_jump_points(grid, enable); }
 CF_INLINE bool a_star(AStarGrid grid, int start_x, int start_y, int end_x, int end_y, bool allow_diagonal_movement, AStarOutput* out = NULL) { return cf_a_star(grid, start_x, start_y, end_x, end_y, allow_diagonal_movement, out); }
+CF_INLINE int a_star_batch(AStarGrid grid, const AStarQuery* queries, int count, AStarOutput* outs, Threadpool* pool = NULL) { return cf_a_star_batch(grid, queries, count, outs, pool); }
+CF_INLINE AStarFlowField make_a_star_flow_field(AStarGrid grid, int goal_x, int goal_y, bool allow_diagonal_movement) { return cf_make_a_star_flow_field(grid, goal_x, goal_y, allow_diagonal_movement); }
+CF_INLINE void destroy_a_star_flow_field(AStarFlowField field) { cf_destroy_a_star_flow_field(field); }
+CF_INLINE void a_star_flow_field_update(AStarFlowField field) { cf_a_star_flow_field_update(field); }
+CF_INLINE bool a_star_flow_field_next(AStarFlowField field, int x, int y, int* next_x, int* next_y) { return cf_a_star_flow_field_next(field, x, y, next_x, next_y); }
+CF_INLINE float a_star_flow_field_cost(AStarFlowField field, int x, int y) { return cf_a_star_flow_field_cost(field, x, y); }
 CF_INLINE void free_a_star_output(CF_AStarOutput* output) { cf_free_a_star_output(output); }
 
 }
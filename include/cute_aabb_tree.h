@@ -11,6 +11,7 @@
 
 #include "cute_defines.h"
 #include "cute_math.h"
+#include "cute_multithreading.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -56,6 +57,89 @@ typedef struct CF_Leaf { int id; } CF_Leaf;
  */
 typedef bool (CF_AabbTreeQueryFn)(CF_Leaf leaf, CF_Aabb aabb, void* leaf_udata, void* fn_udata);
 
+/**
+ * @struct   CF_AabbTreePair
+ * @category collision
+ * @brief    Two leaves whose AABBs overlap, as found by `cf_aabb_tree_find_pairs` or `cf_aabb_tree_find_pairs_with`.
+ * @related  CF_AabbTree CF_Leaf cf_aabb_tree_find_pairs cf_aabb_tree_find_pairs_with
+ */
+typedef struct CF_AabbTreePair
+{
+	/* @member A leaf of the first tree. */
+	CF_Leaf a;
+
+	/* @member A leaf of the second tree, or of the same tree for `cf_aabb_tree_find_pairs`. */
+	CF_Leaf b;
+} CF_AabbTreePair;
+// @end
+
+/**
+ * @struct   CF_AabbTreeLeafShape
+ * @category collision
+ * @brief    The shape of a leaf, filled in by a `CF_AabbTreeSweepFn` for `cf_aabb_tree_sweep` to test against.
+ * @related  CF_AabbTreeSweepFn cf_aabb_tree_sweep cf_aabb_tree_sweep_cached
+ */
+typedef struct CF_AabbTreeLeafShape
+{
+	/* @member Pointer to the shape, such as a `CF_Aabb` or `CF_Poly`. Must stay valid until the sweep returns. */
+	const void* shape;
+
+	/* @member The `CF_ShapeType` of `shape`. */
+	CF_ShapeType type;
+
+	/* @member Defaults to the identity transform. Places `shape` in the world. */
+	CF_Transform transform;
+} CF_AabbTreeLeafShape;
+// @end
+
+/**
+ * @function CF_AabbTreeSweepFn
+ * @category collision
+ * @brief    A function pointer called by `cf_aabb_tree_sweep` to fetch the shape of a leaf the swept shape might hit.
+ * @param    leaf        The leaf being considered.
+ * @param    leaf_udata  The user data pointer given when the leaf was inserted.
+ * @param    fn_udata    The user data pointer given to the sweep.
+ * @param    out         Fill this in with the leaf's shape.
+ * @return   Return true to test the leaf, or false to skip it, such as for the character doing the sweep or a one-way platform.
+ * @remarks  The AABBs stored in the tree are padded, so they can't stand in for the shapes themselves.
+ * @related  CF_AabbTreeLeafShape cf_aabb_tree_sweep cf_aabb_tree_sweep_cached
+ */
+typedef bool (CF_AabbTreeSweepFn)(CF_Leaf leaf, void* leaf_udata, void* fn_udata, CF_AabbTreeLeafShape* out);
+
+/**
+ * @struct   CF_AabbTreeSweepResult
+ * @category collision
+ * @brief    The first hit found by `cf_aabb_tree_sweep`.
+ * @related  cf_aabb_tree_sweep cf_aabb_tree_sweep_cached
+ */
+typedef struct CF_AabbTreeSweepResult
+{
+	/* @member True if the swept shape hit anything. */
+	bool hit;
+
+	/* @member The leaf hit first. */
+	CF_Leaf leaf;
+
+	/* @member The fraction of the motion travelled before the hit, from 0 to 1. Zero if the shape started out touching `leaf`. */
+	float toi;
+
+	/* @member Surface normal pointing from the swept shape to the leaf's shape, at the time of impact. */
+	CF_V2 n;
+
+	/* @member Point of contact at the time of impact. */
+	CF_V2 p;
+} CF_AabbTreeSweepResult;
+// @end
+
+/**
+ * @struct   CF_AabbTreeSweepCache
+ * @category collision
+ * @brief    An opaque handle remembering the leaves near one moving shape, so `cf_aabb_tree_sweep_cached` can skip the tree on later frames.
+ * @related  cf_make_aabb_tree_sweep_cache cf_destroy_aabb_tree_sweep_cache cf_aabb_tree_sweep_cached
+ */
+typedef struct CF_AabbTreeSweepCache { uint64_t id; } CF_AabbTreeSweepCache;
+// @end
+
 /**
  * @function cf_make_aabb_tree
  * @category collision
@@ -74,22 +158,39 @@ CF_API CF_AabbTree CF_CALL cf_make_aabb_tree(int initial_capacity);
  * @function cf_make_aabb_tree_from_memory
  * @category collision
  * @brief    Creates a `CF_AabbTree` from a buffer of memory. This is an advanced function, you're probably look for `cf_make_aabb_tree` instead.
- * @param    initial_capacity  Sizes the internal arrays for a number of elements to insert. This may be zero, but a decent starting number is 256 if you're unsure.
- * @return   Returns a `CF_AabbTree` for optimizing collision queries.
+ * @param    buffer     A tree serialized by `cf_aabb_tree_serialize`.
+ * @param    size       The size of `buffer` in bytes.
+ * @return   Returns a `CF_AabbTree` for optimizing collision queries, or a tree with an `id` of zero if `buffer` doesn't hold a serialized tree.
  * @remarks  If you have a serialized tree stored in a buffer of memory by `cf_aabb_tree_serialize`, this function can be used to load up the serialized tree. This is a fairly advanced
  *           function, if you just want to make an AABB tree you may be looking for `cf_make_aabb_tree` instead. Destroy the tree with `cf_destroy_aabb_tree` when you're done using it.
- * @related  cf_make_aabb_tree cf_aabb_tree_serialize cf_destroy_aabb_tree cf_aabb_tree_serialized_size
+ *           The buffer is copied once and used as-is, with no parsing, so `buffer` may be freed right away. The loaded tree can only be queried, and
+ *           `cf_aabb_tree_get_udata` returns `NULL`. To skip the copy too, see `cf_make_aabb_tree_view`.
+ * @related  cf_make_aabb_tree cf_make_aabb_tree_view cf_aabb_tree_serialize cf_destroy_aabb_tree cf_aabb_tree_serialized_size
  */
 CF_API CF_AabbTree CF_CALL cf_make_aabb_tree_from_memory(const void* buffer, size_t size /*= NULL*/);
 
+/**
+ * @function cf_make_aabb_tree_view
+ * @category collision
+ * @brief    Creates a query-only `CF_AabbTree` that reads a serialized tree in place, without copying or parsing it.
+ * @param    buffer     A tree serialized by `cf_aabb_tree_serialize`, aligned to at least 4 bytes (16 is best).
+ * @param    size       The size of `buffer` in bytes.
+ * @return   Returns a `CF_AabbTree`, or a tree with an `id` of zero if `buffer` doesn't hold a serialized tree or is misaligned.
+ * @remarks  Meant for big static trees, such as level collision, loaded with `cf_fs_read_entire_file_to_memory` or memory mapped from disk.
+ *           `buffer` must stay alive and unchanged until the tree is destroyed with `cf_destroy_aabb_tree`. The tree can only be queried,
+ *           and `cf_aabb_tree_get_udata` returns `NULL`. The layout is stored in native byte order, and isn't loaded on machines that differ.
+ * @related  cf_make_aabb_tree_from_memory cf_aabb_tree_serialize cf_destroy_aabb_tree
+ */
+CF_API CF_AabbTree CF_CALL cf_make_aabb_tree_view(const void* buffer, size_t size);
+
 /**
  * @function cf_destroy_aabb_tree
  * @category collision
- * @brief    Destroys an AABB tree previously created by `cf_make_aabb_tree` or `cf_make_aabb_tree_from_memory`.
+ * @brief    Destroys an AABB tree previously created by `cf_make_aabb_tree`, `cf_make_aabb_tree_from_memory` or `cf_make_aabb_tree_view`.
  * @param    tree       The tree to destroy.
  * @remarks  If you have a serialized tree stored in a buffer of memory by `cf_aabb_tree_serialize`, this function can be used to load up the serialized tree. This is a fairly advanced
  *           function, if you just want to make an AABB tree you may be looking for `cf_make_aabb_tree` instead. Destroy the tree with `cf_destroy_aabb_tree` when you're done using it.
- * @related  cf_make_aabb_tree cf_make_aabb_tree_from_memory
+ * @related  cf_make_aabb_tree cf_make_aabb_tree_from_memory cf_make_aabb_tree_view
  */
 CF_API void CF_CALL cf_destroy_aabb_tree(CF_AabbTree tree);
 
@@ -143,6 +244,50 @@ CF_API bool CF_CALL cf_aabb_tree_update_leaf(CF_AabbTree tree, CF_Leaf leaf, CF_
  */
 CF_API bool CF_CALL cf_aabb_tree_move(CF_AabbTree tree, CF_Leaf leaf, CF_Aabb aabb, CF_V2 offset);
 
+/**
+ * @function cf_aabb_tree_insert_many
+ * @category collision
+ * @brief    Adds many AABBs to the tree at once, then rebuilds the whole tree for fast queries.
+ * @param    tree       The tree.
+ * @param    aabbs      Array of `count` AABBs to insert.
+ * @param    udatas     Can be `NULL`. Array of `count` user data pointers, see `cf_aabb_tree_insert`.
+ * @param    count      The number of AABBs.
+ * @param    leaves     Can be `NULL`. Array of `count` leaves, set to the `CF_Leaf` of each inserted AABB.
+ * @remarks  Much faster than calling `cf_aabb_tree_insert` once per AABB, for example to load thousands of static tiles. The tree is
+ *           built top-down with a binned surface area heuristic, which usually gives a better tree than inserting one at a time.
+ *           Existing leaves are kept, though every branch is rebuilt, so this costs about the same for a big tree as loading it fresh.
+ * @related  cf_aabb_tree_insert cf_aabb_tree_rebuild cf_aabb_tree_update_leaves
+ */
+CF_API void CF_CALL cf_aabb_tree_insert_many(CF_AabbTree tree, const CF_Aabb* aabbs, void* const* udatas, int count, CF_Leaf* leaves);
+
+/**
+ * @function cf_aabb_tree_rebuild
+ * @category collision
+ * @brief    Rebuilds the tree's branches from scratch for fast queries.
+ * @param    tree       The tree.
+ * @remarks  Leaves are kept as they are. Useful now and then when `cf_aabb_tree_update_leaves` has loosened the tree, see `cf_aabb_tree_cost`.
+ * @related  cf_aabb_tree_insert_many cf_aabb_tree_update_leaves cf_aabb_tree_cost
+ */
+CF_API void CF_CALL cf_aabb_tree_rebuild(CF_AabbTree tree);
+
+/**
+ * @function cf_aabb_tree_update_leaves
+ * @category collision
+ * @brief    Moves many leaves at once, like calling `cf_aabb_tree_move` for each.
+ * @param    tree           The tree.
+ * @param    leaves         Array of `count` leaves to move.
+ * @param    aabbs          Array of `count` new AABBs, one per leaf.
+ * @param    offsets        Can be `NULL`. Array of `count` movement offsets, see `cf_aabb_tree_move`.
+ * @param    count          The number of leaves.
+ * @param    max_reinserts  The most leaves to reinsert into better spots in the tree. Zero only refits.
+ * @return   Returns the number of leaves whose internal AABB had to change.
+ * @remarks  Branches above moved leaves are refit once each, no matter how many leaves moved beneath them. Refitting keeps the tree
+ *           correct but lets it loosen over time, so the leaves that loosen it the most are reinserted, up to `max_reinserts` per call.
+ *           This bounds the work per frame while the tree keeps rebalancing itself over a few frames. `CF_Leaf` handles stay valid.
+ * @related  cf_aabb_tree_move cf_aabb_tree_insert_many cf_aabb_tree_rebuild
+ */
+CF_API int CF_CALL cf_aabb_tree_update_leaves(CF_AabbTree tree, const CF_Leaf* leaves, const CF_Aabb* aabbs, const CF_V2* offsets, int count, int max_reinserts);
+
 /**
  * @function cf_aabb_tree_get_aabb
  * @category collision
@@ -191,6 +336,147 @@ CF_API void CF_CALL cf_aabb_tree_query_aabb(const CF_AabbTree tree, CF_AabbTreeQ
  */
 CF_API void CF_CALL cf_aabb_tree_query_ray(const CF_AabbTree tree, CF_AabbTreeQueryFn* fn, CF_Ray ray, void* fn_udata);
 
+/**
+ * @function cf_aabb_tree_find_pairs
+ * @category collision
+ * @brief    Finds every pair of leaves within the tree whose AABBs overlap.
+ * @param    tree       The tree.
+ * @param    pairs      Array of at least `capacity` pairs to write into. Can be `NULL` if `capacity` is zero.
+ * @param    capacity   The number of pairs `pairs` can hold.
+ * @param    pool       Can be `NULL`. A threadpool to spread the search across, see `cf_make_threadpool`.
+ * @return   Returns the number of overlapping pairs, which may be more than `capacity`. Only the first `capacity` pairs are written.
+ * @remarks  This is the broadphase of a physics engine: each pair is reported once, and a leaf is never paired with itself. The tree
+ *           is walked against itself, instead of once per leaf with `cf_aabb_tree_query_aabb`, so each pair of subtrees is only visited
+ *           once. The order of the pairs doesn't depend on `pool`. If the return value is more than `capacity`, grow `pairs` and call
+ *           again. The tree must not be modified until this returns. Query-only trees, such as from `cf_make_aabb_tree_view`, aren't supported.
+ * @related  CF_AabbTreePair cf_aabb_tree_find_pairs cf_aabb_tree_find_pairs_with cf_aabb_tree_query_aabb_batch
+ */
+CF_API int CF_CALL cf_aabb_tree_find_pairs(const CF_AabbTree tree, CF_AabbTreePair* pairs, int capacity, CF_Threadpool* pool);
+
+/**
+ * @function cf_aabb_tree_find_pairs_with
+ * @category collision
+ * @brief    Finds every pair of leaves, one from each tree, whose AABBs overlap.
+ * @param    tree_a     The first tree. Its leaves are reported in `CF_AabbTreePair::a`.
+ * @param    tree_b     The second tree. Its leaves are reported in `CF_AabbTreePair::b`.
+ * @param    pairs      Array of at least `capacity` pairs to write into. Can be `NULL` if `capacity` is zero.
+ * @param    capacity   The number of pairs `pairs` can hold.
+ * @param    pool       Can be `NULL`. A threadpool to spread the search across, see `cf_make_threadpool`.
+ * @return   Returns the number of overlapping pairs, which may be more than `capacity`. Only the first `capacity` pairs are written.
+ * @remarks  Useful when static and dynamic objects live in separate trees. Passing the same tree twice is the same as `cf_aabb_tree_find_pairs`.
+ * @related  CF_AabbTreePair cf_aabb_tree_find_pairs cf_aabb_tree_find_pairs_with
+ */
+CF_API int CF_CALL cf_aabb_tree_find_pairs_with(const CF_AabbTree tree_a, const CF_AabbTree tree_b, CF_AabbTreePair* pairs, int capacity, CF_Threadpool* pool);
+
+/**
+ * @function cf_aabb_tree_query_aabb_batch
+ * @category collision
+ * @brief    Runs many `cf_aabb_tree_query_aabb` queries at once, writing hits into a preallocated array.
+ * @param    tree                The tree to query.
+ * @param    aabbs               Array of `count` AABBs to query.
+ * @param    count               The number of queries.
+ * @param    hits                Array of `count * max_hits_per_query` leaves. Query `i` writes its hits starting at `hits + i * max_hits_per_query`. Can be `NULL` to only count hits.
+ * @param    max_hits_per_query  The number of hits there is room for per query.
+ * @param    hit_counts          Array of `count` ints. Set to the number of hits for each query, which may be more than `max_hits_per_query`.
+ * @param    pool                Can be `NULL`. A threadpool to spread the queries across, see `cf_make_threadpool`.
+ * @remarks  No callbacks are involved, so queries can run on any thread. The tree must not be modified until this returns.
+ * @related  cf_aabb_tree_query_aabb cf_aabb_tree_query_aabb_batch cf_aabb_tree_query_ray_batch cf_aabb_tree_find_pairs
+ */
+CF_API void CF_CALL cf_aabb_tree_query_aabb_batch(const CF_AabbTree tree, const CF_Aabb* aabbs, int count, CF_Leaf* hits, int max_hits_per_query, int* hit_counts, CF_Threadpool* pool);
+
+/**
+ * @function cf_aabb_tree_query_ray_batch
+ * @category collision
+ * @brief    Runs many `cf_aabb_tree_query_ray` queries at once, writing hits into a preallocated array.
+ * @param    tree                The tree to query.
+ * @param    rays                Array of `count` rays to query.
+ * @param    count               The number of queries.
+ * @param    hits                Array of `count * max_hits_per_query` leaves. Query `i` writes its hits starting at `hits + i * max_hits_per_query`. Can be `NULL` to only count hits.
+ * @param    max_hits_per_query  The number of hits there is room for per query.
+ * @param    hit_counts          Array of `count` ints. Set to the number of hits for each query, which may be more than `max_hits_per_query`.
+ * @param    pool                Can be `NULL`. A threadpool to spread the queries across, see `cf_make_threadpool`.
+ * @remarks  Hits are leaves whose AABB the ray touches, not sorted by distance. The tree must not be modified until this returns.
+ * @related  cf_aabb_tree_query_ray cf_aabb_tree_query_aabb_batch cf_aabb_tree_query_ray_batch
+ */
+CF_API void CF_CALL cf_aabb_tree_query_ray_batch(const CF_AabbTree tree, const CF_Ray* rays, int count, CF_Leaf* hits, int max_hits_per_query, int* hit_counts, CF_Threadpool* pool);
+
+/**
+ * @function cf_aabb_tree_sweep
+ * @category collision
+ * @brief    Moves a shape through the tree and returns the first leaf it hits, in a single traversal.
+ * @param    tree       The tree to query.
+ * @param    shape      The shape to sweep, such as a `CF_Capsule` for a character.
+ * @param    type       The `CF_ShapeType` of `shape`.
+ * @param    transform  Can be `NULL` to represent an identity transform. Places `shape` at the start of the sweep.
+ * @param    motion     How far the shape moves.
+ * @param    fn         A callback `CF_AabbTreeSweepFn` you have implemented, handing back the shape of each leaf the sweep might hit.
+ * @param    fn_udata   Can be `NULL`. An optional user data pointer handed back to `fn`.
+ * @return   Returns the hit with the smallest time of impact, see `CF_AabbTreeSweepResult`.
+ * @remarks  This replaces querying the tree and then calling `cf_toi` against every candidate. Nodes are culled against the swept
+ *           bounds, and once a hit is found anything further along the motion is skipped. The shape does not rotate during the sweep.
+ * @related  CF_AabbTreeSweepFn CF_AabbTreeSweepResult cf_aabb_tree_sweep_cached cf_toi
+ */
+CF_API CF_AabbTreeSweepResult CF_CALL cf_aabb_tree_sweep(const CF_AabbTree tree, const void* shape, CF_ShapeType type, const CF_Transform* transform, CF_V2 motion, CF_AabbTreeSweepFn* fn, void* fn_udata);
+
+/**
+ * @function cf_make_aabb_tree_sweep_cache
+ * @category collision
+ * @brief    Makes a `CF_AabbTreeSweepCache`, usually one per character.
+ * @param    margin     How far past a sweep to gather leaves. Sweeps that stay within the margin reuse the gathered leaves.
+ * @related  CF_AabbTreeSweepCache cf_destroy_aabb_tree_sweep_cache cf_aabb_tree_sweep_cached
+ */
+CF_API CF_AabbTreeSweepCache CF_CALL cf_make_aabb_tree_sweep_cache(float margin);
+
+/**
+ * @function cf_destroy_aabb_tree_sweep_cache
+ * @category collision
+ * @brief    Destroys a `CF_AabbTreeSweepCache` made by `cf_make_aabb_tree_sweep_cache`.
+ * @related  CF_AabbTreeSweepCache cf_make_aabb_tree_sweep_cache cf_aabb_tree_sweep_cached
+ */
+CF_API void CF_CALL cf_destroy_aabb_tree_sweep_cache(CF_AabbTreeSweepCache cache);
+
+/**
+ * @function cf_aabb_tree_sweep_cached
+ * @category collision
+ * @brief    Same as `cf_aabb_tree_sweep`, but reuses the leaves gathered by an earlier sweep when the shape hasn't moved far.
+ * @param    tree       The tree to query.
+ * @param    cache      The cache of the shape being swept, see `cf_make_aabb_tree_sweep_cache`.
+ * @param    shape      The shape to sweep.
+ * @param    type       The `CF_ShapeType` of `shape`.
+ * @param    transform  Can be `NULL` to represent an identity transform. Places `shape` at the start of the sweep.
+ * @param    motion     How far the shape moves.
+ * @param    fn         A callback `CF_AabbTreeSweepFn` you have implemented, handing back the shape of each leaf the sweep might hit.
+ * @param    fn_udata   Can be `NULL`. An optional user data pointer handed back to `fn`.
+ * @return   Returns the same hit `cf_aabb_tree_sweep` would.
+ * @remarks  On a miss the cache gathers every leaf within `margin` of the sweep, and later sweeps inside that area only test those leaves.
+ *           Any insert, removal or growth of a leaf in `tree` drops every cache built from it, so this pays off for trees that rarely
+ *           change, like level geometry, and not for trees of things moving every frame.
+ * @related  CF_AabbTreeSweepCache cf_make_aabb_tree_sweep_cache cf_aabb_tree_sweep
+ */
+CF_API CF_AabbTreeSweepResult CF_CALL cf_aabb_tree_sweep_cached(const CF_AabbTree tree, CF_AabbTreeSweepCache cache, const void* shape, CF_ShapeType type, const CF_Transform* transform, CF_V2 motion, CF_AabbTreeSweepFn* fn, void* fn_udata);
+
+/**
+ * @function cf_aabb_tree_flatten
+ * @category collision
+ * @brief    Builds a query-optimized copy of the tree, used by queries until the tree is next modified.
+ * @param    tree       The tree.
+ * @remarks  The copy stores four children per node, so queries test four boxes at once with SIMD and visit about half as many
+ *           nodes. This is meant for trees that rarely change, such as level collision. Any insert, remove, or update throws the
+ *           copy away, and queries fall back to the regular tree until this is called again. Queries report the same leaves either
+ *           way, though possibly in a different order.
+ * @related  cf_aabb_tree_is_flattened cf_aabb_tree_query_aabb cf_aabb_tree_query_ray cf_aabb_tree_query_aabb_batch
+ */
+CF_API void CF_CALL cf_aabb_tree_flatten(CF_AabbTree tree);
+
+/**
+ * @function cf_aabb_tree_is_flattened
+ * @category collision
+ * @brief    Returns true if queries currently use the copy built by `cf_aabb_tree_flatten`.
+ * @param    tree       The tree.
+ * @related  cf_aabb_tree_flatten
+ */
+CF_API bool CF_CALL cf_aabb_tree_is_flattened(const CF_AabbTree tree);
+
 /**
  * @function cf_aabb_tree_cost
  * @category collision
@@ -226,8 +512,10 @@ CF_API size_t CF_CALL cf_aabb_tree_serialized_size(const CF_AabbTree tree);
  * @param    buffer     A buffer of at least `cf_aabb_tree_serialized_size` size to save the tree into as a byte-array.
  * @return   Returns true upon success, false otherwise.
  * @remarks  Call `cf_aabb_tree_serialized_size` to get the `size` parameter. This is useful to save a tree to disk or send a tree over
- *           the network. The main purpose is an optimization to avoid building the tree from scratch.
- * @related  cf_make_aabb_tree cf_aabb_tree_serialized_size
+ *           the network. The main purpose is an optimization to avoid building the tree from scratch. The tree is written in its flattened,
+ *           query-optimized form (see `cf_aabb_tree_flatten`), which `cf_make_aabb_tree_view` reads in place. Leaves are renumbered in
+ *           the saved tree, and user data pointers aren't saved.
+ * @related  cf_make_aabb_tree cf_make_aabb_tree_view cf_aabb_tree_serialized_size
  */
 CF_API bool CF_CALL cf_aabb_tree_serialize(const CF_AabbTree tree, void* buffer, size_t size);
 
@@ -248,18 +536,37 @@ using Leaf = CF_Leaf;
 using AabbTreeQueryFn = CF_AabbTreeQueryFn;
 using Aabb = CF_Aabb;
 using Ray = CF_Ray;
+using AabbTreePair = CF_AabbTreePair;
+using AabbTreeLeafShape = CF_AabbTreeLeafShape;
+using AabbTreeSweepFn = CF_AabbTreeSweepFn;
+using AabbTreeSweepResult = CF_AabbTreeSweepResult;
+using AabbTreeSweepCache = CF_AabbTreeSweepCache;
 
 CF_INLINE AabbTree make_aabb_tree(int initial_capacity = 0) { return cf_make_aabb_tree(initial_capacity); }
 CF_INLINE AabbTree make_aabb_tree_from_memory(const void* buffer, size_t size) { return cf_make_aabb_tree_from_memory(buffer, size); }
+CF_INLINE AabbTree make_aabb_tree_view(const void* buffer, size_t size) { return cf_make_aabb_tree_view(buffer, size); }
 CF_INLINE void destroy_aabb_tree(AabbTree tree) { cf_destroy_aabb_tree(tree); }
 CF_INLINE Leaf aabb_tree_insert(AabbTree tree, Aabb aabb, void* udata = NULL) { return cf_aabb_tree_insert(tree, aabb, udata); }
 CF_INLINE void aabb_tree_remove(AabbTree tree, Leaf leaf) { cf_aabb_tree_remove(tree, leaf); }
 CF_INLINE bool aabb_tree_update_leaf(AabbTree tree, Leaf leaf, Aabb aabb) { return cf_aabb_tree_update_leaf(tree, leaf, aabb); }
 CF_INLINE bool aabb_tree_move(AabbTree tree, Leaf leaf, Aabb aabb, v2 offset) { return cf_aabb_tree_move(tree, leaf, aabb, offset); }
+CF_INLINE void aabb_tree_insert_many(AabbTree tree, const Aabb* aabbs, void* const* udatas, int count, Leaf* leaves = NULL) { cf_aabb_tree_insert_many(tree, aabbs, udatas, count, leaves); }
+CF_INLINE void aabb_tree_rebuild(AabbTree tree) { cf_aabb_tree_rebuild(tree); }
+CF_INLINE int aabb_tree_update_leaves(AabbTree tree, const Leaf* leaves, const Aabb* aabbs, const v2* offsets, int count, int max_reinserts) { return cf_aabb_tree_update_leaves(tree, leaves, aabbs, offsets, count, max_reinserts); }
 CF_INLINE Aabb aabb_tree_get_aabb(AabbTree tree, Leaf leaf) { return cf_aabb_tree_get_aabb(tree, leaf); }
 CF_INLINE void* aabb_tree_get_udata(AabbTree tree, Leaf leaf) { return cf_aabb_tree_get_udata(tree, leaf); }
 CF_INLINE void aabb_tree_query(const AabbTree tree, AabbTreeQueryFn* fn, Aabb aabb, void* fn_udata = NULL) { cf_aabb_tree_query_aabb(tree, fn, aabb, fn_udata); }
 CF_INLINE void aabb_tree_query(const AabbTree tree, AabbTreeQueryFn* fn, Ray ray, void* fn_udata = NULL) { cf_aabb_tree_query_ray(tree, fn, ray, fn_udata); }
+CF_INLINE int aabb_tree_find_pairs(const AabbTree tree, AabbTreePair* pairs, int capacity, Threadpool* pool = NULL) { return cf_aabb_tree_find_pairs(tree, pairs, capacity, pool); }
+CF_INLINE int aabb_tree_find_pairs(const AabbTree tree_a, const AabbTree tree_b, AabbTreePair* pairs, int capacity, Threadpool* pool = NULL) { return cf_aabb_tree_find_pairs_with(tree_a, tree_b, pairs, capacity, pool); }
+CF_INLINE void aabb_tree_query_batch(const AabbTree tree, const Aabb* aabbs, int count, Leaf* hits, int max_hits_per_query, int* hit_counts, Threadpool* pool = NULL) { cf_aabb_tree_query_aabb_batch(tree, aabbs, count, hits, max_hits_per_query, hit_counts, pool); }
+CF_INLINE void aabb_tree_query_batch(const AabbTree tree, const Ray* rays, int count, Leaf* hits, int max_hits_per_query, int* hit_counts, Threadpool* pool = NULL) { cf_aabb_tree_query_ray_batch(tree, rays, count, hits, max_hits_per_query, hit_counts, pool); }
+CF_INLINE AabbTreeSweepResult aabb_tree_sweep(const AabbTree tree, const void* shape, ShapeType type, const Transform* transform, v2 motion, AabbTreeSweepFn* fn, void* fn_udata = NULL) { return cf_aabb_tree_sweep(tree, shape, type, transform, motion, fn, fn_udata); }
+CF_INLINE AabbTreeSweepCache make_aabb_tree_sweep_cache(float margin) { return cf_make_aabb_tree_sweep_cache(margin); }
+CF_INLINE void destroy_aabb_tree_sweep_cache(AabbTreeSweepCache cache) { cf_destroy_aabb_tree_sweep_cache(cache); }
+CF_INLINE AabbTreeSweepResult aabb_tree_sweep(const AabbTree tree, AabbTreeSweepCache cache, const void* shape, ShapeType type, const Transform* transform, v2 motion, AabbTreeSweepFn* fn, void* fn_udata = NULL) { return cf_aabb_tree_sweep_cached(tree, cache, shape, type, transform, motion, fn, fn_udata); }
+CF_INLINE void aabb_tree_flatten(AabbTree tree) { cf_aabb_tree_flatten(tree); }
+CF_INLINE bool aabb_tree_is_flattened(const AabbTree tree) { return cf_aabb_tree_is_flattened(tree); }
 CF_INLINE float aabb_tree_cost(const AabbTree tree) { return cf_aabb_tree_cost(tree); }
 CF_INLINE void aabb_tree_validate(const AabbTree tree) { cf_aabb_tree_validate(tree); }
 CF_INLINE size_t aabb_tree_serialized_size(const AabbTree tree) { return cf_aabb_tree_serialized_size(tree); }
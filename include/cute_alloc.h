@@ -9,6 +9,7 @@
 #define CF_ALLOC_H
 
 #include "cute_defines.h"
+#include "cute_result.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -98,6 +99,100 @@ CF_API void* CF_CALL cf_calloc(size_t size, size_t count);
  */
 CF_API void* CF_CALL cf_realloc(void* ptr, size_t size);
 
+//--------------------------------------------------------------------------------------------------
+// Allocation tracking.
+
+/**
+ * @struct   CF_AllocTagStats
+ * @category allocator
+ * @brief    Counters for all tracked allocations made under one tag.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_tracking_get_stats cf_alloc_tracking_dump
+ */
+typedef struct CF_AllocTagStats
+{
+	/* @member The tag passed to `cf_alloc_push_tag`, or "untagged" for allocations made outside of any tag. */
+	const char* tag;
+
+	/* @member Bytes currently allocated. */
+	uint64_t live_bytes;
+
+	/* @member Number of allocations not yet freed. */
+	int live_count;
+
+	/* @member The highest `live_bytes` has been since tracking was enabled. */
+	uint64_t peak_bytes;
+
+	/* @member Number of allocations made during the last frame. */
+	int frame_alloc_count;
+
+	/* @member Bytes allocated during the last frame. */
+	uint64_t frame_alloc_bytes;
+} CF_AllocTagStats;
+// @end
+
+/**
+ * @function cf_alloc_tracking_enable
+ * @category allocator
+ * @brief    Starts or stops recording every allocation made through `cf_alloc` and friends.
+ * @param    enabled       True to start tracking, false to stop.
+ * @remarks  Tracking is off by default, and costs next to nothing while it's off. While on, each allocation records its size, its
+ *           tag (see `cf_alloc_push_tag`), and for allocations made within CF its file and line, all behind a single lock. It's
+ *           meant for hunting down leaks and allocations made every frame, not for shipping. Memory allocated before tracking was
+ *           enabled is never counted. Stopping throws away everything recorded.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_tracking_get_stats cf_alloc_tracking_dump
+ */
+CF_API void CF_CALL cf_alloc_tracking_enable(bool enabled);
+
+/**
+ * @function cf_alloc_tracking_is_enabled
+ * @category allocator
+ * @brief    Returns true if allocations are being tracked.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_tracking_get_stats cf_alloc_tracking_dump
+ */
+CF_API bool CF_CALL cf_alloc_tracking_is_enabled();
+
+/**
+ * @function cf_alloc_push_tag
+ * @category allocator
+ * @brief    Tags all allocations made on the calling thread until the matching `cf_alloc_pop_tag`.
+ * @param    tag           The name of the tag. Must stay valid for the rest of the program, such as a string literal or a string from `sintern`.
+ * @remarks  Tags may nest, and the innermost one wins. CF tags its own subsystems as "draw", "ecs", "audio", "net", and "json". In C++
+ *           prefer `CF_ALLOC_TAG_SCOPE`. Pushing a tag is cheap and may be left in shipping code.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_pop_tag CF_ALLOC_TAG_SCOPE
+ */
+CF_API void CF_CALL cf_alloc_push_tag(const char* tag);
+
+/**
+ * @function cf_alloc_pop_tag
+ * @category allocator
+ * @brief    Pops the tag pushed by the last call to `cf_alloc_push_tag` on the calling thread.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_pop_tag CF_ALLOC_TAG_SCOPE
+ */
+CF_API void CF_CALL cf_alloc_pop_tag();
+
+/**
+ * @function cf_alloc_tracking_get_stats
+ * @category allocator
+ * @brief    Fetches counters for each tag seen since tracking was enabled.
+ * @param    stats         An array to fill in, can be `NULL`.
+ * @param    capacity      The number of elements in `stats`.
+ * @return   Returns the total number of tags. Only the first `capacity` are written to `stats`.
+ * @remarks  The per-frame counters cover the last whole frame, where a frame ends with each call to `cf_frame_arena_advance`.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_tracking_get_stats cf_alloc_tracking_dump
+ */
+CF_API int CF_CALL cf_alloc_tracking_get_stats(CF_AllocTagStats* stats, int capacity);
+
+/**
+ * @function cf_alloc_tracking_dump
+ * @category allocator
+ * @brief    Writes a text report of all tracked allocations to a file.
+ * @param    virtual_path  A virtual path (see: `cf_fs_set_write_directory`) to write the file to.
+ * @remarks  The report lists the counters of each tag, followed by every call site with live allocations, biggest first. Dumping
+ *           a few times over a long session and comparing the reports shows where memory is growing.
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_tracking_get_stats cf_alloc_tracking_dump
+ */
+CF_API CF_Result CF_CALL cf_alloc_tracking_dump(const char* virtual_path);
+
 //--------------------------------------------------------------------------------------------------
 // Overload operator new ourselves.
 // This avoids including thousands of lines of code in <new>, and also lets us hook up our own
@@ -146,8 +241,10 @@ CF_API void CF_CALL cf_aligned_free(void* ptr);
  * @struct   CF_Arena
  * @category allocator
  * @brief    A simple way to allocate memory without calling `malloc` too often.
- * @remarks  Individual allocations cannot be free'd, instead the entire allocator can reset.
- * @related  cf_arena_init cf_arena_alloc cf_arena_reset
+ * @remarks  Individual allocations cannot be free'd. Instead the whole arena can be reset, or rolled back to a marker from
+ *           `cf_arena_mark` with `cf_arena_rewind`. Blocks are chained on as needed, and are kept for reuse after a rewind.
+ *           Arenas from `cf_arena_init_virtual` use one reserved address range instead of blocks.
+ * @related  CF_Arena CF_ArenaMarker cf_arena_init cf_arena_init_virtual cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset cf_arena_destroy
  */
 typedef struct CF_Arena
 {
@@ -155,10 +252,34 @@ typedef struct CF_Arena
 	int block_size;
 	char* ptr;
 	char* end;
+	// The number of blocks in use. `ptr` points into the last one, the rest are spare blocks left over from before a rewind.
+	int used_blocks;
 	char** blocks;
+	size_t* block_sizes;
+	// Set by `cf_arena_init_virtual`, the reserved address range. `end` marks how much of it is committed.
+	char* base;
+	size_t reserve_size;
+	bool huge_pages;
 } CF_Arena;
 // @end
 
+/**
+ * @struct   CF_ArenaMarker
+ * @category allocator
+ * @brief    A saved position within a `CF_Arena`, see `cf_arena_mark`.
+ * @remarks  A zero-initialized marker refers to the start of the arena.
+ * @related  CF_Arena CF_ArenaMarker cf_arena_mark cf_arena_rewind
+ */
+typedef struct CF_ArenaMarker
+{
+	/* @member The number of blocks in use when the marker was made. */
+	int used_blocks;
+
+	/* @member The position within the last block in use. */
+	char* ptr;
+} CF_ArenaMarker;
+// @end
+
 /**
  * @function cf_arena_init
  * @category allocator
@@ -166,30 +287,212 @@ typedef struct CF_Arena
  * @param    arena         The arena to initialize.
  * @param    alignment     An alignment boundary, must be a power of two.
  * @param    block_size    The default size of each internal call to `malloc` to form pages to further allocate from.
- * @related  cf_arena_alloc cf_arena_reset
+ * @related  CF_Arena cf_arena_init cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset
  */
 CF_API void CF_CALL cf_arena_init(CF_Arena* arena, int alignment, int block_size);
 
+/**
+ * @function cf_arena_init_virtual
+ * @category allocator
+ * @brief    Initializes an arena that allocates from one large range of virtual memory, reserved up front.
+ * @param    arena         The arena to initialize.
+ * @param    alignment     An alignment boundary, must be a power of two.
+ * @param    reserve_size  The most the arena can ever hold, in bytes. Only address space is reserved, so this can be far bigger
+ *                         than what's actually used, such as 1GB on 64-bit platforms.
+ * @param    huge_pages    True to back the arena with huge pages (2MB on most platforms) when the system allows it.
+ * @return   Returns true if the range was reserved, false if the arena fell back to the blocks of `cf_arena_init`.
+ * @remarks  Pages are committed on demand as the arena grows and stay committed afterwards, so `cf_arena_reset` and
+ *           `cf_arena_rewind` only move a pointer back. A frame allocator or snapshot buffer reset every frame never goes back to
+ *           the heap or page faults again once warmed up, and allocations are contiguous. Call `cf_arena_destroy` to hand the
+ *           memory back. Allocations return `NULL` once `reserve_size` runs out.
+ *
+ *           Huge pages cut down on TLB misses for large arenas. On Linux explicit huge pages (MAP_HUGETLB) are tried first, which
+ *           need pages set aside by the system administrator, then transparent huge pages. On Windows large pages need the
+ *           "Lock pages in memory" privilege, and are committed all at once. Otherwise regular pages are used. On platforms
+ *           without virtual memory, such as the web, this falls back to `cf_arena_init` with 1MB blocks.
+ * @related  CF_Arena cf_arena_init cf_arena_init_virtual cf_arena_alloc cf_arena_reset cf_arena_destroy
+ */
+CF_API bool CF_CALL cf_arena_init_virtual(CF_Arena* arena, int alignment, size_t reserve_size, bool huge_pages);
+
 /**
  * @function cf_arena_alloc
  * @category allocator
  * @brief    Allocates a block of memory aligned along a byte boundary.
  * @param    arena         The arena to allocate from.
- * @param    size          The size of the allocation, it cannot be larger than `block_size` from `cf_arena_init`.
- * @return   Returns an aligned pointer of `size` bytes.
- * @related  cf_arena_init cf_arena_reset
+ * @param    size          The size of the allocation.
+ * @return   Returns a pointer of `size` bytes aligned to the `alignment` from `cf_arena_init`.
+ * @remarks  Allocations larger than `block_size` from `cf_arena_init` get a block of their own.
+ * @related  CF_Arena cf_arena_init cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset
  */
 CF_API void* CF_CALL cf_arena_alloc(CF_Arena* arena, size_t size);
 
+/**
+ * @function cf_arena_alloc_aligned
+ * @category allocator
+ * @brief    Allocates a block of memory aligned along a specific byte boundary.
+ * @param    arena         The arena to allocate from.
+ * @param    size          The size of the allocation.
+ * @param    alignment     An alignment boundary, must be a power of two no larger than 256.
+ * @return   Returns a pointer of `size` bytes aligned to `alignment`.
+ * @related  CF_Arena cf_arena_init cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset
+ */
+CF_API void* CF_CALL cf_arena_alloc_aligned(CF_Arena* arena, size_t size, int alignment);
+
+/**
+ * @function cf_arena_mark
+ * @category allocator
+ * @brief    Returns a marker for the arena's current position, to later roll back to with `cf_arena_rewind`.
+ * @param    arena         The arena.
+ * @example  > Scoped temporary allocations.
+ *     CF_ArenaMarker marker = cf_arena_mark(&arena);
+ *     char* scratch = (char*)cf_arena_alloc(&arena, 1024);
+ *     // ... use scratch ...
+ *     cf_arena_rewind(&arena, marker);
+ * @related  CF_Arena CF_ArenaMarker cf_arena_init cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset
+ */
+CF_API CF_ArenaMarker CF_CALL cf_arena_mark(CF_Arena* arena);
+
+/**
+ * @function cf_arena_rewind
+ * @category allocator
+ * @brief    Frees everything allocated since `marker` was made by `cf_arena_mark`.
+ * @param    arena         The arena.
+ * @param    marker        A marker from `cf_arena_mark`, or a zero-initialized marker to free everything.
+ * @remarks  No memory is handed back to the system, so allocating after a rewind reuses the same blocks. Markers may nest, but once
+ *           rewound past a marker, that marker must not be used again. Call `cf_arena_reset` to free the blocks.
+ * @related  CF_Arena CF_ArenaMarker cf_arena_init cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset
+ */
+CF_API void CF_CALL cf_arena_rewind(CF_Arena* arena, CF_ArenaMarker marker);
+
 /**
  * @function cf_arena_reset
  * @category allocator
  * @brief    Free's up all resources used by the allocator and places it back into an initialized state.
  * @param    arena         The arena to reset.
- * @related  cf_arena_init cf_arena_alloc
+ * @remarks  Arenas from `cf_arena_init_virtual` keep their memory, and only rewind to the start.
+ * @related  CF_Arena cf_arena_init cf_arena_alloc cf_arena_alloc_aligned cf_arena_mark cf_arena_rewind cf_arena_reset cf_arena_destroy
  */
 CF_API void CF_CALL cf_arena_reset(CF_Arena* arena);
 
+/**
+ * @function cf_arena_destroy
+ * @category allocator
+ * @brief    Frees all memory of an arena, including the reserved range of `cf_arena_init_virtual`.
+ * @param    arena         The arena to destroy. It must be initialized again before further use.
+ * @related  CF_Arena cf_arena_init cf_arena_init_virtual cf_arena_reset cf_arena_destroy
+ */
+CF_API void CF_CALL cf_arena_destroy(CF_Arena* arena);
+
+//--------------------------------------------------------------------------------------------------
+// Frame allocator.
+
+/**
+ * @function cf_frame_alloc
+ * @category allocator
+ * @brief    Allocates temporary memory that frees itself at the end of the next frame.
+ * @param    size          The size of the allocation in bytes.
+ * @return   Returns a 16-byte aligned pointer of `size` bytes.
+ * @remarks  Each thread allocates from its own pair of arenas, so this is safe to call from any thread without taking a lock.
+ *           Memory stays valid until the end of the frame after the one it was allocated in, where a frame ends with each call to
+ *           `cf_frame_arena_advance`. This is great for temporaries such as formatted strings handed to `cf_draw_text`, or scratch
+ *           arrays, without any calls to `cf_free` and without the cost of going to the heap every frame. Never call `cf_free` on
+ *           the returned pointer.
+ * @related  cf_frame_alloc cf_frame_calloc cf_frame_fmt cf_frame_arena_advance
+ */
+CF_API void* CF_CALL cf_frame_alloc(size_t size);
+
+/**
+ * @function cf_frame_calloc
+ * @category allocator
+ * @brief    Allocates `size * count` bytes of zeroed temporary memory that frees itself at the end of the next frame.
+ * @param    size          The size of each element in bytes.
+ * @param    count         The number of elements.
+ * @remarks  See `cf_frame_alloc` for details.
+ * @related  cf_frame_alloc cf_frame_calloc cf_frame_fmt cf_frame_arena_advance
+ */
+CF_API void* CF_CALL cf_frame_calloc(size_t size, size_t count);
+
+/**
+ * @function cf_frame_fmt
+ * @category allocator
+ * @brief    Printf's into a temporary C string that frees itself at the end of the next frame.
+ * @param    fmt           The format string.
+ * @param    ...           The parameters for the format string.
+ * @remarks  The result is a plain C string, not a dynamic string from `cute_string.h`. See `cf_frame_alloc` for details.
+ *           Short strings are formatted once on the stack, taking the fast path of `sfmt` where it applies.
+ * @example  > Drawing a formatted string without any cleanup.
+ *     cf_draw_text(cf_frame_fmt("HP: %d", hp), cf_v2(0, 0), -1);
+ * @related  cf_frame_alloc cf_frame_calloc cf_frame_fmt cf_frame_arena_advance
+ */
+CF_API char* CF_CALL cf_frame_fmt(const char* fmt, ...);
+
+/**
+ * @function cf_frame_arena_advance
+ * @category allocator
+ * @brief    Ends the current frame for `cf_frame_alloc`, freeing up memory allocated the frame before.
+ * @remarks  This is called for you at the end of `cf_app_draw_onto_screen`, so you only need to call it if you don't use the app,
+ *           such as on a dedicated server.
+ * @related  cf_frame_alloc cf_frame_calloc cf_frame_fmt cf_frame_arena_advance
+ */
+CF_API void CF_CALL cf_frame_arena_advance();
+
+//--------------------------------------------------------------------------------------------------
+// Pool allocator.
+
+/**
+ * @struct   CF_PoolAllocatorStats
+ * @category allocator
+ * @brief    Counters describing the state of the allocator from `cf_pool_allocator`.
+ * @related  CF_PoolAllocatorStats cf_pool_allocator cf_pool_allocator_stats
+ */
+typedef struct CF_PoolAllocatorStats
+{
+	/* @member Bytes reserved from the system for small allocations. These are kept for reuse, and never handed back to the system. */
+	uint64_t bytes_reserved;
+
+	/* @member Number of live allocations too large for any size class, which go straight to `malloc`. */
+	int large_allocation_count;
+
+	/* @member Number of times a thread ran out of cached blocks and fetched a batch from the shared depot. */
+	int refill_count;
+
+	/* @member Number of times a thread cached too many blocks and handed a batch back to the shared depot. */
+	int return_count;
+} CF_PoolAllocatorStats;
+// @end
+
+/**
+ * @function cf_pool_allocator
+ * @category allocator
+ * @brief    Returns a thread-safe general purpose allocator tuned for many small allocations.
+ * @remarks  Allocations of up to 2048 bytes are rounded up to one of a few size classes and served from large slabs. Each thread
+ *           keeps its own cache of free blocks for every size class, so most calls to alloc and free never take a lock. Threads
+ *           trade blocks with a shared depot a whole batch at a time, so memory freed on one thread is reused by the others.
+ *           Larger allocations go straight to `malloc`. All allocations are 16-byte aligned.
+ *           
+ *           Pass the result to `cf_allocator_override` to use it for all of CF's allocations. This must be done before anything
+ *           else is allocated, such as first thing in `main`, since the pool allocator can't free memory it didn't allocate.
+ * @example  > Making the pool allocator the default.
+ *     int main(int argc, char* argv[])
+ *     {
+ *         cf_allocator_override(cf_pool_allocator());
+ *         cf_make_app("Fancy Window Title", 0, 0, 0, 640, 480, CF_APP_OPTIONS_WINDOW_POS_CENTERED_BIT, argv[0]);
+ *         // ...
+ *     }
+ * @related  CF_PoolAllocatorStats cf_pool_allocator cf_pool_allocator_stats cf_allocator_override
+ */
+CF_API CF_Allocator CF_CALL cf_pool_allocator();
+
+/**
+ * @function cf_pool_allocator_stats
+ * @category allocator
+ * @brief    Returns counters describing the state of the allocator from `cf_pool_allocator`.
+ * @remarks  Useful for tuning, or for spotting leaks of large allocations. A high `refill_count` or `return_count` relative to the
+ *           number of allocations means memory keeps moving between threads, for example allocated on one thread and freed on another.
+ * @related  CF_PoolAllocatorStats cf_pool_allocator cf_pool_allocator_stats
+ */
+CF_API CF_PoolAllocatorStats CF_CALL cf_pool_allocator_stats();
+
 //--------------------------------------------------------------------------------------------------
 // Memory pool allocator.
 
@@ -256,6 +559,34 @@ CF_API void CF_CALL cf_memory_pool_free(CF_MemoryPool* pool, void* element);
 }
 #endif // __cplusplus
 
+#ifdef CF_CPP
+
+struct CF_AllocTagScope
+{
+	CF_AllocTagScope(const char* tag) { cf_alloc_push_tag(tag); }
+	~CF_AllocTagScope() { cf_alloc_pop_tag(); }
+};
+
+#define CF_ALLOC_TOKEN_PASTE_HELPER(X, Y) X ## Y
+#define CF_ALLOC_TOKEN_PASTE(X, Y) CF_ALLOC_TOKEN_PASTE_HELPER(X, Y)
+
+/**
+ * @function CF_ALLOC_TAG_SCOPE
+ * @category allocator
+ * @brief    Tags all allocations made from here until the end of the enclosing scope.
+ * @param    tag           The name of the tag, see `cf_alloc_push_tag`.
+ * @example  > Tagging a subsystem's allocations.
+ *     void update_pathfinding()
+ *     {
+ *         CF_ALLOC_TAG_SCOPE("pathfinding");
+ *         // ...
+ *     }
+ * @related  CF_AllocTagStats cf_alloc_tracking_enable cf_alloc_push_tag cf_alloc_pop_tag CF_ALLOC_TAG_SCOPE
+ */
+#define CF_ALLOC_TAG_SCOPE(tag) CF_AllocTagScope CF_ALLOC_TOKEN_PASTE(cf_alloc_tag_scope_, __LINE__)(tag)
+
+#endif // CF_CPP
+
 //--------------------------------------------------------------------------------------------------
 // C++ API
 
@@ -264,14 +595,40 @@ CF_API void CF_CALL cf_memory_pool_free(CF_MemoryPool* pool, void* element);
 namespace Cute
 {
 
+using AllocTagStats = CF_AllocTagStats;
+
+CF_INLINE void alloc_tracking_enable(bool enabled) { cf_alloc_tracking_enable(enabled); }
+CF_INLINE bool alloc_tracking_is_enabled() { return cf_alloc_tracking_is_enabled(); }
+CF_INLINE void alloc_push_tag(const char* tag) { cf_alloc_push_tag(tag); }
+CF_INLINE void alloc_pop_tag() { cf_alloc_pop_tag(); }
+CF_INLINE int alloc_tracking_get_stats(AllocTagStats* stats, int capacity) { return cf_alloc_tracking_get_stats(stats, capacity); }
+CF_INLINE Result alloc_tracking_dump(const char* virtual_path) { return cf_alloc_tracking_dump(virtual_path); }
+
 CF_INLINE void* aligned_alloc(size_t size, int alignment) { return cf_aligned_alloc(size, alignment); }
 CF_INLINE void aligned_free(void* ptr) { return cf_aligned_free(ptr); }
 
 using Arena = CF_Arena;
 
 CF_INLINE void arena_init(CF_Arena* arena, int alignment, int block_size) { cf_arena_init(arena, alignment, block_size); }
+CF_INLINE bool arena_init_virtual(CF_Arena* arena, int alignment, size_t reserve_size, bool huge_pages = false) { return cf_arena_init_virtual(arena, alignment, reserve_size, huge_pages); }
 CF_INLINE void* arena_alloc(CF_Arena* arena, size_t size) { return cf_arena_alloc(arena, size); }
+CF_INLINE void* arena_alloc_aligned(CF_Arena* arena, size_t size, int alignment) { return cf_arena_alloc_aligned(arena, size, alignment); }
 CF_INLINE void arena_reset(CF_Arena* arena) { return cf_arena_reset(arena); }
+CF_INLINE void arena_destroy(CF_Arena* arena) { cf_arena_destroy(arena); }
+
+using ArenaMarker = CF_ArenaMarker;
+
+CF_INLINE ArenaMarker arena_mark(CF_Arena* arena) { return cf_arena_mark(arena); }
+CF_INLINE void arena_rewind(CF_Arena* arena, ArenaMarker marker) { cf_arena_rewind(arena, marker); }
+
+CF_INLINE void* frame_alloc(size_t size) { return cf_frame_alloc(size); }
+CF_INLINE void* frame_calloc(size_t size, size_t count) { return cf_frame_calloc(size, count); }
+CF_INLINE void frame_arena_advance() { cf_frame_arena_advance(); }
+
+using PoolAllocatorStats = CF_PoolAllocatorStats;
+
+CF_INLINE CF_Allocator pool_allocator() { return cf_pool_allocator(); }
+CF_INLINE PoolAllocatorStats pool_allocator_stats() { return cf_pool_allocator_stats(); }
 
 using MemoryPool = CF_MemoryPool;
 
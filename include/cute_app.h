@@ -166,6 +166,12 @@ CF_API CF_DisplayOrientation CF_CALL cf_display_orientation(int display_index);
 	CF_ENUM(APP_OPTIONS_FILE_SYSTEM_DONT_DEFAULT_MOUNT, 1 << 5) \
 	/* @entry Starts the application with no audio. */           \
 	CF_ENUM(APP_OPTIONS_NO_AUDIO,                       1 << 6) \
+	/* @entry Starts the audio mixer without an audio device, for benchmarks or tests. Mix samples yourself with `cf_audio_render`. */ \
+	CF_ENUM(APP_OPTIONS_NO_AUDIO_DEVICE,                1 << 7) \
+	/* @entry For dedicated servers, tests and batch simulations. Implies `APP_OPTIONS_NO_GFX`, `APP_OPTIONS_NO_AUDIO` and `APP_OPTIONS_FILE_SYSTEM_DONT_DEFAULT_MOUNT`, creates no window and no threadpool. Draw functions are accepted and ignored. */ \
+	CF_ENUM(APP_OPTIONS_HEADLESS,                       1 << 8) \
+	/* @entry Waits to open the audio device and start the mixer until the first sound or music is played (or any other audio function needing the mixer is called), or until `cf_app_init_audio`. Speeds up startup for tools and launchers that may never play a sound. */ \
+	CF_ENUM(APP_OPTIONS_LAZY_AUDIO,                     1 << 9) \
 	/* @end */
 
 typedef enum CF_AppOptions
@@ -571,6 +577,17 @@ CF_API ImGuiContext* CF_CALL cf_app_init_imgui(bool no_default_font /*= false*/)
  */
 CF_API sg_imgui_t* CF_CALL cf_app_get_sokol_imgui();
 
+/**
+ * @function cf_app_init_audio
+ * @category app
+ * @brief    Opens the audio device and starts the mixer, if it was put off by `APP_OPTIONS_LAZY_AUDIO`.
+ * @return   Returns any errors as `CF_Result`.
+ * @remarks  Does nothing if audio is already running, or the app was made with `APP_OPTIONS_NO_AUDIO`. Call this during a loading screen
+ *           to avoid a hitch the first time a sound plays.
+ * @related  CF_AppOptions cf_make_app CF_StartupTimings
+ */
+CF_API CF_Result CF_CALL cf_app_init_audio();
+
 /**
  * @function cf_app_get_canvas
  * @category app
@@ -609,6 +626,69 @@ CF_API int CF_CALL cf_app_get_canvas_width();
  */
 CF_API int CF_CALL cf_app_get_canvas_height();
 
+/**
+ * @struct   CF_DynamicResolution
+ * @category app
+ * @brief    Settings for automatically scaling the app's canvas to hold a GPU frame time, see `cf_app_set_dynamic_resolution`.
+ * @related  CF_DynamicResolution cf_dynamic_resolution_defaults cf_app_set_dynamic_resolution cf_app_get_resolution_scale
+ */
+typedef struct CF_DynamicResolution
+{
+	/* @member GPU time per frame to aim for, in milliseconds. Leave some room under your frame budget, e.g. 14 for 60 fps. */
+	float target_milliseconds;
+
+	/* @member Smallest scale of the canvas relative to the size from `cf_app_set_canvas_size`, e.g. 0.5 for half width and height. */
+	float min_scale;
+
+	/* @member Largest scale of the canvas, at most 1. */
+	float max_scale;
+
+	/* @member Number of canvas sizes between `min_scale` and `max_scale`, at least 2. Each is made the first time it's used, then kept. */
+	int levels;
+} CF_DynamicResolution;
+// @end
+
+/**
+ * @function cf_dynamic_resolution_defaults
+ * @category app
+ * @brief    Returns good default settings for `cf_app_set_dynamic_resolution`.
+ * @related  CF_DynamicResolution cf_dynamic_resolution_defaults cf_app_set_dynamic_resolution cf_app_get_resolution_scale
+ */
+CF_INLINE CF_DynamicResolution CF_CALL cf_dynamic_resolution_defaults()
+{
+	CF_DynamicResolution params;
+	params.target_milliseconds = 14.0f;
+	params.min_scale = 0.5f;
+	params.max_scale = 1.0f;
+	params.levels = 6;
+	return params;
+}
+
+/**
+ * @function cf_app_set_dynamic_resolution
+ * @category app
+ * @brief    Turns on dynamic resolution, which renders the app's canvas smaller when the GPU falls behind. Off by default.
+ * @param    params     The settings, or `NULL` to turn dynamic resolution off and go back to the full size canvas.
+ * @remarks  Meant for fill-rate bound devices, where drawing fewer pixels is the cheapest way to hold the frame rate. Each frame the
+ *           GPU time of the whole frame is read back (see `cf_query_gpu_timings`, GPU timing is turned on for you). Running over
+ *           `target_milliseconds` steps the canvas down one size, while running comfortably under it steps back up, and the canvas is
+ *           upscaled onto the screen. Timings arrive a few frames late, so steps are spaced out to see the effect of the last one.
+ *
+ *           Does nothing where `cf_gpu_timing_supported` returns false. The draw API is unaffected, as the camera still maps onto the
+ *           whole canvas, but `cf_app_get_canvas` returns a different canvas whenever the size changes.
+ * @related  CF_DynamicResolution cf_dynamic_resolution_defaults cf_app_set_dynamic_resolution cf_app_get_resolution_scale
+ */
+CF_API void CF_CALL cf_app_set_dynamic_resolution(const CF_DynamicResolution* params);
+
+/**
+ * @function cf_app_get_resolution_scale
+ * @category app
+ * @brief    Returns the current scale of the app's canvas, which is 1 unless dynamic resolution has scaled it down.
+ * @remarks  The canvas is `cf_app_get_canvas_width` by `cf_app_get_canvas_height` times this scale, rounded.
+ * @related  CF_DynamicResolution cf_dynamic_resolution_defaults cf_app_set_dynamic_resolution cf_app_get_resolution_scale
+ */
+CF_API float CF_CALL cf_app_get_resolution_scale();
+
 /**
  * @function cf_app_set_vsync
  * @category app
@@ -625,6 +705,31 @@ CF_API void CF_CALL cf_app_set_vsync(bool true_turn_on_vsync);
  */
 CF_API bool CF_CALL cf_app_get_vsync();
 
+/**
+ * @function cf_app_set_pipelined_rendering
+ * @category app
+ * @brief    Overlaps turning draw API geometry into vertices with your next frame. Off by default.
+ * @param    true_to_pipeline  True to pipeline frames.
+ * @remarks  `cf_app_draw_onto_screen` still sorts and batches the frame's geometry, but fills in the vertices on a worker thread
+ *           and returns without waiting, leaving the game free to simulate the next frame in the meantime. The GPU work for the
+ *           frame is issued at the top of the next `cf_app_draw_onto_screen`, on the main thread, since the graphics backends must
+ *           be driven from the thread that owns the window. The frame is buffered once, so what's on screen lags behind by one frame.
+ *
+ *           Only geometry left over for the app canvas is pipelined, calls to `cf_render_to` behave as usual. Canvases, textures and
+ *           static geometry drawn during a frame must stay alive until the next `cf_app_draw_onto_screen`. The vertex callback from
+ *           `cf_set_vertex_callback` runs on the worker thread. Frames that delay defragging, see `cf_fetch_image`, aren't pipelined.
+ * @related  cf_app_set_pipelined_rendering cf_app_get_pipelined_rendering cf_app_draw_onto_screen
+ */
+CF_API void CF_CALL cf_app_set_pipelined_rendering(bool true_to_pipeline);
+
+/**
+ * @function cf_app_get_pipelined_rendering
+ * @category app
+ * @brief    Returns true if frames are pipelined, see `cf_app_set_pipelined_rendering`.
+ * @related  cf_app_set_pipelined_rendering cf_app_get_pipelined_rendering cf_app_draw_onto_screen
+ */
+CF_API bool CF_CALL cf_app_get_pipelined_rendering();
+
 /**
  * @function cf_app_set_windowed_mode
  * @category app
@@ -737,6 +842,126 @@ typedef struct CF_PowerInfo
  */
 CF_API CF_PowerInfo CF_CALL cf_app_power_info();
 
+/**
+ * @struct   CF_FrameStats
+ * @category app
+ * @brief    Counters describing the work done by each subsystem over one frame, see `cf_app_get_frame_stats`.
+ * @remarks  Meant to be kept on screen on test devices (see `cf_app_frame_stats_imgui_window`), or logged every so often, to spot
+ *           regressions as they happen. Counters are cheap enough to always be on.
+ * @related  CF_FrameStats cf_app_get_frame_stats cf_app_frame_stats_imgui_window CF_RenderStats
+ */
+typedef struct CF_FrameStats
+{
+	/* @member Number of calls to `cf_draw_elements`, see `CF_RenderStats`. */
+	int draw_calls;
+
+	/* @member Vertices sent to the GPU through `cf_mesh_update_vertex_data` and `cf_mesh_append_vertex_data`. */
+	int vertices_uploaded;
+
+	/* @member Batches of sprites, shapes and text flushed by the draw API. */
+	int batches;
+
+	/* @member Number of texture atlases the draw API currently has built. */
+	int atlas_count;
+
+	/* @member Milliseconds spent rebuilding atlases, see `cf_render_settings_defrag_budget`. */
+	float defrag_milliseconds;
+
+	/* @member Glyphs rendered into pixels, which happens the first time each glyph is drawn at a given size and blur. */
+	int glyphs_rasterized;
+
+	/* @member Entities handed to system update functions by `cf_run_systems`, and to `cf_query_for_each`. */
+	int entities_iterated;
+
+	/* @member Calls to `cf_alloc`, `cf_calloc` and `cf_realloc` from any thread. */
+	int alloc_count;
+
+	/* @member Bytes requested by `alloc_count`'s calls. */
+	uint64_t alloc_bytes;
+
+	/* @member Sounds, including music, being mixed at the end of the frame. */
+	int audio_voices;
+
+	/* @member Bytes received over every client and server's socket, including packet headers. */
+	uint64_t net_bytes_received;
+
+	/* @member Bytes sent over every client and server's socket, including packet headers. */
+	uint64_t net_bytes_sent;
+
+	/* @member HTTPS requests made and not yet destroyed with `cf_https_destroy`. */
+	int https_requests;
+} CF_FrameStats;
+// @end
+
+/**
+ * @function cf_app_get_frame_stats
+ * @category app
+ * @brief    Returns `CF_FrameStats` for the most recently completed frame.
+ * @remarks  A frame runs from one call of `cf_app_update` to the next, so this covers your update, drawing, and the
+ *           `cf_app_draw_onto_screen` in between.
+ * @related  CF_FrameStats cf_app_get_frame_stats cf_app_frame_stats_imgui_window
+ */
+CF_API CF_FrameStats CF_CALL cf_app_get_frame_stats();
+
+/**
+ * @function cf_app_frame_stats_imgui_window
+ * @category app
+ * @brief    Shows `cf_app_get_frame_stats` in a small Dear ImGui window.
+ * @remarks  Call once per frame after `cf_app_init_imgui`, does nothing otherwise.
+ * @related  CF_FrameStats cf_app_get_frame_stats cf_app_frame_stats_imgui_window cf_app_init_imgui
+ */
+CF_API void CF_CALL cf_app_frame_stats_imgui_window();
+
+/**
+ * @struct   CF_StartupTimings
+ * @category app
+ * @brief    Milliseconds spent bringing up each subsystem, see `cf_app_get_startup_timings`.
+ * @remarks  Subsystems brought up on first use stay at zero until then, and aren't counted in `total_milliseconds`.
+ * @related  CF_StartupTimings cf_app_get_startup_timings cf_make_app
+ */
+typedef struct CF_StartupTimings
+{
+	/* @member `SDL_Init` for the timer, event, video and gamepad subsystems. */
+	float sdl_milliseconds;
+
+	/* @member Creating the window. */
+	float window_milliseconds;
+
+	/* @member Creating the graphics context and device. */
+	float gfx_milliseconds;
+
+	/* @member The draw API, the screen canvases and their shaders. */
+	float draw_milliseconds;
+
+	/* @member Opening the audio device and starting the mixer, see `APP_OPTIONS_LAZY_AUDIO`. */
+	float audio_milliseconds;
+
+	/* @member Spawning the threadpool's threads. */
+	float threadpool_milliseconds;
+
+	/* @member Setting up the file system and mounting the base directory. */
+	float file_system_milliseconds;
+
+	/* @member All of `cf_make_app`. */
+	float total_milliseconds;
+
+	/* @member Parsing the default font, which happens the first time text is drawn or measured. */
+	float default_font_milliseconds;
+
+	/* @member `cf_app_init_imgui`. */
+	float imgui_milliseconds;
+} CF_StartupTimings;
+// @end
+
+/**
+ * @function cf_app_get_startup_timings
+ * @category app
+ * @brief    Returns a breakdown of the time spent starting up, see `CF_StartupTimings`.
+ * @remarks  Handy to log once after the first frame, to see where a slow cold start goes.
+ * @related  CF_StartupTimings cf_make_app cf_app_init_audio
+ */
+CF_API CF_StartupTimings CF_CALL cf_app_get_startup_timings();
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -757,6 +982,8 @@ enum : int
 };
 
 using PowerInfo = CF_PowerInfo;
+using FrameStats = CF_FrameStats;
+using StartupTimings = CF_StartupTimings;
 
 using DisplayOrientation = CF_DisplayOrientation;
 #define CF_ENUM(K, V) CF_INLINE constexpr DisplayOrientation K = CF_##K;
@@ -818,6 +1045,8 @@ CF_INLINE int app_get_canvas_width() { return cf_app_get_canvas_width(); }
 CF_INLINE int app_get_canvas_height() { return cf_app_get_canvas_height(); }
 CF_INLINE void app_set_vsync(bool true_turn_on_vsync) { cf_app_set_vsync(true_turn_on_vsync); }
 CF_INLINE bool app_get_vsync() { return cf_app_get_vsync(); }
+CF_INLINE void app_set_pipelined_rendering(bool true_to_pipeline) { cf_app_set_pipelined_rendering(true_to_pipeline); }
+CF_INLINE bool app_get_pipelined_rendering() { return cf_app_get_pipelined_rendering(); }
 CF_INLINE void app_set_windowed_mode() { cf_app_set_windowed_mode(); }
 CF_INLINE void app_set_borderless_fullscreen_mode() { cf_app_set_borderless_fullscreen_mode(); }
 CF_INLINE void app_set_fullscreen_mode() { cf_app_set_fullscreen_mode(); }
@@ -826,9 +1055,17 @@ CF_INLINE void app_set_icon(const char* virtual_path_to_png) { cf_app_set_icon(v
 
 CF_INLINE ImGuiContext* app_init_imgui(bool no_default_font = false) { return cf_app_init_imgui(no_default_font); }
 CF_INLINE sg_imgui_t* app_get_sokol_imgui() { return cf_app_get_sokol_imgui(); }
+CF_INLINE Result app_init_audio() { return cf_app_init_audio(); }
 CF_INLINE CF_Canvas app_get_canvas() { return cf_app_get_canvas(); }
 CF_INLINE void app_set_canvas_size(int w, int h) { cf_app_set_canvas_size(w, h); }
+using DynamicResolution = CF_DynamicResolution;
+CF_INLINE DynamicResolution dynamic_resolution_defaults() { return cf_dynamic_resolution_defaults(); }
+CF_INLINE void app_set_dynamic_resolution(const DynamicResolution* params) { cf_app_set_dynamic_resolution(params); }
+CF_INLINE float app_get_resolution_scale() { return cf_app_get_resolution_scale(); }
 CF_INLINE PowerInfo app_power_info() { return cf_app_power_info(); }
+CF_INLINE FrameStats app_get_frame_stats() { return cf_app_get_frame_stats(); }
+CF_INLINE void app_frame_stats_imgui_window() { cf_app_frame_stats_imgui_window(); }
+CF_INLINE StartupTimings app_get_startup_timings() { return cf_app_get_startup_timings(); }
 
 }
 
@@ -662,6 +662,276 @@ const T& Array<T>::last() const
 	return *(m_ptr + m_count - 1);
 }
 
+/**
+ * A growable array that keeps its first `N` elements inline, and only spills to the heap past that.
+ *
+ * Meant for short-lived or usually-small lists on hot paths, such as a list of component types or
+ * a scratch list built on the stack, where `Array` would otherwise allocate every time. The interface
+ * matches `Array`. Pointers to elements are invalidated when the array grows or is moved.
+ */
+template <typename T, int N>
+struct SmallArray
+{
+	SmallArray() { }
+	SmallArray(CF_InitializerList<T> list);
+	SmallArray(const SmallArray<T, N>& other);
+	SmallArray(SmallArray<T, N>&& other);
+	~SmallArray();
+
+	T& add();
+	T& add(const T& item);
+	T& add(T&& item);
+	T pop();
+	void unordered_remove(int index);
+	void clear();
+	void ensure_capacity(int num_elements);
+	void ensure_count(int count);
+	void set_count(int count);
+	void reverse();
+
+	int capacity() const { return m_capacity; }
+	int count() const { return m_count; }
+	int size() const { return m_count; }
+	bool empty() const { return m_count == 0; }
+	// True while the elements still fit in the inline storage.
+	bool is_inline() const { return !m_heap; }
+
+	T* begin() { return s_ptr(); }
+	const T* begin() const { return s_ptr(); }
+	T* end() { return s_ptr() + m_count; }
+	const T* end() const { return s_ptr() + m_count; }
+
+	T& operator[](int index) { CF_ASSERT(index >= 0 && index < m_count); return s_ptr()[index]; }
+	const T& operator[](int index) const { CF_ASSERT(index >= 0 && index < m_count); return s_ptr()[index]; }
+
+	T* operator+(int index) { CF_ASSERT(index >= 0 && index < m_count); return s_ptr() + index; }
+	const T* operator+(int index) const { CF_ASSERT(index >= 0 && index < m_count); return s_ptr() + index; }
+
+	SmallArray<T, N>& operator=(const SmallArray<T, N>& rhs);
+	SmallArray<T, N>& operator=(SmallArray<T, N>&& rhs);
+
+	T& last() { return s_ptr()[m_count - 1]; }
+	const T& last() const { return s_ptr()[m_count - 1]; }
+
+	T* data() { return s_ptr(); }
+	const T* data() const { return s_ptr(); }
+
+private:
+	// The heap pointer is NULL while inline, rather than pointing at `m_buffer`, so the array stays valid if memcpy'd.
+	T* s_ptr() { return m_heap ? m_heap : (T*)m_buffer; }
+	const T* s_ptr() const { return m_heap ? m_heap : (const T*)m_buffer; }
+	void s_grow(int capacity);
+	void s_take(SmallArray<T, N>* other);
+
+	int m_capacity = N;
+	int m_count = 0;
+	T* m_heap = NULL;
+	alignas(T) char m_buffer[sizeof(T) * N];
+};
+
+template <typename T, int N>
+void SmallArray<T, N>::s_grow(int capacity)
+{
+	if (capacity <= m_capacity) return;
+	int new_capacity = m_capacity * 2;
+	while (new_capacity < capacity) {
+		new_capacity *= 2;
+	}
+	T* old_ptr = s_ptr();
+	T* new_ptr = (T*)cf_alloc(sizeof(T) * new_capacity);
+	for (int i = 0; i < m_count; ++i) {
+		CF_PLACEMENT_NEW(new_ptr + i) T(cf_move(old_ptr[i]));
+		old_ptr[i].~T();
+	}
+	cf_free(m_heap);
+	m_heap = new_ptr;
+	m_capacity = new_capacity;
+}
+
+// Call with `this` empty and inline.
+template <typename T, int N>
+void SmallArray<T, N>::s_take(SmallArray<T, N>* other)
+{
+	if (other->m_heap) {
+		m_heap = other->m_heap;
+		m_capacity = other->m_capacity;
+		m_count = other->m_count;
+		other->m_heap = NULL;
+		other->m_capacity = N;
+		other->m_count = 0;
+	} else {
+		T* other_ptr = other->s_ptr();
+		for (int i = 0; i < other->m_count; ++i) {
+			CF_PLACEMENT_NEW((T*)m_buffer + i) T(cf_move(other_ptr[i]));
+		}
+		m_count = other->m_count;
+		other->clear();
+	}
+}
+
+template <typename T, int N>
+SmallArray<T, N>::SmallArray(CF_InitializerList<T> list)
+{
+	s_grow((int)list.size());
+	for (const T* i = list.begin(); i < list.end(); ++i) {
+		add(*i);
+	}
+}
+
+template <typename T, int N>
+SmallArray<T, N>::SmallArray(const SmallArray<T, N>& other)
+{
+	s_grow(other.m_count);
+	T* ptr = s_ptr();
+	const T* other_ptr = other.s_ptr();
+	for (int i = 0; i < other.m_count; ++i) {
+		CF_PLACEMENT_NEW(ptr + i) T(other_ptr[i]);
+	}
+	m_count = other.m_count;
+}
+
+template <typename T, int N>
+SmallArray<T, N>::SmallArray(SmallArray<T, N>&& other)
+{
+	s_take(&other);
+}
+
+template <typename T, int N>
+SmallArray<T, N>::~SmallArray()
+{
+	clear();
+	cf_free(m_heap);
+}
+
+template <typename T, int N>
+T& SmallArray<T, N>::add()
+{
+	s_grow(m_count + 1);
+	return *CF_PLACEMENT_NEW(s_ptr() + m_count++) T();
+}
+
+template <typename T, int N>
+T& SmallArray<T, N>::add(const T& item)
+{
+	if (m_count == m_capacity) {
+		// The item might live in this array, so copy it before growing.
+		T copy = item;
+		s_grow(m_count + 1);
+		return *CF_PLACEMENT_NEW(s_ptr() + m_count++) T(cf_move(copy));
+	}
+	return *CF_PLACEMENT_NEW(s_ptr() + m_count++) T(item);
+}
+
+template <typename T, int N>
+T& SmallArray<T, N>::add(T&& item)
+{
+	s_grow(m_count + 1);
+	return *CF_PLACEMENT_NEW(s_ptr() + m_count++) T(cf_move(item));
+}
+
+template <typename T, int N>
+T SmallArray<T, N>::pop()
+{
+	CF_ASSERT(m_count > 0);
+	T* ptr = s_ptr();
+	T val = cf_move(ptr[m_count - 1]);
+	ptr[m_count - 1].~T();
+	m_count--;
+	return val;
+}
+
+template <typename T, int N>
+void SmallArray<T, N>::unordered_remove(int index)
+{
+	T* ptr = s_ptr();
+	if (index != m_count - 1) {
+		ptr[index] = cf_move(ptr[m_count - 1]);
+	}
+	ptr[--m_count].~T();
+}
+
+template <typename T, int N>
+void SmallArray<T, N>::clear()
+{
+	T* ptr = s_ptr();
+	for (int i = 0; i < m_count; ++i) {
+		ptr[i].~T();
+	}
+	m_count = 0;
+}
+
+template <typename T, int N>
+void SmallArray<T, N>::ensure_capacity(int num_elements)
+{
+	s_grow(num_elements);
+}
+
+template <typename T, int N>
+void SmallArray<T, N>::ensure_count(int count)
+{
+	s_grow(count);
+	T* ptr = s_ptr();
+	for (int i = m_count; i < count; ++i) {
+		CF_PLACEMENT_NEW(ptr + i) T();
+	}
+	if (m_count < count) m_count = count;
+}
+
+template <typename T, int N>
+void SmallArray<T, N>::set_count(int count)
+{
+	s_grow(count);
+	T* ptr = s_ptr();
+	for (int i = m_count; i < count; ++i) {
+		CF_PLACEMENT_NEW(ptr + i) T();
+	}
+	for (int i = count; i < m_count; ++i) {
+		ptr[i].~T();
+	}
+	m_count = count;
+}
+
+template <typename T, int N>
+void SmallArray<T, N>::reverse()
+{
+	T* a = s_ptr();
+	T* b = a + (m_count - 1);
+	while (a < b) {
+		T t = cf_move(*a);
+		*a = cf_move(*b);
+		*b = cf_move(t);
+		++a;
+		--b;
+	}
+}
+
+template <typename T, int N>
+SmallArray<T, N>& SmallArray<T, N>::operator=(const SmallArray<T, N>& rhs)
+{
+	if (this == &rhs) return *this;
+	clear();
+	s_grow(rhs.m_count);
+	T* ptr = s_ptr();
+	const T* rhs_ptr = rhs.s_ptr();
+	for (int i = 0; i < rhs.m_count; ++i) {
+		CF_PLACEMENT_NEW(ptr + i) T(rhs_ptr[i]);
+	}
+	m_count = rhs.m_count;
+	return *this;
+}
+
+template <typename T, int N>
+SmallArray<T, N>& SmallArray<T, N>::operator=(SmallArray<T, N>&& rhs)
+{
+	if (this == &rhs) return *this;
+	clear();
+	cf_free(m_heap);
+	m_heap = NULL;
+	m_capacity = N;
+	s_take(&rhs);
+	return *this;
+}
+
 }
 
 #endif // CF_CPP
@@ -9,6 +9,7 @@
 #define CF_AUDIO_H
 
 #include "cute_defines.h"
+#include "cute_math.h"
 #include "cute_multithreading.h"
 #include "cute_result.h"
 
@@ -32,7 +33,7 @@ typedef struct CF_Sound { uint64_t id; } CF_Sound;
  * @struct   CF_Audio
  * @category audio
  * @brief    An opaque pointer representing raw audio samples loaded as a resource.
- * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_destroy cf_music_play cf_music_switch_to cf_music_crossfade cf_play_sound
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_load_ogg_async cf_audio_load_wav_async cf_audio_is_ready cf_audio_destroy cf_music_play cf_music_switch_to cf_music_crossfade cf_play_sound
  */
 typedef struct CF_Audio { uint64_t id; } CF_Audio;
 // @end
@@ -43,7 +44,7 @@ typedef struct CF_Audio { uint64_t id; } CF_Audio;
  * @brief    Loads a .ogg audio file.
  * @param    path         The virtual path to a .ogg file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
  * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
- * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_destroy
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy
  */
 CF_API CF_Audio CF_CALL cf_audio_load_ogg(const char* path);
 
@@ -53,7 +54,7 @@ CF_API CF_Audio CF_CALL cf_audio_load_ogg(const char* path);
  * @brief    Loads a .wav audio file.
  * @param    path         The virtual path to a .wav file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
  * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
- * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_destroy
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy
  */
 CF_API CF_Audio CF_CALL cf_audio_load_wav(const char* path);
 
@@ -64,7 +65,7 @@ CF_API CF_Audio CF_CALL cf_audio_load_wav(const char* path);
  * @param    memory       A buffer containing the bytes of a .ogg file.
  * @param    byte_count   The number of bytes in `memory`.
  * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
- * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_destroy
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy
  */
 CF_API CF_Audio CF_CALL cf_audio_load_ogg_from_memory(void* memory, int byte_count);
 
@@ -75,16 +76,77 @@ CF_API CF_Audio CF_CALL cf_audio_load_ogg_from_memory(void* memory, int byte_cou
  * @param    memory       A buffer containing the bytes of a .wav file.
  * @param    byte_count   The number of bytes in `memory`.
  * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
- * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_destroy
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy
  */
 CF_API CF_Audio CF_CALL cf_audio_load_wav_from_memory(void* memory, int byte_count);
 
+/**
+ * @function cf_audio_stream_ogg
+ * @category audio
+ * @brief    Opens a .ogg audio file for streaming, decoding it bit by bit while it plays instead of all at once.
+ * @param    path         The virtual path to a .ogg file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
+ * @remarks  Meant for music. A few minutes of music take tens of megabytes once decoded, and decoding it all takes a noticeable hitch
+ *           when loading. A streamed `CF_Audio` only keeps the compressed file in memory along with a small window of decoded samples,
+ *           and the audio mixer decodes more as playback moves along. Play it with `cf_music_play`, `cf_music_switch_to` or
+ *           `cf_music_crossfade`. Since there's only one window, play just one instance at a time, and don't use a negative pitch.
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy cf_music_play
+ */
+CF_API CF_Audio CF_CALL cf_audio_stream_ogg(const char* path);
+
+/**
+ * @function cf_audio_stream_ogg_from_memory
+ * @category audio
+ * @brief    Opens a .ogg audio file from memory for streaming, decoding it bit by bit while it plays instead of all at once.
+ * @param    memory       A buffer containing the bytes of a .ogg file. This is copied, so it can be freed right away.
+ * @param    byte_count   The number of bytes in `memory`.
+ * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
+ * @remarks  See `cf_audio_stream_ogg` for more details.
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy cf_music_play
+ */
+CF_API CF_Audio CF_CALL cf_audio_stream_ogg_from_memory(void* memory, int byte_count);
+
+/**
+ * @function cf_audio_load_ogg_async
+ * @category audio
+ * @brief    Loads a .ogg audio file on a worker thread, returning right away.
+ * @param    path         The virtual path to a .ogg file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
+ * @remarks  Reading and decoding run on the app's threadpool, so loading many sounds at once doesn't stall the game. The returned
+ *           `CF_Audio` can be used right away, but stays silent until loaded: `cf_play_sound` returns a sound that's already finished,
+ *           and `cf_music_play`, `cf_music_switch_to` and `cf_music_crossfade` do nothing. Check `cf_audio_is_ready` to know when it's
+ *           loaded. If the app has no threadpool this is the same as `cf_audio_load_ogg`.
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_async cf_audio_load_wav_async cf_audio_is_ready cf_audio_destroy
+ */
+CF_API CF_Audio CF_CALL cf_audio_load_ogg_async(const char* path);
+
+/**
+ * @function cf_audio_load_wav_async
+ * @category audio
+ * @brief    Loads a .wav audio file on a worker thread, returning right away.
+ * @param    path         The virtual path to a .wav file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @return   Returns a pointer to `CF_Audio`. Free it up with `cf_audio_destroy` when done.
+ * @remarks  See `cf_audio_load_ogg_async` for more details.
+ * @related  CF_Audio cf_audio_load_wav cf_audio_load_ogg_async cf_audio_load_wav_async cf_audio_is_ready cf_audio_destroy
+ */
+CF_API CF_Audio CF_CALL cf_audio_load_wav_async(const char* path);
+
+/**
+ * @function cf_audio_is_ready
+ * @category audio
+ * @brief    Returns true once a `CF_Audio` from `cf_audio_load_ogg_async` or `cf_audio_load_wav_async` has finished loading.
+ * @param    audio        The audio to check.
+ * @remarks  Always true for audio loaded any other way. A load that failed is also ready, but has a `cf_audio_sample_count` of zero.
+ * @related  CF_Audio cf_audio_load_ogg_async cf_audio_load_wav_async cf_audio_sample_count
+ */
+CF_API bool CF_CALL cf_audio_is_ready(CF_Audio audio);
+
 /**
  * @function cf_audio_destroy
  * @category audio
  * @brief    Frees all resources used by a `CF_Audio`.
  * @param    audio        A pointer to the `CF_Audio`.
- * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_destroy
+ * @related  CF_Audio cf_audio_load_ogg cf_audio_load_ogg_from_memory cf_audio_load_wav cf_audio_load_wav_from_memory cf_audio_stream_ogg cf_audio_stream_ogg_from_memory cf_audio_destroy
  */
 CF_API void CF_CALL cf_audio_destroy(CF_Audio audio);
 
@@ -104,11 +166,113 @@ CF_API void CF_CALL cf_audio_destroy(CF_Audio audio);
  */
 CF_API void CF_CALL cf_audio_cull_duplicates(bool true_to_cull_duplicates);
 
+/**
+ * @function cf_audio_set_max_voices
+ * @category audio
+ * @brief    Caps how many sounds are mixed at once, not counting music.
+ * @param    max_voices   The most sounds to mix at once, or zero (the default) for no limit.
+ * @remarks  Mixing hundreds of sounds at once, such as all the explosions of a big fight, can take the mixer longer than the audio it
+ *           produces, which makes audio stutter. With a cap, only the sounds with the highest `CF_SoundParams` priority are mixed, and
+ *           among equal priorities the loudest, then the oldest. The rest become virtual: they're not mixed, but keep playing silently
+ *           so they pick up from the right spot once a voice frees up. To have far away sounds give up their voice first, lower their
+ *           volume with distance. Sounds too quiet to hear are always virtual, even with no cap.
+ * @related  CF_SoundParams cf_play_sound cf_sound_set_priority cf_sound_is_virtual cf_audio_cull_duplicates
+ */
+CF_API void CF_CALL cf_audio_set_max_voices(int max_voices);
+
+/**
+ * @function cf_audio_set_buffer_size
+ * @category audio
+ * @brief    Sets how many samples the mixer keeps queued up ahead of the audio device.
+ * @param    sample_count  Samples per channel, at least 128. Zero picks the default, 1024 (4096 on Emscripten).
+ * @remarks  Must be called before `cf_make_app`, which starts the mixer. Sounds start playing up to this many samples after
+ *           `cf_play_sound`, so at 44100 Hz the default adds about 23ms of latency. Smaller buffers cut that down, which matters for
+ *           rhythm games, but leave the mixer less slack, so the device may run out of samples and click. Watch `underrun_count` from
+ *           `cf_audio_get_stats` to find the smallest buffer that plays cleanly. Some devices round the size up.
+ * @related  cf_audio_set_mix_thread_sleep cf_audio_get_stats CF_AudioStats
+ */
+CF_API void CF_CALL cf_audio_set_buffer_size(int sample_count);
+
+/**
+ * @function cf_audio_set_mix_thread_sleep
+ * @category audio
+ * @brief    Sets how long the mixing thread sleeps between checks for more samples to mix.
+ * @param    milliseconds  Time to sleep. Zero picks the default, one millisecond.
+ * @remarks  Longer sleeps use less CPU, but mix in bigger, later chunks. Keep this well under the time the buffer from
+ *           `cf_audio_set_buffer_size` plays for. May be called before or after `cf_make_app`.
+ * @related  cf_audio_set_buffer_size cf_audio_get_stats
+ */
+CF_API void CF_CALL cf_audio_set_mix_thread_sleep(int milliseconds);
+
+/**
+ * @struct   CF_AudioStats
+ * @category audio
+ * @brief    How hard the mixer is working, see `cf_audio_get_stats`.
+ * @related  CF_AudioStats cf_audio_get_stats cf_audio_reset_stats
+ */
+typedef struct CF_AudioStats
+{
+	/* @member Number of blocks mixed since the last `cf_audio_reset_stats`. */
+	int mix_count;
+
+	/* @member Seconds spent mixing the latest block. */
+	float mix_seconds;
+
+	/* @member Samples per channel in the latest block. */
+	int block_sample_count;
+
+	/* @member Highest time spent mixing a block divided by the time the block plays for, since the last `cf_audio_reset_stats`. Above 1.0 the mixer can't keep up. */
+	float peak_load;
+
+	/* @member Number of times the device ran out of mixed samples and played silence, since the last `cf_audio_reset_stats`. */
+	int underrun_count;
+
+	/* @member Sounds, including music, mixed in the latest block. */
+	int voice_count;
+
+	/* @member Sounds skipped in the latest block for being too quiet or over `cf_audio_set_max_voices`. */
+	int virtual_voice_count;
+
+	/* @member Samples per channel queued ahead of the device, see `cf_audio_set_buffer_size`. */
+	int buffer_size;
+} CF_AudioStats;
+// @end
+
+/**
+ * @function cf_audio_get_stats
+ * @category audio
+ * @brief    Returns timing and load of the mixer.
+ * @remarks  Meant for tuning `cf_audio_set_buffer_size`, or for logging audio problems on players' machines.
+ * @related  CF_AudioStats cf_audio_reset_stats cf_audio_set_buffer_size
+ */
+CF_API CF_AudioStats CF_CALL cf_audio_get_stats();
+
+/**
+ * @function cf_audio_reset_stats
+ * @category audio
+ * @brief    Zeroes the counters and peak load in `CF_AudioStats`.
+ * @related  CF_AudioStats cf_audio_get_stats
+ */
+CF_API void CF_CALL cf_audio_reset_stats();
+
+/**
+ * @function cf_audio_render
+ * @category audio
+ * @brief    Mixes audio right away into a buffer of your own, instead of playing it.
+ * @param    out           Receives `sample_count` stereo samples, as interleaved pairs of 16-bit samples (left then right).
+ * @param    sample_count  The number of stereo samples to mix.
+ * @remarks  Only works when `cf_make_app` was called with `APP_OPTIONS_NO_AUDIO_DEVICE`, otherwise `out` is filled with silence. Mixes in
+ *           blocks of `cf_audio_set_buffer_size` samples, same as when playing, so `cf_audio_get_stats` reports the same costs. Meant for
+ *           benchmarks, tests and rendering audio to a file.
+ * @related  cf_audio_get_stats cf_audio_set_buffer_size cf_make_app
+ */
+CF_API void CF_CALL cf_audio_render(int16_t* out, int sample_count);
+
 /**
  * @function cf_audio_sample_rate
  * @category audio
  * @brief    Returns the sample rate for a loaded audio resource.
- * @related  CF_Audio cf_audio_sample_rate cf_audio_sample_count cf_audio_channel_count
+ * @related  CF_Audio cf_audio_sample_rate cf_audio_sample_count cf_audio_channel_count cf_audio_resample
  */
 CF_API int CF_CALL cf_audio_sample_rate(CF_Audio audio);
 
@@ -128,6 +292,174 @@ CF_API int CF_CALL cf_audio_sample_count(CF_Audio audio);
  */
 CF_API int CF_CALL cf_audio_channel_count(CF_Audio audio);
 
+/**
+ * @enum     CF_AudioResampleQuality
+ * @category audio
+ * @brief    How carefully `cf_audio_resample` computes samples that fall between the original ones.
+ * @related  CF_AudioResampleQuality cf_audio_resample_quality_to_string cf_audio_resample
+ */
+#define CF_AUDIO_RESAMPLE_QUALITY_DEFS \
+	/* @entry Blends the two nearest samples. Fastest, but dulls high frequencies a little. */ \
+	CF_ENUM(AUDIO_RESAMPLE_QUALITY_LINEAR, 0)                                                \
+	/* @entry Fits a curve through the four nearest samples. Cleaner, and still quick. */      \
+	CF_ENUM(AUDIO_RESAMPLE_QUALITY_CUBIC,  1)                                                \
+	/* @end */
+
+typedef enum CF_AudioResampleQuality
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_AUDIO_RESAMPLE_QUALITY_DEFS
+	#undef CF_ENUM
+} CF_AudioResampleQuality;
+
+/**
+ * @function cf_audio_resample_quality_to_string
+ * @category audio
+ * @brief    Convert an enum `CF_AudioResampleQuality` to a c-style string.
+ * @param    quality      The quality to convert to a string.
+ * @related  CF_AudioResampleQuality cf_audio_resample
+ */
+CF_INLINE const char* cf_audio_resample_quality_to_string(CF_AudioResampleQuality quality) {
+	switch (quality) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_AUDIO_RESAMPLE_QUALITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @function cf_audio_resample
+ * @category audio
+ * @brief    Converts a loaded audio resource to the sample rate the mixer plays at.
+ * @param    audio        The audio to convert.
+ * @param    quality      How to compute the new samples, see `CF_AudioResampleQuality`.
+ * @return   Returns any errors as `CF_Result`.
+ * @remarks  The mixer plays every sample at its own rate (44100 Hz), so a sound recorded at another rate plays sped up or slowed down.
+ *           Resampling once at load time fixes that without costing anything while playing. Call this right after loading, before
+ *           playing the audio. Waits for `cf_audio_load_ogg_async` or `cf_audio_load_wav_async` to finish first. Streamed or
+ *           compressed audio can't be resampled, so resample before calling `cf_audio_compress`.
+ * @related  CF_Audio CF_AudioResampleQuality cf_audio_sample_rate cf_audio_compress
+ */
+CF_API CF_Result CF_CALL cf_audio_resample(CF_Audio audio, CF_AudioResampleQuality quality);
+
+/**
+ * @function cf_audio_compress
+ * @category audio
+ * @brief    Compresses a loaded audio resource in memory to about an eighth of its size.
+ * @param    audio        The audio to compress.
+ * @return   Returns any errors as `CF_Result`.
+ * @remarks  Samples are kept as 4-bit ADPCM, which the mixer decodes a few at a time while playing. Decoding is cheap, but the sound loses
+ *           a little quality, so this suits the many short sound effects a game keeps loaded rather than music, which `cf_audio_stream_ogg`
+ *           handles better. Call this right after loading, before playing the audio. Waits for `cf_audio_load_ogg_async` or
+ *           `cf_audio_load_wav_async` to finish first. Compressed audio can't be played with a negative pitch.
+ * @related  CF_Audio cf_audio_resample cf_audio_stream_ogg cf_play_sound
+ */
+CF_API CF_Result CF_CALL cf_audio_compress(CF_Audio audio);
+
+// -------------------------------------------------------------------------------------------------
+// Sound banks.
+
+/**
+ * @struct   CF_AudioBank
+ * @category audio
+ * @brief    An opaque handle representing many `CF_Audio` cooked into one file, see `cf_audio_bank_save`.
+ * @related  cf_audio_bank_save cf_audio_bank_load cf_audio_bank_load_from_memory cf_audio_bank_get cf_audio_bank_destroy
+ */
+typedef struct CF_AudioBank { uint64_t id; } CF_AudioBank;
+// @end
+
+/**
+ * @function cf_audio_bank_save
+ * @category audio
+ * @brief    Cooks many loaded `CF_Audio` into a single sound bank file, ready for `cf_audio_bank_load`.
+ * @param    path         A virtual path (see `cf_fs_write_entire_buffer_to_file`) to write the bank to.
+ * @param    audio        The audio to put in the bank.
+ * @param    names        One name per audio, for looking clips up with `cf_audio_bank_get`. Names must be unique.
+ * @param    count        The number of audio and names.
+ * @return   Returns any errors as `CF_Result`.
+ * @remarks  Meant as a build step. Clips are stored exactly as they sit in memory, so call `cf_audio_resample` and `cf_audio_compress`
+ *           first to cook resampled or compressed clips. Each clip's samples start on a 16 byte boundary, so the mixer can play them straight
+ *           out of the file. Streamed audio can't be put in a bank. Waits for `cf_audio_load_ogg_async` or `cf_audio_load_wav_async` to finish first.
+ * @related  CF_AudioBank cf_audio_bank_load cf_audio_compress cf_audio_resample
+ */
+CF_API CF_Result CF_CALL cf_audio_bank_save(const char* path, const CF_Audio* audio, const char** names, int count);
+
+/**
+ * @function cf_audio_bank_load
+ * @category audio
+ * @brief    Loads a sound bank from `cf_audio_bank_save`.
+ * @param    path         A virtual path (see `cf_fs_mount`) to the bank file.
+ * @return   Returns a `CF_AudioBank`, or an id of zero if the file is missing or isn't a valid bank.
+ * @remarks  The whole file is read with one read and one allocation. Nothing is decoded or copied, each `CF_Audio` from `cf_audio_bank_get`
+ *           points straight into the loaded file, so loading hundreds of sound effects takes about as long as reading the file.
+ * @related  CF_AudioBank cf_audio_bank_load_from_memory cf_audio_bank_get cf_audio_bank_destroy
+ */
+CF_API CF_AudioBank CF_CALL cf_audio_bank_load(const char* path);
+
+/**
+ * @function cf_audio_bank_load_from_memory
+ * @category audio
+ * @brief    Opens a sound bank from `cf_audio_bank_save` that's already in memory, without copying it.
+ * @param    memory       The bank. Must be 16 byte aligned, and must outlive the `CF_AudioBank`.
+ * @param    byte_count   The size of the bank in bytes.
+ * @return   Returns a `CF_AudioBank`, or an id of zero if the memory isn't a valid bank.
+ * @remarks  Use this with a memory mapped file to have the operating system page in samples only as they're played.
+ * @related  CF_AudioBank cf_audio_bank_load cf_audio_bank_get cf_audio_bank_destroy
+ */
+CF_API CF_AudioBank CF_CALL cf_audio_bank_load_from_memory(const void* memory, size_t byte_count);
+
+/**
+ * @function cf_audio_bank_destroy
+ * @category audio
+ * @brief    Destroys a sound bank, along with all of its `CF_Audio`.
+ * @param    bank         The bank to destroy.
+ * @remarks  Sounds still playing from the bank keep their samples until they finish. Don't call `cf_audio_destroy` on audio from a bank.
+ * @related  CF_AudioBank cf_audio_bank_load cf_audio_bank_load_from_memory
+ */
+CF_API void CF_CALL cf_audio_bank_destroy(CF_AudioBank bank);
+
+/**
+ * @function cf_audio_bank_count
+ * @category audio
+ * @brief    Returns the number of clips in a sound bank.
+ * @param    bank         The bank.
+ * @related  CF_AudioBank cf_audio_bank_get_index cf_audio_bank_get_name
+ */
+CF_API int CF_CALL cf_audio_bank_count(CF_AudioBank bank);
+
+/**
+ * @function cf_audio_bank_get
+ * @category audio
+ * @brief    Finds a clip in a sound bank by name.
+ * @param    bank         The bank.
+ * @param    name         The name the clip was given in `cf_audio_bank_save`.
+ * @return   Returns the clip's `CF_Audio`, or an id of zero if there's no clip by this name.
+ * @remarks  Names are looked up with a binary search. The `CF_Audio` belongs to the bank, and can't be resampled or compressed.
+ * @related  CF_AudioBank cf_audio_bank_get_index cf_play_sound
+ */
+CF_API CF_Audio CF_CALL cf_audio_bank_get(CF_AudioBank bank, const char* name);
+
+/**
+ * @function cf_audio_bank_get_index
+ * @category audio
+ * @brief    Returns a clip in a sound bank by index, from 0 to `cf_audio_bank_count` - 1. Clips are sorted by name.
+ * @param    bank         The bank.
+ * @param    index        The index of the clip.
+ * @related  CF_AudioBank cf_audio_bank_count cf_audio_bank_get_name
+ */
+CF_API CF_Audio CF_CALL cf_audio_bank_get_index(CF_AudioBank bank, int index);
+
+/**
+ * @function cf_audio_bank_get_name
+ * @category audio
+ * @brief    Returns the name of a clip in a sound bank by index, from 0 to `cf_audio_bank_count` - 1.
+ * @param    bank         The bank.
+ * @param    index        The index of the clip.
+ * @related  CF_AudioBank cf_audio_bank_count cf_audio_bank_get_index
+ */
+CF_API const char* CF_CALL cf_audio_bank_get_name(CF_AudioBank bank, int index);
+
 // -------------------------------------------------------------------------------------------------
 // Global controls.
 
@@ -280,11 +612,77 @@ CF_API CF_Result CF_CALL cf_music_set_sample_index(int sample_index);
  * @brief    Sets the callback for notifications of when the current song finishes playing.
  * @param    on_finished      Called whenever the current song finishes.
  * @param    udata            An optional pointer handed back to you within the `on_finished` callback.
- * @param    single_threaded  Set to true to queue up callbacks and invoke them on the main thread. Otherwise this callback is called from the mixing thread directly.
+ * @param    single_threaded  Set to true to queue up callbacks and invoke them on the main thread during `cf_app_update`. Otherwise this callback is called from the mixing thread directly.
  * @related  CF_Audio cf_audio_sample_rate cf_audio_sample_count cf_audio_channel_count
  */
 CF_API void CF_CALL cf_music_set_on_finish_callback(void (*on_finished)(void* udata), void* udata, bool single_threaded);
 
+/**
+ * @function cf_music_set_bus
+ * @category audio
+ * @brief    Picks which bus the music is mixed into, see `cf_audio_bus_set_volume`.
+ * @param    bus      The bus, from 0 to `CF_AUDIO_BUS_COUNT` - 1. Defaults to 0.
+ * @related  cf_music_play cf_audio_bus_set_volume cf_audio_bus_set_low_pass cf_audio_bus_set_ducking
+ */
+CF_API void CF_CALL cf_music_set_bus(int bus);
+
+// -------------------------------------------------------------------------------------------------
+// Bus API.
+
+/**
+ * @function CF_AUDIO_BUS_COUNT
+ * @category audio
+ * @brief    The number of audio buses, see `cf_audio_bus_set_volume`.
+ * @related  CF_AUDIO_BUS_COUNT cf_audio_bus_set_volume cf_audio_bus_set_low_pass cf_audio_bus_set_ducking cf_music_set_bus
+ */
+#define CF_AUDIO_BUS_COUNT 8
+
+/**
+ * @function cf_audio_bus_set_volume
+ * @category audio
+ * @brief    Sets the volume of a bus.
+ * @param    bus      The bus, from 0 to `CF_AUDIO_BUS_COUNT` - 1.
+ * @param    volume   A volume from 0.0f to 1.0f. Defaults to 1.0f.
+ * @remarks  Every sound and the music are mixed into a bus, bus 0 unless picked with `CF_SoundParams` or `cf_music_set_bus`. For
+ *           example you could pick one bus each for sound FX, music, UI and voice. A bus runs its effects once over the sum of all
+ *           its sounds, which costs the same no matter how many sounds play, before the buses are added together. Bus effects apply
+ *           on top of each sound's own volume and the other volume settings.
+ * @related  CF_AUDIO_BUS_COUNT cf_audio_bus_get_volume cf_audio_bus_set_low_pass cf_audio_bus_set_ducking cf_music_set_bus CF_SoundParams
+ */
+CF_API void CF_CALL cf_audio_bus_set_volume(int bus, float volume);
+
+/**
+ * @function cf_audio_bus_get_volume
+ * @category audio
+ * @brief    Returns the volume of a bus.
+ * @param    bus      The bus, from 0 to `CF_AUDIO_BUS_COUNT` - 1.
+ * @related  CF_AUDIO_BUS_COUNT cf_audio_bus_set_volume
+ */
+CF_API float CF_CALL cf_audio_bus_get_volume(int bus);
+
+/**
+ * @function cf_audio_bus_set_low_pass
+ * @category audio
+ * @brief    Filters out high frequencies on a bus, for example to muffle sounds under water or behind a wall.
+ * @param    bus         The bus, from 0 to `CF_AUDIO_BUS_COUNT` - 1.
+ * @param    cutoff_hz   Frequencies above this many Hz are softened. 0 turns the filter off, which is the default.
+ * @remarks  This is a gentle one-pole filter, try a few hundred Hz for a strong effect.
+ * @related  CF_AUDIO_BUS_COUNT cf_audio_bus_set_volume cf_audio_bus_set_ducking
+ */
+CF_API void CF_CALL cf_audio_bus_set_low_pass(int bus, float cutoff_hz);
+
+/**
+ * @function cf_audio_bus_set_ducking
+ * @category audio
+ * @brief    Lowers the volume of a bus while another bus plays, for example to lower the music under dialogue.
+ * @param    bus              The bus to lower, from 0 to `CF_AUDIO_BUS_COUNT` - 1.
+ * @param    sidechain_bus    Lowers `bus` while anything audible plays on this bus. -1 turns ducking off, which is the default.
+ * @param    amount           How much to lower the volume, from 0.0f (not at all) to 1.0f (silent).
+ * @param    release_seconds  How long the volume takes to come back up once `sidechain_bus` goes quiet.
+ * @related  CF_AUDIO_BUS_COUNT cf_audio_bus_set_volume cf_audio_bus_set_low_pass
+ */
+CF_API void CF_CALL cf_audio_bus_set_ducking(int bus, int sidechain_bus, float amount, float release_seconds);
+
 // -------------------------------------------------------------------------------------------------
 // Sound API.
 
@@ -314,6 +712,18 @@ typedef struct CF_SoundParams
 
 	/* @member Default: 0. Specify the sample to start playing at. In term of seconds this would be the `cf_audio_sample_rate` * seconds. */
 	int sample_index;
+
+	/* @member Default: 0. When more sounds play than `cf_audio_set_max_voices` allows, higher priority sounds are heard over lower ones. */
+	float priority;
+
+	/* @member Default: 0. Which bus to mix the sound into, from 0 to `CF_AUDIO_BUS_COUNT` - 1. See `cf_audio_bus_set_volume`. */
+	int bus;
+
+	/* @member Default: false. True to attenuate and pan the sound by `position`, see `cf_audio_set_listener`. */
+	bool spatial;
+
+	/* @member Default: (0, 0). Where the sound plays from, if `spatial` is true. */
+	CF_V2 position;
 } CF_SoundParams;
 // @end
 
@@ -332,6 +742,10 @@ CF_INLINE CF_SoundParams CF_CALL cf_sound_params_defaults()
 	params.pan = 0.5f;
 	params.pitch = 1.0f;
 	params.sample_index = 0;
+	params.priority = 0;
+	params.bus = 0;
+	params.spatial = false;
+	params.position = cf_v2(0, 0);
 	return params;
 }
 
@@ -342,6 +756,8 @@ CF_INLINE CF_SoundParams CF_CALL cf_sound_params_defaults()
  * @param    audio_source   The `CF_Audio` samples for the sound to play.
  * @param    params         `CF_SoundParams` on how to play the sound. You can use default values by calling `cf_sound_params_defaults`.
  * @return   Returns a playing sound `CF_Sound`.
+ * @remarks  Audio from `cf_audio_load_ogg_async` or `cf_audio_load_wav_async` that hasn't finished loading is skipped, and the returned
+ *           sound is never active.
  * @related  CF_SoundParams CF_Sound cf_sound_params_defaults cf_play_sound cf_sound_is_active cf_sound_get_is_paused cf_sound_get_is_looped cf_sound_get_volume cf_sound_get_sample_index cf_sound_set_sample_index cf_sound_set_is_paused cf_sound_set_is_looped cf_sound_set_volume cf_sound_stop cf_sound_set_pitch cf_sound_get_pitch
  */
 CF_API CF_Sound CF_CALL cf_play_sound(CF_Audio audio_source, CF_SoundParams params);
@@ -352,7 +768,7 @@ CF_API CF_Sound CF_CALL cf_play_sound(CF_Audio audio_source, CF_SoundParams para
  * @brief    Sets the callback for notifications of when a sound finishes playing, excluding music.
  * @param    on_finished      Called whenever a `CF_Sound` finishes playing, excluding music.
  * @param    udata            An optional pointer handed back to you within the `on_finished` callback.
- * @param    single_threaded  Set to true to queue up callbacks and invoke them on the main thread. Otherwise this callback is called from the mixing thread directly.
+ * @param    single_threaded  Set to true to queue up callbacks and invoke them on the main thread during `cf_app_update`. Otherwise this callback is called from the mixing thread directly.
  * @related  CF_Audio cf_audio_sample_rate cf_audio_sample_count cf_audio_channel_count
  */
 CF_API void CF_CALL cf_sound_set_on_finish_callback(void (*on_finished)(CF_Sound snd, void* udata), void* udata, bool single_threaded);
@@ -363,6 +779,8 @@ CF_API void CF_CALL cf_sound_set_on_finish_callback(void (*on_finished)(CF_Sound
  * @brief    Returns whether or not a sound is active.
  * @param    sound          The sound.
  * @return   Rreturns true if the sound is active, or false if it finished playing (and was not looped).
+ * @remarks  The `cf_sound_set_*` functions and `cf_sound_stop` never wait on the mixer. Their changes are queued up and applied at the
+ *           start of the next mix, so until then the `cf_sound_get_*` functions and this one report the old values.
  * @related  CF_SoundParams CF_Sound cf_sound_params_defaults cf_play_sound cf_sound_is_active cf_sound_get_is_paused cf_sound_get_is_looped cf_sound_get_volume cf_sound_get_sample_index cf_sound_set_sample_index cf_sound_set_is_paused cf_sound_set_is_looped cf_sound_set_volume cf_sound_stop cf_sound_set_pitch cf_sound_get_pitch
  */
 CF_API bool CF_CALL cf_sound_is_active(CF_Sound sound);
@@ -480,6 +898,124 @@ CF_API void CF_CALL cf_sound_set_sample_index(CF_Sound sound, int sample_index);
  */
 CF_API void CF_CALL cf_sound_stop(CF_Sound sound);
 
+/**
+ * @function cf_sound_get_priority
+ * @category audio
+ * @brief    Returns the priority of the sound, see `cf_audio_set_max_voices`.
+ * @related  CF_SoundParams CF_Sound cf_play_sound cf_sound_set_priority cf_sound_is_virtual cf_audio_set_max_voices
+ */
+CF_API float CF_CALL cf_sound_get_priority(CF_Sound sound);
+
+/**
+ * @function cf_sound_set_priority
+ * @category audio
+ * @brief    Sets the priority of the sound, see `cf_audio_set_max_voices`.
+ * @remarks  Defaults to 0.
+ * @related  CF_SoundParams CF_Sound cf_play_sound cf_sound_get_priority cf_sound_is_virtual cf_audio_set_max_voices
+ */
+CF_API void CF_CALL cf_sound_set_priority(CF_Sound sound, float priority);
+
+/**
+ * @function cf_sound_is_virtual
+ * @category audio
+ * @brief    Returns true if the sound lost its voice on the last audio update, see `cf_audio_set_max_voices`.
+ * @remarks  A virtual sound is still active and keeps its place in the audio, it just isn't heard.
+ * @related  CF_SoundParams CF_Sound cf_play_sound cf_sound_get_priority cf_sound_set_priority cf_audio_set_max_voices
+ */
+CF_API bool CF_CALL cf_sound_is_virtual(CF_Sound sound);
+
+// -------------------------------------------------------------------------------------------------
+// Spatial API.
+
+/**
+ * @enum     CF_AudioAttenuation
+ * @category audio
+ * @brief    How spatial sounds get quieter with distance, see `cf_audio_set_attenuation`.
+ * @related  CF_AudioAttenuation cf_audio_attenuation_to_string cf_audio_set_attenuation
+ */
+#define CF_AUDIO_ATTENUATION_DEFS \
+	/* @entry Volume doesn't change with distance, only pan. */                                  \
+	CF_ENUM(AUDIO_ATTENUATION_NONE,        0)                                                   \
+	/* @entry Fades out in a straight line, silent at `max_distance` for a rolloff of 1. */      \
+	CF_ENUM(AUDIO_ATTENUATION_LINEAR,      1)                                                   \
+	/* @entry Halves at twice `min_distance` for a rolloff of 1, like sound in the real world. */ \
+	CF_ENUM(AUDIO_ATTENUATION_INVERSE,     2)                                                   \
+	/* @entry Like inverse, but `rolloff` is an exponent, for a steeper falloff. */              \
+	CF_ENUM(AUDIO_ATTENUATION_EXPONENTIAL, 3)                                                   \
+	/* @end */
+
+typedef enum CF_AudioAttenuation
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_AUDIO_ATTENUATION_DEFS
+	#undef CF_ENUM
+} CF_AudioAttenuation;
+
+/**
+ * @function cf_audio_attenuation_to_string
+ * @category audio
+ * @brief    Convert an enum `CF_AudioAttenuation` to a c-style string.
+ * @param    attenuation  The attenuation to convert to a string.
+ * @related  CF_AudioAttenuation cf_audio_set_attenuation
+ */
+CF_INLINE const char* cf_audio_attenuation_to_string(CF_AudioAttenuation attenuation) {
+	switch (attenuation) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_AUDIO_ATTENUATION_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @function cf_audio_set_listener
+ * @category audio
+ * @brief    Sets where spatial sounds are heard from, usually the camera or the player.
+ * @param    position     The listener's position, in the same space as sound positions.
+ * @remarks  Spatial sounds, see `CF_SoundParams`, have a position. Each update the mixer sets their volume and pan from where they are
+ *           relative to the listener, all in one pass on the mixing thread. The volume from distance applies on top of the sound's own
+ *           volume, but the pan from position replaces the sound's pan. Sounds too far away to hear stop being mixed, see
+ *           `cf_sound_is_virtual`.
+ * @related  cf_audio_set_attenuation cf_sound_set_position cf_sound_set_positions CF_SoundParams
+ */
+CF_API void CF_CALL cf_audio_set_listener(CF_V2 position);
+
+/**
+ * @function cf_audio_set_attenuation
+ * @category audio
+ * @brief    Sets how spatial sounds get quieter with distance from the listener, and pan with position.
+ * @param    model         How volume falls off, see `CF_AudioAttenuation`. `CF_AUDIO_ATTENUATION_LINEAR` by default.
+ * @param    min_distance  Sounds closer than this play at full volume. 64 by default.
+ * @param    max_distance  Sounds further than this stop getting quieter. 1024 by default.
+ * @param    rolloff       How quickly volume drops between the two distances. 1 by default.
+ * @param    pan_distance  Sounds this far to the left or right of the listener play in only one speaker. 512 by default.
+ * @related  CF_AudioAttenuation cf_audio_set_listener cf_sound_set_position
+ */
+CF_API void CF_CALL cf_audio_set_attenuation(CF_AudioAttenuation model, float min_distance, float max_distance, float rolloff, float pan_distance);
+
+/**
+ * @function cf_sound_set_position
+ * @category audio
+ * @brief    Moves a sound, making it spatial if it wasn't already.
+ * @param    sound        The sound.
+ * @param    position     Where the sound plays from.
+ * @remarks  To move many sounds each frame, `cf_sound_set_positions` is much cheaper.
+ * @related  cf_sound_set_positions cf_audio_set_listener CF_SoundParams
+ */
+CF_API void CF_CALL cf_sound_set_position(CF_Sound sound, CF_V2 position);
+
+/**
+ * @function cf_sound_set_positions
+ * @category audio
+ * @brief    Moves many sounds at once, making them spatial if they weren't already.
+ * @param    sounds       The sounds to move.
+ * @param    positions    One position for each sound.
+ * @param    count        The number of sounds.
+ * @remarks  Never waits on the mixer, the new positions are queued up and applied at the start of the next mix. Finished sounds are skipped.
+ * @related  cf_sound_set_position cf_audio_set_listener CF_SoundParams
+ */
+CF_API void CF_CALL cf_sound_set_positions(const CF_Sound* sounds, const CF_V2* positions, int count);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -509,12 +1045,51 @@ CF_INLINE Audio audio_load_ogg(const char* path) { return cf_audio_load_ogg(path
 CF_INLINE Audio audio_load_wav(const char* path) { return cf_audio_load_wav(path); }
 CF_INLINE Audio audio_load_ogg_from_memory(void* memory, int byte_count) { return cf_audio_load_ogg_from_memory(memory, byte_count); }
 CF_INLINE Audio audio_load_wav_from_memory(void* memory, int byte_count) { return cf_audio_load_wav_from_memory(memory, byte_count); }
+CF_INLINE Audio audio_stream_ogg(const char* path) { return cf_audio_stream_ogg(path); }
+CF_INLINE Audio audio_stream_ogg_from_memory(void* memory, int byte_count) { return cf_audio_stream_ogg_from_memory(memory, byte_count); }
+CF_INLINE Audio audio_load_ogg_async(const char* path) { return cf_audio_load_ogg_async(path); }
+CF_INLINE Audio audio_load_wav_async(const char* path) { return cf_audio_load_wav_async(path); }
+CF_INLINE bool audio_is_ready(Audio audio) { return cf_audio_is_ready(audio); }
 CF_INLINE void audio_destroy(Audio audio) { cf_audio_destroy(audio); }
 CF_INLINE void audio_cull_duplicates(bool true_to_cull_duplicates = false) { cf_audio_cull_duplicates(true_to_cull_duplicates); }
+CF_INLINE void audio_set_max_voices(int max_voices = 0) { cf_audio_set_max_voices(max_voices); }
+CF_INLINE void audio_set_buffer_size(int sample_count = 0) { cf_audio_set_buffer_size(sample_count); }
+CF_INLINE void audio_set_mix_thread_sleep(int milliseconds = 0) { cf_audio_set_mix_thread_sleep(milliseconds); }
+using AudioStats = CF_AudioStats;
+CF_INLINE AudioStats audio_get_stats() { return cf_audio_get_stats(); }
+CF_INLINE void audio_reset_stats() { cf_audio_reset_stats(); }
+CF_INLINE void audio_render(int16_t* out, int sample_count) { cf_audio_render(out, sample_count); }
 CF_INLINE int audio_sample_rate(Audio audio) { return cf_audio_sample_rate(audio); }
 CF_INLINE int audio_sample_count(Audio audio) { return cf_audio_sample_count(audio); }
 CF_INLINE int audio_channel_count(Audio audio) { return cf_audio_channel_count(audio); }
 
+using AudioResampleQuality = CF_AudioResampleQuality;
+#define CF_ENUM(K, V) CF_INLINE constexpr AudioResampleQuality K = CF_##K;
+CF_AUDIO_RESAMPLE_QUALITY_DEFS
+#undef CF_ENUM
+
+CF_INLINE const char* to_string(AudioResampleQuality quality) { switch (quality) {
+	#define CF_ENUM(K, V) case K: return #K;
+	CF_AUDIO_RESAMPLE_QUALITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+CF_INLINE Result audio_resample(Audio audio, AudioResampleQuality quality = AUDIO_RESAMPLE_QUALITY_CUBIC) { return cf_audio_resample(audio, quality); }
+CF_INLINE Result audio_compress(Audio audio) { return cf_audio_compress(audio); }
+
+using AudioBank = CF_AudioBank;
+
+CF_INLINE Result audio_bank_save(const char* path, const Audio* audio, const char** names, int count) { return cf_audio_bank_save(path, audio, names, count); }
+CF_INLINE AudioBank audio_bank_load(const char* path) { return cf_audio_bank_load(path); }
+CF_INLINE AudioBank audio_bank_load_from_memory(const void* memory, size_t byte_count) { return cf_audio_bank_load_from_memory(memory, byte_count); }
+CF_INLINE void audio_bank_destroy(AudioBank bank) { cf_audio_bank_destroy(bank); }
+CF_INLINE int audio_bank_count(AudioBank bank) { return cf_audio_bank_count(bank); }
+CF_INLINE Audio audio_bank_get(AudioBank bank, const char* name) { return cf_audio_bank_get(bank, name); }
+CF_INLINE Audio audio_bank_get_index(AudioBank bank, int index) { return cf_audio_bank_get_index(bank, index); }
+CF_INLINE const char* audio_bank_get_name(AudioBank bank, int index) { return cf_audio_bank_get_name(bank, index); }
+
 // -------------------------------------------------------------------------------------------------
 
 CF_INLINE void audio_set_pan(float pan) { cf_audio_set_pan(pan); }
@@ -537,6 +1112,14 @@ CF_INLINE void music_switch_to(Audio audio_source, float fade_out_time = 0, floa
 CF_INLINE void music_crossfade(Audio audio_source, float cross_fade_time = 0) { cf_music_crossfade(audio_source, cross_fade_time); }
 CF_INLINE void music_set_sample_index(int sample_index) { cf_music_set_sample_index(sample_index); }
 CF_INLINE int music_get_sample_index() { return cf_music_get_sample_index(); }
+CF_INLINE void music_set_bus(int bus = 0) { cf_music_set_bus(bus); }
+
+// -------------------------------------------------------------------------------------------------
+
+CF_INLINE void audio_bus_set_volume(int bus, float volume = 1.0f) { cf_audio_bus_set_volume(bus, volume); }
+CF_INLINE float audio_bus_get_volume(int bus) { return cf_audio_bus_get_volume(bus); }
+CF_INLINE void audio_bus_set_low_pass(int bus, float cutoff_hz = 0) { cf_audio_bus_set_low_pass(bus, cutoff_hz); }
+CF_INLINE void audio_bus_set_ducking(int bus, int sidechain_bus, float amount = 0.5f, float release_seconds = 0.5f) { cf_audio_bus_set_ducking(bus, sidechain_bus, amount, release_seconds); }
 
 // -------------------------------------------------------------------------------------------------
 
@@ -555,6 +1138,29 @@ CF_INLINE void sound_set_volume(Sound sound, float volume) { cf_sound_set_volume
 CF_INLINE void sound_set_pitch(Sound sound, float pitch = 1.0f) { cf_sound_set_pitch(sound, pitch); }
 CF_INLINE void sound_set_sample_index(Sound sound, int sample_index) { cf_sound_set_sample_index(sound, sample_index); }
 CF_INLINE void sound_stop(Sound sound) { cf_sound_stop(sound); }
+CF_INLINE float sound_get_priority(Sound sound) { return cf_sound_get_priority(sound); }
+CF_INLINE void sound_set_priority(Sound sound, float priority = 0) { cf_sound_set_priority(sound, priority); }
+CF_INLINE bool sound_is_virtual(Sound sound) { return cf_sound_is_virtual(sound); }
+
+// -------------------------------------------------------------------------------------------------
+
+using AudioAttenuation = CF_AudioAttenuation;
+#define CF_ENUM(K, V) CF_INLINE constexpr AudioAttenuation K = CF_##K;
+CF_AUDIO_ATTENUATION_DEFS
+#undef CF_ENUM
+
+CF_INLINE const char* to_string(AudioAttenuation attenuation) { switch (attenuation) {
+	#define CF_ENUM(K, V) case K: return #K;
+	CF_AUDIO_ATTENUATION_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+CF_INLINE void audio_set_listener(v2 position) { cf_audio_set_listener(position); }
+CF_INLINE void audio_set_attenuation(AudioAttenuation model, float min_distance = 64.0f, float max_distance = 1024.0f, float rolloff = 1.0f, float pan_distance = 512.0f) { cf_audio_set_attenuation(model, min_distance, max_distance, rolloff, pan_distance); }
+CF_INLINE void sound_set_position(Sound sound, v2 position) { cf_sound_set_position(sound, position); }
+CF_INLINE void sound_set_positions(const Sound* sounds, const v2* positions, int count) { cf_sound_set_positions(sounds, (const CF_V2*)positions, count); }
 
 }
 
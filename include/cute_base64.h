@@ -76,6 +76,113 @@ CF_API CF_Result CF_CALL cf_base64_encode(void* dst, size_t dst_size, const void
  */
 CF_API CF_Result CF_CALL cf_base64_decode(void* dst, size_t dst_size, const void* src, size_t src_size);
 
+/**
+ * @struct   CF_Base64Encoder
+ * @category base64
+ * @brief    Encodes base64 a chunk at a time, for data too big to hold encoded all at once.
+ * @remarks  Feed chunks of any size to `cf_base64_encoder_update`, then call `cf_base64_encoder_finish` for the final padded characters.
+ *           The output matches `cf_base64_encode` on all the chunks put together. See `cf_json_write_base64` for embedding binary data
+ *           within json this way.
+ * @related  CF_Base64Encoder cf_make_base64_encoder cf_base64_encoder_update cf_base64_encoder_finish CF_Base64Decoder
+ */
+typedef struct CF_Base64Encoder
+{
+	/* @member Bytes left over from the last chunk, short of a whole triplet. */
+	uint8_t carry[3];
+
+	/* @member The number of bytes in `carry`. */
+	int carry_count;
+} CF_Base64Encoder;
+// @end
+
+/**
+ * @function cf_make_base64_encoder
+ * @category base64
+ * @brief    Returns a new `CF_Base64Encoder`.
+ * @related  CF_Base64Encoder cf_base64_encoder_update cf_base64_encoder_finish
+ */
+CF_API CF_Base64Encoder CF_CALL cf_make_base64_encoder();
+
+/**
+ * @function cf_base64_encoder_update
+ * @category base64
+ * @brief    Encodes the next chunk of raw bytes.
+ * @param    encoder     The encoder.
+ * @param    dst         The destination buffer. Must hold at least `CF_BASE64_ENCODED_SIZE(src_size)` bytes.
+ * @param    src         Raw unencoded bytes.
+ * @param    src_size    The size of `src` in bytes.
+ * @return   Returns the number of characters written to `dst`, always a multiple of four.
+ * @related  CF_Base64Encoder cf_make_base64_encoder cf_base64_encoder_finish
+ */
+CF_API size_t CF_CALL cf_base64_encoder_update(CF_Base64Encoder* encoder, void* dst, const void* src, size_t src_size);
+
+/**
+ * @function cf_base64_encoder_finish
+ * @category base64
+ * @brief    Encodes any leftover bytes along with their `=` padding.
+ * @param    encoder     The encoder.
+ * @param    dst         The destination buffer. Must hold at least four bytes.
+ * @return   Returns the number of characters written to `dst`, either zero or four.
+ * @related  CF_Base64Encoder cf_make_base64_encoder cf_base64_encoder_update
+ */
+CF_API size_t CF_CALL cf_base64_encoder_finish(CF_Base64Encoder* encoder, void* dst);
+
+/**
+ * @struct   CF_Base64Decoder
+ * @category base64
+ * @brief    Decodes base64 a chunk at a time, for data too big to hold all at once.
+ * @remarks  Feed chunks of any size to `cf_base64_decoder_update`, then call `cf_base64_decoder_finish` to check the stream ended
+ *           on a whole group of four characters. Chunks needn't be split on any boundary.
+ * @related  CF_Base64Decoder cf_make_base64_decoder cf_base64_decoder_update cf_base64_decoder_finish CF_Base64Encoder
+ */
+typedef struct CF_Base64Decoder
+{
+	/* @member Characters left over from the last chunk, short of a whole group of four. */
+	uint8_t carry[4];
+
+	/* @member The number of characters in `carry`. */
+	int carry_count;
+
+	/* @member True once the padded final group has been decoded. */
+	bool done;
+
+	/* @member True once an illegal character was found. */
+	bool failed;
+} CF_Base64Decoder;
+// @end
+
+/**
+ * @function cf_make_base64_decoder
+ * @category base64
+ * @brief    Returns a new `CF_Base64Decoder`.
+ * @related  CF_Base64Decoder cf_base64_decoder_update cf_base64_decoder_finish
+ */
+CF_API CF_Base64Decoder CF_CALL cf_make_base64_decoder();
+
+/**
+ * @function cf_base64_decoder_update
+ * @category base64
+ * @brief    Decodes the next chunk of base64 characters.
+ * @param    decoder     The decoder.
+ * @param    dst         The destination buffer. Must hold at least `CF_BASE64_DECODED_SIZE(src_size)` bytes.
+ * @param    src         Base64 encoded characters.
+ * @param    src_size    The size of `src` in bytes.
+ * @param    out_size    Set to the number of bytes written to `dst`.
+ * @return   Returns a `CF_Result` containing information about any errors, such as illegal characters or data after the padding.
+ * @remarks  Once an error is returned every later call fails as well.
+ * @related  CF_Base64Decoder cf_make_base64_decoder cf_base64_decoder_finish
+ */
+CF_API CF_Result CF_CALL cf_base64_decoder_update(CF_Base64Decoder* decoder, void* dst, const void* src, size_t src_size, size_t* out_size);
+
+/**
+ * @function cf_base64_decoder_finish
+ * @category base64
+ * @brief    Returns an error if the stream was invalid, or ended partway through a group of four characters.
+ * @param    decoder     The decoder.
+ * @related  CF_Base64Decoder cf_make_base64_decoder cf_base64_decoder_update
+ */
+CF_API CF_Result CF_CALL cf_base64_decoder_finish(CF_Base64Decoder* decoder);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -91,6 +198,16 @@ namespace Cute
 CF_INLINE Result base64_encode(void* dst, size_t dst_size, const void* src, size_t src_size) { return cf_base64_encode(dst, dst_size, src, src_size); }
 CF_INLINE Result base64_decode(void* dst, size_t dst_size, const void* src, size_t src_size) { return cf_base64_decode(dst, dst_size, src, src_size); }
 
+using Base64Encoder = CF_Base64Encoder;
+using Base64Decoder = CF_Base64Decoder;
+
+CF_INLINE Base64Encoder make_base64_encoder() { return cf_make_base64_encoder(); }
+CF_INLINE size_t base64_encoder_update(Base64Encoder* encoder, void* dst, const void* src, size_t src_size) { return cf_base64_encoder_update(encoder, dst, src, src_size); }
+CF_INLINE size_t base64_encoder_finish(Base64Encoder* encoder, void* dst) { return cf_base64_encoder_finish(encoder, dst); }
+CF_INLINE Base64Decoder make_base64_decoder() { return cf_make_base64_decoder(); }
+CF_INLINE Result base64_decoder_update(Base64Decoder* decoder, void* dst, const void* src, size_t src_size, size_t* out_size) { return cf_base64_decoder_update(decoder, dst, src, src_size, out_size); }
+CF_INLINE Result base64_decoder_finish(Base64Decoder* decoder) { return cf_base64_decoder_finish(decoder); }
+
 }
 
 #endif // CF_CPP
@@ -0,0 +1,470 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_BITSTREAM_H
+#define CF_BITSTREAM_H
+
+#include "cute_defines.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_BitWriter
+ * @category bitstream
+ * @brief    Packs values into a buffer using only as many bits as each value needs.
+ * @remarks  Useful for network packets sent with `cf_client_send` or `cf_server_send`, and for save files. Values are packed bit by bit,
+ *           so a bool takes one bit, an int known to lie within [0, 100] takes seven bits, and a float known to lie within a range can
+ *           be quantized down to just the precision needed. Read the values back in the same order with `CF_BitReader`.
+ *
+ *           Writes never go past the end of the buffer. Instead the writer is marked as overflowed, see `cf_bit_writer_overflowed`.
+ *           The bytes are the same on every platform regardless of endianness.
+ *
+ *           ```cpp
+ *           uint8_t packet[1200];
+ *           CF_BitWriter w = cf_make_bit_writer(packet, sizeof(packet));
+ *           cf_bit_write_int(&w, player->health, 0, 100);
+ *           cf_bit_write_quantized(&w, player->position.x, -1000.0f, 1000.0f, 0.01f);
+ *           cf_bit_write_bool(&w, player->is_jumping);
+ *           int size = cf_bit_writer_flush(&w);
+ *           if (!cf_bit_writer_overflowed(&w)) cf_client_send(client, packet, size, false);
+ *           ```
+ * @related  CF_BitWriter cf_make_bit_writer cf_bit_writer_flush cf_bit_writer_overflowed CF_BitReader
+ */
+typedef struct CF_BitWriter
+{
+	/* @member The buffer written to. */
+	uint8_t* data;
+
+	/* @member The size of `data` in bytes. */
+	int size;
+
+	/* @member The number of whole bytes written to `data` so far. */
+	int byte_count;
+
+	/* @member Bits waiting to be written to `data`, lowest bits first. */
+	uint64_t scratch;
+
+	/* @member The number of bits held in `scratch`. */
+	int scratch_bits;
+
+	/* @member True if any write went past the end of `data`. */
+	bool overflowed;
+} CF_BitWriter;
+// @end
+
+/**
+ * @struct   CF_BitReader
+ * @category bitstream
+ * @brief    Reads back values packed by a `CF_BitWriter`.
+ * @remarks  Reads never go past the end of the buffer, and ranged values are checked against their range. Either problem marks the
+ *           reader as failed and reads return zero from then on, so data from the network can be read without checking every value.
+ *           Check `cf_bit_reader_failed` once afterwards instead.
+ * @related  CF_BitReader cf_make_bit_reader cf_bit_reader_failed CF_BitWriter
+ */
+typedef struct CF_BitReader
+{
+	/* @member The buffer read from. */
+	const uint8_t* data;
+
+	/* @member The size of `data` in bytes. */
+	int size;
+
+	/* @member The number of bytes moved from `data` into `scratch` so far. */
+	int byte_count;
+
+	/* @member Bits read from `data` but not yet returned, lowest bits first. */
+	uint64_t scratch;
+
+	/* @member The number of bits held in `scratch`. */
+	int scratch_bits;
+
+	/* @member True if any read went past the end of `data`, or found a value outside of its range. */
+	bool failed;
+} CF_BitReader;
+// @end
+
+/**
+ * @function cf_bits_required
+ * @category bitstream
+ * @brief    Returns the number of bits needed to store any integer within [min, max].
+ * @param    min        The smallest value.
+ * @param    max        The largest value.
+ * @related  cf_bit_write_int cf_bit_read_int
+ */
+CF_API int CF_CALL cf_bits_required(int min, int max);
+
+/**
+ * @function cf_make_bit_writer
+ * @category bitstream
+ * @brief    Returns a `CF_BitWriter` to pack values into `buffer`.
+ * @param    buffer     The buffer to write to.
+ * @param    size       The size of `buffer` in bytes.
+ * @remarks  Call `cf_bit_writer_flush` when done writing.
+ * @related  CF_BitWriter cf_bit_writer_flush cf_bit_writer_overflowed
+ */
+CF_API CF_BitWriter CF_CALL cf_make_bit_writer(void* buffer, int size);
+
+/**
+ * @function cf_bit_writer_flush
+ * @category bitstream
+ * @brief    Writes out any bits still held by the writer, padding the last byte with zeroes.
+ * @param    w          The writer.
+ * @return   Returns the number of bytes written to the buffer.
+ * @remarks  More values can still be written afterwards, starting at the next whole byte.
+ * @related  CF_BitWriter cf_make_bit_writer cf_bit_writer_bits_written cf_bit_writer_overflowed
+ */
+CF_API int CF_CALL cf_bit_writer_flush(CF_BitWriter* w);
+
+/**
+ * @function cf_bit_writer_bits_written
+ * @category bitstream
+ * @brief    Returns the number of bits written so far.
+ * @param    w          The writer.
+ * @related  CF_BitWriter cf_bit_writer_flush
+ */
+CF_API int CF_CALL cf_bit_writer_bits_written(const CF_BitWriter* w);
+
+/**
+ * @function cf_bit_writer_overflowed
+ * @category bitstream
+ * @brief    Returns true if any value didn't fit in the buffer.
+ * @param    w          The writer.
+ * @remarks  Once overflowed, the rest of the values aren't written, and the buffer shouldn't be sent.
+ * @related  CF_BitWriter cf_make_bit_writer cf_bit_writer_flush
+ */
+CF_API bool CF_CALL cf_bit_writer_overflowed(const CF_BitWriter* w);
+
+/**
+ * @function cf_bit_write
+ * @category bitstream
+ * @brief    Writes the lowest `bits` bits of `value`.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @param    bits       The number of bits to write, up to 32.
+ * @related  CF_BitWriter cf_bit_read cf_bit_write_int cf_bit_write_varint
+ */
+CF_API void CF_CALL cf_bit_write(CF_BitWriter* w, uint32_t value, int bits);
+
+/**
+ * @function cf_bit_write_bool
+ * @category bitstream
+ * @brief    Writes a bool as a single bit.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @related  CF_BitWriter cf_bit_read_bool
+ */
+CF_API void CF_CALL cf_bit_write_bool(CF_BitWriter* w, bool value);
+
+/**
+ * @function cf_bit_write_int
+ * @category bitstream
+ * @brief    Writes an integer known to lie within [min, max] using `cf_bits_required(min, max)` bits.
+ * @param    w          The writer.
+ * @param    value      The value to write. Values outside of the range are clamped.
+ * @param    min        The smallest value.
+ * @param    max        The largest value.
+ * @related  CF_BitWriter cf_bit_read_int cf_bits_required
+ */
+CF_API void CF_CALL cf_bit_write_int(CF_BitWriter* w, int value, int min, int max);
+
+/**
+ * @function cf_bit_write_varint
+ * @category bitstream
+ * @brief    Writes an unsigned integer in seven bit groups, so small values take fewer bits.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @remarks  Takes eight bits for values under 128, sixteen bits for values under 16384, and so on. Good for counts and ids which are
+ *           usually small but have no known upper bound.
+ * @related  CF_BitWriter cf_bit_read_varint cf_bit_write_varint_signed
+ */
+CF_API void CF_CALL cf_bit_write_varint(CF_BitWriter* w, uint64_t value);
+
+/**
+ * @function cf_bit_write_varint_signed
+ * @category bitstream
+ * @brief    Writes a signed integer as with `cf_bit_write_varint`, so values near zero take fewer bits.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @related  CF_BitWriter cf_bit_read_varint_signed cf_bit_write_varint
+ */
+CF_API void CF_CALL cf_bit_write_varint_signed(CF_BitWriter* w, int64_t value);
+
+/**
+ * @function cf_bit_write_float
+ * @category bitstream
+ * @brief    Writes a float with full precision, as 32 bits.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @remarks  Prefer `cf_bit_write_quantized` when the range and precision needed are known.
+ * @related  CF_BitWriter cf_bit_read_float cf_bit_write_quantized
+ */
+CF_API void CF_CALL cf_bit_write_float(CF_BitWriter* w, float value);
+
+/**
+ * @function cf_bit_write_quantized
+ * @category bitstream
+ * @brief    Writes a float known to lie within [min, max], rounded to a multiple of `resolution`.
+ * @param    w          The writer.
+ * @param    value      The value to write. Values outside of the range are clamped.
+ * @param    min        The smallest value.
+ * @param    max        The largest value.
+ * @param    resolution The precision to keep, such as 0.01f for positions to within a hundredth of a unit.
+ * @remarks  Takes `cf_bits_required(0, ceil((max - min) / resolution))` bits. For example, a position within [-1000, 1000] to a precision
+ *           of 0.01 takes 18 bits instead of 32. Read it back with the same `min`, `max` and `resolution`.
+ * @related  CF_BitWriter cf_bit_read_quantized cf_bit_write_delta_quantized
+ */
+CF_API void CF_CALL cf_bit_write_quantized(CF_BitWriter* w, float value, float min, float max, float resolution);
+
+/**
+ * @function cf_bit_write_delta
+ * @category bitstream
+ * @brief    Writes an integer as its difference from a `baseline` value the reader also has.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @param    baseline   The value to encode against, such as the value from the last snapshot the receiver acknowledged.
+ * @remarks  Takes a single bit when the value is unchanged, and few bits when it changed a little.
+ * @related  CF_BitWriter cf_bit_read_delta cf_bit_write_delta_quantized
+ */
+CF_API void CF_CALL cf_bit_write_delta(CF_BitWriter* w, int value, int baseline);
+
+/**
+ * @function cf_bit_write_delta_quantized
+ * @category bitstream
+ * @brief    Writes a quantized float as its difference from a `baseline` value the reader also has.
+ * @param    w          The writer.
+ * @param    value      The value to write.
+ * @param    baseline   The value to encode against, such as the value from the last snapshot the receiver acknowledged.
+ * @param    min        The smallest value.
+ * @param    max        The largest value.
+ * @param    resolution The precision to keep.
+ * @remarks  Both values are quantized as with `cf_bit_write_quantized`, and the difference between them written as with `cf_bit_write_delta`.
+ * @related  CF_BitWriter cf_bit_read_delta_quantized cf_bit_write_quantized cf_bit_write_delta
+ */
+CF_API void CF_CALL cf_bit_write_delta_quantized(CF_BitWriter* w, float value, float baseline, float min, float max, float resolution);
+
+/**
+ * @function cf_bit_write_align
+ * @category bitstream
+ * @brief    Pads with zero bits up to the next whole byte.
+ * @param    w          The writer.
+ * @related  CF_BitWriter cf_bit_read_align cf_bit_write_bytes
+ */
+CF_API void CF_CALL cf_bit_write_align(CF_BitWriter* w);
+
+/**
+ * @function cf_bit_write_bytes
+ * @category bitstream
+ * @brief    Aligns to the next whole byte, then copies in raw bytes.
+ * @param    w          The writer.
+ * @param    data       The bytes to write.
+ * @param    size       The number of bytes to write.
+ * @related  CF_BitWriter cf_bit_read_bytes cf_bit_write_align
+ */
+CF_API void CF_CALL cf_bit_write_bytes(CF_BitWriter* w, const void* data, int size);
+
+/**
+ * @function cf_make_bit_reader
+ * @category bitstream
+ * @brief    Returns a `CF_BitReader` to read values packed by a `CF_BitWriter`.
+ * @param    data       The buffer to read from.
+ * @param    size       The size of `data` in bytes.
+ * @related  CF_BitReader cf_bit_reader_failed cf_bit_reader_bits_remaining
+ */
+CF_API CF_BitReader CF_CALL cf_make_bit_reader(const void* data, int size);
+
+/**
+ * @function cf_bit_reader_failed
+ * @category bitstream
+ * @brief    Returns true if any read went past the end of the buffer, or found a value outside of its range.
+ * @param    r          The reader.
+ * @remarks  Once failed, reads return zero. Treat the values read so far as garbage, such as by dropping the packet.
+ * @related  CF_BitReader cf_make_bit_reader
+ */
+CF_API bool CF_CALL cf_bit_reader_failed(const CF_BitReader* r);
+
+/**
+ * @function cf_bit_reader_bits_remaining
+ * @category bitstream
+ * @brief    Returns the number of bits left to read.
+ * @param    r          The reader.
+ * @remarks  Includes any padding bits at the end of the last byte.
+ * @related  CF_BitReader cf_make_bit_reader
+ */
+CF_API int CF_CALL cf_bit_reader_bits_remaining(const CF_BitReader* r);
+
+/**
+ * @function cf_bit_read
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write`.
+ * @param    r          The reader.
+ * @param    bits       The number of bits to read, up to 32.
+ * @related  CF_BitReader cf_bit_write
+ */
+CF_API uint32_t CF_CALL cf_bit_read(CF_BitReader* r, int bits);
+
+/**
+ * @function cf_bit_read_bool
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_bool`.
+ * @param    r          The reader.
+ * @related  CF_BitReader cf_bit_write_bool
+ */
+CF_API bool CF_CALL cf_bit_read_bool(CF_BitReader* r);
+
+/**
+ * @function cf_bit_read_int
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_int`.
+ * @param    r          The reader.
+ * @param    min        The smallest value, as written.
+ * @param    max        The largest value, as written.
+ * @remarks  A value above `max` fails the reader.
+ * @related  CF_BitReader cf_bit_write_int
+ */
+CF_API int CF_CALL cf_bit_read_int(CF_BitReader* r, int min, int max);
+
+/**
+ * @function cf_bit_read_varint
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_varint`.
+ * @param    r          The reader.
+ * @related  CF_BitReader cf_bit_write_varint
+ */
+CF_API uint64_t CF_CALL cf_bit_read_varint(CF_BitReader* r);
+
+/**
+ * @function cf_bit_read_varint_signed
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_varint_signed`.
+ * @param    r          The reader.
+ * @related  CF_BitReader cf_bit_write_varint_signed
+ */
+CF_API int64_t CF_CALL cf_bit_read_varint_signed(CF_BitReader* r);
+
+/**
+ * @function cf_bit_read_float
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_float`.
+ * @param    r          The reader.
+ * @related  CF_BitReader cf_bit_write_float
+ */
+CF_API float CF_CALL cf_bit_read_float(CF_BitReader* r);
+
+/**
+ * @function cf_bit_read_quantized
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_quantized`.
+ * @param    r          The reader.
+ * @param    min        The smallest value, as written.
+ * @param    max        The largest value, as written.
+ * @param    resolution The precision kept, as written.
+ * @related  CF_BitReader cf_bit_write_quantized
+ */
+CF_API float CF_CALL cf_bit_read_quantized(CF_BitReader* r, float min, float max, float resolution);
+
+/**
+ * @function cf_bit_read_delta
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_delta`.
+ * @param    r          The reader.
+ * @param    baseline   The same baseline the value was written against.
+ * @related  CF_BitReader cf_bit_write_delta
+ */
+CF_API int CF_CALL cf_bit_read_delta(CF_BitReader* r, int baseline);
+
+/**
+ * @function cf_bit_read_delta_quantized
+ * @category bitstream
+ * @brief    Reads a value written by `cf_bit_write_delta_quantized`.
+ * @param    r          The reader.
+ * @param    baseline   The same baseline the value was written against.
+ * @param    min        The smallest value, as written.
+ * @param    max        The largest value, as written.
+ * @param    resolution The precision kept, as written.
+ * @related  CF_BitReader cf_bit_write_delta_quantized
+ */
+CF_API float CF_CALL cf_bit_read_delta_quantized(CF_BitReader* r, float baseline, float min, float max, float resolution);
+
+/**
+ * @function cf_bit_read_align
+ * @category bitstream
+ * @brief    Skips the padding written by `cf_bit_write_align`.
+ * @param    r          The reader.
+ * @related  CF_BitReader cf_bit_write_align
+ */
+CF_API void CF_CALL cf_bit_read_align(CF_BitReader* r);
+
+/**
+ * @function cf_bit_read_bytes
+ * @category bitstream
+ * @brief    Reads raw bytes written by `cf_bit_write_bytes`.
+ * @param    r          The reader.
+ * @param    data       Where to copy the bytes.
+ * @param    size       The number of bytes to read.
+ * @remarks  On failure `data` is zeroed.
+ * @related  CF_BitReader cf_bit_write_bytes
+ */
+CF_API void CF_CALL cf_bit_read_bytes(CF_BitReader* r, void* data, int size);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using BitWriter = CF_BitWriter;
+using BitReader = CF_BitReader;
+
+CF_INLINE int bits_required(int min, int max) { return cf_bits_required(min, max); }
+
+CF_INLINE BitWriter make_bit_writer(void* buffer, int size) { return cf_make_bit_writer(buffer, size); }
+CF_INLINE int bit_writer_flush(BitWriter* w) { return cf_bit_writer_flush(w); }
+CF_INLINE int bit_writer_bits_written(const BitWriter* w) { return cf_bit_writer_bits_written(w); }
+CF_INLINE bool bit_writer_overflowed(const BitWriter* w) { return cf_bit_writer_overflowed(w); }
+CF_INLINE void bit_write(BitWriter* w, uint32_t value, int bits) { cf_bit_write(w, value, bits); }
+CF_INLINE void bit_write_bool(BitWriter* w, bool value) { cf_bit_write_bool(w, value); }
+CF_INLINE void bit_write_int(BitWriter* w, int value, int min, int max) { cf_bit_write_int(w, value, min, max); }
+CF_INLINE void bit_write_varint(BitWriter* w, uint64_t value) { cf_bit_write_varint(w, value); }
+CF_INLINE void bit_write_varint_signed(BitWriter* w, int64_t value) { cf_bit_write_varint_signed(w, value); }
+CF_INLINE void bit_write_float(BitWriter* w, float value) { cf_bit_write_float(w, value); }
+CF_INLINE void bit_write_quantized(BitWriter* w, float value, float min, float max, float resolution) { cf_bit_write_quantized(w, value, min, max, resolution); }
+CF_INLINE void bit_write_delta(BitWriter* w, int value, int baseline) { cf_bit_write_delta(w, value, baseline); }
+CF_INLINE void bit_write_delta_quantized(BitWriter* w, float value, float baseline, float min, float max, float resolution) { cf_bit_write_delta_quantized(w, value, baseline, min, max, resolution); }
+CF_INLINE void bit_write_align(BitWriter* w) { cf_bit_write_align(w); }
+CF_INLINE void bit_write_bytes(BitWriter* w, const void* data, int size) { cf_bit_write_bytes(w, data, size); }
+
+CF_INLINE BitReader make_bit_reader(const void* data, int size) { return cf_make_bit_reader(data, size); }
+CF_INLINE bool bit_reader_failed(const BitReader* r) { return cf_bit_reader_failed(r); }
+CF_INLINE int bit_reader_bits_remaining(const BitReader* r) { return cf_bit_reader_bits_remaining(r); }
+CF_INLINE uint32_t bit_read(BitReader* r, int bits) { return cf_bit_read(r, bits); }
+CF_INLINE bool bit_read_bool(BitReader* r) { return cf_bit_read_bool(r); }
+CF_INLINE int bit_read_int(BitReader* r, int min, int max) { return cf_bit_read_int(r, min, max); }
+CF_INLINE uint64_t bit_read_varint(BitReader* r) { return cf_bit_read_varint(r); }
+CF_INLINE int64_t bit_read_varint_signed(BitReader* r) { return cf_bit_read_varint_signed(r); }
+CF_INLINE float bit_read_float(BitReader* r) { return cf_bit_read_float(r); }
+CF_INLINE float bit_read_quantized(BitReader* r, float min, float max, float resolution) { return cf_bit_read_quantized(r, min, max, resolution); }
+CF_INLINE int bit_read_delta(BitReader* r, int baseline) { return cf_bit_read_delta(r, baseline); }
+CF_INLINE float bit_read_delta_quantized(BitReader* r, float baseline, float min, float max, float resolution) { return cf_bit_read_delta_quantized(r, baseline, min, max, resolution); }
+CF_INLINE void bit_read_align(BitReader* r) { cf_bit_read_align(r); }
+CF_INLINE void bit_read_bytes(BitReader* r, void* data, int size) { cf_bit_read_bytes(r, data, size); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_BITSTREAM_H
@@ -0,0 +1,191 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_CONTACT_CACHE_H
+#define CF_CONTACT_CACHE_H
+
+#include "cute_defines.h"
+#include "cute_math.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_ContactCache
+ * @category collision
+ * @brief    An opaque handle representing a contact cache. See `cf_make_contact_cache` for more details.
+ * @related  cf_make_contact_cache cf_contact_cache_gjk cf_contact_cache_toi_batch
+ */
+typedef struct CF_ContactCache { uint64_t id; } CF_ContactCache;
+// @end
+
+/**
+ * @struct   CF_SweepPair
+ * @category collision
+ * @brief    One pair of moving shapes for `cf_contact_cache_toi_batch`.
+ * @remarks  The ids name the pair in the cache. Any ids work, such as entity ids, as long as they're stable from frame to frame.
+ * @related  CF_SweepPair cf_contact_cache_toi_batch cf_toi
+ */
+typedef struct CF_SweepPair
+{
+	/* @member Stable id of shape `A`. */
+	uint64_t id_a;
+
+	/* @member Stable id of shape `B`. */
+	uint64_t id_b;
+
+	/* @member The first shape. */
+	const void* A;
+
+	/* @member The `CF_ShapeType` of `A`. */
+	CF_ShapeType typeA;
+
+	/* @member Can be `NULL` to represent an identity transform. An optional pointer to a `CF_Transform` to transform `A`. */
+	const CF_Transform* ax;
+
+	/* @member The velocity of `A`. */
+	CF_V2 vA;
+
+	/* @member The second shape. */
+	const void* B;
+
+	/* @member The `CF_ShapeType` of `B`. */
+	CF_ShapeType typeB;
+
+	/* @member Can be `NULL` to represent an identity transform. An optional pointer to a `CF_Transform` to transform `B`. */
+	const CF_Transform* bx;
+
+	/* @member The velocity of `B`. */
+	CF_V2 vB;
+} CF_SweepPair;
+// @end
+
+/**
+ * @function cf_make_contact_cache
+ * @category collision
+ * @brief    Creates a `CF_ContactCache`, which remembers a `CF_GjkCache` for each pair of shapes from one frame to the next.
+ * @param    initial_capacity  Sizes the internal table for a number of pairs. This may be zero.
+ * @return   Returns a `CF_ContactCache` for warm-starting `cf_gjk`.
+ * @remarks  Shapes that stay in contact, or near each other, for many frames barely change their closest features. Feeding last frame's
+ *           `CF_GjkCache` back into `cf_gjk` lets it start from those features, which takes far fewer iterations than starting over.
+ *           Pairs are looked up by a pair of ids you pick. Call `cf_contact_cache_next_frame` once per frame to forget pairs that
+ *           stopped being tested.
+ * @related  CF_ContactCache cf_destroy_contact_cache cf_contact_cache_gjk cf_contact_cache_toi_batch cf_contact_cache_next_frame
+ */
+CF_API CF_ContactCache CF_CALL cf_make_contact_cache(int initial_capacity);
+
+/**
+ * @function cf_destroy_contact_cache
+ * @category collision
+ * @brief    Destroys a contact cache previously created by `cf_make_contact_cache`.
+ * @param    cache      The contact cache to destroy.
+ * @related  cf_make_contact_cache
+ */
+CF_API void CF_CALL cf_destroy_contact_cache(CF_ContactCache cache);
+
+/**
+ * @function cf_contact_cache_gjk
+ * @category collision
+ * @brief    Same as `cf_gjk`, but warm-started from the last time this pair was tested.
+ * @param    cache       The contact cache.
+ * @param    id_a        Stable id of shape `A`.
+ * @param    id_b        Stable id of shape `B`. Pairs are ordered, so {a, b} and {b, a} are different pairs.
+ * @param    A           The first shape.
+ * @param    typeA       The `CF_ShapeType` of the first shape `A`.
+ * @param    ax          Can be `NULL` to represent an identity transform. An optional pointer to a `CF_Transform` to transform `A`.
+ * @param    B           The second shape.
+ * @param    typeB       The `CF_ShapeType` of the second shape `B`.
+ * @param    bx          Can be `NULL` to represent an identity transform. An optional pointer to a `CF_Transform` to transform `B`.
+ * @param    outA        Can be `NULL`. The closest point on `A` to `B`.
+ * @param    outB        Can be `NULL`. The closest point on `B` to `A`.
+ * @param    use_radius  True if you want to use the radius of any `CF_Circle` or `CF_Capsule` inputs, false to treat them as a point/line segment respectively (a radius of zero).
+ * @param    iterations  Can be `NULL`. Records the number of GJK iterations that occurred.
+ * @return   Returns the distance between the shapes.
+ * @remarks  The cached features are thrown away if a pair's shape types or polygon vertex counts change.
+ * @related  CF_ContactCache cf_gjk cf_contact_cache_toi_batch
+ */
+CF_API float CF_CALL cf_contact_cache_gjk(CF_ContactCache cache, uint64_t id_a, uint64_t id_b, const void* A, CF_ShapeType typeA, const CF_Transform* ax, const void* B, CF_ShapeType typeB, const CF_Transform* bx, CF_V2* outA, CF_V2* outB, bool use_radius, int* iterations);
+
+/**
+ * @function cf_contact_cache_toi_batch
+ * @category collision
+ * @brief    Computes the time of impact for many pairs of moving shapes, same as calling `cf_toi` on each pair.
+ * @param    cache       The contact cache.
+ * @param    pairs       The pairs of shapes to sweep, see `CF_SweepPair`.
+ * @param    count       The number of pairs.
+ * @param    use_radius  True if you want to use the radius of any `CF_Circle` or `CF_Capsule` inputs, false to treat them as a point/line segment respectively (a radius of zero).
+ * @param    out         Receives one `CF_ToiResult` per pair.
+ * @remarks  Each pair first runs a warm-started `cf_contact_cache_gjk`. Two shapes can't close a gap wider than the distance they move
+ *           relative to each other, so pairs further apart than that skip the sweep entirely and report no hit. For fast movers this
+ *           skips most pairs a broadphase hands over. Pairs that skip the sweep only fill out `hit` (zero), `toi` (one) and `iterations`.
+ * @related  CF_ContactCache CF_SweepPair CF_ToiResult cf_toi cf_contact_cache_gjk
+ */
+CF_API void CF_CALL cf_contact_cache_toi_batch(CF_ContactCache cache, const CF_SweepPair* pairs, int count, bool use_radius, CF_ToiResult* out);
+
+/**
+ * @function cf_contact_cache_remove
+ * @category collision
+ * @brief    Forgets a pair, for example when one of the shapes is destroyed.
+ * @param    cache      The contact cache.
+ * @param    id_a       Stable id of shape `A`.
+ * @param    id_b       Stable id of shape `B`.
+ * @related  CF_ContactCache cf_contact_cache_next_frame
+ */
+CF_API void CF_CALL cf_contact_cache_remove(CF_ContactCache cache, uint64_t id_a, uint64_t id_b);
+
+/**
+ * @function cf_contact_cache_next_frame
+ * @category collision
+ * @brief    Advances the cache by one frame, forgetting pairs that haven't been tested for a while.
+ * @param    cache            The contact cache.
+ * @param    max_idle_frames  Pairs not tested within this many frames are forgotten. Zero keeps only pairs tested this frame.
+ * @remarks  Call this once per frame so the cache doesn't grow with every pair that was ever tested.
+ * @related  CF_ContactCache cf_contact_cache_count
+ */
+CF_API void CF_CALL cf_contact_cache_next_frame(CF_ContactCache cache, int max_idle_frames);
+
+/**
+ * @function cf_contact_cache_count
+ * @category collision
+ * @brief    Returns the number of pairs in the cache.
+ * @param    cache      The contact cache.
+ * @related  CF_ContactCache cf_contact_cache_next_frame
+ */
+CF_API int CF_CALL cf_contact_cache_count(CF_ContactCache cache);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using ContactCache = CF_ContactCache;
+using SweepPair = CF_SweepPair;
+
+CF_INLINE ContactCache make_contact_cache(int initial_capacity = 0) { return cf_make_contact_cache(initial_capacity); }
+CF_INLINE void destroy_contact_cache(ContactCache cache) { cf_destroy_contact_cache(cache); }
+CF_INLINE float contact_cache_gjk(ContactCache cache, uint64_t id_a, uint64_t id_b, const void* A, ShapeType typeA, const Transform* ax, const void* B, ShapeType typeB, const Transform* bx, v2* outA = NULL, v2* outB = NULL, bool use_radius = true, int* iterations = NULL) { return cf_contact_cache_gjk(cache, id_a, id_b, A, typeA, ax, B, typeB, bx, (CF_V2*)outA, (CF_V2*)outB, use_radius, iterations); }
+CF_INLINE void contact_cache_toi_batch(ContactCache cache, const SweepPair* pairs, int count, bool use_radius, ToiResult* out) { cf_contact_cache_toi_batch(cache, pairs, count, use_radius, out); }
+CF_INLINE void contact_cache_remove(ContactCache cache, uint64_t id_a, uint64_t id_b) { cf_contact_cache_remove(cache, id_a, id_b); }
+CF_INLINE void contact_cache_next_frame(ContactCache cache, int max_idle_frames = 0) { cf_contact_cache_next_frame(cache, max_idle_frames); }
+CF_INLINE int contact_cache_count(ContactCache cache) { return cf_contact_cache_count(cache); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_CONTACT_CACHE_H
@@ -53,6 +53,9 @@ typedef void (CF_CoroutineFn)(CF_Coroutine co);
  *           coroutine with `cf_destroy_coroutine` when done. See `CF_Coroutine` for some more details. **IMPORTANT NOTE**: You should beef
  *           up the stack_size to 1 or 2 MB (you may use e.g. `CF_MB * 2`) if you wish to call into APIs such as DirectX. A variety of APIs
  *           and libraries out there have very deep or complex call stacks -- so the default size may cause stack overflows in such cases.
+ *           On the other hand, shallow coroutines that only call a few small functions may go as low as 4096 bytes. Memory for coroutines is
+ *           pooled by size, so once a few coroutines of a given stack size have been destroyed, making new ones doesn't allocate. Stacks
+ *           have no guard pages, overflowing them corrupts memory rather than crashing right away.
  * @related  CF_Coroutine CF_CoroutineFn CF_CoroutineState cf_make_coroutine cf_destroy_coroutine cf_coroutine_state_to_string cf_coroutine_resume cf_coroutine_yield cf_coroutine_state cf_coroutine_get_udata cf_coroutine_push cf_coroutine_pop cf_coroutine_bytes_pushed cf_coroutine_space_remaining cf_coroutine_currently_running
  */
 CF_API CF_Coroutine CF_CALL cf_make_coroutine(CF_CoroutineFn* fn, int stack_size, void* udata);
@@ -62,7 +65,8 @@ CF_API CF_Coroutine CF_CALL cf_make_coroutine(CF_CoroutineFn* fn, int stack_size
  * @category coroutine
  * @brief    Destroys a coroutine created by `cf_make_coroutine`.
  * @param    co            The coroutine.
- * @remarks  All objects on the coroutine's stack will get automically cleaned up.
+ * @remarks  All objects on the coroutine's stack will get automically cleaned up. The coroutine's memory is kept around to be reused by
+ *           `cf_make_coroutine`, see `cf_coroutine_release_pooled_memory`.
  * @related  CF_Coroutine CF_CoroutineFn CF_CoroutineState cf_make_coroutine cf_destroy_coroutine cf_coroutine_state_to_string cf_coroutine_resume cf_coroutine_yield cf_coroutine_state cf_coroutine_get_udata cf_coroutine_push cf_coroutine_pop cf_coroutine_bytes_pushed cf_coroutine_space_remaining cf_coroutine_currently_running
  */
 CF_API void CF_CALL cf_destroy_coroutine(CF_Coroutine co);
@@ -214,6 +218,85 @@ CF_API size_t CF_CALL cf_coroutine_space_remaining(CF_Coroutine co);
  */
 CF_API CF_Coroutine CF_CALL cf_coroutine_currently_running();
 
+/**
+ * @function cf_coroutine_release_pooled_memory
+ * @category coroutine
+ * @brief    Frees the memory of destroyed coroutines kept around for reuse.
+ * @remarks  Destroyed coroutines return their memory to a pool, up to 32 MB for each distinct stack size, so `cf_make_coroutine` can skip
+ *           the allocation next time. Call this after a burst of coroutines to give the memory back. Called by `cf_destroy_app`.
+ * @related  cf_make_coroutine cf_destroy_coroutine cf_coroutine_release_pooled_memory
+ */
+CF_API void CF_CALL cf_coroutine_release_pooled_memory();
+
+/**
+ * @function cf_coroutine_schedule
+ * @category coroutine
+ * @brief    Hands a coroutine over to the scheduler, which resumes it from `cf_coroutine_scheduler_update` from then on.
+ * @param    co                 The coroutine, fresh from `cf_make_coroutine` or suspended.
+ * @param    destroy_when_done  True to have the scheduler call `cf_destroy_coroutine` once the coroutine finishes.
+ * @remarks  Instead of resuming every coroutine by hand each frame, scheduled coroutines wait with `cf_coroutine_wait_seconds`,
+ *           `cf_coroutine_wait_signal` or `cf_https_wait`, and are only resumed once whatever they wait on is ready. A coroutine
+ *           that calls `cf_coroutine_yield` instead is resumed again on the next update. Once the coroutine finishes the scheduler
+ *           lets go of it. Don't destroy a scheduled coroutine before it's done, and don't resume it yourself.
+ * @related  cf_coroutine_schedule cf_coroutine_scheduler_update cf_coroutine_scheduled_count cf_coroutine_wait_seconds cf_coroutine_wait_signal cf_coroutine_signal
+ */
+CF_API void CF_CALL cf_coroutine_schedule(CF_Coroutine co, bool destroy_when_done);
+
+/**
+ * @function cf_coroutine_scheduler_update
+ * @category coroutine
+ * @brief    Advances the scheduler's clock and resumes the scheduled coroutines that are ready.
+ * @param    dt         Time passed since the last update in seconds, usually `CF_DELTA_TIME`.
+ * @remarks  Call this once per frame from the main thread. Sleeping coroutines cost nothing until their time is up, timed waits are
+ *           kept in a timer wheel and signal waits in per-signal lists. Coroutines readied during the update, for example by a
+ *           `cf_coroutine_signal` from another coroutine, are resumed on the next update.
+ * @related  cf_coroutine_schedule cf_coroutine_scheduler_update cf_coroutine_scheduled_count cf_coroutine_wait_seconds cf_coroutine_wait_signal cf_coroutine_signal
+ */
+CF_API void CF_CALL cf_coroutine_scheduler_update(float dt);
+
+/**
+ * @function cf_coroutine_scheduled_count
+ * @category coroutine
+ * @brief    Returns the number of coroutines handed to `cf_coroutine_schedule` that haven't finished yet.
+ * @related  cf_coroutine_schedule cf_coroutine_scheduler_update cf_coroutine_scheduled_count cf_coroutine_wait_seconds cf_coroutine_wait_signal cf_coroutine_signal
+ */
+CF_API int CF_CALL cf_coroutine_scheduled_count();
+
+/**
+ * @function cf_coroutine_wait_seconds
+ * @category coroutine
+ * @brief    Yields a scheduled coroutine until `seconds` have passed on the scheduler's clock.
+ * @param    co         The coroutine calling this function.
+ * @param    seconds    How long to wait.
+ * @remarks  Only call this from within a coroutine handed to `cf_coroutine_schedule`. Wake-ups happen on the first
+ *           `cf_coroutine_scheduler_update` at or past the time, so the resolution is one frame.
+ * @related  cf_coroutine_schedule cf_coroutine_scheduler_update cf_coroutine_scheduled_count cf_coroutine_wait_seconds cf_coroutine_wait_signal cf_coroutine_signal
+ */
+CF_API void CF_CALL cf_coroutine_wait_seconds(CF_Coroutine co, float seconds);
+
+/**
+ * @function cf_coroutine_wait_signal
+ * @category coroutine
+ * @brief    Yields a scheduled coroutine until `cf_coroutine_signal` is called with `signal`.
+ * @param    co         The coroutine calling this function.
+ * @param    signal     Any number you like, such as an entity id or a hashed event name.
+ * @remarks  Only call this from within a coroutine handed to `cf_coroutine_schedule`.
+ * @related  cf_coroutine_schedule cf_coroutine_scheduler_update cf_coroutine_scheduled_count cf_coroutine_wait_seconds cf_coroutine_wait_signal cf_coroutine_signal
+ */
+CF_API void CF_CALL cf_coroutine_wait_signal(CF_Coroutine co, uint64_t signal);
+
+/**
+ * @function cf_coroutine_signal
+ * @category coroutine
+ * @brief    Wakes every coroutine waiting on `signal` in `cf_coroutine_wait_signal`.
+ * @param    signal     The signal.
+ * @return   Returns the number of coroutines woken up.
+ * @remarks  The coroutines resume on the next `cf_coroutine_scheduler_update`. Signals aren't remembered, coroutines that start waiting
+ *           afterwards wait for the next one.
+ * @related  cf_coroutine_schedule cf_coroutine_scheduler_update cf_coroutine_scheduled_count cf_coroutine_wait_seconds cf_coroutine_wait_signal cf_coroutine_signal
+ */
+CF_API int CF_CALL cf_coroutine_signal(uint64_t signal);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -246,6 +329,13 @@ CF_INLINE const char* to_string(CoroutineState type)
 
 CF_INLINE Coroutine make_coroutine(CoroutineFn* fn, int stack_size = 0, void* udata = NULL) { return cf_make_coroutine(fn, stack_size, udata); }
 CF_INLINE void destroy_coroutine(Coroutine co) { cf_destroy_coroutine(co); }
+CF_INLINE void coroutine_release_pooled_memory() { cf_coroutine_release_pooled_memory(); }
+CF_INLINE void coroutine_schedule(Coroutine co, bool destroy_when_done = false) { cf_coroutine_schedule(co, destroy_when_done); }
+CF_INLINE void coroutine_scheduler_update(float dt) { cf_coroutine_scheduler_update(dt); }
+CF_INLINE int coroutine_scheduled_count() { return cf_coroutine_scheduled_count(); }
+CF_INLINE void coroutine_wait_seconds(Coroutine co, float seconds) { cf_coroutine_wait_seconds(co, seconds); }
+CF_INLINE void coroutine_wait_signal(Coroutine co, uint64_t signal) { cf_coroutine_wait_signal(co, signal); }
+CF_INLINE int coroutine_signal(uint64_t signal) { return cf_coroutine_signal(signal); }
 	 
 CF_INLINE Result coroutine_resume(Coroutine co) { return cf_coroutine_resume(co); }
 CF_INLINE Result coroutine_yield(Coroutine co) { return cf_coroutine_yield(co); }
@@ -8,5 +8,5 @@
 #ifdef CF_DEBUG_PRINTF
 #undef CF_DEBUG_PRINTF
 #endif
-#include <stdio.h>
-#define CF_DEBUG_PRINTF(...) printf(__VA_ARGS__)
+#include "cute_log.h"
+#define CF_DEBUG_PRINTF(...) cf_log(CF_LOG_LEVEL_DEBUG, __VA_ARGS__)
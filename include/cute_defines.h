@@ -119,7 +119,13 @@
 
 #define SOKOL_API_DECL CF_API
 
-#if defined(CF_WINDOWS)
+#if defined(CF_NULL_GFX)
+	// Set by CF_FRAMEWORK_NULL_GFX in CMake, see `CF_BACKEND_TYPE_DUMMY`.
+#	define SOKOL_DUMMY_BACKEND
+#	ifdef CF_EMSCRIPTEN
+#		include <emscripten.h>
+#	endif
+#elif defined(CF_WINDOWS)
 #	define SOKOL_D3D11
 #elif defined(CF_LINUX)
 #	define SOKOL_GLCORE33
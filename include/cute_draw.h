@@ -280,6 +280,9 @@ CF_API void CF_CALL cf_draw_line(CF_V2 p0, CF_V2 p1, float thickness);
  * @param    thickness    The thickness of the line to draw.
  * @param    loop         True to connect the first and last point to form a loop. False otherwise.
  * @param    bevel_count  The number of edges used to smooth corners.
+ * @remarks  The triangulation is cached by the points, thickness and antialiasing. Drawing the same polyline again, such as
+ *           every frame, only re-transforms the cached triangles by the current camera. This also applies to `cf_draw_bezier_line`
+ *           and `cf_draw_bezier_line2`. Polylines not drawn for a frame are dropped from the cache.
  * @related  cf_draw_line cf_draw_polyline cf_draw_bezier_line cf_draw_bezier_line2 cf_draw_arrow
  */
 CF_API void CF_CALL cf_draw_polyline(CF_V2* points, int count, float thickness, bool loop);
@@ -326,6 +329,175 @@ CF_API void CF_CALL cf_draw_bezier_line2(CF_V2 a, CF_V2 c0, CF_V2 c1, CF_V2 b, i
  */
 CF_API void CF_CALL cf_draw_arrow(CF_V2 a, CF_V2 b, float thickness, float arrow_width);
 
+/**
+ * @struct   CF_DrawList
+ * @category draw
+ * @brief    An opaque handle representing a list of recorded draw commands.
+ * @remarks  Normally every `cf_draw_*` call goes straight into one shared batch, so only the main thread can draw. A draw list has its
+ *           own copy of the draw state (color, tint, layer, camera, antialiasing, vertex attributes), so separate threads can each
+ *           record into their own list at the same time. The lists are then submitted on the main thread, in whatever order you
+ *           submit them, which keeps the final output deterministic.
+ *
+ *           Only shapes and sprites can be recorded. Text uses the shared glyph cache and must be drawn on the main thread. Sprites
+ *           and images must already be loaded. Render settings (`cf_render_settings_*`) are not part of a list, they apply when
+ *           the main thread renders.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+typedef struct CF_DrawList { uint64_t id; } CF_DrawList;
+// @end
+
+/**
+ * @function cf_make_draw_list
+ * @category draw
+ * @brief    Returns a new, empty draw list.
+ * @remarks  Call this from the main thread. The list starts out with a copy of the current draw state, see `cf_draw_list_reset`.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+CF_API CF_DrawList CF_CALL cf_make_draw_list();
+
+/**
+ * @function cf_destroy_draw_list
+ * @category draw
+ * @brief    Destroys a draw list made by `cf_make_draw_list`.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+CF_API void CF_CALL cf_destroy_draw_list(CF_DrawList list);
+
+/**
+ * @function cf_draw_list_reset
+ * @category draw
+ * @brief    Clears all recorded commands and copies the current draw state into a draw list.
+ * @remarks  Call this from the main thread once per frame, before handing the list off to another thread. Copying the state picks up
+ *           the current camera, color, layer and so on, so recorded commands match what drawing on the main thread would produce.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+CF_API void CF_CALL cf_draw_list_reset(CF_DrawList list);
+
+/**
+ * @function cf_draw_list_begin
+ * @category draw
+ * @brief    Begins recording into a draw list from the calling thread.
+ * @remarks  Until `cf_draw_list_end`, all `cf_draw_*` calls made on this thread are recorded into `list`, and push/pop calls only
+ *           affect the list's own state. A list can only be recorded by one thread at a time.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+CF_API void CF_CALL cf_draw_list_begin(CF_DrawList list);
+
+/**
+ * @function cf_draw_list_end
+ * @category draw
+ * @brief    Stops recording into a draw list, started with `cf_draw_list_begin`.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+CF_API void CF_CALL cf_draw_list_end(CF_DrawList list);
+
+/**
+ * @function cf_draw_list_submit
+ * @category draw
+ * @brief    Adds all commands recorded into a draw list to the main thread's batch, as if they were drawn right now.
+ * @remarks  Call this from the main thread, once all threads recording the list are done. Submitting doesn't clear the list, so
+ *           the same commands can be submitted again. Call `cf_draw_list_reset` to start over.
+ * @related  CF_DrawList cf_make_draw_list cf_destroy_draw_list cf_draw_list_reset cf_draw_list_begin cf_draw_list_end cf_draw_list_submit
+ */
+CF_API void CF_CALL cf_draw_list_submit(CF_DrawList list);
+
+/**
+ * @struct   CF_StaticGeometry
+ * @category draw
+ * @brief    An opaque handle representing a recorded set of draw calls, baked for fast redrawing.
+ * @remarks  Meant for things drawn every frame that never change, like tilemaps or level art. All images used are copied into a
+ *           private texture atlas, and all vertices are generated once, so each redraw is a single draw call that skips the
+ *           batcher entirely.
+ * @related  CF_StaticGeometry cf_static_geometry_begin cf_static_geometry_end cf_destroy_static_geometry cf_draw_static_geometry
+ */
+typedef struct CF_StaticGeometry { uint64_t id; } CF_StaticGeometry;
+// @end
+
+/**
+ * @function cf_static_geometry_begin
+ * @category draw
+ * @brief    Starts recording draw calls into a new `CF_StaticGeometry`.
+ * @remarks  All shapes and sprites drawn until `cf_static_geometry_end` are recorded instead of drawn, the same as recording a
+ *           `CF_DrawList`. Text can't be recorded, and neither can sprites from premade atlases (`cf_register_premade_atlas`).
+ * @related  CF_StaticGeometry cf_static_geometry_begin cf_static_geometry_end cf_destroy_static_geometry cf_draw_static_geometry
+ */
+CF_API void CF_CALL cf_static_geometry_begin();
+
+/**
+ * @function cf_static_geometry_end
+ * @category draw
+ * @brief    Finishes recording started by `cf_static_geometry_begin`, and returns the baked geometry.
+ * @remarks  Free it up with `cf_destroy_static_geometry` when done.
+ * @related  CF_StaticGeometry cf_static_geometry_begin cf_static_geometry_end cf_destroy_static_geometry cf_draw_static_geometry
+ */
+CF_API CF_StaticGeometry CF_CALL cf_static_geometry_end();
+
+/**
+ * @function cf_destroy_static_geometry
+ * @category draw
+ * @brief    Destroys geometry made by `cf_static_geometry_end`.
+ * @related  CF_StaticGeometry cf_static_geometry_begin cf_static_geometry_end cf_destroy_static_geometry cf_draw_static_geometry
+ */
+CF_API void CF_CALL cf_destroy_static_geometry(CF_StaticGeometry geometry);
+
+/**
+ * @function cf_draw_static_geometry
+ * @category draw
+ * @brief    Draws geometry made by `cf_static_geometry_end`.
+ * @remarks  Static geometry is rendered underneath everything else drawn for the same `cf_render_to` (or `cf_app_draw_onto_screen`),
+ *           which suits backgrounds such as tilemaps. The current camera is applied, so the geometry may be recorded once and drawn from
+ *           any camera. Drawing with the same camera it was recorded with is fastest, as the vertices don't need to be touched at all.
+ * @related  CF_StaticGeometry cf_static_geometry_begin cf_static_geometry_end cf_destroy_static_geometry cf_draw_static_geometry
+ */
+CF_API void CF_CALL cf_draw_static_geometry(CF_StaticGeometry geometry);
+
+/**
+ * @function cf_debug_draw_line
+ * @category draw
+ * @brief    Draws a one pixel wide line meant for debugging, such as physics shapes or AI paths.
+ * @param    p0         An endpoint of the line.
+ * @param    p1         An endpoint of the line.
+ * @param    color      The color of the line.
+ * @remarks  Debug lines skip the sprite batcher and the shape shader entirely. Each becomes a thin quad of flat colored
+ *           triangles in a separate buffer, and the whole buffer is drawn in a single draw call on top of everything else
+ *           by `cf_app_draw_onto_screen`, so many thousands of lines per frame are cheap. The current camera is applied,
+ *           but draw layers, colors, render states and the like are not.
+ *
+ *           Define `CF_NO_DEBUG_DRAW` (or turn off the `CF_FRAMEWORK_DEBUG_DRAW` CMake option) to compile every debug draw
+ *           call down to nothing for release builds.
+ * @related  cf_debug_draw_line cf_debug_draw_box cf_debug_draw_circle
+ */
+CF_API void CF_CALL cf_debug_draw_line(CF_V2 p0, CF_V2 p1, CF_Color color);
+
+/**
+ * @function cf_debug_draw_box
+ * @category draw
+ * @brief    Draws the outline of a box with one pixel wide debug lines.
+ * @param    box        The box.
+ * @param    color      The color of the outline.
+ * @remarks  See `cf_debug_draw_line` for details.
+ * @related  cf_debug_draw_line cf_debug_draw_box cf_debug_draw_circle
+ */
+CF_API void CF_CALL cf_debug_draw_box(CF_Aabb box, CF_Color color);
+
+/**
+ * @function cf_debug_draw_circle
+ * @category draw
+ * @brief    Draws the outline of a circle with one pixel wide debug lines.
+ * @param    p          The center of the circle.
+ * @param    r          The radius of the circle.
+ * @param    color      The color of the outline.
+ * @remarks  See `cf_debug_draw_line` for details.
+ * @related  cf_debug_draw_line cf_debug_draw_box cf_debug_draw_circle
+ */
+CF_API void CF_CALL cf_debug_draw_circle(CF_V2 p, float r, CF_Color color);
+
+#ifdef CF_NO_DEBUG_DRAW
+#	define cf_debug_draw_line(p0, p1, color) ((void)0)
+#	define cf_debug_draw_box(box, color) ((void)0)
+#	define cf_debug_draw_circle(p, r, color) ((void)0)
+#endif // CF_NO_DEBUG_DRAW
+
 /**
  * @function cf_draw_push_layer
  * @category draw
@@ -333,7 +505,7 @@ CF_API void CF_CALL cf_draw_arrow(CF_V2 a, CF_V2 b, float thickness, float arrow
  * @param    layer      The layer.
  * @remarks  Draw layers are sorted before rendering. Lower numbers are rendered fast, while larger numbers are rendered last.
  *           This can be used to pick which sprites/shapes should draw on top of each other.
- * @related  cf_draw_push_layer cf_draw_pop_layer cf_draw_peek_layer
+ * @related  cf_draw_push_layer cf_draw_pop_layer cf_draw_peek_layer cf_draw_push_opaque
  */
 CF_API void CF_CALL cf_draw_push_layer(int layer);
 
@@ -343,7 +515,7 @@ CF_API void CF_CALL cf_draw_push_layer(int layer);
  * @brief    Pops and returns the last draw layer.
  * @remarks  Draw layers are sorted before rendering. Lower numbers are rendered fast, while larger numbers are rendered last.
  *           This can be used to pick which sprites/shapes should draw on top of each other.
- * @related  cf_draw_push_layer cf_draw_pop_layer cf_draw_peek_layer
+ * @related  cf_draw_push_layer cf_draw_pop_layer cf_draw_peek_layer cf_draw_push_opaque
  */
 CF_API int CF_CALL cf_draw_pop_layer();
 
@@ -353,10 +525,40 @@ CF_API int CF_CALL cf_draw_pop_layer();
  * @brief    Returns the last draw layer.
  * @remarks  Draw layers are sorted before rendering. Lower numbers are rendered fast, while larger numbers are rendered last.
  *           This can be used to pick which sprites/shapes should draw on top of each other.
- * @related  cf_draw_push_layer cf_draw_pop_layer cf_draw_peek_layer
+ * @related  cf_draw_push_layer cf_draw_pop_layer cf_draw_peek_layer cf_draw_push_opaque
  */
 CF_API int CF_CALL cf_draw_peek_layer();
 
+/**
+ * @function cf_draw_push_clip_box
+ * @category draw
+ * @brief    Pushes a box to clip all following draws to.
+ * @param    clip_box   The clip box, in the same coordinates as the shapes and sprites drawn within it.
+ * @remarks  Unlike `cf_render_settings_push_scissor`, which applies to a whole `cf_render_to`, the clip box is stored along
+ *           with each sprite and shape as it's drawn. Everything still batches together, so many differently clipped panels
+ *           of a UI can be drawn in a single draw call. Geometry is cut against the box as vertices are generated, which works
+ *           with custom shaders as well. Nested clip boxes are not intersected, the last one pushed is used. The box is
+ *           transformed by the camera as of each draw, and clips to its bounds on screen.
+ * @related  cf_draw_push_clip_box cf_draw_pop_clip_box cf_draw_peek_clip_box cf_render_settings_push_scissor cf_push_text_clip_box
+ */
+CF_API void CF_CALL cf_draw_push_clip_box(CF_Aabb clip_box);
+
+/**
+ * @function cf_draw_pop_clip_box
+ * @category draw
+ * @brief    Pops and returns the last clip box.
+ * @related  cf_draw_push_clip_box cf_draw_pop_clip_box cf_draw_peek_clip_box
+ */
+CF_API CF_Aabb CF_CALL cf_draw_pop_clip_box();
+
+/**
+ * @function cf_draw_peek_clip_box
+ * @category draw
+ * @brief    Returns the last clip box.
+ * @related  cf_draw_push_clip_box cf_draw_pop_clip_box cf_draw_peek_clip_box
+ */
+CF_API CF_Aabb CF_CALL cf_draw_peek_clip_box();
+
 /**
  * @function cf_draw_push_color
  * @category draw
@@ -478,6 +680,46 @@ CF_API float CF_CALL cf_draw_pop_antialias_scale();
  */
 CF_API float CF_CALL cf_draw_peek_antialias_scale();
 
+/**
+ * @function cf_draw_push_opaque
+ * @category draw
+ * @brief    Pushes whether sprites and shapes drawn from now on are opaque.
+ * @param    opaque     True if every pixel drawn is either fully opaque or fully transparent, false otherwise (the default).
+ * @remarks  Everything is normally alpha-blended back-to-front in layer order, so big backgrounds are painted over again and again
+ *           by whatever sits on top of them. Opaque sprites and shapes are instead drawn first, front-to-back, into the canvas's
+ *           depth buffer using their layer (see `cf_draw_push_layer`) as depth. Pixels hidden behind something opaque are then
+ *           skipped by the GPU, including for translucent things drawn afterwards, cutting down on fill rate. This mostly pays off
+ *           on mobile GPUs, for large tile maps, backgrounds and UI panels.
+ *
+ *           Only mark things opaque if they really are: opaque pixels aren't blended, so partially transparent pixels come out
+ *           darkened. Fully transparent pixels are fine, they're skipped. Text, particles, and anything drawn with an opacity or
+ *           color alpha below 1 are always treated as translucent. Opaque shapes aren't antialiased.
+ *
+ *           Within one layer, opaque things always end up below translucent ones, so keep opaque backgrounds on their own layers.
+ *           This has no effect on canvases without a depth buffer, or while drawing with a shader that doesn't read `in_depth`,
+ *           such as one compiled against an older `draw.glsl`.
+ * @related  cf_draw_push_opaque cf_draw_pop_opaque cf_draw_peek_opaque cf_draw_push_layer
+ */
+CF_API void CF_CALL cf_draw_push_opaque(bool opaque);
+
+/**
+ * @function cf_draw_pop_opaque
+ * @category draw
+ * @brief    Pops and returns the last opaque state.
+ * @remarks  See `cf_draw_push_opaque`.
+ * @related  cf_draw_push_opaque cf_draw_pop_opaque cf_draw_peek_opaque cf_draw_push_layer
+ */
+CF_API bool CF_CALL cf_draw_pop_opaque();
+
+/**
+ * @function cf_draw_peek_opaque
+ * @category draw
+ * @brief    Returns the last opaque state.
+ * @remarks  See `cf_draw_push_opaque`.
+ * @related  cf_draw_push_opaque cf_draw_pop_opaque cf_draw_peek_opaque cf_draw_push_layer
+ */
+CF_API bool CF_CALL cf_draw_peek_opaque();
+
 /**
  * @function cf_draw_push_vertex_attributes
  * @category draw
@@ -561,11 +803,14 @@ typedef struct CF_Vertex
 	/* @member For internal use -- Whether or not to render shapes as filled or strokedx. */
 	uint8_t fill;
 
-	/* @member For internal use -- Reserved for a future purpose, simply fulfills byte alignment for now. */
+	/* @member For internal use -- The atlas layer sampled by sprites, see `cf_render_settings_atlas_array`. */
 	uint8_t not_used;
 
 	/* @member Four general purpose floats passed into custom user shaders. */
 	CF_Color attributes;
+
+	/* @member For internal use -- Clip-space depth of the vertex, from its draw layer. See `cf_draw_push_opaque`. */
+	float depth;
 } CF_Vertex;
 // @end
 
@@ -592,7 +837,9 @@ typedef void (CF_VertexFn)(CF_Vertex* verts, int count);
  * @function cf_set_vertex_callback
  * @category draw
  * @brief    An optional callback for modifying vertices before they are sent to the GPU.
- * @remarks  See `CF_VertexFn`.
+ * @remarks  See `CF_VertexFn`. Batches of sprites and shapes are usually sent to the GPU as one instance of a quad
+ *           each rather than as vertices. While a callback is set every batch is expanded into vertices so the
+ *           callback sees them, which costs more to upload.
  * @related  CF_Vertex CF_VertexFn cf_set_vertex_callback
  */
 CF_API void CF_CALL cf_set_vertex_callback(CF_VertexFn* vertex_fn);
@@ -635,6 +882,47 @@ CF_API CF_Result CF_CALL cf_make_font_from_memory(void* data, int size, const ch
  */
 CF_API void CF_CALL cf_destroy_font(const char* font_name);
 
+/**
+ * @function cf_font_prewarm
+ * @category text
+ * @brief    Rasterizes a range of glyphs ahead of time, in the background.
+ * @param    font_name        The unique name for this font.
+ * @param    first_codepoint  The first codepoint of the range, inclusive.
+ * @param    last_codepoint   The last codepoint of the range, inclusive.
+ * @param    font_size        The font size to rasterize at, as used with `cf_push_font_size`.
+ * @param    blur             The blur to rasterize with, as used with `cf_push_font_blur`.
+ * @remarks  Glyphs are normally rasterized the first time they're drawn, which can cause a hitch when a lot of new glyphs show
+ *           up at once (e.g. opening a dialogue box in a CJK language). Rasterization is spread across the app's threadpool. Text
+ *           drawn before a glyph finishes lays out as normal, but leaves that glyph blank until its pixels are ready. On single-core
+ *           machines the glyphs are rasterized immediately instead. Codepoints already rasterized are skipped.
+ * @related  cf_make_font cf_font_pending_glyph_count cf_push_font_size cf_push_font_blur cf_draw_text
+ */
+CF_API void CF_CALL cf_font_prewarm(const char* font_name, int first_codepoint, int last_codepoint, float font_size, int blur);
+
+/**
+ * @function cf_font_set_sdf
+ * @category text
+ * @brief    Draws a font from distance field glyphs, so one image per glyph serves every font size.
+ * @param    font_name   The unique name for this font.
+ * @param    enable      True to draw from distance fields, false to rasterize each font size separately (the default).
+ * @remarks  By default every distinct font size gets its own set of glyph images, so smoothly animating or scaling a font size fills
+ *           up the glyph cache and texture atlases with near-duplicates. With this on each glyph is rasterized once as a signed
+ *           distance field, and the sprite shader resolves its edge at whatever size it's drawn. Small text looks a little softer and
+ *           sharp corners round off at very large sizes. Blur from `cf_push_font_blur` is ignored. Custom shaders compiled against an
+ *           older `draw.glsl` don't know about distance field glyphs and draw them as blurry boxes. Glyphs already rasterized are kept.
+ * @related  cf_make_font cf_push_font_size cf_font_prewarm cf_draw_text
+ */
+CF_API void CF_CALL cf_font_set_sdf(const char* font_name, bool enable);
+
+/**
+ * @function cf_font_pending_glyph_count
+ * @category text
+ * @brief    Returns the number of glyphs from `cf_font_prewarm` still being rasterized in the background.
+ * @param    font_name   The unique name for this font.
+ * @related  cf_make_font cf_font_prewarm cf_draw_text
+ */
+CF_API int CF_CALL cf_font_pending_glyph_count(const char* font_name);
+
 /**
  * @function cf_push_font
  * @category text
@@ -817,6 +1105,20 @@ CF_API float CF_CALL cf_text_height(const char* text, int num_chars_to_draw);
  */
 CF_API CF_V2 CF_CALL cf_text_size(const char* text, int num_chars_to_draw);
 
+/**
+ * @function cf_text_size_batch
+ * @category text
+ * @brief    Measures the width/height of many texts at once, given the currently pushed font.
+ * @param    texts      Array of `count` strings to measure.
+ * @param    count      The number of strings in `texts`.
+ * @param    out_sizes  Array of `count` sizes, filled in with the size of each string as `cf_text_size` would return it.
+ * @remarks  Meant for measuring large amounts of text at once, such as all strings of a localization table during load. Work is
+ *           spread across the app's threadpool. Only glyph metrics are read from the font, so unlike `cf_text_size` this doesn't
+ *           rasterize any glyphs.
+ * @related  cf_make_font cf_text_width cf_text_height cf_text_size cf_text_size_batch
+ */
+CF_API void CF_CALL cf_text_size_batch(const char** texts, int count, CF_V2* out_sizes);
+
 /**
  * @function cf_draw_text
  * @category text
@@ -829,6 +1131,69 @@ CF_API CF_V2 CF_CALL cf_text_size(const char* text, int num_chars_to_draw);
  */
 CF_API void CF_CALL cf_draw_text(const char* text, CF_V2 position, int num_chars_to_draw /*= -1*/);
 
+/**
+ * @struct   CF_TextLayout
+ * @category text
+ * @brief    An opaque handle representing a cached text layout.
+ * @remarks  `cf_draw_text` parses text codes, word-wraps and looks up every glyph each time it's called. A text layout does all of
+ *           that once and keeps the result, which is much cheaper for text that's drawn every frame but rarely changes, such as
+ *           a HUD.
+ * @related  CF_TextLayout cf_make_text_layout cf_destroy_text_layout cf_text_layout_set_text cf_text_layout_size cf_draw_text_layout
+ */
+typedef struct CF_TextLayout { uint64_t id; } CF_TextLayout;
+// @end
+
+/**
+ * @function cf_make_text_layout
+ * @category text
+ * @brief    Returns a new cached text layout for `text`.
+ * @param    text       The text to lay out. The string is copied.
+ * @remarks  The layout uses the current font, font size, blur, wrap width, vertical layout and text effect settings. If any of those
+ *           differ when the layout is drawn, it's rebuilt. Destroy it with `cf_destroy_text_layout` when done.
+ * @related  CF_TextLayout cf_make_text_layout cf_destroy_text_layout cf_text_layout_set_text cf_text_layout_size cf_draw_text_layout
+ */
+CF_API CF_TextLayout CF_CALL cf_make_text_layout(const char* text);
+
+/**
+ * @function cf_destroy_text_layout
+ * @category text
+ * @brief    Destroys a text layout made by `cf_make_text_layout`.
+ * @related  CF_TextLayout cf_make_text_layout cf_destroy_text_layout cf_text_layout_set_text cf_text_layout_size cf_draw_text_layout
+ */
+CF_API void CF_CALL cf_destroy_text_layout(CF_TextLayout layout);
+
+/**
+ * @function cf_text_layout_set_text
+ * @category text
+ * @brief    Changes the text of a layout.
+ * @param    layout     The layout.
+ * @param    text       The new text. The string is copied.
+ * @remarks  Does nothing if `text` matches the current text, so it's fine to call every frame.
+ * @related  CF_TextLayout cf_make_text_layout cf_destroy_text_layout cf_text_layout_set_text cf_text_layout_size cf_draw_text_layout
+ */
+CF_API void CF_CALL cf_text_layout_set_text(CF_TextLayout layout, const char* text);
+
+/**
+ * @function cf_text_layout_size
+ * @category text
+ * @brief    Returns the size of a text layout, as `cf_text_size` would.
+ * @related  CF_TextLayout cf_make_text_layout cf_destroy_text_layout cf_text_layout_set_text cf_text_layout_size cf_draw_text_layout
+ */
+CF_API CF_V2 CF_CALL cf_text_layout_size(CF_TextLayout layout);
+
+/**
+ * @function cf_draw_text_layout
+ * @category text
+ * @brief    Draws a text layout.
+ * @param    layout             The layout.
+ * @param    position           The top-left corner of the text.
+ * @param    num_chars_to_draw  The number of characters to draw. Use -1 to draw the whole string.
+ * @remarks  Color, layer, clip box and transform are read at draw time, same as `cf_draw_text`. Text effects are run each draw, on
+ *           top of the cached glyphs. Markup info (see `cf_text_get_markup_info`) isn't available for layouts.
+ * @related  CF_TextLayout cf_make_text_layout cf_destroy_text_layout cf_text_layout_set_text cf_text_layout_size cf_draw_text_layout
+ */
+CF_API void CF_CALL cf_draw_text_layout(CF_TextLayout layout, CF_V2 position, int num_chars_to_draw /*= -1*/);
+
 /**
  * @struct   CF_TextEffect
  * @category text
@@ -1106,10 +1471,283 @@ CF_API bool CF_CALL cf_peek_text_effect_active();
  * @category draw
  * @brief    Sets a rendering `CF_Filter`, used for sampling from textures.
  * @param    filter       The filter.
- * @related  cf_render_settings_filter cf_render_settings_push_viewport cf_render_settings_push_scissor cf_render_settings_push_render_state cf_render_to cf_app_draw_onto_screen
+ * @remarks  With `CF_FILTER_TRILINEAR` atlas pages get a mip chain, see `cf_render_settings_atlas_mip_levels`.
+ * @related  cf_render_settings_filter cf_render_settings_atlas_mip_levels cf_render_settings_push_viewport cf_render_settings_push_scissor cf_render_settings_push_render_state cf_render_to cf_app_draw_onto_screen
  */
 CF_API void CF_CALL cf_render_settings_filter(CF_Filter filter);
 
+/**
+ * @function cf_render_settings_atlas_mip_levels
+ * @category draw
+ * @brief    Sets how many mip levels atlas pages get when the filter is `CF_FILTER_TRILINEAR`.
+ * @param    levels       The level count, including the full size page. Defaults to 4. 1 disables mips.
+ * @remarks  Mips are rebuilt on the CPU whenever an atlas page is (re)built, so only pages made after this call are affected.
+ *           Each atlas image is separated from its neighbours by transparent padding, which fades edges out as sprites shrink,
+ *           but the deepest levels can still pick up a faint fringe from neighbouring images, hence the low default.
+ * @related  cf_render_settings_filter cf_render_settings_parallel_vertex_threshold
+ */
+CF_API void CF_CALL cf_render_settings_atlas_mip_levels(int levels);
+
+/**
+ * @function cf_render_settings_parallel_vertex_threshold
+ * @category draw
+ * @brief    Sets the minimum number of sprites in a single batch before vertex generation is split across the app's threadpool.
+ * @param    sprite_count  The threshold, in sprites. Defaults to 4096. Set to zero (or less) to always generate vertices on the calling thread.
+ * @remarks  Only takes effect when the machine has more than one core. The generated vertices, and the order they are handed to
+ *           your vertex callback (see `cf_set_vertex_callback`), are identical either way.
+ * @related  cf_render_settings_filter cf_set_vertex_callback cf_render_to cf_app_draw_onto_screen
+ */
+CF_API void CF_CALL cf_render_settings_parallel_vertex_threshold(int sprite_count);
+
+/**
+ * @function cf_render_settings_culling
+ * @category draw
+ * @brief    Enables or disables skipping shapes, sprites and text that lie entirely off-screen.
+ * @param    enabled      True to cull off-screen geometry. Defaults to false.
+ * @remarks  Each item's bounds are tested against the current camera (see `cf_draw_push`) as it's drawn, and items outside of the
+ *           canvas are dropped before they reach the batcher or generate any vertices. Turn this off if a custom shader or vertex
+ *           callback (`cf_set_vertex_callback`) moves geometry on-screen. See `cf_draw_query_cull_stats`.
+ * @related  cf_draw_query_cull_stats CF_DrawCullStats cf_app_draw_onto_screen
+ */
+CF_API void CF_CALL cf_render_settings_culling(bool enabled);
+
+/**
+ * @struct   CF_DrawCullStats
+ * @category draw
+ * @brief    Counters for culling of off-screen geometry, see `cf_render_settings_culling`.
+ * @related  cf_render_settings_culling cf_draw_query_cull_stats
+ */
+typedef struct CF_DrawCullStats
+{
+	/* @member Number of items tested against the screen. */
+	int tested;
+
+	/* @member Number of items skipped for being entirely off-screen. */
+	int culled;
+} CF_DrawCullStats;
+// @end
+
+/**
+ * @function cf_draw_query_cull_stats
+ * @category draw
+ * @brief    Returns `CF_DrawCullStats` for the most recently completed frame.
+ * @related  cf_render_settings_culling CF_DrawCullStats cf_app_draw_onto_screen
+ */
+CF_API CF_DrawCullStats CF_CALL cf_draw_query_cull_stats();
+
+/**
+ * @enum     CF_DrawDebugMode
+ * @category draw
+ * @brief    Debug visualizations of how the draw API renders, see `cf_draw_set_debug_mode`.
+ * @related  CF_DrawDebugMode cf_draw_debug_mode_to_string cf_draw_set_debug_mode cf_draw_get_batch_breaks
+ */
+#define CF_DRAW_DEBUG_MODE_DEFS \
+	/* @entry Draws normally. */                                                                             \
+	CF_ENUM(DRAW_DEBUG_MODE_NONE,     0)                                                                     \
+	/* @entry Adds up how many times each pixel is drawn, from dark red for once through yellow to white. */ \
+	CF_ENUM(DRAW_DEBUG_MODE_OVERDRAW, 1)                                                                     \
+	/* @entry Paints each batch, and so each draw call, in its own flat color. */                            \
+	CF_ENUM(DRAW_DEBUG_MODE_BATCHES,  2)                                                                     \
+	/* @end */
+
+typedef enum CF_DrawDebugMode
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_DRAW_DEBUG_MODE_DEFS
+	#undef CF_ENUM
+} CF_DrawDebugMode;
+
+/**
+ * @function cf_draw_debug_mode_to_string
+ * @category draw
+ * @brief    Returns a `CF_DrawDebugMode` converted to a C string.
+ * @related  CF_DrawDebugMode cf_draw_debug_mode_to_string
+ */
+CF_INLINE const char* cf_draw_debug_mode_to_string(CF_DrawDebugMode mode)
+{
+	switch (mode) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_DRAW_DEBUG_MODE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @enum     CF_BatchBreakReason
+ * @category draw
+ * @brief    Why a batch couldn't be drawn along with the one before it, see `cf_draw_get_batch_breaks`.
+ * @related  CF_BatchBreakReason cf_batch_break_reason_to_string CF_BatchBreak cf_draw_get_batch_breaks
+ */
+#define CF_BATCH_BREAK_REASON_DEFS \
+	/* @entry The first batch drawn onto a canvas this frame. */                                                             \
+	CF_ENUM(BATCH_BREAK_REASON_CANVAS,       0)                                                                              \
+	/* @entry The sprites need a different texture, such as another atlas page or an image too big for any atlas. */         \
+	CF_ENUM(BATCH_BREAK_REASON_TEXTURE,      1)                                                                              \
+	/* @entry A new layer starts with a different texture. Grouping images drawn on the same layers into one atlas helps. */ \
+	CF_ENUM(BATCH_BREAK_REASON_LAYER,        2)                                                                              \
+	/* @entry Switching between opaque and translucent sprites, see `cf_draw_push_opaque`. */                                \
+	CF_ENUM(BATCH_BREAK_REASON_OPAQUE,       3)                                                                              \
+	/* @entry The shader changed since the last `cf_render_to`, see `cf_render_settings_push_shader`. */                     \
+	CF_ENUM(BATCH_BREAK_REASON_SHADER,       4)                                                                              \
+	/* @entry The scissor changed since the last `cf_render_to`, see `cf_render_settings_push_scissor`. */                   \
+	CF_ENUM(BATCH_BREAK_REASON_SCISSOR,      5)                                                                              \
+	/* @entry The viewport changed since the last `cf_render_to`, see `cf_render_settings_push_viewport`. */                 \
+	CF_ENUM(BATCH_BREAK_REASON_VIEWPORT,     6)                                                                              \
+	/* @entry The render state changed since the last `cf_render_to`, see `cf_render_settings_push_render_state`. */         \
+	CF_ENUM(BATCH_BREAK_REASON_RENDER_STATE, 7)                                                                              \
+	/* @entry Another `cf_render_to` onto the same canvas with the same settings, which could have been avoided. */          \
+	CF_ENUM(BATCH_BREAK_REASON_FLUSH,        8)                                                                              \
+	/* @entry Geometry baked with `cf_static_geometry_end` is always drawn on its own. */                                    \
+	CF_ENUM(BATCH_BREAK_REASON_STATIC,       9)                                                                              \
+	/* @end */
+
+typedef enum CF_BatchBreakReason
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_BATCH_BREAK_REASON_DEFS
+	#undef CF_ENUM
+} CF_BatchBreakReason;
+
+/**
+ * @function cf_batch_break_reason_to_string
+ * @category draw
+ * @brief    Returns a `CF_BatchBreakReason` converted to a C string.
+ * @related  CF_BatchBreakReason cf_batch_break_reason_to_string
+ */
+CF_INLINE const char* cf_batch_break_reason_to_string(CF_BatchBreakReason reason)
+{
+	switch (reason) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_BATCH_BREAK_REASON_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @struct   CF_BatchBreak
+ * @category draw
+ * @brief    One batch drawn by the draw API, and why it started, see `cf_draw_get_batch_breaks`.
+ * @related  CF_BatchBreak CF_BatchBreakReason cf_draw_get_batch_breaks
+ */
+typedef struct CF_BatchBreak
+{
+	/* @member Why this batch couldn't join the previous one. See `CF_BatchBreakReason`. */
+	CF_BatchBreakReason reason;
+
+	/* @member Sprites, shapes and glyphs in the batch. Zero for `CF_BATCH_BREAK_REASON_STATIC`. */
+	int sprite_count;
+
+	/* @member The layer of the first sprite in the batch, see `cf_draw_push_layer`. */
+	int layer;
+
+	/* @member The batch's color in `CF_DRAW_DEBUG_MODE_BATCHES`. */
+	CF_Color color;
+} CF_BatchBreak;
+// @end
+
+/**
+ * @function cf_draw_set_debug_mode
+ * @category draw
+ * @brief    Switches on a debug visualization, to see where draw calls and fill rate go.
+ * @param    mode       The visualization, see `CF_DrawDebugMode`. Defaults to `CF_DRAW_DEBUG_MODE_NONE`.
+ * @remarks  Debug modes draw every sprite, shape and glyph as flat colored quads with the built-in shader, covering their whole
+ *           area as the GPU rasterizes it. `CF_DRAW_DEBUG_MODE_OVERDRAW` blends them additively, so it reads best over a black
+ *           clear color (see `cf_clear_color`). The opaque pass (see `cf_draw_push_opaque`) is skipped, and geometry baked with
+ *           `cf_static_geometry_end` keeps its normal look.
+ *
+ *           While any debug mode is on, each batch is recorded along with the reason it started, see `cf_draw_get_batch_breaks`.
+ * @related  CF_DrawDebugMode cf_draw_set_debug_mode cf_draw_get_debug_mode cf_draw_get_batch_breaks cf_draw_debug_imgui_window
+ */
+CF_API void CF_CALL cf_draw_set_debug_mode(CF_DrawDebugMode mode);
+
+/**
+ * @function cf_draw_get_debug_mode
+ * @category draw
+ * @brief    Returns the current `CF_DrawDebugMode`.
+ * @related  CF_DrawDebugMode cf_draw_set_debug_mode cf_draw_get_debug_mode
+ */
+CF_API CF_DrawDebugMode CF_CALL cf_draw_get_debug_mode();
+
+/**
+ * @function cf_draw_get_batch_breaks
+ * @category draw
+ * @brief    Returns every batch drawn in the most recently completed frame, in drawing order.
+ * @param    count      Set to the number of batches returned.
+ * @return   Returns an array of `CF_BatchBreak`, valid until the end of the current frame.
+ * @remarks  Only recorded while a debug mode is on (see `cf_draw_set_debug_mode`), otherwise returns `NULL`. Each batch costs one
+ *           draw call, so this tells why a frame has more draw calls than expected.
+ * @related  CF_BatchBreak CF_BatchBreakReason cf_draw_set_debug_mode cf_draw_get_batch_breaks cf_draw_log_batch_breaks
+ */
+CF_API const CF_BatchBreak* CF_CALL cf_draw_get_batch_breaks(int* count);
+
+/**
+ * @function cf_draw_log_batch_breaks
+ * @category draw
+ * @brief    Logs a line for each batch from `cf_draw_get_batch_breaks`, followed by a tally of the reasons.
+ * @remarks  Logged at `CF_LOG_LEVEL_DEBUG`, see `cf_log`.
+ * @related  cf_draw_get_batch_breaks cf_draw_set_debug_mode cf_draw_debug_imgui_window
+ */
+CF_API void CF_CALL cf_draw_log_batch_breaks();
+
+/**
+ * @function cf_draw_debug_imgui_window
+ * @category draw
+ * @brief    Shows a Dear ImGui window to pick a `CF_DrawDebugMode` and browse `cf_draw_get_batch_breaks`.
+ * @remarks  Call once per frame after `cf_app_init_imgui`, does nothing otherwise.
+ * @related  cf_draw_set_debug_mode cf_draw_get_batch_breaks cf_draw_log_batch_breaks cf_app_init_imgui
+ */
+CF_API void CF_CALL cf_draw_debug_imgui_window();
+
+/**
+ * @function cf_render_settings_defrag_budget
+ * @category draw
+ * @brief    Sets a soft time budget for how long atlas management may take each frame.
+ * @param    milliseconds  The budget in milliseconds. Defaults to zero, meaning unlimited.
+ * @remarks  Each frame the draw API rebuilds texture atlases from recently drawn images, and flushes out atlases that have gone
+ *           stale. Large re-packs can cause a visible hitch. With a budget set, only as many atlas rebuilds/flushes as fit within
+ *           the budget (measured from previous frames, and always at least one) are performed per frame, and the rest is carried
+ *           over to later frames. Images not yet in an atlas are still drawn correctly, just with more draw calls.
+ * @related  cf_draw_defrag_pending cf_app_draw_onto_screen
+ */
+CF_API void CF_CALL cf_render_settings_defrag_budget(float milliseconds);
+
+/**
+ * @function cf_render_settings_pixel_budget
+ * @category draw
+ * @brief    Sets how many bytes of sprite pixels may stay in RAM after they've been copied into an atlas.
+ * @param    bytes         The budget in bytes. Defaults to zero, meaning unlimited, and nothing is ever dropped.
+ * @remarks  Sprites loaded with `cf_make_sprite` or `cf_png_cache_load` keep their decoded pixels around so the draw API can build
+ *           atlases out of them, which duplicates every image in both RAM and VRAM. With a budget set, pixels already copied into an
+ *           atlas are dropped from RAM, least recently used first, whenever the total goes over the budget. If the draw API needs them
+ *           again, for example after the atlas holding them went stale, they're decoded again from their file. Images loaded from memory
+ *           keep a copy of their encoded file for this, but only if they're loaded after a budget is set; otherwise they're never dropped.
+ *           
+ *           With a budget set, don't read the pixels of a `CF_Png` or of a sprite's `ase_t` after drawing it, as they may be gone.
+ * @related  cf_draw_resident_pixel_size cf_render_settings_defrag_budget
+ */
+CF_API void CF_CALL cf_render_settings_pixel_budget(size_t bytes);
+
+/**
+ * @function cf_draw_resident_pixel_size
+ * @category draw
+ * @brief    Returns how many bytes of pixels copied into atlases still remain in RAM.
+ * @remarks  Only counted while a budget is set with `cf_render_settings_pixel_budget`.
+ * @related  cf_render_settings_pixel_budget
+ */
+CF_API size_t CF_CALL cf_draw_resident_pixel_size();
+
+/**
+ * @function cf_draw_defrag_pending
+ * @category draw
+ * @brief    Returns a rough count of atlas rebuilds/flushes waiting to be performed.
+ * @remarks  Useful alongside `cf_render_settings_defrag_budget`, for example to lift the budget during a loading screen until
+ *           this returns zero.
+ * @related  cf_render_settings_defrag_budget cf_app_draw_onto_screen
+ */
+CF_API int CF_CALL cf_draw_defrag_pending();
+
 /**
  * @function cf_render_settings_push_viewport
  * @category draw
@@ -1140,6 +1778,8 @@ CF_API CF_Rect CF_CALL cf_render_settings_peek_viewport();
  * @category draw
  * @brief    Pushes a `CF_Rect` for the scissor to render within.
  * @param    scissor      The scissor box.
+ * @remarks  The scissor applies to every batch drawn by the next `cf_render_to`, so differently scissored geometry needs
+ *           a separate `cf_render_to` each. To clip many regions within one draw call see `cf_draw_push_clip_box`.
  * @related  cf_render_settings_filter cf_render_settings_push_viewport cf_render_settings_push_scissor cf_render_settings_pop_scissor cf_render_settings_peek_scissor cf_render_settings_push_render_state cf_render_to cf_app_draw_onto_screen
  */
 CF_API void CF_CALL cf_render_settings_push_scissor(CF_Rect scissor);
@@ -1204,6 +1844,38 @@ CF_API CF_RenderState CF_CALL cf_render_settings_peek_render_state();
  */
 CF_API void CF_CALL cf_render_settings_set_atlas_dimensions(int width_in_pixels, int height_in_pixels);
 
+/**
+ * @function cf_render_settings_atlas_array
+ * @category draw
+ * @brief    Stores the internal atlas pages as layers of one texture array, so sprites on different pages still batch into one draw call.
+ * @param    enable       True to use a texture array, false for one texture per page (the default).
+ * @return   Returns true if atlas pages are now stored in a texture array.
+ * @remarks  Normally each atlas page is its own texture, and every switch between pages while drawing costs a draw call. With this on,
+ *           each vertex carries the layer of its page instead. This needs `CF_DEVICE_FEATURE_TEXTURE_ARRAY`, otherwise false is
+ *           returned and nothing changes.
+ *
+ *           Custom shaders from `cf_render_settings_push_shader` sample the atlas as a plain 2D texture, so they won't draw sprites
+ *           correctly while this is on. The same goes for textures from `cf_fetch_image`. Pages with mips (see
+ *           `cf_render_settings_atlas_mip_levels`) keep their own textures. A CPU copy of every page is kept, as the texture array is
+ *           rebuilt whenever a page is added.
+ *
+ *           Like `cf_render_settings_set_atlas_dimensions` this invalidates the whole cache, so it's intended as a one-time setup.
+ * @related  cf_render_settings_set_atlas_dimensions cf_render_settings_atlas_budget cf_query_device_feature
+ */
+CF_API bool CF_CALL cf_render_settings_atlas_array(bool enable);
+
+/**
+ * @function cf_render_settings_atlas_budget
+ * @category draw
+ * @brief    Limits the GPU memory taken by the internal atlas pages.
+ * @param    bytes        The budget in bytes, or zero for no limit (the default).
+ * @remarks  Once the budget is used up, a new page is only built after dropping a page holding images that haven't been drawn in a while.
+ *           Until then, images left out of the atlases are drawn from their own small textures, costing a draw call each. Pages already
+ *           over the budget are dropped as their images go unused.
+ * @related  cf_render_settings_set_atlas_dimensions cf_render_settings_atlas_array cf_render_settings_pixel_budget
+ */
+CF_API void CF_CALL cf_render_settings_atlas_budget(size_t bytes);
+
 /**
  * @function cf_render_settings_push_shader
  * @category draw
@@ -1231,6 +1903,18 @@ CF_API CF_Shader CF_CALL cf_render_settings_pop_shader();
  */
 CF_API CF_Shader CF_CALL cf_render_settings_peek_shader();
 
+/**
+ * @function cf_draw_prewarm
+ * @category draw
+ * @brief    Creates the GPU pipelines needed to draw with the current shader and render state, without drawing anything.
+ * @param    canvas     The canvas that will be drawn onto, usually `cf_app_get_canvas`.
+ * @remarks  The first draw with a new combination of shader and render state creates a pipeline, which can hitch. During loading,
+ *           push each shader (`cf_render_settings_push_shader`) and render state (`cf_render_settings_push_render_state`) your game
+ *           draws with and call this. The built-in shader is prewarmed along with all of its variants. See `cf_prewarm_pipeline`.
+ * @related  cf_prewarm_pipeline cf_render_settings_push_shader cf_render_settings_push_render_state cf_set_shader_cache_directory
+ */
+CF_API void CF_CALL cf_draw_prewarm(CF_Canvas canvas);
+
 /**
  * @function cf_render_settings_push_texture
  * @category draw
@@ -1467,6 +2151,9 @@ typedef struct CF_TemporaryImage
 
 	/* @member v coordinate of the image in the texture. */
 	CF_V2 v;
+
+	/* @member Layer of `tex` holding the image. Always zero unless `cf_render_settings_atlas_array` is on, which makes `tex` a texture array. */
+	int layer;
 } CF_TemporaryImage;
 // @end
 
@@ -1524,6 +2211,46 @@ CF_API void CF_CALL cf_register_premade_atlas(const char* png_path, int sub_imag
  */
 CF_API CF_Sprite CF_CALL cf_make_premade_sprite(uint64_t image_id);
 
+/**
+ * @function cf_bake_atlas
+ * @category draw
+ * @brief    Packs a set of .png and .ase/.aseprite files into atlas pages, and writes them out as a single baked atlas file.
+ * @param    out_path     A virtual path to write the baked atlas to. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @param    image_paths  An array of virtual paths to .png or .ase/.aseprite files.
+ * @param    image_count  The number of elements in `image_paths`.
+ * @param    page_width   Width of each atlas page in pixels.
+ * @param    page_height  Height of each atlas page in pixels.
+ * @return   Returns any errors as a `CF_Result`.
+ * @remarks  This is intended to be run offline as part of an asset pipeline, see the `atlas_baker` tool in tools/atlas_baker. Each page is stored
+ *           as a compressed png. Each .png becomes a sub-image named by its path, while each frame of an aseprite file becomes
+ *           a sub-image named by its path followed by `#` and the frame index, e.g. `"/art/girl.ase#3"`. Load the result
+ *           at runtime with `cf_load_baked_atlas`. The file assumes a little-endian platform.
+ * @related  cf_bake_atlas cf_load_baked_atlas cf_make_baked_sprite cf_register_premade_atlas
+ */
+CF_API CF_Result CF_CALL cf_bake_atlas(const char* out_path, const char** image_paths, int image_count, int page_width, int page_height);
+
+/**
+ * @function cf_load_baked_atlas
+ * @category draw
+ * @brief    Loads a baked atlas file from `cf_bake_atlas` and uploads all of its pages to the GPU.
+ * @param    path       A virtual path to the baked atlas. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @return   Returns any errors as a `CF_Result`.
+ * @remarks  Baked images bypass CF's online atlas compiler entirely, so there's no packing cost the first time they're drawn.
+ *           Fetch a drawable sprite with `cf_make_baked_sprite`.
+ * @related  cf_bake_atlas cf_load_baked_atlas cf_make_baked_sprite cf_register_premade_atlas
+ */
+CF_API CF_Result CF_CALL cf_load_baked_atlas(const char* path);
+
+/**
+ * @function cf_make_baked_sprite
+ * @category draw
+ * @brief    Initializes a single-frame drawable sprite from an image within a baked atlas.
+ * @param    name       The name of the sub-image, see `cf_bake_atlas`.
+ * @remarks  Returns `cf_sprite_defaults` if no loaded baked atlas contains `name`.
+ * @related  cf_bake_atlas cf_load_baked_atlas cf_make_baked_sprite cf_make_premade_sprite
+ */
+CF_API CF_Sprite CF_CALL cf_make_baked_sprite(const char* name);
+
 //--------------------------------------------------------------------------------------------------
 // "Hidden" API -- Just here for some inline C++ functions below.
 
@@ -1589,9 +2316,29 @@ CF_INLINE void draw_bezier_line(v2 a, v2 c0, v2 b, int iters, float thickness) {
 CF_INLINE void draw_bezier_line(v2 a, v2 c0, v2 c1, v2 b, int iters, float thickness) { cf_draw_bezier_line2(a, c0, c1, b, iters, thickness); }
 CF_INLINE void draw_arrow(v2 a, v2 b, float thickness, float arrow_width) { cf_draw_arrow(a, b, thickness, arrow_width); }
 
+using DrawList = CF_DrawList;
+
+CF_INLINE DrawList make_draw_list() { return cf_make_draw_list(); }
+CF_INLINE void destroy_draw_list(DrawList list) { cf_destroy_draw_list(list); }
+CF_INLINE void draw_list_reset(DrawList list) { cf_draw_list_reset(list); }
+CF_INLINE void draw_list_begin(DrawList list) { cf_draw_list_begin(list); }
+CF_INLINE void draw_list_end(DrawList list) { cf_draw_list_end(list); }
+CF_INLINE void draw_list_submit(DrawList list) { cf_draw_list_submit(list); }
+using StaticGeometry = CF_StaticGeometry;
+
+CF_INLINE void static_geometry_begin() { cf_static_geometry_begin(); }
+CF_INLINE StaticGeometry static_geometry_end() { return cf_static_geometry_end(); }
+CF_INLINE void destroy_static_geometry(StaticGeometry geometry) { cf_destroy_static_geometry(geometry); }
+CF_INLINE void draw_static_geometry(StaticGeometry geometry) { cf_draw_static_geometry(geometry); }
+CF_INLINE void debug_draw_line(v2 p0, v2 p1, Color color) { cf_debug_draw_line(p0, p1, color); }
+CF_INLINE void debug_draw_box(Aabb box, Color color) { cf_debug_draw_box(box, color); }
+CF_INLINE void debug_draw_circle(v2 p, float r, Color color) { cf_debug_draw_circle(p, r, color); }
 CF_INLINE void draw_push_layer(int layer) { cf_draw_push_layer(layer); }
 CF_INLINE int draw_pop_layer() { return cf_draw_pop_layer(); }
 CF_INLINE int draw_peek_layer() { return cf_draw_peek_layer(); }
+CF_INLINE void draw_push_clip_box(Aabb clip_box) { cf_draw_push_clip_box(clip_box); }
+CF_INLINE Aabb draw_pop_clip_box() { return cf_draw_pop_clip_box(); }
+CF_INLINE Aabb draw_peek_clip_box() { return cf_draw_peek_clip_box(); }
 CF_INLINE void draw_push_color(Color c) { cf_draw_push_color(c); }
 CF_INLINE Color draw_pop_color() { return cf_draw_pop_color(); }
 CF_INLINE Color draw_peek_color() { return cf_draw_peek_color(); }
@@ -1604,6 +2351,9 @@ CF_INLINE bool draw_peek_antialias() { return cf_draw_peek_antialias(); }
 CF_INLINE void draw_push_antialias_scale(float scale) { return cf_draw_push_antialias_scale(scale); }
 CF_INLINE float draw_pop_antialias_scale() { return cf_draw_pop_antialias_scale(); }
 CF_INLINE float draw_peek_antialias_scale() { return cf_draw_peek_antialias_scale(); }
+CF_INLINE void draw_push_opaque(bool opaque) { cf_draw_push_opaque(opaque); }
+CF_INLINE bool draw_pop_opaque() { return cf_draw_pop_opaque(); }
+CF_INLINE bool draw_peek_opaque() { return cf_draw_peek_opaque(); }
 CF_INLINE void draw_push_vertex_attributes(float r, float g, float b, float a) { cf_draw_push_vertex_attributes(r, g, b, a); }
 CF_INLINE void draw_push_vertex_attributes(Color attributes) { cf_draw_push_vertex_attributes2(attributes); }
 CF_INLINE Color draw_pop_vertex_attributes() { return cf_draw_pop_vertex_attributes(); }
@@ -1612,6 +2362,9 @@ CF_INLINE Color draw_peek_vertex_attributes() { return cf_draw_peek_vertex_attri
 CF_INLINE Result make_font(const char* path, const char* font_name) { return cf_make_font(path, font_name); }
 CF_INLINE Result make_font_from_memory(void* data, int size, const char* font_name) { return cf_make_font_from_memory(data, size, font_name); }
 CF_INLINE void destroy_font(const char* font_name) { cf_destroy_font(font_name); }
+CF_INLINE void font_prewarm(const char* font_name, int first_codepoint, int last_codepoint, float font_size, int blur) { cf_font_prewarm(font_name, first_codepoint, last_codepoint, font_size, blur); }
+CF_INLINE void font_set_sdf(const char* font_name, bool enable) { cf_font_set_sdf(font_name, enable); }
+CF_INLINE int font_pending_glyph_count(const char* font_name) { return cf_font_pending_glyph_count(font_name); }
 CF_INLINE void push_font(const char* font_name) { cf_push_font(font_name); }
 CF_INLINE const char* pop_font() { return cf_pop_font(); }
 CF_INLINE const char* peek_font() { return cf_peek_font(); }
@@ -1630,8 +2383,17 @@ CF_INLINE Aabb peek_text_clip_box() { return cf_peek_text_clip_box(); }
 CF_INLINE float text_width(const char* text, int num_chars_to_render = -1) { return cf_text_width(text, num_chars_to_render); }
 CF_INLINE float text_height(const char* text, int num_chars_to_render = -1) { return cf_text_height(text, num_chars_to_render); }
 CF_INLINE v2 text_size(const char* text, int num_chars_to_render = -1) { return cf_text_size(text, num_chars_to_render); }
+CF_INLINE void text_size_batch(const char** texts, int count, v2* out_sizes) { cf_text_size_batch(texts, count, out_sizes); }
 CF_INLINE void draw_text(const char* text, v2 position, int num_chars_to_render = -1) { cf_draw_text(text, position, num_chars_to_render); }
 
+using TextLayout = CF_TextLayout;
+
+CF_INLINE TextLayout make_text_layout(const char* text) { return cf_make_text_layout(text); }
+CF_INLINE void destroy_text_layout(TextLayout layout) { cf_destroy_text_layout(layout); }
+CF_INLINE void text_layout_set_text(TextLayout layout, const char* text) { cf_text_layout_set_text(layout, text); }
+CF_INLINE v2 text_layout_size(TextLayout layout) { return cf_text_layout_size(layout); }
+CF_INLINE void draw_text_layout(TextLayout layout, v2 position, int num_chars_to_render = -1) { cf_draw_text_layout(layout, position, num_chars_to_render); }
+
 struct TextEffect : public CF_TextEffect
 {
 	CF_INLINE bool on_start() const { return index_into_effect == 0; }
@@ -1689,6 +2451,52 @@ CF_INLINE bool pop_text_effect_active() { return cf_pop_text_effect_active(); }
 CF_INLINE bool peek_text_effect_active() { return cf_peek_text_effect_active(); }
 
 CF_INLINE void render_settings_filter(Filter filter) { cf_render_settings_filter(filter); }
+CF_INLINE void render_settings_atlas_mip_levels(int levels) { cf_render_settings_atlas_mip_levels(levels); }
+CF_INLINE void render_settings_parallel_vertex_threshold(int sprite_count) { cf_render_settings_parallel_vertex_threshold(sprite_count); }
+using DrawCullStats = CF_DrawCullStats;
+
+CF_INLINE void render_settings_culling(bool enabled) { cf_render_settings_culling(enabled); }
+CF_INLINE DrawCullStats draw_query_cull_stats() { return cf_draw_query_cull_stats(); }
+
+using DrawDebugMode = CF_DrawDebugMode;
+#define CF_ENUM(K, V) CF_INLINE constexpr DrawDebugMode K = CF_##K;
+CF_DRAW_DEBUG_MODE_DEFS
+#undef CF_ENUM
+
+CF_INLINE constexpr const char* to_string(DrawDebugMode mode) { switch(mode) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_DRAW_DEBUG_MODE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+using BatchBreakReason = CF_BatchBreakReason;
+#define CF_ENUM(K, V) CF_INLINE constexpr BatchBreakReason K = CF_##K;
+CF_BATCH_BREAK_REASON_DEFS
+#undef CF_ENUM
+
+CF_INLINE constexpr const char* to_string(BatchBreakReason reason) { switch(reason) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_BATCH_BREAK_REASON_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+using BatchBreak = CF_BatchBreak;
+
+CF_INLINE void draw_set_debug_mode(DrawDebugMode mode) { cf_draw_set_debug_mode(mode); }
+CF_INLINE DrawDebugMode draw_get_debug_mode() { return cf_draw_get_debug_mode(); }
+CF_INLINE const BatchBreak* draw_get_batch_breaks(int* count) { return cf_draw_get_batch_breaks(count); }
+CF_INLINE void draw_log_batch_breaks() { cf_draw_log_batch_breaks(); }
+CF_INLINE void draw_debug_imgui_window() { cf_draw_debug_imgui_window(); }
+CF_INLINE void render_settings_defrag_budget(float milliseconds) { cf_render_settings_defrag_budget(milliseconds); }
+CF_INLINE int draw_defrag_pending() { return cf_draw_defrag_pending(); }
+CF_INLINE void render_settings_pixel_budget(size_t bytes) { cf_render_settings_pixel_budget(bytes); }
+CF_INLINE bool render_settings_atlas_array(bool enable) { return cf_render_settings_atlas_array(enable); }
+CF_INLINE void render_settings_atlas_budget(size_t bytes) { cf_render_settings_atlas_budget(bytes); }
+CF_INLINE size_t draw_resident_pixel_size() { return cf_draw_resident_pixel_size(); }
 CF_INLINE void render_settings_push_viewport(Rect viewport) { cf_render_settings_push_viewport(viewport); }
 CF_INLINE Rect render_settings_pop_viewport() { return cf_render_settings_pop_viewport(); }
 CF_INLINE Rect render_settings_peek_viewport() { return cf_render_settings_peek_viewport(); }
@@ -1701,6 +2509,7 @@ CF_INLINE RenderState render_settings_peek_render_state() { return cf_render_set
 CF_INLINE void render_settings_push_shader(Shader shader) { cf_render_settings_push_shader(shader); }
 CF_INLINE Shader render_settings_pop_shader() { return cf_render_settings_pop_shader(); }
 CF_INLINE Shader render_settings_peek_shader() { return cf_render_settings_peek_shader(); }
+CF_INLINE void draw_prewarm(Canvas canvas) { cf_draw_prewarm(canvas); }
 CF_INLINE void render_settings_push_texture(const char* name, Texture texture) { cf_render_settings_push_texture(name, texture); }
 CF_INLINE void render_settings_push_uniform(const char* name, void* data, UniformType type, int array_length) { cf_render_settings_push_uniform(name, data, type, array_length); }
 CF_INLINE void render_settings_push_uniform(const char* name, int val) { cf_render_settings_push_uniform_int(name, val); }
@@ -1730,6 +2539,9 @@ CF_INLINE TemporaryImage fetch_image(const CF_Sprite& sprite) { return cf_fetch_
 using AtlasSubImage = CF_AtlasSubImage;
 CF_INLINE void register_premade_atlas(const char* png_path, int sub_image_count, AtlasSubImage* sub_images) { cf_register_premade_atlas(png_path, sub_image_count, sub_images); }
 CF_INLINE Sprite make_premade_sprite(uint64_t image_id) { return cf_make_premade_sprite(image_id); }
+CF_INLINE Result bake_atlas(const char* out_path, const char** image_paths, int image_count, int page_width, int page_height) { return cf_bake_atlas(out_path, image_paths, image_count, page_width, page_height); }
+CF_INLINE Result load_baked_atlas(const char* path) { return cf_load_baked_atlas(path); }
+CF_INLINE Sprite make_baked_sprite(const char* name) { return cf_make_baked_sprite(name); }
 
 }
 
@@ -12,6 +12,7 @@
 #include "cute_handle_table.h"
 #include "cute_array.h"
 #include "cute_typeless_array.h"
+#include "cute_json.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -54,6 +55,38 @@ typedef struct CF_ComponentList { uint64_t id; } CF_ComponentList;
 typedef struct CF_World { uint64_t id; } CF_World;
 // @end
 
+/**
+ * @struct   CF_WorldSnapshot
+ * @category ecs
+ * @brief    An opaque handle to a saved copy of a world's entities and components.
+ * @remarks  Useful for rollback netcode. Create one with `cf_make_world_snapshot`, then save and restore the current world with
+ *           `cf_world_save_snapshot` and `cf_world_restore_snapshot`.
+ * @related  CF_WorldSnapshot cf_make_world_snapshot cf_destroy_world_snapshot cf_world_save_snapshot cf_world_restore_snapshot
+ */
+typedef struct CF_WorldSnapshot { uint64_t id; } CF_WorldSnapshot;
+// @end
+
+/**
+ * @struct   CF_Query
+ * @category ecs
+ * @brief    An opaque handle to a cached filter of entities by component types.
+ * @remarks  Queries iterate entities by component set from anywhere, not just within systems. Make one with `cf_make_query`.
+ * @related  CF_Query cf_make_query cf_query_require_component cf_query_exclude_component cf_query_for_each cf_query_for_each_parallel
+ */
+typedef struct CF_Query { uint64_t id; } CF_Query;
+// @end
+
+/**
+ * @struct   CF_Prefab
+ * @category ecs
+ * @brief    An opaque handle to a template of pre-initialized components for an entity type.
+ * @remarks  Instantiating a prefab copies its components into the new entity instead of running component initializers, and
+ *           saves setting up each component by hand afterwards. Make one with `cf_make_prefab`.
+ * @related  CF_Prefab cf_make_prefab cf_prefab_get_component cf_make_entity_from_prefab cf_make_entities_from_prefab
+ */
+typedef struct CF_Prefab { uint64_t id; } CF_Prefab;
+// @end
+
 /**
  * @function CF_SystemUpdateFn
  * @category ecs
@@ -61,7 +94,8 @@ typedef struct CF_World { uint64_t id; } CF_World;
  * @param    component_list  A tuple of components. See `cf_get_components`.
  * @param    entity_count    The number of entities to be updated.
  * @param    udata           An optional user data pointer. `NULL` by default, or set by `cf_system_set_optional_udata`.
- * @remarks  This function represents a single system in the ECS. See `cf_system_begin`.
+ * @remarks  This function represents a single system in the ECS. See `cf_system_begin`. Components are stored in
+ *           fixed-size chunks, so this function may be called multiple times per entity type -- once per chunk.
  * @related  CF_SystemUpdateFn CF_ComponentList cf_run_systems cf_get_components cf_get_entities cf_system_begin
  */
 typedef void (CF_SystemUpdateFn)(CF_ComponentList component_list, int entity_count, void* udata);
@@ -148,6 +182,93 @@ CF_API void CF_CALL cf_entity_end();
  */
 CF_API CF_Entity CF_CALL cf_make_entity(const char* entity_type);
 
+/**
+ * @function cf_make_entities
+ * @category ecs
+ * @brief    Constructs `count` new entities of the same type at once.
+ * @param    entity_type   The type of entity to construct.
+ * @param    count         The number of entities to construct.
+ * @param    out_entities  Optional array of `count` entities to fill in, may be `NULL`.
+ * @remarks  Much faster than calling `cf_make_entity` in a loop, as storage and handles are reserved just once. Component
+ *           initializers run one component type at a time over all of the new entities. If `entity_type` is not valid all of
+ *           `out_entities` are set to `CF_INVALID_ENTITY`.
+ * @related  cf_make_entity cf_make_entities cf_destroy_entities
+ */
+CF_API void CF_CALL cf_make_entities(const char* entity_type, int count, CF_Entity* out_entities);
+
+/**
+ * @function cf_make_prefab
+ * @category ecs
+ * @brief    Returns a new prefab for an entity type, with each component set up by its initializer.
+ * @param    entity_type   The type of entity the prefab makes.
+ * @remarks  Initializers run once here with `CF_INVALID_ENTITY` as the entity. Adjust the components afterwards with
+ *           `cf_prefab_get_component`. Returns a prefab with an `id` of zero if `entity_type` is not valid. Prefabs work with
+ *           any world. Free it with `cf_destroy_prefab` when done.
+ * @related  CF_Prefab cf_destroy_prefab cf_prefab_get_component cf_make_entity_from_prefab cf_make_entities_from_prefab
+ */
+CF_API CF_Prefab CF_CALL cf_make_prefab(const char* entity_type);
+
+/**
+ * @function cf_destroy_prefab
+ * @category ecs
+ * @brief    Destroys a prefab made by `cf_make_prefab`.
+ * @remarks  Component cleanup functions run on the prefab's own components, with `CF_INVALID_ENTITY` as the entity. Entities
+ *           made from the prefab are unaffected.
+ * @related  CF_Prefab cf_make_prefab
+ */
+CF_API void CF_CALL cf_destroy_prefab(CF_Prefab prefab);
+
+/**
+ * @function cf_prefab_get_component
+ * @category ecs
+ * @brief    Returns one of a prefab's components, for setting the values new entities start with.
+ * @param    prefab          The prefab.
+ * @param    component_type  The type of component.
+ * @return   Returns `NULL` if the prefab's entity type has no such component.
+ * @remarks  Changes only affect entities made afterwards.
+ * @related  CF_Prefab cf_make_prefab cf_make_entity_from_prefab cf_make_entities_from_prefab
+ */
+CF_API void* CF_CALL cf_prefab_get_component(CF_Prefab prefab, const char* component_type);
+
+/**
+ * @function cf_make_entity_from_prefab
+ * @category ecs
+ * @brief    Returns a new entity with its components copied from a prefab.
+ * @remarks  Component initializers are not run, the components are byte-for-byte copies of the prefab's. Cleanup functions still
+ *           run as usual when the entity is destroyed, so a component owning memory should not be made from a prefab.
+ * @related  CF_Prefab cf_make_prefab cf_make_entities_from_prefab cf_make_entity
+ */
+CF_API CF_Entity CF_CALL cf_make_entity_from_prefab(CF_Prefab prefab);
+
+/**
+ * @function CF_PrefabOverrideFn
+ * @category ecs
+ * @brief    Customizes a batch of entities just made from a prefab.
+ * @param    component_list  The new entities and their components, see `cf_get_components` and `cf_get_entities`.
+ * @param    first_instance  Index of the first of these entities within the whole batch, for looking up per-instance data.
+ * @param    entity_count    The number of entities in `component_list`.
+ * @param    udata           The `udata` passed to `cf_make_entities_from_prefab`.
+ * @remarks  Called once per chunk of new entities. Don't make or destroy entities from within this function.
+ * @related  CF_Prefab cf_make_entities_from_prefab
+ */
+typedef void (CF_PrefabOverrideFn)(CF_ComponentList component_list, int first_instance, int entity_count, void* udata);
+
+/**
+ * @function cf_make_entities_from_prefab
+ * @category ecs
+ * @brief    Makes `count` new entities at once, each with its components copied from a prefab.
+ * @param    prefab        The prefab.
+ * @param    count         The number of entities to make.
+ * @param    out_entities  Optional array of `count` entities to fill in, may be `NULL`.
+ * @param    override_fn   Optional, may be `NULL`. Called on the new entities to set per-instance values, such as positions.
+ * @param    udata         Optional, may be `NULL`. Handed back to you in `override_fn`.
+ * @remarks  The fastest way to spawn many entities. Each component is copied into whole runs of new entities at a time, then
+ *           `override_fn` visits the new entities chunk by chunk, like a system. See `cf_make_entity_from_prefab` about
+ *           initializers and cleanup.
+ * @related  CF_Prefab CF_PrefabOverrideFn cf_make_prefab cf_make_entity_from_prefab cf_make_entities
+ */
+CF_API void CF_CALL cf_make_entities_from_prefab(CF_Prefab prefab, int count, CF_Entity* out_entities, CF_PrefabOverrideFn* override_fn, void* udata);
+
 /**
  * @function cf_entity_is_valid
  * @category ecs
@@ -188,6 +309,33 @@ CF_API bool CF_CALL cf_entity_has_component(CF_Entity entity, const char* compon
  */
 CF_API void* CF_CALL cf_entity_get_component(CF_Entity entity, const char* component_type);
 
+/**
+ * @function cf_component_get_id
+ * @category ecs
+ * @brief    Returns the integer ID of a registered component type, or -1 if the type was never registered.
+ * @remarks  IDs are small dense integers handed out in registration order. Cache the ID once and use the `_by_id` functions,
+ *           such as `cf_entity_get_component_by_id`, to skip hashing the type string on every lookup.
+ * @related  cf_component_get_id cf_entity_has_component_by_id cf_entity_get_component_by_id cf_get_components_by_id
+ */
+CF_API int CF_CALL cf_component_get_id(const char* component_type);
+
+/**
+ * @function cf_entity_has_component_by_id
+ * @category ecs
+ * @brief    Returns true if an entity has a particular component, by ID from `cf_component_get_id`.
+ * @related  cf_component_get_id cf_entity_has_component_by_id cf_entity_get_component_by_id cf_get_components_by_id
+ */
+CF_API bool CF_CALL cf_entity_has_component_by_id(CF_Entity entity, int component_id);
+
+/**
+ * @function cf_entity_get_component_by_id
+ * @category ecs
+ * @brief    Returns a pointer to a specific component on an entity, by ID from `cf_component_get_id`.
+ * @remarks  Returns NULL if the entity doesn't have this component.
+ * @related  cf_component_get_id cf_entity_has_component_by_id cf_entity_get_component_by_id cf_get_components_by_id
+ */
+CF_API void* CF_CALL cf_entity_get_component_by_id(CF_Entity entity, int component_id);
+
 /**
  * @function cf_destroy_entity_delayed
  * @category ecs
@@ -204,6 +352,18 @@ CF_API void CF_CALL cf_destroy_entity_delayed(CF_Entity entity);
  */
 CF_API void CF_CALL cf_destroy_entity(CF_Entity entity);
 
+/**
+ * @function cf_destroy_entities
+ * @category ecs
+ * @brief    Destroys an array of entities right now.
+ * @param    entities  The entities to destroy. Invalid entities are skipped.
+ * @param    count     The number of entities.
+ * @remarks  Same as calling `cf_destroy_entity` for each entity, but runs of entities of the same type share a single
+ *           collection lookup.
+ * @related  cf_destroy_entity cf_make_entities cf_destroy_entities
+ */
+CF_API void CF_CALL cf_destroy_entities(const CF_Entity* entities, int count);
+
 /**
  * @function cf_entity_equals
  * @category ecs
@@ -275,6 +435,19 @@ CF_API void CF_CALL cf_entity_delayed_change_type(CF_Entity entity, const char*
  */
 CF_API void CF_CALL cf_entity_change_type(CF_Entity entity, const char* entity_type);
 
+/**
+ * @function cf_entities_change_type
+ * @category ecs
+ * @brief    Changes the type of many entities at once.
+ * @param    entities     The entities to change. Invalid entities, and those already of type `entity_type`, are skipped.
+ * @param    count        The number of entities.
+ * @param    entity_type  The new type for all of the entities.
+ * @remarks  Same as calling `cf_entity_change_type` for each entity, but storage in the new type is reserved just once, and runs of
+ *           entities of the same old type share a single lookup of how components map between the types.
+ * @related  cf_entity_delayed_change_type cf_entity_change_type cf_entities_change_type
+ */
+CF_API void CF_CALL cf_entities_change_type(const CF_Entity* entities, int count, const char* entity_type);
+
 /**
  * @function cf_entity_type_rename
  * @category ecs
@@ -325,6 +498,85 @@ CF_API void CF_CALL cf_component_set_optional_initializer(CF_ComponentFn* initia
  */
 CF_API void CF_CALL cf_component_set_optional_cleanup(CF_ComponentFn* cleanup, void* udata);
 
+/**
+ * @enum     CF_ComponentFieldType
+ * @category ecs
+ * @brief    The type of a component field registered with `cf_component_add_field`.
+ * @related  CF_ComponentFieldType cf_component_add_field cf_component_field_type_to_string
+ */
+#define CF_COMPONENT_FIELD_TYPE_DEFS \
+	/* @entry `int8_t`. */                \
+	CF_ENUM(COMPONENT_FIELD_TYPE_INT8,   0) \
+	/* @entry `uint8_t`. */               \
+	CF_ENUM(COMPONENT_FIELD_TYPE_UINT8,  1) \
+	/* @entry `int16_t`. */               \
+	CF_ENUM(COMPONENT_FIELD_TYPE_INT16,  2) \
+	/* @entry `uint16_t`. */              \
+	CF_ENUM(COMPONENT_FIELD_TYPE_UINT16, 3) \
+	/* @entry `int32_t`, or `int`. */     \
+	CF_ENUM(COMPONENT_FIELD_TYPE_INT32,  4) \
+	/* @entry `uint32_t`. */              \
+	CF_ENUM(COMPONENT_FIELD_TYPE_UINT32, 5) \
+	/* @entry `int64_t`. */               \
+	CF_ENUM(COMPONENT_FIELD_TYPE_INT64,  6) \
+	/* @entry `uint64_t`. */              \
+	CF_ENUM(COMPONENT_FIELD_TYPE_UINT64, 7) \
+	/* @entry `float`. */                 \
+	CF_ENUM(COMPONENT_FIELD_TYPE_FLOAT,  8) \
+	/* @entry `double`. */                \
+	CF_ENUM(COMPONENT_FIELD_TYPE_DOUBLE, 9) \
+	/* @entry `bool`. */                  \
+	CF_ENUM(COMPONENT_FIELD_TYPE_BOOL,   10) \
+	/* @end */
+
+typedef enum CF_ComponentFieldType
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_COMPONENT_FIELD_TYPE_DEFS
+	#undef CF_ENUM
+} CF_ComponentFieldType;
+
+/**
+ * @function cf_component_field_type_to_string
+ * @category ecs
+ * @brief    Convert an enum `CF_ComponentFieldType` to a c-style string.
+ * @param    type       The type to convert to a string.
+ * @related  CF_ComponentFieldType cf_component_add_field
+ */
+CF_INLINE const char* cf_component_field_type_to_string(CF_ComponentFieldType type)
+{
+	switch (type) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_COMPONENT_FIELD_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @function cf_component_add_field
+ * @category ecs
+ * @brief    Describes one field of this new component type, for saving and loading components.
+ * @param    name       The name of the field, as written to JSON.
+ * @param    type       The field's type, see `CF_ComponentFieldType`.
+ * @param    offset     The byte offset of the field within the component, such as from `CF_OFFSET_OF`.
+ * @param    count      The number of values, for fixed-size arrays. Use 1 for a single value, or 2 for a `CF_V2`'s two floats.
+ * @example > Registering fields of a component.
+ *     typedef struct Transform { CF_V2 position; float angle; int layer; } Transform;
+ *
+ *     cf_component_begin();
+ *     cf_component_set_name("Transform");
+ *     cf_component_set_size(sizeof(Transform));
+ *     cf_component_add_field("position", CF_COMPONENT_FIELD_TYPE_FLOAT, CF_OFFSET_OF(Transform, position), 2);
+ *     cf_component_add_field("angle", CF_COMPONENT_FIELD_TYPE_FLOAT, CF_OFFSET_OF(Transform, angle), 1);
+ *     cf_component_add_field("layer", CF_COMPONENT_FIELD_TYPE_INT32, CF_OFFSET_OF(Transform, layer), 1);
+ *     cf_component_end();
+ * @remarks  Only registered fields are saved and loaded, the rest of a component is left as its initializer set it. Components with
+ *           no fields are skipped entirely. Pointers, strings and entity handles can't be registered, as they don't survive a save.
+ * @related  CF_ComponentFieldType cf_component_to_json cf_world_to_json cf_world_to_binary
+ */
+CF_API void CF_CALL cf_component_add_field(const char* name, CF_ComponentFieldType type, size_t offset, int count);
+
 /**
  * @function cf_component_end
  * @category ecs
@@ -376,6 +628,45 @@ CF_API void CF_CALL cf_system_set_update(CF_SystemUpdateFn* update_fn);
  */
 CF_API void CF_CALL cf_system_require_component(const char* component_type);
 
+/**
+ * @function cf_system_require_component_read_only
+ * @category ecs
+ * @brief    Same as `cf_system_require_component`, but promises the system never writes to this component type.
+ * @remarks  Parallel systems (see `cf_system_set_optional_parallel`) that only read a component may update at the same time
+ *           as each other, while a system writing a component waits for, or is waited on by, every other system accessing it.
+ * @related  cf_system_require_component cf_system_require_component_read_only cf_system_set_optional_parallel cf_run_systems
+ */
+CF_API void CF_CALL cf_system_require_component_read_only(const char* component_type);
+
+/**
+ * @function cf_system_set_optional_parallel
+ * @category ecs
+ * @brief    Allows `cf_run_systems` to run this system's update on worker threads.
+ * @param    parallel   True to allow parallel updates. False by default.
+ * @remarks  A parallel system's update function may be called on several threads at once, one call per chunk of matching entities,
+ *           and alongside other parallel systems it doesn't conflict with. Components are declared read/write with
+ *           `cf_system_require_component` or read-only with `cf_system_require_component_read_only`. The update function
+ *           must only touch the components it declared, plus its own thread-safe state. Structural changes must go through
+ *           the delayed functions such as `cf_destroy_entity_delayed` or `cf_entity_delayed_change_type`, which still apply
+ *           at the end of `cf_run_systems`. Pre and post update callbacks always run on the calling thread.
+ * @related  cf_system_require_component cf_system_require_component_read_only cf_system_set_optional_parallel cf_run_systems
+ */
+CF_API void CF_CALL cf_system_set_optional_parallel(bool parallel);
+
+/**
+ * @function cf_system_set_optional_changed_filter
+ * @category ecs
+ * @brief    Only update entities whose `component_type` changed since this system last ran.
+ * @param    component_type  A component type this system requires. If not yet required, it's required as with `cf_system_require_component`.
+ * @remarks  Changes are tracked per chunk of entities (see `CF_SystemUpdateFn`), so unchanged entities sharing a chunk with a
+ *           changed one are still updated. A component counts as changed when its entity is created or moved in storage,
+ *           when it's fetched with `cf_entity_get_component`, or when a system requiring it not read-only updates its chunk
+ *           -- prefer `cf_system_require_component_read_only` for components a system doesn't write. A system never sees
+ *           changes caused by its own updates. Call this multiple times to update when any one of several components changed.
+ * @related  cf_system_require_component cf_system_require_component_read_only cf_system_set_optional_changed_filter cf_run_systems
+ */
+CF_API void CF_CALL cf_system_set_optional_changed_filter(const char* component_type);
+
 /**
  * @function cf_system_set_optional_pre_update
  * @category ecs
@@ -414,10 +705,128 @@ CF_API void CF_CALL cf_system_end();
  * @brief    Updates a system.
  * @remarks  All entities who have matching components will be filtered for and passed along to the system for updating. The order
  *           of system updates is determined by the order in which they are defined by `cf_system_begin`.
- * @related  cf_system_begin cf_system_set_name cf_system_set_update cf_system_require_component cf_system_set_optional_pre_update cf_system_set_optional_post_update cf_system_set_optional_udata cf_system_end
+ *           
+ *           Consecutive systems marked with `cf_system_set_optional_parallel` are scheduled on the threadpool instead. Within
+ *           such a run, a system only waits on earlier systems it conflicts with (one of them writes a component the other
+ *           accesses), and their pre update callbacks run first, then all their updates in parallel, then their post updates.
+ * @related  cf_system_begin cf_system_set_name cf_system_set_update cf_system_require_component cf_system_set_optional_pre_update cf_system_set_optional_post_update cf_system_set_optional_udata cf_system_end cf_run_systems_world
  */
 CF_API void CF_CALL cf_run_systems();
 
+/**
+ * @function cf_run_systems_world
+ * @category ecs
+ * @brief    Same as `cf_run_systems`, but updates `world` instead of the current world.
+ * @param    world      The world to update.
+ * @remarks  While this runs, every ECS call made from your systems and their callbacks goes to `world`, including from worker
+ *           threads of parallel systems. No other world is touched, so different worlds may be updated at the same time from
+ *           different threads, such as to simulate many matches at once on a server.
+ *
+ *           Systems, components and entity types are shared by all worlds, so define them all up-front, before updating worlds
+ *           from multiple threads. Parallel systems only use the threadpool for one world at a time, and otherwise run on the
+ *           calling thread. Profiles are kept per world, see `cf_query_system_profile`.
+ * @related  cf_run_systems cf_world_bind_to_thread CF_World
+ */
+CF_API void CF_CALL cf_run_systems_world(CF_World world);
+
+/**
+ * @struct   CF_SystemProfile
+ * @category ecs
+ * @brief    Timings and counts of a single system from the most recent `cf_run_systems`.
+ * @remarks  Only recorded while profiling is on, see `cf_system_profiling_enable`.
+ * @related  CF_SystemProfile CF_SystemsProfile cf_system_profiling_enable cf_query_system_profile cf_system_profile_imgui_window
+ */
+typedef struct CF_SystemProfile
+{
+	/* @member The system's name, see `cf_system_set_name`. NULL if the system was never named. */
+	const char* name;
+
+	/* @member True if the system was run on the threadpool, see `cf_system_set_optional_parallel`. */
+	bool parallel;
+
+	/* @member Time spent in the system's pre update callback, in milliseconds. */
+	float pre_update_milliseconds;
+
+	/* @member Time spent in the system's update callback, in milliseconds. For parallel systems this is summed over all threads. */
+	float update_milliseconds;
+
+	/* @member Time spent in the system's post update callback, in milliseconds. */
+	float post_update_milliseconds;
+
+	/* @member Number of entity collections (one per entity type) the system updated. */
+	int collection_count;
+
+	/* @member Number of chunks passed to the update callback, see `CF_SystemUpdateFn`. */
+	int chunk_count;
+
+	/* @member Number of entities passed to the update callback. */
+	int entity_count;
+} CF_SystemProfile;
+// @end
+
+/**
+ * @struct   CF_SystemsProfile
+ * @category ecs
+ * @brief    A profile of the most recent `cf_run_systems`, one `CF_SystemProfile` per system.
+ * @related  CF_SystemProfile CF_SystemsProfile cf_system_profiling_enable cf_query_system_profile cf_system_profile_imgui_window
+ */
+typedef struct CF_SystemsProfile
+{
+	/* @member Number of elements in `systems`. */
+	int count;
+
+	/* @member One profile per system, in the order systems were defined by `cf_system_begin`. */
+	const CF_SystemProfile* systems;
+
+	/* @member Total time spent in `cf_run_systems`, in milliseconds. */
+	float milliseconds;
+
+	/* @member Time spent performing delayed operations at the end of `cf_run_systems`, in milliseconds. */
+	float delayed_milliseconds;
+
+	/* @member Number of entities destroyed by `cf_destroy_entity_delayed`. */
+	int delayed_destroy_count;
+
+	/* @member Number of entities deactivated by `cf_entity_delayed_deactivate`. */
+	int delayed_deactivate_count;
+
+	/* @member Number of entities activated by `cf_entity_delayed_activate`. */
+	int delayed_activate_count;
+
+	/* @member Number of entities changed by `cf_entity_delayed_change_type`. */
+	int delayed_change_type_count;
+} CF_SystemsProfile;
+// @end
+
+/**
+ * @function cf_system_profiling_enable
+ * @category ecs
+ * @brief    Turns profiling of `cf_run_systems` on or off. Off by default.
+ * @param    enable     True to record a `CF_SystemsProfile` each time `cf_run_systems` is called.
+ * @remarks  Profiling costs a few timer reads per system and chunk, and nothing at all while off.
+ * @related  CF_SystemProfile CF_SystemsProfile cf_system_profiling_enable cf_query_system_profile cf_system_profile_imgui_window
+ */
+CF_API void CF_CALL cf_system_profiling_enable(bool enable);
+
+/**
+ * @function cf_query_system_profile
+ * @category ecs
+ * @brief    Returns the profile recorded by the most recent `cf_run_systems` of the current world while profiling was on.
+ * @remarks  The returned pointer is valid until the world's next call to `cf_run_systems`. Each world keeps its own profile.
+ * @related  CF_SystemProfile CF_SystemsProfile cf_system_profiling_enable cf_query_system_profile cf_system_profile_imgui_window
+ */
+CF_API CF_SystemsProfile CF_CALL cf_query_system_profile();
+
+/**
+ * @function cf_system_profile_imgui_window
+ * @category ecs
+ * @brief    Draws a Dear ImGui window showing `cf_query_system_profile`.
+ * @remarks  Call once per frame after `cf_app_init_imgui`, does nothing otherwise. Turn on `cf_system_profiling_enable` for
+ *           the window to show anything.
+ * @related  CF_SystemProfile CF_SystemsProfile cf_system_profiling_enable cf_query_system_profile cf_system_profile_imgui_window
+ */
+CF_API void CF_CALL cf_system_profile_imgui_window();
+
 /**
  * @function cf_get_components
  * @category ecs
@@ -428,6 +837,14 @@ CF_API void CF_CALL cf_run_systems();
  */
 CF_API void* CF_CALL cf_get_components(CF_ComponentList component_list, const char* component_type);
 
+/**
+ * @function cf_get_components_by_id
+ * @category ecs
+ * @brief    Same as `cf_get_components`, but by ID from `cf_component_get_id`.
+ * @related  cf_component_get_id cf_entity_has_component_by_id cf_entity_get_component_by_id cf_get_components_by_id
+ */
+CF_API void* CF_CALL cf_get_components_by_id(CF_ComponentList component_list, int component_id);
+
 /**
  * @function cf_get_entities
  * @category ecs
@@ -438,12 +855,87 @@ CF_API void* CF_CALL cf_get_components(CF_ComponentList component_list, const ch
 CF_API CF_Entity* CF_CALL cf_get_entities(CF_ComponentList component_list);
 #define CF_GET_COMPONENTS(component_list, T) (T*)cf_get_components(component_list, #T)
 
+/**
+ * @function cf_make_query
+ * @category ecs
+ * @brief    Returns a new query, matching all entities until components are required or excluded.
+ * @remarks  The set of matching entity types is cached per query, and only recomputed after the query itself or the ECS schema
+ *           changes (such as adding entity types) or when used in a different world. Free it with `cf_destroy_query` when done.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API CF_Query CF_CALL cf_make_query();
+
+/**
+ * @function cf_destroy_query
+ * @category ecs
+ * @brief    Destroys a query created by `cf_make_query`.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API void CF_CALL cf_destroy_query(CF_Query query);
+
+/**
+ * @function cf_query_require_component
+ * @category ecs
+ * @brief    Only match entities with `component_type`.
+ * @remarks  Visited components count as changed, see `cf_system_set_optional_changed_filter`.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API void CF_CALL cf_query_require_component(CF_Query query, const char* component_type);
+
+/**
+ * @function cf_query_require_component_read_only
+ * @category ecs
+ * @brief    Only match entities with `component_type`, which the query callback promises not to write.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API void CF_CALL cf_query_require_component_read_only(CF_Query query, const char* component_type);
+
+/**
+ * @function cf_query_exclude_component
+ * @category ecs
+ * @brief    Skip entities with `component_type`.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API void CF_CALL cf_query_exclude_component(CF_Query query, const char* component_type);
+
+/**
+ * @function cf_query_count
+ * @category ecs
+ * @brief    Returns the number of active entities in the current world matching the query.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API int CF_CALL cf_query_count(CF_Query query);
+
+/**
+ * @function cf_query_for_each
+ * @category ecs
+ * @brief    Calls `update_fn` for all active entities in the current world matching the query.
+ * @param    query      The query.
+ * @param    update_fn  Called once per chunk of matching entities, just like a system. Fetch components with `cf_get_components`.
+ * @param    udata      An optional user data pointer handed to `update_fn`.
+ * @remarks  Safe to call from anywhere, including within a system update.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API void CF_CALL cf_query_for_each(CF_Query query, CF_SystemUpdateFn* update_fn, void* udata);
+
+/**
+ * @function cf_query_for_each_parallel
+ * @category ecs
+ * @brief    Same as `cf_query_for_each`, but calls `update_fn` on the threadpool, one chunk of entities per task.
+ * @remarks  Returns once all chunks are updated. `update_fn` must only touch its own chunk's components, and make structural changes
+ *           through the delayed functions such as `cf_destroy_entity_delayed`, which apply at the end of the next `cf_run_systems`.
+ *           Runs on the calling thread if the app has no threadpool, or when called from within a parallel system.
+ * @related  CF_Query cf_make_query cf_destroy_query cf_query_require_component cf_query_require_component_read_only cf_query_exclude_component cf_query_count cf_query_for_each cf_query_for_each_parallel
+ */
+CF_API void CF_CALL cf_query_for_each_parallel(CF_Query query, CF_SystemUpdateFn* update_fn, void* udata);
+
 /**
  * @function cf_make_world
  * @category ecs
  * @brief    Constructs a new entity world.
  * @remarks  Entity worlds are scopes of entity instances. Other functions like looking up an entity, or system updates, only work
- *           on entity instances that belong to the currently active world.
+ *           on entity instances that belong to the currently active world. The new world can hold entities of every entity type
+ *           defined so far.
  * @related  CF_World cf_make_world cf_destroy_world cf_world_push cf_world_pop cf_world_peek cf_world_equals
  */
 CF_API CF_World CF_CALL cf_make_world();
@@ -480,6 +972,17 @@ CF_API CF_World CF_CALL cf_world_pop();
  */
 CF_API CF_World CF_CALL cf_world_peek();
 
+/**
+ * @function cf_world_bind_to_thread
+ * @category ecs
+ * @brief    Makes `world` the current world for the calling thread only, in place of the world from `cf_world_push`.
+ * @param    world      The world, or `CF_INVALID_WORLD` to go back to the world from `cf_world_push`.
+ * @remarks  Use this to create or modify entities of a world on a thread of your own, such as when setting up one match of many
+ *           on a server. Pair it with `cf_run_systems_world` to then update that world on the same thread.
+ * @related  CF_World cf_world_push cf_world_peek cf_run_systems_world
+ */
+CF_API void CF_CALL cf_world_bind_to_thread(CF_World world);
+
 /**
  * @function cf_world_equals
  * @category ecs
@@ -488,6 +991,121 @@ CF_API CF_World CF_CALL cf_world_peek();
  */
 CF_INLINE bool cf_world_equals(CF_World a, CF_World b) { return a.id == b.id; }
 
+/**
+ * @function cf_make_world_snapshot
+ * @category ecs
+ * @brief    Returns a new, empty world snapshot.
+ * @remarks  Snapshots keep their memory between saves, so keep a few around (such as a ring buffer of one per rollback frame)
+ *           and reuse them rather than making new ones each frame. Free it with `cf_destroy_world_snapshot` when done.
+ * @related  CF_WorldSnapshot cf_make_world_snapshot cf_destroy_world_snapshot cf_world_save_snapshot cf_world_restore_snapshot
+ */
+CF_API CF_WorldSnapshot CF_CALL cf_make_world_snapshot();
+
+/**
+ * @function cf_destroy_world_snapshot
+ * @category ecs
+ * @brief    Destroys a snapshot created by `cf_make_world_snapshot`.
+ * @related  CF_WorldSnapshot cf_make_world_snapshot cf_destroy_world_snapshot cf_world_save_snapshot cf_world_restore_snapshot
+ */
+CF_API void CF_CALL cf_destroy_world_snapshot(CF_WorldSnapshot snapshot);
+
+/**
+ * @function cf_world_save_snapshot
+ * @category ecs
+ * @brief    Saves all entities and components of the current world into `snapshot`, overwriting whatever it held before.
+ * @remarks  Components are copied byte for byte, so they should be plain data -- any memory a component points to is not saved.
+ *           Only chunks of components changed since this snapshot last saved or restored this world are copied (see
+ *           `cf_system_set_optional_changed_filter` for what counts as a change). Don't call this from within a system.
+ * @related  CF_WorldSnapshot cf_make_world_snapshot cf_destroy_world_snapshot cf_world_save_snapshot cf_world_restore_snapshot
+ */
+CF_API void CF_CALL cf_world_save_snapshot(CF_WorldSnapshot snapshot);
+
+/**
+ * @function cf_world_restore_snapshot
+ * @category ecs
+ * @brief    Restores the current world to exactly the state saved in `snapshot`.
+ * @remarks  Entities made since the save become invalid, and entities destroyed since become valid again. No component initializer
+ *           or cleanup callbacks run. Only chunks that differ from the snapshot are copied, and these count as changed for systems
+ *           using `cf_system_set_optional_changed_filter`. Entity types registered after the save are left empty. Don't call this
+ *           from within a system.
+ * @related  CF_WorldSnapshot cf_make_world_snapshot cf_destroy_world_snapshot cf_world_save_snapshot cf_world_restore_snapshot
+ */
+CF_API void CF_CALL cf_world_restore_snapshot(CF_WorldSnapshot snapshot);
+
+/**
+ * @function cf_component_to_json
+ * @category ecs
+ * @brief    Writes the registered fields of a component out as a JSON object.
+ * @param    doc             The document to create the object in.
+ * @param    component_type  The component's type.
+ * @param    component       The component, such as from `cf_entity_get_component`.
+ * @return   Returns a new JSON object, keyed by field name. Fields with a count above one become arrays.
+ * @related  cf_component_add_field cf_component_from_json cf_world_to_json
+ */
+CF_API CF_JVal CF_CALL cf_component_to_json(CF_JDoc doc, const char* component_type, const void* component);
+
+/**
+ * @function cf_component_from_json
+ * @category ecs
+ * @brief    Reads the registered fields of a component from a JSON object.
+ * @param    component_type  The component's type.
+ * @param    val             A JSON object, as written by `cf_component_to_json`.
+ * @param    component       The component to write into.
+ * @remarks  Fields missing from `val` are left untouched, so components saved before a field was added still load.
+ * @related  cf_component_add_field cf_component_to_json cf_world_from_json
+ */
+CF_API void CF_CALL cf_component_from_json(const char* component_type, CF_JVal val, void* component);
+
+/**
+ * @function cf_world_to_json
+ * @category ecs
+ * @brief    Writes every entity of the current world out as JSON, such as for a save game.
+ * @param    doc        The document to create the value in.
+ * @return   Returns a new JSON object holding one array of entities per entity type.
+ * @remarks  Only fields registered with `cf_component_add_field` are written. See `cf_world_to_binary` for a smaller and faster format.
+ * @related  cf_world_from_json cf_world_to_binary cf_component_to_json
+ */
+CF_API CF_JVal CF_CALL cf_world_to_json(CF_JDoc doc);
+
+/**
+ * @function cf_world_from_json
+ * @category ecs
+ * @brief    Makes the entities saved by `cf_world_to_json` in the current world.
+ * @param    val        The value returned by `cf_world_to_json`.
+ * @return   Returns any errors as `CF_Result`.
+ * @remarks  Entities are made as by `cf_make_entities`, so component initializers run before saved fields are read in. Entity types
+ *           no longer registered are skipped. Loaded entities get new handles, so the world is usually cleared first. Don't call this
+ *           from within a system.
+ * @related  cf_world_to_json cf_world_from_binary cf_component_from_json
+ */
+CF_API CF_Result CF_CALL cf_world_from_json(CF_JVal val);
+
+/**
+ * @function cf_world_to_binary
+ * @category ecs
+ * @brief    Writes every entity of the current world out in a compact binary format, such as for a save game.
+ * @param    size       The size of the returned buffer in bytes.
+ * @return   Returns a buffer to free with `cf_free`.
+ * @remarks  Only fields registered with `cf_component_add_field` are written, column by column straight out of component storage.
+ *           Each component's fields are described in the buffer, so it still loads after fields are added, removed or reordered.
+ *           Values are written in the machine's byte order.
+ * @related  cf_world_from_binary cf_world_to_json
+ */
+CF_API void* CF_CALL cf_world_to_binary(size_t* size);
+
+/**
+ * @function cf_world_from_binary
+ * @category ecs
+ * @brief    Makes the entities saved by `cf_world_to_binary` in the current world.
+ * @param    data       The buffer returned by `cf_world_to_binary`.
+ * @param    size       The size of `data` in bytes.
+ * @return   Returns any errors as `CF_Result`, such as for a truncated buffer.
+ * @remarks  Loads as `cf_world_from_json` does. Saved fields no longer registered, or registered with a different type, are skipped.
+ *           Entities made before an error is found are left in the world, so save a `CF_WorldSnapshot` first to roll back.
+ * @related  cf_world_to_binary cf_world_from_json
+ */
+CF_API CF_Result CF_CALL cf_world_from_binary(const void* data, size_t size);
+
 /**
  * @function cf_is_entity_type_valid
  * @category ecs
@@ -548,8 +1166,15 @@ namespace Cute
 using Entity = CF_Entity;
 using ComponentList = CF_ComponentList;
 using World = CF_World;
+using WorldSnapshot = CF_WorldSnapshot;
+using Query = CF_Query;
+using Prefab = CF_Prefab;
+using PrefabOverrideFn = CF_PrefabOverrideFn;
+using SystemProfile = CF_SystemProfile;
+using SystemsProfile = CF_SystemsProfile;
 using SystemUpdateFn = CF_SystemUpdateFn;
 using ComponentFn = CF_ComponentFn;
+using ComponentFieldType = CF_ComponentFieldType;
 
 //--------------------------------------------------------------------------------------------------
 // Entity
@@ -563,12 +1188,22 @@ CF_INLINE void entity_add_component(const char* component_type) { cf_entity_add_
 CF_INLINE void entity_end() { cf_entity_end(); }
 
 CF_INLINE Entity make_entity(const char* entity_type) { return cf_make_entity(entity_type); }
+CF_INLINE void make_entities(const char* entity_type, int count, Entity* out_entities) { cf_make_entities(entity_type, count, out_entities); }
+CF_INLINE Prefab make_prefab(const char* entity_type) { return cf_make_prefab(entity_type); }
+CF_INLINE void destroy_prefab(Prefab prefab) { cf_destroy_prefab(prefab); }
+CF_INLINE void* prefab_get_component(Prefab prefab, const char* component_type) { return cf_prefab_get_component(prefab, component_type); }
+CF_INLINE Entity make_entity_from_prefab(Prefab prefab) { return cf_make_entity_from_prefab(prefab); }
+CF_INLINE void make_entities_from_prefab(Prefab prefab, int count, Entity* out_entities, PrefabOverrideFn* override_fn = NULL, void* udata = NULL) { cf_make_entities_from_prefab(prefab, count, out_entities, override_fn, udata); }
 CF_INLINE bool entity_is_valid(Entity entity) { return cf_entity_is_valid(entity); }
 CF_INLINE bool entity_is_type(Entity entity, const char* entity_type) { return cf_entity_is_type(entity, entity_type); }
 CF_INLINE const char* entity_get_type_string(Entity entity) { return cf_entity_get_type_string(entity); }
 CF_INLINE bool entity_has_component(Entity entity, const char* component_type) { return cf_entity_has_component(entity, component_type); }
 CF_INLINE void* entity_get_component(Entity entity, const char* component_type) { return cf_entity_get_component(entity, component_type); }
+CF_INLINE int component_get_id(const char* component_type) { return cf_component_get_id(component_type); }
+CF_INLINE bool entity_has_component(Entity entity, int component_id) { return cf_entity_has_component_by_id(entity, component_id); }
+CF_INLINE void* entity_get_component(Entity entity, int component_id) { return cf_entity_get_component_by_id(entity, component_id); }
 CF_INLINE void destroy_entity(Entity entity) { cf_destroy_entity(entity); }
+CF_INLINE void destroy_entities(const Entity* entities, int count) { cf_destroy_entities(entities, count); }
 CF_INLINE void destroy_entity_delayed(Entity entity) { cf_destroy_entity_delayed(entity); }
 
 CF_INLINE bool entity_equals(CF_Entity* a, CF_Entity* b) { return a->handle == b->handle; }
@@ -586,28 +1221,57 @@ CF_INLINE void component_set_name(const char* name) { cf_component_set_name(name
 CF_INLINE void component_set_size(size_t size) { cf_component_set_size(size); }
 CF_INLINE void component_set_optional_initializer(ComponentFn* intializer, void* udata = NULL) { cf_component_set_optional_initializer(intializer, udata); }
 CF_INLINE void component_set_optional_cleanup(ComponentFn* cleanup, void* udata = NULL) { cf_component_set_optional_cleanup(cleanup, udata); }
+CF_INLINE void component_add_field(const char* name, ComponentFieldType type, size_t offset, int count = 1) { cf_component_add_field(name, type, offset, count); }
 CF_INLINE void component_end() { cf_component_end(); }
 
 CF_INLINE void system_begin() { cf_system_begin(); }
 CF_INLINE void system_set_name(const char* name) { cf_system_set_name(name); }
 CF_INLINE void system_set_update(CF_SystemUpdateFn* update_fn) { cf_system_set_update(update_fn); }
 CF_INLINE void system_require_component(const char* component_type) { cf_system_require_component(component_type); }
+CF_INLINE void system_require_component_read_only(const char* component_type) { cf_system_require_component_read_only(component_type); }
+CF_INLINE void system_set_optional_parallel(bool parallel) { cf_system_set_optional_parallel(parallel); }
+CF_INLINE void system_set_optional_changed_filter(const char* component_type) { cf_system_set_optional_changed_filter(component_type); }
 CF_INLINE void system_set_optional_pre_update(void (*pre_update_fn)(void* udata)) { cf_system_set_optional_pre_update(pre_update_fn); }
 CF_INLINE void system_set_optional_post_update(void (*post_update_fn)(void* udata)) { cf_system_set_optional_post_update(post_update_fn); }
 CF_INLINE void system_set_optional_udata(void* udata) { cf_system_set_optional_udata(udata); }
 CF_INLINE void system_end() { cf_system_end(); }
 
 CF_INLINE void run_systems() { cf_run_systems(); }
+CF_INLINE void run_systems_world(CF_World world) { cf_run_systems_world(world); }
+CF_INLINE void system_profiling_enable(bool enable) { cf_system_profiling_enable(enable); }
+CF_INLINE SystemsProfile query_system_profile() { return cf_query_system_profile(); }
+CF_INLINE void system_profile_imgui_window() { cf_system_profile_imgui_window(); }
 
 CF_INLINE void* CF_CALL get_components(ComponentList component_list, const char* component_type) { return cf_get_components(component_list, component_type); }
+CF_INLINE void* CF_CALL get_components(ComponentList component_list, int component_id) { return cf_get_components_by_id(component_list, component_id); }
 CF_INLINE Entity* CF_CALL get_entities(ComponentList component_list) { return cf_get_entities(component_list); }
 
+CF_INLINE Query make_query() { return cf_make_query(); }
+CF_INLINE void destroy_query(Query query) { cf_destroy_query(query); }
+CF_INLINE void query_require_component(Query query, const char* component_type) { cf_query_require_component(query, component_type); }
+CF_INLINE void query_require_component_read_only(Query query, const char* component_type) { cf_query_require_component_read_only(query, component_type); }
+CF_INLINE void query_exclude_component(Query query, const char* component_type) { cf_query_exclude_component(query, component_type); }
+CF_INLINE int query_count(Query query) { return cf_query_count(query); }
+CF_INLINE void query_for_each(Query query, SystemUpdateFn* update_fn, void* udata = NULL) { cf_query_for_each(query, update_fn, udata); }
+CF_INLINE void query_for_each_parallel(Query query, SystemUpdateFn* update_fn, void* udata = NULL) { cf_query_for_each_parallel(query, update_fn, udata); }
+
 CF_INLINE CF_World make_world() { return cf_make_world(); }
 CF_INLINE void destroy_world(CF_World world) { cf_destroy_world(world); }
 CF_INLINE void world_push(CF_World world) { cf_world_push(world); }
 CF_INLINE CF_World world_pop() { return cf_world_pop(); }
 CF_INLINE CF_World world_peek() { return cf_world_peek(); }
+CF_INLINE void world_bind_to_thread(CF_World world) { cf_world_bind_to_thread(world); }
 CF_INLINE bool world_equals(CF_World a, CF_World b) { return a.id == b.id; }
+CF_INLINE WorldSnapshot make_world_snapshot() { return cf_make_world_snapshot(); }
+CF_INLINE void destroy_world_snapshot(WorldSnapshot snapshot) { cf_destroy_world_snapshot(snapshot); }
+CF_INLINE void world_save_snapshot(WorldSnapshot snapshot) { cf_world_save_snapshot(snapshot); }
+CF_INLINE void world_restore_snapshot(WorldSnapshot snapshot) { cf_world_restore_snapshot(snapshot); }
+CF_INLINE CF_JVal component_to_json(CF_JDoc doc, const char* component_type, const void* component) { return cf_component_to_json(doc, component_type, component); }
+CF_INLINE void component_from_json(const char* component_type, CF_JVal val, void* component) { cf_component_from_json(component_type, val, component); }
+CF_INLINE CF_JVal world_to_json(CF_JDoc doc) { return cf_world_to_json(doc); }
+CF_INLINE Result world_from_json(CF_JVal val) { return cf_world_from_json(val); }
+CF_INLINE void* world_to_binary(size_t* size) { return cf_world_to_binary(size); }
+CF_INLINE Result world_from_binary(const void* data, size_t size) { return cf_world_from_binary(data, size); }
 CF_INLINE bool operator==(CF_World a, CF_World b) { return a.id == b.id; }
 CF_INLINE bool operator!=(CF_World a, CF_World b) { return a.id != b.id; }
 
@@ -34,7 +34,7 @@ extern "C" {
  *     printf("%s\n", filename);
  *     // Prints: big_gem.txt
  * @remarks  Call `sfree` on the return value when done. `sp` stands for "sting path".
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spfname(s) cf_path_get_filename(s)
 
@@ -48,7 +48,7 @@ extern "C" {
  *     printf("%s\n", filename);
  *     // Prints: big_gem
  * @remarks  Call `sfree` on the return value when done. `sp` stands for "sting path".
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spfname_no_ext(s) cf_path_get_filename_no_ext(s)
 
@@ -62,7 +62,7 @@ extern "C" {
  *     printf("%s\n", ext);
  *     // Prints: .txt
  * @remarks  Call `sfree` on the return value when done. `sp` stands for "sting path".
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spext(s) cf_path_get_ext(s)
 
@@ -73,7 +73,7 @@ extern "C" {
  * @param    s          The path string.
  * @param    ext        The file extension.
  * @remarks  `sp` stands for "sting path".
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spext_equ(s, ext) cf_path_ext_equ(s, ext)
 
@@ -85,7 +85,7 @@ extern "C" {
  * @return   If the string is not a dynamic string from CF's string API, a new string is returned. Otherwise the
  *           string is modified in-place. You must call `sfree` if a new dynamic string is returned, when done.
  * @remarks  `sp` stands for "sting path".
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define sppop(s) cf_path_pop(s)
 
@@ -98,7 +98,7 @@ extern "C" {
  * @return   If the string is not a dynamic string from CF's string API, a new string is returned. Otherwise the
  *           string is modified in-place. You must call `sfree` if a new dynamic string is returned, when done.
  * @remarks  `sp` stands for "sting path".
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define sppopn(s, n) cf_path_pop_n(s, n)
 
@@ -112,7 +112,7 @@ extern "C" {
  *           string is modified in-place. You must call `sfree` if a new dynamic string is returned, when done.
  * @remarks  This will insert ellipses "..." into the path as necessary. This function is useful for displaying paths
  *           and visualizing them in small boxes or windows. n includes the nul-byte. Returns a new string.
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spcompact(s, n) cf_path_compact(s, n)
 
@@ -126,7 +126,7 @@ extern "C" {
  *     printf("%s\n", filename);
  *     // Prints: /rare
  * @remarks  `sp` stands for "sting path". Call `sfree` on the return value when done.
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spdir_of(s) cf_path_directory_of(s)
 
@@ -140,7 +140,7 @@ extern "C" {
  *     printf("%s\n", filename);
  *     // Prints: /data
  * @remarks  `sp` stands for "sting path". Call `sfree` on the return value when done.
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define sptop_of(s) cf_path_top_directory(s)
 
@@ -158,10 +158,54 @@ extern "C" {
  *           ```
  *           spnorm("C:\\Users\\Randy\\Documents") -> "C:/Users/Randy/Documents"
  *           ```
- * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
  */
 #define spnorm(s) cf_path_normalize(s)
 
+/**
+ * @function spfname_view
+ * @category path
+ * @brief    Returns the filename portion of a path, without making a new string.
+ * @param    s          The path string.
+ * @return   Returns a pointer into `s` at the start of the filename, or `NULL` if the path has no filename.
+ * @example  > Example peeking at a filename within a path.
+ *     const char* filename = spfname_view("/data/collections/rare/big_gem.txt");
+ *     printf("%s\n", filename);
+ *     // Prints: big_gem.txt
+ * @remarks  Unlike `spfname` nothing is allocated, so don't call `sfree` on the return value. It's only valid as long as `s` is.
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
+ */
+#define spfname_view(s) cf_path_view_filename(s)
+
+/**
+ * @function spfname_no_ext_view
+ * @category path
+ * @brief    Returns the filename portion of a path without the file extension, without making a new string.
+ * @param    s          The path string.
+ * @param    len        Set to the length of the filename, not counting the extension.
+ * @return   Returns a pointer into `s` at the start of the filename, or `NULL` if the path has no filename.
+ * @example  > Example interning a filename without the extension, without any temporary strings.
+ *     int len;
+ *     const char* filename = spfname_no_ext_view("/data/collections/rare/big_gem.txt", &len);
+ *     const char* name = sintern_range(filename, filename + len);
+ *     // name is "big_gem"
+ * @remarks  The result isn't nul-terminated at `len`. Nothing is allocated, so don't call `sfree` on the return value. It's only valid as
+ *           long as `s` is.
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
+ */
+#define spfname_no_ext_view(s, len) cf_path_view_filename_no_ext(s, len)
+
+/**
+ * @function spext_view
+ * @category path
+ * @brief    Returns the extension of the file for the given path, without making a new string.
+ * @param    s          The path string.
+ * @return   Returns a pointer into `s` at the extension, including the '.', or `NULL` if the path has no extension.
+ * @remarks  Unlike `spext` nothing is allocated, so don't call `sfree` on the return value. It's only valid as long as `s` is.
+ * @related  spfname spfname_no_ext spext spext_equ sppop sppopn spcompact spdir_of sptop_of spnorm spfname_view spfname_no_ext_view spext_view
+ */
+#define spext_view(s) cf_path_view_ext(s)
+
 CF_API char* CF_CALL cf_path_get_filename(const char* path);
 CF_API char* CF_CALL cf_path_get_filename_no_ext(const char* path);
 CF_API char* CF_CALL cf_path_get_ext(const char* path);
@@ -172,6 +216,9 @@ CF_API char* CF_CALL cf_path_compact(const char* path, int n);
 CF_API char* CF_CALL cf_path_directory_of(const char* path);
 CF_API char* CF_CALL cf_path_top_directory(const char* path);
 CF_API char* CF_CALL cf_path_normalize(const char* path);
+CF_API const char* CF_CALL cf_path_view_filename(const char* path);
+CF_API const char* CF_CALL cf_path_view_filename_no_ext(const char* path, int* len);
+CF_API const char* CF_CALL cf_path_view_ext(const char* path);
 
 //--------------------------------------------------------------------------------------------------
 // Virtual file system.
@@ -235,6 +282,7 @@ CF_API char* CF_CALL cf_path_normalize(const char* path);
  *    .WAD (DOOM engine archives)
  *    .VDF (Gothic I/II engine archives)
  *    .SLB (Independence War archives)
+ *    .CFPK (Cute Framework packs, see `cf_fs_write_pack`)
  * 
  * Whenever an archive is mounted the file system treats it like a normal directory. No extra
  * work is needed. This lets us do really cool things, like deploy patches by downloading
@@ -527,6 +575,20 @@ CF_API void CF_CALL cf_fs_free_enumerated_directory(const char** directory_list)
  */
 CF_API bool CF_CALL cf_fs_file_exists(const char* virtual_path);
 
+/**
+ * @function cf_fs_set_index_enabled
+ * @category file
+ * @brief    Answers path lookups from an in-memory index of every mounted file, instead of searching each mount in turn.
+ * @param    enabled       True to use the index. Off by default.
+ * @remarks  Without the index, `cf_fs_stat`, `cf_fs_file_exists`, `cf_fs_enumerate_directory` and `cf_fs_get_actual_path` search every
+ *           mounted directory and archive on each call, which adds up for tools that crawl many files. With the index they become a hash
+ *           lookup. The index is built on the next lookup after mounting, dismounting, changing the write directory or writing through
+ *           `cf_fs_***` functions, which walks every mounted directory once, so enable it once mounting is done. Files changed outside
+ *           of `cf_fs_***` aren't noticed, unless reported by `cf_fs_watch_mounts`. Paths with "." or ".." still go to the mounts.
+ * @related  cf_fs_stat cf_fs_file_exists cf_fs_enumerate_directory cf_fs_get_actual_path cf_fs_mount
+ */
+CF_API void CF_CALL cf_fs_set_index_enabled(bool enabled);
+
 /**
  * @function cf_fs_read
  * @category file
@@ -649,6 +711,47 @@ CF_API CF_Result CF_CALL cf_fs_write_string_to_file(const char* virtual_path, co
  */
 CF_API CF_Result CF_CALL cf_fs_write_string_range_to_file(const char* virtual_path, const char* begin, const char* end);
 
+/**
+ * @function cf_fs_write_pack
+ * @category file
+ * @brief    Writes every file within a directory, and its subdirectories, into one .cfpk pack file.
+ * @param    virtual_directory  The directory to pack. Its contents become the top level of the pack.
+ * @param    pack_virtual_path  Where to write the pack, within the write directory (see `cf_fs_set_write_directory`).
+ * @param    compress           True to compress files with LZ4, for those that shrink enough to be worth it.
+ * @return   Returns any errors as a `CF_Result`.
+ * @remarks  Mount the pack with `cf_fs_mount` like any other archive. Packs are read-only, and built for mounting many thousands of
+ *           files quickly. Paths are found through a hash table stored in the pack, so mounting is a single read and opening a file
+ *           skips searching a directory listing. Uncompressed files of a page or more are stored page-aligned, and `cf_fs_map_file`
+ *           memory-maps them in place. The `cfpack` tool wraps this function for build scripts.
+ *           [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @related  cf_fs_write_pack cf_fs_mount cf_fs_map_file
+ */
+CF_API CF_Result CF_CALL cf_fs_write_pack(const char* virtual_directory, const char* pack_virtual_path, bool compress);
+
+/**
+ * @function cf_fs_map_file
+ * @category file
+ * @brief    Returns a read-only view of an entire file, without copying it when possible.
+ * @param    virtual_path  A path to the file.
+ * @param    size          If the file exists the size of the file is stored here.
+ * @return   Returns the file's contents, or `NULL` if the file can't be read. Call `cf_fs_unmap_file` when done.
+ * @remarks  Files in a mounted directory, and entries stored uncompressed in a mounted .zip archive, are memory-mapped by the OS. Nothing is
+ *           read up front, and pages are loaded from disk only as they're touched, so large files such as atlases or sound banks can be used
+ *           in place. Anything else, such as compressed entries, falls back to `cf_fs_read_entire_file_to_memory`. The view must not be written
+ *           to, and isn't nul-terminated. Don't overwrite the file on disk while it's mapped. [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @related  cf_fs_map_file cf_fs_unmap_file cf_fs_read_entire_file_to_memory
+ */
+CF_API const void* CF_CALL cf_fs_map_file(const char* virtual_path, size_t* size);
+
+/**
+ * @function cf_fs_unmap_file
+ * @category file
+ * @brief    Releases a view returned by `cf_fs_map_file`.
+ * @param    data       The pointer returned by `cf_fs_map_file`.
+ * @related  cf_fs_map_file cf_fs_unmap_file
+ */
+CF_API void CF_CALL cf_fs_unmap_file(const void* data);
+
 /**
  * @function cf_fs_get_backend_specific_error_message
  * @category file
@@ -671,6 +774,263 @@ CF_API const char* CF_CALL cf_fs_get_backend_specific_error_message();
  */
 CF_API const char* CF_CALL cf_fs_get_actual_path(const char* virtual_path);
 
+/**
+ * @struct   CF_FileRequest
+ * @category file
+ * @brief    A handle to a file being read in the background, see `cf_fs_read_async`.
+ * @remarks  A zeroed request refers to nothing. Requests don't need to be freed.
+ * @related  CF_FileRequest CF_FileReadFn cf_fs_read_async cf_fs_cancel_async cf_fs_poll_async
+ */
+typedef struct CF_FileRequest { uint64_t id; } CF_FileRequest;
+// @end
+
+/**
+ * @enum     CF_FilePriority
+ * @category file
+ * @brief    The order background reads are started in, see `cf_fs_read_async`.
+ * @related  CF_FileRequest cf_fs_read_async cf_file_priority_to_string
+ */
+#define CF_FILE_PRIORITY_DEFS \
+	/* @entry Read after everything else, such as prefetching the next level. */ \
+	CF_ENUM(FILE_PRIORITY_LOW, 0)                                               \
+	/* @entry The default. */                                                    \
+	CF_ENUM(FILE_PRIORITY_NORMAL, 1)                                            \
+	/* @entry Read before anything else, such as a texture needed on screen right now. */ \
+	CF_ENUM(FILE_PRIORITY_HIGH, 2)                                              \
+	/* @entry The number of priorities. */                                       \
+	CF_ENUM(FILE_PRIORITY_COUNT, 3)                                             \
+// @end
+
+typedef enum CF_FilePriority
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_FILE_PRIORITY_DEFS
+	#undef CF_ENUM
+} CF_FilePriority;
+
+/**
+ * @function cf_file_priority_to_string
+ * @category file
+ * @brief    Returns a `CF_FilePriority` converted to a c-string.
+ * @related  CF_FilePriority cf_fs_read_async
+ */
+CF_INLINE const char* cf_file_priority_to_string(CF_FilePriority priority)
+{
+	switch (priority) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_FILE_PRIORITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @function CF_FileReadFn
+ * @category file
+ * @brief    A function pointer (callback) that reports a finished background read.
+ * @param    request       The request returned by `cf_fs_read_async`.
+ * @param    virtual_path  The path that was read.
+ * @param    result        Any errors, such as a missing file, as a `CF_Result`.
+ * @param    data          The whole file, or `NULL` on error. Followed by a nul byte, so text files can be used as C strings. Call `cf_free` on it when done.
+ * @param    size          The size of the file in bytes, not counting the nul byte.
+ * @param    udata         The `udata` passed to `cf_fs_read_async`.
+ * @remarks  Called from `cf_fs_poll_async`, on the thread that calls it.
+ * @related  CF_FileRequest cf_fs_read_async cf_fs_poll_async
+ */
+typedef void (CF_FileReadFn)(CF_FileRequest request, const char* virtual_path, CF_Result result, void* data, size_t size, void* udata);
+
+/**
+ * @function cf_fs_read_async
+ * @category file
+ * @brief    Reads an entire file into memory on a background thread, without blocking the caller.
+ * @param    virtual_path  A path to the file.
+ * @param    priority      Reads of higher `CF_FilePriority` start first. Reads of the same priority start in the order they were requested.
+ * @param    fn            Called from `cf_fs_poll_async` once the file has been read, see `CF_FileReadFn`.
+ * @param    udata         Can be `NULL`. Handed back to you in `fn`.
+ * @return   Returns a `CF_FileRequest` for cancelling the read with `cf_fs_cancel_async`.
+ * @remarks  Reads run one at a time on a dedicated I/O thread, started on first use. A dedicated thread keeps a long queue of reads, such as
+ *           streaming in a level, from stalling frames. Call `cf_fs_poll_async` once per frame to receive the files. Don't mount, dismount
+ *           or change the write directory while reads are pending.
+ * @related  CF_FileRequest CF_FilePriority CF_FileReadFn cf_fs_cancel_async cf_fs_poll_async cf_fs_async_pending_count
+ */
+CF_API CF_FileRequest CF_CALL cf_fs_read_async(const char* virtual_path, CF_FilePriority priority, CF_FileReadFn* fn, void* udata);
+
+/**
+ * @function cf_fs_cancel_async
+ * @category file
+ * @brief    Cancels a read started by `cf_fs_read_async`, or a write started by `cf_fs_write_async`.
+ * @param    request       The request to cancel.
+ * @return   Returns true if the request was cancelled, or false if its callback already ran or the request is unknown.
+ * @remarks  The callback of a cancelled request never runs. A read already in progress stops at its next chunk, and its memory is freed for you.
+ *           A cancelled write never replaces the file.
+ * @related  CF_FileRequest cf_fs_read_async cf_fs_write_async cf_fs_poll_async
+ */
+CF_API bool CF_CALL cf_fs_cancel_async(CF_FileRequest request);
+
+/**
+ * @function cf_fs_poll_async
+ * @category file
+ * @brief    Runs the callbacks of finished background reads and writes.
+ * @param    max_count     The most callbacks to run, for spreading many small files across frames. Zero runs them all.
+ * @return   Returns the number of callbacks run.
+ * @remarks  Call this once per frame from your main loop. Callbacks run in the order requests finished, and may start new requests.
+ * @related  CF_FileRequest CF_FileReadFn CF_FileWriteFn cf_fs_read_async cf_fs_write_async cf_fs_async_pending_count
+ */
+CF_API int CF_CALL cf_fs_poll_async(int max_count);
+
+/**
+ * @function cf_fs_async_pending_count
+ * @category file
+ * @brief    Returns the number of background reads and writes whose callbacks haven't run yet.
+ * @remarks  Useful for loading screens, which can wait until this reaches zero.
+ * @related  cf_fs_read_async cf_fs_write_async cf_fs_poll_async
+ */
+CF_API int CF_CALL cf_fs_async_pending_count();
+
+/**
+ * @function CF_FileWriteFn
+ * @category file
+ * @brief    A function pointer (callback) that reports a finished background write.
+ * @param    request       The request returned by `cf_fs_write_async` or `cf_fs_write_async_serialized`.
+ * @param    virtual_path  The path that was written.
+ * @param    result        Any errors, such as a full disk, as a `CF_Result`. On error the previous file is left untouched.
+ * @param    udata         The `udata` passed when starting the write.
+ * @remarks  Called from `cf_fs_poll_async`, on the thread that calls it.
+ * @related  CF_FileRequest cf_fs_write_async cf_fs_write_async_serialized cf_fs_poll_async
+ */
+typedef void (CF_FileWriteFn)(CF_FileRequest request, const char* virtual_path, CF_Result result, void* udata);
+
+/**
+ * @function CF_FileSerializeFn
+ * @category file
+ * @brief    A function pointer (callback) that turns a snapshot of your data into the bytes of a file, see `cf_fs_write_async_serialized`.
+ * @param    udata         The `serialize_udata` passed to `cf_fs_write_async_serialized`.
+ * @param    canceled      True if the write was cancelled, or dropped by `cf_fs_destroy`, before it started. Free `udata` and return `NULL`.
+ * @param    size          Set this to the size of the returned bytes.
+ * @return   Return the bytes to write, allocated with `cf_alloc`, or `NULL` on error. They're freed for you.
+ * @remarks  Called exactly once per write, on the I/O thread, so it must only touch `udata`. This is also the place to free `udata`.
+ * @related  cf_fs_write_async_serialized CF_FileWriteFn
+ */
+typedef void* (CF_FileSerializeFn)(void* udata, bool canceled, size_t* size);
+
+/**
+ * @function cf_fs_write_async
+ * @category file
+ * @brief    Writes an entire file on a background thread, without blocking the caller.
+ * @param    virtual_path  A path to the file, within the write directory.
+ * @param    data          The bytes to write. Copied, so can be freed right away.
+ * @param    size          The number of bytes to write.
+ * @param    compress      True to compress the file with LZ4, see `cf_fs_decompress`.
+ * @param    fn            Can be `NULL`. Called from `cf_fs_poll_async` once the file is on disk, see `CF_FileWriteFn`.
+ * @param    udata         Can be `NULL`. Handed back to you in `fn`.
+ * @return   Returns a `CF_FileRequest` for cancelling the write with `cf_fs_cancel_async`.
+ * @remarks  Meant for save games and settings. The file is written next to `virtual_path` with a ".tmp" suffix, then renamed over
+ *           it, so a crash or power loss mid-write leaves either the old file or the new one, never half of each. Writes share the I/O
+ *           thread of `cf_fs_read_async` and run ahead of reads in the order requested, so a later read of the same path sees the new
+ *           file. A write that has started finishes even if cancelled, but then isn't renamed into place. Pending writes are finished
+ *           by `cf_fs_destroy` rather than dropped.
+ * @related  CF_FileRequest CF_FileWriteFn cf_fs_write_async_serialized cf_fs_cancel_async cf_fs_poll_async cf_fs_decompress
+ */
+CF_API CF_FileRequest CF_CALL cf_fs_write_async(const char* virtual_path, const void* data, size_t size, bool compress, CF_FileWriteFn* fn, void* udata);
+
+/**
+ * @function cf_fs_write_async_serialized
+ * @category file
+ * @brief    Serializes and writes an entire file on a background thread, without blocking the caller.
+ * @param    virtual_path     A path to the file, within the write directory.
+ * @param    serialize        Called on the I/O thread to produce the bytes of the file, see `CF_FileSerializeFn`.
+ * @param    serialize_udata  Handed to `serialize`. Usually a snapshot of your game state, owned by the write from here on.
+ * @param    compress         True to compress the file with LZ4, see `cf_fs_decompress`.
+ * @param    fn               Can be `NULL`. Called from `cf_fs_poll_async` once the file is on disk, see `CF_FileWriteFn`.
+ * @param    udata            Can be `NULL`. Handed back to you in `fn`.
+ * @return   Returns a `CF_FileRequest` for cancelling the write with `cf_fs_cancel_async`.
+ * @remarks  Works like `cf_fs_write_async`, but moves serialization off of the calling thread as well. Copy what needs saving into
+ *           `serialize_udata` on the main thread, which is cheap, and leave turning it into text or binary to `serialize`. See
+ *           `cf_json_save_async` for saving a `CF_JDoc` this way.
+ * @related  CF_FileRequest CF_FileSerializeFn CF_FileWriteFn cf_fs_write_async cf_fs_cancel_async cf_fs_poll_async
+ */
+CF_API CF_FileRequest CF_CALL cf_fs_write_async_serialized(const char* virtual_path, CF_FileSerializeFn* serialize, void* serialize_udata, bool compress, CF_FileWriteFn* fn, void* udata);
+
+/**
+ * @function cf_fs_is_compressed
+ * @category file
+ * @brief    Returns true if `data` is a file compressed by `cf_fs_write_async` or `cf_fs_write_async_serialized`.
+ * @param    data          The bytes of a file.
+ * @param    size          The size of `data` in bytes.
+ * @related  cf_fs_decompress cf_fs_write_async
+ */
+CF_API bool CF_CALL cf_fs_is_compressed(const void* data, size_t size);
+
+/**
+ * @function cf_fs_decompress
+ * @category file
+ * @brief    Decompresses a file written with `compress` set by `cf_fs_write_async` or `cf_fs_write_async_serialized`.
+ * @param    data          The bytes of the compressed file.
+ * @param    size          The size of `data` in bytes.
+ * @param    decompressed_size  Can be `NULL`. Set to the size of the decompressed file, not counting the nul byte.
+ * @return   Returns the decompressed file followed by a nul byte, or `NULL` if `data` isn't a valid compressed file. Call `cf_free` on it when done.
+ * @remarks  `cf_make_json_from_file` and `cf_make_json_readonly_from_file` decompress files for you.
+ * @related  cf_fs_is_compressed cf_fs_write_async
+ */
+CF_API void* CF_CALL cf_fs_decompress(const void* data, size_t size, size_t* decompressed_size);
+
+/**
+ * @function CF_FileChangedFn
+ * @category file
+ * @brief    A function pointer (callback) that reports a file changed on disk while watching mounted directories.
+ * @param    virtual_path  The virtual path of the file that changed, such as "/content/hero.ase".
+ * @param    udata         The `udata` passed to `cf_fs_watch_mounts`.
+ * @remarks  Called from `cf_fs_poll_changes`, on the thread that calls it. The file may have been deleted, so check with `cf_fs_stat` if it matters.
+ * @related  cf_fs_watch_mounts cf_fs_poll_changes
+ */
+typedef void (CF_FileChangedFn)(const char* virtual_path, void* udata);
+
+/**
+ * @function cf_fs_watch_mounts
+ * @category file
+ * @brief    Starts watching every mounted directory for changed files, for hot-reloading assets while the game runs.
+ * @param    fn            Can be `NULL`. Called once per changed file from `cf_fs_poll_changes`, see `CF_FileChangedFn`.
+ * @param    udata         Can be `NULL`. Handed back to you in `fn`.
+ * @return   Returns any errors as `CF_Result`, such as on platforms without a native file watcher.
+ * @remarks  Uses the OS's own change notifications (inotify, ReadDirectoryChangesW or FSEvents) rather than polling timestamps, so watching
+ *           large content folders costs nothing until a file actually changes. Directories mounted or dismounted later with `cf_fs_mount`
+ *           and `cf_fs_dismount` are picked up automatically, while archives such as .zip or .cfpk files are never watched. Editors often
+ *           save a file in several steps, so changes are debounced, see `cf_fs_set_watch_debounce`. Sprites made by `cf_make_sprite` and
+ *           images loaded by `cf_png_cache_load` are reloaded in place for you, as long as their dimensions and frame counts stay the same.
+ *           Fonts, audio and shaders are left to `fn`, since they can't be swapped under existing handles.
+ * @related  CF_FileChangedFn cf_fs_unwatch_mounts cf_fs_set_watch_debounce cf_fs_poll_changes
+ */
+CF_API CF_Result CF_CALL cf_fs_watch_mounts(CF_FileChangedFn* fn, void* udata);
+
+/**
+ * @function cf_fs_unwatch_mounts
+ * @category file
+ * @brief    Stops watching mounted directories, started by `cf_fs_watch_mounts`.
+ * @remarks  Changes not yet reported are dropped.
+ * @related  cf_fs_watch_mounts cf_fs_poll_changes
+ */
+CF_API void CF_CALL cf_fs_unwatch_mounts();
+
+/**
+ * @function cf_fs_set_watch_debounce
+ * @category file
+ * @brief    Sets how long a file must go unchanged before it's reported as changed.
+ * @param    seconds       Defaults to 0.1 seconds.
+ * @remarks  A file changing again before the delay is up restarts the delay, so a file saved in several steps reloads once, after the last step.
+ * @related  cf_fs_watch_mounts cf_fs_poll_changes
+ */
+CF_API void CF_CALL cf_fs_set_watch_debounce(float seconds);
+
+/**
+ * @function cf_fs_poll_changes
+ * @category file
+ * @brief    Reloads assets and runs the `CF_FileChangedFn` for files that changed on disk.
+ * @return   Returns the number of changed files reported.
+ * @remarks  `cf_app_update` calls this for you once per frame. Only call it yourself if you watch without a full application.
+ * @related  CF_FileChangedFn cf_fs_watch_mounts
+ */
+CF_API int CF_CALL cf_fs_poll_changes();
+
 /**
  * @function cf_fs_init
  * @category file
@@ -690,7 +1050,8 @@ CF_API CF_Result CF_CALL cf_fs_init(const char* argv0);
  * @brief    Destroys the [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
  * @param    argv0       The first command-line argument passed into your `main` function.
  * @remarks  Cleans up all static memory used by `cf_fs_init`. You probably don't need to call this function,
- *           as `cf_app_destroy` already does this for you.
+ *           as `cf_app_destroy` already does this for you. Pending `cf_fs_read_async` reads are dropped without running their callbacks,
+ *           while pending `cf_fs_write_async` writes are finished first.
  * @related  cf_fs_init cf_fs_destroy
  */
 CF_API void CF_CALL cf_fs_destroy();
@@ -709,6 +1070,11 @@ namespace Cute
 
 using Stat = CF_Stat;
 using File = CF_File;
+using FileRequest = CF_FileRequest;
+using FileReadFn = CF_FileReadFn;
+using FileWriteFn = CF_FileWriteFn;
+using FileSerializeFn = CF_FileSerializeFn;
+using FileChangedFn = CF_FileChangedFn;
 
 using FileType = CF_FileType;
 #define CF_ENUM(K, V) CF_INLINE constexpr FileType K = CF_##K;
@@ -725,6 +1091,21 @@ CF_INLINE const char* to_string(FileType type)
 	}
 }
 
+using FilePriority = CF_FilePriority;
+#define CF_ENUM(K, V) CF_INLINE constexpr FilePriority K = CF_##K;
+CF_FILE_PRIORITY_DEFS
+#undef CF_ENUM
+
+CF_INLINE const char* to_string(FilePriority priority)
+{
+	switch (priority) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_FILE_PRIORITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
 CF_INLINE const char* fs_get_base_directory() { return cf_fs_get_base_directory(); }
 CF_INLINE Result fs_set_write_directory(const char* platform_dependent_directory) { return cf_fs_set_write_directory(platform_dependent_directory); }
 CF_INLINE Result fs_mount(const char* archive, const char* mount_point, bool append_to_path = true) { return cf_fs_mount(archive, mount_point, append_to_path); }
@@ -749,9 +1130,25 @@ CF_INLINE size_t fs_size(File* file) { return cf_fs_size(file); }
 CF_INLINE void* fs_read_entire_file_to_memory(const char* virtual_path, size_t* size = NULL) { return cf_fs_read_entire_file_to_memory(virtual_path, size); }
 CF_INLINE char* fs_read_entire_file_to_memory_and_nul_terminate(const char* virtual_path, size_t* size = NULL) { return cf_fs_read_entire_file_to_memory_and_nul_terminate(virtual_path, size); }
 CF_INLINE Result fs_write_entire_buffer_to_file(const char* virtual_path, const void* data, size_t size) { return cf_fs_write_entire_buffer_to_file(virtual_path, data, size); }
+CF_INLINE Result fs_write_pack(const char* virtual_directory, const char* pack_virtual_path, bool compress = false) { return cf_fs_write_pack(virtual_directory, pack_virtual_path, compress); }
+CF_INLINE const void* fs_map_file(const char* virtual_path, size_t* size = NULL) { return cf_fs_map_file(virtual_path, size); }
+CF_INLINE void fs_unmap_file(const void* data) { cf_fs_unmap_file(data); }
 CF_INLINE const char* fs_get_backend_specific_error_message() { return cf_fs_get_backend_specific_error_message(); }
 CF_INLINE const char* fs_get_user_directory(const char* org, const char* app) { return cf_fs_get_user_directory(org, app); }
 CF_INLINE const char* fs_get_actual_path(const char* virtual_path) { return cf_fs_get_actual_path(virtual_path); }
+CF_INLINE FileRequest fs_read_async(const char* virtual_path, FilePriority priority, FileReadFn* fn, void* udata = NULL) { return cf_fs_read_async(virtual_path, priority, fn, udata); }
+CF_INLINE FileRequest fs_write_async(const char* virtual_path, const void* data, size_t size, bool compress = false, FileWriteFn* fn = NULL, void* udata = NULL) { return cf_fs_write_async(virtual_path, data, size, compress, fn, udata); }
+CF_INLINE FileRequest fs_write_async_serialized(const char* virtual_path, FileSerializeFn* serialize, void* serialize_udata, bool compress = false, FileWriteFn* fn = NULL, void* udata = NULL) { return cf_fs_write_async_serialized(virtual_path, serialize, serialize_udata, compress, fn, udata); }
+CF_INLINE bool fs_is_compressed(const void* data, size_t size) { return cf_fs_is_compressed(data, size); }
+CF_INLINE void* fs_decompress(const void* data, size_t size, size_t* decompressed_size = NULL) { return cf_fs_decompress(data, size, decompressed_size); }
+CF_INLINE bool fs_cancel_async(FileRequest request) { return cf_fs_cancel_async(request); }
+CF_INLINE int fs_poll_async(int max_count = 0) { return cf_fs_poll_async(max_count); }
+CF_INLINE int fs_async_pending_count() { return cf_fs_async_pending_count(); }
+CF_INLINE Result fs_watch_mounts(CF_FileChangedFn* fn, void* udata = NULL) { return cf_fs_watch_mounts(fn, udata); }
+CF_INLINE void fs_unwatch_mounts() { cf_fs_unwatch_mounts(); }
+CF_INLINE void fs_set_watch_debounce(float seconds) { cf_fs_set_watch_debounce(seconds); }
+CF_INLINE int fs_poll_changes() { return cf_fs_poll_changes(); }
+CF_INLINE void fs_set_index_enabled(bool enabled) { cf_fs_set_index_enabled(enabled); }
 
 struct Path
 {
@@ -766,6 +1163,8 @@ struct Path
 	CF_INLINE String filename() const { return String::steal_from(spfname(m_path)); }
 	CF_INLINE String filename_no_ext() const { return String::steal_from(spfname_no_ext(m_path)); }
 	CF_INLINE String ext() const { return String::steal_from(spext(m_path)); }
+	CF_INLINE const char* filename_view() const { return spfname_view(m_path); }
+	CF_INLINE const char* ext_view() const { return spext_view(m_path); }
 	CF_INLINE bool has_ext(const char* ext) const { return spext_equ(m_path, ext); }
 	CF_INLINE void pop() { sppop(m_path); }
 	CF_INLINE void pop(int n) { sppopn(m_path, n); }
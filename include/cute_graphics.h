@@ -45,7 +45,6 @@ extern "C" {
  *     - uint16_t indices (only uint32_t supported) *
  *     - Cube map
  *     - 3D textures
- *     - Texture arrays *
  *     - Sampler types signed/unsigned int (only float supported)
  *     - Other primitive types besides triangles
  *     - UV wrap border colors
@@ -172,6 +171,8 @@ typedef struct CF_Shader { uint64_t id; } CF_Shader;
 	CF_ENUM(BACKEND_TYPE_METAL_SIMULATOR, 5) \
 	/* @entry WebGPU (for browsers). */      \
 	CF_ENUM(BACKEND_TYPE_WGPU,            6) \
+	/* @entry No GPU at all, for builds made with the CMake option `CF_FRAMEWORK_NULL_GFX`. Resources, pipelines and draw calls are accepted and dropped, so the CPU side of drawing can be measured on machines without a GPU. */ \
+	CF_ENUM(BACKEND_TYPE_DUMMY,           7) \
 	/* @end */
 
 typedef enum CF_BackendType
@@ -447,6 +448,8 @@ CF_API bool CF_CALL cf_query_pixel_format(CF_PixelFormat format, CF_PixelFormatO
 #define CF_DEVICE_FEATURE_DEFS \
 	/* @entry Texture clamp addressing style, e.g. `CF_WRAP_MODE_CLAMP_TO_EDGE` or `CF_WRAP_MODE_CLAMP_TO_BORDER` . */ \
 	CF_ENUM(DEVICE_FEATURE_TEXTURE_CLAMP,    0)                                                                        \
+	/* @entry Textures with more than one layer, see `CF_TextureParams::layer_count`. */                                  \
+	CF_ENUM(DEVICE_FEATURE_TEXTURE_ARRAY,    1)                                                                        \
 	/* @end */
 
 typedef enum CF_DeviceFeature
@@ -490,6 +493,8 @@ CF_API bool CF_CALL cf_query_device_feature(CF_DeviceFeature feature);
 	CF_ENUM(RESOURCE_LIMIT_TEXTURE_DIMENSION,       0)                              \
 	/* @entry Limit on the number of vertex attributes. */                          \
 	CF_ENUM(RESOURCE_LIMIT_VERTEX_ATTRIBUTE_MAX,    1)                              \
+	/* @entry Limit on the number of layers of a texture array. */                  \
+	CF_ENUM(RESOURCE_LIMIT_TEXTURE_ARRAY_LAYERS,    2)                              \
 	/* @end */
 
 typedef enum CF_ResourceLimit
@@ -573,6 +578,8 @@ CF_INLINE const char* cf_usage_type_to_string(CF_UsageType type) {
 	CF_ENUM(FILTER_NEAREST, 0)                                               \
 	/* @entry Linear (bilinear) filtering. A good general purpose option. */ \
 	CF_ENUM(FILTER_LINEAR,  1)                                               \
+	/* @entry Linear filtering within and between mip levels. Textures without mips sample as `CF_FILTER_LINEAR`. */ \
+	CF_ENUM(FILTER_TRILINEAR, 2)                                             \
 	/* @end */
 
 typedef enum CF_Filter
@@ -668,6 +675,12 @@ typedef struct CF_TextureParams
 	/* @member Number of elements (usually pixels) along the height of the texture. */
 	int height;
 
+	/* @member Number of mip levels, 1 by default. Each level's data follows the previous one in `initial_data`, largest first. */
+	int mip_count;
+
+	/* @member Number of layers, 1 by default. More than one makes a texture array, sampled in shaders with `sampler2DArray`, see `CF_DEVICE_FEATURE_TEXTURE_ARRAY`. Within each mip level of `initial_data` every layer follows the previous one. */
+	int layer_count;
+
 	/* @member If true you can render to this texture via `CF_Canvas`. */
 	bool render_target;
 
@@ -697,6 +710,34 @@ CF_API CF_TextureParams CF_CALL cf_texture_defaults(int w, int h);
  */
 CF_API CF_Texture CF_CALL cf_make_texture(CF_TextureParams texture_params);
 
+/**
+ * @function cf_texture_data_size
+ * @category graphics
+ * @brief    Returns the number of bytes of one mip level of a texture in the given format.
+ * @param    format     The pixel format, including block compressed formats such as `CF_PIXELFORMAT_BC7_RGBA`.
+ * @param    w          Width of the mip level in pixels.
+ * @param    h          Height of the mip level in pixels.
+ * @remarks  Useful to fill in `initial_data_size` for `cf_make_texture`. Returns 0 for unknown formats.
+ * @related  CF_TextureParams cf_make_texture cf_load_texture
+ */
+CF_API int CF_CALL cf_texture_data_size(CF_PixelFormat format, int w, int h);
+
+/**
+ * @function cf_load_texture
+ * @category graphics
+ * @brief    Loads a pre-cooked texture from a DDS or KTX file, uploading its data to the GPU as-is.
+ * @param    virtual_path  Path to the file. [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @param    filter        The filtering to use when sampling the texture.
+ * @param    texture_out   The new texture is stored here on success. Free it with `cf_destroy_texture`.
+ * @param    params_out    Optional, pass NULL to ignore. The size, format and mip count read from the file.
+ * @remarks  This is the intended path for large images such as backgrounds in block compressed formats (BCn from DDS
+ *           or KTX, ETC2 and PVRTC from KTX), which take 4-8x less memory than RGBA8. All mip levels in the file are
+ *           loaded. Returns an error if the format isn't supported by the device, so check `cf_query_pixel_format` to
+ *           choose which cooked variant to ship to a platform.
+ * @related  CF_TextureParams cf_make_texture cf_texture_data_size cf_query_pixel_format
+ */
+CF_API CF_Result CF_CALL cf_load_texture(const char* virtual_path, CF_Filter filter, CF_Texture* texture_out, CF_TextureParams* params_out /*= NULL*/);
+
 /**
  * @function cf_destroy_texture
  * @category graphics
@@ -718,6 +759,106 @@ CF_API void CF_CALL cf_destroy_texture(CF_Texture texture);
  */
 CF_API void CF_CALL cf_update_texture(CF_Texture texture, void* data, int size);
 
+/**
+ * @struct   CF_TextureUpload
+ * @category graphics
+ * @brief    An opaque handle to texture data staged from any thread, see `cf_make_texture_async`.
+ * @remarks  Loader threads decode pixels and stage them, then the render thread creates and fills the textures inside
+ *           `cf_commit`, a budgeted number of bytes per frame (see `cf_set_texture_upload_budget`). This spreads large
+ *           loads across frames instead of stalling one of them.
+ *
+ *           ```cpp
+ *           // On a loader thread.
+ *           CF_TextureParams params = cf_texture_defaults(w, h);
+ *           params.initial_data = pixels;
+ *           params.initial_data_size = w * h * sizeof(CF_Pixel);
+ *           CF_TextureUpload upload = cf_make_texture_async(params);
+ *
+ *           // Later, on the main thread.
+ *           if (cf_texture_upload_ready(upload)) {
+ *               CF_Texture texture = cf_texture_upload_get_texture(upload);
+ *               cf_destroy_texture_upload(upload);
+ *           }
+ *           ```
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_texture_upload_ready cf_texture_upload_get_texture cf_destroy_texture_upload cf_set_texture_upload_budget
+ */
+typedef struct CF_TextureUpload { uint64_t id; } CF_TextureUpload;
+// @end
+
+/**
+ * @function cf_make_texture_async
+ * @category graphics
+ * @brief    Stages a new texture to be created by the render thread. Safe to call from any thread.
+ * @param    texture_params  The texture's parameters, see `cf_texture_defaults`.
+ * @return   Returns an upload to poll with `cf_texture_upload_ready`. Free it with `cf_destroy_texture_upload`.
+ * @remarks  `initial_data` is copied, so it may be freed as soon as this returns. The texture is made during a later
+ *           `cf_commit`. All GPU calls stay on the render thread, as every backend of sokol_gfx requires, including D3D11.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_texture_upload_ready cf_texture_upload_get_texture cf_destroy_texture_upload cf_set_texture_upload_budget
+ */
+CF_API CF_TextureUpload CF_CALL cf_make_texture_async(CF_TextureParams texture_params);
+
+/**
+ * @function cf_update_texture_async
+ * @category graphics
+ * @brief    Stages new contents for a `CF_Texture`, like `cf_update_texture`. Safe to call from any thread.
+ * @param    texture    The texture. It must not have been created with `CF_USAGE_TYPE_IMMUTABLE`.
+ * @param    data       The data to upload to the texture. It's copied, so it may be freed as soon as this returns.
+ * @param    size       The size in bytes of `data`.
+ * @return   Returns an upload to poll with `cf_texture_upload_ready`. Free it with `cf_destroy_texture_upload`.
+ * @remarks  Updates to the same texture are applied in order, at most one per frame. Don't also call `cf_update_texture`
+ *           on the texture while updates are staged, as a texture may only be updated once per frame.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_texture_upload_ready cf_texture_upload_get_texture cf_destroy_texture_upload cf_set_texture_upload_budget
+ */
+CF_API CF_TextureUpload CF_CALL cf_update_texture_async(CF_Texture texture, const void* data, int size);
+
+/**
+ * @function cf_texture_upload_ready
+ * @category graphics
+ * @brief    Returns true once a staged upload has reached the GPU. Never blocks, and is safe to call from any thread.
+ * @param    upload     The upload from `cf_make_texture_async` or `cf_update_texture_async`.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_texture_upload_ready cf_texture_upload_get_texture cf_destroy_texture_upload
+ */
+CF_API bool CF_CALL cf_texture_upload_ready(CF_TextureUpload upload);
+
+/**
+ * @function cf_texture_upload_get_texture
+ * @category graphics
+ * @brief    Returns the texture of an upload, or an invalid texture (id of zero) if it isn't ready yet.
+ * @param    upload     The upload from `cf_make_texture_async` or `cf_update_texture_async`.
+ * @remarks  For `cf_make_texture_async` the texture belongs to you once it's ready, free it with `cf_destroy_texture`.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_texture_upload_ready cf_texture_upload_get_texture cf_destroy_texture_upload
+ */
+CF_API CF_Texture CF_CALL cf_texture_upload_get_texture(CF_TextureUpload upload);
+
+/**
+ * @function cf_destroy_texture_upload
+ * @category graphics
+ * @brief    Frees an upload handle. Safe to call from any thread, and before the upload is ready.
+ * @param    upload     The upload from `cf_make_texture_async` or `cf_update_texture_async`.
+ * @remarks  A pending upload is dropped. Destroying the upload of a ready `cf_make_texture_async` leaves its texture alive.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_texture_upload_ready cf_destroy_texture_upload
+ */
+CF_API void CF_CALL cf_destroy_texture_upload(CF_TextureUpload upload);
+
+/**
+ * @function cf_set_texture_upload_budget
+ * @category graphics
+ * @brief    Sets how many bytes of staged texture data the render thread uploads each frame. The default is 4 MB.
+ * @param    bytes_per_frame  The budget. Zero or less uploads everything that's staged every frame.
+ * @remarks  At least one upload happens each frame, so uploads larger than the budget still go through.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_flush_texture_uploads
+ */
+CF_API void CF_CALL cf_set_texture_upload_budget(int bytes_per_frame);
+
+/**
+ * @function cf_flush_texture_uploads
+ * @category graphics
+ * @brief    Uploads everything staged right now, ignoring the budget. Call it from the render thread, e.g. behind a loading screen.
+ * @remarks  Staged updates beyond the first to any one texture still wait for later frames.
+ * @related  CF_TextureUpload cf_make_texture_async cf_update_texture_async cf_set_texture_upload_budget
+ */
+CF_API void CF_CALL cf_flush_texture_uploads();
+
 //--------------------------------------------------------------------------------------------------
 // Shader.
 
@@ -835,6 +976,22 @@ CF_API CF_Shader CF_CALL cf_make_shader(CF_SokolShader sokol_shader);
  */
 CF_API void CF_CALL cf_destroy_shader(CF_Shader shader);
 
+/**
+ * @function cf_set_shader_cache_directory
+ * @category graphics
+ * @brief    Keeps compiled shaders on disk, so they are only compiled the first time the game runs.
+ * @param    virtual_path  A directory within the write directory, see `cf_fs_set_write_directory`, such as "/shader_cache". Pass NULL to
+ *                         stop using the cache, which is the default.
+ * @remarks  Affects shaders made after this call, so call it right after `cf_make_app` and `cf_fs_set_write_directory`. The draw
+ *           API's built-in shaders are made by `cf_make_app` and aren't cached. Files are named after a hash of each shader's source,
+ *           so stale files are simply never read again.
+ *
+ *           Only D3D11 compiles shaders from source inside Cute Framework, so that's the only backend using the cache. GL drivers and
+ *           Metal keep their own caches of compiled programs. For the first-use cost of pipelines on every backend see `cf_prewarm_pipeline`.
+ * @related  CF_Shader cf_make_shader cf_prewarm_pipeline cf_fs_set_write_directory
+ */
+CF_API void CF_CALL cf_set_shader_cache_directory(const char* virtual_path);
+
 //--------------------------------------------------------------------------------------------------
 // Render Canvases.
 
@@ -885,6 +1042,30 @@ CF_API CF_Canvas CF_CALL cf_make_canvas(CF_CanvasParams canvas_params);
  */
 CF_API void CF_CALL cf_destroy_canvas(CF_Canvas canvas);
 
+/**
+ * @function cf_acquire_transient_canvas
+ * @category graphics
+ * @brief    Returns a pooled `CF_Canvas` for intermediate rendering, valid until the end of the current frame.
+ * @param    canvas_params  The texture settings of the canvas, see `cf_canvas_defaults`. `initial_data` is ignored.
+ * @remarks  Intended for effects such as post-processing that need scratch canvases every frame. Canvases are recycled
+ *           by matching texture settings (size, formats, filter, wrap modes), so steady-state frames allocate nothing,
+ *           and canvases unused for a few frames are freed -- e.g. after the window is resized. The contents of a
+ *           recycled canvas are undefined, so apply it with `clear` set to true. Never call `cf_destroy_canvas` on it.
+ * @related  cf_acquire_transient_canvas cf_release_transient_canvas cf_make_canvas cf_canvas_defaults
+ */
+CF_API CF_Canvas CF_CALL cf_acquire_transient_canvas(CF_CanvasParams canvas_params);
+
+/**
+ * @function cf_release_transient_canvas
+ * @category graphics
+ * @brief    Returns a canvas from `cf_acquire_transient_canvas` to the pool before the end of the frame.
+ * @param    canvas     The canvas to release.
+ * @remarks  Optional, as all transient canvases are released when the frame ends. Releasing a canvas as soon as its
+ *           last use has been rendered lets later acquires within the same frame reuse its memory.
+ * @related  cf_acquire_transient_canvas cf_release_transient_canvas cf_make_canvas cf_canvas_defaults
+ */
+CF_API void CF_CALL cf_release_transient_canvas(CF_Canvas canvas);
+
 /**
  * @function cf_canvas_get_target
  * @category graphics
@@ -936,6 +1117,61 @@ CF_API uint64_t CF_CALL cf_canvas_get_backend_depth_stencil_handle(CF_Canvas can
  */
 CF_API void CF_CALL cf_canvas_blit(CF_Canvas src, CF_V2 u0, CF_V2 v0, CF_Canvas dst, CF_V2 u1, CF_V2 v1);
 
+/**
+ * @struct   CF_Readback
+ * @category graphics
+ * @brief    An opaque handle to pixels on their way back from the GPU, see `cf_canvas_readback_async`.
+ * @related  CF_Readback cf_canvas_readback_async cf_readback_ready cf_readback_pixels cf_destroy_readback
+ */
+typedef struct CF_Readback { uint64_t id; } CF_Readback;
+// @end
+
+/**
+ * @function cf_canvas_readback_async
+ * @category graphics
+ * @brief    Starts copying a rectangle of a canvas back to the CPU, without waiting on the GPU.
+ * @param    canvas     The canvas to read from.
+ * @param    rect       The rectangle to read in pixels, where (0, 0) is the top-left of the canvas. It's clipped to the canvas.
+ * @return   Returns a readback to poll with `cf_readback_ready`, or an invalid readback (id of zero) if the backend
+ *           or the canvas's pixel format don't support asynchronous readback.
+ * @remarks  The copy is issued into a staging buffer at the end of the frame, so it captures the canvas as it looks
+ *           when the frame is committed. The canvas must stay alive until then. Pixels usually arrive a frame or two
+ *           later, once the GPU has caught up. Supported on D3D11, Metal and GL 3.3 with RGBA8 or BGRA8 canvases.
+ *           Free the readback with `cf_destroy_readback`.
+ * @related  CF_Readback cf_canvas_readback_async cf_readback_ready cf_readback_pixels cf_destroy_readback
+ */
+CF_API CF_Readback CF_CALL cf_canvas_readback_async(CF_Canvas canvas, CF_Rect rect);
+
+/**
+ * @function cf_readback_ready
+ * @category graphics
+ * @brief    Returns true once the pixels of a readback have arrived. Never blocks.
+ * @param    readback   The readback from `cf_canvas_readback_async`.
+ * @related  CF_Readback cf_canvas_readback_async cf_readback_ready cf_readback_pixels cf_destroy_readback
+ */
+CF_API bool CF_CALL cf_readback_ready(CF_Readback readback);
+
+/**
+ * @function cf_readback_pixels
+ * @category graphics
+ * @brief    Returns the pixels of a readback, or NULL if they haven't arrived yet.
+ * @param    readback   The readback from `cf_canvas_readback_async`.
+ * @param    w          Optional, the width of the clipped rectangle.
+ * @param    h          Optional, the height of the clipped rectangle.
+ * @remarks  Pixels are RGBA8, top row first. They're owned by the readback and freed with `cf_destroy_readback`.
+ * @related  CF_Readback cf_canvas_readback_async cf_readback_ready cf_readback_pixels cf_destroy_readback
+ */
+CF_API const CF_Pixel* CF_CALL cf_readback_pixels(CF_Readback readback, int* w, int* h);
+
+/**
+ * @function cf_destroy_readback
+ * @category graphics
+ * @brief    Frees a readback and its staging buffer. Safe to call before the pixels arrive.
+ * @param    readback   The readback from `cf_canvas_readback_async`.
+ * @related  CF_Readback cf_canvas_readback_async cf_readback_ready cf_readback_pixels cf_destroy_readback
+ */
+CF_API void CF_CALL cf_destroy_readback(CF_Readback readback);
+
 //--------------------------------------------------------------------------------------------------
 // Mesh.
 
@@ -1114,7 +1350,8 @@ CF_API void CF_CALL cf_mesh_update_vertex_data(CF_Mesh mesh, void* data, int cou
  *           to call this function more than once. This function can be called multiple times per frame. The
  *           intended use-case is to stream bits of data to the GPU and issue a `cf_draw_elements` call. The
  *           only elements that will be drawn are the elements from the last call to `cf_mesh_append_index_data`,
- *           all previously appended data will remain untouched.
+ *           all previously appended data will remain untouched. If the data doesn't fit in the remaining space for
+ *           this frame the internal buffer is replaced by one at least twice as large.
  * @related  CF_Mesh cf_make_mesh cf_destroy_mesh cf_mesh_set_attributes cf_mesh_update_vertex_data cf_mesh_update_instance_data cf_mesh_update_index_data
  */
 CF_API int CF_CALL cf_mesh_append_vertex_data(CF_Mesh mesh, void* data, int count);
@@ -1125,10 +1362,8 @@ CF_API int CF_CALL cf_mesh_append_vertex_data(CF_Mesh mesh, void* data, int coun
  * @brief    Returns true if a number of bytes to append would overflow the internal vertex buffer.
  * @param    mesh          The mesh.
  * @param    append_count  A number of bytes to append.
- * @remarks  Use this when streaming data to the GPU to make sure the internal streaming buffers are not overrun.
- *           You specified this size when creating the mesh. Use this function to understand if you're sending
- *           too much to the GPU all at once. You might need to send less data or increase the size of your mesh's
- *           internal buffers.
+ * @remarks  Appending never drops data, as the internal streaming buffers grow on demand. Use this function to avoid
+ *           the cost of growing mid-frame, e.g. by picking a larger initial size in `cf_make_mesh`. See `cf_mesh_query_stats`.
  * @related  CF_Mesh cf_make_mesh cf_destroy_mesh cf_mesh_set_attributes cf_mesh_update_vertex_data cf_mesh_update_instance_data cf_mesh_update_index_data
  */
 CF_API bool CF_CALL cf_mesh_will_overflow_vertex_data(CF_Mesh mesh, int append_count);
@@ -1159,7 +1394,8 @@ CF_API void CF_CALL cf_mesh_update_instance_data(CF_Mesh mesh, void* data, int c
  *           to call this function more than once. This function can be called multiple times per frame. The
  *           intended use-case is to stream bits of data to the GPU and issue a `cf_draw_elements` call. The
  *           only elements that will be drawn are the elements from the last call to `cf_mesh_append_index_data`,
- *           all previously appended data will remain untouched.
+ *           all previously appended data will remain untouched. If the data doesn't fit in the remaining space for
+ *           this frame the internal buffer is replaced by one at least twice as large.
  * @related  CF_Mesh cf_make_mesh cf_destroy_mesh cf_mesh_set_attributes cf_mesh_update_vertex_data cf_mesh_update_instance_data cf_mesh_update_index_data
  */
 CF_API int CF_CALL cf_mesh_append_instance_data(CF_Mesh mesh, void* data, int count);
@@ -1170,10 +1406,8 @@ CF_API int CF_CALL cf_mesh_append_instance_data(CF_Mesh mesh, void* data, int co
  * @brief    Returns true if a number of bytes to append would overflow the internal vertex buffer.
  * @param    mesh          The mesh.
  * @param    append_count  A number of bytes to append.
- * @remarks  Use this when streaming data to the GPU to make sure the internal streaming buffers are not overrun.
- *           You specified this size when creating the mesh. Use this function to understand if you're sending
- *           too much to the GPU all at once. You might need to send less data or increase the size of your mesh's
- *           internal buffers.
+ * @remarks  Appending never drops data, as the internal streaming buffers grow on demand. Use this function to avoid
+ *           the cost of growing mid-frame, e.g. by picking a larger initial size in `cf_make_mesh`. See `cf_mesh_query_stats`.
  * @related  CF_Mesh cf_make_mesh cf_destroy_mesh cf_mesh_set_attributes cf_mesh_update_vertex_data cf_mesh_update_instance_data cf_mesh_update_index_data
  */
 CF_API bool CF_CALL cf_mesh_will_overflow_instance_data(CF_Mesh mesh, int append_count);
@@ -1204,7 +1438,8 @@ CF_API void CF_CALL cf_mesh_update_index_data(CF_Mesh mesh, uint32_t* indices, i
  *           to call this function more than once. This function can be called multiple times per frame. The
  *           intended use-case is to stream bits of data to the GPU and issue a `cf_draw_elements` call. The
  *           only elements that will be drawn are the elements from the last call to `cf_mesh_append_index_data`,
- *           all previously appended data will remain untouched.
+ *           all previously appended data will remain untouched. If the data doesn't fit in the remaining space for
+ *           this frame the internal buffer is replaced by one at least twice as large.
  * @related  CF_Mesh cf_make_mesh cf_destroy_mesh cf_mesh_set_attributes cf_mesh_update_vertex_data cf_mesh_update_instance_data cf_mesh_update_index_data
  */
 CF_API int CF_CALL cf_mesh_append_index_data(CF_Mesh mesh, uint32_t* indices, int count);
@@ -1215,14 +1450,56 @@ CF_API int CF_CALL cf_mesh_append_index_data(CF_Mesh mesh, uint32_t* indices, in
  * @brief    Returns true if a number of bytes to append would overflow the internal index buffer.
  * @param    mesh          The mesh.
  * @param    append_count  A number of bytes to append.
- * @remarks  Use this when streaming data to the GPU to make sure the internal streaming buffers are not overrun.
- *           You specified this size when creating the mesh. Use this function to understand if you're sending
- *           too much to the GPU all at once. You might need to send less data or increase the size of your mesh's
- *           internal buffers.
+ * @remarks  Appending never drops data, as the internal streaming buffers grow on demand. Use this function to avoid
+ *           the cost of growing mid-frame, e.g. by picking a larger initial size in `cf_make_mesh`. See `cf_mesh_query_stats`.
  * @related  CF_Mesh cf_make_mesh cf_destroy_mesh cf_mesh_set_attributes cf_mesh_update_vertex_data cf_mesh_update_instance_data cf_mesh_update_index_data
  */
 CF_API bool CF_CALL cf_mesh_will_overflow_index_data(CF_Mesh mesh, int append_count);
 
+/**
+ * @struct   CF_MeshStats
+ * @category graphics
+ * @brief    Sizes of a mesh's internal buffers, and how much of them gets used.
+ * @remarks  High-water marks are lifetime maxima: the most bytes appended to a buffer within any single frame since the
+ *           mesh was created. They are never reset, so they reflect the worst frame seen so far rather than the current one.
+ * @related  CF_Mesh cf_mesh_query_stats cf_make_mesh
+ */
+typedef struct CF_MeshStats
+{
+	/* @member Current size of the vertex buffer in bytes. */
+	int vertex_capacity;
+
+	/* @member Most bytes of vertex data appended within any single frame over the mesh's lifetime. */
+	int vertex_high_water;
+
+	/* @member Current size of the index buffer in bytes. */
+	int index_capacity;
+
+	/* @member Most bytes of index data appended within any single frame over the mesh's lifetime. */
+	int index_high_water;
+
+	/* @member Current size of the instance buffer in bytes. */
+	int instance_capacity;
+
+	/* @member Most bytes of instance data appended within any single frame over the mesh's lifetime. */
+	int instance_high_water;
+
+	/* @member Number of times any of the buffers had to grow to fit appended data. */
+	int grow_count;
+} CF_MeshStats;
+// @end
+
+/**
+ * @function cf_mesh_query_stats
+ * @category graphics
+ * @brief    Returns buffer sizes and high-water marks for a mesh.
+ * @param    mesh       The mesh.
+ * @remarks  Useful for picking initial buffer sizes in `cf_make_mesh` so streaming meshes never have to grow. High-water
+ *           marks are lifetime maxima and are not reset per frame, see `CF_MeshStats`.
+ * @related  CF_Mesh CF_MeshStats cf_make_mesh cf_mesh_append_vertex_data cf_mesh_append_index_data cf_mesh_append_instance_data
+ */
+CF_API CF_MeshStats CF_CALL cf_mesh_query_stats(CF_Mesh mesh);
+
 //--------------------------------------------------------------------------------------------------
 // Render state.
 
@@ -1903,7 +2180,8 @@ CF_API void CF_CALL cf_apply_shader(CF_Shader shader, CF_Material material);
  * @brief    Draws all elements within the last applied mesh.
  * @remarks  If the mesh is a static mesh with usage `CF_USAGE_TYPE_IMMUTABLE` the number of elements drawn will always be consistent with the mesh's
  *           initial data. For `USAGE_TYPE_DYNAMIC` and `CF_USAGE_TYPE_STREAM` the number of elements will always match the previous call to
- *           `cf_mesh_update_***` or `cf_mesh_append_***`.
+ *           `cf_mesh_update_***` or `cf_mesh_append_***`. Meshes created with an index buffer draw by index count. Meshes created
+ *           with an instance buffer draw one instance per element of instance data, otherwise a single instance is drawn.
  * @related  CF_Mesh cf_create_mesh cf_apply_shader cf_apply_canvas
  */
 CF_API void CF_CALL cf_draw_elements();
@@ -1918,6 +2196,203 @@ CF_API void CF_CALL cf_draw_elements();
  */
 CF_API void CF_CALL cf_unapply_canvas();
 
+/**
+ * @struct   CF_PipelineCacheStats
+ * @category graphics
+ * @brief    Counters describing how well the internal pipeline cache is performing.
+ * @remarks  Every unique combination of shader, vertex layout, `CF_RenderState` and canvas pixel format requires a GPU pipeline
+ *           object. Creating these is expensive, so they're cached and reused across frames. In a steady-state frame `misses`
+ *           should not increase at all.
+ * @related  CF_PipelineCacheStats cf_query_pipeline_cache_stats cf_reset_pipeline_cache_stats cf_set_pipeline_cache_capacity
+ */
+typedef struct CF_PipelineCacheStats
+{
+	/* @member Number of times `cf_apply_shader` found an existing pipeline. */
+	int hits;
+
+	/* @member Number of times `cf_apply_shader` had to create a new pipeline. */
+	int misses;
+
+	/* @member Number of pipelines destroyed to make room, or because their shader was destroyed. */
+	int evictions;
+
+	/* @member Number of pipelines currently held in the cache. */
+	int count;
+} CF_PipelineCacheStats;
+// @end
+
+/**
+ * @function cf_query_pipeline_cache_stats
+ * @category graphics
+ * @brief    Returns counters for the internal pipeline cache.
+ * @remarks  Counters accumulate until `cf_reset_pipeline_cache_stats` is called. A good way to check for pipeline churn is to reset
+ *           the stats at the start of a frame, then check `misses` is zero at the end of the frame.
+ * @related  CF_PipelineCacheStats cf_query_pipeline_cache_stats cf_reset_pipeline_cache_stats cf_set_pipeline_cache_capacity
+ */
+CF_API CF_PipelineCacheStats CF_CALL cf_query_pipeline_cache_stats();
+
+/**
+ * @function cf_reset_pipeline_cache_stats
+ * @category graphics
+ * @brief    Resets the hit/miss/eviction counters of the internal pipeline cache back to zero.
+ * @related  CF_PipelineCacheStats cf_query_pipeline_cache_stats cf_reset_pipeline_cache_stats cf_set_pipeline_cache_capacity
+ */
+CF_API void CF_CALL cf_reset_pipeline_cache_stats();
+
+/**
+ * @function cf_set_pipeline_cache_capacity
+ * @category graphics
+ * @brief    Sets the maximum number of pipelines kept alive by the internal pipeline cache.
+ * @param    capacity   The max number of cached pipelines. Defaults to 32.
+ * @remarks  When the cache is full the least recently used pipeline is destroyed. The underlying graphics backend has a fixed
+ *           pool of pipeline objects (64 by default), so keep this well below that limit.
+ * @related  CF_PipelineCacheStats cf_query_pipeline_cache_stats cf_reset_pipeline_cache_stats cf_set_pipeline_cache_capacity
+ */
+CF_API void CF_CALL cf_set_pipeline_cache_capacity(int capacity);
+
+/**
+ * @function cf_prewarm_pipeline
+ * @category graphics
+ * @brief    Creates the pipeline `cf_apply_shader` would need to draw `mesh` onto `canvas`, without drawing anything.
+ * @param    canvas     The canvas to be drawn onto. Only its pixel format matters.
+ * @param    mesh       The mesh to be drawn. Only its vertex layout matters.
+ * @param    shader     The shader to draw with.
+ * @param    material   The material to draw with. Only its render state matters.
+ * @remarks  Creating a pipeline the first time a combination of shader, vertex layout and render state shows up can hitch, more
+ *           so on D3D11 and Metal. Call this during loading for each combination your game uses. Pipelines are kept by the same cache
+ *           `cf_apply_shader` uses, so raise `cf_set_pipeline_cache_capacity` if you prewarm more than it holds. For the draw API see
+ *           `cf_draw_prewarm`.
+ * @related  CF_PipelineCacheStats cf_set_pipeline_cache_capacity cf_apply_shader cf_set_shader_cache_directory
+ */
+CF_API void CF_CALL cf_prewarm_pipeline(CF_Canvas canvas, CF_Mesh mesh, CF_Shader shader, CF_Material material);
+
+/**
+ * @struct   CF_RenderStats
+ * @category graphics
+ * @brief    Per-frame counters for draw calls and GPU state changes.
+ * @remarks  Applying a pipeline, viewport or scissor identical to the one already applied within the current canvas pass is skipped,
+ *           and counted in `skipped_applies`. Likewise, uniform blocks of a material are only sent when their contents changed,
+ *           counted in `skipped_uniform_uploads`. See `cf_query_render_stats`.
+ * @related  CF_RenderStats cf_query_render_stats cf_apply_shader cf_apply_viewport cf_apply_scissor
+ */
+typedef struct CF_RenderStats
+{
+	/* @member Number of calls to `cf_draw_elements`. */
+	int draw_calls;
+
+	/* @member Number of pipeline, viewport and scissor changes actually sent to the GPU. */
+	int state_changes;
+
+	/* @member Number of pipeline, viewport and scissor applies skipped since they matched the current state. */
+	int skipped_applies;
+
+	/* @member Number of uniform blocks sent to the GPU. */
+	int uniform_uploads;
+
+	/* @member Number of uniform blocks not re-sent since the GPU already had their current contents. */
+	int skipped_uniform_uploads;
+
+	/* @member Number of vertices sent to the GPU by `cf_mesh_update_vertex_data` and `cf_mesh_append_vertex_data`. */
+	int vertices_uploaded;
+} CF_RenderStats;
+// @end
+
+/**
+ * @function cf_query_render_stats
+ * @category graphics
+ * @brief    Returns `CF_RenderStats` for the most recently completed frame.
+ * @related  CF_RenderStats cf_query_render_stats cf_app_draw_onto_screen
+ */
+CF_API CF_RenderStats CF_CALL cf_query_render_stats();
+
+/**
+ * @struct   CF_GpuTiming
+ * @category graphics
+ * @brief    GPU time spent within one labeled scope of a frame.
+ * @remarks  See `cf_gpu_timer_push` and `cf_query_gpu_timings`.
+ * @related  CF_GpuTiming CF_GpuTimings cf_gpu_timer_push cf_gpu_timer_pop cf_query_gpu_timings
+ */
+typedef struct CF_GpuTiming
+{
+	/* @member The label passed to `cf_gpu_timer_push`, or "frame" for the root scope spanning the whole frame. */
+	const char* label;
+
+	/* @member Nesting depth of this scope, where the root "frame" scope is 0. */
+	int depth;
+
+	/* @member GPU time between the push and pop of this scope, in milliseconds. */
+	float milliseconds;
+} CF_GpuTiming;
+// @end
+
+/**
+ * @struct   CF_GpuTimings
+ * @category graphics
+ * @brief    All `CF_GpuTiming` scopes of the most recently resolved frame.
+ * @related  CF_GpuTiming CF_GpuTimings cf_gpu_timer_push cf_gpu_timer_pop cf_query_gpu_timings
+ */
+typedef struct CF_GpuTimings
+{
+	/* @member Number of elements in `timings`. */
+	int count;
+
+	/* @member Scopes in the order they were pushed, parents before their children. */
+	const CF_GpuTiming* timings;
+
+	/* @member The frame these timings were recorded on. Typically a few frames behind the current one. */
+	uint64_t frame;
+} CF_GpuTimings;
+// @end
+
+/**
+ * @function cf_gpu_timing_enable
+ * @category graphics
+ * @brief    Turns GPU timestamp queries on or off. Off by default.
+ * @param    enable     True to record GPU timings.
+ * @remarks  Takes effect at the start of the next frame. Does nothing if `cf_gpu_timing_supported` returns false.
+ * @related  CF_GpuTimings cf_gpu_timing_enable cf_gpu_timing_supported cf_gpu_timer_push cf_query_gpu_timings
+ */
+CF_API void CF_CALL cf_gpu_timing_enable(bool enable);
+
+/**
+ * @function cf_gpu_timing_supported
+ * @category graphics
+ * @brief    Returns true if the graphics backend supports GPU timestamp queries.
+ * @remarks  Supported on D3D11 and OpenGL 3.3. Not yet supported on Metal or GLES3.
+ * @related  CF_GpuTimings cf_gpu_timing_enable cf_gpu_timing_supported cf_gpu_timer_push cf_query_gpu_timings
+ */
+CF_API bool CF_CALL cf_gpu_timing_supported();
+
+/**
+ * @function cf_gpu_timer_push
+ * @category graphics
+ * @brief    Begins a labeled scope measuring GPU time until the matching `cf_gpu_timer_pop`.
+ * @param    label      A name for this scope, reported in `CF_GpuTiming::label`.
+ * @remarks  Scopes may nest and may span canvases, e.g. wrap a few `cf_render_to` calls to time a whole pass. Each
+ *           `cf_render_to` is automatically timed as a scope labeled "cf_render_to". Scopes still open at the end
+ *           of the frame are closed automatically.
+ * @related  CF_GpuTimings cf_gpu_timing_enable cf_gpu_timer_push cf_gpu_timer_pop cf_query_gpu_timings
+ */
+CF_API void CF_CALL cf_gpu_timer_push(const char* label);
+
+/**
+ * @function cf_gpu_timer_pop
+ * @category graphics
+ * @brief    Ends the scope begun by the most recent `cf_gpu_timer_push`.
+ * @related  CF_GpuTimings cf_gpu_timing_enable cf_gpu_timer_push cf_gpu_timer_pop cf_query_gpu_timings
+ */
+CF_API void CF_CALL cf_gpu_timer_pop();
+
+/**
+ * @function cf_query_gpu_timings
+ * @category graphics
+ * @brief    Returns the GPU timings of the most recent frame the GPU has finished.
+ * @remarks  Results are read back without stalling, so they arrive a few frames late; check `CF_GpuTimings::frame`.
+ *           The returned pointer is valid until the next call to `cf_app_draw_onto_screen`.
+ * @related  CF_GpuTimings cf_gpu_timing_enable cf_gpu_timer_push cf_gpu_timer_pop cf_query_gpu_timings
+ */
+CF_API CF_GpuTimings CF_CALL cf_query_gpu_timings();
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -1932,10 +2407,12 @@ namespace Cute
 
 using Texture  = CF_Texture;
 using Canvas = CF_Canvas;
+using Readback = CF_Readback;
 using Mesh = CF_Mesh;
 using Material = CF_Material;
 using Shader = CF_Shader;
 using TextureParams = CF_TextureParams;
+using TextureUpload = CF_TextureUpload;
 using SokolShader = CF_SokolShader;
 using CanvasParams = CF_CanvasParams;
 using VertexAttribute = CF_VertexAttribute;
@@ -1944,6 +2421,11 @@ using StencilParams = CF_StencilParams;
 using BlendState = CF_BlendState;
 using RenderState = CF_RenderState;
 using BackendType = CF_BackendType;
+using PipelineCacheStats = CF_PipelineCacheStats;
+using MeshStats = CF_MeshStats;
+using RenderStats = CF_RenderStats;
+using GpuTiming = CF_GpuTiming;
+using GpuTimings = CF_GpuTimings;
 
 using BackendType = CF_BackendType;
 #define CF_ENUM(K, V) CF_INLINE constexpr CF_BackendType K = CF_##K;
@@ -2159,18 +2641,34 @@ CF_INLINE bool query_device_feature(DeviceFeature feature) { return cf_query_dev
 CF_INLINE int query_resource_limit(ResourceLimit resource_limit) { return cf_query_resource_limit(resource_limit); }
 CF_INLINE TextureParams texture_defaults(int w, int h) { return cf_texture_defaults(w, h); }
 CF_INLINE Texture make_texture(TextureParams texture_params) { return cf_make_texture(texture_params); }
+CF_INLINE int texture_data_size(PixelFormat format, int w, int h) { return cf_texture_data_size(format, w, h); }
+CF_INLINE Result load_texture(const char* virtual_path, Filter filter, Texture* texture_out, TextureParams* params_out = NULL) { return cf_load_texture(virtual_path, filter, texture_out, params_out); }
 CF_INLINE void destroy_texture(Texture texture) { cf_destroy_texture(texture); }
 CF_INLINE void update_texture(Texture texture, void* data, int size) { cf_update_texture(texture, data, size); }
+CF_INLINE TextureUpload make_texture_async(TextureParams texture_params) { return cf_make_texture_async(texture_params); }
+CF_INLINE TextureUpload update_texture_async(Texture texture, const void* data, int size) { return cf_update_texture_async(texture, data, size); }
+CF_INLINE bool texture_upload_ready(TextureUpload upload) { return cf_texture_upload_ready(upload); }
+CF_INLINE Texture texture_upload_get_texture(TextureUpload upload) { return cf_texture_upload_get_texture(upload); }
+CF_INLINE void destroy_texture_upload(TextureUpload upload) { cf_destroy_texture_upload(upload); }
+CF_INLINE void set_texture_upload_budget(int bytes_per_frame) { cf_set_texture_upload_budget(bytes_per_frame); }
+CF_INLINE void flush_texture_uploads() { cf_flush_texture_uploads(); }
 CF_INLINE Shader make_shader(SokolShader sokol_shader) { return cf_make_shader(sokol_shader); }
 CF_INLINE void destroy_shader(Shader shader) { cf_destroy_shader(shader); }
+CF_INLINE void set_shader_cache_directory(const char* virtual_path) { cf_set_shader_cache_directory(virtual_path); }
 CF_INLINE CanvasParams canvas_defaults(int w, int h) { return cf_canvas_defaults(w, h); }
 CF_INLINE Canvas make_canvas(CanvasParams pass_params) { return cf_make_canvas(pass_params); }
 CF_INLINE void destroy_canvas(Canvas canvas) { cf_destroy_canvas(canvas); }
+CF_INLINE Canvas acquire_transient_canvas(CanvasParams params) { return cf_acquire_transient_canvas(params); }
+CF_INLINE void release_transient_canvas(Canvas canvas) { cf_release_transient_canvas(canvas); }
 CF_INLINE Texture canvas_get_target(Canvas canvas) { return cf_canvas_get_target(canvas); }
 CF_INLINE Texture canvas_get_depth_stencil_target(Canvas canvas) { return cf_canvas_get_depth_stencil_target(canvas); }
 CF_INLINE uint64_t canvas_get_backend_target_handle(Canvas canvas) { return cf_canvas_get_backend_target_handle(canvas); }
 CF_INLINE uint64_t canvas_get_backend_depth_stencil_handle(Canvas canvas) { return cf_canvas_get_backend_depth_stencil_handle(canvas); }
 CF_INLINE void canvas_blit(Canvas src, v2 u0, v2 v0, Canvas dst, v2 u1, v2 v1) { cf_canvas_blit(src, u0, v0, dst, u1, v1); }
+CF_INLINE Readback canvas_readback_async(Canvas canvas, Rect rect) { return cf_canvas_readback_async(canvas, rect); }
+CF_INLINE bool readback_ready(Readback readback) { return cf_readback_ready(readback); }
+CF_INLINE const Pixel* readback_pixels(Readback readback, int* w = NULL, int* h = NULL) { return cf_readback_pixels(readback, w, h); }
+CF_INLINE void destroy_readback(Readback readback) { cf_destroy_readback(readback); }
 CF_INLINE Mesh make_mesh(UsageType usage_type, int vertex_buffer_size, int index_buffer_size, int instance_buffer_size) { return cf_make_mesh(usage_type, vertex_buffer_size, index_buffer_size, instance_buffer_size); }
 CF_INLINE void destroy_mesh(Mesh mesh) { cf_destroy_mesh(mesh); }
 CF_INLINE void mesh_set_attributes(Mesh mesh, const VertexAttribute* attributes, int attribute_count, int vertex_stride, int instance_stride) { cf_mesh_set_attributes(mesh, attributes, attribute_count, vertex_stride, instance_stride); }
@@ -2183,6 +2681,7 @@ CF_INLINE bool mesh_will_overflow_instance_data(Mesh mesh, int append_count) { r
 CF_INLINE void mesh_update_index_data(Mesh mesh, uint32_t* indices, int count) { cf_mesh_update_index_data(mesh, indices, count); }
 CF_INLINE int mesh_append_index_data(Mesh mesh, uint32_t* indices, int append_count) { return cf_mesh_append_index_data(mesh, indices, append_count); }
 CF_INLINE bool mesh_will_overflow_index_data(Mesh mesh, int append_count) { return cf_mesh_will_overflow_index_data(mesh, append_count); }
+CF_INLINE MeshStats mesh_query_stats(Mesh mesh) { return cf_mesh_query_stats(mesh); }
 CF_INLINE RenderState render_state_defaults() { return cf_render_state_defaults(); }
 CF_INLINE Material make_material() { return cf_make_material(); }
 CF_INLINE void destroy_material(Material material) { cf_destroy_material(material); }
@@ -2200,6 +2699,16 @@ CF_INLINE void apply_mesh(Mesh mesh) { cf_apply_mesh(mesh); }
 CF_INLINE void apply_shader(Shader shader, Material material) { cf_apply_shader(shader, material); }
 CF_INLINE void draw_elements() { cf_draw_elements(); }
 CF_INLINE void unapply_canvas() { cf_unapply_canvas(); }
+CF_INLINE PipelineCacheStats query_pipeline_cache_stats() { return cf_query_pipeline_cache_stats(); }
+CF_INLINE void reset_pipeline_cache_stats() { cf_reset_pipeline_cache_stats(); }
+CF_INLINE void set_pipeline_cache_capacity(int capacity) { cf_set_pipeline_cache_capacity(capacity); }
+CF_INLINE void prewarm_pipeline(Canvas canvas, Mesh mesh, Shader shader, Material material) { cf_prewarm_pipeline(canvas, mesh, shader, material); }
+CF_INLINE RenderStats query_render_stats() { return cf_query_render_stats(); }
+CF_INLINE void gpu_timing_enable(bool enable) { cf_gpu_timing_enable(enable); }
+CF_INLINE bool gpu_timing_supported() { return cf_gpu_timing_supported(); }
+CF_INLINE void gpu_timer_push(const char* label) { cf_gpu_timer_push(label); }
+CF_INLINE void gpu_timer_pop() { cf_gpu_timer_pop(); }
+CF_INLINE GpuTimings query_gpu_timings() { return cf_query_gpu_timings(); }
 CF_INLINE void clear_color(float r, float g, float b, float a) { cf_clear_color(r, g, b, a); }
 CF_INLINE void clear_color(Color color) { cf_clear_color2(color); }
 
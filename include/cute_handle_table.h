@@ -9,6 +9,7 @@
 #define CF_HANDLE_TABLE_H
 
 #include "cute_defines.h"
+#include "cute_array.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -72,6 +73,16 @@ CF_API CF_HandleTable* CF_CALL cf_make_handle_allocator(int initial_capacity);
  */
 CF_API void CF_CALL cf_destroy_handle_allocator(CF_HandleTable* table);
 
+/**
+ * @function cf_handle_allocator_reserve
+ * @category utility
+ * @brief    Makes room for at least `capacity` handles, so allocating up to that many won't need to grow the table.
+ * @param    table        The table.
+ * @param    capacity     The total number of handles to make room for.
+ * @related  CF_Handle CF_HandleTable cf_make_handle_allocator cf_handle_allocator_alloc cf_handle_allocator_alloc_many
+ */
+CF_API void CF_CALL cf_handle_allocator_reserve(CF_HandleTable* table, int capacity);
+
 /**
  * @function cf_handle_allocator_alloc
  * @category utility
@@ -83,6 +94,20 @@ CF_API void CF_CALL cf_destroy_handle_allocator(CF_HandleTable* table);
  */
 CF_API CF_Handle CF_CALL cf_handle_allocator_alloc(CF_HandleTable* table, uint32_t index, uint16_t type);
 
+/**
+ * @function cf_handle_allocator_alloc_many
+ * @category utility
+ * @brief    Allocates `count` unique handles, where handle `i` maps to `first_index + i` and `type`.
+ * @param    table        The table.
+ * @param    first_index  The 32-bit value the first handle maps to. Can be fetched with `cf_handle_allocator_get_index`.
+ * @param    count        The number of handles to allocate.
+ * @param    type         A 16-bit value all the handles map to. Can be fetched with `cf_handle_allocator_get_type`.
+ * @param    out_handles  Array of `count` handles to fill in.
+ * @remarks  Same as calling `cf_handle_allocator_alloc` `count` times, but grows the table at most once.
+ * @related  CF_Handle CF_HandleTable cf_handle_allocator_alloc cf_handle_allocator_get_index cf_handle_allocator_get_type cf_handle_allocator_active cf_handle_allocator_activate cf_handle_allocator_deactivate cf_handle_allocator_update_index cf_handle_allocator_free cf_handle_allocator_handle_valid
+ */
+CF_API void CF_CALL cf_handle_allocator_alloc_many(CF_HandleTable* table, uint32_t first_index, int count, uint16_t type, CF_Handle* out_handles);
+
 /**
  * @function cf_handle_allocator_get_index
  * @category utility
@@ -177,11 +202,23 @@ CF_API void CF_CALL cf_handle_allocator_free(CF_HandleTable* table, CF_Handle ha
  * @brief    Returns true if a `CF_Handle` is valid.
  * @param    table        The table.
  * @param    handle       A handle created by `cf_handle_allocator_alloc`.
- * @remarks  Handles are created in a valid state. They only become invalid when `cf_handle_allocator_free` is called.
+ * @remarks  Handles are created in a valid state. They only become invalid when `cf_handle_allocator_free` is called. Handles
+ *           past the end of the table, such as `CF_INVALID_HANDLE`, are reported as invalid.
  * @related  CF_Handle CF_HandleTable cf_handle_allocator_get_index cf_handle_allocator_get_index cf_handle_allocator_get_type cf_handle_allocator_active cf_handle_allocator_activate cf_handle_allocator_deactivate cf_handle_allocator_update_index cf_handle_allocator_free cf_handle_allocator_handle_valid
  */
 CF_API int CF_CALL cf_handle_allocator_handle_valid(CF_HandleTable* table, CF_Handle handle);
 
+/**
+ * @function cf_handle_allocator_copy
+ * @category utility
+ * @brief    Overwrites `dst` with a copy of every handle within `src`.
+ * @param    dst          The table to overwrite.
+ * @param    src          The table to copy.
+ * @remarks  Afterwards all handles valid in `src` are valid in `dst` and map to the same values. Useful for saving and restoring state.
+ * @related  CF_Handle CF_HandleTable cf_make_handle_allocator cf_handle_allocator_copy
+ */
+CF_API void CF_CALL cf_handle_allocator_copy(CF_HandleTable* dst, const CF_HandleTable* src);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -209,6 +246,11 @@ struct HandleTable
 		m_alloc = NULL;
 	}
 
+	CF_INLINE void reserve(int capacity)
+	{
+		cf_handle_allocator_reserve(m_alloc, capacity);
+	}
+
 	CF_INLINE CF_Handle alloc_handle(uint32_t index, uint16_t type = 0)
 	{
 		return cf_handle_allocator_alloc(m_alloc, index, type);
@@ -219,6 +261,11 @@ struct HandleTable
 		return cf_handle_allocator_alloc(m_alloc, ~0, 0);
 	}
 
+	CF_INLINE void alloc_handles(uint32_t first_index, int count, uint16_t type, CF_Handle* out_handles)
+	{
+		cf_handle_allocator_alloc_many(m_alloc, first_index, count, type, out_handles);
+	}
+
 	CF_INLINE uint32_t get_index(CF_Handle handle)
 	{
 		return cf_handle_allocator_get_index(m_alloc, handle);
@@ -267,6 +314,98 @@ struct HandleTable
 	CF_HandleTable* m_alloc;
 };
 
+/**
+ * Stores values contiguously, handing out a generation-checked `Handle` for each one.
+ *
+ * Values are kept densely packed for cache-friendly iteration, and removal swaps the last value into
+ * the hole, so indices (and pointers) into the map are not stable -- hold onto handles instead. Lookups
+ * and removals are O(1). Removed handles are detected as invalid, even once their slot is reused.
+ */
+template <typename T>
+struct SlotMap
+{
+	SlotMap(int initial_capacity = 0) : m_table(initial_capacity) { }
+	SlotMap(const SlotMap<T>&) = delete;
+	SlotMap<T>& operator=(const SlotMap<T>&) = delete;
+
+	CF_INLINE Handle insert(const T& value) { m_items.add(value); return s_track(); }
+	CF_INLINE Handle insert(T&& value) { m_items.add(cf_move(value)); return s_track(); }
+
+	CF_INLINE void reserve(int capacity) { m_table.reserve(capacity); m_items.ensure_capacity(capacity); m_handles.ensure_capacity(capacity); }
+
+	// Returns false if `handle` was already removed.
+	bool remove(Handle handle);
+	void clear();
+
+	CF_INLINE bool valid(Handle handle) const { return m_table.valid(handle); }
+
+	// Returns NULL if `handle` is no longer valid.
+	CF_INLINE T* find(Handle handle) { return valid(handle) ? m_items + index_of(handle) : NULL; }
+	CF_INLINE const T* find(Handle handle) const { return valid(handle) ? m_items + index_of(handle) : NULL; }
+	CF_INLINE T& get(Handle handle) { CF_ASSERT(valid(handle)); return m_items[index_of(handle)]; }
+	CF_INLINE const T& get(Handle handle) const { CF_ASSERT(valid(handle)); return m_items[index_of(handle)]; }
+
+	// The dense index of `handle`'s value, only meaningful until the next removal.
+	CF_INLINE int index_of(Handle handle) const { return (int)m_table.get_index(handle); }
+	// The handle of the value at dense `index`.
+	CF_INLINE Handle handle_of(int index) const { return m_handles[index]; }
+
+	CF_INLINE int count() const { return m_items.count(); }
+	CF_INLINE int size() const { return m_items.count(); }
+	CF_INLINE bool empty() const { return m_items.count() == 0; }
+
+	CF_INLINE T& operator[](int index) { return m_items[index]; }
+	CF_INLINE const T& operator[](int index) const { return m_items[index]; }
+	CF_INLINE T* data() { return m_items.data(); }
+	CF_INLINE const T* data() const { return m_items.data(); }
+	CF_INLINE const Handle* handles() const { return m_handles.data(); }
+	CF_INLINE T* begin() { return m_items.begin(); }
+	CF_INLINE const T* begin() const { return m_items.begin(); }
+	CF_INLINE T* end() { return m_items.end(); }
+	CF_INLINE const T* end() const { return m_items.end(); }
+
+private:
+	CF_INLINE Handle s_track()
+	{
+		Handle handle = m_table.alloc_handle((uint32_t)(m_items.count() - 1));
+		m_handles.add(handle);
+		return handle;
+	}
+
+	// Lookups don't modify the table, but the C API isn't const.
+	mutable HandleTable m_table;
+	Array<T> m_items;
+	// Parallel to `m_items`, the handle of each value.
+	Array<Handle> m_handles;
+};
+
+template <typename T>
+bool SlotMap<T>::remove(Handle handle)
+{
+	if (!valid(handle)) return false;
+	int index = index_of(handle);
+	int last = m_items.count() - 1;
+	if (index != last) {
+		m_items[index] = cf_move(m_items[last]);
+		m_handles[index] = m_handles[last];
+		m_table.update_index(m_handles[index], (uint32_t)index);
+	}
+	m_items.pop();
+	m_handles.pop();
+	m_table.free_handle(handle);
+	return true;
+}
+
+template <typename T>
+void SlotMap<T>::clear()
+{
+	for (int i = 0; i < m_handles.count(); ++i) {
+		m_table.free_handle(m_handles[i]);
+	}
+	m_items.clear();
+	m_handles.clear();
+}
+
 }
 
 #endif // CF_CPP
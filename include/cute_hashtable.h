@@ -280,7 +280,8 @@
  * @brief    Sorts the {key, item} pairs in the table by keys.
  * @param    h        The hashtable. Can be `NULL`. Needs to be a pointer to the type of items in the table.
  * @remarks  The keys and items returned by `hkeys` and `hitems` will be sorted. Recall that all keys in the hashtable are treated
- *           as `uint64_t`, so the sorting simply sorts the keys from least to greatest as `uint64_t`. This is _not_ a stable sort.
+ *           as `uint64_t`, so the sorting simply sorts the keys from least to greatest as `uint64_t`. Keys are radix sorted in
+ *           O(n), and each key and item is moved once.
  * @related  htbl hswap hsort hssort hsisort
  */
 #define hsort(h) cf_hashtable_sort(h)
@@ -340,6 +341,39 @@
  */
 #define hfree(h) cf_hashtable_free(h)
 
+/**
+ * @function hreserve
+ * @category hash
+ * @brief    Makes room for at least `n` {key, item} pairs without any further growth.
+ * @param    h        The hashtable. Can be `NULL`. Needs to be a pointer to the type of items in the table.
+ * @param    n        The number of pairs to make room for.
+ * @remarks  Adding many pairs one at a time grows the table in steps, rehashing the whole table at each step. Reserving up front
+ *           avoids that. Invalidates pointers to items within the table.
+ * @related  htbl hset hreserve hbuild_from hcount
+ */
+#define hreserve(h, n) cf_hashtable_reserve(h, n)
+
+/**
+ * @function hbuild_from
+ * @category hash
+ * @brief    Replaces the contents of the table with `n` {key, item} pairs in one pass.
+ * @param    h        The hashtable. Can be `NULL`. Needs to be a pointer to the type of items in the table.
+ * @param    keys     An array of `n` keys, typecasted to `uint64_t`. Every key must be unique.
+ * @param    items    An array of `n` items.
+ * @param    n        The number of pairs.
+ * @remarks  Much faster than calling `hset` `n` times. The table is sized once, and slots are filled in memory order. The items
+ *           within the table end up in the same order as `items`. Duplicate keys are not detected.
+ * @example > Building a table from arrays.
+ *     uint64_t keys[] = { 10, 20, 30 };
+ *     float items[] = { 1.0f, 2.0f, 3.0f };
+ *     htbl float* table = NULL;
+ *     hbuild_from(table, keys, items, 3);
+ *     CF_ASSERT(hget(table, 20) == 2.0f);
+ *     hfree(table);
+ * @related  htbl hset hreserve hbuild_from hcount
+ */
+#define hbuild_from(h, keys, items, n) cf_hashtable_build_from(h, keys, items, n)
+
 //--------------------------------------------------------------------------------------------------
 // Longform C API.
 
@@ -362,6 +396,8 @@
 #define cf_hashtable_size(h) (h ? cf_hashtable_count_impl(CF_HHDR(h)) : 0)
 #define cf_hashtable_count(h) cf_hashtable_size(h)
 #define cf_hashtable_free(h) do { CF_HCANARY(h); if (h) cf_hashtable_free_impl(CF_HHDR(h)); h = NULL; } while (0)
+#define cf_hashtable_reserve(h, n) ((h) ? (h) : (*(void**)&(h) = cf_hashtable_make_impl(sizeof(uint64_t), sizeof(*(h)), (n) > 0 ? (n) : 1)), CF_HCANARY(h), *(void**)&(h) = cf_hashtable_reserve_impl(CF_HHDR(h), n))
+#define cf_hashtable_build_from(h, keys, items, n) ((h) ? (h) : (*(void**)&(h) = cf_hashtable_make_impl(sizeof(uint64_t), sizeof(*(h)), (n) > 0 ? (n) : 1)), CF_HCANARY(h), *(void**)&(h) = cf_hashtable_build_impl(CF_HHDR(h), keys, items, n))
 
 //--------------------------------------------------------------------------------------------------
 // Hidden API - Not intended for direct use.
@@ -378,7 +414,6 @@ typedef struct CF_Hslot
 {
 	uint32_t key_hash;
 	int item_index;
-	int base_count;
 } CF_Hslot;
 
 typedef struct CF_Hhdr
@@ -388,6 +423,8 @@ typedef struct CF_Hhdr
 	int item_capacity;
 	int count;
 	int slot_capacity;
+	int tombstone_count;
+	uint8_t* slot_ctrl;
 	CF_Hslot* slots;
 	void* items_key;
 	int* items_slot_index;
@@ -414,9 +451,12 @@ CF_API void* CF_CALL cf_hashtable_items_impl(const CF_Hhdr* table);
 CF_API void* CF_CALL cf_hashtable_keys_impl(const CF_Hhdr* table);
 CF_API void CF_CALL cf_hashtable_clear_impl(CF_Hhdr* table);
 CF_API void CF_CALL cf_hashtable_swap_impl(CF_Hhdr* table, int index_a, int index_b);
+CF_API void CF_CALL cf_hashtable_permute_impl(CF_Hhdr* table, int* order);
 CF_API void* CF_CALL cf_hashtable_sort_impl(CF_Hhdr* table);
 CF_API void* CF_CALL cf_hashtable_ssort_impl(CF_Hhdr* table);
 CF_API void* CF_CALL cf_hashtable_sisort_impl(CF_Hhdr* table);
+CF_API void* CF_CALL cf_hashtable_reserve_impl(CF_Hhdr* table, int capacity);
+CF_API void* CF_CALL cf_hashtable_build_impl(CF_Hhdr* table, const void* keys, const void* items, int count);
 
 #ifdef __cplusplus
 }
@@ -430,6 +470,52 @@ CF_API void* CF_CALL cf_hashtable_sisort_impl(CF_Hhdr* table);
 namespace Cute
 {
 
+// Sorts `indices` so that `less(indices[i], indices[i + 1])` never holds backwards. Sorting indices, then
+// moving the data once, is much cheaper than swapping large elements around during the sort.
+// A quicksort with median-of-three pivots, falling back to insertion sort for short ranges.
+template <typename L>
+void sort_indices(int* indices, int count, L less)
+{
+	while (count > 16) {
+		int mid = count / 2;
+		int* a = indices;
+		int* b = indices + mid;
+		int* c = indices + count - 1;
+		// Move the median of the first, middle and last to the end as the pivot.
+		if (less(*b, *a)) { int t = *a; *a = *b; *b = t; }
+		if (less(*c, *b)) { int t = *b; *b = *c; *c = t; }
+		if (less(*b, *a)) { int t = *a; *a = *b; *b = t; }
+		{ int t = *b; *b = *c; *c = t; }
+		int pivot = *c;
+		int lo = 0;
+		for (int hi = 0; hi < count - 1; ++hi) {
+			if (less(indices[hi], pivot)) {
+				int t = indices[lo]; indices[lo] = indices[hi]; indices[hi] = t;
+				++lo;
+			}
+		}
+		{ int t = indices[lo]; indices[lo] = indices[count - 1]; indices[count - 1] = t; }
+		// Recurse into the smaller side and loop on the larger, to bound the stack depth.
+		if (lo < count - 1 - lo) {
+			sort_indices(indices, lo, less);
+			indices += lo + 1;
+			count -= lo + 1;
+		} else {
+			sort_indices(indices + lo + 1, count - 1 - lo, less);
+			count = lo;
+		}
+	}
+	for (int i = 1; i < count; ++i) {
+		int index = indices[i];
+		int j = i;
+		while (j > 0 && less(index, indices[j - 1])) {
+			indices[j] = indices[j - 1];
+			--j;
+		}
+		indices[j] = index;
+	}
+}
+
 // General purpose {key, item} pair mapping via internal hash table.
 // Keys are treated as mere byte buffers (Plain Old Data).
 // Items have contructors/destructors called, but are *not* allowed to store references/pointers to themselves.
@@ -461,6 +547,8 @@ struct Map
 	void remove(const K& key);
 
 	void clear();
+	void ensure_capacity(int capacity);
+	void build_from(const K* keys, const T* items, int count);
 
 	int count() const;
 	T* items();
@@ -484,11 +572,8 @@ struct Map
 private:
 	CF_Hhdr* m_table = NULL;
 
-	template <typename P>
-	void sort_keys(int offset, int count, P predicate);
-
-	template <typename P>
-	void sort_items(int offset, int count, P predicate);
+	template <typename L>
+	void sort(L less);
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -502,14 +587,8 @@ Map<K, T>::Map()
 template <typename K, typename T>
 Map<K, T>::Map(const Map<K, T>& other)
 {
-	int n = other.count();
-	const T* items = other.items();
-	const K* keys = other.keys();
-	if (n) {
-		m_table = CF_HHDR((T*)cf_hashtable_make_impl(sizeof(K), sizeof(T), n));
-		for (int i = 0; i < n; ++i) {
-			insert(keys[i], items[i]);
-		}
+	if (other.count()) {
+		build_from(other.keys(), other.items(), other.count());
 	}
 }
 
@@ -622,6 +701,25 @@ void Map<K, T>::clear()
 	if (m_table) cf_hashtable_clear_impl(m_table);
 }
 
+template <typename K, typename T>
+void Map<K, T>::ensure_capacity(int capacity)
+{
+	if (!m_table) m_table = CF_HHDR((T*)cf_hashtable_make_impl(sizeof(K), sizeof(T), capacity > 0 ? capacity : 1));
+	m_table = CF_HHDR((T*)cf_hashtable_reserve_impl(m_table, capacity));
+}
+
+template <typename K, typename T>
+void Map<K, T>::build_from(const K* keys, const T* items, int count)
+{
+	clear();
+	if (!m_table) m_table = CF_HHDR((T*)cf_hashtable_make_impl(sizeof(K), sizeof(T), count > 0 ? count : 1));
+	m_table = CF_HHDR((T*)cf_hashtable_build_impl(m_table, keys, NULL, count));
+	T* elements = this->items();
+	for (int i = 0; i < count; ++i) {
+		CF_PLACEMENT_NEW(elements + i) T(items[i]);
+	}
+}
+
 template <typename K, typename T>
 int Map<K, T>::count() const
 {
@@ -661,16 +759,8 @@ void Map<K, T>::swap(int index_a, int index_b)
 template <typename K, typename T>
 Map<K, T>& Map<K, T>::operator=(const Map<K, T>& rhs)
 {
-	clear();
-	int n = rhs.count();
-	const T* items = rhs.items();
-	const K* keys = rhs.keys();
-	if (n) {
-		m_table = CF_HHDR((T*)cf_hashtable_make_impl(sizeof(K), sizeof(T), n));
-		for (int i = 0; i < n; ++i) {
-			insert(keys[i], items[i]);
-		}
-	}
+	if (this == &rhs) return *this;
+	build_from(rhs.keys(), rhs.items(), rhs.count());
 	return *this;
 }
 
@@ -684,75 +774,32 @@ Map<K, T>& Map<K, T>::operator=(Map<K, T>&& rhs)
 }
 
 template <typename K, typename T>
-template <typename P>
-void Map<K, T>::sort_keys(int offset, int count, P predicate)
+template <typename L>
+void Map<K, T>::sort(L less)
 {
+	int count = m_table ? m_table->count : 0;
 	if (count <= 1) return;
-
-	auto key = [=, this](int index) -> K& {
-		uint8_t* keys = (uint8_t*)m_table->items_key;
-		void* k = keys + index * m_table->key_size;
-		return *(K*)k;
-	};
-	auto swap = [=, this](int ia, int ib) { cf_hashtable_swap_impl(m_table, offset + ia, offset + ib); };
-
-	const K& pivot_key = key(count - 1);
-	int lo = 0;
-	for (int hi = 0; hi < count - 1; ++hi) {
-		const K& hi_key = key(hi);
-		if (predicate(hi_key, pivot_key)) {
-			swap(lo, hi);
-			lo++;
-		}
-	}
-
-	swap(count - 1, lo);
-
-	sort_keys(0, lo, predicate);
-	sort_keys(lo + 1, count - 1 - lo, predicate);
+	int* order = (int*)cf_alloc(sizeof(int) * count);
+	for (int i = 0; i < count; ++i) order[i] = i;
+	sort_indices(order, count, less);
+	cf_hashtable_permute_impl(m_table, order);
+	cf_free(order);
 }
 
 template <typename K, typename T>
 template <typename P>
 void Map<K, T>::sort_by_keys(P predicate)
 {
-	sort_keys(0, m_table->count, predicate);
-}
-
-template <typename K, typename T>
-template <typename P>
-void Map<K, T>::sort_items(int offset, int count, P predicate)
-{
-	if (count <= 1) return;
-
-	auto item = [=, this](int index) -> T& {
-		uint8_t* items = (uint8_t*)m_table->items_data;
-		void* item = items + index * m_table->item_size;
-		return *(T*)item;
-	};
-	auto swap = [=, this](int ia, int ib) { cf_hashtable_swap_impl(m_table, offset + ia, offset + ib); };
-
-	const K& pivot = item(count - 1);
-	int lo = 0;
-	for (int hi = 0; hi < count - 1; ++hi) {
-		const K& val = item(hi);
-		if (predicate(val, pivot)) {
-			swap(lo, hi);
-			lo++;
-		}
-	}
-
-	swap(count - 1, lo);
-
-	sort_items(0, lo, predicate);
-	sort_items(lo + 1, count - 1 - lo, predicate);
+	const K* k = keys();
+	sort([&](int a, int b) { return predicate(k[a], k[b]); });
 }
 
 template <typename K, typename T>
 template <typename P>
 void Map<K, T>::sort_by_items(P predicate)
 {
-	sort_items(0, m_table->count, predicate);
+	const T* v = items();
+	sort([&](int a, int b) { return predicate(v[a], v[b]); });
 }
 
 }
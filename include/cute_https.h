@@ -13,6 +13,7 @@
 #include "cute_c_runtime.h"
 #include "cute_array.h"
 #include "cute_hashtable.h"
+#include "cute_coroutine.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -60,7 +61,17 @@ extern "C" {
  *     }
  * @remarks  You may create a request by calling either `cf_https_get` or `cf_https_post`. It is intended to continually
  *           call `cf_https_process` in a loop until the request generates a response, or fails.
- * @related  CF_HttpsRequest CF_HttpsResponse cf_https_get cf_https_post
+ *
+ *           Connections are kept alive after a successful response and pooled per host, so follow-up requests to the same
+ *           host skip the TCP and TLS handshakes. Idle connections are closed after 30 seconds, or call
+ *           `cf_https_close_idle_connections` to close them right away. Requests share the pool, so process them all from
+ *           the same thread.
+ *
+ *           Requests ask for gzip or deflate compressed responses with an `Accept-Encoding` header, and the body is decompressed
+ *           as it arrives. The `Content-Encoding` header is left in the response, but `cf_https_response_content` and
+ *           `CF_HttpsBodyFn` only ever see the decompressed body. To get the body exactly as the server sent it, add your own
+ *           `Accept-Encoding` header with `cf_https_add_header`.
+ * @related  CF_HttpsRequest CF_HttpsResponse cf_https_get cf_https_post cf_https_close_idle_connections
  */
 typedef struct CF_HttpsRequest { uint64_t id; } CF_HttpsRequest;
 // @end
@@ -119,10 +130,87 @@ CF_API CF_HttpsRequest CF_CALL cf_https_get(const char* host, int port, const ch
  * @param    verify_cert  Recommended as true. Set to true to verify the server certificate (you want this on).
  * @return   Returns a `CF_HttpsRequest` for processing the get request and receiving a response.
  * @remarks  You should continually call `cf_https_process` on the `CF_HttpsRequest`. See `CF_HttpsRequest` for details.
- * @related  CF_HttpsRequest cf_https_get cf_https_post cf_https_destroy cf_https_process cf_https_response
+ *           To send `content` compressed, see `cf_https_set_gzip_content`.
+ * @related  CF_HttpsRequest cf_https_get cf_https_post cf_https_destroy cf_https_process cf_https_response cf_https_set_gzip_content
  */
 CF_API CF_HttpsRequest CF_CALL cf_https_post(const char* host, int port, const char* uri, const void* content, int content_length, bool verify_cert);
 
+/**
+ * @function cf_https_download
+ * @category web
+ * @brief    Creates an HTTPS GET request that streams the response body straight into a file.
+ * @param    host          The address of the host, e.g. "www.google.com".
+ * @param    port          The port number to connect over, typically 443 for common web traffic.
+ * @param    uri           The address of the resource the request references, e.g. "/patch.pak".
+ * @param    virtual_path  Where to write the file, see [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @param    resume        Set to true to continue a previously interrupted download. The bytes already in `virtual_path` are skipped
+ *                         with a range request.
+ * @param    verify_cert   Recommended as true. Set to true to verify the server certificate (you want this on).
+ * @return   Returns a `CF_HttpsRequest` for processing the download.
+ * @remarks  You should continually call `cf_https_process` on the `CF_HttpsRequest`, and may call `cf_https_progress` to display progress.
+ *           The body never sits in memory all at once, so downloading large files costs about one network packet of memory. If the
+ *           server ignores the range the file is downloaded again from the start. If the server replies with an error code nothing is
+ *           written, and the error page is available via `cf_https_response_content`. A response code of 416 when resuming usually means
+ *           the file was already complete. If the download fails the partial file is left in place to resume later.
+ *
+ *           Unlike other requests, downloads don't ask for a compressed response, so the file on disk matches what the server
+ *           has and resuming by byte range works.
+ * @related  CF_HttpsRequest cf_https_get cf_https_progress cf_https_set_body_callback cf_https_process
+ */
+CF_API CF_HttpsRequest CF_CALL cf_https_download(const char* host, int port, const char* uri, const char* virtual_path, bool resume, bool verify_cert);
+
+/**
+ * @function CF_HttpsBodyFn
+ * @category web
+ * @brief    A function pointer (callback) that receives a response body piece-by-piece as it arrives.
+ * @param    request  The request the body belongs to.
+ * @param    data     The next piece of the body. Only valid until the callback returns.
+ * @param    size     The size of `data` in bytes.
+ * @param    udata    The `udata` passed to `cf_https_set_body_callback`.
+ * @remarks  Called from within `cf_https_process`.
+ * @related  CF_HttpsRequest cf_https_set_body_callback
+ */
+typedef void (CF_HttpsBodyFn)(CF_HttpsRequest request, const void* data, int size, void* udata);
+
+/**
+ * @function cf_https_set_body_callback
+ * @category web
+ * @brief    Streams the response body to a callback instead of collecting it in memory.
+ * @param    request  The request.
+ * @param    fn       Called with each piece of the body as it arrives, see `CF_HttpsBodyFn`.
+ * @param    udata    Can be `NULL`. Handed back to you in `fn`.
+ * @remarks  You should call this before calling `cf_https_process`. Once set `cf_https_response_content` stays empty, while headers and
+ *           the response code are still available as usual.
+ * @related  CF_HttpsRequest CF_HttpsBodyFn cf_https_download cf_https_progress
+ */
+CF_API void CF_CALL cf_https_set_body_callback(CF_HttpsRequest request, CF_HttpsBodyFn* fn, void* udata);
+
+/**
+ * @function cf_https_set_gzip_content
+ * @category web
+ * @brief    Sends the content of a POST request gzip compressed.
+ * @param    request  The request, made by `cf_https_post`.
+ * @param    gzip     True to compress the content.
+ * @remarks  You should call this before calling `cf_https_process`. The content is compressed when the request is sent, and goes out
+ *           with a `Content-Encoding: gzip` header. Content that doesn't get any smaller, such as already compressed data, is sent
+ *           as-is. Only turn this on for servers known to accept compressed requests, many don't.
+ * @related  CF_HttpsRequest cf_https_post cf_https_add_header
+ */
+CF_API void CF_CALL cf_https_set_gzip_content(CF_HttpsRequest request, bool gzip);
+
+/**
+ * @function cf_https_progress
+ * @category web
+ * @brief    Reports how much of the response body has arrived.
+ * @param    request   The request.
+ * @param    received  Can be `NULL`. Bytes of the body received so far, including bytes already on disk when resuming a download.
+ * @param    total     Can be `NULL`. Total size of the body in bytes, or 0 while unknown (e.g. chunked responses).
+ * @remarks  Only counts streamed bodies, see `cf_https_download` and `cf_https_set_body_callback`. Compressed bodies are counted
+ *           in compressed bytes, the same as `total`.
+ * @related  CF_HttpsRequest cf_https_download cf_https_set_body_callback
+ */
+CF_API void CF_CALL cf_https_progress(CF_HttpsRequest request, uint64_t* received, uint64_t* total);
+
 /**
  * @function cf_https_add_header
  * @category web
@@ -143,6 +231,16 @@ CF_API void CF_CALL cf_https_add_header(CF_HttpsRequest request, const char* nam
  */
 CF_API void CF_CALL cf_https_destroy(CF_HttpsRequest request);
 
+/**
+ * @function cf_https_close_idle_connections
+ * @category web
+ * @brief    Closes all pooled keep-alive connections.
+ * @remarks  Finished requests hand their connection back to a pool for reuse by later requests to the same host. Call this
+ *           to release those sockets, for example before shutting down. See `CF_HttpsRequest`.
+ * @related  CF_HttpsRequest cf_https_get cf_https_post cf_https_destroy
+ */
+CF_API void CF_CALL cf_https_close_idle_connections(void);
+
 /**
  * @enum     CF_HttpsResult
  * @category web
@@ -205,6 +303,76 @@ CF_INLINE const char* cf_https_result_to_string(CF_HttpsResult state)
  */
 CF_API CF_HttpsResult CF_CALL cf_https_process(CF_HttpsRequest request);
 
+/**
+ * @function CF_HttpsDoneFn
+ * @category web
+ * @brief    A function pointer (callback) that reports a finished request processed by `cf_https_process_async`.
+ * @param    request  The finished request. Its response is ready, call `cf_https_destroy` on it once you're done with it.
+ * @param    result   How the request went, see `CF_HttpsResult`. Never `CF_HTTPS_RESULT_PENDING`.
+ * @param    udata    The `udata` passed to `cf_https_process_async`.
+ * @remarks  Called from `cf_https_poll_async`, on the thread that calls it.
+ * @related  CF_HttpsRequest cf_https_process_async cf_https_poll_async
+ */
+typedef void (CF_HttpsDoneFn)(CF_HttpsRequest request, CF_HttpsResult result, void* udata);
+
+/**
+ * @function cf_https_process_async
+ * @category web
+ * @brief    Hands a request over to a background network thread to process, instead of calling `cf_https_process` yourself.
+ * @param    request  The request.
+ * @param    fn       Called from `cf_https_poll_async` once the request finishes, see `CF_HttpsDoneFn`.
+ * @param    udata    Can be `NULL`. Handed back to you in `fn`.
+ * @remarks  One network thread, started on first use, drives every submitted request and sleeps on socket readiness in between, so
+ *           many outstanding requests don't cost any polling on your end. Call `cf_https_poll_async` once per frame to receive finished
+ *           requests. Don't call `cf_https_process` or `cf_https_destroy` on the request until it has been handed back to `fn`. Body
+ *           callbacks (see `cf_https_set_body_callback`) run on the network thread. Keep-alive connections are shared with the
+ *           network thread, so don't mix this with calling `cf_https_process` yourself on other requests at the same time.
+ * @related  CF_HttpsRequest CF_HttpsDoneFn cf_https_poll_async cf_https_async_pending_count cf_https_set_max_concurrent_requests
+ */
+CF_API void CF_CALL cf_https_process_async(CF_HttpsRequest request, CF_HttpsDoneFn* fn, void* udata);
+
+/**
+ * @function cf_https_poll_async
+ * @category web
+ * @brief    Delivers requests finished on the network thread to their callbacks.
+ * @param    max_count  The most callbacks to run in this call, or 0 for all of them.
+ * @return   Returns the number of callbacks run.
+ * @remarks  Call this once per frame, every finished request is delivered in one batch.
+ * @related  CF_HttpsRequest CF_HttpsDoneFn cf_https_process_async cf_https_async_pending_count
+ */
+CF_API int CF_CALL cf_https_poll_async(int max_count);
+
+/**
+ * @function cf_https_async_pending_count
+ * @category web
+ * @brief    Returns the number of requests handed to `cf_https_process_async` not yet delivered by `cf_https_poll_async`.
+ * @related  CF_HttpsRequest cf_https_process_async cf_https_poll_async
+ */
+CF_API int CF_CALL cf_https_async_pending_count();
+
+/**
+ * @function cf_https_set_max_concurrent_requests
+ * @category web
+ * @brief    Limits how many requests the network thread works on at once, 8 by default.
+ * @param    max_concurrent  The most requests in flight at once. Further requests wait their turn in submission order.
+ * @related  CF_HttpsRequest cf_https_process_async cf_https_poll_async
+ */
+CF_API void CF_CALL cf_https_set_max_concurrent_requests(int max_concurrent);
+
+/**
+ * @function cf_https_wait
+ * @category web
+ * @brief    Processes a request on the network thread, yielding the calling coroutine until the request finishes.
+ * @param    co       The coroutine calling this function, which must be handed to `cf_coroutine_schedule`.
+ * @param    request  The request.
+ * @return   Returns how the request went, see `CF_HttpsResult`.
+ * @remarks  Replaces calling `cf_https_process` from a coroutine every frame. The request goes to `cf_https_process_async`, and
+ *           the coroutine sleeps until `cf_coroutine_scheduler_update` sees it finish. While any wait is outstanding the scheduler
+ *           calls `cf_https_poll_async`, so callbacks of other async requests are delivered from there as well.
+ * @related  CF_HttpsRequest cf_https_process_async cf_coroutine_schedule cf_coroutine_scheduler_update
+ */
+CF_API CF_HttpsResult CF_CALL cf_https_wait(CF_Coroutine co, CF_HttpsRequest request);
+
 /**
  * @function cf_https_response
  * @category web
@@ -288,8 +456,14 @@ using HttpsHeader = CF_HttpsHeader;
 
 CF_INLINE HttpsRequest https_get(const char* host, int port, const char* uri, bool verify_cert = true) { return cf_https_get(host, port, uri, verify_cert); }
 CF_INLINE HttpsRequest https_post(const char* host, int port, const char* uri, const void* content, int content_length, bool verify_cert = true) { return cf_https_post(host, port, uri, content, content_length, verify_cert); }
+CF_INLINE HttpsRequest https_download(const char* host, int port, const char* uri, const char* virtual_path, bool resume = true, bool verify_cert = true) { return cf_https_download(host, port, uri, virtual_path, resume, verify_cert); }
+using HttpsBodyFn = CF_HttpsBodyFn;
+CF_INLINE void https_set_body_callback(HttpsRequest request, HttpsBodyFn* fn, void* udata = NULL) { cf_https_set_body_callback(request, fn, udata); }
+CF_INLINE void https_set_gzip_content(HttpsRequest request, bool gzip = true) { cf_https_set_gzip_content(request, gzip); }
+CF_INLINE void https_progress(HttpsRequest request, uint64_t* received, uint64_t* total) { cf_https_progress(request, received, total); }
 CF_INLINE void https_add_header(HttpsRequest request, const char* name, const char* value) { cf_https_add_header(request, name, value); }
 CF_INLINE void https_destroy(HttpsRequest request) { cf_https_destroy(request); }
+CF_INLINE void https_close_idle_connections() { cf_https_close_idle_connections(); }
 
 using HttpsResult = CF_HttpsResult;
 #define CF_ENUM(K, V) CF_INLINE constexpr HttpsResult K = CF_##K;
@@ -307,6 +481,12 @@ CF_INLINE const char* to_string(HttpsResult result)
 }
 
 CF_INLINE HttpsResult https_process(HttpsRequest request) { return cf_https_process(request); }
+using HttpsDoneFn = CF_HttpsDoneFn;
+CF_INLINE void https_process_async(HttpsRequest request, HttpsDoneFn* fn, void* udata = NULL) { cf_https_process_async(request, fn, udata); }
+CF_INLINE int https_poll_async(int max_count = 0) { return cf_https_poll_async(max_count); }
+CF_INLINE int https_async_pending_count() { return cf_https_async_pending_count(); }
+CF_INLINE HttpsResult https_wait(Coroutine co, HttpsRequest request) { return cf_https_wait(co, request); }
+CF_INLINE void https_set_max_concurrent_requests(int max_concurrent) { cf_https_set_max_concurrent_requests(max_concurrent); }
 CF_INLINE HttpsResponse https_response(HttpsRequest request) { return cf_https_response(request); }
 CF_INLINE int https_response_code(HttpsResponse response) { return cf_https_response_code(response); }
 CF_INLINE int https_response_content_length(HttpsResponse response) { return cf_https_response_content_length(response); }
@@ -95,6 +95,33 @@ CF_API CF_Result CF_CALL cf_image_load_png(const char* virtual_path, CF_Image* i
  */
 CF_API CF_Result CF_CALL cf_image_load_png_from_memory(const void* data, int size, CF_Image* img);
 
+/**
+ * @function cf_image_load_png_premultiplied
+ * @category image
+ * @brief    Loads a png image with premultiplied alpha.
+ * @param    virtual_path  A virtual path to the image file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @param    img           Out parameter for the image.
+ * @return   Check the `CF_Result` for errors.
+ * @remarks  Gives the same pixels as `cf_image_load_png` followed by `cf_image_premultiply`, but faster. Each row is premultiplied right after
+ *           it's decoded while it's still in cache, instead of in a second pass over the whole image. Paletted images premultiply their
+ *           palette once instead of each pixel.
+ * @related  CF_Image cf_image_load_png cf_image_load_png_from_memory_premultiplied cf_image_premultiply
+ */
+CF_API CF_Result CF_CALL cf_image_load_png_premultiplied(const char* virtual_path, CF_Image* img);
+
+/**
+ * @function cf_image_load_png_from_memory_premultiplied
+ * @category image
+ * @brief    Loads a png image from memory with premultiplied alpha.
+ * @param    data          Pointer to the png file in memory.
+ * @param    size          The number of bytes in the `data` pointer.
+ * @param    img           Out parameter for the image.
+ * @return   Check the `CF_Result` for errors.
+ * @remarks  Gives the same pixels as `cf_image_load_png_from_memory` followed by `cf_image_premultiply`, but faster. See `cf_image_load_png_premultiplied`.
+ * @related  CF_Image cf_image_load_png_premultiplied cf_image_load_png_from_memory cf_image_premultiply
+ */
+CF_API CF_Result CF_CALL cf_image_load_png_from_memory_premultiplied(const void* data, int size, CF_Image* img);
+
 /**
  * @function cf_image_load_png_wh
  * @category image
@@ -164,6 +191,27 @@ CF_API void CF_CALL cf_image_free_indexed(CF_ImageIndexed* img);
  */
 CF_API CF_Image CF_CALL cf_image_depallete(CF_ImageIndexed* img);
 
+/**
+ * @function cf_pixels_premultiply
+ * @category image
+ * @brief    Premultiplies the alpha component of each pixel with the RGB color components.
+ * @param    pixels        The pixels to premultiply.
+ * @param    count         The number of pixels.
+ * @remarks  The same as `cf_image_premultiply`, for pixels not kept in a `CF_Image`, such as pixels handed to `cf_make_easy_sprite_from_pixels`.
+ * @related  CF_Image cf_image_premultiply
+ */
+CF_API void CF_CALL cf_pixels_premultiply(CF_Pixel* pixels, int count);
+
+/**
+ * @function cf_pixels_swap_red_blue
+ * @category image
+ * @brief    Swaps the red and blue components of each pixel, converting between RGBA and BGRA.
+ * @param    pixels        The pixels to convert.
+ * @param    count         The number of pixels.
+ * @related  CF_Image cf_image_swap_red_blue
+ */
+CF_API void CF_CALL cf_pixels_swap_red_blue(CF_Pixel* pixels, int count);
+
 /**
  * @function cf_image_premultiply
  * @category image
@@ -175,6 +223,15 @@ CF_API CF_Image CF_CALL cf_image_depallete(CF_ImageIndexed* img);
  */
 CF_API void CF_CALL cf_image_premultiply(CF_Image* img);
 
+/**
+ * @function cf_image_swap_red_blue
+ * @category image
+ * @brief    Swaps the red and blue components of each pixel, converting between RGBA and BGRA.
+ * @param    img           The image to convert.
+ * @related  CF_Image cf_pixels_swap_red_blue
+ */
+CF_API void CF_CALL cf_image_swap_red_blue(CF_Image* img);
+
 /**
  * @function cf_image_flip_horizontal
  * @category image
@@ -203,6 +260,8 @@ using ImageIndexed = CF_ImageIndexed;
 
 CF_INLINE Result image_load_png(const char* virtual_path, Image* img) { return cf_image_load_png(virtual_path, img); }
 CF_INLINE Result image_load_png_mem(const void* data, int size, Image* img) { return cf_image_load_png_from_memory(data, size, img); }
+CF_INLINE Result image_load_png_premultiplied(const char* virtual_path, Image* img) { return cf_image_load_png_premultiplied(virtual_path, img); }
+CF_INLINE Result image_load_png_mem_premultiplied(const void* data, int size, Image* img) { return cf_image_load_png_from_memory_premultiplied(data, size, img); }
 CF_INLINE Result image_load_png_wh(const void* data, int size, int* w, int* h) { return cf_image_load_png_wh(data, size, w, h); }
 CF_INLINE void image_free(Image* img) { cf_image_free(img); }
 
@@ -215,7 +274,10 @@ CF_INLINE void image_free(ImageIndexed* img) { cf_image_free_indexed(img); }
 
 CF_INLINE Image image_depallete(ImageIndexed* img) { return cf_image_depallete(img); }
 CF_INLINE void image_premultiply(Image* img) { cf_image_premultiply(img); }
+CF_INLINE void image_swap_red_blue(Image* img) { cf_image_swap_red_blue(img); }
 CF_INLINE void image_flip_horizontal(Image* img) { cf_image_flip_horizontal(img); }
+CF_INLINE void pixels_premultiply(Pixel* pixels, int count) { cf_pixels_premultiply(pixels, count); }
+CF_INLINE void pixels_swap_red_blue(Pixel* pixels, int count) { cf_pixels_swap_red_blue(pixels, count); }
 
 }
 
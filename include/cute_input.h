@@ -9,6 +9,7 @@
 #define CF_INPUT_H
 
 #include "cute_defines.h"
+#include "cute_joypad.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -927,6 +928,142 @@ CF_API int CF_CALL cf_touch_get_all(CF_Touch** touch_all);
  */
 CF_API bool CF_CALL cf_touch_get(uint64_t id, CF_Touch* touch);
 
+/**
+ * @enum     CF_InputEventType
+ * @category input
+ * @brief    The kinds of `CF_InputEvent`.
+ * @related  CF_InputEventType cf_input_event_type_to_string CF_InputEvent cf_input_event_get_all
+ */
+#define CF_INPUT_EVENT_TYPE_DEFS \
+	/* @entry A key was pressed, see `CF_InputEvent::key`. Key repeats are not reported. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_KEY_PRESSED, 0) \
+	/* @entry A key was released, see `CF_InputEvent::key`. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_KEY_RELEASED, 1) \
+	/* @entry A mouse button was pressed, see `CF_InputEvent::mouse_button`. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_MOUSE_PRESSED, 2) \
+	/* @entry A mouse button was released, see `CF_InputEvent::mouse_button`. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_MOUSE_RELEASED, 3) \
+	/* @entry A joypad button was pressed, see `CF_InputEvent::joypad` and `CF_InputEvent::joypad_button`. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_JOYPAD_PRESSED, 4) \
+	/* @entry A joypad button was released, see `CF_InputEvent::joypad` and `CF_InputEvent::joypad_button`. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_JOYPAD_RELEASED, 5) \
+	/* @entry A joypad axis moved, see `CF_InputEvent::joypad`, `CF_InputEvent::joypad_axis` and `CF_InputEvent::axis_value`. */ \
+	CF_ENUM(INPUT_EVENT_TYPE_JOYPAD_AXIS, 6) \
+	/* @end */
+
+typedef enum CF_InputEventType
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_INPUT_EVENT_TYPE_DEFS
+	#undef CF_ENUM
+} CF_InputEventType;
+
+/**
+ * @function cf_input_event_type_to_string
+ * @category input
+ * @brief    Convert an enum `CF_InputEventType` to a c-style string.
+ * @param    type         The type to convert to a string.
+ * @related  CF_InputEventType cf_input_event_type_to_string CF_InputEvent cf_input_event_get_all
+ */
+CF_INLINE const char* cf_input_event_type_to_string(CF_InputEventType type)
+{
+	switch (type) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_INPUT_EVENT_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @struct   CF_InputEvent
+ * @category input
+ * @brief    A single timestamped press, release or axis motion.
+ * @remarks  Only the members matching `type` are filled in.
+ * @related  CF_InputEvent CF_InputEventType cf_input_event_get_all cf_input_poll
+ */
+typedef struct CF_InputEvent
+{
+	/* @member The kind of event, see `CF_InputEventType`. */
+	CF_InputEventType type;
+
+	/* @member When the event happened in seconds, on the same clock as `cf_get_ticks` divided by `cf_get_tick_frequency`. */
+	double timestamp;
+
+	/* @member The key for key events. */
+	CF_KeyButton key;
+
+	/* @member The button for mouse events. */
+	CF_MouseButton mouse_button;
+
+	/* @member The joypad for joypad events. */
+	CF_Joypad joypad;
+
+	/* @member The button for joypad button events. */
+	CF_JoypadButton joypad_button;
+
+	/* @member The axis for joypad axis events. */
+	CF_JoypadAxis joypad_axis;
+
+	/* @member The new value of the axis for joypad axis events, from -32768 to 32767. */
+	int axis_value;
+} CF_InputEvent;
+// @end
+
+/**
+ * @function cf_input_event_get_all
+ * @category input
+ * @brief    Returns every press, release and axis motion applied in the current update, in the order they happened.
+ * @param    events         An array of all `CF_InputEvent` events for this update.
+ * @return   Returns the number of `CF_InputEvent` events in `events`.
+ * @remarks  Input is timestamped as it arrives and queued. Each update only applies the input that happened before the moment in
+ *           time the update simulates up to. With a fixed timestep (see `cf_set_fixed_timestep`) that means a burst of input
+ *           arriving within one frame is spread over the fixed updates run that frame, in the order and roughly at the times it
+ *           actually happened, instead of all landing in the first update. A button pressed and released within a single update
+ *           has its release held back to the next update, so `cf_key_just_pressed` and friends never miss a quick tap.
+ *           Use this function when you need more than the per-update states, e.g. to read inputs for a fighting game buffer.
+ * @example > Looping over all input events.
+ *     CF_InputEvent* events = NULL;
+ *     int event_count = cf_input_event_get_all(&events);
+ *     for (int i = 0; i < event_count; ++i) {
+ *         do_something(events[i]);
+ *     }
+ * @related  CF_InputEvent cf_input_event_get_all cf_input_poll cf_input_set_high_frequency_polling
+ */
+CF_API int CF_CALL cf_input_event_get_all(CF_InputEvent** events);
+
+/**
+ * @function cf_input_poll
+ * @category input
+ * @brief    Pulls pending input from the operating system and timestamps it, without applying it yet.
+ * @remarks  Input is normally pulled at the start of each update, and stamped with the times the operating system reports. Calling
+ *           this during long stretches of work, or enabling `cf_input_set_high_frequency_polling`, keeps those times accurate on
+ *           platforms reporting coarse timestamps. Must be called from the main thread.
+ * @related  CF_InputEvent cf_input_event_get_all cf_input_poll cf_input_set_high_frequency_polling
+ */
+CF_API void CF_CALL cf_input_poll();
+
+/**
+ * @function cf_input_set_high_frequency_polling
+ * @category input
+ * @brief    Polls input about once a millisecond while waiting on the frame limiter.
+ * @param    true_to_enable  True to enable high frequency polling, false to disable it. Off by default.
+ * @remarks  Only has an effect while the app is sleeping to hit `cf_set_target_framerate` or in low latency mode, see
+ *           `cf_set_low_latency_mode`. The wait turns into a busy loop calling `cf_input_poll`, trading CPU time for more precise
+ *           timestamps on input from high polling rate devices. Polling happens on the main thread, as the operating system requires
+ *           input be read there.
+ * @related  CF_InputEvent cf_input_event_get_all cf_input_poll cf_input_set_high_frequency_polling cf_input_get_high_frequency_polling
+ */
+CF_API void CF_CALL cf_input_set_high_frequency_polling(bool true_to_enable);
+
+/**
+ * @function cf_input_get_high_frequency_polling
+ * @category input
+ * @brief    Returns true if high frequency polling is enabled, see `cf_input_set_high_frequency_polling`.
+ * @related  cf_input_set_high_frequency_polling
+ */
+CF_API bool CF_CALL cf_input_get_high_frequency_polling();
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -971,6 +1108,22 @@ CF_INLINE const char* to_string(MouseButton button)
 
 using ImeComposition = CF_ImeComposition;
 using Touch = CF_Touch;
+using InputEvent = CF_InputEvent;
+
+using InputEventType = CF_InputEventType;
+#define CF_ENUM(K, V) CF_INLINE constexpr InputEventType K = CF_##K;
+CF_INPUT_EVENT_TYPE_DEFS
+#undef CF_ENUM
+
+CF_INLINE const char* to_string(InputEventType type)
+{
+	switch (type) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_INPUT_EVENT_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
 
 CF_INLINE bool key_down(KeyButton key) { return cf_key_down(key); }
 CF_INLINE bool key_up(KeyButton key) { return cf_key_up(key); }
@@ -1012,6 +1165,10 @@ CF_INLINE bool input_get_ime_composition(ImeComposition* composition) { return c
 
 CF_INLINE bool touch_get(uint64_t id, Touch* touch) { return cf_touch_get(id,touch); }
 
+CF_INLINE void input_poll() { cf_input_poll(); }
+CF_INLINE void input_set_high_frequency_polling(bool true_to_enable) { cf_input_set_high_frequency_polling(true_to_enable); }
+CF_INLINE bool input_get_high_frequency_polling() { return cf_input_get_high_frequency_polling(); }
+
 }
 
 #endif // CF_CPP
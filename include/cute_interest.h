@@ -0,0 +1,189 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_INTEREST_H
+#define CF_INTEREST_H
+
+#include "cute_defines.h"
+#include "cute_math.h"
+#include "cute_multithreading.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_Interest
+ * @category net
+ * @brief    An opaque handle tracking which entities each client can see, for a server deciding what to send to whom.
+ * @remarks  Entities are points kept in a `CF_SpatialHash`, and each client has a view region. Once per tick `cf_interest_update`
+ *           queries each view, and reports the entities that entered or left it since the last update. The cost of an update
+ *           scales with the number of entities clients can see, not with the number of entities times the number of clients.
+ *
+ *           The enter and leave lists are meant to drive the scope of a `CF_ReplicationServer` made with `scoped` set.
+ *
+ *           ```cpp
+ *           // Server, once per tick.
+ *           for (int i = 0; i < entity_count; ++i) cf_interest_set_entity(interest, e[i].index, e[i].position);
+ *           for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+ *               if (cf_server_is_client_connected(server, i)) cf_interest_set_view(interest, i, view_of_player(i));
+ *           }
+ *           cf_interest_update(interest, NULL);
+ *           for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+ *               int count;
+ *               const int* entered = cf_interest_get_entered(interest, i, &count);
+ *               for (int j = 0; j < count; ++j) cf_replication_server_scope_add(rs, i, entered[j]);
+ *               const int* left = cf_interest_get_left(interest, i, &count);
+ *               for (int j = 0; j < count; ++j) cf_replication_server_scope_remove(rs, i, left[j]);
+ *           }
+ *           ```
+ * @related  CF_Interest cf_make_interest cf_interest_set_entity cf_interest_set_view cf_interest_update cf_interest_get_entered cf_interest_get_left
+ */
+typedef struct CF_Interest { uint64_t id; } CF_Interest;
+// @end
+
+/**
+ * @function cf_make_interest
+ * @category net
+ * @brief    Returns a new `CF_Interest`.
+ * @param    cell_size     The cell size of the internal `CF_SpatialHash`. About a quarter of the width of a typical view works well.
+ * @param    leave_margin  How far past a view an entity must go before it leaves. Keeps entities on the edge of a view from flickering in and out.
+ * @related  CF_Interest cf_destroy_interest cf_interest_update
+ */
+CF_API CF_Interest CF_CALL cf_make_interest(float cell_size, float leave_margin);
+
+/**
+ * @function cf_destroy_interest
+ * @category net
+ * @brief    Destroys a `CF_Interest` made by `cf_make_interest`.
+ * @related  CF_Interest cf_make_interest
+ */
+CF_API void CF_CALL cf_destroy_interest(CF_Interest interest);
+
+/**
+ * @function cf_interest_set_entity
+ * @category net
+ * @brief    Adds an entity, or moves it.
+ * @param    interest   The interest manager.
+ * @param    entity     The entity's index, zero or more. Usually the same index given to `cf_replication_server_set_entity`.
+ * @param    position   Where the entity is.
+ * @remarks  Moving an entity is cheap, so set every entity each tick. Clients find out on the next `cf_interest_update`.
+ * @related  CF_Interest cf_interest_remove_entity cf_interest_update
+ */
+CF_API void CF_CALL cf_interest_set_entity(CF_Interest interest, int entity, CF_V2 position);
+
+/**
+ * @function cf_interest_remove_entity
+ * @category net
+ * @brief    Removes an entity, which leaves every view it was in on the next `cf_interest_update`.
+ * @param    interest   The interest manager.
+ * @param    entity     The entity's index.
+ * @related  CF_Interest cf_interest_set_entity cf_interest_update
+ */
+CF_API void CF_CALL cf_interest_remove_entity(CF_Interest interest, int entity);
+
+/**
+ * @function cf_interest_set_view
+ * @category net
+ * @brief    Sets the region a client can see.
+ * @param    interest       The interest manager.
+ * @param    client_index   The client, indexed like `CF_ServerEvent`'s `client_index`.
+ * @param    view           The region. Entities inside it enter the client's view on the next `cf_interest_update`.
+ * @related  CF_Interest cf_interest_remove_view cf_interest_update
+ */
+CF_API void CF_CALL cf_interest_set_view(CF_Interest interest, int client_index, CF_Aabb view);
+
+/**
+ * @function cf_interest_remove_view
+ * @category net
+ * @brief    Removes a client's view, so everything it could see leaves on the next `cf_interest_update`.
+ * @param    interest       The interest manager.
+ * @param    client_index   The client.
+ * @remarks  Call this when a client disconnects.
+ * @related  CF_Interest cf_interest_set_view cf_interest_update
+ */
+CF_API void CF_CALL cf_interest_remove_view(CF_Interest interest, int client_index);
+
+/**
+ * @function cf_interest_update
+ * @category net
+ * @brief    Finds what each client sees now, and what entered and left each view since the last update.
+ * @param    interest   The interest manager.
+ * @param    pool       Can be `NULL`. A threadpool to spread the clients across, see `cf_make_threadpool`.
+ * @related  CF_Interest cf_interest_get_entered cf_interest_get_left cf_interest_get_visible
+ */
+CF_API void CF_CALL cf_interest_update(CF_Interest interest, CF_Threadpool* pool);
+
+/**
+ * @function cf_interest_get_entered
+ * @category net
+ * @brief    Returns the entities that entered a client's view during the last `cf_interest_update`, sorted by index.
+ * @param    interest       The interest manager.
+ * @param    client_index   The client.
+ * @param    count          Set to the number of entities returned.
+ * @remarks  The array is valid until the next `cf_interest_update`.
+ * @related  CF_Interest cf_interest_update cf_interest_get_left cf_interest_get_visible
+ */
+CF_API const int* CF_CALL cf_interest_get_entered(CF_Interest interest, int client_index, int* count);
+
+/**
+ * @function cf_interest_get_left
+ * @category net
+ * @brief    Returns the entities that left a client's view during the last `cf_interest_update`, sorted by index.
+ * @param    interest       The interest manager.
+ * @param    client_index   The client.
+ * @param    count          Set to the number of entities returned.
+ * @remarks  Includes entities removed with `cf_interest_remove_entity`. The array is valid until the next `cf_interest_update`.
+ * @related  CF_Interest cf_interest_update cf_interest_get_entered cf_interest_get_visible
+ */
+CF_API const int* CF_CALL cf_interest_get_left(CF_Interest interest, int client_index, int* count);
+
+/**
+ * @function cf_interest_get_visible
+ * @category net
+ * @brief    Returns every entity a client could see as of the last `cf_interest_update`, sorted by index.
+ * @param    interest       The interest manager.
+ * @param    client_index   The client.
+ * @param    count          Set to the number of entities returned.
+ * @remarks  The array is valid until the next `cf_interest_update`.
+ * @related  CF_Interest cf_interest_update cf_interest_get_entered cf_interest_get_left
+ */
+CF_API const int* CF_CALL cf_interest_get_visible(CF_Interest interest, int client_index, int* count);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using Interest = CF_Interest;
+
+CF_INLINE Interest make_interest(float cell_size, float leave_margin = 0) { return cf_make_interest(cell_size, leave_margin); }
+CF_INLINE void destroy_interest(Interest interest) { cf_destroy_interest(interest); }
+CF_INLINE void interest_set_entity(Interest interest, int entity, v2 position) { cf_interest_set_entity(interest, entity, position); }
+CF_INLINE void interest_remove_entity(Interest interest, int entity) { cf_interest_remove_entity(interest, entity); }
+CF_INLINE void interest_set_view(Interest interest, int client_index, Aabb view) { cf_interest_set_view(interest, client_index, view); }
+CF_INLINE void interest_remove_view(Interest interest, int client_index) { cf_interest_remove_view(interest, client_index); }
+CF_INLINE void interest_update(Interest interest, Threadpool* pool = NULL) { cf_interest_update(interest, pool); }
+CF_INLINE const int* interest_get_entered(Interest interest, int client_index, int* count) { return cf_interest_get_entered(interest, client_index, count); }
+CF_INLINE const int* interest_get_left(Interest interest, int client_index, int* count) { return cf_interest_get_left(interest, client_index, count); }
+CF_INLINE const int* interest_get_visible(Interest interest, int client_index, int* count) { return cf_interest_get_visible(interest, client_index, count); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_INTEREST_H
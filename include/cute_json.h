@@ -11,6 +11,7 @@
 #include "cute_defines.h"
 #include "cute_string.h"
 #include "cute_result.h"
+#include "cute_file_system.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -109,6 +110,40 @@ CF_API CF_JDoc CF_CALL cf_make_json(const void* data, size_t size);
  */
 CF_API CF_JDoc CF_CALL cf_make_json_from_file(const char* virtual_path);
 
+/**
+ * @function cf_make_json_readonly
+ * @category json
+ * @brief    Loads a json blob that will only be read, never modified.
+ * @param    data       A pointer to the raw json blob data.
+ * @param    size       The number of bytes in the `data` pointer.
+ * @return   Returns a `CF_JDoc`, or one with an `id` of zero if the json couldn't be parsed.
+ * @remarks  `cf_make_json` builds a mutable copy of the whole document after parsing it. A read-only document skips that copy,
+ *           taking roughly half the memory and time, which suits config and level files. Every function for fetching or iterating
+ *           values works as usual, but any function that creates or modifies values asserts. Free it with `cf_destroy_json`.
+ * @related  CF_JDoc cf_make_json cf_make_json_readonly_from_file cf_json_is_readonly cf_destroy_json
+ */
+CF_API CF_JDoc CF_CALL cf_make_json_readonly(const void* data, size_t size);
+
+/**
+ * @function cf_make_json_readonly_from_file
+ * @category json
+ * @brief    Loads a json file that will only be read, never modified.
+ * @param    virtual_path  A virtual path to the json file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @return   Returns a `CF_JDoc`, or one with an `id` of zero if the file is missing or couldn't be parsed.
+ * @remarks  The file is parsed in-place, so strings in the document point straight into the file's memory rather than being copied.
+ *           See `cf_make_json_readonly`.
+ * @related  CF_JDoc cf_make_json_from_file cf_make_json_readonly cf_json_is_readonly cf_destroy_json
+ */
+CF_API CF_JDoc CF_CALL cf_make_json_readonly_from_file(const char* virtual_path);
+
+/**
+ * @function cf_json_is_readonly
+ * @category json
+ * @brief    Returns true if the document was made by `cf_make_json_readonly` or `cf_make_json_readonly_from_file`.
+ * @related  CF_JDoc cf_make_json_readonly cf_make_json_readonly_from_file
+ */
+CF_API bool CF_CALL cf_json_is_readonly(CF_JDoc doc);
+
 /**
  * @function cf_destroy_json
  * @category json
@@ -275,6 +310,8 @@ CF_API int CF_CALL cf_json_get_len(CF_JVal val);
  * @param    val       The JSON value to search for `key` within.
  * @param    key       The search key.
  * @return   Returns the `CF_JVal` associated with `key` on the object `val`.
+ * @remarks  Lookups search the object's keys in order. Objects with many keys from a `cf_make_json_readonly` document are hashed
+ *           the second time in a row they're searched, so fetching many fields from a wide object stays fast.
  * @related  CF_JVal cf_json_get cf_json_array_at cf_json_array_get cf_json_iter
  */
 CF_API CF_JVal CF_CALL cf_json_get(CF_JVal val, const char* key);
@@ -286,7 +323,8 @@ CF_API CF_JVal CF_CALL cf_json_get(CF_JVal val, const char* key);
  * @param    val       The JSON value to search for `key` within.
  * @param    index     The index of the value to return.
  * @return   Returns the `CF_JVal` associated with `index` on the object `val`.
- * @remarks  This function does the same thing as `cf_json_array_get`.
+ * @remarks  This function does the same thing as `cf_json_array_get`. Fetching indices in increasing order, such as in a for loop, steps
+ *           along from the last index fetched, so looping over a whole array is linear rather than quadratic.
  * @related  CF_JVal cf_json_get cf_json_array_at cf_json_array_get cf_json_iter
  */
 CF_API CF_JVal CF_CALL cf_json_array_at(CF_JVal val, int index);
@@ -303,6 +341,32 @@ CF_API CF_JVal CF_CALL cf_json_array_at(CF_JVal val, int index);
  */
 CF_API CF_JVal CF_CALL cf_json_array_get(CF_JVal val, int index);
 
+/**
+ * @function cf_json_array_get_ints
+ * @category json
+ * @brief    Copies the elements of an array out as integers, in one pass.
+ * @param    arr       The JSON array.
+ * @param    out       Where to write the integers.
+ * @param    count     The capacity of `out`.
+ * @return   Returns the number of integers written, the lesser of `count` and the array's length. Returns 0 if `arr` isn't an array.
+ * @remarks  Elements are converted as by `cf_json_get_int`. Handy for large arrays such as tile maps.
+ * @related  CF_JVal cf_json_array_at cf_json_array_get_floats cf_json_get_len
+ */
+CF_API int CF_CALL cf_json_array_get_ints(CF_JVal arr, int* out, int count);
+
+/**
+ * @function cf_json_array_get_floats
+ * @category json
+ * @brief    Copies the elements of an array out as floats, in one pass.
+ * @param    arr       The JSON array.
+ * @param    out       Where to write the floats.
+ * @param    count     The capacity of `out`.
+ * @return   Returns the number of floats written, the lesser of `count` and the array's length. Returns 0 if `arr` isn't an array.
+ * @remarks  Elements are converted as by `cf_json_get_float`.
+ * @related  CF_JVal cf_json_array_at cf_json_array_get_ints cf_json_get_len
+ */
+CF_API int CF_CALL cf_json_array_get_floats(CF_JVal arr, float* out, int count);
+
 /**
  * @struct   CF_JIter
  * @category json
@@ -935,6 +999,476 @@ CF_API CF_Result CF_CALL cf_json_to_file(CF_JDoc doc, const char* virtual_path);
  */
 CF_API CF_Result CF_CALL cf_json_to_file_minimal(CF_JDoc doc, const char* virtual_path);
 
+/**
+ * @function cf_json_save_async
+ * @category json
+ * @brief    Saves the json document to a file on a background thread, without stalling the frame.
+ * @param    doc           The json document to save. The save takes ownership of it, so don't touch or destroy it afterwards.
+ * @param    virtual_path  A virtual path to the json file, within the write directory set with `cf_fs_set_write_directory`.
+ * @param    pretty        True to format as `cf_json_to_file` does, false to leave out all whitespace as `cf_json_to_file_minimal` does.
+ * @param    compress      True to compress the file with LZ4. `cf_make_json_from_file` and `cf_make_json_readonly_from_file` decompress it for you.
+ * @param    fn            Can be `NULL`. Called from `cf_fs_poll_async` once the file is on disk, see `CF_FileWriteFn`.
+ * @param    udata         Can be `NULL`. Handed back to you in `fn`.
+ * @return   Returns a `CF_FileRequest` for cancelling the save with `cf_fs_cancel_async`.
+ * @remarks  Meant for autosaves. Build a fresh document from your game state on the main thread, which is quick, then hand it over here.
+ *           Converting it to text, compressing and writing all happen on the I/O thread, and the file is replaced atomically, see
+ *           `cf_fs_write_async_serialized`. The document is destroyed on the I/O thread once written.
+ * @related  CF_JDoc cf_json_to_file cf_fs_write_async_serialized cf_fs_poll_async
+ */
+CF_API CF_FileRequest CF_CALL cf_json_save_async(CF_JDoc doc, const char* virtual_path, bool pretty, bool compress, CF_FileWriteFn* fn, void* udata);
+
+//--------------------------------------------------------------------------------------------------
+// Streaming writer.
+
+/**
+ * @struct   CF_JsonWriter
+ * @category json
+ * @brief    Writes JSON text value by value, without building a `CF_JDoc` first.
+ * @remarks  Good for large save files and telemetry dumps, where building a whole document would allocate a node per value. Text is
+ *           appended straight to a string, or to a file through a small fixed-size buffer, so memory use doesn't grow with the output.
+ *
+ *           ```cpp
+ *           CF_JsonWriter w = cf_make_json_writer_to_file("/save/telemetry.json", false);
+ *           cf_json_write_begin_object(w);
+ *           cf_json_write_key(w, "frames");
+ *           cf_json_write_begin_array(w);
+ *           for (int i = 0; i < frame_count; ++i) cf_json_write_float(w, frame_times[i]);
+ *           cf_json_write_end_array(w);
+ *           cf_json_write_end_object(w);
+ *           CF_Result result = cf_json_writer_finish(w);
+ *           cf_destroy_json_writer(w);
+ *           ```
+ * @related  CF_JsonWriter cf_make_json_writer cf_make_json_writer_to_file cf_json_writer_finish cf_destroy_json_writer
+ */
+typedef struct CF_JsonWriter { uint64_t id; } CF_JsonWriter;
+/* @end */
+
+/**
+ * @function cf_make_json_writer
+ * @category json
+ * @brief    Returns a `CF_JsonWriter` that writes into a string.
+ * @param    pretty     True to format as `cf_json_to_string` does, false to leave out all whitespace as `cf_json_to_string_minimal` does.
+ * @remarks  Fetch the text with `cf_json_writer_get_string`. Free the writer with `cf_destroy_json_writer` when done.
+ * @related  CF_JsonWriter cf_make_json_writer_to_file cf_json_writer_get_string cf_destroy_json_writer
+ */
+CF_API CF_JsonWriter CF_CALL cf_make_json_writer(bool pretty);
+
+/**
+ * @function cf_make_json_writer_to_file
+ * @category json
+ * @brief    Returns a `CF_JsonWriter` that writes into a file as it goes.
+ * @param    virtual_path  A virtual path to the json file. Make sure to setup your write directory with `cf_fs_set_write_directory`.
+ * @param    pretty        True to format as `cf_json_to_file` does, false to leave out all whitespace as `cf_json_to_file_minimal` does.
+ * @remarks  Call `cf_json_writer_finish` to write out the last of the text and check for errors, such as the file failing to open.
+ * @related  CF_JsonWriter cf_make_json_writer cf_json_writer_finish cf_destroy_json_writer
+ */
+CF_API CF_JsonWriter CF_CALL cf_make_json_writer_to_file(const char* virtual_path, bool pretty);
+
+/**
+ * @function cf_json_writer_finish
+ * @category json
+ * @brief    Writes out any buffered text and closes the file, if any.
+ * @param    w          The writer.
+ * @return   Returns any errors as `CF_Result`, such as failed writes or objects and arrays left open.
+ * @remarks  Nothing more can be written afterwards.
+ * @related  CF_JsonWriter cf_make_json_writer_to_file cf_destroy_json_writer
+ */
+CF_API CF_Result CF_CALL cf_json_writer_finish(CF_JsonWriter w);
+
+/**
+ * @function cf_destroy_json_writer
+ * @category json
+ * @brief    Frees a writer, first finishing it if needed.
+ * @param    w          The writer.
+ * @related  CF_JsonWriter cf_make_json_writer cf_make_json_writer_to_file cf_json_writer_finish
+ */
+CF_API void CF_CALL cf_destroy_json_writer(CF_JsonWriter w);
+
+/**
+ * @function cf_json_writer_get_string
+ * @category json
+ * @brief    Returns the text written so far by a writer from `cf_make_json_writer`.
+ * @param    w          The writer.
+ * @return   Returns `NULL` for a writer from `cf_make_json_writer_to_file`.
+ * @remarks  The string belongs to the writer, and is freed by `cf_destroy_json_writer`.
+ * @related  CF_JsonWriter cf_make_json_writer
+ */
+CF_API const char* CF_CALL cf_json_writer_get_string(CF_JsonWriter w);
+
+/**
+ * @function cf_json_write_begin_object
+ * @category json
+ * @brief    Opens an object, to be filled with `cf_json_write_key` and values, then closed with `cf_json_write_end_object`.
+ * @param    w          The writer.
+ * @related  CF_JsonWriter cf_json_write_end_object cf_json_write_key cf_json_write_begin_array
+ */
+CF_API void CF_CALL cf_json_write_begin_object(CF_JsonWriter w);
+
+/**
+ * @function cf_json_write_end_object
+ * @category json
+ * @brief    Closes the object opened by `cf_json_write_begin_object`.
+ * @param    w          The writer.
+ * @related  CF_JsonWriter cf_json_write_begin_object
+ */
+CF_API void CF_CALL cf_json_write_end_object(CF_JsonWriter w);
+
+/**
+ * @function cf_json_write_begin_array
+ * @category json
+ * @brief    Opens an array, to be filled with values, then closed with `cf_json_write_end_array`.
+ * @param    w          The writer.
+ * @related  CF_JsonWriter cf_json_write_end_array cf_json_write_begin_object
+ */
+CF_API void CF_CALL cf_json_write_begin_array(CF_JsonWriter w);
+
+/**
+ * @function cf_json_write_end_array
+ * @category json
+ * @brief    Closes the array opened by `cf_json_write_begin_array`.
+ * @param    w          The writer.
+ * @related  CF_JsonWriter cf_json_write_begin_array
+ */
+CF_API void CF_CALL cf_json_write_end_array(CF_JsonWriter w);
+
+/**
+ * @function cf_json_write_key
+ * @category json
+ * @brief    Writes the key of the next value within an object.
+ * @param    w          The writer.
+ * @param    key        The key.
+ * @remarks  Every value within an object must follow a key.
+ * @related  CF_JsonWriter cf_json_write_begin_object
+ */
+CF_API void CF_CALL cf_json_write_key(CF_JsonWriter w, const char* key);
+
+/**
+ * @function cf_json_write_null
+ * @category json
+ * @brief    Writes a null value.
+ * @param    w          The writer.
+ * @related  CF_JsonWriter cf_json_write_int cf_json_write_float cf_json_write_bool cf_json_write_string
+ */
+CF_API void CF_CALL cf_json_write_null(CF_JsonWriter w);
+
+/**
+ * @function cf_json_write_int
+ * @category json
+ * @brief    Writes an integer value.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_i64 cf_json_write_u64 cf_json_write_float
+ */
+CF_API void CF_CALL cf_json_write_int(CF_JsonWriter w, int val);
+
+/**
+ * @function cf_json_write_i64
+ * @category json
+ * @brief    Writes a 64-bit integer value.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_int cf_json_write_u64
+ */
+CF_API void CF_CALL cf_json_write_i64(CF_JsonWriter w, int64_t val);
+
+/**
+ * @function cf_json_write_u64
+ * @category json
+ * @brief    Writes an unsigned 64-bit integer value.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_int cf_json_write_i64
+ */
+CF_API void CF_CALL cf_json_write_u64(CF_JsonWriter w, uint64_t val);
+
+/**
+ * @function cf_json_write_float
+ * @category json
+ * @brief    Writes a float value, with the fewest digits that read back as the same float.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_double cf_json_write_int
+ */
+CF_API void CF_CALL cf_json_write_float(CF_JsonWriter w, float val);
+
+/**
+ * @function cf_json_write_double
+ * @category json
+ * @brief    Writes a double value, with the fewest digits that read back as the same double.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_float cf_json_write_int
+ */
+CF_API void CF_CALL cf_json_write_double(CF_JsonWriter w, double val);
+
+/**
+ * @function cf_json_write_bool
+ * @category json
+ * @brief    Writes a bool value.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_null cf_json_write_int
+ */
+CF_API void CF_CALL cf_json_write_bool(CF_JsonWriter w, bool val);
+
+/**
+ * @function cf_json_write_string
+ * @category json
+ * @brief    Writes a string value, escaped as needed.
+ * @param    w          The writer.
+ * @param    val        The value.
+ * @related  CF_JsonWriter cf_json_write_string_range cf_json_write_key
+ */
+CF_API void CF_CALL cf_json_write_string(CF_JsonWriter w, const char* val);
+
+/**
+ * @function cf_json_write_string_range
+ * @category json
+ * @brief    Writes a string value, escaped as needed.
+ * @param    w          The writer.
+ * @param    begin      The beginning of the string.
+ * @param    end        One past the end of the string.
+ * @related  CF_JsonWriter cf_json_write_string cf_json_write_key
+ */
+CF_API void CF_CALL cf_json_write_string_range(CF_JsonWriter w, const char* begin, const char* end);
+
+/**
+ * @function cf_json_write_base64
+ * @category json
+ * @brief    Writes binary data as a base64 encoded string value.
+ * @param    w          The writer.
+ * @param    data       The raw bytes to encode.
+ * @param    size       The size of `data` in bytes.
+ * @remarks  Useful for embedding thumbnails or replays within a save. The data is encoded a chunk at a time with `CF_Base64Encoder`,
+ *           so no encoded copy of the whole blob is ever made. Read it back with `cf_json_reader_get_base64`.
+ * @related  CF_JsonWriter cf_json_write_string cf_json_reader_get_base64 CF_Base64Encoder
+ */
+CF_API void CF_CALL cf_json_write_base64(CF_JsonWriter w, const void* data, size_t size);
+
+//--------------------------------------------------------------------------------------------------
+// Streaming reader.
+
+/**
+ * @struct   CF_JsonReader
+ * @category json
+ * @brief    Reads JSON text one token at a time, without building a `CF_JDoc` or loading the whole file.
+ * @remarks  Good for scanning huge files, such as analytics logs or giant levels. Files are read in fixed-size chunks, so memory use stays
+ *           bounded by the chunk size, the longest string and the deepest nesting, rather than the file size. Accepts the same relaxed
+ *           JSON as `cf_make_json`, including comments and trailing commas.
+ *
+ *           ```cpp
+ *           CF_JsonReader r = cf_make_json_reader_from_file("/logs/analytics.json");
+ *           CF_JToken token;
+ *           while ((token = cf_json_reader_next(r)) > CF_JTOKEN_ERROR) {
+ *               if (token == CF_JTOKEN_KEY && !CF_STRCMP(cf_json_reader_get_string(r), "frame_ms")) {
+ *                   if (cf_json_reader_next(r) == CF_JTOKEN_FLOAT) total += cf_json_reader_get_double(r);
+ *               }
+ *           }
+ *           if (token == CF_JTOKEN_ERROR) printf("%s\n", cf_json_reader_result(r).details);
+ *           cf_destroy_json_reader(r);
+ *           ```
+ * @related  CF_JsonReader CF_JToken cf_make_json_reader cf_make_json_reader_from_file cf_json_reader_next cf_destroy_json_reader
+ */
+typedef struct CF_JsonReader { uint64_t id; } CF_JsonReader;
+/* @end */
+
+/**
+ * @enum     CF_JToken
+ * @category json
+ * @brief    The tokens returned by `cf_json_reader_next`.
+ * @related  CF_JsonReader cf_json_reader_next cf_jtoken_to_string
+ */
+#define CF_JTOKEN_DEFS \
+	/* @entry The end of the text was reached. */                                                          \
+	CF_ENUM(JTOKEN_END,            0)                                                                       \
+	/* @entry The text isn't valid JSON, or couldn't be read. See `cf_json_reader_result`. */              \
+	CF_ENUM(JTOKEN_ERROR,          1)                                                                       \
+	/* @entry The start of an object. */                                                                   \
+	CF_ENUM(JTOKEN_BEGIN_OBJECT,   2)                                                                       \
+	/* @entry The end of an object. */                                                                     \
+	CF_ENUM(JTOKEN_END_OBJECT,     3)                                                                       \
+	/* @entry The start of an array. */                                                                    \
+	CF_ENUM(JTOKEN_BEGIN_ARRAY,    4)                                                                       \
+	/* @entry The end of an array. */                                                                      \
+	CF_ENUM(JTOKEN_END_ARRAY,      5)                                                                       \
+	/* @entry A key within an object, see `cf_json_reader_get_string`. Its value is the next token. */      \
+	CF_ENUM(JTOKEN_KEY,            6)                                                                       \
+	/* @entry Null. */                                                                                     \
+	CF_ENUM(JTOKEN_NULL,           7)                                                                       \
+	/* @entry Integer, see `cf_json_reader_get_i64`. */                                                    \
+	CF_ENUM(JTOKEN_INT,            8)                                                                       \
+	/* @entry Float, see `cf_json_reader_get_double`. */                                                   \
+	CF_ENUM(JTOKEN_FLOAT,          9)                                                                       \
+	/* @entry Boolean, see `cf_json_reader_get_bool`. */                                                   \
+	CF_ENUM(JTOKEN_BOOL,          10)                                                                       \
+	/* @entry String, see `cf_json_reader_get_string`. */                                                  \
+	CF_ENUM(JTOKEN_STRING,        11)                                                                       \
+	/* @end */
+
+typedef enum CF_JToken
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_JTOKEN_DEFS
+	#undef CF_ENUM
+} CF_JToken;
+
+/**
+ * @function cf_jtoken_to_string
+ * @category json
+ * @brief    Convert an enum `CF_JToken` to a c-style string.
+ * @param    token        The token to convert to a string.
+ * @related  CF_JsonReader CF_JToken
+ */
+CF_INLINE const char* cf_jtoken_to_string(CF_JToken token)
+{
+	switch (token) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_JTOKEN_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @function cf_make_json_reader
+ * @category json
+ * @brief    Returns a `CF_JsonReader` over JSON text in memory.
+ * @param    data       The JSON text. It must stay valid until the reader is destroyed.
+ * @param    size       The number of bytes in `data`.
+ * @remarks  Free it with `cf_destroy_json_reader` when done.
+ * @related  CF_JsonReader cf_make_json_reader_from_file cf_json_reader_next cf_destroy_json_reader
+ */
+CF_API CF_JsonReader CF_CALL cf_make_json_reader(const void* data, size_t size);
+
+/**
+ * @function cf_make_json_reader_from_file
+ * @category json
+ * @brief    Returns a `CF_JsonReader` that reads a JSON file a chunk at a time.
+ * @param    virtual_path  A virtual path to the json file. See [Virtual File System](https://randygaul.github.io/cute_framework/#/topics/virtual_file_system).
+ * @remarks  If the file can't be opened the first token is `CF_JTOKEN_ERROR`. Free it with `cf_destroy_json_reader` when done.
+ * @related  CF_JsonReader cf_make_json_reader cf_json_reader_next cf_destroy_json_reader
+ */
+CF_API CF_JsonReader CF_CALL cf_make_json_reader_from_file(const char* virtual_path);
+
+/**
+ * @function cf_destroy_json_reader
+ * @category json
+ * @brief    Frees a reader, closing its file if any.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_make_json_reader cf_make_json_reader_from_file
+ */
+CF_API void CF_CALL cf_destroy_json_reader(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_next
+ * @category json
+ * @brief    Reads the next token.
+ * @param    r          The reader.
+ * @return   Returns the token read, as `CF_JToken`. Returns `CF_JTOKEN_END` after the root value, and `CF_JTOKEN_ERROR` from the
+ *           first error on.
+ * @remarks  The value of the token is fetched with `cf_json_reader_get_string` and friends, and only until the next call.
+ * @related  CF_JsonReader CF_JToken cf_json_reader_skip cf_json_reader_get_string cf_json_reader_depth
+ */
+CF_API CF_JToken CF_CALL cf_json_reader_next(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_skip
+ * @category json
+ * @brief    Skips past whatever the last token started.
+ * @param    r          The reader.
+ * @remarks  After `CF_JTOKEN_BEGIN_OBJECT` or `CF_JTOKEN_BEGIN_ARRAY` this skips the rest of the object or array. After `CF_JTOKEN_KEY`
+ *           this skips the key's value. Otherwise it does nothing.
+ * @related  CF_JsonReader cf_json_reader_next
+ */
+CF_API void CF_CALL cf_json_reader_skip(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_depth
+ * @category json
+ * @brief    Returns how many objects and arrays the reader is within.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_json_reader_next
+ */
+CF_API int CF_CALL cf_json_reader_depth(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_string
+ * @category json
+ * @brief    Returns the text of the last `CF_JTOKEN_KEY` or `CF_JTOKEN_STRING`, with escapes decoded.
+ * @param    r          The reader.
+ * @remarks  Only valid until the next call to `cf_json_reader_next`. Returns an empty string for other tokens.
+ * @related  CF_JsonReader cf_json_reader_get_len cf_json_reader_next
+ */
+CF_API const char* CF_CALL cf_json_reader_get_string(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_len
+ * @category json
+ * @brief    Returns the length in bytes of `cf_json_reader_get_string`.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_json_reader_get_string
+ */
+CF_API int CF_CALL cf_json_reader_get_len(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_i64
+ * @category json
+ * @brief    Returns the value of the last `CF_JTOKEN_INT` or `CF_JTOKEN_FLOAT` as an integer.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_json_reader_get_u64 cf_json_reader_get_double
+ */
+CF_API int64_t CF_CALL cf_json_reader_get_i64(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_u64
+ * @category json
+ * @brief    Returns the value of the last `CF_JTOKEN_INT` or `CF_JTOKEN_FLOAT` as an unsigned integer.
+ * @param    r          The reader.
+ * @remarks  Use this for integers too large for `cf_json_reader_get_i64`.
+ * @related  CF_JsonReader cf_json_reader_get_i64 cf_json_reader_get_double
+ */
+CF_API uint64_t CF_CALL cf_json_reader_get_u64(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_double
+ * @category json
+ * @brief    Returns the value of the last `CF_JTOKEN_FLOAT` or `CF_JTOKEN_INT` as a double.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_json_reader_get_i64
+ */
+CF_API double CF_CALL cf_json_reader_get_double(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_bool
+ * @category json
+ * @brief    Returns the value of the last `CF_JTOKEN_BOOL`.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_json_reader_next
+ */
+CF_API bool CF_CALL cf_json_reader_get_bool(CF_JsonReader r);
+
+/**
+ * @function cf_json_reader_get_base64
+ * @category json
+ * @brief    Decodes the last `CF_JTOKEN_STRING` as base64, such as one written by `cf_json_write_base64`.
+ * @param    r          The reader.
+ * @param    dst        The destination buffer for the decoded bytes.
+ * @param    dst_size   The size of `dst` in bytes. `CF_BASE64_DECODED_SIZE(cf_json_reader_get_len(r))` is always enough.
+ * @param    out_size   Can be `NULL`. Set to the number of bytes decoded.
+ * @return   Returns any errors as a `CF_Result`, such as the string not being valid base64.
+ * @related  CF_JsonReader cf_json_reader_get_string cf_json_write_base64
+ */
+CF_API CF_Result CF_CALL cf_json_reader_get_base64(CF_JsonReader r, void* dst, size_t dst_size, size_t* out_size);
+
+/**
+ * @function cf_json_reader_result
+ * @category json
+ * @brief    Returns the error that stopped the reader, if any, including the line it happened on.
+ * @param    r          The reader.
+ * @related  CF_JsonReader cf_json_reader_next
+ */
+CF_API CF_Result CF_CALL cf_json_reader_result(CF_JsonReader r);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -945,6 +1479,7 @@ CF_API CF_Result CF_CALL cf_json_to_file_minimal(CF_JDoc doc, const char* virtua
 #ifdef CF_CPP
 
 using JType = CF_JType;
+using JToken = CF_JToken;
 
 namespace Cute
 {
@@ -988,6 +1523,8 @@ struct JVal
 	CF_INLINE JVal get(const char* key) const { return JVal(cf_json_get(v, key), d); }
 	CF_INLINE JVal get(int index) const { return JVal(cf_json_array_get(v, index), d); }
 	CF_INLINE JVal at(int index) const { return JVal(cf_json_array_at(v, index), d); }
+	CF_INLINE int get_ints(int* out, int count) const { return cf_json_array_get_ints(v, out, count); }
+	CF_INLINE int get_floats(float* out, int count) const { return cf_json_array_get_floats(v, out, count); }
 	CF_INLINE int get_int() const { return cf_json_get_int(v); }
 	CF_INLINE int64_t get_i64() const { return cf_json_get_i64(v); }
 	CF_INLINE uint64_t get_u64() const { return cf_json_get_u64(v); }
@@ -1065,8 +1602,11 @@ struct JDoc
 	CF_INLINE static JDoc make() { return JDoc(cf_make_json(NULL, 0)); }
 	CF_INLINE static JDoc make(const void* data, size_t size) { return JDoc(cf_make_json(data, size)); }
 	CF_INLINE static JDoc make(const char* virtual_path) { return JDoc(cf_make_json_from_file(virtual_path)); }
+	CF_INLINE static JDoc make_readonly(const void* data, size_t size) { return JDoc(cf_make_json_readonly(data, size)); }
+	CF_INLINE static JDoc make_readonly(const char* virtual_path) { return JDoc(cf_make_json_readonly_from_file(virtual_path)); }
 	CF_INLINE static void destroy(JDoc doc) { cf_destroy_json(doc.d); }
 	CF_INLINE void destroy() { cf_destroy_json(d); }
+	CF_INLINE bool is_readonly() const { return cf_json_is_readonly(d); }
 
 	CF_INLINE void set_root(JVal v) { cf_json_set_root(d, v.v); }
 	CF_INLINE JVal root() const { return JVal(cf_json_get_root(d), d); }
@@ -1103,11 +1643,72 @@ struct JDoc
 	CF_INLINE String to_string_minimal() { return String::steal_from(cf_json_to_string_minimal(d)); }
 	CF_INLINE void to_file_minimal(const char* virtual_path) { cf_json_to_file_minimal(d, virtual_path); }
 
+	// Takes ownership of the document, so don't call `destroy` afterwards.
+	CF_INLINE FileRequest save_async(const char* virtual_path, bool pretty = true, bool compress = false, FileWriteFn* fn = NULL, void* udata = NULL) { return cf_json_save_async(d, virtual_path, pretty, compress, fn, udata); }
+
 private:
 	CF_INLINE JDoc(CF_JDoc d) { this->d = d; }
 	CF_JDoc d;
 };
 
+// Writes JSON text value by value, without building a JDoc. Be sure to call `destroy` when you're done.
+struct JWriter
+{
+	CF_INLINE static JWriter make(bool pretty = true) { return JWriter(cf_make_json_writer(pretty)); }
+	CF_INLINE static JWriter make(const char* virtual_path, bool pretty = true) { return JWriter(cf_make_json_writer_to_file(virtual_path, pretty)); }
+	CF_INLINE Result finish() { return cf_json_writer_finish(w); }
+	CF_INLINE void destroy() { cf_destroy_json_writer(w); }
+	CF_INLINE const char* string() const { return cf_json_writer_get_string(w); }
+
+	CF_INLINE JWriter& begin_object() { cf_json_write_begin_object(w); return *this; }
+	CF_INLINE JWriter& end_object() { cf_json_write_end_object(w); return *this; }
+	CF_INLINE JWriter& begin_array() { cf_json_write_begin_array(w); return *this; }
+	CF_INLINE JWriter& end_array() { cf_json_write_end_array(w); return *this; }
+	CF_INLINE JWriter& key(const char* key) { cf_json_write_key(w, key); return *this; }
+
+	CF_INLINE JWriter& write_null() { cf_json_write_null(w); return *this; }
+	CF_INLINE JWriter& write(int v) { cf_json_write_int(w, v); return *this; }
+	CF_INLINE JWriter& write(int64_t v) { cf_json_write_i64(w, v); return *this; }
+	CF_INLINE JWriter& write(uint64_t v) { cf_json_write_u64(w, v); return *this; }
+	CF_INLINE JWriter& write(float v) { cf_json_write_float(w, v); return *this; }
+	CF_INLINE JWriter& write(double v) { cf_json_write_double(w, v); return *this; }
+	CF_INLINE JWriter& write(bool v) { cf_json_write_bool(w, v); return *this; }
+	CF_INLINE JWriter& write(const char* v) { cf_json_write_string(w, v); return *this; }
+	CF_INLINE JWriter& write(const char* begin, const char* end) { cf_json_write_string_range(w, begin, end); return *this; }
+	CF_INLINE JWriter& write_base64(const void* data, size_t size) { cf_json_write_base64(w, data, size); return *this; }
+
+private:
+	CF_INLINE JWriter(CF_JsonWriter w) { this->w = w; }
+	CF_JsonWriter w;
+};
+
+// Reads JSON text one token at a time, without building a JDoc. Be sure to call `destroy` when you're done.
+struct JReader
+{
+	CF_INLINE static JReader make(const void* data, size_t size) { return JReader(cf_make_json_reader(data, size)); }
+	CF_INLINE static JReader make(const char* virtual_path) { return JReader(cf_make_json_reader_from_file(virtual_path)); }
+	CF_INLINE void destroy() { cf_destroy_json_reader(r); }
+
+	CF_INLINE JToken next() { return cf_json_reader_next(r); }
+	CF_INLINE void skip() { cf_json_reader_skip(r); }
+	CF_INLINE int depth() const { return cf_json_reader_depth(r); }
+	CF_INLINE Result result() const { return cf_json_reader_result(r); }
+
+	CF_INLINE const char* get_string() const { return cf_json_reader_get_string(r); }
+	CF_INLINE int get_len() const { return cf_json_reader_get_len(r); }
+	CF_INLINE int get_int() const { return (int)cf_json_reader_get_i64(r); }
+	CF_INLINE int64_t get_i64() const { return cf_json_reader_get_i64(r); }
+	CF_INLINE uint64_t get_u64() const { return cf_json_reader_get_u64(r); }
+	CF_INLINE float get_float() const { return (float)cf_json_reader_get_double(r); }
+	CF_INLINE double get_double() const { return cf_json_reader_get_double(r); }
+	CF_INLINE bool get_bool() const { return cf_json_reader_get_bool(r); }
+	CF_INLINE Result get_base64(void* dst, size_t dst_size, size_t* out_size = NULL) const { return cf_json_reader_get_base64(r, dst, dst_size, out_size); }
+
+private:
+	CF_INLINE JReader(CF_JsonReader r) { this->r = r; }
+	CF_JsonReader r;
+};
+
 // Inline implementations placed down here, as opposed to inside the class, to avoid circular reference compile errors.
 CF_INLINE bool JIter::done() const { return cf_json_iter_done(i); }
 CF_INLINE const char* JIter::key() const { return cf_json_iter_key(i); }
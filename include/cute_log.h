@@ -0,0 +1,205 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_LOG_H
+#define CF_LOG_H
+
+#include "cute_defines.h"
+#include "cute_result.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @enum     CF_LogLevel
+ * @category log
+ * @brief    How important a log message is, see `cf_log`.
+ * @related  CF_LogLevel cf_log_level_to_string cf_log cf_log_set_level
+ */
+#define CF_LOG_LEVEL_DEFS \
+	/* @entry Chatty details only useful while chasing down a problem. `CF_DEBUG_PRINTF` logs at this level. */ \
+	CF_ENUM(LOG_LEVEL_DEBUG,   0)                                                                            \
+	/* @entry Notable events, such as a client connecting or a level loading. */                             \
+	CF_ENUM(LOG_LEVEL_INFO,    1)                                                                            \
+	/* @entry Something went wrong, but was recovered from. */                                               \
+	CF_ENUM(LOG_LEVEL_WARNING, 2)                                                                            \
+	/* @entry Something went wrong. */                                                                       \
+	CF_ENUM(LOG_LEVEL_ERROR,   3)                                                                            \
+	/* @end */
+
+typedef enum CF_LogLevel
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_LOG_LEVEL_DEFS
+	#undef CF_ENUM
+} CF_LogLevel;
+
+/**
+ * @function cf_log_level_to_string
+ * @category log
+ * @brief    Returns a `CF_LogLevel` converted to a C string.
+ * @related  CF_LogLevel cf_log_level_to_string
+ */
+CF_INLINE const char* cf_log_level_to_string(CF_LogLevel level)
+{
+	switch (level) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_LOG_LEVEL_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @struct   CF_LogSinkFn
+ * @category log
+ * @brief    A function called with each formatted log message, see `cf_log_set_sink`.
+ * @param    level      The level the message was logged at.
+ * @param    message    The formatted message, without a trailing newline. Only valid during the call.
+ * @param    udata      The `udata` given to `cf_log_set_sink`.
+ * @remarks  Called from the background log thread, or from whichever thread calls `cf_log_flush`, but never from two threads at once.
+ * @related  CF_LogSinkFn cf_log_set_sink
+ */
+typedef void (CF_LogSinkFn)(CF_LogLevel level, const char* message, void* udata);
+// @end
+
+/**
+ * @struct   CF_LogStats
+ * @category log
+ * @brief    Counters for the log, see `cf_log_stats`.
+ * @related  CF_LogStats cf_log_stats cf_log
+ */
+typedef struct CF_LogStats
+{
+	/* @member Messages formatted and handed to the sinks. */
+	uint64_t written_count;
+
+	/* @member Messages thrown away because their thread's buffer was full. */
+	uint64_t dropped_count;
+
+	/* @member Messages that were cut short because they didn't fit in one record. */
+	uint64_t truncated_count;
+} CF_LogStats;
+// @end
+
+/**
+ * @function cf_log
+ * @category log
+ * @brief    Logs a printf-style message.
+ * @param    level      How important the message is. Messages below `cf_log_set_level` are skipped.
+ * @param    fmt        A printf-style format string. Must be a string literal, or otherwise stay valid until the message is written.
+ * @remarks  The message isn't formatted here. Its arguments are copied into a lock-free buffer owned by the calling thread, and a
+ *           background thread formats and writes them out a few milliseconds later. This keeps logging cheap enough to leave on
+ *           in shipped games, from any thread. Strings passed with `%s` are copied, so they may be freed right away.
+ *
+ *           If a thread logs faster than the background thread keeps up, messages are dropped instead of stalling the caller,
+ *           and counted in `cf_log_stats`. `%n` isn't supported.
+ * @related  cf_log cf_log_flush cf_log_set_level cf_log_set_stdout cf_log_set_file cf_log_set_sink cf_log_stats
+ */
+CF_API void CF_CALL cf_log(CF_LogLevel level, const char* fmt, ...);
+
+/**
+ * @function cf_log_flush
+ * @category log
+ * @brief    Writes out every message logged so far, on the calling thread, before returning.
+ * @remarks  Call this before a crash handler exits, or before reading back a log file.
+ * @related  cf_log cf_log_flush cf_log_set_file
+ */
+CF_API void CF_CALL cf_log_flush();
+
+/**
+ * @function cf_log_set_level
+ * @category log
+ * @brief    Skips messages below `level`. Defaults to `CF_LOG_LEVEL_DEBUG`, which logs everything.
+ * @param    level      The least important level to log.
+ * @related  CF_LogLevel cf_log cf_log_set_level
+ */
+CF_API void CF_CALL cf_log_set_level(CF_LogLevel level);
+
+/**
+ * @function cf_log_set_stdout
+ * @category log
+ * @brief    Sets whether messages are printed to stdout. On by default.
+ * @param    enabled    True to print messages.
+ * @related  cf_log cf_log_set_stdout cf_log_set_file cf_log_set_sink
+ */
+CF_API void CF_CALL cf_log_set_stdout(bool enabled);
+
+/**
+ * @function cf_log_set_file
+ * @category log
+ * @brief    Appends messages to a file, or stops writing to one.
+ * @param    virtual_path  A virtual path (see: `cf_fs_set_write_directory`) to append to, or `NULL` to close the current file.
+ * @return   Returns any errors as a `CF_Result`.
+ * @remarks  Messages already logged but not yet written go to the new file. Only one file is open at a time.
+ * @related  cf_log cf_log_set_stdout cf_log_set_file cf_log_set_sink cf_log_flush
+ */
+CF_API CF_Result CF_CALL cf_log_set_file(const char* virtual_path);
+
+/**
+ * @function cf_log_set_sink
+ * @category log
+ * @brief    Hands each message to a function, such as one sending them over the network to a log server.
+ * @param    fn         Called with each message, see `CF_LogSinkFn`. `NULL` removes the current sink.
+ * @param    udata      Passed back to `fn`.
+ * @remarks  The sink runs on the background log thread, so it may block without stalling the game, but messages pile up behind it.
+ * @related  CF_LogSinkFn cf_log cf_log_set_stdout cf_log_set_file cf_log_set_sink
+ */
+CF_API void CF_CALL cf_log_set_sink(CF_LogSinkFn* fn, void* udata);
+
+/**
+ * @function cf_log_stats
+ * @category log
+ * @brief    Returns counters of messages written, dropped and truncated since the program started.
+ * @related  CF_LogStats cf_log
+ */
+CF_API CF_LogStats CF_CALL cf_log_stats();
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using LogLevel = CF_LogLevel;
+#define CF_ENUM(K, V) CF_INLINE constexpr LogLevel K = CF_##K;
+CF_LOG_LEVEL_DEFS
+#undef CF_ENUM
+
+CF_INLINE constexpr const char* to_string(LogLevel level) { switch(level) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_LOG_LEVEL_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+using LogSinkFn = CF_LogSinkFn;
+using LogStats = CF_LogStats;
+
+CF_INLINE void log_flush() { cf_log_flush(); }
+CF_INLINE void log_set_level(LogLevel level) { cf_log_set_level(level); }
+CF_INLINE void log_set_stdout(bool enabled) { cf_log_set_stdout(enabled); }
+CF_INLINE Result log_set_file(const char* virtual_path) { return cf_log_set_file(virtual_path); }
+CF_INLINE void log_set_sink(LogSinkFn* fn, void* udata = NULL) { cf_log_set_sink(fn, udata); }
+CF_INLINE LogStats log_stats() { return cf_log_stats(); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_LOG_H
@@ -0,0 +1,174 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_MANIFEST_H
+#define CF_MANIFEST_H
+
+#include "cute_defines.h"
+#include "cute_result.h"
+#include "cute_audio.h"
+#include "cute_json.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_Manifest
+ * @category manifest
+ * @brief    A list of the assets a scene needs, for loading them all up front instead of mid-gameplay.
+ * @remarks  A manifest is a JSON file listing assets by virtual path, one array per kind of asset. Every array is optional.
+ *
+ *           ```json
+ *           {
+ *               "include": [ "/levels/common.manifest" ],
+ *               "sprites": [ "/art/hero.ase", "/art/slime.ase" ],
+ *               "fonts": [ "/fonts/pixel.ttf", { "path": "/fonts/title.ttf", "name": "title" } ],
+ *               "audio": [ "/sfx/jump.wav", "/music/forest.ogg" ],
+ *               "json": [ "/levels/forest.json" ]
+ *           }
+ *           ```
+ *
+ *           Each included manifest's assets become part of this one, so assets shared by many scenes can be listed once. Sprites are
+ *           .ase or .aseprite files. Fonts are named after their path, unless given a name. Audio is .wav or .ogg.
+ * @related  CF_Manifest cf_make_manifest cf_manifest_load cf_manifest_unload cf_manifest_progress
+ */
+typedef struct CF_Manifest { uint64_t id; } CF_Manifest;
+// @end
+
+/**
+ * @function cf_make_manifest
+ * @category manifest
+ * @brief    Reads a manifest, along with every manifest it includes.
+ * @param    virtual_path  The virtual path to a manifest file, see `CF_Manifest`.
+ * @param    result_out    Can be `NULL`. Any errors, such as a missing file or include, as `CF_Result`.
+ * @return   Returns a `CF_Manifest` ready for `cf_manifest_load`. Nothing is loaded yet.
+ * @remarks  Free it with `cf_destroy_manifest` when done. On error the manifest still lists whatever assets could be read.
+ * @related  CF_Manifest cf_destroy_manifest cf_manifest_load
+ */
+CF_API CF_Manifest CF_CALL cf_make_manifest(const char* virtual_path, CF_Result* result_out);
+
+/**
+ * @function cf_destroy_manifest
+ * @category manifest
+ * @brief    Frees a manifest, unloading its assets first if loaded.
+ * @param    manifest      The manifest to destroy.
+ * @related  CF_Manifest cf_make_manifest cf_manifest_unload
+ */
+CF_API void CF_CALL cf_destroy_manifest(CF_Manifest manifest);
+
+/**
+ * @function cf_manifest_load
+ * @category manifest
+ * @brief    Starts loading every asset in a manifest, without blocking.
+ * @param    manifest      The manifest to load.
+ * @remarks  Files are read on the background I/O thread of `cf_fs_read_async`, and audio decodes on the app's threadpool. Sprites, fonts
+ *           and JSON are finished as their files arrive in `cf_fs_poll_async`, so keep calling that once per frame, and check
+ *           `cf_manifest_progress` for a loading screen. Assets are reference counted across manifests: an asset already loaded by another
+ *           manifest is shared rather than loaded again. Once loaded, use the assets as usual, such as with `cf_make_sprite` or
+ *           `cf_push_font`, or fetch them with `cf_manifest_get_audio` and `cf_manifest_get_json`. Loading a loaded manifest does nothing.
+ * @related  CF_Manifest cf_manifest_unload cf_manifest_progress cf_manifest_is_loaded cf_manifest_result
+ */
+CF_API void CF_CALL cf_manifest_load(CF_Manifest manifest);
+
+/**
+ * @function cf_manifest_unload
+ * @category manifest
+ * @brief    Releases every asset in a manifest, unloading those no other loaded manifest uses.
+ * @param    manifest      The manifest to unload.
+ * @remarks  To move between scenes, load the next scene's manifest and then unload the current one. Assets both scenes share stay
+ *           loaded, while the rest are freed. Reads still in flight are cancelled. Sprites made from an unloaded manifest are left
+ *           dangling, as with `cf_sprite_unload`.
+ * @related  CF_Manifest cf_manifest_load cf_destroy_manifest
+ */
+CF_API void CF_CALL cf_manifest_unload(CF_Manifest manifest);
+
+/**
+ * @function cf_manifest_progress
+ * @category manifest
+ * @brief    Returns how much of a loading manifest has finished, from 0 to 1.
+ * @param    manifest      The manifest to check.
+ * @remarks  Counts assets rather than bytes. Assets that failed to load count as finished, see `cf_manifest_result`. Returns 0 for a
+ *           manifest that isn't loaded.
+ * @related  CF_Manifest cf_manifest_load cf_manifest_is_loaded
+ */
+CF_API float CF_CALL cf_manifest_progress(CF_Manifest manifest);
+
+/**
+ * @function cf_manifest_is_loaded
+ * @category manifest
+ * @brief    Returns true once every asset in a loading manifest has finished.
+ * @param    manifest      The manifest to check.
+ * @related  CF_Manifest cf_manifest_load cf_manifest_progress cf_manifest_result
+ */
+CF_API bool CF_CALL cf_manifest_is_loaded(CF_Manifest manifest);
+
+/**
+ * @function cf_manifest_result
+ * @category manifest
+ * @brief    Returns the first error from reading a manifest or loading its assets, if any.
+ * @param    manifest      The manifest to check.
+ * @related  CF_Manifest cf_make_manifest cf_manifest_load cf_manifest_is_loaded
+ */
+CF_API CF_Result CF_CALL cf_manifest_result(CF_Manifest manifest);
+
+/**
+ * @function cf_manifest_get_audio
+ * @category manifest
+ * @brief    Returns audio loaded by a manifest.
+ * @param    manifest      The manifest listing the audio.
+ * @param    virtual_path  The path of the audio, as listed in the manifest.
+ * @return   Returns a `CF_Audio` with an `id` of zero if the manifest isn't loaded or doesn't list the audio.
+ * @remarks  Don't call `cf_audio_destroy` on it, the manifest owns it. It may still be loading, see `cf_audio_is_ready`.
+ * @related  CF_Manifest cf_manifest_load cf_manifest_get_json
+ */
+CF_API CF_Audio CF_CALL cf_manifest_get_audio(CF_Manifest manifest, const char* virtual_path);
+
+/**
+ * @function cf_manifest_get_json
+ * @category manifest
+ * @brief    Returns a JSON document loaded by a manifest.
+ * @param    manifest      The manifest listing the document.
+ * @param    virtual_path  The path of the document, as listed in the manifest.
+ * @return   Returns a `CF_JDoc` with an `id` of zero if the document isn't loaded yet, failed to parse, or isn't listed.
+ * @remarks  Don't call `cf_destroy_json` on it, the manifest owns it.
+ * @related  CF_Manifest cf_manifest_load cf_manifest_get_audio
+ */
+CF_API CF_JDoc CF_CALL cf_manifest_get_json(CF_Manifest manifest, const char* virtual_path);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using Manifest = CF_Manifest;
+
+CF_INLINE Manifest make_manifest(const char* virtual_path, Result* result_out = NULL) { return cf_make_manifest(virtual_path, result_out); }
+CF_INLINE void destroy_manifest(Manifest manifest) { cf_destroy_manifest(manifest); }
+CF_INLINE void manifest_load(Manifest manifest) { cf_manifest_load(manifest); }
+CF_INLINE void manifest_unload(Manifest manifest) { cf_manifest_unload(manifest); }
+CF_INLINE float manifest_progress(Manifest manifest) { return cf_manifest_progress(manifest); }
+CF_INLINE bool manifest_is_loaded(Manifest manifest) { return cf_manifest_is_loaded(manifest); }
+CF_INLINE Result manifest_result(Manifest manifest) { return cf_manifest_result(manifest); }
+CF_INLINE Audio manifest_get_audio(Manifest manifest, const char* virtual_path) { return cf_manifest_get_audio(manifest, virtual_path); }
+CF_INLINE CF_JDoc manifest_get_json(Manifest manifest, const char* virtual_path) { return cf_manifest_get_json(manifest, virtual_path); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_MANIFEST_H
@@ -1262,6 +1262,33 @@ CF_INLINE CF_V2 cf_mul_m32_v2(CF_M3x2 a, CF_V2 b) { return cf_add_v2(cf_mul_m2_v
  */
 CF_INLINE CF_M3x2 cf_mul_m32(CF_M3x2 a, CF_M3x2 b) { CF_M3x2 c; c.m = cf_mul_m2(a.m, b.m); c.p = cf_add_v2(cf_mul_m2_v2(a.m, b.p), a.p); return c; }
 
+/**
+ * @function cf_mul_m32_v2_batch
+ * @category math
+ * @brief    Multiplies an array of vectors by a `CF_M3x2`, same as calling `cf_mul_m32_v2` on each one.
+ * @param    m          The matrix.
+ * @param    in         The vectors to transform.
+ * @param    out        Receives `count` transformed vectors. May be the same array as `in`.
+ * @param    count      The number of vectors.
+ * @remarks  Vectors are transformed two at a time with SIMD instructions, which is much faster for large arrays such as the positions of
+ *           thousands of entities.
+ * @related  CF_M3x2 cf_mul_m32_v2 cf_mul_m32_v2_batch cf_mul_m32_batch
+ */
+CF_API void CF_CALL cf_mul_m32_v2_batch(CF_M3x2 m, const CF_V2* in, CF_V2* out, int count);
+
+/**
+ * @function cf_mul_m32_batch
+ * @category math
+ * @brief    Composes a `CF_M3x2` with an array of others, same as calling `cf_mul_m32(m, in[i])` on each one.
+ * @param    m          The matrix applied last, such as a camera.
+ * @param    in         The matrices to compose with, such as each entity's own transform.
+ * @param    out        Receives `count` matrices. May be the same array as `in`.
+ * @param    count      The number of matrices.
+ * @remarks  Uses SIMD instructions, see `cf_mul_m32_v2_batch`.
+ * @related  CF_M3x2 cf_mul_m32 cf_mul_m32_v2_batch cf_mul_m32_batch
+ */
+CF_API void CF_CALL cf_mul_m32_batch(CF_M3x2 m, const CF_M3x2* in, CF_M3x2* out, int count);
+
 /**
  * @function cf_make_identity
  * @category math
@@ -2430,6 +2457,86 @@ CF_API CF_Manifold CF_CALL cf_capsule_to_poly_manifold(CF_Capsule A, const CF_Po
  */
 CF_API CF_Manifold CF_CALL cf_poly_to_poly_manifold(const CF_Poly* A, const CF_Transform* ax, const CF_Poly* B, const CF_Transform* bx);
 
+/**
+ * @function cf_circle_to_circle_manifold_batch
+ * @category collision
+ * @brief    Computes manifolds for many pairs of shapes at once.
+ * @param    A          The first shape of each pair.
+ * @param    B          The second shape of each pair.
+ * @param    count      The number of pairs, i.e. the number of elements in `A`, `B` and `out`.
+ * @param    out        Receives one `CF_Manifold` per pair, `A[i]` against `B[i]`. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Produces the same results as calling `cf_circle_to_circle_manifold` on each pair, but much faster for many pairs. Pairs are checked
+ *           four at a time with SIMD instructions, and the full manifold is only computed for pairs that might overlap.
+ *           This is meant for the narrowphase, run over all the pairs found by a broadphase such as `CF_AabbTree`.
+ * @related  CF_Manifold cf_circle_to_circle_manifold_batch cf_circle_to_aabb_manifold_batch cf_circle_to_capsule_manifold_batch cf_aabb_to_aabb_manifold_batch cf_aabb_to_capsule_manifold_batch cf_capsule_to_capsule_manifold_batch cf_collide_batch
+ */
+CF_API void CF_CALL cf_circle_to_circle_manifold_batch(const CF_Circle* A, const CF_Circle* B, int count, CF_Manifold* out);
+
+/**
+ * @function cf_circle_to_aabb_manifold_batch
+ * @category collision
+ * @brief    Computes manifolds for many pairs of shapes at once.
+ * @param    A          The first shape of each pair.
+ * @param    B          The second shape of each pair.
+ * @param    count      The number of pairs, i.e. the number of elements in `A`, `B` and `out`.
+ * @param    out        Receives one `CF_Manifold` per pair, `A[i]` against `B[i]`. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Produces the same results as calling `cf_circle_to_aabb_manifold` on each pair. See `cf_circle_to_circle_manifold_batch` for details.
+ * @related  CF_Manifold cf_circle_to_circle_manifold_batch cf_circle_to_aabb_manifold_batch cf_circle_to_capsule_manifold_batch cf_aabb_to_aabb_manifold_batch cf_aabb_to_capsule_manifold_batch cf_capsule_to_capsule_manifold_batch cf_collide_batch
+ */
+CF_API void CF_CALL cf_circle_to_aabb_manifold_batch(const CF_Circle* A, const CF_Aabb* B, int count, CF_Manifold* out);
+
+/**
+ * @function cf_circle_to_capsule_manifold_batch
+ * @category collision
+ * @brief    Computes manifolds for many pairs of shapes at once.
+ * @param    A          The first shape of each pair.
+ * @param    B          The second shape of each pair.
+ * @param    count      The number of pairs, i.e. the number of elements in `A`, `B` and `out`.
+ * @param    out        Receives one `CF_Manifold` per pair, `A[i]` against `B[i]`. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Produces the same results as calling `cf_circle_to_capsule_manifold` on each pair. See `cf_circle_to_circle_manifold_batch` for details.
+ * @related  CF_Manifold cf_circle_to_circle_manifold_batch cf_circle_to_aabb_manifold_batch cf_circle_to_capsule_manifold_batch cf_aabb_to_aabb_manifold_batch cf_aabb_to_capsule_manifold_batch cf_capsule_to_capsule_manifold_batch cf_collide_batch
+ */
+CF_API void CF_CALL cf_circle_to_capsule_manifold_batch(const CF_Circle* A, const CF_Capsule* B, int count, CF_Manifold* out);
+
+/**
+ * @function cf_aabb_to_aabb_manifold_batch
+ * @category collision
+ * @brief    Computes manifolds for many pairs of shapes at once.
+ * @param    A          The first shape of each pair.
+ * @param    B          The second shape of each pair.
+ * @param    count      The number of pairs, i.e. the number of elements in `A`, `B` and `out`.
+ * @param    out        Receives one `CF_Manifold` per pair, `A[i]` against `B[i]`. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Produces the same results as calling `cf_aabb_to_aabb_manifold` on each pair. See `cf_circle_to_circle_manifold_batch` for details.
+ * @related  CF_Manifold cf_circle_to_circle_manifold_batch cf_circle_to_aabb_manifold_batch cf_circle_to_capsule_manifold_batch cf_aabb_to_aabb_manifold_batch cf_aabb_to_capsule_manifold_batch cf_capsule_to_capsule_manifold_batch cf_collide_batch
+ */
+CF_API void CF_CALL cf_aabb_to_aabb_manifold_batch(const CF_Aabb* A, const CF_Aabb* B, int count, CF_Manifold* out);
+
+/**
+ * @function cf_aabb_to_capsule_manifold_batch
+ * @category collision
+ * @brief    Computes manifolds for many pairs of shapes at once.
+ * @param    A          The first shape of each pair.
+ * @param    B          The second shape of each pair.
+ * @param    count      The number of pairs, i.e. the number of elements in `A`, `B` and `out`.
+ * @param    out        Receives one `CF_Manifold` per pair, `A[i]` against `B[i]`. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Produces the same results as calling `cf_aabb_to_capsule_manifold` on each pair. See `cf_circle_to_circle_manifold_batch` for details.
+ * @related  CF_Manifold cf_circle_to_circle_manifold_batch cf_circle_to_aabb_manifold_batch cf_circle_to_capsule_manifold_batch cf_aabb_to_aabb_manifold_batch cf_aabb_to_capsule_manifold_batch cf_capsule_to_capsule_manifold_batch cf_collide_batch
+ */
+CF_API void CF_CALL cf_aabb_to_capsule_manifold_batch(const CF_Aabb* A, const CF_Capsule* B, int count, CF_Manifold* out);
+
+/**
+ * @function cf_capsule_to_capsule_manifold_batch
+ * @category collision
+ * @brief    Computes manifolds for many pairs of shapes at once.
+ * @param    A          The first shape of each pair.
+ * @param    B          The second shape of each pair.
+ * @param    count      The number of pairs, i.e. the number of elements in `A`, `B` and `out`.
+ * @param    out        Receives one `CF_Manifold` per pair, `A[i]` against `B[i]`. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Produces the same results as calling `cf_capsule_to_capsule_manifold` on each pair. See `cf_circle_to_circle_manifold_batch` for details.
+ * @related  CF_Manifold cf_circle_to_circle_manifold_batch cf_circle_to_aabb_manifold_batch cf_circle_to_capsule_manifold_batch cf_aabb_to_aabb_manifold_batch cf_aabb_to_capsule_manifold_batch cf_capsule_to_capsule_manifold_batch cf_collide_batch
+ */
+CF_API void CF_CALL cf_capsule_to_capsule_manifold_batch(const CF_Capsule* A, const CF_Capsule* B, int count, CF_Manifold* out);
+
 /**
  * @struct   CF_GjkCache
  * @category collision
@@ -2579,6 +2686,24 @@ CF_API int CF_CALL cf_collided(const void* A, const CF_Transform* ax, CF_ShapeTy
  */
 CF_API void CF_CALL cf_collide(const void* A, const CF_Transform* ax, CF_ShapeType typeA, const void* B, const CF_Transform* bx, CF_ShapeType typeB, CF_Manifold* m);
 
+/**
+ * @function cf_collide_batch
+ * @category collision
+ * @brief    Computes a `CF_Manifold` for many pairs of shapes at once, same as calling `cf_collide` on each pair.
+ * @param    A           The first shape of each pair.
+ * @param    ax          Can be `NULL` to represent identity transforms. An optional array of `count` transforms for `A`.
+ * @param    typeA       The `CF_ShapeType` of each shape in `A`.
+ * @param    B           The second shape of each pair.
+ * @param    bx          Can be `NULL` to represent identity transforms. An optional array of `count` transforms for `B`.
+ * @param    typeB       The `CF_ShapeType` of each shape in `B`.
+ * @param    count       The number of pairs.
+ * @param    out         Receives one `CF_Manifold` per pair. `count` is set to zero for pairs that don't intersect.
+ * @remarks  Pairs may mix any shape types. When every pair has the same circle, AABB or capsule types, the typed batch functions
+ *           such as `cf_circle_to_circle_manifold_batch` are much faster.
+ * @related  cf_collide cf_circle_to_circle_manifold_batch CF_Transform CF_ShapeType CF_Manifold
+ */
+CF_API void CF_CALL cf_collide_batch(const void* const* A, const CF_Transform* ax, const CF_ShapeType* typeA, const void* const* B, const CF_Transform* bx, const CF_ShapeType* typeB, int count, CF_Manifold* out);
+
 /**
  * @function cf_cast_ray
  * @category collision
@@ -2747,6 +2872,8 @@ CF_INLINE M2x2 mul(M2x2 a, M2x2 b) { return cf_mul_m2(a, b); }
 
 CF_INLINE v2 mul(M3x2 a, v2 b) { return cf_mul_m32_v2(a, b); }
 CF_INLINE M3x2 mul(M3x2 a, M3x2 b) { return cf_mul_m32(a, b); }
+CF_INLINE void mul_batch(M3x2 m, const v2* in, v2* out, int count) { cf_mul_m32_v2_batch(m, in, out, count); }
+CF_INLINE void mul_batch(M3x2 m, const M3x2* in, M3x2* out, int count) { cf_mul_m32_batch(m, in, out, count); }
 CF_INLINE M3x2 make_identity() { return cf_make_identity(); }
 CF_INLINE M3x2 make_translation(float x, float y) { return cf_make_translation_f(x, y); }
 CF_INLINE M3x2 make_translation(v2 p) { return cf_make_translation(p); }
@@ -2870,6 +2997,13 @@ CF_INLINE Manifold aabb_to_poly_manifold(Aabb A, const Poly* B, const Transform*
 CF_INLINE Manifold capsule_to_poly_manifold(Capsule A, const Poly* B, const Transform* bx) { return cf_capsule_to_poly_manifold(A, B, bx); }
 CF_INLINE Manifold poly_to_poly_manifold(const Poly* A, const Transform* ax, const Poly* B, const Transform* bx) { return cf_poly_to_poly_manifold(A, ax, B, bx); }
 
+CF_INLINE void circle_to_circle_manifold_batch(const Circle* A, const Circle* B, int count, Manifold* out) { cf_circle_to_circle_manifold_batch(A, B, count, out); }
+CF_INLINE void circle_to_aabb_manifold_batch(const Circle* A, const Aabb* B, int count, Manifold* out) { cf_circle_to_aabb_manifold_batch(A, B, count, out); }
+CF_INLINE void circle_to_capsule_manifold_batch(const Circle* A, const Capsule* B, int count, Manifold* out) { cf_circle_to_capsule_manifold_batch(A, B, count, out); }
+CF_INLINE void aabb_to_aabb_manifold_batch(const Aabb* A, const Aabb* B, int count, Manifold* out) { cf_aabb_to_aabb_manifold_batch(A, B, count, out); }
+CF_INLINE void aabb_to_capsule_manifold_batch(const Aabb* A, const Capsule* B, int count, Manifold* out) { cf_aabb_to_capsule_manifold_batch(A, B, count, out); }
+CF_INLINE void capsule_to_capsule_manifold_batch(const Capsule* A, const Capsule* B, int count, Manifold* out) { cf_capsule_to_capsule_manifold_batch(A, B, count, out); }
+
 CF_INLINE float gjk(const void* A, ShapeType typeA, const Transform* ax_ptr, const void* B, ShapeType typeB, const Transform* bx_ptr, v2* outA, v2* outB, int use_radius, int* iterations, GjkCache* cache)
 {
 	return cf_gjk(A, typeA, ax_ptr, B, typeB, bx_ptr, (CF_V2*)outA, (CF_V2*)outB, use_radius, iterations, cache);
@@ -2882,6 +3016,7 @@ CF_INLINE ToiResult toi(const void* A, ShapeType typeA, const Transform* ax_ptr,
 
 CF_INLINE int collided(const void* A, const Transform* ax, ShapeType typeA, const void* B, const Transform* bx, ShapeType typeB) { return cf_collided(A, ax, typeA, B, bx, typeB); }
 CF_INLINE void collide(const void* A, const Transform* ax, ShapeType typeA, const void* B, const Transform* bx, ShapeType typeB, Manifold* m) { return cf_collide(A, ax, typeA, B, bx, typeB, m); }
+CF_INLINE void collide_batch(const void* const* A, const Transform* ax, const ShapeType* typeA, const void* const* B, const Transform* bx, const ShapeType* typeB, int count, Manifold* out) { cf_collide_batch(A, ax, typeA, B, bx, typeB, count, out); }
 CF_INLINE bool cast_ray(Ray A, const void* B, const Transform* bx, ShapeType typeB, Raycast* out) { return cf_cast_ray(A, B, bx, typeB, out); }
 
 }
@@ -24,15 +24,39 @@ extern "C" {
  * @struct   CF_Mutex
  * @category multithreading
  * @brief    An opaque handle representing a mutex.
- * @related  CF_Mutex cf_make_mutex cf_destroy_mutex cf_mutex_lock cf_mutex_unlock cf_mutex_try_lock
+ * @remarks  A thread waiting on a locked mutex spins briefly, then sleeps until the mutex is unlocked. How long it spins adapts
+ *           to how long the lock is usually held. A zero-initialized mutex is unlocked and ready to use.
+ *
+ *           Mutexes are recursive: a thread may lock a mutex it already holds, and must unlock it once per lock.
+ * @related  CF_Mutex cf_make_mutex cf_destroy_mutex cf_mutex_lock cf_mutex_unlock cf_mutex_try_lock cf_mutex_stats
  */
 typedef cute_mutex_t CF_Mutex;
 // @end
 
+/**
+ * @struct   CF_MutexStats
+ * @category multithreading
+ * @brief    Counters for how often a `CF_Mutex` was fought over, see `cf_mutex_stats`.
+ * @related  CF_MutexStats CF_Mutex cf_mutex_stats cf_mutex_reset_stats
+ */
+typedef struct CF_MutexStats
+{
+	/* @member Number of times the mutex was locked. */
+	uint64_t lock_count;
+
+	/* @member Number of those locks that found the mutex already locked and had to wait. */
+	uint64_t contended_count;
+
+	/* @member Number of those waits that spun out and put the thread to sleep. */
+	uint64_t park_count;
+} CF_MutexStats;
+// @end
+
 /**
  * @struct   CF_ConditionVariable
  * @category multithreading
  * @brief    An opaque handle representing a condition variable.
+ * @remarks  A zero-initialized condition variable is ready to use.
  * @related  CF_ConditionVariable cf_make_cv cf_destroy_cv cf_cv_wake_all cf_cv_wake_one cf_cv_wait
  */
 typedef cute_cv_t CF_ConditionVariable;
@@ -52,6 +76,7 @@ typedef cute_atomic_int_t CF_AtomicInt;
  * @struct   CF_Semaphore
  * @category multithreading
  * @brief    An opaque handle representing a semaphore.
+ * @remarks  A thread waiting on a semaphore spins briefly, then sleeps until the semaphore is posted.
  * @related  CF_Semaphore cf_make_sem cf_destroy_sem cf_sem_post cf_sem_try cf_sem_wait cf_sem_value
  */
 typedef cute_semaphore_t CF_Semaphore;
@@ -106,9 +131,42 @@ typedef cute_rw_lock_t CF_ReadWriteLock;
  * @struct   CF_Threadpool
  * @category multithreading
  * @brief    An opaque handle representing a threadpool.
- * @related  CF_Threadpool CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ * @remarks  Each thread in the pool keeps its own queue of tasks, and idle threads steal tasks queued by others. Adding tasks
+ *           never takes a lock, except from threads that neither made the pool nor belong to it.
+ * @related  CF_Threadpool CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job
  */
-typedef cute_threadpool_t CF_Threadpool;
+typedef struct CF_Threadpool CF_Threadpool;
+// @end
+
+/**
+ * @struct   CF_Job
+ * @category multithreading
+ * @brief    A handle to a task added to a `CF_Threadpool`, see `cf_threadpool_add_task`.
+ * @remarks  A zeroed job is always done. Jobs don't need to be freed.
+ * @related  CF_Threadpool CF_Job cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_wait_job cf_threadpool_job_is_done
+ */
+typedef struct CF_Job { uint64_t id; } CF_Job;
+// @end
+
+/**
+ * @struct   CF_SPSCQueue
+ * @category multithreading
+ * @brief    An opaque handle representing a bounded lock-free queue with one producer and one consumer thread.
+ * @remarks  Good for streaming data between two threads, such as commands to an audio or network thread, without taking locks.
+ * @related  CF_SPSCQueue cf_make_spsc_queue cf_destroy_spsc_queue cf_spsc_queue_push cf_spsc_queue_pop cf_spsc_queue_count
+ */
+typedef struct CF_SPSCQueue CF_SPSCQueue;
+// @end
+
+/**
+ * @struct   CF_MPMCQueue
+ * @category multithreading
+ * @brief    An opaque handle representing a bounded lock-free queue any number of threads can push to and pop from.
+ * @remarks  A little slower than `CF_SPSCQueue`, but safe to share between many producers and consumers, such as many threads
+ *           sending log messages to one writer.
+ * @related  CF_MPMCQueue cf_make_mpmc_queue cf_destroy_mpmc_queue cf_mpmc_queue_push cf_mpmc_queue_pop cf_mpmc_queue_count
+ */
+typedef struct CF_MPMCQueue CF_MPMCQueue;
 // @end
 
 /**
@@ -135,7 +193,8 @@ CF_API void CF_CALL cf_destroy_mutex(CF_Mutex* mutex);
  * @brief    Locks a `CF_Mutex`.
  * @param    mutex      The mutex.
  * @return   Returns any errors as a `CF_Result`.
- * @remarks  Will cause the thread to wait until the lock is available if it's currently locked.
+ * @remarks  Will cause the thread to wait until the lock is available if it's currently locked by another thread. Locking a
+ *           mutex the calling thread already holds succeeds right away, and needs a matching `cf_mutex_unlock`.
  * @related  CF_Mutex cf_make_mutex cf_destroy_mutex cf_mutex_lock cf_mutex_unlock cf_mutex_try_lock
  */
 CF_API CF_Result CF_CALL cf_mutex_lock(CF_Mutex* mutex);
@@ -155,11 +214,32 @@ CF_API CF_Result CF_CALL cf_mutex_unlock(CF_Mutex* mutex);
  * @category multithreading
  * @brief    Attempts to lock a `CF_Mutex` without waiting.
  * @param    mutex      The mutex.
- * @return   Returns true if the lock was acquired, and false if the lock was already locked.
+ * @return   Returns true if the lock was acquired, and false if the lock was already locked by another thread.
  * @related  CF_Mutex cf_make_mutex cf_destroy_mutex cf_mutex_lock cf_mutex_unlock cf_mutex_try_lock
  */
 CF_API bool CF_CALL cf_mutex_try_lock(CF_Mutex* mutex);
 
+/**
+ * @function cf_mutex_stats
+ * @category multithreading
+ * @brief    Returns counters of how contended a `CF_Mutex` has been.
+ * @param    mutex      The mutex.
+ * @remarks  Useful for finding locks worth splitting up or removing. The counters are updated by whichever thread holds the lock,
+ *           so read them while holding it for exact numbers.
+ * @related  CF_MutexStats CF_Mutex cf_mutex_reset_stats
+ */
+CF_API CF_MutexStats CF_CALL cf_mutex_stats(CF_Mutex* mutex);
+
+/**
+ * @function cf_mutex_reset_stats
+ * @category multithreading
+ * @brief    Zeroes the counters returned by `cf_mutex_stats`.
+ * @param    mutex      The mutex.
+ * @remarks  Call this while holding the lock.
+ * @related  CF_MutexStats CF_Mutex cf_mutex_stats
+ */
+CF_API void CF_CALL cf_mutex_reset_stats(CF_Mutex* mutex);
+
 /**
  * @function cf_make_cv
  * @category multithreading
@@ -343,7 +423,8 @@ CF_API CF_Result CF_CALL cf_thread_wait(CF_Thread* thread);
  * @function cf_core_count
  * @category CPU
  * @brief    Returns the number of cores on the CPU. Can be affected my machine dependent technology, such as Intel's hyperthreading.
- * @related  cf_core_count
+ * @remarks  See `cf_cpu_topology` for physical cores, and performance versus efficiency cores.
+ * @related  cf_core_count cf_cpu_topology
  */
 CF_API int CF_CALL cf_core_count();
 
@@ -355,6 +436,87 @@ CF_API int CF_CALL cf_core_count();
  */
 CF_API int CF_CALL cf_cacheline_size();
 
+/**
+ * @enum     CF_CoreType
+ * @category CPU
+ * @brief    The kinds of cores found on hybrid CPUs, such as Intel's P-cores and E-cores, or ARM's big.LITTLE.
+ * @remarks  On CPUs with only one kind of core, every core is a performance core.
+ * @related  CF_CoreType cf_core_type_to_string CF_CpuTopology cf_cpu_topology CF_ThreadpoolParams
+ */
+#define CF_CORE_TYPE_DEFS \
+	/* @entry Any core, the OS picks. */                                                  \
+	CF_ENUM(CORE_TYPE_ANY,         0)                                                     \
+	/* @entry The fastest cores. Good for work the current frame waits on. */             \
+	CF_ENUM(CORE_TYPE_PERFORMANCE, 1)                                                     \
+	/* @entry Slower, power efficient cores. Good for background work, such as streaming. */ \
+	CF_ENUM(CORE_TYPE_EFFICIENCY,  2)                                                     \
+	/* @end */
+
+typedef enum CF_CoreType
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_CORE_TYPE_DEFS
+	#undef CF_ENUM
+} CF_CoreType;
+
+/**
+ * @function cf_core_type_to_string
+ * @category CPU
+ * @brief    Returns a `CF_CoreType` converted to a C string.
+ * @related  CF_CoreType cf_core_type_to_string
+ */
+CF_INLINE const char* cf_core_type_to_string(CF_CoreType type)
+{
+	switch (type) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_CORE_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @struct   CF_CpuTopology
+ * @category CPU
+ * @brief    How the cores of the CPU are laid out, see `cf_cpu_topology`.
+ * @remarks  A physical core can run more than one hardware thread at once (e.g. Intel's hyperthreading), each of which counts as
+ *           a logical core. Counts the OS doesn't report fall back to treating each logical core as its own physical core.
+ * @related  CF_CpuTopology cf_cpu_topology CF_CoreType cf_core_count
+ */
+typedef struct CF_CpuTopology
+{
+	/* @member Hardware threads, usually the same as `cf_core_count`. */
+	int logical_core_count;
+
+	/* @member Physical cores. */
+	int physical_core_count;
+
+	/* @member Physical performance cores. */
+	int performance_core_count;
+
+	/* @member Physical efficiency cores. Zero on CPUs with only one kind of core. */
+	int efficiency_core_count;
+
+	/* @member Hardware threads of the performance cores. */
+	int performance_thread_count;
+
+	/* @member Hardware threads of the efficiency cores. */
+	int efficiency_thread_count;
+
+	/* @member Groups of cores sharing a last-level cache. Threads within a cluster share data cheaply. */
+	int cache_cluster_count;
+} CF_CpuTopology;
+// @end
+
+/**
+ * @function cf_cpu_topology
+ * @category CPU
+ * @brief    Returns how the cores of the CPU are laid out.
+ * @remarks  Queried from the OS once, then cached. Use it to size threadpools, see `CF_ThreadpoolParams`.
+ * @related  CF_CpuTopology cf_cpu_topology CF_CoreType cf_core_count cf_make_threadpool_with_params
+ */
+CF_API CF_CpuTopology CF_CALL cf_cpu_topology();
+
 /**
  * @function cf_atomic_zero
  * @category atomic
@@ -509,10 +671,88 @@ CF_API void CF_CALL cf_write_unlock(CF_ReadWriteLock* rw);
  * @remarks  Threadpools are an advanced topic. You've been warned! John has a [good article on threadpools](https://nachtimwald.com/2019/04/12/thread-pool-in-c/).
  *           A task is a single function that a thread in the threadpool will run. Usually they perform one chunk of work, and then
  *           return. Often a task is defined as a bunch of processing that doesn't share any data external to the task.
- * @related  CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
  */
 typedef void (CF_CALL CF_TaskFn)(void* param);
 
+/**
+ * @enum     CF_ThreadPriority
+ * @category multithreading
+ * @brief    Scheduling priorities for the threads of a `CF_Threadpool`, see `CF_ThreadpoolParams`.
+ * @related  CF_ThreadPriority cf_thread_priority_to_string CF_ThreadpoolParams
+ */
+#define CF_THREAD_PRIORITY_DEFS \
+	/* @entry Runs when nothing more important needs the core. */ \
+	CF_ENUM(THREAD_PRIORITY_LOW,    0)                              \
+	/* @entry The same priority as other threads. */                \
+	CF_ENUM(THREAD_PRIORITY_NORMAL, 1)                              \
+	/* @entry Runs ahead of normal threads. */                      \
+	CF_ENUM(THREAD_PRIORITY_HIGH,   2)                              \
+	/* @end */
+
+typedef enum CF_ThreadPriority
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_THREAD_PRIORITY_DEFS
+	#undef CF_ENUM
+} CF_ThreadPriority;
+
+/**
+ * @function cf_thread_priority_to_string
+ * @category multithreading
+ * @brief    Returns a `CF_ThreadPriority` converted to a C string.
+ * @related  CF_ThreadPriority cf_thread_priority_to_string
+ */
+CF_INLINE const char* cf_thread_priority_to_string(CF_ThreadPriority priority)
+{
+	switch (priority) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_THREAD_PRIORITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @struct   CF_ThreadpoolParams
+ * @category multithreading
+ * @brief    Where and how the threads of a `CF_Threadpool` run, see `cf_make_threadpool_with_params`.
+ * @remarks  On hybrid CPUs, keep work the frame waits on in a pool on `CF_CORE_TYPE_PERFORMANCE` cores, and put background work such as
+ *           streaming in a second pool on `CF_CORE_TYPE_EFFICIENCY` cores with `CF_THREAD_PRIORITY_LOW`.
+ *
+ *           Threads are pinned to cores of `core_type` on Windows, Linux and Android. On Apple platforms threads can't be pinned, so
+ *           `core_type` picks a quality of service class instead, which the OS uses to place threads on performance or efficiency
+ *           cores. If the CPU has no cores of `core_type`, threads run on any core.
+ * @related  CF_ThreadpoolParams cf_threadpool_params_defaults cf_make_threadpool_with_params CF_CoreType CF_ThreadPriority cf_cpu_topology
+ */
+typedef struct CF_ThreadpoolParams
+{
+	/* @member Default: 0. How many threads to spawn. Zero spawns one per hardware thread of `core_type`, less one for the calling thread. */
+	int thread_count;
+
+	/* @member Default: `CF_CORE_TYPE_ANY`. The cores to run the threads on. */
+	CF_CoreType core_type;
+
+	/* @member Default: `CF_THREAD_PRIORITY_NORMAL`. The threads' scheduling priority. Left at normal if the OS doesn't allow it. */
+	CF_ThreadPriority priority;
+} CF_ThreadpoolParams;
+// @end
+
+/**
+ * @function cf_threadpool_params_defaults
+ * @category multithreading
+ * @brief    Returns a `CF_ThreadpoolParams` filled with default settings.
+ * @related  CF_ThreadpoolParams cf_threadpool_params_defaults cf_make_threadpool_with_params
+ */
+CF_INLINE CF_ThreadpoolParams CF_CALL cf_threadpool_params_defaults()
+{
+	CF_ThreadpoolParams params;
+	params.thread_count = 0;
+	params.core_type = CF_CORE_TYPE_ANY;
+	params.priority = CF_THREAD_PRIORITY_NORMAL;
+	return params;
+}
+
 /**
  * @function cf_make_threadpool
  * @category multithreading
@@ -522,39 +762,88 @@ typedef void (CF_CALL CF_TaskFn)(void* param);
  *           into the threadpool (see: `CF_TaskFn`). Once the task is completed, the thread attempts to fetch another task. If no more
  *           tasks are available, the thread goes back to sleep. A common tactic is to take the number of cores in a given CPU and
  *           subtract one, then use this number for `thread_count`. We subtract one to account for the main thread.
- * @related  CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
  */
 CF_API CF_Threadpool* CF_CALL cf_make_threadpool(int thread_count);
 
+/**
+ * @function cf_make_threadpool_with_params
+ * @category multithreading
+ * @brief    Returns a new `CF_Threadpool` whose threads run on a chosen kind of core, at a chosen priority.
+ * @param    params     Can be `NULL` for the defaults. See `CF_ThreadpoolParams`.
+ * @remarks  Works just like `cf_make_threadpool` otherwise. Call `cf_destroy_threadpool` when done.
+ * @related  CF_ThreadpoolParams cf_threadpool_params_defaults cf_make_threadpool cf_destroy_threadpool cf_cpu_topology
+ */
+CF_API CF_Threadpool* CF_CALL cf_make_threadpool_with_params(const CF_ThreadpoolParams* params);
+
 /**
  * @function cf_destroy_threadpool
  * @category multithreading
  * @brief    Destroys a `CF_Threadpool` created by `cf_make_threadpool`.
  * @param    pool       The pool.
- * @related  CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
  */
 CF_API void CF_CALL cf_destroy_threadpool(CF_Threadpool* pool);
 
 /**
  * @function cf_threadpool_add_task
  * @category multithreading
- * @brief    Adds a `CF_TaskFn` to the threadpool.
+ * @brief    Adds a `CF_TaskFn` to the threadpool, and returns a `CF_Job` to wait on.
  * @param    pool       The pool.
  * @param    task       The task for a thread in the pool to perform.
  * @param    param      Can be `NULL`. This gets handed to the `CF_TaskFn` when it gets called.
  * @remarks  Once a task is added to the pool `cf_threadpool_kick_and_wait` or `cf_threadpool_kick` must be called wake threads. Once
- *           awake, threads will process the tasks. The order of start/finish for the tasks is not deterministic.
- * @related  CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ *           awake, threads will process the tasks. The order of start/finish for the tasks is not deterministic. Tasks may add
+ *           more tasks, which the adding thread will get to even if no other thread is woken. If the calling thread already has over
+ *           a thousand unfinished tasks in the pool, `task` runs right away on the calling thread instead.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
+ */
+CF_API CF_Job CF_CALL cf_threadpool_add_task(CF_Threadpool* pool, CF_TaskFn* task, void* param);
+
+/**
+ * @function cf_threadpool_add_dependent_task
+ * @category multithreading
+ * @brief    Adds a `CF_TaskFn` to the threadpool that only runs once all of `dependencies` are done.
+ * @param    pool              The pool.
+ * @param    task              The task for a thread in the pool to perform.
+ * @param    param             Can be `NULL`. This gets handed to the `CF_TaskFn` when it gets called.
+ * @param    dependencies      Jobs from `cf_threadpool_add_task` or `cf_threadpool_add_dependent_task` to run after. Can be `NULL`.
+ * @param    dependency_count  The number of elements in `dependencies`.
+ * @param    counter           Can be `NULL`. Incremented now, and decremented once `task` is done. See `cf_threadpool_wait_counter`.
+ * @remarks  The task is queued by whichever thread finishes its last dependency, so chains of tasks such as physics, then game
+ *           logic, then draw recording run back to back without waking the calling thread in between. Many tasks may share one
+ *           counter to wait on them all at once.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
+ */
+CF_API CF_Job CF_CALL cf_threadpool_add_dependent_task(CF_Threadpool* pool, CF_TaskFn* task, void* param, const CF_Job* dependencies, int dependency_count, CF_AtomicInt* counter);
+
+/**
+ * @function cf_threadpool_add_fiber_task
+ * @category multithreading
+ * @brief    Adds a `CF_TaskFn` to the threadpool that runs on its own fiber, and may yield while it waits.
+ * @param    pool              The pool.
+ * @param    task              The task for a thread in the pool to perform.
+ * @param    param             Can be `NULL`. This gets handed to the `CF_TaskFn` when it gets called.
+ * @param    dependencies      Jobs to run after. Can be `NULL`.
+ * @param    dependency_count  The number of elements in `dependencies`.
+ * @param    counter           Can be `NULL`. Incremented now, and decremented once `task` is done. See `cf_threadpool_wait_counter`.
+ * @remarks  The task runs on a pooled `CF_Coroutine` with a 256 KB stack. When it calls `cf_threadpool_wait_job` or
+ *           `cf_threadpool_wait_counter`, the fiber is parked instead of blocking the thread, and the thread moves on to other
+ *           tasks. Once the wait is over any thread in the pool may pick the fiber back up, so don't hold mutexes or read
+ *           `thread_local` variables across a wait. To wait on work outside the pool, such as an I/O request, have the task wait
+ *           on a counter, and once the work is done decrement the counter followed by `cf_threadpool_kick` to wake the pool.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
  */
-CF_API void CF_CALL cf_threadpool_add_task(CF_Threadpool* pool, CF_TaskFn* task, void* param);
+CF_API CF_Job CF_CALL cf_threadpool_add_fiber_task(CF_Threadpool* pool, CF_TaskFn* task, void* param, const CF_Job* dependencies, int dependency_count, CF_AtomicInt* counter);
 
 /**
  * @function cf_threadpool_kick_and_wait
  * @category multithreading
  * @brief    Tells the internal threads to wake and start processing tasks, and blocks until all tasks are done.
  * @param    pool       The pool.
- * @remarks  This function will block until all tasks are completed.
- * @related  CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ * @remarks  This function will block until all tasks are completed, running tasks on the calling thread in the meantime. Don't
+ *           call this from within a task, as it would wait on itself. Use `cf_threadpool_wait_job` instead.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
  */
 CF_API void CF_CALL cf_threadpool_kick_and_wait(CF_Threadpool* pool);
 
@@ -564,10 +853,217 @@ CF_API void CF_CALL cf_threadpool_kick_and_wait(CF_Threadpool* pool);
  * @brief    Tells the internal threads to wake and start processing tasks without blocking.
  * @param    pool       The pool.
  * @remarks  This function will _not_ block. It immediately returns after signaling the threads in the pool to wake.
- * @related  CF_TaskFn cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_kick_and_wait cf_threadpool_kick
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
  */
 CF_API void CF_CALL cf_threadpool_kick(CF_Threadpool* pool);
 
+/**
+ * @function cf_threadpool_wait_job
+ * @category multithreading
+ * @brief    Blocks until `job` is done.
+ * @param    pool       The pool.
+ * @param    job        A job returned by `cf_threadpool_add_task`.
+ * @remarks  Runs other queued tasks on the calling thread while waiting, so it's safe to call from within a task. Remember to
+ *           call `cf_threadpool_kick` first if you want other threads to help out. Within a task from `cf_threadpool_add_fiber_task`
+ *           the fiber is parked instead, freeing up the thread.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
+ */
+CF_API void CF_CALL cf_threadpool_wait_job(CF_Threadpool* pool, CF_Job job);
+
+/**
+ * @function cf_threadpool_job_is_done
+ * @category multithreading
+ * @brief    Returns true if `job` has finished running, without blocking.
+ * @param    pool       The pool.
+ * @param    job        A job returned by `cf_threadpool_add_task`.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
+ */
+CF_API bool CF_CALL cf_threadpool_job_is_done(CF_Threadpool* pool, CF_Job job);
+
+/**
+ * @function cf_threadpool_wait_counter
+ * @category multithreading
+ * @brief    Blocks until `counter` drops to zero.
+ * @param    pool       The pool.
+ * @param    counter    A counter handed to `cf_threadpool_add_dependent_task`, starting at zero.
+ * @remarks  Unlike `cf_threadpool_kick_and_wait` this only waits on the tasks counted by `counter`, and runs other queued tasks on the
+ *           calling thread in the meantime, so it's safe to call from within a task. Within a task from `cf_threadpool_add_fiber_task`
+ *           the fiber is parked instead, freeing up the thread.
+ * @related  CF_TaskFn CF_Job cf_make_threadpool cf_destroy_threadpool cf_threadpool_add_task cf_threadpool_add_dependent_task cf_threadpool_add_fiber_task cf_threadpool_kick_and_wait cf_threadpool_kick cf_threadpool_wait_job cf_threadpool_wait_counter
+ */
+CF_API void CF_CALL cf_threadpool_wait_counter(CF_Threadpool* pool, CF_AtomicInt* counter);
+
+/**
+ * @function CF_ParallelForFn
+ * @category multithreading
+ * @brief    A function pointer processing the indices [begin, end) for `cf_parallel_for`.
+ * @param    begin      The first index to process.
+ * @param    end        One past the last index to process.
+ * @param    udata      The `udata` handed to `cf_parallel_for`.
+ * @related  CF_ParallelForFn CF_ParallelReduceFn CF_ParallelJoinFn cf_parallel_for cf_parallel_reduce
+ */
+typedef void (CF_CALL CF_ParallelForFn)(int begin, int end, void* udata);
+
+/**
+ * @function CF_ParallelReduceFn
+ * @category multithreading
+ * @brief    A function pointer accumulating the indices [begin, end) into `partial` for `cf_parallel_reduce`.
+ * @param    begin      The first index to process.
+ * @param    end        One past the last index to process.
+ * @param    partial    This range's partial result, which starts out as a copy of the initial result.
+ * @param    udata      The `udata` handed to `cf_parallel_reduce`.
+ * @related  CF_ParallelForFn CF_ParallelReduceFn CF_ParallelJoinFn cf_parallel_for cf_parallel_reduce
+ */
+typedef void (CF_CALL CF_ParallelReduceFn)(int begin, int end, void* partial, void* udata);
+
+/**
+ * @function CF_ParallelJoinFn
+ * @category multithreading
+ * @brief    A function pointer merging a range's `partial` result into `result` for `cf_parallel_reduce`.
+ * @param    result     The final result.
+ * @param    partial    A partial result from `CF_ParallelReduceFn`.
+ * @param    udata      The `udata` handed to `cf_parallel_reduce`.
+ * @related  CF_ParallelForFn CF_ParallelReduceFn CF_ParallelJoinFn cf_parallel_for cf_parallel_reduce
+ */
+typedef void (CF_CALL CF_ParallelJoinFn)(void* result, const void* partial, void* udata);
+
+/**
+ * @function cf_parallel_for
+ * @category multithreading
+ * @brief    Calls `fn` over contiguous ranges covering [0, count), spread across the threadpool, and blocks until all are done.
+ * @param    pool       The pool. Can be `NULL` to run everything on the calling thread.
+ * @param    count      The number of indices to process.
+ * @param    grain      The smallest range worth handing to another thread. Use 0 or 1 if each index is a lot of work.
+ * @param    fn         Called once per range, see `CF_ParallelForFn`.
+ * @param    udata      Can be `NULL`. Handed to `fn`.
+ * @remarks  Ranges are sized to give each thread a few of them, and threads grab the next range as they finish one, so uneven work
+ *           still balances out. The calling thread processes ranges too. Safe to call from within a task.
+ * @related  CF_ParallelForFn CF_ParallelReduceFn CF_ParallelJoinFn cf_parallel_for cf_parallel_reduce
+ */
+CF_API void CF_CALL cf_parallel_for(CF_Threadpool* pool, int count, int grain, CF_ParallelForFn* fn, void* udata);
+
+/**
+ * @function cf_parallel_reduce
+ * @category multithreading
+ * @brief    Like `cf_parallel_for`, but accumulates each range into its own partial result, and joins them into `result`.
+ * @param    pool         The pool. Can be `NULL` to run everything on the calling thread.
+ * @param    count        The number of indices to process.
+ * @param    grain        The smallest range worth handing to another thread.
+ * @param    result       Holds the identity value (such as zero for a sum) on input, and the reduced result on output.
+ * @param    result_size  The size of `result` in bytes.
+ * @param    fn           Called once per range with a fresh copy of the identity value, see `CF_ParallelReduceFn`.
+ * @param    join         Called on the calling thread for each range's partial result, in order of their ranges.
+ * @param    udata        Can be `NULL`. Handed to `fn` and `join`.
+ * @remarks  Partial results are joined in index order, so the result is deterministic for a given pool size even when `join`
+ *           isn't commutative (such as floating point sums).
+ * @related  CF_ParallelForFn CF_ParallelReduceFn CF_ParallelJoinFn cf_parallel_for cf_parallel_reduce
+ */
+CF_API void CF_CALL cf_parallel_reduce(CF_Threadpool* pool, int count, int grain, void* result, int result_size, CF_ParallelReduceFn* fn, CF_ParallelJoinFn* join, void* udata);
+
+/**
+ * @function cf_make_spsc_queue
+ * @category multithreading
+ * @brief    Returns a new `CF_SPSCQueue`.
+ * @param    capacity      The most elements the queue holds at once, rounded up to a power of two.
+ * @param    element_size  The size in bytes of each element.
+ * @remarks  Elements are copied in and out of the queue. Free it up with `cf_destroy_spsc_queue` when done.
+ * @related  CF_SPSCQueue cf_make_spsc_queue cf_destroy_spsc_queue cf_spsc_queue_push cf_spsc_queue_pop cf_spsc_queue_count
+ */
+CF_API CF_SPSCQueue* CF_CALL cf_make_spsc_queue(int capacity, int element_size);
+
+/**
+ * @function cf_destroy_spsc_queue
+ * @category multithreading
+ * @brief    Destroys a queue made by `cf_make_spsc_queue`.
+ * @param    queue      The queue.
+ * @related  CF_SPSCQueue cf_make_spsc_queue cf_destroy_spsc_queue cf_spsc_queue_push cf_spsc_queue_pop cf_spsc_queue_count
+ */
+CF_API void CF_CALL cf_destroy_spsc_queue(CF_SPSCQueue* queue);
+
+/**
+ * @function cf_spsc_queue_push
+ * @category multithreading
+ * @brief    Copies `element` onto the back of the queue. Returns false if the queue is full.
+ * @param    queue      The queue.
+ * @param    element    Points to `element_size` bytes to copy in.
+ * @remarks  Never blocks. Only one thread at a time may push.
+ * @related  CF_SPSCQueue cf_make_spsc_queue cf_destroy_spsc_queue cf_spsc_queue_push cf_spsc_queue_pop cf_spsc_queue_count
+ */
+CF_API bool CF_CALL cf_spsc_queue_push(CF_SPSCQueue* queue, const void* element);
+
+/**
+ * @function cf_spsc_queue_pop
+ * @category multithreading
+ * @brief    Copies the front of the queue out to `element` and removes it. Returns false if the queue is empty.
+ * @param    queue      The queue.
+ * @param    element    Points to `element_size` bytes to copy out to.
+ * @remarks  Never blocks. Only one thread at a time may pop.
+ * @related  CF_SPSCQueue cf_make_spsc_queue cf_destroy_spsc_queue cf_spsc_queue_push cf_spsc_queue_pop cf_spsc_queue_count
+ */
+CF_API bool CF_CALL cf_spsc_queue_pop(CF_SPSCQueue* queue, void* element);
+
+/**
+ * @function cf_spsc_queue_count
+ * @category multithreading
+ * @brief    Returns the number of elements in the queue.
+ * @param    queue      The queue.
+ * @remarks  Other threads may push or pop at any time, so the count is only a snapshot.
+ * @related  CF_SPSCQueue cf_make_spsc_queue cf_destroy_spsc_queue cf_spsc_queue_push cf_spsc_queue_pop cf_spsc_queue_count
+ */
+CF_API int CF_CALL cf_spsc_queue_count(CF_SPSCQueue* queue);
+
+/**
+ * @function cf_make_mpmc_queue
+ * @category multithreading
+ * @brief    Returns a new `CF_MPMCQueue`.
+ * @param    capacity      The most elements the queue holds at once, rounded up to a power of two.
+ * @param    element_size  The size in bytes of each element.
+ * @remarks  Elements are copied in and out of the queue. Free it up with `cf_destroy_mpmc_queue` when done.
+ * @related  CF_MPMCQueue cf_make_mpmc_queue cf_destroy_mpmc_queue cf_mpmc_queue_push cf_mpmc_queue_pop cf_mpmc_queue_count
+ */
+CF_API CF_MPMCQueue* CF_CALL cf_make_mpmc_queue(int capacity, int element_size);
+
+/**
+ * @function cf_destroy_mpmc_queue
+ * @category multithreading
+ * @brief    Destroys a queue made by `cf_make_mpmc_queue`.
+ * @param    queue      The queue.
+ * @related  CF_MPMCQueue cf_make_mpmc_queue cf_destroy_mpmc_queue cf_mpmc_queue_push cf_mpmc_queue_pop cf_mpmc_queue_count
+ */
+CF_API void CF_CALL cf_destroy_mpmc_queue(CF_MPMCQueue* queue);
+
+/**
+ * @function cf_mpmc_queue_push
+ * @category multithreading
+ * @brief    Copies `element` onto the back of the queue. Returns false if the queue is full.
+ * @param    queue      The queue.
+ * @param    element    Points to `element_size` bytes to copy in.
+ * @remarks  Never blocks. Safe to call from any number of threads at once.
+ * @related  CF_MPMCQueue cf_make_mpmc_queue cf_destroy_mpmc_queue cf_mpmc_queue_push cf_mpmc_queue_pop cf_mpmc_queue_count
+ */
+CF_API bool CF_CALL cf_mpmc_queue_push(CF_MPMCQueue* queue, const void* element);
+
+/**
+ * @function cf_mpmc_queue_pop
+ * @category multithreading
+ * @brief    Copies the front of the queue out to `element` and removes it. Returns false if the queue is empty.
+ * @param    queue      The queue.
+ * @param    element    Points to `element_size` bytes to copy out to.
+ * @remarks  Never blocks. Safe to call from any number of threads at once.
+ * @related  CF_MPMCQueue cf_make_mpmc_queue cf_destroy_mpmc_queue cf_mpmc_queue_push cf_mpmc_queue_pop cf_mpmc_queue_count
+ */
+CF_API bool CF_CALL cf_mpmc_queue_pop(CF_MPMCQueue* queue, void* element);
+
+/**
+ * @function cf_mpmc_queue_count
+ * @category multithreading
+ * @brief    Returns the number of elements in the queue.
+ * @param    queue      The queue.
+ * @remarks  Other threads may push or pop at any time, so the count is only a snapshot.
+ * @related  CF_MPMCQueue cf_make_mpmc_queue cf_destroy_mpmc_queue cf_mpmc_queue_push cf_mpmc_queue_pop cf_mpmc_queue_count
+ */
+CF_API int CF_CALL cf_mpmc_queue_count(CF_MPMCQueue* queue);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -581,6 +1077,7 @@ namespace Cute
 {
 
 using Mutex = CF_Mutex;
+using MutexStats = CF_MutexStats;
 using ConditionVariable = CF_ConditionVariable;
 using AtomicInt = CF_AtomicInt;
 using Semaphore = CF_Semaphore;
@@ -589,13 +1086,54 @@ using ThreadId = CF_ThreadId;
 using ThreadFn = CF_ThreadFn;
 using ReadWriteLock = CF_ReadWriteLock;
 using Threadpool = CF_Threadpool;
+using SPSCQueue = CF_SPSCQueue;
+using MPMCQueue = CF_MPMCQueue;
+using Job = CF_Job;
 using TaskFn = CF_TaskFn;
+using ParallelForFn = CF_ParallelForFn;
+using ParallelReduceFn = CF_ParallelReduceFn;
+using ParallelJoinFn = CF_ParallelJoinFn;
+using CpuTopology = CF_CpuTopology;
+
+using CoreType = CF_CoreType;
+#define CF_ENUM(K, V) CF_INLINE constexpr CoreType K = CF_##K;
+CF_CORE_TYPE_DEFS
+#undef CF_ENUM
+
+CF_INLINE constexpr const char* to_string(CoreType type) { switch(type) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_CORE_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+using ThreadPriority = CF_ThreadPriority;
+#define CF_ENUM(K, V) CF_INLINE constexpr ThreadPriority K = CF_##K;
+CF_THREAD_PRIORITY_DEFS
+#undef CF_ENUM
+
+CF_INLINE constexpr const char* to_string(ThreadPriority type) { switch(type) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_THREAD_PRIORITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+struct ThreadpoolParams : public CF_ThreadpoolParams
+{
+	ThreadpoolParams() { *(CF_ThreadpoolParams*)this = cf_threadpool_params_defaults(); }
+	ThreadpoolParams(CF_ThreadpoolParams p) { *(CF_ThreadpoolParams*)this = p; }
+};
 
 CF_INLINE Mutex make_mutex() { return cf_make_mutex(); }
 CF_INLINE void destroy_mutex(Mutex* mutex) { cf_destroy_mutex(mutex); }
 CF_INLINE Result mutex_lock(Mutex* mutex) { return cf_mutex_lock(mutex); }
 CF_INLINE Result mutex_unlock(Mutex* mutex) { return cf_mutex_unlock(mutex); }
 CF_INLINE bool Mutexrylock(Mutex* mutex) { return cf_mutex_try_lock(mutex); }
+CF_INLINE MutexStats mutex_stats(Mutex* mutex) { return cf_mutex_stats(mutex); }
+CF_INLINE void mutex_reset_stats(Mutex* mutex) { cf_mutex_reset_stats(mutex); }
 
 CF_INLINE ConditionVariable make_cv() { return cf_make_cv(); }
 CF_INLINE void destroy_cv(ConditionVariable* cv) { cf_destroy_cv(cv); }
@@ -618,6 +1156,7 @@ CF_INLINE Result thread_wait(Thread* thread) { return cf_thread_wait(thread); }
 
 CF_INLINE int core_count() { return cf_core_count(); }
 CF_INLINE int cacheline_size() { return cf_cacheline_size(); }
+CF_INLINE CpuTopology cpu_topology() { return cf_cpu_topology(); }
 
 CF_INLINE AtomicInt atomic_zero() { return cf_atomic_zero(); }
 CF_INLINE int atomic_add(AtomicInt* atomic, int addend) { return cf_atomic_add(atomic, addend); }
@@ -636,10 +1175,29 @@ CF_INLINE void write_lock(ReadWriteLock* rw) { cf_write_lock(rw); }
 CF_INLINE void write_unlock(ReadWriteLock* rw) { cf_write_unlock(rw); }
 
 CF_INLINE Threadpool* make_threadpool(int thread_count) { return cf_make_threadpool(thread_count); }
+CF_INLINE Threadpool* make_threadpool(const ThreadpoolParams* params) { return cf_make_threadpool_with_params(params); }
 CF_INLINE void destroy_threadpool(Threadpool* pool) { return cf_destroy_threadpool(pool); }
-CF_INLINE void threadpool_add_task(Threadpool* pool, TaskFn* task, void* param) { return cf_threadpool_add_task(pool, task, param); }
+CF_INLINE Job threadpool_add_task(Threadpool* pool, TaskFn* task, void* param) { return cf_threadpool_add_task(pool, task, param); }
 CF_INLINE void threadpool_kick_and_wait(Threadpool* pool) { return cf_threadpool_kick_and_wait(pool); }
 CF_INLINE void threadpool_kick(Threadpool* pool) { return cf_threadpool_kick(pool); }
+CF_INLINE void threadpool_wait_job(Threadpool* pool, Job job) { return cf_threadpool_wait_job(pool, job); }
+CF_INLINE bool threadpool_job_is_done(Threadpool* pool, Job job) { return cf_threadpool_job_is_done(pool, job); }
+CF_INLINE Job threadpool_add_dependent_task(Threadpool* pool, TaskFn* task, void* param, const Job* dependencies, int dependency_count, AtomicInt* counter = NULL) { return cf_threadpool_add_dependent_task(pool, task, param, dependencies, dependency_count, counter); }
+CF_INLINE Job threadpool_add_fiber_task(Threadpool* pool, TaskFn* task, void* param, const Job* dependencies = NULL, int dependency_count = 0, AtomicInt* counter = NULL) { return cf_threadpool_add_fiber_task(pool, task, param, dependencies, dependency_count, counter); }
+CF_INLINE void threadpool_wait_counter(Threadpool* pool, AtomicInt* counter) { cf_threadpool_wait_counter(pool, counter); }
+CF_INLINE void parallel_for(Threadpool* pool, int count, int grain, ParallelForFn* fn, void* udata = NULL) { cf_parallel_for(pool, count, grain, fn, udata); }
+CF_INLINE void parallel_reduce(Threadpool* pool, int count, int grain, void* result, int result_size, ParallelReduceFn* fn, ParallelJoinFn* join, void* udata = NULL) { cf_parallel_reduce(pool, count, grain, result, result_size, fn, join, udata); }
+
+CF_INLINE SPSCQueue* make_spsc_queue(int capacity, int element_size) { return cf_make_spsc_queue(capacity, element_size); }
+CF_INLINE void destroy_spsc_queue(SPSCQueue* queue) { cf_destroy_spsc_queue(queue); }
+CF_INLINE bool spsc_queue_push(SPSCQueue* queue, const void* element) { return cf_spsc_queue_push(queue, element); }
+CF_INLINE bool spsc_queue_pop(SPSCQueue* queue, void* element) { return cf_spsc_queue_pop(queue, element); }
+CF_INLINE int spsc_queue_count(SPSCQueue* queue) { return cf_spsc_queue_count(queue); }
+CF_INLINE MPMCQueue* make_mpmc_queue(int capacity, int element_size) { return cf_make_mpmc_queue(capacity, element_size); }
+CF_INLINE void destroy_mpmc_queue(MPMCQueue* queue) { cf_destroy_mpmc_queue(queue); }
+CF_INLINE bool mpmc_queue_push(MPMCQueue* queue, const void* element) { return cf_mpmc_queue_push(queue, element); }
+CF_INLINE bool mpmc_queue_pop(MPMCQueue* queue, void* element) { return cf_mpmc_queue_pop(queue, element); }
+CF_INLINE int mpmc_queue_count(MPMCQueue* queue) { return cf_mpmc_queue_count(queue); }
 
 }
 
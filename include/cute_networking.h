@@ -9,6 +9,7 @@
 #define CF_NETWORKING_H
 
 #include <cute_result.h>
+#include <cute_multithreading.h>
 #include <cute/cute_net.h>
 
 //--------------------------------------------------------------------------------------------------
@@ -33,7 +34,17 @@ typedef struct cn_client_t CF_Client;
  * @brief    An opaque pointer representing a single networked server.
  * @related  CF_Client CF_Server cf_make_client
  */
-typedef struct cn_server_t CF_Server;
+typedef struct CF_Server CF_Server;
+// @end
+
+/**
+ * @struct   CF_ServerHost
+ * @category net
+ * @brief    An opaque pointer to a pool of I/O threads shared by many `CF_Server` instances.
+ * @remarks  See `cf_make_server_host`.
+ * @related  CF_Server CF_ServerHost cf_make_server_host CF_ServerConfig
+ */
+typedef struct CF_ServerHost CF_ServerHost;
 // @end
 
 /**
@@ -206,6 +217,51 @@ CF_API void CF_CALL cf_crypto_sign_keygen(CF_CryptoSignPublic* public_key, CF_Cr
  */
 CF_API CF_Result CF_CALL cf_generate_connect_token(uint64_t application_id, uint64_t creation_timestamp, const CF_CryptoKey* client_to_server_key, const CF_CryptoKey* server_to_client_key, uint64_t expiration_timestamp, uint32_t handshake_timeout, int address_count, const char** address_list, uint64_t client_id, const uint8_t* user_data, const CF_CryptoSignSecret* shared_secret_key, uint8_t* token_ptr_out);
 
+/**
+ * @struct   CF_ConnectTokenRequest
+ * @category net
+ * @brief    The parts of a connect token unique to one client, see `cf_generate_connect_tokens`.
+ * @related  CF_ConnectTokenRequest cf_generate_connect_tokens cf_generate_connect_token
+ */
+typedef struct CF_ConnectTokenRequest
+{
+	/* The unique client identifier (you pick this). */
+	uint64_t client_id;
+
+	/* A unique key for the client to encrypt packets, see `cf_crypto_generate_key`. */
+	CF_CryptoKey client_to_server_key;
+
+	/* A unique key for the server to encrypt packets, see `cf_crypto_generate_key`. */
+	CF_CryptoKey server_to_client_key;
+
+	/* Can be `NULL`. Optional buffer of `CF_CONNECT_TOKEN_USER_DATA_SIZE` (256) bytes. */
+	const uint8_t* user_data;
+} CF_ConnectTokenRequest;
+// @end
+
+/**
+ * @function cf_generate_connect_tokens
+ * @category net
+ * @brief    Generates many connect tokens in one call, for a matchmaker handing out tokens to lots of players at once.
+ * @param    application_id        A unique number to identify your game, the same as in `cf_make_client` and `cf_make_server`.
+ * @param    creation_timestamp    A unix timestamp of the current time.
+ * @param    expiration_timestamp  A unix timestamp for when these connect tokens expire and become invalid.
+ * @param    handshake_timeout     The number of seconds the connection will stay alive during the handshake process.
+ * @param    address_count         Must be from 1 to 32 (inclusive). The number of addresses in `address_list`.
+ * @param    address_list          A list of game servers the clients can try connecting to, of length `address_count`.
+ * @param    shared_secret_key     Only your webservice and game servers know this key.
+ * @param    count                 The number of tokens to generate.
+ * @param    requests              The client specific parts of each token, of length `count`.
+ * @param    tokens_out            Your buffer of `count * CF_CONNECT_TOKEN_SIZE` bytes. Token `i` starts at `i * CF_CONNECT_TOKEN_SIZE`.
+ * @param    pool                  Can be `NULL`. A threadpool to spread the tokens across, see `cf_make_threadpool`.
+ * @return   Returns any errors as `CF_Result`.
+ * @remarks  Each token is the same as one from `cf_generate_connect_token` with the same parameters. Everything the tokens share,
+ *           such as the parsed addresses and the hash of the public section, is prepared once for the whole batch, and the random
+ *           bytes for every token are drawn in one go, so the signing and encryption of each token can run on any thread.
+ * @related  CF_ConnectTokenRequest cf_generate_connect_tokens cf_generate_connect_token cf_crypto_generate_key
+ */
+CF_API CF_Result CF_CALL cf_generate_connect_tokens(uint64_t application_id, uint64_t creation_timestamp, uint64_t expiration_timestamp, uint32_t handshake_timeout, int address_count, const char** address_list, const CF_CryptoSignSecret* shared_secret_key, int count, const CF_ConnectTokenRequest* requests, uint8_t* tokens_out, CF_Threadpool* pool);
+
 //--------------------------------------------------------------------------------------------------
 // CLIENT
 
@@ -303,10 +359,39 @@ CF_API void CF_CALL cf_client_free_packet(CF_Client* client, void* packet);
  *           that can be lost due to packet loss as an unreliable packet. Of course, some packets are required
  *           to be sent, and so reliable is appropriate. As an optimization some kinds of data, such as frequent
  *           transform updates, can be sent unreliably.
+ *           
+ *           To keep packets small, pack them with a `CF_BitWriter`.
  * @related  CF_Client cf_client_pop_packet cf_client_free_packet cf_client_send
  */
 CF_API CF_Result CF_CALL cf_client_send(CF_Client* client, const void* packet, int size, bool send_reliably);
 
+/**
+ * @function CF_RELIABLE_CHANNEL_COUNT
+ * @category net
+ * @brief    The number of reliable channels, see `cf_client_send_on_channel` and `cf_server_send_on_channel`.
+ * @related  cf_client_send_on_channel cf_server_send_on_channel
+ */
+#define CF_RELIABLE_CHANNEL_COUNT 4
+
+/**
+ * @function cf_client_send_on_channel
+ * @category net
+ * @brief    Sends a packet to the server reliably, in order only relative to other packets on the same channel.
+ * @param    client             The client.
+ * @param    packet             The packet.
+ * @param    size               The size of `packet` in bytes.
+ * @param    channel            From 0 to `CF_RELIABLE_CHANNEL_COUNT - 1`. Reliable packets from `cf_client_send` go on channel 0.
+ * @return   Returns any errors as a `CF_Result`.
+ * @remarks  Each channel only waits on its own lost packets. Send large messages, such as levels or replays, on their own channel so
+ *           they don't hold up small messages on another. Large messages are split into fragments and reassembled on the other end,
+ *           up to 20 MB each, and the channels take turns filling the window of fragments in flight.
+ *
+ *           Memory for partly received messages is capped per connection. Past the cap, fragments of new messages are refused
+ *           unacknowledged, so the other end sends them again once earlier messages finish. See `reassembly_bytes` in `CF_NetworkStats`.
+ * @related  CF_Client cf_client_send cf_client_pop_packet CF_RELIABLE_CHANNEL_COUNT
+ */
+CF_API CF_Result CF_CALL cf_client_send_on_channel(CF_Client* client, const void* packet, int size, int channel);
+
 /**
  * @enum     CF_ClientState
  * @category net
@@ -382,6 +467,59 @@ CF_API CF_ClientState CF_CALL cf_client_state_get(const CF_Client* client);
  */
 CF_API void CF_CALL cf_client_enable_network_simulator(CF_Client* client, double latency, double jitter, double drop_chance, double duplicate_chance);
 
+/**
+ * @struct   CF_NetworkStats
+ * @category net
+ * @brief    Health of a connection, for dashboards or for adapting how much you send.
+ * @remarks  Estimates are smoothed over recent packets, while counts are totals since the connection started.
+ * @related  CF_NetworkStats cf_client_get_stats cf_server_get_client_stats cf_server_get_stats
+ */
+typedef struct CF_NetworkStats
+{
+	/* @member Smoothed round trip time in seconds. */
+	float rtt;
+
+	/* @member Smoothed variation of the round trip time in seconds. */
+	float jitter;
+
+	/* @member Estimated fraction of packets lost, from 0 to 1. */
+	float packet_loss;
+
+	/* @member Estimated bytes received per second, including packet headers. */
+	float incoming_bytes_per_second;
+
+	/* @member Estimated bytes sent per second, including packet headers. */
+	float outgoing_bytes_per_second;
+
+	/* @member Reliable packets waiting to be sent, plus fragments sent but not yet acknowledged. */
+	int reliable_queue_depth;
+
+	/* @member Memory held by large messages partly received, see `cf_client_send_on_channel`. */
+	int reassembly_bytes;
+
+	/* @member Payload bytes held back by `max_outgoing_bytes_per_second` in `CF_ServerConfig`. Always zero for clients. */
+	int queued_bytes;
+
+	/* @member Total fragments resent after going unacknowledged. */
+	uint64_t resend_count;
+
+	/* @member Total packets sent. */
+	uint64_t packets_sent;
+
+	/* @member Total packets received. */
+	uint64_t packets_received;
+} CF_NetworkStats;
+// @end
+
+/**
+ * @function cf_client_get_stats
+ * @category net
+ * @brief    Returns the health of the client's connection, see `CF_NetworkStats`.
+ * @param    client     The client.
+ * @related  CF_NetworkStats cf_server_get_client_stats cf_server_get_stats
+ */
+CF_API CF_NetworkStats CF_CALL cf_client_get_stats(CF_Client* client);
+
 //--------------------------------------------------------------------------------------------------
 // SERVER
 
@@ -400,10 +538,10 @@ typedef struct CF_ServerConfig
 	/* @member A unique number to identify your game, can be whatever value you like. This must be the same number as in `client_make`. */
 	uint64_t application_id;
 
-	/* @member Not implemented yet. */
+	/* @member Payload bytes each client may send per second, or zero for no limit. Payloads past the budget are dropped before reaching `cf_server_pop_event`, so leave headroom above what a well-behaved client sends. */
 	int max_incoming_bytes_per_second;
 
-	/* @member Not implemented yet. */
+	/* @member Payload bytes sent to each client per second, or zero for no limit. See `cf_server_send_with_priority`. */
 	int max_outgoing_bytes_per_second;
 
 	/* @member The number of seconds before consider a connection as timed out when not receiving any packets on the connection. */
@@ -417,6 +555,12 @@ typedef struct CF_ServerConfig
 
 	/* @member The secret part of your public key cryptography used for connect tokens. This must never be shared publicly and remain a complete secret only know to your servers. See `CF_CryptoSignSecret`. */
 	CF_CryptoSignSecret secret_key;
+
+	/* @member Runs receiving, decryption, encryption and sending on a dedicated thread, instead of inside `cf_server_update`. The rest of the server API stays on your thread, and talks to the I/O thread through lock-free queues. Defaults to false. */
+	bool use_io_thread;
+
+	/* @member Runs the I/O on a shared `CF_ServerHost` instead of a thread of its own. Implies `use_io_thread`. Defaults to NULL. */
+	CF_ServerHost* host;
 } CF_ServerConfig;
 // @end
 
@@ -434,6 +578,8 @@ CF_INLINE CF_ServerConfig CF_CALL cf_server_config_defaults()
 	config.max_outgoing_bytes_per_second = 0;
 	config.connection_timeout = 10;
 	config.resend_rate = 0.1f;
+	config.use_io_thread = false;
+	config.host = NULL;
 	return config;
 }
 
@@ -563,6 +709,7 @@ typedef struct CF_ServerEvent
  * @return   Returns true if an event was popped.
  * @remarks  Server events notify of when a client connects/disconnects, or has sent a payload packet.
  *           You must free the payload packets with `cf_server_free_packet` when done.
+ *           With `use_io_thread` in `CF_ServerConfig` events arrive as soon as the I/O thread receives them, not just after `cf_server_update`.
  * @related  CF_ServerEventType cf_server_event_type_to_string CF_ServerEvent cf_server_pop_event cf_server_update cf_server_send
  */
 CF_API bool CF_CALL cf_server_pop_event(CF_Server* server, CF_ServerEvent* event);
@@ -579,7 +726,8 @@ CF_API void CF_CALL cf_server_free_packet(CF_Server* server, int client_index, v
  * @function cf_server_update
  * @category net
  * @brief    Updates the server.
- * @remarks  Call this once per game tick.
+ * @remarks  Call this once per game tick. With `use_io_thread` in `CF_ServerConfig` the network work happens on the I/O thread, and this
+ *           only hands over queued sends and the current time.
  * @related  cf_server_update CF_ServerEvent cf_server_pop_event
  */
 CF_API void CF_CALL cf_server_update(CF_Server* server, double dt, uint64_t current_time);
@@ -602,10 +750,96 @@ CF_API void CF_CALL cf_server_disconnect_client(CF_Server* server, int client_in
  * @param    client_index   An index representing a particular client, from `CF_ServerEvent`.
  * @param    send_reliably  If `true` the packet will be sent reliably and in order. If false the packet will be sent just once, and may
  *                          arrive out of order or not at all.
- * @related  cf_server_update CF_ServerEvent cf_server_pop_event cf_server_send
+ * @remarks  To keep packets small, pack them with a `CF_BitWriter`. Sends at `CF_SEND_PRIORITY_NORMAL`, see `cf_server_send_with_priority`.
+ * @related  cf_server_update CF_ServerEvent cf_server_pop_event cf_server_send cf_server_send_with_priority
  */
 CF_API void CF_CALL cf_server_send(CF_Server* server, const void* packet, int size, int client_index, bool send_reliably);
 
+/**
+ * @enum     CF_SendPriority
+ * @category net
+ * @brief    Decides which packets go first when a client's outgoing bandwidth is limited.
+ * @related  CF_SendPriority cf_send_priority_to_string cf_server_send_with_priority CF_ServerConfig
+ */
+#define CF_SEND_PRIORITY_DEFS \
+	/* @entry Sent only once everything else has gone out, e.g. cosmetic effects or chat. */ \
+	CF_ENUM(SEND_PRIORITY_LOW,    0) \
+	/* @entry The priority used by `cf_server_send`. */ \
+	CF_ENUM(SEND_PRIORITY_NORMAL, 1) \
+	/* @entry Sent before anything else, e.g. inputs or hit confirmations. */ \
+	CF_ENUM(SEND_PRIORITY_HIGH,   2) \
+	/* @end */
+
+typedef enum CF_SendPriority
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_SEND_PRIORITY_DEFS
+	#undef CF_ENUM
+} CF_SendPriority;
+
+/**
+ * @function cf_send_priority_to_string
+ * @category net
+ * @brief    Convert an enum `CF_SendPriority` to a c-style string.
+ * @param    priority     The priority to convert to a string.
+ * @related  CF_SendPriority cf_send_priority_to_string cf_server_send_with_priority
+ */
+CF_INLINE const char* cf_send_priority_to_string(CF_SendPriority priority)
+{
+	switch (priority) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_SEND_PRIORITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @function cf_server_send_with_priority
+ * @category net
+ * @brief    Sends a packet to a client, ahead of any queued packets of lower priority.
+ * @param    server         The server.
+ * @param    packet         Data to send. It's copied, so you may free it right away.
+ * @param    size           Size of `data` in bytes.
+ * @param    client_index   An index representing a particular client, from `CF_ServerEvent`.
+ * @param    send_reliably  If `true` the packet will be sent reliably and in order. If false the packet will be sent just once, and may
+ *                          arrive out of order or not at all.
+ * @param    priority       Where the packet goes in the client's send queue, see `CF_SendPriority`.
+ * @remarks  Without `max_outgoing_bytes_per_second` in `CF_ServerConfig` packets go out right away, and the priority does nothing.
+ *           Otherwise packets are queued, and `cf_server_update` sends as many as the client's budget allows, highest priority first.
+ *           Unreliable packets that don't fit in this update's budget are dropped, since a newer one is likely on its way, while
+ *           reliable packets wait for the next update. A short burst over the budget is allowed so large packets still get through.
+ * @related  CF_SendPriority cf_server_send cf_server_update cf_server_get_queued_bytes CF_ServerConfig
+ */
+CF_API void CF_CALL cf_server_send_with_priority(CF_Server* server, const void* packet, int size, int client_index, bool send_reliably, CF_SendPriority priority);
+
+/**
+ * @function cf_server_send_on_channel
+ * @category net
+ * @brief    Sends a packet to a client reliably, in order only relative to other packets on the same channel.
+ * @param    server         The server.
+ * @param    packet         Data to send. It's copied, so you may free it right away.
+ * @param    size           Size of `data` in bytes.
+ * @param    client_index   An index representing a particular client, from `CF_ServerEvent`.
+ * @param    channel        From 0 to `CF_RELIABLE_CHANNEL_COUNT - 1`. Reliable packets from `cf_server_send` go on channel 0.
+ * @param    priority       Where the packet goes in the client's send queue, see `CF_SendPriority`.
+ * @remarks  See `cf_client_send_on_channel` for how channels and large messages work.
+ * @related  cf_server_send cf_server_send_with_priority cf_client_send_on_channel CF_RELIABLE_CHANNEL_COUNT
+ */
+CF_API void CF_CALL cf_server_send_on_channel(CF_Server* server, const void* packet, int size, int client_index, int channel, CF_SendPriority priority);
+
+/**
+ * @function cf_server_get_queued_bytes
+ * @category net
+ * @brief    Returns the number of bytes waiting in a client's send queue.
+ * @param    server         The server.
+ * @param    client_index   An index representing a particular client, from `CF_ServerEvent`.
+ * @remarks  Always zero without `max_outgoing_bytes_per_second` in `CF_ServerConfig`. A steadily growing queue means you're sending more
+ *           reliable data than the client's budget, and should send less often or pack tighter.
+ * @related  cf_server_send_with_priority CF_ServerConfig
+ */
+CF_API int CF_CALL cf_server_get_queued_bytes(CF_Server* server, int client_index);
+
 /**
  * @function cf_server_is_client_connected
  * @category net
@@ -627,6 +861,51 @@ CF_API bool CF_CALL cf_server_is_client_connected(CF_Server* server, int client_
  */
 CF_API void CF_CALL cf_server_enable_network_simulator(CF_Server* server, double latency, double jitter, double drop_chance, double duplicate_chance);
 
+/**
+ * @function cf_server_get_client_stats
+ * @category net
+ * @brief    Returns the health of one client's connection, see `CF_NetworkStats`.
+ * @param    server         The server.
+ * @param    client_index   The client.
+ * @remarks  Returns all zeroes if the client isn't connected. With `use_io_thread` the stats are as of the I/O thread's last update.
+ * @related  CF_NetworkStats cf_server_get_stats cf_client_get_stats
+ */
+CF_API CF_NetworkStats CF_CALL cf_server_get_client_stats(CF_Server* server, int client_index);
+
+/**
+ * @function cf_server_get_stats
+ * @category net
+ * @brief    Returns the combined health of every connection to the server, see `CF_NetworkStats`.
+ * @param    server         The server.
+ * @remarks  Round trip time, jitter and packet loss are averaged across connected clients, everything else is summed.
+ * @related  CF_NetworkStats cf_server_get_client_stats cf_client_get_stats
+ */
+CF_API CF_NetworkStats CF_CALL cf_server_get_stats(CF_Server* server);
+
+/**
+ * @function cf_make_server_host
+ * @category net
+ * @brief    Returns a new `CF_ServerHost`, a pool of I/O threads for running many servers in one process.
+ * @param    thread_count   The number of I/O threads, or zero for one per core.
+ * @remarks  Set `host` in `CF_ServerConfig` to run a server's I/O on the host. Each started server is given to the least
+ *           busy thread, and every thread takes turns updating its servers, so a machine running many matches needs only
+ *           as many I/O threads as it has cores. Everything else about the server, including the API being called from your
+ *           own thread, works just as with `use_io_thread`.
+ *
+ *           Each server still binds its own address and port.
+ * @related  CF_ServerHost cf_destroy_server_host CF_ServerConfig cf_make_server
+ */
+CF_API CF_ServerHost* CF_CALL cf_make_server_host(int thread_count);
+
+/**
+ * @function cf_destroy_server_host
+ * @category net
+ * @brief    Destroys a `CF_ServerHost` made by `cf_make_server_host`.
+ * @remarks  Destroy every server using the host first.
+ * @related  CF_ServerHost cf_make_server_host
+ */
+CF_API void CF_CALL cf_destroy_server_host(CF_ServerHost* host);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -641,9 +920,11 @@ namespace Cute
 
 using Client = CF_Client;
 using Server = CF_Server;
+using ServerHost = CF_ServerHost;
 using CryptoKey = CF_CryptoKey;
 using CryptoSignPublic = CF_CryptoSignPublic;
 using CryptoSignSecret = CF_CryptoSignSecret;
+using NetworkStats = CF_NetworkStats;
 
 //--------------------------------------------------------------------------------------------------
 // ENDPOINT
@@ -697,6 +978,10 @@ CF_INLINE Result generate_connect_token(
 		token_ptr_out);
 }
 
+using ConnectTokenRequest = CF_ConnectTokenRequest;
+
+CF_INLINE Result generate_connect_tokens(uint64_t application_id, uint64_t creation_timestamp, uint64_t expiration_timestamp, uint32_t handshake_timeout, int address_count, const char** address_list, const CryptoSignSecret* shared_secret_key, int count, const ConnectTokenRequest* requests, uint8_t* tokens_out, Threadpool* pool = NULL) { return cf_generate_connect_tokens(application_id, creation_timestamp, expiration_timestamp, handshake_timeout, address_count, address_list, shared_secret_key, count, requests, tokens_out, pool); }
+
 //--------------------------------------------------------------------------------------------------
 // CLIENT
 
@@ -723,8 +1008,10 @@ CF_INLINE void client_update(Client* client, double dt, uint64_t current_time) {
 CF_INLINE bool client_pop_packet(Client* client, void** packet, int* size, bool* was_sent_reliably = NULL) { return cf_client_pop_packet(client,packet,size,was_sent_reliably); }
 CF_INLINE void client_free_packet(Client* client, void* packet) { cf_client_free_packet(client,packet); }
 CF_INLINE Result client_send(Client* client, const void* packet, int size, bool send_reliably) { return cf_client_send(client,packet,size,send_reliably); }
+CF_INLINE Result client_send_on_channel(Client* client, const void* packet, int size, int channel) { return cf_client_send_on_channel(client,packet,size,channel); }
 CF_INLINE ClientState client_state_get(const Client* client) { return cf_client_state_get(client); }
 CF_INLINE void client_enable_network_simulator(Client* client, double latency, double jitter, double drop_chance, double duplicate_chance) { cf_client_enable_network_simulator(client,latency,jitter,drop_chance,duplicate_chance); }
+CF_INLINE NetworkStats client_get_stats(Client* client) { return cf_client_get_stats(client); }
 
 //--------------------------------------------------------------------------------------------------
 // SERVER
@@ -747,6 +1034,21 @@ CF_INLINE const char* to_string(ServerEventType type)
 	}
 }
 
+using SendPriority = CF_SendPriority;
+#define CF_ENUM(K, V) CF_INLINE constexpr SendPriority K = CF_##K;
+CF_SEND_PRIORITY_DEFS
+#undef CF_ENUM
+
+CF_INLINE const char* to_string(SendPriority priority)
+{
+	switch (priority) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_SEND_PRIORITY_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
 CF_INLINE ServerConfig server_config_defaults() { return cf_server_config_defaults(); }
 CF_INLINE Server* make_server(ServerConfig config) { return cf_make_server(config); }
 CF_INLINE void destroy_server(Server* server) { cf_destroy_server(server); }
@@ -757,8 +1059,15 @@ CF_INLINE void server_free_packet(Server* server, int client_index, void* data)
 CF_INLINE void server_update(Server* server, double dt, uint64_t current_time) { cf_server_update(server,dt,current_time); }
 CF_INLINE void server_disconnect_client(Server* server, int client_index, bool notify_client = true) { cf_server_disconnect_client(server, client_index, notify_client); }
 CF_INLINE void server_send(Server* server, const void* packet, int size, int client_index, bool send_reliably) { cf_server_send(server,packet,size,client_index,send_reliably); }
+CF_INLINE void server_send_with_priority(Server* server, const void* packet, int size, int client_index, bool send_reliably, SendPriority priority) { cf_server_send_with_priority(server,packet,size,client_index,send_reliably,priority); }
+CF_INLINE void server_send_on_channel(Server* server, const void* packet, int size, int client_index, int channel, SendPriority priority = CF_SEND_PRIORITY_NORMAL) { cf_server_send_on_channel(server,packet,size,client_index,channel,priority); }
+CF_INLINE int server_get_queued_bytes(Server* server, int client_index) { return cf_server_get_queued_bytes(server,client_index); }
 CF_INLINE bool server_is_client_connected(Server* server, int client_index) { return cf_server_is_client_connected(server,client_index); }
 CF_INLINE void server_enable_network_simulator(Server* server, double latency, double jitter, double drop_chance, double duplicate_chance) { cf_server_enable_network_simulator(server,latency,jitter,drop_chance,duplicate_chance); }
+CF_INLINE NetworkStats server_get_client_stats(Server* server, int client_index) { return cf_server_get_client_stats(server,client_index); }
+CF_INLINE NetworkStats server_get_stats(Server* server) { return cf_server_get_stats(server); }
+CF_INLINE ServerHost* make_server_host(int thread_count = 0) { return cf_make_server_host(thread_count); }
+CF_INLINE void destroy_server_host(ServerHost* host) { cf_destroy_server_host(host); }
 
 }
 
@@ -10,6 +10,7 @@
 
 #include "cute_defines.h"
 #include "cute_graphics.h"
+#include "cute_multithreading.h"
 
 //--------------------------------------------------------------------------------------------------
 // C API
@@ -109,6 +110,63 @@ CF_API float CF_CALL cf_noise3(CF_Noise noise, float x, float y, float z);
  */
 CF_API float CF_CALL cf_noise4(CF_Noise noise, float x, float y, float z, float w);
 
+/**
+ * @function cf_noise_fill
+ * @category noise
+ * @brief    Fills a grid of floats with `cf_noise2` samples, many at a time.
+ * @param    noise   The noise to sample, see `cf_make_noise` or `cf_make_noise_fbm`.
+ * @param    values  The `w * h` floats to fill, row by row. Each is in the range [-1,1].
+ * @param    w       The width of the grid.
+ * @param    h       The height of the grid.
+ * @param    x       The x-coordinate sampled by the first column.
+ * @param    y       The y-coordinate sampled by the first row.
+ * @param    step    The distance between samples in both directions.
+ * @param    pool    Can be `NULL`. A threadpool to spread the rows across, see `cf_make_threadpool`.
+ * @remarks  Samples are computed four at a time with SIMD in single precision, so they can differ from `cf_noise2` in the last few
+ *           bits. Use this instead of the pixel functions when you want the raw values, e.g. for a heightmap, and skip the conversion
+ *           to colors entirely.
+ * @related  CF_Noise cf_noise2 cf_noise_fill cf_noise_fill_wrapped cf_noise_pixels cf_noise_fbm_pixels
+ */
+CF_API void CF_CALL cf_noise_fill(CF_Noise noise, float* values, int w, int h, float x, float y, float step, CF_Threadpool* pool);
+
+/**
+ * @function cf_noise_fill_wrapped
+ * @category noise
+ * @brief    Fills a grid of floats with noise that can animate in a loop, and tiles seamlessly.
+ * @param    noise           The noise to sample, see `cf_make_noise` or `cf_make_noise_fbm`.
+ * @param    values          The `w * h` floats to fill, row by row. Each is in the range [-1,1].
+ * @param    w               The width of the grid.
+ * @param    h               The height of the grid.
+ * @param    scale           Scales up or down the noise, like zooming in or out. Default 1.0f.
+ * @param    time            A time parameter for animation.
+ * @param    time_amplitude  Adjusts how much the animation evolves over the period. Default 1.0f.
+ * @param    pool            Can be `NULL`. A threadpool to spread the rows across, see `cf_make_threadpool`.
+ * @remarks  This produces the same values as `cf_noise_pixels_wrapped` and `cf_noise_fbm_pixels_wrapped`, without the conversion to colors.
+ *           See those functions for details on animating the noise.
+ * @related  CF_Noise cf_noise4 cf_noise_fill cf_noise_fill_wrapped cf_noise_pixels_wrapped cf_noise_fbm_pixels_wrapped
+ */
+CF_API void CF_CALL cf_noise_fill_wrapped(CF_Noise noise, float* values, int w, int h, float scale, float time, float time_amplitude, CF_Threadpool* pool);
+
+/**
+ * @function cf_noise_render_to
+ * @category noise
+ * @brief    Renders `cf_noise2` samples onto a canvas with a shader, instead of generating pixels on the CPU.
+ * @param    noise   The noise to sample, see `cf_make_noise` or `cf_make_noise_fbm`.
+ * @param    canvas  The canvas to render onto. Every pixel is overwritten.
+ * @param    x       The x-coordinate sampled by the left column of pixels.
+ * @param    y       The y-coordinate sampled by the top row of pixels.
+ * @param    step    The distance between samples in both directions.
+ * @remarks  Samples the same points as `cf_noise_fill` with the same seed and fbm settings, written as gray levels the same way the pixel
+ *           functions do. To match `cf_noise_fbm_pixels` for a `w` by `h` canvas pass `-0.5f, -0.5f, 1.0f / min(w, h)`. For `cf_noise_pixels`
+ *           pass `-0.5f * scale, -0.5f * scale, scale / min(w, h)`. Animate the noise by moving `x` and `y` each frame, which costs only a
+ *           draw call, with nothing generated or uploaded from the CPU. The seamless looping of the `_wrapped` functions needs 4D noise and
+ *           is only available on the CPU.
+ *           
+ *           Like `cf_canvas_blit` this renders immediately, so call it before or after `cf_render_to`, not while a canvas is being drawn to.
+ * @related  CF_Noise cf_noise2 cf_noise_fill cf_noise_pixels cf_noise_fbm_pixels cf_make_canvas cf_render_to
+ */
+CF_API void CF_CALL cf_noise_render_to(CF_Noise noise, CF_Canvas canvas, float x, float y, float step);
+
 /**
  * @function cf_noise_pixels
  * @category noise
@@ -119,7 +177,8 @@ CF_API float CF_CALL cf_noise4(CF_Noise noise, float x, float y, float z, float
  * @param    scale      Scales up or down the noise in the image, like zooming in or out. Default 1.0f.
  * @return   Returns a generated image filled with noise.
  * @remarks  The generated noise is quite simple -- you're probably looking for the more advanced `cf_noise_fbm_pixels`, or `cf_noise_fbm_pixels_wrapped`.
- * @related  cf_noise_pixels cf_noise_pixels_wrapped cf_noise_fbm_pixels cf_noise_fbm_pixels_wrapped
+ *           Large images are generated across the app's threadpool when there is one. For the raw noise values see `cf_noise_fill`.
+ * @related  cf_noise_pixels cf_noise_pixels_wrapped cf_noise_fbm_pixels cf_noise_fbm_pixels_wrapped cf_noise_fill
  */
 CF_API CF_Pixel* CF_CALL cf_noise_pixels(int w, int h, uint64_t seed, float scale);
 
@@ -183,6 +242,85 @@ CF_API CF_Pixel* CF_CALL cf_noise_fbm_pixels(int w, int h, uint64_t seed, float
  */
 CF_API CF_Pixel* CF_CALL cf_noise_fbm_pixels_wrapped(int w, int h, uint64_t seed, float scale, float lacunarity, int octaves, float falloff, float time, float time_amplitude);
 
+/**
+ * @struct   CF_NoiseCache
+ * @category noise
+ * @brief    A cache of noise tiles for streaming procedural worlds, see `cf_make_noise_cache`.
+ * @related  CF_NoiseCache cf_make_noise_cache cf_destroy_noise_cache cf_noise_cache_sample cf_noise_cache_get_tile cf_noise_cache_prefetch
+ */
+typedef struct CF_NoiseCache { uint64_t id; } CF_NoiseCache;
+// @end
+
+/**
+ * @function cf_make_noise_cache
+ * @category noise
+ * @brief    Makes a cache of square tiles of `cf_noise2` samples, generated on demand and kept around until least recently used.
+ * @param    noise      The noise to sample, see `cf_make_noise` or `cf_make_noise_fbm`. Must outlive the cache.
+ * @param    tile_size  The number of samples along each side of a tile, e.g. 64.
+ * @param    step       The distance between samples, in noise coordinates.
+ * @param    max_tiles  The most tiles to keep around before evicting the least recently used ones.
+ * @param    pool       Can be `NULL`. A threadpool to generate prefetched tiles on, see `cf_make_threadpool`.
+ * @return   Free it up with `cf_destroy_noise_cache` when done.
+ * @remarks  Samples sit on a grid at multiples of `step`, so tile (0,0) begins at the origin. Games that build worlds from noise tend to
+ *           sample the same coordinates frame after frame; with a cache each sample is generated once, in batches with `cf_noise_fill`.
+ *           Call `cf_noise_cache_prefetch` each frame around the camera or player so tiles are ready before they're needed. The cache
+ *           isn't thread-safe, so call its functions from one thread at a time.
+ * @related  CF_NoiseCache cf_make_noise_cache cf_destroy_noise_cache cf_noise_cache_sample cf_noise_cache_get_tile cf_noise_cache_prefetch
+ */
+CF_API CF_NoiseCache CF_CALL cf_make_noise_cache(CF_Noise noise, int tile_size, float step, int max_tiles, CF_Threadpool* pool);
+
+/**
+ * @function cf_destroy_noise_cache
+ * @category noise
+ * @brief    Destroys a cache made by `cf_make_noise_cache`.
+ * @param    cache      The cache.
+ * @remarks  Waits for any tiles still being generated.
+ * @related  CF_NoiseCache cf_make_noise_cache cf_destroy_noise_cache cf_noise_cache_sample cf_noise_cache_get_tile cf_noise_cache_prefetch
+ */
+CF_API void CF_CALL cf_destroy_noise_cache(CF_NoiseCache cache);
+
+/**
+ * @function cf_noise_cache_sample
+ * @category noise
+ * @brief    Returns the noise at a point, bilinearly interpolated between the cached samples around it.
+ * @param    cache      The cache.
+ * @param    x          The x-coordinate, in noise coordinates.
+ * @param    y          The y-coordinate, in noise coordinates.
+ * @remarks  At multiples of `step` this is the same value as `cf_noise2` up to rounding. Interpolation is seamless across tiles. A missing
+ *           tile is generated on the spot, and one still being prefetched is waited on.
+ * @related  CF_NoiseCache cf_make_noise_cache cf_destroy_noise_cache cf_noise_cache_sample cf_noise_cache_get_tile cf_noise_cache_prefetch
+ */
+CF_API float CF_CALL cf_noise_cache_sample(CF_NoiseCache cache, float x, float y);
+
+/**
+ * @function cf_noise_cache_get_tile
+ * @category noise
+ * @brief    Returns the samples of one tile.
+ * @param    cache      The cache.
+ * @param    tile_x     The x-index of the tile, which begins at `tile_x * tile_size * step`.
+ * @param    tile_y     The y-index of the tile, which begins at `tile_y * tile_size * step`.
+ * @return   Returns `(tile_size + 1) * (tile_size + 1)` samples row by row, where the last row and column repeat the first of the
+ *           neighboring tiles.
+ * @remarks  Generates the tile if missing, or waits on it if it's being prefetched. The pointer is valid until the tile is evicted by a
+ *           later call on the cache.
+ * @related  CF_NoiseCache cf_make_noise_cache cf_destroy_noise_cache cf_noise_cache_sample cf_noise_cache_get_tile cf_noise_cache_prefetch
+ */
+CF_API const float* CF_CALL cf_noise_cache_get_tile(CF_NoiseCache cache, int tile_x, int tile_y);
+
+/**
+ * @function cf_noise_cache_prefetch
+ * @category noise
+ * @brief    Starts generating every tile within `radius` of a focus point, nearest first.
+ * @param    cache      The cache.
+ * @param    x          The x-coordinate of the focus, in noise coordinates.
+ * @param    y          The y-coordinate of the focus, in noise coordinates.
+ * @param    radius     The distance around the focus to cover.
+ * @remarks  Returns right away when the cache has a threadpool, otherwise the tiles are generated on the calling thread. Prefetched tiles
+ *           count as recently used, so keep `max_tiles` comfortably above the number of tiles the radius covers.
+ * @related  CF_NoiseCache cf_make_noise_cache cf_destroy_noise_cache cf_noise_cache_sample cf_noise_cache_get_tile cf_noise_cache_prefetch
+ */
+CF_API void CF_CALL cf_noise_cache_prefetch(CF_NoiseCache cache, float x, float y, float radius);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
@@ -196,6 +334,7 @@ namespace Cute
 {
 
 using Noise = CF_Noise;
+using NoiseCache = CF_NoiseCache;
 
 CF_INLINE Noise make_noise(uint64_t seed) { return cf_make_noise(seed); }
 CF_INLINE Noise make_noise_fbm(uint64_t seed, float scale, float lacunarity, int octaves, float falloff) { return cf_make_noise_fbm(seed, scale, lacunarity, octaves, falloff); }
@@ -204,6 +343,16 @@ CF_INLINE float noise(CF_Noise noise, v2 p) { return cf_noise2(noise, p.x, p.y);
 CF_INLINE float noise(CF_Noise noise, float x, float y) { return cf_noise2(noise, x, y); }
 CF_INLINE float noise(CF_Noise noise, float x, float y, float z) { return cf_noise3(noise, x, y, z); }
 CF_INLINE float noise(CF_Noise noise, float x, float y, float z, float w) { return cf_noise4(noise, x, y, z, w); }
+CF_INLINE void noise_fill(CF_Noise noise, float* values, int w, int h, float x, float y, float step, CF_Threadpool* pool = NULL) { cf_noise_fill(noise, values, w, h, x, y, step, pool); }
+CF_INLINE void noise_fill_wrapped(CF_Noise noise, float* values, int w, int h, float scale, float time, float time_amplitude, CF_Threadpool* pool = NULL) { cf_noise_fill_wrapped(noise, values, w, h, scale, time, time_amplitude, pool); }
+CF_INLINE void noise_render_to(CF_Noise noise, CF_Canvas canvas, float x, float y, float step) { cf_noise_render_to(noise, canvas, x, y, step); }
+CF_INLINE NoiseCache make_noise_cache(CF_Noise noise, int tile_size, float step, int max_tiles, CF_Threadpool* pool = NULL) { return cf_make_noise_cache(noise, tile_size, step, max_tiles, pool); }
+CF_INLINE void destroy_noise_cache(NoiseCache cache) { cf_destroy_noise_cache(cache); }
+CF_INLINE float noise_cache_sample(NoiseCache cache, float x, float y) { return cf_noise_cache_sample(cache, x, y); }
+CF_INLINE float noise_cache_sample(NoiseCache cache, v2 p) { return cf_noise_cache_sample(cache, p.x, p.y); }
+CF_INLINE const float* noise_cache_get_tile(NoiseCache cache, int tile_x, int tile_y) { return cf_noise_cache_get_tile(cache, tile_x, tile_y); }
+CF_INLINE void noise_cache_prefetch(NoiseCache cache, float x, float y, float radius) { cf_noise_cache_prefetch(cache, x, y, radius); }
+CF_INLINE void noise_cache_prefetch(NoiseCache cache, v2 p, float radius) { cf_noise_cache_prefetch(cache, p.x, p.y, radius); }
 CF_INLINE CF_Pixel* noise_pixels(int w, int h, uint64_t seed, float scale) { return cf_noise_pixels(w, h, seed, scale); }
 CF_INLINE CF_Pixel* noise_pixels_wrapped(int w, int h, uint64_t seed, float scale, float time, float time_amplitude) { return cf_noise_pixels_wrapped(w, h, seed, scale, time, time_amplitude); }
 CF_INLINE CF_Pixel* noise_fbm_pixels(int w, int h, uint64_t seed, float scale, float lacunarity, int octaves, float falloff) { return cf_noise_fbm_pixels(w, h, seed, scale, lacunarity, octaves, falloff); }
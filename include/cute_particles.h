@@ -0,0 +1,272 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_PARTICLES_H
+#define CF_PARTICLES_H
+
+#include "cute_defines.h"
+#include "cute_math.h"
+#include "cute_color.h"
+#include "cute_sprite.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_ParticleEmitter
+ * @category draw
+ * @brief    An opaque handle for a pool of particles spawned, simulated and drawn together.
+ * @remarks  Particles are kept in arrays per emitter and stepped four at a time by `cf_particle_emitter_update`. `cf_draw_particles`
+ *           puts a single placeholder into the batcher in place of every particle. The placeholder sorts by the current draw layer like
+ *           any other draw, and the whole emitter is drawn in its place with one instanced draw call. Each emitter keeps its own
+ *           instance buffer holding just a position and age per particle, uploaded at most once a frame, and the GPU works out size,
+ *           color and the quad around each particle. This skips batching thousands of individual `cf_draw_circle_fill` or
+ *           `cf_draw_sprite` calls, and building vertices for any of them on the CPU.
+ *
+ *           ```cpp
+ *           CF_ParticleParams params = cf_particle_params_defaults();
+ *           params.rate = 200;
+ *           params.gravity = cf_v2(0, -100);
+ *           CF_ParticleEmitter sparks = cf_make_particle_emitter(params);
+ *
+ *           // Each frame.
+ *           cf_particle_emitter_set_position(sparks, torch_position);
+ *           cf_particle_emitter_update(sparks, CF_DELTA_TIME);
+ *           cf_draw_particles(sparks);
+ *           ```
+ * @related  CF_ParticleEmitter CF_ParticleParams cf_make_particle_emitter cf_particle_emitter_update cf_draw_particles
+ */
+typedef struct CF_ParticleEmitter { uint64_t id; } CF_ParticleEmitter;
+// @end
+
+/**
+ * @struct   CF_ParticleParams
+ * @category draw
+ * @brief    Settings for a `CF_ParticleEmitter`, see `cf_particle_params_defaults`.
+ * @remarks  Ranges pick a uniformly random value per particle as it spawns. Size and color blend from their start to their end value
+ *           over each particle's lifetime.
+ * @related  CF_ParticleParams cf_particle_params_defaults cf_make_particle_emitter cf_particle_emitter_set_params
+ */
+typedef struct CF_ParticleParams
+{
+	/* @member The most particles alive at once. Spawning stops while the emitter is full. */
+	int capacity;
+
+	/* @member Particles spawned per second while emitting, see `cf_particle_emitter_set_emitting`. */
+	float rate;
+
+	/* @member Shortest lifetime, in seconds. */
+	float lifetime_min;
+
+	/* @member Longest lifetime, in seconds. */
+	float lifetime_max;
+
+	/* @member Particles spawn at a random spot within this distance from the emitter's position. */
+	float spawn_radius;
+
+	/* @member Launch direction in radians, where zero points along +x. */
+	float angle;
+
+	/* @member Launch directions vary randomly by up to this many radians to either side of `angle`. */
+	float spread;
+
+	/* @member Slowest launch speed. */
+	float speed_min;
+
+	/* @member Fastest launch speed. */
+	float speed_max;
+
+	/* @member Acceleration applied to every particle. */
+	CF_V2 gravity;
+
+	/* @member The fraction of velocity lost per second, from 0 to 1. */
+	float drag;
+
+	/* @member Diameter as particles spawn. For sprites this scales the sprite, where 1 is its original size. */
+	float size_start;
+
+	/* @member Diameter (or sprite scale) as particles expire. */
+	float size_end;
+
+	/* @member Color as particles spawn. Sprites only use the alpha channel. */
+	CF_Color color_start;
+
+	/* @member Color as particles expire. */
+	CF_Color color_end;
+
+	/* @member Seeds the emitter's random numbers, so the same settings and updates replay the same particles. */
+	uint64_t seed;
+} CF_ParticleParams;
+// @end
+
+/**
+ * @function cf_particle_params_defaults
+ * @category draw
+ * @brief    Returns a good set of default settings: white particles drifting upwards, fading out over one second.
+ * @related  CF_ParticleParams cf_make_particle_emitter
+ */
+CF_INLINE CF_ParticleParams CF_CALL cf_particle_params_defaults()
+{
+	CF_ParticleParams params;
+	params.capacity = 1024;
+	params.rate = 100.0f;
+	params.lifetime_min = 1.0f;
+	params.lifetime_max = 1.0f;
+	params.spawn_radius = 0;
+	params.angle = CF_PI * 0.5f;
+	params.spread = CF_PI * 0.25f;
+	params.speed_min = 50.0f;
+	params.speed_max = 100.0f;
+	params.gravity = cf_v2(0, 0);
+	params.drag = 0;
+	params.size_start = 8.0f;
+	params.size_end = 0;
+	params.color_start = cf_color_white();
+	params.color_end = cf_make_color_rgba_f(1, 1, 1, 0);
+	params.seed = 0;
+	return params;
+}
+
+/**
+ * @function cf_make_particle_emitter
+ * @category draw
+ * @brief    Returns a new `CF_ParticleEmitter`, emitting right away at the origin.
+ * @param    params     The settings, see `cf_particle_params_defaults`.
+ * @remarks  Particles draw as filled circles until given a sprite with `cf_particle_emitter_set_sprite`.
+ * @related  CF_ParticleEmitter cf_destroy_particle_emitter cf_particle_emitter_update cf_draw_particles
+ */
+CF_API CF_ParticleEmitter CF_CALL cf_make_particle_emitter(CF_ParticleParams params);
+
+/**
+ * @function cf_destroy_particle_emitter
+ * @category draw
+ * @brief    Destroys a `CF_ParticleEmitter` made by `cf_make_particle_emitter`.
+ * @remarks  Don't destroy an emitter drawn with `cf_draw_particles` before the frame is rendered.
+ * @related  CF_ParticleEmitter cf_make_particle_emitter
+ */
+CF_API void CF_CALL cf_destroy_particle_emitter(CF_ParticleEmitter emitter);
+
+/**
+ * @function cf_particle_emitter_set_params
+ * @category draw
+ * @brief    Replaces the settings of an emitter.
+ * @param    emitter    The emitter.
+ * @param    params     The new settings.
+ * @remarks  Live particles keep moving as they were launched. Lowering `capacity` removes the newest particles that no longer fit.
+ * @related  CF_ParticleEmitter CF_ParticleParams cf_make_particle_emitter
+ */
+CF_API void CF_CALL cf_particle_emitter_set_params(CF_ParticleEmitter emitter, CF_ParticleParams params);
+
+/**
+ * @function cf_particle_emitter_set_sprite
+ * @category draw
+ * @brief    Draws each particle as a sprite, instead of a filled circle.
+ * @param    emitter    The emitter.
+ * @param    sprite     The sprite, or `NULL` to go back to circles. Its current frame is used, and its own transform is ignored.
+ * @related  CF_ParticleEmitter cf_draw_particles
+ */
+CF_API void CF_CALL cf_particle_emitter_set_sprite(CF_ParticleEmitter emitter, const CF_Sprite* sprite);
+
+/**
+ * @function cf_particle_emitter_set_position
+ * @category draw
+ * @brief    Moves where new particles spawn. Live particles stay where they are.
+ * @param    emitter    The emitter.
+ * @param    position   The new position.
+ * @related  CF_ParticleEmitter cf_particle_emitter_update
+ */
+CF_API void CF_CALL cf_particle_emitter_set_position(CF_ParticleEmitter emitter, CF_V2 position);
+
+/**
+ * @function cf_particle_emitter_set_emitting
+ * @category draw
+ * @brief    Starts or stops spawning particles at `rate`. Live particles play out either way.
+ * @param    emitter    The emitter.
+ * @param    emitting   True to spawn particles over time.
+ * @related  CF_ParticleEmitter cf_particle_emitter_burst
+ */
+CF_API void CF_CALL cf_particle_emitter_set_emitting(CF_ParticleEmitter emitter, bool emitting);
+
+/**
+ * @function cf_particle_emitter_burst
+ * @category draw
+ * @brief    Spawns a number of particles at once, such as for an explosion.
+ * @param    emitter    The emitter.
+ * @param    count      How many particles to spawn, limited by the room left below `capacity`.
+ * @related  CF_ParticleEmitter cf_particle_emitter_set_emitting
+ */
+CF_API void CF_CALL cf_particle_emitter_burst(CF_ParticleEmitter emitter, int count);
+
+/**
+ * @function cf_particle_emitter_update
+ * @category draw
+ * @brief    Steps all particles forward in time, removes expired ones and spawns new ones.
+ * @param    emitter    The emitter.
+ * @param    dt         The time step in seconds, such as `CF_DELTA_TIME`.
+ * @related  CF_ParticleEmitter cf_draw_particles
+ */
+CF_API void CF_CALL cf_particle_emitter_update(CF_ParticleEmitter emitter, float dt);
+
+/**
+ * @function cf_particle_emitter_count
+ * @category draw
+ * @brief    Returns the number of live particles.
+ * @param    emitter    The emitter.
+ * @related  CF_ParticleEmitter cf_particle_emitter_update
+ */
+CF_API int CF_CALL cf_particle_emitter_count(CF_ParticleEmitter emitter);
+
+/**
+ * @function cf_draw_particles
+ * @category draw
+ * @brief    Draws all live particles of an emitter.
+ * @param    emitter    The emitter.
+ * @remarks  Reads the current layer, camera, tint, clip box and vertex attributes, same as `cf_draw_sprite`. Particles are read once
+ *           the frame is rendered, so don't update or destroy the emitter in between. An emitter drawn more than once in a frame draws
+ *           the particles uploaded the first time each time. Draw lists draw the emitter as it is once the frame they're submitted
+ *           to is rendered. Emitters can't be baked into static geometry. Custom shaders, vertex callbacks and debug colors don't
+ *           apply to particles, as they never turn into vertices.
+ * @related  CF_ParticleEmitter cf_particle_emitter_update cf_draw_push_layer
+ */
+CF_API void CF_CALL cf_draw_particles(CF_ParticleEmitter emitter);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using ParticleEmitter = CF_ParticleEmitter;
+using ParticleParams = CF_ParticleParams;
+
+CF_INLINE ParticleParams particle_params_defaults() { return cf_particle_params_defaults(); }
+CF_INLINE ParticleEmitter make_particle_emitter(ParticleParams params) { return cf_make_particle_emitter(params); }
+CF_INLINE void destroy_particle_emitter(ParticleEmitter emitter) { cf_destroy_particle_emitter(emitter); }
+CF_INLINE void particle_emitter_set_params(ParticleEmitter emitter, ParticleParams params) { cf_particle_emitter_set_params(emitter, params); }
+CF_INLINE void particle_emitter_set_sprite(ParticleEmitter emitter, const Sprite* sprite) { cf_particle_emitter_set_sprite(emitter, sprite); }
+CF_INLINE void particle_emitter_set_position(ParticleEmitter emitter, v2 position) { cf_particle_emitter_set_position(emitter, position); }
+CF_INLINE void particle_emitter_set_emitting(ParticleEmitter emitter, bool emitting) { cf_particle_emitter_set_emitting(emitter, emitting); }
+CF_INLINE void particle_emitter_burst(ParticleEmitter emitter, int count) { cf_particle_emitter_burst(emitter, count); }
+CF_INLINE void particle_emitter_update(ParticleEmitter emitter, float dt) { cf_particle_emitter_update(emitter, dt); }
+CF_INLINE int particle_emitter_count(ParticleEmitter emitter) { return cf_particle_emitter_count(emitter); }
+CF_INLINE void draw_particles(ParticleEmitter emitter) { cf_draw_particles(emitter); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_PARTICLES_H
@@ -0,0 +1,595 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_PHYSICS_H
+#define CF_PHYSICS_H
+
+#include "cute_defines.h"
+#include "cute_math.h"
+#include "cute_multithreading.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_PhysicsWorld
+ * @category physics
+ * @brief    An opaque handle for a world of rigid bodies that collide, bounce and come to rest on each other.
+ * @remarks  Bodies are found with a `CF_AabbTree` broadphase and collided with `cf_collide`. Contacts are remembered from one step to the
+ *           next so resting stacks settle quickly. Bodies touching each other are grouped into islands, islands that stop moving go to
+ *           sleep and cost next to nothing, and awake islands are solved in parallel on the world's threadpool.
+ *
+ *           ```cpp
+ *           CF_PhysicsWorld world = cf_make_physics_world(NULL);
+ *           CF_Aabb ground_box = cf_make_aabb(cf_v2(-200, -10), cf_v2(200, 10));
+ *           CF_BodyParams ground = cf_body_defaults();
+ *           ground.shape = &ground_box;
+ *           ground.shape_type = CF_SHAPE_TYPE_AABB;
+ *           cf_make_body(world, &ground);
+ *
+ *           CF_Circle ball_circle = cf_make_circle(cf_v2(0, 0), 8);
+ *           CF_BodyParams ball = cf_body_defaults();
+ *           ball.type = CF_BODY_TYPE_DYNAMIC;
+ *           ball.position = cf_v2(0, 100);
+ *           ball.shape = &ball_circle;
+ *           ball.shape_type = CF_SHAPE_TYPE_CIRCLE;
+ *           CF_Body b = cf_make_body(world, &ball);
+ *
+ *           // In your update, with a fixed timestep, see `cf_set_fixed_timestep`.
+ *           cf_physics_world_step(world, CF_DELTA_TIME_FIXED);
+ *           CF_Transform tx = cf_body_get_transform(b);
+ *           ```
+ * @related  CF_PhysicsWorld CF_PhysicsWorldParams cf_make_physics_world cf_physics_world_step CF_Body cf_make_body
+ */
+typedef struct CF_PhysicsWorld { uint64_t id; } CF_PhysicsWorld;
+// @end
+
+/**
+ * @struct   CF_Body
+ * @category physics
+ * @brief    An opaque handle for a rigid body within a `CF_PhysicsWorld`.
+ * @related  CF_Body CF_BodyParams cf_make_body cf_destroy_body cf_body_get_transform
+ */
+typedef struct CF_Body { uint64_t id; } CF_Body;
+// @end
+
+/**
+ * @enum     CF_BodyType
+ * @category physics
+ * @brief    How a body moves.
+ * @related  CF_BodyType cf_body_type_to_string CF_BodyParams
+ */
+#define CF_BODY_TYPE_DEFS \
+	/* @entry Never moves, such as the ground and walls. Has infinite mass. */ \
+	CF_ENUM(BODY_TYPE_STATIC, 0) \
+	/* @entry Moves by its velocity alone, such as a moving platform. Pushes dynamic bodies, but isn't pushed back. */ \
+	CF_ENUM(BODY_TYPE_KINEMATIC, 1) \
+	/* @entry Moved by gravity, forces and collisions. */ \
+	CF_ENUM(BODY_TYPE_DYNAMIC, 2) \
+	/* @end */
+
+typedef enum CF_BodyType
+{
+	#define CF_ENUM(K, V) CF_##K = V,
+	CF_BODY_TYPE_DEFS
+	#undef CF_ENUM
+} CF_BodyType;
+
+/**
+ * @function cf_body_type_to_string
+ * @category physics
+ * @brief    Returns a `CF_BodyType` converted to a C string.
+ * @related  CF_BodyType cf_body_type_to_string CF_BodyParams
+ */
+CF_INLINE const char* cf_body_type_to_string(CF_BodyType type)
+{
+	switch (type) {
+	#define CF_ENUM(K, V) case CF_##K: return CF_STRINGIZE(CF_##K);
+	CF_BODY_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+/**
+ * @struct   CF_PhysicsWorldParams
+ * @category physics
+ * @brief    Parameters for `cf_make_physics_world`.
+ * @remarks  Use `cf_physics_world_defaults` for default settings. The defaults are tuned for worlds measured in pixels, the same units
+ *           `cf_draw` uses, where a body tends to be a few dozen units across.
+ * @related  CF_PhysicsWorldParams cf_physics_world_defaults cf_make_physics_world
+ */
+typedef struct CF_PhysicsWorldParams
+{
+	/* @member Default: (0, -500). Acceleration applied to every dynamic body. */
+	CF_V2 gravity;
+
+	/* @member Default: 8. Solver passes over the contacts per step. More passes give stiffer stacks at a higher cost. */
+	int velocity_iterations;
+
+	/* @member Default: 0.5f. How far shapes may sink into each other before being pushed apart. Keeps resting contacts from jittering. */
+	float linear_slop;
+
+	/* @member Default: true. Lets islands that stopped moving go to sleep. */
+	bool sleep_enabled;
+
+	/* @member Default: 0.5f. Seconds an island must stay still before it goes to sleep. */
+	float time_to_sleep;
+
+	/* @member Default: 2.0f. Bodies moving slower than this count as still, in units per second. */
+	float sleep_linear_velocity;
+
+	/* @member Default: 0.05f. Bodies spinning slower than this count as still, in radians per second. */
+	float sleep_angular_velocity;
+
+	/* @member Default: `NULL`. Can be `NULL`. A threadpool to run the narrowphase and island solver on, see `cf_make_threadpool`. */
+	CF_Threadpool* pool;
+} CF_PhysicsWorldParams;
+// @end
+
+/**
+ * @function cf_physics_world_defaults
+ * @category physics
+ * @brief    Returns a `CF_PhysicsWorldParams` filled with default settings.
+ * @related  CF_PhysicsWorldParams cf_physics_world_defaults cf_make_physics_world
+ */
+CF_INLINE CF_PhysicsWorldParams CF_CALL cf_physics_world_defaults()
+{
+	CF_PhysicsWorldParams params;
+	params.gravity = cf_v2(0, -500.0f);
+	params.velocity_iterations = 8;
+	params.linear_slop = 0.5f;
+	params.sleep_enabled = true;
+	params.time_to_sleep = 0.5f;
+	params.sleep_linear_velocity = 2.0f;
+	params.sleep_angular_velocity = 0.05f;
+	params.pool = NULL;
+	return params;
+}
+
+/**
+ * @struct   CF_BodyParams
+ * @category physics
+ * @brief    Parameters for `cf_make_body`.
+ * @remarks  Use `cf_body_defaults` for default settings. Each body has a single shape, given in the body's local space.
+ * @related  CF_BodyParams cf_body_defaults cf_make_body CF_BodyType
+ */
+typedef struct CF_BodyParams
+{
+	/* @member Default: `CF_BODY_TYPE_STATIC`. How the body moves, see `CF_BodyType`. */
+	CF_BodyType type;
+
+	/* @member Default: (0, 0). Where the body's origin starts out. */
+	CF_V2 position;
+
+	/* @member Default: 0. The body's starting rotation in radians. */
+	float angle;
+
+	/* @member Default: (0, 0). The starting velocity of the body's center of mass. */
+	CF_V2 velocity;
+
+	/* @member Default: 0. The starting angular velocity in radians per second. */
+	float angular_velocity;
+
+	/* @member Default: 0. Slows the body's velocity down over time. Zero for none. */
+	float linear_damping;
+
+	/* @member Default: 0. Slows the body's spin down over time. Zero for none. */
+	float angular_damping;
+
+	/* @member Default: false. True to keep the body from rotating, such as for a player character. */
+	bool fixed_rotation;
+
+	/* @member Default: `NULL`. Pointer to the shape, in the body's local space. Copied by `cf_make_body`. */
+	const void* shape;
+
+	/* @member Default: `CF_SHAPE_TYPE_NONE`. The `CF_ShapeType` of `shape`. Circles, AABBs, capsules and polygons are supported. */
+	CF_ShapeType shape_type;
+
+	/* @member Default: 0.01f. Mass per unit of area. Only dynamic bodies have mass. */
+	float density;
+
+	/* @member Default: 0.4f. How much the body resists sliding, usually from 0 to 1. Two bodies touching use the square root of the product of theirs. */
+	float friction;
+
+	/* @member Default: 0. How bouncy the body is, from 0 to 1. Two bodies touching use the larger of theirs. */
+	float restitution;
+
+	/* @member Default: `NULL`. An optional pointer handed back by `cf_body_get_udata`. */
+	void* udata;
+} CF_BodyParams;
+// @end
+
+/**
+ * @function cf_body_defaults
+ * @category physics
+ * @brief    Returns a `CF_BodyParams` filled with default settings.
+ * @related  CF_BodyParams cf_body_defaults cf_make_body
+ */
+CF_INLINE CF_BodyParams CF_CALL cf_body_defaults()
+{
+	CF_BodyParams params;
+	params.type = CF_BODY_TYPE_STATIC;
+	params.position = cf_v2(0, 0);
+	params.angle = 0;
+	params.velocity = cf_v2(0, 0);
+	params.angular_velocity = 0;
+	params.linear_damping = 0;
+	params.angular_damping = 0;
+	params.fixed_rotation = false;
+	params.shape = NULL;
+	params.shape_type = CF_SHAPE_TYPE_NONE;
+	params.density = 0.01f;
+	params.friction = 0.4f;
+	params.restitution = 0;
+	params.udata = NULL;
+	return params;
+}
+
+/**
+ * @function CF_BodyQueryFn
+ * @category physics
+ * @brief    A function pointer called once per body found by `cf_physics_world_query_aabb`.
+ * @param    body       The body.
+ * @param    udata      The `udata` handed to `cf_physics_world_query_aabb`.
+ * @return   Return true to keep searching, false to stop.
+ * @related  CF_BodyQueryFn cf_physics_world_query_aabb
+ */
+typedef bool (CF_CALL CF_BodyQueryFn)(CF_Body body, void* udata);
+
+/**
+ * @function cf_make_physics_world
+ * @category physics
+ * @brief    Returns a new, empty `CF_PhysicsWorld`.
+ * @param    params     Can be `NULL` for the defaults. See `CF_PhysicsWorldParams`.
+ * @related  CF_PhysicsWorld CF_PhysicsWorldParams cf_destroy_physics_world cf_physics_world_step cf_make_body
+ */
+CF_API CF_PhysicsWorld CF_CALL cf_make_physics_world(const CF_PhysicsWorldParams* params);
+
+/**
+ * @function cf_destroy_physics_world
+ * @category physics
+ * @brief    Destroys a `CF_PhysicsWorld` along with all of its bodies.
+ * @related  CF_PhysicsWorld cf_make_physics_world
+ */
+CF_API void CF_CALL cf_destroy_physics_world(CF_PhysicsWorld world);
+
+/**
+ * @function cf_physics_world_step
+ * @category physics
+ * @brief    Moves the world forward by `dt` seconds.
+ * @param    world      The world.
+ * @param    dt         The time to step by, in seconds.
+ * @remarks  Gravity and forces are applied, the broadphase finds shapes that might touch, contacts are collided and matched up with
+ *           last step's to warm-start the solver, then each awake island is solved and moved on the threadpool.
+ *
+ *           Call this with the same `dt` each time, such as from a fixed timestep, see `cf_set_fixed_timestep`. Given the same starting
+ *           world and the same calls, stepping gives the same results every time, no matter how many threads are in the pool.
+ * @related  CF_PhysicsWorld cf_make_physics_world cf_physics_world_set_gravity
+ */
+CF_API void CF_CALL cf_physics_world_step(CF_PhysicsWorld world, float dt);
+
+/**
+ * @function cf_physics_world_set_gravity
+ * @category physics
+ * @brief    Sets the acceleration applied to every dynamic body.
+ * @param    world      The world.
+ * @param    gravity    The new gravity.
+ * @remarks  Sleeping bodies stay asleep, wake them with `cf_body_wake` if needed.
+ * @related  CF_PhysicsWorld cf_physics_world_get_gravity
+ */
+CF_API void CF_CALL cf_physics_world_set_gravity(CF_PhysicsWorld world, CF_V2 gravity);
+
+/**
+ * @function cf_physics_world_get_gravity
+ * @category physics
+ * @brief    Returns the acceleration applied to every dynamic body.
+ * @param    world      The world.
+ * @related  CF_PhysicsWorld cf_physics_world_set_gravity
+ */
+CF_API CF_V2 CF_CALL cf_physics_world_get_gravity(CF_PhysicsWorld world);
+
+/**
+ * @function cf_physics_world_body_count
+ * @category physics
+ * @brief    Returns the number of bodies in the world.
+ * @param    world      The world.
+ * @related  CF_PhysicsWorld cf_physics_world_contact_count cf_physics_world_awake_body_count
+ */
+CF_API int CF_CALL cf_physics_world_body_count(CF_PhysicsWorld world);
+
+/**
+ * @function cf_physics_world_awake_body_count
+ * @category physics
+ * @brief    Returns the number of dynamic and kinematic bodies that are awake.
+ * @param    world      The world.
+ * @related  CF_PhysicsWorld cf_physics_world_body_count cf_body_is_awake
+ */
+CF_API int CF_CALL cf_physics_world_awake_body_count(CF_PhysicsWorld world);
+
+/**
+ * @function cf_physics_world_contact_count
+ * @category physics
+ * @brief    Returns the number of pairs of shapes that touched during the last step.
+ * @param    world      The world.
+ * @related  CF_PhysicsWorld cf_physics_world_body_count
+ */
+CF_API int CF_CALL cf_physics_world_contact_count(CF_PhysicsWorld world);
+
+/**
+ * @function cf_physics_world_query_aabb
+ * @category physics
+ * @brief    Calls `fn` for each body whose shape's bounding box overlaps `aabb`.
+ * @param    world      The world.
+ * @param    aabb       The box to search.
+ * @param    fn         Called once per body found, see `CF_BodyQueryFn`.
+ * @param    udata      Can be `NULL`. Handed to `fn`.
+ * @remarks  Only bounding boxes are tested, call `cf_collided` on the results for an exact test.
+ * @related  CF_PhysicsWorld CF_BodyQueryFn
+ */
+CF_API void CF_CALL cf_physics_world_query_aabb(CF_PhysicsWorld world, CF_Aabb aabb, CF_BodyQueryFn* fn, void* udata);
+
+/**
+ * @function cf_make_body
+ * @category physics
+ * @brief    Adds a new body to the world.
+ * @param    world      The world.
+ * @param    params     The body's settings, see `CF_BodyParams`.
+ * @return   Returns the new body.
+ * @remarks  Static bodies are meant to stay put. Adding or moving many of them is slower than for other bodies, since every body
+ *           near them is woken up.
+ * @related  CF_Body CF_BodyParams cf_body_defaults cf_destroy_body
+ */
+CF_API CF_Body CF_CALL cf_make_body(CF_PhysicsWorld world, const CF_BodyParams* params);
+
+/**
+ * @function cf_destroy_body
+ * @category physics
+ * @brief    Removes a body from its world, waking up any bodies near it.
+ * @param    body       The body.
+ * @related  CF_Body cf_make_body
+ */
+CF_API void CF_CALL cf_destroy_body(CF_Body body);
+
+/**
+ * @function cf_body_get_type
+ * @category physics
+ * @brief    Returns how the body moves, see `CF_BodyType`.
+ * @param    body       The body.
+ * @related  CF_Body CF_BodyType
+ */
+CF_API CF_BodyType CF_CALL cf_body_get_type(CF_Body body);
+
+/**
+ * @function cf_body_get_transform
+ * @category physics
+ * @brief    Returns the position and rotation of the body's origin.
+ * @param    body       The body.
+ * @remarks  This is the transform to draw the body's shape with.
+ * @related  CF_Body cf_body_set_transform cf_body_get_position cf_body_get_angle
+ */
+CF_API CF_Transform CF_CALL cf_body_get_transform(CF_Body body);
+
+/**
+ * @function cf_body_set_transform
+ * @category physics
+ * @brief    Teleports the body's origin to a new position and rotation, and wakes it up.
+ * @param    body       The body.
+ * @param    position   The new position.
+ * @param    angle      The new rotation in radians.
+ * @related  CF_Body cf_body_get_transform
+ */
+CF_API void CF_CALL cf_body_set_transform(CF_Body body, CF_V2 position, float angle);
+
+/**
+ * @function cf_body_get_position
+ * @category physics
+ * @brief    Returns the position of the body's origin.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_get_transform cf_body_get_angle
+ */
+CF_API CF_V2 CF_CALL cf_body_get_position(CF_Body body);
+
+/**
+ * @function cf_body_get_angle
+ * @category physics
+ * @brief    Returns the body's rotation in radians.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_get_transform cf_body_get_position
+ */
+CF_API float CF_CALL cf_body_get_angle(CF_Body body);
+
+/**
+ * @function cf_body_get_velocity
+ * @category physics
+ * @brief    Returns the velocity of the body's center of mass.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_set_velocity cf_body_get_angular_velocity
+ */
+CF_API CF_V2 CF_CALL cf_body_get_velocity(CF_Body body);
+
+/**
+ * @function cf_body_set_velocity
+ * @category physics
+ * @brief    Sets the velocity of the body's center of mass, and wakes it up.
+ * @param    body       The body.
+ * @param    velocity   The new velocity.
+ * @remarks  Does nothing for static bodies.
+ * @related  CF_Body cf_body_get_velocity cf_body_set_angular_velocity
+ */
+CF_API void CF_CALL cf_body_set_velocity(CF_Body body, CF_V2 velocity);
+
+/**
+ * @function cf_body_get_angular_velocity
+ * @category physics
+ * @brief    Returns the body's angular velocity in radians per second.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_set_angular_velocity cf_body_get_velocity
+ */
+CF_API float CF_CALL cf_body_get_angular_velocity(CF_Body body);
+
+/**
+ * @function cf_body_set_angular_velocity
+ * @category physics
+ * @brief    Sets the body's angular velocity in radians per second, and wakes it up.
+ * @param    body              The body.
+ * @param    angular_velocity  The new angular velocity.
+ * @remarks  Does nothing for static bodies, or bodies made with `fixed_rotation`.
+ * @related  CF_Body cf_body_get_angular_velocity cf_body_set_velocity
+ */
+CF_API void CF_CALL cf_body_set_angular_velocity(CF_Body body, float angular_velocity);
+
+/**
+ * @function cf_body_apply_force
+ * @category physics
+ * @brief    Pushes on the body's center of mass during the next step, and wakes it up.
+ * @param    body       The body.
+ * @param    force      The force to apply.
+ * @remarks  Forces add up until the next `cf_physics_world_step`, then are cleared. Only dynamic bodies are affected.
+ * @related  CF_Body cf_body_apply_impulse
+ */
+CF_API void CF_CALL cf_body_apply_force(CF_Body body, CF_V2 force);
+
+/**
+ * @function cf_body_apply_impulse
+ * @category physics
+ * @brief    Instantly changes the body's velocity as if it were struck at `point`, and wakes it up.
+ * @param    body       The body.
+ * @param    impulse    The impulse to apply.
+ * @param    point      Where to apply the impulse, in world space. Off-center points also spin the body.
+ * @remarks  Only dynamic bodies are affected.
+ * @related  CF_Body cf_body_apply_force
+ */
+CF_API void CF_CALL cf_body_apply_impulse(CF_Body body, CF_V2 impulse, CF_V2 point);
+
+/**
+ * @function cf_body_get_mass
+ * @category physics
+ * @brief    Returns the body's mass, or zero for static and kinematic bodies.
+ * @param    body       The body.
+ * @related  CF_Body CF_BodyParams
+ */
+CF_API float CF_CALL cf_body_get_mass(CF_Body body);
+
+/**
+ * @function cf_body_is_awake
+ * @category physics
+ * @brief    Returns true if the body is awake. Static bodies are never awake.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_wake cf_physics_world_awake_body_count
+ */
+CF_API bool CF_CALL cf_body_is_awake(CF_Body body);
+
+/**
+ * @function cf_body_wake
+ * @category physics
+ * @brief    Wakes the body up, along with everything it's touching on the next step.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_is_awake
+ */
+CF_API void CF_CALL cf_body_wake(CF_Body body);
+
+/**
+ * @function cf_body_get_udata
+ * @category physics
+ * @brief    Returns the `udata` pointer from `CF_BodyParams`.
+ * @param    body       The body.
+ * @related  CF_Body cf_body_set_udata
+ */
+CF_API void* CF_CALL cf_body_get_udata(CF_Body body);
+
+/**
+ * @function cf_body_set_udata
+ * @category physics
+ * @brief    Sets the pointer returned by `cf_body_get_udata`.
+ * @param    body       The body.
+ * @param    udata      The new pointer.
+ * @related  CF_Body cf_body_get_udata
+ */
+CF_API void CF_CALL cf_body_set_udata(CF_Body body, void* udata);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using PhysicsWorld = CF_PhysicsWorld;
+using Body = CF_Body;
+using BodyType = CF_BodyType;
+using BodyQueryFn = CF_BodyQueryFn;
+
+#define CF_ENUM(K, V) CF_INLINE constexpr BodyType K = CF_##K;
+CF_BODY_TYPE_DEFS
+#undef CF_ENUM
+
+CF_INLINE const char* to_string(BodyType type)
+{
+	switch (type) {
+	#define CF_ENUM(K, V) case CF_##K: return #K;
+	CF_BODY_TYPE_DEFS
+	#undef CF_ENUM
+	default: return NULL;
+	}
+}
+
+struct PhysicsWorldParams : public CF_PhysicsWorldParams
+{
+	PhysicsWorldParams() { *(CF_PhysicsWorldParams*)this = cf_physics_world_defaults(); }
+	PhysicsWorldParams(CF_PhysicsWorldParams p) { *(CF_PhysicsWorldParams*)this = p; }
+};
+
+struct BodyParams : public CF_BodyParams
+{
+	BodyParams() { *(CF_BodyParams*)this = cf_body_defaults(); }
+	BodyParams(CF_BodyParams p) { *(CF_BodyParams*)this = p; }
+};
+
+CF_INLINE PhysicsWorld make_physics_world(const PhysicsWorldParams* params = NULL) { return cf_make_physics_world(params); }
+CF_INLINE void destroy_physics_world(PhysicsWorld world) { cf_destroy_physics_world(world); }
+CF_INLINE void physics_world_step(PhysicsWorld world, float dt) { cf_physics_world_step(world, dt); }
+CF_INLINE void physics_world_set_gravity(PhysicsWorld world, v2 gravity) { cf_physics_world_set_gravity(world, gravity); }
+CF_INLINE v2 physics_world_get_gravity(PhysicsWorld world) { return cf_physics_world_get_gravity(world); }
+CF_INLINE int physics_world_body_count(PhysicsWorld world) { return cf_physics_world_body_count(world); }
+CF_INLINE int physics_world_awake_body_count(PhysicsWorld world) { return cf_physics_world_awake_body_count(world); }
+CF_INLINE int physics_world_contact_count(PhysicsWorld world) { return cf_physics_world_contact_count(world); }
+CF_INLINE void physics_world_query_aabb(PhysicsWorld world, Aabb aabb, BodyQueryFn* fn, void* udata = NULL) { cf_physics_world_query_aabb(world, aabb, fn, udata); }
+
+CF_INLINE Body make_body(PhysicsWorld world, const BodyParams* params) { return cf_make_body(world, params); }
+CF_INLINE void destroy_body(Body body) { cf_destroy_body(body); }
+CF_INLINE BodyType body_get_type(Body body) { return cf_body_get_type(body); }
+CF_INLINE Transform body_get_transform(Body body) { return cf_body_get_transform(body); }
+CF_INLINE void body_set_transform(Body body, v2 position, float angle) { cf_body_set_transform(body, position, angle); }
+CF_INLINE v2 body_get_position(Body body) { return cf_body_get_position(body); }
+CF_INLINE float body_get_angle(Body body) { return cf_body_get_angle(body); }
+CF_INLINE v2 body_get_velocity(Body body) { return cf_body_get_velocity(body); }
+CF_INLINE void body_set_velocity(Body body, v2 velocity) { cf_body_set_velocity(body, velocity); }
+CF_INLINE float body_get_angular_velocity(Body body) { return cf_body_get_angular_velocity(body); }
+CF_INLINE void body_set_angular_velocity(Body body, float angular_velocity) { cf_body_set_angular_velocity(body, angular_velocity); }
+CF_INLINE void body_apply_force(Body body, v2 force) { cf_body_apply_force(body, force); }
+CF_INLINE void body_apply_impulse(Body body, v2 impulse, v2 point) { cf_body_apply_impulse(body, impulse, point); }
+CF_INLINE float body_get_mass(Body body) { return cf_body_get_mass(body); }
+CF_INLINE bool body_is_awake(Body body) { return cf_body_is_awake(body); }
+CF_INLINE void body_wake(Body body) { cf_body_wake(body); }
+CF_INLINE void* body_get_udata(Body body) { return cf_body_get_udata(body); }
+CF_INLINE void body_set_udata(Body body, void* udata) { cf_body_set_udata(body, udata); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_PHYSICS_H
@@ -85,6 +85,20 @@ CF_INLINE CF_Png cf_png_defaults()
  */
 CF_API CF_Result CF_CALL cf_png_cache_load(const char* png_path, CF_Png* png /*= NULL*/);
 
+/**
+ * @function cf_png_cache_load_batch
+ * @category png_cache
+ * @brief    Loads many images `CF_Png` into the cache at once.
+ * @param    png_paths     An array of virtual paths to .png files.
+ * @param    count         The number of paths in `png_paths`.
+ * @param    pngs          Can be `NULL`. An array of `count` images, filled out in the same order as `png_paths`.
+ * @return   Returns the first error encountered, if any.
+ * @remarks  The same as calling `cf_png_cache_load` on each path, but the files are read, decoded and premultiplied across the
+ *           app's threadpool. Pngs that fail to load are set to `cf_png_defaults` in `pngs`, while the rest are still loaded.
+ * @related  CF_Png cf_png_defaults cf_png_cache_load cf_make_png_cache_animation cf_make_png_cache_sprite
+ */
+CF_API CF_Result CF_CALL cf_png_cache_load_batch(const char** png_paths, int count, CF_Png* pngs /*= NULL*/);
+
 /**
  * @function cf_png_cache_load_from_memory
  * @category png_cache
@@ -194,6 +208,7 @@ struct Png : public CF_Png
 };
 
 CF_INLINE Result png_cache_load(const char* png_path, Png* png = NULL) { return cf_png_cache_load(png_path, (CF_Png*)png); }
+CF_INLINE Result png_cache_load_batch(const char** png_paths, int count, Png* pngs = NULL) { return cf_png_cache_load_batch(png_paths, count, (CF_Png*)pngs); }
 CF_INLINE Result png_cache_load_mem(const char* png_path, const void* memory, size_t size, CF_Png* png = NULL) { return cf_png_cache_load_from_memory(png_path, memory, size, png); }
 CF_INLINE void png_cache_unload(Png png) { cf_png_cache_unload(png); }
 CF_API const Animation* CF_CALL make_png_cache_animation(const char* name, const Array<CF_Png>& pngs, const Array<float>& delays);
@@ -17,11 +17,16 @@
 namespace Cute
 {
 
+// Both queues are 4-ary heaps: shallower than a binary heap, and a node's children share a cache line
+// of costs, so sifting down touches far less memory. Costs live apart from values for the same reason.
+#define CF_HEAP_ARITY 4
+
 /**
  * Implements a heap data structure in order to implement other more advanced algorithms within Cute Framework,
  * such as A* or branch-and-bound for the AABB tree.
  *
- * Currently not thoroughly tested.
+ * A queue is either a min-queue or a max-queue -- don't mix `push_min` with `push_max` on the same queue. If `T`
+ * can be mapped to a small integer ID, prefer `IndexedPriorityQueue`, which also supports decreasing a cost.
  */
 
 template <typename T>
@@ -30,82 +35,76 @@ struct PriorityQueue
 	void push_min(const T& val, float cost);
 	bool pop_min(T* val = NULL, float* cost = NULL);
 
-	void push_max(const T& val, float cost);
-	bool pop_max(T* val = NULL, float* cost = NULL);
+	// Max-queues are stored as min-queues of negated costs.
+	void push_max(const T& val, float cost) { push_min(val, -cost); }
+	bool pop_max(T* val = NULL, float* cost = NULL) { bool result = pop_min(val, cost); if (result && cost) *cost = -*cost; return result; }
 
 	int count();
 	int count() const;
 	void clear();
+	void reserve(int capacity) { m_values.ensure_capacity(capacity); m_costs.ensure_capacity(capacity); }
 
 private:
 	Array<T> m_values;
 	Array<float> m_costs;
 
-	int predicate_min(int iA, int iB);
-	int predicate_max(int iA, int iB);
 	void swap(int iA, int iB);
 };
 
-// -------------------------------------------------------------------------------------------------
-
-template <typename T>
-void PriorityQueue<T>::push_min(const T& val, float cost)
+/**
+ * A min-heap of integer IDs in the range [0, capacity), each with a cost, supporting decrease-key.
+ *
+ * Each ID is in the queue at most once. Pushing an ID which is already queued lowers its cost instead of adding
+ * a duplicate, which keeps the queue small for searches such as A* or Dijkstra's, where the same node is
+ * reached many times.
+ */
+struct IndexedPriorityQueue
 {
-	m_values.add(val);
-	m_costs.add(cost);
+	// Makes room for IDs in [0, capacity). Must be called before pushing any ID at or past the current capacity.
+	void reserve(int capacity);
 
-	int i = m_values.count();
-	while (i > 1 && predicate_min(i - 1, i / 2 - 1) > 0) {
-		swap(i - 1, i / 2 - 1);
-		i /= 2;
-	}
-}
+	// Pushes `id`, or lowers its cost if it's already queued. Does nothing if it's queued with a lower cost.
+	void push_or_decrease(int id, float cost);
+	bool pop_min(int* id = NULL, float* cost = NULL);
 
-template <typename T>
-bool PriorityQueue<T>::pop_min(T* val, float* cost)
-{
-	int count = m_values.count();
-	if (!count) return false;
-	if (val) *val = m_values[0];
-	if (cost) *cost = m_costs[0];
+	bool contains(int id) const { return id >= 0 && id < m_positions.count() && m_positions[id] >= 0; }
+	// The cost of a queued ID.
+	float cost(int id) const { CF_ASSERT(contains(id)); return m_costs[m_positions[id]]; }
 
-	count--;
-	m_values.unordered_remove(0);
-	m_costs.unordered_remove(0);
+	int count() const { return m_ids.count(); }
+	int capacity() const { return m_positions.count(); }
+	void clear();
 
-	int u = 0, v = 1;
-	while (u != v) {
-		u = v;
-		if (2 * u + 1 <= count) {
-			if (predicate_min(u - 1, 2 * u - 1) <= 0) v = 2 * u;
-			if (predicate_min(v - 1, 2 * u + 1 - 1) <= 0) v = 2 * u + 1;
-		} else if (2 * u <= count) {
-			if (predicate_min(u - 1, 2 * u - 1) <= 0) v = 2 * u;
-		}
+private:
+	Array<int> m_ids;
+	Array<float> m_costs;
+	// Heap position of each ID, or -1 if it isn't queued.
+	Array<int> m_positions;
 
-		if (u != v) {
-			swap(u - 1, v - 1);
-		}
-	}
+	void sift_up(int i);
+	void sift_down(int i);
+	void place(int i, int id, float cost) { m_ids[i] = id; m_costs[i] = cost; m_positions[id] = i; }
+};
 
-	return true;
-}
+// -------------------------------------------------------------------------------------------------
 
 template <typename T>
-void PriorityQueue<T>::push_max(const T& val, float cost)
+void PriorityQueue<T>::push_min(const T& val, float cost)
 {
 	m_values.add(val);
 	m_costs.add(cost);
 
-	int i = m_values.count();
-	while (i > 1 && predicate_max(i - 1, i / 2 - 1) > 0) {
-		swap(i - 1, i / 2 - 1);
-		i /= 2;
+	int i = m_values.count() - 1;
+	while (i > 0) {
+		int parent = (i - 1) / CF_HEAP_ARITY;
+		if (!(m_costs[i] < m_costs[parent])) break;
+		swap(i, parent);
+		i = parent;
 	}
 }
 
 template <typename T>
-bool PriorityQueue<T>::pop_max(T* val, float* cost)
+bool PriorityQueue<T>::pop_min(T* val, float* cost)
 {
 	int count = m_values.count();
 	if (!count) return false;
@@ -116,19 +115,19 @@ bool PriorityQueue<T>::pop_max(T* val, float* cost)
 	m_values.unordered_remove(0);
 	m_costs.unordered_remove(0);
 
-	int u = 0, v = 1;
-	while (u != v) {
-		u = v;
-		if (2 * u + 1 <= count) {
-			if (predicate_max(u - 1, 2 * u - 1) <= 0) v = 2 * u;
-			if (predicate_max(v - 1, 2 * u + 1 - 1) <= 0) v = 2 * u + 1;
-		} else if (2 * u <= count) {
-			if (predicate_max(u - 1, 2 * u - 1) <= 0) v = 2 * u;
-		}
-
-		if (u != v) {
-			swap(u - 1, v - 1);
+	const float* costs = m_costs.data();
+	int i = 0;
+	while (true) {
+		int first = i * CF_HEAP_ARITY + 1;
+		if (first >= count) break;
+		int last = first + CF_HEAP_ARITY < count ? first + CF_HEAP_ARITY : count;
+		int best = first;
+		for (int c = first + 1; c < last; ++c) {
+			if (costs[c] < costs[best]) best = c;
 		}
+		if (!(costs[best] < costs[i])) break;
+		swap(i, best);
+		i = best;
 	}
 
 	return true;
@@ -154,31 +153,106 @@ void PriorityQueue<T>::clear()
 }
 
 template <typename T>
-int PriorityQueue<T>::predicate_min(int iA, int iB)
+void PriorityQueue<T>::swap(int iA, int iB)
 {
-	float costA = m_costs[iA];
-	float costB = m_costs[iB];
-	return costA < costB ? -1 : costA > costB ? 1 : 0;
+	T tval = cf_move(m_values[iA]);
+	m_values[iA] = cf_move(m_values[iB]);
+	m_values[iB] = cf_move(tval);
+
+	float fval = m_costs[iA];
+	m_costs[iA] = m_costs[iB];
+	m_costs[iB] = fval;
 }
 
-template <typename T>
-int PriorityQueue<T>::predicate_max(int iA, int iB)
+// -------------------------------------------------------------------------------------------------
+
+CF_INLINE void IndexedPriorityQueue::reserve(int capacity)
 {
-	float costA = m_costs[iA];
-	float costB = m_costs[iB];
-	return costA > costB ? -1 : costA < costB ? 1 : 0;
+	int old_capacity = m_positions.count();
+	if (capacity <= old_capacity) return;
+	m_positions.ensure_count(capacity);
+	for (int i = old_capacity; i < capacity; ++i) {
+		m_positions[i] = -1;
+	}
+	m_ids.ensure_capacity(capacity);
+	m_costs.ensure_capacity(capacity);
 }
 
-template <typename T>
-void PriorityQueue<T>::swap(int iA, int iB)
+CF_INLINE void IndexedPriorityQueue::push_or_decrease(int id, float cost)
 {
-	T tval = m_values[iA];
-	m_values[iA] = m_values[iB];
-	m_values[iB] = tval;
+	CF_ASSERT(id >= 0 && id < m_positions.count());
+	int i = m_positions[id];
+	if (i < 0) {
+		i = m_ids.count();
+		m_ids.add(id);
+		m_costs.add(cost);
+		m_positions[id] = i;
+	} else if (cost < m_costs[i]) {
+		m_costs[i] = cost;
+	} else {
+		return;
+	}
+	sift_up(i);
+}
 
-	float fval = m_costs[iA];
-	m_costs[iA] = m_costs[iB];
-	m_costs[iB] = fval;
+CF_INLINE bool IndexedPriorityQueue::pop_min(int* id, float* cost)
+{
+	int count = m_ids.count();
+	if (!count) return false;
+	if (id) *id = m_ids[0];
+	if (cost) *cost = m_costs[0];
+	m_positions[m_ids[0]] = -1;
+	int last_id = m_ids.pop();
+	float last_cost = m_costs.pop();
+	if (count > 1) {
+		place(0, last_id, last_cost);
+		sift_down(0);
+	}
+	return true;
+}
+
+CF_INLINE void IndexedPriorityQueue::clear()
+{
+	for (int i = 0; i < m_ids.count(); ++i) {
+		m_positions[m_ids[i]] = -1;
+	}
+	m_ids.clear();
+	m_costs.clear();
+}
+
+// Both sifts carry the moving entry along in registers and write it once at its final position.
+CF_INLINE void IndexedPriorityQueue::sift_up(int i)
+{
+	int id = m_ids[i];
+	float cost = m_costs[i];
+	while (i > 0) {
+		int parent = (i - 1) / CF_HEAP_ARITY;
+		if (!(cost < m_costs[parent])) break;
+		place(i, m_ids[parent], m_costs[parent]);
+		i = parent;
+	}
+	place(i, id, cost);
+}
+
+CF_INLINE void IndexedPriorityQueue::sift_down(int i)
+{
+	int count = m_ids.count();
+	int id = m_ids[i];
+	float cost = m_costs[i];
+	const float* costs = m_costs.data();
+	while (true) {
+		int first = i * CF_HEAP_ARITY + 1;
+		if (first >= count) break;
+		int last = first + CF_HEAP_ARITY < count ? first + CF_HEAP_ARITY : count;
+		int best = first;
+		for (int c = first + 1; c < last; ++c) {
+			if (costs[c] < costs[best]) best = c;
+		}
+		if (!(costs[best] < cost)) break;
+		place(i, m_ids[best], costs[best]);
+		i = best;
+	}
+	place(i, id, cost);
 }
 
 }
@@ -0,0 +1,121 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_PROFILE_H
+#define CF_PROFILE_H
+
+#include "cute_defines.h"
+#include "cute_result.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @function cf_profile_enable
+ * @category profile
+ * @brief    Starts or stops recording profile zones.
+ * @param    enabled    True to start recording, false to stop.
+ * @remarks  Recording is off by default, and zones cost next to nothing while it's off. Starting a recording throws away anything
+ *           recorded before. Once done, call `cf_profile_save_chrome_trace` to look over the results.
+ * @related  cf_profile_enable cf_profile_is_enabled cf_profile_begin cf_profile_end CF_PROFILE_SCOPE cf_profile_save_chrome_trace
+ */
+CF_API void CF_CALL cf_profile_enable(bool enabled);
+
+/**
+ * @function cf_profile_is_enabled
+ * @category profile
+ * @brief    Returns true if profile zones are being recorded.
+ * @related  cf_profile_enable cf_profile_is_enabled cf_profile_begin cf_profile_end CF_PROFILE_SCOPE cf_profile_save_chrome_trace
+ */
+CF_API bool CF_CALL cf_profile_is_enabled();
+
+/**
+ * @function cf_profile_begin
+ * @category profile
+ * @brief    Begins a profile zone on the calling thread.
+ * @param    name       The name of the zone. Must stay valid until the recording is saved, such as a string literal or a string from `sintern`.
+ * @remarks  Each call must be matched by a call to `cf_profile_end` on the same thread. Zones may nest. Each thread records into
+ *           its own lock-free buffer, so zones are safe and cheap to use from any thread, including threadpool tasks. In C++ prefer
+ *           `CF_PROFILE_SCOPE`.
+ * @related  cf_profile_enable cf_profile_is_enabled cf_profile_begin cf_profile_end CF_PROFILE_SCOPE cf_profile_save_chrome_trace
+ */
+CF_API void CF_CALL cf_profile_begin(const char* name);
+
+/**
+ * @function cf_profile_end
+ * @category profile
+ * @brief    Ends the last profile zone begun on the calling thread by `cf_profile_begin`.
+ * @related  cf_profile_enable cf_profile_is_enabled cf_profile_begin cf_profile_end CF_PROFILE_SCOPE cf_profile_save_chrome_trace
+ */
+CF_API void CF_CALL cf_profile_end();
+
+/**
+ * @function cf_profile_save_chrome_trace
+ * @category profile
+ * @brief    Saves all recorded profile zones as a Chrome trace JSON file.
+ * @param    virtual_path  A virtual path (see: `cf_fs_set_write_directory`) to write the file to.
+ * @remarks  Open the file in `chrome://tracing`, [Perfetto](https://ui.perfetto.dev), or import it into Tracy with its
+ *           `import-chrome` tool. Each thread that recorded zones shows up as its own track. Safe to call while recording.
+ * @related  cf_profile_enable cf_profile_is_enabled cf_profile_begin cf_profile_end CF_PROFILE_SCOPE cf_profile_save_chrome_trace
+ */
+CF_API CF_Result CF_CALL cf_profile_save_chrome_trace(const char* virtual_path);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+#ifdef CF_CPP
+
+struct CF_ProfileScope
+{
+	CF_ProfileScope(const char* name) { cf_profile_begin(name); }
+	~CF_ProfileScope() { cf_profile_end(); }
+};
+
+#define CF_PROFILE_TOKEN_PASTE_HELPER(X, Y) X ## Y
+#define CF_PROFILE_TOKEN_PASTE(X, Y) CF_PROFILE_TOKEN_PASTE_HELPER(X, Y)
+
+/**
+ * @function CF_PROFILE_SCOPE
+ * @category profile
+ * @brief    Records a profile zone from here until the end of the enclosing scope.
+ * @param    name       The name of the zone, see `cf_profile_begin`.
+ * @example  > Profiling a function.
+ *     void update_physics()
+ *     {
+ *         CF_PROFILE_SCOPE("update_physics");
+ *         // ...
+ *     }
+ * @related  cf_profile_enable cf_profile_is_enabled cf_profile_begin cf_profile_end CF_PROFILE_SCOPE cf_profile_save_chrome_trace
+ */
+#define CF_PROFILE_SCOPE(name) CF_ProfileScope CF_PROFILE_TOKEN_PASTE(cf_profile_scope_, __LINE__)(name)
+
+#endif // CF_CPP
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+CF_INLINE void profile_enable(bool enabled) { cf_profile_enable(enabled); }
+CF_INLINE bool profile_is_enabled() { return cf_profile_is_enabled(); }
+CF_INLINE void profile_begin(const char* name) { cf_profile_begin(name); }
+CF_INLINE void profile_end() { cf_profile_end(); }
+CF_INLINE Result profile_save_chrome_trace(const char* virtual_path) { return cf_profile_save_chrome_trace(virtual_path); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_PROFILE_H
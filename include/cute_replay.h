@@ -0,0 +1,188 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_REPLAY_H
+#define CF_REPLAY_H
+
+#include "cute_defines.h"
+#include "cute_result.h"
+#include "cute_time.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_Replay
+ * @category replay
+ * @brief    An opaque handle for a recording of input and time, taken once per update.
+ * @remarks  Input and time are the only things feeding your simulation that aren't under your control. A replay captures both for each
+ *           call to your update function, so the exact same run can be played back later, such as to reproduce a bug from a player's
+ *           machine, or to time your simulation offline.
+ *
+ *           Each update stores the keyboard, mouse, window, joypad, touch and text input state along with `CF_TICKS`, `CF_SECONDS`,
+ *           `CF_DELTA_TIME` and `CF_DELTA_TIME_FIXED`. Updates are encoded as the bytes that changed since the update before, which
+ *           usually comes out at a handful of bytes each. Once the replay grows past its size limit the oldest updates are dropped, so
+ *           recording can be left on all the time.
+ *
+ *           Playback only reproduces your game if everything else is deterministic, so seed your `CF_RndState` the same way, and
+ *           don't read the clock with `cf_get_ticks`.
+ *
+ *           ```cpp
+ *           CF_Replay replay = cf_make_replay(0);
+ *           cf_replay_start_recording(replay);
+ *           while (cf_app_is_running()) {
+ *               cf_app_update(update);
+ *               // ...
+ *           }
+ *           cf_replay_save(replay, "/bug.replay");
+ *
+ *           // Later, headless and as fast as possible.
+ *           CF_Replay replay = cf_replay_load("/bug.replay", NULL);
+ *           while (cf_replay_step(replay, update)) {}
+ *           ```
+ * @related  CF_Replay cf_make_replay cf_replay_start_recording cf_replay_step cf_replay_save cf_replay_load
+ */
+typedef struct CF_Replay { uint64_t id; } CF_Replay;
+// @end
+
+/**
+ * @function cf_make_replay
+ * @category replay
+ * @brief    Returns a new, empty `CF_Replay`.
+ * @param    max_bytes  The most memory the recorded updates may take, or zero for the default of 16MB. Older updates are dropped
+ *                      to make room.
+ * @related  CF_Replay cf_destroy_replay cf_replay_start_recording
+ */
+CF_API CF_Replay CF_CALL cf_make_replay(int max_bytes);
+
+/**
+ * @function cf_destroy_replay
+ * @category replay
+ * @brief    Destroys a `CF_Replay`, stopping it first if it's being recorded.
+ * @related  CF_Replay cf_make_replay
+ */
+CF_API void CF_CALL cf_destroy_replay(CF_Replay replay);
+
+/**
+ * @function cf_replay_start_recording
+ * @category replay
+ * @brief    Clears the replay, then records each following update into it.
+ * @param    replay     The replay.
+ * @remarks  Updates are recorded inside `cf_app_update`, right after input is gathered and before your update function is called.
+ *           Only one replay records at a time, starting another one stops this one.
+ * @related  CF_Replay cf_replay_stop_recording cf_replay_step_count cf_replay_save
+ */
+CF_API void CF_CALL cf_replay_start_recording(CF_Replay replay);
+
+/**
+ * @function cf_replay_stop_recording
+ * @category replay
+ * @brief    Stops recording, if a replay is being recorded.
+ * @related  CF_Replay cf_replay_start_recording
+ */
+CF_API void CF_CALL cf_replay_stop_recording();
+
+/**
+ * @function cf_replay_step_count
+ * @category replay
+ * @brief    Returns the number of updates held by the replay.
+ * @param    replay     The replay.
+ * @related  CF_Replay cf_replay_size cf_replay_step
+ */
+CF_API int CF_CALL cf_replay_step_count(CF_Replay replay);
+
+/**
+ * @function cf_replay_size
+ * @category replay
+ * @brief    Returns the number of bytes the recorded updates take up.
+ * @param    replay     The replay.
+ * @related  CF_Replay cf_make_replay cf_replay_step_count
+ */
+CF_API int CF_CALL cf_replay_size(CF_Replay replay);
+
+/**
+ * @function cf_replay_rewind
+ * @category replay
+ * @brief    Moves playback back to the oldest update held by the replay.
+ * @param    replay     The replay.
+ * @related  CF_Replay cf_replay_step
+ */
+CF_API void CF_CALL cf_replay_rewind(CF_Replay replay);
+
+/**
+ * @function cf_replay_step
+ * @category replay
+ * @brief    Plays back the next recorded update.
+ * @param    replay     The replay.
+ * @param    on_update  Your update function, called once with the recorded input and time in place.
+ * @return   Returns false once there are no more updates to play, without calling `on_update`.
+ * @remarks  This stands in for `cf_app_update`. Instead of gathering input and waiting on the clock it copies the recorded state into
+ *           the input and time globals, then calls `on_update` with the pointer from `cf_set_update_udata`. Nothing is drawn and
+ *           nothing sleeps, so calling this in a loop runs your simulation as fast as it can go, even from an app made with
+ *           `APP_OPTIONS_NO_GFX`.
+ *
+ *           Joypads are matched up by the order they were opened in. Recorded joypads without an open match are skipped.
+ * @related  CF_Replay cf_replay_rewind cf_replay_load
+ */
+CF_API bool CF_CALL cf_replay_step(CF_Replay replay, CF_OnUpdateFn* on_update);
+
+/**
+ * @function cf_replay_save
+ * @category replay
+ * @brief    Writes the replay to a file.
+ * @param    replay        The replay.
+ * @param    virtual_path  The path to write to, see `cf_fs_write_entire_buffer_to_file`.
+ * @remarks  Replays are meant to be played back on the same platform they were recorded on.
+ * @related  CF_Replay cf_replay_load
+ */
+CF_API CF_Result CF_CALL cf_replay_save(CF_Replay replay, const char* virtual_path);
+
+/**
+ * @function cf_replay_load
+ * @category replay
+ * @brief    Returns a replay read from a file written by `cf_replay_save`, ready to play back.
+ * @param    virtual_path  The path to read from.
+ * @param    result_out    Optional, set to an error if the file couldn't be read.
+ * @return   Returns a replay with an `id` of zero on failure.
+ * @related  CF_Replay cf_replay_save cf_replay_step
+ */
+CF_API CF_Replay CF_CALL cf_replay_load(const char* virtual_path, CF_Result* result_out);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using Replay = CF_Replay;
+
+CF_INLINE Replay make_replay(int max_bytes = 0) { return cf_make_replay(max_bytes); }
+CF_INLINE void destroy_replay(Replay replay) { cf_destroy_replay(replay); }
+CF_INLINE void replay_start_recording(Replay replay) { cf_replay_start_recording(replay); }
+CF_INLINE void replay_stop_recording() { cf_replay_stop_recording(); }
+CF_INLINE int replay_step_count(Replay replay) { return cf_replay_step_count(replay); }
+CF_INLINE int replay_size(Replay replay) { return cf_replay_size(replay); }
+CF_INLINE void replay_rewind(Replay replay) { cf_replay_rewind(replay); }
+CF_INLINE bool replay_step(Replay replay, OnUpdateFn* on_update) { return cf_replay_step(replay, on_update); }
+CF_INLINE Result replay_save(Replay replay, const char* virtual_path) { return cf_replay_save(replay, virtual_path); }
+CF_INLINE Replay replay_load(const char* virtual_path, Result* result_out = NULL) { return cf_replay_load(virtual_path, result_out); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_REPLAY_H
@@ -0,0 +1,330 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_REPLICATION_H
+#define CF_REPLICATION_H
+
+#include "cute_defines.h"
+#include "cute_networking.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_ReplicationServer
+ * @category net
+ * @brief    An opaque handle for syncing entity state from a server to its clients.
+ * @remarks  Each entity is a fixed number of integer fields, set with `cf_replication_server_set_entity`. For each client the server
+ *           remembers the last state that client acknowledged, and sends only entities that differ from it. Each field is
+ *           delta-encoded against that acknowledged state with `cf_bit_write_delta`, so an unchanged field costs a single bit.
+ *           Entities compete for room in each packet by priority, see `cf_replication_server_set_priority`.
+ *
+ *           Pack floats into fields by quantizing them, e.g. `(int)(x * 100)` for centimeter precision.
+ *
+ *           In big worlds, set `scoped` so each client only gets the entities near it, with its scope kept up to date by a `CF_Interest`.
+ *
+ *           ```cpp
+ *           // Server, once per tick.
+ *           for (int i = 0; i < entity_count; ++i) {
+ *               int32_t fields[3] = { (int)(e[i].x * 100), (int)(e[i].y * 100), e[i].health };
+ *               cf_replication_server_set_entity(rs, e[i].index, fields);
+ *           }
+ *           for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+ *               if (cf_server_is_client_connected(server, i)) cf_replication_server_send(rs, server, i);
+ *           }
+ *
+ *           // Server, when a client's input packet carries an ack.
+ *           cf_replication_server_ack(rs, client_index, ack_sequence);
+ *
+ *           // Client, for each snapshot packet received.
+ *           uint16_t ack;
+ *           if (cf_replication_client_read(rc, packet, size, &ack)) {
+ *               // Send `ack` back to the server, e.g. with the next input packet.
+ *           }
+ *           ```
+ * @related  CF_ReplicationServer cf_make_replication_server cf_replication_server_set_entity cf_replication_server_send cf_replication_server_ack CF_ReplicationClient
+ */
+typedef struct CF_ReplicationServer { uint64_t id; } CF_ReplicationServer;
+// @end
+
+/**
+ * @struct   CF_ReplicationClient
+ * @category net
+ * @brief    An opaque handle for receiving entity state sent by a `CF_ReplicationServer`.
+ * @related  CF_ReplicationClient cf_make_replication_client cf_replication_client_read cf_replication_client_get_entity CF_ReplicationServer
+ */
+typedef struct CF_ReplicationClient { uint64_t id; } CF_ReplicationClient;
+// @end
+
+/**
+ * @struct   CF_ReplicationConfig
+ * @category net
+ * @brief    Settings for `cf_make_replication_server` and `cf_make_replication_client`.
+ * @remarks  The server and its clients must use the same `entity_capacity` and `field_count`.
+ * @related  CF_ReplicationConfig cf_replication_config_defaults cf_make_replication_server cf_make_replication_client
+ */
+typedef struct CF_ReplicationConfig
+{
+	/* @member Entities are numbered from zero up to, but not including, this. */
+	int entity_capacity;
+
+	/* @member The number of `int32_t` fields describing each entity. */
+	int field_count;
+
+	/* @member How many clients the server syncs, indexed like `CF_ServerEvent`'s `client_index`. Ignored by clients. */
+	int client_capacity;
+
+	/* @member How many recent packets are remembered while waiting on acks. Acks older than this are ignored, and entities fall back to a full send. */
+	int history_size;
+
+	/* @member Default false. When true, each client only gets the entities added to its scope with `cf_replication_server_scope_add`, and writing a packet only looks at those instead of every entity. Ignored by clients. */
+	bool scoped;
+} CF_ReplicationConfig;
+// @end
+
+/**
+ * @function cf_replication_config_defaults
+ * @category net
+ * @brief    Returns a good set of default settings, leaving `entity_capacity` and `field_count` for you to fill in.
+ * @related  CF_ReplicationConfig cf_make_replication_server cf_make_replication_client
+ */
+CF_INLINE CF_ReplicationConfig CF_CALL cf_replication_config_defaults()
+{
+	CF_ReplicationConfig config;
+	config.entity_capacity = 0;
+	config.field_count = 0;
+	config.client_capacity = CF_SERVER_MAX_CLIENTS;
+	config.history_size = 32;
+	config.scoped = false;
+	return config;
+}
+
+/**
+ * @function cf_make_replication_server
+ * @category net
+ * @brief    Returns a new `CF_ReplicationServer`.
+ * @param    config     The settings, see `cf_replication_config_defaults`.
+ * @related  CF_ReplicationServer cf_destroy_replication_server cf_replication_server_set_entity cf_replication_server_send
+ */
+CF_API CF_ReplicationServer CF_CALL cf_make_replication_server(CF_ReplicationConfig config);
+
+/**
+ * @function cf_destroy_replication_server
+ * @category net
+ * @brief    Destroys a `CF_ReplicationServer` made by `cf_make_replication_server`.
+ * @related  CF_ReplicationServer cf_make_replication_server
+ */
+CF_API void CF_CALL cf_destroy_replication_server(CF_ReplicationServer rs);
+
+/**
+ * @function cf_replication_server_set_entity
+ * @category net
+ * @brief    Sets the current state of an entity, creating it for clients if it didn't exist yet.
+ * @param    rs         The replication server.
+ * @param    entity     The entity's index, less than `entity_capacity`.
+ * @param    fields     `field_count` values describing the entity. They're copied.
+ * @related  CF_ReplicationServer cf_replication_server_remove_entity cf_replication_server_send
+ */
+CF_API void CF_CALL cf_replication_server_set_entity(CF_ReplicationServer rs, int entity, const int32_t* fields);
+
+/**
+ * @function cf_replication_server_remove_entity
+ * @category net
+ * @brief    Removes an entity, which is then removed on clients too.
+ * @param    rs         The replication server.
+ * @param    entity     The entity's index.
+ * @related  CF_ReplicationServer cf_replication_server_set_entity
+ */
+CF_API void CF_CALL cf_replication_server_remove_entity(CF_ReplicationServer rs, int entity);
+
+/**
+ * @function cf_replication_server_set_priority
+ * @category net
+ * @brief    Sets how relevant an entity is to one client.
+ * @param    rs             The replication server.
+ * @param    client_index   The client.
+ * @param    entity         The entity's index.
+ * @param    priority       Defaults to 1. Zero means the entity isn't sent to this client at all.
+ * @remarks  Changed entities build up their priority each time a packet is written, and the highest totals go first. An entity that
+ *           didn't fit catches up over the next few packets, so low priority entities are sent less often rather than never.
+ *           For example, scale priority by distance to the client's player.
+ * @related  CF_ReplicationServer cf_replication_server_write cf_replication_server_send
+ */
+CF_API void CF_CALL cf_replication_server_set_priority(CF_ReplicationServer rs, int client_index, int entity, float priority);
+
+/**
+ * @function cf_replication_server_scope_add
+ * @category net
+ * @brief    Adds an entity to a client's scope, so the client is sent the entity from now on.
+ * @param    rs             The replication server, made with `scoped` set.
+ * @param    client_index   The client.
+ * @param    entity         The entity's index.
+ * @remarks  Usually driven by `cf_interest_get_entered`. `cf_replication_server_reset_client` empties the scope.
+ * @related  CF_ReplicationServer cf_replication_server_scope_remove CF_Interest
+ */
+CF_API void CF_CALL cf_replication_server_scope_add(CF_ReplicationServer rs, int client_index, int entity);
+
+/**
+ * @function cf_replication_server_scope_remove
+ * @category net
+ * @brief    Removes an entity from a client's scope, so it's removed on that client as if it were destroyed.
+ * @param    rs             The replication server, made with `scoped` set.
+ * @param    client_index   The client.
+ * @param    entity         The entity's index.
+ * @remarks  Usually driven by `cf_interest_get_left`. The entity is still looked at when writing until the client acks its removal.
+ * @related  CF_ReplicationServer cf_replication_server_scope_add CF_Interest
+ */
+CF_API void CF_CALL cf_replication_server_scope_remove(CF_ReplicationServer rs, int client_index, int entity);
+
+/**
+ * @function cf_replication_server_reset_client
+ * @category net
+ * @brief    Forgets everything known about a client, so the next packets send every entity in full.
+ * @param    rs             The replication server.
+ * @param    client_index   The client.
+ * @remarks  Call this when a client connects or disconnects.
+ * @related  CF_ReplicationServer CF_ServerEvent
+ */
+CF_API void CF_CALL cf_replication_server_reset_client(CF_ReplicationServer rs, int client_index);
+
+/**
+ * @function cf_replication_server_write
+ * @category net
+ * @brief    Writes the next packet for a client.
+ * @param    rs             The replication server.
+ * @param    client_index   The client.
+ * @param    buffer         Where to write the packet.
+ * @param    size           The size of `buffer` in bytes, which caps the size of the packet.
+ * @return   Returns the size of the packet in bytes, or zero if the client is already up to date.
+ * @remarks  Send the packet unreliably -- a lost packet is simply superseded by the next one. See `cf_replication_server_send`.
+ * @related  CF_ReplicationServer cf_replication_server_send cf_replication_server_ack cf_replication_client_read
+ */
+CF_API int CF_CALL cf_replication_server_write(CF_ReplicationServer rs, int client_index, void* buffer, int size);
+
+/**
+ * @function cf_replication_server_send
+ * @category net
+ * @brief    Writes the next packet for a client and sends it unreliably with `cf_server_send`.
+ * @param    rs             The replication server.
+ * @param    server         The server.
+ * @param    client_index   The client.
+ * @remarks  Packets are capped to a single unfragmented datagram. Does nothing if the client is already up to date.
+ * @related  CF_ReplicationServer cf_replication_server_write cf_replication_server_ack
+ */
+CF_API void CF_CALL cf_replication_server_send(CF_ReplicationServer rs, CF_Server* server, int client_index);
+
+/**
+ * @function cf_replication_server_ack
+ * @category net
+ * @brief    Records that a client received a packet, as reported by `cf_replication_client_read`.
+ * @param    rs             The replication server.
+ * @param    client_index   The client.
+ * @param    sequence       The ack from the client.
+ * @remarks  Later packets are delta-encoded against what the client acked. How acks get back to the server is up to you, usually
+ *           as a field in the client's next input packet.
+ * @related  CF_ReplicationServer cf_replication_server_write cf_replication_client_read
+ */
+CF_API void CF_CALL cf_replication_server_ack(CF_ReplicationServer rs, int client_index, uint16_t sequence);
+
+/**
+ * @function cf_make_replication_client
+ * @category net
+ * @brief    Returns a new `CF_ReplicationClient`.
+ * @param    config     The settings, which must match the server's.
+ * @related  CF_ReplicationClient cf_destroy_replication_client cf_replication_client_read
+ */
+CF_API CF_ReplicationClient CF_CALL cf_make_replication_client(CF_ReplicationConfig config);
+
+/**
+ * @function cf_destroy_replication_client
+ * @category net
+ * @brief    Destroys a `CF_ReplicationClient` made by `cf_make_replication_client`.
+ * @related  CF_ReplicationClient cf_make_replication_client
+ */
+CF_API void CF_CALL cf_destroy_replication_client(CF_ReplicationClient rc);
+
+/**
+ * @function cf_replication_client_read
+ * @category net
+ * @brief    Applies a packet written by `cf_replication_server_write`.
+ * @param    rc         The replication client.
+ * @param    data       The packet.
+ * @param    size       The size of the packet in bytes.
+ * @param    ack        Set to the sequence to send back to the server for `cf_replication_server_ack`.
+ * @return   Returns true if the packet should be acked.
+ * @remarks  Out of order packets never overwrite newer state. A packet is not acked if it was malformed, or if some entity's
+ *           baseline was already forgotten. The server then falls back to sending those entities in full.
+ * @related  CF_ReplicationClient cf_replication_client_has_entity cf_replication_client_get_entity cf_replication_server_ack
+ */
+CF_API bool CF_CALL cf_replication_client_read(CF_ReplicationClient rc, const void* data, int size, uint16_t* ack);
+
+/**
+ * @function cf_replication_client_has_entity
+ * @category net
+ * @brief    Returns true if the entity currently exists on the server, as far as this client knows.
+ * @param    rc         The replication client.
+ * @param    entity     The entity's index.
+ * @related  CF_ReplicationClient cf_replication_client_get_entity
+ */
+CF_API bool CF_CALL cf_replication_client_has_entity(CF_ReplicationClient rc, int entity);
+
+/**
+ * @function cf_replication_client_get_entity
+ * @category net
+ * @brief    Returns the `field_count` fields last received for an entity.
+ * @param    rc         The replication client.
+ * @param    entity     The entity's index.
+ * @remarks  Check `cf_replication_client_has_entity` first, the fields of a missing entity are stale.
+ * @related  CF_ReplicationClient cf_replication_client_has_entity cf_replication_client_read
+ */
+CF_API const int32_t* CF_CALL cf_replication_client_get_entity(CF_ReplicationClient rc, int entity);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using ReplicationServer = CF_ReplicationServer;
+using ReplicationClient = CF_ReplicationClient;
+using ReplicationConfig = CF_ReplicationConfig;
+
+CF_INLINE ReplicationConfig replication_config_defaults() { return cf_replication_config_defaults(); }
+
+CF_INLINE ReplicationServer make_replication_server(ReplicationConfig config) { return cf_make_replication_server(config); }
+CF_INLINE void destroy_replication_server(ReplicationServer rs) { cf_destroy_replication_server(rs); }
+CF_INLINE void replication_server_set_entity(ReplicationServer rs, int entity, const int32_t* fields) { cf_replication_server_set_entity(rs, entity, fields); }
+CF_INLINE void replication_server_remove_entity(ReplicationServer rs, int entity) { cf_replication_server_remove_entity(rs, entity); }
+CF_INLINE void replication_server_set_priority(ReplicationServer rs, int client_index, int entity, float priority) { cf_replication_server_set_priority(rs, client_index, entity, priority); }
+CF_INLINE void replication_server_scope_add(ReplicationServer rs, int client_index, int entity) { cf_replication_server_scope_add(rs, client_index, entity); }
+CF_INLINE void replication_server_scope_remove(ReplicationServer rs, int client_index, int entity) { cf_replication_server_scope_remove(rs, client_index, entity); }
+CF_INLINE void replication_server_reset_client(ReplicationServer rs, int client_index) { cf_replication_server_reset_client(rs, client_index); }
+CF_INLINE int replication_server_write(ReplicationServer rs, int client_index, void* buffer, int size) { return cf_replication_server_write(rs, client_index, buffer, size); }
+CF_INLINE void replication_server_send(ReplicationServer rs, Server* server, int client_index) { cf_replication_server_send(rs, server, client_index); }
+CF_INLINE void replication_server_ack(ReplicationServer rs, int client_index, uint16_t sequence) { cf_replication_server_ack(rs, client_index, sequence); }
+
+CF_INLINE ReplicationClient make_replication_client(ReplicationConfig config) { return cf_make_replication_client(config); }
+CF_INLINE void destroy_replication_client(ReplicationClient rc) { cf_destroy_replication_client(rc); }
+CF_INLINE bool replication_client_read(ReplicationClient rc, const void* data, int size, uint16_t* ack) { return cf_replication_client_read(rc, data, size, ack); }
+CF_INLINE bool replication_client_has_entity(ReplicationClient rc, int entity) { return cf_replication_client_has_entity(rc, entity); }
+CF_INLINE const int32_t* replication_client_get_entity(ReplicationClient rc, int entity) { return cf_replication_client_get_entity(rc, entity); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_REPLICATION_H
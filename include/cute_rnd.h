@@ -111,6 +111,63 @@ CF_INLINE float    CF_CALL cf_rnd_range_float(CF_RndState* rnd, float min, float
  */
 CF_INLINE double   CF_CALL cf_rnd_range_double(CF_RndState* rnd, double min, double max);
 
+/**
+ * @function cf_rnd_fill_floats
+ * @category random
+ * @brief    Fills an array with random `float`s from 0 up to (but not including) 1.
+ * @param    rnd          The random number generator state.
+ * @param    out          Receives `count` random numbers.
+ * @param    count        The number of random numbers to generate.
+ * @remarks  Much faster than calling `cf_rnd_float` in a loop for large arrays. Four independent streams are run side by side with
+ *           SIMD instructions, each starting 2^64 numbers further along `rnd`'s sequence, and interleaved into `out`. The results are
+ *           deterministic, but differ from calling `cf_rnd_float` `count` times unless `count` is below 1024. Afterwards `rnd` has moved
+ *           past the numbers used, so following calls never repeat them.
+ * @related  CF_RndState cf_rnd_float cf_rnd_fill_floats cf_rnd_fill_uint32 cf_rnd_split
+ */
+CF_API void CF_CALL cf_rnd_fill_floats(CF_RndState* rnd, float* out, int count);
+
+/**
+ * @function cf_rnd_fill_uint32
+ * @category random
+ * @brief    Fills an array with random `uint32_t`s.
+ * @param    rnd          The random number generator state.
+ * @param    out          Receives `count` random numbers.
+ * @param    count        The number of random numbers to generate.
+ * @remarks  Each number is the high 32 bits of a `cf_rnd` result, which are the best quality bits of this generator. See
+ *           `cf_rnd_fill_floats` for how the numbers are generated.
+ * @related  CF_RndState cf_rnd cf_rnd_fill_floats cf_rnd_fill_uint32 cf_rnd_split
+ */
+CF_API void CF_CALL cf_rnd_fill_uint32(CF_RndState* rnd, uint32_t* out, int count);
+
+/**
+ * @function cf_rnd_jump
+ * @category random
+ * @brief    Moves `rnd` ahead 2^96 numbers along its sequence, as if `cf_rnd` was called that many times.
+ * @param    rnd          The random number generator state.
+ * @remarks  Takes about as long as a couple hundred calls to `cf_rnd`. See `cf_rnd_split` for giving each thread its own stream.
+ * @related  CF_RndState cf_rnd_seed cf_rnd_jump cf_rnd_split
+ */
+CF_API void CF_CALL cf_rnd_jump(CF_RndState* rnd);
+
+/**
+ * @function cf_rnd_split
+ * @category random
+ * @brief    Returns a new generator for a separate stream of random numbers, and moves `rnd` past it.
+ * @param    rnd          The random number generator state.
+ * @remarks  The returned generator is a copy of `rnd`, after which `rnd` jumps ahead 2^96 numbers with `cf_rnd_jump`. Streams split
+ *           one after another never overlap (unless one of them is used for 2^96 numbers), and are the same each run for the same seed.
+ *           This makes it easy to hand each worker thread its own deterministic generator.
+ *
+ *           ```cpp
+ *           CF_RndState rnd = cf_rnd_seed(level_seed);
+ *           for (int i = 0; i < worker_count; ++i) {
+ *               workers[i].rnd = cf_rnd_split(&rnd);
+ *           }
+ *           ```
+ * @related  CF_RndState cf_rnd_seed cf_rnd_jump cf_rnd_split
+ */
+CF_API CF_RndState CF_CALL cf_rnd_split(CF_RndState* rnd);
+
 // -------------------------------------------------------------------------------------------------
 
 CF_INLINE uint64_t cf_internal_rnd_murmur3_avalanche64(uint64_t h)
@@ -222,6 +279,10 @@ CF_INLINE int      rnd_range(Rnd* rnd, int min, int max) { return cf_rnd_range_i
 CF_INLINE uint64_t rnd_range(Rnd* rnd, uint64_t min, uint64_t max) { return cf_rnd_range_uint64(rnd, min, max); }
 CF_INLINE float    rnd_range(Rnd* rnd, float min, float max) { return cf_rnd_range_float(rnd, min, max); }
 CF_INLINE double   rnd_range(Rnd* rnd, double min, double max) { return cf_rnd_range_double(rnd, min, max); }
+CF_INLINE void     rnd_fill(Rnd* rnd, float* out, int count) { cf_rnd_fill_floats(rnd, out, count); }
+CF_INLINE void     rnd_fill(Rnd* rnd, uint32_t* out, int count) { cf_rnd_fill_uint32(rnd, out, count); }
+CF_INLINE void     rnd_jump(Rnd* rnd) { cf_rnd_jump(rnd); }
+CF_INLINE Rnd      rnd_split(Rnd* rnd) { return cf_rnd_split(rnd); }
 
 CF_INLINE uint64_t rnd(Rnd& rnd) { return cf_rnd(&rnd); }
 CF_INLINE float    rnd_float(Rnd& rnd) { return cf_rnd_float(&rnd); }
@@ -230,6 +291,10 @@ CF_INLINE int      rnd_range(Rnd& rnd, int min, int max) { return cf_rnd_range_i
 CF_INLINE uint64_t rnd_range(Rnd& rnd, uint64_t min, uint64_t max) { return cf_rnd_range_uint64(&rnd, min, max); }
 CF_INLINE float    rnd_range(Rnd& rnd, float min, float max) { return cf_rnd_range_float(&rnd, min, max); }
 CF_INLINE double   rnd_range(Rnd& rnd, double min, double max) { return cf_rnd_range_double(&rnd, min, max); }
+CF_INLINE void     rnd_fill(Rnd& rnd, float* out, int count) { cf_rnd_fill_floats(&rnd, out, count); }
+CF_INLINE void     rnd_fill(Rnd& rnd, uint32_t* out, int count) { cf_rnd_fill_uint32(&rnd, out, count); }
+CF_INLINE void     rnd_jump(Rnd& rnd) { cf_rnd_jump(&rnd); }
+CF_INLINE Rnd      rnd_split(Rnd& rnd) { return cf_rnd_split(&rnd); }
 
 }
 
@@ -0,0 +1,161 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_SPATIAL_HASH_H
+#define CF_SPATIAL_HASH_H
+
+#include "cute_defines.h"
+#include "cute_math.h"
+#include "cute_aabb_tree.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_SpatialHash
+ * @category collision
+ * @brief    An opaque handle representing a spatial hash, a uniform grid of cells. See `cf_make_spatial_hash` for more details.
+ * @related  cf_make_spatial_hash cf_spatial_hash_insert cf_spatial_hash_query_aabb
+ */
+typedef struct CF_SpatialHash { uint64_t id; } CF_SpatialHash;
+// @end
+
+/**
+ * @function cf_make_spatial_hash
+ * @category collision
+ * @brief    Creates a `CF_SpatialHash`, an alternative to `CF_AabbTree` for many similarly sized objects that move every frame.
+ * @param    cell_size         The width and height of each grid cell. A good size is about the size of a typical object.
+ * @param    initial_capacity  Sizes the internal arrays for a number of objects to insert. This may be zero.
+ * @return   Returns a `CF_SpatialHash` for optimizing collision queries.
+ * @remarks  Objects are sorted into the cells of an infinite uniform grid, and only occupied cells take up memory. Unlike `CF_AabbTree`,
+ *           moving an object is O(1): `cf_spatial_hash_update` just stores the new AABB. The grid is rebuilt in one batch before the next
+ *           query, by radix sorting objects on their cells so each cell's objects sit next to each other in memory. This suits bullets,
+ *           particles or crowds. Use `CF_AabbTree` instead for objects of very different sizes, or that mostly stand still.
+ * @related  CF_SpatialHash cf_destroy_spatial_hash cf_spatial_hash_insert cf_spatial_hash_update cf_spatial_hash_query_aabb
+ */
+CF_API CF_SpatialHash CF_CALL cf_make_spatial_hash(float cell_size, int initial_capacity);
+
+/**
+ * @function cf_destroy_spatial_hash
+ * @category collision
+ * @brief    Destroys a spatial hash previously created by `cf_make_spatial_hash`.
+ * @param    hash       The spatial hash to destroy.
+ * @related  cf_make_spatial_hash
+ */
+CF_API void CF_CALL cf_destroy_spatial_hash(CF_SpatialHash hash);
+
+/**
+ * @function cf_spatial_hash_insert
+ * @category collision
+ * @brief    Adds a new `CF_Leaf` to the spatial hash.
+ * @param    hash       The spatial hash.
+ * @param    aabb       The AABB (axis-aligned bounding box) representing your object.
+ * @param    udata      Can be `NULL`. An optional user data pointer. This gets returned to you in the callback `CF_AabbTreeQueryFn`.
+ * @return   Returns a `CF_Leaf` representing the inserted AABB.
+ * @related  cf_spatial_hash_remove cf_spatial_hash_update cf_spatial_hash_query_aabb
+ */
+CF_API CF_Leaf CF_CALL cf_spatial_hash_insert(CF_SpatialHash hash, CF_Aabb aabb, void* udata);
+
+/**
+ * @function cf_spatial_hash_remove
+ * @category collision
+ * @brief    Removes a `CF_Leaf` from the spatial hash.
+ * @param    hash       The spatial hash.
+ * @param    leaf       The leaf returned from `cf_spatial_hash_insert`.
+ * @related  cf_spatial_hash_insert
+ */
+CF_API void CF_CALL cf_spatial_hash_remove(CF_SpatialHash hash, CF_Leaf leaf);
+
+/**
+ * @function cf_spatial_hash_update
+ * @category collision
+ * @brief    Updates a `CF_Leaf`'s AABB. Call this if your object moves.
+ * @param    hash       The spatial hash.
+ * @param    leaf       The leaf returned from `cf_spatial_hash_insert`.
+ * @param    aabb       The new AABB around your moved object.
+ * @remarks  This is O(1), it only stores `aabb`. The grid catches up in one batch at the next `cf_spatial_hash_rebuild` or query.
+ * @related  cf_spatial_hash_insert cf_spatial_hash_rebuild cf_spatial_hash_query_aabb
+ */
+CF_API void CF_CALL cf_spatial_hash_update(CF_SpatialHash hash, CF_Leaf leaf, CF_Aabb aabb);
+
+/**
+ * @function cf_spatial_hash_get_aabb
+ * @category collision
+ * @brief    Returns the AABB of a `CF_Leaf`.
+ * @param    hash       The spatial hash.
+ * @param    leaf       The leaf returned from `cf_spatial_hash_insert`.
+ * @related  cf_spatial_hash_insert cf_spatial_hash_update
+ */
+CF_API CF_Aabb CF_CALL cf_spatial_hash_get_aabb(CF_SpatialHash hash, CF_Leaf leaf);
+
+/**
+ * @function cf_spatial_hash_get_udata
+ * @category collision
+ * @brief    Returns the `udata` pointer from `cf_spatial_hash_insert`.
+ * @param    hash       The spatial hash.
+ * @param    leaf       The leaf returned from `cf_spatial_hash_insert`.
+ * @related  cf_spatial_hash_insert
+ */
+CF_API void* CF_CALL cf_spatial_hash_get_udata(CF_SpatialHash hash, CF_Leaf leaf);
+
+/**
+ * @function cf_spatial_hash_rebuild
+ * @category collision
+ * @brief    Sorts every object into the grid cells it overlaps, if anything changed since the last rebuild.
+ * @param    hash       The spatial hash.
+ * @remarks  Queries call this for you, so there's usually no need to. Call it once after moving everything for the frame if queries
+ *           then run on more than one thread, as queries are otherwise only safe to run one at a time.
+ * @related  cf_spatial_hash_update cf_spatial_hash_query_aabb
+ */
+CF_API void CF_CALL cf_spatial_hash_rebuild(CF_SpatialHash hash);
+
+/**
+ * @function cf_spatial_hash_query_aabb
+ * @category collision
+ * @brief    Finds all objects whose AABB overlaps `aabb`.
+ * @param    hash       The spatial hash to query.
+ * @param    fn         Reports hits, see `CF_AabbTreeQueryFn`. Each object is reported once, in no particular order.
+ * @param    aabb       The AABB to query with.
+ * @param    fn_udata   Can be `NULL`. An optional user data pointer, handed back to you when `fn` is called to report hits.
+ * @remarks  The spatial hash must not be modified from within `fn`.
+ * @related  cf_spatial_hash_insert cf_spatial_hash_rebuild CF_AabbTreeQueryFn
+ */
+CF_API void CF_CALL cf_spatial_hash_query_aabb(const CF_SpatialHash hash, CF_AabbTreeQueryFn* fn, CF_Aabb aabb, void* fn_udata);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using SpatialHash = CF_SpatialHash;
+
+CF_INLINE SpatialHash make_spatial_hash(float cell_size, int initial_capacity = 0) { return cf_make_spatial_hash(cell_size, initial_capacity); }
+CF_INLINE void destroy_spatial_hash(SpatialHash hash) { cf_destroy_spatial_hash(hash); }
+CF_INLINE Leaf spatial_hash_insert(SpatialHash hash, Aabb aabb, void* udata = NULL) { return cf_spatial_hash_insert(hash, aabb, udata); }
+CF_INLINE void spatial_hash_remove(SpatialHash hash, Leaf leaf) { cf_spatial_hash_remove(hash, leaf); }
+CF_INLINE void spatial_hash_update(SpatialHash hash, Leaf leaf, Aabb aabb) { cf_spatial_hash_update(hash, leaf, aabb); }
+CF_INLINE Aabb spatial_hash_get_aabb(SpatialHash hash, Leaf leaf) { return cf_spatial_hash_get_aabb(hash, leaf); }
+CF_INLINE void* spatial_hash_get_udata(SpatialHash hash, Leaf leaf) { return cf_spatial_hash_get_udata(hash, leaf); }
+CF_INLINE void spatial_hash_rebuild(SpatialHash hash) { cf_spatial_hash_rebuild(hash); }
+CF_INLINE void spatial_hash_query(const SpatialHash hash, AabbTreeQueryFn* fn, Aabb aabb, void* fn_udata = NULL) { cf_spatial_hash_query_aabb(hash, fn, aabb, fn_udata); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_SPATIAL_HASH_H
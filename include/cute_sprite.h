@@ -14,6 +14,7 @@
 #include "cute_string.h"
 #include "cute_math.h"
 #include "cute_time.h"
+#include "cute_multithreading.h"
 #include "cute_color.h"
 #include "cute_result.h"
 #include "cute_math.h"
@@ -215,6 +216,56 @@ CF_API void CF_CALL cf_easy_sprite_update_pixels(CF_Sprite* sprite, const CF_Pix
  */
 CF_API void CF_CALL cf_easy_sprite_unload(CF_Sprite *sprite);
 
+/**
+ * @function cf_make_dynamic_sprite
+ * @category sprite
+ * @brief    Constructs a sprite backed by its own texture, for pixels that change often such as video playback or minimaps.
+ * @param    pixels     The initial pixels, `w * h` in size, or `NULL` to start out transparent.
+ * @param    w          The width of the sprite in pixels.
+ * @param    h          The height of the sprite in pixels.
+ * @return   Returns a `CF_Sprite` that can be drawn with `cf_draw_sprite`.
+ * @remarks  Unlike easy sprites, dynamic sprites live outside of the atlases. Updating them never re-fetches pixels or
+ *           rebuilds an atlas, it uploads the sprite's own texture at most once per frame. The texture is streamed, so
+ *           the GPU can still read last frame's pixels while this frame's are written. The downside is every dynamic
+ *           sprite breaks up draw call batching, so prefer easy sprites for images that rarely change.
+ * @related  CF_Sprite cf_make_dynamic_sprite cf_dynamic_sprite_update_pixels cf_dynamic_sprite_update_rect cf_dynamic_sprite_unload
+ */
+CF_API CF_Sprite CF_CALL cf_make_dynamic_sprite(const CF_Pixel* pixels, int w, int h);
+
+/**
+ * @function cf_dynamic_sprite_update_pixels
+ * @category sprite
+ * @brief    Replaces all pixels of a sprite created by `cf_make_dynamic_sprite`.
+ * @param    sprite     The sprite to update.
+ * @param    pixels     The new pixels, `sprite->w * sprite->h` in size.
+ * @related  CF_Sprite cf_make_dynamic_sprite cf_dynamic_sprite_update_pixels cf_dynamic_sprite_update_rect cf_dynamic_sprite_unload
+ */
+CF_API void CF_CALL cf_dynamic_sprite_update_pixels(CF_Sprite* sprite, const CF_Pixel* pixels);
+
+/**
+ * @function cf_dynamic_sprite_update_rect
+ * @category sprite
+ * @brief    Replaces a sub-rectangle of the pixels of a sprite created by `cf_make_dynamic_sprite`.
+ * @param    sprite     The sprite to update.
+ * @param    x          The left of the rectangle, in pixels.
+ * @param    y          The top of the rectangle, in pixels. Row zero is the top row of the sprite.
+ * @param    w          The width of the rectangle, in pixels.
+ * @param    h          The height of the rectangle, in pixels.
+ * @param    pixels     Tightly packed rows of the new pixels, `w * h` in size.
+ * @remarks  Any part of the rectangle outside of the sprite is ignored. Many updates in one frame are merged into a single upload.
+ * @related  CF_Sprite cf_make_dynamic_sprite cf_dynamic_sprite_update_pixels cf_dynamic_sprite_update_rect cf_dynamic_sprite_unload
+ */
+CF_API void CF_CALL cf_dynamic_sprite_update_rect(CF_Sprite* sprite, int x, int y, int w, int h, const CF_Pixel* pixels);
+
+/**
+ * @function cf_dynamic_sprite_unload
+ * @category sprite
+ * @brief    Destroys the texture and pixels of a sprite created by `cf_make_dynamic_sprite`.
+ * @param    sprite     The sprite to unload.
+ * @related  CF_Sprite cf_make_dynamic_sprite cf_dynamic_sprite_update_pixels cf_dynamic_sprite_update_rect cf_dynamic_sprite_unload
+ */
+CF_API void CF_CALL cf_dynamic_sprite_unload(CF_Sprite* sprite);
+
 /**
  * @function cf_make_sprite
  * @category sprite
@@ -229,6 +280,22 @@ CF_API void CF_CALL cf_easy_sprite_unload(CF_Sprite *sprite);
  */
 CF_API CF_Sprite CF_CALL cf_make_sprite(const char* aseprite_path);
 
+/**
+ * @function cf_make_sprites
+ * @category sprite
+ * @brief    Loads many sprites from aseprite files at once.
+ * @param    aseprite_paths  An array of virtual paths to .ase files.
+ * @param    count           The number of paths in `aseprite_paths`.
+ * @param    sprites_out     Can be `NULL`. An array of `count` sprites, filled out in the same order as `aseprite_paths`.
+ * @return   Returns the first error encountered, if any.
+ * @remarks  The same as calling `cf_make_sprite` on each path, but the files are read, decoded and premultiplied across the app's
+ *           threadpool, then cached all at once. Use this for loading screens with many sprites. Sprites that fail to load are set to
+ *           `cf_sprite_defaults` in `sprites_out`, with no message box, while the rest are still loaded. Sprites already in the cache
+ *           aren't loaded again.
+ * @related  CF_Sprite cf_make_sprite cf_make_sprite_from_memory cf_sprite_unload
+ */
+CF_API CF_Result CF_CALL cf_make_sprites(const char** aseprite_paths, int count, CF_Sprite* sprites_out);
+
 /**
  * @function cf_make_sprite_from_memory
  * @category sprite
@@ -275,6 +342,35 @@ CF_API void CF_CALL cf_sprite_unload(const char* aseprite_path);
  */
 CF_API CF_Sprite CF_CALL cf_sprite_reload(const CF_Sprite* sprite);
 
+/**
+ * @function cf_sprite_set_cook_directory
+ * @category sprite
+ * @brief    Caches sprites as cooked files in a directory, so later loads of the same .ase files skip parsing them.
+ * @param    virtual_directory  A virtual directory for cooked files, such as "/cooked". `NULL` turns cooking off, the default.
+ * @remarks  Parsing an .ase decompresses and blends every layer of every frame, which is slow for big layered files. A cooked file holds
+ *           the finished, premultiplied frames along with the animation tags and origin slice, named after a hash of the .ase file's
+ *           contents. Loads by `cf_make_sprite`, `cf_make_sprites` and `cf_make_sprite_from_memory` use a matching cooked file when one is
+ *           found, and otherwise parse the .ase and write its cooked file. Editing an .ase changes its hash, so stale cooked files are
+ *           never used, though they aren't deleted either. Cooked files are written to the write directory, see `cf_fs_set_write_directory`,
+ *           and read through the search path, so mount the write directory to use them on the next run. Shipped games can include their
+ *           cooked files and skip parsing altogether, but the .ase files are still needed to compute their hashes.
+ * @related  cf_make_sprite cf_make_sprites cf_fs_set_write_directory
+ */
+CF_API void CF_CALL cf_sprite_set_cook_directory(const char* virtual_directory);
+
+/**
+ * @function cf_sprite_set_parallel_decoding
+ * @category sprite
+ * @brief    Spreads the decoding of each .ase file across the app's threadpool. Off by default.
+ * @param    true_to_parallelize  True to decode in parallel.
+ * @remarks  Decoding an .ase inflates every compressed cel and then blends the layers of every frame, one after another. With this on,
+ *           the cels are inflated and the frames blended on the threadpool instead, which speeds up loading sprite sheets with many frames.
+ *           The decoded frames are identical either way, in the same order. Has no effect on sprites read from cooked files, see
+ *           `cf_sprite_set_cook_directory`, or when the app was made without a threadpool.
+ * @related  cf_make_sprite cf_make_sprites cf_make_sprite_from_memory cf_sprite_set_cook_directory
+ */
+CF_API void CF_CALL cf_sprite_set_parallel_decoding(bool true_to_parallelize);
+
 //--------------------------------------------------------------------------------------------------
 // In-line implementation of `CF_Sprite` functions.
 
@@ -462,6 +558,22 @@ CF_INLINE void cf_sprite_update(CF_Sprite* sprite)
 	}
 }
 
+/**
+ * @function cf_sprites_update
+ * @category sprite
+ * @brief    Updates the animations of many sprites at once.
+ * @param    sprites    An array of sprites.
+ * @param    count      The number of sprites in `sprites`.
+ * @param    dt         Time passed since the last update in seconds, usually `CF_DELTA_TIME`.
+ * @param    pool       Can be `NULL`. Large batches are split into tasks on this threadpool.
+ * @remarks  Faster than calling `cf_sprite_update` on each sprite. Sprites are grouped by play direction and each group is advanced in a
+ *           tight loop. Unlike `cf_sprite_update`, a `dt` longer than a frame's delay advances through as many frames as it covers, and
+ *           leftover time carries over to the next frame. Since time carries over `cf_sprite_on_loop` may not fire, compare
+ *           `cf_sprite_get_loop_count` between updates instead.
+ * @related  CF_Sprite cf_sprite_update cf_sprite_play cf_sprite_get_loop_count
+ */
+CF_API void CF_CALL cf_sprites_update(CF_Sprite* sprites, int count, float dt, CF_Threadpool* pool);
+
 /**
  * @function cf_sprite_reset
  * @category sprite
@@ -679,6 +791,147 @@ CF_INLINE bool cf_sprite_on_loop(CF_Sprite* sprite)
 	}
 }
 
+/**
+ * @struct   CF_SpriteDef
+ * @category sprite
+ * @brief    An opaque handle to the shared, read-only half of a sprite: its size, origin and animations.
+ * @remarks  A `CF_Sprite` carries a copy of all of this along with its playback state, which is handy but adds up with many
+ *           sprites. Instead, make one `CF_SpriteDef` per sprite file, and a small `CF_SpriteInstance` per entity.
+ * @related  CF_SpriteDef CF_SpriteInstance cf_make_sprite_def cf_make_sprite_def_from_sprite cf_destroy_sprite_def cf_make_sprite_instance
+ */
+typedef struct CF_SpriteDef { uint64_t id; } CF_SpriteDef;
+// @end
+
+/**
+ * @struct   CF_SpriteInstance
+ * @category sprite
+ * @brief    The 16 byte per-entity half of a sprite: which animation is playing and how far along it is.
+ * @remarks  Instances are plain old data, and point back at their `CF_SpriteDef` for everything else. Scale, opacity and
+ *           transform aren't stored, they're passed in when drawing with `cf_draw_sprite_instance`.
+ * @related  CF_SpriteDef CF_SpriteInstance cf_make_sprite_instance cf_sprite_instance_play cf_sprite_instances_update cf_draw_sprite_instance
+ */
+typedef struct CF_SpriteInstance
+{
+	/* @member The `id` of the `CF_SpriteDef` this is an instance of. */
+	uint32_t def;
+
+	/* @member Index of the playing animation within the definition, see `cf_sprite_instance_play`. */
+	uint16_t animation;
+
+	/* @member The current frame within the animation. */
+	uint16_t frame_index;
+
+	/* @member The current elapsed time within the frame, in seconds. */
+	float t;
+
+	/* @member The number of times the animation has completed. Wraps around past 65535. */
+	uint16_t loop_count;
+
+	/* @member The direction frames play in, see `CF_PlayDirection`. Set to the animation's direction by `cf_sprite_instance_play`. */
+	uint8_t play_direction;
+
+	/* @member Whether or not to pause updates to the animation. */
+	bool paused;
+} CF_SpriteInstance;
+// @end
+
+/**
+ * @function cf_make_sprite_def
+ * @category sprite
+ * @brief    Loads a .ase file, and returns a definition for making many `CF_SpriteInstance`s of it.
+ * @param    aseprite_path  Virtual path to a .ase file.
+ * @remarks  Loads the file like `cf_make_sprite`. Calling this again with the same path returns the same definition without
+ *           searching the sprite cache. If the sprite is unloaded with `cf_sprite_unload` its instances draw nothing, until the
+ *           path is passed here again, or to `cf_sprite_reload`, which updates the definition in place.
+ * @related  CF_SpriteDef cf_make_sprite_def_from_sprite cf_destroy_sprite_def cf_make_sprite_instance
+ */
+CF_API CF_SpriteDef CF_CALL cf_make_sprite_def(const char* aseprite_path);
+
+/**
+ * @function cf_make_sprite_def_from_sprite
+ * @category sprite
+ * @brief    Returns a definition sharing the size, origin and animations of an existing sprite.
+ * @param    sprite     The sprite, such as one from `cf_make_sprite_from_memory` or `cf_make_easy_sprite_from_png`.
+ * @remarks  The definition refers to the sprite's animations rather than copying them, so they must outlive it. Each call makes a
+ *           new definition, destroy it with `cf_destroy_sprite_def` when done.
+ * @related  CF_SpriteDef cf_make_sprite_def cf_destroy_sprite_def cf_make_sprite_instance
+ */
+CF_API CF_SpriteDef CF_CALL cf_make_sprite_def_from_sprite(const CF_Sprite* sprite);
+
+/**
+ * @function cf_destroy_sprite_def
+ * @category sprite
+ * @brief    Destroys a `CF_SpriteDef`.
+ * @param    def        The definition.
+ * @remarks  Doesn't unload the sprite it came from. Instances of it must not be updated or drawn afterwards.
+ * @related  CF_SpriteDef cf_make_sprite_def cf_make_sprite_def_from_sprite
+ */
+CF_API void CF_CALL cf_destroy_sprite_def(CF_SpriteDef def);
+
+/**
+ * @function cf_make_sprite_instance
+ * @category sprite
+ * @brief    Returns a new instance of a sprite definition, playing its first animation.
+ * @param    def        The definition.
+ * @related  CF_SpriteDef CF_SpriteInstance cf_sprite_instance_play cf_sprite_instances_update cf_draw_sprite_instance
+ */
+CF_API CF_SpriteInstance CF_CALL cf_make_sprite_instance(CF_SpriteDef def);
+
+/**
+ * @function cf_sprite_instance_play
+ * @category sprite
+ * @brief    Switches to a new animation and starts playing it from the beginning.
+ * @param    instance   The instance.
+ * @param    animation  Name of the animation to switch to and start playing.
+ * @related  CF_SpriteInstance cf_sprite_instance_play cf_sprite_instance_is_playing cf_sprite_instances_update
+ */
+CF_API void CF_CALL cf_sprite_instance_play(CF_SpriteInstance* instance, const char* animation);
+
+/**
+ * @function cf_sprite_instance_is_playing
+ * @category sprite
+ * @brief    Returns true if `animation` is the currently playing animation.
+ * @param    instance   The instance.
+ * @param    animation  Name of the animation.
+ * @related  CF_SpriteInstance cf_sprite_instance_play cf_sprite_instance_is_playing
+ */
+CF_API bool CF_CALL cf_sprite_instance_is_playing(const CF_SpriteInstance* instance, const char* animation);
+
+/**
+ * @function cf_sprite_instances_update
+ * @category sprite
+ * @brief    Updates the animations of many sprite instances at once.
+ * @param    instances  An array of instances.
+ * @param    count      The number of instances in `instances`.
+ * @param    dt         Time passed since the last update in seconds, usually `CF_DELTA_TIME`.
+ * @param    pool       Can be `NULL`. Large batches are split into ranges on this threadpool.
+ * @remarks  Steps frames just like `cf_sprites_update`, advancing through as many frames as `dt` covers.
+ * @related  CF_SpriteInstance cf_sprite_instance_play cf_sprites_update
+ */
+CF_API void CF_CALL cf_sprite_instances_update(CF_SpriteInstance* instances, int count, float dt, CF_Threadpool* pool);
+
+/**
+ * @function cf_draw_sprite_instance
+ * @category sprite
+ * @brief    Draws a sprite instance.
+ * @param    instance   The instance.
+ * @param    position   Where to draw the sprite, before its definition's local offset.
+ * @param    scale      Scale of the sprite, negative to flip it. Usually `(1, 1)`.
+ * @remarks  Drawn just like `cf_draw_sprite`, so the current draw transform, tint and layer all apply.
+ * @related  CF_SpriteInstance cf_sprite_instance_to_sprite cf_draw_sprite
+ */
+CF_API void CF_CALL cf_draw_sprite_instance(const CF_SpriteInstance* instance, CF_V2 position, CF_V2 scale);
+
+/**
+ * @function cf_sprite_instance_to_sprite
+ * @category sprite
+ * @brief    Returns a full `CF_Sprite` with the instance's definition and playback state.
+ * @param    instance   The instance.
+ * @remarks  Useful for calling any of the `CF_Sprite` functions on an instance, such as `cf_sprite_frame_delay`.
+ * @related  CF_SpriteInstance CF_Sprite cf_draw_sprite_instance
+ */
+CF_API CF_Sprite CF_CALL cf_sprite_instance_to_sprite(const CF_SpriteInstance* instance);
+
 /**
  * @function cf_animation_add_frame
  * @category sprite
@@ -747,10 +1000,31 @@ struct Sprite : public CF_Sprite
 
 CF_INLINE Sprite easy_make_sprite(const char* png_path, Result* result) { return cf_make_easy_sprite_from_png(png_path, result); }
 CF_INLINE Sprite easy_make_sprite(const Pixel* pixels, int w, int h) { return cf_make_easy_sprite_from_pixels(pixels, w, h); }
+CF_INLINE Sprite make_dynamic_sprite(const Pixel* pixels, int w, int h) { return cf_make_dynamic_sprite(pixels, w, h); }
+CF_INLINE void dynamic_sprite_update_pixels(Sprite* sprite, const Pixel* pixels) { cf_dynamic_sprite_update_pixels(sprite, pixels); }
+CF_INLINE void dynamic_sprite_update_rect(Sprite* sprite, int x, int y, int w, int h, const Pixel* pixels) { cf_dynamic_sprite_update_rect(sprite, x, y, w, h, pixels); }
+CF_INLINE void dynamic_sprite_unload(Sprite* sprite) { cf_dynamic_sprite_unload(sprite); }
 CF_INLINE Sprite make_sprite(const char* aseprite_path) { return cf_make_sprite(aseprite_path); }
+CF_INLINE Result make_sprites(const char** aseprite_paths, int count, Sprite* sprites_out) { return cf_make_sprites(aseprite_paths, count, (CF_Sprite*)sprites_out); }
 CF_INLINE void sprite_unload(const char* aseprite_path) { cf_sprite_unload(aseprite_path); }
 CF_INLINE Sprite sprite_reload(const Sprite* sprite) { return cf_sprite_reload(sprite); }
 CF_INLINE Sprite sprite_reload(Sprite& sprite) { return (sprite = cf_sprite_reload(&sprite)); }
+CF_INLINE void sprite_set_cook_directory(const char* virtual_directory) { cf_sprite_set_cook_directory(virtual_directory); }
+CF_INLINE void sprite_set_parallel_decoding(bool true_to_parallelize) { cf_sprite_set_parallel_decoding(true_to_parallelize); }
+CF_INLINE void sprites_update(Sprite* sprites, int count, float dt = CF_DELTA_TIME, Threadpool* pool = NULL) { cf_sprites_update((CF_Sprite*)sprites, count, dt, pool); }
+
+using SpriteDef = CF_SpriteDef;
+using SpriteInstance = CF_SpriteInstance;
+
+CF_INLINE SpriteDef make_sprite_def(const char* aseprite_path) { return cf_make_sprite_def(aseprite_path); }
+CF_INLINE SpriteDef make_sprite_def(const Sprite* sprite) { return cf_make_sprite_def_from_sprite(sprite); }
+CF_INLINE void destroy_sprite_def(SpriteDef def) { cf_destroy_sprite_def(def); }
+CF_INLINE SpriteInstance make_sprite_instance(SpriteDef def) { return cf_make_sprite_instance(def); }
+CF_INLINE void sprite_instance_play(SpriteInstance* instance, const char* animation) { cf_sprite_instance_play(instance, animation); }
+CF_INLINE bool sprite_instance_is_playing(const SpriteInstance* instance, const char* animation) { return cf_sprite_instance_is_playing(instance, animation); }
+CF_INLINE void sprite_instances_update(SpriteInstance* instances, int count, float dt = CF_DELTA_TIME, Threadpool* pool = NULL) { cf_sprite_instances_update(instances, count, dt, pool); }
+CF_INLINE void draw_sprite_instance(const SpriteInstance* instance, v2 position, v2 scale = V2(1, 1)) { cf_draw_sprite_instance(instance, position, scale); }
+CF_INLINE Sprite sprite_instance_to_sprite(const SpriteInstance* instance) { return cf_sprite_instance_to_sprite(instance); }
 
 }
 
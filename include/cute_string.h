@@ -143,10 +143,13 @@ extern "C" {
  * @param    s            The string. Can be `NULL`.
  * @param    fmt          The format string.
  * @param    ...          The parameters for the format string.
- * @remarks  The string will be overwritten from the beginning. Will automatically adjust capacity as needed.
- * @related  sfmt sfmt_append svfmt svfmt_append sset
+ * @remarks  The string will be overwritten from the beginning. Will automatically adjust capacity as needed. Format strings using only
+ *           the flags `-+ 0`, plain widths and precisions, and the conversions `d i u x X c s f F %` are formatted in a single pass
+ *           without calling `vsnprintf`, with the same output. To format per-frame text without touching the heap, format into a
+ *           string from `sstatic` or `sframe`, or use `cf_frame_fmt`.
+ * @related  sfmt sfmt_append svfmt svfmt_append sset sstatic sframe
  */
-#define sfmt(s, fmt, ...) cf_string_fmt(s, fmt, (__VA_ARGS__))
+#define sfmt(s, fmt, ...) cf_string_fmt(s, fmt, __VA_ARGS__)
 
 /**
  * @function sfmt_append
@@ -158,7 +161,7 @@ extern "C" {
  * @remarks  All printed data is appended to the end of the string. Will automatically adjust it's capacity as needed.
  * @related  sfmt sfmt_append svfmt svfmt_append sset
  */
-#define sfmt_append(s, fmt, ...) cf_string_fmt_append(s, fmt, (__VA_ARGS__))
+#define sfmt_append(s, fmt, ...) cf_string_fmt_append(s, fmt, __VA_ARGS__)
 
 /**
  * @function svfmt
@@ -667,10 +670,35 @@ extern "C" {
  * @param    buffer       Pointer to a static memory buffer.
  * @param    buffer_size  The size of `buffer` in bytes.
  * @remarks  Will grow onto the heap if the size becomes too large. Call `sfree` when done.
- * @related  sstatic sisdyna spush sset
+ * @related  sstatic sarena sframe sisdyna spush sset
  */
 #define sstatic(s, buffer, buffer_size) cf_string_static(s, buffer, buffer_size)
 
+/**
+ * @function sarena
+ * @category string
+ * @brief    Creates an empty string with its storage taken from an arena.
+ * @param    s            The string. Should be `NULL`.
+ * @param    arena        The arena to allocate from, see `CF_Arena`.
+ * @param    capacity     The number of characters to make room for, not counting the nul-terminator.
+ * @remarks  Works just like `sstatic` -- the string grows onto the heap if it outgrows `capacity`, so call `sfree` when done, before
+ *           the arena rewinds or resets. Handy for lots of short-lived strings, such as while parsing.
+ * @related  sstatic sarena sframe sfree
+ */
+#define sarena(s, arena, capacity) cf_string_arena(s, arena, capacity)
+
+/**
+ * @function sframe
+ * @category string
+ * @brief    Creates an empty string with its storage taken from the frame allocator.
+ * @param    s            The string. Should be `NULL`.
+ * @param    capacity     The number of characters to make room for, not counting the nul-terminator.
+ * @remarks  Works just like `sstatic` with storage from `cf_frame_alloc`, and stays valid just as long. The string only goes to the heap
+ *           if it outgrows `capacity`, so `sfree` is only needed for strings that might -- call it before the frame memory goes away.
+ * @related  sstatic sarena sframe sfree cf_frame_alloc
+ */
+#define sframe(s, capacity) cf_string_frame(s, capacity)
+
 /**
  * @function sisdyna
  * @category string
@@ -678,7 +706,7 @@ extern "C" {
  * @param    s            The string. Can be `NULL`.
  * @return   Returns true if `s` is a dynamically alloced string from this C string API.
  * @remarks  This can be evaluated at compile time for string literals.
- * @related  sstatic sisdyna spush sset
+ * @related  sstatic sarena sframe sisdyna spush sset
  */
 #define sisdyna(s) cf_string_is_dynamic(s)
 
@@ -786,6 +814,7 @@ CF_API const uint16_t* CF_CALL cf_decode_UTF16(const uint16_t* s, int* codepoint
  *           - You can simply compare pointers for equality, as opposed to comparing the string contents, as long as both strings came from this function.
  *           - You may optionally call `sinuke` to free all resources used by the global string table.
  *           - This function is very fast if the string was already stored previously.
+ *           - Safe to call from any thread. Looking up a string that was already stored never takes a lock.
  * @related  sintern sintern_range sivalid silen sinuke
  */
 #define sintern(s) cf_sintern(s)
@@ -805,6 +834,7 @@ CF_API const uint16_t* CF_CALL cf_decode_UTF16(const uint16_t* s, int* codepoint
  *           - You can simply compare pointers for equality, as opposed to comparing the string contents, as long as both strings came from this function.
  *           - You may optionally call `sinuke` to free all resources used by the global string table.
  *           - This function is very fast if the string was already stored previously.
+ *           - Safe to call from any thread. Looking up a string that was already stored never takes a lock.
  * @related  sintern sintern_range sivalid silen sinuke
  */
 #define sintern_range(start, end) cf_sintern_range(start, end)
@@ -901,6 +931,8 @@ CF_API const uint16_t* CF_CALL cf_decode_UTF16(const uint16_t* s, int* codepoint
 #define cf_string_pop(s) (s = cf_spop(s))
 #define cf_string_pop_n(s, n) (s = cf_spopn(s, n))
 #define cf_string_static(s, buffer, buffer_size) (cf_array_static(s, buffer, buffer_size), cf_array_push(s, 0))
+#define cf_string_arena(s, arena, capacity) (s = cf_sarena(arena, capacity))
+#define cf_string_frame(s, capacity) (s = cf_sframe(capacity))
 #define cf_string_is_dynamic(s) (s && !((#s)[0] == '"') && CF_AHDR(s)->cookie == CF_ACOOKIE)
 #define cf_sinuke() cf_sinuke_intern_table()
 #define cf_string_append_UTF8(s, codepoint) (s = cf_string_append_UTF8_impl(s, codepoint))
@@ -919,6 +951,8 @@ typedef struct cf_intern_t
 } cf_intern_t;
 
 CF_API char* CF_CALL cf_sfit(char* a, int n);
+CF_API char* CF_CALL cf_sarena(CF_Arena* arena, int capacity);
+CF_API char* CF_CALL cf_sframe(int capacity);
 CF_API char* CF_CALL cf_sset(char* a, const char* b);
 CF_API char* CF_CALL cf_sfmt(char* s, const char* fmt, ...);
 CF_API char* CF_CALL cf_sfmt_append(char* s, const char* fmt, ...);
@@ -981,114 +1015,128 @@ CF_INLINE uint64_t constexpr fnv1a(const void* data, int size)
 
 /**
  * General purpose string class.
- * Each string is stored in its own buffer internally.
- * 8 byte stack size.
+ * Short strings (up to 23 characters) are stored inline without touching the heap. Longer strings
+ * move onto the heap into their own buffer. 64 byte stack size.
+ * 
+ * The inline storage is found by offset rather than by pointer, so a String may be memcpy'd around, for example
+ * as the value of a `Map`.
  */
 struct String
 {
-	CF_INLINE String() { }
-	CF_INLINE String(const char* s) { sset(m_str, s); }
-	CF_INLINE String(const char* start, const char* end) { int length = (int)(end - start); sfit(m_str, length); CF_STRNCPY(m_str, start, length); CF_AHDR(m_str)->size = length + 1; }
-	CF_INLINE String(const String& s) { sset(m_str, s); }
-	CF_INLINE String(String&& s) {  m_str = s.m_str; s.m_str = NULL; }
-	CF_INLINE String(int i) { sint(m_str, i); }
-	CF_INLINE String(uint32_t i) { suint(m_str, i); }
-	CF_INLINE String(int64_t uint) { sint(m_str, uint); }
-	CF_INLINE String(uint64_t uint) { suint(m_str, uint); }
-	CF_INLINE String(float f) { sfloat(m_str, f); }
-	CF_INLINE String(double f) { sfloat(m_str, f); }
-	CF_INLINE String(bool b) { sbool(m_str, b); }
+	CF_INLINE String() { s_init(); }
+	CF_INLINE String(const char* s) { s_init(); char* p = s_ptr(); sset(p, s); s_commit(p); }
+	CF_INLINE String(const char* start, const char* end) { s_init(); char* p = s_ptr(); sappend_range(p, start, end); s_commit(p); }
+	CF_INLINE String(const String& s) { s_init(); char* p = s_ptr(); sset(p, s.c_str()); s_commit(p); }
+	CF_INLINE String(String&& s) { s_take(s); }
+	CF_INLINE String(int i) { s_init(); char* p = s_ptr(); sint(p, i); s_commit(p); }
+	CF_INLINE String(uint32_t i) { s_init(); char* p = s_ptr(); suint(p, i); s_commit(p); }
+	CF_INLINE String(int64_t uint) { s_init(); char* p = s_ptr(); sint(p, uint); s_commit(p); }
+	CF_INLINE String(uint64_t uint) { s_init(); char* p = s_ptr(); suint(p, uint); s_commit(p); }
+	CF_INLINE String(float f) { s_init(); char* p = s_ptr(); sfloat(p, f); s_commit(p); }
+	CF_INLINE String(double f) { s_init(); char* p = s_ptr(); sfloat(p, f); s_commit(p); }
+	CF_INLINE String(bool b) { s_init(); char* p = s_ptr(); sbool(p, b); s_commit(p); }
 	CF_INLINE ~String() { sfree(m_str); m_str = NULL; }
 
 	CF_INLINE static String steal_from(char* cute_c_api_string) { CF_ACANARY(cute_c_api_string); String r; r.m_str = cute_c_api_string; return r; }
-	CF_INLINE char* steal() { char* result = m_str; m_str = NULL; return result; }
-	CF_INLINE static String from_hex(uint64_t uint) { String r; shex(r.m_str, uint); return r; }
-
-	CF_INLINE int to_int() const { return stoint(m_str); }
-	CF_INLINE uint64_t to_uint() const { return stouint(m_str); }
-	CF_INLINE float to_float() const { return stofloat(m_str); }
-	CF_INLINE double to_double() const { return stodouble(m_str); }
-	CF_INLINE uint64_t to_hex() const { return stohex(m_str); }
-	CF_INLINE bool to_bool() const { return stobool(m_str); }
-
-	CF_INLINE const char* c_str() const { return m_str; }
-	CF_INLINE char* c_str() { return m_str; }
-	CF_INLINE const char* begin() const { return m_str; }
-	CF_INLINE char* begin() { return m_str; }
-	CF_INLINE const char* end() const { return m_str + scount(m_str); }
-	CF_INLINE char* end() { return m_str + scount(m_str); }
-	CF_INLINE char last() const { return slast(m_str); }
-	CF_INLINE char first() const { return sfirst(m_str); }
-	CF_INLINE operator const char*() const { return m_str; }
-	CF_INLINE operator char*() const { return m_str; }
-
-	CF_INLINE char& operator[](int index) { s_chki(index); return m_str[index]; }
-	CF_INLINE const char& operator[](int index) const { s_chki(index); return m_str[index]; }
-
-	CF_INLINE int len() const { return slen(m_str); }
-	CF_INLINE int capacity() const { return scap(m_str); }
-	CF_INLINE int size() const { return scount(m_str); }
-	CF_INLINE int count() const { return scount(m_str); }
-	CF_INLINE void ensure_capacity(int capacity) { sfit(m_str, capacity); }
-	CF_INLINE void fit(int capacity) { sfit(m_str, capacity); }
-	CF_INLINE void set_len(int len) { sfit(m_str, len + 1); cf_array_len(m_str) = len + 1; m_str[len] = 0; }
-	CF_INLINE bool empty() const { return sempty(m_str); }
-
-	CF_INLINE String& add(char ch) { spush(m_str, ch); return *this; }
-	CF_INLINE String& append(const char* s) { sappend(m_str, s); return *this; }
-	CF_INLINE String& operator+(const char* s) { sappend(m_str, s); return *this; }
-	CF_INLINE String& operator+(int i) { sfmt_append(m_str, "%d", i); return *this; }
-	CF_INLINE String& operator+(uint64_t uint) { sfmt_append(m_str, "%" PRIu64, uint); return *this; }
-	CF_INLINE String& operator+(float f) { sfmt_append(m_str, "%f", f); return *this; }
-	CF_INLINE String& operator+(double f) { sfmt_append(m_str, "%f", f); return *this; }
-	CF_INLINE String& operator+(bool b) { sfmt_append(m_str, "%s", b ? "true" : "false"); return *this; }
-	CF_INLINE String& operator+(v2 v) { sfmt_append(m_str, "{ %f, %f }", v.x, v.y); return *this; }
-	CF_INLINE String& append(const char* start, const char* end) { sappend_range(m_str, start, end); return *this; }
-	CF_INLINE String& append(int codepoint) { sappend_UTF8(m_str, codepoint); return *this; }
-	static CF_INLINE String fmt(const char* fmt, ...) { String result; va_list args; va_start(args, fmt); svfmt(result.m_str, fmt, args); va_end(args); return result; }
-	CF_INLINE String& fmt_append(const char* fmt, ...) { va_list args; va_start(args, fmt); svfmt_append(m_str, fmt, args); va_end(args); return *this; }
-	CF_INLINE String& trim() { strim(m_str); return *this; }
-	CF_INLINE String& ltrim() { sltrim(m_str); return *this; }
-	CF_INLINE String& rtrim() { srtrim(m_str); return *this; }
-	CF_INLINE String& lpad(char pad, int count) { slpad(m_str, pad, count); return *this; }
-	CF_INLINE String& rpad(char pad, int count) { srpad(m_str, pad, count); return *this; }
-	CF_INLINE String& dedup(char ch) { sdedup(m_str, ch); return *this; }
-	CF_INLINE String& set(const char* s) { sset(m_str, s); return *this; }
-	CF_INLINE String& operator=(const char* s) { sset(m_str, s); return *this; }
-	CF_INLINE String& operator=(const String& s) { sset(m_str, s); return *this; }
-	CF_INLINE String& operator=(String&& s) { m_str = s.m_str; s.m_str = NULL; return *this; }
-	CF_INLINE Array<String> split(char split_c) { Array<String> r; char** s = ssplit(m_str, split_c); for (int i=0;i<alen(s);++i) r.add(cf_move(steal_from(s[i]))); afree(s); return r; }
-	static CF_INLINE Array<String> split(const char* split_me, char split_c) { Array<String> r; char** s = ssplit(split_me, split_c); for (int i=0;i<alen(s);++i) r.add(cf_move(steal_from(s[i]))); afree(s); return r; }
-	CF_INLINE char pop() { char result = slast(m_str); spop(m_str); return result; }
-	CF_INLINE char pop(int n) { char result = slast(m_str); spopn(m_str, n); return result; }
-	CF_INLINE char popn(int n) { char result = slast(m_str); spopn(m_str, n); return result; }
-	CF_INLINE int first_index_of(char ch) const { return sfirst_index_of(m_str, ch); }
-	CF_INLINE int last_index_of(char ch) const { return slast_index_of(m_str, ch); }
-	CF_INLINE int first_index_of(char ch, int offset) const { return sfirst_index_of(m_str + offset, ch); }
-	CF_INLINE int last_index_of(char ch, int offset) const { return slast_index_of(m_str + offset, ch); }
-	CF_INLINE int find(const char* find_me) const { const char* ptr = sfind(m_str, find_me); return (int)(ptr ? ptr - m_str : -1); }
-	CF_INLINE String& replace(const char* replace_me, const char* with_me) { sreplace(m_str, replace_me, with_me); return *this; }
-	CF_INLINE String& erase(int index, int count) { serase(m_str, index, count); return *this; }
-	CF_INLINE String dup() const { return steal_from(sdup(m_str)); }
-	CF_INLINE void clear() { sclear(m_str); }
+	CF_INLINE char* steal() { char* result = m_str ? m_str : sdup(s_ptr()); m_str = NULL; s_init(); return result; }
+	CF_INLINE static String from_hex(uint64_t uint) { String r; char* p = r.s_ptr(); shex(p, uint); r.s_commit(p); return r; }
+	CF_INLINE bool is_inline() const { return !m_str; }
+
+	CF_INLINE int to_int() const { return stoint(s_ptr()); }
+	CF_INLINE uint64_t to_uint() const { return stouint(s_ptr()); }
+	CF_INLINE float to_float() const { return stofloat(s_ptr()); }
+	CF_INLINE double to_double() const { return stodouble(s_ptr()); }
+	CF_INLINE uint64_t to_hex() const { return stohex(s_ptr()); }
+	CF_INLINE bool to_bool() const { return stobool(s_ptr()); }
+
+	CF_INLINE const char* c_str() const { return s_ptr(); }
+	CF_INLINE char* c_str() { return s_ptr(); }
+	CF_INLINE const char* begin() const { return s_ptr(); }
+	CF_INLINE char* begin() { return s_ptr(); }
+	CF_INLINE const char* end() const { return s_ptr() + scount(s_ptr()); }
+	CF_INLINE char* end() { return s_ptr() + scount(s_ptr()); }
+	CF_INLINE char last() const { return slast(s_ptr()); }
+	CF_INLINE char first() const { return sfirst(s_ptr()); }
+	CF_INLINE operator const char*() const { return s_ptr(); }
+	CF_INLINE operator char*() const { return s_ptr(); }
+
+	CF_INLINE char& operator[](int index) { s_chki(index); return s_ptr()[index]; }
+	CF_INLINE const char& operator[](int index) const { s_chki(index); return s_ptr()[index]; }
+
+	CF_INLINE int len() const { return slen(s_ptr()); }
+	CF_INLINE int capacity() const { return scap(s_ptr()); }
+	CF_INLINE int size() const { return scount(s_ptr()); }
+	CF_INLINE int count() const { return scount(s_ptr()); }
+	CF_INLINE void ensure_capacity(int capacity) { char* p = s_ptr(); sfit(p, capacity); s_commit(p); }
+	CF_INLINE void fit(int capacity) { char* p = s_ptr(); sfit(p, capacity); s_commit(p); }
+	CF_INLINE void set_len(int len) { char* p = s_ptr(); sfit(p, len + 1); s_commit(p); cf_array_len(p) = len + 1; p[len] = 0; }
+	CF_INLINE bool empty() const { return sempty(s_ptr()); }
+
+	CF_INLINE String& add(char ch) { char* p = s_ptr(); spush(p, ch); s_commit(p); return *this; }
+	CF_INLINE String& append(const char* s) { char* p = s_ptr(); sappend(p, s); s_commit(p); return *this; }
+	CF_INLINE String& operator+(const char* s) { return append(s); }
+	CF_INLINE String& operator+(int i) { return fmt_append("%d", i); }
+	CF_INLINE String& operator+(uint64_t uint) { return fmt_append("%" PRIu64, uint); }
+	CF_INLINE String& operator+(float f) { return fmt_append("%f", f); }
+	CF_INLINE String& operator+(double f) { return fmt_append("%f", f); }
+	CF_INLINE String& operator+(bool b) { return fmt_append("%s", b ? "true" : "false"); }
+	CF_INLINE String& operator+(v2 v) { return fmt_append("{ %f, %f }", v.x, v.y); }
+	CF_INLINE String& append(const char* start, const char* end) { char* p = s_ptr(); sappend_range(p, start, end); s_commit(p); return *this; }
+	CF_INLINE String& append(int codepoint) { char* p = s_ptr(); sappend_UTF8(p, codepoint); s_commit(p); return *this; }
+	static CF_INLINE String fmt(const char* fmt, ...) { String result; char* p = result.s_ptr(); va_list args; va_start(args, fmt); svfmt(p, fmt, args); va_end(args); result.s_commit(p); return result; }
+	CF_INLINE String& fmt_append(const char* fmt, ...) { char* p = s_ptr(); va_list args; va_start(args, fmt); svfmt_append(p, fmt, args); va_end(args); s_commit(p); return *this; }
+	CF_INLINE String& trim() { char* p = s_ptr(); strim(p); s_commit(p); return *this; }
+	CF_INLINE String& ltrim() { char* p = s_ptr(); sltrim(p); s_commit(p); return *this; }
+	CF_INLINE String& rtrim() { char* p = s_ptr(); srtrim(p); s_commit(p); return *this; }
+	CF_INLINE String& lpad(char pad, int count) { char* p = s_ptr(); slpad(p, pad, count); s_commit(p); return *this; }
+	CF_INLINE String& rpad(char pad, int count) { char* p = s_ptr(); srpad(p, pad, count); s_commit(p); return *this; }
+	CF_INLINE String& dedup(char ch) { char* p = s_ptr(); sdedup(p, ch); s_commit(p); return *this; }
+	CF_INLINE String& set(const char* s) { char* p = s_ptr(); if (s) sset(p, s); else sclear(p); s_commit(p); return *this; }
+	CF_INLINE String& operator=(const char* s) { return set(s); }
+	CF_INLINE String& operator=(const String& s) { return set(s.c_str()); }
+	CF_INLINE String& operator=(String&& s) { if (this != &s) { sfree(m_str); s_take(s); } return *this; }
+	CF_INLINE Array<String> split(char split_c) { return split(s_ptr(), split_c); }
+	static CF_INLINE Array<String> split(const char* split_me, char split_c) { Array<String> r; char** s = ssplit(split_me, split_c); for (int i=0;i<acount(s);++i) r.add(cf_move(steal_from(s[i]))); afree(s); return r; }
+	CF_INLINE char pop() { char* p = s_ptr(); char result = slast(p); spop(p); s_commit(p); return result; }
+	CF_INLINE char pop(int n) { return popn(n); }
+	CF_INLINE char popn(int n) { char* p = s_ptr(); char result = slast(p); spopn(p, n); s_commit(p); return result; }
+	CF_INLINE int first_index_of(char ch) const { return sfirst_index_of(s_ptr(), ch); }
+	CF_INLINE int last_index_of(char ch) const { return slast_index_of(s_ptr(), ch); }
+	CF_INLINE int first_index_of(char ch, int offset) const { return sfirst_index_of(s_ptr() + offset, ch); }
+	CF_INLINE int last_index_of(char ch, int offset) const { return slast_index_of(s_ptr() + offset, ch); }
+	CF_INLINE int find(const char* find_me) const { const char* ptr = sfind(s_ptr(), find_me); return (int)(ptr ? ptr - s_ptr() : -1); }
+	CF_INLINE String& replace(const char* replace_me, const char* with_me) { char* p = s_ptr(); sreplace(p, replace_me, with_me); s_commit(p); return *this; }
+	CF_INLINE String& erase(int index, int count) { char* p = s_ptr(); serase(p, index, count); s_commit(p); return *this; }
+	CF_INLINE String dup() const { return String(*this); }
+	CF_INLINE void clear() { char* p = s_ptr(); sclear(p); s_commit(p); }
 	
-	CF_INLINE bool starts_with(const char* s) const { return sprefix(m_str, s); }
-	CF_INLINE bool begins_with(const char* s) const { return sprefix(m_str, s); }
-	CF_INLINE bool ends_with(const char* s) const { return ssuffix(m_str, s); }
-	CF_INLINE bool prefix(const char* s) const { return sprefix(m_str, s); }
-	CF_INLINE bool suffix(const char* s) const { return ssuffix(m_str, s); }
-	CF_INLINE bool operator==(const char* s) { return !CF_STRCMP(m_str, s); }
-	CF_INLINE bool operator!=(const char* s) { return CF_STRCMP(m_str, s); }
-	CF_INLINE bool compare(const char* s, bool no_case = false) { return no_case ? sequ(m_str, s) : siequ(m_str, s); }
+	CF_INLINE bool starts_with(const char* s) const { return sprefix(s_ptr(), s); }
+	CF_INLINE bool begins_with(const char* s) const { return sprefix(s_ptr(), s); }
+	CF_INLINE bool ends_with(const char* s) const { return ssuffix(s_ptr(), s); }
+	CF_INLINE bool prefix(const char* s) const { return sprefix(s_ptr(), s); }
+	CF_INLINE bool suffix(const char* s) const { return ssuffix(s_ptr(), s); }
+	CF_INLINE bool operator==(const char* s) { return !CF_STRCMP(s_ptr(), s); }
+	CF_INLINE bool operator!=(const char* s) { return CF_STRCMP(s_ptr(), s); }
+	CF_INLINE bool compare(const char* s, bool no_case = false) { return no_case ? sequ(s_ptr(), s) : siequ(s_ptr(), s); }
 	CF_INLINE bool cmp(const char* s, bool no_case = false) { return compare(s, no_case); }
-	CF_INLINE bool contains(const char* contains_me) { return scontains(m_str, contains_me); }
-	CF_INLINE String& to_upper() { stoupper(m_str); return *this; }
-	CF_INLINE String& to_lower() { stolower(m_str); return *this; }
-	CF_INLINE uint64_t hash() const { return shash(m_str); }
+	CF_INLINE bool contains(const char* contains_me) { return scontains(s_ptr(), contains_me); }
+	CF_INLINE String& to_upper() { char* p = s_ptr(); stoupper(p); s_commit(p); return *this; }
+	CF_INLINE String& to_lower() { char* p = s_ptr(); stolower(p); s_commit(p); return *this; }
+	CF_INLINE uint64_t hash() const { return shash(s_ptr()); }
 
 private:
+	// Heap storage, or NULL while the string fits in `m_buffer`.
 	char* m_str = NULL;
-	CF_INLINE void s_chki(int i) const { CF_ASSERT(i >= 0 && i < scount(m_str)); }
+	// A static string (see `sstatic`), header included. Sits right after the pointer to keep the header aligned.
+	char m_buffer[56];
+
+	CF_INLINE char* s_inline() const { return (char*)m_buffer + sizeof(CF_Ahdr); }
+	CF_INLINE char* s_ptr() const { return m_str ? m_str : s_inline(); }
+	CF_INLINE void s_init() { char* p; sstatic(p, m_buffer, sizeof(m_buffer)); }
+	// Call after any string macro that may have grown the string onto the heap.
+	CF_INLINE void s_commit(char* p) { if (p != s_inline()) m_str = p; }
+	CF_INLINE void s_take(String& s) { m_str = s.m_str; CF_MEMCPY(m_buffer, s.m_buffer, sizeof(m_buffer)); s.m_str = NULL; s.s_init(); }
+	CF_INLINE void s_chki(int i) const { CF_ASSERT(i >= 0 && i < scount(s_ptr())); }
 };
 
 CF_INLINE String operator+(const String& a, const String& b) { String result = a; result.append(b); return result; }
@@ -1115,7 +1163,7 @@ struct UTF8
 	CF_INLINE UTF8() { }
 	CF_INLINE UTF8(const char* text) { this->text = text; }
 
-	CF_INLINE bool next() { if (*text) { text = cf_decode_UTF8(text, &codepoint); return true; } else return false; }
+	CF_INLINE bool next() { if (*text) { if ((unsigned char)*text < 0x80) codepoint = *text++; else text = cf_decode_UTF8(text, &codepoint); return true; } else return false; }
 
 	int codepoint;
 	const char* text = NULL;
@@ -0,0 +1,168 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_TILEMAP_H
+#define CF_TILEMAP_H
+
+#include "cute_defines.h"
+#include "cute_math.h"
+#include "cute_sprite.h"
+
+//--------------------------------------------------------------------------------------------------
+// C API
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+/**
+ * @struct   CF_Tilemap
+ * @category draw
+ * @brief    An opaque handle for a grid of tiles drawn as baked chunks.
+ * @remarks  Each layer of the map is split into square chunks of tiles. A chunk is baked into a `CF_StaticGeometry` the first time
+ *           it's seen, and `cf_draw_tilemap` only draws chunks overlapping the camera. Changing a tile only rebakes the chunk it's in.
+ *
+ *           Tile (0, 0) sits with its bottom-left corner on the origin, x goes right and y goes up. Use `cf_draw_push` and friends to
+ *           place the map elsewhere.
+ *
+ *           ```cpp
+ *           CF_Tilemap map = cf_make_tilemap(256, 256, cf_v2(16, 16), 0);
+ *           int ground = cf_tilemap_add_layer(map);
+ *           int grass = cf_tilemap_add_tile(map, &grass_sprite);
+ *           for (int y = 0; y < 256; ++y) {
+ *               for (int x = 0; x < 256; ++x) {
+ *                   cf_tilemap_set_tile(map, ground, x, y, grass);
+ *               }
+ *           }
+ *
+ *           // Each frame.
+ *           cf_draw_tilemap(map);
+ *           ```
+ * @related  CF_Tilemap cf_make_tilemap cf_destroy_tilemap cf_tilemap_add_layer cf_tilemap_add_tile cf_tilemap_set_tile cf_draw_tilemap
+ */
+typedef struct CF_Tilemap { uint64_t id; } CF_Tilemap;
+// @end
+
+/**
+ * @function cf_make_tilemap
+ * @category draw
+ * @brief    Returns a new, empty `CF_Tilemap`.
+ * @param    width       The number of tiles across.
+ * @param    height      The number of tiles high.
+ * @param    tile_size   The size of each tile in world units.
+ * @param    chunk_size  The number of tiles across each chunk, or zero for the default of 16. Smaller chunks rebake faster, larger
+ *                       chunks mean fewer draw calls.
+ * @remarks  The map starts out with no layers, see `cf_tilemap_add_layer`.
+ * @related  CF_Tilemap cf_destroy_tilemap cf_tilemap_add_layer cf_draw_tilemap
+ */
+CF_API CF_Tilemap CF_CALL cf_make_tilemap(int width, int height, CF_V2 tile_size, int chunk_size);
+
+/**
+ * @function cf_destroy_tilemap
+ * @category draw
+ * @brief    Destroys a `CF_Tilemap` and all of its baked chunks.
+ * @related  CF_Tilemap cf_make_tilemap
+ */
+CF_API void CF_CALL cf_destroy_tilemap(CF_Tilemap tilemap);
+
+/**
+ * @function cf_tilemap_add_layer
+ * @category draw
+ * @brief    Adds an empty layer on top of all the others, and returns its index.
+ * @param    tilemap    The tilemap.
+ * @remarks  Layers are drawn in the order they were added.
+ * @related  CF_Tilemap cf_tilemap_layer_count cf_tilemap_set_tile
+ */
+CF_API int CF_CALL cf_tilemap_add_layer(CF_Tilemap tilemap);
+
+/**
+ * @function cf_tilemap_layer_count
+ * @category draw
+ * @brief    Returns the number of layers added with `cf_tilemap_add_layer`.
+ * @param    tilemap    The tilemap.
+ * @related  CF_Tilemap cf_tilemap_add_layer
+ */
+CF_API int CF_CALL cf_tilemap_layer_count(CF_Tilemap tilemap);
+
+/**
+ * @function cf_tilemap_add_tile
+ * @category draw
+ * @brief    Adds a kind of tile, and returns its index for `cf_tilemap_set_tile`.
+ * @param    tilemap    The tilemap.
+ * @param    sprite     The sprite drawn for this tile. Its current frame and scale are copied, its transform is ignored.
+ * @remarks  Indices start at one, as zero means an empty tile. Sprites are drawn centered on their tile. Animated sprites are
+ *           baked as whatever frame they were on. Sprites from premade atlases can't be used, same as for `CF_StaticGeometry`.
+ * @related  CF_Tilemap cf_tilemap_set_tile
+ */
+CF_API int CF_CALL cf_tilemap_add_tile(CF_Tilemap tilemap, const CF_Sprite* sprite);
+
+/**
+ * @function cf_tilemap_set_tile
+ * @category draw
+ * @brief    Places a tile on the map.
+ * @param    tilemap    The tilemap.
+ * @param    layer      The layer, from `cf_tilemap_add_layer`.
+ * @param    x          The column, from zero at the left.
+ * @param    y          The row, from zero at the bottom.
+ * @param    tile       The tile, from `cf_tilemap_add_tile`, or zero to clear it.
+ * @remarks  Only the chunk holding this tile is rebaked, the next time it's drawn. Setting a tile to what it already is does nothing.
+ * @related  CF_Tilemap cf_tilemap_get_tile cf_tilemap_add_tile cf_draw_tilemap
+ */
+CF_API void CF_CALL cf_tilemap_set_tile(CF_Tilemap tilemap, int layer, int x, int y, int tile);
+
+/**
+ * @function cf_tilemap_get_tile
+ * @category draw
+ * @brief    Returns the tile at a spot on the map, or zero if it's empty.
+ * @param    tilemap    The tilemap.
+ * @param    layer      The layer, from `cf_tilemap_add_layer`.
+ * @param    x          The column, from zero at the left.
+ * @param    y          The row, from zero at the bottom.
+ * @related  CF_Tilemap cf_tilemap_set_tile
+ */
+CF_API int CF_CALL cf_tilemap_get_tile(CF_Tilemap tilemap, int layer, int x, int y);
+
+/**
+ * @function cf_draw_tilemap
+ * @category draw
+ * @brief    Draws all layers of a tilemap, chunks outside the camera are skipped.
+ * @param    tilemap    The tilemap.
+ * @remarks  Chunks are drawn with `cf_draw_static_geometry`, so the map renders underneath everything else drawn for the same
+ *           `cf_render_to`. Changed chunks are rebaked here, so this can't be called while recording a `CF_DrawList`.
+ * @related  CF_Tilemap cf_tilemap_set_tile cf_draw_static_geometry
+ */
+CF_API void CF_CALL cf_draw_tilemap(CF_Tilemap tilemap);
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+
+//--------------------------------------------------------------------------------------------------
+// C++ API
+
+#ifdef CF_CPP
+
+namespace Cute
+{
+
+using Tilemap = CF_Tilemap;
+
+CF_INLINE Tilemap make_tilemap(int width, int height, v2 tile_size, int chunk_size = 0) { return cf_make_tilemap(width, height, tile_size, chunk_size); }
+CF_INLINE void destroy_tilemap(Tilemap tilemap) { cf_destroy_tilemap(tilemap); }
+CF_INLINE int tilemap_add_layer(Tilemap tilemap) { return cf_tilemap_add_layer(tilemap); }
+CF_INLINE int tilemap_layer_count(Tilemap tilemap) { return cf_tilemap_layer_count(tilemap); }
+CF_INLINE int tilemap_add_tile(Tilemap tilemap, const Sprite* sprite) { return cf_tilemap_add_tile(tilemap, sprite); }
+CF_INLINE int tilemap_add_tile(Tilemap tilemap, const Sprite& sprite) { return cf_tilemap_add_tile(tilemap, &sprite); }
+CF_INLINE void tilemap_set_tile(Tilemap tilemap, int layer, int x, int y, int tile) { cf_tilemap_set_tile(tilemap, layer, x, y, tile); }
+CF_INLINE int tilemap_get_tile(Tilemap tilemap, int layer, int x, int y) { return cf_tilemap_get_tile(tilemap, layer, x, y); }
+CF_INLINE void draw_tilemap(Tilemap tilemap) { cf_draw_tilemap(tilemap); }
+
+}
+
+#endif // CF_CPP
+
+#endif // CF_TILEMAP_H
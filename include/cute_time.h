@@ -148,6 +148,28 @@ CF_API void CF_CALL cf_set_fixed_timestep_max_updates(int max_updates);
  */
 CF_API void CF_CALL cf_set_target_framerate(int frames_per_second);
 
+/**
+ * @function cf_set_low_latency_mode
+ * @category time
+ * @brief    Starts each frame as late as possible while still making the next display refresh, to cut input latency.
+ * @param    true_to_enable  True to turn on low latency mode. Off by default.
+ * @remarks  Only has an effect with vsync on (see `cf_app_set_vsync`). Normally a frame starts right after the previous present,
+ *           then waits in its own present for the display to refresh, so input is already most of a frame old by the time it's
+ *           shown. In low latency mode `cf_update_time` instead sleeps first, based on the refresh rate (or `cf_set_target_framerate`)
+ *           and the slowest recent frame work times from `cf_get_frame_time_stats`, and only then reads input and runs the update.
+ *           Games with erratic frame times may occasionally miss a refresh.
+ * @related  cf_set_low_latency_mode cf_get_low_latency_mode cf_set_target_framerate cf_get_frame_time_stats
+ */
+CF_API void CF_CALL cf_set_low_latency_mode(bool true_to_enable);
+
+/**
+ * @function cf_get_low_latency_mode
+ * @category time
+ * @brief    Returns true if low latency mode is on, see `cf_set_low_latency_mode`.
+ * @related  cf_set_low_latency_mode cf_get_low_latency_mode cf_set_target_framerate cf_get_frame_time_stats
+ */
+CF_API bool CF_CALL cf_get_low_latency_mode();
+
 /**
  * @function cf_set_update_udata
  * @category time
@@ -260,6 +282,48 @@ CF_API uint64_t CF_CALL cf_get_tick_frequency();
  */
 CF_API void CF_CALL cf_sleep(int milliseconds);
 
+/**
+ * @struct   CF_FrameTimeStats
+ * @category time
+ * @brief    Timings over roughly the last 256 frames, in seconds.
+ * @remarks  Percentiles describe frame pacing better than an average does: a steady game has `p99` close to `p50`, while occasional
+ *           hitches show up as a large `p99` or `max`.
+ * @related  CF_FrameTimeStats cf_get_frame_time_stats cf_set_target_framerate cf_set_low_latency_mode
+ */
+typedef struct CF_FrameTimeStats
+{
+	/* @member Average time between frames. */
+	float average;
+
+	/* @member Median time between frames. */
+	float p50;
+
+	/* @member 99th percentile time between frames. */
+	float p99;
+
+	/* @member Longest time between frames. */
+	float max;
+
+	/* @member Median time spent on a frame itself, from the end of `cf_update_time`'s pacing up to presenting in `cf_app_draw_onto_screen`. */
+	float work_p50;
+
+	/* @member 99th percentile of `work_p50`'s time. */
+	float work_p99;
+
+	/* @member Number of frames the stats cover. */
+	int sample_count;
+} CF_FrameTimeStats;
+// @end
+
+/**
+ * @function cf_get_frame_time_stats
+ * @category time
+ * @brief    Returns timing statistics for recent frames.
+ * @remarks  Frame times are recorded by `cf_update_time`, and work times by `cf_app_draw_onto_screen`.
+ * @related  CF_FrameTimeStats cf_get_frame_time_stats cf_set_target_framerate cf_set_low_latency_mode
+ */
+CF_API CF_FrameTimeStats CF_CALL cf_get_frame_time_stats();
+
 /**
  * @struct   CF_Stopwatch
  * @category time
@@ -328,10 +392,13 @@ namespace Cute
 #define DELTA_TIME_INTERPOLANT (CF_DELTA_TIME_INTERPOLANT)
 using OnUpdateFn = CF_OnUpdateFn;
 using Stopwatch = CF_Stopwatch;
+using FrameTimeStats = CF_FrameTimeStats;
 
 CF_INLINE void set_fixed_timestep(int frames_per_second = 60) { cf_set_fixed_timestep(frames_per_second); }
 CF_INLINE void set_fixed_timestep_max_updates(int max_updates = 5) { cf_set_fixed_timestep_max_updates(max_updates); }
 CF_INLINE void set_target_framerate(int frames_per_second = -1) { cf_set_target_framerate(frames_per_second); }
+CF_INLINE void set_low_latency_mode(bool true_to_enable) { cf_set_low_latency_mode(true_to_enable); }
+CF_INLINE bool get_low_latency_mode() { return cf_get_low_latency_mode(); }
 CF_INLINE void update_time(OnUpdateFn* on_update = NULL) { cf_update_time(on_update); }
 CF_INLINE void pause_for(float seconds) { cf_pause_for(seconds); }
 CF_INLINE void pause_for_ticks(uint64_t pause_ticks) { cf_pause_for_ticks(pause_ticks); }
@@ -344,6 +411,7 @@ CF_INLINE bool is_paused() { return cf_is_paused(); }
 CF_INLINE uint64_t get_ticks() { return cf_get_ticks(); }
 CF_INLINE uint64_t get_tick_frequency() { return cf_get_tick_frequency(); }
 CF_INLINE void sleep(int milliseconds) { cf_sleep(milliseconds); }
+CF_INLINE FrameTimeStats get_frame_time_stats() { return cf_get_frame_time_stats(); }
 
 CF_INLINE CF_Stopwatch make_stopwatch() { return cf_make_stopwatch(); }
 CF_INLINE double stopwatch_seconds(CF_Stopwatch stopwatch) { return cf_stopwatch_seconds(stopwatch); }
@@ -28,16 +28,26 @@ struct CF_TypelessArray
 
 	void* add();
 	void* add(const void* item);
+	// Adds `n` elements to the end in one go, returning the first. `items` is optional, to copy in.
+	void* add_n(int n, const void* items = NULL);
 	void* insert(int index);
 	void* insert(int index, const void* item);
 	void set(int index, const void* item);
 	void remove(int index);
+	// Removes the `n` elements starting at `index`, keeping the rest in order.
+	void remove_n(int index, int n);
 	void* pop();
 	void unordered_remove(int index);
+	// Removes the `n` elements starting at `index`, filling the hole with elements from the end.
+	void swap_remove_n(int index, int n);
 	void copy(int src, int dst, int count = 1);
 	void swap(int index_a, int index_b);
 	void clear();
 	void ensure_capacity(int num_elements);
+	// Like `ensure_capacity`, but also aligns the storage to `alignment` bytes (such as 16, 32 or 64), so
+	// elements can be fed straight into SIMD loads. Only the first element is aligned, so keep the element
+	// size a multiple of `alignment` to align them all. Zero keeps the current alignment.
+	void reserve(int num_elements, int alignment = 0);
 	void steal_from(CF_TypelessArray* steal_from_me);
 
 	int capacity() const;
@@ -58,6 +68,7 @@ struct CF_TypelessArray
 	size_t m_element_size = 0;
 	int m_capacity = 0;
 	int m_count = 0;
+	int m_alignment = 0; // Zero for the default allocator alignment.
 	void* m_items = NULL;
 };
 
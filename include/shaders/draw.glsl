@@ -219,6 +219,30 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 
 @vs vs
 @glsl_options flip_vert_y
+	// CF_DRAW_INSTANCED compiles a variant drawing a unit quad once per sprite or shape, everything but
+	// `in_corner` being per-instance, see `CF_QuadInstance`. `in_corner` weighs the quad's corners a, b,
+	// c and d, one of them 1 and the rest 0.
+	// CF_DRAW_PARTICLES compiles a variant drawing every particle of an emitter as an instance of the same
+	// quad. Instances only hold a particle's position and how far along its life it is, everything shared by
+	// the emitter comes from `particle_params`, see `s_draw_particles`.
+#ifdef CF_DRAW_INSTANCED
+	layout (location = 0) in vec4 in_corner;
+	layout (location = 1) in vec4 in_pos_ab;
+	layout (location = 2) in vec4 in_pos_cd;
+	layout (location = 3) in vec4 in_posH_ab;
+	layout (location = 4) in vec4 in_posH_cd;
+	layout (location = 5) in vec4 in_ab;
+	layout (location = 6) in vec2 in_c;
+	layout (location = 7) in vec4 in_uv_rect;
+	layout (location = 8) in vec4 in_col;
+	layout (location = 9) in vec3 in_shape;
+	layout (location = 10) in vec4 in_params;
+	layout (location = 11) in vec4 in_user_params;
+	layout (location = 12) in float in_depth;
+#elif defined(CF_DRAW_PARTICLES)
+	layout (location = 0) in vec4 in_corner;
+	layout (location = 1) in vec3 in_particle;
+#else
 	layout (location = 0) in vec2 in_pos;
 	layout (location = 1) in vec2 in_posH;
 	layout (location = 2) in vec2 in_a;
@@ -231,6 +255,8 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 	layout (location = 9) in float in_aa;
 	layout (location = 10) in vec4 in_params;
 	layout (location = 11) in vec4 in_user_params;
+	layout (location = 12) in float in_depth;
+#endif
 
 	layout (location = 0) out vec2 v_pos;
 	layout (location = 1) out vec2 v_a;
@@ -246,15 +272,87 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 	layout (location = 11) out float v_fill;
 	layout (location = 12) out vec2 v_posH;
 	layout (location = 13) out vec4 v_user;
+#ifdef CF_DRAW_ATLAS_ARRAY
+	layout (location = 14) flat out float v_layer;
+#endif
+
+#ifdef CF_DRAW_PARTICLES
+	layout (binding = 0) uniform particle_params {
+		vec4 u_mvp;         // The camera's 2x2 matrix, x axis in xy and y axis in zw.
+		vec4 u_mvp_p;       // The camera's translation in xy, the layer's depth in z, 1 in w for sprites or 0 for circles.
+		vec4 u_size;        // Half extents per unit of size in xy, then the size at birth and at death.
+		vec4 u_color_start;
+		vec4 u_color_end;
+		vec4 u_tint;
+		vec4 u_uv_rect;     // Atlas rect of the sprite, min in xy and max in zw.
+		vec4 u_user_params;
+		float u_aa;
+		float u_layer;      // Atlas array layer over 255, as `in_params.a` holds it, see CF_DRAW_ATLAS_ARRAY.
+	};
 
+	@include_block blend
+#else
 	layout (binding = 0) uniform vs_params {
 		vec2 u_cam_pos;
 		vec2 u_cam_scale;
 		float u_cam_angle;
 	};
+#endif
 
 	void main()
 	{
+#ifdef CF_DRAW_INSTANCED
+		vec4 w = in_corner;
+		vec2 in_pos = in_pos_ab.xy * w.x + in_pos_ab.zw * w.y + in_pos_cd.xy * w.z + in_pos_cd.zw * w.w;
+		vec2 in_posH = in_posH_ab.xy * w.x + in_posH_ab.zw * w.y + in_posH_cd.xy * w.z + in_posH_cd.zw * w.w;
+		v_pos = in_pos;
+		v_a = in_ab.xy;
+		v_b = in_ab.zw;
+		v_c = in_c;
+		// Corners a and b take the rect's max v, b and c its max u, as laid out by `s_fill_vertices`.
+		v_uv = mix(in_uv_rect.xy, in_uv_rect.zw, vec2(w.y + w.z, w.x + w.y));
+		v_col = in_col;
+		v_radius = in_shape.x;
+		v_stroke = in_shape.y;
+		v_aa = in_shape.z;
+#elif defined(CF_DRAW_PARTICLES)
+		// Sprites are tinted and fade out, circles take on their color overlaid with the tint. The fragment
+		// shader sees them as `VA_TYPE_SPRITE` (0) and `VA_TYPE_SEGMENT` (3).
+		vec2 side = vec2(in_corner.y + in_corner.z, in_corner.x + in_corner.y);
+		float size = mix(u_size.z, u_size.w, in_particle.z);
+		vec4 color = mix(u_color_start, u_color_end, in_particle.z);
+		vec2 he;
+		vec4 col;
+		float type;
+		float alpha;
+		if (u_mvp_p.w > 0.5) {
+			he = u_size.xy * size;
+			col = u_tint;
+			type = 0.0;
+			alpha = color.a;
+		} else {
+			float r = size * 0.5 + u_aa;
+			he = vec2(r, r);
+			col = overlay(color, u_tint);
+			type = 3.0 / 255.0;
+			alpha = 1.0;
+		}
+		vec2 in_pos = in_particle.xy + (side * 2.0 - 1.0) * he;
+		vec2 in_posH = u_mvp.xy * in_pos.x + u_mvp.zw * in_pos.y + u_mvp_p.xy;
+		v_pos = in_pos;
+		v_a = in_particle.xy;
+		v_b = in_particle.xy;
+		v_c = in_particle.xy;
+		// Same corners as CF_DRAW_INSTANCED.
+		v_uv = mix(u_uv_rect.xy, u_uv_rect.zw, side);
+		v_col = vec4(col.rgb * col.a, col.a);
+		v_radius = size * 0.5;
+		v_stroke = 0.0;
+		v_aa = u_aa;
+		vec4 in_params = vec4(type, alpha, 1.0, u_layer);
+		vec4 in_user_params = u_user_params;
+		float in_depth = u_mvp_p.z;
+#else
 		v_pos = in_pos;
 		v_a = in_a;
 		v_b = in_b;
@@ -264,12 +362,16 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 		v_radius = in_radius;
 		v_stroke = in_stroke;
 		v_aa = in_aa;
+#endif
 		v_type = in_params.r;
 		v_alpha = in_params.g;
 		v_fill = in_params.b;
-		// = in_params.a;
+#ifdef CF_DRAW_ATLAS_ARRAY
+		v_layer = in_params.a * 255.0;
+#endif
 
-		vec4 posH = vec4(in_posH, 0, 1);
+		// Depth from the draw layer, only tested while drawing opaque geometry, see `cf_draw_push_opaque`.
+		vec4 posH = vec4(in_posH, in_depth, 1);
 		gl_Position = posH;
 		v_posH = in_posH;
 		v_user = in_user_params;
@@ -294,12 +396,40 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 
 	out vec4 result;
 
+	// CF_DRAW_ATLAS_ARRAY compiles a variant for atlas pages kept as layers of one texture array, the
+	// layer coming in through the spare vertex byte. See `cf_render_settings_atlas_array`.
+#ifdef CF_DRAW_ATLAS_ARRAY
+	layout (location = 14) flat in float v_layer;
+	layout (binding = 0) uniform sampler2DArray u_image;
+	vec4 sample_atlas(vec2 uv) { return texture(u_image, vec3(uv, v_layer)); }
+	vec4 sample_atlas_lod0(vec2 uv) { return textureLod(u_image, vec3(uv, v_layer), 0.0); }
+#else
 	layout (binding = 0) uniform sampler2D u_image;
+	vec4 sample_atlas(vec2 uv) { return texture(u_image, uv); }
+	vec4 sample_atlas_lod0(vec2 uv) { return textureLod(u_image, uv, 0.0); }
+#endif
 
 	layout (binding = 0) uniform fs_params {
 		vec2 u_texture_size;
+#ifdef CF_DRAW_PARTICLES
+		vec4 u_clip; // Clip box in the same space as `v_posH`, see `cf_draw_push_clip_box`.
+#endif
 	};
 
+	// Coverage of a distance field glyph (see `cf_font_set_sdf`), filtered by hand as the atlas is usually
+	// point sampled. The field is 0.5 on the outline and reaches 6 texels past it, see `CF_FONT_SDF_PADDING`.
+	float text_sdf(float texels_per_pixel)
+	{
+		vec2 texel = v_uv * u_texture_size - 0.5;
+		vec2 base = floor(texel);
+		vec2 f = texel - base;
+		vec2 uv0 = (base + 0.5) / u_texture_size;
+		vec2 uv1 = (base + 1.5) / u_texture_size;
+		float d = mix(mix(sample_atlas_lod0(uv0).a, sample_atlas_lod0(vec2(uv1.x, uv0.y)).a, f.x),
+		              mix(sample_atlas_lod0(vec2(uv0.x, uv1.y)).a, sample_atlas_lod0(uv1).a, f.x), f.y);
+		return clamp((d - 128.0/255.0) * (255.0 * 6.0 / 128.0) / texels_per_pixel + 0.5, 0.0, 1.0);
+	}
+
 	@include_block blend
 	@include_block gamma
 	@include_block smooth_uv
@@ -314,15 +444,27 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 		bool is_seg       = v_type >  (2.5/255.0) && v_type < (3.5/255.0);
 		bool is_tri       = v_type >  (3.5/255.0) && v_type < (4.5/255.0);
 		bool is_tri_sdf   = v_type >  (4.5/255.0) && v_type < (5.5/255.0);
+		bool is_text_sdf  = v_type >  (5.5/255.0) && v_type < (6.5/255.0);
 
-		// Traditional sprite/text/tri cases.
+		// CF_DRAW_SPRITES_ONLY and CF_DRAW_SHAPES_ONLY compile specialized variants for batches holding
+		// only sprites/text or only shapes, see `src/shaders/compile.sh`.
 		vec4 c = vec4(0);
-		c = !(is_sprite && is_text) ? de_gamma(texture(u_image, smooth_uv(v_uv, u_texture_size))) : c;
+#ifndef CF_DRAW_SHAPES_ONLY
+		// Texels covered by one pixel, for the edges of distance field glyphs. Derivatives are taken
+		// here, outside of any branch.
+		vec2 texel_pos = v_uv * u_texture_size;
+		float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+
+		// Traditional sprite/text cases.
+		c = !(is_sprite && is_text) ? de_gamma(sample_atlas(smooth_uv(v_uv, u_texture_size))) : c;
 		c = is_sprite ? gamma(overlay(c, v_col)) : c;
 		c = is_text ? v_col * c.a : c;
-		c = is_tri ? v_col : c;
+		if (is_text_sdf) c = v_col * text_sdf(texels_per_pixel);
+#endif
 
-		// SDF cases.
+#ifndef CF_DRAW_SPRITES_ONLY
+		// Tri and SDF cases.
+		c = is_tri ? v_col : c;
 		float d = 0;
 		if (is_box) {
 			d = distance_box(v_pos, v_a, v_b, v_c);
@@ -332,12 +474,17 @@ float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
 		} else if (is_tri_sdf) {
 			d = distance_triangle(v_pos, v_a, v_b, v_c);
 		}
-		c = (!is_sprite && !is_text && !is_tri) ? sdf(c, v_col, d - v_radius) : c;
+		c = (!is_sprite && !is_text && !is_tri && !is_text_sdf) ? sdf(c, v_col, d - v_radius) : c;
+#endif
 
 		c *= v_alpha;
 		vec2 screen_position = (v_posH + vec2(1,1)) * 0.5;
 		c = shader(c, v_pos, v_uv, screen_position, v_user);
 		if (c.a == 0) discard;
+#ifdef CF_DRAW_PARTICLES
+		// Particles are clipped per pixel, as they never go through `s_clip_vertices`.
+		if (any(lessThan(v_posH, u_clip.xy)) || any(greaterThan(v_posH, u_clip.zw))) discard;
+#endif
 		result = c;
 	}
 @end
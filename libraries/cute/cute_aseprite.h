@@ -47,6 +47,7 @@
 		                  ette index, can parse 1.3 files (no tileset support)
 		1.03 (11/27/2023) fixed slice pivot parse bug
   		1.04 (02/20/2024) chunck 0x0004 support
+		1.05 (10/15/2026) optional parallel inflate and blend, see cute_aseprite_load_from_memory_ex
 */
 
 /*
@@ -74,6 +75,21 @@
 			cute_aseprite_free(ase);
 
 
+		Big files spend most of their load time inflating cels and blending frames.
+		Both can be spread across threads by handing in your own parallel-for.
+
+			void my_parallel_for(int count, cute_aseprite_range_fn* fn, void* udata, void* parallel_udata)
+			{
+				// Call fn(begin, end, udata) over ranges covering [0, count) on any
+				// threads you like, and return once they're all done.
+			}
+
+			ase_t* ase = cute_aseprite_load_from_memory_ex(data, size, NULL, my_parallel_for, my_pool);
+
+		The result is identical no matter how the ranges are scheduled. The allocator
+		(see CUTE_ASEPRITE_ALLOC) is called from those threads, so it must be thread-safe.
+
+
 	DATA STRUCTURES
 
 		Aseprite files have frames, layers, and cels. A single frame is one frame of an
@@ -104,6 +120,16 @@ ase_t* cute_aseprite_load_from_file(const char* path, void* mem_ctx);
 ase_t* cute_aseprite_load_from_memory(const void* memory, int size, void* mem_ctx);
 void cute_aseprite_free(ase_t* aseprite);
 
+// Processes the indices [begin, end).
+typedef void (cute_aseprite_range_fn)(int begin, int end, void* udata);
+
+// Calls `fn` over ranges covering [0, count), possibly on other threads, and returns once all of them are done.
+typedef void (cute_aseprite_parallel_for_fn)(int count, cute_aseprite_range_fn* fn, void* udata, void* parallel_udata);
+
+// Same as `cute_aseprite_load_from_memory`, but inflates cels and blends frames through `parallel_for`. Pass NULL
+// for `parallel_for` to do everything on the calling thread.
+ase_t* cute_aseprite_load_from_memory_ex(const void* memory, int size, void* mem_ctx, cute_aseprite_parallel_for_fn* parallel_for, void* parallel_udata);
+
 #define CUTE_ASEPRITE_MAX_LAYERS (64)
 #define CUTE_ASEPRITE_MAX_SLICES (128)
 #define CUTE_ASEPRITE_MAX_PALETTE_ENTRIES (1024)
@@ -739,6 +765,37 @@ typedef struct ase_state_t
 	void* mem_ctx;
 } ase_state_t;
 
+// A compressed cel found while parsing, inflated once the whole file has been parsed.
+typedef struct ase_inflate_job_t
+{
+	ase_cel_t* cel;
+	void* in;
+	int in_bytes;
+	int out_bytes;
+	int ok;
+} ase_inflate_job_t;
+
+typedef struct ase_inflate_jobs_t
+{
+	ase_inflate_job_t* jobs;
+	int count;
+	int capacity;
+	void* mem_ctx;
+} ase_inflate_jobs_t;
+
+static void s_add_inflate_job(ase_inflate_jobs_t* jobs, ase_inflate_job_t job)
+{
+	if (jobs->count == jobs->capacity) {
+		int capacity = jobs->capacity ? jobs->capacity * 2 : 64;
+		ase_inflate_job_t* new_jobs = (ase_inflate_job_t*)CUTE_ASEPRITE_ALLOC((int)sizeof(ase_inflate_job_t) * capacity, jobs->mem_ctx);
+		if (jobs->count) CUTE_ASEPRITE_MEMCPY(new_jobs, jobs->jobs, sizeof(ase_inflate_job_t) * (size_t)jobs->count);
+		CUTE_ASEPRITE_FREE(jobs->jobs, jobs->mem_ctx);
+		jobs->jobs = new_jobs;
+		jobs->capacity = capacity;
+	}
+	jobs->jobs[jobs->count++] = job;
+}
+
 static uint8_t s_read_uint8(ase_state_t* s)
 {
 	CUTE_ASEPRITE_ASSERT(s->in <= s->end + sizeof(uint8_t));
@@ -923,7 +980,80 @@ static ase_color_t s_color(ase_t* ase, void* src, int index)
 	return result;
 }
 
+static void s_inflate_range(int begin, int end, void* udata)
+{
+	ase_inflate_jobs_t* jobs = (ase_inflate_jobs_t*)udata;
+	for (int i = begin; i < end; ++i) {
+		ase_inflate_job_t* job = jobs->jobs + i;
+		job->ok = s_inflate(job->in, job->in_bytes, job->cel->pixels, job->out_bytes, jobs->mem_ctx);
+	}
+}
+
+static void s_blend_range(int begin, int end, void* udata)
+{
+	ase_t* ase = (ase_t*)udata;
+	for (int i = begin; i < end; ++i) {
+		ase_frame_t* frame = ase->frames + i;
+		ase_color_t* dst = frame->pixels;
+		for (int j = 0; j < frame->cel_count; ++j) {
+			ase_cel_t* cel = frame->cels + j;
+			if (!(cel->layer->flags & ASE_LAYER_FLAGS_VISIBLE)) {
+				continue;
+			}
+			if (cel->layer->parent && !(cel->layer->parent->flags & ASE_LAYER_FLAGS_VISIBLE)) {
+				continue;
+			}
+			while (cel->is_linked) {
+				ase_frame_t* frame = ase->frames + cel->linked_frame_index;
+				int found = 0;
+				for (int k = 0; k < frame->cel_count; ++k) {
+					if (frame->cels[k].layer == cel->layer) {
+						cel = frame->cels + k;
+						found = 1;
+						break;
+					}
+				}
+				CUTE_ASEPRITE_ASSERT(found);
+			}
+			void* src = cel->pixels;
+			uint8_t opacity = (uint8_t)(cel->opacity * cel->layer->opacity * 255.0f);
+			int cx = cel->x;
+			int cy = cel->y;
+			int cw = cel->w;
+			int ch = cel->h;
+			int cl = -s_min(cx, 0);
+			int ct = -s_min(cy, 0);
+			int dl = s_max(cx, 0);
+			int dt = s_max(cy, 0);
+			int dr = s_min(ase->w, cw + cx);
+			int db = s_min(ase->h, ch + cy);
+			int aw = ase->w;
+			for (int dx = dl, sx = cl; dx < dr; dx++, sx++) {
+				for (int dy = dt, sy = ct; dy < db; dy++, sy++) {
+					int dst_index = aw * dy + dx;
+					ase_color_t src_color = s_color(ase, src, cw * sy + sx);
+					ase_color_t dst_color = dst[dst_index];
+					ase_color_t result = s_blend(src_color, dst_color, opacity);
+					dst[dst_index] = result;
+				}
+			}
+		}
+	}
+}
+
+static void s_for(cute_aseprite_parallel_for_fn* parallel_for, void* parallel_udata, int count, cute_aseprite_range_fn* fn, void* udata)
+{
+	if (!count) return;
+	if (parallel_for) parallel_for(count, fn, udata, parallel_udata);
+	else fn(0, count, udata);
+}
+
 ase_t* cute_aseprite_load_from_memory(const void* memory, int size, void* mem_ctx)
+{
+	return cute_aseprite_load_from_memory_ex(memory, size, mem_ctx, NULL, NULL);
+}
+
+ase_t* cute_aseprite_load_from_memory_ex(const void* memory, int size, void* mem_ctx, cute_aseprite_parallel_for_fn* parallel_for, void* parallel_udata)
 {
 	ase_t* ase = (ase_t*)CUTE_ASEPRITE_ALLOC(sizeof(ase_t), mem_ctx);
 	CUTE_ASEPRITE_MEMSET(ase, 0, sizeof(*ase));
@@ -970,6 +1100,7 @@ ase_t* cute_aseprite_load_from_memory(const void* memory, int size, void* mem_ct
 	int tag_index = 0;
 
 	ase_layer_t* layer_stack[CUTE_ASEPRITE_MAX_LAYERS];
+	ase_inflate_jobs_t inflate_jobs = { NULL, 0, 0, mem_ctx };
 
 	// Parse all chunks in the .aseprite file.
 	for (int i = 0; i < ase->frame_count; ++i) {
@@ -1076,10 +1207,9 @@ ase_t* cute_aseprite_load_from_memory(const void* memory, int size, void* mem_ct
 					CUTE_ASEPRITE_ASSERT((zlib_byte0 & 0xF0) <= 0x70); // Innapropriate window size detected.
 					CUTE_ASEPRITE_ASSERT(!(zlib_byte1 & 0x20)); // Preset dictionary is present and not supported.
 					int pixels_sz = cel->w * cel->h * bpp;
-					void* pixels_decompressed = CUTE_ASEPRITE_ALLOC(pixels_sz, mem_ctx);
-					int ret = s_inflate(pixels, deflate_bytes, pixels_decompressed, pixels_sz, mem_ctx);
-					if (!ret) CUTE_ASEPRITE_WARNING(s_error_reason);
-					cel->pixels = pixels_decompressed;
+					cel->pixels = CUTE_ASEPRITE_ALLOC(pixels_sz, mem_ctx);
+					ase_inflate_job_t job = { cel, pixels, deflate_bytes, pixels_sz, 0 };
+					s_add_inflate_job(&inflate_jobs, job);
 					s_skip(s, deflate_bytes);
 				}	break;
 				}
@@ -1224,56 +1354,21 @@ ase_t* cute_aseprite_load_from_memory(const void* memory, int size, void* mem_ct
 		}
 	}
 
-	// Blend all cel pixels into each of their respective frames, for convenience.
+	// Inflate every compressed cel. Each job writes only its own cel, so they can run in any order.
+	s_for(parallel_for, parallel_udata, inflate_jobs.count, s_inflate_range, &inflate_jobs);
+	for (int i = 0; i < inflate_jobs.count; ++i) {
+		if (!inflate_jobs.jobs[i].ok) CUTE_ASEPRITE_WARNING(s_error_reason);
+	}
+	CUTE_ASEPRITE_FREE(inflate_jobs.jobs, mem_ctx);
+
+	// Blend all cel pixels into each of their respective frames, for convenience. Each frame only writes
+	// its own pixels, and only reads cels, so frames can be blended in any order.
 	for (int i = 0; i < ase->frame_count; ++i) {
 		ase_frame_t* frame = ase->frames + i;
 		frame->pixels = (ase_color_t*)CUTE_ASEPRITE_ALLOC((int)(sizeof(ase_color_t)) * ase->w * ase->h, mem_ctx);
 		CUTE_ASEPRITE_MEMSET(frame->pixels, 0, sizeof(ase_color_t) * (size_t)ase->w * (size_t)ase->h);
-		ase_color_t* dst = frame->pixels;
-		for (int j = 0; j < frame->cel_count; ++j) {
-			ase_cel_t* cel = frame->cels + j;
-			if (!(cel->layer->flags & ASE_LAYER_FLAGS_VISIBLE)) {
-				continue;
-			}
-			if (cel->layer->parent && !(cel->layer->parent->flags & ASE_LAYER_FLAGS_VISIBLE)) {
-				continue;
-			}
-			while (cel->is_linked) {
-				ase_frame_t* frame = ase->frames + cel->linked_frame_index;
-				int found = 0;
-				for (int k = 0; k < frame->cel_count; ++k) {
-					if (frame->cels[k].layer == cel->layer) {
-						cel = frame->cels + k;
-						found = 1;
-						break;
-					}
-				}
-				CUTE_ASEPRITE_ASSERT(found);
-			}
-			void* src = cel->pixels;
-			uint8_t opacity = (uint8_t)(cel->opacity * cel->layer->opacity * 255.0f);
-			int cx = cel->x;
-			int cy = cel->y;
-			int cw = cel->w;
-			int ch = cel->h;
-			int cl = -s_min(cx, 0);
-			int ct = -s_min(cy, 0);
-			int dl = s_max(cx, 0);
-			int dt = s_max(cy, 0);
-			int dr = s_min(ase->w, cw + cx);
-			int db = s_min(ase->h, ch + cy);
-			int aw = ase->w;
-			for (int dx = dl, sx = cl; dx < dr; dx++, sx++) {
-				for (int dy = dt, sy = ct; dy < db; dy++, sy++) {
-					int dst_index = aw * dy + dx;
-					ase_color_t src_color = s_color(ase, src, cw * sy + sx);
-					ase_color_t dst_color = dst[dst_index];
-					ase_color_t result = s_blend(src_color, dst_color, opacity);
-					dst[dst_index] = result;
-				}
-			}
-		}
 	}
+	s_for(parallel_for, parallel_udata, ase->frame_count, s_blend_range, ase);
 
 	ase->mem_ctx = mem_ctx;
 	return ase;
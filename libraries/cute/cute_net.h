@@ -334,6 +334,55 @@ cn_result_t cn_generate_connect_token(
 	uint8_t* token_ptr_out                            // Pointer to your buffer, should be `CN_CONNECT_TOKEN_SIZE` bytes large.
 );
 
+/**
+ * Everything a batch of connect tokens has in common, prepared once by `cn_connect_token_batch_init`. Tokens
+ * of the batch are then made by `cn_generate_connect_token_from_batch`, which skips parsing the addresses and
+ * hashing the public section again, and touches no global state, so it can run on many threads at once.
+ */
+typedef struct cn_connect_token_batch_t
+{
+	uint64_t application_id;
+	uint64_t creation_timestamp;
+	cn_crypto_sign_secret_t shared_secret_key;
+	uint8_t public_section[568];
+	uint8_t sign_state[64]; // The signature's hash state, with the public section already absorbed.
+} cn_connect_token_batch_t;
+
+/**
+ * The number of random bytes each token of a batch needs, see `cn_generate_connect_token_from_batch`.
+ */
+#define CN_CONNECT_TOKEN_RANDOM_SIZE 52
+
+/**
+ * Prepares a batch of connect tokens. The parameters mean the same as in `cn_generate_connect_token`.
+ */
+cn_result_t cn_connect_token_batch_init(
+	cn_connect_token_batch_t* batch,
+	uint64_t application_id,
+	uint64_t creation_timestamp,
+	uint64_t expiration_timestamp,
+	uint32_t handshake_timeout,
+	int address_count,
+	const char** address_list,
+	const cn_crypto_sign_secret_t* shared_secret_key
+);
+
+/**
+ * Generates one connect token of a batch. Safe to call from many threads at once with the same batch.
+ * `random` must be `CN_CONNECT_TOKEN_RANDOM_SIZE` bytes from `cn_crypto_random_bytes`, never used for
+ * another token. Draw the bytes for a whole batch with one call up front, as `cn_crypto_random_bytes` is
+ * not thread-safe.
+ */
+void cn_generate_connect_token_from_batch(
+	const cn_connect_token_batch_t* batch,
+	const cn_crypto_key_t* client_to_server_key,
+	const cn_crypto_key_t* server_to_client_key,
+	uint64_t client_id,
+	const uint8_t* user_data,
+	const uint8_t* random,
+	uint8_t* token_ptr_out
+);
+
 //--------------------------------------------------------------------------------------------------
 // CLIENT
 
@@ -396,6 +445,18 @@ void cn_client_free_packet(cn_client_t* client, void* packet);
  */
 cn_result_t cn_client_send(cn_client_t* client, const void* packet, int size, bool send_reliably);
 
+/**
+ * Sends a packet reliably and in order, but only in order relative to other packets on the same
+ * `channel`, from 0 to `CN_RELIABLE_CHANNEL_COUNT - 1`. Reliable packets from `cn_client_send` go
+ * on channel 0.
+ * 
+ * Each channel only ever waits on its own lost packets, so a large message on one channel, like a
+ * level or a replay, doesn't hold up small messages on another. Large messages are split up into
+ * fragments, and the channels take turns filling the window of fragments in flight.
+ */
+#define CN_RELIABLE_CHANNEL_COUNT 4
+cn_result_t cn_client_send_on_channel(cn_client_t* client, const void* packet, int size, int channel);
+
 typedef enum cn_client_state_t
 {
 	CN_CLIENT_STATE_CONNECT_TOKEN_EXPIRED         = -6,
@@ -418,6 +479,22 @@ float cn_client_get_rtt_estimate(cn_client_t* client);
 float cn_client_get_incoming_kbps_estimate(cn_client_t* client);
 float cn_client_get_outgoing_kbps_estimate(cn_client_t* client);
 
+typedef struct cn_connection_stats_t
+{
+	float rtt;                      // Smoothed round trip time in milliseconds.
+	float rtt_jitter;               // Smoothed deviation of the round trip time in milliseconds.
+	float packet_loss;              // Estimated fraction of packets lost, from 0 to 1.
+	float incoming_kbps;            // Estimated incoming bandwidth in kilobits per second.
+	float outgoing_kbps;            // Estimated outgoing bandwidth in kilobits per second.
+	int reliable_queue_depth;       // Reliable packets waiting to send, plus fragments sent but not yet acked.
+	int reassembly_bytes;           // Memory held by messages partly received.
+	uint64_t resend_count;          // Total fragments resent after going unacked.
+	uint64_t packets_sent;          // Total packets sent.
+	uint64_t packets_received;      // Total packets received.
+} cn_connection_stats_t;
+
+cn_connection_stats_t cn_client_get_stats(cn_client_t* client);
+
 //--------------------------------------------------------------------------------------------------
 // SERVER
 
@@ -535,6 +612,12 @@ void cn_server_disconnect_client(cn_server_t* server, int client_index, bool not
  *                   packet for every 16 received.
  */
 cn_result_t cn_server_send(cn_server_t* server, const void* packet, int size, int client_index, bool send_reliably);
+
+/**
+ * Sends a packet reliably and in order relative to other packets on the same `channel`. See
+ * `cn_client_send_on_channel` for details.
+ */
+cn_result_t cn_server_send_on_channel(cn_server_t* server, const void* packet, int size, int client_index, int channel);
 bool cn_server_is_client_connected(cn_server_t* server, int client_index);
 
 /**
@@ -559,6 +642,13 @@ float cn_server_get_packet_loss_estimate(cn_server_t* server, int client_index);
 float cn_server_get_rtt_estimate(cn_server_t* server, int client_index);
 float cn_server_get_incoming_kbps_estimate(cn_server_t* server, int client_index);
 float cn_server_get_outgoing_kbps_estimate(cn_server_t* server, int client_index);
+cn_connection_stats_t cn_server_get_stats(cn_server_t* server, int client_index);
+
+//--------------------------------------------------------------------------------------------------
+// SOCKET TOTALS
+
+// Bytes sent and received over every socket since startup, including packet headers.
+void cn_get_socket_byte_totals(uint64_t* sent, uint64_t* received);
 
 //--------------------------------------------------------------------------------------------------
 // ERROR
@@ -3936,8 +4026,9 @@ hydro_sign_challenge(uint8_t       challenge[hydro_sign_CHALLENGEBYTES],
 }
 
 static int
-hydro_sign_prehash(uint8_t csig[hydro_sign_BYTES], const uint8_t prehash[hydro_sign_PREHASHBYTES],
-				   const uint8_t sk[hydro_sign_SECRETKEYBYTES])
+hydro_sign_prehash_random(uint8_t csig[hydro_sign_BYTES], const uint8_t prehash[hydro_sign_PREHASHBYTES],
+						  const uint8_t sk[hydro_sign_SECRETKEYBYTES],
+						  const uint8_t random[hydro_x25519_SECRETKEYBYTES])
 {
 	hydro_hash_state st;
 	uint8_t          challenge[hydro_sign_CHALLENGEBYTES];
@@ -3946,7 +4037,7 @@ hydro_sign_prehash(uint8_t csig[hydro_sign_BYTES], const uint8_t prehash[hydro_s
 	uint8_t *        sig    = &csig[hydro_sign_NONCEBYTES];
 	uint8_t *        eph_sk = sig;
 
-	hydro_random_buf(eph_sk, hydro_x25519_SECRETKEYBYTES);
+	memcpy(eph_sk, random, hydro_x25519_SECRETKEYBYTES);
 	COMPILER_ASSERT(hydro_x25519_SECRETKEYBYTES == hydro_hash_KEYBYTES);
 	hydro_hash_init(&st, (const char *) zero, sk);
 	hydro_hash_update(&st, eph_sk, hydro_x25519_SECRETKEYBYTES);
@@ -3963,6 +4054,17 @@ hydro_sign_prehash(uint8_t csig[hydro_sign_BYTES], const uint8_t prehash[hydro_s
 	return 0;
 }
 
+static int
+hydro_sign_prehash(uint8_t csig[hydro_sign_BYTES], const uint8_t prehash[hydro_sign_PREHASHBYTES],
+				   const uint8_t sk[hydro_sign_SECRETKEYBYTES])
+{
+	uint8_t random[hydro_x25519_SECRETKEYBYTES];
+
+	hydro_random_buf(random, sizeof random);
+
+	return hydro_sign_prehash_random(csig, prehash, sk, random);
+}
+
 static int
 hydro_sign_verify_core(hydro_x25519_fe xs[5], const hydro_x25519_limb_t *other1,
 					   const uint8_t other2[hydro_x25519_BYTES])
@@ -4778,6 +4880,12 @@ int cn_circular_buffer_grow(cn_circular_buffer_t* buffer, int new_size_in_bytes)
 #	include <errno.h>
 #endif
 
+// Linux can move a whole batch of datagrams per syscall. glibc only declares recvmmsg/sendmmsg
+// with _GNU_SOURCE, which C++ compilers define by default.
+#if defined(CN_LINUX) && defined(_GNU_SOURCE) && !defined(CUTE_NET_NO_MMSG)
+#	define CN_SOCKET_MMSG 1
+#endif
+
 static char* s_parse_ipv6_for_port(cn_endpoint_t* endpoint, char* str, int len)
 {
 	if (*str == '[') {
@@ -4925,10 +5033,22 @@ int cn_endpoint_equals(cn_endpoint_t a, cn_endpoint_t b)
 	typedef int cn_socket_cn_handle_t;
 #endif
 
+#define CN_SOCKET_BATCH_MAX 32
+
+typedef struct cn_socket_batch_t
+{
+	int count;
+	cn_endpoint_t endpoints[CN_SOCKET_BATCH_MAX];
+	int sizes[CN_SOCKET_BATCH_MAX];
+	uint8_t data[CN_SOCKET_BATCH_MAX][CN_PROTOCOL_PACKET_SIZE_MAX];
+} cn_socket_batch_t;
+
 typedef struct cn_socket_t
 {
 	cn_socket_cn_handle_t handle;
 	cn_endpoint_t endpoint;
+	// While set, sends are collected here and go out together in `cn_socket_flush`.
+	cn_socket_batch_t* send_batch;
 } cn_socket_t;
 
 void cn_socket_cleanup(cn_socket_t* socket)
@@ -4953,6 +5073,7 @@ static int s_socket_init(cn_socket_t* the_socket, cn_address_type_t address_type
 	int af = AF_INET;
 #endif
 	the_socket->handle = socket(af, SOCK_DGRAM, IPPROTO_UDP);
+	the_socket->send_batch = NULL;
 
 #ifdef CN_WINDOWS
 	if (the_socket->handle == INVALID_SOCKET)
@@ -5152,46 +5273,147 @@ int cn_socket_init2(cn_socket_t* the_socket, const char* address_and_port, int s
 	return 0;
 }
 
-int cn_socket_send_internal(cn_socket_t* socket, cn_endpoint_t send_to, const void* data, int byte_count)
+static int s_endpoint_to_sockaddr(cn_endpoint_t endpoint, struct sockaddr_storage* sockaddr, int* length)
 {
-	cn_endpoint_t endpoint = send_to;
-	CN_ASSERT(data);
-	CN_ASSERT(byte_count >= 0);
-	CN_ASSERT(socket->handle != 0);
-	CN_ASSERT(endpoint.type != CN_ADDRESS_TYPE_NONE);
-
+	CN_MEMSET(sockaddr, 0, sizeof(*sockaddr));
 #ifndef CUTE_NET_NO_IPV6
 	if (endpoint.type == CN_ADDRESS_TYPE_IPV6) {
-		struct sockaddr_in6 socket_address;
-		CN_MEMSET(&socket_address, 0, sizeof(socket_address));
-		socket_address.sin6_family = AF_INET6;
+		struct sockaddr_in6* socket_address = (struct sockaddr_in6*)sockaddr;
+		socket_address->sin6_family = AF_INET6;
 		int i;
 		for (i = 0; i < 8; ++i)
 		{
-			((uint16_t*) &socket_address.sin6_addr) [i] = htons(endpoint.u.ipv6[i]);
+			((uint16_t*) &socket_address->sin6_addr) [i] = htons(endpoint.u.ipv6[i]);
 		}
-		socket_address.sin6_port = htons(endpoint.port);
-		int result = sendto(socket->handle, (const char*)data, byte_count, 0, (struct sockaddr*)&socket_address, sizeof(socket_address));
-		return result;
+		socket_address->sin6_port = htons(endpoint.port);
+		*length = (int)sizeof(struct sockaddr_in6);
+		return 0;
 	}
 	else 
 #endif
 	if (endpoint.type == CN_ADDRESS_TYPE_IPV4) {
-		struct sockaddr_in socket_address;
-		CN_MEMSET(&socket_address, 0, sizeof(socket_address));
-		socket_address.sin_family = AF_INET;
-		socket_address.sin_addr.s_addr = (((uint32_t)endpoint.u.ipv4[0]))        |
-		                                 (((uint32_t)endpoint.u.ipv4[1]) << 8)   |
-		                                 (((uint32_t)endpoint.u.ipv4[2]) << 16)  |
-		                                 (((uint32_t)endpoint.u.ipv4[3]) << 24);
-		socket_address.sin_port = htons(endpoint.port);
-		int result = sendto(socket->handle, (const char*)data, byte_count, 0, (struct sockaddr*)&socket_address, sizeof(socket_address));
-		return result;
+		struct sockaddr_in* socket_address = (struct sockaddr_in*)sockaddr;
+		socket_address->sin_family = AF_INET;
+		socket_address->sin_addr.s_addr = (((uint32_t)endpoint.u.ipv4[0]))        |
+		                                  (((uint32_t)endpoint.u.ipv4[1]) << 8)   |
+		                                  (((uint32_t)endpoint.u.ipv4[2]) << 16)  |
+		                                  (((uint32_t)endpoint.u.ipv4[3]) << 24);
+		socket_address->sin_port = htons(endpoint.port);
+		*length = (int)sizeof(struct sockaddr_in);
+		return 0;
 	}
 
 	return -1;
 }
 
+static int s_sockaddr_to_endpoint(const struct sockaddr_storage* sockaddr, cn_endpoint_t* endpoint)
+{
+	CN_MEMSET(endpoint, 0, sizeof(*endpoint));
+#ifndef CUTE_NET_NO_IPV6
+	if (sockaddr->ss_family == AF_INET6) {
+		const struct sockaddr_in6* addr_ipv6 = (const struct sockaddr_in6*) sockaddr;
+		endpoint->type = CN_ADDRESS_TYPE_IPV6;
+		int i;
+		for (i = 0; i < 8; ++i) {
+			endpoint->u.ipv6[i] = ntohs(((const uint16_t*) &addr_ipv6->sin6_addr) [i]);
+		}
+		endpoint->port = ntohs(addr_ipv6->sin6_port);
+		return 0;
+	}
+	else
+#endif
+	if (sockaddr->ss_family == AF_INET) {
+		const struct sockaddr_in* addr_ipv4 = (const struct sockaddr_in*) sockaddr;
+		endpoint->type = CN_ADDRESS_TYPE_IPV4;
+		endpoint->u.ipv4[0] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0x000000FF));
+		endpoint->u.ipv4[1] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0x0000FF00) >> 8);
+		endpoint->u.ipv4[2] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0x00FF0000) >> 16);
+		endpoint->u.ipv4[3] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0xFF000000) >> 24);
+		endpoint->port = ntohs(addr_ipv4->sin_port);
+		return 0;
+	}
+
+	return -1;
+}
+
+static int s_socket_sendto(cn_socket_t* socket, cn_endpoint_t endpoint, const void* data, int byte_count)
+{
+	struct sockaddr_storage socket_address;
+	int length;
+	if (s_endpoint_to_sockaddr(endpoint, &socket_address, &length)) return -1;
+	return (int)sendto(socket->handle, (const char*)data, byte_count, 0, (struct sockaddr*)&socket_address, length);
+}
+
+int cn_socket_flush(cn_socket_t* socket)
+{
+	cn_socket_batch_t* batch = socket->send_batch;
+	if (!batch || !batch->count) return 0;
+
+#ifdef CN_SOCKET_MMSG
+	struct mmsghdr messages[CN_SOCKET_BATCH_MAX];
+	struct iovec iovecs[CN_SOCKET_BATCH_MAX];
+	struct sockaddr_storage addresses[CN_SOCKET_BATCH_MAX];
+	int count = 0;
+	for (int i = 0; i < batch->count; ++i) {
+		int length;
+		if (s_endpoint_to_sockaddr(batch->endpoints[i], addresses + count, &length)) continue;
+		iovecs[count].iov_base = batch->data[i];
+		iovecs[count].iov_len = (size_t)batch->sizes[i];
+		CN_MEMSET(messages + count, 0, sizeof(messages[count]));
+		messages[count].msg_hdr.msg_name = addresses + count;
+		messages[count].msg_hdr.msg_namelen = (socklen_t)length;
+		messages[count].msg_hdr.msg_iov = iovecs + count;
+		messages[count].msg_hdr.msg_iovlen = 1;
+		++count;
+	}
+	int sent = 0;
+	while (sent < count) {
+		int result = sendmmsg(socket->handle, messages + sent, (unsigned)(count - sent), 0);
+		// UDP is best-effort anyways, so a full send buffer drops the rest just like sendto would.
+		if (result <= 0) break;
+		sent += result;
+	}
+#else
+	for (int i = 0; i < batch->count; ++i) {
+		s_socket_sendto(socket, batch->endpoints[i], batch->data[i], batch->sizes[i]);
+	}
+#endif
+
+	batch->count = 0;
+	return 0;
+}
+
+static uint64_t s_socket_bytes_sent;
+static uint64_t s_socket_bytes_received;
+
+void cn_get_socket_byte_totals(uint64_t* sent, uint64_t* received)
+{
+	*sent = s_socket_bytes_sent;
+	*received = s_socket_bytes_received;
+}
+
+int cn_socket_send_internal(cn_socket_t* socket, cn_endpoint_t send_to, const void* data, int byte_count)
+{
+	cn_endpoint_t endpoint = send_to;
+	CN_ASSERT(data);
+	CN_ASSERT(byte_count >= 0);
+	CN_ASSERT(socket->handle != 0);
+	CN_ASSERT(endpoint.type != CN_ADDRESS_TYPE_NONE);
+	s_socket_bytes_sent += byte_count;
+
+	cn_socket_batch_t* batch = socket->send_batch;
+	if (batch && byte_count <= CN_PROTOCOL_PACKET_SIZE_MAX) {
+		if (batch->count == CN_SOCKET_BATCH_MAX) cn_socket_flush(socket);
+		batch->endpoints[batch->count] = endpoint;
+		batch->sizes[batch->count] = byte_count;
+		CN_MEMCPY(batch->data[batch->count], data, byte_count);
+		batch->count++;
+		return byte_count;
+	}
+
+	return s_socket_sendto(socket, endpoint, data, byte_count);
+}
+
 int cn_socket_receive(cn_socket_t* the_socket, cn_endpoint_t* from, void* data, int byte_count)
 {
 	CN_ASSERT(the_socket);
@@ -5225,27 +5447,7 @@ int cn_socket_receive(cn_socket_t* the_socket, cn_endpoint_t* from, void* data,
 	}
 #endif
 
-#ifndef CUTE_NET_NO_IPV6
-	if (sockaddr_from.ss_family == AF_INET6) {
-		struct sockaddr_in6* addr_ipv6 = (struct sockaddr_in6*) &sockaddr_from;
-		from->type = CN_ADDRESS_TYPE_IPV6;
-		int i;
-		for (i = 0; i < 8; ++i) {
-			from->u.ipv6[i] = ntohs(((uint16_t*) &addr_ipv6->sin6_addr) [i]);
-		}
-		from->port = ntohs(addr_ipv6->sin6_port);
-	}
-	else
-#endif
-	if (sockaddr_from.ss_family == AF_INET) {
-		struct sockaddr_in* addr_ipv4 = (struct sockaddr_in*) &sockaddr_from;
-		from->type = CN_ADDRESS_TYPE_IPV4;
-		from->u.ipv4[0] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0x000000FF));
-		from->u.ipv4[1] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0x0000FF00) >> 8);
-		from->u.ipv4[2] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0x00FF0000) >> 16);
-		from->u.ipv4[3] = (uint8_t)((addr_ipv4->sin_addr.s_addr & 0xFF000000) >> 24);
-		from->port = ntohs(addr_ipv4->sin_port);
-	} else {
+	if (s_sockaddr_to_endpoint(&sockaddr_from, from)) {
 		CN_ASSERT(0);
 		//error_set("The function recvfrom returned an invalid ip format.");
 		return -1;
@@ -5253,9 +5455,54 @@ int cn_socket_receive(cn_socket_t* the_socket, cn_endpoint_t* from, void* data,
 
 	CN_ASSERT(result >= 0);
 	int bytes_read = result;
+	s_socket_bytes_received += bytes_read;
 	return bytes_read;
 }
 
+// Fills `batch` with as many waiting packets as fit. Returns how many, zero when none are waiting, or -1 on error.
+int cn_socket_receive_batch(cn_socket_t* the_socket, cn_socket_batch_t* batch)
+{
+	CN_ASSERT(the_socket);
+	CN_ASSERT(the_socket->handle != 0);
+	batch->count = 0;
+
+#ifdef CN_SOCKET_MMSG
+	struct mmsghdr messages[CN_SOCKET_BATCH_MAX];
+	struct iovec iovecs[CN_SOCKET_BATCH_MAX];
+	struct sockaddr_storage addresses[CN_SOCKET_BATCH_MAX];
+	for (int i = 0; i < CN_SOCKET_BATCH_MAX; ++i) {
+		iovecs[i].iov_base = batch->data[i];
+		iovecs[i].iov_len = CN_PROTOCOL_PACKET_SIZE_MAX;
+		CN_MEMSET(messages + i, 0, sizeof(messages[i]));
+		messages[i].msg_hdr.msg_name = addresses + i;
+		messages[i].msg_hdr.msg_namelen = sizeof(addresses[i]);
+		messages[i].msg_hdr.msg_iov = iovecs + i;
+		messages[i].msg_hdr.msg_iovlen = 1;
+	}
+	int result = recvmmsg(the_socket->handle, messages, CN_SOCKET_BATCH_MAX, MSG_DONTWAIT, NULL);
+	if (result <= 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+		return -1;
+	}
+	for (int i = 0; i < result; ++i) {
+		if (s_sockaddr_to_endpoint(addresses + i, batch->endpoints + batch->count)) continue;
+		batch->sizes[batch->count++] = (int)messages[i].msg_len;
+		s_socket_bytes_received += messages[i].msg_len;
+	}
+#else
+	while (batch->count < CN_SOCKET_BATCH_MAX) {
+		int sz = cn_socket_receive(the_socket, batch->endpoints + batch->count, batch->data[batch->count], CN_PROTOCOL_PACKET_SIZE_MAX);
+		if (sz <= 0) {
+			if (sz < 0 && !batch->count) return -1;
+			break;
+		}
+		batch->sizes[batch->count++] = sz;
+	}
+#endif
+
+	return batch->count;
+}
+
 // -------------------------------------------------------------------------------------------------
 
 typedef struct cn_simulator_t cn_simulator_t;
@@ -5326,6 +5573,9 @@ struct cn_protocol_server_t
 	cn_protocol_replay_buffer_t client_replay_buffer[CN_PROTOCOL_SERVER_MAX_CLIENTS];
 
 	uint8_t buffer[CN_PROTOCOL_PACKET_SIZE_MAX];
+	cn_socket_batch_t receive_batch;
+	int receive_batch_index;
+	cn_socket_batch_t send_batch;
 	void* mem_ctx;
 };
 
@@ -5567,19 +5817,15 @@ int cn_socket_send(cn_socket_t* socket, cn_simulator_t* sim, cn_endpoint_t to, c
 
 // -------------------------------------------------------------------------------------------------
 
-cn_result_t cn_generate_connect_token(
+cn_result_t cn_connect_token_batch_init(
+	cn_connect_token_batch_t* batch,
 	uint64_t application_id,
 	uint64_t creation_timestamp,
-	const cn_crypto_key_t* client_to_server_key,
-	const cn_crypto_key_t* server_to_client_key,
 	uint64_t expiration_timestamp,
 	uint32_t handshake_timeout,
 	int address_count,
 	const char** address_list,
-	uint64_t client_id,
-	const uint8_t* user_data,
-	const cn_crypto_sign_secret_t* shared_secret_key,
-	uint8_t* token_ptr_out
+	const cn_crypto_sign_secret_t* shared_secret_key
 )
 {
 	cn_result_t result = s_cn_init_check();
@@ -5587,18 +5833,15 @@ cn_result_t cn_generate_connect_token(
 
 	CN_ASSERT(address_count >= 1 && address_count <= 32);
 	CN_ASSERT(creation_timestamp < expiration_timestamp);
+	CN_ASSERT(sizeof(hydro_sign_state) <= sizeof(batch->sign_state));
 
-	uint8_t** p = &token_ptr_out;
+	batch->application_id = application_id;
+	batch->creation_timestamp = creation_timestamp;
+	batch->shared_secret_key = *shared_secret_key;
 
-	// Write the REST SECTION.
-	cn_write_bytes(p, CN_PROTOCOL_VERSION_STRING, CN_PROTOCOL_VERSION_STRING_LEN);
-	cn_write_uint64(p, application_id);
-	cn_write_uint64(p, creation_timestamp);
-	cn_write_key(p, client_to_server_key);
-	cn_write_key(p, server_to_client_key);
-
-	// Write the PUBLIC SECTION.
-	uint8_t* public_section = *p;
+	// Write the PUBLIC SECTION, the same for every token.
+	uint8_t* public_section = batch->public_section;
+	uint8_t** p = &public_section;
 	cn_write_uint8(p, 0);
 	cn_write_bytes(p, CN_PROTOCOL_VERSION_STRING, CN_PROTOCOL_VERSION_STRING_LEN);
 	cn_write_uint64(p, application_id);
@@ -5611,14 +5854,41 @@ cn_result_t cn_generate_connect_token(
 		cn_write_endpoint(p, endpoint);
 	}
 
-	int bytes_written = (int)(*p - public_section);
+	int bytes_written = (int)(*p - batch->public_section);
 	CN_ASSERT(bytes_written <= 568);
-	int zeroes = 568 - bytes_written;
-	for (int i = 0; i < zeroes; ++i)
-		cn_write_uint8(p, 0);
+	CN_MEMSET(*p, 0, 568 - bytes_written);
 
-	bytes_written = (int)(*p - public_section);
-	CN_ASSERT(bytes_written == 568);
+	// The signature covers the public section first, so hash it once here.
+	hydro_sign_state sign_state;
+	hydro_sign_init(&sign_state, CN_CRYPTO_CONTEXT);
+	hydro_sign_update(&sign_state, batch->public_section, 568);
+	CN_MEMCPY(batch->sign_state, &sign_state, sizeof(sign_state));
+
+	return cn_error_success();
+}
+
+void cn_generate_connect_token_from_batch(
+	const cn_connect_token_batch_t* batch,
+	const cn_crypto_key_t* client_to_server_key,
+	const cn_crypto_key_t* server_to_client_key,
+	uint64_t client_id,
+	const uint8_t* user_data,
+	const uint8_t* random,
+	uint8_t* token_ptr_out
+)
+{
+	uint8_t** p = &token_ptr_out;
+
+	// Write the REST SECTION.
+	cn_write_bytes(p, CN_PROTOCOL_VERSION_STRING, CN_PROTOCOL_VERSION_STRING_LEN);
+	cn_write_uint64(p, batch->application_id);
+	cn_write_uint64(p, batch->creation_timestamp);
+	cn_write_key(p, client_to_server_key);
+	cn_write_key(p, server_to_client_key);
+
+	// Write the PUBLIC SECTION.
+	uint8_t* public_section = *p;
+	cn_write_bytes(p, batch->public_section, 568);
 
 	// Write the SECRET SECTION.
 	uint8_t* secret_section = *p;
@@ -5635,18 +5905,49 @@ cn_result_t cn_generate_connect_token(
 	*p += CN_PROTOCOL_CONNECT_TOKEN_USER_DATA_SIZE;
 
 	// Encrypt the SECRET SECTION.
-	cn_crypto_encrypt((const cn_crypto_key_t*)shared_secret_key, secret_section, CN_PROTOCOL_CONNECT_TOKEN_SECRET_SECTION_SIZE - CN_CRYPTO_HEADER_BYTES, 0);
+	CN_ASSERT(CN_CONNECT_TOKEN_RANDOM_SIZE == hydro_secretbox_IVBYTES + hydro_x25519_SECRETKEYBYTES);
+	hydro_secretbox_encrypt_iv(secret_section, secret_section, CN_PROTOCOL_CONNECT_TOKEN_SECRET_SECTION_SIZE - CN_CRYPTO_HEADER_BYTES, 0, CN_CRYPTO_CONTEXT, batch->shared_secret_key.key, random);
 	*p += CN_CRYPTO_HEADER_BYTES;
 
-	// Compute the signature.
+	// Compute the signature, continuing the hash of the public section.
+	hydro_sign_state sign_state;
+	CN_MEMCPY(&sign_state, batch->sign_state, sizeof(sign_state));
+	hydro_sign_update(&sign_state, secret_section, 1024 - CN_PROTOCOL_SIGNATURE_SIZE - 568);
+	uint8_t prehash[hydro_sign_PREHASHBYTES];
+	hydro_hash_final(&sign_state.hash_st, prehash, sizeof prehash);
 	cn_crypto_signature_t signature;
-	cn_crypto_sign_create(shared_secret_key, &signature, public_section, 1024 - CN_PROTOCOL_SIGNATURE_SIZE);
+	hydro_sign_prehash_random(signature.bytes, prehash, batch->shared_secret_key.key, random + hydro_secretbox_IVBYTES);
 
 	// Write the signature.
 	CN_MEMCPY(*p, signature.bytes, sizeof(signature));
 	*p += sizeof(signature);
-	bytes_written = (int)(*p - public_section);
+	int bytes_written = (int)(*p - public_section);
 	CN_ASSERT(bytes_written == CN_PROTOCOL_CONNECT_TOKEN_PACKET_SIZE);
+	(void)bytes_written;
+}
+
+cn_result_t cn_generate_connect_token(
+	uint64_t application_id,
+	uint64_t creation_timestamp,
+	const cn_crypto_key_t* client_to_server_key,
+	const cn_crypto_key_t* server_to_client_key,
+	uint64_t expiration_timestamp,
+	uint32_t handshake_timeout,
+	int address_count,
+	const char** address_list,
+	uint64_t client_id,
+	const uint8_t* user_data,
+	const cn_crypto_sign_secret_t* shared_secret_key,
+	uint8_t* token_ptr_out
+)
+{
+	cn_connect_token_batch_t batch;
+	cn_result_t result = cn_connect_token_batch_init(&batch, application_id, creation_timestamp, expiration_timestamp, handshake_timeout, address_count, address_list, shared_secret_key);
+	if (cn_is_error(result)) return result;
+
+	uint8_t random[CN_CONNECT_TOKEN_RANDOM_SIZE];
+	cn_crypto_random_bytes(random, sizeof(random));
+	cn_generate_connect_token_from_batch(&batch, client_to_server_key, server_to_client_key, client_id, user_data, random, token_ptr_out);
 
 	return cn_error_success();
 }
@@ -5716,6 +6017,7 @@ cn_memory_pool_t* cn_memory_pool_create(int element_size, int element_count, voi
 	pool->arena = (uint8_t*)(pool + 1);
 	pool->free_list = pool->arena;
 	pool->overflow_count = 0;
+	pool->mem_ctx = user_allocator_context;
 
 	for (int i = 0; i < element_count - 1; ++i)
 	{
@@ -5762,10 +6064,14 @@ void* cn_memory_pool_alloc(cn_memory_pool_t* pool)
 	return mem;
 }
 
+CN_INLINE int cn_memory_pool_owns(cn_memory_pool_t* pool, const void* element)
+{
+	return (const uint8_t*)element >= pool->arena && (const uint8_t*)element < pool->arena + pool->arena_size;
+}
+
 void cn_memory_pool_free(cn_memory_pool_t* pool, void* element)
 {
-	int difference = (int)((uint8_t*)element - pool->arena);
-	int in_bounds = difference < pool->arena_size;
+	int in_bounds = cn_memory_pool_owns(pool, element);
 	if (pool->overflow_count && !in_bounds) {
 		CN_FREE(element, pool->mem_ctx);
 		pool->overflow_count--;
@@ -7331,13 +7637,21 @@ static void s_protocol_server_connect_client(cn_protocol_server_t* server, cn_en
 
 static void s_protocol_server_receive_packets(cn_protocol_server_t* server)
 {
-	uint8_t* buffer = server->buffer;
+	cn_socket_batch_t* batch = &server->receive_batch;
+	batch->count = 0;
+	server->receive_batch_index = 0;
 
 	while (1)
 	{
-		cn_endpoint_t from;
-		int sz = cn_socket_receive(&server->socket, &from, buffer, CN_PROTOCOL_PACKET_SIZE_MAX);
-		if (!sz) break;
+		// Packets come off the socket a batch at a time, then are handled one by one.
+		if (server->receive_batch_index == batch->count) {
+			server->receive_batch_index = 0;
+			if (cn_socket_receive_batch(&server->socket, batch) <= 0) break;
+		}
+		int batch_index = server->receive_batch_index++;
+		cn_endpoint_t from = batch->endpoints[batch_index];
+		uint8_t* buffer = batch->data[batch_index];
+		int sz = batch->sizes[batch_index];
 
 		if (sz < 73) {
 			continue;
@@ -7754,6 +8068,7 @@ typedef struct cn_ack_system_t
 	cn_sequence_buffer_t received_packets;
 
 	double rtt;
+	double rtt_jitter;
 	double packet_loss;
 	double outgoing_bandwidth_kbps;
 	double incoming_bandwidth_kbps;
@@ -8016,12 +8331,15 @@ static int s_send_queue_peek(cn_socket_send_queue_t* q, cn_socket_send_queue_ite
 	}
 }
 
-static void s_send_queue_shutdown(cn_socket_send_queue_t* q, void* mem_ctx)
+struct cn_transport_t;
+static void s_transport_free(struct cn_transport_t* transport, void* mem);
+
+static void s_send_queue_shutdown(cn_socket_send_queue_t* q, struct cn_transport_t* transport)
 {
 	while (q->count--) {
 		int next_index = (q->index0 + 1) % CN_TRANSPORT_SEND_QUEUE_MAX_ENTRIES;
 		cn_socket_send_queue_item_t* item = q->items + next_index;
-		CN_FREE(item->packet, mem_ctx);
+		s_transport_free(transport, item->packet);
 		q->index0 = next_index;
 	}
 }
@@ -8046,6 +8364,7 @@ typedef struct cn_fragment_reassembly_entry_t
 	int fragment_count_so_far;
 	int fragments_total;
 	uint8_t* fragment_received;
+	int reserved_bytes;
 } cn_fragment_reassembly_entry_t;
 
 typedef struct cn_packet_assembly_t
@@ -8056,14 +8375,7 @@ typedef struct cn_packet_assembly_t
 	cn_packet_queue_t packets_received;
 } cn_packet_assembly_t;
 
-static void s_fragment_reassembly_entry_cleanup(void* data, uint16_t sequence, void* udata, void* mem_ctx)
-{
-	cn_fragment_reassembly_entry_t* reassembly = (cn_fragment_reassembly_entry_t*)data;
-	CN_FREE(reassembly->packet, mem_ctx);
-	CN_FREE(reassembly->fragment_received, mem_ctx);
-}
-
-static int s_packet_assembly_init(cn_packet_assembly_t* assembly, int max_fragments_in_flight, void* mem_ctx)
+static int s_packet_assembly_init(cn_packet_assembly_t* assembly, int max_fragments_in_flight, struct cn_transport_t* transport, void* mem_ctx)
 {
 	int ret = 0;
 	int reassembly_init = 0;
@@ -8071,7 +8383,7 @@ static int s_packet_assembly_init(cn_packet_assembly_t* assembly, int max_fragme
 	assembly->send_sequence = 0;
 	assembly->receive_sequence = 0;
 
-	CN_CHECK(cn_sequence_buffer_init(&assembly->fragments_received, max_fragments_in_flight, sizeof(cn_fragment_reassembly_entry_t), NULL, mem_ctx));
+	CN_CHECK(cn_sequence_buffer_init(&assembly->fragments_received, max_fragments_in_flight, sizeof(cn_fragment_reassembly_entry_t), transport, mem_ctx));
 	reassembly_init = 1;
 	cn_packet_queue_init(&assembly->packets_received);
 
@@ -8082,11 +8394,6 @@ static int s_packet_assembly_init(cn_packet_assembly_t* assembly, int max_fragme
 	return ret;
 }
 
-static void s_packet_assembly_cleanup(cn_packet_assembly_t* assembly)
-{
-	cn_sequence_buffer_cleanup(&assembly->fragments_received, s_fragment_reassembly_entry_cleanup);
-}
-
 // -------------------------------------------------------------------------------------------------
 
 typedef struct cn_transport_t
@@ -8096,8 +8403,12 @@ typedef struct cn_transport_t
 	int max_packet_size;
 	int max_fragments_in_flight;
 	int max_size_single_send;
+	int max_reassembly_bytes;
+	int reassembly_bytes;
+	int send_receive_queue_size;
 
-	cn_socket_send_queue_t send_queue;
+	cn_socket_send_queue_t send_queues[CN_RELIABLE_CHANNEL_COUNT];
+	int next_send_channel;
 
 	int fragments_count;
 	int fragments_capacity;
@@ -8105,23 +8416,71 @@ typedef struct cn_transport_t
 	cn_ack_system_t* ack_system;
 	cn_sequence_buffer_t sent_fragments;
 	uint64_t fragment_id_gen;
+	uint64_t resend_count;
 	uint16_t oldest_received_sequence;
-	cn_packet_assembly_t reliable_and_in_order_assembly;
+	cn_packet_assembly_t reliable_assemblies[CN_RELIABLE_CHANNEL_COUNT];
 	cn_packet_assembly_t fire_and_forget_assembly;
 
 	void* mem_ctx;
 	void* udata;
+	cn_memory_pool_t* packet_pool;
 
 	uint8_t fire_and_forget_buffer[CN_TRANSPORT_MAX_FRAGMENT_SIZE + CN_TRANSPORT_HEADER_SIZE];
 } cn_transport_t;
 
+// Anything up to a single fragment comes out of the shared packet pool, so the usual small packet
+// never touches the heap. Bigger packets, or an exhausted pool, fall back to CN_ALLOC.
+static void* s_transport_alloc(cn_transport_t* transport, int size)
+{
+	if (transport->packet_pool && size <= transport->packet_pool->element_size) {
+		void* mem = cn_memory_pool_try_alloc(transport->packet_pool);
+		if (mem) return mem;
+	}
+	return CN_ALLOC(size, transport->mem_ctx);
+}
+
+static void s_transport_free(cn_transport_t* transport, void* mem)
+{
+	if (!mem) return;
+	if (transport->packet_pool && cn_memory_pool_owns(transport->packet_pool, mem)) {
+		cn_memory_pool_free(transport->packet_pool, mem);
+	} else {
+		CN_FREE(mem, transport->mem_ctx);
+	}
+}
+
+static void s_fragment_reassembly_entry_cleanup(void* data, uint16_t sequence, void* udata, void* mem_ctx)
+{
+	cn_fragment_reassembly_entry_t* reassembly = (cn_fragment_reassembly_entry_t*)data;
+	cn_transport_t* transport = (cn_transport_t*)udata;
+	s_transport_free(transport, reassembly->packet);
+	s_transport_free(transport, reassembly->fragment_received);
+	transport->reassembly_bytes -= reassembly->reserved_bytes;
+}
+
+static void s_packet_assembly_cleanup(cn_packet_assembly_t* assembly)
+{
+	cn_sequence_buffer_cleanup(&assembly->fragments_received, s_fragment_reassembly_entry_cleanup);
+}
+
+// Channels past the first are set up on first use, since most connections never touch them.
+static cn_packet_assembly_t* s_transport_channel(cn_transport_t* transport, int channel)
+{
+	cn_packet_assembly_t* assembly = transport->reliable_assemblies + channel;
+	if (!assembly->fragments_received.capacity) {
+		if (s_packet_assembly_init(assembly, transport->send_receive_queue_size, transport, transport->mem_ctx)) return NULL;
+	}
+	return assembly;
+}
+
 // -------------------------------------------------------------------------------------------------
 
+// Shares its leading members with cn_received_packet_t, so bandwidth can be measured over either.
 typedef struct cn_sent_packet_t
 {
 	double timestamp;
-	int acked;
 	int size;
+	int acked;
 } cn_sent_packet_t;
 
 typedef struct cn_received_packet_t
@@ -8160,6 +8519,7 @@ cn_ack_system_t* cn_ack_system_create(cn_ack_system_config_t config)
 	received_packets_init = 1;
 
 	ack_system->rtt = 0;
+	ack_system->rtt_jitter = 0;
 	ack_system->packet_loss = 0;
 	ack_system->outgoing_bandwidth_kbps = 0;
 	ack_system->incoming_bandwidth_kbps = 0;
@@ -8198,6 +8558,7 @@ void cn_ack_system_reset(cn_ack_system_t* ack_system)
 	cn_sequence_buffer_reset(&ack_system->received_packets, NULL);
 
 	ack_system->rtt = 0;
+	ack_system->rtt_jitter = 0;
 	ack_system->packet_loss = 0;
 	ack_system->outgoing_bandwidth_kbps = 0;
 	ack_system->incoming_bandwidth_kbps = 0;
@@ -8312,9 +8673,16 @@ cn_result_t cn_ack_system_receive_packet(cn_ack_system_t* ack_system, void* data
 				ack_system->counters[CN_ACK_SYSTEM_COUNTERS_PACKETS_ACKED]++;
 				sent_packet->acked = 1;
 
-				float rtt = (float)(ack_system->time - sent_packet->timestamp) * 1000.0f;
-				if (ack_system->rtt == 0.0f && rtt > 0.0f) ack_system->rtt = rtt;
-				else ack_system->rtt += (rtt - ack_system->rtt) * 0.001f;
+				// Smoothed as in TCP's retransmission timer (RFC 6298), so a few samples are enough to converge.
+				double rtt = (ack_system->time - sent_packet->timestamp) * 1000.0;
+				if (ack_system->rtt == 0 && rtt > 0) {
+					ack_system->rtt = rtt;
+					ack_system->rtt_jitter = rtt / 2;
+				} else {
+					double deviation = rtt - ack_system->rtt;
+					ack_system->rtt_jitter += ((deviation < 0 ? -deviation : deviation) - ack_system->rtt_jitter) * 0.25;
+					ack_system->rtt += deviation * 0.125;
+				}
 				CN_ASSERT(ack_system->rtt >= 0);
 			}
 		}
@@ -8372,7 +8740,7 @@ CN_INLINE double s_calc_bandwidth(double bandwidth, cn_sequence_buffer_t* packet
 
 	for (int i = 0; i < num_samples; ++i) {
 		uint16_t sequence = (uint16_t)(base_sequence + i);
-		cn_sent_packet_t* packet = (cn_sent_packet_t*)cn_sequence_buffer_find(packets, sequence);
+		cn_received_packet_t* packet = (cn_received_packet_t*)cn_sequence_buffer_find(packets, sequence);
 		if (packet) {
 			bytes_sent += packet->size;
 			if (packet->timestamp < start_timestamp) start_timestamp = packet->timestamp;
@@ -8396,8 +8764,8 @@ void cn_ack_system_update(cn_ack_system_t* ack_system, double dt)
 {
 	ack_system->time += dt;
 	ack_system->packet_loss = s_calc_packet_loss(ack_system->packet_loss, &ack_system->sent_packets);
-	ack_system->incoming_bandwidth_kbps = s_calc_bandwidth(ack_system->incoming_bandwidth_kbps, &ack_system->sent_packets);
-	ack_system->outgoing_bandwidth_kbps = s_calc_bandwidth(ack_system->outgoing_bandwidth_kbps, &ack_system->received_packets);
+	ack_system->incoming_bandwidth_kbps = s_calc_bandwidth(ack_system->incoming_bandwidth_kbps, &ack_system->received_packets);
+	ack_system->outgoing_bandwidth_kbps = s_calc_bandwidth(ack_system->outgoing_bandwidth_kbps, &ack_system->sent_packets);
 }
 
 double cn_ack_system_rtt(cn_ack_system_t* ack_system)
@@ -8437,10 +8805,18 @@ typedef struct cn_transport_config_t
 	int max_size_single_send;
 	int send_receive_queue_size;
 	void* user_allocator_context;
+
+	// Caps the memory held by messages partly received. Fragments of a new message that won't fit are refused, and sent
+	// again by the other end later. The next message each reliable channel is waiting on is always let through, so it
+	// can't stall, making the true worst case this plus `CN_RELIABLE_CHANNEL_COUNT * max_size_single_send`.
+	int max_reassembly_bytes;
 	void* udata;
 
 	int index;
 	cn_result_t (*send_packet_fn)(int client_index, void* packet, int size, void* udata);
+
+	// Optional, and may be shared by many transports. Must outlive the transport and any packets it handed out.
+	cn_memory_pool_t* packet_pool;
 } cn_transport_config_t;
 
 CN_INLINE cn_transport_config_t cn_transport_config_defaults()
@@ -8453,9 +8829,11 @@ CN_INLINE cn_transport_config_t cn_transport_config_defaults()
 	config.max_fragments_in_flight = 32;
 	config.max_size_single_send = (CN_MB) * 20;
 	config.send_receive_queue_size = 1024;
+	config.max_reassembly_bytes = (CN_MB) * 4;
 	config.udata = NULL;
 	config.index = -1;
 	config.send_packet_fn = NULL;
+	config.packet_pool = NULL;
 	return config;
 }
 
@@ -8476,7 +8854,11 @@ cn_transport_t* cn_transport_create(cn_transport_config_t config)
 	transport->max_packet_size = config.max_packet_size;
 	transport->max_fragments_in_flight = config.max_fragments_in_flight;
 	transport->max_size_single_send = config.max_size_single_send;
+	transport->max_reassembly_bytes = config.max_reassembly_bytes;
+	transport->reassembly_bytes = 0;
+	transport->send_receive_queue_size = config.send_receive_queue_size;
 	transport->udata = config.udata;
+	transport->packet_pool = config.packet_pool;
 
 	transport->fragments_capacity = 256;
 	transport->fragments_count = 0;
@@ -8493,17 +8875,22 @@ cn_transport_t* cn_transport_create(cn_transport_config_t config)
 	sequence_sent_fragments_init = 1;
 
 	transport->fragment_id_gen = 0;
+	transport->resend_count = 0;
 	transport->oldest_received_sequence = 0;
-	CN_CHECK(s_packet_assembly_init(&transport->reliable_and_in_order_assembly, config.send_receive_queue_size, transport->mem_ctx));
+	CN_MEMSET(transport->reliable_assemblies, 0, sizeof(transport->reliable_assemblies));
+	CN_CHECK(s_packet_assembly_init(transport->reliable_assemblies, config.send_receive_queue_size, transport, transport->mem_ctx));
 	assembly_reliable_init = 1;
-	CN_CHECK(s_packet_assembly_init(&transport->fire_and_forget_assembly, config.send_receive_queue_size, transport->mem_ctx));
+	CN_CHECK(s_packet_assembly_init(&transport->fire_and_forget_assembly, config.send_receive_queue_size, transport, transport->mem_ctx));
 	assembly_unreliable_init = 1;
 
-	s_send_queue_init(&transport->send_queue);
+	for (int i = 0; i < CN_RELIABLE_CHANNEL_COUNT; ++i) {
+		s_send_queue_init(transport->send_queues + i);
+	}
+	transport->next_send_channel = 0;
 
 	if (ret) {
 		if (sequence_sent_fragments_init) cn_sequence_buffer_cleanup(&transport->sent_fragments, NULL);
-		if (assembly_reliable_init) s_packet_assembly_cleanup(&transport->reliable_and_in_order_assembly);
+		if (assembly_reliable_init) s_packet_assembly_cleanup(transport->reliable_assemblies);
 		if (assembly_unreliable_init) s_packet_assembly_cleanup(&transport->fire_and_forget_assembly);
 		CN_FREE(transport, config.user_allocator_context);
 	}
@@ -8516,7 +8903,7 @@ static void s_transport_cleanup_packet_queue(cn_transport_t* transport, cn_packe
 	int index = q->index0;
 	while (q->count--) {
 		int next_index = index + 1 % CN_PACKET_QUEUE_MAX_ENTRIES;
-		CN_FREE(q->packets[index], transport->mem_ctx);
+		s_transport_free(transport, q->packets[index]);
 		index = next_index;
 	}
 }
@@ -8526,18 +8913,24 @@ void cn_transport_destroy(cn_transport_t* transport)
 	if (!transport) return;
 	void* mem_ctx = transport->mem_ctx;
 
-	s_transport_cleanup_packet_queue(transport, &transport->reliable_and_in_order_assembly.packets_received);
+	for (int i = 0; i < CN_RELIABLE_CHANNEL_COUNT; ++i) {
+		cn_packet_assembly_t* assembly = transport->reliable_assemblies + i;
+		if (!assembly->fragments_received.capacity) continue;
+		s_transport_cleanup_packet_queue(transport, &assembly->packets_received);
+		s_packet_assembly_cleanup(assembly);
+	}
 	s_transport_cleanup_packet_queue(transport, &transport->fire_and_forget_assembly.packets_received);
 
 	cn_sequence_buffer_cleanup(&transport->sent_fragments, NULL);
-	s_packet_assembly_cleanup(&transport->reliable_and_in_order_assembly);
 	s_packet_assembly_cleanup(&transport->fire_and_forget_assembly);
 	for (int i = 0; i < transport->fragments_count; ++i) {
 		cn_fragment_t* fragment = transport->fragments + i;
-		CN_FREE(fragment->data, mem_ctx);
+		s_transport_free(transport, fragment->data);
 	}
 	CN_FREE(transport->fragments, mem_ctx);
-	s_send_queue_shutdown(&transport->send_queue, transport->mem_ctx);
+	for (int i = 0; i < CN_RELIABLE_CHANNEL_COUNT; ++i) {
+		s_send_queue_shutdown(transport->send_queues + i, transport);
+	}
 	cn_ack_system_destroy(transport->ack_system);
 	CN_FREE(transport, mem_ctx);
 }
@@ -8554,6 +8947,61 @@ CN_INLINE int s_transport_write_header(uint8_t* buffer, int size, uint8_t prefix
 	return (int)(buffer - buffer_start);
 }
 
+// Sends the next fragment of `item`, the front of a channel's send queue, and pops it once all of its fragments are out.
+static cn_result_t s_transport_send_fragment(cn_transport_t* transport, int channel, cn_socket_send_queue_item_t* item)
+{
+	int fragment_size = transport->fragment_size;
+	uint16_t fragment_header_index = (uint16_t)item->fragment_index;
+	int this_fragment_size = fragment_header_index != item->fragment_count - 1 ? fragment_size : item->final_fragment_size;
+	uint8_t* fragment_src = item->packet + item->fragment_index * fragment_size;
+	CN_ASSERT(this_fragment_size <= CN_ACK_SYSTEM_MAX_PACKET_SIZE);
+	CN_ASSERT(this_fragment_size > 0);
+
+	// Allocate fragment.
+	CN_CHECK_BUFFER_GROW(transport, fragments_count, fragments_capacity, fragments, cn_fragment_t);
+	cn_fragment_t* fragment = transport->fragments + transport->fragments_count++;
+
+	fragment->id = transport->fragment_id_gen++;
+	fragment->index = fragment_header_index;
+	fragment->timestamp = transport->ack_system->time;
+	fragment->data = (uint8_t*)s_transport_alloc(transport, fragment_size + CN_TRANSPORT_HEADER_SIZE);
+	fragment->size = this_fragment_size;
+
+	// Write the transport header. The prefix is 0 for fire and forget packets, otherwise one past the channel.
+	int header_size = s_transport_write_header(fragment->data, this_fragment_size + CN_TRANSPORT_HEADER_SIZE, (uint8_t)(channel + 1), item->fragment_sequence, item->fragment_count, fragment_header_index, (uint16_t)this_fragment_size);
+	if (header_size != CN_TRANSPORT_HEADER_SIZE) {
+		s_transport_free(transport, fragment->data);
+		transport->fragments_count--;
+		return cn_error_failure("Failed to write transport header.");
+	}
+
+	// Copy over the `data` from user.
+	CN_MEMCPY(fragment->data + header_size, fragment_src, this_fragment_size);
+
+	// Send to ack system.
+	uint16_t ack_sequence;
+	CN_PRINTF("Sent reliable sequence %d.\n", item->fragment_sequence);
+	cn_result_t result = cn_ack_system_send_packet(transport->ack_system, fragment->data, this_fragment_size + CN_TRANSPORT_HEADER_SIZE, &ack_sequence);
+	if (cn_is_error(result)) {
+		s_transport_free(transport, fragment->data);
+		transport->fragments_count--;
+		return result;
+	}
+
+	// If all succeeds, record fragment entry. Hopefully it will be acked later.
+	// If ack'd it will be remove from the transport->fragments array.
+	uint64_t* fragment_id_ptr = (uint64_t*)cn_sequence_buffer_insert(&transport->sent_fragments, ack_sequence, NULL);
+	CN_ASSERT(fragment_id_ptr);
+	*fragment_id_ptr = fragment->id;
+
+	if (++item->fragment_index == item->fragment_count) {
+		s_send_queue_pop(transport->send_queues + channel);
+		s_transport_free(transport, item->packet);
+	}
+
+	return cn_error_success();
+}
+
 static cn_result_t s_transport_send_fragments(cn_transport_t* transport)
 {
 	CN_ASSERT(transport->fragments_count <= transport->max_fragments_in_flight);
@@ -8561,86 +9009,34 @@ static cn_result_t s_transport_send_fragments(cn_transport_t* transport)
 		return cn_error_failure("Too many fragments already in flight.");
 	}
 
-	double timestamp = transport->ack_system->time;
-	int fragments_space_available_send = transport->max_fragments_in_flight - transport->fragments_count;
-	int fragment_size = transport->fragment_size;
+	// Channels take turns sending one fragment each, so a large message shares the window with the
+	// other channels rather than filling it up. Stops once the window is full or every queue is empty.
+	int idle_channels = 0;
+	while (transport->fragments_count < transport->max_fragments_in_flight && idle_channels < CN_RELIABLE_CHANNEL_COUNT) {
+		int channel = transport->next_send_channel;
+		transport->next_send_channel = (channel + 1) % CN_RELIABLE_CHANNEL_COUNT;
 
-	while (fragments_space_available_send) {
 		cn_socket_send_queue_item_t* item;
-		if (s_send_queue_peek(&transport->send_queue, &item) < 0) {
-			break;
-		}
-
-		uint8_t* data_ptr = item->packet + item->fragment_index * fragment_size;
-		int fragment_count_left = item->fragment_count - item->fragment_index;
-		int fragment_count_to_send = fragments_space_available_send < fragment_count_left ? fragments_space_available_send : fragment_count_left;
-		CN_ASSERT(item->fragment_index + fragment_count_to_send <= item->fragment_count);
-
-		for (int i = 0; i < fragment_count_to_send; ++i) {
-			// Allocate fragment.
-			uint16_t fragment_header_index = (uint16_t)(item->fragment_index + i);
-			int this_fragment_size = fragment_header_index != item->fragment_count - 1 ? fragment_size : item->final_fragment_size;
-			uint8_t* fragment_src = data_ptr + fragment_size * i;
-			CN_ASSERT(this_fragment_size <= CN_ACK_SYSTEM_MAX_PACKET_SIZE);
-			CN_ASSERT(this_fragment_size > 0);
-
-			int fragment_index = transport->fragments_count;
-			CN_CHECK_BUFFER_GROW(transport, fragments_count, fragments_capacity, fragments, cn_fragment_t);
-			cn_fragment_t* fragment = transport->fragments + transport->fragments_count++;
-
-			fragment->id = transport->fragment_id_gen++;
-			fragment->index = fragment_header_index;
-			fragment->timestamp = timestamp;
-			fragment->data = (uint8_t*)CN_ALLOC(fragment_size + CN_TRANSPORT_HEADER_SIZE, transport->mem_ctx);
-			fragment->size = this_fragment_size;
-			// TODO: Memory pool on sent fragments.
-
-			// Write the transport header.
-			int header_size = s_transport_write_header(fragment->data, this_fragment_size + CN_TRANSPORT_HEADER_SIZE, 1, item->fragment_sequence, item->fragment_count, fragment_header_index, (uint16_t)this_fragment_size);
-			if (header_size != CN_TRANSPORT_HEADER_SIZE) {
-				CN_FREE(fragment->data, transport->mem_ctx);
-				transport->fragments_count--;
-				return cn_error_failure("Failed to write transport header.");
-			}
-
-			// Copy over the `data` from user.
-			CN_MEMCPY(fragment->data + header_size, fragment_src, this_fragment_size);
-
-			// Send to ack system.
-			uint16_t ack_sequence;
-			CN_PRINTF("Sent reliable sequence %d.\n", item->fragment_sequence);
-			cn_result_t result = cn_ack_system_send_packet(transport->ack_system, fragment->data, this_fragment_size + CN_TRANSPORT_HEADER_SIZE, &ack_sequence);
-			if (cn_is_error(result)) {
-				CN_FREE(fragment->data, transport->mem_ctx);
-				transport->fragments_count--;
-				return result;
-			}
-
-			// If all succeeds, record fragment entry. Hopefully it will be acked later.
-			// If ack'd it will be remove from the transport->fragments array.
-			uint64_t* fragment_id_ptr = (uint64_t*)cn_sequence_buffer_insert(&transport->sent_fragments, ack_sequence, NULL);
-			CN_ASSERT(fragment_id_ptr);
-			*fragment_id_ptr = fragment->id;
-		}
-
-		if (item->fragment_index + fragment_count_to_send == item->fragment_count) {
-			s_send_queue_pop(&transport->send_queue);
-			CN_FREE(item->packet, transport->mem_ctx);
-		} else {
-			item->fragment_index += fragment_count_to_send;
+		if (s_send_queue_peek(transport->send_queues + channel, &item) < 0) {
+			++idle_channels;
+			continue;
 		}
 
-		fragments_space_available_send -= fragment_count_to_send;
+		idle_channels = 0;
+		cn_result_t result = s_transport_send_fragment(transport, channel, item);
+		if (cn_is_error(result)) return result;
 	}
 
 	return cn_error_success();
 }
 
-cn_result_t s_transport_send_reliably(cn_transport_t* transport, const void* data, int size)
+cn_result_t s_transport_send_reliably(cn_transport_t* transport, const void* data, int size, int channel)
 {
 	if (size < 0) return cn_error_failure("Negative `size` not allowed.");
 	if (size > transport->max_size_single_send) return cn_error_failure("`size` exceeded `max_size_single_send` from `transport->config`.");
-	if (transport->send_queue.count == CN_TRANSPORT_SEND_QUEUE_MAX_ENTRIES) {
+	if (channel < 0 || channel >= CN_RELIABLE_CHANNEL_COUNT) return cn_error_failure("`channel` must be from 0 to `CN_RELIABLE_CHANNEL_COUNT - 1`.");
+	cn_socket_send_queue_t* send_queue = transport->send_queues + channel;
+	if (send_queue->count == CN_TRANSPORT_SEND_QUEUE_MAX_ENTRIES) {
 		return cn_error_failure("Send queue for reliable packets is full. Increase `CN_TRANSPORT_SEND_QUEUE_MAX_ENTRIES` or send packets less frequently.");
 	}
 
@@ -8650,15 +9046,18 @@ cn_result_t s_transport_send_reliably(cn_transport_t* transport, const void* dat
 	if (final_fragment_size > 0) fragment_count++;
 	else final_fragment_size = fragment_size;
 
+	cn_packet_assembly_t* assembly = s_transport_channel(transport, channel);
+	if (!assembly) return cn_error_failure("Failed to set up the reliable channel.");
+
 	cn_socket_send_queue_item_t send_item;
-	send_item.fragment_sequence = transport->reliable_and_in_order_assembly.send_sequence++;
+	send_item.fragment_sequence = assembly->send_sequence++;
 	send_item.fragment_index = 0;
 	send_item.fragment_count = fragment_count;
 	send_item.final_fragment_size = final_fragment_size;
 	send_item.size = size;
-	send_item.packet = (uint8_t*)CN_ALLOC(size, transport->mem_ctx);
+	send_item.packet = (uint8_t*)s_transport_alloc(transport, size);
 	CN_MEMCPY(send_item.packet, data, size);
-	s_send_queue_push(&transport->send_queue, &send_item);
+	s_send_queue_push(send_queue, &send_item);
 
 	return cn_error_success();
 }
@@ -8707,22 +9106,29 @@ cn_result_t s_transport_send(cn_transport_t* transport, const void* data, int si
 cn_result_t cn_transport_send(cn_transport_t* transport, const void* data, int size, bool send_reliably)
 {
 	if (send_reliably) {
-		return s_transport_send_reliably(transport, data, size);
+		return s_transport_send_reliably(transport, data, size, 0);
 	} else {
 		return s_transport_send(transport, data, size);
 	}
 }
 
+cn_result_t cn_transport_send_on_channel(cn_transport_t* transport, const void* data, int size, int channel)
+{
+	return s_transport_send_reliably(transport, data, size, channel);
+}
+
 cn_result_t cn_transport_receive_reliably_and_in_order(cn_transport_t* transport, void** data, int* size)
 {
-	cn_packet_assembly_t* assembly = &transport->reliable_and_in_order_assembly;
-	if (cn_packet_queue_pop(&assembly->packets_received, data, size) < 0) {
-		*data = NULL;
-		*size = 0;
-		return cn_error_failure("No data.");
-	} else {
-		return cn_error_success();
+	// In order within each channel. Unused channels have an empty queue.
+	for (int i = 0; i < CN_RELIABLE_CHANNEL_COUNT; ++i) {
+		cn_packet_assembly_t* assembly = transport->reliable_assemblies + i;
+		if (cn_packet_queue_pop(&assembly->packets_received, data, size) == 0) {
+			return cn_error_success();
+		}
 	}
+	*data = NULL;
+	*size = 0;
+	return cn_error_failure("No data.");
 }
 
 cn_result_t cn_transport_receive_fire_and_forget(cn_transport_t* transport, void** data, int* size)
@@ -8739,14 +9145,36 @@ cn_result_t cn_transport_receive_fire_and_forget(cn_transport_t* transport, void
 
 void cn_transport_free_packet(cn_transport_t* transport, void* data)
 {
-	CN_FREE(data, transport->mem_ctx);
+	s_transport_free(transport, data);
+}
+
+CN_INLINE int s_transport_reassembly_bytes(cn_transport_t* transport, int fragment_count)
+{
+	return fragment_count * (transport->fragment_size + 1);
+}
+
+// Whether a fragment may be taken in without going over `max_reassembly_bytes`.
+static bool s_transport_can_reassemble(cn_transport_t* transport, cn_packet_assembly_t* assembly, bool reliable, uint16_t sequence, int fragment_count)
+{
+	// Already reassembling, or old and about to be dropped, or the message this channel is waiting on.
+	if (cn_sequence_buffer_find(&assembly->fragments_received, sequence)) return true;
+	if (reliable && !s_sequence_greater_than(sequence, assembly->receive_sequence)) return true;
+
+	int bytes = s_transport_reassembly_bytes(transport, fragment_count);
+	if (transport->reassembly_bytes + bytes <= transport->max_reassembly_bytes) return true;
+	if (!reliable) return false;
+
+	// Fire and forget messages are allowed to go missing, so make room by dropping any partly received ones.
+	cn_sequence_buffer_t* fire_and_forget = &transport->fire_and_forget_assembly.fragments_received;
+	for (int i = 0; i < fire_and_forget->capacity; ++i) {
+		cn_sequence_buffer_remove(fire_and_forget, (uint16_t)i, s_fragment_reassembly_entry_cleanup);
+	}
+	return transport->reassembly_bytes + bytes <= transport->max_reassembly_bytes;
 }
 
 cn_result_t cn_transport_process_packet(cn_transport_t* transport, void* data, int size)
 {
-	if (size < CN_TRANSPORT_HEADER_SIZE) return cn_error_failure("`size` is too small to fit `CN_TRANSPORT_HEADER_SIZE`.");
-	cn_result_t result = cn_ack_system_receive_packet(transport->ack_system, data, size);
-	if (cn_is_error(result)) return result;
+	if (size < CN_ACK_SYSTEM_HEADER_SIZE + CN_TRANSPORT_HEADER_SIZE) return cn_error_failure("`size` is too small to fit `CN_TRANSPORT_HEADER_SIZE`.");
 
 	// Read transport header.
 	uint8_t* buffer = (uint8_t*)data + CN_ACK_SYSTEM_HEADER_SIZE;
@@ -8762,7 +9190,7 @@ cn_result_t cn_transport_process_packet(cn_transport_t* transport, void* data, i
 		return cn_error_failure("Packet exceeded `max_size_single_send` limit.");
 	}
 
-	if (fragment_index > fragment_count) {
+	if (fragment_index >= fragment_count) {
 		return cn_error_failure("Fragment index out of bounds.");
 	}
 
@@ -8770,14 +9198,23 @@ cn_result_t cn_transport_process_packet(cn_transport_t* transport, void* data, i
 		return cn_error_failure("Fragment size somehow didn't match `transport->fragment_size`.");
 	}
 
-	cn_packet_assembly_t* assembly;
-	if (prefix) {
-		assembly = &transport->reliable_and_in_order_assembly;
-		if (s_sequence_less_than(fragment_sequence, assembly->receive_sequence)) {
-			return cn_error_failure("Sequence is too old.");
-		}
-	} else {
-		assembly = &transport->fire_and_forget_assembly;
+	if (prefix > CN_RELIABLE_CHANNEL_COUNT) {
+		return cn_error_failure("Reliable channel out of bounds.");
+	}
+
+	cn_packet_assembly_t* assembly = prefix ? s_transport_channel(transport, prefix - 1) : &transport->fire_and_forget_assembly;
+	if (!assembly) return cn_error_failure("Failed to set up the reliable channel.");
+
+	// Refused before acking, so the other end sends it again later, once there's room.
+	if (!s_transport_can_reassemble(transport, assembly, prefix != 0, fragment_sequence, fragment_count)) {
+		return cn_error_failure("Over `max_reassembly_bytes`, fragment refused.");
+	}
+
+	cn_result_t result = cn_ack_system_receive_packet(transport->ack_system, data, size);
+	if (cn_is_error(result)) return result;
+
+	if (prefix && s_sequence_less_than(fragment_sequence, assembly->receive_sequence)) {
+		return cn_error_failure("Sequence is too old.");
 	}
 
 	// Build reassembly if it doesn't exist yet.
@@ -8791,11 +9228,13 @@ cn_result_t cn_transport_process_packet(cn_transport_t* transport, void* data, i
 			CN_PRINTF("Found fragment sequence %d.\n", fragment_sequence);
 		}
 		reassembly->received_final_fragment = 0;
+		reassembly->reserved_bytes = s_transport_reassembly_bytes(transport, fragment_count);
+		transport->reassembly_bytes += reassembly->reserved_bytes;
 		reassembly->packet_size = total_packet_size;
-		reassembly->packet = (uint8_t*)CN_ALLOC(total_packet_size, transport->mem_ctx);
+		reassembly->packet = (uint8_t*)s_transport_alloc(transport, total_packet_size);
 		reassembly->fragment_count_so_far = 0;
 		reassembly->fragments_total = fragment_count;
-		reassembly->fragment_received = (uint8_t*)CN_ALLOC(fragment_count, transport->mem_ctx);
+		reassembly->fragment_received = (uint8_t*)s_transport_alloc(transport, fragment_count);
 		CN_MEMSET(reassembly->fragment_received, 0, fragment_count);
 	}
 
@@ -8867,7 +9306,7 @@ void cn_transport_remove_flight_fragment(cn_transport_t* transport, uint64_t fra
 {
 	for (int j = 0; j < transport->fragments_count; ++j) {
 		if (transport->fragments[j].id == fragment_id) {
-			CN_FREE(transport->fragments[j].data, transport->mem_ctx);
+			s_transport_free(transport, transport->fragments[j].data);
 			transport->fragments[j] = transport->fragments[--transport->fragments_count];
 		}
 	}
@@ -8908,7 +9347,7 @@ void cn_transport_send_fragments(cn_transport_t* transport)
 		cn_result_t result = cn_ack_system_send_packet(transport->ack_system, fragment->data, fragment->size + CN_TRANSPORT_HEADER_SIZE, &sequence);
 		if (cn_is_error(result)) {
 			// Remove failed fragments (this should never happen, and is only here for safety).
-			CN_FREE(fragment->data, transport->mem_ctx);
+			s_transport_free(transport, fragment->data);
 			transport->fragments[i] = transport->fragments[--transport->fragments_count];
 			CN_ASSERT(false);
 			continue;
@@ -8920,6 +9359,7 @@ void cn_transport_send_fragments(cn_transport_t* transport)
 		CN_ASSERT(fragment_id_ptr);
 		*fragment_id_ptr = fragment->id;
 		fragment->timestamp = timestamp;
+		transport->resend_count++;
 	}
 
 	// Send off any available fragments from the send queue.
@@ -8931,6 +9371,26 @@ int cn_transport_unacked_fragment_count(cn_transport_t* transport)
 	return transport->fragments_count;
 }
 
+static cn_connection_stats_t s_transport_stats(cn_transport_t* transport)
+{
+	cn_ack_system_t* ack_system = transport->ack_system;
+	cn_connection_stats_t stats;
+	stats.rtt = (float)ack_system->rtt;
+	stats.rtt_jitter = (float)ack_system->rtt_jitter;
+	stats.packet_loss = (float)ack_system->packet_loss;
+	stats.incoming_kbps = (float)ack_system->incoming_bandwidth_kbps;
+	stats.outgoing_kbps = (float)ack_system->outgoing_bandwidth_kbps;
+	stats.reliable_queue_depth = transport->fragments_count;
+	for (int i = 0; i < CN_RELIABLE_CHANNEL_COUNT; ++i) {
+		stats.reliable_queue_depth += transport->send_queues[i].count;
+	}
+	stats.reassembly_bytes = transport->reassembly_bytes;
+	stats.resend_count = transport->resend_count;
+	stats.packets_sent = ack_system->counters[CN_ACK_SYSTEM_COUNTERS_PACKETS_SENT];
+	stats.packets_received = ack_system->counters[CN_ACK_SYSTEM_COUNTERS_PACKETS_RECEIVED];
+	return stats;
+}
+
 void cn_transport_update(cn_transport_t* transport, double dt)
 {
 	cn_ack_system_update(transport->ack_system, dt);
@@ -8941,10 +9401,15 @@ void cn_transport_update(cn_transport_t* transport, double dt)
 //--------------------------------------------------------------------------------------------------
 // CLIENT
 
+#define CN_PACKET_POOL_ELEMENT_SIZE (CN_TRANSPORT_MAX_FRAGMENT_SIZE + CN_TRANSPORT_HEADER_SIZE)
+#define CN_CLIENT_PACKET_POOL_COUNT 256
+#define CN_SERVER_PACKET_POOL_COUNT 2048
+
 struct cn_client_t
 {
 	cn_protocol_client_t* p_client;
 	cn_transport_t* transport;
+	cn_memory_pool_t* packet_pool;
 	void* mem_ctx;
 };
 
@@ -8966,11 +9431,13 @@ cn_client_t* cn_client_create(uint16_t port, uint64_t application_id, bool use_i
 	CN_MEMSET(client, 0, sizeof(*client));
 	client->p_client = p_client;
 	client->mem_ctx = user_allocator_context;
+	client->packet_pool = cn_memory_pool_create(CN_PACKET_POOL_ELEMENT_SIZE, CN_CLIENT_PACKET_POOL_COUNT, user_allocator_context);
 
 	cn_transport_config_t config = cn_transport_config_defaults();
 	config.send_packet_fn = s_send;
 	config.user_allocator_context = user_allocator_context;
 	config.udata = client;
+	config.packet_pool = client->packet_pool;
 	client->transport = cn_transport_create(config);
 
 	return client;
@@ -8981,6 +9448,7 @@ void cn_client_destroy(cn_client_t* client)
 	if (!client) return;
 	cn_protocol_client_destroy(client->p_client);
 	cn_transport_destroy(client->transport);
+	cn_memory_pool_destroy(client->packet_pool);
 	void* mem_ctx = client->mem_ctx;
 	CN_FREE(client, mem_ctx);
 }
@@ -9043,6 +9511,17 @@ cn_result_t cn_client_send(cn_client_t* client, const void* packet, int size, bo
 	return cn_transport_send(client->transport, packet, size, send_reliably);
 }
 
+cn_result_t cn_client_send_on_channel(cn_client_t* client, const void* packet, int size, int channel)
+{
+	if (size <= 0) {
+		return cn_error_failure("Empty packets are not allowed.");
+	}
+	if (cn_protocol_client_get_state(client->p_client) != CN_PROTOCOL_CLIENT_STATE_CONNECTED) {
+		return cn_error_failure("Client is not connected.");
+	}
+	return cn_transport_send_on_channel(client->transport, packet, size, channel);
+}
+
 cn_client_state_t cn_client_state_get(const cn_client_t* client)
 {
 	return (cn_client_state_t)cn_protocol_client_get_state(client->p_client);
@@ -9091,6 +9570,11 @@ float cn_client_get_outgoing_kbps_estimate(cn_client_t* client)
 	return (float)client->transport->ack_system->outgoing_bandwidth_kbps;
 }
 
+cn_connection_stats_t cn_client_get_stats(cn_client_t* client)
+{
+	return s_transport_stats(client->transport);
+}
+
 //--------------------------------------------------------------------------------------------------
 // SERVER
 
@@ -9105,6 +9589,8 @@ struct cn_server_t
 	uint8_t buffer[CN_PROTOCOL_PACKET_SIZE_MAX];
 	cn_circular_buffer_t event_queue;
 	cn_transport_t* client_transports[CN_SERVER_MAX_CLIENTS];
+	// Shared by all client transports, so payloads stay valid across a client's transport being recreated.
+	cn_memory_pool_t* packet_pool;
 	cn_protocol_server_t* p_server;
 	void* mem_ctx;
 };
@@ -9126,6 +9612,7 @@ cn_server_t* cn_server_create(cn_server_config_t config)
 	server->config = config;
 	server->event_queue = cn_circular_buffer_create(CN_MB * 10, config.user_allocator_context);
 	server->p_server = cn_protocol_server_create(config.application_id, &server->config.public_key, &server->config.secret_key, server->mem_ctx);
+	server->packet_pool = cn_memory_pool_create(CN_PACKET_POOL_ELEMENT_SIZE, CN_SERVER_PACKET_POOL_COUNT, server->mem_ctx);
 
 	return server;
 }
@@ -9135,6 +9622,7 @@ void cn_server_destroy(cn_server_t* server)
 	if (!server) return;
 	cn_server_stop(server);
 	cn_protocol_server_destroy(server->p_server);
+	cn_memory_pool_destroy(server->packet_pool);
 	void* mem_ctx = server->mem_ctx;
 	cn_circular_buffer_free(&server->event_queue);
 	CN_FREE(server, mem_ctx);
@@ -9151,6 +9639,7 @@ cn_result_t cn_server_start(cn_server_t* server, const char* address_and_port)
 		transport_config.send_packet_fn = s_send_packet_fn;
 		transport_config.udata = server;
 		transport_config.user_allocator_context = server->mem_ctx;
+		transport_config.packet_pool = server->packet_pool;
 		server->client_transports[i] = cn_transport_create(transport_config);
 	}
 
@@ -9187,6 +9676,10 @@ CN_INLINE int s_server_event_push(cn_server_t* server, cn_server_event_t* event)
 
 void cn_server_update(cn_server_t* server, double dt, uint64_t current_time)
 {
+	// Everything sent during the update goes out in as few syscalls as possible at the end.
+	cn_socket_t* socket = &server->p_server->socket;
+	socket->send_batch = &server->p_server->send_batch;
+
 	// Update the protocol server.
 	cn_protocol_server_update(server->p_server, dt, current_time);
 
@@ -9218,6 +9711,7 @@ void cn_server_update(cn_server_t* server, double dt, uint64_t current_time)
 			transport_config.send_packet_fn = s_send_packet_fn;
 			transport_config.udata = server;
 			transport_config.user_allocator_context = server->mem_ctx;
+			transport_config.packet_pool = server->packet_pool;
 			server->client_transports[e.u.disconnected.client_index] = cn_transport_create(transport_config);
 		}	break;
 
@@ -9266,6 +9760,9 @@ void cn_server_update(cn_server_t* server, double dt, uint64_t current_time)
 			}
 		}
 	}
+
+	cn_socket_flush(socket);
+	socket->send_batch = NULL;
 }
 
 bool cn_server_pop_event(cn_server_t* server, cn_server_event_t* event)
@@ -9297,6 +9794,16 @@ cn_result_t cn_server_send(cn_server_t* server, const void* packet, int size, in
 	return cn_transport_send(server->client_transports[client_index], packet, size, send_reliably);
 }
 
+cn_result_t cn_server_send_on_channel(cn_server_t* server, const void* packet, int size, int client_index, int channel)
+{
+	if (size <= 0) {
+		return cn_error_failure("Empty packets are not allowed.");
+	}
+	CN_ASSERT(client_index >= 0 && client_index < CN_SERVER_MAX_CLIENTS);
+	CN_ASSERT(cn_protocol_server_is_client_connected(server->p_server, client_index));
+	return cn_transport_send_on_channel(server->client_transports[client_index], packet, size, channel);
+}
+
 bool cn_server_is_client_connected(cn_server_t* server, int client_index)
 {
 	return cn_protocol_server_is_client_connected(server->p_server, client_index);
@@ -9328,13 +9835,19 @@ float cn_server_get_rtt_estimate(cn_server_t* server, int client_index)
 float cn_server_get_incoming_kbps_estimate(cn_server_t* server, int client_index)
 {
 	CN_ASSERT(cn_server_is_client_connected(server, client_index));
-	return (float)server->client_transports[client_index]->ack_system->outgoing_bandwidth_kbps;
+	return (float)server->client_transports[client_index]->ack_system->incoming_bandwidth_kbps;
 }
 
 float cn_server_get_outgoing_kbps_estimate(cn_server_t* server, int client_index)
 {
 	CN_ASSERT(cn_server_is_client_connected(server, client_index));
-	return (float)server->client_transports[client_index]->ack_system->incoming_bandwidth_kbps;
+	return (float)server->client_transports[client_index]->ack_system->outgoing_bandwidth_kbps;
+}
+
+cn_connection_stats_t cn_server_get_stats(cn_server_t* server, int client_index)
+{
+	CN_ASSERT(cn_server_is_client_connected(server, client_index));
+	return s_transport_stats(server->client_transports[client_index]);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -10752,6 +11265,98 @@ int cn_transport_send_many_reliables_at_once()
 	return 0;
 }
 
+CN_TEST_CASE(cn_transport_reliable_channels, "A large message on one channel doesn't hold up another, and reassembly memory stays bounded.");
+int cn_transport_reliable_channels()
+{
+	cn_test_transport_data_t data_a = cn_test_transport_data_defaults();
+	cn_test_transport_data_t data_b = cn_test_transport_data_defaults();
+	data_a.id = 0;
+	data_b.id = 1;
+	double dt = 1.0/60.0;
+
+	cn_transport_config_t config = cn_transport_config_defaults();
+	config.send_packet_fn = cn_test_transport_send_packet_fn;
+	config.max_reassembly_bytes = CN_KB * 64;
+	config.udata = &data_a;
+	cn_transport_t* transport_a = cn_transport_create(config);
+	config.udata = &data_b;
+	cn_transport_t* transport_b = cn_transport_create(config);
+	data_a.transport_a = transport_a;
+	data_a.transport_b = transport_b;
+	data_b.transport_a = transport_a;
+	data_b.transport_b = transport_b;
+
+	int big_size = CN_KB * 256;
+	uint8_t* big = (uint8_t*)CN_ALLOC(big_size, NULL);
+	for (int i = 0; i < big_size; ++i) {
+		big[i] = (uint8_t)(i * 7);
+	}
+	uint8_t small = 9;
+
+	// The big message goes first, and the small one right after on another channel.
+	CN_TEST_CHECK(cn_is_error(cn_transport_send_on_channel(transport_a, big, big_size, 1)));
+	CN_TEST_CHECK(cn_is_error(cn_transport_send_on_channel(transport_a, &small, 1, 0)));
+	CN_TEST_ASSERT(cn_is_error(cn_transport_send_on_channel(transport_a, &small, 1, CN_RELIABLE_CHANNEL_COUNT)));
+
+	// Fire and forget messages over the budget are refused outright.
+	CN_TEST_CHECK(cn_is_error(cn_transport_send(transport_a, big, CN_KB * 128, false)));
+
+	void* packet_received;
+	int packet_received_size;
+	int iters = 0;
+	bool got_small = false;
+	bool got_big = false;
+	uint8_t keepalive = 0;
+
+	while (!got_big || cn_transport_unacked_fragment_count(transport_a)) {
+		CN_TEST_CHECK(cn_is_error(cn_transport_send(transport_a, &keepalive, 1, false)));
+		CN_TEST_CHECK(cn_is_error(cn_transport_send(transport_b, &keepalive, 1, false)));
+
+		cn_transport_update(transport_a, dt);
+		cn_transport_update(transport_b, dt);
+
+		while (!cn_is_error(cn_transport_receive_reliably_and_in_order(transport_b, &packet_received, &packet_received_size))) {
+			if (packet_received_size == 1) {
+				CN_TEST_ASSERT(!got_big);
+				got_small = true;
+			} else {
+				CN_TEST_ASSERT(got_small);
+				CN_TEST_ASSERT(packet_received_size == big_size);
+				CN_TEST_ASSERT(!CN_MEMCMP(big, packet_received, big_size));
+				got_big = true;
+			}
+			cn_transport_free_packet(transport_b, packet_received);
+		}
+
+		void* data;
+		int size;
+		while (!cn_is_error(cn_transport_receive_fire_and_forget(transport_a, &data, &size))) {
+			cn_transport_free_packet(transport_a, data);
+		}
+		while (!cn_is_error(cn_transport_receive_fire_and_forget(transport_b, &data, &size))) {
+			CN_TEST_ASSERT(size == 1);
+			cn_transport_free_packet(transport_b, data);
+		}
+
+		// Only the message channel 1 is waiting on may go past the budget.
+		CN_TEST_ASSERT(transport_b->reassembly_bytes <= config.max_reassembly_bytes + s_transport_reassembly_bytes(transport_b, big_size / CN_TRANSPORT_MAX_FRAGMENT_SIZE + 1));
+
+		if (++iters == 1000) {
+			CN_TEST_ASSERT(false);
+			break;
+		}
+	}
+
+	CN_TEST_ASSERT(got_small && got_big);
+	CN_TEST_ASSERT(transport_b->reassembly_bytes == 0);
+	CN_FREE(big, NULL);
+
+	cn_transport_destroy(transport_a);
+	cn_transport_destroy(transport_b);
+
+	return 0;
+}
+
 CN_TEST_CASE(cn_packet_connection_accepted, "Write, encrypt, decrypt, and assert the *connection accepted packet*.");
 int cn_packet_connection_accepted()
 {
@@ -12262,6 +12867,7 @@ int cn_run_tests(int which_test, bool soak)
 		CN_TEST_CASE_ENTRY(cn_transport_drop_fragments),
 		CN_TEST_CASE_ENTRY(cn_transport_drop_fragments_reliable_hammer),
 		CN_TEST_CASE_ENTRY(cn_transport_send_many_reliables_at_once),
+		CN_TEST_CASE_ENTRY(cn_transport_reliable_channels),
 		CN_TEST_CASE_ENTRY(cn_packet_connection_accepted),
 		CN_TEST_CASE_ENTRY(cn_packet_connection_denied),
 		CN_TEST_CASE_ENTRY(cn_packet_keepalive),
@@ -80,6 +80,7 @@
 			CUTE_PNG_MEMCPY
 			CUTE_PNG_MEMCMP
 			CUTE_PNG_MEMSET
+			CUTE_PNG_MEMMOVE
 			CUTE_PNG_ASSERT
 			CUTE_PNG_FPRINTF
 			CUTE_PNG_SEEK_SET
@@ -93,6 +94,7 @@
 			CUTE_PNG_FCLOSE
 			CUTE_PNG_FERROR
 			CUTE_PNG_ATLAS_MUST_FIT
+			CUTE_PNG_NO_SIMD
 			CUTE_PNG_ATLAS_FLIP_Y_AXIS_FOR_UV
 			CUTE_PNG_ATLAS_EMPTY_COLOR
 */
@@ -165,6 +167,10 @@ int cp_default_save_atlas(const char* out_path_image, const char* out_path_atlas
 // call free on cp_image_t::pix when done, or call cp_free_png
 cp_image_t cp_load_png(const char *file_name);
 cp_image_t cp_load_png_mem(const void *png_data, int png_length);
+
+// Same as `cp_load_png_mem`, but premultiplies each row as soon as it's decoded, instead of in a second pass over the
+// whole image with `cp_premultiply`. Rounds down exactly, so the bytes can differ by one from `cp_premultiply`.
+cp_image_t cp_load_png_mem_premultiplied(const void *png_data, int png_length);
 cp_image_t cp_load_blank(int w, int h); // Alloc's pixels, but `pix` memory is uninitialized.
 void cp_free_png(cp_image_t* img);
 void cp_flip_image_horizontal(cp_image_t* img);
@@ -227,6 +233,11 @@ struct cp_atlas_image_t
 #ifndef CUTE_PNG_IMPLEMENTATION_ONCE
 #define CUTE_PNG_IMPLEMENTATION_ONCE
 
+#if !defined(CUTE_PNG_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#include <emmintrin.h>
+	#define CUTE_PNG_SSE2
+#endif
+
 #if !defined(CUTE_PNG_ALLOCA)
 	#define CUTE_PNG_ALLOCA alloca
 
@@ -272,6 +283,11 @@ struct cp_atlas_image_t
 	#define CUTE_PNG_MEMSET memset
 #endif
 
+#if !defined(CUTE_PNG_MEMMOVE)
+	#include <string.h>
+	#define CUTE_PNG_MEMMOVE memmove
+#endif
+
 #if !defined(CUTE_PNG_ASSERT)
 	#include <assert.h>
 	#define CUTE_PNG_ASSERT assert
@@ -386,6 +402,8 @@ typedef struct cp_state_t
 	char* begin;
 
 	uint16_t lookup[CUTE_PNG_LOOKUP_COUNT];
+	uint16_t dst_lookup[CUTE_PNG_LOOKUP_COUNT];
+	uint16_t len_lookup[CUTE_PNG_LOOKUP_COUNT];
 	uint32_t lit[288];
 	uint32_t dst[32];
 	uint32_t len[19];
@@ -482,7 +500,8 @@ static uint32_t cp_rev16(uint32_t a)
 }
 
 // RFC 1951 section 3.2.2
-static int cp_build(cp_state_t* s, uint32_t* tree, uint8_t* lens, int sym_count)
+// Also fills out `lookup`, which decodes any code of up to CUTE_PNG_LOOKUP_BITS bits with a single load.
+static int cp_build(uint16_t* lookup, uint32_t* tree, uint8_t* lens, int sym_count)
 {
 	int n, codes[16], first[16], counts[16] = { 0 };
 
@@ -497,7 +516,7 @@ static int cp_build(cp_state_t* s, uint32_t* tree, uint8_t* lens, int sym_count)
 		first[n] = first[n - 1] + counts[n - 1];
 	}
 
-	if (s) CUTE_PNG_MEMSET(s->lookup, 0, sizeof(s->lookup));
+	CUTE_PNG_MEMSET(lookup, 0, sizeof(uint16_t) * CUTE_PNG_LOOKUP_COUNT);
 	for (int i = 0; i < sym_count; ++i)
 	{
 		int len = lens[i];
@@ -509,12 +528,12 @@ static int cp_build(cp_state_t* s, uint32_t* tree, uint8_t* lens, int sym_count)
 			uint32_t slot = first[len]++;
 			tree[slot] = (code << (32 - len)) | (i << 4) | len;
 
-			if (s && len <= CUTE_PNG_LOOKUP_BITS)
+			if (len <= CUTE_PNG_LOOKUP_BITS)
 			{
 				int j = cp_rev16(code) >> (16 - len);
 				while (j < (1 << CUTE_PNG_LOOKUP_BITS))
 				{
-					s->lookup[j] = (uint16_t)((len << CUTE_PNG_LOOKUP_BITS) | i);
+					lookup[j] = (uint16_t)((len << CUTE_PNG_LOOKUP_BITS) | i);
 					j += (1 << len);
 				}
 			}
@@ -551,14 +570,23 @@ cp_err:
 // 3.2.6
 static int cp_fixed(cp_state_t* s)
 {
-	s->nlit = cp_build(s, s->lit, cp_fixed_table, 288);
-	s->ndst = cp_build(0, s->dst, cp_fixed_table + 288, 32);
+	s->nlit = cp_build(s->lookup, s->lit, cp_fixed_table, 288);
+	s->ndst = cp_build(s->dst_lookup, s->dst, cp_fixed_table + 288, 32);
 	return 1;
 }
 
-static int cp_decode(cp_state_t* s, uint32_t* tree, int hi)
+static int cp_decode(cp_state_t* s, const uint16_t* lookup, uint32_t* tree, int hi)
 {
 	uint64_t bits = cp_peak_bits(s, 16);
+
+	// Short codes, which are nearly all of them, come straight out of the lookup table.
+	uint16_t entry = lookup[bits & CUTE_PNG_LOOKUP_MASK];
+	if (entry)
+	{
+		cp_consume_bits(s, entry >> CUTE_PNG_LOOKUP_BITS);
+		return entry & CUTE_PNG_LOOKUP_MASK;
+	}
+
 	uint32_t search = (cp_rev16((uint32_t)bits) << 16) | 0xFFFF;
 	int lo = 0;
 	while (lo < hi)
@@ -590,12 +618,12 @@ static int cp_dynamic(cp_state_t* s)
 		lenlens[cp_permutation_order[i]] = (uint8_t)cp_read_bits(s, 3);
 
 	// Build the tree for decoding code lengths
-	s->nlen = cp_build(0, s->len, lenlens, 19);
+	s->nlen = cp_build(s->len_lookup, s->len, lenlens, 19);
 	uint8_t lens[288 + 32];
 
 	for (int n = 0; n < nlit + ndst;)
 	{
-		int sym = cp_decode(s, s->len, s->nlen);
+		int sym = cp_decode(s, s->len_lookup, s->len, s->nlen);
 		switch (sym)
 		{
 		case 16: for (int i =  3 + cp_read_bits(s, 2); i; --i, ++n) lens[n] = lens[n - 1]; break;
@@ -605,8 +633,8 @@ static int cp_dynamic(cp_state_t* s)
 		}
 	}
 
-	s->nlit = cp_build(s, s->lit, lens, nlit);
-	s->ndst = cp_build(0, s->dst, lens + nlit, ndst);
+	s->nlit = cp_build(s->lookup, s->lit, lens, nlit);
+	s->ndst = cp_build(s->dst_lookup, s->dst, lens + nlit, ndst);
 	return 1;
 }
 
@@ -615,7 +643,7 @@ static int cp_block(cp_state_t* s)
 {
 	while (1)
 	{
-		int symbol = cp_decode(s, s->lit, s->nlit);
+		int symbol = cp_decode(s, s->lookup, s->lit, s->nlit);
 
 		if (symbol < 256)
 		{
@@ -628,7 +656,7 @@ static int cp_block(cp_state_t* s)
 		{
 			symbol -= 257;
 			int length = cp_read_bits(s, cp_len_extra_bits[symbol]) + cp_len_base[symbol];
-			int distance_symbol = cp_decode(s, s->dst, s->ndst);
+			int distance_symbol = cp_decode(s, s->dst_lookup, s->dst, s->ndst);
 			int backwards_distance = cp_read_bits(s, cp_dist_extra_bits[distance_symbol]) + cp_dist_base[distance_symbol];
 			CUTE_PNG_CHECK(s->out - backwards_distance >= s->begin, "Attempted to write before out buffer (invalid backwards distance).");
 			CUTE_PNG_CHECK(s->out + length <= s->out_end, "Attempted to overwrite out buffer while outputting a string.");
@@ -636,13 +664,18 @@ static int cp_block(cp_state_t* s)
 			char* dst = s->out;
 			s->out += length;
 
-			switch (backwards_distance)
+			if (backwards_distance == 1)
 			{
-			case 1: // very common in images
+				// very common in images
 				CUTE_PNG_MEMSET(dst, *src, length);
-				break;
-			default: while (length--) *dst++ = *src++;
 			}
+			else if (backwards_distance >= 8)
+			{
+				// Eight bytes at a time. Each chunk only reads bytes at least eight back, which are already written.
+				for (; length >= 8; length -= 8, src += 8, dst += 8) CUTE_PNG_MEMCPY(dst, src, 8);
+				while (length--) *dst++ = *src++;
+			}
+			else while (length--) *dst++ = *src++;
 		}
 
 		else break;
@@ -983,6 +1016,84 @@ static const uint8_t* cp_find(cp_raw_png_t* png, const char* chunk, uint32_t min
 	return 0;
 }
 
+// Unfilters one row of 4-byte pixels at a time with SSE2. Each pixel depends on the one to its left, so the
+// speedup comes from doing all four channels of a pixel at once.
+#ifdef CUTE_PNG_SSE2
+
+static void cp_unfilter_sub4_sse2(uint8_t* row, int len)
+{
+	__m128i a = _mm_setzero_si128();
+	for (int x = 0; x < len; x += 4)
+	{
+		int v;
+		CUTE_PNG_MEMCPY(&v, row + x, 4);
+		a = _mm_add_epi8(a, _mm_cvtsi32_si128(v));
+		v = _mm_cvtsi128_si32(a);
+		CUTE_PNG_MEMCPY(row + x, &v, 4);
+	}
+}
+
+static void cp_unfilter_avg4_sse2(uint8_t* row, const uint8_t* prev, int len)
+{
+	// (a + b) / 2 without overflow is avg(a, b) minus the rounding bit that `_mm_avg_epu8` adds.
+	const __m128i one = _mm_set1_epi8(1);
+	__m128i a = _mm_setzero_si128();
+	for (int x = 0; x < len; x += 4)
+	{
+		int v, u;
+		CUTE_PNG_MEMCPY(&v, row + x, 4);
+		CUTE_PNG_MEMCPY(&u, prev + x, 4);
+		__m128i b = _mm_cvtsi32_si128(u);
+		__m128i avg = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+		a = _mm_add_epi8(avg, _mm_cvtsi32_si128(v));
+		v = _mm_cvtsi128_si32(a);
+		CUTE_PNG_MEMCPY(row + x, &v, 4);
+	}
+}
+
+static void cp_unfilter_paeth4_sse2(uint8_t* row, const uint8_t* prev, int len)
+{
+	// Paeth picks whichever of a (left), b (up) or c (up-left) is closest to a + b - c, done in 16-bit lanes.
+	const __m128i zero = _mm_setzero_si128();
+	__m128i a = zero, c = zero;
+	for (int x = 0; x < len; x += 4)
+	{
+		int v, u;
+		CUTE_PNG_MEMCPY(&v, row + x, 4);
+		CUTE_PNG_MEMCPY(&u, prev + x, 4);
+		__m128i b = _mm_unpacklo_epi8(_mm_cvtsi32_si128(u), zero);
+		__m128i pa = _mm_sub_epi16(b, c);
+		__m128i pb = _mm_sub_epi16(a, c);
+		__m128i pc = _mm_add_epi16(pa, pb);
+		pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+		pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+		pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+		__m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+		// Ties go to a, then b, then c.
+		__m128i use_a = _mm_cmpeq_epi16(smallest, pa);
+		__m128i use_b = _mm_andnot_si128(use_a, _mm_cmpeq_epi16(smallest, pb));
+		__m128i use_c = _mm_andnot_si128(_mm_or_si128(use_a, use_b), _mm_set1_epi16(-1));
+		__m128i pred = _mm_or_si128(_mm_or_si128(_mm_and_si128(use_a, a), _mm_and_si128(use_b, b)), _mm_and_si128(use_c, c));
+		__m128i d = _mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero);
+		a = _mm_and_si128(_mm_add_epi16(d, pred), _mm_set1_epi16(0xFF));
+		c = b;
+		v = _mm_cvtsi128_si32(_mm_packus_epi16(a, a));
+		CUTE_PNG_MEMCPY(row + x, &v, 4);
+	}
+}
+
+#endif // CUTE_PNG_SSE2
+
+static void cp_unfilter_up(uint8_t* row, const uint8_t* prev, int len)
+{
+	int x = 0;
+#ifdef CUTE_PNG_SSE2
+	for (; x + 16 <= len; x += 16)
+		_mm_storeu_si128((__m128i*)(row + x), _mm_add_epi8(_mm_loadu_si128((const __m128i*)(row + x)), _mm_loadu_si128((const __m128i*)(prev + x))));
+#endif
+	for (; x < len; x++) row[x] += prev[x];
+}
+
 static int cp_unfilter(int w, int h, int bpp, uint8_t* raw)
 {
 	int len = w * bpp;
@@ -1009,12 +1120,24 @@ static int cp_unfilter(int w, int h, int bpp, uint8_t* raw)
 
 	for (int y = 1; y < h; y++, prev = raw, raw += len)
 	{
+#ifdef CUTE_PNG_SSE2
+		if (bpp == 4 && *raw != 0 && *raw != 2 && *raw <= 4)
+		{
+			switch (*raw++)
+			{
+			case 1: cp_unfilter_sub4_sse2(raw, len); break;
+			case 3: cp_unfilter_avg4_sse2(raw, prev, len); break;
+			case 4: cp_unfilter_paeth4_sse2(raw, prev, len); break;
+			}
+			continue;
+		}
+#endif // CUTE_PNG_SSE2
 #define FILTER_LOOP(A, B) for (x = 0 ; x < bpp; x++) raw[x] += A; for (; x < len; x++) raw[x] += B; break
 		switch (*raw++)
 		{
 		case 0: break;
 		case 1: FILTER_LOOP(0          , raw[x - bpp] );
-		case 2: FILTER_LOOP(prev[x]    , prev[x]);
+		case 2: cp_unfilter_up(raw, prev, len); break;
 		case 3: FILTER_LOOP(prev[x] / 2, (raw[x - bpp] + prev[x]) / 2);
 		case 4: FILTER_LOOP(prev[x]    , cp_paeth(raw[x - bpp], prev[x], prev[x -bpp]));
 		default: return 0;
@@ -1025,23 +1148,77 @@ static int cp_unfilter(int w, int h, int bpp, uint8_t* raw)
 	return 1;
 }
 
-static void cp_convert(int bpp, int w, int h, uint8_t* src, cp_pixel_t* dst)
+// `x * a / 255` rounded down, exact for any two bytes `x` and `a`.
+static uint8_t cp_mul_div_255(uint32_t x, uint32_t a)
+{
+	uint32_t t = x * a;
+	return (uint8_t)((t + (t >> 8) + 1) >> 8);
+}
+
+static void cp_premultiply_row(cp_pixel_t* pix, int w)
+{
+	int x = 0;
+#ifdef CUTE_PNG_SSE2
+	// Two pixels per 16-bit half. Alpha multiplies by 255 to stay the same.
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rgb_mask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+	const __m128i alpha_255 = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+	const __m128i one = _mm_set1_epi16(1);
+	for (; x + 4 <= w; x += 4)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i*)(pix + x));
+		__m128i halves[2] = { _mm_unpacklo_epi8(p, zero), _mm_unpackhi_epi8(p, zero) };
+		for (int j = 0; j < 2; ++j)
+		{
+			__m128i c = halves[j];
+			__m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(c, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			a = _mm_or_si128(_mm_and_si128(a, rgb_mask), alpha_255);
+			__m128i t = _mm_mullo_epi16(c, a);
+			halves[j] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), one), 8);
+		}
+		_mm_storeu_si128((__m128i*)(pix + x), _mm_packus_epi16(halves[0], halves[1]));
+	}
+#endif // CUTE_PNG_SSE2
+	for (; x < w; x++)
+	{
+		cp_pixel_t* p = pix + x;
+		p->r = cp_mul_div_255(p->r, p->a);
+		p->g = cp_mul_div_255(p->g, p->a);
+		p->b = cp_mul_div_255(p->b, p->a);
+	}
+}
+
+static void cp_convert(int bpp, int w, int h, uint8_t* src, cp_pixel_t* dst, int premultiply)
 {
+	// Greyscale and RGB have no alpha, so there's nothing to premultiply.
+	premultiply = premultiply && (bpp == 2 || bpp == 4);
+
 	for (int y = 0; y < h; y++)
 	{
+		cp_pixel_t* row = dst;
+
 		// skip filter byte
 		src++;
 
-		for (int x = 0; x < w; x++, src += bpp)
+		if (bpp == 4)
+		{
+			// The pixels are already RGBA, they only need to move over to cover the filter bytes.
+			CUTE_PNG_MEMMOVE(dst, src, w * 4);
+			dst += w;
+			src += w * 4;
+		}
+		else for (int x = 0; x < w; x++, src += bpp)
 		{
 			switch (bpp)
 			{
 				case 1: *dst++ = cp_make_pixel(src[0], src[0], src[0]); break;
 				case 2: *dst++ = cp_make_pixel_a(src[0], src[0], src[0], src[1]); break;
 				case 3: *dst++ = cp_make_pixel(src[0], src[1], src[2]); break;
-				case 4: *dst++ = cp_make_pixel_a(src[0], src[1], src[2], src[3]); break;
 			}
 		}
+
+		// Premultiply while the row is still in cache.
+		if (premultiply) cp_premultiply_row(row, w);
 	}
 }
 
@@ -1053,8 +1230,26 @@ static uint8_t cp_get_alpha_for_indexed_image(int index, const uint8_t* trns, ui
 	else return trns[index];
 }
 
-static void cp_depalette(int w, int h, uint8_t* src, cp_pixel_t* dst, const uint8_t* plte, const uint8_t* trns, uint32_t trns_len)
+static void cp_depalette(int w, int h, uint8_t* src, cp_pixel_t* dst, const uint8_t* plte, uint32_t plte_len, const uint8_t* trns, uint32_t trns_len, int premultiply)
 {
+	// Look up the palette once up front, premultiplied if asked, rather than for every pixel.
+	cp_pixel_t palette[256];
+	for (int c = 0; c < 256; ++c)
+	{
+		if ((uint32_t)c * 3 + 2 >= plte_len)
+		{
+			// Out of range indices are invalid, make them black rather than read past the PLTE chunk.
+			palette[c] = cp_make_pixel_a(0, 0, 0, cp_get_alpha_for_indexed_image(c, trns, trns_len));
+			continue;
+		}
+		uint8_t r = plte[c * 3];
+		uint8_t g = plte[c * 3 + 1];
+		uint8_t b = plte[c * 3 + 2];
+		uint8_t a = cp_get_alpha_for_indexed_image(c, trns, trns_len);
+		palette[c] = cp_make_pixel_a(r, g, b, a);
+	}
+	if (premultiply) cp_premultiply_row(palette, 256);
+
 	for (int y = 0; y < h; ++y)
 	{
 		// skip filter byte
@@ -1062,12 +1257,7 @@ static void cp_depalette(int w, int h, uint8_t* src, cp_pixel_t* dst, const uint
 
 		for (int x = 0; x < w; ++x, ++src)
 		{
-			int c = *src;
-			uint8_t r = plte[c * 3];
-			uint8_t g = plte[c * 3 + 1];
-			uint8_t b = plte[c * 3 + 2];
-			uint8_t a = cp_get_alpha_for_indexed_image(c, trns, trns_len);
-			*dst++ = cp_make_pixel_a(r, g, b, a);
+			*dst++ = palette[*src];
 		}
 	}
 }
@@ -1082,7 +1272,7 @@ static int cp_out_size(cp_image_t* img, int bpp)
 	return (img->w + 1) * img->h * bpp;
 }
 
-cp_image_t cp_load_png_mem(const void* png_data, int png_length)
+static cp_image_t cp_load_png_mem_internal(const void* png_data, int png_length, int premultiply)
 {
 	const char* sig = "\211PNG\r\n\032\n";
 	const uint8_t* ihdr, *first, *plte, *trns;
@@ -1181,10 +1371,11 @@ cp_image_t cp_load_png_mem(const void* png_data, int png_length)
 	if (color_type == 3)
 	{
 		CUTE_PNG_CHECK(plte, "color type of indexed requires a PLTE chunk");
+		uint32_t plte_len = cp_get_chunk_byte_length(plte);
 		uint32_t trns_len = trns ? cp_get_chunk_byte_length(trns) : 0;
-		cp_depalette(img.w, img.h, out, img.pix, plte, trns, trns_len);
+		cp_depalette(img.w, img.h, out, img.pix, plte, plte_len, trns, trns_len, premultiply);
 	}
-	else cp_convert(bpp, img.w, img.h, out, img.pix);
+	else cp_convert(bpp, img.w, img.h, out, img.pix, premultiply);
 
 	CUTE_PNG_FREE(data);
 	return img;
@@ -1197,6 +1388,16 @@ cp_err:
 	return img;
 }
 
+cp_image_t cp_load_png_mem(const void* png_data, int png_length)
+{
+	return cp_load_png_mem_internal(png_data, png_length, 0);
+}
+
+cp_image_t cp_load_png_mem_premultiplied(const void* png_data, int png_length)
+{
+	return cp_load_png_mem_internal(png_data, png_length, 1);
+}
+
 cp_image_t cp_load_blank(int w, int h)
 {
 	cp_image_t img;
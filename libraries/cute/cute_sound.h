@@ -256,6 +256,9 @@ typedef enum cs_error_t
 	CUTE_SOUND_ERROR_TRIED_TO_SET_SAMPLE_INDEX_BEYOND_THE_AUDIO_SOURCES_SAMPLE_COUNT,
 	CUTE_SOUND_ERROR_STB_VORBIS_DECODE_FAILED,
 	CUTE_SOUND_ERROR_OGG_UNSUPPORTED_CHANNEL_COUNT,
+	CUTE_SOUND_ERROR_AUDIO_SOURCE_IS_PLAYING,
+	CUTE_SOUND_ERROR_AUDIO_SOURCE_CANNOT_BE_CONVERTED,
+	CUTE_SOUND_ERROR_HEADLESS_REQUIRES_SDL,
 } cs_error_t;
 
 const char* cs_error_as_string(cs_error_t error);
@@ -269,8 +272,21 @@ const char* cs_error_as_string(cs_error_t error);
  * buffered_samples is clamped to be at least 1024.
  */
 cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_samples, void* user_allocator_context /* = NULL */);
+
+/**
+ * Same as `cs_init`, but without opening an audio device. Nothing plays, pull mixed samples out with
+ * `cs_render` instead. Meant for benchmarks, tests and offline rendering. Only on the SDL backend.
+ */
+cs_error_t cs_init_headless(unsigned play_frequency_in_Hz, int buffered_samples, void* user_allocator_context /* = NULL */);
 void cs_shutdown();
 
+/**
+ * Mixes `sample_count` stereo samples into `out`, as interleaved 16-bit pairs, right away. Use after
+ * `cs_init_headless`, as an audio device would otherwise take some of the samples for itself. Mixes one
+ * block of `buffered_samples` at a time, same as the mixing thread.
+ */
+void cs_render(int16_t* out, int sample_count);
+
 /**
  * Call this function once per game-tick.
  */
@@ -291,6 +307,28 @@ void cs_spawn_mix_thread();
  */
 void cs_mix_thread_sleep_delay(int milliseconds);
 
+/**
+ * Timing and load of the mixer, for checking whether a buffer size is safe on some hardware.
+ */
+typedef struct cs_mixer_stats_t
+{
+	int mix_count;           // Number of blocks mixed so far.
+	float mix_seconds;       // Time spent mixing the latest block.
+	int block_sample_count;  // Samples per channel in the latest block.
+	float peak_load;         // Highest time spent mixing a block divided by the time the block plays for. Above 1 the mixer falls behind.
+	int underrun_count;      // Number of times the device asked for samples before they were mixed, playing silence instead. Not tracked on DirectSound.
+	int voice_count;         // Sounds, including music, mixed in the latest block.
+	int virtual_voice_count; // Sounds skipped in the latest block, see `cs_set_max_voices`.
+	int buffered_samples;    // Samples per channel the mixer keeps ahead of the device, as passed to `cs_init`.
+} cs_mixer_stats_t;
+
+cs_mixer_stats_t cs_get_mixer_stats();
+
+/**
+ * Zeroes the counters and peak load in the mixer stats.
+ */
+void cs_reset_mixer_stats();
+
 /**
  * Sometimes useful for dynamic library shenanigans.
  */
@@ -313,6 +351,11 @@ void cs_free_audio_source(cs_audio_source_t* audio);
 	cs_audio_source_t* cs_load_ogg(const char* path, cs_error_t* err /* = NULL */);
 	cs_audio_source_t* cs_read_mem_ogg(const void* memory, size_t size, cs_error_t* err /* = NULL */);
 
+	// Streams an OGG instead of decoding it all up front. Only the compressed file (copied from `memory`) and
+	// a small window of decoded samples around the play cursor are kept in memory, and the mixer decodes more
+	// as the window runs out. Meant for music, so play just one instance at a time, and not backwards.
+	cs_audio_source_t* cs_read_mem_ogg_stream(const void* memory, size_t size, cs_error_t* err /* = NULL */);
+
 #endif
 
 // SDL_RWops specific functions
@@ -337,6 +380,30 @@ int cs_get_sample_rate(const cs_audio_source_t* audio);
 int cs_get_sample_count(const cs_audio_source_t* audio);
 int cs_get_channel_count(const cs_audio_source_t* audio);
 
+// -------------------------------------------------------------------------------------------------
+// Audio source conversions.
+// These change a loaded audio source in place, so call them right after loading, before playing it.
+
+typedef enum cs_resample_quality_t
+{
+	CUTE_SOUND_RESAMPLE_QUALITY_LINEAR,
+	CUTE_SOUND_RESAMPLE_QUALITY_CUBIC,
+} cs_resample_quality_t;
+
+// The rate the mixer plays every audio source at, as passed to `cs_init`. Sources recorded at another
+// rate play sped up or slowed down, unless resampled with `cs_resample`.
+int cs_get_mixer_sample_rate();
+
+// Resamples the audio to `sample_rate`, usually `cs_get_mixer_sample_rate()`. Cubic sounds cleaner than
+// linear, but takes a little longer. There's no filtering, so downsampling can alias high frequencies.
+// Doesn't work on streamed or compressed audio.
+cs_error_t cs_resample(cs_audio_source_t* audio, int sample_rate, cs_resample_quality_t quality /* = CUTE_SOUND_RESAMPLE_QUALITY_CUBIC */);
+
+// Compresses the samples to 4-bit IMA ADPCM, which takes about an eighth of the memory. The mixer decodes
+// just the samples it needs each mix, which is cheap, but a little lossy. Meant for short sound effects
+// kept in memory. Compressed audio can't be played backwards (negative pitch). Doesn't work on streamed audio.
+cs_error_t cs_compress_adpcm(cs_audio_source_t* audio);
+
 // -------------------------------------------------------------------------------------------------
 // Music sounds.
 
@@ -366,6 +433,11 @@ typedef struct cs_sound_params_t
 	float pan    /* = 0.5f */; // Can be from 0 to 1.
 	float pitch  /* = 1.0f */;
 	int sample_index /* = 0 */;
+	float priority /* = 0 */; // Higher priority sounds keep their voice when over `cs_set_max_voices`.
+	int bus /* = 0 */; // Which bus to mix into, see `cs_bus_set_volume`.
+	bool spatial /* = false */; // Attenuates and pans the sound by its position, see `cs_set_listener_position`.
+	float x /* = 0 */;
+	float y /* = 0 */;
 } cs_sound_params_t;
 
 cs_sound_params_t cs_sound_params_default();
@@ -386,6 +458,26 @@ void cs_on_sound_finished_callback(void (*on_finish)(cs_playing_sound_t, void*),
  */
 void cs_on_music_finished_callback(void (*on_finish)(void*), void* udata);
 
+/**
+ * Off by default. When enabled, the mixer queues up finished sounds and songs instead of calling the
+ * callbacks from `cs_on_sound_finished_callback` or `cs_on_music_finished_callback`. Pop them with
+ * `cs_pop_finished_sound` from the thread of your choice. The queue holds `CUTE_SOUND_FINISHED_CAPACITY`
+ * sounds, past which finished sounds are dropped rather than make the mixer wait.
+ */
+void cs_queue_finished_sounds(bool true_to_queue);
+
+/**
+ * Pops the oldest sound queued up by `cs_queue_finished_sounds`. Returns false when the queue is empty.
+ * `is_music` can be NULL, otherwise it's set to true for a song from the `cs_music_*` functions. Call
+ * this from just one thread. Never blocks on the mixer.
+ */
+bool cs_pop_finished_sound(cs_playing_sound_t* sound, bool* is_music);
+
+/**
+ * The `cs_sound_set_*` functions, `cs_sound_stop` and `cs_set_listener_position` never wait on the mixer.
+ * They queue up their change and the mixer applies it at the start of its next mix, so the getters
+ * below report the old value until then. Call them from just one thread.
+ */
 bool cs_sound_is_active(cs_playing_sound_t sound);
 bool cs_sound_get_is_paused(cs_playing_sound_t sound);
 bool cs_sound_get_is_looped(cs_playing_sound_t sound);
@@ -400,6 +492,9 @@ void cs_sound_set_pan(cs_playing_sound_t sound, float pan_0_to_1);
 void cs_sound_set_pitch(cs_playing_sound_t sound, float pitch);
 cs_error_t cs_sound_set_sample_index(cs_playing_sound_t sound, int sample_index);
 void cs_sound_stop(cs_playing_sound_t sound);
+float cs_sound_get_priority(cs_playing_sound_t sound);
+void cs_sound_set_priority(cs_playing_sound_t sound, float priority);
+bool cs_sound_is_virtual(cs_playing_sound_t sound);
 
 void cs_set_playing_sounds_volume(float volume_0_to_1);
 void cs_stop_all_playing_sounds();
@@ -412,6 +507,88 @@ void cs_stop_all_playing_sounds();
  */
 void cs_cull_duplicates(bool true_to_enable);
 
+/**
+ * Off (zero) by default. Caps how many sounds get mixed at once, not counting music. Each update the
+ * sounds with the highest priority are mixed, then the loudest among equal priorities, then the oldest.
+ * The rest become "virtual": they aren't mixed, but keep advancing their sample index so they pick up
+ * at the right spot once a voice frees up. Lower the volume of far away sounds to have them give up
+ * their voice first. Sounds too quiet to hear are always virtual, even with no cap.
+ */
+void cs_set_max_voices(int max_voices);
+
+// -------------------------------------------------------------------------------------------------
+// Buses.
+
+#ifndef CUTE_SOUND_BUS_COUNT
+#	define CUTE_SOUND_BUS_COUNT 8
+#endif
+
+/**
+ * Sounds and music are mixed into one of `CUTE_SOUND_BUS_COUNT` buses, bus 0 by default, for example one
+ * bus each for sound FX, music, UI and voice. Pick a sound's bus with `cs_sound_params_t::bus`, and the
+ * music's with `cs_music_set_bus`. Each update a bus runs its effects once over the sum of its sounds,
+ * rather than once per sound, then all buses are added together. Bus effects apply on top of the volume
+ * of each sound, as well as the global volume settings.
+ */
+void cs_bus_set_volume(int bus, float volume_0_to_1);
+float cs_bus_get_volume(int bus);
+
+/**
+ * Cutoff frequency in Hz of a gentle one-pole low-pass filter, for example to muffle sounds under water.
+ * Zero turns the filter off, which is the default.
+ */
+void cs_bus_set_low_pass(int bus, float cutoff_Hz);
+
+/**
+ * Lowers the volume of `bus` by `amount_0_to_1` while anything audible plays on `sidechain_bus`, for
+ * example to lower music under dialogue. The volume comes back up over `release_seconds` once the
+ * sidechain goes quiet. Pass -1 as `sidechain_bus` to turn ducking off, which is the default.
+ */
+void cs_bus_set_ducking(int bus, int sidechain_bus, float amount_0_to_1, float release_seconds);
+
+void cs_music_set_bus(int bus);
+
+// -------------------------------------------------------------------------------------------------
+// Spatial sounds.
+
+typedef enum cs_attenuation_t
+{
+	CUTE_SOUND_ATTENUATION_NONE,        // Volume doesn't change with distance, only pan.
+	CUTE_SOUND_ATTENUATION_LINEAR,      // Fades out in a straight line, silent at `max_distance` for a rolloff of 1.
+	CUTE_SOUND_ATTENUATION_INVERSE,     // Halves at twice `min_distance` for a rolloff of 1, like sound in the real world.
+	CUTE_SOUND_ATTENUATION_EXPONENTIAL, // Like inverse, but the rolloff is an exponent, for steeper falloff.
+} cs_attenuation_t;
+
+typedef struct cs_attenuation_params_t
+{
+	cs_attenuation_t model /* = CUTE_SOUND_ATTENUATION_LINEAR */;
+	float min_distance /* = 64 */;  // Closer than this sounds play at full volume.
+	float max_distance /* = 1024 */; // Further than this sounds stop getting quieter.
+	float rolloff /* = 1 */;        // How quickly volume drops off between the two.
+	float pan_distance /* = 512 */;  // Sounds this far to the left or right of the listener play in only one speaker.
+} cs_attenuation_params_t;
+
+cs_attenuation_params_t cs_attenuation_params_default();
+
+/**
+ * Spatial sounds have a position, and each update the mixer sets their volume and pan from where they are
+ * relative to the listener, all in one pass. Pick the falloff with `cs_set_attenuation`. The volume from
+ * distance applies on top of the sound's own volume, but the pan from position replaces the sound's pan.
+ * Sounds too far away to hear become virtual, see `cs_set_max_voices`.
+ */
+void cs_set_listener_position(float x, float y);
+void cs_set_attenuation(cs_attenuation_params_t params);
+
+/**
+ * Moves a sound, making it spatial if it wasn't already.
+ */
+void cs_sound_set_position(cs_playing_sound_t sound, float x, float y);
+
+/**
+ * Moves many sounds at once. `xy` holds `count` pairs of x and y.
+ */
+void cs_sound_set_positions(const cs_playing_sound_t* sounds, const float* xy, int count);
+
 // -------------------------------------------------------------------------------------------------
 // Global context.
 
@@ -462,6 +639,74 @@ void cs_set_global_user_allocator_context(void* user_allocator_context);
 #	define CUTE_SOUND_MEMCMP memcmp
 #endif
 
+#ifndef CUTE_SOUND_MEMMOVE
+#	include <string.h>
+#	define CUTE_SOUND_MEMMOVE memmove
+#endif
+
+#ifndef CUTE_SOUND_QSORT
+#	include <stdlib.h>
+#	define CUTE_SOUND_QSORT qsort
+#endif
+
+#ifndef CUTE_SOUND_EXPF
+#	include <math.h>
+#	define CUTE_SOUND_EXPF expf
+#endif
+
+#ifndef CUTE_SOUND_POWF
+#	include <math.h>
+#	define CUTE_SOUND_POWF powf
+#endif
+
+#ifndef CUTE_SOUND_SQRTF
+#	include <math.h>
+#	define CUTE_SOUND_SQRTF sqrtf
+#endif
+
+// Fewest samples per channel a streamed source decodes ahead of the play cursor.
+#ifndef CUTE_SOUND_STREAM_WINDOW
+#	define CUTE_SOUND_STREAM_WINDOW (1024 * 16)
+#endif
+
+// Samples per channel in each block of ADPCM compressed audio. Each block starts over from a stored
+// sample, so the mixer can decode from any block, but spends 4 bytes per block per channel doing so.
+#ifndef CUTE_SOUND_ADPCM_BLOCK
+#	define CUTE_SOUND_ADPCM_BLOCK 256
+#endif
+
+// Parameter changes the `cs_sound_set_*` functions can queue up for the mixer. Must be a power of two.
+#ifndef CUTE_SOUND_COMMAND_CAPACITY
+#	define CUTE_SOUND_COMMAND_CAPACITY 4096
+#endif
+
+// Finished sounds the mixer can queue up for `cs_pop_finished_sound`. Must be a power of two.
+#ifndef CUTE_SOUND_FINISHED_CAPACITY
+#	define CUTE_SOUND_FINISHED_CAPACITY 1024
+#endif
+
+// Acquire loads and release stores of the indices shared by the mixer and the game thread.
+#ifndef CUTE_SOUND_ATOMIC_LOAD
+#	if defined(_MSC_VER)
+#		include <intrin.h>
+#		define CUTE_SOUND_ATOMIC_LOAD(ptr) ((unsigned)_InterlockedOr((volatile long*)(ptr), 0))
+#		define CUTE_SOUND_ATOMIC_STORE(ptr, value) _InterlockedExchange((volatile long*)(ptr), (long)(value))
+#	else
+#		define CUTE_SOUND_ATOMIC_LOAD(ptr) __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#		define CUTE_SOUND_ATOMIC_STORE(ptr, value) __atomic_store_n(ptr, value, __ATOMIC_RELEASE)
+#	endif
+#endif
+
+// Sounds quieter than this wouldn't change a single bit of 16-bit output, so they aren't mixed.
+#ifndef CUTE_SOUND_INAUDIBLE_VOLUME
+#	define CUTE_SOUND_INAUDIBLE_VOLUME (1.0f / 32768.0f)
+#endif
+
+// A sidechain bus at least this loud, as a root mean square of 16-bit samples, ducks other buses.
+#ifndef CUTE_SOUND_DUCK_THRESHOLD
+#	define CUTE_SOUND_DUCK_THRESHOLD 32.0f
+#endif
+
 #ifndef CUTE_SOUND_SEEK_SET
 #	include <stdio.h>
 #	define CUTE_SOUND_SEEK_SET SEEK_SET
@@ -1361,6 +1606,9 @@ const char* cs_error_as_string(cs_error_t error) {
 	case CUTE_SOUND_ERROR_TRIED_TO_SET_SAMPLE_INDEX_BEYOND_THE_AUDIO_SOURCES_SAMPLE_COUNT: return "CUTE_SOUND_ERROR_TRIED_TO_SET_SAMPLE_INDEX_BEYOND_THE_AUDIO_SOURCES_SAMPLE_COUNT";
 	case CUTE_SOUND_ERROR_STB_VORBIS_DECODE_FAILED: return "CUTE_SOUND_ERROR_STB_VORBIS_DECODE_FAILED";
 	case CUTE_SOUND_ERROR_OGG_UNSUPPORTED_CHANNEL_COUNT: return "CUTE_SOUND_ERROR_OGG_UNSUPPORTED_CHANNEL_COUN";
+	case CUTE_SOUND_ERROR_AUDIO_SOURCE_IS_PLAYING: return "CUTE_SOUND_ERROR_AUDIO_SOURCE_IS_PLAYING";
+	case CUTE_SOUND_ERROR_AUDIO_SOURCE_CANNOT_BE_CONVERTED: return "CUTE_SOUND_ERROR_AUDIO_SOURCE_CANNOT_BE_CONVERTED";
+	case CUTE_SOUND_ERROR_HEADLESS_REQUIRES_SDL: return "CUTE_SOUND_ERROR_HEADLESS_REQUIRES_SDL";
 	default: return "UNKNOWN";
 	}
 }
@@ -1380,10 +1628,36 @@ typedef struct cs_audio_source_t
 	// updated whenever playing instances are inserted into the context.
 	int playing_count;
 
-	// The actual raw audio samples in memory.
+	// The actual raw audio samples in memory. For streamed sources, only the window of samples
+	// starting at `stream->window_start`.
 	void* channels[2];
+
+	// NULL unless the audio is decoded bit by bit while playing, see `cs_read_mem_ogg_stream`.
+	struct cs_stream_t* stream;
+
+	// NULL unless compressed by `cs_compress_adpcm`, in which case `channels` are NULL.
+	uint8_t* adpcm;
+
+	// The samples belong to someone else, such as a sound bank, so they're never freed or converted.
+	bool borrowed;
 } cs_audio_source_t;
 
+typedef struct cs_stream_t
+{
+	// Decodes up to `count` samples per channel into `channels`, returning how many were decoded.
+	int (*read)(void* udata, float** channels, int count);
+	// Moves the decoder to a sample index.
+	void (*seek)(void* udata, int sample_index);
+	void (*free)(void* udata);
+	void* udata;
+
+	// Index of the first sample in the window, always a multiple of 4.
+	int window_start;
+	// Number of decoded samples in the window. The rest of the window reads as silence.
+	int window_count;
+	int capacity;
+} cs_stream_t;
+
 typedef struct cs_sound_inst_t
 {
 	uint64_t id;
@@ -1396,10 +1670,65 @@ typedef struct cs_sound_inst_t
 	float pan1;
 	float pitch;
 	int sample_index;
+	float priority;
+	bool is_virtual;
+	int bus;
+	bool spatial;
+	float x;
+	float y;
+	float gain; // Volume from distance to the listener, 1 for sounds that aren't spatial.
 	cs_audio_source_t* audio;
 	cs_list_node_t node;
 } cs_sound_inst_t;
 
+typedef struct cs_bus_t
+{
+	cs__m128* floatA;
+	cs__m128* floatB;
+	bool used;
+	float level;
+	float volume;
+	float gain;
+	float low_pass_Hz;
+	float low_pass_alpha;
+	float low_passA;
+	float low_passB;
+	int duck_bus;
+	float duck_amount;
+	float duck_release;
+	float duck_gain;
+} cs_bus_t;
+
+typedef enum cs_command_type_t
+{
+	CUTE_SOUND_COMMAND_PAUSED,
+	CUTE_SOUND_COMMAND_LOOPED,
+	CUTE_SOUND_COMMAND_VOLUME,
+	CUTE_SOUND_COMMAND_PAN,
+	CUTE_SOUND_COMMAND_PITCH,
+	CUTE_SOUND_COMMAND_SAMPLE_INDEX,
+	CUTE_SOUND_COMMAND_STOP,
+	CUTE_SOUND_COMMAND_PRIORITY,
+	CUTE_SOUND_COMMAND_POSITION,
+	CUTE_SOUND_COMMAND_LISTENER,
+} cs_command_type_t;
+
+// A parameter change for the mixer to apply to a playing sound, see `cs_push_command`.
+typedef struct cs_command_t
+{
+	cs_command_type_t type;
+	uint64_t id;
+	float x;
+	float y;
+	int i;
+} cs_command_t;
+
+typedef struct cs_finished_t
+{
+	uint64_t id;
+	bool is_music;
+} cs_finished_t;
+
 typedef enum cs_music_state_t
 {
 	CUTE_SOUND_MUSIC_STATE_NONE,
@@ -1432,6 +1761,26 @@ typedef struct cs_context_t
 	void** duplicates /* = NULL */;
 	int duplicate_count /* = 0 */;
 	int duplicate_capacity /* = 0 */;
+	int max_voices /* = 0 */;
+	cs_sound_inst_t** voices /* = NULL */;
+	int voice_capacity /* = 0 */;
+	cs_bus_t buses[CUTE_SOUND_BUS_COUNT];
+	int music_bus /* = 0 */;
+	float listener_x /* = 0 */;
+	float listener_y /* = 0 */;
+	cs_attenuation_params_t attenuation;
+	float* adpcmA /* = NULL */;
+	float* adpcmB /* = NULL */;
+	int adpcm_capacity /* = 0 */;
+	// Single producer single consumer rings. The game thread pushes commands, the mixer pops them. The
+	// mixer pushes finished sounds, the game thread pops them. Indices only ever count up.
+	cs_command_t commands[CUTE_SOUND_COMMAND_CAPACITY];
+	unsigned command_read /* = 0 */;
+	unsigned command_write /* = 0 */;
+	cs_finished_t finished[CUTE_SOUND_FINISHED_CAPACITY];
+	unsigned finished_read /* = 0 */;
+	unsigned finished_write /* = 0 */;
+	bool queue_finished /* = false */;
 	void (*on_finish)(cs_playing_sound_t, void*); /* = NULL */;
 	void* on_finish_udata /* = NULL */;
 	void (*on_music_finish)(void*); /* = NULL */;
@@ -1466,6 +1815,7 @@ typedef struct cs_context_t
 	bool separate_thread;
 	bool running;
 	int sleep_milliseconds;
+	cs_mixer_stats_t stats;
 
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
 
@@ -1523,6 +1873,23 @@ void cs_sleep(int milliseconds)
 #endif
 }
 
+// Reads a high resolution clock, in seconds.
+static double cs_seconds()
+{
+#if CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
+	LARGE_INTEGER counter, frequency;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	return (double)counter.QuadPart / (double)frequency.QuadPart;
+#elif CUTE_SOUND_PLATFORM == CUTE_SOUND_APPLE
+	mach_timebase_info_data_t timebase;
+	mach_timebase_info(&timebase);
+	return (double)mach_absolute_time() * timebase.numer / timebase.denom * 1.0e-9;
+#elif CUTE_SOUND_PLATFORM == CUTE_SOUND_SDL
+	return (double)SDL_GetPerformanceCounter() / (double)SDL_GetPerformanceFrequency();
+#endif
+}
+
 static void* cs_malloc16(size_t size)
 {
 	void* p = CUTE_SOUND_ALLOC(size + 16, s_mem_ctx);
@@ -1540,6 +1907,151 @@ static void cs_free16(void* p)
 	CUTE_SOUND_FREE((char*)p - (((size_t)*((char*)p - 1)) & 0xFF), s_mem_ctx);
 }
 
+static void cs_free_audio_source_memory(cs_audio_source_t* audio)
+{
+	cs_free16(audio->channels[0]);
+	if (audio->stream) {
+		audio->stream->free(audio->stream->udata);
+		CUTE_SOUND_FREE(audio->stream, s_mem_ctx);
+	}
+	CUTE_SOUND_FREE(audio->adpcm, s_mem_ctx);
+	CUTE_SOUND_FREE(audio, s_mem_ctx);
+}
+
+static const int cs_adpcm_step_table[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+	337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int cs_adpcm_index_table[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+// Bytes per block per channel: the starting sample, the step index, a byte of padding, then a nibble for each other sample.
+#define CUTE_SOUND_ADPCM_BLOCK_BYTES (4 + CUTE_SOUND_ADPCM_BLOCK / 2)
+
+// Applies one 4-bit code to the predicted sample and step index.
+static void cs_adpcm_step(int* predictor, int* index, int code)
+{
+	int step = cs_adpcm_step_table[*index];
+	int delta = step >> 3;
+	if (code & 4) delta += step;
+	if (code & 2) delta += step >> 1;
+	if (code & 1) delta += step >> 2;
+	int p = *predictor + ((code & 8) ? -delta : delta);
+	*predictor = p < -32768 ? -32768 : p > 32767 ? 32767 : p;
+	int i = *index + cs_adpcm_index_table[code];
+	*index = i < 0 ? 0 : i > 88 ? 88 : i;
+}
+
+static int cs_adpcm_block_count(const cs_audio_source_t* audio)
+{
+	return (audio->sample_count + CUTE_SOUND_ADPCM_BLOCK - 1) / CUTE_SOUND_ADPCM_BLOCK;
+}
+
+// Decodes the blocks covering `count` samples from `sample_index` on into the mixer's scratch buffers,
+// returning the index of the first decoded sample. Samples past the end of the audio read as silence.
+static int cs_adpcm_decode(cs_audio_source_t* audio, int sample_index, int count)
+{
+	int block_count = cs_adpcm_block_count(audio);
+	int first = sample_index / CUTE_SOUND_ADPCM_BLOCK;
+	if (first > block_count - 1) first = block_count - 1;
+	int end = sample_index + count;
+	int last = (end + CUTE_SOUND_ADPCM_BLOCK - 1) / CUTE_SOUND_ADPCM_BLOCK;
+	if (last > block_count) last = block_count;
+	if (last <= first) last = first + 1;
+	int window_start = first * CUTE_SOUND_ADPCM_BLOCK;
+	int decoded = (last - first) * CUTE_SOUND_ADPCM_BLOCK;
+	int needed = end - window_start > decoded ? end - window_start : decoded;
+	int capacity = (int)CUTE_SOUND_ALIGN(needed + 8, 4);
+
+	if (capacity > s_ctx->adpcm_capacity) {
+		cs_free16(s_ctx->adpcmA);
+		s_ctx->adpcmA = (float*)cs_malloc16(sizeof(float) * capacity * 2);
+		s_ctx->adpcmB = s_ctx->adpcmA + capacity;
+		s_ctx->adpcm_capacity = capacity;
+	}
+
+	for (int c = 0; c < audio->channel_count; ++c) {
+		float* out = c ? s_ctx->adpcmB : s_ctx->adpcmA;
+		for (int b = first; b < last; ++b) {
+			const uint8_t* block = audio->adpcm + ((size_t)b * audio->channel_count + c) * CUTE_SOUND_ADPCM_BLOCK_BYTES;
+			int predictor = (int16_t)(block[0] | (block[1] << 8));
+			int index = block[2];
+			const uint8_t* codes = block + 4;
+			*out++ = (float)predictor;
+			for (int i = 1; i < CUTE_SOUND_ADPCM_BLOCK; ++i) {
+				int code = (codes[(i - 1) >> 1] >> (((i - 1) & 1) * 4)) & 0xF;
+				cs_adpcm_step(&predictor, &index, code);
+				*out++ = (float)predictor;
+			}
+		}
+		float* channel = c ? s_ctx->adpcmB : s_ctx->adpcmA;
+		int tail = audio->sample_count - window_start;
+		if (tail > decoded) tail = decoded;
+		CUTE_SOUND_MEMSET(channel + tail, 0, sizeof(float) * (capacity - tail));
+	}
+
+	return window_start;
+}
+
+// Makes sure a streamed source's window holds `count` samples from `sample_index` on, decoding as needed.
+static void cs_stream_prepare(cs_audio_source_t* audio, int sample_index, int count)
+{
+	cs_stream_t* stream = audio->stream;
+	int start = (int)CUTE_SOUND_TRUNC(sample_index, 4);
+	int end = start + count + 8;
+	int decoded_end = end < audio->sample_count ? end : audio->sample_count;
+	if (start >= stream->window_start && decoded_end <= stream->window_start + stream->window_count && end <= stream->window_start + stream->capacity) {
+		return;
+	}
+
+	// Room for a few mixes worth of samples, so the window slides along only every so often.
+	int capacity = (int)CUTE_SOUND_ALIGN(count * 4 + 8, 4);
+	if (capacity < CUTE_SOUND_STREAM_WINDOW) capacity = CUTE_SOUND_STREAM_WINDOW;
+	if (capacity > stream->capacity) {
+		float* a = (float*)cs_malloc16(sizeof(float) * capacity * 2);
+		float* b = a + capacity;
+		if (stream->window_count) {
+			CUTE_SOUND_MEMCPY(a, audio->channels[0], sizeof(float) * stream->window_count);
+			if (audio->channels[1]) CUTE_SOUND_MEMCPY(b, audio->channels[1], sizeof(float) * stream->window_count);
+		}
+		cs_free16(audio->channels[0]);
+		audio->channels[0] = a;
+		audio->channels[1] = audio->channel_count == 2 ? b : NULL;
+		stream->capacity = capacity;
+	}
+
+	if (start < stream->window_start || start > stream->window_start + stream->window_count) {
+		// Jumped elsewhere in the track, such as looping back to the start.
+		stream->seek(stream->udata, start);
+		stream->window_start = start;
+		stream->window_count = 0;
+	} else if (start > stream->window_start) {
+		// Slide the window forward, keeping the samples not played yet.
+		int drop = start - stream->window_start;
+		int keep = stream->window_count - drop;
+		for (int i = 0; i < audio->channel_count; ++i) {
+			float* channel = (float*)audio->channels[i];
+			CUTE_SOUND_MEMMOVE(channel, channel + drop, sizeof(float) * keep);
+		}
+		stream->window_start = start;
+		stream->window_count = keep;
+	}
+
+	while (stream->window_count < stream->capacity && stream->window_start + stream->window_count < audio->sample_count) {
+		float* out[2] = { (float*)audio->channels[0] + stream->window_count, audio->channels[1] ? (float*)audio->channels[1] + stream->window_count : NULL };
+		int decoded = stream->read(stream->udata, out, stream->capacity - stream->window_count);
+		if (decoded <= 0) break;
+		stream->window_count += decoded;
+	}
+	for (int i = 0; i < audio->channel_count; ++i) {
+		float* channel = (float*)audio->channels[i];
+		CUTE_SOUND_MEMSET(channel + stream->window_count, 0, sizeof(float) * (stream->capacity - stream->window_count));
+	}
+}
+
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_SDL || CUTE_SOUND_PLATFORM == CUTE_SOUND_APPLE
 
 	static int cs_samples_written()
@@ -1603,6 +2115,8 @@ static void cs_free16(void* p)
 			size = allowed_size;
 		}
 
+		if (zeros) s_ctx->stats.underrun_count++;
+
 		int samples_to_read = CUTE_SOUND_BYTES_TO_SAMPLES(size);
 		int samples_to_end = sample_count - index0;
 
@@ -1702,8 +2216,11 @@ static void s_add_page()
 	s_ctx->pages = page;
 }
 
-cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_samples, void* user_allocator_context /* = NULL */)
+static cs_error_t cs_init_impl(void* os_handle, unsigned play_frequency_in_Hz, int buffered_samples, void* user_allocator_context, bool open_device)
 {
+#if CUTE_SOUND_PLATFORM != CUTE_SOUND_SDL
+	if (!open_device) return CUTE_SOUND_ERROR_HEADLESS_REQUIRES_SDL;
+#endif
 	buffered_samples = buffered_samples < CUTE_SOUND_MINIMUM_BUFFERED_SAMPLES ? CUTE_SOUND_MINIMUM_BUFFERED_SAMPLES : buffered_samples;
 	int sample_count = buffered_samples;
 	int wide_count = (int)CUTE_SOUND_ALIGN(sample_count, 4);
@@ -1800,8 +2317,10 @@ cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_
 #elif CUTE_SOUND_PLATFORM == CUTE_SOUND_SDL
 
 	SDL_AudioSpec wanted, have;
-	int ret = SDL_InitSubSystem(SDL_INIT_AUDIO);
-	if (ret < 0) return CUTE_SOUND_ERROR_CANT_INIT_SDL_AUDIO;
+	if (open_device) {
+		int ret = SDL_InitSubSystem(SDL_INIT_AUDIO);
+		if (ret < 0) return CUTE_SOUND_ERROR_CANT_INIT_SDL_AUDIO;
+	}
 
 #endif
 
@@ -1814,6 +2333,11 @@ cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_
 	s_ctx->sound_volume = 1.0f;
 	s_ctx->music_looped = true;
 	s_ctx->music_paused = false;
+	s_ctx->command_read = 0;
+	s_ctx->command_write = 0;
+	s_ctx->finished_read = 0;
+	s_ctx->finished_write = 0;
+	s_ctx->queue_finished = false;
 	s_ctx->on_finish = NULL;
 	s_ctx->on_finish_udata = NULL;
 	s_ctx->on_music_finish = NULL;
@@ -1842,9 +2366,27 @@ cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_
 	s_ctx->floatA = (cs__m128*)cs_malloc16(sizeof(cs__m128) * wide_count);
 	s_ctx->floatB = (cs__m128*)cs_malloc16(sizeof(cs__m128) * wide_count);
 	s_ctx->samples = (cs__m128i*)cs_malloc16(sizeof(cs__m128i) * wide_count);
+	for (int i = 0; i < CUTE_SOUND_BUS_COUNT; ++i) {
+		cs_bus_t* bus = s_ctx->buses + i;
+		CUTE_SOUND_MEMSET(bus, 0, sizeof(*bus));
+		bus->floatA = (cs__m128*)cs_malloc16(sizeof(cs__m128) * wide_count);
+		bus->floatB = (cs__m128*)cs_malloc16(sizeof(cs__m128) * wide_count);
+		CUTE_SOUND_MEMSET(bus->floatA, 0, sizeof(cs__m128) * wide_count);
+		CUTE_SOUND_MEMSET(bus->floatB, 0, sizeof(cs__m128) * wide_count);
+		bus->volume = 1.0f;
+		bus->gain = 1.0f;
+		bus->duck_bus = -1;
+		bus->duck_gain = 1.0f;
+	}
+	s_ctx->music_bus = 0;
+	s_ctx->listener_x = 0;
+	s_ctx->listener_y = 0;
+	s_ctx->attenuation = cs_attenuation_params_default();
 	s_ctx->running = true;
 	s_ctx->separate_thread = false;
 	s_ctx->sleep_milliseconds = 0;
+	CUTE_SOUND_MEMSET(&s_ctx->stats, 0, sizeof(s_ctx->stats));
+	s_ctx->stats.buffered_samples = buffered_samples;
 
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
 
@@ -1884,9 +2426,12 @@ cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_
 	s_ctx->index1 = 0;
 	s_ctx->samples_in_circular_buffer = 0;
 	s_ctx->sample_count = wide_count * 4;
-	s_ctx->dev = SDL_OpenAudioDevice(NULL, 0, &wanted, &have, 0);
-	if (s_ctx->dev < 0) return CUTE_SOUND_ERROR_CANT_OPEN_AUDIO_DEVICE; // This leaks memory, oh well.
-	SDL_PauseAudioDevice(s_ctx->dev, 0);
+	s_ctx->dev = 0;
+	if (open_device) {
+		s_ctx->dev = SDL_OpenAudioDevice(NULL, 0, &wanted, &have, 0);
+		if (s_ctx->dev < 0) return CUTE_SOUND_ERROR_CANT_OPEN_AUDIO_DEVICE; // This leaks memory, oh well.
+		SDL_PauseAudioDevice(s_ctx->dev, 0);
+	}
 	s_ctx->mutex = SDL_CreateMutex();
 
 #endif
@@ -1894,9 +2439,25 @@ cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_
 	s_ctx->duplicate_count = 0;
 	s_ctx->duplicates = NULL;
 	s_ctx->cull_duplicates = false;
+	s_ctx->max_voices = 0;
+	s_ctx->voices = NULL;
+	s_ctx->voice_capacity = 0;
+	s_ctx->adpcmA = NULL;
+	s_ctx->adpcmB = NULL;
+	s_ctx->adpcm_capacity = 0;
 	return CUTE_SOUND_ERROR_NONE;
 }
 
+cs_error_t cs_init(void* os_handle, unsigned play_frequency_in_Hz, int buffered_samples, void* user_allocator_context)
+{
+	return cs_init_impl(os_handle, play_frequency_in_Hz, buffered_samples, user_allocator_context, true);
+}
+
+cs_error_t cs_init_headless(unsigned play_frequency_in_Hz, int buffered_samples, void* user_allocator_context)
+{
+	return cs_init_impl(NULL, play_frequency_in_Hz, buffered_samples, user_allocator_context, false);
+}
+
 void cs_lock();
 void cs_unlock();
 
@@ -1920,7 +2481,7 @@ void cs_shutdown()
 #elif CUTE_SOUND_PLATFORM == CUTE_SOUND_SDL
 
 	SDL_DestroyMutex(s_ctx->mutex);
-	SDL_CloseAudioDevice(s_ctx->dev);
+	if (s_ctx->dev) SDL_CloseAudioDevice(s_ctx->dev);
 
 #endif
 
@@ -1945,14 +2506,19 @@ void cs_shutdown()
 
 	for (int i = 0; i < s_ctx->audio_sources_to_free_size; ++i) {
 		cs_audio_source_t* audio = s_ctx->audio_sources_to_free[i];
-		cs_free16(audio->channels[0]);
-		CUTE_SOUND_FREE(audio, s_mem_ctx);
+		cs_free_audio_source_memory(audio);
 	}
 	CUTE_SOUND_FREE(s_ctx->audio_sources_to_free, s_mem_ctx);
 
 	cs_free16(s_ctx->floatA);
 	cs_free16(s_ctx->floatB);
 	cs_free16(s_ctx->samples);
+	for (int i = 0; i < CUTE_SOUND_BUS_COUNT; ++i) {
+		cs_free16(s_ctx->buses[i].floatA);
+		cs_free16(s_ctx->buses[i].floatB);
+	}
+	CUTE_SOUND_FREE(s_ctx->voices, s_mem_ctx);
+	cs_free16(s_ctx->adpcmA);
 	cs_hashtableterm(&s_ctx->instance_map);
 	CUTE_SOUND_FREE(s_ctx, s_mem_ctx);
 	s_ctx = NULL;
@@ -2083,6 +2649,24 @@ void cs_unlock()
 #endif
 }
 
+void cs_render(int16_t* out, int sample_count)
+{
+#if CUTE_SOUND_PLATFORM == CUTE_SOUND_SDL || CUTE_SOUND_PLATFORM == CUTE_SOUND_APPLE
+	while (sample_count > 0) {
+		cs_mix();
+		cs_lock();
+		int count = cs_samples_written();
+		if (count > sample_count) count = sample_count;
+		cs_pull_bytes(out, CUTE_SOUND_SAMPLES_TO_BYTES(count));
+		cs_unlock();
+		if (!count) break;
+		out += count * 2;
+		sample_count -= count;
+	}
+#endif
+	CUTE_SOUND_MEMSET(out, 0, sizeof(int16_t) * 2 * (sample_count > 0 ? sample_count : 0));
+}
+
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
 
 static void cs_dsound_get_bytes_to_fill(int* byte_to_lock, int* bytes_to_write)
@@ -2202,6 +2786,205 @@ void cs_dsound_dont_run_too_fast()
 
 #endif // CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
 
+static int cs_voice_compare(const void* a, const void* b)
+{
+	const cs_sound_inst_t* A = *(const cs_sound_inst_t**)a;
+	const cs_sound_inst_t* B = *(const cs_sound_inst_t**)b;
+	if (A->priority != B->priority) return A->priority > B->priority ? -1 : 1;
+	float volume_a = A->volume * A->gain;
+	float volume_b = B->volume * B->gain;
+	if (volume_a != volume_b) return volume_a > volume_b ? -1 : 1;
+	// Older sounds win ties, so new sounds don't keep cutting off ones already playing.
+	return A->id < B->id ? -1 : A->id > B->id ? 1 : 0;
+}
+
+static void cs_run_commands();
+static void cs_push_finished(uint64_t id, bool is_music);
+
+// Volume from distance to the listener, see `cs_set_attenuation`.
+static float cs_attenuate(float distance)
+{
+	cs_attenuation_params_t* params = &s_ctx->attenuation;
+	float min_distance = params->min_distance;
+	float max_distance = params->max_distance;
+	float d = distance < min_distance ? min_distance : distance > max_distance ? max_distance : distance;
+	float gain = 1.0f;
+	switch (params->model) {
+	case CUTE_SOUND_ATTENUATION_NONE: break;
+	case CUTE_SOUND_ATTENUATION_LINEAR:
+		if (max_distance > min_distance) gain = 1.0f - params->rolloff * (d - min_distance) / (max_distance - min_distance);
+		break;
+	case CUTE_SOUND_ATTENUATION_INVERSE:
+		gain = min_distance / (min_distance + params->rolloff * (d - min_distance));
+		break;
+	case CUTE_SOUND_ATTENUATION_EXPONENTIAL:
+		gain = CUTE_SOUND_POWF(d / min_distance, -params->rolloff);
+		break;
+	}
+	return gain < 0 ? 0 : gain > 1 ? 1 : gain;
+}
+
+// Sets the volume and pan of every spatial sound from its position relative to the listener.
+static void cs_spatialize()
+{
+	float pan_distance = s_ctx->attenuation.pan_distance;
+	cs_list_node_t* playing_node = cs_list_begin(&s_ctx->playing_sounds);
+	cs_list_node_t* end_node = cs_list_end(&s_ctx->playing_sounds);
+	do {
+		cs_sound_inst_t* playing = CUTE_SOUND_LIST_HOST(cs_sound_inst_t, node, playing_node);
+		playing_node = playing_node->next;
+		if (!playing->spatial) continue;
+		float dx = playing->x - s_ctx->listener_x;
+		float dy = playing->y - s_ctx->listener_y;
+		playing->gain = cs_attenuate(CUTE_SOUND_SQRTF(dx * dx + dy * dy));
+		float pan = pan_distance > 0 ? 0.5f + 0.5f * dx / pan_distance : 0.5f;
+		pan = pan < 0 ? 0 : pan > 1 ? 1 : pan;
+		playing->pan0 = 1.0f - pan;
+		playing->pan1 = pan;
+	} while (playing_node != end_node);
+}
+
+// Marks which sounds get mixed this update, see `cs_set_max_voices`.
+static void cs_assign_voices()
+{
+	if (cs_list_empty(&s_ctx->playing_sounds)) return;
+	int count = 0;
+	cs_list_node_t* playing_node = cs_list_begin(&s_ctx->playing_sounds);
+	cs_list_node_t* end_node = cs_list_end(&s_ctx->playing_sounds);
+	do {
+		cs_sound_inst_t* playing = CUTE_SOUND_LIST_HOST(cs_sound_inst_t, node, playing_node);
+		playing_node = playing_node->next;
+		playing->is_virtual = false;
+		if (playing->is_music || !playing->active || playing->paused || !playing->audio) continue;
+		if (playing->volume * playing->gain * s_ctx->sound_volume * s_ctx->global_volume < CUTE_SOUND_INAUDIBLE_VOLUME) {
+			playing->is_virtual = true;
+			continue;
+		}
+		if (s_ctx->max_voices <= 0) continue;
+		if (count == s_ctx->voice_capacity) {
+			int new_capacity = s_ctx->voice_capacity ? s_ctx->voice_capacity * 2 : 256;
+			cs_sound_inst_t** voices = (cs_sound_inst_t**)CUTE_SOUND_ALLOC(sizeof(cs_sound_inst_t*) * new_capacity, s_mem_ctx);
+			if (count) CUTE_SOUND_MEMCPY(voices, s_ctx->voices, sizeof(cs_sound_inst_t*) * count);
+			CUTE_SOUND_FREE(s_ctx->voices, s_mem_ctx);
+			s_ctx->voices = voices;
+			s_ctx->voice_capacity = new_capacity;
+		}
+		s_ctx->voices[count++] = playing;
+	} while (playing_node != end_node);
+
+	if (count <= s_ctx->max_voices) return;
+	CUTE_SOUND_QSORT(s_ctx->voices, count, sizeof(cs_sound_inst_t*), cs_voice_compare);
+	for (int i = s_ctx->max_voices; i < count; ++i) {
+		s_ctx->voices[i]->is_virtual = true;
+	}
+}
+
+// Moves a virtual sound along as if it were mixed. Returns false once a non-looping sound has ended.
+static bool cs_advance_virtual(cs_sound_inst_t* playing, int samples_needed)
+{
+	int sample_count = playing->audio->sample_count;
+	int sample_index = playing->sample_index + (int)(samples_needed * playing->pitch);
+	if (sample_index >= sample_count || sample_index < 0) {
+		if (!playing->looped) return false;
+		sample_index %= sample_count;
+		if (sample_index < 0) sample_index += sample_count;
+	}
+	playing->sample_index = sample_index;
+	return true;
+}
+
+// Mean square of a bus's samples across both channels, a measure of how loud it is.
+static float cs_bus_level(const cs_bus_t* bus, int wide)
+{
+	cs__m128 sum = cs_mm_set1_ps(0);
+	for (int i = 0; i < wide; ++i) {
+		sum = cs_mm_add_ps(sum, cs_mm_mul_ps(bus->floatA[i], bus->floatA[i]));
+		sum = cs_mm_add_ps(sum, cs_mm_mul_ps(bus->floatB[i], bus->floatB[i]));
+	}
+	float* f = (float*)&sum;
+	return (f[0] + f[1] + f[2] + f[3]) / (float)(wide * 8);
+}
+
+// The one-pole filter feeds each output into the next, so unlike the other effects it runs a sample at a time.
+static void cs_bus_low_pass(cs_bus_t* bus, int wide)
+{
+	float alpha = bus->low_pass_alpha;
+	float a = bus->low_passA;
+	float b = bus->low_passB;
+	float* fA = (float*)bus->floatA;
+	float* fB = (float*)bus->floatB;
+	for (int i = 0; i < wide * 4; ++i) {
+		a += alpha * (fA[i] - a);
+		b += alpha * (fB[i] - b);
+		fA[i] = a;
+		fB[i] = b;
+	}
+	bus->low_passA = a;
+	bus->low_passB = b;
+}
+
+// Runs each bus's effects over the sum of its sounds, and adds the buses into the final mix.
+static void cs_mix_buses(cs__m128* floatA, cs__m128* floatB, int samples)
+{
+	int wide = (int)CUTE_SOUND_ALIGN(samples, 4) / 4;
+	float dt = (float)samples / (float)s_ctx->Hz;
+
+	// Sidechains listen to a bus before its own effects, so buses can run in any order.
+	for (int i = 0; i < CUTE_SOUND_BUS_COUNT; ++i) {
+		cs_bus_t* bus = s_ctx->buses + i;
+		bus->level = bus->used ? cs_bus_level(bus, wide) : 0;
+	}
+
+	for (int i = 0; i < CUTE_SOUND_BUS_COUNT; ++i) {
+		cs_bus_t* bus = s_ctx->buses + i;
+		if (bus->duck_bus >= 0) {
+			float ducked = 1.0f - bus->duck_amount;
+			if (s_ctx->buses[bus->duck_bus].level > CUTE_SOUND_DUCK_THRESHOLD * CUTE_SOUND_DUCK_THRESHOLD) {
+				bus->duck_gain = ducked;
+			} else if (bus->duck_gain < 1.0f) {
+				bus->duck_gain = bus->duck_release > 0 ? bus->duck_gain + dt / bus->duck_release : 1.0f;
+				if (bus->duck_gain > 1.0f) bus->duck_gain = 1.0f;
+			}
+		} else {
+			bus->duck_gain = 1.0f;
+		}
+
+		// Ramp from the last update's gain to this one's over the update, so changes don't click.
+		float gain0 = bus->gain;
+		float gain1 = bus->volume * bus->duck_gain;
+		bus->gain = gain1;
+		if (!bus->used) {
+			// A filter on a silent bus would only be decaying towards zero anyway.
+			bus->low_passA = 0;
+			bus->low_passB = 0;
+			continue;
+		}
+
+		if (bus->low_pass_Hz > 0) cs_bus_low_pass(bus, wide);
+
+		if (gain0 == gain1) {
+			cs__m128 gain = cs_mm_set1_ps(gain1);
+			for (int j = 0; j < wide; ++j) {
+				floatA[j] = cs_mm_add_ps(floatA[j], cs_mm_mul_ps(bus->floatA[j], gain));
+				floatB[j] = cs_mm_add_ps(floatB[j], cs_mm_mul_ps(bus->floatB[j], gain));
+			}
+		} else {
+			float step = (gain1 - gain0) / (float)(wide * 4);
+			cs__m128 gain = cs_mm_set_ps(gain0 + step * 3, gain0 + step * 2, gain0 + step, gain0);
+			cs__m128 gain_step = cs_mm_set1_ps(step * 4);
+			for (int j = 0; j < wide; ++j) {
+				floatA[j] = cs_mm_add_ps(floatA[j], cs_mm_mul_ps(bus->floatA[j], gain));
+				floatB[j] = cs_mm_add_ps(floatB[j], cs_mm_mul_ps(bus->floatB[j], gain));
+				gain = cs_mm_add_ps(gain, gain_step);
+			}
+		}
+
+		CUTE_SOUND_MEMSET(bus->floatA, 0, sizeof(cs__m128) * s_ctx->wide_count);
+		CUTE_SOUND_MEMSET(bus->floatB, 0, sizeof(cs__m128) * s_ctx->wide_count);
+		bus->used = false;
+	}
+}
+
 void cs_mix()
 {
 	cs__m128i* samples;
@@ -2209,8 +2992,12 @@ void cs_mix()
 	cs__m128* floatB;
 	int samples_needed;
 	int write_offset = 0;
+	double mix_start;
+	int voice_count = 0;
+	int virtual_voice_count = 0;
 
 	cs_lock();
+	cs_run_commands();
 
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
 
@@ -2230,6 +3017,8 @@ void cs_mix()
 
 #endif
 
+	mix_start = cs_seconds();
+
 	// Clear mixer buffers.
 	floatA = s_ctx->floatA;
 	floatB = s_ctx->floatB;
@@ -2238,6 +3027,8 @@ void cs_mix()
 
 	// Mix all playing sounds into the mixer buffers.
 	if (!s_ctx->global_pause && !cs_list_empty(&s_ctx->playing_sounds)) {
+		cs_spatialize();
+		cs_assign_voices();
 		cs_list_node_t* playing_node = cs_list_begin(&s_ctx->playing_sounds);
 		cs_list_node_t* end_node = cs_list_end(&s_ctx->playing_sounds);
 		do {
@@ -2265,13 +3056,41 @@ void cs_mix()
 				s_ctx->duplicates[s_ctx->duplicate_count++] = (void*)audio;
 			}
 
+			if (playing->is_virtual) {
+				virtual_voice_count++;
+				if (cs_advance_virtual(playing, samples_needed)) goto get_next_playing_sound;
+				goto remove;
+			}
+			voice_count++;
+
 			// Jump here for looping sounds if we need to wrap-around the audio source
 			// and continue mixing more samples.
 			mix_more:
 
 			{
+				// Streamed and compressed audio only hold a window of samples, indexed from `window_start`.
+				int window_start = 0;
 				cs__m128* cA = (cs__m128*)audio->channels[0];
 				cs__m128* cB = (cs__m128*)audio->channels[1];
+				if (audio->stream || audio->adpcm) {
+					if (playing->pitch < 0) goto remove;
+					int pitch_margin = 4 * ((int)playing->pitch + 1);
+					int samples_to_prepare = (int)(samples_needed * playing->pitch) + pitch_margin;
+					if (audio->stream) {
+						cs_stream_prepare(audio, playing->sample_index, samples_to_prepare);
+						window_start = audio->stream->window_start;
+						cA = (cs__m128*)audio->channels[0];
+						cB = (cs__m128*)audio->channels[1];
+					} else {
+						window_start = cs_adpcm_decode(audio, playing->sample_index, samples_to_prepare);
+						cA = (cs__m128*)s_ctx->adpcmA;
+						cB = audio->channel_count == 2 ? (cs__m128*)s_ctx->adpcmB : NULL;
+					}
+				}
+				cs_bus_t* bus = s_ctx->buses + playing->bus;
+				cs__m128* busA = bus->floatA;
+				cs__m128* busB = bus->floatB;
+				bus->used = true;
 
 				// Attempted to play a sound with no audio.
 				// Make sure the audio file was loaded properly.
@@ -2279,8 +3098,8 @@ void cs_mix()
 
 				float gpan0 = 1.0f - s_ctx->global_pan;
 				float gpan1 = s_ctx->global_pan;
-				float vA0 = playing->volume * playing->pan0 * gpan0 * s_ctx->global_volume;
-				float vB0 = playing->volume * playing->pan1 * gpan1 * s_ctx->global_volume;
+				float vA0 = playing->volume * playing->gain * playing->pan0 * gpan0 * s_ctx->global_volume;
+				float vB0 = playing->volume * playing->gain * playing->pan1 * gpan1 * s_ctx->global_volume;
 				if (!playing->is_music) {
 					vA0 *= s_ctx->sound_volume;
 					vB0 *= s_ctx->sound_volume;
@@ -2292,7 +3111,7 @@ void cs_mix()
 				cs__m128 vB = cs_mm_set1_ps(vB0);
 
 				int prev_playing_sample_index = playing->sample_index;
-				int sample_index_wide = (int)CUTE_SOUND_TRUNC(playing->sample_index, 4) / 4;
+				int sample_index_wide = ((int)CUTE_SOUND_TRUNC(playing->sample_index, 4) - window_start) / 4;
 				int samples_to_read = (int)(samples_needed * playing->pitch);
 				if (samples_to_read + playing->sample_index > audio->sample_count) {
 					samples_to_read = audio->sample_count - playing->sample_index;
@@ -2312,7 +3131,7 @@ void cs_mix()
 					// Pitch shifting -- We read in samples at a resampled rate (multiply by pitch). These samples
 					// are read in one at a time in scalar mode, but then mixed together via SIMD.
 					cs__m128 pitch = cs_mm_set1_ps(playing->pitch);
-					cs__m128 index_offset = cs_mm_set1_ps((float)playing->sample_index);
+					cs__m128 index_offset = cs_mm_set1_ps((float)(playing->sample_index - window_start));
 					switch (audio->channel_count) {
 					case 1:
 					{
@@ -2342,8 +3161,8 @@ void cs_mix()
 							cs__m128 A = cs_mm_add_ps(loA, cs_mm_mul_ps(index_frac, cs_mm_sub_ps(hiA, loA)));
 							cs__m128 B = cs_mm_mul_ps(A, vB);
 							A = cs_mm_mul_ps(A, vA);
-							floatA[i + write_offset_wide] = cs_mm_add_ps(floatA[i + write_offset_wide], A);
-							floatB[i + write_offset_wide] = cs_mm_add_ps(floatB[i + write_offset_wide], B);
+							busA[i + write_offset_wide] = cs_mm_add_ps(busA[i + write_offset_wide], A);
+							busB[i + write_offset_wide] = cs_mm_add_ps(busB[i + write_offset_wide], B);
 						}
 						break;
 					}
@@ -2390,8 +3209,8 @@ void cs_mix()
 
 							A = cs_mm_mul_ps(A, vA);
 							B = cs_mm_mul_ps(B, vB);
-							floatA[i + write_offset_wide] = cs_mm_add_ps(floatA[i + write_offset_wide], A);
-							floatB[i + write_offset_wide] = cs_mm_add_ps(floatB[i + write_offset_wide], B);
+							busA[i + write_offset_wide] = cs_mm_add_ps(busA[i + write_offset_wide], A);
+							busB[i + write_offset_wide] = cs_mm_add_ps(busB[i + write_offset_wide], B);
 						}
 					}	break;
 					}
@@ -2404,8 +3223,8 @@ void cs_mix()
 							cs__m128 A = cA[i + sample_index_wide];
 							cs__m128 B = cs_mm_mul_ps(A, vB);
 							A = cs_mm_mul_ps(A, vA);
-							floatA[i + write_offset_wide] = cs_mm_add_ps(floatA[i + write_offset_wide], A);
-							floatB[i + write_offset_wide] = cs_mm_add_ps(floatB[i + write_offset_wide], B);
+							busA[i + write_offset_wide] = cs_mm_add_ps(busA[i + write_offset_wide], A);
+							busB[i + write_offset_wide] = cs_mm_add_ps(busB[i + write_offset_wide], B);
 						}
 						break;
 					}
@@ -2417,8 +3236,8 @@ void cs_mix()
 
 							A = cs_mm_mul_ps(A, vA);
 							B = cs_mm_mul_ps(B, vB);
-							floatA[i + write_offset_wide] = cs_mm_add_ps(floatA[i + write_offset_wide], A);
-							floatB[i + write_offset_wide] = cs_mm_add_ps(floatB[i + write_offset_wide], B);
+							busA[i + write_offset_wide] = cs_mm_add_ps(busA[i + write_offset_wide], A);
+							busB[i + write_offset_wide] = cs_mm_add_ps(busB[i + write_offset_wide], B);
 						}
 					}	break;
 					}
@@ -2478,7 +3297,9 @@ void cs_mix()
 			cs_hashtableremove(&s_ctx->instance_map, playing->id);
 			playing_node = next_node;
 			write_offset = 0;
-			if (s_ctx->on_finish && !playing->is_music) {
+			if (s_ctx->queue_finished) {
+				cs_push_finished(playing->id, playing->is_music);
+			} else if (s_ctx->on_finish && !playing->is_music) {
 				cs_playing_sound_t snd = { playing->id };
 				s_ctx->on_finish(snd, s_ctx->on_finish_udata);
 			} else if (s_ctx->on_music_finish && playing->is_music) {
@@ -2489,6 +3310,7 @@ void cs_mix()
 	}
 
 	s_ctx->duplicate_count = 0;
+	cs_mix_buses(floatA, floatB, bytes_to_write / s_ctx->bps);
 
 	// load all floats into 16 bit packed interleaved samples
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_WINDOWS
@@ -2527,14 +3349,25 @@ void cs_mix()
 	for (int i = 0; i < s_ctx->audio_sources_to_free_size;) {
 		cs_audio_source_t* audio = s_ctx->audio_sources_to_free[i];
 		if (audio->playing_count == 0) {
-			cs_free16(audio->channels[0]);
-			CUTE_SOUND_FREE(audio, s_mem_ctx);
+			cs_free_audio_source_memory(audio);
 			s_ctx->audio_sources_to_free[i] = s_ctx->audio_sources_to_free[--s_ctx->audio_sources_to_free_size];
 		} else {
 			++i;
 		}
 	}
 
+	{
+		cs_mixer_stats_t* stats = &s_ctx->stats;
+		float mix_seconds = (float)(cs_seconds() - mix_start);
+		float load = mix_seconds * (float)s_ctx->Hz / (float)samples_needed;
+		stats->mix_count++;
+		stats->mix_seconds = mix_seconds;
+		stats->block_sample_count = samples_needed;
+		if (load > stats->peak_load) stats->peak_load = load;
+		stats->voice_count = voice_count;
+		stats->virtual_voice_count = virtual_voice_count;
+	}
+
 	unlock:
 	cs_unlock();
 }
@@ -2557,6 +3390,23 @@ void cs_mix_thread_sleep_delay(int milliseconds)
 	s_ctx->sleep_milliseconds = milliseconds;
 }
 
+cs_mixer_stats_t cs_get_mixer_stats()
+{
+	cs_lock();
+	cs_mixer_stats_t stats = s_ctx->stats;
+	cs_unlock();
+	return stats;
+}
+
+void cs_reset_mixer_stats()
+{
+	cs_lock();
+	s_ctx->stats.mix_count = 0;
+	s_ctx->stats.peak_load = 0;
+	s_ctx->stats.underrun_count = 0;
+	cs_unlock();
+}
+
 void* cs_get_context_ptr()
 {
 	return (void*)s_ctx;
@@ -2733,11 +3583,11 @@ cs_audio_source_t* cs_read_mem_wav(const void* memory, size_t size, cs_error_t*
 
 void cs_free_audio_source(cs_audio_source_t* audio)
 {
+	if (audio->borrowed) return;
 	if (s_ctx) {
 		cs_lock();
 		if (audio->playing_count == 0) {
-			cs_free16(audio->channels[0]);
-			CUTE_SOUND_FREE(audio, s_mem_ctx);
+			cs_free_audio_source_memory(audio);
 		} else {
 			if (s_ctx->audio_sources_to_free_size == s_ctx->audio_sources_to_free_capacity) {
 				int new_capacity = s_ctx->audio_sources_to_free_capacity * 2;
@@ -2752,8 +3602,7 @@ void cs_free_audio_source(cs_audio_source_t* audio)
 		cs_unlock();
 	} else {
 		CUTE_SOUND_ASSERT(audio->playing_count == 0);
-		cs_free16(audio->channels[0]);
-		CUTE_SOUND_FREE(audio, s_mem_ctx);
+		cs_free_audio_source_memory(audio);
 	}
 }
 
@@ -2772,6 +3621,104 @@ int cs_get_channel_count(const cs_audio_source_t* audio)
 	return audio->channel_count;
 }
 
+int cs_get_mixer_sample_rate()
+{
+	return s_ctx ? s_ctx->Hz : 0;
+}
+
+cs_error_t cs_resample(cs_audio_source_t* audio, int sample_rate, cs_resample_quality_t quality)
+{
+	if (audio->playing_count) return CUTE_SOUND_ERROR_AUDIO_SOURCE_IS_PLAYING;
+	if (audio->stream || audio->adpcm || audio->borrowed || sample_rate <= 0) return CUTE_SOUND_ERROR_AUDIO_SOURCE_CANNOT_BE_CONVERTED;
+	if (sample_rate == audio->sample_rate) return CUTE_SOUND_ERROR_NONE;
+
+	double step = (double)audio->sample_rate / (double)sample_rate;
+	int sample_count = (int)((double)audio->sample_count / step);
+	if (sample_count < 1) sample_count = 1;
+	int wide_count = (int)CUTE_SOUND_ALIGN(sample_count, 4) / 4;
+	float* a = (float*)cs_malloc16(wide_count * sizeof(cs__m128) * audio->channel_count);
+	int last = audio->sample_count - 1;
+
+	for (int c = 0; c < audio->channel_count; ++c) {
+		const float* in = (const float*)audio->channels[c];
+		float* out = a + c * wide_count * 4;
+		for (int i = 0; i < sample_count; ++i) {
+			double t = i * step;
+			int j = (int)t;
+			if (j > last) j = last;
+			float f = (float)(t - j);
+			float p1 = in[j];
+			float p2 = in[j + 1 > last ? last : j + 1];
+			if (quality == CUTE_SOUND_RESAMPLE_QUALITY_CUBIC) {
+				// Catmull-Rom spline through the two samples on either side.
+				float p0 = in[j - 1 < 0 ? 0 : j - 1];
+				float p3 = in[j + 2 > last ? last : j + 2];
+				out[i] = p1 + 0.5f * f * (p2 - p0 + f * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + f * (3.0f * (p1 - p2) + p3 - p0)));
+			} else {
+				out[i] = p1 + f * (p2 - p1);
+			}
+		}
+		CUTE_SOUND_MEMSET(out + sample_count, 0, sizeof(float) * (wide_count * 4 - sample_count));
+	}
+
+	cs_free16(audio->channels[0]);
+	audio->channels[0] = a;
+	audio->channels[1] = audio->channel_count == 2 ? a + wide_count * 4 : NULL;
+	audio->sample_rate = sample_rate;
+	audio->sample_count = sample_count;
+	return CUTE_SOUND_ERROR_NONE;
+}
+
+cs_error_t cs_compress_adpcm(cs_audio_source_t* audio)
+{
+	if (audio->playing_count) return CUTE_SOUND_ERROR_AUDIO_SOURCE_IS_PLAYING;
+	if (audio->stream || audio->adpcm || audio->borrowed) return CUTE_SOUND_ERROR_AUDIO_SOURCE_CANNOT_BE_CONVERTED;
+
+	int block_count = cs_adpcm_block_count(audio);
+	size_t size = (size_t)block_count * audio->channel_count * CUTE_SOUND_ADPCM_BLOCK_BYTES;
+	uint8_t* adpcm = (uint8_t*)CUTE_SOUND_ALLOC(size, s_mem_ctx);
+	CUTE_SOUND_MEMSET(adpcm, 0, size);
+
+	for (int c = 0; c < audio->channel_count; ++c) {
+		const float* in = (const float*)audio->channels[c];
+		int index = 0;
+		for (int b = 0; b < block_count; ++b) {
+			uint8_t* block = adpcm + ((size_t)b * audio->channel_count + c) * CUTE_SOUND_ADPCM_BLOCK_BYTES;
+			uint8_t* codes = block + 4;
+			int first = b * CUTE_SOUND_ADPCM_BLOCK;
+			float s = in[first];
+			int predictor = (int)(s < -32768.0f ? -32768.0f : s > 32767.0f ? 32767.0f : s);
+			block[0] = (uint8_t)(predictor & 0xFF);
+			block[1] = (uint8_t)((predictor >> 8) & 0xFF);
+			block[2] = (uint8_t)index;
+			for (int i = 1; i < CUTE_SOUND_ADPCM_BLOCK; ++i) {
+				int sample_index = first + i;
+				int sample = sample_index < audio->sample_count ? (int)in[sample_index] : 0;
+				int diff = sample - predictor;
+				int code = 0;
+				if (diff < 0) {
+					code = 8;
+					diff = -diff;
+				}
+				int step = cs_adpcm_step_table[index];
+				if (diff >= step) { code |= 4; diff -= step; }
+				step >>= 1;
+				if (diff >= step) { code |= 2; diff -= step; }
+				step >>= 1;
+				if (diff >= step) code |= 1;
+				cs_adpcm_step(&predictor, &index, code);
+				codes[(i - 1) >> 1] |= (uint8_t)(code << (((i - 1) & 1) * 4));
+			}
+		}
+	}
+
+	cs_free16(audio->channels[0]);
+	audio->channels[0] = NULL;
+	audio->channels[1] = NULL;
+	audio->adpcm = adpcm;
+	return CUTE_SOUND_ERROR_NONE;
+}
+
 #if CUTE_SOUND_PLATFORM == CUTE_SOUND_SDL && defined(SDL_rwops_h_) && defined(CUTE_SOUND_SDL_RWOPS)
 
 	// Load an SDL_RWops object's data into memory.
@@ -2876,6 +3823,85 @@ cs_audio_source_t* cs_read_mem_ogg(const void* memory, size_t length, cs_error_t
 	return audio;
 }
 
+typedef struct cs_ogg_stream_t
+{
+	stb_vorbis* vorbis;
+	void* memory;
+	int channel_count;
+} cs_ogg_stream_t;
+
+static int cs_ogg_stream_read(void* udata, float** channels, int count)
+{
+	cs_ogg_stream_t* ogg = (cs_ogg_stream_t*)udata;
+	int decoded = stb_vorbis_get_samples_float(ogg->vorbis, ogg->channel_count, channels, count);
+
+	// Match the scale and clipping of samples decoded up front as 16-bit integers.
+	for (int i = 0; i < ogg->channel_count; ++i) {
+		for (int j = 0; j < decoded; ++j) {
+			float sample = channels[i][j] * 32768.0f;
+			channels[i][j] = sample < -32768.0f ? -32768.0f : sample > 32767.0f ? 32767.0f : sample;
+		}
+	}
+	return decoded;
+}
+
+static void cs_ogg_stream_seek(void* udata, int sample_index)
+{
+	cs_ogg_stream_t* ogg = (cs_ogg_stream_t*)udata;
+	stb_vorbis_seek(ogg->vorbis, (unsigned)sample_index);
+}
+
+static void cs_ogg_stream_free(void* udata)
+{
+	cs_ogg_stream_t* ogg = (cs_ogg_stream_t*)udata;
+	stb_vorbis_close(ogg->vorbis);
+	CUTE_SOUND_FREE(ogg->memory, s_mem_ctx);
+	CUTE_SOUND_FREE(ogg, s_mem_ctx);
+}
+
+cs_audio_source_t* cs_read_mem_ogg_stream(const void* memory, size_t length, cs_error_t* err)
+{
+	// The decoder reads straight from the compressed file, so it needs a copy to outlive `memory`.
+	void* copy = CUTE_SOUND_ALLOC(length, s_mem_ctx);
+	CUTE_SOUND_MEMCPY(copy, memory, length);
+	int error = 0;
+	stb_vorbis* vorbis = stb_vorbis_open_memory((const unsigned char*)copy, (int)length, &error, NULL);
+	if (!vorbis) {
+		CUTE_SOUND_FREE(copy, s_mem_ctx);
+		if (err) *err = CUTE_SOUND_ERROR_STB_VORBIS_DECODE_FAILED;
+		return NULL;
+	}
+	stb_vorbis_info info = stb_vorbis_get_info(vorbis);
+	if (info.channels != 1 && info.channels != 2) {
+		stb_vorbis_close(vorbis);
+		CUTE_SOUND_FREE(copy, s_mem_ctx);
+		if (err) *err = CUTE_SOUND_ERROR_OGG_UNSUPPORTED_CHANNEL_COUNT;
+		return NULL;
+	}
+
+	cs_ogg_stream_t* ogg = (cs_ogg_stream_t*)CUTE_SOUND_ALLOC(sizeof(cs_ogg_stream_t), s_mem_ctx);
+	ogg->vorbis = vorbis;
+	ogg->memory = copy;
+	ogg->channel_count = info.channels;
+
+	cs_stream_t* stream = (cs_stream_t*)CUTE_SOUND_ALLOC(sizeof(cs_stream_t), s_mem_ctx);
+	CUTE_SOUND_MEMSET(stream, 0, sizeof(*stream));
+	stream->read = cs_ogg_stream_read;
+	stream->seek = cs_ogg_stream_seek;
+	stream->free = cs_ogg_stream_free;
+	stream->udata = ogg;
+
+	cs_audio_source_t* audio = (cs_audio_source_t*)CUTE_SOUND_ALLOC(sizeof(cs_audio_source_t), s_mem_ctx);
+	CUTE_SOUND_MEMSET(audio, 0, sizeof(*audio));
+	audio->sample_rate = (int)info.sample_rate;
+	audio->sample_count = (int)stb_vorbis_stream_length_in_samples(vorbis);
+	audio->channel_count = info.channels;
+	audio->stream = stream;
+
+	if (err) *err = CUTE_SOUND_ERROR_NONE;
+	return audio;
+}
+
 cs_audio_source_t* cs_load_ogg(const char* path, cs_error_t* err)
 {
 	int length;
@@ -2929,6 +3955,13 @@ static cs_sound_inst_t* s_inst_music(cs_audio_source_t* src, float volume)
 	inst->pan0 = 0.5f;
 	inst->pan1 = 0.5f;
 	inst->pitch = 1.0f;
+	inst->priority = 0;
+	inst->is_virtual = false;
+	inst->bus = s_ctx->music_bus;
+	inst->spatial = false;
+	inst->x = 0;
+	inst->y = 0;
+	inst->gain = 1.0f;
 	inst->audio = src;
 	inst->sample_index = 0;
 	cs_list_init_node(&inst->node);
@@ -2955,6 +3988,13 @@ static cs_sound_inst_t* s_inst(cs_audio_source_t* src, cs_sound_params_t params)
 	inst->pan0 = panl;
 	inst->pan1 = panr;
 	inst->pitch = params.pitch;
+	inst->priority = params.priority;
+	inst->is_virtual = false;
+	inst->bus = params.bus < 0 ? 0 : params.bus >= CUTE_SOUND_BUS_COUNT ? CUTE_SOUND_BUS_COUNT - 1 : params.bus;
+	inst->spatial = params.spatial;
+	inst->x = params.x;
+	inst->y = params.y;
+	inst->gain = 1.0f;
 	inst->audio = src;
 	inst->sample_index = params.sample_index;
 	CUTE_SOUND_ASSERT(inst->sample_index < src->sample_count);
@@ -3254,6 +4294,11 @@ cs_sound_params_t cs_sound_params_default()
 	params.pan = 0.5f;
 	params.pitch = 1.0f;
 	params.sample_index = 0;
+	params.priority = 0;
+	params.bus = 0;
+	params.spatial = false;
+	params.x = 0;
+	params.y = 0;
 	return params;
 }
 
@@ -3332,43 +4377,122 @@ int cs_sound_get_sample_index(cs_playing_sound_t sound)
 	return inst->sample_index;
 }
 
+// Only the game thread pushes commands, so the write index is its own. When the mixer has fallen a
+// whole ring behind, catch up by hand rather than drop changes or reorder them.
+static void cs_push_command(cs_command_t cmd)
+{
+	unsigned write = s_ctx->command_write;
+	if (write - CUTE_SOUND_ATOMIC_LOAD(&s_ctx->command_read) == CUTE_SOUND_COMMAND_CAPACITY) {
+		cs_lock();
+		cs_run_commands();
+		cs_unlock();
+	}
+	s_ctx->commands[write & (CUTE_SOUND_COMMAND_CAPACITY - 1)] = cmd;
+	CUTE_SOUND_ATOMIC_STORE(&s_ctx->command_write, write + 1);
+}
+
+static void cs_push_sound_command(cs_command_type_t type, cs_playing_sound_t sound, float x, float y, int i)
+{
+	cs_command_t cmd;
+	cmd.type = type;
+	cmd.id = sound.id;
+	cmd.x = x;
+	cmd.y = y;
+	cmd.i = i;
+	cs_push_command(cmd);
+}
+
+// Applies queued commands. Called with the mixer lock held, at the start of each mix.
+static void cs_run_commands()
+{
+	unsigned read = CUTE_SOUND_ATOMIC_LOAD(&s_ctx->command_read);
+	unsigned write = CUTE_SOUND_ATOMIC_LOAD(&s_ctx->command_write);
+	while (read != write) {
+		cs_command_t* cmd = s_ctx->commands + (read++ & (CUTE_SOUND_COMMAND_CAPACITY - 1));
+		if (cmd->type == CUTE_SOUND_COMMAND_LISTENER) {
+			s_ctx->listener_x = cmd->x;
+			s_ctx->listener_y = cmd->y;
+			continue;
+		}
+		cs_playing_sound_t sound = { cmd->id };
+		cs_sound_inst_t* inst = s_get_inst(sound);
+		if (!inst) continue;
+		switch (cmd->type) {
+		case CUTE_SOUND_COMMAND_PAUSED: inst->paused = cmd->i ? true : false; break;
+		case CUTE_SOUND_COMMAND_LOOPED: inst->looped = cmd->i ? true : false; break;
+		case CUTE_SOUND_COMMAND_VOLUME: inst->volume = cmd->x; break;
+		case CUTE_SOUND_COMMAND_PAN: inst->pan0 = 1.0f - cmd->x; inst->pan1 = cmd->x; break;
+		case CUTE_SOUND_COMMAND_PITCH: inst->pitch = cmd->x; break;
+		case CUTE_SOUND_COMMAND_SAMPLE_INDEX: if (cmd->i <= inst->audio->sample_count) inst->sample_index = cmd->i; break;
+		case CUTE_SOUND_COMMAND_STOP: inst->active = false; break;
+		case CUTE_SOUND_COMMAND_PRIORITY: inst->priority = cmd->x; break;
+		case CUTE_SOUND_COMMAND_POSITION:
+			if (inst->is_music) break;
+			inst->spatial = true;
+			inst->x = cmd->x;
+			inst->y = cmd->y;
+			break;
+		default: break;
+		}
+	}
+	CUTE_SOUND_ATOMIC_STORE(&s_ctx->command_read, read);
+}
+
+// Called by the mixer. A full ring means nobody is popping, so the sound is dropped rather than waited on.
+static void cs_push_finished(uint64_t id, bool is_music)
+{
+	unsigned write = s_ctx->finished_write;
+	if (write - CUTE_SOUND_ATOMIC_LOAD(&s_ctx->finished_read) == CUTE_SOUND_FINISHED_CAPACITY) return;
+	cs_finished_t* finished = s_ctx->finished + (write & (CUTE_SOUND_FINISHED_CAPACITY - 1));
+	finished->id = id;
+	finished->is_music = is_music;
+	CUTE_SOUND_ATOMIC_STORE(&s_ctx->finished_write, write + 1);
+}
+
+void cs_queue_finished_sounds(bool true_to_queue)
+{
+	cs_lock();
+	s_ctx->queue_finished = true_to_queue;
+	cs_unlock();
+}
+
+bool cs_pop_finished_sound(cs_playing_sound_t* sound, bool* is_music)
+{
+	unsigned read = s_ctx->finished_read;
+	if (read == CUTE_SOUND_ATOMIC_LOAD(&s_ctx->finished_write)) return false;
+	cs_finished_t* finished = s_ctx->finished + (read & (CUTE_SOUND_FINISHED_CAPACITY - 1));
+	sound->id = finished->id;
+	if (is_music) *is_music = finished->is_music;
+	CUTE_SOUND_ATOMIC_STORE(&s_ctx->finished_read, read + 1);
+	return true;
+}
+
 void cs_sound_set_is_paused(cs_playing_sound_t sound, bool true_for_paused)
 {
-	cs_sound_inst_t* inst = s_get_inst(sound);
-	if (!inst) return;
-	inst->paused = true_for_paused;
+	cs_push_sound_command(CUTE_SOUND_COMMAND_PAUSED, sound, 0, 0, true_for_paused ? 1 : 0);
 }
 
 void cs_sound_set_is_looped(cs_playing_sound_t sound, bool true_for_looped)
 {
-	cs_sound_inst_t* inst = s_get_inst(sound);
-	if (!inst) return;
-	inst->looped = true_for_looped;
+	cs_push_sound_command(CUTE_SOUND_COMMAND_LOOPED, sound, 0, 0, true_for_looped ? 1 : 0);
 }
 
 void cs_sound_set_volume(cs_playing_sound_t sound, float volume_0_to_1)
 {
 	if (volume_0_to_1 < 0) volume_0_to_1 = 0;
-	cs_sound_inst_t* inst = s_get_inst(sound);
-	if (!inst) return;
-	inst->volume = volume_0_to_1;
+	cs_push_sound_command(CUTE_SOUND_COMMAND_VOLUME, sound, volume_0_to_1, 0, 0);
 }
 
 void cs_sound_set_pitch(cs_playing_sound_t sound, float pitch)
 {
-	cs_sound_inst_t* inst = s_get_inst(sound);
-	if (!inst) return;
-	inst->pitch = pitch;
+	cs_push_sound_command(CUTE_SOUND_COMMAND_PITCH, sound, pitch, 0, 0);
 }
 
 void cs_sound_set_pan(cs_playing_sound_t sound, float pan_0_to_1)
 {
 	if (pan_0_to_1 < 0) pan_0_to_1 = 0;
 	if (pan_0_to_1 > 1) pan_0_to_1 = 1;
-	cs_sound_inst_t* inst = s_get_inst(sound);
-	if (!inst) return;
-	inst->pan0 = 1.0f - pan_0_to_1;
-	inst->pan1 = pan_0_to_1;
+	cs_push_sound_command(CUTE_SOUND_COMMAND_PAN, sound, pan_0_to_1, 0, 0);
 }
 
 cs_error_t cs_sound_set_sample_index(cs_playing_sound_t sound, int sample_index)
@@ -3376,15 +4500,32 @@ cs_error_t cs_sound_set_sample_index(cs_playing_sound_t sound, int sample_index)
 	cs_sound_inst_t* inst = s_get_inst(sound);
 	if (!inst) return CUTE_SOUND_ERROR_INVALID_SOUND;
 	if (sample_index > inst->audio->sample_count) return CUTE_SOUND_ERROR_TRIED_TO_SET_SAMPLE_INDEX_BEYOND_THE_AUDIO_SOURCES_SAMPLE_COUNT;
-	inst->sample_index = sample_index;
+	cs_push_sound_command(CUTE_SOUND_COMMAND_SAMPLE_INDEX, sound, 0, 0, sample_index);
 	return CUTE_SOUND_ERROR_NONE;
 }
 
 void cs_sound_stop(cs_playing_sound_t sound)
+{
+	cs_push_sound_command(CUTE_SOUND_COMMAND_STOP, sound, 0, 0, 0);
+}
+
+float cs_sound_get_priority(cs_playing_sound_t sound)
+{
+	cs_sound_inst_t* inst = s_get_inst(sound);
+	if (!inst) return 0;
+	return inst->priority;
+}
+
+void cs_sound_set_priority(cs_playing_sound_t sound, float priority)
+{
+	cs_push_sound_command(CUTE_SOUND_COMMAND_PRIORITY, sound, priority, 0, 0);
+}
+
+bool cs_sound_is_virtual(cs_playing_sound_t sound)
 {
 	cs_sound_inst_t* inst = s_get_inst(sound);
-	if (!inst) return;
-	inst->active = false;
+	if (!inst) return false;
+	return inst->is_virtual;
 }
 
 void cs_set_playing_sounds_volume(float volume_0_to_1)
@@ -3422,6 +4563,97 @@ void cs_cull_duplicates(bool true_to_enable)
 	s_ctx->cull_duplicates = true_to_enable;
 }
 
+void cs_set_max_voices(int max_voices)
+{
+	s_ctx->max_voices = max_voices < 0 ? 0 : max_voices;
+}
+
+static cs_bus_t* s_get_bus(int bus)
+{
+	if (bus < 0 || bus >= CUTE_SOUND_BUS_COUNT) return NULL;
+	return s_ctx->buses + bus;
+}
+
+void cs_bus_set_volume(int bus_index, float volume_0_to_1)
+{
+	cs_bus_t* bus = s_get_bus(bus_index);
+	if (!bus) return;
+	bus->volume = volume_0_to_1 < 0 ? 0 : volume_0_to_1;
+}
+
+float cs_bus_get_volume(int bus_index)
+{
+	cs_bus_t* bus = s_get_bus(bus_index);
+	if (!bus) return 0;
+	return bus->volume;
+}
+
+void cs_bus_set_low_pass(int bus_index, float cutoff_Hz)
+{
+	cs_bus_t* bus = s_get_bus(bus_index);
+	if (!bus) return;
+	bus->low_pass_Hz = cutoff_Hz < 0 ? 0 : cutoff_Hz;
+	bus->low_pass_alpha = 1.0f - CUTE_SOUND_EXPF(-2.0f * 3.14159265f * bus->low_pass_Hz / (float)s_ctx->Hz);
+}
+
+void cs_bus_set_ducking(int bus_index, int sidechain_bus, float amount_0_to_1, float release_seconds)
+{
+	cs_bus_t* bus = s_get_bus(bus_index);
+	if (!bus) return;
+	if (sidechain_bus == bus_index || !s_get_bus(sidechain_bus)) sidechain_bus = -1;
+	bus->duck_bus = sidechain_bus;
+	bus->duck_amount = amount_0_to_1 < 0 ? 0 : amount_0_to_1 > 1 ? 1 : amount_0_to_1;
+	bus->duck_release = release_seconds < 0 ? 0 : release_seconds;
+}
+
+void cs_music_set_bus(int bus)
+{
+	if (!s_get_bus(bus)) return;
+	s_ctx->music_bus = bus;
+	if (s_ctx->music_playing) s_ctx->music_playing->bus = bus;
+	if (s_ctx->music_next) s_ctx->music_next->bus = bus;
+}
+
+cs_attenuation_params_t cs_attenuation_params_default()
+{
+	cs_attenuation_params_t params;
+	params.model = CUTE_SOUND_ATTENUATION_LINEAR;
+	params.min_distance = 64.0f;
+	params.max_distance = 1024.0f;
+	params.rolloff = 1.0f;
+	params.pan_distance = 512.0f;
+	return params;
+}
+
+void cs_set_listener_position(float x, float y)
+{
+	cs_playing_sound_t none = { 0 };
+	cs_push_sound_command(CUTE_SOUND_COMMAND_LISTENER, none, x, y, 0);
+}
+
+void cs_set_attenuation(cs_attenuation_params_t params)
+{
+	if (params.min_distance < 1.0e-3f) params.min_distance = 1.0e-3f;
+	if (params.max_distance < params.min_distance) params.max_distance = params.min_distance;
+	if (params.rolloff < 0) params.rolloff = 0;
+	cs_lock();
+	s_ctx->attenuation = params;
+	cs_unlock();
+}
+
+void cs_sound_set_position(cs_playing_sound_t sound, float x, float y)
+{
+	float xy[2] = { x, y };
+	cs_sound_set_positions(&sound, xy, 1);
+}
+
+void cs_sound_set_positions(const cs_playing_sound_t* sounds, const float* xy, int count)
+{
+	for (int i = 0; i < count; ++i) {
+		cs_push_sound_command(CUTE_SOUND_COMMAND_POSITION, sounds[i], xy[i * 2], xy[i * 2 + 1], 0);
+	}
+}
+
 void* cs_get_global_context()
 {
 	return s_ctx;
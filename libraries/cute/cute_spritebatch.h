@@ -158,6 +158,14 @@
 	#define SPRITEBATCH_U64 unsigned long long
 #endif // SPRITEBATCH_U64
 
+// This define is optional. Consecutive sprites (after sorting) whose texture ids map to the same key
+// are reported together in one batch. Override it if several texture ids can be drawn with one
+// texture binding, e.g. atlases stored as layers of a single texture array. In that case the
+// `submit_batch_fn` is responsible for telling the sprites apart by their `texture_id`.
+#ifndef SPRITEBATCH_BATCH_KEY
+	#define SPRITEBATCH_BATCH_KEY(texture_id) (texture_id)
+#endif // SPRITEBATCH_BATCH_KEY
+
 typedef struct spritebatch_t spritebatch_t;
 typedef struct spritebatch_config_t spritebatch_config_t;
 typedef struct spritebatch_sprite_t spritebatch_sprite_t;
@@ -269,6 +277,22 @@ int spritebatch_flush(spritebatch_t* sb);
 // Can be called every 1/N times `spritebatch_flush` is called.
 int spritebatch_defrag(spritebatch_t* sb);
 
+// Limits the number of expensive operations a single call to `spritebatch_defrag` may perform. An
+// operation is either building a new atlas, or flushing an old atlas back into the lonely buffer.
+// Any work left over is picked up by subsequent calls to `spritebatch_defrag`, and in the meantime
+// affected images are simply drawn from their own lonely textures. Set to 0 (the default) for no limit.
+void spritebatch_set_defrag_budget(spritebatch_t* sb, int max_operations);
+
+// Returns a rough count of the expensive operations (see `spritebatch_set_defrag_budget`) the next
+// call to `spritebatch_defrag` would like to perform. Useful to schedule large re-packs, e.g. while
+// a loading screen is up.
+int spritebatch_defrag_pending(spritebatch_t* sb);
+
+// Caps the number of internal atlases, e.g. to keep their textures within a memory budget. Once at
+// the cap `spritebatch_defrag` only builds a new atlas after flushing an old one holding decayed
+// images, and otherwise leaves images in the lonely buffer. Set to 0 (the default) for no limit.
+void spritebatch_set_atlas_limit(spritebatch_t* sb, int max_atlases);
+
 int spritebatch_init(spritebatch_t* sb, spritebatch_config_t* config, void* udata);
 void spritebatch_term(spritebatch_t* sb);
 
@@ -537,6 +561,9 @@ struct spritebatch_t
 	int lonely_buffer_count_till_decay;
 	float ratio_to_decay_atlas;
 	float ratio_to_merge_atlases;
+	int max_defrag_operations;
+	int defrag_operations; // number of operations performed by the last `spritebatch_defrag` call
+	int max_atlases;
 	submit_batch_fn* batch_callback;
 	get_pixels_fn* get_pixels_callback;
 	generate_texture_handle_fn* generate_texture_callback;
@@ -1035,6 +1062,9 @@ int spritebatch_init(spritebatch_t* sb, spritebatch_config_t* config, void* udat
 	sb->ticks_to_decay_texture = config->ticks_to_decay_texture;
 	sb->lonely_buffer_count_till_flush = config->lonely_buffer_count_till_flush;
 	sb->lonely_buffer_count_till_decay = sb->lonely_buffer_count_till_flush / 2;
+	sb->max_defrag_operations = 0;
+	sb->defrag_operations = 0;
+	sb->max_atlases = 0;
 	if (sb->lonely_buffer_count_till_decay <= 0) sb->lonely_buffer_count_till_decay = 1;
 	sb->ratio_to_decay_atlas = config->ratio_to_decay_atlas;
 	sb->ratio_to_merge_atlases = config->ratio_to_merge_atlases;
@@ -1569,7 +1599,7 @@ int spritebatch_flush(spritebatch_t* sb)
 				break;
 			}
 
-			if (id != sb->sprites[max].texture_id)
+			if (SPRITEBATCH_BATCH_KEY(id) != SPRITEBATCH_BATCH_KEY(sb->sprites[max].texture_id))
 				break;
 
 			++max;
@@ -2066,12 +2096,102 @@ void spritebatch_internal_log_chain(spritebatch_internal_atlas_t* atlas)
 	}
 }
 
+static int spritebatch_internal_atlas_decayed(spritebatch_t* sb, spritebatch_internal_atlas_t* atlas)
+{
+	int texture_count = hashtable_count(&atlas->sprites_to_textures);
+	spritebatch_internal_texture_t* textures = (spritebatch_internal_texture_t*)hashtable_items(&atlas->sprites_to_textures);
+	int decayed_texture_count = 0;
+	for (int i = 0; i < texture_count; ++i) if (textures[i].timestamp >= sb->ticks_to_decay_texture) decayed_texture_count++;
+
+	float ratio;
+	if (!decayed_texture_count) ratio = 0;
+	else ratio = (float)texture_count / (float)decayed_texture_count;
+	return ratio > sb->ratio_to_decay_atlas;
+}
+
+void spritebatch_set_defrag_budget(spritebatch_t* sb, int max_operations)
+{
+	sb->max_defrag_operations = max_operations;
+}
+
+void spritebatch_set_atlas_limit(spritebatch_t* sb, int max_atlases)
+{
+	sb->max_atlases = max_atlases;
+}
+
+static int spritebatch_internal_atlas_count(spritebatch_t* sb)
+{
+	int count = 0;
+	spritebatch_internal_atlas_t* atlas = sb->atlases;
+	if (atlas)
+	{
+		do
+		{
+			++count;
+			atlas = atlas->next;
+		}
+		while (atlas != sb->atlases);
+	}
+	return count;
+}
+
+// Flushes the atlas holding the most decayed images to make room for a new one. Returns 0 if no
+// atlas holds any decayed image, as flushing a fully live atlas would only rebuild it again.
+static int spritebatch_internal_evict_atlas(spritebatch_t* sb)
+{
+	spritebatch_internal_atlas_t* best = 0;
+	int best_decayed = 0;
+	spritebatch_internal_atlas_t* atlas = sb->atlases;
+	if (!atlas) return 0;
+	do
+	{
+		int texture_count = hashtable_count(&atlas->sprites_to_textures);
+		spritebatch_internal_texture_t* textures = (spritebatch_internal_texture_t*)hashtable_items(&atlas->sprites_to_textures);
+		int decayed = 0;
+		for (int i = 0; i < texture_count; ++i) if (textures[i].timestamp >= sb->ticks_to_decay_texture) decayed++;
+		if (decayed > best_decayed)
+		{
+			best = atlas;
+			best_decayed = decayed;
+		}
+		atlas = atlas->next;
+	}
+	while (atlas != sb->atlases);
+	if (!best) return 0;
+	SPRITEBATCH_LOG("evicted atlas %p to stay within the atlas limit\n", best);
+	spritebatch_internal_flush_atlas(sb, best, 0, 0);
+	return 1;
+}
+
+int spritebatch_defrag_pending(spritebatch_t* sb)
+{
+	int pending = 0;
+	int merge_candidates = 0;
+	spritebatch_internal_atlas_t* atlas = sb->atlases;
+	if (atlas)
+	{
+		spritebatch_internal_atlas_t* sentinel = atlas;
+		do
+		{
+			if (spritebatch_internal_atlas_decayed(sb, atlas)) pending++;
+			else if (atlas->volume_ratio < sb->ratio_to_merge_atlases) merge_candidates++;
+			atlas = atlas->next;
+		}
+		while (atlas != sentinel);
+	}
+	pending += merge_candidates - (merge_candidates & 1);
+	if (hashtable_count(&sb->sprites_to_lonely_textures) > sb->lonely_buffer_count_till_flush) pending++;
+	return pending;
+}
+
 int spritebatch_defrag(spritebatch_t* sb)
 {
+	int ops_left = sb->max_defrag_operations > 0 ? sb->max_defrag_operations : INT_MAX;
+	sb->defrag_operations = 0;
+
 	// remove decayed atlases and flush them to the lonely buffer
 	// only flush textures that are not decayed
 	int ticks_to_decay_texture = sb->ticks_to_decay_texture;
-	float ratio_to_decay_atlas = sb->ratio_to_decay_atlas;
 	spritebatch_internal_atlas_t* atlas = sb->atlases;
 	if (atlas)
 	{
@@ -2080,22 +2200,15 @@ int spritebatch_defrag(spritebatch_t* sb)
 		do
 		{
 			spritebatch_internal_atlas_t* next = atlas->next;
-			int texture_count = hashtable_count(&atlas->sprites_to_textures);
-			spritebatch_internal_texture_t* textures = (spritebatch_internal_texture_t*)hashtable_items(&atlas->sprites_to_textures);
-			int decayed_texture_count = 0;
-			for (int i = 0; i < texture_count; ++i) if (textures[i].timestamp >= ticks_to_decay_texture) decayed_texture_count++;
-
-			float ratio;
-			if (!decayed_texture_count) ratio = 0;
-			else ratio = (float)texture_count / (float)decayed_texture_count;
-			if (ratio > ratio_to_decay_atlas)
+			if (ops_left > 0 && spritebatch_internal_atlas_decayed(sb, atlas))
 			{
 				SPRITEBATCH_LOG("flushed atlas %p\n", atlas);
 				spritebatch_internal_flush_atlas(sb, atlas, &sentinel, &next);
+				--ops_left;
 			}
 			atlas = next;
 		}
-		while (atlas != sentinel);
+		while (atlas && atlas != sentinel);
 	}
 
 	// merge mostly empty atlases
@@ -2114,9 +2227,11 @@ int spritebatch_defrag(spritebatch_t* sb)
 			SPRITEBATCH_ASSERT(sp >= 0 && sp <= 2);
 			if (sp == 2)
 			{
+				if (ops_left < 2) break;
 				SPRITEBATCH_LOG("merged 2 atlases\n");
 				spritebatch_internal_flush_atlas(sb, merge_stack[0], &sentinel, &next);
 				spritebatch_internal_flush_atlas(sb, merge_stack[1], &sentinel, &next);
+				ops_left -= 2;
 				sp = 0;
 			}
 
@@ -2127,11 +2242,12 @@ int spritebatch_defrag(spritebatch_t* sb)
 		}
 		while (atlas != sentinel);
 
-		if (sp == 2)
+		if (sp == 2 && ops_left >= 2)
 		{
 			SPRITEBATCH_LOG("merged 2 atlases (out of loop)\n");
 			spritebatch_internal_flush_atlas(sb, merge_stack[0], 0, 0);
 			spritebatch_internal_flush_atlas(sb, merge_stack[1], 0, 0);
+			ops_left -= 2;
 		}
 	}
 
@@ -2169,8 +2285,17 @@ int spritebatch_defrag(spritebatch_t* sb)
 	// grab lonely_buffer_count_till_flush of them and make an atlas
 	int lonely_buffer_count_till_flush = sb->lonely_buffer_count_till_flush;
 	int stuck = 0;
-	while (lonely_count > lonely_buffer_count_till_flush && !stuck)
+	while (lonely_count > lonely_buffer_count_till_flush && !stuck && ops_left > 0)
 	{
+		if (sb->max_atlases > 0 && spritebatch_internal_atlas_count(sb) >= sb->max_atlases)
+		{
+			// Make room first, the flushed images join the lonely buffer.
+			if (ops_left < 2 || !spritebatch_internal_evict_atlas(sb)) break;
+			--ops_left;
+			lonely_count = hashtable_count(&sb->sprites_to_lonely_textures);
+			lonely_textures = (spritebatch_internal_lonely_texture_t*)hashtable_items(&sb->sprites_to_lonely_textures);
+		}
+		--ops_left;
 		atlas = (spritebatch_internal_atlas_t*)SPRITEBATCH_MALLOC(sizeof(spritebatch_internal_atlas_t), sb->mem_ctx);
 		if (sb->atlases)
 		{
@@ -2241,6 +2366,7 @@ int spritebatch_defrag(spritebatch_t* sb)
 		}
 	}
 
+	if (sb->max_defrag_operations > 0) sb->defrag_operations = sb->max_defrag_operations - ops_left;
 	return 1;
 }
 
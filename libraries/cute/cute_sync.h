@@ -435,7 +435,7 @@ int cute_atomic_get(cute_atomic_int_t* atomic)
 
 int cute_atomic_cas(cute_atomic_int_t* atomic, int expected, int value)
 {
-	return (int)_InterlockedCompareExchange(&atomic->i, value, expected) == value;
+	return (int)_InterlockedCompareExchange(&atomic->i, value, expected) == expected;
 }
 
 void* cute_atomic_ptr_set(void** atomic, void* value)
@@ -450,7 +450,7 @@ void* cute_atomic_ptr_get(void** atomic)
 
 int cute_atomic_ptr_cas(void** atomic, void* expected, void* value)
 {
-	return _InterlockedCompareExchangePointer(atomic, value, expected) == value;
+	return _InterlockedCompareExchangePointer(atomic, value, expected) == expected;
 }
 
 #elif defined(CUTE_SYNC_POSIX)
@@ -467,9 +467,7 @@ int cute_atomic_add(cute_atomic_int_t* atomic, int addend)
 
 int cute_atomic_set(cute_atomic_int_t* atomic, int value)
 {
-	int result = (int)__sync_lock_test_and_set(&atomic->i, value);
-	__sync_lock_release(&atomic->i);
-	return result;
+	return __atomic_exchange_n(&atomic->i, value, __ATOMIC_SEQ_CST);
 }
 
 int cute_atomic_get(cute_atomic_int_t* atomic)
@@ -479,14 +477,12 @@ int cute_atomic_get(cute_atomic_int_t* atomic)
 
 int cute_atomic_cas(cute_atomic_int_t* atomic, int expected, int value)
 {
-	return (int)__sync_val_compare_and_swap(&atomic->i, expected, value) == value;
+	return (int)__sync_val_compare_and_swap(&atomic->i, expected, value) == expected;
 }
 
 void* cute_atomic_ptr_set(void** atomic, void* value)
 {
-	void* result = __sync_lock_test_and_set(atomic, value);
-	__sync_lock_release(atomic);
-	return result;
+	return __atomic_exchange_n(atomic, value, __ATOMIC_SEQ_CST);
 }
 
 void* cute_atomic_ptr_get(void** atomic)
@@ -496,7 +492,7 @@ void* cute_atomic_ptr_get(void** atomic)
 
 int cute_atomic_ptr_cas(void** atomic, void* expected, void* value)
 {
-	return __sync_val_compare_and_swap(atomic, expected, value) == value;
+	return __sync_val_compare_and_swap(atomic, expected, value) == expected;
 }
 
 #endif // End atomics implementation.
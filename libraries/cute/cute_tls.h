@@ -267,6 +267,11 @@ int tls_read(TLS_Connection connection, void* data, int size);
 // Returns 0 on disconnect or -1 on error.
 int tls_send(TLS_Connection connection, const void* data, int size);
 
+// Blocks until any of the connections has something for `tls_process` to do, or `timeout_ms` passes.
+// Returns right away if data is already waiting. Handy for driving many connections from one thread
+// without busy polling.
+void tls_wait(const TLS_Connection* connections, int count, int timeout_ms);
+
 #define TLS_1_KB 1024
 #define TLS_MAX_RECORD_SIZE (16 * TLS_1_KB)                  // TLS defines records to be up to 16kb.
 #define TLS_MAX_PACKET_SIZE (TLS_MAX_RECORD_SIZE + TLS_1_KB) // Some extra rooms for records split over two packets.
@@ -328,6 +333,7 @@ int tls_send(TLS_Connection connection, const void* data, int size);
 #elif defined(TLS_APPLE)
 #	include <Network/Network.h>
 #	include <pthread.h>
+#	include <unistd.h>
 #elif defined(TLS_S2N)
 #	include <assert.h>
 #	include <stdio.h>
@@ -438,6 +444,7 @@ typedef struct TLS_Context
 	SecPkgContext_StreamSizes sizes;
 	bool tcp_connect_pending;
 	bool first_call;
+	bool incomplete; // Buffered ciphertext is only part of a record, more must arrive before decrypting.
 	int received;    // Byte count in incoming buffer (ciphertext).
 	int used;        // Byte count used from incoming buffer to decrypt current packet.
 	int available;   // Byte count available for decrypted bytes.
@@ -459,6 +466,14 @@ typedef struct TLS_Context
 int tls_s2n_init = 0;
 #endif
 
+#ifdef TLS_WINDOWS
+// One credentials handle shared by all connections. SChannel caches TLS sessions per credentials
+// handle, so sharing it lets reconnects to the same host resume the session with an abbreviated
+// handshake instead of a full one.
+CredHandle tls_credentials;
+int tls_credentials_refcount = 0;
+#endif
+
 // Called in a poll-style manner on Windows.
 // For Apple we call this once on init to setup a tail-end recursive callback loop.
 static void tls_recv(TLS_Context* ctx)
@@ -480,6 +495,7 @@ static void tls_recv(TLS_Context* ctx)
 				break;
 			} else {
 				ctx->received += r;
+				ctx->incomplete = 0;
 			}
 		}
 	#endif // TLS_WINDOWS
@@ -644,12 +660,16 @@ TLS_Connection tls_connect(const char* hostname, int port)
 						 | SCH_CRED_NO_DEFAULT_CREDS;     // Client certs are not supported.
 			cred.grbitEnabledProtocols = SP_PROT_TLS1_2;  // Specifically pick only TLS 1.2.
 
-			if (AcquireCredentialsHandleA(NULL, (char*)UNISP_NAME_A, SECPKG_CRED_OUTBOUND, NULL, &cred, NULL, NULL, &ctx->handle, NULL) != SEC_E_OK)
-			{
-				closesocket(ctx->sock);
-				TLS_FREE(ctx);
-				return result;
+			if (!tls_credentials_refcount) {
+				if (AcquireCredentialsHandleA(NULL, (char*)UNISP_NAME_A, SECPKG_CRED_OUTBOUND, NULL, &cred, NULL, NULL, &tls_credentials, NULL) != SEC_E_OK)
+				{
+					closesocket(ctx->sock);
+					TLS_FREE(ctx);
+					return result;
+				}
 			}
+			tls_credentials_refcount++;
+			ctx->handle = tls_credentials;
 		}
 		#elif defined(TLS_S2N)
 			// Create connection and set our socket onto it. s2n wraps our socket -- actually
@@ -968,6 +988,7 @@ TLS_State tls_process(TLS_Connection connection)
 				SecBufferDesc desc = { SECBUFFER_VERSION, TLS_ARRAYSIZE(buffers), buffers };
 
 				SECURITY_STATUS sec = DecryptMessage(&ctx->context, &desc, 0, NULL);
+				ctx->incomplete = sec == SEC_E_INCOMPLETE_MESSAGE;
 				if (sec == SEC_E_OK) {
 					// Successfully decrypted some data.
 					TLS_ASSERT(buffers[0].BufferType == SECBUFFER_STREAM_HEADER);
@@ -1100,7 +1121,9 @@ void tls_disconnect(TLS_Connection connection)
 			shutdown(ctx->sock, SD_BOTH);
 		}
 		DeleteSecurityContext(&ctx->context);
-		FreeCredentialsHandle(&ctx->handle);
+		if (--tls_credentials_refcount == 0) {
+			FreeCredentialsHandle(&tls_credentials);
+		}
 		closesocket(ctx->sock);
 	#endif
 
@@ -1259,6 +1282,57 @@ int tls_send(TLS_Connection connection, const void* data, int size)
 	return 0;
 }
 
+void tls_wait(const TLS_Connection* connections, int count, int timeout_ms)
+{
+	#if defined(TLS_WINDOWS) || defined(TLS_S2N)
+		fd_set reads, writes;
+		FD_ZERO(&reads);
+		FD_ZERO(&writes);
+		int max_fd = 0;
+		int watched = 0;
+		for (int i = 0; i < count; ++i) {
+			TLS_Context* ctx = (TLS_Context*)connections[i].id;
+			if (ctx->state != TLS_STATE_PENDING && ctx->state != TLS_STATE_CONNECTED) {
+				// Errors, disconnects and full queues are for the caller to notice.
+				return;
+			}
+			if (ctx->q.count || ctx->packet) return;
+			#ifdef TLS_WINDOWS
+				// Another whole record may already be buffered, DecryptMessage only handles one per call.
+				if (ctx->state == TLS_STATE_CONNECTED && ctx->received && !ctx->incomplete) return;
+			#else
+				// s2n may hold decrypted bytes past what fit in our incoming buffer.
+				if (ctx->state == TLS_STATE_CONNECTED && s2n_peek(ctx->connection)) return;
+			#endif
+			if (ctx->tcp_connect_pending) FD_SET(ctx->sock, &writes);
+			FD_SET(ctx->sock, &reads);
+			if ((int)ctx->sock > max_fd) max_fd = (int)ctx->sock;
+			++watched;
+		}
+		struct timeval timeout;
+		timeout.tv_sec = timeout_ms / 1000;
+		timeout.tv_usec = (timeout_ms % 1000) * 1000;
+		if (watched) {
+			select(max_fd + 1, &reads, &writes, NULL, &timeout);
+		} else {
+			// Windows doesn't allow select on empty sets.
+			#ifdef TLS_WINDOWS
+				Sleep(timeout_ms);
+			#else
+				select(0, NULL, NULL, NULL, &timeout);
+			#endif
+		}
+	#elif defined(TLS_APPLE)
+		// Network.framework receives on its own dispatch queue and has no socket to wait on, so just nap briefly.
+		for (int i = 0; i < count; ++i) {
+			TLS_Context* ctx = (TLS_Context*)connections[i].id;
+			if (ctx->state != TLS_STATE_PENDING && ctx->state != TLS_STATE_CONNECTED) return;
+			if (ctx->q.count || ctx->packet) return;
+		}
+		usleep((timeout_ms < 1 ? timeout_ms : 1) * 1000);
+	#endif
+}
+
 #endif // CUTE_TLS_IMPLEMENTATION_ONCE
 #endif // CUTE_TLS_IMPLEMENTATION
 
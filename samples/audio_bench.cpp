@@ -0,0 +1,145 @@
+#include <cute.h>
+using namespace Cute;
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+// Headless audio benchmark. Plays many looping voices with their own pitch and pan, fades and bends
+// them every block like a game would, and mixes without an audio device as fast as possible. Reports
+// what each block cost to mix, and how quickly WAV and OGG files decode. Run it before and after a
+// change to the mixer and compare the numbers.
+//
+// Usage: audio_bench [voices] [seconds] [buffer_size]
+//
+// Reads jump.wav and thingy.ogg from the audio_bench_data folder next to the executable.
+
+static double s_seconds(uint64_t ticks)
+{
+	return (double)ticks / (double)cf_get_tick_frequency();
+}
+
+static int s_cmp_double(const void* a, const void* b)
+{
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static void s_bench_decode(const char* name, const char* path, bool ogg)
+{
+	size_t size;
+	void* data = fs_read_entire_file_to_memory(path, &size);
+	if (!data) {
+		printf("decode %-5s can't read %s\n", name, path);
+		return;
+	}
+
+	// Decode for at least a second, so short files still time well.
+	int runs = 0;
+	double seconds = 0;
+	double audio_seconds = 0;
+	while (seconds < 1.0 || runs < 3) {
+		uint64_t start = cf_get_ticks();
+		Audio audio = ogg ? audio_load_ogg_from_memory(data, (int)size) : audio_load_wav_from_memory(data, (int)size);
+		seconds += s_seconds(cf_get_ticks() - start);
+		audio_seconds += (double)audio_sample_count(audio) / audio_sample_rate(audio);
+		audio_destroy(audio);
+		++runs;
+	}
+	cf_free(data);
+
+	double mb_per_second = (double)size * runs / seconds / (1024.0 * 1024.0);
+	printf("decode %-5s %9.2f MB/s %9.1fx realtime  (%d runs)\n", name, mb_per_second, audio_seconds / seconds, runs);
+}
+
+static void s_bench_mix(const char* name, const Audio* clips, int clip_count, int voice_count, float seconds, int buffer_size)
+{
+	Rnd rnd = rnd_seed(1234);
+	Array<Sound> sounds;
+	Array<float> pitches;
+	for (int i = 0; i < voice_count; ++i) {
+		Audio clip = clips[i % clip_count];
+		SoundParams params;
+		params.looped = true;
+		params.volume = rnd_range(rnd, 0.05f, 0.25f);
+		params.pan = rnd_range(rnd, 0.0f, 1.0f);
+		params.pitch = rnd_range(rnd, 0.5f, 2.0f);
+		params.sample_index = rnd_range(rnd, 0, audio_sample_count(clip) - 1);
+		sounds.add(play_sound(clip, params));
+		pitches.add(params.pitch);
+	}
+
+	int block_count = (int)(seconds * 44100.0f / buffer_size);
+	if (block_count < 1) block_count = 1;
+	Array<int16_t> out;
+	out.ensure_count(buffer_size * 2);
+	Array<double> costs;
+	costs.ensure_capacity(block_count);
+	audio_reset_stats();
+
+	for (int i = 0; i < block_count; ++i) {
+		float t = (float)i * buffer_size / 44100.0f;
+		for (int j = 0; j < voice_count; ++j) {
+			sound_set_volume(sounds[j], 0.15f + 0.1f * sinf(t * 2.0f + j));
+			sound_set_pitch(sounds[j], pitches[j] * (1.0f + 0.05f * sinf(t + j)));
+		}
+		uint64_t start = cf_get_ticks();
+		audio_render(out.data(), buffer_size);
+		costs.add(s_seconds(cf_get_ticks() - start));
+	}
+
+	AudioStats stats = audio_get_stats();
+	double total = 0;
+	for (int i = 0; i < costs.count(); ++i) total += costs[i];
+	qsort(costs.data(), costs.count(), sizeof(double), s_cmp_double);
+	double p50 = costs[costs.count() / 2];
+	double p99 = costs[(int)(costs.count() * 0.99)];
+	double max = costs.last();
+	double audio_seconds = (double)block_count * buffer_size / 44100.0;
+	printf("mix %-8s voices %5d  mixed %5d  avg %8.1f us  p50 %8.1f us  p99 %8.1f us  max %8.1f us  peak load %6.3f  %8.1fx realtime\n",
+		name, voice_count, stats.voice_count, total / block_count * 1.0e6, p50 * 1.0e6, p99 * 1.0e6, max * 1.0e6, stats.peak_load, audio_seconds / total);
+
+	for (int i = 0; i < voice_count; ++i) {
+		sound_stop(sounds[i]);
+	}
+	audio_render(out.data(), buffer_size);
+}
+
+int main(int argc, char* argv[])
+{
+	int voice_count = argc > 1 ? atoi(argv[1]) : 256;
+	float seconds = argc > 2 ? (float)atof(argv[2]) : 10.0f;
+	int buffer_size = argc > 3 ? atoi(argv[3]) : 1024;
+
+	audio_set_buffer_size(buffer_size);
+	Result result = make_app("audio bench", 0, 0, 0, 0, 0, APP_OPTIONS_NO_GFX | APP_OPTIONS_NO_AUDIO_DEVICE, argv[0]);
+	if (is_error(result)) {
+		printf("%s\n", result.details);
+		return -1;
+	}
+	buffer_size = audio_get_stats().buffer_size;
+	printf("buffer size %d samples, %.1f ms per block\n", buffer_size, buffer_size * 1000.0f / 44100.0f);
+
+	s_bench_decode("wav", "/audio_bench_data/jump.wav", false);
+	s_bench_decode("ogg", "/audio_bench_data/thingy.ogg", true);
+
+	Audio clips[2];
+	clips[0] = audio_load_wav("/audio_bench_data/jump.wav");
+	clips[1] = audio_load_ogg("/audio_bench_data/thingy.ogg");
+	if (!clips[0].id || !clips[1].id) {
+		printf("Can't load the clips in audio_bench_data.\n");
+		destroy_app();
+		return -1;
+	}
+
+	s_bench_mix("raw", clips, 2, voice_count, seconds, buffer_size);
+	audio_compress(clips[0]);
+	audio_compress(clips[1]);
+	s_bench_mix("adpcm", clips, 2, voice_count, seconds, buffer_size);
+
+	audio_destroy(clips[0]);
+	audio_destroy(clips[1]);
+	destroy_app();
+	return 0;
+}
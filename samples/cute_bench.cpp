@@ -0,0 +1,590 @@
+#include <cute.h>
+#include <cute_a_star.h>
+using namespace Cute;
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Benchmarks for the framework's hot paths, from small pieces like hashtable lookups up to whole
+// frames of sprites. Every benchmark uses fixed seeds and sizes so runs line up from one commit to
+// the next. Each one runs once to warm up, then `repeat` more times, and the fastest and median
+// runs are reported. Run it before and after a change and compare the numbers, or hand the JSON
+// output to a script that tracks them over time.
+//
+// Usage: cute_bench [--json path] [--filter substring] [--repeat count] [--headless]
+//
+// --headless skips the benchmarks that need a GPU (sprites and text). To time those on a machine
+// without a GPU, configure CMake with CF_FRAMEWORK_NULL_GFX=ON instead. Draws then run through a null
+// backend, so only their CPU cost (batching, atlas packing, vertex building, text layout) is measured.
+
+struct Bench
+{
+	const char* name;
+	const char* unit; // What one operation is, ns per `unit` is reported.
+	int ops;          // Operations per run.
+	double seconds;   // Timed so far this run.
+	uint64_t start;
+};
+
+typedef void (BenchFn)(Bench* b);
+
+struct BenchResult
+{
+	const char* name;
+	const char* unit;
+	int ops;
+	int runs;
+	double min_ns;
+	double median_ns;
+	double max_ns;
+};
+
+static int s_repeat = 5;
+static const char* s_filter = NULL;
+static bool s_headless = false;
+static Array<BenchResult> s_results;
+
+static void s_start(Bench* b)
+{
+	b->start = cf_get_ticks();
+}
+
+static void s_stop(Bench* b)
+{
+	b->seconds += (double)(cf_get_ticks() - b->start) / (double)cf_get_tick_frequency();
+}
+
+static int s_cmp_double(const void* a, const void* b)
+{
+	double x = *(const double*)a;
+	double y = *(const double*)b;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static void s_run(const char* name, const char* unit, int ops, BenchFn* fn, bool needs_gfx = false)
+{
+	if (s_filter && !strstr(name, s_filter)) return;
+	if (needs_gfx && s_headless) return;
+
+	Array<double> samples;
+	for (int i = 0; i < s_repeat + 1; ++i) {
+		Bench b = { name, unit, ops, 0, 0 };
+		fn(&b);
+		if (i) samples.add(b.seconds * 1.0e9 / ops);
+	}
+	qsort(samples.data(), samples.count(), sizeof(double), s_cmp_double);
+
+	BenchResult result;
+	result.name = name;
+	result.unit = unit;
+	result.ops = ops;
+	result.runs = samples.count();
+	result.min_ns = samples[0];
+	result.median_ns = samples[samples.count() / 2];
+	result.max_ns = samples.last();
+	s_results.add(result);
+	printf("%-24s %10d %-7s min %10.2f  median %10.2f  max %10.2f  ns/%s\n", name, ops, unit, result.min_ns, result.median_ns, result.max_ns, unit);
+	fflush(stdout);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Containers and strings.
+
+#define KEY_COUNT 100000
+
+static Array<uint64_t> s_keys;
+
+static void s_make_keys()
+{
+	Rnd rnd = rnd_seed(1);
+	s_keys.ensure_count(KEY_COUNT);
+	for (int i = 0; i < KEY_COUNT; ++i) s_keys[i] = cf_rnd(&rnd);
+}
+
+static void s_bench_map_insert(Bench* b)
+{
+	Map<uint64_t, uint64_t> map;
+	s_start(b);
+	for (int i = 0; i < KEY_COUNT; ++i) map.insert(s_keys[i], (uint64_t)i);
+	s_stop(b);
+}
+
+static void s_bench_map_find(Bench* b)
+{
+	Map<uint64_t, uint64_t> map;
+	for (int i = 0; i < KEY_COUNT; ++i) map.insert(s_keys[i], (uint64_t)i);
+	uint64_t sum = 0;
+	s_start(b);
+	for (int i = KEY_COUNT - 1; i >= 0; --i) sum += map.get(s_keys[i]);
+	s_stop(b);
+	if (sum == 1) printf(" ");
+}
+
+#define STRING_COUNT 50000
+
+static Array<String> s_strings;
+
+static void s_make_strings()
+{
+	for (int i = 0; i < STRING_COUNT; ++i) {
+		char buf[64];
+		snprintf(buf, sizeof(buf), "entity_%d_component_%d", i, i * 7919 % 1000);
+		s_strings.add(String(buf));
+	}
+}
+
+// Everything after the warm up run finds its strings already interned, same as a game mostly does.
+static void s_bench_sintern(Bench* b)
+{
+	s_start(b);
+	for (int i = 0; i < STRING_COUNT; ++i) cf_sintern(s_strings[i].c_str());
+	s_stop(b);
+}
+
+//--------------------------------------------------------------------------------------------------
+// ECS.
+
+#define ENTITY_COUNT 10000
+#define ECS_FRAMES 100
+
+struct BenchPosition { v2 p; };
+struct BenchVelocity { v2 v; };
+
+static void s_update_movers(CF_ComponentList list, int count, void* udata)
+{
+	BenchPosition* positions = (BenchPosition*)cf_get_components(list, "BenchPosition");
+	BenchVelocity* velocities = (BenchVelocity*)cf_get_components(list, "BenchVelocity");
+	for (int i = 0; i < count; ++i) {
+		positions[i].p = positions[i].p + velocities[i].v * (1.0f / 60.0f);
+	}
+}
+
+static void s_ecs_init()
+{
+	cf_component_begin();
+	cf_component_set_name("BenchPosition");
+	cf_component_set_size(sizeof(BenchPosition));
+	cf_component_end();
+
+	cf_component_begin();
+	cf_component_set_name("BenchVelocity");
+	cf_component_set_size(sizeof(BenchVelocity));
+	cf_component_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Mover");
+	cf_entity_add_component("BenchPosition");
+	cf_entity_add_component("BenchVelocity");
+	cf_entity_end();
+
+	// Not matched by the system, so churning these doesn't add to the iteration benchmark.
+	cf_entity_begin();
+	cf_entity_set_name("Marker");
+	cf_entity_add_component("BenchPosition");
+	cf_entity_end();
+
+	cf_system_begin();
+	cf_system_set_update(s_update_movers);
+	cf_system_require_component("BenchPosition");
+	cf_system_require_component("BenchVelocity");
+	cf_system_end();
+}
+
+static void s_bench_ecs_iterate(Bench* b)
+{
+	Array<CF_Entity> entities;
+	entities.ensure_count(ENTITY_COUNT);
+	cf_make_entities("Mover", ENTITY_COUNT, entities.data());
+	for (int i = 0; i < ENTITY_COUNT; ++i) {
+		BenchVelocity* v = (BenchVelocity*)cf_entity_get_component(entities[i], "BenchVelocity");
+		v->v = V2((float)(i % 17), (float)(i % 13));
+	}
+	s_start(b);
+	for (int i = 0; i < ECS_FRAMES; ++i) cf_run_systems();
+	s_stop(b);
+	for (int i = 0; i < ENTITY_COUNT; ++i) cf_destroy_entity(entities[i]);
+}
+
+static void s_bench_ecs_churn(Bench* b)
+{
+	Array<CF_Entity> entities;
+	entities.ensure_count(ENTITY_COUNT);
+	s_start(b);
+	for (int i = 0; i < ENTITY_COUNT; ++i) entities[i] = cf_make_entity("Marker");
+	for (int i = 0; i < ENTITY_COUNT; ++i) cf_destroy_entity(entities[(i * 7919) % ENTITY_COUNT]);
+	s_stop(b);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Collision and pathfinding.
+
+#define AABB_COUNT 10000
+
+static Array<CF_Aabb> s_aabbs;
+
+static void s_make_aabbs()
+{
+	Rnd rnd = rnd_seed(2);
+	for (int i = 0; i < AABB_COUNT; ++i) {
+		v2 p = V2(rnd_range(rnd, -1000.0f, 1000.0f), rnd_range(rnd, -1000.0f, 1000.0f));
+		v2 e = V2(rnd_range(rnd, 1.0f, 10.0f), rnd_range(rnd, 1.0f, 10.0f));
+		s_aabbs.add(make_aabb(p - e, p + e));
+	}
+}
+
+static void s_bench_aabb_tree_build(Bench* b)
+{
+	s_start(b);
+	CF_AabbTree tree = cf_make_aabb_tree(0);
+	for (int i = 0; i < AABB_COUNT; ++i) cf_aabb_tree_insert(tree, s_aabbs[i], NULL);
+	s_stop(b);
+	cf_destroy_aabb_tree(tree);
+}
+
+static bool s_count_hit(CF_Leaf leaf, CF_Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	++*(int*)fn_udata;
+	return true;
+}
+
+static void s_bench_aabb_tree_query(Bench* b)
+{
+	CF_AabbTree tree = cf_make_aabb_tree(0);
+	for (int i = 0; i < AABB_COUNT; ++i) cf_aabb_tree_insert(tree, s_aabbs[i], NULL);
+	int hits = 0;
+	s_start(b);
+	for (int i = 0; i < AABB_COUNT; ++i) cf_aabb_tree_query_aabb(tree, s_count_hit, s_aabbs[i], &hits);
+	s_stop(b);
+	cf_destroy_aabb_tree(tree);
+}
+
+#define GRID_SIZE 256
+#define PATH_COUNT 64
+
+static void s_bench_a_star(Bench* b)
+{
+	Rnd rnd = rnd_seed(3);
+	Array<float> costs;
+	costs.ensure_count(GRID_SIZE * GRID_SIZE);
+	for (int i = 0; i < costs.count(); ++i) costs[i] = rnd_range(rnd, 0.0f, 1.0f) < 0.2f ? 0.0f : 1.0f;
+	CF_AStarGrid grid = cf_make_a_star_grid(GRID_SIZE, GRID_SIZE, costs.data());
+	CF_AStarOutput out = { };
+	s_start(b);
+	for (int i = 0; i < PATH_COUNT; ++i) {
+		int x0 = rnd_range(rnd, 0, GRID_SIZE - 1), y0 = rnd_range(rnd, 0, GRID_SIZE - 1);
+		int x1 = rnd_range(rnd, 0, GRID_SIZE - 1), y1 = rnd_range(rnd, 0, GRID_SIZE - 1);
+		cf_a_star_grid_set_cost(grid, x0, y0, 1.0f);
+		cf_a_star_grid_set_cost(grid, x1, y1, 1.0f);
+		cf_a_star(grid, x0, y0, x1, y1, true, &out);
+		cf_free_a_star_output(&out);
+	}
+	s_stop(b);
+	cf_destroy_a_star_grid(grid);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Data formats.
+
+static Array<char> s_json;
+static Array<uint8_t> s_bytes;
+static Array<char> s_base64;
+
+static void s_make_data()
+{
+	CF_JsonWriter w = cf_make_json_writer(true);
+	cf_json_write_begin_array(w);
+	Rnd rnd = rnd_seed(4);
+	for (int i = 0; i < 10000; ++i) {
+		char name[32];
+		snprintf(name, sizeof(name), "entity_%d", i);
+		cf_json_write_begin_object(w);
+		cf_json_write_key(w, "id");
+		cf_json_write_int(w, i);
+		cf_json_write_key(w, "name");
+		cf_json_write_string(w, name);
+		cf_json_write_key(w, "position");
+		cf_json_write_begin_array(w);
+		cf_json_write_float(w, rnd_range(rnd, -1000.0f, 1000.0f));
+		cf_json_write_float(w, rnd_range(rnd, -1000.0f, 1000.0f));
+		cf_json_write_end_array(w);
+		cf_json_write_key(w, "alive");
+		cf_json_write_bool(w, (i & 1) != 0);
+		cf_json_write_end_object(w);
+	}
+	cf_json_write_end_array(w);
+	cf_json_writer_finish(w);
+	const char* text = cf_json_writer_get_string(w);
+	int len = (int)strlen(text);
+	s_json.ensure_count(len);
+	memcpy(s_json.data(), text, len);
+	cf_destroy_json_writer(w);
+
+	s_bytes.ensure_count(1024 * 1024);
+	cf_rnd_fill_uint32(&rnd, (uint32_t*)s_bytes.data(), s_bytes.count() / 4);
+	s_base64.ensure_count(CF_BASE64_ENCODED_SIZE(s_bytes.count()));
+	cf_base64_encode(s_base64.data(), s_base64.count(), s_bytes.data(), s_bytes.count());
+}
+
+static void s_bench_json_parse(Bench* b)
+{
+	s_start(b);
+	CF_JDoc doc = cf_make_json(s_json.data(), s_json.count());
+	s_stop(b);
+	cf_destroy_json(doc);
+}
+
+static void s_bench_base64_encode(Bench* b)
+{
+	Array<char> out;
+	out.ensure_count(s_base64.count());
+	s_start(b);
+	cf_base64_encode(out.data(), out.count(), s_bytes.data(), s_bytes.count());
+	s_stop(b);
+}
+
+static void s_bench_base64_decode(Bench* b)
+{
+	Array<uint8_t> out;
+	out.ensure_count(CF_BASE64_DECODED_SIZE(s_base64.count()));
+	s_start(b);
+	cf_base64_decode(out.data(), out.count(), s_base64.data(), s_base64.count());
+	s_stop(b);
+}
+
+#define NOISE_SIZE 512
+
+static void s_bench_noise(Bench* b)
+{
+	CF_Noise noise = cf_make_noise_fbm(5, 0.01f, 2.0f, 4, 0.5f);
+	Array<float> values;
+	values.ensure_count(NOISE_SIZE * NOISE_SIZE);
+	s_start(b);
+	cf_noise_fill(noise, values.data(), NOISE_SIZE, NOISE_SIZE, 0, 0, 1.0f, NULL);
+	s_stop(b);
+	cf_destroy_noise(noise);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Networking.
+
+#define TOKEN_COUNT 256
+
+static const char* s_token_addresses[] = { "127.0.0.1:5000", "127.0.0.1:5001", "[::1]:5000" };
+static CF_CryptoSignSecret s_token_secret;
+static Array<CF_ConnectTokenRequest> s_token_requests;
+static Array<uint8_t> s_tokens;
+
+static void s_make_token_requests()
+{
+	CF_CryptoSignPublic pk;
+	cf_crypto_sign_keygen(&pk, &s_token_secret);
+	for (int i = 0; i < TOKEN_COUNT; ++i) {
+		CF_ConnectTokenRequest request;
+		request.client_id = (uint64_t)i;
+		request.client_to_server_key = cf_crypto_generate_key();
+		request.server_to_client_key = cf_crypto_generate_key();
+		request.user_data = NULL;
+		s_token_requests.add(request);
+	}
+	s_tokens.ensure_count(TOKEN_COUNT * CF_CONNECT_TOKEN_SIZE);
+}
+
+static void s_bench_connect_token(Bench* b)
+{
+	s_start(b);
+	for (int i = 0; i < TOKEN_COUNT; ++i) {
+		const CF_ConnectTokenRequest* r = &s_token_requests[i];
+		cf_generate_connect_token(123, 0, &r->client_to_server_key, &r->server_to_client_key, 60, 5, CF_ARRAY_SIZE(s_token_addresses), s_token_addresses, r->client_id, r->user_data, &s_token_secret, s_tokens.data() + i * CF_CONNECT_TOKEN_SIZE);
+	}
+	s_stop(b);
+}
+
+static void s_bench_connect_token_batch(Bench* b)
+{
+	s_start(b);
+	cf_generate_connect_tokens(123, 0, 60, 5, CF_ARRAY_SIZE(s_token_addresses), s_token_addresses, &s_token_secret, TOKEN_COUNT, s_token_requests.data(), s_tokens.data(), NULL);
+	s_stop(b);
+}
+
+static void s_bench_connect_token_batch_mt(Bench* b)
+{
+	CF_Threadpool* pool = cf_make_threadpool(cf_core_count());
+	s_start(b);
+	cf_generate_connect_tokens(123, 0, 60, 5, CF_ARRAY_SIZE(s_token_addresses), s_token_addresses, &s_token_secret, TOKEN_COUNT, s_token_requests.data(), s_tokens.data(), pool);
+	s_stop(b);
+	cf_destroy_threadpool(pool);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Drawing, needs a GPU.
+
+#define SPRITE_COUNT 10000
+#define SPRITE_FRAMES 10
+
+static CF_Sprite s_sprites[4];
+
+static void s_make_sprites()
+{
+	for (int i = 0; i < CF_ARRAY_SIZE(s_sprites); ++i) {
+		CF_Pixel pixels[16 * 16];
+		for (int j = 0; j < 16 * 16; ++j) {
+			pixels[j].colors.r = (uint8_t)(i * 60);
+			pixels[j].colors.g = (uint8_t)j;
+			pixels[j].colors.b = 128;
+			pixels[j].colors.a = 255;
+		}
+		s_sprites[i] = cf_make_easy_sprite_from_pixels(pixels, 16, 16);
+	}
+}
+
+// Pushes sprites into the batcher, then flushes them through `s_draw_report` which builds the vertices.
+static void s_bench_draw_sprites(Bench* b)
+{
+	Rnd rnd = rnd_seed(6);
+	for (int frame = 0; frame < SPRITE_FRAMES; ++frame) {
+		cf_app_update(NULL);
+		s_start(b);
+		for (int i = 0; i < SPRITE_COUNT; ++i) {
+			CF_Sprite* sprite = s_sprites + (i & 3);
+			sprite->transform.p = V2(rnd_range(rnd, -300.0f, 300.0f), rnd_range(rnd, -200.0f, 200.0f));
+			sprite->transform.r = sincos(rnd_range(rnd, 0.0f, CF_PI));
+			cf_draw_sprite(sprite);
+		}
+		cf_app_draw_onto_screen(true);
+		s_stop(b);
+	}
+}
+
+static const char* s_lines[] = {
+	"The quick brown fox jumps over the lazy dog.",
+	"Pack my box with five dozen liquor jugs!",
+	"Sphinx of black quartz, judge my vow.",
+	"How vexingly quick daft zebras jump; 1234567890",
+	"A wizard's job is to vex chumps quickly in fog.",
+	"Bright vixens jump; dozy fowl quack. (0123456789)",
+	"Jackdaws love my big sphinx of quartz.",
+	"The five boxing wizards jump quickly, again and again.",
+};
+
+#define TEXT_REPEAT 2000
+
+static void s_bench_text_layout(Bench* b)
+{
+	cf_push_font_size(24.0f);
+	float w = 0;
+	s_start(b);
+	for (int i = 0; i < TEXT_REPEAT; ++i) {
+		w += cf_text_size(s_lines[i % CF_ARRAY_SIZE(s_lines)], -1).x;
+	}
+	s_stop(b);
+	cf_pop_font_size();
+	if (w < 0) printf(" ");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+static void s_write_json(const char* path)
+{
+	CF_JsonWriter w = cf_make_json_writer(true);
+	cf_json_write_begin_object(w);
+	cf_json_write_key(w, "version");
+	cf_json_write_string(w, CF_VERSION_STRING_COMPILED);
+	cf_json_write_key(w, "build");
+#ifdef NDEBUG
+	cf_json_write_string(w, "release");
+#else
+	cf_json_write_string(w, "debug");
+#endif
+	cf_json_write_key(w, "backend");
+	cf_json_write_string(w, s_headless ? "none" : to_string(query_backend()));
+	cf_json_write_key(w, "repeat");
+	cf_json_write_int(w, s_repeat);
+	cf_json_write_key(w, "benchmarks");
+	cf_json_write_begin_array(w);
+	for (int i = 0; i < s_results.count(); ++i) {
+		const BenchResult& r = s_results[i];
+		cf_json_write_begin_object(w);
+		cf_json_write_key(w, "name");
+		cf_json_write_string(w, r.name);
+		cf_json_write_key(w, "unit");
+		cf_json_write_string(w, r.unit);
+		cf_json_write_key(w, "ops");
+		cf_json_write_int(w, r.ops);
+		cf_json_write_key(w, "runs");
+		cf_json_write_int(w, r.runs);
+		cf_json_write_key(w, "min_ns");
+		cf_json_write_double(w, r.min_ns);
+		cf_json_write_key(w, "median_ns");
+		cf_json_write_double(w, r.median_ns);
+		cf_json_write_key(w, "max_ns");
+		cf_json_write_double(w, r.max_ns);
+		cf_json_write_end_object(w);
+	}
+	cf_json_write_end_array(w);
+	cf_json_write_end_object(w);
+	cf_json_writer_finish(w);
+
+	FILE* fp = fopen(path, "wb");
+	if (fp) {
+		fputs(cf_json_writer_get_string(w), fp);
+		fclose(fp);
+	} else {
+		printf("Can't write %s\n", path);
+	}
+	cf_destroy_json_writer(w);
+}
+
+int main(int argc, char* argv[])
+{
+	const char* json_path = NULL;
+	for (int i = 1; i < argc; ++i) {
+		if (!strcmp(argv[i], "--json") && i + 1 < argc) json_path = argv[++i];
+		else if (!strcmp(argv[i], "--filter") && i + 1 < argc) s_filter = argv[++i];
+		else if (!strcmp(argv[i], "--repeat") && i + 1 < argc) s_repeat = cf_max(1, atoi(argv[++i]));
+		else if (!strcmp(argv[i], "--headless")) s_headless = true;
+		else {
+			printf("Usage: cute_bench [--json path] [--filter substring] [--repeat count] [--headless]\n");
+			return -1;
+		}
+	}
+
+	int options = s_headless ? APP_OPTIONS_HEADLESS : APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO;
+	Result result = make_app("cute bench", 0, 0, 0, 640, 480, options, argv[0]);
+	if (is_error(result)) {
+		printf("%s\n", result.details);
+		return -1;
+	}
+	if (!s_headless) cf_app_set_vsync(false);
+
+	s_make_keys();
+	s_make_strings();
+	s_ecs_init();
+	s_make_aabbs();
+	s_make_data();
+	s_make_token_requests();
+	if (!s_headless) s_make_sprites();
+
+	s_run("hashtable_insert", "insert", KEY_COUNT, s_bench_map_insert);
+	s_run("hashtable_find", "find", KEY_COUNT, s_bench_map_find);
+	s_run("sintern", "string", STRING_COUNT, s_bench_sintern);
+	s_run("ecs_iterate", "entity", ENTITY_COUNT * ECS_FRAMES, s_bench_ecs_iterate);
+	s_run("ecs_churn", "entity", ENTITY_COUNT, s_bench_ecs_churn);
+	s_run("aabb_tree_build", "insert", AABB_COUNT, s_bench_aabb_tree_build);
+	s_run("aabb_tree_query", "query", AABB_COUNT, s_bench_aabb_tree_query);
+	s_run("a_star", "path", PATH_COUNT, s_bench_a_star);
+	s_run("json_parse", "byte", s_json.count(), s_bench_json_parse);
+	s_run("base64_encode", "byte", s_bytes.count(), s_bench_base64_encode);
+	s_run("base64_decode", "byte", s_base64.count(), s_bench_base64_decode);
+	s_run("noise_fbm", "sample", NOISE_SIZE * NOISE_SIZE, s_bench_noise);
+	s_run("connect_token", "token", TOKEN_COUNT, s_bench_connect_token);
+	s_run("connect_token_batch", "token", TOKEN_COUNT, s_bench_connect_token_batch);
+	s_run("connect_token_batch_mt", "token", TOKEN_COUNT, s_bench_connect_token_batch_mt);
+	s_run("draw_sprites", "sprite", SPRITE_COUNT * SPRITE_FRAMES, s_bench_draw_sprites, true);
+	s_run("text_layout", "line", TEXT_REPEAT, s_bench_text_layout, true);
+
+	if (json_path) s_write_json(json_path);
+
+	destroy_app();
+	return 0;
+}
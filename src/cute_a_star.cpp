@@ -8,11 +8,20 @@
 #include <cute_array.h>
 #include <cute_a_star.h>
 #include <cute_math.h>
+#include <cute_hashtable.h>
 #include <cute_priority_queue.h>
+#include <cute_multithreading.h>
 #include <float.h>
+#include <limits.h>
 
 #include <internal/cute_alloc_internal.h>
 
+// Entrances at least this wide get a transition at each end instead of one in the middle.
+#define A_STAR_WIDE_ENTRANCE 6
+
+// Fewest cache misses in a batch worth spinning up another search context for.
+#define A_STAR_BATCH_QUERIES_PER_TASK 8
+
 using namespace Cute;
 
 struct CF_iv2
@@ -20,14 +29,98 @@ struct CF_iv2
 	int x, y;
 };
 
+// A rectangle of cells [x0, x1) by [y0, y1) a search is confined to.
+struct CF_AStarBounds
+{
+	int x0, y0, x1, y1;
+};
+
 struct CF_AStarNodeInternal
 {
-	CF_iv2 p;
 	float h; // Cost from the heuristic function to the end.
 	float g; // Accumulated cost of the path (from `cell_to_cost`).
-	float f; // h + g
-	bool visited;
-	CF_AStarNodeInternal* parent;
+	int parent; // Index of the previous node on the path, or -1 for the start.
+	uint32_t generation; // Every other field is stale unless this matches the grid's generation.
+	bool visited; // True once the node's shortest path is known.
+};
+
+// A cell next to a cluster border, where paths may cross into the neighboring cluster.
+struct CF_AStarEntrance
+{
+	int cell;
+	int cluster;
+	int border; // cluster * 2 for the border to the right, cluster * 2 + 1 for the border above.
+	int twin; // The entrance on the other side of the border.
+	int slot; // Index in the cluster's list of entrances.
+};
+
+struct CF_AStarCluster
+{
+	Array<int> entrances;
+	// Shortest path costs between entrances within the cluster, `dist[i * count + j]` from i to j.
+	Array<float> dist;
+	bool dirty = false;
+};
+
+// Abstract graph for hierarchical path-finding (HPA*). The grid is split into square clusters, linked by
+// entrances along their borders. Long paths are planned over entrances, then refined cluster by cluster.
+struct CF_AStarHierarchy
+{
+	int cluster_size = 0;
+	int cw = 0;
+	int ch = 0;
+	bool diagonal = false;
+	Array<CF_AStarCluster> clusters;
+	Array<int> dirty_clusters;
+	Array<CF_AStarEntrance> entrances;
+	Array<int> free_entrances;
+
+	// Scratch for updates.
+	uint32_t stamp = 0;
+	Array<uint32_t> border_stamps;
+	Array<uint32_t> cluster_stamps;
+	Array<int> affected_clusters;
+};
+
+struct CF_AStarCachedPath
+{
+	bool used = false;
+	bool found = false;
+	uint64_t key = 0;
+	uint64_t last_used = 0;
+	CF_AStarBounds bounds = { };
+	Array<int> x;
+	Array<int> y;
+};
+
+// Least-recently-used cache of paths, keyed by start, end, and diagonal movement.
+struct CF_AStarPathCache
+{
+	int capacity = 0;
+	uint64_t tick = 0;
+	Array<CF_AStarCachedPath> paths;
+	Map<uint64_t, int> slots;
+};
+
+// Scratch memory for one search at a time. Searches only read the grid, so each thread gets its own context.
+struct CF_AStarContext
+{
+	Array<CF_AStarNodeInternal> nodes;
+	// Bumped once per search instead of clearing every node.
+	uint32_t generation = 0;
+	// Indices of nodes to visit. Finding a cheaper path to a queued node lowers its cost in place.
+	IndexedPriorityQueue open_list;
+
+	// Abstract searches over the entrances of `CF_AStarHierarchy`.
+	Array<float> start_dist;
+	Array<float> goal_dist;
+	uint32_t abstract_generation = 0;
+	Array<uint32_t> abstract_generations;
+	Array<float> abstract_g;
+	Array<int> abstract_parent;
+	Array<bool> abstract_closed;
+	IndexedPriorityQueue abstract_open_list;
+	Array<int> abstract_path;
 };
 
 struct CF_AStarGridInternal
@@ -35,24 +128,26 @@ struct CF_AStarGridInternal
 	int w = 0;
 	int h = 0;
 	float* cell_costs = NULL;
-	Array<CF_AStarNodeInternal> nodes;
-	PriorityQueue<CF_AStarNodeInternal*> open_list;
-
-	void reset()
-	{
-		for (int i = 0; i < w; ++i) {
-			for (int j = 0; j < h; ++j) {
-				CF_AStarNodeInternal* n = nodes + (j * w + i);
-				n->p = { i, j };
-				n->visited = false;
-				n->f = FLT_MAX;
-				n->g = 0;
-				n->h = 0;
-				n->parent = NULL;
-			}
-		}
-		open_list.clear();
-	}
+	// Used by `cf_a_star`, and by the first task of `cf_a_star_batch`.
+	CF_AStarContext context;
+	// Made by the first `cf_a_star_batch` to need them, then kept around for later batches.
+	Array<CF_AStarContext*> batch_contexts;
+	CF_AStarHierarchy hierarchy;
+	CF_AStarPathCache path_cache;
+	bool jump_points = false;
+	// Open cells with a cost other than 1, which rule out jump point search.
+	int weighted_cell_count = 0;
+};
+
+struct CF_AStarFlowFieldInternal
+{
+	CF_AStarGridInternal* grid = NULL;
+	int goal = 0;
+	bool allow_diagonal_movement = false;
+	// Cost from each cell to the goal, or FLT_MAX if the goal can't be reached.
+	Array<float> costs;
+	// The next cell along the shortest path from each cell, or -1 at the goal and unreachable cells.
+	Array<int> next;
 };
 
 static float cf_internal_s_heuristic(CF_iv2 a, CF_iv2 b, float allow_diagonals)
@@ -65,6 +160,697 @@ static float cf_internal_s_heuristic(CF_iv2 a, CF_iv2 b, float allow_diagonals)
 	return chebyshev;
 }
 
+static CF_INLINE CF_iv2 s_cell_p(const CF_AStarGridInternal* grid, int index)
+{
+	CF_iv2 p = { index % grid->w, index / grid->w };
+	return p;
+}
+
+static CF_INLINE float s_cell_cost(const CF_AStarGridInternal* grid, int index)
+{
+	return grid->cell_costs ? grid->cell_costs[index] : 1.0f;
+}
+
+// Fetches a node, lazily resetting it if it was last touched by an older search.
+static CF_INLINE CF_AStarNodeInternal* s_node(CF_AStarContext* ctx, int index)
+{
+	CF_AStarNodeInternal* n = ctx->nodes.data() + index;
+	if (n->generation != ctx->generation) {
+		n->generation = ctx->generation;
+		n->h = 0;
+		n->g = FLT_MAX;
+		n->parent = -1;
+		n->visited = false;
+	}
+	return n;
+}
+
+// Cost of the shortest path found to a node by the last search, or FLT_MAX if it wasn't reached.
+static CF_INLINE float s_node_cost(const CF_AStarContext* ctx, int index)
+{
+	const CF_AStarNodeInternal* n = ctx->nodes.data() + index;
+	return n->generation == ctx->generation && n->visited ? n->g : FLT_MAX;
+}
+
+static void s_next_generation(CF_AStarContext* ctx)
+{
+	if (++ctx->generation == 0) {
+		// Wrapped around, so old stamps could look current again.
+		for (int i = 0; i < ctx->nodes.count(); ++i) {
+			ctx->nodes[i].generation = 0;
+		}
+		ctx->generation = 1;
+	}
+}
+
+static void s_init_context(CF_AStarContext* ctx, int cell_count)
+{
+	ctx->nodes.ensure_count(cell_count);
+	for (int i = 0; i < cell_count; ++i) {
+		ctx->nodes[i].generation = 0;
+	}
+	ctx->generation = 0;
+	ctx->open_list.reserve(cell_count);
+}
+
+// Runs A* from `start` to `goal`, touching only the nodes it reaches. With `goal` of -1 this instead runs
+// Dijkstra's over all of `bounds`, see `s_node_cost`. A `reverse` search follows moves backwards, finding
+// costs from each node to `start` rather than from `start`.
+static bool s_search(const CF_AStarGridInternal* grid, CF_AStarContext* ctx, int start, int goal, CF_AStarBounds bounds, bool allow_diagonal_movement, bool reverse)
+{
+	s_next_generation(ctx);
+	IndexedPriorityQueue& open_list = ctx->open_list;
+	int w = grid->w;
+	CF_iv2 e = goal >= 0 ? s_cell_p(grid, goal) : CF_iv2 { 0, 0 };
+	float allow_diagonals = allow_diagonal_movement ? 1.0f : 0;
+	CF_AStarNodeInternal* initial = s_node(ctx, start);
+	initial->g = 0;
+	initial->h = goal >= 0 ? cf_internal_s_heuristic(s_cell_p(grid, start), e, allow_diagonals) : 0;
+	open_list.push_or_decrease(start, initial->h);
+
+	while (open_list.count()) {
+		int q_index;
+		open_list.pop_min(&q_index);
+		CF_AStarNodeInternal* q = ctx->nodes.data() + q_index;
+		q->visited = true;
+
+		if (q_index == goal) {
+			open_list.clear();
+			return true;
+		}
+
+		CF_iv2 qp = { q_index % w, q_index / w };
+		float q_cost = s_cell_cost(grid, q_index);
+		int next_count = 0;
+		int next[8];
+		float next_step[8];
+
+		// Diagonal steps cost more, to match the heuristic.
+		#define CF_A_STAR_ADD_SUCCESSOR(x, y, step) \
+			if ((x) >= bounds.x0 && (x) < bounds.x1 && (y) >= bounds.y0 && (y) < bounds.y1) { \
+				next_step[next_count] = step; \
+				next[next_count++] = (y) * w + (x); \
+			}
+
+		CF_A_STAR_ADD_SUCCESSOR(qp.x + 1, qp.y, 1.0f);
+		CF_A_STAR_ADD_SUCCESSOR(qp.x, qp.y + 1, 1.0f);
+		CF_A_STAR_ADD_SUCCESSOR(qp.x - 1, qp.y, 1.0f);
+		CF_A_STAR_ADD_SUCCESSOR(qp.x, qp.y - 1, 1.0f);
+		if (allow_diagonal_movement) {
+			CF_A_STAR_ADD_SUCCESSOR(qp.x + 1, qp.y + 1, 1.4142135f);
+			CF_A_STAR_ADD_SUCCESSOR(qp.x - 1, qp.y + 1, 1.4142135f);
+			CF_A_STAR_ADD_SUCCESSOR(qp.x + 1, qp.y - 1, 1.4142135f);
+			CF_A_STAR_ADD_SUCCESSOR(qp.x - 1, qp.y - 1, 1.4142135f);
+		}
+		#undef CF_A_STAR_ADD_SUCCESSOR
+
+		for (int i = 0; i < next_count; ++i) {
+			int index = next[i];
+			float cell_cost = s_cell_cost(grid, index);
+			bool non_traversable = cell_cost <= 0;
+			if (non_traversable) continue;
+			CF_AStarNodeInternal* n = s_node(ctx, index);
+			if (n->visited) continue;
+			// Each move costs as much as the cell it enters.
+			float g = q->g + (reverse ? q_cost : cell_cost) * next_step[i];
+			if (n->g <= g) continue;
+
+			// The heuristic only depends on the node, so compute it on first reach.
+			if (n->g == FLT_MAX && goal >= 0) n->h = cf_internal_s_heuristic(s_cell_p(grid, index), e, allow_diagonals);
+			n->g = g;
+			n->parent = q_index;
+			open_list.push_or_decrease(index, g + n->h);
+		}
+	}
+
+	return goal < 0;
+}
+
+// Paths are walked from the goal back to the start, then flipped around.
+static void s_reverse_path(dyna int* out_x, dyna int* out_y, int first)
+{
+	int last = acount(out_x) - 1;
+	for (; first < last; ++first, --last) {
+		int x = out_x[first]; out_x[first] = out_x[last]; out_x[last] = x;
+		int y = out_y[first]; out_y[first] = out_y[last]; out_y[last] = y;
+	}
+}
+
+// Appends the path found by the last search, from just after its start up to `goal`.
+static void s_push_path(const CF_AStarGridInternal* grid, const CF_AStarContext* ctx, int goal, dyna int** out_x, dyna int** out_y)
+{
+	int first = acount(*out_x);
+	for (int index = goal; ctx->nodes[index].parent >= 0; index = ctx->nodes[index].parent) {
+		CF_iv2 p = s_cell_p(grid, index);
+		apush(*out_x, p.x);
+		apush(*out_y, p.y);
+	}
+	s_reverse_path(*out_x, *out_y, first);
+}
+
+static CF_AStarBounds s_grid_bounds(const CF_AStarGridInternal* grid)
+{
+	CF_AStarBounds bounds = { 0, 0, grid->w, grid->h };
+	return bounds;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Jump point search.
+
+static CF_INLINE int s_step_toward(int from, int to)
+{
+	return (to > from) - (to < from);
+}
+
+static CF_INLINE bool s_is_open(const CF_AStarGridInternal* grid, int x, int y)
+{
+	return x >= 0 && y >= 0 && x < grid->w && y < grid->h && s_cell_cost(grid, y * grid->w + x) > 0;
+}
+
+static CF_INLINE bool s_uses_jump_points(const CF_AStarGridInternal* grid, bool allow_diagonal_movement)
+{
+	return grid->jump_points && allow_diagonal_movement && !grid->weighted_cell_count;
+}
+
+// Steps from (x, y) along (dx, dy) until reaching a cell an optimal path might turn at, returning its index, or -1 on
+// hitting a wall. Those are cells next to a blocked cell that a path could only get around optimally by passing through
+// them, or diagonal cells with a straight jump point along either axis.
+static int s_jump(const CF_AStarGridInternal* grid, int x, int y, int dx, int dy, int goal)
+{
+	while (true) {
+		x += dx;
+		y += dy;
+		if (!s_is_open(grid, x, y)) return -1;
+		int index = y * grid->w + x;
+		if (index == goal) return index;
+		if (dx && dy) {
+			if (!s_is_open(grid, x - dx, y) && s_is_open(grid, x - dx, y + dy)) return index;
+			if (!s_is_open(grid, x, y - dy) && s_is_open(grid, x + dx, y - dy)) return index;
+			if (s_jump(grid, x, y, dx, 0, goal) >= 0 || s_jump(grid, x, y, 0, dy, goal) >= 0) return index;
+		} else if (dx) {
+			if (!s_is_open(grid, x, y + 1) && s_is_open(grid, x + dx, y + 1)) return index;
+			if (!s_is_open(grid, x, y - 1) && s_is_open(grid, x + dx, y - 1)) return index;
+		} else {
+			if (!s_is_open(grid, x + 1, y) && s_is_open(grid, x + 1, y + dy)) return index;
+			if (!s_is_open(grid, x - 1, y) && s_is_open(grid, x - 1, y + dy)) return index;
+		}
+	}
+}
+
+// Appends the path found by the last jump point search, filling in the straight and diagonal runs between jump points.
+static void s_push_jump_path(const CF_AStarGridInternal* grid, const CF_AStarContext* ctx, int goal, dyna int** out_x, dyna int** out_y)
+{
+	int first = acount(*out_x);
+	for (int index = goal; ctx->nodes[index].parent >= 0; index = ctx->nodes[index].parent) {
+		CF_iv2 p = s_cell_p(grid, index);
+		CF_iv2 parent = s_cell_p(grid, ctx->nodes[index].parent);
+		int dx = s_step_toward(p.x, parent.x);
+		int dy = s_step_toward(p.y, parent.y);
+		for (; p.x != parent.x || p.y != parent.y; p.x += dx, p.y += dy) {
+			apush(*out_x, p.x);
+			apush(*out_y, p.y);
+		}
+	}
+	s_reverse_path(*out_x, *out_y, first);
+}
+
+// A* over jump points instead of every cell, for grids where every open cell costs the same and diagonal moves are
+// allowed. Long straight and diagonal runs of open cells are skipped over in one go, finding paths exactly as short.
+static bool s_jump_point_search(const CF_AStarGridInternal* grid, CF_AStarContext* ctx, int start, int goal, dyna int** out_x, dyna int** out_y)
+{
+	s_next_generation(ctx);
+	IndexedPriorityQueue& open_list = ctx->open_list;
+	CF_iv2 e = s_cell_p(grid, goal);
+	CF_AStarNodeInternal* initial = s_node(ctx, start);
+	initial->g = 0;
+	initial->h = cf_internal_s_heuristic(s_cell_p(grid, start), e, 1.0f);
+	open_list.push_or_decrease(start, initial->h);
+
+	while (open_list.count()) {
+		int q_index;
+		open_list.pop_min(&q_index);
+		CF_AStarNodeInternal* q = ctx->nodes.data() + q_index;
+		q->visited = true;
+
+		if (q_index == goal) {
+			open_list.clear();
+			s_push_jump_path(grid, ctx, goal, out_x, out_y);
+			return true;
+		}
+
+		// Only directions an optimal path could continue in, given the direction it arrived from.
+		CF_iv2 qp = s_cell_p(grid, q_index);
+		int dirs[8][2];
+		int dir_count = 0;
+		#define CF_A_STAR_ADD_DIRECTION(x, y) dirs[dir_count][0] = (x); dirs[dir_count][1] = (y); ++dir_count
+		if (q->parent < 0) {
+			for (int dy = -1; dy <= 1; ++dy) {
+				for (int dx = -1; dx <= 1; ++dx) {
+					if (dx || dy) { CF_A_STAR_ADD_DIRECTION(dx, dy); }
+				}
+			}
+		} else {
+			CF_iv2 pp = s_cell_p(grid, q->parent);
+			int dx = s_step_toward(pp.x, qp.x);
+			int dy = s_step_toward(pp.y, qp.y);
+			if (dx && dy) {
+				CF_A_STAR_ADD_DIRECTION(dx, 0);
+				CF_A_STAR_ADD_DIRECTION(0, dy);
+				CF_A_STAR_ADD_DIRECTION(dx, dy);
+				if (!s_is_open(grid, qp.x - dx, qp.y)) { CF_A_STAR_ADD_DIRECTION(-dx, dy); }
+				if (!s_is_open(grid, qp.x, qp.y - dy)) { CF_A_STAR_ADD_DIRECTION(dx, -dy); }
+			} else if (dx) {
+				CF_A_STAR_ADD_DIRECTION(dx, 0);
+				if (!s_is_open(grid, qp.x, qp.y + 1)) { CF_A_STAR_ADD_DIRECTION(dx, 1); }
+				if (!s_is_open(grid, qp.x, qp.y - 1)) { CF_A_STAR_ADD_DIRECTION(dx, -1); }
+			} else {
+				CF_A_STAR_ADD_DIRECTION(0, dy);
+				if (!s_is_open(grid, qp.x + 1, qp.y)) { CF_A_STAR_ADD_DIRECTION(1, dy); }
+				if (!s_is_open(grid, qp.x - 1, qp.y)) { CF_A_STAR_ADD_DIRECTION(-1, dy); }
+			}
+		}
+		#undef CF_A_STAR_ADD_DIRECTION
+
+		for (int i = 0; i < dir_count; ++i) {
+			int index = s_jump(grid, qp.x, qp.y, dirs[i][0], dirs[i][1], goal);
+			if (index < 0) continue;
+			CF_AStarNodeInternal* n = s_node(ctx, index);
+			if (n->visited) continue;
+			// Jump points are a straight or diagonal line apart, so the octile distance is the exact cost.
+			CF_iv2 np = s_cell_p(grid, index);
+			float g = q->g + cf_internal_s_heuristic(qp, np, 1.0f);
+			if (n->g <= g) continue;
+			if (n->g == FLT_MAX) n->h = cf_internal_s_heuristic(np, e, 1.0f);
+			n->g = g;
+			n->parent = q_index;
+			open_list.push_or_decrease(index, g + n->h);
+		}
+	}
+
+	return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Hierarchical path-finding.
+
+static CF_INLINE int s_cluster_of(const CF_AStarGridInternal* grid, int index)
+{
+	const CF_AStarHierarchy* hier = &grid->hierarchy;
+	CF_iv2 p = s_cell_p(grid, index);
+	return (p.y / hier->cluster_size) * hier->cw + p.x / hier->cluster_size;
+}
+
+static CF_AStarBounds s_cluster_bounds(const CF_AStarGridInternal* grid, int cluster)
+{
+	const CF_AStarHierarchy* hier = &grid->hierarchy;
+	int size = hier->cluster_size;
+	CF_AStarBounds bounds;
+	bounds.x0 = (cluster % hier->cw) * size;
+	bounds.y0 = (cluster / hier->cw) * size;
+	bounds.x1 = cf_min(bounds.x0 + size, grid->w);
+	bounds.y1 = cf_min(bounds.y0 + size, grid->h);
+	return bounds;
+}
+
+static void s_mark_cluster_dirty(CF_AStarHierarchy* hier, int cluster)
+{
+	if (hier->clusters[cluster].dirty) return;
+	hier->clusters[cluster].dirty = true;
+	hier->dirty_clusters.add(cluster);
+}
+
+static int s_add_entrance(CF_AStarHierarchy* hier, int cell, int cluster, int border)
+{
+	int index = hier->free_entrances.count() ? hier->free_entrances.pop() : hier->entrances.count();
+	if (index == hier->entrances.count()) hier->entrances.add();
+	CF_AStarEntrance* entrance = hier->entrances + index;
+	entrance->cell = cell;
+	entrance->cluster = cluster;
+	entrance->border = border;
+	entrance->twin = -1;
+	hier->clusters[cluster].entrances.add(index);
+	return index;
+}
+
+static void s_remove_border_entrances(CF_AStarHierarchy* hier, int cluster, int border)
+{
+	Array<int>& entrances = hier->clusters[cluster].entrances;
+	for (int i = 0; i < entrances.count();) {
+		if (hier->entrances[entrances[i]].border == border) {
+			hier->free_entrances.add(entrances[i]);
+			entrances.unordered_remove(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+// Places entrances along one side of a cluster, where the cells on both sides of the border are open.
+static void s_build_border(CF_AStarGridInternal* grid, int cluster, int side)
+{
+	CF_AStarHierarchy* hier = &grid->hierarchy;
+	int cx = cluster % hier->cw;
+	int cy = cluster / hier->cw;
+	if (side == 0 && cx + 1 >= hier->cw) return;
+	if (side == 1 && cy + 1 >= hier->ch) return;
+	int neighbor = side == 0 ? cluster + 1 : cluster + hier->cw;
+	int border = cluster * 2 + side;
+	s_remove_border_entrances(hier, cluster, border);
+	s_remove_border_entrances(hier, neighbor, border);
+
+	// Walk the cells just inside the border, stepping along it.
+	CF_AStarBounds bounds = s_cluster_bounds(grid, cluster);
+	int w = grid->w;
+	int first = side == 0 ? bounds.y0 * w + bounds.x1 - 1 : (bounds.y1 - 1) * w + bounds.x0;
+	int length = side == 0 ? bounds.y1 - bounds.y0 : bounds.x1 - bounds.x0;
+	int stride = side == 0 ? w : 1;
+	int across = side == 0 ? 1 : w;
+	int run = 0;
+	for (int i = 0; i <= length; ++i) {
+		int cell = first + i * stride;
+		bool open = i < length && s_cell_cost(grid, cell) > 0 && s_cell_cost(grid, cell + across) > 0;
+		if (open) {
+			++run;
+			continue;
+		}
+		if (run) {
+			int run_first = i - run;
+			int spots[2] = { run_first + run / 2, -1 };
+			if (run >= A_STAR_WIDE_ENTRANCE) {
+				spots[0] = run_first;
+				spots[1] = i - 1;
+			}
+			for (int j = 0; j < 2 && spots[j] >= 0; ++j) {
+				int a_cell = first + spots[j] * stride;
+				int a = s_add_entrance(hier, a_cell, cluster, border);
+				int b = s_add_entrance(hier, a_cell + across, neighbor, border);
+				hier->entrances[a].twin = b;
+				hier->entrances[b].twin = a;
+			}
+			run = 0;
+		}
+	}
+}
+
+// Finds the shortest path costs between every pair of entrances within a cluster.
+static void s_build_cluster_dist(CF_AStarGridInternal* grid, int cluster_index)
+{
+	CF_AStarHierarchy* hier = &grid->hierarchy;
+	CF_AStarCluster* cluster = hier->clusters + cluster_index;
+	CF_AStarBounds bounds = s_cluster_bounds(grid, cluster_index);
+	int count = cluster->entrances.count();
+	cluster->dist.ensure_count(count * count);
+	for (int i = 0; i < count; ++i) {
+		hier->entrances[cluster->entrances[i]].slot = i;
+	}
+	for (int i = 0; i < count; ++i) {
+		s_search(grid, &grid->context, hier->entrances[cluster->entrances[i]].cell, -1, bounds, hier->diagonal, false);
+		for (int j = 0; j < count; ++j) {
+			cluster->dist[i * count + j] = s_node_cost(&grid->context, hier->entrances[cluster->entrances[j]].cell);
+		}
+	}
+}
+
+// Rebuilds entrances and distances around every cluster with changed cell costs.
+static void s_update_hierarchy(CF_AStarGridInternal* grid, bool allow_diagonal_movement)
+{
+	CF_AStarHierarchy* hier = &grid->hierarchy;
+	if (hier->diagonal != allow_diagonal_movement) {
+		// Distances within clusters depend on diagonal movement.
+		hier->diagonal = allow_diagonal_movement;
+		for (int i = 0; i < hier->clusters.count(); ++i) {
+			s_mark_cluster_dirty(hier, i);
+		}
+	}
+	if (!hier->dirty_clusters.count()) return;
+
+	uint32_t stamp = ++hier->stamp;
+	hier->affected_clusters.clear();
+	for (int i = 0; i < hier->dirty_clusters.count(); ++i) {
+		int cluster = hier->dirty_clusters[i];
+		hier->clusters[cluster].dirty = false;
+		int cx = cluster % hier->cw;
+		int cy = cluster / hier->cw;
+
+		// Every border of the cluster, each one owned by the cluster to its left or below.
+		int borders[4] = { cluster * 2, cluster * 2 + 1, cx > 0 ? (cluster - 1) * 2 : -1, cy > 0 ? (cluster - hier->cw) * 2 + 1 : -1 };
+		for (int j = 0; j < 4; ++j) {
+			if (borders[j] < 0 || hier->border_stamps[borders[j]] == stamp) continue;
+			hier->border_stamps[borders[j]] = stamp;
+			s_build_border(grid, borders[j] / 2, borders[j] % 2);
+		}
+
+		// Entrances of neighboring clusters may have changed as well.
+		int neighbors[5] = {
+			cluster,
+			cx + 1 < hier->cw ? cluster + 1 : -1,
+			cy + 1 < hier->ch ? cluster + hier->cw : -1,
+			cx > 0 ? cluster - 1 : -1,
+			cy > 0 ? cluster - hier->cw : -1,
+		};
+		for (int j = 0; j < 5; ++j) {
+			if (neighbors[j] < 0 || hier->cluster_stamps[neighbors[j]] == stamp) continue;
+			hier->cluster_stamps[neighbors[j]] = stamp;
+			hier->affected_clusters.add(neighbors[j]);
+		}
+	}
+	hier->dirty_clusters.clear();
+
+	for (int i = 0; i < hier->affected_clusters.count(); ++i) {
+		s_build_cluster_dist(grid, hier->affected_clusters[i]);
+	}
+}
+
+static CF_INLINE void s_abstract_relax(CF_AStarContext* ctx, int from, int to, float g, float h)
+{
+	if (ctx->abstract_generations[to] != ctx->abstract_generation) {
+		ctx->abstract_generations[to] = ctx->abstract_generation;
+		ctx->abstract_g[to] = FLT_MAX;
+		ctx->abstract_closed[to] = false;
+	}
+	if (ctx->abstract_closed[to] || ctx->abstract_g[to] <= g) return;
+	ctx->abstract_g[to] = g;
+	ctx->abstract_parent[to] = from;
+	ctx->abstract_open_list.push_or_decrease(to, g + h);
+}
+
+// Plans a path over entrances, then refines each leg into cells with a search confined to one cluster.
+// Only reads the hierarchy, which must be up to date, see `s_update_hierarchy`.
+static bool s_hierarchical_a_star(const CF_AStarGridInternal* grid, CF_AStarContext* ctx, int start, int end, bool allow_diagonal_movement, dyna int** out_x, dyna int** out_y)
+{
+	const CF_AStarHierarchy* hier = &grid->hierarchy;
+	float allow_diagonals = allow_diagonal_movement ? 1.0f : 0;
+	CF_iv2 e = s_cell_p(grid, end);
+
+	// Costs from the start to each entrance of its cluster, and from each entrance of the last cluster to the end.
+	int start_cluster = s_cluster_of(grid, start);
+	int end_cluster = s_cluster_of(grid, end);
+	const Array<int>& start_entrances = hier->clusters[start_cluster].entrances;
+	const Array<int>& end_entrances = hier->clusters[end_cluster].entrances;
+	s_search(grid, ctx, start, -1, s_cluster_bounds(grid, start_cluster), allow_diagonal_movement, false);
+	ctx->start_dist.ensure_count(start_entrances.count());
+	for (int i = 0; i < start_entrances.count(); ++i) {
+		ctx->start_dist[i] = s_node_cost(ctx, hier->entrances[start_entrances[i]].cell);
+	}
+	s_search(grid, ctx, end, -1, s_cluster_bounds(grid, end_cluster), allow_diagonal_movement, true);
+	ctx->goal_dist.ensure_count(end_entrances.count());
+	for (int i = 0; i < end_entrances.count(); ++i) {
+		ctx->goal_dist[i] = s_node_cost(ctx, hier->entrances[end_entrances[i]].cell);
+	}
+
+	// A* over entrances, with two extra nodes for the start and end cells.
+	int count = hier->entrances.count();
+	int s_node_index = count;
+	int e_node_index = count + 1;
+	if (ctx->abstract_generations.count() < count + 2) {
+		int old_count = ctx->abstract_generations.count();
+		ctx->abstract_generations.ensure_count(count + 2);
+		for (int i = old_count; i < count + 2; ++i) ctx->abstract_generations[i] = 0;
+		ctx->abstract_g.ensure_count(count + 2);
+		ctx->abstract_parent.ensure_count(count + 2);
+		ctx->abstract_closed.ensure_count(count + 2);
+		ctx->abstract_open_list.reserve(count + 2);
+	}
+	if (++ctx->abstract_generation == 0) {
+		for (int i = 0; i < ctx->abstract_generations.count(); ++i) ctx->abstract_generations[i] = 0;
+		ctx->abstract_generation = 1;
+	}
+	s_abstract_relax(ctx, -1, s_node_index, 0, 0);
+	bool found = false;
+	while (ctx->abstract_open_list.count()) {
+		int u;
+		ctx->abstract_open_list.pop_min(&u);
+		ctx->abstract_closed[u] = true;
+		if (u == e_node_index) {
+			found = true;
+			ctx->abstract_open_list.clear();
+			break;
+		}
+
+		float g = ctx->abstract_g[u];
+		if (u == s_node_index) {
+			for (int i = 0; i < start_entrances.count(); ++i) {
+				if (ctx->start_dist[i] == FLT_MAX) continue;
+				int v = start_entrances[i];
+				s_abstract_relax(ctx, u, v, ctx->start_dist[i], cf_internal_s_heuristic(s_cell_p(grid, hier->entrances[v].cell), e, allow_diagonals));
+			}
+			continue;
+		}
+
+		const CF_AStarEntrance* entrance = hier->entrances + u;
+		const CF_AStarEntrance* twin = hier->entrances + entrance->twin;
+		s_abstract_relax(ctx, u, entrance->twin, g + s_cell_cost(grid, twin->cell), cf_internal_s_heuristic(s_cell_p(grid, twin->cell), e, allow_diagonals));
+		const CF_AStarCluster* cluster = hier->clusters + entrance->cluster;
+		int n = cluster->entrances.count();
+		const float* dist = cluster->dist.data() + entrance->slot * n;
+		for (int i = 0; i < n; ++i) {
+			if (i == entrance->slot || dist[i] == FLT_MAX) continue;
+			int v = cluster->entrances[i];
+			s_abstract_relax(ctx, u, v, g + dist[i], cf_internal_s_heuristic(s_cell_p(grid, hier->entrances[v].cell), e, allow_diagonals));
+		}
+		if (entrance->cluster == end_cluster && ctx->goal_dist[entrance->slot] != FLT_MAX) {
+			s_abstract_relax(ctx, u, e_node_index, g + ctx->goal_dist[entrance->slot], 0);
+		}
+	}
+	if (!found) return false;
+
+	// Refine the legs between entrances into cells.
+	ctx->abstract_path.clear();
+	for (int u = ctx->abstract_parent[e_node_index]; u != s_node_index; u = ctx->abstract_parent[u]) {
+		ctx->abstract_path.add(u);
+	}
+	int cell = start;
+	int cluster = start_cluster;
+	for (int i = ctx->abstract_path.count() - 1; i >= 0; --i) {
+		const CF_AStarEntrance* entrance = hier->entrances + ctx->abstract_path[i];
+		if (entrance->cluster != cluster) {
+			// Crossing a border is a single step into the twin entrance.
+			CF_iv2 p = s_cell_p(grid, entrance->cell);
+			apush(*out_x, p.x);
+			apush(*out_y, p.y);
+		} else {
+			bool leg_found = s_search(grid, ctx, cell, entrance->cell, s_cluster_bounds(grid, cluster), allow_diagonal_movement, false);
+			CF_ASSERT(leg_found);
+			s_push_path(grid, ctx, entrance->cell, out_x, out_y);
+		}
+		cell = entrance->cell;
+		cluster = entrance->cluster;
+	}
+	bool leg_found = s_search(grid, ctx, cell, end, s_cluster_bounds(grid, end_cluster), allow_diagonal_movement, false);
+	CF_ASSERT(leg_found);
+	s_push_path(grid, ctx, end, out_x, out_y);
+	return true;
+}
+
+// Long paths go through the hierarchy, if there is one. Paths between neighboring clusters are short enough to search directly.
+static bool s_wants_hierarchy(const CF_AStarGridInternal* grid, int start, int end)
+{
+	const CF_AStarHierarchy* hier = &grid->hierarchy;
+	if (!hier->cluster_size) return false;
+	CF_iv2 s = s_cell_p(grid, start);
+	CF_iv2 e = s_cell_p(grid, end);
+	int size = hier->cluster_size;
+	int cluster_distance = cf_max(cf_abs_int(s.x / size - e.x / size), cf_abs_int(s.y / size - e.y / size));
+	return cluster_distance > 1;
+}
+
+// Finds a path from `start` to `end`, which must differ, appending it to `out_x` and `out_y`. Only reads the grid.
+static bool s_find_path(const CF_AStarGridInternal* grid, CF_AStarContext* ctx, int start, int end, bool allow_diagonal_movement, dyna int** out_x, dyna int** out_y)
+{
+	if (s_cell_cost(grid, end) <= 0) {
+		// The end can never be entered, no need to search the whole grid to find that out.
+		return false;
+	}
+
+	// The hierarchy may miss paths that squeeze diagonally past the corner of a cluster, so a full search double
+	// checks before giving up. A hierarchy built for the other diagonal mode can't be used at all.
+	const CF_AStarHierarchy* hier = &grid->hierarchy;
+	if (s_wants_hierarchy(grid, start, end) && hier->diagonal == allow_diagonal_movement && !hier->dirty_clusters.count()) {
+		if (s_hierarchical_a_star(grid, ctx, start, end, allow_diagonal_movement, out_x, out_y)) {
+			return true;
+		}
+	}
+	if (s_uses_jump_points(grid, allow_diagonal_movement)) {
+		return s_jump_point_search(grid, ctx, start, end, out_x, out_y);
+	}
+	if (s_search(grid, ctx, start, end, s_grid_bounds(grid), allow_diagonal_movement, false)) {
+		s_push_path(grid, ctx, end, out_x, out_y);
+		return true;
+	}
+	return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Path cache.
+
+static CF_INLINE uint64_t s_path_key(int start, int end, bool allow_diagonal_movement)
+{
+	return ((uint64_t)(uint32_t)start << 32 | (uint32_t)end) ^ (allow_diagonal_movement ? 1ULL << 63 : 0);
+}
+
+static void s_forget_path(CF_AStarPathCache* cache, int slot)
+{
+	cache->slots.remove(cache->paths[slot].key);
+	cache->paths[slot].used = false;
+}
+
+static void s_remember_path(CF_AStarPathCache* cache, uint64_t key, bool found, const int* x, const int* y, int count)
+{
+	// Reuse an empty slot, or else the least recently used one.
+	int slot = 0;
+	for (int i = 0; i < cache->paths.count(); ++i) {
+		if (!cache->paths[i].used) {
+			slot = i;
+			break;
+		}
+		if (cache->paths[i].last_used < cache->paths[slot].last_used) slot = i;
+	}
+	if (cache->paths[slot].used) s_forget_path(cache, slot);
+
+	CF_AStarCachedPath* path = cache->paths + slot;
+	path->used = true;
+	path->found = found;
+	path->key = key;
+	path->last_used = ++cache->tick;
+	path->x.clear();
+	path->y.clear();
+	path->bounds = { INT_MAX, INT_MAX, INT_MIN, INT_MIN };
+	for (int i = 0; i < count; ++i) {
+		path->x.add(x[i]);
+		path->y.add(y[i]);
+		path->bounds.x0 = cf_min(path->bounds.x0, x[i]);
+		path->bounds.y0 = cf_min(path->bounds.y0, y[i]);
+		path->bounds.x1 = cf_max(path->bounds.x1, x[i]);
+		path->bounds.y1 = cf_max(path->bounds.y1, y[i]);
+	}
+	cache->slots.insert(key, slot);
+}
+
+static void s_invalidate_paths(CF_AStarPathCache* cache, int x, int y, float old_cost, float new_cost)
+{
+	// Blocked cells are infinitely expensive.
+	float old_effective = old_cost > 0 ? old_cost : FLT_MAX;
+	float new_effective = new_cost > 0 ? new_cost : FLT_MAX;
+	if (new_effective == old_effective) return;
+	for (int i = 0; i < cache->paths.count(); ++i) {
+		CF_AStarCachedPath* path = cache->paths + i;
+		if (!path->used) continue;
+		if (new_effective < old_effective) {
+			// A cheaper cell could shorten any path, or open up new ones.
+			s_forget_path(cache, i);
+		} else if (path->found && x >= path->bounds.x0 && x <= path->bounds.x1 && y >= path->bounds.y0 && y <= path->bounds.y1) {
+			// A pricier cell only matters to paths crossing it.
+			for (int j = 0; j < path->x.count(); ++j) {
+				if (path->x[j] == x && path->y[j] == y) {
+					s_forget_path(cache, i);
+					break;
+				}
+			}
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
 
 CF_AStarGrid cf_make_a_star_grid(int w, int h, float* cell_costs)
 {
@@ -72,12 +858,17 @@ CF_AStarGrid cf_make_a_star_grid(int w, int h, float* cell_costs)
 	grid->w = w;
 	grid->h = h;
 	grid->cell_costs = cell_costs;
-	grid->nodes.ensure_count(w * h);
+	s_init_context(&grid->context, w * h);
 	CF_AStarGrid result;
 	result.id = (uint64_t)grid;
 	return result;
 }
 
+static CF_INLINE int s_is_weighted(float cost)
+{
+	return cost > 0 && cost != 1.0f;
+}
+
 float cf_a_star_grid_get_cost(CF_AStarGrid grid_handle, int x, int y)
 {
 	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
@@ -88,112 +879,345 @@ float cf_a_star_grid_get_cost(CF_AStarGrid grid_handle, int x, int y)
 void cf_a_star_grid_set_cost(CF_AStarGrid grid_handle, int x, int y, float cost)
 {
 	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
-	grid->cell_costs[y * grid->w + x] = cost;
+	int index = y * grid->w + x;
+	float old_cost = grid->cell_costs[index];
+	grid->cell_costs[index] = cost;
+	if (grid->hierarchy.cluster_size) s_mark_cluster_dirty(&grid->hierarchy, s_cluster_of(grid, index));
+	if (grid->path_cache.capacity) s_invalidate_paths(&grid->path_cache, x, y, old_cost, cost);
+	if (grid->jump_points) grid->weighted_cell_count += s_is_weighted(cost) - s_is_weighted(old_cost);
+}
+
+void cf_a_star_grid_enable_jump_points(CF_AStarGrid grid_handle, bool enable)
+{
+	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
+	grid->jump_points = enable;
+	grid->weighted_cell_count = 0;
+	if (!enable || !grid->cell_costs) return;
+	for (int i = 0; i < grid->w * grid->h; ++i) {
+		grid->weighted_cell_count += s_is_weighted(grid->cell_costs[i]);
+	}
+}
+
+void cf_a_star_grid_enable_hierarchy(CF_AStarGrid grid_handle, int cluster_size)
+{
+	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
+	CF_AStarHierarchy* hier = &grid->hierarchy;
+	hier->clusters.clear();
+	hier->dirty_clusters.clear();
+	hier->entrances.clear();
+	hier->free_entrances.clear();
+	hier->cluster_size = cluster_size > 0 ? cluster_size : 0;
+	hier->cw = 0;
+	hier->ch = 0;
+	if (!hier->cluster_size) return;
+
+	// Everything starts dirty, and gets built by the first query.
+	hier->cw = (grid->w + cluster_size - 1) / cluster_size;
+	hier->ch = (grid->h + cluster_size - 1) / cluster_size;
+	int cluster_count = hier->cw * hier->ch;
+	hier->clusters.ensure_count(cluster_count);
+	hier->border_stamps.ensure_count(cluster_count * 2);
+	hier->cluster_stamps.ensure_count(cluster_count);
+	for (int i = 0; i < cluster_count; ++i) {
+		hier->border_stamps[i * 2] = hier->border_stamps[i * 2 + 1] = 0;
+		hier->cluster_stamps[i] = 0;
+		s_mark_cluster_dirty(hier, i);
+	}
+	hier->stamp = 0;
+}
+
+void cf_a_star_grid_enable_path_cache(CF_AStarGrid grid_handle, int capacity)
+{
+	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
+	CF_AStarPathCache* cache = &grid->path_cache;
+	cache->paths.clear();
+	cache->slots.clear();
+	cache->capacity = capacity > 0 ? capacity : 0;
+	cache->paths.ensure_count(cache->capacity);
 }
 
 void cf_destroy_a_star_grid(CF_AStarGrid grid_handle)
 {
 	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
+	for (int i = 0; i < grid->batch_contexts.count(); ++i) {
+		CF_AStarContext* ctx = grid->batch_contexts[i];
+		ctx->~CF_AStarContext();
+		CF_FREE(ctx);
+	}
 	grid->~CF_AStarGridInternal();
 	CF_FREE(grid);
 }
 
+// Answers a query from the cache, if it's there.
+static bool s_lookup_path(CF_AStarPathCache* cache, uint64_t key, bool* found, dyna int** out_x, dyna int** out_y)
+{
+	if (!cache->capacity) return false;
+	int* slot = cache->slots.try_get(key);
+	if (!slot) return false;
+	CF_AStarCachedPath* path = cache->paths + *slot;
+	path->last_used = ++cache->tick;
+	*found = path->found;
+	if (path->found && out_x) {
+		afit(*out_x, path->x.count());
+		afit(*out_y, path->y.count());
+		for (int i = 0; i < path->x.count(); ++i) {
+			apush(*out_x, path->x[i]);
+			apush(*out_y, path->y[i]);
+		}
+	}
+	return true;
+}
+
+// Hands the path over to `out`, or frees it if there's nowhere to put it.
+static void s_finish_output(bool found, dyna int* out_x, dyna int* out_y, CF_AStarOutput* out)
+{
+	if (found && out) {
+		out->count = acount(out_x);
+		out->x = out_x;
+		out->y = out_y;
+		CF_ASSERT(acount(out_x) == acount(out_y));
+	} else {
+		afree(out_x);
+		afree(out_y);
+	}
+}
+
 bool cf_a_star(CF_AStarGrid grid_handle, int start_x, int start_y, int end_x, int end_y, bool allow_diagonal_movement, CF_AStarOutput* out)
 {
 	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
-	grid->reset();
-	PriorityQueue<CF_AStarNodeInternal*>& open_list = grid->open_list;
-	CF_iv2 s = { start_x, start_y };
-	CF_iv2 e = { end_x, end_y };
-	float allow_diagonals = allow_diagonal_movement ? 1.0f : 0;
-	CF_AStarNodeInternal* nodes = grid->nodes.data();
-	const float* cell_costs = grid->cell_costs;
 	dyna int* out_x = NULL;
 	dyna int* out_y = NULL;
 
-	if (s.x == e.x && s.y == e.y) {
-		if (out) {
-			apush(out_x, s.x);
-			apush(out_y, s.y);
-			out->count = 1;
-			out->x = out_x;
-			out->y = out_y;
-		}
+	if (start_x == end_x && start_y == end_y) {
+		apush(out_x, start_x);
+		apush(out_y, start_y);
+		s_finish_output(true, out_x, out_y, out);
 		return true;
 	}
 
 	int w = grid->w;
-	int h = grid->h;
-	int index = s.y * w + s.x;
-	CF_AStarNodeInternal* initial = nodes + index;
-	initial->g = 0;
-	initial->h = cf_internal_s_heuristic(s, e, allow_diagonals);
-	initial->f = initial->h;
-	initial->visited = true;
-	open_list.push_min(initial, initial->f);
+	int start = start_y * w + start_x;
+	int end = end_y * w + end_x;
+	CF_AStarPathCache* cache = &grid->path_cache;
+	uint64_t key = s_path_key(start, end, allow_diagonal_movement);
+	bool found = false;
+	if (s_lookup_path(cache, key, &found, out ? &out_x : NULL, &out_y)) {
+		s_finish_output(found, out_x, out_y, out);
+		return found;
+	}
 
-	while (open_list.count()) {
-		CF_AStarNodeInternal* q;
-		open_list.pop_min(&q);
-		CF_iv2 qp = q->p;
-
-		if (qp.x == e.x && qp.y == e.y) {
-			if (out) {
-				while (q->parent) {
-					apush(out_x, q->p.x);
-					apush(out_y, q->p.y);
-					q = q->parent;
-				}
+	if (s_wants_hierarchy(grid, start, end)) {
+		s_update_hierarchy(grid, allow_diagonal_movement);
+	}
+	found = s_find_path(grid, &grid->context, start, end, allow_diagonal_movement, &out_x, &out_y);
 
-				arev(out_x);
-				arev(out_y);
-				out->count = acount(out_x);
-				CF_ASSERT(acount(out_x) == acount(out_y));
-			}
+	if (cache->capacity) {
+		s_remember_path(cache, key, found, out_x, out_y, acount(out_x));
+	}
+	s_finish_output(found, out_x, out_y, out);
+	return found;
+}
 
-			return true;
-		}
+struct CF_AStarBatchTask
+{
+	const CF_AStarGridInternal* grid;
+	CF_AStarContext* ctx;
+	const CF_AStarQuery* queries;
+	const int* misses;
+	int miss_count;
+	CF_AtomicInt* next_miss;
+	CF_AStarOutput* outs;
+};
 
-		int next_count = 0;
-		CF_AStarNodeInternal* next[8];
+static void CF_CALL s_batch_task(void* param)
+{
+	CF_AStarBatchTask* task = (CF_AStarBatchTask*)param;
+	const CF_AStarGridInternal* grid = task->grid;
+	int w = grid->w;
 
-		#define CF_A_STAR_ADD_SUCCESSOR(x, y) \
-			if ((x) >= 0 && (x) < w && (y) >= 0 && (y) < h) { \
-				next[next_count++] = nodes + ((y) * w + (x)); \
-			}
+	// Paths vary wildly in length, so tasks grab queries one at a time until they run out.
+	for (int i = cf_atomic_add(task->next_miss, 1); i < task->miss_count; i = cf_atomic_add(task->next_miss, 1)) {
+		int q = task->misses[i];
+		const CF_AStarQuery* query = task->queries + q;
+		dyna int* out_x = NULL;
+		dyna int* out_y = NULL;
+		int start = query->start_y * w + query->start_x;
+		int end = query->end_y * w + query->end_x;
+		bool found = s_find_path(grid, task->ctx, start, end, query->allow_diagonal_movement, &out_x, &out_y);
+		s_finish_output(found, out_x, out_y, task->outs + q);
+	}
+}
 
-		CF_A_STAR_ADD_SUCCESSOR(qp.x + 1, qp.y);
-		CF_A_STAR_ADD_SUCCESSOR(qp.x, qp.y + 1);
-		CF_A_STAR_ADD_SUCCESSOR(qp.x - 1, qp.y);
-		CF_A_STAR_ADD_SUCCESSOR(qp.x, qp.y - 1);
-		if (allow_diagonal_movement) {
-			CF_A_STAR_ADD_SUCCESSOR(qp.x + 1, qp.y + 1);
-			CF_A_STAR_ADD_SUCCESSOR(qp.x - 1, qp.y + 1);
-			CF_A_STAR_ADD_SUCCESSOR(qp.x + 1, qp.y - 1);
-			CF_A_STAR_ADD_SUCCESSOR(qp.x - 1, qp.y - 1);
+int cf_a_star_batch(CF_AStarGrid grid_handle, const CF_AStarQuery* queries, int count, CF_AStarOutput* outs, CF_Threadpool* pool)
+{
+	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
+	CF_AStarPathCache* cache = &grid->path_cache;
+	int w = grid->w;
+
+	// Everything that writes to the grid happens here, up front, so the searches themselves only read it.
+	Array<int> misses;
+	bool hierarchy_updated = false;
+	for (int i = 0; i < count; ++i) {
+		const CF_AStarQuery* query = queries + i;
+		CF_AStarOutput* out = outs + i;
+		out->count = 0;
+		out->x = NULL;
+		out->y = NULL;
+		bool found = false;
+		if (query->start_x == query->end_x && query->start_y == query->end_y) {
+			apush(out->x, query->start_x);
+			apush(out->y, query->start_y);
+			out->count = 1;
+			continue;
+		}
+		int start = query->start_y * w + query->start_x;
+		int end = query->end_y * w + query->end_x;
+		if (s_lookup_path(cache, s_path_key(start, end, query->allow_diagonal_movement), &found, &out->x, &out->y)) {
+			out->count = acount(out->x);
+			continue;
 		}
+		// The hierarchy holds one diagonal mode at a time, so a batch mixing both only uses it for one.
+		if (!hierarchy_updated && s_wants_hierarchy(grid, start, end)) {
+			s_update_hierarchy(grid, query->allow_diagonal_movement);
+			hierarchy_updated = true;
+		}
+		misses.add(i);
+	}
 
-		for (int i = 0; i < next_count; ++i) {
-			CF_AStarNodeInternal* n = next[i];
-			index = n->p.y * w + n->p.x;
-			float cell_cost = cell_costs ? cell_costs[index] : 1.0f;
-			bool non_traversable = cell_cost <= 0;
-			float g = n->g + cell_cost;
-			if (n->visited) continue;
-			if (non_traversable) continue;
-			if (n->g <= g) continue;
+	// One task per context. Each context holds a node per cell, so don't make more than the batch needs.
+	int task_count = pool ? cf_clamp_int(misses.count() / A_STAR_BATCH_QUERIES_PER_TASK, 1, cf_core_count()) : 1;
+	while (grid->batch_contexts.count() < task_count - 1) {
+		CF_AStarContext* ctx = CF_NEW(CF_AStarContext);
+		s_init_context(ctx, grid->w * grid->h);
+		grid->batch_contexts.add(ctx);
+	}
+	CF_AtomicInt next_miss = { 0 };
+	Array<CF_AStarBatchTask> tasks;
+	tasks.ensure_count(task_count);
+	for (int i = 0; i < task_count; ++i) {
+		CF_AStarBatchTask* task = tasks + i;
+		task->grid = grid;
+		task->ctx = i ? grid->batch_contexts[i - 1] : &grid->context;
+		task->queries = queries;
+		task->misses = misses.data();
+		task->miss_count = misses.count();
+		task->next_miss = &next_miss;
+		task->outs = outs;
+	}
+	if (task_count > 1) {
+		CF_AtomicInt counter = { 0 };
+		for (int i = 0; i < task_count; ++i) {
+			cf_threadpool_add_dependent_task(pool, s_batch_task, tasks + i, NULL, 0, &counter);
+		}
+		cf_threadpool_kick(pool);
+		cf_threadpool_wait_counter(pool, &counter);
+	} else {
+		s_batch_task(tasks.data());
+	}
 
-			float h = cf_internal_s_heuristic(n->p, e, allow_diagonals);
-			n->g = g;
-			n->h = h;
-			n->f = g + h;
-			n->parent = q;
-			n->visited = true;
-			open_list.push_min(n, n->f);
+	int found_count = 0;
+	for (int i = 0; i < count; ++i) {
+		if (outs[i].count) ++found_count;
+	}
+	if (cache->capacity) {
+		for (int i = 0; i < misses.count(); ++i) {
+			const CF_AStarQuery* query = queries + misses[i];
+			const CF_AStarOutput* out = outs + misses[i];
+			uint64_t key = s_path_key(query->start_y * w + query->start_x, query->end_y * w + query->end_x, query->allow_diagonal_movement);
+			// The same query may show up more than once in a batch.
+			if (cache->slots.try_get(key)) continue;
+			s_remember_path(cache, key, out->count > 0, out->x, out->y, out->count);
 		}
 	}
+	return found_count;
+}
 
-	return false;
+//--------------------------------------------------------------------------------------------------
+// Flow fields.
+
+static void s_build_flow_field(CF_AStarFlowFieldInternal* field)
+{
+	CF_AStarGridInternal* grid = field->grid;
+	CF_AStarContext* ctx = &grid->context;
+	int cell_count = grid->w * grid->h;
+	field->costs.ensure_count(cell_count);
+	field->next.ensure_count(cell_count);
+
+	// Searching backwards from the goal finds the cost from every cell to it, and each cell's parent is its next step.
+	bool reachable = s_cell_cost(grid, field->goal) > 0;
+	if (reachable) {
+		s_search(grid, ctx, field->goal, -1, s_grid_bounds(grid), field->allow_diagonal_movement, true);
+	}
+	float* costs = field->costs.data();
+	int* next = field->next.data();
+	for (int i = 0; i < cell_count; ++i) {
+		costs[i] = reachable ? s_node_cost(ctx, i) : FLT_MAX;
+		next[i] = costs[i] == FLT_MAX ? -1 : ctx->nodes[i].parent;
+	}
+	if (!reachable) return;
+
+	// Like `cf_a_star`, agents stuck in a blocked cell may step out of it into the best open neighbor.
+	int w = grid->w;
+	for (int i = 0; i < cell_count; ++i) {
+		if (s_cell_cost(grid, i) > 0) continue;
+		CF_iv2 p = s_cell_p(grid, i);
+		for (int dy = -1; dy <= 1; ++dy) {
+			for (int dx = -1; dx <= 1; ++dx) {
+				if (!(dx || dy) || (dx && dy && !field->allow_diagonal_movement)) continue;
+				if (!s_is_open(grid, p.x + dx, p.y + dy)) continue;
+				int n = (p.y + dy) * w + p.x + dx;
+				if (costs[n] == FLT_MAX) continue;
+				float cost = costs[n] + s_cell_cost(grid, n) * (dx && dy ? 1.4142135f : 1.0f);
+				if (cost < costs[i]) {
+					costs[i] = cost;
+					next[i] = n;
+				}
+			}
+		}
+	}
+}
+
+CF_AStarFlowField cf_make_a_star_flow_field(CF_AStarGrid grid_handle, int goal_x, int goal_y, bool allow_diagonal_movement)
+{
+	CF_AStarGridInternal* grid = (CF_AStarGridInternal*)grid_handle.id;
+	CF_AStarFlowFieldInternal* field = CF_NEW(CF_AStarFlowFieldInternal);
+	field->grid = grid;
+	field->goal = goal_y * grid->w + goal_x;
+	field->allow_diagonal_movement = allow_diagonal_movement;
+	s_build_flow_field(field);
+	CF_AStarFlowField result;
+	result.id = (uint64_t)field;
+	return result;
+}
+
+void cf_destroy_a_star_flow_field(CF_AStarFlowField field_handle)
+{
+	CF_AStarFlowFieldInternal* field = (CF_AStarFlowFieldInternal*)field_handle.id;
+	field->~CF_AStarFlowFieldInternal();
+	CF_FREE(field);
+}
+
+void cf_a_star_flow_field_update(CF_AStarFlowField field_handle)
+{
+	CF_AStarFlowFieldInternal* field = (CF_AStarFlowFieldInternal*)field_handle.id;
+	s_build_flow_field(field);
+}
+
+float cf_a_star_flow_field_cost(CF_AStarFlowField field_handle, int x, int y)
+{
+	CF_AStarFlowFieldInternal* field = (CF_AStarFlowFieldInternal*)field_handle.id;
+	float cost = field->costs[y * field->grid->w + x];
+	return cost == FLT_MAX ? -1.0f : cost;
+}
+
+bool cf_a_star_flow_field_next(CF_AStarFlowField field_handle, int x, int y, int* next_x, int* next_y)
+{
+	CF_AStarFlowFieldInternal* field = (CF_AStarFlowFieldInternal*)field_handle.id;
+	int next = field->next[y * field->grid->w + x];
+	if (next < 0) return false;
+	if (next_x) *next_x = next % field->grid->w;
+	if (next_y) *next_y = next / field->grid->w;
+	return true;
 }
 
 CF_API void CF_CALL cf_free_a_star_output(CF_AStarOutput* out)
@@ -9,16 +9,27 @@
 #include <cute_array.h>
 #include <cute_alloc.h>
 #include <cute_defer.h>
+#include <cute_multithreading.h>
 
 #include <internal/cute_alloc_internal.h>
-#include <internal/cute_serialize_internal.h>
 
 #include <float.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_AABB_TREE_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_AABB_TREE_NEON
+#endif
+
 #define AABB_TREE_EXPAND_CONSTANT 2.0f
 #define AABB_TREE_STACK_QUERY_CAPACITY 256
 #define AABB_TREE_NULL_NODE_INDEX -1
 #define AABB_TREE_MOVE_CONSTANT 4.0f
+#define AABB_TREE_SAH_BIN_COUNT 16
+#define AABB_TREE_FILE_VERSION 1
+#define AABB_TREE_FILE_ENDIAN_CHECK 0x01020304
 
 using namespace Cute;
 
@@ -30,6 +41,31 @@ struct CF_AabbTreeNode
 	int height;
 };
 
+// A node of the flattened query layout: four children with their bounds stored as SoA, so one
+// node is tested against a query with a handful of SIMD ops. Children >= 0 are wide nodes, and
+// children < 0 are leaves, stored as `~leaf`. Unused slots have inverted bounds and never hit.
+struct CF_AabbTreeWideNode
+{
+	float min_x[4];
+	float min_y[4];
+	float max_x[4];
+	float max_y[4];
+	int children[4];
+};
+
+// The serialized layout, as written by `cf_aabb_tree_serialize`: this header, then `node_count` wide nodes
+// (the root first), then `leaf_count` leaf AABBs. Leaves are numbered 0 to `leaf_count - 1`. Everything is
+// stored in native byte order, and the header keeps the nodes 16 byte aligned, so it's read in place.
+struct CF_AabbTreeFileHeader
+{
+	char fourcc[4];
+	uint32_t version;
+	uint32_t endian_check;
+	uint32_t node_count;
+	uint32_t leaf_count;
+	uint32_t unused[3];
+};
+
 struct CF_AabbTreeInternal
 {
 	int root = AABB_TREE_NULL_NODE_INDEX;
@@ -39,8 +75,41 @@ struct CF_AabbTreeInternal
 	Array<CF_AabbTreeNode> nodes;
 	Array<CF_Aabb> aabbs;
 	Array<void*> udatas;
+	// Built by `cf_aabb_tree_flatten`, and emptied by any change to the tree. Queries use it when present.
+	Array<CF_AabbTreeWideNode> wide;
+	// Bumped whenever a leaf is added, removed or grows, to tell sweep caches their gathered leaves are stale.
+	uint64_t version = 0;
+	// Set for query-only trees read in place from a serialized buffer, in which case the arrays above are unused.
+	// `view_copy` is the buffer's copy owned by the tree, made by `cf_make_aabb_tree_from_memory`.
+	const CF_AabbTreeFileHeader* view = NULL;
+	void* view_copy = NULL;
 };
 
+static CF_INLINE const CF_AabbTreeWideNode* s_view_nodes(const CF_AabbTreeFileHeader* view)
+{
+	return (const CF_AabbTreeWideNode*)(view + 1);
+}
+
+static CF_INLINE const CF_Aabb* s_view_aabbs(const CF_AabbTreeFileHeader* view)
+{
+	return (const CF_Aabb*)(s_view_nodes(view) + view->node_count);
+}
+
+static CF_INLINE size_t s_view_size(uint32_t node_count, uint32_t leaf_count)
+{
+	return sizeof(CF_AabbTreeFileHeader) + sizeof(CF_AabbTreeWideNode) * node_count + sizeof(CF_Aabb) * leaf_count;
+}
+
+static CF_INLINE CF_Aabb s_leaf_aabb(const CF_AabbTreeInternal* tree, int index)
+{
+	return tree->view ? s_view_aabbs(tree->view)[index] : tree->aabbs[index];
+}
+
+static CF_INLINE void* s_leaf_udata(const CF_AabbTreeInternal* tree, int index)
+{
+	return tree->view ? NULL : tree->udatas[index];
+}
+
 static int s_balance(CF_AabbTreeInternal* tree, int index_a)
 {
 	//      a
@@ -288,6 +357,8 @@ struct CF_AabbTreePriorityQueue
 		return true;
 	}
 
+	inline int count() const { return m_count; }
+
 private:
 	inline int predicate(int index_a, int index_b)
 	{
@@ -358,58 +429,24 @@ static int s_branch_and_bound_find_optimal_sibling(CF_AabbTreeInternal* tree, CF
 	return best_index;
 }
 
-static void s_write_v2(uint8_t** p, CF_V2 value)
-{
-	cf_write_float(p, value.x);
-	cf_write_float(p, value.y);
-}
-
-static CF_V2 s_read_v2(uint8_t** p)
+// Precomputed per ray, so each node only costs a box test and a slab test. Sweeps are rays whose `extent`
+// grows each box tested, by the half extents of the swept shape's bounds.
+struct CF_AabbTreeRay
 {
-	CF_V2 value;
-	value.x = cf_read_float(p);
-	value.y = cf_read_float(p);
-	return value;
-}
-
-static void s_init_from_buffer(CF_AabbTreeInternal* tree, uint8_t** p, int height)
-{
-	bool is_leaf = !!cf_read_uint8(p);
-	CF_V2 min = s_read_v2(p);
-	CF_V2 max = s_read_v2(p);
-	int index_a = AABB_TREE_NULL_NODE_INDEX;
-	int index_b = AABB_TREE_NULL_NODE_INDEX;
-	if (!is_leaf) {
-		index_a = cf_read_uint32(p);
-		index_b = cf_read_uint32(p);
-	}
-	int index_parent = cf_read_uint32(p);
-
-	CF_Aabb aabb = cf_make_aabb(min, max);
-	CF_AabbTreeNode node;
-	node.index_a = index_a;
-	node.index_b = index_b;
-	node.index_parent = index_parent;
-	node.height = height;
-	tree->aabbs.add(aabb);
-	tree->nodes.add(node);
-	tree->udatas.add(NULL);
-
-	if (!is_leaf) {
-		s_init_from_buffer(tree, p, height + 1);
-		s_init_from_buffer(tree, p, height + 1);
-	}
-}
+	CF_Ray inv;
+	CF_V2 extent;
+	CF_Aabb bounds;
+};
 
-static inline int s_raycast(CF_Aabb aabb, CF_Ray ray_inv)
+static inline int s_raycast(CF_Aabb aabb, const CF_AabbTreeRay* ray)
 {
-	CF_V2 d0 = (aabb.min - ray_inv.p) * ray_inv.d;
-	CF_V2 d1 = (aabb.min - ray_inv.p) * ray_inv.d;
+	CF_V2 d0 = (aabb.min - ray->extent - ray->inv.p) * ray->inv.d;
+	CF_V2 d1 = (aabb.max + ray->extent - ray->inv.p) * ray->inv.d;
 	CF_V2 v0 = cf_min_v2(d0, d1);
 	CF_V2 v1 = cf_max_v2(d0, d1);
 	float tmin = cf_hmax(v0);
 	float tmax = cf_hmin(v1);
-	return (tmax >= 0) && (tmax >= tmin) && (tmin <= ray_inv.t);
+	return (tmax >= 0) && (tmax >= tmin) && (tmin <= ray->inv.t);
 }
 
 static float s_tree_cost(CF_AabbTreeInternal* tree, int index)
@@ -421,101 +458,6 @@ static float s_tree_cost(CF_AabbTreeInternal* tree, int index)
 	return cost_a + cost_b + my_cost;
 }
 
-static void s_build_index_map(CF_AabbTreeInternal* tree, Array<int>* map, int* i, int index)
-{
-	if (map->operator[](index) == AABB_TREE_NULL_NODE_INDEX) {
-		CF_ASSERT(*i < (int)tree->nodes.size());
-		map->operator[](index) = *i;
-		*i = *i + 1;
-	}
-
-	if (tree->nodes[index].index_a != AABB_TREE_NULL_NODE_INDEX) {
-		CF_ASSERT(tree->nodes[index].index_b != AABB_TREE_NULL_NODE_INDEX);
-		s_build_index_map(tree, map, i, tree->nodes[index].index_a);
-		s_build_index_map(tree, map, i, tree->nodes[index].index_b);
-	}
-}
-
-CF_AabbTreeInternal* s_remap(CF_AabbTreeInternal* tree)
-{
-	if (tree->root == AABB_TREE_NULL_NODE_INDEX) {
-		return NULL;
-	}
-
-	// Build a map of old to new indices.
-	Array<int> map;
-	map.ensure_count(tree->node_count);
-	CF_MEMSET(map.data(), AABB_TREE_NULL_NODE_INDEX, sizeof(int) * tree->node_count);
-	int i = 0;
-	s_build_index_map(tree, &map, &i, tree->root);
-	CF_ASSERT(i == tree->node_count);
-
-	// Create a copy of the input tree.
-	CF_AabbTreeInternal* result = (CF_AabbTreeInternal*)cf_make_aabb_tree(tree->node_count).id;
-	result->root = tree->root;
-	result->nodes = tree->nodes;
-	result->aabbs = tree->aabbs;
-	result->udatas = tree->udatas;
-	result->freelist = tree->freelist;
-	result->node_capacity = tree->node_capacity;
-	result->node_count = tree->node_count;
-	Array<CF_AabbTreeNode>& nodes = result->nodes;
-	Array<CF_Aabb>& aabbs = result->aabbs;
-	Array<void*>& udatas = result->udatas;
-
-	// Swap all values to a contiguous form within the copy.
-	for (int i = 0; i < (int)map.size(); ++i) {
-		int new_index = map[i];
-		if (new_index == AABB_TREE_NULL_NODE_INDEX) continue;
-		nodes[new_index] = nodes[i];
-		aabbs[new_index] = aabbs[i];
-		udatas[new_index] = udatas[i];
-
-		// Reassign all indices within each node.
-		int index_a = nodes[new_index].index_a;
-		int index_b = nodes[new_index].index_b;
-		int index_parent = nodes[new_index].index_parent;
-
-		nodes[new_index].index_a = index_a != AABB_TREE_NULL_NODE_INDEX ? map[index_a] : AABB_TREE_NULL_NODE_INDEX;
-		nodes[new_index].index_b = index_b != AABB_TREE_NULL_NODE_INDEX ? map[index_b] : AABB_TREE_NULL_NODE_INDEX;
-		nodes[new_index].index_parent = index_parent != AABB_TREE_NULL_NODE_INDEX ? map[index_parent] : AABB_TREE_NULL_NODE_INDEX;
-	}
-
-	// Return the copy.
-	CF_ASSERT(map[result->root] == 0);
-	result->root = 0;
-	return result;
-}
-
-static void s_serialize_to_buffer(CF_AabbTreeInternal* tree, uint8_t** p, int index)
-{
-	CF_AabbTreeNode* nodes = tree->nodes.data();
-	CF_AabbTreeNode* node = nodes + index;
-	bool is_leaf = node->index_a == AABB_TREE_NULL_NODE_INDEX;
-
-	if (is_leaf) {
-		cf_write_uint8(p, 1);
-	} else {
-		cf_write_uint8(p, 0);
-	}
-
-	CF_Aabb aabb = tree->aabbs[index];
-	s_write_v2(p, aabb.min);
-	s_write_v2(p, aabb.max);
-
-	if (!is_leaf) {
-		cf_write_uint32(p, node->index_a);
-		cf_write_uint32(p, node->index_b);
-	}
-	cf_write_uint32(p, node->index_parent);
-
-	if (!is_leaf) {
-		CF_ASSERT(node->index_b != AABB_TREE_NULL_NODE_INDEX);
-		s_serialize_to_buffer(tree, p, node->index_a);
-		s_serialize_to_buffer(tree, p, node->index_b);
-	}
-}
-
 static int s_validate(CF_AabbTreeInternal* tree, int index, int depth)
 {
 	if (index == AABB_TREE_NULL_NODE_INDEX) return depth - 1;
@@ -560,39 +502,54 @@ CF_AabbTree cf_make_aabb_tree(int initial_capacity)
 	return result;
 }
 
-CF_AabbTree cf_make_aabb_tree_from_memory(const void* buffer, size_t size)
+// Checks `header` is from a serialized tree this build can read in place, spanning `size` bytes or less.
+static bool s_header_is_valid(const CF_AabbTreeFileHeader* header, size_t size)
 {
-	CF_AabbTreeInternal* tree = CF_NEW(CF_AabbTreeInternal);
-	uint8_t* p = (uint8_t*)buffer;
-	uint8_t fourcc[4];
-	cf_read_fourcc(&p, fourcc);
-	if (CF_MEMCMP(fourcc, "aabb", 4)) return { 0 };
-
-	int node_count = (int)cf_read_uint32(&p);
-	CF_AabbTree tree_handle = cf_make_aabb_tree(0);
-	tree->nodes.ensure_count(node_count);
-	tree->aabbs.ensure_count(node_count);
-	tree->udatas.ensure_count(node_count);
-	s_init_from_buffer(tree, &p, 0);
-
-	tree->node_count = node_count;
-	tree->root = 0;
-	tree->freelist = AABB_TREE_NULL_NODE_INDEX;
+	if (CF_MEMCMP(header->fourcc, "bvh4", 4)) return false;
+	if (header->version != AABB_TREE_FILE_VERSION || header->endian_check != AABB_TREE_FILE_ENDIAN_CHECK) return false;
+	return size >= s_view_size(header->node_count, header->leaf_count);
+}
 
+CF_AabbTree cf_make_aabb_tree_view(const void* buffer, size_t size)
+{
+	const CF_AabbTreeFileHeader* header = (const CF_AabbTreeFileHeader*)buffer;
+	if (!buffer || ((uintptr_t)buffer & 3) || size < sizeof(CF_AabbTreeFileHeader)) return { 0 };
+	if (!s_header_is_valid(header, size)) return { 0 };
+	CF_AabbTreeInternal* tree = CF_NEW(CF_AabbTreeInternal);
+	tree->view = header;
 	CF_AabbTree result;
 	result.id = (uint64_t)tree;
 	return result;
 }
 
+CF_AabbTree cf_make_aabb_tree_from_memory(const void* buffer, size_t size)
+{
+	// Read the header from a copy, as `buffer` itself may not be aligned.
+	CF_AabbTreeFileHeader header;
+	if (!buffer || size < sizeof(header)) return { 0 };
+	CF_MEMCPY(&header, buffer, sizeof(header));
+	if (!s_header_is_valid(&header, size)) return { 0 };
+	size = s_view_size(header.node_count, header.leaf_count);
+	void* copy = CF_ALLOC(size);
+	CF_MEMCPY(copy, buffer, size);
+	CF_AabbTree result = cf_make_aabb_tree_view(copy, size);
+	((CF_AabbTreeInternal*)result.id)->view_copy = copy;
+	return result;
+}
+
 void cf_destroy_aabb_tree(CF_AabbTree tree_handle)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	if (tree->view_copy) CF_FREE(tree->view_copy);
 	tree->~CF_AabbTreeInternal();
 	CF_FREE(tree);
 }
 
 static CF_Leaf s_insert(CF_AabbTreeInternal* tree, CF_Aabb aabb, void* udata)
 {
+	tree->wide.clear();
+	tree->version++;
+
 	// Make a new node.
 	int new_index = s_pop_freelist(tree, aabb, udata);
 	int search_index = tree->root;
@@ -646,23 +603,25 @@ static CF_Leaf s_insert(CF_AabbTreeInternal* tree, CF_Aabb aabb, void* udata)
 		s_refit_hierarchy(tree, parent_index);
 	}
 
-	CF_AabbTree tree_handle;
-	tree_handle.id = (uint64_t)tree;
-	cf_aabb_tree_validate(tree_handle);
-
 	return { new_index };
 }
 
 CF_Leaf cf_aabb_tree_insert(CF_AabbTree tree_handle, CF_Aabb aabb, void* udata)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_ASSERT(!tree->view);
 	aabb = cf_expand_aabb_f(aabb, AABB_TREE_EXPAND_CONSTANT);
-	return s_insert(tree, aabb, udata);
+	CF_Leaf leaf = s_insert(tree, aabb, udata);
+	cf_aabb_tree_validate(tree_handle);
+	return leaf;
 }
 
 void cf_aabb_tree_remove(CF_AabbTree tree_handle, CF_Leaf leaf)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_ASSERT(!tree->view);
+	tree->wide.clear();
+	tree->version++;
 	int index = leaf.id;
 	if (tree->root == index) {
 		tree->root = AABB_TREE_NULL_NODE_INDEX;
@@ -711,11 +670,13 @@ bool cf_aabb_tree_update_leaf(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aab
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
 
 	// Can only update leaves.
+	CF_ASSERT(!tree->view);
 	CF_ASSERT(tree->nodes[leaf.id].index_a == AABB_TREE_NULL_NODE_INDEX);
 	CF_ASSERT(tree->nodes[leaf.id].index_b == AABB_TREE_NULL_NODE_INDEX);
 
 	if (cf_contains_aabb(tree->aabbs[leaf.id], aabb)) {
 		tree->aabbs[leaf.id] = aabb;
+		tree->wide.clear();
 		return false;
 	}
 
@@ -726,14 +687,9 @@ bool cf_aabb_tree_update_leaf(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aab
 	return true;
 }
 
-bool cf_aabb_tree_move(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aabb, CF_V2 offset)
+// The AABB stored for a leaf moving by `offset`: padded, and stretched in the direction of movement.
+static CF_Aabb s_fat_aabb(CF_Aabb aabb, CF_V2 offset)
 {
-	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
-
-	// Can only update leaves.
-	CF_ASSERT(tree->nodes[leaf.id].index_a == AABB_TREE_NULL_NODE_INDEX);
-	CF_ASSERT(tree->nodes[leaf.id].index_b == AABB_TREE_NULL_NODE_INDEX);
-
 	aabb = cf_expand_aabb_f(aabb, AABB_TREE_EXPAND_CONSTANT);
 	CF_V2 delta = offset * AABB_TREE_MOVE_CONSTANT;
 
@@ -749,7 +705,12 @@ bool cf_aabb_tree_move(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aabb, CF_V
 		aabb.max.y += delta.y;
 	}
 
-	CF_Aabb old_aabb = tree->aabbs[leaf.id];
+	return aabb;
+}
+
+// A stored AABB can be kept if it still holds the new fat AABB, and isn't way too huge for it.
+static bool s_fat_aabb_is_stale(CF_Aabb old_aabb, CF_Aabb aabb)
+{
 	if (cf_contains_aabb(old_aabb, aabb)) {
 		CF_Aabb big_aabb = cf_expand_aabb_f(aabb, AABB_TREE_MOVE_CONSTANT);
 		bool old_aabb_is_not_way_too_huge = cf_contains_aabb(big_aabb, old_aabb);
@@ -757,10 +718,27 @@ bool cf_aabb_tree_move(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aabb, CF_V
 			return false;
 		}
 	}
+	return true;
+}
+
+bool cf_aabb_tree_move(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aabb, CF_V2 offset)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+
+	// Can only update leaves.
+	CF_ASSERT(!tree->view);
+	CF_ASSERT(tree->nodes[leaf.id].index_a == AABB_TREE_NULL_NODE_INDEX);
+	CF_ASSERT(tree->nodes[leaf.id].index_b == AABB_TREE_NULL_NODE_INDEX);
+
+	aabb = s_fat_aabb(aabb, offset);
+	if (!s_fat_aabb_is_stale(tree->aabbs[leaf.id], aabb)) {
+		return false;
+	}
 
 	void* udata = tree->udatas[leaf.id];
 	cf_aabb_tree_remove(tree_handle, leaf);
 	s_insert(tree, aabb, udata);
+	cf_aabb_tree_validate(tree_handle);
 
 	return true;
 }
@@ -768,95 +746,870 @@ bool cf_aabb_tree_move(CF_AabbTree tree_handle, CF_Leaf leaf, CF_Aabb aabb, CF_V
 CF_Aabb cf_aabb_tree_get_aabb(CF_AabbTree tree_handle, CF_Leaf leaf)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
-	return tree->aabbs[leaf.id];
+	return s_leaf_aabb(tree, leaf.id);
 }
 
 void* cf_aabb_tree_get_udata(CF_AabbTree tree_handle, CF_Leaf leaf)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
-	return tree->udatas[leaf.id];
+	return s_leaf_udata(tree, leaf.id);
 }
 
-void cf_aabb_tree_query_aabb(const CF_AabbTree tree_handle, CF_AabbTreeQueryFn* fn, CF_Aabb aabb, void* fn_udata)
+static CF_AabbTreeRay s_make_ray(CF_Ray ray)
+{
+	CF_AabbTreeRay result;
+	result.inv = ray;
+	// A zero component must make its slab infinitely wide, not empty, so stand in a huge inverse instead of zero.
+	result.inv.d.x = ray.d.x != 0 ? 1.0f / ray.d.x : 1.0e30f;
+	result.inv.d.y = ray.d.y != 0 ? 1.0f / ray.d.y : 1.0e30f;
+	result.extent = cf_v2(0, 0);
+	CF_V2 ray_end = cf_endpoint(ray);
+	result.bounds.min = cf_min_v2(ray.p, ray_end);
+	result.bounds.max = cf_max_v2(ray.p, ray_end);
+	return result;
+}
+
+// Returns a bit per child of `node` whose bounds overlap `bounds`, and that `ray` hits if it isn't NULL.
+static CF_INLINE int s_wide_hit_mask(const CF_AabbTreeWideNode* node, CF_Aabb bounds, const CF_AabbTreeRay* ray)
+{
+#if defined(CF_AABB_TREE_SSE2)
+	__m128 min_x = _mm_loadu_ps(node->min_x);
+	__m128 min_y = _mm_loadu_ps(node->min_y);
+	__m128 max_x = _mm_loadu_ps(node->max_x);
+	__m128 max_y = _mm_loadu_ps(node->max_y);
+	__m128 hit = _mm_and_ps(_mm_cmple_ps(min_x, _mm_set1_ps(bounds.max.x)), _mm_cmple_ps(_mm_set1_ps(bounds.min.x), max_x));
+	hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(min_y, _mm_set1_ps(bounds.max.y)), _mm_cmple_ps(_mm_set1_ps(bounds.min.y), max_y)));
+	if (ray) {
+		__m128 lo_x = _mm_set1_ps(ray->inv.p.x + ray->extent.x), lo_y = _mm_set1_ps(ray->inv.p.y + ray->extent.y);
+		__m128 hi_x = _mm_set1_ps(ray->inv.p.x - ray->extent.x), hi_y = _mm_set1_ps(ray->inv.p.y - ray->extent.y);
+		__m128 ix = _mm_set1_ps(ray->inv.d.x), iy = _mm_set1_ps(ray->inv.d.y);
+		__m128 x0 = _mm_mul_ps(_mm_sub_ps(min_x, lo_x), ix), x1 = _mm_mul_ps(_mm_sub_ps(max_x, hi_x), ix);
+		__m128 y0 = _mm_mul_ps(_mm_sub_ps(min_y, lo_y), iy), y1 = _mm_mul_ps(_mm_sub_ps(max_y, hi_y), iy);
+		__m128 tmin = _mm_max_ps(_mm_min_ps(x0, x1), _mm_min_ps(y0, y1));
+		__m128 tmax = _mm_min_ps(_mm_max_ps(x0, x1), _mm_max_ps(y0, y1));
+		hit = _mm_and_ps(hit, _mm_cmpge_ps(tmax, _mm_setzero_ps()));
+		hit = _mm_and_ps(hit, _mm_cmpge_ps(tmax, tmin));
+		hit = _mm_and_ps(hit, _mm_cmple_ps(tmin, _mm_set1_ps(ray->inv.t)));
+	}
+	return _mm_movemask_ps(hit);
+#elif defined(CF_AABB_TREE_NEON)
+	float32x4_t min_x = vld1q_f32(node->min_x);
+	float32x4_t min_y = vld1q_f32(node->min_y);
+	float32x4_t max_x = vld1q_f32(node->max_x);
+	float32x4_t max_y = vld1q_f32(node->max_y);
+	uint32x4_t hit = vandq_u32(vcleq_f32(min_x, vdupq_n_f32(bounds.max.x)), vcleq_f32(vdupq_n_f32(bounds.min.x), max_x));
+	hit = vandq_u32(hit, vandq_u32(vcleq_f32(min_y, vdupq_n_f32(bounds.max.y)), vcleq_f32(vdupq_n_f32(bounds.min.y), max_y)));
+	if (ray) {
+		float32x4_t lo_x = vdupq_n_f32(ray->inv.p.x + ray->extent.x), lo_y = vdupq_n_f32(ray->inv.p.y + ray->extent.y);
+		float32x4_t hi_x = vdupq_n_f32(ray->inv.p.x - ray->extent.x), hi_y = vdupq_n_f32(ray->inv.p.y - ray->extent.y);
+		float32x4_t ix = vdupq_n_f32(ray->inv.d.x), iy = vdupq_n_f32(ray->inv.d.y);
+		float32x4_t x0 = vmulq_f32(vsubq_f32(min_x, lo_x), ix), x1 = vmulq_f32(vsubq_f32(max_x, hi_x), ix);
+		float32x4_t y0 = vmulq_f32(vsubq_f32(min_y, lo_y), iy), y1 = vmulq_f32(vsubq_f32(max_y, hi_y), iy);
+		float32x4_t tmin = vmaxq_f32(vminq_f32(x0, x1), vminq_f32(y0, y1));
+		float32x4_t tmax = vminq_f32(vmaxq_f32(x0, x1), vmaxq_f32(y0, y1));
+		hit = vandq_u32(hit, vcgeq_f32(tmax, vdupq_n_f32(0)));
+		hit = vandq_u32(hit, vcgeq_f32(tmax, tmin));
+		hit = vandq_u32(hit, vcleq_f32(tmin, vdupq_n_f32(ray->inv.t)));
+	}
+	static const uint32_t bits[4] = { 1, 2, 4, 8 };
+	return (int)vaddvq_u32(vandq_u32(hit, vld1q_u32(bits)));
+#else
+	int mask = 0;
+	for (int i = 0; i < 4; ++i) {
+		CF_Aabb aabb = cf_make_aabb(cf_v2(node->min_x[i], node->min_y[i]), cf_v2(node->max_x[i], node->max_y[i]));
+		if (!cf_collide_aabb(bounds, aabb)) continue;
+		if (ray && !s_raycast(aabb, ray)) continue;
+		mask |= 1 << i;
+	}
+	return mask;
+#endif
+}
+
+// Calls `visit(leaf_index)` for each leaf overlapping `bounds`, and hit by `ray` if it isn't NULL, until `visit` returns false.
+template <typename V>
+static void s_query(const CF_AabbTreeInternal* tree, CF_Aabb bounds, const CF_AabbTreeRay* ray, V visit)
 {
-	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
-	if (tree->root == AABB_TREE_NULL_NODE_INDEX) return;
 	int index_stack_buf[AABB_TREE_STACK_QUERY_CAPACITY];
 	int* index_stack = NULL;
 	astatic(index_stack, index_stack_buf, CF_ARRAY_SIZE(index_stack_buf));
 	CF_DEFER(afree(index_stack));
+
+	const CF_AabbTreeWideNode* wide = tree->view ? s_view_nodes(tree->view) : tree->wide.data();
+	int wide_count = tree->view ? (int)tree->view->node_count : tree->wide.count();
+	if (wide_count) {
+		apush(index_stack, 0);
+		while (alen(index_stack)) {
+			const CF_AabbTreeWideNode* node = wide + apop(index_stack);
+			int mask = s_wide_hit_mask(node, bounds, ray);
+			for (int i = 0; i < 4; ++i) {
+				if (!(mask & (1 << i))) continue;
+				int child = node->children[i];
+				if (child < 0) {
+					if (!visit(~child)) return;
+				} else {
+					apush(index_stack, child);
+				}
+			}
+		}
+		return;
+	}
+
+	if (tree->root == AABB_TREE_NULL_NODE_INDEX) return;
 	const CF_AabbTreeNode* nodes = tree->nodes.data();
 	const CF_Aabb* aabbs = tree->aabbs.data();
-	void* const* udatas = tree->udatas.data();
 	apush(index_stack, tree->root);
-
 	while (alen(index_stack)) {
 		int index = apop(index_stack);
 		CF_Aabb search_aabb = aabbs[index];
+		if (!cf_collide_aabb(bounds, search_aabb)) continue;
+		if (ray && !s_raycast(search_aabb, ray)) continue;
+		const CF_AabbTreeNode* node = nodes + index;
+		if (node->index_a == AABB_TREE_NULL_NODE_INDEX) {
+			if (!visit(index)) return;
+		} else {
+			apush(index_stack, node->index_a);
+			apush(index_stack, node->index_b);
+		}
+	}
+}
 
-		if (cf_collide_aabb(aabb, search_aabb)) {
-			const CF_AabbTreeNode* node = nodes + index;
+void cf_aabb_tree_query_aabb(const CF_AabbTree tree_handle, CF_AabbTreeQueryFn* fn, CF_Aabb aabb, void* fn_udata)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	s_query(tree, aabb, NULL, [&](int index) {
+		CF_Leaf leaf = { index };
+		return fn(leaf, s_leaf_aabb(tree, index), s_leaf_udata(tree, index), fn_udata);
+	});
+}
 
-			if (node->index_a == AABB_TREE_NULL_NODE_INDEX) {
-				CF_Leaf leaf = { index };
-				if (!fn(leaf, search_aabb, udatas[index], fn_udata)) {
-					return;
-				}
-			} else {
-				apush(index_stack, node->index_a);
-				apush(index_stack, node->index_b);
+void cf_aabb_tree_query_ray(const CF_AabbTree tree_handle, CF_AabbTreeQueryFn* fn, CF_Ray ray, void* fn_udata)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_AabbTreeRay r = s_make_ray(ray);
+	s_query(tree, r.bounds, &r, [&](int index) {
+		CF_Leaf leaf = { index };
+		return fn(leaf, s_leaf_aabb(tree, index), s_leaf_udata(tree, index), fn_udata);
+	});
+}
+
+//--------------------------------------------------------------------------------------------------
+// Sweeps.
+
+static CF_Aabb s_verts_aabb(CF_Transform xf, const CF_V2* verts, int count)
+{
+	CF_V2 lo = cf_mul_tf_v2(xf, verts[0]);
+	CF_V2 hi = lo;
+	for (int i = 1; i < count; ++i) {
+		CF_V2 p = cf_mul_tf_v2(xf, verts[i]);
+		lo = cf_min_v2(lo, p);
+		hi = cf_max_v2(hi, p);
+	}
+	return cf_make_aabb(lo, hi);
+}
+
+static CF_Aabb s_shape_aabb(const void* shape, CF_ShapeType type, CF_Transform xf)
+{
+	switch (type) {
+	case CF_SHAPE_TYPE_CIRCLE:
+	{
+		const CF_Circle* circle = (const CF_Circle*)shape;
+		CF_V2 p = cf_mul_tf_v2(xf, circle->p);
+		return cf_expand_aabb_f(cf_make_aabb(p, p), circle->r);
+	}
+
+	case CF_SHAPE_TYPE_AABB:
+	{
+		CF_V2 verts[4];
+		cf_aabb_verts(verts, *(const CF_Aabb*)shape);
+		return s_verts_aabb(xf, verts, 4);
+	}
+
+	case CF_SHAPE_TYPE_CAPSULE:
+	{
+		const CF_Capsule* capsule = (const CF_Capsule*)shape;
+		CF_V2 a = cf_mul_tf_v2(xf, capsule->a);
+		CF_V2 b = cf_mul_tf_v2(xf, capsule->b);
+		return cf_expand_aabb_f(cf_make_aabb(cf_min_v2(a, b), cf_max_v2(a, b)), capsule->r);
+	}
+
+	default:
+	{
+		const CF_Poly* poly = (const CF_Poly*)shape;
+		return s_verts_aabb(xf, poly->verts, poly->count);
+	}
+	}
+}
+
+// One sweep in progress. `ray` starts at the center of the shape's bounds and is shortened to each hit found,
+// so the traversal stops opening nodes that could only be hit later.
+struct CF_AabbTreeSweep
+{
+	const void* shape;
+	CF_ShapeType type;
+	CF_Transform xf;
+	CF_V2 motion;
+	CF_AabbTreeRay ray;
+	CF_AabbTreeSweepFn* fn;
+	void* fn_udata;
+	CF_AabbTreeSweepResult result;
+};
+
+static CF_AabbTreeSweep s_make_sweep(const void* shape, CF_ShapeType type, const CF_Transform* transform, CF_V2 motion, CF_AabbTreeSweepFn* fn, void* fn_udata)
+{
+	CF_AabbTreeSweep sweep;
+	sweep.shape = shape;
+	sweep.type = type;
+	sweep.xf = transform ? *transform : cf_make_transform();
+	sweep.motion = motion;
+	sweep.fn = fn;
+	sweep.fn_udata = fn_udata;
+	CF_Aabb aabb = s_shape_aabb(shape, type, sweep.xf);
+	sweep.ray.inv.p = cf_center(aabb);
+	sweep.ray.inv.d.x = motion.x != 0 ? 1.0f / motion.x : 1.0e30f;
+	sweep.ray.inv.d.y = motion.y != 0 ? 1.0f / motion.y : 1.0e30f;
+	sweep.ray.inv.t = 1.0f;
+	sweep.ray.extent = cf_half_extents(aabb);
+	sweep.ray.bounds = cf_combine(aabb, cf_make_aabb(aabb.min + motion, aabb.max + motion));
+	sweep.result.hit = false;
+	sweep.result.leaf.id = AABB_TREE_NULL_NODE_INDEX;
+	sweep.result.toi = 1.0f;
+	sweep.result.n = cf_v2(0, 0);
+	sweep.result.p = cf_v2(0, 0);
+	return sweep;
+}
+
+// Sweeps against one leaf, keeping the hit if it's the earliest so far. Returns false once no hit can come any sooner.
+static bool s_sweep_leaf(const CF_AabbTreeInternal* tree, CF_AabbTreeSweep* sweep, int index)
+{
+	CF_Leaf leaf = { index };
+	CF_AabbTreeLeafShape target;
+	target.shape = NULL;
+	target.type = CF_SHAPE_TYPE_NONE;
+	target.transform = cf_make_transform();
+	if (!sweep->fn(leaf, s_leaf_udata(tree, index), sweep->fn_udata, &target) || !target.shape) return true;
+
+	CF_ToiResult toi = cf_toi(sweep->shape, sweep->type, &sweep->xf, sweep->motion, target.shape, target.type, &target.transform, cf_v2(0, 0), true);
+	if (!toi.hit || (sweep->result.hit && toi.toi >= sweep->result.toi)) return true;
+	sweep->result.hit = true;
+	sweep->result.leaf = leaf;
+	sweep->result.toi = toi.toi;
+	sweep->result.n = toi.n;
+	sweep->result.p = toi.p;
+	sweep->ray.inv.t = toi.toi;
+	return toi.toi > 0;
+}
+
+CF_AabbTreeSweepResult cf_aabb_tree_sweep(const CF_AabbTree tree_handle, const void* shape, CF_ShapeType type, const CF_Transform* transform, CF_V2 motion, CF_AabbTreeSweepFn* fn, void* fn_udata)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_AabbTreeSweep sweep = s_make_sweep(shape, type, transform, motion, fn, fn_udata);
+	s_query(tree, sweep.ray.bounds, &sweep.ray, [&](int index) {
+		return s_sweep_leaf(tree, &sweep, index);
+	});
+	return sweep.result;
+}
+
+struct CF_AabbTreeSweepCacheInternal
+{
+	float margin = 0;
+	// The leaves overlapping `bounds`, gathered from `tree` when it was at `version`.
+	const CF_AabbTreeInternal* tree = NULL;
+	uint64_t version = 0;
+	CF_Aabb bounds = { };
+	Array<int> leaves;
+};
+
+CF_AabbTreeSweepCache cf_make_aabb_tree_sweep_cache(float margin)
+{
+	CF_AabbTreeSweepCacheInternal* cache = CF_NEW(CF_AabbTreeSweepCacheInternal);
+	cache->margin = margin;
+	CF_AabbTreeSweepCache result;
+	result.id = (uint64_t)cache;
+	return result;
+}
+
+void cf_destroy_aabb_tree_sweep_cache(CF_AabbTreeSweepCache cache_handle)
+{
+	CF_AabbTreeSweepCacheInternal* cache = (CF_AabbTreeSweepCacheInternal*)cache_handle.id;
+	cache->~CF_AabbTreeSweepCacheInternal();
+	CF_FREE(cache);
+}
+
+CF_AabbTreeSweepResult cf_aabb_tree_sweep_cached(const CF_AabbTree tree_handle, CF_AabbTreeSweepCache cache_handle, const void* shape, CF_ShapeType type, const CF_Transform* transform, CF_V2 motion, CF_AabbTreeSweepFn* fn, void* fn_udata)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_AabbTreeSweepCacheInternal* cache = (CF_AabbTreeSweepCacheInternal*)cache_handle.id;
+	CF_AabbTreeSweep sweep = s_make_sweep(shape, type, transform, motion, fn, fn_udata);
+
+	// Gather again once the sweep leaves the gathered area, or the tree has changed since.
+	if (cache->tree != tree || cache->version != tree->version || !cf_contains_aabb(cache->bounds, sweep.ray.bounds)) {
+		cache->tree = tree;
+		cache->version = tree->version;
+		cache->bounds = cf_expand_aabb_f(sweep.ray.bounds, cache->margin);
+		cache->leaves.clear();
+		s_query(tree, cache->bounds, NULL, [&](int index) {
+			cache->leaves.add(index);
+			return true;
+		});
+	}
+
+	for (int i = 0; i < cache->leaves.count(); ++i) {
+		int index = cache->leaves[i];
+		CF_Aabb aabb = s_leaf_aabb(tree, index);
+		if (!cf_collide_aabb(sweep.ray.bounds, aabb) || !s_raycast(aabb, &sweep.ray)) continue;
+		if (!s_sweep_leaf(tree, &sweep, index)) break;
+	}
+	return sweep.result;
+}
+
+// Picks up to four children for the wide node made from binary node `index`, by repeatedly opening
+// the biggest binary node found so far, so each wide node covers two levels of the binary tree.
+static int s_wide_children(const CF_AabbTreeInternal* tree, int index, int* children)
+{
+	const CF_AabbTreeNode* nodes = tree->nodes.data();
+	if (nodes[index].index_a == AABB_TREE_NULL_NODE_INDEX) {
+		children[0] = index;
+		return 1;
+	}
+	int count = 2;
+	children[0] = nodes[index].index_a;
+	children[1] = nodes[index].index_b;
+	while (count < 4) {
+		int best = -1;
+		float best_area = -1.0f;
+		for (int i = 0; i < count; ++i) {
+			if (nodes[children[i]].index_a == AABB_TREE_NULL_NODE_INDEX) continue;
+			float area = cf_surface_area_aabb(tree->aabbs[children[i]]);
+			if (area > best_area) {
+				best = i;
+				best_area = area;
 			}
 		}
+		if (best < 0) break;
+		int opened = children[best];
+		children[best] = nodes[opened].index_a;
+		children[count++] = nodes[opened].index_b;
 	}
+	return count;
 }
 
-void cf_aabb_tree_query_ray(const CF_AabbTree tree_handle, CF_AabbTreeQueryFn* fn, CF_Ray ray, void* fn_udata)
+void cf_aabb_tree_flatten(CF_AabbTree tree_handle)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	if (tree->view) return;
+	tree->wide.clear();
 	if (tree->root == AABB_TREE_NULL_NODE_INDEX) return;
-	int index_stack_buf[AABB_TREE_STACK_QUERY_CAPACITY];
-	int* index_stack = NULL;
-	astatic(index_stack, index_stack_buf, CF_ARRAY_SIZE(index_stack_buf));
-	CF_DEFER(afree(index_stack));
-	const CF_AabbTreeNode* nodes = tree->nodes.data();
-	const CF_Aabb* aabbs = tree->aabbs.data();
-	void* const* udatas = tree->udatas.data();
-	apush(index_stack, tree->root);
 
-	CF_Ray ray_inv = ray;
-	ray_inv.d = cf_safe_invert_v2(ray.d);
-	CF_V2 ray_end = cf_endpoint(ray);
-	CF_Aabb ray_aabb;
-	ray_aabb.min = cf_min_v2(ray.p, ray_end);
-	ray_aabb.max = cf_min_v2(ray.p, ray_end);
+	// Binary nodes waiting to become wide nodes, each with where to link the wide node in once made.
+	struct Pending { int index; int parent; int slot; };
+	Array<Pending> stack;
+	stack.add({ tree->root, -1, 0 });
+	while (stack.count()) {
+		Pending p = stack.pop();
+		int w = tree->wide.count();
+		if (p.parent >= 0) tree->wide[p.parent].children[p.slot] = w;
+		CF_AabbTreeWideNode& node = tree->wide.add();
+		int children[4];
+		int count = s_wide_children(tree, p.index, children);
+		for (int i = 0; i < 4; ++i) {
+			if (i >= count) {
+				node.min_x[i] = node.min_y[i] = FLT_MAX;
+				node.max_x[i] = node.max_y[i] = -FLT_MAX;
+				node.children[i] = ~0;
+				continue;
+			}
+			CF_Aabb aabb = tree->aabbs[children[i]];
+			node.min_x[i] = aabb.min.x;
+			node.min_y[i] = aabb.min.y;
+			node.max_x[i] = aabb.max.x;
+			node.max_y[i] = aabb.max.y;
+			if (tree->nodes[children[i]].index_a == AABB_TREE_NULL_NODE_INDEX) {
+				node.children[i] = ~children[i];
+			} else {
+				stack.add({ children[i], w, i });
+			}
+		}
+	}
+}
 
-	while (alen(index_stack)) {
-		int index = apop(index_stack);
-		CF_Aabb search_aabb = aabbs[index];
+bool cf_aabb_tree_is_flattened(const CF_AabbTree tree_handle)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	return tree->view || tree->wide.count() > 0;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Bulk build and refit.
+
+// Builds a subtree over `leaves` top-down, splitting each range where a binned surface area heuristic
+// says the two halves are cheapest to query. Returns the subtree's root.
+static int s_build(CF_AabbTreeInternal* tree, int* leaves, int count, int index_parent)
+{
+	CF_Aabb* aabbs = tree->aabbs.data();
+	if (count == 1) {
+		int index = leaves[0];
+		tree->nodes[index].index_parent = index_parent;
+		tree->nodes[index].height = 0;
+		return index;
+	}
+
+	CF_Aabb bounds = aabbs[leaves[0]];
+	CF_Aabb centroid_bounds = cf_make_aabb(cf_center(bounds), cf_center(bounds));
+	for (int i = 1; i < count; ++i) {
+		bounds = cf_combine(bounds, aabbs[leaves[i]]);
+		CF_V2 c = cf_center(aabbs[leaves[i]]);
+		centroid_bounds = cf_make_aabb(cf_min_v2(centroid_bounds.min, c), cf_max_v2(centroid_bounds.max, c));
+	}
 
-		if (!cf_collide_aabb(ray_aabb, search_aabb)) {
-			continue;
+	// Bin centroids along the longer axis, then sweep the bins for the cheapest split.
+	CF_V2 extents = centroid_bounds.max - centroid_bounds.min;
+	int axis = extents.x >= extents.y ? 0 : 1;
+	float lo = axis ? centroid_bounds.min.y : centroid_bounds.min.x;
+	float extent = axis ? extents.y : extents.x;
+	int split = count / 2;
+	if (extent > 0) {
+		float scale = AABB_TREE_SAH_BIN_COUNT / extent;
+		CF_Aabb bin_aabbs[AABB_TREE_SAH_BIN_COUNT];
+		int bin_counts[AABB_TREE_SAH_BIN_COUNT] = { 0 };
+		auto bin_of = [&](int leaf) {
+			CF_V2 c = cf_center(aabbs[leaf]);
+			int bin = (int)(((axis ? c.y : c.x) - lo) * scale);
+			return cf_clamp(bin, 0, AABB_TREE_SAH_BIN_COUNT - 1);
+		};
+		for (int i = 0; i < count; ++i) {
+			int bin = bin_of(leaves[i]);
+			bin_aabbs[bin] = bin_counts[bin]++ ? cf_combine(bin_aabbs[bin], aabbs[leaves[i]]) : aabbs[leaves[i]];
 		}
 
-		if (s_raycast(search_aabb, ray_inv)) {
-			const CF_AabbTreeNode* node = nodes + index;
+		// right_costs[i] is the cost of bins i + 1 onward.
+		float right_costs[AABB_TREE_SAH_BIN_COUNT];
+		CF_Aabb right = { };
+		int right_count = 0;
+		for (int i = AABB_TREE_SAH_BIN_COUNT - 1; i > 0; --i) {
+			if (bin_counts[i]) right = right_count ? cf_combine(right, bin_aabbs[i]) : bin_aabbs[i];
+			right_count += bin_counts[i];
+			right_costs[i - 1] = right_count ? right_count * cf_surface_area_aabb(right) : 0;
+		}
+		CF_Aabb left = { };
+		int left_count = 0;
+		int best_bin = -1;
+		float best_cost = FLT_MAX;
+		for (int i = 0; i < AABB_TREE_SAH_BIN_COUNT - 1; ++i) {
+			if (bin_counts[i]) left = left_count ? cf_combine(left, bin_aabbs[i]) : bin_aabbs[i];
+			left_count += bin_counts[i];
+			if (!left_count || left_count == count) continue;
+			float cost = left_count * cf_surface_area_aabb(left) + right_costs[i];
+			if (cost < best_cost) {
+				best_cost = cost;
+				best_bin = i;
+			}
+		}
 
-			if (node->index_a != AABB_TREE_NULL_NODE_INDEX) {
-				CF_Leaf leaf = { index };
-				if (!fn(leaf, search_aabb, udatas[index], fn_udata)) {
-					return;
-				}
+		// The lowest and highest centroids land in the first and last bins, so a split always exists.
+		CF_ASSERT(best_bin >= 0);
+		int i = 0, j = count - 1;
+		while (i <= j) {
+			if (bin_of(leaves[i]) <= best_bin) {
+				++i;
 			} else {
-				apush(index_stack, node->index_a);
-				apush(index_stack, node->index_b);
+				int t = leaves[i];
+				leaves[i] = leaves[j];
+				leaves[j--] = t;
+			}
+		}
+		split = i;
+	}
+
+	int index = s_pop_freelist(tree, bounds);
+	int index_a = s_build(tree, leaves, split, index);
+	int index_b = s_build(tree, leaves + split, count - split, index);
+	CF_AabbTreeNode* node = tree->nodes.data() + index;
+	node->index_a = index_a;
+	node->index_b = index_b;
+	node->index_parent = index_parent;
+	node->height = cf_max(tree->nodes[index_a].height, tree->nodes[index_b].height) + 1;
+	return index;
+}
+
+// Frees every branch and builds new ones over the leaves. Leaves keep their indices.
+static void s_rebuild(CF_AabbTreeInternal* tree)
+{
+	tree->wide.clear();
+	if (tree->root == AABB_TREE_NULL_NODE_INDEX) return;
+
+	Array<int> leaves;
+	leaves.ensure_capacity(tree->node_count / 2 + 1);
+	Array<int> stack;
+	stack.add(tree->root);
+	while (stack.count()) {
+		int index = stack.pop();
+		CF_AabbTreeNode* node = tree->nodes.data() + index;
+		if (node->index_a == AABB_TREE_NULL_NODE_INDEX) {
+			leaves.add(index);
+		} else {
+			stack.add(node->index_a);
+			stack.add(node->index_b);
+			s_push_freelist(tree, index);
+		}
+	}
+
+	tree->root = s_build(tree, leaves.data(), leaves.count(), AABB_TREE_NULL_NODE_INDEX);
+}
+
+void cf_aabb_tree_insert_many(CF_AabbTree tree_handle, const CF_Aabb* aabbs, void* const* udatas, int count, CF_Leaf* leaves)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_ASSERT(!tree->view);
+	if (count <= 0) return;
+
+	tree->version++;
+
+	// Link the new leaves under the root so the rebuild below finds them.
+	for (int i = 0; i < count; ++i) {
+		CF_Aabb aabb = cf_expand_aabb_f(aabbs[i], AABB_TREE_EXPAND_CONSTANT);
+		int index = s_pop_freelist(tree, aabb, udatas ? udatas[i] : NULL);
+		if (leaves) leaves[i].id = index;
+		if (tree->root == AABB_TREE_NULL_NODE_INDEX) {
+			tree->root = index;
+		} else {
+			int branch_index = s_pop_freelist(tree, cf_combine(aabb, tree->aabbs[tree->root]));
+			CF_AabbTreeNode* branch = tree->nodes.data() + branch_index;
+			branch->index_a = tree->root;
+			branch->index_b = index;
+			tree->nodes[tree->root].index_parent = branch_index;
+			tree->nodes[index].index_parent = branch_index;
+			tree->root = branch_index;
+		}
+	}
+
+	s_rebuild(tree);
+	cf_aabb_tree_validate(tree_handle);
+}
+
+void cf_aabb_tree_rebuild(CF_AabbTree tree_handle)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_ASSERT(!tree->view);
+	s_rebuild(tree);
+	cf_aabb_tree_validate(tree_handle);
+}
+
+// Recomputes the AABBs of dirty branches beneath `index`, children first.
+static void s_refit_dirty(CF_AabbTreeInternal* tree, int index, uint8_t* dirty)
+{
+	if (!dirty[index]) return;
+	dirty[index] = 0;
+	CF_AabbTreeNode* node = tree->nodes.data() + index;
+	s_refit_dirty(tree, node->index_a, dirty);
+	s_refit_dirty(tree, node->index_b, dirty);
+	tree->aabbs[index] = cf_combine(tree->aabbs[node->index_a], tree->aabbs[node->index_b]);
+}
+
+int cf_aabb_tree_update_leaves(CF_AabbTree tree_handle, const CF_Leaf* leaves, const CF_Aabb* aabbs, const CF_V2* offsets, int count, int max_reinserts)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	CF_ASSERT(!tree->view);
+
+	// Store new fat AABBs, and mark each branch above a changed leaf as dirty.
+	Array<uint8_t> dirty;
+	Array<int> moved;
+	for (int i = 0; i < count; ++i) {
+		int index = leaves[i].id;
+		CF_ASSERT(tree->nodes[index].index_a == AABB_TREE_NULL_NODE_INDEX);
+		CF_Aabb aabb = s_fat_aabb(aabbs[i], offsets ? offsets[i] : cf_v2(0, 0));
+		if (!s_fat_aabb_is_stale(tree->aabbs[index], aabb)) continue;
+		tree->aabbs[index] = aabb;
+		moved.add(index);
+		if (!dirty.count()) {
+			dirty.ensure_count(tree->node_capacity);
+			CF_MEMSET(dirty.data(), 0, dirty.count());
+		}
+		for (int p = tree->nodes[index].index_parent; p != AABB_TREE_NULL_NODE_INDEX && !dirty[p]; p = tree->nodes[p].index_parent) {
+			dirty[p] = 1;
+		}
+	}
+	if (!moved.count()) return 0;
+	tree->wide.clear();
+	tree->version++;
+
+	// Refit every dirty branch once, instead of once per leaf beneath it.
+	if (tree->root != AABB_TREE_NULL_NODE_INDEX && tree->nodes[tree->root].index_a != AABB_TREE_NULL_NODE_INDEX) {
+		s_refit_dirty(tree, tree->root, dirty.data());
+	}
+
+	// Refitting never restructures the tree, so it loosens as leaves drift from their siblings. Reinsert
+	// the leaves that bloat their parent the most, up to the budget, which also rebalances along the way.
+	if (max_reinserts > 0) {
+		CF_AabbTreePriorityQueue queue;
+		int indices[AABB_TREE_STACK_QUERY_CAPACITY];
+		float costs[AABB_TREE_STACK_QUERY_CAPACITY];
+		queue.init(indices, costs, AABB_TREE_STACK_QUERY_CAPACITY);
+		for (int i = 0; i < moved.count(); ++i) {
+			int index = moved[i];
+			int index_parent = tree->nodes[index].index_parent;
+			if (index_parent == AABB_TREE_NULL_NODE_INDEX) continue;
+			const CF_AabbTreeNode* parent = tree->nodes.data() + index_parent;
+			int index_sibling = parent->index_a == index ? parent->index_b : parent->index_a;
+			float cost = cf_surface_area_aabb(tree->aabbs[index_parent]) - cf_surface_area_aabb(tree->aabbs[index_sibling]);
+			queue.push(index, cost);
+			if (queue.count() > max_reinserts) {
+				// Drop the cheapest, keeping the most expensive `max_reinserts` leaves.
+				int dropped;
+				float dropped_cost;
+				queue.try_pop(&dropped, &dropped_cost);
+			}
+		}
+		int index;
+		float cost;
+		while (queue.try_pop(&index, &cost)) {
+			CF_Leaf leaf = { index };
+			CF_Aabb aabb = tree->aabbs[index];
+			void* udata = tree->udatas[index];
+			cf_aabb_tree_remove(tree_handle, leaf);
+			CF_Leaf new_leaf = s_insert(tree, aabb, udata);
+			CF_ASSERT(new_leaf.id == leaf.id);
+			CF_UNUSED(new_leaf);
+		}
+	}
+
+	cf_aabb_tree_validate(tree_handle);
+	return moved.count();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Pairs and batch queries.
+
+// Aim for a few times more tasks than threads, so uneven subtrees still balance out.
+#define AABB_TREE_PAIR_TASK_COUNT 64
+#define AABB_TREE_BATCH_TASK_SIZE 64
+
+static CF_INLINE bool s_is_leaf(const CF_AabbTreeInternal* tree, int index)
+{
+	return tree->nodes[index].index_a == AABB_TREE_NULL_NODE_INDEX;
+}
+
+// Finding pairs is a list of node pairs to test. A pair of the same node means all pairs within its subtree.
+struct CF_AabbTreeNodePair
+{
+	int a;
+	int b;
+};
+
+struct CF_AabbTreePairTask
+{
+	const CF_AabbTreeInternal* tree_a;
+	const CF_AabbTreeInternal* tree_b;
+	Array<CF_AabbTreeNodePair> work;
+	Array<CF_AabbTreePair> pairs;
+};
+
+// Expands one node pair into the node pairs beneath it, or emits it as a leaf pair. Returns false if it was a leaf pair.
+static bool s_expand_pair(const CF_AabbTreeInternal* tree_a, const CF_AabbTreeInternal* tree_b, CF_AabbTreeNodePair p, Array<CF_AabbTreeNodePair>* out, Array<CF_AabbTreePair>* pairs)
+{
+	bool leaf_a = s_is_leaf(tree_a, p.a);
+	bool leaf_b = s_is_leaf(tree_b, p.b);
+	if (tree_a == tree_b && p.a == p.b) {
+		if (leaf_a) return true;
+		const CF_AabbTreeNode& node = tree_a->nodes[p.a];
+		out->add({ node.index_a, node.index_a });
+		out->add({ node.index_b, node.index_b });
+		out->add({ node.index_a, node.index_b });
+		return true;
+	}
+	if (!cf_collide_aabb(tree_a->aabbs[p.a], tree_b->aabbs[p.b])) return true;
+	if (leaf_a && leaf_b) {
+		pairs->add({ { p.a }, { p.b } });
+		return false;
+	}
+	// Descend into the bigger box, which shrinks the overlap fastest.
+	if (leaf_b || (!leaf_a && cf_surface_area_aabb(tree_a->aabbs[p.a]) > cf_surface_area_aabb(tree_b->aabbs[p.b]))) {
+		const CF_AabbTreeNode& node = tree_a->nodes[p.a];
+		out->add({ node.index_a, p.b });
+		out->add({ node.index_b, p.b });
+	} else {
+		const CF_AabbTreeNode& node = tree_b->nodes[p.b];
+		out->add({ p.a, node.index_a });
+		out->add({ p.a, node.index_b });
+	}
+	return true;
+}
+
+static void CF_CALL s_pair_task(void* param)
+{
+	CF_AabbTreePairTask* task = (CF_AabbTreePairTask*)param;
+	Array<CF_AabbTreeNodePair>& stack = task->work;
+	while (stack.count()) {
+		CF_AabbTreeNodePair p = stack.pop();
+		s_expand_pair(task->tree_a, task->tree_b, p, &stack, &task->pairs);
+	}
+}
+
+// Runs `fn` over each of `params`, spread across `pool` if there is one.
+static void s_run_tasks(CF_Threadpool* pool, CF_TaskFn* fn, uint8_t* params, int param_size, int count)
+{
+	if (pool && count > 1) {
+		CF_AtomicInt counter = { 0 };
+		for (int i = 0; i < count; ++i) {
+			cf_threadpool_add_dependent_task(pool, fn, params + i * param_size, NULL, 0, &counter);
+		}
+		cf_threadpool_kick(pool);
+		cf_threadpool_wait_counter(pool, &counter);
+	} else {
+		for (int i = 0; i < count; ++i) {
+			fn(params + i * param_size);
+		}
+	}
+}
+
+static int s_find_pairs(const CF_AabbTreeInternal* tree_a, const CF_AabbTreeInternal* tree_b, CF_AabbTreePair* pairs, int capacity, CF_Threadpool* pool)
+{
+	// Pairs are found on the binary tree, which trees read from a serialized buffer don't have.
+	CF_ASSERT(!tree_a->view && !tree_b->view);
+	if (tree_a->root == AABB_TREE_NULL_NODE_INDEX || tree_b->root == AABB_TREE_NULL_NODE_INDEX) return 0;
+
+	// Split the top of the traversal breadth-first into independent node pairs, one task each.
+	Array<CF_AabbTreePair> top_pairs;
+	Array<CF_AabbTreeNodePair> work;
+	Array<CF_AabbTreeNodePair> next;
+	work.add({ tree_a->root, tree_b->root });
+	bool expanded = true;
+	while (expanded && work.count() < AABB_TREE_PAIR_TASK_COUNT) {
+		expanded = false;
+		next.clear();
+		for (int i = 0; i < work.count(); ++i) {
+			int before = next.count();
+			if (s_expand_pair(tree_a, tree_b, work[i], &next, &top_pairs)) {
+				expanded |= next.count() != before;
 			}
 		}
+		Array<CF_AabbTreeNodePair> t;
+		t.steal_from(work);
+		work.steal_from(next);
+		next.steal_from(t);
+	}
+
+	int task_count = work.count();
+	CF_AabbTreePairTask* tasks = (CF_AabbTreePairTask*)CF_ALLOC(sizeof(CF_AabbTreePairTask) * (task_count ? task_count : 1));
+	for (int i = 0; i < task_count; ++i) {
+		CF_PLACEMENT_NEW(tasks + i) CF_AabbTreePairTask();
+		tasks[i].tree_a = tree_a;
+		tasks[i].tree_b = tree_b;
+		tasks[i].work.add(work[i]);
 	}
+	s_run_tasks(pool, s_pair_task, (uint8_t*)tasks, sizeof(CF_AabbTreePairTask), task_count);
+
+	// Gather the results in task order, so the output doesn't depend on thread timing.
+	int total = 0;
+	auto emit = [&](const Array<CF_AabbTreePair>& list) {
+		for (int i = 0; i < list.count(); ++i, ++total) {
+			if (total < capacity) pairs[total] = list[i];
+		}
+	};
+	emit(top_pairs);
+	for (int i = 0; i < task_count; ++i) {
+		emit(tasks[i].pairs);
+		tasks[i].~CF_AabbTreePairTask();
+	}
+	CF_FREE(tasks);
+	return total;
+}
+
+int cf_aabb_tree_find_pairs(const CF_AabbTree tree_handle, CF_AabbTreePair* pairs, int capacity, CF_Threadpool* pool)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	return s_find_pairs(tree, tree, pairs, capacity, pool);
+}
+
+int cf_aabb_tree_find_pairs_with(const CF_AabbTree tree_a, const CF_AabbTree tree_b, CF_AabbTreePair* pairs, int capacity, CF_Threadpool* pool)
+{
+	CF_AabbTreeInternal* a = (CF_AabbTreeInternal*)tree_a.id;
+	CF_AabbTreeInternal* b = (CF_AabbTreeInternal*)tree_b.id;
+	return s_find_pairs(a, b, pairs, capacity, pool);
+}
+
+struct CF_AabbTreeBatchTask
+{
+	const CF_AabbTreeInternal* tree;
+	const CF_Aabb* aabbs;
+	const CF_Ray* rays;
+	int first;
+	int count;
+	CF_Leaf* hits;
+	int max_hits;
+	int* hit_counts;
+};
+
+static void CF_CALL s_batch_task(void* param)
+{
+	CF_AabbTreeBatchTask* task = (CF_AabbTreeBatchTask*)param;
+	for (int q = task->first; q < task->first + task->count; ++q) {
+		CF_Leaf* hits = task->hits ? task->hits + (size_t)q * task->max_hits : NULL;
+		int hit_count = 0;
+		auto visit = [&](int index) {
+			if (hits && hit_count < task->max_hits) hits[hit_count].id = index;
+			++hit_count;
+			return true;
+		};
+		if (task->rays) {
+			CF_AabbTreeRay r = s_make_ray(task->rays[q]);
+			s_query(task->tree, r.bounds, &r, visit);
+		} else {
+			s_query(task->tree, task->aabbs[q], NULL, visit);
+		}
+		task->hit_counts[q] = hit_count;
+	}
+}
+
+static void s_query_batch(const CF_AabbTreeInternal* tree, const CF_Aabb* aabbs, const CF_Ray* rays, int count, CF_Leaf* hits, int max_hits, int* hit_counts, CF_Threadpool* pool)
+{
+	if (tree->root == AABB_TREE_NULL_NODE_INDEX && !tree->view) {
+		CF_MEMSET(hit_counts, 0, sizeof(int) * count);
+		return;
+	}
+	int task_count = (count + AABB_TREE_BATCH_TASK_SIZE - 1) / AABB_TREE_BATCH_TASK_SIZE;
+	Array<CF_AabbTreeBatchTask> tasks;
+	tasks.ensure_capacity(task_count);
+	for (int first = 0; first < count; first += AABB_TREE_BATCH_TASK_SIZE) {
+		CF_AabbTreeBatchTask& task = tasks.add();
+		task.tree = tree;
+		task.aabbs = aabbs;
+		task.rays = rays;
+		task.first = first;
+		task.count = cf_min(AABB_TREE_BATCH_TASK_SIZE, count - first);
+		task.hits = hits;
+		task.max_hits = max_hits;
+		task.hit_counts = hit_counts;
+	}
+	s_run_tasks(pool, s_batch_task, (uint8_t*)tasks.data(), sizeof(CF_AabbTreeBatchTask), tasks.count());
+}
+
+void cf_aabb_tree_query_aabb_batch(const CF_AabbTree tree_handle, const CF_Aabb* aabbs, int count, CF_Leaf* hits, int max_hits_per_query, int* hit_counts, CF_Threadpool* pool)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	s_query_batch(tree, aabbs, NULL, count, hits, max_hits_per_query, hit_counts, pool);
+}
+
+void cf_aabb_tree_query_ray_batch(const CF_AabbTree tree_handle, const CF_Ray* rays, int count, CF_Leaf* hits, int max_hits_per_query, int* hit_counts, CF_Threadpool* pool)
+{
+	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	s_query_batch(tree, NULL, rays, count, hits, max_hits_per_query, hit_counts, pool);
 }
 
 float cf_aabb_tree_cost(const CF_AabbTree tree_handle)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
+	if (tree->view) {
+		// Every node but the root is a child slot of a wide node.
+		float cost = 0;
+		const CF_AabbTreeWideNode* nodes = s_view_nodes(tree->view);
+		for (uint32_t i = 0; i < tree->view->node_count; ++i) {
+			for (int j = 0; j < 4; ++j) {
+				if (nodes[i].min_x[j] > nodes[i].max_x[j]) continue;
+				cost += cf_surface_area_aabb(cf_make_aabb(cf_v2(nodes[i].min_x[j], nodes[i].min_y[j]), cf_v2(nodes[i].max_x[j], nodes[i].max_y[j])));
+			}
+		}
+		return cost;
+	}
 	return s_tree_cost(tree, tree->root);
 }
 
@@ -872,40 +1625,49 @@ void cf_aabb_tree_validate(const CF_AabbTree tree_handle)
 size_t cf_aabb_tree_serialized_size(const CF_AabbTree tree_handle)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
-	size_t fourcc_size = 4;
-	size_t node_count_size = sizeof(uint32_t);
-	size_t overhead_per_node = 1;
-	size_t aabb_size = sizeof(float) * 2 * 2;
-	size_t internal_node_size = sizeof(uint32_t);
-	size_t leaf_node_size = sizeof(uint32_t) * 3;
-	size_t leaf_node_count = ((size_t)tree->node_count + 1) / 2;
-	size_t internal_node_count = (size_t)tree->node_count - leaf_node_count;
-	size_t all_internal_nodes_size = (aabb_size + internal_node_size + overhead_per_node) * internal_node_count;
-	size_t all_leaf_nodes_size = (aabb_size + leaf_node_size + overhead_per_node) * leaf_node_count;
-	size_t needed_size = fourcc_size + node_count_size + all_internal_nodes_size + all_leaf_nodes_size;
-	return needed_size;
+	if (tree->view) return s_view_size(tree->view->node_count, tree->view->leaf_count);
+	if (!tree->wide.count()) cf_aabb_tree_flatten(tree_handle);
+	uint32_t leaf_count = ((uint32_t)tree->node_count + 1) / 2;
+	return s_view_size((uint32_t)tree->wide.count(), leaf_count);
 }
 
 bool cf_aabb_tree_serialize(const CF_AabbTree tree_handle, void* buffer, size_t size)
 {
 	CF_AabbTreeInternal* tree = (CF_AabbTreeInternal*)tree_handle.id;
 	size_t needed_size = cf_aabb_tree_serialized_size(tree_handle);
-	if (needed_size < size) return false;
-	CF_AabbTreeInternal* copy = s_remap(tree);
+	if (size < needed_size) return false;
+	if (tree->view) {
+		CF_MEMCPY(buffer, tree->view, needed_size);
+		return true;
+	}
 
+	// The serialized layout is the flattened tree, with leaves renumbered in the order they're found.
+	CF_AabbTreeFileHeader header = { };
+	CF_MEMCPY(header.fourcc, "bvh4", 4);
+	header.version = AABB_TREE_FILE_VERSION;
+	header.endian_check = AABB_TREE_FILE_ENDIAN_CHECK;
+	header.node_count = (uint32_t)tree->wide.count();
+	header.leaf_count = ((uint32_t)tree->node_count + 1) / 2;
 	uint8_t* p = (uint8_t*)buffer;
-	cf_write_fourcc(&p, "aabb");
-	cf_write_uint32(&p, (uint32_t)copy->node_count);
-	s_serialize_to_buffer(copy, &p, copy->root);
-	CF_AabbTree copy_handle;
-	copy_handle.id = (uint64_t)copy;
-	cf_destroy_aabb_tree(copy_handle);
-
-	size_t size_written = p - (uint8_t*)buffer;
-	CF_ASSERT(size_written <= size);
-	if (size_written > size) {
-		return false;
+	uint8_t* leaf_p = p + s_view_size(header.node_count, 0);
+	CF_MEMCPY(p, &header, sizeof(header));
+	p += sizeof(header);
+	int leaf_count = 0;
+	for (int i = 0; i < tree->wide.count(); ++i) {
+		CF_AabbTreeWideNode node = tree->wide[i];
+		for (int j = 0; j < 4; ++j) {
+			bool is_empty = node.min_x[j] > node.max_x[j];
+			if (is_empty || node.children[j] >= 0) continue;
+			CF_Aabb aabb = tree->aabbs[~node.children[j]];
+			CF_MEMCPY(leaf_p, &aabb, sizeof(aabb));
+			leaf_p += sizeof(aabb);
+			node.children[j] = ~leaf_count++;
+		}
+		CF_MEMCPY(p, &node, sizeof(node));
+		p += sizeof(node);
 	}
+	CF_ASSERT(leaf_count == (int)header.leaf_count);
+	CF_ASSERT(leaf_p == (uint8_t*)buffer + needed_size);
 
 	return true;
 }
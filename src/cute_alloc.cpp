@@ -15,9 +15,31 @@
 #include <cute_alloc.h>
 #include <cute_c_runtime.h>
 #include <cute_array.h>
+#include <cute_file_system.h>
+#include <cute_multithreading.h>
+#include <cute_string.h>
 
 #include <internal/cute_alloc_internal.h>
 
+#include <atomic>
+#include <stdarg.h>
+#include <stdio.h>
+
+#ifdef CF_WINDOWS
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#	define CF_VIRTUAL_MEMORY
+#elif !defined(CF_EMSCRIPTEN)
+#	include <sys/mman.h>
+#	include <unistd.h>
+#	define CF_VIRTUAL_MEMORY
+#endif
+
 void* s_default_alloc(size_t size, void* udata)
 {
 	CF_UNUSED(udata);
@@ -62,24 +84,450 @@ void cf_allocator_restore_default()
 	s_allocator = s_default_allocator;
 }
 
+//--------------------------------------------------------------------------------------------------
+
+// Tracked allocations live in an open addressed table keyed by pointer, so untracked memory (allocated
+// before tracking was turned on) is simply not found when freed. Like the pool allocator, everything in
+// here uses malloc directly to avoid recursing into `cf_alloc`.
+
+#define CF_ALLOC_MAX_TAGS 64
+#define CF_ALLOC_MAX_TAG_DEPTH 32
+
+struct CF_AllocRecord
+{
+	void* ptr;
+	size_t size;
+	const char* file;
+	int line;
+	int tag;
+};
+
+struct CF_AllocTag
+{
+	const char* name;
+	uint64_t live_bytes;
+	int live_count;
+	uint64_t peak_bytes;
+	int frame_count;
+	uint64_t frame_bytes;
+	int last_frame_count;
+	uint64_t last_frame_bytes;
+};
+
+struct CF_AllocTracking
+{
+	CF_AtomicInt enabled;
+	// Guards everything below.
+	CF_Mutex lock;
+	int tag_count;
+	CF_AllocTag tags[CF_ALLOC_MAX_TAGS];
+	int record_count;
+	int record_capacity;
+	CF_AllocRecord* records;
+};
+
+struct CF_AllocTagStack
+{
+	int depth;
+	const char* tags[CF_ALLOC_MAX_TAG_DEPTH];
+};
+
+static CF_AllocTracking s_tracking;
+static thread_local CF_AllocTagStack s_alloc_tags;
+
+static void s_tracking_lock()
+{
+	cf_mutex_lock(&s_tracking.lock);
+}
+
+static void s_tracking_unlock()
+{
+	cf_mutex_unlock(&s_tracking.lock);
+}
+
+static int s_tracking_slot(void* ptr)
+{
+	uint64_t h = ((uint64_t)(uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ull;
+	return (int)(h >> 32) & (s_tracking.record_capacity - 1);
+}
+
+// Call with the lock held.
+static int s_tracking_tag()
+{
+	int depth = s_alloc_tags.depth < CF_ALLOC_MAX_TAG_DEPTH ? s_alloc_tags.depth : CF_ALLOC_MAX_TAG_DEPTH;
+	const char* name = depth ? s_alloc_tags.tags[depth - 1] : NULL;
+	if (!name) return 0;
+	for (int i = 1; i < s_tracking.tag_count; ++i) {
+		if (s_tracking.tags[i].name == name) return i;
+	}
+	for (int i = 1; i < s_tracking.tag_count; ++i) {
+		if (!CF_STRCMP(s_tracking.tags[i].name, name)) return i;
+	}
+	if (s_tracking.tag_count == CF_ALLOC_MAX_TAGS) return 0;
+	CF_AllocTag* tag = s_tracking.tags + s_tracking.tag_count;
+	CF_MEMSET(tag, 0, sizeof(*tag));
+	tag->name = name;
+	return s_tracking.tag_count++;
+}
+
+// Call with the lock held.
+static void s_tracking_insert(CF_AllocRecord record)
+{
+	if ((s_tracking.record_count + 1) * 2 > s_tracking.record_capacity) {
+		int old_capacity = s_tracking.record_capacity;
+		CF_AllocRecord* old_records = s_tracking.records;
+		s_tracking.record_capacity = old_capacity ? old_capacity * 2 : 1024;
+		s_tracking.records = (CF_AllocRecord*)calloc((size_t)s_tracking.record_capacity, sizeof(CF_AllocRecord));
+		for (int i = 0; i < old_capacity; ++i) {
+			if (!old_records[i].ptr) continue;
+			int slot = s_tracking_slot(old_records[i].ptr);
+			while (s_tracking.records[slot].ptr) slot = (slot + 1) & (s_tracking.record_capacity - 1);
+			s_tracking.records[slot] = old_records[i];
+		}
+		free(old_records);
+	}
+	int slot = s_tracking_slot(record.ptr);
+	while (s_tracking.records[slot].ptr) slot = (slot + 1) & (s_tracking.record_capacity - 1);
+	s_tracking.records[slot] = record;
+	s_tracking.record_count++;
+
+	CF_AllocTag* tag = s_tracking.tags + record.tag;
+	tag->live_bytes += record.size;
+	tag->live_count++;
+	if (tag->live_bytes > tag->peak_bytes) tag->peak_bytes = tag->live_bytes;
+	tag->frame_count++;
+	tag->frame_bytes += record.size;
+}
+
+// Call with the lock held.
+static bool s_tracking_remove(void* ptr, CF_AllocRecord* out)
+{
+	if (!s_tracking.record_count) return false;
+	int mask = s_tracking.record_capacity - 1;
+	int slot = s_tracking_slot(ptr);
+	while (s_tracking.records[slot].ptr != ptr) {
+		if (!s_tracking.records[slot].ptr) return false;
+		slot = (slot + 1) & mask;
+	}
+	*out = s_tracking.records[slot];
+	s_tracking.record_count--;
+	CF_AllocTag* tag = s_tracking.tags + out->tag;
+	tag->live_bytes -= out->size;
+	tag->live_count--;
+
+	// Shift later records of the same cluster back, so lookups never stop early at the hole.
+	int hole = slot;
+	for (int i = (slot + 1) & mask; s_tracking.records[i].ptr; i = (i + 1) & mask) {
+		int home = s_tracking_slot(s_tracking.records[i].ptr);
+		if (((i - home) & mask) >= ((i - hole) & mask)) {
+			s_tracking.records[hole] = s_tracking.records[i];
+			hole = i;
+		}
+	}
+	s_tracking.records[hole].ptr = NULL;
+	return true;
+}
+
+static void s_track_alloc(void* ptr, size_t size, const char* file, int line)
+{
+	if (!ptr) return;
+	s_tracking_lock();
+	if (cf_atomic_get(&s_tracking.enabled)) {
+		CF_AllocRecord record;
+		record.ptr = ptr;
+		record.size = size;
+		record.file = file;
+		record.line = line;
+		record.tag = s_tracking_tag();
+		s_tracking_insert(record);
+	}
+	s_tracking_unlock();
+}
+
+static bool s_track_free(void* ptr, CF_AllocRecord* out)
+{
+	if (!ptr) return false;
+	s_tracking_lock();
+	bool found = s_tracking_remove(ptr, out);
+	s_tracking_unlock();
+	return found;
+}
+
+// Counted for `CF_FrameStats`. Each thread bumps its own running totals so counting never contends on a shared
+// cache line, and the totals are summed up whenever the stats are taken. Counters are allocated with plain malloc
+// since going through `CF_ALLOC` here would recurse, and are handed to a new thread once their owner exits.
+struct CF_AllocCounter
+{
+	std::atomic<uint64_t> count; // Only written by the owning thread.
+	std::atomic<uint64_t> bytes; // Only written by the owning thread.
+	std::atomic<bool> in_use;
+	uint64_t taken_count; // Only touched by `cf_alloc_take_frame_counts`.
+	uint64_t taken_bytes; // Only touched by `cf_alloc_take_frame_counts`.
+	CF_AllocCounter* next;
+};
+
+struct CF_AllocCounterOwner
+{
+	CF_AllocCounter* counter = NULL;
+	~CF_AllocCounterOwner() { if (counter) counter->in_use.store(false, std::memory_order_release); }
+};
+
+static std::atomic<CF_AllocCounter*> s_alloc_counters;
+static thread_local CF_AllocCounterOwner s_alloc_counter;
+
+static CF_AllocCounter* s_alloc_counter_register()
+{
+	for (CF_AllocCounter* counter = s_alloc_counters.load(std::memory_order_acquire); counter; counter = counter->next) {
+		bool in_use = false;
+		if (!counter->in_use.load(std::memory_order_relaxed) && counter->in_use.compare_exchange_strong(in_use, true, std::memory_order_acquire)) {
+			return counter;
+		}
+	}
+	CF_AllocCounter* counter = (CF_AllocCounter*)malloc(sizeof(CF_AllocCounter));
+	CF_PLACEMENT_NEW(counter) CF_AllocCounter();
+	counter->in_use.store(true, std::memory_order_relaxed);
+	counter->next = s_alloc_counters.load(std::memory_order_relaxed);
+	while (!s_alloc_counters.compare_exchange_weak(counter->next, counter, std::memory_order_release, std::memory_order_relaxed)) {
+	}
+	return counter;
+}
+
+static CF_INLINE void s_count_alloc(size_t size)
+{
+	CF_AllocCounter* counter = s_alloc_counter.counter;
+	if (!counter) counter = s_alloc_counter.counter = s_alloc_counter_register();
+	// Single writer, so a plain load and store is enough, no locked read-modify-write needed.
+	counter->count.store(counter->count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	counter->bytes.store(counter->bytes.load(std::memory_order_relaxed) + (uint64_t)size, std::memory_order_relaxed);
+}
+
+void cf_alloc_take_frame_counts(int* count, uint64_t* bytes)
+{
+	uint64_t total_count = 0;
+	uint64_t total_bytes = 0;
+	for (CF_AllocCounter* counter = s_alloc_counters.load(std::memory_order_acquire); counter; counter = counter->next) {
+		uint64_t c = counter->count.load(std::memory_order_relaxed);
+		uint64_t b = counter->bytes.load(std::memory_order_relaxed);
+		total_count += c - counter->taken_count;
+		total_bytes += b - counter->taken_bytes;
+		counter->taken_count = c;
+		counter->taken_bytes = b;
+	}
+	*count = (int)total_count;
+	*bytes = total_bytes;
+}
+
+void* cf_alloc_at(size_t size, const char* file, int line)
+{
+	s_count_alloc(size);
+	void* result = s_allocator.alloc_fn ? s_allocator.alloc_fn(size, NULL) : s_default_alloc(size, NULL);
+	if (cf_atomic_get(&s_tracking.enabled)) s_track_alloc(result, size, file, line);
+	return result;
+}
+
+void* cf_calloc_at(size_t size, size_t count, const char* file, int line)
+{
+	s_count_alloc(size * count);
+	void* result = s_allocator.calloc_fn ? s_allocator.calloc_fn(size, count, NULL) : s_default_calloc(size, count, NULL);
+	if (cf_atomic_get(&s_tracking.enabled)) s_track_alloc(result, size * count, file, line);
+	return result;
+}
+
+void* cf_realloc_at(void* ptr, size_t size, const char* file, int line)
+{
+	s_count_alloc(size);
+	if (!cf_atomic_get(&s_tracking.enabled)) {
+		return s_allocator.realloc_fn ? s_allocator.realloc_fn(ptr, size, NULL) : s_default_realloc(ptr, size, NULL);
+	}
+	// Forget the old pointer first, otherwise another thread could be handed the same address and record it
+	// before we get the chance to remove ours.
+	CF_AllocRecord record;
+	bool tracked = s_track_free(ptr, &record);
+	void* result = s_allocator.realloc_fn ? s_allocator.realloc_fn(ptr, size, NULL) : s_default_realloc(ptr, size, NULL);
+	if (result) {
+		s_track_alloc(result, size, file, line);
+	} else if (size && tracked) {
+		// The old pointer is still valid when realloc fails.
+		s_tracking_lock();
+		if (cf_atomic_get(&s_tracking.enabled)) s_tracking_insert(record);
+		s_tracking_unlock();
+	}
+	return result;
+}
+
 void* cf_alloc(size_t size)
 {
-	return s_allocator.alloc_fn ? s_allocator.alloc_fn(size, NULL) : s_default_alloc(size, NULL);
+	return cf_alloc_at(size, NULL, 0);
 }
 
 void cf_free(void* ptr)
 {
+	if (cf_atomic_get(&s_tracking.enabled)) {
+		CF_AllocRecord record;
+		s_track_free(ptr, &record);
+	}
 	s_allocator.free_fn ? s_allocator.free_fn(ptr, NULL) : s_default_free(ptr, NULL);
 }
 
 void* cf_calloc(size_t size, size_t count)
 {
-	return s_allocator.calloc_fn ? s_allocator.calloc_fn(size, count, NULL) : s_default_calloc(size, count, NULL);
+	return cf_calloc_at(size, count, NULL, 0);
 }
 
 void* cf_realloc(void* ptr, size_t size)
 {
-	return s_allocator.realloc_fn ? s_allocator.realloc_fn(ptr, size, NULL) : s_default_realloc(ptr, size, NULL);
+	return cf_realloc_at(ptr, size, NULL, 0);
+}
+
+void cf_alloc_tracking_enable(bool enabled)
+{
+	s_tracking_lock();
+	if (enabled != !!cf_atomic_get(&s_tracking.enabled)) {
+		free(s_tracking.records);
+		s_tracking.records = NULL;
+		s_tracking.record_count = 0;
+		s_tracking.record_capacity = 0;
+		s_tracking.tag_count = 1;
+		CF_MEMSET(&s_tracking.tags[0], 0, sizeof(s_tracking.tags[0]));
+		s_tracking.tags[0].name = "untagged";
+		cf_atomic_set(&s_tracking.enabled, enabled ? 1 : 0);
+	}
+	s_tracking_unlock();
+}
+
+bool cf_alloc_tracking_is_enabled()
+{
+	return !!cf_atomic_get(&s_tracking.enabled);
+}
+
+void cf_alloc_push_tag(const char* tag)
+{
+	// Tags nested deeper than the max are counted, but not recorded.
+	if (s_alloc_tags.depth < CF_ALLOC_MAX_TAG_DEPTH) s_alloc_tags.tags[s_alloc_tags.depth] = tag;
+	s_alloc_tags.depth++;
+}
+
+void cf_alloc_pop_tag()
+{
+	CF_ASSERT(s_alloc_tags.depth > 0);
+	if (s_alloc_tags.depth > 0) s_alloc_tags.depth--;
+}
+
+static CF_AllocTagStats s_tag_stats(const CF_AllocTag* tag)
+{
+	CF_AllocTagStats stats;
+	stats.tag = tag->name;
+	stats.live_bytes = tag->live_bytes;
+	stats.live_count = tag->live_count;
+	stats.peak_bytes = tag->peak_bytes;
+	stats.frame_alloc_count = tag->last_frame_count;
+	stats.frame_alloc_bytes = tag->last_frame_bytes;
+	return stats;
+}
+
+int cf_alloc_tracking_get_stats(CF_AllocTagStats* stats, int capacity)
+{
+	s_tracking_lock();
+	int count = s_tracking.tag_count;
+	for (int i = 0; stats && i < count && i < capacity; ++i) {
+		stats[i] = s_tag_stats(s_tracking.tags + i);
+	}
+	s_tracking_unlock();
+	return count;
+}
+
+static void s_tracking_next_frame()
+{
+	if (!cf_atomic_get(&s_tracking.enabled)) return;
+	s_tracking_lock();
+	for (int i = 0; i < s_tracking.tag_count; ++i) {
+		CF_AllocTag* tag = s_tracking.tags + i;
+		tag->last_frame_count = tag->frame_count;
+		tag->last_frame_bytes = tag->frame_bytes;
+		tag->frame_count = 0;
+		tag->frame_bytes = 0;
+	}
+	s_tracking_unlock();
+}
+
+struct CF_AllocSite
+{
+	int tag;
+	const char* file;
+	int line;
+	int count;
+	uint64_t bytes;
+};
+
+static int s_site_cmp(const void* a, const void* b)
+{
+	const CF_AllocSite* sa = (const CF_AllocSite*)a;
+	const CF_AllocSite* sb = (const CF_AllocSite*)b;
+	if (sa->tag != sb->tag) return sa->tag < sb->tag ? -1 : 1;
+	if (sa->file != sb->file) return (uintptr_t)sa->file < (uintptr_t)sb->file ? -1 : 1;
+	if (sa->line != sb->line) return sa->line < sb->line ? -1 : 1;
+	return 0;
+}
+
+static int s_site_bytes_cmp(const void* a, const void* b)
+{
+	uint64_t ba = ((const CF_AllocSite*)a)->bytes;
+	uint64_t bb = ((const CF_AllocSite*)b)->bytes;
+	return ba == bb ? 0 : (ba > bb ? -1 : 1);
+}
+
+CF_Result cf_alloc_tracking_dump(const char* virtual_path)
+{
+	// Copy everything out under the lock, then format without it, since formatting allocates.
+	s_tracking_lock();
+	int tag_count = s_tracking.tag_count;
+	CF_AllocTagStats tags[CF_ALLOC_MAX_TAGS];
+	for (int i = 0; i < tag_count; ++i) {
+		tags[i] = s_tag_stats(s_tracking.tags + i);
+	}
+	int site_count = 0;
+	CF_AllocSite* sites = (CF_AllocSite*)malloc(sizeof(CF_AllocSite) * (s_tracking.record_count + 1));
+	for (int i = 0; i < s_tracking.record_capacity; ++i) {
+		const CF_AllocRecord* record = s_tracking.records + i;
+		if (!record->ptr) continue;
+		CF_AllocSite* site = sites + site_count++;
+		site->tag = record->tag;
+		site->file = record->file;
+		site->line = record->line;
+		site->count = 1;
+		site->bytes = record->size;
+	}
+	s_tracking_unlock();
+
+	// Merge records from the same call site, then list the biggest first.
+	qsort(sites, (size_t)site_count, sizeof(CF_AllocSite), s_site_cmp);
+	int merged_count = 0;
+	for (int i = 0; i < site_count; ++i) {
+		if (merged_count && !s_site_cmp(sites + merged_count - 1, sites + i)) {
+			sites[merged_count - 1].count++;
+			sites[merged_count - 1].bytes += sites[i].bytes;
+		} else {
+			sites[merged_count++] = sites[i];
+		}
+	}
+	qsort(sites, (size_t)merged_count, sizeof(CF_AllocSite), s_site_bytes_cmp);
+
+	char* s = NULL;
+	sfmt_append(s, "%-24s %14s %12s %14s %14s %14s\n", "tag", "live bytes", "live count", "peak bytes", "frame allocs", "frame bytes");
+	for (int i = 0; i < tag_count; ++i) {
+		const CF_AllocTagStats* tag = tags + i;
+		sfmt_append(s, "%-24s %14llu %12d %14llu %14d %14llu\n", tag->tag, (unsigned long long)tag->live_bytes, tag->live_count, (unsigned long long)tag->peak_bytes, tag->frame_alloc_count, (unsigned long long)tag->frame_alloc_bytes);
+	}
+	sappend(s, "\nLive allocations by call site:\n");
+	for (int i = 0; i < merged_count; ++i) {
+		const CF_AllocSite* site = sites + i;
+		sfmt_append(s, "%14llu bytes in %8d allocations, %-16s %s:%d\n", (unsigned long long)site->bytes, site->count, tags[site->tag].tag, site->file ? site->file : "unknown", site->line);
+	}
+	free(sites);
+
+	CF_Result result = cf_fs_write_entire_buffer_to_file(virtual_path, s, (size_t)slen(s));
+	sfree(s);
+	return result;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -112,32 +560,622 @@ void cf_arena_init(CF_Arena* arena, int alignment, int block_size)
 	arena->block_size = block_size;
 }
 
-void* cf_arena_alloc(CF_Arena* arena, size_t size)
+// Virtual arenas commit this much at a time, rather than page by page, to keep system calls rare.
+#define CF_ARENA_COMMIT_SIZE (64 * 1024)
+#define CF_ARENA_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#define CF_ARENA_FALLBACK_BLOCK_SIZE (1024 * 1024)
+
+#ifdef CF_VIRTUAL_MEMORY
+
+static size_t s_page_size()
 {
-	CF_ASSERT((int)size < arena->block_size);
-	if (size > (size_t)(arena->end - arena->ptr)) {
-		arena->ptr = (char*)cf_aligned_alloc(arena->block_size, arena->alignment);
-		arena->end = arena->ptr + arena->block_size;
-		apush(arena->blocks, arena->ptr);
+#ifdef CF_WINDOWS
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (size_t)info.dwAllocationGranularity;
+#else
+	return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// Reserves address space without backing it with memory. Sets `*committed` if the whole range is usable
+// right away, as with explicit huge pages, which can't be committed piece by piece.
+static char* s_reserve(size_t size, bool huge_pages, bool* committed)
+{
+	*committed = false;
+#ifdef CF_WINDOWS
+	if (huge_pages) {
+		SIZE_T large_page = GetLargePageMinimum();
+		if (large_page && !(size % large_page)) {
+			void* result = VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+			if (result) {
+				*committed = true;
+				return (char*)result;
+			}
+		}
 	}
-	void* result = arena->ptr;
-	arena->ptr = (char*)CF_ALIGN_FORWARD_PTR(arena->ptr + size, arena->alignment);
-	CF_ASSERT(!(((size_t)(arena->ptr)) & (arena->alignment - 1)));
+	return (char*)VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+#	ifdef MAP_HUGETLB
+	if (huge_pages) {
+		void* result = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (result != MAP_FAILED) {
+			*committed = true;
+			return (char*)result;
+		}
+	}
+#	endif
+	void* result = mmap(NULL, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (result == MAP_FAILED) return NULL;
+#	ifdef MADV_HUGEPAGE
+	// Fall back to transparent huge pages, which the kernel hands out as committed ranges line up with them.
+	if (huge_pages) madvise(result, size, MADV_HUGEPAGE);
+#	endif
+	return (char*)result;
+#endif
+}
+
+static bool s_commit(char* ptr, size_t size)
+{
+#ifdef CF_WINDOWS
+	return VirtualAlloc(ptr, size, MEM_COMMIT, PAGE_READWRITE) != NULL;
+#else
+	return mprotect(ptr, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+static void s_release(char* ptr, size_t size)
+{
+#ifdef CF_WINDOWS
+	CF_UNUSED(size);
+	VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+	munmap(ptr, size);
+#endif
+}
+
+#endif // CF_VIRTUAL_MEMORY
+
+bool cf_arena_init_virtual(CF_Arena* arena, int alignment, size_t reserve_size, bool huge_pages)
+{
+	CF_ASSERT(alignment > 0 && !(alignment & (alignment - 1)));
+#ifdef CF_VIRTUAL_MEMORY
+	size_t page_size = huge_pages ? CF_ARENA_HUGE_PAGE_SIZE : s_page_size();
+	size_t size = CF_ALIGN_FORWARD(reserve_size, page_size);
+	bool committed;
+	char* base = s_reserve(size, huge_pages, &committed);
+	if (base) {
+		cf_arena_init(arena, alignment, 0);
+		arena->base = base;
+		arena->reserve_size = size;
+		arena->huge_pages = huge_pages;
+		arena->ptr = base;
+		arena->end = committed ? base + size : base;
+		return true;
+	}
+#else
+	CF_UNUSED(huge_pages);
+#endif
+	size_t block_size = reserve_size < CF_ARENA_FALLBACK_BLOCK_SIZE ? reserve_size : CF_ARENA_FALLBACK_BLOCK_SIZE;
+	cf_arena_init(arena, alignment, (int)block_size);
+	return false;
+}
+
+// Commits enough of a virtual arena's range for `size` more bytes at `ptr`. Returns false once the reserve runs out.
+static bool s_arena_grow(CF_Arena* arena, char* ptr, size_t size)
+{
+#ifdef CF_VIRTUAL_MEMORY
+	char* reserve_end = arena->base + arena->reserve_size;
+	if (ptr > reserve_end || size > (size_t)(reserve_end - ptr)) return false;
+	size_t granule = arena->huge_pages ? CF_ARENA_HUGE_PAGE_SIZE : CF_ARENA_COMMIT_SIZE;
+	size_t needed = (size_t)(ptr + size - arena->base);
+	char* end = arena->base + CF_ALIGN_FORWARD(needed, granule);
+	if (end > reserve_end) end = reserve_end;
+	if (!s_commit(arena->end, (size_t)(end - arena->end))) return false;
+	arena->end = end;
+	return true;
+#else
+	CF_UNUSED(arena);
+	CF_UNUSED(ptr);
+	CF_UNUSED(size);
+	return false;
+#endif
+}
+
+static void s_arena_next_block(CF_Arena* arena, size_t size)
+{
+	size_t block_size = size > (size_t)arena->block_size ? size : (size_t)arena->block_size;
+
+	// Reuse a spare block left over from before a rewind if one is big enough, otherwise chain on a new one.
+	int index = arena->used_blocks;
+	int found = -1;
+	for (int i = index; i < acount(arena->blocks); ++i) {
+		if (arena->block_sizes[i] >= block_size) {
+			found = i;
+			break;
+		}
+	}
+	if (found < 0) {
+		found = acount(arena->blocks);
+		apush(arena->blocks, (char*)cf_aligned_alloc(block_size, arena->alignment));
+		apush(arena->block_sizes, block_size);
+	}
+
+	// Only spare blocks are ever reordered, so markers stay valid.
+	char* block = arena->blocks[found];
+	size_t found_size = arena->block_sizes[found];
+	arena->blocks[found] = arena->blocks[index];
+	arena->block_sizes[found] = arena->block_sizes[index];
+	arena->blocks[index] = block;
+	arena->block_sizes[index] = found_size;
+
+	arena->used_blocks = index + 1;
+	arena->ptr = block;
+	arena->end = block + found_size;
+}
+
+void* cf_arena_alloc_aligned(CF_Arena* arena, size_t size, int alignment)
+{
+	CF_ASSERT(alignment > 0 && !(alignment & (alignment - 1)) && alignment <= 256);
+	char* ptr = (char*)CF_ALIGN_FORWARD_PTR(arena->ptr, alignment);
+	if (arena->base) {
+		if ((ptr > arena->end || size > (size_t)(arena->end - ptr)) && !s_arena_grow(arena, ptr, size)) return NULL;
+		arena->ptr = ptr + size;
+		return ptr;
+	}
+	if (!arena->ptr || ptr > arena->end || size > (size_t)(arena->end - ptr)) {
+		// Blocks are only aligned to the arena's alignment, so leave room to align further.
+		size_t padding = alignment > arena->alignment ? (size_t)alignment : 0;
+		s_arena_next_block(arena, size + padding);
+		ptr = (char*)CF_ALIGN_FORWARD_PTR(arena->ptr, alignment);
+	}
+	arena->ptr = ptr + size;
 	CF_ASSERT(arena->ptr <= arena->end);
-	return result;
+	return ptr;
+}
+
+void* cf_arena_alloc(CF_Arena* arena, size_t size)
+{
+	return cf_arena_alloc_aligned(arena, size, arena->alignment);
+}
+
+CF_ArenaMarker cf_arena_mark(CF_Arena* arena)
+{
+	CF_ArenaMarker marker;
+	marker.used_blocks = arena->used_blocks;
+	marker.ptr = arena->ptr;
+	return marker;
+}
+
+void cf_arena_rewind(CF_Arena* arena, CF_ArenaMarker marker)
+{
+	if (arena->base) {
+		// Virtual arenas have no blocks, a zero marker is simply a NULL pointer.
+		CF_ASSERT(!marker.ptr || (marker.ptr >= arena->base && marker.ptr <= arena->ptr));
+		arena->ptr = marker.ptr ? marker.ptr : arena->base;
+		return;
+	}
+	CF_ASSERT(marker.used_blocks <= arena->used_blocks);
+	arena->used_blocks = marker.used_blocks;
+	if (marker.used_blocks) {
+		int index = marker.used_blocks - 1;
+		arena->ptr = marker.ptr;
+		arena->end = arena->blocks[index] + arena->block_sizes[index];
+	} else {
+		arena->ptr = NULL;
+		arena->end = NULL;
+	}
 }
 
 void cf_arena_reset(CF_Arena* arena)
 {
-	if (arena->blocks) {
-		for (int i = 0; i < alen(arena->blocks); ++i) {
-			cf_aligned_free(arena->blocks[i]);
-		}
-		afree(arena->blocks);
+	if (arena->base) {
+		arena->ptr = arena->base;
+		return;
 	}
+	for (int i = 0; i < acount(arena->blocks); ++i) {
+		cf_aligned_free(arena->blocks[i]);
+	}
+	afree(arena->blocks);
+	afree(arena->block_sizes);
 	arena->ptr = NULL;
 	arena->end = NULL;
+	arena->used_blocks = 0;
 	arena->blocks = NULL;
+	arena->block_sizes = NULL;
+}
+
+void cf_arena_destroy(CF_Arena* arena)
+{
+#ifdef CF_VIRTUAL_MEMORY
+	if (arena->base) {
+		s_release(arena->base, arena->reserve_size);
+		CF_MEMSET(arena, 0, sizeof(*arena));
+		return;
+	}
+#endif
+	cf_arena_reset(arena);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+// Unlike `CF_Arena`, rewinding a frame arena keeps its blocks around for the next frame to reuse. Each
+// thread has two, and flips between them the first time it allocates after the frame advances.
+
+#define CF_FRAME_BLOCK_SIZE (64 * 1024)
+#define CF_FRAME_ALIGNMENT 16
+
+struct CF_FrameArena
+{
+	int block_index = -1;
+	char* ptr = NULL;
+	char* end = NULL;
+	dyna char** blocks = NULL;
+	// Allocations too big for a block, freed on rewind.
+	dyna char** large = NULL;
+};
+
+struct CF_FrameArenas
+{
+	int frame = 0;
+	int current = 0;
+	CF_FrameArena arenas[2];
+
+	~CF_FrameArenas()
+	{
+		for (int i = 0; i < 2; ++i) {
+			CF_FrameArena* arena = arenas + i;
+			for (int j = 0; j < acount(arena->blocks); ++j) cf_aligned_free(arena->blocks[j]);
+			for (int j = 0; j < acount(arena->large); ++j) cf_aligned_free(arena->large[j]);
+			afree(arena->blocks);
+			afree(arena->large);
+		}
+	}
+};
+
+static CF_AtomicInt s_frame;
+static thread_local CF_FrameArenas s_frame_arenas;
+
+static void s_frame_arena_rewind(CF_FrameArena* arena)
+{
+	for (int i = 0; i < acount(arena->large); ++i) {
+		cf_aligned_free(arena->large[i]);
+	}
+	aclear(arena->large);
+	arena->block_index = -1;
+	arena->ptr = NULL;
+	arena->end = NULL;
+}
+
+void* cf_frame_alloc(size_t size)
+{
+	CF_FrameArenas* arenas = &s_frame_arenas;
+	int frame = cf_atomic_get(&s_frame);
+	if (arenas->frame != frame) {
+		arenas->frame = frame;
+		arenas->current ^= 1;
+		s_frame_arena_rewind(arenas->arenas + arenas->current);
+	}
+	CF_FrameArena* arena = arenas->arenas + arenas->current;
+
+	size = CF_ALIGN_FORWARD(size, (size_t)CF_FRAME_ALIGNMENT);
+	if (size > CF_FRAME_BLOCK_SIZE) {
+		char* result = (char*)cf_aligned_alloc(size, CF_FRAME_ALIGNMENT);
+		apush(arena->large, result);
+		return result;
+	}
+	if (size > (size_t)(arena->end - arena->ptr)) {
+		if (++arena->block_index == acount(arena->blocks)) {
+			apush(arena->blocks, (char*)cf_aligned_alloc(CF_FRAME_BLOCK_SIZE, CF_FRAME_ALIGNMENT));
+		}
+		arena->ptr = arena->blocks[arena->block_index];
+		arena->end = arena->ptr + CF_FRAME_BLOCK_SIZE;
+	}
+	void* result = arena->ptr;
+	arena->ptr += size;
+	return result;
+}
+
+void* cf_frame_calloc(size_t size, size_t count)
+{
+	void* result = cf_frame_alloc(size * count);
+	CF_MEMSET(result, 0, size * count);
+	return result;
+}
+
+char* cf_frame_fmt(const char* fmt, ...)
+{
+	// Formatted once into the stack, then copied, rather than measured with one `vsnprintf` and printed with another.
+	alignas(CF_Ahdr) char buffer[sizeof(CF_Ahdr) + 256];
+	char* s = NULL;
+	sstatic(s, buffer, sizeof(buffer));
+	va_list args;
+	va_start(args, fmt);
+	svfmt(s, fmt, args);
+	va_end(args);
+	char* result = (char*)cf_frame_alloc((size_t)scount(s));
+	CF_MEMCPY(result, s, scount(s));
+	sfree(s);
+	return result;
+}
+
+void cf_frame_arena_advance()
+{
+	cf_atomic_add(&s_frame, 1);
+	s_tracking_next_frame();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+// Small allocations are rounded up to a size class. Each thread keeps a list of free blocks for every class,
+// and trades whole batches of blocks with a shared depot, so the depot's lock is taken once per batch rather
+// than once per allocation. Each allocation is prefixed by a header naming its class, so free and realloc
+// don't need to be told the size. Memory comes straight from malloc, since going through `cf_alloc` would
+// recurse right back into this allocator once it's installed with `cf_allocator_override`.
+
+#define CF_POOL_HEADER_SIZE 16
+#define CF_POOL_LARGE -1
+#define CF_POOL_BATCH_SIZE 64
+#define CF_POOL_SLAB_SIZE (128 * 1024)
+#define CF_POOL_CLASS_COUNT 24
+
+static const int s_pool_class_sizes[CF_POOL_CLASS_COUNT] = {
+	16, 32, 48, 64, 80, 96, 112, 128,
+	160, 192, 224, 256, 320, 384, 448, 512,
+	640, 768, 896, 1024, 1280, 1536, 1792, 2048,
+};
+
+#define CF_POOL_MAX_SMALL 2048
+
+struct CF_PoolHeader
+{
+	int size_class;
+	// Only used by large allocations.
+	size_t size;
+};
+
+static_assert(sizeof(CF_PoolHeader) <= CF_POOL_HEADER_SIZE, "The pool header must leave allocations 16-byte aligned.");
+
+struct CF_PoolBlock
+{
+	CF_PoolBlock* next;
+};
+
+struct CF_PoolBatch
+{
+	CF_PoolBlock* head;
+	int count;
+};
+
+struct CF_PoolClass
+{
+	CF_Mutex lock;
+	int batch_count;
+	int batch_capacity;
+	CF_PoolBatch* batches;
+	// Fresh blocks are carved from here once the depot runs out of batches.
+	char* slab_ptr;
+	char* slab_end;
+};
+
+struct CF_PoolDepot
+{
+	CF_PoolClass classes[CF_POOL_CLASS_COUNT];
+	CF_AtomicInt slab_count;
+	CF_AtomicInt large_count;
+	CF_AtomicInt refill_count;
+	CF_AtomicInt return_count;
+};
+
+static CF_PoolDepot s_pool;
+
+static void s_pool_lock(CF_PoolClass* c)
+{
+	cf_mutex_lock(&c->lock);
+}
+
+static void s_pool_unlock(CF_PoolClass* c)
+{
+	cf_mutex_unlock(&c->lock);
+}
+
+static void s_pool_return(int size_class, CF_PoolBlock* head, int count)
+{
+	CF_PoolClass* c = s_pool.classes + size_class;
+	s_pool_lock(c);
+	if (c->batch_count == c->batch_capacity) {
+		int capacity = c->batch_capacity ? c->batch_capacity * 2 : 64;
+		c->batches = (CF_PoolBatch*)realloc(c->batches, sizeof(CF_PoolBatch) * capacity);
+		c->batch_capacity = capacity;
+	}
+	c->batches[c->batch_count].head = head;
+	c->batches[c->batch_count].count = count;
+	c->batch_count++;
+	s_pool_unlock(c);
+	cf_atomic_add(&s_pool.return_count, 1);
+}
+
+static CF_PoolBlock* s_pool_refill(int size_class, int* count)
+{
+	CF_PoolClass* c = s_pool.classes + size_class;
+	cf_atomic_add(&s_pool.refill_count, 1);
+	s_pool_lock(c);
+	if (c->batch_count) {
+		CF_PoolBatch batch = c->batches[--c->batch_count];
+		s_pool_unlock(c);
+		*count = batch.count;
+		return batch.head;
+	}
+	size_t block_size = (size_t)s_pool_class_sizes[size_class] + CF_POOL_HEADER_SIZE;
+	if ((size_t)(c->slab_end - c->slab_ptr) < block_size) {
+		// The tail of the old slab is too small to use, and is simply left behind.
+		char* slab = (char*)malloc(CF_POOL_SLAB_SIZE);
+		if (!slab) {
+			s_pool_unlock(c);
+			return NULL;
+		}
+		c->slab_ptr = slab;
+		c->slab_end = slab + CF_POOL_SLAB_SIZE;
+		cf_atomic_add(&s_pool.slab_count, 1);
+	}
+	CF_PoolBlock* head = NULL;
+	int n = 0;
+	while (n < CF_POOL_BATCH_SIZE && (size_t)(c->slab_end - c->slab_ptr) >= block_size) {
+		CF_PoolBlock* block = (CF_PoolBlock*)c->slab_ptr;
+		c->slab_ptr += block_size;
+		block->next = head;
+		head = block;
+		++n;
+	}
+	s_pool_unlock(c);
+	*count = n;
+	return head;
+}
+
+struct CF_PoolCache
+{
+	bool dead = false;
+	CF_PoolBlock* heads[CF_POOL_CLASS_COUNT] = { };
+	int counts[CF_POOL_CLASS_COUNT] = { };
+
+	~CF_PoolCache()
+	{
+		// Hand everything back as the thread exits. Anything freed on this thread afterwards, such as by
+		// other destructors, goes straight to the depot.
+		for (int i = 0; i < CF_POOL_CLASS_COUNT; ++i) {
+			if (heads[i]) s_pool_return(i, heads[i], counts[i]);
+			heads[i] = NULL;
+			counts[i] = 0;
+		}
+		dead = true;
+	}
+};
+
+static thread_local CF_PoolCache s_pool_cache;
+
+static int s_pool_size_class(size_t size)
+{
+	if (size <= 128) return size ? (int)((size - 1) / 16) : 0;
+	int i = 8;
+	while ((size_t)s_pool_class_sizes[i] < size) ++i;
+	return i;
+}
+
+static void* s_pool_alloc_large(size_t size)
+{
+	CF_PoolHeader* header = (CF_PoolHeader*)malloc(CF_POOL_HEADER_SIZE + size);
+	if (!header) return NULL;
+	header->size_class = CF_POOL_LARGE;
+	header->size = size;
+	cf_atomic_add(&s_pool.large_count, 1);
+	return (char*)header + CF_POOL_HEADER_SIZE;
+}
+
+static void* s_pool_alloc(size_t size, void* udata)
+{
+	CF_UNUSED(udata);
+	CF_PoolCache* cache = &s_pool_cache;
+	if (size > CF_POOL_MAX_SMALL || cache->dead) return s_pool_alloc_large(size);
+	int size_class = s_pool_size_class(size);
+	CF_PoolBlock* block = cache->heads[size_class];
+	if (!block) {
+		block = s_pool_refill(size_class, &cache->counts[size_class]);
+		if (!block) return NULL;
+	}
+	cache->heads[size_class] = block->next;
+	cache->counts[size_class]--;
+	CF_PoolHeader* header = (CF_PoolHeader*)block;
+	header->size_class = size_class;
+	return (char*)header + CF_POOL_HEADER_SIZE;
+}
+
+static void s_pool_free(void* ptr, void* udata)
+{
+	CF_UNUSED(udata);
+	if (!ptr) return;
+	CF_PoolHeader* header = (CF_PoolHeader*)((char*)ptr - CF_POOL_HEADER_SIZE);
+	int size_class = header->size_class;
+	if (size_class == CF_POOL_LARGE) {
+		cf_atomic_add(&s_pool.large_count, -1);
+		free(header);
+		return;
+	}
+	CF_ASSERT(size_class >= 0 && size_class < CF_POOL_CLASS_COUNT);
+	CF_PoolBlock* block = (CF_PoolBlock*)header;
+	CF_PoolCache* cache = &s_pool_cache;
+	if (cache->dead) {
+		block->next = NULL;
+		s_pool_return(size_class, block, 1);
+		return;
+	}
+	block->next = cache->heads[size_class];
+	cache->heads[size_class] = block;
+	if (++cache->counts[size_class] == CF_POOL_BATCH_SIZE * 2) {
+		// Keep one batch for this thread, and hand the other to the depot for any thread to reuse.
+		CF_PoolBlock* last = block;
+		for (int i = 1; i < CF_POOL_BATCH_SIZE; ++i) last = last->next;
+		cache->heads[size_class] = last->next;
+		cache->counts[size_class] = CF_POOL_BATCH_SIZE;
+		last->next = NULL;
+		s_pool_return(size_class, block, CF_POOL_BATCH_SIZE);
+	}
+}
+
+static void* s_pool_calloc(size_t size, size_t count, void* udata)
+{
+	void* result = s_pool_alloc(size * count, udata);
+	if (result) CF_MEMSET(result, 0, size * count);
+	return result;
+}
+
+static void* s_pool_realloc(void* ptr, size_t size, void* udata)
+{
+	if (!ptr) return s_pool_alloc(size, udata);
+	if (!size) {
+		s_pool_free(ptr, udata);
+		return NULL;
+	}
+	CF_PoolHeader* header = (CF_PoolHeader*)((char*)ptr - CF_POOL_HEADER_SIZE);
+	size_t capacity;
+	if (header->size_class == CF_POOL_LARGE) {
+		if (size > CF_POOL_MAX_SMALL) {
+			header = (CF_PoolHeader*)realloc(header, CF_POOL_HEADER_SIZE + size);
+			if (!header) return NULL;
+			header->size = size;
+			return (char*)header + CF_POOL_HEADER_SIZE;
+		}
+		capacity = header->size;
+	} else {
+		capacity = (size_t)s_pool_class_sizes[header->size_class];
+		// Stay put unless the block is too small, or way too big.
+		if (size <= capacity && size > capacity / 2) return ptr;
+	}
+	void* result = s_pool_alloc(size, udata);
+	if (!result) return NULL;
+	CF_MEMCPY(result, ptr, size < capacity ? size : capacity);
+	s_pool_free(ptr, udata);
+	return result;
+}
+
+CF_Allocator cf_pool_allocator()
+{
+	CF_Allocator allocator;
+	allocator.udata = NULL;
+	allocator.alloc_fn = s_pool_alloc;
+	allocator.free_fn = s_pool_free;
+	allocator.calloc_fn = s_pool_calloc;
+	allocator.realloc_fn = s_pool_realloc;
+	return allocator;
+}
+
+CF_PoolAllocatorStats cf_pool_allocator_stats()
+{
+	CF_PoolAllocatorStats stats;
+	stats.bytes_reserved = (uint64_t)cf_atomic_get(&s_pool.slab_count) * CF_POOL_SLAB_SIZE;
+	stats.large_allocation_count = cf_atomic_get(&s_pool.large_count);
+	stats.refill_count = cf_atomic_get(&s_pool.refill_count);
+	stats.return_count = cf_atomic_get(&s_pool.return_count);
+	return stats;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -13,18 +13,28 @@
 #include <cute_c_runtime.h>
 #include <cute_draw.h>
 #include <cute_time.h>
+#include <cute_profile.h>
+#include <cute_log.h>
+#include <cute_coroutine.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
 #include <internal/cute_input_internal.h>
 #include <internal/cute_graphics_internal.h>
+#include <internal/cute_time_internal.h>
 #include <internal/cute_draw_internal.h>
 #include <internal/cute_dx11.h>
 #include <internal/cute_metal.h>
 #include <internal/cute_png_cache_internal.h>
+#include <internal/cute_manifest_internal.h>
 #include <internal/cute_aseprite_cache_internal.h>
+#include <internal/cute_audio_internal.h>
+#include <internal/cute_profile_internal.h>
+#include <internal/cute_log_internal.h>
+#include <internal/cute_https_internal.h>
+#include <internal/cute_replay_internal.h>
+#include <internal/cute_networking_internal.h>
 
-#include <data/fonts/calibri.h>
 
 #include <SDL.h>
 
@@ -175,14 +185,49 @@ unsigned char default_png_data[81] = {
 	0x82
 };
 
+static float s_resolution_level_scale(int level)
+{
+	const CF_DynamicResolution& params = app->dynamic_resolution.params;
+	return params.min_scale + (params.max_scale - params.min_scale) * (float)level / (float)(params.levels - 1);
+}
+
+// Points `offscreen_canvas` at the canvas for a dynamic resolution level, making it if needed.
+static void s_apply_resolution_level(int level)
+{
+	CF_DynamicResolutionState* dr = &app->dynamic_resolution;
+	dr->level = level;
+	dr->scale = dr->enabled ? s_resolution_level_scale(level) : 1.0f;
+	CF_Canvas canvas = app->full_canvas;
+	if (dr->scale < 1.0f) {
+		while (dr->canvases.count() <= level) dr->canvases.add({ 0 });
+		if (!dr->canvases[level].id) {
+			int w = max(1, (int)((float)app->canvas_w * dr->scale + 0.5f));
+			int h = max(1, (int)((float)app->canvas_h * dr->scale + 0.5f));
+			dr->canvases[level] = cf_make_canvas(cf_canvas_defaults(w, h));
+		}
+		canvas = dr->canvases[level];
+	}
+	app->offscreen_canvas = canvas;
+	cf_material_set_texture_fs(app->backbuffer_material, "u_image", cf_canvas_get_target(canvas));
+}
+
+static void s_destroy_resolution_canvases()
+{
+	CF_DynamicResolutionState* dr = &app->dynamic_resolution;
+	for (int i = 0; i < dr->canvases.count(); ++i) {
+		if (dr->canvases[i].id) cf_destroy_canvas(dr->canvases[i]);
+	}
+	dr->canvases.clear();
+}
+
 static void s_canvas(int w, int h)
 {
 	{
 		CF_CanvasParams params = cf_canvas_defaults(w, h);
-		if (app->offscreen_canvas.id) {
-			cf_destroy_canvas(app->offscreen_canvas);
+		if (app->full_canvas.id) {
+			cf_destroy_canvas(app->full_canvas);
 		}
-		app->offscreen_canvas = cf_make_canvas(params);
+		app->full_canvas = cf_make_canvas(params);
 	}
 	{
 		// Size (0,0) is a hidden feature to use sokol's default canvas. This let's us
@@ -195,18 +240,75 @@ static void s_canvas(int w, int h)
 	}
 	app->canvas_w = w;
 	app->canvas_h = h;
-	cf_material_set_texture_fs(app->backbuffer_material, "u_image", cf_canvas_get_target(app->offscreen_canvas));
+
+	// Smaller canvases are sized off of this one, so they're remade as they're needed.
+	s_destroy_resolution_canvases();
+	s_apply_resolution_level(app->dynamic_resolution.level);
+}
+
+// Steps the dynamic resolution up or down a level based on the latest GPU timings.
+static void s_update_dynamic_resolution()
+{
+	CF_DynamicResolutionState* dr = &app->dynamic_resolution;
+	if (!dr->enabled) return;
+	CF_GpuTimings timings = cf_query_gpu_timings();
+	if (!timings.count || timings.frame == dr->timings_frame) return;
+	dr->timings_frame = timings.frame;
+	if (dr->settle > 0) {
+		--dr->settle;
+		return;
+	}
+
+	// The root scope spans the whole frame.
+	float ms = timings.timings[0].milliseconds;
+	dr->smoothed_milliseconds = dr->smoothed_milliseconds > 0 ? cf_lerp(dr->smoothed_milliseconds, ms, 0.25f) : ms;
+
+	// Only step up with enough headroom that the larger size is expected to fit, otherwise the canvas would flip
+	// back and forth. Cost scales with the pixel count, so the square of the ratio of scales.
+	int level = dr->level;
+	float target = dr->params.target_milliseconds;
+	if (dr->smoothed_milliseconds > target && level > 0) {
+		--level;
+	} else if (level < dr->params.levels - 1) {
+		float growth = s_resolution_level_scale(level + 1) / s_resolution_level_scale(level);
+		if (dr->smoothed_milliseconds * growth * growth < target * 0.9f) ++level;
+	}
+	if (level != dr->level) {
+		s_apply_resolution_level(level);
+		dr->smoothed_milliseconds = 0;
+		dr->settle = CF_GPU_TIMER_FRAME_COUNT;
+	}
+}
+
+// Returns the milliseconds elapsed since `*ticks`, and restarts `*ticks` from now.
+static float s_startup_lap(uint64_t* ticks)
+{
+	uint64_t now = cf_get_ticks();
+	float milliseconds = (float)((double)(now - *ticks) * 1000.0 / (double)cf_get_tick_frequency());
+	*ticks = now;
+	return milliseconds;
 }
 
 CF_Result cf_make_app(const char* window_title, int display_index, int x, int y, int w, int h, int options, const char* argv0)
 {
 	SDL_SetMainReady();
+	CF_StartupTimings timings = { };
+	uint64_t start_ticks = cf_get_ticks();
+	uint64_t ticks = start_ticks;
+
+	bool headless = !!(options & APP_OPTIONS_HEADLESS);
+	if (headless) {
+		options |= APP_OPTIONS_NO_GFX | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_FILE_SYSTEM_DONT_DEFAULT_MOUNT;
+	}
 
 	bool use_dx11 = false;
 	bool use_gl33 = false;
 	bool use_gles3 = false;
 	bool use_metal = false;
-	#if defined(CF_WINDOWS)
+	bool use_null = false;
+	#if defined(CF_NULL_GFX)
+	use_null = true;
+	#elif defined(CF_WINDOWS)
 	use_dx11 = true;
 	#elif defined(CF_LINUX)
 	use_gl33 = true;
@@ -215,16 +317,20 @@ CF_Result cf_make_app(const char* window_title, int display_index, int x, int y,
 	#elif defined(CF_EMSCRIPTEN)
 	use_gles3 = true;
 	#endif
-	bool use_gfx = (use_dx11|use_gl33|use_gles3|use_metal) && !(options & APP_OPTIONS_NO_GFX);
+	bool use_gfx = (use_dx11|use_gl33|use_gles3|use_metal|use_null) && !(options & APP_OPTIONS_NO_GFX);
 
 #ifdef CF_EMSCRIPTEN
 	Uint32 sdl_options = SDL_INIT_EVENTS | SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_GAMECONTROLLER;
 #else
 	Uint32 sdl_options = SDL_INIT_EVENTS | SDL_INIT_VIDEO | SDL_INIT_TIMER | SDL_INIT_GAMECONTROLLER | SDL_INIT_HAPTIC;
-	if (options & APP_OPTIONS_NO_GFX) {
+	if ((options & APP_OPTIONS_NO_GFX) || use_null) {
 		sdl_options &= ~SDL_INIT_VIDEO;
 	}
 #endif
+	if (headless) {
+		// Only timers and events, no devices.
+		sdl_options = SDL_INIT_EVENTS | SDL_INIT_TIMER;
+	}
 
 	// Turn on high DPI support for all platforms.
 	options |= SDL_WINDOW_ALLOW_HIGHDPI;
@@ -232,6 +338,7 @@ CF_Result cf_make_app(const char* window_title, int display_index, int x, int y,
 	if (SDL_Init(sdl_options)) {
 		return cf_result_error("SDL_Init failed");
 	}
+	timings.sdl_milliseconds = s_startup_lap(&ticks);
 
 	if (use_gfx) {
 		// Some backends don't support window size of zero.
@@ -259,21 +366,24 @@ CF_Result cf_make_app(const char* window_title, int display_index, int x, int y,
 		SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
 	}
 
-	SDL_Window* window;
-	if (options & APP_OPTIONS_WINDOW_POS_CENTERED) {
+	SDL_Window* window = NULL;
+	if (headless || use_null) {
+		// No window. The null backend has nothing to present to, so it runs on machines without a display.
+	} else if (options & APP_OPTIONS_WINDOW_POS_CENTERED) {
 		window = SDL_CreateWindow(window_title, SDL_WINDOWPOS_CENTERED_DISPLAY(display_index), SDL_WINDOWPOS_CENTERED_DISPLAY(display_index), w, h, flags);
 	} else {
 		int x_offset = display_x(display_index);
 		int y_offset = display_y(display_index);
 		window = SDL_CreateWindow(window_title, x_offset+x, y_offset+y, w, h, flags);
 	}
+	timings.window_milliseconds = s_startup_lap(&ticks);
 	CF_App* app = (CF_App*)CF_ALLOC(sizeof(CF_App));
 	CF_PLACEMENT_NEW(app) CF_App;
 	app->options = options;
 	app->window = window;
 	app->w = w;
 	app->h = h;
-	SDL_GetWindowPosition(app->window, &app->x, &app->y);
+	if (window) SDL_GetWindowPosition(app->window, &app->x, &app->y);
 	list_init(&app->joypads);
 	::app = app;
 
@@ -325,6 +435,21 @@ CF_Result cf_make_app(const char* window_title, int display_index, int x, int y,
 		app->gfx_enabled = true;
 	}
 
+	if (use_null && use_gfx) {
+		// Sokol's dummy backend hands out valid handles and drops everything else, so the whole draw API
+		// runs on the CPU as usual.
+		CF_MEMSET(&app->gfx_ctx_params, 0, sizeof(app->gfx_ctx_params));
+		app->gfx_ctx_params.color_format = SG_PIXELFORMAT_RGBA8;
+		app->gfx_ctx_params.depth_format = SG_PIXELFORMAT_DEPTH_STENCIL;
+		sg_desc params = { };
+		params.context = app->gfx_ctx_params;
+		params.logger.func = slog_func;
+		sg_setup(params);
+		app->gfx_enabled = true;
+	}
+
+	timings.gfx_milliseconds = s_startup_lap(&ticks);
+
 	cf_make_aseprite_cache();
 	cf_make_png_cache();
 
@@ -362,35 +487,29 @@ CF_Result cf_make_app(const char* window_title, int display_index, int x, int y,
 		// with a black background.
 		cf_apply_canvas(app->offscreen_canvas, true);
 
-		// Create a default font.
-		make_font_from_memory(calibri_data, calibri_sz, "Calibri");
+		// The default font ("Calibri") is parsed the first time it's used, see `cf_font_get`.
+	} else {
+		// A CPU-only draw state, so draw calls can be made and are simply ignored.
+		cf_make_draw();
 	}
+	timings.draw_milliseconds = s_startup_lap(&ticks);
+	app->startup_timings = timings;
 
 	if (!(options & APP_OPTIONS_NO_AUDIO)) {
-		int more_on_emscripten = 1;
-	#ifdef CF_EMSCRIPTEN
-		more_on_emscripten = 4;
-	#endif
-		cs_error_t err = cs_init(NULL, 44100, 1024 * more_on_emscripten, NULL);
-		if (err == CUTE_SOUND_ERROR_NONE) {
-	#ifndef CF_EMSCRIPTEN
-			cs_spawn_mix_thread();
-			app->spawned_mix_thread = true;
-	#endif // CF_EMSCRIPTEN
-			app->audio_needs_updates = true;
-			//cs_cull_duplicates(true); -- https://github.com/RandyGaul/cute_framework/issues/172
-		} else {
-			CF_Result result;
-			result.code = -1;
-			result.details = cs_error_as_string(err);
-			return result;
+		app->audio_headless = !!(options & APP_OPTIONS_NO_AUDIO_DEVICE);
+		app->audio_lazy = true;
+		if (!(options & APP_OPTIONS_LAZY_AUDIO)) {
+			CF_Result result = cf_app_init_audio();
+			if (cf_is_error(result)) return result;
 		}
 	}
+	ticks = cf_get_ticks();
 
-	int num_threads_to_spawn = cf_core_count() - 1;
+	int num_threads_to_spawn = headless ? 0 : cf_core_count() - 1;
 	if (num_threads_to_spawn) {
 		app->threadpool = cf_make_threadpool(num_threads_to_spawn);
 	}
+	app->startup_timings.threadpool_milliseconds = s_startup_lap(&ticks);
 
 	CF_Result err = cf_fs_init(argv0);
 	if (cf_is_error(err)) {
@@ -399,26 +518,37 @@ CF_Result cf_make_app(const char* window_title, int display_index, int x, int y,
 		// Put the base directory (the path to the exe) onto the file system search path.
 		cf_fs_mount(cf_fs_get_base_directory(), "", true);
 	}
+	app->startup_timings.file_system_milliseconds = s_startup_lap(&ticks);
 
 	// Initialize a default ECS world.
 	app->world = cf_make_world();
 	app->worlds.add(app->world);
+	app->startup_timings.total_milliseconds = s_startup_lap(&start_ticks);
 
 	return cf_result_success();
 }
 
 void cf_destroy_app()
 {
+	cf_destroy_manifests();
 	if (app->using_imgui) {
 		ImGui_ImplSDL2_Shutdown();
 		simgui_shutdown();
 		sg_imgui_discard(&app->sg_imgui);
 		app->using_imgui = false;
 	}
-	if (app->gfx_enabled) {
+	for (int i = 0; i < app->dynamic_sprites.count(); ++i) {
+		CF_DynamicSprite* dynamic = app->dynamic_sprites.items() + i;
+		if (dynamic->texture.id) cf_destroy_texture(dynamic->texture);
+		CF_FREE(dynamic->pix);
+	}
+	if (!app->gfx_enabled) {
+		cf_destroy_draw();
+	} else {
 		sg_end_pass();
 		cf_destroy_draw();
-		cf_destroy_canvas(app->offscreen_canvas);
+		s_destroy_resolution_canvases();
+		cf_destroy_canvas(app->full_canvas);
 		cf_destroy_canvas(app->backbuffer_canvas);
 		cf_destroy_mesh(app->backbuffer_quad);
 		cf_destroy_shader(app->backbuffer_shader);
@@ -428,6 +558,10 @@ void cf_destroy_app()
 			cf_destroy_material(app->blit_material);
 			cf_destroy_shader(app->blit_shader);
 		}
+		if (app->noise_shader_init) {
+			cf_destroy_material(app->noise_material);
+			cf_destroy_shader(app->noise_shader);
+		}
 		cf_destroy_graphics();
 		sg_shutdown();
 		cf_dx11_shutdown();
@@ -439,18 +573,27 @@ void cf_destroy_app()
 	for (int i = 0; i < app->worlds.count(); ++i) {
 		cf_destroy_world(app->worlds[i]);
 	}
+	cf_audio_finish_loads();
 	cs_shutdown();
-	destroy_mutex(&app->on_sound_finish_mutex);
-	SDL_DestroyWindow(app->window);
+	cf_audio_free_banks(true);
+	if (app->window) SDL_DestroyWindow(app->window);
 	SDL_Quit();
-	destroy_threadpool(app->threadpool);
+	if (app->threadpool) destroy_threadpool(app->threadpool);
+	cf_coroutine_release_pooled_memory();
+	cf_profile_shutdown();
+	cf_log_shutdown();
 	cs_shutdown();
 	CF_Image* easy_sprites = app->easy_sprites.items();
 	for (int i = 0; i < app->easy_sprites.count(); ++i) {
 		cf_image_free(&easy_sprites[i]);
 	}
+	for (int i = 0; i < app->text_effect_pool.count(); ++i) {
+		app->text_effect_pool[i]->~CF_TextEffectState();
+		CF_FREE(app->text_effect_pool[i]);
+	}
 	app->~CF_App();
 	CF_FREE(app);
+	cf_https_shutdown();
 	cf_fs_destroy();
 }
 
@@ -467,31 +610,58 @@ void cf_app_signal_shutdown()
 static void s_on_update(void* udata)
 {
 	cf_pump_input_msgs();
+	if (app->replay_recording) cf_replay_capture(app->replay_recording);
 	if (app->audio_needs_updates) {
+		CF_ALLOC_TAG_SCOPE("audio");
 		cs_update(DELTA_TIME);
 		if (app->on_sound_finish_single_threaded) {
-			mutex_lock(&app->on_sound_finish_mutex);
-			Array<CF_Sound> on_finish = app->on_sound_finish_queue;
-			app->on_sound_finish_queue.clear();
-			mutex_unlock(&app->on_sound_finish_mutex);
-			for (int i = 0; i < on_finish.size(); ++i) {
-				app->on_sound_finish(on_finish[i], app->on_sound_finish_udata);
-			}
-			if (app->on_music_finish && app->on_music_finish_signal) {
-				app->on_music_finish_signal = false;
-				app->on_music_finish(app->on_music_finish_udata);
+			cs_playing_sound_t snd;
+			bool is_music;
+			while (cs_pop_finished_sound(&snd, &is_music)) {
+				if (is_music) {
+					if (app->on_music_finish) app->on_music_finish(app->on_music_finish_udata);
+				} else if (app->on_sound_finish) {
+					CF_Sound sound;
+					sound.id = snd.id;
+					app->on_sound_finish(sound, app->on_sound_finish_udata);
+				}
 			}
 		}
 	}
+	if (app->audio_banks_to_free.count()) cf_audio_free_banks(false);
 	if (app->user_on_update) app->user_on_update(udata);
 }
 
+// Gathers the counters of the frame that just ended from each subsystem, see `cf_app_get_frame_stats`.
+static void s_take_frame_stats()
+{
+	CF_FrameStats stats = { };
+	CF_RenderStats render_stats = cf_query_render_stats();
+	stats.draw_calls = render_stats.draw_calls;
+	stats.vertices_uploaded = render_stats.vertices_uploaded;
+	cf_draw_take_frame_stats(&stats);
+	stats.entities_iterated = cf_atomic_set(&app->entities_iterated, 0);
+	cf_alloc_take_frame_counts(&stats.alloc_count, &stats.alloc_bytes);
+	if (app->audio_needs_updates) stats.audio_voices = cf_audio_get_stats().voice_count;
+	uint64_t sent, received;
+	cf_net_get_byte_totals(&sent, &received);
+	stats.net_bytes_sent = sent - app->net_bytes_sent_total;
+	stats.net_bytes_received = received - app->net_bytes_received_total;
+	app->net_bytes_sent_total = sent;
+	app->net_bytes_received_total = received;
+	stats.https_requests = cf_https_live_request_count();
+	app->frame_stats = stats;
+}
+
 void cf_app_update(CF_OnUpdateFn* on_update)
 {
+	cf_profile_collect();
+	CF_PROFILE_SCOPE("cf_app_update");
+	s_take_frame_stats();
 	if (app->gfx_enabled) {
 		// Deal with DPI scaling.
-		int pw = 0, ph = 0;
-		SDL_GetWindowSizeInPixels(app->window, &pw, &ph);
+		int pw = app->w, ph = app->h;
+		if (app->window) SDL_GetWindowSizeInPixels(app->window, &pw, &ph);
 		app->dpi_scale = (float)ph / (float)app->h;
 		app->dpi_scale_was_changed = false;
 		if (app->dpi_scale != app->dpi_scale_prev) {
@@ -509,6 +679,7 @@ void cf_app_update(CF_OnUpdateFn* on_update)
 			simgui_new_frame(&desc);
 		}
 	}
+	cf_fs_poll_changes();
 	app->user_on_update = on_update;
 	cf_update_time(s_on_update);
 }
@@ -522,39 +693,100 @@ static void s_imgui_present()
 	}
 }
 
+// Clears all pushed draw parameters and returns the frame's draw call count.
+static int s_end_frame()
+{
+	draw->colors.set_count(1);
+	draw->tints.set_count(1);
+	draw->antialias.set_count(1);
+	draw->antialias_scale.set_count(1);
+	draw->opaque.set_count(1);
+	draw->render_states.set_count(1);
+	draw->scissors.set_count(1);
+	draw->viewports.set_count(1);
+	draw->layers.set_count(1);
+	draw->layers.set_count(1);
+	draw->reset_cam();
+	draw->font_sizes.set_count(1);
+	draw->fonts.set_count(1);
+	draw->blurs.set_count(1);
+	draw->text_wrap_widths.set_count(1);
+	draw->text_clip_boxes.set_count(1);
+	draw->vertical.set_count(1);
+	draw->user_params.set_count(1);
+	draw->shaders.set_count(1);
+	material_clear_textures(draw->material);
+	material_clear_uniforms(draw->material);
+	draw->uniform_texture_w = 0;
+	draw->uniform_texture_h = 0;
+
+	// Frees temporaries from `cf_frame_alloc` made the frame before this one.
+	cf_frame_arena_advance();
+
+	// Report the number of draw calls.
+	// This is always user draw call count +1.
+	int draw_call_count = app->draw_call_count;
+	app->draw_call_count = 0;
+	return draw_call_count;
+}
+
 int cf_app_draw_onto_screen(bool clear)
 {
-	// Update lifteime of all text effects.
-	const char** keys = app->text_effect_states.keys();
-	CF_TextEffectState* effect_states = app->text_effect_states.items();
+	CF_ALLOC_TAG_SCOPE("draw");
+	if (!app->gfx_enabled) {
+		// Nothing was recorded, see `s_push_sprite`.
+		return s_end_frame();
+	}
+
+	// Update lifteime of all text effects. Dead states go back to the pool with their memory intact.
+	const uint64_t* keys = app->text_effect_states.keys();
+	const int* handles = app->text_effect_states.items();
 	int count = app->text_effect_states.count();
 	for (int i = 0; i < count;) {
-		if (!effect_states[i].alive) {
+		CF_TextEffectState* effect_state = app->text_effect_pool[handles[i]];
+		if (!effect_state->alive) {
+			app->text_effect_free_list.add(handles[i]);
 			app->text_effect_states.remove(keys[i]);
 			--count;
 		} else {
-			effect_states[i].alive = false;
+			effect_state->alive = false;
 			++i;
 		}
 	}
 
+	// Pick this frame's canvas size before anything is drawn into it.
+	s_update_dynamic_resolution();
+
+	// Draw last frame's geometry if it was pipelined. This must come before any defrag, as it still refers
+	// to the old atlases.
+	cf_draw_pipeline_submit(app->offscreen_canvas);
+
 	// Update the spritebatch itself.
 	// This does atlas management internally.
 	// All references to backend texture id's are now invalid (fetch_image or canvas_get_backend_target_handle).
 	if (!draw->delay_defrag) {
-		spritebatch_tick(&draw->sb);
-		spritebatch_defrag(&draw->sb);
+		cf_draw_tick_and_defrag();
 	}
 
-	// Render any remaining geometry in the draw API.
-	cf_render_to(app->offscreen_canvas, clear);
+	// Render any remaining geometry in the draw API. When pipelined it's batched now, expanded into vertices
+	// on a worker while the next frame runs, and drawn at the top of the next call. A delayed defrag would
+	// invalidate the batches before then, so those frames are drawn right away instead.
+	if (app->pipelined_rendering && !draw->delay_defrag) {
+		cf_draw_pipeline_record(clear);
+	} else {
+		cf_render_to(app->offscreen_canvas, clear);
+	}
+
+	// Debug lines go on top of everything, in one draw call.
+	cf_debug_draw_flush(app->offscreen_canvas);
 
 	// Stretch the app canvas onto the backbuffer canvas.
 	cf_apply_canvas(app->backbuffer_canvas, true);
 	{
 		cf_apply_mesh(app->backbuffer_quad);
 		cf_apply_shader(app->backbuffer_shader, app->backbuffer_material);
-		v2 u_texture_size = V2((float)app->w, (float)app->h);
+		// Sampled with `smooth_uv`, which also upscales smaller dynamic resolution canvases cleanly.
+		v2 u_texture_size = V2((float)app->canvas_w, (float)app->canvas_h) * app->dynamic_resolution.scale;
 		cf_material_set_uniform_fs(app->backbuffer_material, "fs_params", "u_texture_size", &u_texture_size, CF_UNIFORM_TYPE_FLOAT2, 1);
 		cf_draw_elements();
 	}
@@ -569,46 +801,23 @@ int cf_app_draw_onto_screen(bool clear)
 	// before doing final rendering to reduce draw call count, but in the case where ImGui is rendered it's acceptable
 	// to have the perf-hit and delay until next frame.
 	if (draw->delay_defrag) {
-		spritebatch_tick(&draw->sb);
-		spritebatch_defrag(&draw->sb);
+		cf_draw_tick_and_defrag();
 		draw->delay_defrag = false;
 	}
 
+	cf_draw_end_frame();
+
 	// Flip to screen.
+	cf_time_present_begin();
 	cf_commit();
 	cf_dx11_present(app->vsync);
 	cf_metal_present(app->vsync);
 	if (app->use_gl) {
 		SDL_GL_SwapWindow(app->window);
 	}
+	cf_time_present_end();
 
-	// Clear all pushed draw parameters.
-	draw->colors.set_count(1);
-	draw->tints.set_count(1);
-	draw->antialias.set_count(1);
-	draw->antialias_scale.set_count(1);
-	draw->render_states.set_count(1);
-	draw->scissors.set_count(1);
-	draw->viewports.set_count(1);
-	draw->layers.set_count(1);
-	draw->layers.set_count(1);
-	draw->reset_cam();
-	draw->font_sizes.set_count(1);
-	draw->fonts.set_count(1);
-	draw->blurs.set_count(1);
-	draw->text_wrap_widths.set_count(1);
-	draw->text_clip_boxes.set_count(1);
-	draw->vertical.set_count(1);
-	draw->user_params.set_count(1);
-	draw->shaders.set_count(1);
-	material_clear_textures(draw->material);
-	material_clear_uniforms(draw->material);
-
-	// Report the number of draw calls.
-	// This is always user draw call count +1.
-	int draw_call_count = app->draw_call_count;
-	app->draw_call_count = 0;
-	return draw_call_count;
+	return s_end_frame();
 }
 
 void cf_app_get_size(int* w, int* h)
@@ -761,6 +970,32 @@ int cf_app_get_canvas_height()
 	return app->canvas_h;
 }
 
+void cf_app_set_dynamic_resolution(const CF_DynamicResolution* params)
+{
+	CF_DynamicResolutionState* dr = &app->dynamic_resolution;
+	bool enable = params && cf_gpu_timing_supported();
+	if (enable) {
+		dr->params = *params;
+		dr->params.min_scale = cf_clamp(dr->params.min_scale, 0.1f, 1.0f);
+		dr->params.max_scale = cf_clamp(dr->params.max_scale, dr->params.min_scale, 1.0f);
+		dr->params.levels = max(dr->params.levels, 2);
+		cf_gpu_timing_enable(true);
+	}
+	dr->enabled = enable;
+	dr->smoothed_milliseconds = 0;
+	dr->settle = 0;
+	s_destroy_resolution_canvases();
+	if (app->gfx_enabled) {
+		unapply_canvas();
+		s_apply_resolution_level(enable ? dr->params.levels - 1 : 0);
+	}
+}
+
+float cf_app_get_resolution_scale()
+{
+	return app->dynamic_resolution.scale;
+}
+
 void cf_app_set_vsync(bool true_turn_on_vsync)
 {
 	app->vsync = true_turn_on_vsync;
@@ -771,6 +1006,16 @@ bool cf_app_get_vsync()
 	return app->vsync;
 }
 
+void cf_app_set_pipelined_rendering(bool true_to_pipeline)
+{
+	app->pipelined_rendering = true_to_pipeline;
+}
+
+bool cf_app_get_pipelined_rendering()
+{
+	return app->pipelined_rendering;
+}
+
 void cf_app_set_windowed_mode()
 {
 	SDL_SetWindowFullscreen(app->window, 0);
@@ -795,7 +1040,7 @@ void cf_app_set_icon(const char* virtual_path_to_png)
 {
 	CF_Image img;
 	if (is_error(cf_image_load_png(virtual_path_to_png, &img))) {
-		fprintf(stderr, "Unable to open icon png file %s.", virtual_path_to_png);
+		cf_log(CF_LOG_LEVEL_ERROR, "Unable to open icon png file %s.", virtual_path_to_png);
 		return;
 	}
 	SDL_Surface* icon = SDL_CreateRGBSurfaceFrom(img.pix, img.w, img.h, 32, img.w * 4, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
@@ -804,9 +1049,37 @@ void cf_app_set_icon(const char* virtual_path_to_png)
 	cf_image_free(&img);
 }
 
+CF_Result cf_app_init_audio()
+{
+	if (!app->audio_lazy) return cf_result_success();
+	uint64_t ticks = cf_get_ticks();
+	cs_error_t err = app->audio_headless ? cs_init_headless(44100, cf_audio_buffer_size(), NULL) : cs_init(NULL, 44100, cf_audio_buffer_size(), NULL);
+	if (err != CUTE_SOUND_ERROR_NONE) {
+		CF_Result result;
+		result.code = -1;
+		result.details = cs_error_as_string(err);
+		return result;
+	}
+	app->audio_lazy = false;
+	cs_mix_thread_sleep_delay(cf_audio_mix_thread_sleep());
+#if !defined(CF_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+	// Without a device nothing needs mixing in the background, `cf_audio_render` mixes on the spot.
+	// Web builds without threads mix on the main thread instead.
+	if (!app->audio_headless) {
+		cs_spawn_mix_thread();
+		app->spawned_mix_thread = true;
+	}
+#endif // CF_EMSCRIPTEN
+	app->audio_needs_updates = true;
+	//cs_cull_duplicates(true); -- https://github.com/RandyGaul/cute_framework/issues/172
+	app->startup_timings.audio_milliseconds = s_startup_lap(&ticks);
+	return cf_result_success();
+}
+
 ImGuiContext* cf_app_init_imgui(bool no_default_font)
 {
-	if (!app->gfx_enabled) return NULL;
+	if (!app->gfx_enabled || !app->window) return NULL;
+	uint64_t ticks = cf_get_ticks();
 
 	IMGUI_CHECKVERSION();
 	ImGui::CreateContext();
@@ -823,6 +1096,7 @@ ImGuiContext* cf_app_init_imgui(bool no_default_font)
 		case SG_BACKEND_METAL_MACOS: ImGui_ImplSDL2_InitForMetal(app->window); break;
 		case SG_BACKEND_METAL_SIMULATOR: ImGui_ImplSDL2_InitForMetal(app->window); break;
 		case SG_BACKEND_WGPU: ImGui_ImplSDL2_InitForOpenGL(app->window, NULL); break;
+		case SG_BACKEND_DUMMY: break;
 	}
 	
 	simgui_desc_t imgui_params = { 0 };
@@ -831,6 +1105,7 @@ ImGuiContext* cf_app_init_imgui(bool no_default_font)
 	simgui_setup(imgui_params);
 	sg_imgui_desc_t sg_imgui_desc = { };
 	sg_imgui_init(&app->sg_imgui, &sg_imgui_desc);
+	app->startup_timings.imgui_milliseconds = s_startup_lap(&ticks);
 
 	return ::ImGui::GetCurrentContext();
 }
@@ -841,6 +1116,35 @@ sg_imgui_t* cf_app_get_sokol_imgui()
 	return &app->sg_imgui;
 }
 
+CF_FrameStats cf_app_get_frame_stats()
+{
+	return app->frame_stats;
+}
+
+CF_StartupTimings cf_app_get_startup_timings()
+{
+	return app->startup_timings;
+}
+
+void cf_app_frame_stats_imgui_window()
+{
+	if (!app->using_imgui) return;
+	const CF_FrameStats& stats = app->frame_stats;
+
+	ImGui::Begin("Frame Stats");
+	ImGui::Text("Draw calls: %d", stats.draw_calls);
+	ImGui::Text("Vertices uploaded: %d", stats.vertices_uploaded);
+	ImGui::Text("Batches: %d", stats.batches);
+	ImGui::Text("Atlases: %d (defrag %.3f ms)", stats.atlas_count, stats.defrag_milliseconds);
+	ImGui::Text("Glyphs rasterized: %d", stats.glyphs_rasterized);
+	ImGui::Text("Entities iterated: %d", stats.entities_iterated);
+	ImGui::Text("Allocations: %d (%.1f KB)", stats.alloc_count, (double)stats.alloc_bytes / 1024.0);
+	ImGui::Text("Audio voices: %d", stats.audio_voices);
+	ImGui::Text("Net: %llu bytes in, %llu bytes out", (unsigned long long)stats.net_bytes_received, (unsigned long long)stats.net_bytes_sent);
+	ImGui::Text("HTTPS requests: %d", stats.https_requests);
+	ImGui::End();
+}
+
 CF_PowerInfo cf_app_power_info()
 {
 	CF_PowerInfo info;
@@ -83,8 +83,10 @@ void* cf_arev(const void* a_ptr, size_t element_size)
 		CF_MEMCPY(t, a, element_size);
 		CF_MEMCPY(a, b, element_size);
 		CF_MEMCPY(b, t, element_size);
-		a = (void*)((uintptr_t)a + (element_size * ia++));
-		b = (void*)((uintptr_t)b + (element_size * ib++));
+		a = (void*)((uintptr_t)a + element_size);
+		b = (void*)((uintptr_t)b - element_size);
+		ia++;
+		ib--;
 	}
 
 	CF_FREE(t);
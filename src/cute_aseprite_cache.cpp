@@ -9,6 +9,8 @@
 #include <cute_debug_printf.h>
 #include <cute_file_system.h>
 #include <cute_defer.h>
+#include <cute_image.h>
+#include <cute_multithreading.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
@@ -24,26 +26,365 @@ struct CF_AsepriteCacheEntry
 	ase_t* ase = NULL;
 	htbl Animation** animations = NULL;
 	CF_V2 local_offset = V2(0, 0);
+	uint64_t first_id = 0;
+	// A copy of the file for sprites loaded from memory, to decode again if their pixels get dropped.
+	bool from_memory = false;
+	void* data = NULL;
+	int size = 0;
 };
 
 struct CF_AsepriteCache
 {
 	Map<const char*, CF_AsepriteCacheEntry> aseprites;
 	Map<uint64_t, void*> id_to_pixels;
+	Map<uint64_t, const char*> id_to_path;
 	uint64_t id_gen = CF_ASEPRITE_ID_RANGE_LO;
 };
 
 CF_GLOBAL static CF_AsepriteCache* cache;
+CF_GLOBAL static char* s_cook_directory;
+CF_GLOBAL static bool s_parallel_decoding;
+
+//--------------------------------------------------------------------------------------------------
+// Cooked sprites.
+// Parsing an .ase decompresses and blends every cel of every layer, which is slow for big layered
+// files. Cooked files hold the flattened, premultiplied frames instead, named after a hash of the
+// source file so edited files never match a stale cooked file.
+
+#define CF_COOKED_ASE_MAGIC   0x50534643 // "CFSP"
+#define CF_COOKED_ASE_VERSION 1
+
+struct CF_CookedAseHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t source_hash;
+	uint64_t source_size;
+	int32_t w, h;
+	int32_t frame_count;
+	int32_t tag_count;
+	// The slice named "origin", the only slice sprites use.
+	int32_t has_origin;
+	int32_t origin_x, origin_y, origin_w, origin_h;
+};
+
+struct CF_CookedAseTag
+{
+	int32_t from_frame;
+	int32_t to_frame;
+	int32_t direction;
+	int32_t name_len;
+};
+
+static void s_premultiply(ase_t* ase)
+{
+	for (int i = 0; i < ase->frame_count; ++i) {
+		cf_pixels_premultiply((CF_Pixel*)ase->frames[i].pixels, ase->w * ase->h);
+	}
+}
+
+static char* s_cooked_path(uint64_t hash)
+{
+	char* path = NULL;
+	sset(path, s_cook_directory);
+	if (slast(path) != '/') sappend(path, "/");
+	sfmt_append(path, "%016llx.cfsprite", (unsigned long long)hash);
+	return path;
+}
+
+static char* s_dup_name(const char* name, int len)
+{
+	char* result = (char*)CUTE_ASEPRITE_ALLOC(len + 1, NULL);
+	CF_MEMCPY(result, name, len);
+	result[len] = 0;
+	return result;
+}
+
+// Returns an ase holding just the frames, tags and origin slice of a cooked file, or `NULL` if it's missing or stale.
+static ase_t* s_read_cooked(const char* cooked_path, uint64_t hash, int size)
+{
+	size_t file_size = 0;
+	uint8_t* file = (uint8_t*)cf_fs_read_entire_file_to_memory(cooked_path, &file_size);
+	if (!file) return NULL;
+	CF_DEFER(CF_FREE(file));
+	uint8_t* p = file;
+	uint8_t* end = file + file_size;
+
+	CF_CookedAseHeader header;
+	if (file_size < sizeof(header)) return NULL;
+	CF_MEMCPY(&header, p, sizeof(header));
+	p += sizeof(header);
+	if (header.magic != CF_COOKED_ASE_MAGIC || header.version != CF_COOKED_ASE_VERSION) return NULL;
+	if (header.source_hash != hash || header.source_size != (uint64_t)size) return NULL;
+	if (header.w <= 0 || header.h <= 0 || header.frame_count <= 0 || header.tag_count < 0 || header.tag_count > CUTE_ASEPRITE_MAX_TAGS) return NULL;
+	size_t frame_size = sizeof(int32_t) + sizeof(ase_color_t) * (size_t)header.w * header.h;
+
+	ase_t* ase = (ase_t*)CUTE_ASEPRITE_ALLOC(sizeof(ase_t), NULL);
+	CF_MEMSET(ase, 0, sizeof(ase_t));
+	ase->mode = ASE_MODE_RGBA;
+	ase->w = header.w;
+	ase->h = header.h;
+	ase->frames = (ase_frame_t*)CUTE_ASEPRITE_ALLOC(sizeof(ase_frame_t) * header.frame_count, NULL);
+	CF_MEMSET(ase->frames, 0, sizeof(ase_frame_t) * header.frame_count);
+	ase->frame_count = header.frame_count;
+
+	bool ok = true;
+	for (int i = 0; i < header.tag_count && ok; ++i) {
+		CF_CookedAseTag tag;
+		if ((size_t)(end - p) < sizeof(tag)) { ok = false; break; }
+		CF_MEMCPY(&tag, p, sizeof(tag));
+		p += sizeof(tag);
+		if (tag.name_len < 0 || end - p < tag.name_len) { ok = false; break; }
+		ase_tag_t* out = ase->tags + ase->tag_count++;
+		out->from_frame = tag.from_frame;
+		out->to_frame = tag.to_frame;
+		out->loop_animation_direction = (ase_animation_direction_t)tag.direction;
+		out->name = s_dup_name((const char*)p, tag.name_len);
+		p += tag.name_len;
+		ok = tag.from_frame >= 0 && tag.from_frame <= tag.to_frame && tag.to_frame < header.frame_count;
+	}
+	for (int i = 0; i < header.frame_count && ok; ++i) {
+		if ((size_t)(end - p) < frame_size) { ok = false; break; }
+		ase_frame_t* frame = ase->frames + i;
+		int32_t duration;
+		CF_MEMCPY(&duration, p, sizeof(duration));
+		frame->ase = ase;
+		frame->duration_milliseconds = duration;
+		frame->pixels = (ase_color_t*)CUTE_ASEPRITE_ALLOC(frame_size - sizeof(duration), NULL);
+		CF_MEMCPY(frame->pixels, p + sizeof(duration), frame_size - sizeof(duration));
+		p += frame_size;
+	}
+	if (!ok) {
+		cute_aseprite_free(ase);
+		return NULL;
+	}
+
+	if (header.has_origin) {
+		ase_slice_t* slice = ase->slices + ase->slice_count++;
+		slice->name = s_dup_name("origin", 6);
+		slice->origin_x = header.origin_x;
+		slice->origin_y = header.origin_y;
+		slice->w = header.origin_w;
+		slice->h = header.origin_h;
+	}
+	return ase;
+}
+
+static void s_write_cooked(const char* cooked_path, uint64_t hash, int size, const ase_t* ase)
+{
+	CF_CookedAseHeader header = { };
+	header.magic = CF_COOKED_ASE_MAGIC;
+	header.version = CF_COOKED_ASE_VERSION;
+	header.source_hash = hash;
+	header.source_size = (uint64_t)size;
+	header.w = ase->w;
+	header.h = ase->h;
+	header.frame_count = ase->frame_count;
+	header.tag_count = ase->tag_count;
+	for (int i = 0; i < ase->slice_count; ++i) {
+		const ase_slice_t* slice = ase->slices + i;
+		if (CF_STRCMP(slice->name, "origin")) continue;
+		header.has_origin = 1;
+		header.origin_x = slice->origin_x;
+		header.origin_y = slice->origin_y;
+		header.origin_w = slice->w;
+		header.origin_h = slice->h;
+		break;
+	}
+
+	Array<uint8_t> out;
+	size_t pixels_size = sizeof(ase_color_t) * (size_t)ase->w * ase->h;
+	out.ensure_capacity((int)(sizeof(header) + ase->frame_count * (sizeof(int32_t) + pixels_size)));
+	auto write = [&](const void* data, size_t bytes) {
+		int at = out.count();
+		out.ensure_count(at + (int)bytes);
+		CF_MEMCPY(out.data() + at, data, bytes);
+	};
+	write(&header, sizeof(header));
+	for (int i = 0; i < ase->tag_count; ++i) {
+		const ase_tag_t* tag = ase->tags + i;
+		CF_CookedAseTag cooked;
+		cooked.from_frame = tag->from_frame;
+		cooked.to_frame = tag->to_frame;
+		cooked.direction = (int32_t)tag->loop_animation_direction;
+		cooked.name_len = (int32_t)CF_STRLEN(tag->name);
+		write(&cooked, sizeof(cooked));
+		write(tag->name, cooked.name_len);
+	}
+	for (int i = 0; i < ase->frame_count; ++i) {
+		int32_t duration = ase->frames[i].duration_milliseconds;
+		write(&duration, sizeof(duration));
+		write(ase->frames[i].pixels, pixels_size);
+	}
+
+	// Without a write directory there's nowhere to cook to, which is fine for shipped games with their cooked files mounted.
+	cf_fs_write_entire_buffer_to_file(cooked_path, out.data(), (size_t)out.count());
+}
+
+struct CF_AseRange
+{
+	cute_aseprite_range_fn* fn;
+	void* udata;
+};
+
+static void CF_CALL s_ase_range(int begin, int end, void* udata)
+{
+	CF_AseRange* range = (CF_AseRange*)udata;
+	range->fn(begin, end, range->udata);
+}
+
+// Runs the cel inflates and frame blends of `cute_aseprite_load_from_memory_ex` on the threadpool.
+static void s_ase_parallel_for(int count, cute_aseprite_range_fn* fn, void* udata, void* parallel_udata)
+{
+	CF_AseRange range = { fn, udata };
+	cf_parallel_for((CF_Threadpool*)parallel_udata, count, 1, s_ase_range, &range);
+}
+
+// Returns the premultiplied ase for an .ase file's contents, from its cooked file if there is one.
+static ase_t* s_load_ase(const void* data, int size)
+{
+	char* cooked_path = NULL;
+	uint64_t hash = 0;
+	if (s_cook_directory) {
+		hash = cf_fnv1a(data, size);
+		cooked_path = s_cooked_path(hash);
+		ase_t* ase = s_read_cooked(cooked_path, hash, size);
+		if (ase) {
+			sfree(cooked_path);
+			return ase;
+		}
+	}
+	ase_t* ase = NULL;
+	if (s_parallel_decoding && app && app->threadpool) {
+		ase = cute_aseprite_load_from_memory_ex(data, size, NULL, s_ase_parallel_for, app->threadpool);
+	} else {
+		ase = cute_aseprite_load_from_memory(data, size, NULL);
+	}
+	if (ase) {
+		s_premultiply(ase);
+		if (cooked_path) s_write_cooked(cooked_path, hash, size, ase);
+	}
+	sfree(cooked_path);
+	return ase;
+}
+
+void cf_aseprite_cache_set_cook_directory(const char* virtual_directory)
+{
+	if (virtual_directory) sset(s_cook_directory, virtual_directory);
+	else sfree(s_cook_directory);
+}
+
+void cf_aseprite_cache_set_parallel_decoding(bool true_to_parallelize)
+{
+	s_parallel_decoding = true_to_parallelize;
+}
+
+// Decodes an ase again, putting back every frame's pixels dropped by `cf_aseprite_cache_drop_pixels`.
+static void s_redecode(CF_AsepriteCacheEntry* entry, Array<uint64_t>* restored)
+{
+	const void* data = entry->data;
+	int size = entry->size;
+	void* file = NULL;
+	if (!entry->from_memory) {
+		size_t sz = 0;
+		file = cf_fs_read_entire_file_to_memory(entry->path, &sz);
+		if (!file) return;
+		data = file;
+		size = (int)sz;
+	}
+	ase_t* ase = s_load_ase(data, size);
+	CF_FREE(file);
+	if (!ase) return;
+
+	// Skip files that changed on disk in the meantime.
+	if (ase->w == entry->ase->w && ase->h == entry->ase->h && ase->frame_count == entry->ase->frame_count) {
+		for (int i = 0; i < ase->frame_count; ++i) {
+			ase_frame_t* frame = entry->ase->frames + i;
+			if (frame->pixels) continue;
+			frame->pixels = ase->frames[i].pixels;
+			ase->frames[i].pixels = NULL;
+			uint64_t id = entry->first_id + i;
+			cache->id_to_pixels.get(id) = frame->pixels;
+			restored->add(id);
+		}
+	}
+	cute_aseprite_free(ase);
+}
 
 void cf_aseprite_cache_get_pixels(uint64_t image_id, void* buffer, int bytes_to_fill)
 {
 	auto pixels_ptr = cache->id_to_pixels.try_find(image_id);
-	if (!pixels_ptr) {
+	Array<uint64_t> restored;
+	if (pixels_ptr && !*pixels_ptr) {
+		s_redecode(cache->aseprites.try_find(cache->id_to_path.get(image_id)), &restored);
+	}
+	if (!pixels_ptr || !*pixels_ptr) {
 		CF_DEBUG_PRINTF("Aseprite cache -- unable to find id %lld.\n", (long long int)image_id);
 		CF_MEMSET(buffer, 0, bytes_to_fill);
 	} else {
 		void* pixels = *pixels_ptr;
 		CF_MEMCPY(buffer, pixels, bytes_to_fill);
+
+		// Every frame has the same size. Frames decoded alongside this one count as used too, so they can be dropped again.
+		for (int i = 0; i < restored.count(); ++i) {
+			if (restored[i] != image_id) cf_image_pixels_used(restored[i], (size_t)bytes_to_fill);
+		}
+		cf_image_pixels_used(image_id, (size_t)bytes_to_fill);
+	}
+}
+
+bool cf_aseprite_cache_drop_pixels(uint64_t image_id)
+{
+	auto pixels_ptr = cache->id_to_pixels.try_find(image_id);
+	if (!pixels_ptr || !*pixels_ptr) return false;
+	CF_AsepriteCacheEntry* entry = cache->aseprites.try_find(cache->id_to_path.get(image_id));
+	// Sprites loaded from memory without a copy of their file have nothing to decode again from.
+	if (entry->from_memory && !entry->data) return false;
+	ase_frame_t* frame = entry->ase->frames + (image_id - entry->first_id);
+	CUTE_ASEPRITE_FREE(frame->pixels, entry->ase->mem_ctx);
+	frame->pixels = NULL;
+	*pixels_ptr = NULL;
+	return true;
+}
+
+// Paths match with or without their leading slash.
+static bool s_same_path(const char* a, const char* b)
+{
+	if (*a == '/') ++a;
+	if (*b == '/') ++b;
+	return !CF_STRCMP(a, b);
+}
+
+void cf_aseprite_cache_file_changed(const char* virtual_path)
+{
+	if (!cache) return;
+	for (int i = 0; i < cache->aseprites.count(); ++i) {
+		CF_AsepriteCacheEntry* entry = cache->aseprites.items() + i;
+		if (entry->from_memory || !s_same_path(entry->path, virtual_path)) continue;
+
+		size_t sz = 0;
+		void* data = cf_fs_read_entire_file_to_memory(entry->path, &sz);
+		if (!data) continue;
+		ase_t* ase = s_load_ase(data, (int)sz);
+		CF_FREE(data);
+		if (!ase) continue;
+
+		// Frame ids and sprite sizes are handed out already, so only the pixels can change.
+		if (ase->w != entry->ase->w || ase->h != entry->ase->h || ase->frame_count != entry->ase->frame_count) {
+			CF_DEBUG_PRINTF("Aseprite cache -- can't reload \"%s\", its size or frame count changed.\n", entry->path);
+			cute_aseprite_free(ase);
+			continue;
+		}
+		for (int j = 0; j < ase->frame_count; ++j) {
+			ase_frame_t* frame = entry->ase->frames + j;
+			CUTE_ASEPRITE_FREE(frame->pixels, entry->ase->mem_ctx);
+			frame->pixels = ase->frames[j].pixels;
+			ase->frames[j].pixels = NULL;
+			uint64_t id = entry->first_id + j;
+			cache->id_to_pixels.get(id) = frame->pixels;
+			if (draw) spritebatch_invalidate(&draw->sb, id);
+		}
+		cute_aseprite_free(ase);
 	}
 }
 
@@ -66,9 +407,11 @@ void cf_destroy_aseprite_cache()
 
 		hfree(entry->animations);
 		cute_aseprite_free(entry->ase);
+		CF_FREE(entry->data);
 	}
 	cache->~CF_AsepriteCache();
 	CF_FREE(cache);
+	sfree(s_cook_directory);
 }
 
 static CF_PlayDirection s_play_direction(ase_animation_direction_t direction)
@@ -95,38 +438,31 @@ static void s_sprite(CF_AsepriteCacheEntry entry, CF_Sprite* sprite)
 	}
 }
 
-CF_Result cf_aseprite_cache_load_from_memory(const char* unique_name, const void* data, int sz, CF_Sprite* sprite_out)
+// Adds an already premultiplied ase to the cache. `data` is the file it came from when loaded from memory, otherwise `NULL`.
+static void s_cache_ase(const char* unique_name, ase_t* ase, const void* data, int size, CF_Sprite* sprite_out)
 {
-	ase_t* ase = cute_aseprite_load_from_memory(data, (int)sz, NULL);
-	if (!ase) return cf_result_error("Unable to open ase file at `aseprite_path`.");
-
 	// Allocate internal cache data structure entries.
+	CF_AsepriteCacheEntry entry;
 	Animation** animations = NULL;
 	Array<uint64_t> ids;
 	ids.ensure_capacity(ase->frame_count);
 
+	entry.first_id = cache->id_gen;
 	for (int i = 0; i < ase->frame_count; ++i) {
 		uint64_t id = cache->id_gen++;
 		ids.add(id);
+		cache->id_to_pixels.insert(id, ase->frames[i].pixels);
+		cache->id_to_path.insert(id, unique_name);
+	}
 
-		// Premultiply alpha.
-		ase_color_t* pix = ase->frames[i].pixels;
-		for (int i = 0; i < ase->h; ++i) {
-			for (int j = 0; j < ase->w; ++j) {
-				float a = pix[i * ase->w + j].a / 255.0f;
-				float r = pix[i * ase->w + j].r / 255.0f;
-				float g = pix[i * ase->w + j].g / 255.0f;
-				float b = pix[i * ase->w + j].b / 255.0f;
-				r *= a;
-				g *= a;
-				b *= a;
-				pix[i * ase->w + j].r = (uint8_t)(r * 255.0f);
-				pix[i * ase->w + j].g = (uint8_t)(g * 255.0f);
-				pix[i * ase->w + j].b = (uint8_t)(b * 255.0f);
-			}
+	// With a pixel budget keep the file around, to decode again if the pixels get dropped.
+	if (data) {
+		entry.from_memory = true;
+		if (app && app->pixel_budget) {
+			entry.data = CF_ALLOC(size);
+			entry.size = size;
+			CF_MEMCPY(entry.data, data, size);
 		}
-
-		cache->id_to_pixels.insert(id, ase->frames[i].pixels);
 	}
 
 	// Fill out the animation table from the aseprite file.
@@ -169,7 +505,6 @@ CF_Result cf_aseprite_cache_load_from_memory(const char* unique_name, const void
 
 	// Look for slice information to define the sprite's local offset.
 	// The slice named "origin"'s center is used to define the local offset.
-	CF_AsepriteCacheEntry entry;
 	for (int i = 0; i < ase->slice_count; ++i) {
 		ase_slice_t* slice = ase->slices + i;
 		if (!CF_STRCMP(slice->name, "origin")) {
@@ -193,9 +528,21 @@ CF_Result cf_aseprite_cache_load_from_memory(const char* unique_name, const void
 	cache->aseprites.insert(unique_name, entry);
 
 	s_sprite(entry, sprite_out);
+}
+
+static CF_Result s_load_from_memory(const char* unique_name, const void* data, int sz, bool from_file, CF_Sprite* sprite_out)
+{
+	ase_t* ase = s_load_ase(data, sz);
+	if (!ase) return cf_result_error("Unable to open ase file at `aseprite_path`.");
+	s_cache_ase(unique_name, ase, from_file ? NULL : data, sz, sprite_out);
 	return cf_result_success();
 }
 
+CF_Result cf_aseprite_cache_load_from_memory(const char* unique_name, const void* data, int sz, CF_Sprite* sprite_out)
+{
+	return s_load_from_memory(unique_name, data, sz, false, sprite_out);
+}
+
 CF_Result cf_aseprite_cache_load(const char* aseprite_path, CF_Sprite* sprite)
 {
 	// First see if this ase was already cached.
@@ -212,7 +559,81 @@ CF_Result cf_aseprite_cache_load(const char* aseprite_path, CF_Sprite* sprite)
 	if (!data) return cf_result_error("Unable to open ase file at `aseprite_path`.");
 	CF_DEFER(CF_FREE(data));
 
-	return cf_aseprite_cache_load_from_memory(aseprite_path, data, (int)sz, sprite);
+	return s_load_from_memory(aseprite_path, data, (int)sz, true, sprite);
+}
+
+CF_Result cf_aseprite_cache_load_from_file_data(const char* aseprite_path, const void* data, int sz, CF_Sprite* sprite)
+{
+	// Unlike `cf_aseprite_cache_load_from_memory` the sprite remembers its file, to decode again or hot-reload from.
+	aseprite_path = sintern(aseprite_path);
+	auto entry_ptr = cache->aseprites.try_find(aseprite_path);
+	if (entry_ptr) {
+		s_sprite(*entry_ptr, sprite);
+		return cf_result_success();
+	}
+	return s_load_from_memory(aseprite_path, data, sz, true, sprite);
+}
+
+struct CF_AsepriteLoad
+{
+	const char* path;
+	ase_t* ase;
+};
+
+static void s_aseprite_load_task(void* udata)
+{
+	CF_AsepriteLoad* load = (CF_AsepriteLoad*)udata;
+	size_t sz = 0;
+	void* data = cf_fs_read_entire_file_to_memory(load->path, &sz);
+	if (!data) return;
+	load->ase = s_load_ase(data, (int)sz);
+	CF_FREE(data);
+}
+
+CF_Result cf_aseprite_cache_load_batch(const char** aseprite_paths, int count, CF_Sprite* sprites_out)
+{
+	// Only load each path not already in the cache once.
+	Array<CF_AsepriteLoad> loads;
+	Map<const char*, int> queued;
+	for (int i = 0; i < count; ++i) {
+		const char* path = sintern(aseprite_paths[i]);
+		if (cache->aseprites.has(path) || queued.has(path)) continue;
+		queued.insert(path, loads.count());
+		CF_AsepriteLoad load;
+		load.path = path;
+		load.ase = NULL;
+		loads.add(load);
+	}
+
+	// Read, decode and premultiply each file on the threadpool.
+	CF_Threadpool* pool = app ? app->threadpool : NULL;
+	if (pool && loads.count() > 1) {
+		CF_AtomicInt counter = { 0 };
+		for (int i = 0; i < loads.count(); ++i) {
+			cf_threadpool_add_dependent_task(pool, s_aseprite_load_task, loads + i, NULL, 0, &counter);
+		}
+		cf_threadpool_kick(pool);
+		cf_threadpool_wait_counter(pool, &counter);
+	} else {
+		for (int i = 0; i < loads.count(); ++i) {
+			s_aseprite_load_task(loads + i);
+		}
+	}
+
+	// Then add all of them to the cache at once.
+	CF_Result result = cf_result_success();
+	for (int i = 0; i < loads.count(); ++i) {
+		CF_Sprite sprite = cf_sprite_defaults();
+		if (loads[i].ase) s_cache_ase(loads[i].path, loads[i].ase, NULL, 0, &sprite);
+		else if (!cf_is_error(result)) result = cf_result_error("Unable to open ase file in `aseprite_paths`.");
+	}
+	for (int i = 0; i < count; ++i) {
+		CF_Sprite sprite = cf_sprite_defaults();
+		auto entry_ptr = cache->aseprites.try_find(sintern(aseprite_paths[i]));
+		if (entry_ptr) s_sprite(*entry_ptr, &sprite);
+		if (sprites_out) sprites_out[i] = sprite;
+	}
+	return result;
 }
 
 void cf_aseprite_cache_unload(const char* aseprite_path)
@@ -222,20 +643,22 @@ void cf_aseprite_cache_unload(const char* aseprite_path)
 	if (!entry_ptr) return;
 
 	CF_AsepriteCacheEntry entry = *entry_ptr;
+	for (int i = 0; i < entry.ase->frame_count; ++i) {
+		uint64_t id = entry.first_id + i;
+		cache->id_to_pixels.remove(id);
+		cache->id_to_path.remove(id);
+		cf_image_pixels_forget(id);
+		if (draw) spritebatch_invalidate(&draw->sb, id);
+	}
 	for (int i = 0; i < hcount(entry.animations); ++i) {
 		CF_Animation* animation = entry.animations[i];
-		for (int j = 0; j < alen(animation->frames); ++j) {
-			uint64_t id = animation->frames[j].id;
-			cache->id_to_pixels.remove(id);
-			spritebatch_invalidate(&draw->sb, id);
-		}
-
 		afree(animation->frames);
 		CF_FREE(animation);
 	}
 
 	hfree(entry.animations);
 	cute_aseprite_free(entry.ase);
+	CF_FREE(entry.data);
 	cache->aseprites.remove(aseprite_path);
 }
 
@@ -9,13 +9,18 @@
 #include <cute_file_system.h>
 #include <cute_alloc.h>
 
+#include <cute_multithreading.h>
+#include <cute_string.h>
+
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
+#include <internal/cute_audio_internal.h>
 
 #define STB_VORBIS_HEADER_ONLY
 #include <stb/stb_vorbis.c>
 
-#ifdef CF_EMSCRIPTEN
+// Built with CF_FRAMEWORK_EMSCRIPTEN_SIMD the SSE mixer runs on wasm SIMD128.
+#if defined(CF_EMSCRIPTEN) && !defined(__SSE2__)
 #	ifndef CUTE_SOUND_SCALAR_MODE
 #		define CUTE_SOUND_SCALAR_MODE
 #	endif // CUTE_SOUND_SCALAR_MODE
@@ -23,11 +28,14 @@
 
 #define CUTE_SOUND_IMPLEMENTATION
 #define CUTE_SOUND_FORCE_SDL
+#define CUTE_SOUND_BUS_COUNT CF_AUDIO_BUS_COUNT
 #define CUTE_SOUND_ASSERT CF_ASSERT
+#define CUTE_SOUND_MINIMUM_BUFFERED_SAMPLES 128
 #include <cute/cute_sound.h>
 
 CF_Audio cf_audio_load_ogg(const char* path)
 {
+	CF_ALLOC_TAG_SCOPE("audio");
 	size_t size;
 	void* data = cf_fs_read_entire_file_to_memory(path, &size);
 	if (data) {
@@ -40,6 +48,7 @@ CF_Audio cf_audio_load_ogg(const char* path)
 
 CF_Audio cf_audio_load_wav(const char* path)
 {
+	CF_ALLOC_TAG_SCOPE("audio");
 	size_t size;
 	void* data = cf_fs_read_entire_file_to_memory(path, &size);
 	if (data) {
@@ -64,8 +73,137 @@ CF_Audio cf_audio_load_wav_from_memory(void* memory, int byte_count)
 	return result;
 }
 
+CF_Audio cf_audio_stream_ogg(const char* path)
+{
+	CF_ALLOC_TAG_SCOPE("audio");
+	size_t size;
+	void* data = cf_fs_read_entire_file_to_memory(path, &size);
+	if (data) {
+		CF_Audio src = cf_audio_stream_ogg_from_memory(data, (int)size);
+		CF_FREE(data);
+		return src;
+	}
+	return { 0 };
+}
+
+CF_Audio cf_audio_stream_ogg_from_memory(void* memory, int byte_count)
+{
+	cs_audio_source_t* src = cs_read_mem_ogg_stream(memory, (size_t)byte_count, NULL);
+	CF_Audio result = { (uint64_t)src };
+	return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+
+enum CF_AudioLoadType
+{
+	CF_AUDIO_LOAD_TYPE_OGG,
+	CF_AUDIO_LOAD_TYPE_WAV,
+};
+
+struct CF_AudioLoad
+{
+	CF_AudioLoadType type;
+	const char* path;
+	cs_audio_source_t* loaded;
+	CF_AtomicInt counter;
+};
+
+static void s_audio_load_job(void* udata)
+{
+	CF_AudioLoad* load = (CF_AudioLoad*)udata;
+	size_t size;
+	void* data = cf_fs_read_entire_file_to_memory(load->path, &size);
+	if (!data) return;
+	if (load->type == CF_AUDIO_LOAD_TYPE_OGG) {
+		load->loaded = cs_read_mem_ogg(data, size, NULL);
+	} else {
+		load->loaded = cs_read_mem_wav(data, size, NULL);
+	}
+	CF_FREE(data);
+}
+
+// Hands a finished background load over to the placeholder returned to the user. With `wait` set
+// blocks until the load completes. Returns false if the load is still running.
+static bool s_sync_audio_load(uint64_t id, bool wait)
+{
+	if (!app->audio_loads.count()) return true;
+	CF_AudioLoad** load_ptr = app->audio_loads.try_get(id);
+	if (!load_ptr) return true;
+	CF_AudioLoad* load = *load_ptr;
+	if (wait) {
+		cf_threadpool_wait_counter(app->threadpool, &load->counter);
+	} else if (cf_atomic_get(&load->counter)) {
+		return false;
+	}
+	if (load->loaded) {
+		*(cs_audio_source_t*)id = *load->loaded;
+		CUTE_SOUND_FREE(load->loaded, s_mem_ctx);
+	}
+	app->audio_loads.remove(id);
+	CF_FREE(load);
+	return true;
+}
+
+static CF_Audio s_load_async(const char* path, CF_AudioLoadType type)
+{
+	if (!app->threadpool) {
+		return type == CF_AUDIO_LOAD_TYPE_OGG ? cf_audio_load_ogg(path) : cf_audio_load_wav(path);
+	}
+
+	CF_ALLOC_TAG_SCOPE("audio");
+	// The placeholder has no samples, so it stays silent until the load completes.
+	cs_audio_source_t* audio = (cs_audio_source_t*)CUTE_SOUND_ALLOC(sizeof(cs_audio_source_t), s_mem_ctx);
+	CUTE_SOUND_MEMSET(audio, 0, sizeof(*audio));
+	CF_AudioLoad* load = (CF_AudioLoad*)CF_ALLOC(sizeof(CF_AudioLoad));
+	load->type = type;
+	load->path = sintern(path);
+	load->loaded = NULL;
+	load->counter = cf_atomic_zero();
+	app->audio_loads.insert((uint64_t)audio, load);
+	cf_threadpool_add_dependent_task(app->threadpool, s_audio_load_job, load, NULL, 0, &load->counter);
+	cf_threadpool_kick(app->threadpool);
+	CF_Audio result = { (uint64_t)audio };
+	return result;
+}
+
+CF_Audio cf_audio_load_ogg_async(const char* path)
+{
+	return s_load_async(path, CF_AUDIO_LOAD_TYPE_OGG);
+}
+
+CF_Audio cf_audio_load_wav_async(const char* path)
+{
+	return s_load_async(path, CF_AUDIO_LOAD_TYPE_WAV);
+}
+
+bool cf_audio_is_ready(CF_Audio audio)
+{
+	return s_sync_audio_load(audio.id, false);
+}
+
+void cf_audio_finish_loads()
+{
+	while (app->audio_loads.count()) {
+		s_sync_audio_load(app->audio_loads.keys()[0], true);
+	}
+}
+
+// Starts the mixer on first use, see `APP_OPTIONS_LAZY_AUDIO`.
+static inline void s_start_mixer()
+{
+	if (app->audio_lazy) cf_app_init_audio();
+}
+
+// Async loads that haven't completed, or that failed, have no samples to play.
+static bool s_is_playable(CF_Audio audio)
+{
+	return s_sync_audio_load(audio.id, false) && ((cs_audio_source_t*)audio.id)->sample_count > 0;
+}
+
 void cf_audio_destroy(CF_Audio audio)
 {
+	s_sync_audio_load(audio.id, true);
 	cs_free_audio_source((cs_audio_source_t*)audio.id);
 }
 
@@ -73,21 +211,25 @@ void cf_audio_destroy(CF_Audio audio)
 
 void cf_audio_set_pan(float pan)
 {
+	s_start_mixer();
 	cs_set_global_pan(pan);
 }
 
 void cf_audio_set_global_volume(float volume)
 {
+	s_start_mixer();
 	cs_set_global_volume(volume);
 }
 
 void cf_audio_set_sound_volume(float volume)
 {
+	s_start_mixer();
 	cs_set_playing_sounds_volume(volume);
 }
 
 void cf_audio_set_pause(bool true_for_paused)
 {
+	s_start_mixer();
 	cs_set_global_pause(true_for_paused);
 }
 
@@ -106,63 +248,115 @@ static inline CF_Result s_result(cs_error_t err)
 
 void cf_music_play(CF_Audio audio_source, float fade_in_time)
 {
+	s_start_mixer();
+	if (!s_is_playable(audio_source)) return;
 	cs_music_play((cs_audio_source_t*)audio_source.id, fade_in_time);
 }
 
 void cf_music_stop(float fade_out_time)
 {
+	s_start_mixer();
 	cs_music_stop(fade_out_time);
 }
 
 void cf_music_set_volume(float volume)
 {
+	s_start_mixer();
 	cs_music_set_volume(volume);
 }
 
 void cf_music_set_loop(bool true_to_loop)
 {
+	s_start_mixer();
 	cs_music_set_loop(true_to_loop);
 }
 
 void cf_music_pause()
 {
+	s_start_mixer();
 	cs_music_pause();
 }
 
 void cf_music_resume()
 {
+	s_start_mixer();
 	cs_music_resume();
 }
 
 void cf_music_switch_to(CF_Audio audio_source, float fade_out_time, float fade_in_time)
 {
+	s_start_mixer();
+	if (!s_is_playable(audio_source)) return;
 	return cs_music_switch_to((cs_audio_source_t*)audio_source.id, fade_out_time, fade_in_time);
 }
 
 void cf_music_crossfade(CF_Audio audio_source, float cross_fade_time)
 {
+	s_start_mixer();
+	if (!s_is_playable(audio_source)) return;
 	return cs_music_crossfade((cs_audio_source_t*)audio_source.id, cross_fade_time);
 }
 
 int cf_music_get_sample_index()
 {
+	s_start_mixer();
 	return cs_music_get_sample_index();
 }
 
 CF_Result cf_music_set_sample_index(int sample_index)
 {
+	s_start_mixer();
 	return s_result(cs_music_set_sample_index(sample_index));
 }
 
 void cf_music_set_pitch(float pitch)
 {
+	s_start_mixer();
 	cs_music_set_pitch(pitch);
 }
 
+void cf_music_set_bus(int bus)
+{
+	s_start_mixer();
+	cs_music_set_bus(bus);
+}
+
+// -------------------------------------------------------------------------------------------------
+
+void cf_audio_bus_set_volume(int bus, float volume)
+{
+	s_start_mixer();
+	cs_bus_set_volume(bus, volume);
+}
+
+float cf_audio_bus_get_volume(int bus)
+{
+	s_start_mixer();
+	return cs_bus_get_volume(bus);
+}
+
+void cf_audio_bus_set_low_pass(int bus, float cutoff_hz)
+{
+	s_start_mixer();
+	cs_bus_set_low_pass(bus, cutoff_hz);
+}
+
+void cf_audio_bus_set_ducking(int bus, int sidechain_bus, float amount, float release_seconds)
+{
+	s_start_mixer();
+	cs_bus_set_ducking(bus, sidechain_bus, amount, release_seconds);
+}
+
 // -------------------------------------------------------------------------------------------------
 
 CF_Sound cf_play_sound(CF_Audio audio_source, CF_SoundParams params)
 {
+	s_start_mixer();
+	CF_ALLOC_TAG_SCOPE("audio");
+	if (!s_is_playable(audio_source)) {
+		CF_Sound result = { 0 };
+		return result;
+	}
 	cs_sound_params_t csparams;
 	csparams.paused = params.paused;
 	csparams.looped = params.looped;
@@ -170,6 +364,11 @@ CF_Sound cf_play_sound(CF_Audio audio_source, CF_SoundParams params)
 	csparams.pan = params.pan;
 	csparams.pitch = params.pitch;
 	csparams.sample_index = params.sample_index;
+	csparams.priority = params.priority;
+	csparams.bus = params.bus;
+	csparams.spatial = params.spatial;
+	csparams.x = params.position.x;
+	csparams.y = params.position.y;
 	CF_Sound result;
 	cs_playing_sound_t csresult = cs_play_sound((cs_audio_source_t*)audio_source.id, csparams);
 	result.id = csresult.id;
@@ -178,132 +377,595 @@ CF_Sound cf_play_sound(CF_Audio audio_source, CF_SoundParams params)
 
 void s_on_finish(CF_Sound snd, void* udata)
 {
-	if (app->on_sound_finish_single_threaded) {
-		app->on_sound_finish_queue.add(snd);
-	} else {
-		app->on_sound_finish(snd, udata);
-	}
+	app->on_sound_finish(snd, udata);
 }
 
 void s_on_finish_music(void* udata)
 {
-	if (app->on_sound_finish_single_threaded) {
-		app->on_music_finish_signal = true;
-	} else {
-		app->on_music_finish(udata);
-	}
+	app->on_music_finish(udata);
 }
 
+// Single threaded callbacks are queued up by the mixer, and popped off in `s_on_update` from cute_app.cpp.
 void cf_sound_set_on_finish_callback(void (*on_finish)(CF_Sound, void*), void* udata, bool single_threaded)
 {
+	s_start_mixer();
 	app->on_sound_finish_single_threaded = single_threaded;
 	app->on_sound_finish = on_finish;
 	app->on_sound_finish_udata = udata;
+	cs_queue_finished_sounds(single_threaded);
 	cs_on_sound_finished_callback((void (*)(cs_playing_sound_t, void*))s_on_finish, udata);
 }
 
 void cf_music_set_on_finish_callback(void (*on_finish)(void*), void* udata, bool single_threaded)
 {
+	s_start_mixer();
 	app->on_sound_finish_single_threaded = single_threaded;
 	app->on_music_finish = on_finish;
 	app->on_music_finish_udata = udata;
+	cs_queue_finished_sounds(single_threaded);
 	cs_on_music_finished_callback((void (*)(void*))s_on_finish_music, udata);
 }
 
 bool cf_sound_is_active(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	return cs_sound_is_active(cssound);
 }
 
 bool cf_sound_get_is_paused(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	return cs_sound_get_is_paused(cssound);
 }
 
 bool cf_sound_get_is_looped(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	return cs_sound_get_is_looped(cssound);
 }
 
 float cf_sound_get_volume(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	return cs_sound_get_volume(cssound);
 }
 
 float cf_sound_get_pitch(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	return cs_sound_get_pitch(cssound);
 }
 
 int cf_sound_get_sample_index(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	return cs_sound_get_sample_index(cssound);
 }
 
 void cf_sound_set_is_paused(CF_Sound sound, bool true_for_paused)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	cs_sound_set_is_paused(cssound, true_for_paused);
 }
 
 void cf_sound_set_is_looped(CF_Sound sound, bool true_for_looped)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	cs_sound_set_is_looped(cssound, true_for_looped);
 }
 
 void cf_sound_set_volume(CF_Sound sound, float volume)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	cs_sound_set_volume(cssound, volume);
 }
 
 void cf_sound_set_sample_index(CF_Sound sound, int sample_index)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	cs_sound_set_sample_index(cssound, sample_index);
 }
 
 void cf_sound_stop(CF_Sound sound)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	cs_sound_stop(cssound);
 }
 
 void cf_sound_set_pitch(CF_Sound sound, float pitch)
 {
+	s_start_mixer();
 	cs_playing_sound_t cssound = { sound.id };
 	cs_sound_set_pitch(cssound, pitch);
 }
 
+float cf_sound_get_priority(CF_Sound sound)
+{
+	s_start_mixer();
+	cs_playing_sound_t cssound = { sound.id };
+	return cs_sound_get_priority(cssound);
+}
+
+void cf_sound_set_priority(CF_Sound sound, float priority)
+{
+	s_start_mixer();
+	cs_playing_sound_t cssound = { sound.id };
+	cs_sound_set_priority(cssound, priority);
+}
+
+bool cf_sound_is_virtual(CF_Sound sound)
+{
+	s_start_mixer();
+	cs_playing_sound_t cssound = { sound.id };
+	return cs_sound_is_virtual(cssound);
+}
+
+void cf_audio_set_listener(CF_V2 position)
+{
+	s_start_mixer();
+	cs_set_listener_position(position.x, position.y);
+}
+
+void cf_audio_set_attenuation(CF_AudioAttenuation model, float min_distance, float max_distance, float rolloff, float pan_distance)
+{
+	s_start_mixer();
+	cs_attenuation_params_t params;
+	switch (model) {
+	case CF_AUDIO_ATTENUATION_NONE: params.model = CUTE_SOUND_ATTENUATION_NONE; break;
+	case CF_AUDIO_ATTENUATION_LINEAR: params.model = CUTE_SOUND_ATTENUATION_LINEAR; break;
+	case CF_AUDIO_ATTENUATION_INVERSE: params.model = CUTE_SOUND_ATTENUATION_INVERSE; break;
+	case CF_AUDIO_ATTENUATION_EXPONENTIAL: params.model = CUTE_SOUND_ATTENUATION_EXPONENTIAL; break;
+	default: params.model = CUTE_SOUND_ATTENUATION_LINEAR; break;
+	}
+	params.min_distance = min_distance;
+	params.max_distance = max_distance;
+	params.rolloff = rolloff;
+	params.pan_distance = pan_distance;
+	cs_set_attenuation(params);
+}
+
+void cf_sound_set_position(CF_Sound sound, CF_V2 position)
+{
+	s_start_mixer();
+	cs_playing_sound_t cssound = { sound.id };
+	cs_sound_set_position(cssound, position.x, position.y);
+}
+
+void cf_sound_set_positions(const CF_Sound* sounds, const CF_V2* positions, int count)
+{
+	s_start_mixer();
+	static_assert(sizeof(CF_Sound) == sizeof(cs_playing_sound_t), "CF_Sound must match cs_playing_sound_t.");
+	static_assert(sizeof(CF_V2) == sizeof(float) * 2, "CF_V2 must be two packed floats.");
+	cs_sound_set_positions((const cs_playing_sound_t*)sounds, (const float*)positions, count);
+}
+
 void cf_audio_cull_duplicates(bool true_to_cull_duplicates)
 {
+	s_start_mixer();
 	cs_cull_duplicates(true_to_cull_duplicates);
 }
 
+void cf_audio_set_max_voices(int max_voices)
+{
+	s_start_mixer();
+	cs_set_max_voices(max_voices);
+}
+
+// Set before `cf_make_app` starts the mixer.
+static int s_buffer_size = 0;
+static int s_mix_thread_sleep = 0;
+
+void cf_audio_set_buffer_size(int sample_count)
+{
+	s_buffer_size = sample_count;
+}
+
+int cf_audio_buffer_size()
+{
+	if (s_buffer_size > 0) return s_buffer_size;
+#ifdef CF_EMSCRIPTEN
+	return 1024 * 4;
+#else
+	return 1024;
+#endif
+}
+
+void cf_audio_set_mix_thread_sleep(int milliseconds)
+{
+	s_mix_thread_sleep = milliseconds;
+	if (cs_get_context_ptr()) cs_mix_thread_sleep_delay(milliseconds);
+}
+
+int cf_audio_mix_thread_sleep()
+{
+	return s_mix_thread_sleep;
+}
+
+CF_AudioStats cf_audio_get_stats()
+{
+	s_start_mixer();
+	cs_mixer_stats_t stats = cs_get_mixer_stats();
+	CF_AudioStats result;
+	result.mix_count = stats.mix_count;
+	result.mix_seconds = stats.mix_seconds;
+	result.block_sample_count = stats.block_sample_count;
+	result.peak_load = stats.peak_load;
+	result.underrun_count = stats.underrun_count;
+	result.voice_count = stats.voice_count;
+	result.virtual_voice_count = stats.virtual_voice_count;
+	result.buffer_size = stats.buffered_samples;
+	return result;
+}
+
+void cf_audio_reset_stats()
+{
+	s_start_mixer();
+	cs_reset_mixer_stats();
+}
+
+void cf_audio_render(int16_t* out, int sample_count)
+{
+	s_start_mixer();
+	if (app->audio_headless) {
+		cs_render(out, sample_count);
+	} else {
+		CF_MEMSET(out, 0, sizeof(int16_t) * 2 * sample_count);
+	}
+}
+
 int cf_audio_sample_rate(CF_Audio audio)
 {
+	s_sync_audio_load(audio.id, false);
 	cs_audio_source_t* src = (cs_audio_source_t*)audio.id;
 	return src->sample_rate;
 }
 
 int cf_audio_sample_count(CF_Audio audio)
 {
+	s_sync_audio_load(audio.id, false);
 	cs_audio_source_t* src = (cs_audio_source_t*)audio.id;
 	return src->sample_count;
 }
 
 int cf_audio_channel_count(CF_Audio audio)
 {
+	s_sync_audio_load(audio.id, false);
 	cs_audio_source_t* src = (cs_audio_source_t*)audio.id;
 	return src->channel_count;
 }
 
+CF_Result cf_audio_resample(CF_Audio audio, CF_AudioResampleQuality quality)
+{
+	s_sync_audio_load(audio.id, true);
+	cs_audio_source_t* src = (cs_audio_source_t*)audio.id;
+	if (!src->sample_count) return cf_result_error("Audio has no samples to resample.");
+	cs_resample_quality_t q = quality == CF_AUDIO_RESAMPLE_QUALITY_LINEAR ? CUTE_SOUND_RESAMPLE_QUALITY_LINEAR : CUTE_SOUND_RESAMPLE_QUALITY_CUBIC;
+	return s_result(cs_resample(src, cs_get_mixer_sample_rate(), q));
+}
+
+CF_Result cf_audio_compress(CF_Audio audio)
+{
+	s_sync_audio_load(audio.id, true);
+	cs_audio_source_t* src = (cs_audio_source_t*)audio.id;
+	if (!src->sample_count) return cf_result_error("Audio has no samples to compress.");
+	return s_result(cs_compress_adpcm(src));
+}
+
+// -------------------------------------------------------------------------------------------------
+// Sound banks.
+
+// A bank is a header, a table of clips sorted by name, the names, then each clip's samples on a 16 byte
+// boundary. Samples are stored as the mixer keeps them in memory: planar floats padded to a multiple of
+// four samples per channel, or ADPCM blocks from `cs_compress_adpcm`. Everything is little endian.
+#define CF_AUDIO_BANK_VERSION 1
+#define CF_AUDIO_BANK_ALIGNMENT 16
+
+struct CF_AudioBankHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t clip_count;
+	uint32_t adpcm_block;
+};
+
+struct CF_AudioBankClip
+{
+	uint32_t name_offset;
+	uint32_t sample_rate;
+	uint32_t sample_count;
+	uint32_t channel_count;
+	uint32_t compressed;
+	uint32_t unused;
+	uint64_t data_offset;
+	uint64_t data_size;
+};
+
+struct CF_AudioBankInternal
+{
+	const uint8_t* data;
+	void* owned_data;
+	bool owned_aligned;
+	int count;
+	const CF_AudioBankClip* clips;
+	const char* names;
+	cs_audio_source_t* sources;
+};
+
+static uint64_t s_bank_data_size(const cs_audio_source_t* src)
+{
+	if (src->adpcm) return (uint64_t)cs_adpcm_block_count(src) * src->channel_count * CUTE_SOUND_ADPCM_BLOCK_BYTES;
+	return (uint64_t)CUTE_SOUND_ALIGN(src->sample_count, 4) * sizeof(float) * src->channel_count;
+}
+
+struct CF_AudioBankName
+{
+	const char* name;
+	int index;
+};
+
+static int s_bank_name_cmp(const void* a, const void* b)
+{
+	return CF_STRCMP(((const CF_AudioBankName*)a)->name, ((const CF_AudioBankName*)b)->name);
+}
+
+CF_Result cf_audio_bank_save(const char* path, const CF_Audio* audio, const char** names, int count)
+{
+	CF_ALLOC_TAG_SCOPE("audio");
+	for (int i = 0; i < count; ++i) {
+		s_sync_audio_load(audio[i].id, true);
+		cs_audio_source_t* src = (cs_audio_source_t*)audio[i].id;
+		if (!src || !src->sample_count) return cf_result_error("Audio has no samples to save.");
+		if (src->stream) return cf_result_error("Streamed audio can't be saved to a bank.");
+		if (!names[i]) return cf_result_error("Every clip in a bank needs a name.");
+	}
+
+	// Clips are sorted by name so `cf_audio_bank_get` can binary search.
+	Cute::Array<CF_AudioBankName> order;
+	order.ensure_capacity(count);
+	for (int i = 0; i < count; ++i) order.add({ names[i], i });
+	qsort(order.data(), count, sizeof(CF_AudioBankName), s_bank_name_cmp);
+	for (int i = 1; i < count; ++i) {
+		if (!CF_STRCMP(order[i - 1].name, order[i].name)) return cf_result_error("Names in a bank must be unique.");
+	}
+
+	size_t names_size = 0;
+	for (int i = 0; i < count; ++i) names_size += CF_STRLEN(names[i]) + 1;
+	size_t offset = CUTE_SOUND_ALIGN(sizeof(CF_AudioBankHeader) + sizeof(CF_AudioBankClip) * count + names_size, CF_AUDIO_BANK_ALIGNMENT);
+	size_t total = offset;
+	for (int i = 0; i < count; ++i) {
+		total = CUTE_SOUND_ALIGN(total + s_bank_data_size((cs_audio_source_t*)audio[order[i].index].id), CF_AUDIO_BANK_ALIGNMENT);
+	}
+
+	uint8_t* data = (uint8_t*)CF_ALLOC(total);
+	CF_MEMSET(data, 0, total);
+	CF_AudioBankHeader* header = (CF_AudioBankHeader*)data;
+	CF_MEMCPY(header->magic, "CFSB", 4);
+	header->version = CF_AUDIO_BANK_VERSION;
+	header->clip_count = (uint32_t)count;
+	header->adpcm_block = CUTE_SOUND_ADPCM_BLOCK;
+	CF_AudioBankClip* clips = (CF_AudioBankClip*)(header + 1);
+	char* name_table = (char*)(clips + count);
+	uint32_t name_offset = 0;
+	for (int i = 0; i < count; ++i) {
+		const cs_audio_source_t* src = (const cs_audio_source_t*)audio[order[i].index].id;
+		const char* name = order[i].name;
+		CF_AudioBankClip* clip = clips + i;
+		clip->name_offset = name_offset;
+		clip->sample_rate = (uint32_t)src->sample_rate;
+		clip->sample_count = (uint32_t)src->sample_count;
+		clip->channel_count = (uint32_t)src->channel_count;
+		clip->compressed = src->adpcm ? 1 : 0;
+		clip->data_offset = offset;
+		clip->data_size = s_bank_data_size(src);
+		size_t name_size = CF_STRLEN(name) + 1;
+		CF_MEMCPY(name_table + name_offset, name, name_size);
+		name_offset += (uint32_t)name_size;
+		if (src->adpcm) {
+			CF_MEMCPY(data + offset, src->adpcm, (size_t)clip->data_size);
+		} else {
+			size_t channel_size = (size_t)clip->data_size / src->channel_count;
+			for (int c = 0; c < src->channel_count; ++c) {
+				CF_MEMCPY(data + offset + channel_size * c, src->channels[c], channel_size);
+			}
+		}
+		offset = CUTE_SOUND_ALIGN(offset + clip->data_size, CF_AUDIO_BANK_ALIGNMENT);
+	}
+
+	CF_Result result = cf_fs_write_entire_buffer_to_file(path, data, total);
+	CF_FREE(data);
+	return result;
+}
+
+static CF_AudioBankInternal* s_open_bank(const void* memory, size_t size)
+{
+	const uint8_t* data = (const uint8_t*)memory;
+	if (!data || ((uintptr_t)data & (CF_AUDIO_BANK_ALIGNMENT - 1))) return NULL;
+	if (size < sizeof(CF_AudioBankHeader)) return NULL;
+	const CF_AudioBankHeader* header = (const CF_AudioBankHeader*)data;
+	if (CF_MEMCMP(header->magic, "CFSB", 4) || header->version != CF_AUDIO_BANK_VERSION) return NULL;
+	if (header->adpcm_block != CUTE_SOUND_ADPCM_BLOCK) return NULL;
+	int count = (int)header->clip_count;
+	if (count < 0 || (size - sizeof(CF_AudioBankHeader)) / sizeof(CF_AudioBankClip) < (size_t)count) return NULL;
+	const CF_AudioBankClip* clips = (const CF_AudioBankClip*)(header + 1);
+	const char* names = (const char*)(clips + count);
+	size_t names_size = size - (size_t)((const uint8_t*)names - data);
+
+	CF_AudioBankInternal* bank = (CF_AudioBankInternal*)CF_ALLOC(sizeof(CF_AudioBankInternal) + sizeof(cs_audio_source_t) * count);
+	bank->data = data;
+	bank->owned_data = NULL;
+	bank->owned_aligned = false;
+	bank->count = count;
+	bank->clips = clips;
+	bank->names = names;
+	bank->sources = (cs_audio_source_t*)(bank + 1);
+	CF_MEMSET(bank->sources, 0, sizeof(cs_audio_source_t) * count);
+
+	for (int i = 0; i < count; ++i) {
+		const CF_AudioBankClip* clip = clips + i;
+		cs_audio_source_t* src = bank->sources + i;
+		bool valid = clip->name_offset < names_size && CF_MEMCHR(names + clip->name_offset, 0, names_size - clip->name_offset);
+		valid = valid && (clip->channel_count == 1 || clip->channel_count == 2) && clip->sample_count > 0 && clip->sample_count <= INT_MAX;
+		valid = valid && !(clip->data_offset & (CF_AUDIO_BANK_ALIGNMENT - 1)) && clip->data_offset <= size && clip->data_size <= size - clip->data_offset;
+		if (!valid) {
+			CF_FREE(bank);
+			return NULL;
+		}
+		src->sample_rate = (int)clip->sample_rate;
+		src->sample_count = (int)clip->sample_count;
+		src->channel_count = (int)clip->channel_count;
+		src->borrowed = true;
+		uint8_t* samples = (uint8_t*)(data + clip->data_offset);
+		if (clip->compressed) {
+			src->adpcm = samples;
+		} else {
+			src->channels[0] = samples;
+			if (src->channel_count == 2) src->channels[1] = samples + clip->data_size / 2;
+		}
+		if (clip->data_size != s_bank_data_size(src)) {
+			CF_FREE(bank);
+			return NULL;
+		}
+	}
+	return bank;
+}
+
+CF_AudioBank cf_audio_bank_load(const char* path)
+{
+	CF_ALLOC_TAG_SCOPE("audio");
+	CF_AudioBank result = { 0 };
+	size_t size;
+	void* data = cf_fs_read_entire_file_to_memory(path, &size);
+	if (!data) return result;
+	if ((uintptr_t)data & (CF_AUDIO_BANK_ALIGNMENT - 1)) {
+		// Only on platforms where the allocator hands out less than 16 byte alignment.
+		void* aligned = cf_aligned_alloc(size, CF_AUDIO_BANK_ALIGNMENT);
+		CF_MEMCPY(aligned, data, size);
+		CF_FREE(data);
+		CF_AudioBankInternal* bank = s_open_bank(aligned, size);
+		if (!bank) {
+			cf_aligned_free(aligned);
+			return result;
+		}
+		bank->owned_data = aligned;
+		bank->owned_aligned = true;
+		result.id = (uint64_t)bank;
+		return result;
+	}
+	CF_AudioBankInternal* bank = s_open_bank(data, size);
+	if (!bank) {
+		CF_FREE(data);
+		return result;
+	}
+	bank->owned_data = data;
+	result.id = (uint64_t)bank;
+	return result;
+}
+
+CF_AudioBank cf_audio_bank_load_from_memory(const void* memory, size_t byte_count)
+{
+	CF_ALLOC_TAG_SCOPE("audio");
+	CF_AudioBank result = { (uint64_t)s_open_bank(memory, byte_count) };
+	return result;
+}
+
+static void s_free_bank(CF_AudioBankInternal* bank)
+{
+	if (bank->owned_aligned) {
+		cf_aligned_free(bank->owned_data);
+	} else {
+		CF_FREE(bank->owned_data);
+	}
+	CF_FREE(bank);
+}
+
+// Sounds from a bank are stopped by the mixer, which then lets go of their audio.
+static bool s_bank_is_playing(CF_AudioBankInternal* bank)
+{
+	bool playing = false;
+	cs_lock();
+	for (int i = 0; i < bank->count && !playing; ++i) {
+		playing = bank->sources[i].playing_count > 0;
+	}
+	cs_unlock();
+	return playing;
+}
+
+void cf_audio_bank_destroy(CF_AudioBank bank_handle)
+{
+	CF_AudioBankInternal* bank = (CF_AudioBankInternal*)bank_handle.id;
+	if (!bank) return;
+	if (s_bank_is_playing(bank)) {
+		app->audio_banks_to_free.add(bank);
+	} else {
+		s_free_bank(bank);
+	}
+}
+
+void cf_audio_free_banks(bool force)
+{
+	for (int i = 0; i < app->audio_banks_to_free.count();) {
+		CF_AudioBankInternal* bank = app->audio_banks_to_free[i];
+		if (force || !s_bank_is_playing(bank)) {
+			s_free_bank(bank);
+			app->audio_banks_to_free.unordered_remove(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+int cf_audio_bank_count(CF_AudioBank bank_handle)
+{
+	CF_AudioBankInternal* bank = (CF_AudioBankInternal*)bank_handle.id;
+	return bank->count;
+}
+
+CF_Audio cf_audio_bank_get(CF_AudioBank bank_handle, const char* name)
+{
+	CF_AudioBankInternal* bank = (CF_AudioBankInternal*)bank_handle.id;
+	CF_Audio result = { 0 };
+	int lo = 0;
+	int hi = bank->count - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		int cmp = CF_STRCMP(name, bank->names + bank->clips[mid].name_offset);
+		if (cmp == 0) {
+			result.id = (uint64_t)(bank->sources + mid);
+			break;
+		} else if (cmp < 0) {
+			hi = mid - 1;
+		} else {
+			lo = mid + 1;
+		}
+	}
+	return result;
+}
+
+CF_Audio cf_audio_bank_get_index(CF_AudioBank bank_handle, int index)
+{
+	CF_AudioBankInternal* bank = (CF_AudioBankInternal*)bank_handle.id;
+	CF_ASSERT(index >= 0 && index < bank->count);
+	CF_Audio result = { (uint64_t)(bank->sources + index) };
+	return result;
+}
+
+const char* cf_audio_bank_get_name(CF_AudioBank bank_handle, int index)
+{
+	CF_AudioBankInternal* bank = (CF_AudioBankInternal*)bank_handle.id;
+	CF_ASSERT(index >= 0 && index < bank->count);
+	return bank->names + bank->clips[index].name_offset;
+}
+
 #undef STB_VORBIS_HEADER_ONLY
 #include <stb/stb_vorbis.c>
@@ -8,7 +8,17 @@
 #include <cute_base64.h>
 #include <cute_c_runtime.h>
 
+// SSSE3 isn't part of baseline x64, so it's only used when the compiler targets it, such as with -mssse3 or /arch:AVX.
+#if defined(__SSSE3__) || defined(__AVX__)
+#	include <tmmintrin.h>
+#	define CF_BASE64_SSSE3
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_BASE64_NEON
+#endif
+
 // Implementation referenced from: https://tools.ietf.org/html/rfc4648
+// Vectorized paths referenced from: http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html and http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
 
 // From: https://tools.ietf.org/html/rfc4648#section-3.2
 static const uint8_t s_6bits_to_base64[64] = {
@@ -21,7 +31,7 @@ static const uint8_t s_6bits_to_base64[64] = {
 	Generated by:
 
 		int out_array[80];
-		for (int i = 0; i < 80; ++i) out_array[i] = -1;
+		for (int i = 0; i < 80; ++i) out_array[i] = 255;
 		for (int i = 0; i < 64; ++i)
 		{
 			int val = s_6bits_to_base64[i];
@@ -30,156 +40,348 @@ static const uint8_t s_6bits_to_base64[64] = {
 		}
 		for (int i = 0; i < 80; ++i) printf("%d, ", out_array[i]);
 */
-static const int s_base64_to_6bits[80] = {
-
-	62, -1, -1, -1, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4,
-	5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1, -1,
+static const uint8_t s_base64_to_6bits[80] = {
+	62, 255, 255, 255, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 255, 255, 255, 255, 255, 255, 255, 0, 1, 2, 3, 4,
+	5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 255, 255, 255, 255, 255, 255,
 	26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
 };
 
+#define CF_BASE64_ILLEGAL_CHARACTER "Found illegal character in input stream."
+
+//--------------------------------------------------------------------------------------------------
+// Encoding.
+
+// Encodes whole triplets, advancing `in` and `out` past them.
+static void s_encode_triplets(const uint8_t** in_ptr, uint8_t** out_ptr, size_t triplets)
+{
+	const uint8_t* in = *in_ptr;
+	uint8_t* out = *out_ptr;
+	const uint8_t* end = in + triplets * 3;
+
+#if defined(CF_BASE64_SSSE3)
+	// 12 bytes to 16 characters per step. Each step loads 16 bytes, so stop while 16 remain.
+	const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+	const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	while (end - in >= 16) {
+		__m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)in), shuffle);
+		// Spread the four 6-bit fields of each triplet into their own bytes.
+		__m128i t0 = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+		__m128i t1 = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+		__m128i indices = _mm_or_si128(t0, t1);
+		// Map each range of indices (A-Z, a-z, 0-9, +, /) to the offset that turns it into its character.
+		__m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+		range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+		_mm_storeu_si128((__m128i*)out, _mm_add_epi8(indices, _mm_shuffle_epi8(shift_lut, range)));
+		in += 12;
+		out += 16;
+	}
+#elif defined(CF_BASE64_NEON)
+	// 48 bytes to 64 characters per step.
+	uint8x16x4_t lut;
+	lut.val[0] = vld1q_u8(s_6bits_to_base64);
+	lut.val[1] = vld1q_u8(s_6bits_to_base64 + 16);
+	lut.val[2] = vld1q_u8(s_6bits_to_base64 + 32);
+	lut.val[3] = vld1q_u8(s_6bits_to_base64 + 48);
+	while (end - in >= 48) {
+		uint8x16x3_t v = vld3q_u8(in);
+		uint8x16x4_t result;
+		result.val[0] = vqtbl4q_u8(lut, vshrq_n_u8(v.val[0], 2));
+		result.val[1] = vqtbl4q_u8(lut, vorrq_u8(vshlq_n_u8(vandq_u8(v.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(v.val[1], 4)));
+		result.val[2] = vqtbl4q_u8(lut, vorrq_u8(vshlq_n_u8(vandq_u8(v.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(v.val[2], 6)));
+		result.val[3] = vqtbl4q_u8(lut, vandq_u8(v.val[2], vdupq_n_u8(0x3F)));
+		vst4q_u8(out, result);
+		in += 48;
+		out += 64;
+	}
+#endif
+
+	while (in < end) {
+		uint32_t bits = ((uint32_t)in[0]) << 16 | ((uint32_t)in[1]) << 8 | ((uint32_t)in[2]);
+		in += 3;
+		*out++ = s_6bits_to_base64[(bits >> 18) & 0x3F];
+		*out++ = s_6bits_to_base64[(bits >> 12) & 0x3F];
+		*out++ = s_6bits_to_base64[(bits >> 6) & 0x3F];
+		*out++ = s_6bits_to_base64[bits & 0x3F];
+	}
+
+	*in_ptr = in;
+	*out_ptr = out;
+}
+
+// Encodes the final one or two bytes along with their padding.
+static void s_encode_tail(const uint8_t* in, int count, uint8_t* out)
+{
+	CF_ASSERT(count == 1 || count == 2);
+	uint32_t bits = ((uint32_t)in[0]) << 16 | (count == 2 ? ((uint32_t)in[1]) << 8 : 0);
+	out[0] = s_6bits_to_base64[(bits >> 18) & 0x3F];
+	out[1] = s_6bits_to_base64[(bits >> 12) & 0x3F];
+	out[2] = count == 2 ? s_6bits_to_base64[(bits >> 6) & 0x3F] : '=';
+	out[3] = '=';
+}
+
 CF_Result cf_base64_encode(void* dst, size_t dst_size, const void* src, size_t src_size)
 {
 	size_t out_size = CF_BASE64_ENCODED_SIZE(src_size);
 	if (dst_size < out_size) return cf_result_error("`dst` buffer too small to place encoded output.");
 
-	size_t triplets = (src_size) / 3;
-	int pads = (src_size) % 3 ? 3 - (src_size) % 3 : 0;
+	const uint8_t* in = (const uint8_t*)src;
+	uint8_t* out = (uint8_t*)dst;
+	s_encode_triplets(&in, &out, src_size / 3);
+	int remainder = (int)(src_size % 3);
+	if (remainder) {
+		s_encode_tail(in, remainder, out);
+		out += 4;
+	}
 
+	CF_ASSERT((size_t)(out - (uint8_t*)dst) == out_size);
+
+	return cf_result_success();
+}
+
+CF_Base64Encoder cf_make_base64_encoder()
+{
+	CF_Base64Encoder encoder;
+	CF_MEMSET(&encoder, 0, sizeof(encoder));
+	return encoder;
+}
+
+size_t cf_base64_encoder_update(CF_Base64Encoder* encoder, void* dst, const void* src, size_t src_size)
+{
 	const uint8_t* in = (const uint8_t*)src;
+	const uint8_t* end = in + src_size;
 	uint8_t* out = (uint8_t*)dst;
 
-	while (triplets--)
-	{
-		uint32_t bits = ((uint32_t)in[0]) << 16 | ((uint32_t)in[1]) << 8 | ((uint32_t)in[2]);
-		uint32_t a = (bits & 0xFC0000) >> 18;
-		uint32_t b = (bits & 0x3F000) >> 12;
-		uint32_t c = (bits & 0xFC0) >> 6;
-		uint32_t d = (bits & 0x3F);
-		in += 3;
-		CF_ASSERT(a < 64);
-		CF_ASSERT(b < 64);
-		CF_ASSERT(c < 64);
-		CF_ASSERT(d < 64);
-		*out++ = s_6bits_to_base64[a];
-		*out++ = s_6bits_to_base64[b];
-		*out++ = s_6bits_to_base64[c];
-		*out++ = s_6bits_to_base64[d];
+	// Top up the bytes left over from last time into a whole triplet first.
+	if (encoder->carry_count) {
+		while (encoder->carry_count < 3 && in < end) encoder->carry[encoder->carry_count++] = *in++;
+		if (encoder->carry_count < 3) return 0;
+		const uint8_t* carry = encoder->carry;
+		s_encode_triplets(&carry, &out, 1);
+		encoder->carry_count = 0;
 	}
 
-	switch (pads)
-	{
-	case 1:
-	{
-		uint32_t bits = ((uint32_t)in[0]) << 8 | ((uint32_t)in[1]);
-		uint32_t a = (bits & 0xFC00) >> 10;
-		uint32_t b = (bits & 0x3F0) >> 4;
-		uint32_t c = (bits & 0xF) << 2;
-		CF_ASSERT(a < 64);
-		CF_ASSERT(b < 64);
-		CF_ASSERT(c < 64);
-		*out++ = s_6bits_to_base64[a];
-		*out++ = s_6bits_to_base64[b];
-		*out++ = s_6bits_to_base64[c];
-		in += 2;
-	}	break;
-
-	case 2:
-		uint32_t bits = ((uint32_t)in[0]);
-		uint32_t a = (bits & 0xFC) >> 2;
-		uint32_t b = (bits & 0x3) << 4;
-		CF_ASSERT(a < 64);
-		CF_ASSERT(b < 64);
-		*out++ = s_6bits_to_base64[a];
-		*out++ = s_6bits_to_base64[b];
-		in += 1;
-		break;
+	s_encode_triplets(&in, &out, (size_t)(end - in) / 3);
+	while (in < end) encoder->carry[encoder->carry_count++] = *in++;
+	return (size_t)(out - (uint8_t*)dst);
+}
+
+size_t cf_base64_encoder_finish(CF_Base64Encoder* encoder, void* dst)
+{
+	if (!encoder->carry_count) return 0;
+	s_encode_tail(encoder->carry, encoder->carry_count, (uint8_t*)dst);
+	encoder->carry_count = 0;
+	return 4;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Decoding.
+
+static CF_INLINE uint32_t s_decode_char(uint8_t c)
+{
+	uint32_t index = (uint32_t)c - 43;
+	return index < 80 ? s_base64_to_6bits[index] : 255;
+}
+
+// Decodes whole unpadded quadruplets, advancing `in` and `out` past them. Returns false on an illegal character,
+// which includes `=`. `out_end` is the end of the destination, which the vectorized paths need a little slack within.
+static bool s_decode_quadruplets(const uint8_t** in_ptr, uint8_t** out_ptr, uint8_t* out_end, size_t quadruplets)
+{
+	const uint8_t* in = *in_ptr;
+	uint8_t* out = *out_ptr;
+	const uint8_t* end = in + quadruplets * 4;
+
+#if defined(CF_BASE64_SSSE3)
+	// 16 characters to 12 bytes per step. Each step stores 16 bytes, so stop while 16 bytes of room remain.
+	// A block with an illegal character drops to the scalar loop, which reports it.
+	const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+	const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m128i mask_2f = _mm_set1_epi8(0x2f);
+	const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	while (end - in >= 16 && out_end - out >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)in);
+		__m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(v, 4), mask_2f);
+		__m128i lo = _mm_shuffle_epi8(lut_lo, _mm_and_si128(v, mask_2f));
+		__m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0xFFFF) break;
+		__m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(v, mask_2f), hi_nibbles));
+		v = _mm_add_epi8(v, roll);
+		// Merge the 6-bit values back into 24-bit triplets, then pack the triplets together.
+		v = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+		v = _mm_madd_epi16(v, _mm_set1_epi32(0x00011000));
+		_mm_storeu_si128((__m128i*)out, _mm_shuffle_epi8(v, pack));
+		in += 16;
+		out += 12;
 	}
+#elif defined(CF_BASE64_NEON)
+	// 64 characters to 48 bytes per step. Illegal characters map to 255 and drop to the scalar loop, which reports them.
+	uint8x16x4_t lut;
+	lut.val[0] = vld1q_u8(s_base64_to_6bits);
+	lut.val[1] = vld1q_u8(s_base64_to_6bits + 16);
+	lut.val[2] = vld1q_u8(s_base64_to_6bits + 32);
+	lut.val[3] = vld1q_u8(s_base64_to_6bits + 48);
+	uint8x16_t lut_tail = vld1q_u8(s_base64_to_6bits + 64);
+	(void)out_end;
+	while (end - in >= 64) {
+		uint8x16x4_t v = vld4q_u8(in);
+		uint8x16_t invalid = vdupq_n_u8(0);
+		for (int i = 0; i < 4; ++i) {
+			uint8x16_t index = vsubq_u8(v.val[i], vdupq_n_u8(43));
+			uint8x16_t bits = vqtbx4q_u8(vdupq_n_u8(255), lut, index);
+			v.val[i] = vqtbx1q_u8(bits, lut_tail, vsubq_u8(index, vdupq_n_u8(64)));
+			invalid = vorrq_u8(invalid, v.val[i]);
+		}
+		if (vmaxvq_u8(invalid) > 63) break;
+		uint8x16x3_t result;
+		result.val[0] = vorrq_u8(vshlq_n_u8(v.val[0], 2), vshrq_n_u8(v.val[1], 4));
+		result.val[1] = vorrq_u8(vshlq_n_u8(v.val[1], 4), vshrq_n_u8(v.val[2], 2));
+		result.val[2] = vorrq_u8(vshlq_n_u8(v.val[2], 6), v.val[3]);
+		vst3q_u8(out, result);
+		in += 64;
+		out += 48;
+	}
+#else
+	(void)out_end;
+#endif
 
-	while (pads--)
-	{
-		*out++ = '=';
+	// RFC describes the best way to handle bad input is to reject the entire input.
+	// https://tools.ietf.org/html/rfc4648#page-14
+	bool ok = true;
+	while (in < end) {
+		uint32_t a = s_decode_char(in[0]);
+		uint32_t b = s_decode_char(in[1]);
+		uint32_t c = s_decode_char(in[2]);
+		uint32_t d = s_decode_char(in[3]);
+		if ((a | b | c | d) > 63) {
+			ok = false;
+			break;
+		}
+		in += 4;
+		uint32_t bits = (a << 18) | (b << 12) | (c << 6) | d;
+		*out++ = (uint8_t)(bits >> 16);
+		*out++ = (uint8_t)(bits >> 8);
+		*out++ = (uint8_t)bits;
 	}
 
-	CF_ASSERT((int)(out - (uint8_t*)dst) == out_size);
+	*in_ptr = in;
+	*out_ptr = out;
+	return ok;
+}
 
-	return cf_result_success();
+// Returns the number of `=` characters ending a quadruplet, or -1 if they're misplaced.
+static int s_pad_count(const uint8_t* in)
+{
+	if (in[3] != '=') return in[2] == '=' ? -1 : 0;
+	return in[2] == '=' ? 2 : 1;
+}
+
+// Decodes a quadruplet ending in one or two `=` characters. Returns the number of bytes written, or -1 on an illegal character.
+static int s_decode_padded(const uint8_t* in, int pads, uint8_t* out)
+{
+	uint32_t a = s_decode_char(in[0]);
+	uint32_t b = s_decode_char(in[1]);
+	uint32_t c = pads == 1 ? s_decode_char(in[2]) : 0;
+	if ((a | b | c) > 63) return -1;
+	uint32_t bits = (a << 18) | (b << 12) | (c << 6);
+	out[0] = (uint8_t)(bits >> 16);
+	if (pads == 1) out[1] = (uint8_t)(bits >> 8);
+	return 3 - pads;
 }
 
 CF_Result cf_base64_decode(void* dst, size_t dst_size, const void* src, size_t src_size)
 {
 	if (!src_size) return cf_result_success();
 	if (src_size % 4) return cf_result_error("`src_size` is not a multiple of 4 (all base64 streams must be padded to a multiple of four with `=` characters).");
-	size_t quadruplets = src_size / 4;
-	
+
 	const uint8_t* in = (const uint8_t*)src;
 	uint8_t* out = (uint8_t*)dst;
+	int pads = s_pad_count(in + src_size - 4);
+	if (pads < 0) return cf_result_error(CF_BASE64_ILLEGAL_CHARACTER);
+	if (dst_size < CF_BASE64_DECODED_SIZE(src_size) - pads) return cf_result_error("'dst_size' is too small to decode.");
 
-	const uint8_t* end = in + src_size;
-	int pads = 0;
-	if (end[-1] == '=') pads++;
-	if (end[-2] == '=') pads++;
-	if (pads) quadruplets--;
-
-	size_t exact_out_size = CF_BASE64_DECODED_SIZE(src_size);
-	switch (pads)
-	{
-	case 1: dst_size -= 2; break;
-	case 2: dst_size -= 1; break;
+	size_t quadruplets = src_size / 4 - (pads ? 1 : 0);
+	if (!s_decode_quadruplets(&in, &out, out + dst_size, quadruplets)) return cf_result_error(CF_BASE64_ILLEGAL_CHARACTER);
+	if (pads) {
+		int n = s_decode_padded(in, pads, out);
+		if (n < 0) return cf_result_error(CF_BASE64_ILLEGAL_CHARACTER);
+		out += n;
 	}
-	if (CF_BASE64_DECODED_SIZE(src_size) < exact_out_size) return cf_result_error("'dst_size' is too small to decode.");
 
-	// RFC describes the best way to handle bad input is to reject the entire input.
-	// https://tools.ietf.org/html/rfc4648#page-14
+	CF_ASSERT((size_t)(out + pads - (uint8_t*)dst) == CF_BASE64_DECODED_SIZE(src_size));
+
+	return cf_result_success();
+}
 
-	while (quadruplets--)
-	{
-		uint32_t a = *in++ - 43;
-		uint32_t b = *in++ - 43;
-		uint32_t c = *in++ - 43;
-		uint32_t d = *in++ - 43;
-		if ((a > 79) | (b > 79) | (c > 79) | (d > 79)) return cf_result_error("Found illegal character in input stream.");
-		a = s_base64_to_6bits[a];
-		b = s_base64_to_6bits[b];
-		c = s_base64_to_6bits[c];
-		d = s_base64_to_6bits[d];
-		if ((a == ~0) | (b == ~0) | (c == ~0) | (d == ~0)) return cf_result_error("Found illegal character in input stream.");
-		uint32_t bits = (a << 26) | (b << 20) | (c << 14) | (d << 8);
-		*out++ = (bits & 0xFF000000) >> 24;
-		*out++ = (bits & 0x00FF0000) >> 16;
-		*out++ = (bits & 0x0000FF00) >> 8;
+CF_Base64Decoder cf_make_base64_decoder()
+{
+	CF_Base64Decoder decoder;
+	CF_MEMSET(&decoder, 0, sizeof(decoder));
+	return decoder;
+}
+
+// Decodes one quadruplet, which may be the padded final one.
+static bool s_decode_one(CF_Base64Decoder* decoder, const uint8_t* in, uint8_t** out)
+{
+	int pads = s_pad_count(in);
+	if (pads < 0) return false;
+	if (pads) {
+		int n = s_decode_padded(in, pads, *out);
+		if (n < 0) return false;
+		*out += n;
+		decoder->done = true;
+		return true;
+	}
+	return s_decode_quadruplets(&in, out, *out + 3, 1);
+}
+
+CF_Result cf_base64_decoder_update(CF_Base64Decoder* decoder, void* dst, const void* src, size_t src_size, size_t* out_size)
+{
+	const uint8_t* in = (const uint8_t*)src;
+	const uint8_t* end = in + src_size;
+	uint8_t* out = (uint8_t*)dst;
+	uint8_t* out_end = out + CF_BASE64_DECODED_SIZE(src_size);
+	*out_size = 0;
+	if (decoder->failed) return cf_result_error(CF_BASE64_ILLEGAL_CHARACTER);
+	if (!src_size) return cf_result_success();
+	if (decoder->done) {
+		decoder->failed = true;
+		return cf_result_error("Found data after the padding that ends a base64 stream.");
+	}
+
+	// Top up the characters left over from last time into a whole quadruplet first.
+	if (decoder->carry_count) {
+		while (decoder->carry_count < 4 && in < end) decoder->carry[decoder->carry_count++] = *in++;
+		if (decoder->carry_count < 4) return cf_result_success();
+		decoder->carry_count = 0;
+		if (!s_decode_one(decoder, decoder->carry, &out)) decoder->failed = true;
+		if (!decoder->failed && decoder->done && in < end) {
+			decoder->failed = true;
+			return cf_result_error("Found data after the padding that ends a base64 stream.");
+		}
 	}
 
-	switch (pads)
-	{
-	case 1:
-	{
-		uint32_t a = *in++ - 43;
-		uint32_t b = *in++ - 43;
-		uint32_t c = *in++ - 43;
-		if ((a > 79) | (b > 79) | (c > 79)) return cf_result_error("Found illegal character in input stream.");
-		a = s_base64_to_6bits[a];
-		b = s_base64_to_6bits[b];
-		c = s_base64_to_6bits[c];
-		if ((a == ~0) | (b == ~0) | (c == ~0)) return cf_result_error("Found illegal character in input stream.");
-		uint32_t bits = (a << 26) | (b << 20) | (c << 14);
-		*out++ = (bits & 0xFF000000) >> 24;
-		*out++ = (bits & 0x00FF0000) >> 16;
-	}	break;
-
-	case 2:
-	{
-		uint32_t a = *in++ - 43;
-		uint32_t b = *in++ - 43;
-		if ((a > 79) | (b > 79)) return cf_result_error("Found illegal character in input stream.");
-		a = s_base64_to_6bits[a];
-		b = s_base64_to_6bits[b];
-		if ((a == ~0) | (b == ~0)) return cf_result_error("Found illegal character in input stream.");
-		uint32_t bits = (a << 26) | (b << 20);
-		*out++ = (bits & 0xFF000000) >> 24;
-	}	break;
+	// Only the last whole quadruplet of the chunk may be padded, which is then the end of the stream.
+	size_t quadruplets = (size_t)(end - in) / 4;
+	if (!decoder->failed && quadruplets) {
+		if (!s_decode_quadruplets(&in, &out, out_end, quadruplets - 1) || !s_decode_one(decoder, in, &out)) {
+			decoder->failed = true;
+		}
+		in += 4;
 	}
+	if (decoder->failed) return cf_result_error(CF_BASE64_ILLEGAL_CHARACTER);
 
-	CF_ASSERT((int)(out + pads - (uint8_t*)dst) == CF_BASE64_DECODED_SIZE(src_size));
+	if (in < end && decoder->done) {
+		decoder->failed = true;
+		return cf_result_error("Found data after the padding that ends a base64 stream.");
+	}
+	while (in < end) decoder->carry[decoder->carry_count++] = *in++;
+	*out_size = (size_t)(out - (uint8_t*)dst);
+	return cf_result_success();
+}
 
+CF_Result cf_base64_decoder_finish(CF_Base64Decoder* decoder)
+{
+	if (decoder->failed) return cf_result_error(CF_BASE64_ILLEGAL_CHARACTER);
+	if (decoder->carry_count) return cf_result_error("The base64 stream ended partway through a group of four characters.");
 	return cf_result_success();
 }
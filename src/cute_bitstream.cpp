@@ -0,0 +1,344 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_bitstream.h>
+#include <cute_c_runtime.h>
+#include <cute_math.h>
+
+int cf_bits_required(int min, int max)
+{
+	CF_ASSERT(min <= max);
+	uint32_t range = (uint32_t)max - (uint32_t)min;
+	int bits = 0;
+	while (range) {
+		++bits;
+		range >>= 1;
+	}
+	return bits;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Writer.
+
+CF_BitWriter cf_make_bit_writer(void* buffer, int size)
+{
+	CF_BitWriter w;
+	CF_MEMSET(&w, 0, sizeof(w));
+	w.data = (uint8_t*)buffer;
+	w.size = size;
+	return w;
+}
+
+static void s_write_byte(CF_BitWriter* w, uint8_t byte)
+{
+	if (w->byte_count < w->size) {
+		w->data[w->byte_count++] = byte;
+	} else {
+		w->overflowed = true;
+	}
+}
+
+// Moves whole bytes out of scratch, 32 bits at a time while there's room.
+static void s_write_scratch(CF_BitWriter* w, int min_bits)
+{
+	while (w->scratch_bits >= min_bits && w->scratch_bits >= 8) {
+		if (w->scratch_bits >= 32 && w->byte_count + 4 <= w->size) {
+			uint32_t word = (uint32_t)w->scratch;
+			uint8_t* p = w->data + w->byte_count;
+			p[0] = (uint8_t)word;
+			p[1] = (uint8_t)(word >> 8);
+			p[2] = (uint8_t)(word >> 16);
+			p[3] = (uint8_t)(word >> 24);
+			w->byte_count += 4;
+			w->scratch >>= 32;
+			w->scratch_bits -= 32;
+		} else {
+			s_write_byte(w, (uint8_t)w->scratch);
+			w->scratch >>= 8;
+			w->scratch_bits -= 8;
+		}
+	}
+}
+
+int cf_bit_writer_flush(CF_BitWriter* w)
+{
+	cf_bit_write_align(w);
+	s_write_scratch(w, 8);
+	return w->byte_count;
+}
+
+int cf_bit_writer_bits_written(const CF_BitWriter* w)
+{
+	return w->byte_count * 8 + w->scratch_bits;
+}
+
+bool cf_bit_writer_overflowed(const CF_BitWriter* w)
+{
+	return w->overflowed;
+}
+
+void cf_bit_write(CF_BitWriter* w, uint32_t value, int bits)
+{
+	CF_ASSERT(bits >= 0 && bits <= 32);
+	if (w->overflowed || !bits) return;
+	if (bits < 32) value &= (1u << bits) - 1;
+	w->scratch |= (uint64_t)value << w->scratch_bits;
+	w->scratch_bits += bits;
+	s_write_scratch(w, 32);
+}
+
+void cf_bit_write_bool(CF_BitWriter* w, bool value)
+{
+	cf_bit_write(w, value ? 1 : 0, 1);
+}
+
+void cf_bit_write_int(CF_BitWriter* w, int value, int min, int max)
+{
+	value = cf_clamp_int(value, min, max);
+	cf_bit_write(w, (uint32_t)value - (uint32_t)min, cf_bits_required(min, max));
+}
+
+void cf_bit_write_varint(CF_BitWriter* w, uint64_t value)
+{
+	do {
+		uint32_t group = (uint32_t)(value & 0x7F);
+		value >>= 7;
+		cf_bit_write(w, group | (value ? 0x80 : 0), 8);
+	} while (value);
+}
+
+void cf_bit_write_varint_signed(CF_BitWriter* w, int64_t value)
+{
+	// Zigzag encoding interleaves negative and positive values, so small magnitudes stay small.
+	uint64_t zigzag = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+	cf_bit_write_varint(w, zigzag);
+}
+
+void cf_bit_write_float(CF_BitWriter* w, float value)
+{
+	uint32_t bits;
+	CF_MEMCPY(&bits, &value, sizeof(bits));
+	cf_bit_write(w, bits, 32);
+}
+
+static int s_quantize_steps(float min, float max, float resolution)
+{
+	CF_ASSERT(min <= max && resolution > 0);
+	double steps = ceil(((double)max - (double)min) / (double)resolution);
+	CF_ASSERT(steps < (double)(1 << 30));
+	return (int)steps;
+}
+
+static int s_quantize(float value, float min, float max, float resolution, int steps)
+{
+	if (value >= max) return steps;
+	value = cf_max(value, min);
+	int q = (int)(((double)value - (double)min) / (double)resolution + 0.5);
+	return cf_min(q, steps);
+}
+
+static float s_dequantize(int q, float min, float max, float resolution, int steps)
+{
+	// The last step is snapped to max, since max - min needn't be a multiple of resolution.
+	if (q == steps) return max;
+	return cf_min((float)((double)min + (double)q * (double)resolution), max);
+}
+
+void cf_bit_write_quantized(CF_BitWriter* w, float value, float min, float max, float resolution)
+{
+	int steps = s_quantize_steps(min, max, resolution);
+	cf_bit_write_int(w, s_quantize(value, min, max, resolution, steps), 0, steps);
+}
+
+void cf_bit_write_delta(CF_BitWriter* w, int value, int baseline)
+{
+	bool changed = value != baseline;
+	cf_bit_write_bool(w, changed);
+	if (changed) {
+		cf_bit_write_varint_signed(w, (int64_t)value - (int64_t)baseline);
+	}
+}
+
+void cf_bit_write_delta_quantized(CF_BitWriter* w, float value, float baseline, float min, float max, float resolution)
+{
+	int steps = s_quantize_steps(min, max, resolution);
+	int q = s_quantize(value, min, max, resolution, steps);
+	int q_baseline = s_quantize(baseline, min, max, resolution, steps);
+	cf_bit_write_delta(w, q, q_baseline);
+}
+
+void cf_bit_write_align(CF_BitWriter* w)
+{
+	// Bits above scratch_bits are always zero, so this pads with zeroes.
+	w->scratch_bits = (w->scratch_bits + 7) & ~7;
+	s_write_scratch(w, 32);
+}
+
+void cf_bit_write_bytes(CF_BitWriter* w, const void* data, int size)
+{
+	cf_bit_write_align(w);
+	s_write_scratch(w, 8);
+	if (w->overflowed) return;
+	if (w->byte_count + size > w->size) {
+		w->overflowed = true;
+		return;
+	}
+	CF_MEMCPY(w->data + w->byte_count, data, size);
+	w->byte_count += size;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Reader.
+
+CF_BitReader cf_make_bit_reader(const void* data, int size)
+{
+	CF_BitReader r;
+	CF_MEMSET(&r, 0, sizeof(r));
+	r.data = (const uint8_t*)data;
+	r.size = size;
+	return r;
+}
+
+bool cf_bit_reader_failed(const CF_BitReader* r)
+{
+	return r->failed;
+}
+
+int cf_bit_reader_bits_remaining(const CF_BitReader* r)
+{
+	return (r->size - r->byte_count) * 8 + r->scratch_bits;
+}
+
+// Fills scratch with at least `bits` bits, 32 bits at a time while there's enough data.
+static bool s_read_scratch(CF_BitReader* r, int bits)
+{
+	while (r->scratch_bits < bits) {
+		if (r->scratch_bits <= 32 && r->byte_count + 4 <= r->size) {
+			const uint8_t* p = r->data + r->byte_count;
+			uint32_t word = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+			r->scratch |= (uint64_t)word << r->scratch_bits;
+			r->scratch_bits += 32;
+			r->byte_count += 4;
+		} else if (r->byte_count < r->size) {
+			r->scratch |= (uint64_t)r->data[r->byte_count++] << r->scratch_bits;
+			r->scratch_bits += 8;
+		} else {
+			r->failed = true;
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t cf_bit_read(CF_BitReader* r, int bits)
+{
+	CF_ASSERT(bits >= 0 && bits <= 32);
+	if (r->failed || !bits) return 0;
+	if (!s_read_scratch(r, bits)) return 0;
+	uint32_t value = (uint32_t)r->scratch;
+	if (bits < 32) value &= (1u << bits) - 1;
+	r->scratch >>= bits;
+	r->scratch_bits -= bits;
+	return value;
+}
+
+bool cf_bit_read_bool(CF_BitReader* r)
+{
+	return cf_bit_read(r, 1) ? true : false;
+}
+
+int cf_bit_read_int(CF_BitReader* r, int min, int max)
+{
+	uint32_t range = (uint32_t)max - (uint32_t)min;
+	uint32_t value = cf_bit_read(r, cf_bits_required(min, max));
+	if (value > range) r->failed = true;
+	if (r->failed) return 0;
+	return (int)((uint32_t)min + value);
+}
+
+uint64_t cf_bit_read_varint(CF_BitReader* r)
+{
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		uint32_t group = cf_bit_read(r, 8);
+		if (r->failed) return 0;
+		value |= (uint64_t)(group & 0x7F) << shift;
+		if (!(group & 0x80)) return value;
+	}
+	// More groups than any 64-bit value needs.
+	r->failed = true;
+	return 0;
+}
+
+int64_t cf_bit_read_varint_signed(CF_BitReader* r)
+{
+	uint64_t zigzag = cf_bit_read_varint(r);
+	return (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+}
+
+float cf_bit_read_float(CF_BitReader* r)
+{
+	uint32_t bits = cf_bit_read(r, 32);
+	float value;
+	CF_MEMCPY(&value, &bits, sizeof(value));
+	return value;
+}
+
+float cf_bit_read_quantized(CF_BitReader* r, float min, float max, float resolution)
+{
+	int steps = s_quantize_steps(min, max, resolution);
+	int q = cf_bit_read_int(r, 0, steps);
+	if (r->failed) return 0;
+	return s_dequantize(q, min, max, resolution, steps);
+}
+
+int cf_bit_read_delta(CF_BitReader* r, int baseline)
+{
+	if (!cf_bit_read_bool(r)) return r->failed ? 0 : baseline;
+	int64_t value = (int64_t)baseline + cf_bit_read_varint_signed(r);
+	if (value < INT32_MIN || value > INT32_MAX) r->failed = true;
+	if (r->failed) return 0;
+	return (int)value;
+}
+
+float cf_bit_read_delta_quantized(CF_BitReader* r, float baseline, float min, float max, float resolution)
+{
+	int steps = s_quantize_steps(min, max, resolution);
+	int q_baseline = s_quantize(baseline, min, max, resolution, steps);
+	int q = cf_bit_read_delta(r, q_baseline);
+	if (q < 0 || q > steps) r->failed = true;
+	if (r->failed) return 0;
+	return s_dequantize(q, min, max, resolution, steps);
+}
+
+void cf_bit_read_align(CF_BitReader* r)
+{
+	int padding = r->scratch_bits & 7;
+	r->scratch >>= padding;
+	r->scratch_bits -= padding;
+}
+
+void cf_bit_read_bytes(CF_BitReader* r, void* data, int size)
+{
+	cf_bit_read_align(r);
+	uint8_t* out = (uint8_t*)data;
+	if (r->failed || size > cf_bit_reader_bits_remaining(r) / 8) {
+		r->failed = true;
+		CF_MEMSET(data, 0, size);
+		return;
+	}
+
+	// Whole bytes already pulled into scratch come first.
+	while (size && r->scratch_bits) {
+		*out++ = (uint8_t)r->scratch;
+		r->scratch >>= 8;
+		r->scratch_bits -= 8;
+		--size;
+	}
+	CF_MEMCPY(out, r->data + r->byte_count, size);
+	r->byte_count += size;
+}
@@ -0,0 +1,154 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_contact_cache.h>
+#include <cute_hashtable.h>
+#include <cute_alloc.h>
+
+#include <internal/cute_alloc_internal.h>
+
+// Same early-out tolerance `cf_toi` uses for shapes already touching.
+#define CONTACT_CACHE_TOI_TOLERANCE 1.0e-4f
+
+using namespace Cute;
+
+struct CF_ContactCacheEntry
+{
+	uint64_t id_a;
+	uint64_t id_b;
+	CF_ShapeType type_a;
+	CF_ShapeType type_b;
+	int vert_count_a;
+	int vert_count_b;
+	CF_GjkCache gjk;
+	uint64_t last_used_frame;
+};
+
+struct CF_ContactCacheInternal
+{
+	Map<uint64_t, CF_ContactCacheEntry> entries;
+	uint64_t frame = 0;
+};
+
+static CF_INLINE uint64_t s_pair_key(uint64_t id_a, uint64_t id_b)
+{
+	// Different pairs may share a key, entries remember their ids to tell them apart.
+	return id_a ^ (id_b * 0x9E3779B97F4A7C15ULL + 0x632BE59BD9B4E019ULL + (id_a << 6) + (id_a >> 2));
+}
+
+// Cached simplex indices are only meaningful for shapes with the same vertices as last time.
+static int s_vert_count(const void* shape, CF_ShapeType type)
+{
+	switch (type) {
+	case CF_SHAPE_TYPE_CIRCLE: return 1;
+	case CF_SHAPE_TYPE_AABB: return 4;
+	case CF_SHAPE_TYPE_CAPSULE: return 2;
+	case CF_SHAPE_TYPE_POLY: return ((const CF_Poly*)shape)->count;
+	default: return 0;
+	}
+}
+
+static CF_GjkCache* s_gjk_cache(CF_ContactCacheInternal* cache, uint64_t id_a, uint64_t id_b, const void* A, CF_ShapeType typeA, const void* B, CF_ShapeType typeB)
+{
+	uint64_t key = s_pair_key(id_a, id_b);
+	int vert_count_a = s_vert_count(A, typeA);
+	int vert_count_b = s_vert_count(B, typeB);
+	CF_ContactCacheEntry* entry = cache->entries.try_get(key);
+	if (!entry) {
+		entry = cache->entries.insert(key);
+		entry->gjk.count = 0;
+	} else if (entry->id_a != id_a || entry->id_b != id_b || entry->type_a != typeA || entry->type_b != typeB || entry->vert_count_a != vert_count_a || entry->vert_count_b != vert_count_b) {
+		entry->gjk.count = 0;
+	}
+	entry->id_a = id_a;
+	entry->id_b = id_b;
+	entry->type_a = typeA;
+	entry->type_b = typeB;
+	entry->vert_count_a = vert_count_a;
+	entry->vert_count_b = vert_count_b;
+	entry->last_used_frame = cache->frame;
+	return &entry->gjk;
+}
+
+CF_ContactCache cf_make_contact_cache(int initial_capacity)
+{
+	CF_ContactCacheInternal* cache = CF_NEW(CF_ContactCacheInternal);
+	if (initial_capacity > 0) cache->entries.ensure_capacity(initial_capacity);
+	CF_ContactCache result;
+	result.id = (uint64_t)cache;
+	return result;
+}
+
+void cf_destroy_contact_cache(CF_ContactCache cache_handle)
+{
+	CF_ContactCacheInternal* cache = (CF_ContactCacheInternal*)cache_handle.id;
+	cache->~CF_ContactCacheInternal();
+	CF_FREE(cache);
+}
+
+float cf_contact_cache_gjk(CF_ContactCache cache_handle, uint64_t id_a, uint64_t id_b, const void* A, CF_ShapeType typeA, const CF_Transform* ax, const void* B, CF_ShapeType typeB, const CF_Transform* bx, CF_V2* outA, CF_V2* outB, bool use_radius, int* iterations)
+{
+	CF_ContactCacheInternal* cache = (CF_ContactCacheInternal*)cache_handle.id;
+	CF_GjkCache* gjk = s_gjk_cache(cache, id_a, id_b, A, typeA, B, typeB);
+	return cf_gjk(A, typeA, ax, B, typeB, bx, outA, outB, use_radius, iterations, gjk);
+}
+
+void cf_contact_cache_toi_batch(CF_ContactCache cache_handle, const CF_SweepPair* pairs, int count, bool use_radius, CF_ToiResult* out)
+{
+	CF_ContactCacheInternal* cache = (CF_ContactCacheInternal*)cache_handle.id;
+	for (int i = 0; i < count; ++i) {
+		const CF_SweepPair* pair = pairs + i;
+		CF_GjkCache* gjk = s_gjk_cache(cache, pair->id_a, pair->id_b, pair->A, pair->typeA, pair->B, pair->typeB);
+		int iterations = 0;
+		float distance = cf_gjk(pair->A, pair->typeA, pair->ax, pair->B, pair->typeB, pair->bx, NULL, NULL, use_radius, &iterations, gjk);
+
+		// The gap can shrink by at most the relative motion, so a wider gap can't close this frame.
+		float motion = cf_len(cf_sub_v2(pair->vB, pair->vA));
+		if (distance > motion + CONTACT_CACHE_TOI_TOLERANCE) {
+			CF_ToiResult result;
+			result.hit = 0;
+			result.toi = 1.0f;
+			result.n = cf_v2(0, 0);
+			result.p = cf_v2(0, 0);
+			result.iterations = iterations;
+			out[i] = result;
+		} else {
+			out[i] = cf_toi(pair->A, pair->typeA, pair->ax, pair->vA, pair->B, pair->typeB, pair->bx, pair->vB, use_radius);
+		}
+	}
+}
+
+void cf_contact_cache_remove(CF_ContactCache cache_handle, uint64_t id_a, uint64_t id_b)
+{
+	CF_ContactCacheInternal* cache = (CF_ContactCacheInternal*)cache_handle.id;
+	uint64_t key = s_pair_key(id_a, id_b);
+	CF_ContactCacheEntry* entry = cache->entries.try_get(key);
+	if (entry && entry->id_a == id_a && entry->id_b == id_b) {
+		cache->entries.remove(key);
+	}
+}
+
+void cf_contact_cache_next_frame(CF_ContactCache cache_handle, int max_idle_frames)
+{
+	CF_ContactCacheInternal* cache = (CF_ContactCacheInternal*)cache_handle.id;
+	CF_ASSERT(max_idle_frames >= 0);
+	Map<uint64_t, CF_ContactCacheEntry>& entries = cache->entries;
+	for (int i = 0; i < entries.count();) {
+		if (cache->frame - entries.items()[i].last_used_frame > (uint64_t)max_idle_frames) {
+			entries.remove(entries.keys()[i]);
+		} else {
+			++i;
+		}
+	}
+	cache->frame++;
+}
+
+int cf_contact_cache_count(CF_ContactCache cache_handle)
+{
+	CF_ContactCacheInternal* cache = (CF_ContactCacheInternal*)cache_handle.id;
+	return cache->entries.count();
+}
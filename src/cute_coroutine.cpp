@@ -7,20 +7,118 @@
 
 #include <cute_coroutine.h>
 #include <cute_c_runtime.h>
+#include <cute_multithreading.h>
+#include <cute_array.h>
+#include <cute_hashtable.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
+#include <internal/cute_coroutine_internal.h>
 
+// Allows small stacks for shallow coroutines, minicoro defaults to a 32 KB minimum.
+#define MCO_MIN_STACK_SIZE 4096
 #define MINICORO_IMPL
 #include <edubart/minicoro.h>
 
+enum CF_CoroutineWait
+{
+	CF_COROUTINE_WAIT_NONE,
+	CF_COROUTINE_WAIT_READY,
+	CF_COROUTINE_WAIT_SECONDS,
+	CF_COROUTINE_WAIT_SIGNAL,
+	CF_COROUTINE_WAIT_WOKEN,
+};
+
 struct CF_CoroutineInternal
 {
 	mco_coro* mco;
 	CF_CoroutineFn* fn = NULL;
 	void* udata = NULL;
+	size_t block_size = 0;
+	CF_CoroutineInternal* next_free = NULL;
+
+	// Scheduler state, see `cf_coroutine_schedule`.
+	bool scheduled = false;
+	bool destroy_when_done = false;
+	CF_CoroutineWait wait = CF_COROUTINE_WAIT_NONE;
+	double wake_time = 0;
+	CF_CoroutineInternal* next_waiting = NULL; // Coroutines waiting on the same signal.
+};
+
+// Each coroutine is a single block holding `CF_CoroutineInternal` followed by the minicoro context,
+// storage and stack. Destroyed blocks are kept in a free list per size class, so in steady state
+// making a coroutine doesn't allocate. Classes are block sizes rounded up to 4 KB, as programs tend
+// to use a handful of distinct stack sizes.
+#define CF_COROUTINE_BLOCK_GRANULARITY 4096
+#define CF_COROUTINE_SIZE_CLASS_MAX 16
+#define CF_COROUTINE_POOL_MAX_BYTES_PER_CLASS (32 * CF_MB)
+
+struct CF_CoroutineSizeClass
+{
+	size_t block_size;
+	size_t free_bytes;
+	CF_CoroutineInternal* free_list;
 };
 
+static CF_CoroutineSizeClass s_classes[CF_COROUTINE_SIZE_CLASS_MAX];
+static int s_class_count;
+static CF_Mutex s_pool_lock;
+
+// Held for a handful of instructions at a time, so waiters rarely get past the mutex's spin.
+static void s_pool_lock_acquire()
+{
+	cf_mutex_lock(&s_pool_lock);
+}
+
+static void s_pool_lock_release()
+{
+	cf_mutex_unlock(&s_pool_lock);
+}
+
+static CF_CoroutineSizeClass* s_find_class(size_t block_size)
+{
+	for (int i = 0; i < s_class_count; ++i) {
+		if (s_classes[i].block_size == block_size) return s_classes + i;
+	}
+	if (s_class_count == CF_COROUTINE_SIZE_CLASS_MAX) return NULL;
+	CF_CoroutineSizeClass* size_class = s_classes + s_class_count++;
+	size_class->block_size = block_size;
+	size_class->free_bytes = 0;
+	size_class->free_list = NULL;
+	return size_class;
+}
+
+static void* s_block_alloc(size_t block_size)
+{
+	void* block = NULL;
+	s_pool_lock_acquire();
+	CF_CoroutineSizeClass* size_class = s_find_class(block_size);
+	if (size_class && size_class->free_list) {
+		CF_CoroutineInternal* co = size_class->free_list;
+		size_class->free_list = co->next_free;
+		size_class->free_bytes -= block_size;
+		block = co;
+	}
+	s_pool_lock_release();
+	if (!block) block = cf_aligned_alloc(block_size, 16);
+	return block;
+}
+
+static void s_block_free(CF_CoroutineInternal* co)
+{
+	size_t block_size = co->block_size;
+	s_pool_lock_acquire();
+	CF_CoroutineSizeClass* size_class = s_find_class(block_size);
+	bool pooled = size_class && size_class->free_bytes + block_size <= CF_COROUTINE_POOL_MAX_BYTES_PER_CLASS;
+	if (pooled) {
+		co->next_free = size_class->free_list;
+		size_class->free_list = co;
+		size_class->free_bytes += block_size;
+	}
+	s_pool_lock_release();
+	if (!pooled) cf_aligned_free(co);
+}
+
 static void s_co_fn(mco_coro* mco)
 {
 	CF_CoroutineInternal* co = (CF_CoroutineInternal*)mco_get_user_data(mco);
@@ -32,10 +130,14 @@ static void s_co_fn(mco_coro* mco)
 CF_Coroutine cf_make_coroutine(CF_CoroutineFn* fn, int stack_size, void* udata)
 {
 	mco_desc desc = mco_desc_init(s_co_fn, (size_t)stack_size);
-	CF_CoroutineInternal* co = CF_NEW(CF_CoroutineInternal);
+	size_t offset = CF_ALIGN_FORWARD(sizeof(CF_CoroutineInternal), 16);
+	size_t block_size = CF_ALIGN_FORWARD(offset + desc.coro_size, CF_COROUTINE_BLOCK_GRANULARITY);
+	void* block = s_block_alloc(block_size);
+	CF_CoroutineInternal* co = CF_PLACEMENT_NEW(block) CF_CoroutineInternal;
+	co->block_size = block_size;
 	desc.user_data = (void*)co;
-	mco_coro* mco;
-	mco_result res = mco_create(&mco, &desc);
+	mco_coro* mco = (mco_coro*)((char*)block + offset);
+	mco_result res = mco_init(mco, &desc);
 	CF_ASSERT(res == MCO_SUCCESS);
 	co->mco = mco;
 	co->fn = fn;
@@ -50,9 +152,31 @@ void cf_destroy_coroutine(CF_Coroutine co_handle)
 	CF_CoroutineInternal* co = (CF_CoroutineInternal*)co_handle.id;
 	mco_state state = mco_status(co->mco);
 	CF_ASSERT(state == MCO_DEAD || state == MCO_SUSPENDED);
-	mco_result res = mco_destroy(co->mco);
+	CF_ASSERT(!co->scheduled); // Scheduled coroutines may only be destroyed once they're done.
+	mco_result res = mco_uninit(co->mco);
 	CF_ASSERT(res == MCO_SUCCESS);
-	CF_FREE(co);
+	s_block_free(co);
+}
+
+void cf_coroutine_release_pooled_memory()
+{
+	s_pool_lock_acquire();
+	CF_CoroutineInternal* free_lists[CF_COROUTINE_SIZE_CLASS_MAX];
+	int count = s_class_count;
+	for (int i = 0; i < count; ++i) {
+		free_lists[i] = s_classes[i].free_list;
+		s_classes[i].free_list = NULL;
+		s_classes[i].free_bytes = 0;
+	}
+	s_pool_lock_release();
+	for (int i = 0; i < count; ++i) {
+		CF_CoroutineInternal* co = free_lists[i];
+		while (co) {
+			CF_CoroutineInternal* next = co->next_free;
+			cf_aligned_free(co);
+			co = next;
+		}
+	}
 }
 
 CF_Result cf_coroutine_resume(CF_Coroutine co_handle)
@@ -138,3 +262,171 @@ CF_Coroutine cf_coroutine_currently_running()
 	result.id = (uint64_t)co;
 	return result;
 }
+
+//--------------------------------------------------------------------------------------------------
+// Scheduler.
+
+// Timed waits go into a hashed timer wheel of 1/60th second slots. Each update only looks at the
+// slots time has passed through, and coroutines waiting more than a lap (about four seconds) just
+// stay put until their lap comes around.
+#define CF_SCHEDULER_TICKS_PER_SECOND 60
+#define CF_SCHEDULER_WHEEL_SIZE 256
+
+struct CF_Scheduler
+{
+	double now = 0;
+	uint64_t tick = 0;
+	int count = 0;
+	Cute::Array<CF_CoroutineInternal*> ready;
+	Cute::Array<CF_CoroutineInternal*> resuming;
+	Cute::Array<CF_CoroutineInternal*> wheel[CF_SCHEDULER_WHEEL_SIZE];
+	Cute::Map<uint64_t, CF_CoroutineInternal*> signals; // Heads of the lists of waiting coroutines.
+	Cute::Array<CF_SchedulerPollFn*> polls;
+};
+
+static CF_Scheduler s_scheduler;
+
+static CF_Coroutine s_handle(CF_CoroutineInternal* co)
+{
+	CF_Coroutine result;
+	result.id = (uint64_t)co;
+	return result;
+}
+
+static void s_make_ready(CF_CoroutineInternal* co)
+{
+	if (co->wait == CF_COROUTINE_WAIT_READY) return;
+	co->wait = CF_COROUTINE_WAIT_READY;
+	s_scheduler.ready.add(co);
+}
+
+static void s_wait(CF_CoroutineInternal* co, CF_CoroutineWait wait)
+{
+	CF_ASSERT(co->scheduled && mco_running() == co->mco); // Only scheduled coroutines may wait, and only on themselves.
+	co->wait = wait;
+	mco_yield(co->mco);
+}
+
+void cf_coroutine_schedule(CF_Coroutine co_handle, bool destroy_when_done)
+{
+	CF_CoroutineInternal* co = (CF_CoroutineInternal*)co_handle.id;
+	CF_ASSERT(!co->scheduled);
+	co->scheduled = true;
+	co->destroy_when_done = destroy_when_done;
+	co->wait = CF_COROUTINE_WAIT_NONE;
+	s_scheduler.count++;
+	s_make_ready(co);
+}
+
+void cf_coroutine_scheduler_update(float dt)
+{
+	CF_Scheduler* sched = &s_scheduler;
+	for (int i = 0; i < sched->polls.count(); ++i) {
+		sched->polls[i]();
+	}
+
+	// Wake timers in every slot passed through since the last update. The current slot is checked
+	// again next time, as it may still hold coroutines due later within the same tick.
+	if (dt > 0) sched->now += dt;
+	uint64_t tick = (uint64_t)(sched->now * CF_SCHEDULER_TICKS_PER_SECOND);
+	uint64_t first = sched->tick;
+	if (tick - first >= CF_SCHEDULER_WHEEL_SIZE) first = tick - CF_SCHEDULER_WHEEL_SIZE + 1;
+	for (uint64_t t = first; t <= tick; ++t) {
+		Cute::Array<CF_CoroutineInternal*>& slot = sched->wheel[t % CF_SCHEDULER_WHEEL_SIZE];
+		for (int i = 0; i < slot.count();) {
+			CF_CoroutineInternal* co = slot[i];
+			if (co->wake_time <= sched->now) {
+				slot.unordered_remove(i);
+				s_make_ready(co);
+			} else {
+				++i;
+			}
+		}
+	}
+	sched->tick = tick;
+
+	// Only resume what's ready right now. Coroutines readied along the way, e.g. by a signal, run
+	// on the next update.
+	sched->resuming.clear();
+	for (int i = 0; i < sched->ready.count(); ++i) {
+		sched->resuming.add(sched->ready[i]);
+	}
+	sched->ready.clear();
+	for (int i = 0; i < sched->resuming.count(); ++i) {
+		CF_CoroutineInternal* co = sched->resuming[i];
+		co->wait = CF_COROUTINE_WAIT_NONE;
+		mco_resume(co->mco);
+		if (mco_status(co->mco) == MCO_DEAD) {
+			co->scheduled = false;
+			sched->count--;
+			if (co->destroy_when_done) cf_destroy_coroutine(s_handle(co));
+		} else if (co->wait == CF_COROUTINE_WAIT_NONE) {
+			// A plain yield, resume again next update.
+			s_make_ready(co);
+		}
+	}
+}
+
+int cf_coroutine_scheduled_count()
+{
+	return s_scheduler.count;
+}
+
+void cf_coroutine_wait_seconds(CF_Coroutine co_handle, float seconds)
+{
+	CF_CoroutineInternal* co = (CF_CoroutineInternal*)co_handle.id;
+	co->wake_time = s_scheduler.now + (double)seconds;
+	uint64_t tick = (uint64_t)(co->wake_time * CF_SCHEDULER_TICKS_PER_SECOND);
+	if (tick < s_scheduler.tick) tick = s_scheduler.tick;
+	s_scheduler.wheel[tick % CF_SCHEDULER_WHEEL_SIZE].add(co);
+	s_wait(co, CF_COROUTINE_WAIT_SECONDS);
+}
+
+void cf_coroutine_wait_signal(CF_Coroutine co_handle, uint64_t signal)
+{
+	CF_CoroutineInternal* co = (CF_CoroutineInternal*)co_handle.id;
+	CF_CoroutineInternal** head = s_scheduler.signals.try_get(signal);
+	if (head) {
+		co->next_waiting = *head;
+		*head = co;
+	} else {
+		co->next_waiting = NULL;
+		s_scheduler.signals.insert(signal, co);
+	}
+	s_wait(co, CF_COROUTINE_WAIT_SIGNAL);
+}
+
+int cf_coroutine_signal(uint64_t signal)
+{
+	CF_CoroutineInternal** head = s_scheduler.signals.try_get(signal);
+	if (!head) return 0;
+	CF_CoroutineInternal* co = *head;
+	s_scheduler.signals.remove(signal);
+	int count = 0;
+	while (co) {
+		CF_CoroutineInternal* next = co->next_waiting;
+		co->next_waiting = NULL;
+		s_make_ready(co);
+		co = next;
+		++count;
+	}
+	return count;
+}
+
+void cf_coroutine_wait_woken(CF_Coroutine co_handle)
+{
+	CF_CoroutineInternal* co = (CF_CoroutineInternal*)co_handle.id;
+	s_wait(co, CF_COROUTINE_WAIT_WOKEN);
+}
+
+void cf_coroutine_wake(CF_Coroutine co_handle)
+{
+	CF_CoroutineInternal* co = (CF_CoroutineInternal*)co_handle.id;
+	CF_ASSERT(co->wait == CF_COROUTINE_WAIT_WOKEN);
+	s_make_ready(co);
+}
+
+void cf_coroutine_scheduler_add_poll(CF_SchedulerPollFn* fn)
+{
+	s_scheduler.polls.add(fn);
+}
@@ -12,16 +12,31 @@
 #include <cute_defer.h>
 #include <cute_routine.h>
 #include <cute_rnd.h>
+#include <cute_profile.h>
+#include <cute_log.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
 #include <internal/cute_png_cache_internal.h>
 #include <internal/cute_aseprite_cache_internal.h>
 #include <internal/cute_font_internal.h>
+#include <internal/cute_graphics_internal.h>
+#include <internal/cute_string_internal.h>
+#include <internal/cute_particles_internal.h>
 
 #include <shaders/sprite_shader.h>
+// Specializations of the sprite shader, see `src/shaders/compile.sh`.
+#include <shaders/sprite_sprites_shader.h>
+#include <shaders/sprite_shapes_shader.h>
+#include <shaders/sprite_array_shader.h>
+#include <shaders/sprite_instanced_shader.h>
+#include <shaders/sprite_particles_shader.h>
+#include <shaders/sprite_particles_array_shader.h>
+#include <shaders/debug_shader.h>
 
-struct CF_Draw* draw;
+#include <data/fonts/calibri.h>
+
+thread_local struct CF_Draw* draw;
 
 #define SPRITEBATCH_IMPLEMENTATION
 #include <cute/cute_spritebatch.h>
@@ -30,6 +45,8 @@ struct CF_Draw* draw;
 #define CUTE_PNG_ASSERT CF_ASSERT
 #include <cute/cute_png.h>
 
+#include <cute/cute_aseprite.h>
+
 #define STB_TRUETYPE_IMPLEMENTATION
 #define STBTT_assert CF_ASSERT
 #include <stb/stb_truetype.h>
@@ -55,21 +72,193 @@ using namespace Cute;
 #define VA_TYPE_SEGMENT       (3)
 #define VA_TYPE_TRIANGLE      (4)
 #define VA_TYPE_TRIANGLE_SDF  (5)
+#define VA_TYPE_TEXT_SDF      (6)
 
-SPRITEBATCH_U64 cf_generate_texture_handle(void* pixels, int w, int h, void* udata)
+struct CF_MipJob
+{
+	const CF_Pixel* src;
+	CF_Pixel* dst;
+	int src_w, src_h;
+	int dst_w;
+};
+
+static void s_downsample_rows(int begin, int end, void* udata)
+{
+	CF_MipJob* job = (CF_MipJob*)udata;
+	for (int y = begin; y < end; ++y) {
+		int y0 = min(y * 2, job->src_h - 1);
+		int y1 = min(y * 2 + 1, job->src_h - 1);
+		for (int x = 0; x < job->dst_w; ++x) {
+			int x0 = min(x * 2, job->src_w - 1);
+			int x1 = min(x * 2 + 1, job->src_w - 1);
+			CF_Pixel a = job->src[y0 * job->src_w + x0];
+			CF_Pixel b = job->src[y0 * job->src_w + x1];
+			CF_Pixel c = job->src[y1 * job->src_w + x0];
+			CF_Pixel d = job->src[y1 * job->src_w + x1];
+			// Atlas pixels are premultiplied, so a plain box filter fades edges into the transparent padding
+			// instead of darkening them.
+			CF_Pixel p;
+			p.colors.r = (uint8_t)((a.colors.r + b.colors.r + c.colors.r + d.colors.r + 2) >> 2);
+			p.colors.g = (uint8_t)((a.colors.g + b.colors.g + c.colors.g + d.colors.g + 2) >> 2);
+			p.colors.b = (uint8_t)((a.colors.b + b.colors.b + c.colors.b + d.colors.b + 2) >> 2);
+			p.colors.a = (uint8_t)((a.colors.a + b.colors.a + c.colors.a + d.colors.a + 2) >> 2);
+			job->dst[y * job->dst_w + x] = p;
+		}
+	}
+}
+
+int cf_atlas_mip_chain(const CF_Pixel* pixels, int w, int h, int max_levels, CF_Pixel** chain_out)
+{
+	int levels = 1;
+	int size = w * h;
+	for (int lw = w, lh = h; levels < max_levels && (lw > 1 || lh > 1) && levels < SG_MAX_MIPMAPS; ++levels) {
+		lw = max(lw / 2, 1);
+		lh = max(lh / 2, 1);
+		size += lw * lh;
+	}
+	CF_Pixel* chain = (CF_Pixel*)CF_ALLOC(sizeof(CF_Pixel) * size);
+	CF_MEMCPY(chain, pixels, sizeof(CF_Pixel) * w * h);
+	CF_Pixel* src = chain;
+	for (int i = 1, lw = w, lh = h; i < levels; ++i) {
+		CF_MipJob job;
+		job.src = src;
+		job.dst = src + lw * lh;
+		job.src_w = lw;
+		job.src_h = lh;
+		lw = max(lw / 2, 1);
+		lh = max(lh / 2, 1);
+		job.dst_w = lw;
+		cf_parallel_for(app ? app->threadpool : NULL, lh, 32, s_downsample_rows, &job);
+		src = job.dst;
+	}
+	*chain_out = chain;
+	return levels;
+}
+
+// Every atlas page goes through here, so `CF_FILTER_TRILINEAR` gets a mip chain rebuilt alongside the page.
+static CF_Texture s_make_atlas_texture(const CF_Pixel* pixels, int w, int h)
 {
-	CF_UNUSED(udata);
 	CF_TextureParams params = cf_texture_defaults(w, h);
 	params.filter = draw->filter;
-	params.initial_data = pixels;
-	params.initial_data_size = w * h * sizeof(CF_Pixel);
-	CF_Texture texture = cf_make_texture(params);
+	params.initial_data = (void*)pixels;
+	params.initial_data_size = w * h * (int)sizeof(CF_Pixel);
+	if (draw->filter == CF_FILTER_TRILINEAR && draw->atlas_mip_levels > 1) {
+		CF_Pixel* chain;
+		params.mip_count = cf_atlas_mip_chain(pixels, w, h, draw->atlas_mip_levels, &chain);
+		CF_DEFER(CF_FREE(chain));
+		params.initial_data = chain;
+		params.initial_data_size = 0;
+		for (int i = 0, lw = w, lh = h; i < params.mip_count; ++i) {
+			params.initial_data_size += lw * lh * (int)sizeof(CF_Pixel);
+			lw = max(lw / 2, 1);
+			lh = max(lh / 2, 1);
+		}
+		return cf_make_texture(params);
+	}
+	return cf_make_texture(params);
+}
+
+// Bytes of GPU memory taken by one spritebatch atlas page, including its mips.
+static size_t s_atlas_page_bytes()
+{
+	int w = draw->sb.atlas_width_in_pixels;
+	int h = draw->sb.atlas_height_in_pixels;
+	int levels = draw->filter == CF_FILTER_TRILINEAR ? draw->atlas_mip_levels : 1;
+	size_t bytes = 0;
+	for (int i = 0; i < levels; ++i) {
+		bytes += (size_t)w * h * sizeof(CF_Pixel);
+		if (w == 1 && h == 1) break;
+		w = max(w / 2, 1);
+		h = max(h / 2, 1);
+	}
+	return bytes;
+}
+
+static int s_atlas_page_limit()
+{
+	if (!draw->atlas_budget) return 0;
+	return (int)min(max(draw->atlas_budget / s_atlas_page_bytes(), (size_t)1), (size_t)INT_MAX);
+}
+
+// Copies a page into a free layer of the atlas array, growing it if needed. Returns -1 if the page
+// should get its own texture instead.
+static int s_atlas_array_add(const CF_Pixel* pixels)
+{
+	CF_AtlasArray* array = &draw->atlas_array;
+	if (!array->enabled) return -1;
+	if (draw->filter == CF_FILTER_TRILINEAR && draw->atlas_mip_levels > 1) return -1;
+	int layer = 0;
+	while (layer < array->layer_count && array->used[layer]) ++layer;
+	if (layer == array->layer_count) {
+		int max_layers = min(CF_ATLAS_LAYER_MAX, cf_query_resource_limit(CF_RESOURCE_LIMIT_TEXTURE_ARRAY_LAYERS));
+		int page_limit = s_atlas_page_limit();
+		if (page_limit) max_layers = min(max_layers, page_limit);
+		if (array->layer_count >= max_layers) return -1;
+		array->layer_count = min(max(array->layer_count * 2, 4), max_layers);
+		array->used.ensure_count(array->layer_count);
+	}
+	int page = draw->sb.atlas_width_in_pixels * draw->sb.atlas_height_in_pixels;
+	array->pixels.ensure_count(array->layer_count * page);
+	CF_MEMCPY(array->pixels.data() + layer * page, pixels, sizeof(CF_Pixel) * page);
+	array->used[layer] = true;
+	array->dirty = true;
+	return layer;
+}
+
+static void s_atlas_array_reset()
+{
+	CF_AtlasArray* array = &draw->atlas_array;
+	if (array->texture.id) cf_destroy_texture(array->texture);
+	array->texture = { };
+	array->layer_count = 0;
+	array->dirty = false;
+	array->pixels.clear();
+	array->used.clear();
+}
+
+// Resolves a spritebatch texture id to the texture to bind. Pages added to the atlas array since it
+// was last built are uploaded here, once, before their first draw.
+static CF_Texture s_atlas_texture(uint64_t texture_id)
+{
+	if (!CF_IS_ATLAS_LAYER(texture_id)) return { texture_id };
+	CF_AtlasArray* array = &draw->atlas_array;
+	if (array->dirty) {
+		if (array->texture.id) cf_destroy_texture(array->texture);
+		CF_TextureParams params = cf_texture_defaults(draw->sb.atlas_width_in_pixels, draw->sb.atlas_height_in_pixels);
+		params.filter = draw->filter;
+		params.layer_count = array->layer_count;
+		params.initial_data = array->pixels.data();
+		params.initial_data_size = array->pixels.count() * (int)sizeof(CF_Pixel);
+		array->texture = cf_make_texture(params);
+		array->dirty = false;
+	}
+	return array->texture;
+}
+
+static CF_INLINE uint8_t s_atlas_layer(uint64_t texture_id)
+{
+	return CF_IS_ATLAS_LAYER(texture_id) ? (uint8_t)(texture_id & (CF_ATLAS_LAYER_MAX - 1)) : 0;
+}
+
+SPRITEBATCH_U64 cf_generate_texture_handle(void* pixels, int w, int h, void* udata)
+{
+	CF_UNUSED(udata);
+	if (w == draw->sb.atlas_width_in_pixels && h == draw->sb.atlas_height_in_pixels) {
+		int layer = s_atlas_array_add((CF_Pixel*)pixels);
+		if (layer >= 0) return CF_ATLAS_LAYER_BIT | (uint64_t)layer;
+	}
+	CF_Texture texture = s_make_atlas_texture((CF_Pixel*)pixels, w, h);
 	return texture.id;
 }
 
 void cf_destroy_texture_handle(SPRITEBATCH_U64 texture_id, void* udata)
 {
 	CF_UNUSED(udata);
+	if (CF_IS_ATLAS_LAYER(texture_id)) {
+		// The layer's old pixels are left alone, they're simply overwritten by the next page.
+		draw->atlas_array.used[s_atlas_layer(texture_id)] = false;
+		return;
+	}
 	CF_Texture tex;
 	tex.id = texture_id;
 	cf_destroy_texture(tex);
@@ -93,6 +282,9 @@ void cf_get_pixels(SPRITEBATCH_U64 image_id, void* buffer, int bytes_to_fill, vo
 	} else if (image_id >= CF_EASY_ID_RANGE_LO && image_id <= CF_EASY_ID_RANGE_HI) {
 		CF_Pixel* pixels = app->easy_sprites.get(image_id).pix;
 		CF_MEMCPY(buffer, pixels, bytes_to_fill);
+	} else if (image_id >= CF_DYNAMIC_ID_RANGE_LO && image_id <= CF_DYNAMIC_ID_RANGE_HI) {
+		CF_Pixel* pixels = app->dynamic_sprites.get(image_id).pix;
+		CF_MEMCPY(buffer, pixels, bytes_to_fill);
 	} else if (image_id >= CF_PREMADE_ID_RANGE_LO && image_id <= CF_PREMADE_ID_RANGE_LO) {
 		uint64_t png_id = draw->premade_sub_image_id_to_png_atlas_map.find(image_id);
 		cf_png_cache_get_pixels(png_id, buffer, bytes_to_fill);
@@ -102,6 +294,62 @@ void cf_get_pixels(SPRITEBATCH_U64 image_id, void* buffer, int bytes_to_fill, vo
 	}
 }
 
+// Drops the least recently used pixels until back under the budget. Goes a quarter below it, so
+// each new image past the budget doesn't sort everything again.
+static void s_evict_pixels()
+{
+	size_t target = app->pixel_budget - app->pixel_budget / 4;
+	int count = app->resident_pixels.count();
+	const uint64_t* ids = app->resident_pixels.keys();
+	const CF_ResidentPixels* resident = app->resident_pixels.items();
+	Array<int> order;
+	order.ensure_count(count);
+	for (int i = 0; i < count; ++i) order[i] = i;
+	std::sort(order.begin(), order.end(), [&](int a, int b) { return resident[a].last_use < resident[b].last_use; });
+
+	Array<uint64_t> evict;
+	size_t size = app->resident_pixel_size;
+	for (int i = 0; i < count && size > target; ++i) {
+		evict.add(ids[order[i]]);
+		size -= resident[order[i]].size;
+	}
+	for (int i = 0; i < evict.count(); ++i) {
+		uint64_t id = evict[i];
+		if (id >= CF_ASEPRITE_ID_RANGE_LO && id <= CF_ASEPRITE_ID_RANGE_HI) {
+			cf_aseprite_cache_drop_pixels(id);
+		} else if (id >= CF_PNG_ID_RANGE_LO && id <= CF_PNG_ID_RANGE_HI) {
+			cf_png_cache_drop_pixels(id);
+		}
+		// Pixels that can't be dropped, such as pngs from memory loaded without a budget, are just no longer tracked.
+		cf_image_pixels_forget(id);
+	}
+}
+
+void cf_image_pixels_used(uint64_t image_id, size_t size)
+{
+	if (!app->pixel_budget) return;
+	CF_ResidentPixels* resident = app->resident_pixels.try_get(image_id);
+	if (resident) {
+		resident->last_use = ++app->resident_pixel_tick;
+		return;
+	}
+	resident = app->resident_pixels.insert(image_id);
+	resident->size = size;
+	resident->last_use = ++app->resident_pixel_tick;
+	app->resident_pixel_size += size;
+	if (app->resident_pixel_size > app->pixel_budget) {
+		s_evict_pixels();
+	}
+}
+
+void cf_image_pixels_forget(uint64_t image_id)
+{
+	CF_ResidentPixels* resident = app->resident_pixels.try_get(image_id);
+	if (!resident) return;
+	app->resident_pixel_size -= resident->size;
+	app->resident_pixels.remove(image_id);
+}
+
 static CF_INLINE float s_intersect(float a, float b, float u0, float u1, float plane_d)
 {
 	float da = a - plane_d;
@@ -109,18 +357,167 @@ static CF_INLINE float s_intersect(float a, float b, float u0, float u1, float p
 	return u0 + (u1 - u0) * (da / (da - db));
 }
 
-static void s_draw_report(spritebatch_sprite_t* sprites, int count, int texture_w, int texture_h, void* udata)
+// A quad or triangle clipped against a box has at most 8 corners, fanned out into 6 triangles.
+#define CF_MAX_CLIPPED_VERTS 18
+
+// The room `s_fill_vertices` needs for `count` sprites.
+static int s_vertex_capacity(const spritebatch_sprite_t* sprites, int count)
+{
+	int capacity = count * 6;
+	for (int i = 0; i < count; ++i) {
+		if (sprites[i].geom.do_clipping) capacity += CF_MAX_CLIPPED_VERTS - 6;
+	}
+	return capacity;
+}
+
+// Depth of a draw layer, see `cf_draw_push_opaque`. Higher layers are drawn on top, so they're nearer. Steps
+// stay distinct in a 24-bit depth buffer even on GL, which maps clip-space [0, 1] onto half of its depth range.
+#define CF_LAYER_DEPTH_RANGE (1 << 21)
+static CF_INLINE float s_layer_depth(int layer)
+{
+	layer = cf_clamp_int(layer, -CF_LAYER_DEPTH_RANGE + 1, CF_LAYER_DEPTH_RANGE - 1);
+	return 0.5f - (float)layer * (0.5f / (float)CF_LAYER_DEPTH_RANGE);
+}
+
+// Vertex attributes are constant across a shape, except for the ones interpolated here.
+static CF_INLINE CF_Vertex s_lerp_vertex(const CF_Vertex& a, const CF_Vertex& b, float t)
+{
+	CF_Vertex v = a;
+	v.p = lerp(a.p, b.p, t);
+	v.posH = lerp(a.posH, b.posH, t);
+	v.uv = lerp(a.uv, b.uv, t);
+	return v;
+}
+
+static CF_INLINE float s_axis(v2 v, int axis)
+{
+	return axis ? v.y : v.x;
+}
+
+// Clips the 3 vertices of a triangle or the 6 of a quad against `clip`, in place. Returns the new
+// vertex count, up to `CF_MAX_CLIPPED_VERTS`.
+static int s_clip_vertices(CF_Vertex* verts, int count, CF_Aabb clip)
+{
+	bool inside = true;
+	for (int i = 0; i < count; ++i) {
+		inside &= cf_contains_point(clip, verts[i].posH);
+	}
+	if (inside) return count;
+
+	// Quads are laid out as two triangles, {0, 3, 1} and {1, 3, 2}, see `s_fill_vertices`.
+	CF_Vertex poly[2][8];
+	int n;
+	if (count == 3) {
+		poly[0][0] = verts[0];
+		poly[0][1] = verts[1];
+		poly[0][2] = verts[2];
+		n = 3;
+	} else {
+		poly[0][0] = verts[0];
+		poly[0][1] = verts[2];
+		poly[0][2] = verts[5];
+		poly[0][3] = verts[1];
+		n = 4;
+	}
+
+	// Sutherland-Hodgman, one side of the box at a time.
+	int in = 0;
+	for (int plane = 0; plane < 4 && n; ++plane) {
+		int axis = plane & 1;
+		float sign = plane < 2 ? -1.0f : 1.0f;
+		float d = plane < 2 ? -s_axis(clip.min, axis) : s_axis(clip.max, axis);
+		const CF_Vertex* src = poly[in];
+		CF_Vertex* dst = poly[!in];
+		int m = 0;
+		for (int i = 0; i < n; ++i) {
+			const CF_Vertex& a = src[i];
+			const CF_Vertex& b = src[(i + 1) % n];
+			float da = sign * s_axis(a.posH, axis) - d;
+			float db = sign * s_axis(b.posH, axis) - d;
+			bool a_inside = da <= 0;
+			bool b_inside = db <= 0;
+			if (a_inside) dst[m++] = a;
+			if (a_inside != b_inside) dst[m++] = s_lerp_vertex(a, b, da / (da - db));
+		}
+		n = m;
+		in = !in;
+	}
+
+	int vert_count = 0;
+	for (int i = 1; i + 1 < n; ++i) {
+		verts[vert_count++] = poly[in][0];
+		verts[vert_count++] = poly[in][i];
+		verts[vert_count++] = poly[in][i + 1];
+	}
+	return vert_count;
+}
+
+static CF_INLINE bool s_is_upright(const BatchGeometry& geom)
+{
+	return geom.a.x == geom.d.x && geom.b.x == geom.c.x && geom.a.y == geom.b.y && geom.c.y == geom.d.y;
+}
+
+// Clips an upright sprite against its clip box by shrinking the quad and its UVs. Returns false if
+// nothing is left of it.
+static bool s_clip_upright_sprite(spritebatch_sprite_t* s, BatchGeometry* geom)
+{
+	CF_Aabb bb = make_aabb(geom->d, geom->b);
+	CF_Aabb clip = geom->clip;
+	float top = clip.max.y;
+	float left = clip.min.x;
+	float bottom = clip.min.y;
+	float right = clip.max.x;
+
+	int separating_x_axis = (bb.max.x < left) | (bb.min.x > right);
+	if (separating_x_axis) {
+		return false;
+	}
+
+	if (bb.min.x < left) {
+		s->minx = s_intersect(bb.min.x, bb.max.x, s->minx, s->maxx, left);
+		bb.min.x = left;
+	}
+
+	if (bb.max.x > right) {
+		s->maxx = s_intersect(bb.min.x, bb.max.x, s->minx, s->maxx, right);
+		bb.max.x = right;
+	}
+
+	if (bb.min.y < bottom) {
+		s->miny = s_intersect(bb.min.y, bb.max.y, s->miny, s->maxy, bottom);
+		bb.min.y = bottom;
+	}
+
+	if (bb.max.y > top) {
+		s->maxy = s_intersect(bb.min.y, bb.max.y, s->miny, s->maxy, top);
+		bb.max.y = top;
+	}
+
+	if ((bb.min.x >= bb.max.x) | (bb.min.y >= bb.max.y)) {
+		return false;
+	}
+
+	geom->a = V2(bb.min.x, bb.max.y);
+	geom->b = bb.max;
+	geom->c = V2(bb.max.x, bb.min.y);
+	geom->d = bb.min;
+	return true;
+}
+
+// Expands each sprite into either 3 or 6 vertices, more if clipped with `cf_draw_push_clip_box`, or
+// none if clipped away entirely. The output array must have room for `s_vertex_capacity` vertices.
+// Returns the number of vertices written.
+static int s_fill_vertices(spritebatch_sprite_t* sprites, int count, CF_Vertex* verts)
 {
-	CF_UNUSED(udata);
 	int vert_count = 0;
-	draw->verts.ensure_count(count * 6);
-	CF_Vertex* verts = draw->verts.data();
 	CF_MEMSET(verts, 0, sizeof(CF_Vertex) * count * 6);
 
 	for (int i = 0; i < count; ++i) {
 		spritebatch_sprite_t* s = sprites + i;
 		BatchGeometry geom = s->geom;
 		CF_Vertex* out = verts + vert_count;
+		int first_vert = vert_count;
+		bool needs_clipping = geom.do_clipping;
 
 		v2 quad[6] = {
 			geom.box[0],
@@ -217,50 +614,12 @@ static void s_draw_report(spritebatch_sprite_t* sprites, int count, int texture_
 
 		case BATCH_GEOMETRY_TYPE_SPRITE:
 		{
-			bool clipped_away = false;
-			if (geom.do_clipping) {
-				CF_ASSERT(geom.is_text);
-
-				CF_Aabb bb = make_aabb(geom.d, geom.b);
-				CF_Aabb clip = geom.clip;
-				float top = clip.max.y;
-				float left = clip.min.x;
-				float bottom = clip.min.y;
-				float right = clip.max.x;
-
-				int separating_x_axis = (bb.max.x < left) | (bb.min.x > right);
-				if (separating_x_axis) {
-					continue;
-				}
-
-				if (bb.min.x < left) {
-					s->minx = s_intersect(bb.min.x, bb.max.x, s->minx, s->maxx, left);
-					bb.min.x = left;
-				}
-
-				if (bb.max.x > right) {
-					s->maxx = s_intersect(bb.min.x, bb.max.x, s->minx, s->maxx, right);
-					bb.max.x = right;
-				}
-
-				if (bb.min.y < bottom) {
-					s->miny = s_intersect(bb.min.y, bb.max.y, s->miny, s->maxy, bottom);
-					bb.min.y = bottom;
-				}
-
-				if (bb.max.y > top) {
-					s->maxy = s_intersect(bb.min.y, bb.max.y, s->miny, s->maxy, top);
-					bb.max.y = top;
-				}
-
-				if ((bb.min.x >= bb.max.x) | (bb.min.y >= bb.max.y)) {
+			// Upright sprites, such as all text, are clipped by shrinking the quad and its UVs.
+			if (geom.do_clipping && s_is_upright(geom)) {
+				needs_clipping = false;
+				if (!s_clip_upright_sprite(s, &geom)) {
 					continue;
 				}
-
-				geom.a = V2(bb.min.x, bb.max.y);
-				geom.b = bb.max;
-				geom.c = V2(bb.max.x, bb.min.y);
-				geom.d = bb.min;
 			}
 
 			for (int i = 0; i < 6; ++i) {
@@ -268,12 +627,13 @@ static void s_draw_report(spritebatch_sprite_t* sprites, int count, int texture_
 				if (s->geom.is_sprite) {
 					out[i].type = VA_TYPE_SPRITE;
 				} else if (s->geom.is_text) {
-					out[i].type = VA_TYPE_TEXT;
+					out[i].type = s->geom.is_text_sdf ? VA_TYPE_TEXT_SDF : VA_TYPE_TEXT;
 				} else {
 					CF_ASSERT(false);
 				}
 				out[i].color = s->geom.color;
 				out[i].attributes = geom.user_params;
+				out[i].not_used = s_atlas_layer(s->texture_id);
 			}
 
 			out[0].posH = geom.a;
@@ -351,101 +711,671 @@ static void s_draw_report(spritebatch_sprite_t* sprites, int count, int texture_
 		
 			vert_count += 3;
 		}	break;
+
+		case BATCH_GEOMETRY_TYPE_PARTICLES:
+			// Emitters are drawn from their own mesh by `s_draw_particles`, never as vertices.
+			CF_ASSERT(false);
+			break;
+		}
+
+		if (needs_clipping) {
+			vert_count = first_vert + s_clip_vertices(out, vert_count - first_vert, geom.clip);
+		}
+
+		float depth = s_layer_depth(s->sort_bits);
+		for (int j = first_vert; j < vert_count; ++j) {
+			verts[j].depth = depth;
 		}
 	}
 
-	// Allow users to optionally modulate vertices.
-	if (draw->vertex_fn) {
-		draw->vertex_fn(verts, vert_count);
+	return vert_count;
+}
+
+static void s_vertex_job(void* udata)
+{
+	CF_VertexJob* job = (CF_VertexJob*)udata;
+	job->vert_count = s_fill_vertices(job->sprites, job->count, job->verts);
+}
+
+static int s_fill_vertices_parallel(spritebatch_sprite_t* sprites, int count, CF_Vertex* verts)
+{
+	// Each job gets a disjoint slice of sprites, and writes to the matching disjoint slice of verts.
+	int job_count = min(cf_core_count(), count);
+	int sprites_per_job = (count + job_count - 1) / job_count;
+	job_count = (count + sprites_per_job - 1) / sprites_per_job;
+	draw->vertex_jobs.ensure_count(job_count);
+	int first_vert = 0;
+	for (int i = 0; i < job_count; ++i) {
+		CF_VertexJob* job = draw->vertex_jobs + i;
+		int first = i * sprites_per_job;
+		job->sprites = sprites + first;
+		job->count = min(sprites_per_job, count - first);
+		job->verts = verts + first_vert;
+		job->vert_count = 0;
+		first_vert += s_vertex_capacity(job->sprites, job->count);
+		cf_threadpool_add_task(app->threadpool, s_vertex_job, job);
 	}
+	cf_threadpool_kick_and_wait(app->threadpool);
 
-	// Apply viewport.
-	Rect viewport = draw->viewports.last();
-	if (viewport.w >= 0 && viewport.h >= 0) {
-		cf_apply_viewport(viewport.x, viewport.y, viewport.w, viewport.h);
+	// Slices can contain fewer verts than they have room for, so pack them together in order. The output
+	// is identical to running s_fill_vertices in one go.
+	int vert_count = 0;
+	for (int i = 0; i < job_count; ++i) {
+		CF_VertexJob* job = draw->vertex_jobs + i;
+		if (job->verts != verts + vert_count) {
+			CF_MEMMOVE(verts + vert_count, job->verts, sizeof(CF_Vertex) * job->vert_count);
+		}
+		vert_count += job->vert_count;
 	}
+	return vert_count;
+}
 
-	// Apply scissor.
-	Rect scissor = draw->scissors.last();
-	if (scissor.w >= 0 && scissor.h >= 0) {
-		cf_apply_scissor(scissor.x, scissor.y, scissor.w, scissor.h);
+// Converts to the compact sprite layout. Returns false if any vertex needs the full layout, e.g. an
+// SDF shape, or a UV outside [0, 1] that can't be represented as a normalized integer.
+static bool s_pack_sprite_vertices(const CF_Vertex* verts, int count, CF_SpriteVertex* out)
+{
+	for (int i = 0; i < count; ++i) {
+		const CF_Vertex* v = verts + i;
+		if (v->type != VA_TYPE_SPRITE && v->type != VA_TYPE_TEXT && v->type != VA_TYPE_TEXT_SDF) return false;
+		if (v->uv.x < 0 || v->uv.x > 1.0f || v->uv.y < 0 || v->uv.y > 1.0f) return false;
+		CF_SpriteVertex* o = out + i;
+		o->p = v->p;
+		o->posH = v->posH;
+		o->uv[0] = (uint16_t)(v->uv.x * 65535.0f + 0.5f);
+		o->uv[1] = (uint16_t)(v->uv.y * 65535.0f + 0.5f);
+		o->color = v->color;
+		o->type = v->type;
+		o->alpha = v->alpha;
+		o->fill = v->fill;
+		o->not_used = v->not_used;
+		o->attributes = v->attributes;
+		o->depth = v->depth;
 	}
+	return true;
+}
 
-	// Map the vertex buffer with sprite vertex data.
-	cf_mesh_append_vertex_data(draw->mesh, verts, vert_count);
-	cf_apply_mesh(draw->mesh);
+static void s_submit_draw(CF_Mesh mesh, CF_Texture atlas, int texture_w, int texture_h, SpriteShaderVariant variant, bool opaque);
 
-	// Apply the atlas texture.
-	CF_Texture atlas = { sprites->texture_id };
-	cf_material_set_texture_fs(draw->material, "u_image", atlas);
+// Picks the smallest variant of the default shader able to draw every sprite in a batch.
+static SpriteShaderVariant s_sprite_shader_variant(const spritebatch_sprite_t* sprites, int count)
+{
+	// Batches never mix atlas array layers with other textures, see `SPRITEBATCH_BATCH_KEY`.
+	if (count && CF_IS_ATLAS_LAYER(sprites->texture_id)) return SPRITE_SHADER_VARIANT_ARRAY;
+	bool textured = false;
+	bool shapes = false;
+	for (int i = 0; i < count && !(textured && shapes); ++i) {
+		if (sprites[i].geom.type == BATCH_GEOMETRY_TYPE_SPRITE) {
+			textured = true;
+		} else {
+			shapes = true;
+		}
+	}
+	if (textured && shapes) return SPRITE_SHADER_VARIANT_ALL;
+	return textured ? SPRITE_SHADER_VARIANT_SPRITES : SPRITE_SHADER_VARIANT_SHAPES;
+}
 
-	// Apply uniforms.
-	v2 u_texture_size = cf_v2((float)texture_w, (float)texture_h);
-	cf_material_set_uniform_fs(draw->material, "fs_params", "u_texture_size", &u_texture_size, CF_UNIFORM_TYPE_FLOAT2, 1);
-	v2 u_texel_size = cf_v2(1.0f / (float)texture_w, 1.0f / (float)texture_h);
-	cf_material_set_uniform_fs(draw->material, "fs_params", "u_texel_size", &u_texel_size, CF_UNIFORM_TYPE_FLOAT2, 1);
+// Whether a run of sprites can be drawn as instances of `CF_Draw::quad_mesh`, see `s_draw_instances`. Every
+// sprite has to be a single quad, and nothing may need the expanded vertices: vertex callbacks, debug modes,
+// custom shaders, atlas array pages and shapes clipped into polygons all stay on the vertex path.
+static bool s_can_draw_instanced(const spritebatch_sprite_t* sprites, int count)
+{
+	if (draw->vertex_fn || draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) return false;
+	if (draw->shaders.last().id != draw->shaders[0].id) return false;
+	if (CF_IS_ATLAS_LAYER(sprites->texture_id)) return false;
+	for (int i = 0; i < count; ++i) {
+		const BatchGeometry& geom = sprites[i].geom;
+		switch (geom.type) {
+		case BATCH_GEOMETRY_TYPE_SPRITE:
+			if (geom.do_clipping && !s_is_upright(geom)) return false;
+			break;
+		case BATCH_GEOMETRY_TYPE_TRI_SDF:
+		case BATCH_GEOMETRY_TYPE_QUAD:
+		case BATCH_GEOMETRY_TYPE_CIRCLE:
+		case BATCH_GEOMETRY_TYPE_CAPSULE:
+			if (geom.do_clipping) return false;
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
 
-	// Apply render state.
-	cf_material_set_render_state(draw->material, draw->render_states.last());
+// Fills one instance per sprite, the counterpart of `s_fill_vertices` for runs passing `s_can_draw_instanced`.
+// Sprites clipped away entirely are skipped. Returns the number of instances written.
+static int s_fill_instances(spritebatch_sprite_t* sprites, int count, CF_QuadInstance* instances)
+{
+	int instance_count = 0;
+	for (int i = 0; i < count; ++i) {
+		spritebatch_sprite_t* s = sprites + i;
+		BatchGeometry geom = s->geom;
+		CF_QuadInstance* out = instances + instance_count;
+		CF_MEMSET(out, 0, sizeof(*out));
 
-	// Kick off a draw call.
-	cf_apply_shader(draw->shaders.last(), draw->material);
-	cf_draw_elements();
+		if (geom.type == BATCH_GEOMETRY_TYPE_SPRITE) {
+			if (geom.do_clipping && !s_clip_upright_sprite(s, &geom)) {
+				continue;
+			}
+			out->posH[0] = geom.a;
+			out->posH[1] = geom.b;
+			out->posH[2] = geom.c;
+			out->posH[3] = geom.d;
+			out->uv_min = V2(s->minx, s->miny);
+			out->uv_max = V2(s->maxx, s->maxy);
+			if (geom.is_sprite) {
+				out->type = VA_TYPE_SPRITE;
+			} else {
+				out->type = geom.is_text_sdf ? VA_TYPE_TEXT_SDF : VA_TYPE_TEXT;
+			}
+		} else {
+			for (int j = 0; j < 4; ++j) {
+				out->p[j] = geom.box[j];
+				out->posH[j] = geom.boxH[j];
+			}
+			out->a = geom.a;
+			out->b = geom.b;
+			out->c = geom.c;
+			out->radius = geom.radius;
+			out->stroke = geom.stroke;
+			out->aa = geom.aa;
+			out->fill = geom.fill ? 255 : 0;
+			switch (geom.type) {
+			case BATCH_GEOMETRY_TYPE_TRI_SDF: out->type = VA_TYPE_TRIANGLE_SDF; break;
+			case BATCH_GEOMETRY_TYPE_QUAD: out->type = VA_TYPE_BOX; break;
+			default: out->type = VA_TYPE_SEGMENT; break; // Circles and capsules.
+			}
+		}
+		out->color = geom.color;
+		out->alpha = (uint8_t)(geom.alpha * 255.0f);
+		out->attributes = geom.user_params;
+		out->depth = s_layer_depth(s->sort_bits);
+		instance_count++;
+	}
+	return instance_count;
 }
 
-//--------------------------------------------------------------------------------------------------
-// Hidden API called by CF_App.
-
-static void s_init_sb(int w, int h)
+// Draws a run passing `s_can_draw_instanced` with one draw call, uploading a `CF_QuadInstance` per sprite
+// instead of six vertices.
+static void s_draw_instances(spritebatch_sprite_t* sprites, int count, int texture_w, int texture_h, bool opaque)
 {
-	spritebatch_config_t config;
-	spritebatch_set_default_config(&config);
-	config.atlas_use_border_pixels = 1;
-	config.ticks_to_decay_texture = 100000;
-	config.batch_callback = s_draw_report;
-	config.get_pixels_callback = cf_get_pixels;
-	config.generate_texture_callback = cf_generate_texture_handle;
-	config.delete_texture_callback = cf_destroy_texture_handle;
-	config.allocator_context = NULL;
-	config.lonely_buffer_count_till_flush = 0;
-	config.atlas_height_in_pixels = w;
-	config.atlas_width_in_pixels = h;
+	draw->quad_instances.ensure_count(count);
+	int instance_count = s_fill_instances(sprites, count, draw->quad_instances.data());
+	if (!instance_count) return;
+	cf_mesh_append_instance_data(draw->quad_mesh, draw->quad_instances.data(), instance_count);
+	CF_Texture atlas = s_atlas_texture(sprites->texture_id);
+	s_submit_draw(draw->quad_mesh, atlas, texture_w, texture_h, SPRITE_SHADER_VARIANT_INSTANCED, opaque);
+}
 
-	if (spritebatch_init(&draw->sb, &config, NULL)) {
-		CF_FREE(draw);
-		draw = NULL;
-		CF_ASSERT(false);
+// Works out why the first batch of a flush onto `canvas` can't join the last batch drawn, see
+// `cf_draw_get_batch_breaks`.
+static void s_track_flush(CF_Canvas canvas)
+{
+	CF_BatchTracker* t = &draw->batch_tracker;
+	CF_Shader shader = draw->shaders.last();
+	Rect scissor = draw->scissors.last();
+	Rect viewport = draw->viewports.last();
+	const CF_RenderState& render_state = draw->render_states.last();
+	if (!t->has_flush || t->canvas_id != canvas.id) {
+		t->flush_reason = CF_BATCH_BREAK_REASON_CANVAS;
+	} else if (t->shader_id != shader.id) {
+		t->flush_reason = CF_BATCH_BREAK_REASON_SHADER;
+	} else if (CF_MEMCMP(&t->scissor, &scissor, sizeof(scissor))) {
+		t->flush_reason = CF_BATCH_BREAK_REASON_SCISSOR;
+	} else if (CF_MEMCMP(&t->viewport, &viewport, sizeof(viewport))) {
+		t->flush_reason = CF_BATCH_BREAK_REASON_VIEWPORT;
+	} else if (CF_MEMCMP(&t->render_state, &render_state, sizeof(render_state))) {
+		t->flush_reason = CF_BATCH_BREAK_REASON_RENDER_STATE;
+	} else {
+		t->flush_reason = CF_BATCH_BREAK_REASON_FLUSH;
+	}
+	t->has_flush = true;
+	t->has_batch = false;
+	t->canvas_id = canvas.id;
+	t->shader_id = shader.id;
+	t->scissor = scissor;
+	t->viewport = viewport;
+	t->render_state = render_state;
+}
+
+// Records a batch in `batch_breaks`, and returns its color for `CF_DRAW_DEBUG_MODE_BATCHES`.
+static CF_Color s_track_batch(const spritebatch_sprite_t* sprites, int count, bool opaque, CF_BatchBreakReason reason)
+{
+	CF_BatchTracker* t = &draw->batch_tracker;
+	if (reason != CF_BATCH_BREAK_REASON_STATIC) {
+		if (!t->has_batch) {
+			reason = t->flush_reason;
+		} else if (opaque != t->opaque) {
+			reason = CF_BATCH_BREAK_REASON_OPAQUE;
+		} else if (sprites->sort_bits != t->layer) {
+			reason = CF_BATCH_BREAK_REASON_LAYER;
+		} else {
+			reason = CF_BATCH_BREAK_REASON_TEXTURE;
+		}
+		t->has_batch = true;
+		t->texture_id = sprites->texture_id;
+		t->layer = sprites[count - 1].sort_bits;
+		t->opaque = opaque;
 	}
+
+	// Stepping the hue by the golden ratio keeps neighboring batches far apart in color.
+	CF_BatchBreak b;
+	float hue = (float)draw->batch_breaks.count() * 0.618034f;
+	b.reason = reason;
+	b.sprite_count = reason == CF_BATCH_BREAK_REASON_STATIC ? 0 : count;
+	b.layer = count ? sprites->sort_bits : 0;
+	b.color = cf_hsv_to_rgb(cf_make_color_rgb_f(hue - floorf(hue), 0.7f, 1.0f));
+	draw->batch_breaks.add(b);
+	return b.color;
 }
 
-void CF_Draw::reset_cam()
+// Flattens vertices into solid triangles for the debug modes, see `cf_draw_set_debug_mode`.
+static void s_debug_vertices(CF_Vertex* verts, int count, CF_DrawDebugMode mode, CF_Color batch_color)
 {
-	cam_stack.clear();
-	cam_stack.add(cf_make_identity());
-	mvp = projection;
-	draw->antialias_scale.set_count(1);
-	draw->set_aaf();
+	// Adding this up saturates red after 8 layers, green after 32 and blue after 128.
+	CF_Pixel color = mode == CF_DRAW_DEBUG_MODE_OVERDRAW ? cf_make_pixel_rgba(32, 8, 2, 255) : to_pixel(batch_color);
+	for (int i = 0; i < count; ++i) {
+		verts[i].type = VA_TYPE_TRIANGLE;
+		verts[i].color = color;
+		verts[i].alpha = 255;
+	}
 }
 
-// Sets the anti-alias factor, the width of roughly one pixel scaled.
-// This factor remains constant-size despite zooming in/out with the camera.
-void CF_Draw::set_aaf()
+// Draws a run of sprites sharing a texture, which are either all opaque or all translucent.
+static void s_draw_run(spritebatch_sprite_t* sprites, int count, int texture_w, int texture_h, bool opaque)
 {
-	float on_or_off = draw->antialias.last() ? 1.0f : 0.0f;
-	float inv_cam_scale = 1.0f / len(draw->cam_stack.last().m.y);
-	float scale = draw->antialias_scale.last();
-	aaf = scale * inv_cam_scale * on_or_off;
+	CF_Color debug_color = { };
+	if (draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) {
+		debug_color = s_track_batch(sprites, count, opaque, CF_BATCH_BREAK_REASON_TEXTURE);
+	}
+
+	// Pipelined frames only keep a copy of the batch here, vertices are filled in on a worker thread.
+	if (draw->pipeline_recording) {
+		CF_PipelinedFrame* frame = &draw->pipelined;
+		CF_PipelinedBatch batch;
+		batch.first = frame->sprites.count();
+		batch.count = count;
+		batch.first_vert = frame->vert_capacity;
+		frame->vert_capacity += s_vertex_capacity(sprites, count);
+		batch.texture_id = sprites->texture_id;
+		batch.texture_w = texture_w;
+		batch.texture_h = texture_h;
+		batch.vert_count = 0;
+		batch.compact = false;
+		batch.opaque = opaque;
+		batch.debug_color = debug_color;
+		batch.variant = SPRITE_SHADER_VARIANT_ALL;
+		batch.particles = -1;
+		frame->sprites.ensure_count(batch.first + count);
+		CF_MEMCPY(frame->sprites.data() + batch.first, sprites, sizeof(spritebatch_sprite_t) * count);
+		frame->batches.add(batch);
+		return;
+	}
+
+	if (s_can_draw_instanced(sprites, count)) {
+		s_draw_instances(sprites, count, texture_w, texture_h, opaque);
+		return;
+	}
+
+	draw->verts.ensure_count(s_vertex_capacity(sprites, count));
+	CF_Vertex* verts = draw->verts.data();
+
+	int vert_count;
+	if (app->threadpool && draw->parallel_vertex_threshold > 0 && count >= draw->parallel_vertex_threshold) {
+		vert_count = s_fill_vertices_parallel(sprites, count, verts);
+	} else {
+		vert_count = s_fill_vertices(sprites, count, verts);
+	}
+
+	// Allow users to optionally modulate vertices.
+	if (draw->vertex_fn) {
+		draw->vertex_fn(verts, vert_count);
+	}
+	if (draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) {
+		s_debug_vertices(verts, vert_count, draw->debug_mode, debug_color);
+	}
+
+	// Map the vertex buffer with sprite vertex data. Plain sprite/text batches go through the compact
+	// layout to roughly halve the upload size.
+	CF_Mesh mesh;
+	draw->sprite_verts.ensure_count(vert_count);
+	if (s_pack_sprite_vertices(verts, vert_count, draw->sprite_verts.data())) {
+		cf_mesh_append_vertex_data(draw->sprite_mesh, draw->sprite_verts.data(), vert_count);
+		mesh = draw->sprite_mesh;
+	} else {
+		cf_mesh_append_vertex_data(draw->mesh, verts, vert_count);
+		mesh = draw->mesh;
+	}
+
+	CF_Texture atlas = s_atlas_texture(sprites->texture_id);
+	s_submit_draw(mesh, atlas, texture_w, texture_h, s_sprite_shader_variant(sprites, count), opaque);
 }
 
-void cf_make_draw()
-{
-	draw = CF_NEW(CF_Draw);
-	draw->projection = ortho_2d(0, 0, (float)app->w, (float)app->h);
-	draw->reset_cam();
+// Each vertex of the unit quad weighs the corners a, b, c and d of an instance, with the two triangles laid out
+// as in `s_fill_vertices`. Shared by `CF_Draw::quad_mesh` and every particle emitter's mesh.
+static float s_quad_corners[6][4] = {
+	{ 1, 0, 0, 0 },
+	{ 0, 0, 0, 1 },
+	{ 0, 1, 0, 0 },
+	{ 0, 1, 0, 0 },
+	{ 0, 0, 0, 1 },
+	{ 0, 0, 1, 0 },
+};
 
+// Makes the mesh an emitter's particles are drawn from, the unit quad plus a `CF_ParticleInstance` per particle.
+static CF_Mesh s_make_particle_mesh(int capacity)
+{
+	CF_Mesh mesh = cf_make_mesh(CF_USAGE_TYPE_STREAM, sizeof(s_quad_corners), 0, capacity * (int)sizeof(CF_ParticleInstance));
+	CF_VertexAttribute attrs[2] = { };
+	attrs[0].name = "in_corner";
+	attrs[0].format = CF_VERTEX_FORMAT_FLOAT4;
+	attrs[0].offset = 0;
+	attrs[1].name = "in_particle";
+	attrs[1].format = CF_VERTEX_FORMAT_FLOAT3;
+	attrs[1].offset = 0;
+	attrs[1].step_type = CF_ATTRIBUTE_STEP_PER_INSTANCE;
+	cf_mesh_set_attributes(mesh, attrs, CF_ARRAY_SIZE(attrs), sizeof(float) * 4, sizeof(CF_ParticleInstance));
+	cf_mesh_update_vertex_data(mesh, s_quad_corners, CF_ARRAY_SIZE(s_quad_corners));
+	return mesh;
+}
+
+void cf_draw_destroy_particle_mesh(CF_Mesh mesh)
+{
+	// Without a draw the app and every GPU resource are already gone.
+	if (!draw) return;
+	if (draw->pipelined.pending) {
+		draw->pipelined.dead_meshes.add(mesh);
+	} else {
+		cf_destroy_mesh(mesh);
+	}
+}
+
+// Sets an emitter's uniforms on the draw material and issues its instanced draw call.
+static void s_submit_particles(CF_ParticleBatch& b, uint64_t texture_id, int texture_w, int texture_h, SpriteShaderVariant variant)
+{
+	CF_Material material = draw->material;
+	cf_material_set_uniform_vs(material, "particle_params", "u_mvp", b.mvp, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_mvp_p", b.mvp_p, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_size", b.size, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_color_start", &b.color_start, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_color_end", &b.color_end, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_tint", &b.tint, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_uv_rect", b.uv_rect, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_user_params", &b.user_params, CF_UNIFORM_TYPE_FLOAT4, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_aa", &b.aa, CF_UNIFORM_TYPE_FLOAT, 1);
+	cf_material_set_uniform_vs(material, "particle_params", "u_layer", &b.layer, CF_UNIFORM_TYPE_FLOAT, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_clip", &b.clip, CF_UNIFORM_TYPE_FLOAT4, 1);
+	s_submit_draw(b.mesh, s_atlas_texture(texture_id), texture_w, texture_h, variant, false);
+}
+
+// Draws an emitter from `cf_draw_particles` with one instanced draw call from its own mesh. Particles are simulated
+// on the CPU, so each frame they're uploaded once as a position and age per particle, and the vertex shader works
+// out the rest from the emitter's params. `placeholder` carries the layer, clip box and atlas UVs of the image.
+static void s_draw_particles(const spritebatch_sprite_t* placeholder, int texture_w, int texture_h)
+{
+	const CF_ParticleDraw& pd = draw->particle_draws[placeholder->geom.particle_draw];
+	CF_ParticleEmitterInternal* e = pd.emitter;
+	if (!e->count) return;
+	if (draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) {
+		s_track_batch(placeholder, 1, false, CF_BATCH_BREAK_REASON_TEXTURE);
+	}
+
+	// Buffers can only be updated once a frame, so drawing an emitter again in the same frame reuses the upload.
+	if (!e->mesh.id) e->mesh = s_make_particle_mesh(e->capacity);
+	if (e->upload_frame != draw->frame) {
+		draw->particle_instances.ensure_count(e->count);
+		CF_ParticleInstance* instances = draw->particle_instances.data();
+		for (int i = 0; i < e->count; ++i) {
+			instances[i].p = V2(e->px[i], e->py[i]);
+			instances[i].t = cf_clamp01(e->age[i] / e->lifetime[i]);
+		}
+		cf_mesh_update_instance_data(e->mesh, instances, e->count);
+		e->upload_frame = draw->frame;
+	}
+
+	const CF_ParticleParams& params = e->params;
+	bool sprite = e->image_id != 0;
+	CF_M3x2 m = pd.mvp;
+	CF_ParticleBatch b;
+	b.mesh = e->mesh;
+	b.mvp[0] = m.m.x.x;
+	b.mvp[1] = m.m.x.y;
+	b.mvp[2] = m.m.y.x;
+	b.mvp[3] = m.m.y.y;
+	b.mvp_p[0] = m.p.x;
+	b.mvp_p[1] = m.p.y;
+	b.mvp_p[2] = s_layer_depth(placeholder->sort_bits);
+	b.mvp_p[3] = sprite ? 1.0f : 0.0f;
+	// Sprites span the same quad as `cf_draw_sprite`, grown to cover the image's border pixels in the atlas.
+	// Circles are sized by their radius alone.
+	b.size[0] = sprite ? (float)(e->image_w + 2) * 0.5f : 0;
+	b.size[1] = sprite ? (float)(e->image_h + 2) * 0.5f : 0;
+	b.size[2] = params.size_start;
+	b.size[3] = params.size_end;
+	b.color_start = params.color_start;
+	b.color_end = params.color_end;
+	b.tint = pd.tint;
+	// Circles sample uv 0 like the other shapes, a cleared border texel, rather than the placeholder's image.
+	b.uv_rect[0] = sprite ? placeholder->minx : 0;
+	b.uv_rect[1] = sprite ? placeholder->miny : 0;
+	b.uv_rect[2] = sprite ? placeholder->maxx : 0;
+	b.uv_rect[3] = sprite ? placeholder->maxy : 0;
+	b.user_params = pd.user_params;
+	b.aa = pd.aaf;
+	b.layer = (float)s_atlas_layer(placeholder->texture_id) / 255.0f;
+	b.clip = placeholder->geom.do_clipping ? placeholder->geom.clip : make_aabb(V2(-FLT_MAX, -FLT_MAX), V2(FLT_MAX, FLT_MAX));
+	SpriteShaderVariant variant = CF_IS_ATLAS_LAYER(placeholder->texture_id) ? SPRITE_SHADER_VARIANT_PARTICLES_ARRAY : SPRITE_SHADER_VARIANT_PARTICLES;
+
+	// Pipelined frames draw from the emitter's mesh as they're submitted, the instances are already uploaded.
+	if (draw->pipeline_recording) {
+		CF_PipelinedFrame* frame = &draw->pipelined;
+		CF_PipelinedBatch batch = { };
+		batch.first = frame->sprites.count();
+		batch.first_vert = frame->vert_capacity;
+		batch.texture_id = placeholder->texture_id;
+		batch.texture_w = texture_w;
+		batch.texture_h = texture_h;
+		batch.variant = variant;
+		batch.particles = frame->particles.count();
+		frame->particles.add(b);
+		frame->batches.add(batch);
+		return;
+	}
+
+	s_submit_particles(b, placeholder->texture_id, texture_w, texture_h, variant);
+}
+
+static void s_draw_report(spritebatch_sprite_t* sprites, int count, int texture_w, int texture_h, void* udata)
+{
+	CF_PROFILE_SCOPE("s_draw_report");
+	CF_UNUSED(udata);
+	draw->batch_count++;
+
+	// Opaque and translucent sprites sharing a texture may land in one batch, but need different render states.
+	// Particle emitters in the batch are drawn on their own, in order with the runs around them.
+	int first = 0;
+	for (int i = 0; i <= count; ++i) {
+		bool particles = i < count && sprites[i].geom.type == BATCH_GEOMETRY_TYPE_PARTICLES;
+		bool split = i == count || particles || (draw->opaque_pass && sprites[i].geom.opaque != sprites[first].geom.opaque);
+		if (!split) continue;
+		if (i > first) {
+			s_draw_run(sprites + first, i - first, texture_w, texture_h, draw->opaque_pass && sprites[first].geom.opaque);
+		}
+		if (particles) {
+			s_draw_particles(sprites + i, texture_w, texture_h);
+			first = i + 1;
+		} else {
+			first = i;
+		}
+	}
+}
+
+// Sorts opaque sprites front to back ahead of everything else, see `cf_draw_push_opaque`. Only
+// used while flushing with an opaque pass, otherwise spritebatch sorts by layer on its own.
+static void s_sort_opaque_first(spritebatch_sprite_t* sprites, int count)
+{
+	spritebatch_sprite_t* scratch = draw->sb.sprites_scratch;
+	int opaque_count = 0;
+	int translucent_count = 0;
+	for (int i = 0; i < count; ++i) {
+		if (sprites[i].geom.opaque) {
+			sprites[opaque_count++] = sprites[i];
+		} else {
+			scratch[translucent_count++] = sprites[i];
+		}
+	}
+	CF_MEMCPY(sprites + opaque_count, scratch, sizeof(spritebatch_sprite_t) * translucent_count);
+
+	// Reversing the usual back to front order draws the topmost opaque sprites first, so the depth
+	// test rejects whatever they cover. This keeps later sprites on top within a layer.
+	spritebatch_internal_merge_sort(sprites, scratch, opaque_count);
+	for (int i = 0, j = opaque_count - 1; i < j; ++i, --j) {
+		spritebatch_sprite_t t = sprites[i];
+		sprites[i] = sprites[j];
+		sprites[j] = t;
+	}
+	spritebatch_internal_merge_sort(sprites + opaque_count, scratch, translucent_count);
+}
+
+// Whether the current flush can draw opaque sprites in their own depth-tested pass.
+static bool s_opaque_pass_supported(CF_Canvas canvas)
+{
+	if (!draw->opaque_count || draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE || !cf_canvas_has_depth(canvas)) return false;
+	CF_Shader shader = draw->shaders.last();
+	if (shader.id != draw->shaders[0].id) return cf_shader_has_vertex_input(shader, "in_depth");
+	for (int i = 0; i < SPRITE_SHADER_VARIANT_COUNT; ++i) {
+		// Particles take their depth from a uniform instead.
+		if (i == SPRITE_SHADER_VARIANT_PARTICLES || i == SPRITE_SHADER_VARIANT_PARTICLES_ARRAY) continue;
+		if (!cf_shader_has_vertex_input(draw->sprite_shader_variants[i], "in_depth")) return false;
+	}
+	return true;
+}
+
+// Runs `spritebatch_flush`, with an opaque pass if `opaque_pass` is set.
+static void s_flush_sb(bool opaque_pass)
+{
+	draw->opaque_pass = opaque_pass;
+	draw->sb.sprites_sorter_callback = opaque_pass ? s_sort_opaque_first : NULL;
+	spritebatch_flush(&draw->sb);
+	draw->sb.sprites_sorter_callback = NULL;
+	draw->opaque_pass = false;
+	draw->opaque_count = 0;
+}
+
+// Applies the current render settings and issues one draw call for `mesh`, sampling from `atlas`.
+static void s_submit_draw(CF_Mesh mesh, CF_Texture atlas, int texture_w, int texture_h, SpriteShaderVariant variant, bool opaque)
+{
+	// Apply viewport.
+	Rect viewport = draw->viewports.last();
+	if (viewport.w >= 0 && viewport.h >= 0) {
+		cf_apply_viewport(viewport.x, viewport.y, viewport.w, viewport.h);
+	}
+
+	// Apply scissor.
+	Rect scissor = draw->scissors.last();
+	if (scissor.w >= 0 && scissor.h >= 0) {
+		cf_apply_scissor(scissor.x, scissor.y, scissor.w, scissor.h);
+	}
+
+	cf_apply_mesh(mesh);
+
+	// Apply the atlas texture.
+	cf_material_set_texture_fs(draw->material, "u_image", atlas);
+
+	// Apply uniforms.
+	if (texture_w != draw->uniform_texture_w || texture_h != draw->uniform_texture_h) {
+		v2 u_texture_size = cf_v2((float)texture_w, (float)texture_h);
+		cf_material_set_uniform_fs(draw->material, "fs_params", "u_texture_size", &u_texture_size, CF_UNIFORM_TYPE_FLOAT2, 1);
+		v2 u_texel_size = cf_v2(1.0f / (float)texture_w, 1.0f / (float)texture_h);
+		cf_material_set_uniform_fs(draw->material, "fs_params", "u_texel_size", &u_texel_size, CF_UNIFORM_TYPE_FLOAT2, 1);
+		draw->uniform_texture_w = texture_w;
+		draw->uniform_texture_h = texture_h;
+	}
+
+	// Apply render state. In an opaque pass opaque sprites fill the depth buffer without blending,
+	// and everything else is depth-tested against them.
+	CF_RenderState state = draw->render_states.last();
+	if (draw->opaque_pass) {
+		state.depth_write_enabled = opaque;
+		state.depth_compare = opaque ? CF_COMPARE_FUNCTION_LESS_THAN : CF_COMPARE_FUNCTION_LESS_THAN_OR_EQUAL;
+		if (opaque) state.blend.enabled = false;
+	}
+	if (draw->debug_mode == CF_DRAW_DEBUG_MODE_OVERDRAW) {
+		state.blend.enabled = true;
+		state.blend.rgb_op = CF_BLEND_OP_ADD;
+		state.blend.rgb_src_blend_factor = CF_BLENDFACTOR_ONE;
+		state.blend.rgb_dst_blend_factor = CF_BLENDFACTOR_ONE;
+		state.blend.alpha_op = CF_BLEND_OP_ADD;
+		state.blend.alpha_src_blend_factor = CF_BLENDFACTOR_ONE;
+		state.blend.alpha_dst_blend_factor = CF_BLENDFACTOR_ONE;
+	}
+	cf_material_set_render_state(draw->material, state);
+
+	// Kick off a draw call. Custom shaders are used as-is, only the default one has variants. Debug
+	// modes draw flat triangles, which only the default shader's full variants know about. Particle
+	// meshes only fit the particle variants, so those are always used.
+	CF_Shader shader = draw->shaders.last();
+	if (variant == SPRITE_SHADER_VARIANT_PARTICLES || variant == SPRITE_SHADER_VARIANT_PARTICLES_ARRAY) {
+		shader = draw->sprite_shader_variants[variant];
+	} else if (draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) {
+		shader = draw->sprite_shader_variants[variant == SPRITE_SHADER_VARIANT_ARRAY ? variant : SPRITE_SHADER_VARIANT_ALL];
+	} else if (shader.id == draw->shaders[0].id) {
+		shader = draw->sprite_shader_variants[variant];
+	}
+	cf_apply_shader(shader, draw->material);
+	cf_draw_elements();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Hidden API called by CF_App.
+
+static void s_init_sb(int w, int h)
+{
+	spritebatch_config_t config;
+	spritebatch_set_default_config(&config);
+	config.atlas_use_border_pixels = 1;
+	config.ticks_to_decay_texture = 100000;
+	config.batch_callback = s_draw_report;
+	config.get_pixels_callback = cf_get_pixels;
+	config.generate_texture_callback = cf_generate_texture_handle;
+	config.delete_texture_callback = cf_destroy_texture_handle;
+	config.allocator_context = NULL;
+	config.lonely_buffer_count_till_flush = 0;
+	config.atlas_height_in_pixels = w;
+	config.atlas_width_in_pixels = h;
+
+	if (spritebatch_init(&draw->sb, &config, NULL)) {
+		CF_FREE(draw);
+		draw = NULL;
+		CF_ASSERT(false);
+	}
+	spritebatch_set_atlas_limit(&draw->sb, s_atlas_page_limit());
+}
+
+void CF_Draw::reset_cam()
+{
+	cam_stack.clear();
+	cam_stack.add(cf_make_identity());
+	mvp = projection;
+	draw->antialias_scale.set_count(1);
+	draw->set_aaf();
+}
+
+// Sets the anti-alias factor, the width of roughly one pixel scaled.
+// This factor remains constant-size despite zooming in/out with the camera.
+void CF_Draw::set_aaf()
+{
+	float on_or_off = draw->antialias.last() ? 1.0f : 0.0f;
+	float inv_cam_scale = 1.0f / len(draw->cam_stack.last().m.y);
+	float scale = draw->antialias_scale.last();
+	aaf = scale * inv_cam_scale * on_or_off;
+}
+
+static void s_make_draw_gpu_resources()
+{
 	// Mesh + vertex attributes.
-	draw->mesh = cf_make_mesh(CF_USAGE_TYPE_STREAM, CF_MB * 25, 0, 0);
-	CF_VertexAttribute attrs[12] = { };
+	// These start small and grow on demand, see `cf_mesh_append_vertex_data`.
+	draw->mesh = cf_make_mesh(CF_USAGE_TYPE_STREAM, CF_MB * 2, 0, 0);
+	CF_VertexAttribute attrs[13] = { };
 	attrs[0].name = "in_pos";
 	attrs[0].format = CF_VERTEX_FORMAT_FLOAT2;
 	attrs[0].offset = CF_OFFSET_OF(CF_Vertex, p);
@@ -482,10 +1412,106 @@ void cf_make_draw()
 	attrs[11].name = "in_user_params";
 	attrs[11].format = CF_VERTEX_FORMAT_FLOAT4;
 	attrs[11].offset = CF_OFFSET_OF(CF_Vertex, attributes);
+	attrs[12].name = "in_depth";
+	attrs[12].format = CF_VERTEX_FORMAT_FLOAT;
+	attrs[12].offset = CF_OFFSET_OF(CF_Vertex, depth);
 	cf_mesh_set_attributes(draw->mesh, attrs, CF_ARRAY_SIZE(attrs), sizeof(CF_Vertex), 0);
+	CF_MEMCPY(draw->vertex_attributes, attrs, sizeof(attrs));
+
+	// Compact mesh for sprite/text batches. The shader still expects the SDF inputs, but never reads
+	// them for sprites or text, so they alias the position.
+	draw->sprite_mesh = cf_make_mesh(CF_USAGE_TYPE_STREAM, CF_MB, 0, 0);
+	attrs[0].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[1].offset = CF_OFFSET_OF(CF_SpriteVertex, posH);
+	attrs[2].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[3].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[4].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[5].format = CF_VERTEX_FORMAT_USHORT2N;
+	attrs[5].offset = CF_OFFSET_OF(CF_SpriteVertex, uv);
+	attrs[6].offset = CF_OFFSET_OF(CF_SpriteVertex, color);
+	attrs[7].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[8].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[9].offset = CF_OFFSET_OF(CF_SpriteVertex, p);
+	attrs[10].offset = CF_OFFSET_OF(CF_SpriteVertex, type);
+	attrs[11].offset = CF_OFFSET_OF(CF_SpriteVertex, attributes);
+	attrs[12].offset = CF_OFFSET_OF(CF_SpriteVertex, depth);
+	cf_mesh_set_attributes(draw->sprite_mesh, attrs, CF_ARRAY_SIZE(attrs), sizeof(CF_SpriteVertex), 0);
+
+	// Unit quad for instanced batches, see `s_draw_instances`.
+	draw->quad_mesh = cf_make_mesh(CF_USAGE_TYPE_STREAM, sizeof(float) * 4 * 6, 0, CF_MB);
+	CF_VertexAttribute quad_attrs[13] = { };
+	quad_attrs[0].name = "in_corner";
+	quad_attrs[0].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[0].offset = 0;
+	quad_attrs[1].name = "in_pos_ab";
+	quad_attrs[1].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[1].offset = CF_OFFSET_OF(CF_QuadInstance, p[0]);
+	quad_attrs[2].name = "in_pos_cd";
+	quad_attrs[2].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[2].offset = CF_OFFSET_OF(CF_QuadInstance, p[2]);
+	quad_attrs[3].name = "in_posH_ab";
+	quad_attrs[3].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[3].offset = CF_OFFSET_OF(CF_QuadInstance, posH[0]);
+	quad_attrs[4].name = "in_posH_cd";
+	quad_attrs[4].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[4].offset = CF_OFFSET_OF(CF_QuadInstance, posH[2]);
+	quad_attrs[5].name = "in_ab";
+	quad_attrs[5].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[5].offset = CF_OFFSET_OF(CF_QuadInstance, a);
+	quad_attrs[6].name = "in_c";
+	quad_attrs[6].format = CF_VERTEX_FORMAT_FLOAT2;
+	quad_attrs[6].offset = CF_OFFSET_OF(CF_QuadInstance, c);
+	quad_attrs[7].name = "in_uv_rect";
+	quad_attrs[7].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[7].offset = CF_OFFSET_OF(CF_QuadInstance, uv_min);
+	quad_attrs[8].name = "in_col";
+	quad_attrs[8].format = CF_VERTEX_FORMAT_UBYTE4N;
+	quad_attrs[8].offset = CF_OFFSET_OF(CF_QuadInstance, color);
+	quad_attrs[9].name = "in_shape";
+	quad_attrs[9].format = CF_VERTEX_FORMAT_FLOAT3;
+	quad_attrs[9].offset = CF_OFFSET_OF(CF_QuadInstance, radius);
+	quad_attrs[10].name = "in_params";
+	quad_attrs[10].format = CF_VERTEX_FORMAT_UBYTE4N;
+	quad_attrs[10].offset = CF_OFFSET_OF(CF_QuadInstance, type);
+	quad_attrs[11].name = "in_user_params";
+	quad_attrs[11].format = CF_VERTEX_FORMAT_FLOAT4;
+	quad_attrs[11].offset = CF_OFFSET_OF(CF_QuadInstance, attributes);
+	quad_attrs[12].name = "in_depth";
+	quad_attrs[12].format = CF_VERTEX_FORMAT_FLOAT;
+	quad_attrs[12].offset = CF_OFFSET_OF(CF_QuadInstance, depth);
+	for (int i = 1; i < (int)CF_ARRAY_SIZE(quad_attrs); ++i) {
+		quad_attrs[i].step_type = CF_ATTRIBUTE_STEP_PER_INSTANCE;
+	}
+	cf_mesh_set_attributes(draw->quad_mesh, quad_attrs, CF_ARRAY_SIZE(quad_attrs), sizeof(float) * 4, sizeof(CF_QuadInstance));
+	cf_mesh_update_vertex_data(draw->quad_mesh, s_quad_corners, CF_ARRAY_SIZE(s_quad_corners));
 
 	// Shaders.
-	draw->shaders.add(CF_MAKE_SOKOL_SHADER(sprite_shader));
+	CF_Shader shader = CF_MAKE_SOKOL_SHADER(sprite_shader);
+	draw->shaders.add(shader);
+	for (int i = 0; i < SPRITE_SHADER_VARIANT_COUNT; ++i) {
+		draw->sprite_shader_variants[i] = shader;
+	}
+	draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_SPRITES] = CF_MAKE_SOKOL_SHADER(sprite_sprites_shader);
+	draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_SHAPES] = CF_MAKE_SOKOL_SHADER(sprite_shapes_shader);
+	draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_ARRAY] = CF_MAKE_SOKOL_SHADER(sprite_array_shader);
+	draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_INSTANCED] = CF_MAKE_SOKOL_SHADER(sprite_instanced_shader);
+	draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_PARTICLES] = CF_MAKE_SOKOL_SHADER(sprite_particles_shader);
+	draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_PARTICLES_ARRAY] = CF_MAKE_SOKOL_SHADER(sprite_particles_array_shader);
+}
+
+void cf_make_draw()
+{
+	draw = CF_NEW(CF_Draw);
+	draw->projection = ortho_2d(0, 0, (float)app->w, (float)app->h);
+	draw->reset_cam();
+	draw->headless = !app->gfx_enabled;
+
+	// Headless draws accept and ignore all draw calls, so they skip every GPU resource.
+	if (draw->headless) {
+		draw->shaders.add(CF_Shader{ 0 });
+	} else {
+		s_make_draw_gpu_resources();
+	}
 
 	// Material.
 	draw->material = cf_make_material();
@@ -506,16 +1532,136 @@ void cf_make_draw()
 
 void cf_destroy_draw()
 {
+	if (draw->pipelined.pending && draw->pipelined.threaded) {
+		cf_threadpool_wait_job(app->threadpool, draw->pipelined.job);
+	}
 	spritebatch_term(&draw->sb);
-	cf_destroy_mesh(draw->mesh);
+	s_atlas_array_reset();
+	if (!draw->headless) {
+		cf_destroy_mesh(draw->mesh);
+		cf_destroy_mesh(draw->sprite_mesh);
+		cf_destroy_mesh(draw->quad_mesh);
+		for (int i = 0; i < draw->pipelined.dead_meshes.count(); ++i) {
+			cf_destroy_mesh(draw->pipelined.dead_meshes[i]);
+		}
+		for (int i = 0; i < SPRITE_SHADER_VARIANT_COUNT; ++i) {
+			if (draw->sprite_shader_variants[i].id != draw->shaders[0].id) {
+				cf_destroy_shader(draw->sprite_shader_variants[i]);
+			}
+		}
+		cf_destroy_shader(draw->shaders[0]);
+		if (draw->debug_mesh.id) {
+			cf_destroy_mesh(draw->debug_mesh);
+			cf_destroy_shader(draw->debug_shader);
+			cf_destroy_material(draw->debug_material);
+		}
+	}
+	for (int i = 0; i < draw->premade_textures.count(); ++i) {
+		cf_destroy_texture(draw->premade_textures[i]);
+	}
 	cf_destroy_material(draw->material);
-	cf_destroy_shader(draw->shaders[0]);
+	if (draw->pipelined.material.id) {
+		cf_destroy_material(draw->pipelined.material);
+	}
 	draw->~CF_Draw();
 	CF_FREE(draw);
 }
 
 //--------------------------------------------------------------------------------------------------
 
+// Returns true if the geometry's bounds, already transformed into clip space, lie entirely outside
+// of the canvas (and therefore the viewport, which clip space maps onto).
+static bool s_is_offscreen(const spritebatch_sprite_t& s)
+{
+	const CF_V2* p;
+	int count;
+	CF_V2 abc[4];
+	switch (s.geom.type) {
+	case BATCH_GEOMETRY_TYPE_SPRITE:
+		abc[0] = s.geom.a; abc[1] = s.geom.b; abc[2] = s.geom.c; abc[3] = s.geom.d;
+		p = abc;
+		count = 4;
+		break;
+	case BATCH_GEOMETRY_TYPE_TRI:
+		abc[0] = s.geom.a; abc[1] = s.geom.b; abc[2] = s.geom.c;
+		p = abc;
+		count = 3;
+		break;
+	case BATCH_GEOMETRY_TYPE_SEGMENT:
+		p = s.geom.boxH;
+		count = 3;
+		break;
+	default:
+		p = s.geom.boxH;
+		count = 4;
+		break;
+	}
+
+	CF_V2 lo = p[0], hi = p[0];
+	for (int i = 1; i < count; ++i) {
+		lo = cf_min_v2(lo, p[i]);
+		hi = cf_max_v2(hi, p[i]);
+	}
+	return hi.x < -1.0f || lo.x > 1.0f || hi.y < -1.0f || lo.y > 1.0f;
+}
+
+// Stores the clip box from `cf_draw_push_clip_box` in clip space, intersected with the text clip box if
+// there is one.
+static void s_apply_clip_box(BatchGeometry* geom)
+{
+	CF_Aabb box = draw->clip_boxes.last();
+	CF_M3x2 m = draw->mvp;
+	v2 p0 = mul(m, box.min);
+	v2 p1 = mul(m, box.max);
+	v2 p2 = mul(m, V2(box.min.x, box.max.y));
+	v2 p3 = mul(m, V2(box.max.x, box.min.y));
+	CF_Aabb clip = make_aabb(min(min(p0, p1), min(p2, p3)), max(max(p0, p1), max(p2, p3)));
+	if (geom->do_clipping) {
+		clip = make_aabb(max(clip.min, geom->clip.min), min(clip.max, geom->clip.max));
+	}
+	geom->clip = clip;
+	geom->do_clipping = true;
+}
+
+// Marks geometry drawn under `cf_draw_push_opaque` as opaque, unless it's see-through anyway.
+static void s_classify_opaque(BatchGeometry* geom)
+{
+	if (geom->is_text || geom->type == BATCH_GEOMETRY_TYPE_PARTICLES || geom->alpha < 1.0f) return;
+	if (geom->type != BATCH_GEOMETRY_TYPE_SPRITE && geom->color.colors.a != 255) return;
+	geom->opaque = true;
+	// Soft edges would need blending, so opaque shapes are drawn without antialiasing.
+	if (geom->type != BATCH_GEOMETRY_TYPE_SPRITE) geom->aa = 0;
+}
+
+// All draw functions go through here, so draw lists can capture sprites instead of batching them.
+CF_INLINE void s_push_sprite(const spritebatch_sprite_t& sprite)
+{
+	if (draw->headless) return;
+	const spritebatch_sprite_t* s = &sprite;
+	spritebatch_sprite_t copy;
+	bool clip = draw->clip_boxes.count() > 1;
+	bool opaque = draw->opaque.last();
+	if (clip || opaque) {
+		copy = sprite;
+		if (clip) s_apply_clip_box(&copy.geom);
+		if (opaque) s_classify_opaque(&copy.geom);
+		s = &copy;
+	}
+	if (draw->culling) {
+		draw->cull_stats.tested++;
+		if (s_is_offscreen(*s)) {
+			draw->cull_stats.culled++;
+			return;
+		}
+	}
+	if (draw->recording) {
+		draw->recorded.add(*s);
+	} else {
+		spritebatch_push(&draw->sb, *s);
+		if (s->geom.opaque) draw->opaque_count++;
+	}
+}
+
 void cf_draw_sprite(const CF_Sprite* sprite)
 {
 	spritebatch_sprite_t s = { };
@@ -562,18 +1708,18 @@ void cf_draw_sprite(const CF_Sprite* sprite)
 		quad[j].y = y;
 	}
 
-	CF_M3x2 m = draw->mvp;
-	s.geom.a = mul(m, quad[0]);
-	s.geom.b = mul(m, quad[1]);
-	s.geom.c = mul(m, quad[2]);
-	s.geom.d = mul(m, quad[3]);
+	cf_mul_m32_v2_batch(draw->mvp, quad, quad, 4);
+	s.geom.a = quad[0];
+	s.geom.b = quad[1];
+	s.geom.c = quad[2];
+	s.geom.d = quad[3];
 	s.geom.is_sprite = true;
 
 	s.geom.color = premultiply(to_pixel(draw->tints.last()));
 	s.geom.alpha = sprite->opacity;
 	s.geom.user_params = draw->user_params.last();
 	s.sort_bits = draw->layers.last();
-	spritebatch_push(&draw->sb, s);
+	s_push_sprite(s);
 }
 
 static void s_draw_quad(CF_V2 p0, CF_V2 p1, CF_V2 p2, CF_V2 p3, float stroke, float radius, bool fill)
@@ -599,10 +1745,7 @@ static void s_draw_quad(CF_V2 p0, CF_V2 p1, CF_V2 p2, CF_V2 p3, float stroke, fl
 	s.geom.box[1] = p1;
 	s.geom.box[2] = p2;
 	s.geom.box[3] = p3;
-	s.geom.boxH[0] = mul(m, p0);
-	s.geom.boxH[1] = mul(m, p1);
-	s.geom.boxH[2] = mul(m, p2);
-	s.geom.boxH[3] = mul(m, p3);
+	cf_mul_m32_v2_batch(m, s.geom.box, s.geom.boxH, 4);
 	s.geom.a = c;
 	s.geom.b = he;
 	s.geom.c = u;
@@ -615,7 +1758,7 @@ static void s_draw_quad(CF_V2 p0, CF_V2 p1, CF_V2 p2, CF_V2 p3, float stroke, fl
 	s.geom.aa = aaf;
 	s.geom.user_params = draw->user_params.last();
 	s.sort_bits = draw->layers.last();
-	spritebatch_push(&draw->sb, s);
+	s_push_sprite(s);
 }
 
 void cf_draw_quad(CF_Aabb bb, float thickness, float chubbiness)
@@ -681,10 +1824,7 @@ static void s_draw_circle(v2 position, float stroke, float radius, bool fill)
 	s.geom.box[1] = s.geom.box[1];
 	s.geom.box[2] = s.geom.box[2];
 	s.geom.box[3] = s.geom.box[3];
-	s.geom.boxH[0] = mul(m, s.geom.box[0]);
-	s.geom.boxH[1] = mul(m, s.geom.box[1]);
-	s.geom.boxH[2] = mul(m, s.geom.box[2]);
-	s.geom.boxH[3] = mul(m, s.geom.box[3]);
+	cf_mul_m32_v2_batch(m, s.geom.box, s.geom.boxH, 4);
 	s.geom.a = position;
 	s.geom.b = position;
 	s.geom.c = position;
@@ -697,7 +1837,38 @@ static void s_draw_circle(v2 position, float stroke, float radius, bool fill)
 	s.geom.aa = aaf;
 	s.geom.user_params = draw->user_params.last();
 	s.sort_bits = draw->layers.last();
-	spritebatch_push(&draw->sb, s);
+	s_push_sprite(s);
+}
+
+void cf_draw_particles(CF_ParticleEmitter emitter)
+{
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	if (draw->headless || !e->count) return;
+
+	CF_ParticleDraw pd;
+	pd.emitter = e;
+	pd.mvp = draw->mvp;
+	pd.tint = draw->tints.last();
+	pd.user_params = draw->user_params.last();
+	pd.aaf = draw->aaf;
+
+	// A single placeholder goes through the batcher, sorted by layer and atlas like any other sprite, and the
+	// whole emitter is drawn in its place, see `s_draw_particles`. Draw lists keep their own `particle_draws`,
+	// moved over as the list is submitted.
+	spritebatch_sprite_t s = { };
+	s.image_id = e->image_id ? e->image_id : app->default_image_id;
+	s.w = e->image_id ? e->image_w : 1;
+	s.h = e->image_id ? e->image_h : 1;
+	s.sort_bits = draw->layers.last();
+	s.geom.type = BATCH_GEOMETRY_TYPE_PARTICLES;
+	s.geom.particle_draw = draw->particle_draws.count();
+	if (draw->clip_boxes.count() > 1) s_apply_clip_box(&s.geom);
+	draw->particle_draws.add(pd);
+	if (draw->recording) {
+		draw->recorded.add(s);
+	} else {
+		spritebatch_push(&draw->sb, s);
+	}
 }
 
 void cf_draw_circle(CF_Circle circle, float thickness)
@@ -740,10 +1911,7 @@ static void s_draw_capsule(v2 a, v2 b, float stroke, float radius, bool fill)
 	s.geom.type = BATCH_GEOMETRY_TYPE_CAPSULE;
 
 	s_bounding_box_of_capsule(a, b, radius, stroke, s.geom.box);
-	s.geom.boxH[0] = mul(m, s.geom.box[0]);
-	s.geom.boxH[1] = mul(m, s.geom.box[1]);
-	s.geom.boxH[2] = mul(m, s.geom.box[2]);
-	s.geom.boxH[3] = mul(m, s.geom.box[3]);
+	cf_mul_m32_v2_batch(m, s.geom.box, s.geom.boxH, 4);
 	s.geom.a = a;
 	s.geom.b = b;
 	s.geom.c = a;
@@ -757,7 +1925,7 @@ static void s_draw_capsule(v2 a, v2 b, float stroke, float radius, bool fill)
 	s.geom.user_params = draw->user_params.last();
 	s.sort_bits = draw->layers.last();
 
-	spritebatch_push(&draw->sb, s);
+	s_push_sprite(s);
 }
 
 void cf_draw_capsule(CF_Capsule capsule, float thickness)
@@ -826,10 +1994,7 @@ static void s_cf_draw_tri(v2 a, v2 b, v2 c, float stroke, float radius, bool fil
 		s.geom.box[1] = s.geom.box[1];
 		s.geom.box[2] = s.geom.box[2];
 		s.geom.box[3] = s.geom.box[3];
-		s.geom.boxH[0] = mul(m, s.geom.box[0]);
-		s.geom.boxH[1] = mul(m, s.geom.box[1]);
-		s.geom.boxH[2] = mul(m, s.geom.box[2]);
-		s.geom.boxH[3] = mul(m, s.geom.box[3]);
+		cf_mul_m32_v2_batch(m, s.geom.box, s.geom.boxH, 4);
 		s.geom.a = a;
 		s.geom.b = b;
 		s.geom.c = c;
@@ -848,7 +2013,7 @@ static void s_cf_draw_tri(v2 a, v2 b, v2 c, float stroke, float radius, bool fil
 	s.geom.aa = draw->aaf;
 	s.geom.user_params = draw->user_params.last();
 	s.sort_bits = draw->layers.last();
-	spritebatch_push(&draw->sb, s);
+	s_push_sprite(s);
 }
 
 void cf_draw_tri(CF_V2 p0, CF_V2 p1, CF_V2 p2, float thickness, float chubbiness)
@@ -866,36 +2031,8 @@ void cf_draw_line(CF_V2 p0, CF_V2 p1, float thickness)
 	s_draw_capsule(p0, p1, 0, thickness, true);
 }
 
-void cf_draw_polyline(CF_V2* pts, int count, float thickness, bool loop)
+static void s_tessellate_polyline(const v2* pts, int count, float radius, bool loop, Array<CF_PolylineTri>* tris)
 {
-	float radius = thickness * 0.5f;
-
-	if (count <= 0) {
-		return;
-	} else if (count == 1) {
-		cf_draw_circle_fill2(pts[0], radius);
-	} else if (count == 2) {
-		cf_draw_capsule_fill2(pts[0], pts[1], radius);
-	}
-
-	// Each portion of the polyline will be rendered with a single triangle per spritebatch entry.
-	CF_M3x2 m = draw->mvp;
-	spritebatch_sprite_t s = { };
-	s.image_id = app->default_image_id;
-	s.geom.color = premultiply(to_pixel(cf_overlay_color(draw->colors.last(), draw->tints.last())));
-	s.geom.alpha = 1.0f;
-	s.geom.radius = radius;
-	s.geom.stroke = 0;
-	s.geom.fill = true;
-	s.geom.aa = draw->aaf;
-	s.geom.type = BATCH_GEOMETRY_TYPE_SEGMENT;
-	s.geom.user_params = draw->user_params.last();
-	s.sort_bits = draw->layers.last();
-	s.w = s.h = 1;
-
-	// Expand to account for aa.
-	radius += draw->aaf;
-
 	int i2 = 2;
 	v2 p0 = pts[0];
 	v2 p1 = pts[1];
@@ -907,7 +2044,6 @@ void cf_draw_polyline(CF_V2* pts, int count, float thickness, bool loop)
 	v2 a = p0 - n0 * radius + t0 * radius;
 	v2 b = p0 - n0 * radius - t0 * radius;
 
-	bool debug = false;
 	bool skip = false;
 	int iters = count - 2;
 	if (loop) {
@@ -917,37 +2053,16 @@ void cf_draw_polyline(CF_V2* pts, int count, float thickness, bool loop)
 
 	auto submit = [&](v2 a, v2 b, v2 c, bool solo = false) {
 		if (skip) return;
-		if (debug) {
-			draw_push_antialias(false);
-			draw_tri(a, b, c);
-			draw_tri_fill(a, b, c);
-			draw_pop_antialias();
-		} else {
-			s.geom.a = p0;
-			s.geom.b = p1;
-			s.geom.c = solo ? p0 : p2;
-			s.geom.box[0] = a;
-			s.geom.box[1] = b;
-			s.geom.box[2] = c;
-			s.geom.boxH[0] = mul(m, a);
-			s.geom.boxH[1] = mul(m, b);
-			s.geom.boxH[2] = mul(m, c);
-			spritebatch_push(&draw->sb, s);
-		}
+		CF_PolylineTri tri;
+		tri.a = p0;
+		tri.b = p1;
+		tri.c = solo ? p0 : p2;
+		tri.box[0] = a;
+		tri.box[1] = b;
+		tri.box[2] = c;
+		tris->add(tri);
 	};
 
-#define DBG_POINT(P, C) \
-	draw_push_color(color_##C()); \
-	draw_quad(make_aabb(P, 2.0f, 2.0f)); \
-	draw_text(#P, P + V2(0, 5)); \
-	draw_pop_color()
-
-#define DBG_PLANE(H, P, C, L) \
-	draw_push_color(color_##C()); \
-	draw_arrow(project(H, P), (P) + H.n * L * 15.0f, L, L * 3.0f); \
-	draw_text(#H, (P) + H.n * L * 15.0f); \
-	draw_pop_color()
-
 	for (int i = 0; i < iters; ++i) {
 		n0 = norm(p1 - p0);
 		n1 = norm(p2 - p1);
@@ -1046,6 +2161,68 @@ void cf_draw_polyline(CF_V2* pts, int count, float thickness, bool loop)
 	}
 }
 
+void cf_draw_polyline(CF_V2* pts, int count, float thickness, bool loop)
+{
+	float radius = thickness * 0.5f;
+
+	if (count <= 0) {
+		return;
+	} else if (count == 1) {
+		cf_draw_circle_fill2(pts[0], radius);
+		return;
+	} else if (count == 2) {
+		cf_draw_capsule_fill2(pts[0], pts[1], radius);
+		return;
+	}
+
+	// UIs tend to draw the same curves every frame, so recent tessellations are looked up by their inputs
+	// and only re-transformed. The points are compared as well, in case of a hash collision.
+	uint64_t key = cf_fnv1a(pts, (int)(sizeof(CF_V2) * count));
+	key = key * 31 + cf_fnv1a(&radius, sizeof(radius));
+	key = key * 31 + cf_fnv1a(&draw->aaf, sizeof(draw->aaf));
+	key = key * 31 + (uint64_t)loop;
+	CF_PolylineTessellation* tess = draw->polyline_cache.try_find(key);
+	bool hit = tess && tess->pts.count() == count && tess->radius == radius && tess->aaf == draw->aaf && tess->loop == loop && !CF_MEMCMP(tess->pts.data(), pts, sizeof(CF_V2) * count);
+	if (!tess) tess = draw->polyline_cache.insert(key);
+	if (!hit) {
+		tess->pts.clear();
+		for (int i = 0; i < count; ++i) tess->pts.add(pts[i]);
+		tess->radius = radius;
+		tess->aaf = draw->aaf;
+		tess->loop = loop;
+		tess->tris.clear();
+		// Expand to account for aa.
+		s_tessellate_polyline(pts, count, radius + draw->aaf, loop, &tess->tris);
+	}
+	tess->frame = draw->frame;
+
+	// Each portion of the polyline will be rendered with a single triangle per spritebatch entry.
+	CF_M3x2 m = draw->mvp;
+	spritebatch_sprite_t s = { };
+	s.image_id = app->default_image_id;
+	s.geom.color = premultiply(to_pixel(cf_overlay_color(draw->colors.last(), draw->tints.last())));
+	s.geom.alpha = 1.0f;
+	s.geom.radius = radius;
+	s.geom.stroke = 0;
+	s.geom.fill = true;
+	s.geom.aa = draw->aaf;
+	s.geom.type = BATCH_GEOMETRY_TYPE_SEGMENT;
+	s.geom.user_params = draw->user_params.last();
+	s.sort_bits = draw->layers.last();
+	s.w = s.h = 1;
+	for (int i = 0; i < tess->tris.count(); ++i) {
+		const CF_PolylineTri& tri = tess->tris[i];
+		s.geom.a = tri.a;
+		s.geom.b = tri.b;
+		s.geom.c = tri.c;
+		s.geom.box[0] = tri.box[0];
+		s.geom.box[1] = tri.box[1];
+		s.geom.box[2] = tri.box[2];
+		cf_mul_m32_v2_batch(m, tri.box, s.geom.boxH, 3);
+		s_push_sprite(s);
+	}
+}
+
 void cf_draw_bezier_line(CF_V2 a, CF_V2 c0, CF_V2 b, int iters, float thickness)
 {
 	draw->temp.ensure_capacity(iters);
@@ -1108,7 +2285,18 @@ CF_Result cf_make_font_from_memory(void* data, int size, const char* font_name)
 	stbtt_GetFontBoundingBox(&font->info, &x0, &y0, &x1, &y1);
 	font->width = x1 - x0;
 
-	// Build kerning table.
+	// Build the codepoint to glyph index table for the basic multilingual plane, so text layout
+	// doesn't have to search the font's cmap for every character. Codepoints missing from the font
+	// map to the replacement character (or the font's "missing glyph" glyph, index 0).
+	int replacement_index = stbtt_FindGlyphIndex(&font->info, 0xFFFD);
+	font->replacement_glyph_index = replacement_index;
+	font->bmp_glyph_indices.ensure_count(CF_FONT_BMP_SIZE);
+	for (int cp = 0; cp < CF_FONT_BMP_SIZE; ++cp) {
+		int glyph_index = stbtt_FindGlyphIndex(&font->info, cp);
+		font->bmp_glyph_indices[cp] = (uint16_t)(glyph_index ? glyph_index : replacement_index);
+	}
+
+	// Build kerning table, key'd by glyph index pairs.
 	Array<stbtt_kerningentry> table_array;
 	int table_length = stbtt_GetKerningTableLength(&font->info);
 	table_array.ensure_capacity(table_length);
@@ -1133,12 +2321,15 @@ CF_Result cf_make_font(const char* path, const char* font_name)
 	return cf_make_font_from_memory(data, (int)size, font_name);
 }
 
+static void s_sync_glyph_jobs(CF_Font* font, bool wait);
+
 void cf_destroy_font(const char* font_name)
 {
 	font_name = sintern(font_name);
 	CF_Font* font = app->fonts.get(font_name);
 	if (!font) return;
 	app->fonts.remove(font_name);
+	s_sync_glyph_jobs(font, true);
 	CF_FREE(font->file_data);
 	for (int i = 0; i < font->image_ids.count(); ++i) {
 		uint64_t image_id = font->image_ids[i];
@@ -1155,7 +2346,17 @@ void cf_destroy_font(const char* font_name)
 CF_Font* cf_font_get(const char* font_name)
 {
 	CF_ASSERT(font_name);
-	return app->fonts.get(sintern(font_name));
+	font_name = sintern(font_name);
+	CF_Font* font = app->fonts.get(font_name);
+	if (!font && !app->default_font_loaded && app->gfx_enabled && font_name == sintern("Calibri")) {
+		// Parsing the default font and building its tables takes a while, so it waits until text needs it.
+		app->default_font_loaded = true;
+		uint64_t ticks = cf_get_ticks();
+		cf_make_font_from_memory(calibri_data, calibri_sz, "Calibri");
+		app->startup_timings.default_font_milliseconds = (float)((double)(cf_get_ticks() - ticks) * 1000.0 / (double)cf_get_tick_frequency());
+		font = app->fonts.get(font_name);
+	}
+	return font;
 }
 
 CF_INLINE uint64_t cf_glyph_key(int cp, float font_size, int blur)
@@ -1163,10 +2364,28 @@ CF_INLINE uint64_t cf_glyph_key(int cp, float font_size, int blur)
 	int k0 = cp;
 	int k1 = (int)(font_size * 1000.0f);
 	int k2 = blur;
-	uint64_t key = ((uint64_t)k0 & 0xFFFFFFFFULL) << 32 | ((uint64_t)k1 & 0xFFFFULL) << 16 | ((uint64_t)k2 & 0xFFFFULL);
+	// 21 bits of codepoint, 30 bits of font size (in thousandths), 13 bits of blur.
+	uint64_t key = ((uint64_t)k0 & 0x1FFFFFULL) << 43 | ((uint64_t)k1 & 0x3FFFFFFFULL) << 13 | ((uint64_t)k2 & 0x1FFFULL);
 	return key;
 }
 
+// Distance field glyphs (see `cf_font_set_sdf`) are rasterized once at this size and scaled to any font size.
+// The field reaches `CF_FONT_SDF_PADDING` pixels past the outline, the sprite shader's distance field text
+// branch assumes this value.
+#define CF_FONT_SDF_SIZE 48.0f
+#define CF_FONT_SDF_PADDING 6
+#define CF_FONT_SDF_ON_EDGE 128
+
+// Stands in for the blur in keys of distance field glyphs, as blur is clamped far below it.
+#define CF_GLYPH_KEY_SDF 0x1FFF
+
+static uint64_t s_font_glyph_key(const CF_Font* font, int cp, float font_size, int blur)
+{
+	// Distance field glyphs are shared by every size.
+	if (font->sdf) return cf_glyph_key(cp, CF_FONT_SDF_SIZE, CF_GLYPH_KEY_SDF);
+	return cf_glyph_key(cp, font_size, blur);
+}
+
 // From fontastash.h, memononen
 // Based on Exponential blur, Jani Huhtanen, 2006
 
@@ -1246,33 +2465,59 @@ static void s_save(const char* path, uint8_t* pixels, int w, int h)
 	CF_FREE(img.pix);
 }
 
-static void s_render(CF_Font* font, CF_Glyph* glyph, float font_size, int blur)
+static void s_glyph_metrics(CF_Font* font, CF_Glyph* glyph, float font_size, int blur)
 {
 	// Create glyph quad.
-	blur = clamp(blur, 0, 20);
-	int pad = blur + 2;
+	int pad = glyph->sdf ? CF_FONT_SDF_PADDING : blur + 2;
 	float scale = stbtt_ScaleForPixelHeight(&font->info, font_size);
 	int xadvance, lsb, x0, y0, x1, y1;
 	stbtt_GetGlyphHMetrics(&font->info, glyph->index, &xadvance, &lsb);
 	stbtt_GetGlyphBitmapBox(&font->info, glyph->index, scale, scale, &x0, &y0, &x1, &y1);
 	int w = x1 - x0 + pad*2;
 	int h = y1 - y0 + pad*2;
+	if (glyph->sdf) {
+		// The distance field is laid out around the outline as `stbtt_GetGlyphSDF` does it.
+		x0 -= pad;
+		y0 -= pad;
+	}
 	glyph->w = w;
 	glyph->h = h;
 	glyph->q0 = V2((float)x0, -(float)(y0 + h)); // Swapped y.
 	glyph->q1 = V2((float)(x0 + w), -(float)y0); // Swapped y.
 	glyph->xadvance = xadvance * scale;
 	glyph->visible |= w > 0 && h > 0;
+}
 
+// Counted for `CF_FrameStats`, glyphs may be rasterized on worker threads.
+static CF_AtomicInt s_glyphs_rasterized;
+
+// Only reads from the font, so it's safe to call from worker threads.
+static CF_Pixel* s_rasterize(CF_Font* font, int glyph_index, int w, int h, float font_size, int blur, bool sdf)
+{
+	cf_atomic_add(&s_glyphs_rasterized, 1);
 	// Render glyph.
+	int pad = blur + 2;
+	float scale = stbtt_ScaleForPixelHeight(&font->info, font_size);
 	uint8_t* pixels_1bpp = (uint8_t*)CF_CALLOC(w * h);
 	CF_DEFER(CF_FREE(pixels_1bpp));
-	stbtt_MakeGlyphBitmap(&font->info, pixels_1bpp + pad * w + pad, w - pad*2, h - pad*2, w, scale, scale, glyph->index);
-	//s_save("glyph.png", pixels_1bpp, w, h);
+	if (sdf) {
+		// Distance to the outline, 0.5 on the edge and increasing inward, in place of coverage.
+		int sdf_w, sdf_h, xoff, yoff;
+		uint8_t* field = stbtt_GetGlyphSDF(&font->info, scale, glyph_index, CF_FONT_SDF_PADDING, CF_FONT_SDF_ON_EDGE, (float)CF_FONT_SDF_ON_EDGE / CF_FONT_SDF_PADDING, &sdf_w, &sdf_h, &xoff, &yoff);
+		if (field) {
+			for (int y = 0; y < min(h, sdf_h); ++y) {
+				CF_MEMCPY(pixels_1bpp + y * w, field + y * sdf_w, min(w, sdf_w));
+			}
+			stbtt_FreeSDF(field, NULL);
+		}
+	} else {
+		stbtt_MakeGlyphBitmap(&font->info, pixels_1bpp + pad * w + pad, w - pad*2, h - pad*2, w, scale, scale, glyph_index);
+		//s_save("glyph.png", pixels_1bpp, w, h);
 
-	// Apply blur.
-	if (blur) s_blur(pixels_1bpp, w, h, w, blur);
-	//s_save("glyph_blur.png", pixels_1bpp, w, h);
+		// Apply blur.
+		if (blur) s_blur(pixels_1bpp, w, h, w, blur);
+		//s_save("glyph_blur.png", pixels_1bpp, w, h);
+	}
 
 	// Convert to premultiplied RGBA8 pixel format.
 	CF_Pixel* pixels = (CF_Pixel*)CF_ALLOC(w * h * sizeof(CF_Pixel));
@@ -1282,38 +2527,181 @@ static void s_render(CF_Font* font, CF_Glyph* glyph, float font_size, int blur)
 		if (v) p = make_pixel(v, v, v, v);
 		pixels[i] = p;
 	}
+	return pixels;
+}
 
+static void s_install_glyph_pixels(CF_Font* font, CF_Glyph* glyph, CF_Pixel* pixels)
+{
 	// Allocate an image id for the glyph's sprite.
 	glyph->image_id = app->font_image_id_gen++;
 	app->font_pixels.insert(glyph->image_id, pixels);
 	font->image_ids.add(glyph->image_id);
 }
 
-CF_Glyph* cf_font_get_glyph(CF_Font* font, int codepoint, float font_size, int blur)
+static void s_render(CF_Font* font, CF_Glyph* glyph, float font_size, int blur)
+{
+	blur = clamp(blur, 0, 20);
+	s_glyph_metrics(font, glyph, font_size, blur);
+	CF_Pixel* pixels = s_rasterize(font, glyph->index, glyph->w, glyph->h, font_size, blur, glyph->sdf);
+	s_install_glyph_pixels(font, glyph, pixels);
+}
+
+static CF_Glyph* s_find_or_add_glyph(CF_Font* font, uint64_t glyph_key, int codepoint)
 {
-	uint64_t glyph_key = cf_glyph_key(codepoint, font_size, blur);
 	CF_Glyph* glyph = font->glyphs.try_get(glyph_key);
 	if (!glyph) {
-		int glyph_index = stbtt_FindGlyphIndex(&font->info, codepoint);
-		if (!glyph_index) {
-			// This codepoint doesn't exist in this font.
-			// Try and use a backup glyph instead.
-			glyph_index = 0xFFFD;
-		}
+		int glyph_index = cf_font_glyph_index(font, codepoint);
 		glyph = font->glyphs.insert(glyph_key);
 		glyph->index = glyph_index;
 		glyph->visible = stbtt_IsGlyphEmpty(&font->info, glyph_index) == 0;
+		glyph->sdf = font->sdf;
+	}
+	return glyph;
+}
+
+static void s_glyph_job(void* udata)
+{
+	CF_GlyphJob* job = (CF_GlyphJob*)udata;
+	for (int i = 0; i < job->count; ++i) {
+		CF_GlyphJob::Entry* e = job->entries + i;
+		e->pixels = s_rasterize(job->font, e->index, e->w, e->h, job->font_size, job->blur, job->sdf);
+	}
+}
+
+// Hands finished background rasterization over to the glyph table. With `wait` set blocks until
+// every job for this font has completed, running queued work on this thread in the meantime.
+static void s_sync_glyph_jobs(CF_Font* font, bool wait)
+{
+	for (int i = 0; i < font->glyph_jobs.count();) {
+		CF_GlyphJob* job = font->glyph_jobs[i];
+		if (wait) {
+			cf_threadpool_wait_job(app->threadpool, job->handle);
+		} else if (!cf_threadpool_job_is_done(app->threadpool, job->handle)) {
+			++i;
+			continue;
+		}
+		for (int j = 0; j < job->count; ++j) {
+			CF_GlyphJob::Entry* e = job->entries + j;
+			CF_Glyph* glyph = font->glyphs.try_get(e->key);
+			CF_ASSERT(glyph);
+			glyph->pending = false;
+			s_install_glyph_pixels(font, glyph, e->pixels);
+		}
+		font->pending_glyph_count -= job->count;
+		CF_FREE(job->entries);
+		CF_FREE(job);
+		font->glyph_jobs.unordered_remove(i);
+	}
+}
+
+int cf_font_glyph_index(const CF_Font* font, int codepoint)
+{
+	if ((unsigned)codepoint < CF_FONT_BMP_SIZE) {
+		return font->bmp_glyph_indices[codepoint];
 	}
+
+	// This is outside the lookup table, so search the font itself. Codepoints that don't exist in
+	// this font use a backup glyph instead.
+	int glyph_index = stbtt_FindGlyphIndex(&font->info, codepoint);
+	return glyph_index ? glyph_index : font->replacement_glyph_index;
+}
+
+float cf_font_raster_size(const CF_Font* font, float font_size)
+{
+	return font->sdf ? CF_FONT_SDF_SIZE : font_size;
+}
+
+CF_Glyph* cf_font_get_glyph(CF_Font* font, int codepoint, float font_size, int blur)
+{
+	uint64_t glyph_key = s_font_glyph_key(font, codepoint, font_size, blur);
+	font_size = cf_font_raster_size(font, font_size);
+	CF_Glyph* glyph = s_find_or_add_glyph(font, glyph_key, codepoint);
 	if (glyph->image_id) return glyph;
 
+	if (glyph->pending) {
+		// Still being rasterized in the background (see `cf_font_prewarm`). Metrics are already
+		// valid for layout, the caller skips drawing until the pixels arrive.
+		s_sync_glyph_jobs(font, false);
+		return font->glyphs.try_get(glyph_key);
+	}
+
 	// Render the glyph if it exists in the font, but is not yet rendered.
 	s_render(font, glyph, font_size, blur);
 	return glyph;
 }
 
+void cf_font_prewarm(const char* font_name, int first_codepoint, int last_codepoint, float font_size, int blur)
+{
+	CF_Font* font = cf_font_get(font_name);
+	CF_ASSERT(font);
+	if (!font) return;
+	CF_ASSERT(first_codepoint <= last_codepoint);
+
+	// Glyph table entries and metrics are set up on this thread, only the rasterization (the
+	// expensive part) is handed off.
+	Array<CF_GlyphJob::Entry> entries;
+	float key_size = font_size;
+	font_size = cf_font_raster_size(font, font_size);
+	int blur_clamped = clamp(blur, 0, 20);
+	for (int cp = first_codepoint; cp <= last_codepoint; ++cp) {
+		uint64_t glyph_key = s_font_glyph_key(font, cp, key_size, blur);
+		CF_Glyph* glyph = s_find_or_add_glyph(font, glyph_key, cp);
+		if (glyph->image_id || glyph->pending) continue;
+		s_glyph_metrics(font, glyph, font_size, blur_clamped);
+		if (!app->threadpool) {
+			s_install_glyph_pixels(font, glyph, s_rasterize(font, glyph->index, glyph->w, glyph->h, font_size, blur_clamped, glyph->sdf));
+			continue;
+		}
+		glyph->pending = true;
+		CF_GlyphJob::Entry e;
+		e.key = glyph_key;
+		e.index = glyph->index;
+		e.w = glyph->w;
+		e.h = glyph->h;
+		e.pixels = NULL;
+		entries.add(e);
+	}
+	if (!entries.count()) return;
+
+	// Split the range into a few jobs per core so work balances out across the pool.
+	int job_count = min(cf_core_count() * 4, entries.count());
+	int per_job = (entries.count() + job_count - 1) / job_count;
+	for (int i = 0; i < entries.count(); i += per_job) {
+		CF_GlyphJob* job = (CF_GlyphJob*)CF_ALLOC(sizeof(CF_GlyphJob));
+		job->font = font;
+		job->font_size = font_size;
+		job->blur = blur_clamped;
+		job->sdf = font->sdf;
+		job->count = min(per_job, entries.count() - i);
+		job->entries = (CF_GlyphJob::Entry*)CF_ALLOC(sizeof(CF_GlyphJob::Entry) * job->count);
+		CF_MEMCPY(job->entries, entries + i, sizeof(CF_GlyphJob::Entry) * job->count);
+		job->handle = cf_threadpool_add_task(app->threadpool, s_glyph_job, job);
+		font->glyph_jobs.add(job);
+	}
+	font->pending_glyph_count += entries.count();
+	cf_threadpool_kick(app->threadpool);
+}
+
+void cf_font_set_sdf(const char* font_name, bool enable)
+{
+	CF_Font* font = cf_font_get(font_name);
+	CF_ASSERT(font);
+	if (!font) return;
+	font->sdf = enable;
+}
+
+int cf_font_pending_glyph_count(const char* font_name)
+{
+	CF_Font* font = cf_font_get(font_name);
+	if (!font) return 0;
+	s_sync_glyph_jobs(font, false);
+	return font->pending_glyph_count;
+}
+
 float cf_font_get_kern(CF_Font* font, float font_size, int codepoint0, int codepoint1)
 {
-	uint64_t key = CF_KERN_KEY(codepoint0, codepoint1);
+	if (!font->kerning.count()) return 0;
+	uint64_t key = CF_KERN_KEY(cf_font_glyph_index(font, codepoint0), cf_font_glyph_index(font, codepoint1));
 	return font->kerning.get(key) * stbtt_ScaleForPixelHeight(&font->info, font_size);
 }
 
@@ -1450,7 +2838,7 @@ bool cf_peek_text_effect_active()
 	return draw->text_effects.last();
 }
 
-static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool render = true, cf_text_markup_info_fn* markups = NULL);
+static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool render = true, cf_text_markup_info_fn* markups = NULL, CF_TextLayoutInternal* record = NULL);
 
 float cf_text_width(const char* text, int text_length)
 {
@@ -1486,10 +2874,10 @@ static bool s_is_space(int cp)
 	}
 }
 
-static const char* s_find_end_of_line(CF_Font* font, const char* text, float wrap_width)
+// `advance` returns the horizontal advance for a codepoint.
+template <typename F>
+static const char* s_find_end_of_line(const char* text, float wrap_width, F advance)
 {
-	float font_size = draw->font_sizes.last();
-	int blur = draw->blurs.last();
 	float x = 0;
 	const char* start_of_word = 0;
 	float word_w = 0;
@@ -1497,8 +2885,8 @@ static const char* s_find_end_of_line(CF_Font* font, const char* text, float wra
 
 	while (*text) {
 		const char* text_prev = text;
-		text = cf_decode_UTF8(text, &cp);
-		CF_Glyph* glyph = cf_font_get_glyph(font, cp, font_size, blur);
+		text = cf_decode_UTF8_fast(text, &cp);
+		float xadvance = advance(cp);
 
 		if (cp == '\n') {
 			x = 0;
@@ -1509,17 +2897,17 @@ static const char* s_find_end_of_line(CF_Font* font, const char* text, float wra
 			continue;
 		} else {
 			if (s_is_space(cp)) {
-				x += word_w + glyph->xadvance;
+				x += word_w + xadvance;
 				word_w = 0;
 				start_of_word = 0;
 			} else {
 				if (!start_of_word) {
 					start_of_word = text_prev;
 				}
-				if (x + word_w + glyph->xadvance < wrap_width) {
-					word_w += glyph->xadvance;
+				if (x + word_w + xadvance < wrap_width) {
+					word_w += xadvance;
 				} else {
-					if (word_w + glyph->xadvance < wrap_width) {
+					if (word_w + xadvance < wrap_width) {
 						// Put entire word on the next line.
 						return start_of_word;
 					} else {
@@ -1534,27 +2922,51 @@ static const char* s_find_end_of_line(CF_Font* font, const char* text, float wra
 	return text + 1;
 }
 
+static const char* s_find_end_of_line(CF_Font* font, const char* text, float wrap_width)
+{
+	float font_size = draw->font_sizes.last();
+	int blur = draw->blurs.last();
+	float glyph_scale = font_size / cf_font_raster_size(font, font_size);
+	return s_find_end_of_line(text, wrap_width, [&](int cp) {
+		return cf_font_get_glyph(font, cp, font_size, blur)->xadvance * glyph_scale;
+	});
+}
+
 struct CF_CodeParseState
 {
 	CF_TextEffectState* effect;
 	const char* in;
 	const char* end;
 	int glyph_count;
-	String sanitized;
+	// The name or value being parsed, in memory from `cf_frame_alloc` so parsing doesn't go to the heap.
+	char* token;
+	int token_len;
 
 	bool done() { return in >= end; }
-	void append(int ch) { sanitized.append(ch); ++glyph_count; }
+	const char* token_clear() { token_len = 0; token[0] = 0; return token; }
+	void token_append(int cp)
+	{
+		if (cp > 0x10FFFF) cp = 0xFFFD;
+		#define CF_EMIT(X, Y, Z) token[token_len++] = (char)(X | ((cp >> Y) & Z))
+		     if (cp <    0x80) { CF_EMIT(0x00,0,0x7F); }
+		else if (cp <   0x800) { CF_EMIT(0xC0,6,0x1F); CF_EMIT(0x80, 0,  0x3F); }
+		else if (cp < 0x10000) { CF_EMIT(0xE0,12,0xF); CF_EMIT(0x80, 6,  0x3F); CF_EMIT(0x80, 0, 0x3F); }
+		else                   { CF_EMIT(0xF0,18,0x7); CF_EMIT(0x80, 12, 0x3F); CF_EMIT(0x80, 6, 0x3F); CF_EMIT(0x80, 0, 0x3F); }
+		#undef CF_EMIT
+		token[token_len] = 0;
+	}
+	void append(int ch) { effect->sanitized.append(ch); ++glyph_count; }
 	void ltrim() { while (!done()) { int cp = *in; if (s_is_space(cp)) ++in; else break; } }
-	int next(bool trim = true) { if (trim) ltrim(); int cp; in = cf_decode_UTF8(in, &cp); return cp; }
-	int peek(bool trim = true) { if (trim) ltrim(); int cp; cf_decode_UTF8(in, &cp); return cp; }
-	void skip(bool trim = true) { if (trim) ltrim(); int cp; in = cf_decode_UTF8(in, &cp); }
+	int next(bool trim = true) { if (trim) ltrim(); int cp; in = cf_decode_UTF8_fast(in, &cp); return cp; }
+	int peek(bool trim = true) { if (trim) ltrim(); int cp; cf_decode_UTF8_fast(in, &cp); return cp; }
+	void skip(bool trim = true) { if (trim) ltrim(); int cp; in = cf_decode_UTF8_fast(in, &cp); }
 	bool expect(int ch) { int cp = next(); if (cp != ch) { return false; } return true; }
-	bool try_next(int ch, bool trim = true) { if (trim) ltrim(); int cp; const char* next = cf_decode_UTF8(in, &cp); if (cp == ch) { in = next; return true; } return false; }
+	bool try_next(int ch, bool trim = true) { if (trim) ltrim(); int cp; const char* next = cf_decode_UTF8_fast(in, &cp); if (cp == ch) { in = next; return true; } return false; }
 };
 
-static String s_parse_code_name(CF_CodeParseState* s)
+static const char* s_parse_code_name(CF_CodeParseState* s)
 {
-	String name;
+	const char* name = s->token_clear();
 	while (!s->done()) {
 		int cp = s->peek(false);
 		if (cp == '=' || cp == '>') {
@@ -1569,7 +2981,7 @@ static String s_parse_code_name(CF_CodeParseState* s)
 		} else if (s_is_space(cp)) {
 			return name;
 		} else {
-			name.append(cp);
+			s->token_append(cp);
 			s->skip(false);
 		}
 	}
@@ -1588,7 +3000,7 @@ static bool s_is_hex_alphanum(int ch)
 
 static CF_Color s_parse_color(CF_CodeParseState* s)
 {
-	String string;
+	const char* string = s->token_clear();
 	s->expect('#');
 	int digits = 0;
 	while (!s->done()) {
@@ -1596,14 +3008,14 @@ static CF_Color s_parse_color(CF_CodeParseState* s)
 		if (!s_is_hex_alphanum(cp)) {
 			break;
 		} else {
-			string.append(cp);
+			s->token_append(cp);
 			++digits;
 			s->skip();
 		}
 	}
 	int hex = 0;
-	if (!string.empty()) {
-		hex = (int)string.to_hex();
+	if (*string) {
+		hex = (int)stohex(string);
 		if (digits == 6) {
 			// Treat the color as opaque if only 3 bytes were found.
 			hex = hex << 8 | 0xFF;
@@ -1623,7 +3035,7 @@ static bool s_is_num(int ch)
 
 static double s_parse_number(CF_CodeParseState* s)
 {
-	String string;
+	const char* string = s->token_clear();
 	bool is_float = false;
 	bool is_neg = false;
 	if (s->try_next('-')) {
@@ -1634,31 +3046,31 @@ static double s_parse_number(CF_CodeParseState* s)
 	while (!s->done()) {
 		int cp = s->peek();
 		if (cp == '.') {
-			string.append('.');
+			s->token_append('.');
 			s->skip(false);
 			is_float = true;
 		} else if (!s_is_num(cp)) {
 			break;
 		} else {
-			string.append(cp);
+			s->token_append(cp);
 			s->skip(false);
 		}
 	}
 	double result = 0;
 	if (is_float) {
-		result = string.to_double();
+		result = stodouble(string);
 	} else {
-		if (!string.empty()) {
-			result = (double)string.to_int();
+		if (*string) {
+			result = (double)stoint(string);
 		}
 	}
 	if (is_neg) result = -result;
 	return result;
 }
 
-static String s_parse_string(CF_CodeParseState* s)
+static const char* s_parse_string(CF_CodeParseState* s)
 {
-	String string;
+	const char* string = s->token_clear();
 	s->expect('"');
 	while (!s->done()) {
 		int cp = s->next(false);
@@ -1666,11 +3078,11 @@ static String s_parse_string(CF_CodeParseState* s)
 			break;
 		} else if (cp == '/') {
 			if (s->peek(false) == '"') {
-				string.append('"');
+				s->token_append('"');
 				s->skip();
 			}
 		} else {
-			string.append(cp);
+			s->token_append(cp);
 		}
 	}
 	return string;
@@ -1685,9 +3097,9 @@ static CF_TextCodeVal s_parse_code_val(CF_CodeParseState* s)
 		val.type = CF_TEXT_CODE_VAL_TYPE_COLOR;
 		val.u.color = c;
 	} else if (cp == '"') {
-		String string = s_parse_string(s);
+		const char* string = s_parse_string(s);
 		val.type = CF_TEXT_CODE_VAL_TYPE_STRING;
-		val.u.string = !string.empty() ? sintern(string.c_str()) : NULL;
+		val.u.string = *string ? sintern(string) : NULL;
 	} else {
 		double number = s_parse_number(s);
 		val.type = CF_TEXT_CODE_VAL_TYPE_NUMBER;
@@ -1700,9 +3112,10 @@ static void s_parse_code(CF_CodeParseState* s)
 {
 	CF_TextCode code = { };
 	bool finish = s->try_next('/');
+	code.params = finish ? -1 : s->effect->params_add();
 	bool first = true;
 	while (!s->done()) {
-		const char* name = sintern(s_parse_code_name(s).c_str());
+		const char* name = sintern(s_parse_code_name(s));
 		if (first) {
 			first = false;
 			code.effect_name = name;
@@ -1710,7 +3123,7 @@ static void s_parse_code(CF_CodeParseState* s)
 		}
 		if (s->try_next('=')) {
 			CF_TextCodeVal val = s_parse_code_val(s);
-			code.params.insert(name, val);
+			if (!finish) s->effect->params[code.params].insert(name, val);
 		}
 		if (s->try_next('>')) {
 			break;
@@ -1797,7 +3210,17 @@ static void s_parse_codes(CF_TextEffectState* effect, const char* text)
 	s->effect = effect;
 	s->in = text;
 	s->end = text + CF_STRLEN(text);
+	// A malformed byte is re-encoded as U+FFFD, which takes up three bytes.
+	s->token = (char*)cf_frame_alloc((s->end - s->in) * 3 + 1);
 	while (!s->done()) {
+		// Copy plain runs of ASCII over as-is, only stopping for text codes and multi-byte characters.
+		const char* run_end = cf_scan_ascii(s->in, s->end, "</", 2);
+		if (run_end != s->in) {
+			effect->sanitized.append(s->in, run_end);
+			s->glyph_count += (int)(run_end - s->in);
+			s->in = run_end;
+			continue;
+		}
 		int cp = s->next(false);
 		if (cp == '/' && s->try_next('<', false)) {
 			s->append('<');
@@ -1812,32 +3235,46 @@ static void s_parse_codes(CF_TextEffectState* effect, const char* text)
 			return a.index_in_string < b.index_in_string;
 		}
 	);
-	effect->sanitized = s->sanitized;
 }
 
-static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool render, cf_text_markup_info_fn* markups)
+// Fetches the effect state for `text`, parsing its codes into a pooled state the first time it's seen. States that
+// weren't drawn last frame are recycled by `cf_app_draw_onto_screen`, keeping their memory, so animating the same
+// text each frame doesn't touch the heap.
+static CF_TextEffectState* s_text_effect_state(const char* text)
+{
+	uint64_t h = fnv1a(text, (int)CF_STRLEN(text) + 1);
+	int* handle = app->text_effect_states.try_find(h);
+	if (handle) return app->text_effect_pool[*handle];
+
+	int index;
+	if (app->text_effect_free_list.count()) {
+		index = app->text_effect_free_list.pop();
+		app->text_effect_pool[index]->reset();
+	} else {
+		index = app->text_effect_pool.count();
+		app->text_effect_pool.add(CF_NEW(CF_TextEffectState));
+	}
+	app->text_effect_states.insert(h, index);
+	CF_TextEffectState* effect_state = app->text_effect_pool[index];
+	effect_state->hash = h;
+	s_parse_codes(effect_state, text);
+	return effect_state;
+}
+
+static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool render, cf_text_markup_info_fn* markups, CF_TextLayoutInternal* record)
 {
+	// The glyph cache isn't thread-safe, so text can't be recorded into draw lists.
+	CF_ASSERT(!draw->recording);
+	if (render && draw->headless) return V2(0,0);
 	CF_Font* font = cf_font_get(draw->fonts.last());
 	CF_ASSERT(font);
 	if (!font) return V2(0,0);
 
-	// Cache effect state key'd by input text pointer.
-	CF_TextEffectState* effect_state = app->text_effect_states.try_find(text);
-	if (!effect_state) {
-		effect_state = app->text_effect_states.insert(text);
-		effect_state->hash = fnv1a(text, (int)CF_STRLEN(text) + 1);
-		s_parse_codes(effect_state, text);
-	} else {
-		uint64_t h = fnv1a(text, (int)CF_STRLEN(text) + 1);
-		if (effect_state->hash != h) {
-			// Contents have changed, re-parse the whole thing.
-			app->text_effect_states.remove(text);
-			effect_state = app->text_effect_states.insert(text);
-			effect_state->hash = h;
-			s_parse_codes(effect_state, text);
-		}
-	}
-	if (render || markups) {
+	// Cache effect state key'd by the text's contents, so text rebuilt each frame at a new address still finds
+	// its state. Text layouts own their effect state instead.
+	CF_TextEffectState* effect_state = record ? &record->effect_state : s_text_effect_state(text);
+	if ((render || markups) && !effect_state->alive) {
+		// Identical text drawn more than once a frame shares one state, so only advance time once.
 		effect_state->alive = true;
 		effect_state->elapsed += CF_DELTA_TIME;
 	}
@@ -1880,7 +3317,7 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 				effect.index_into_effect = 0;
 				effect.glyph_count = code->glyph_count;
 				effect.elapsed = effect_state->elapsed;
-				effect.params = &code->params;
+				effect.params = effect_state->params + code->params;
 				effect.fn = code->fn;
 				effect_state->effects.add(effect);
 			}
@@ -1914,7 +3351,7 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 
 	// Used by the line-wrapping algorithm to skip characters.
 	auto skip_to_next = [&]() {
-		text = cf_decode_UTF8(text, &cp);
+		text = cf_decode_UTF8_fast(text, &cp);
 		effect_cleanup();
 		++index;
 	};
@@ -1954,7 +3391,7 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 		cp_prev = cp;
 		const char* prev_text = text;
 		if ((render || markups) && do_effects) effect_spawn();
-		text = cf_decode_UTF8(text, &cp);
+		text = cf_decode_UTF8_fast(text, &cp);
 		++index;
 		CF_DEFER(effect_cleanup());
 
@@ -1995,9 +3432,30 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 		}
 
 		// Prepare a sprite struct for rendering.
-		float xadvance = glyph->xadvance;
-		if (render || markups) {
-			bool visible = glyph->visible;
+		// Distance field glyphs are shared by every size, see `cf_font_set_sdf`.
+		float glyph_scale = font_size / cf_font_raster_size(font, font_size);
+		float xadvance = glyph->xadvance * glyph_scale;
+		if (record) {
+			// Record the glyph before any text effects, those are applied each time the layout is drawn.
+			v2 kern = V2(cf_font_get_kern(font, font_size, cp_prev, cp), 0);
+			v2 pad = V2(1,1) * glyph_scale;
+			CF_TextLayoutGlyph g;
+			g.glyph_key = s_font_glyph_key(font, cp, font_size, blur);
+			g.image_id = glyph->image_id;
+			g.cp = cp;
+			g.index = index;
+			g.w = glyph->w;
+			g.h = glyph->h;
+			g.pen = V2(x,y);
+			g.q0 = glyph->q0 * glyph_scale + V2(x,y) + kern - pad;
+			g.q1 = glyph->q1 * glyph_scale + V2(x,y) + kern + pad;
+			g.xadvance = xadvance;
+			g.visible = glyph->visible;
+			g.pending = glyph->pending;
+			g.sdf = glyph->sdf;
+			record->glyphs.add(g);
+		} else if (render || markups) {
+			bool visible = glyph->visible && !glyph->pending;
 			s.image_id = glyph->image_id;
 			s.w = glyph->w;
 			s.h = glyph->h;
@@ -2007,9 +3465,9 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 
 			uint64_t kern_key = CF_KERN_KEY(cp_prev, cp);
 			v2 kern = V2(cf_font_get_kern(font, font_size, cp_prev, cp), 0);
-			v2 pad = V2(1,1); // Account for 1-pixel padding in spritebatch.
-			v2 q0 = glyph->q0 + V2(x,y) + kern - pad;
-			v2 q1 = glyph->q1 + V2(x,y) + kern + pad;
+			v2 pad = V2(1,1) * glyph_scale; // Account for 1-pixel padding in spritebatch.
+			v2 q0 = glyph->q0 * glyph_scale + V2(x,y) + kern - pad;
+			v2 q1 = glyph->q1 * glyph_scale + V2(x,y) + kern + pad;
 
 			// Apply any active custom text effects.
 			for (int i = 0; i < effect_state->effects.count();) {
@@ -2073,9 +3531,10 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 				s.geom.clip = make_aabb(mul(m, clip.min), mul(m, clip.max));
 				s.geom.do_clipping = do_clipping;
 				s.geom.is_text = true;
+				s.geom.is_text_sdf = glyph->sdf;
 				s.sort_bits = draw->layers.last();
 
-				spritebatch_push(&draw->sb, s);
+				s_push_sprite(s);
 			}
 		}
 
@@ -2093,6 +3552,8 @@ static v2 s_draw_text(const char* text, CF_V2 position, int text_length, bool re
 		}
 	}
 	draw->strikes.clear();
+	// Effects still running when `text_length` cut the text short would otherwise pile up across frames.
+	effect_state->effects.clear();
 
 	return V2(x, y - h * 0.25f);
 }
@@ -2102,6 +3563,338 @@ void cf_draw_text(const char* text, CF_V2 position, int text_length)
 	s_draw_text(text, position, text_length);
 }
 
+// Everything `s_measure_text` needs, captured up-front so it can run on worker threads.
+struct CF_TextMeasureState
+{
+	CF_Font* font;
+	float scale;
+	float wrap_w;
+	bool vertical;
+};
+
+static float s_measure_advance(CF_Font* font, int cp, float scale)
+{
+	int glyph_index = cf_font_glyph_index(font, cp);
+	int xadvance, lsb;
+	stbtt_GetGlyphHMetrics(&font->info, glyph_index, &xadvance, &lsb);
+	return xadvance * scale;
+}
+
+// Mirrors the layout logic of `s_draw_text` without touching the glyph cache, or any other shared
+// state, making it safe to call from multiple threads at once.
+static v2 s_measure_text(const CF_TextMeasureState* state, const char* text)
+{
+	CF_Font* font = state->font;
+	float scale = state->scale;
+	float line_height = font->line_height * scale;
+	float h = (font->ascent + font->descent) * scale;
+	float w = font->width * scale;
+	float x = 0;
+	float initial_y = -font->ascent * scale;
+	float y = initial_y;
+	const char* end_of_line = NULL;
+	int cp = 0;
+
+	auto apply_newline = [&]() {
+		if (state->vertical) {
+			x += w;
+			y = initial_y;
+		} else {
+			x = 0;
+			y -= line_height;
+		}
+	};
+	auto advance = [&](int cp) { return s_measure_advance(font, cp, scale); };
+
+	while (text && *text) {
+		const char* prev_text = text;
+		text = cf_decode_UTF8_fast(text, &cp);
+
+		if (cp == '\n') {
+			apply_newline();
+			continue;
+		}
+
+		if (!end_of_line) {
+			end_of_line = s_find_end_of_line(prev_text, state->wrap_w, advance);
+		}
+
+		if (!(text < end_of_line)) {
+			end_of_line = NULL;
+			apply_newline();
+			while (cp) {
+				cp = *text;
+				if (cp == '\n') {
+					apply_newline();
+					text = cf_decode_UTF8_fast(text, &cp);
+					break;
+				}
+				else if (s_is_space(cp)) { text = cf_decode_UTF8_fast(text, &cp); }
+				else break;
+			}
+			continue;
+		}
+
+		if (state->vertical) {
+			y -= line_height;
+		} else {
+			x += advance(cp);
+		}
+	}
+
+	y -= h * 0.25f;
+	return V2(x, y < 0 ? -y : y);
+}
+
+struct CF_TextMeasureJob
+{
+	const CF_TextMeasureState* state;
+	const char** texts;
+	CF_V2* sizes;
+};
+
+static void s_text_measure_range(int begin, int end, void* udata)
+{
+	CF_TextMeasureJob* job = (CF_TextMeasureJob*)udata;
+	for (int i = begin; i < end; ++i) {
+		job->sizes[i] = s_measure_text(job->state, job->texts[i]);
+	}
+}
+
+void cf_text_size_batch(const char** texts, int count, CF_V2* out_sizes)
+{
+	CF_Font* font = cf_font_get(draw->fonts.last());
+	CF_ASSERT(font);
+	if (!font || count <= 0) return;
+
+	CF_TextMeasureState state;
+	state.font = font;
+	state.scale = stbtt_ScaleForPixelHeight(&font->info, draw->font_sizes.last());
+	state.wrap_w = draw->text_wrap_widths.last();
+	state.vertical = draw->vertical.last();
+
+	// Strip out text codes up-front on this thread, as parsing touches shared state.
+	Array<const char*> measured;
+	Array<CF_TextEffectState> sanitized;
+	measured.ensure_count(count);
+	bool do_effects = draw->text_effects.last();
+	for (int i = 0; i < count; ++i) {
+		measured[i] = texts[i];
+		if (do_effects && texts[i] && CF_STRCHR(texts[i], '<')) {
+			CF_TextEffectState* effect_state = &sanitized.add();
+			s_parse_codes(effect_state, texts[i]);
+		}
+	}
+	for (int i = 0, j = 0; i < count && sanitized.count(); ++i) {
+		if (do_effects && texts[i] && CF_STRCHR(texts[i], '<')) {
+			measured[i] = sanitized[j++].sanitized.c_str();
+		}
+	}
+
+	CF_TextMeasureJob job;
+	job.state = &state;
+	job.texts = measured.data();
+	job.sizes = out_sizes;
+	cf_parallel_for(app->threadpool, count, 64, s_text_measure_range, &job);
+}
+
+static bool s_text_layout_is_stale(CF_TextLayoutInternal* layout)
+{
+	return layout->font_name != draw->fonts.last()
+		|| layout->font_size != draw->font_sizes.last()
+		|| layout->blur != draw->blurs.last()
+		|| layout->wrap_width != draw->text_wrap_widths.last()
+		|| layout->vertical != draw->vertical.last()
+		|| layout->text_effects != draw->text_effects.last();
+}
+
+static void s_text_layout_build(CF_TextLayoutInternal* layout)
+{
+	layout->font_name = draw->fonts.last();
+	layout->font_size = draw->font_sizes.last();
+	layout->blur = draw->blurs.last();
+	layout->wrap_width = draw->text_wrap_widths.last();
+	layout->vertical = draw->vertical.last();
+	layout->text_effects = draw->text_effects.last();
+
+	float elapsed = layout->effect_state.elapsed;
+	layout->effect_state.reset();
+	layout->effect_state.hash = layout->hash;
+	layout->effect_state.elapsed = elapsed;
+	s_parse_codes(&layout->effect_state, layout->text.c_str());
+
+	layout->glyphs.clear();
+	v2 size = s_draw_text(layout->text.c_str(), V2(0,0), -1, false, NULL, layout);
+	size.y = size.y < 0 ? -size.y : size.y;
+	layout->size = size;
+}
+
+CF_TextLayout cf_make_text_layout(const char* text)
+{
+	CF_TextLayoutInternal* layout = (CF_TextLayoutInternal*)CF_NEW(CF_TextLayoutInternal);
+	layout->text = text ? text : "";
+	layout->hash = fnv1a(layout->text.c_str(), layout->text.size() + 1);
+	s_text_layout_build(layout);
+	CF_TextLayout result;
+	result.id = (uint64_t)layout;
+	return result;
+}
+
+void cf_destroy_text_layout(CF_TextLayout layout_handle)
+{
+	CF_TextLayoutInternal* layout = (CF_TextLayoutInternal*)layout_handle.id;
+	if (!layout) return;
+	layout->~CF_TextLayoutInternal();
+	CF_FREE(layout);
+}
+
+void cf_text_layout_set_text(CF_TextLayout layout_handle, const char* text)
+{
+	CF_TextLayoutInternal* layout = (CF_TextLayoutInternal*)layout_handle.id;
+	if (!text) text = "";
+	uint64_t h = fnv1a(text, (int)CF_STRLEN(text) + 1);
+	if (h == layout->hash && layout->text == text) return;
+	layout->text = text;
+	layout->hash = h;
+	s_text_layout_build(layout);
+}
+
+CF_V2 cf_text_layout_size(CF_TextLayout layout_handle)
+{
+	CF_TextLayoutInternal* layout = (CF_TextLayoutInternal*)layout_handle.id;
+	if (s_text_layout_is_stale(layout)) s_text_layout_build(layout);
+	return layout->size;
+}
+
+void cf_draw_text_layout(CF_TextLayout layout_handle, CF_V2 position, int num_chars_to_draw)
+{
+	CF_TextLayoutInternal* layout = (CF_TextLayoutInternal*)layout_handle.id;
+	CF_ASSERT(!draw->recording);
+	if (s_text_layout_is_stale(layout)) s_text_layout_build(layout);
+	CF_Font* font = cf_font_get(layout->font_name);
+	if (!font) return;
+	if (num_chars_to_draw < 0) num_chars_to_draw = INT_MAX;
+
+	CF_TextEffectState* effect_state = &layout->effect_state;
+	effect_state->elapsed += CF_DELTA_TIME;
+	bool do_effects = layout->text_effects && effect_state->codes.count();
+	bool do_clipping = draw->text_clip_boxes.size() > 1;
+	CF_Aabb clip = draw->text_clip_boxes.last();
+	float scale = stbtt_ScaleForPixelHeight(&font->info, layout->font_size);
+	float h = (font->ascent + font->descent) * scale;
+	M3x2 m = draw->mvp;
+	int code_index = 0;
+
+	// Text effects are replayed on top of the cached glyphs, mirroring `s_draw_text`.
+	auto effect_cleanup = [&](int index) {
+		for (int i = 0; i < effect_state->effects.count();) {
+			TextEffect* effect = effect_state->effects + i;
+			if (effect->index_into_string + effect->glyph_count <= index) {
+				effect->index_into_effect = effect->glyph_count - 1;
+				effect->on_end = true;
+				if (effect->fn) effect->fn(effect);
+				effect_state->effects.unordered_remove(i);
+			} else {
+				++i;
+			}
+		}
+	};
+
+	for (int j = 0; j < layout->glyphs.count(); ++j) {
+		CF_TextLayoutGlyph* g = layout->glyphs + j;
+		if (g->index > num_chars_to_draw) break;
+
+		// Pick up glyphs still being rasterized in the background.
+		if (g->pending) {
+			CF_Glyph* glyph = cf_font_get_glyph(font, g->cp, layout->font_size, layout->blur);
+			g->pending = glyph->pending;
+			g->image_id = glyph->image_id;
+		}
+
+		v2 q0 = g->q0 + position;
+		v2 q1 = g->q1 + position;
+		CF_Color color = draw->colors.last();
+		float alpha = 1.0f;
+		bool visible = g->visible && !g->pending;
+
+		if (do_effects) {
+			while (code_index < effect_state->codes.count() && effect_state->codes[code_index].index_in_string < g->index) {
+				CF_TextCode* code = effect_state->codes + code_index++;
+				TextEffect effect = { };
+				effect.effect_name = code->effect_name;
+				effect.initial_index = effect.index_into_string = code->index_in_string;
+				effect.index_into_effect = 0;
+				effect.glyph_count = code->glyph_count;
+				effect.elapsed = effect_state->elapsed;
+				effect.params = effect_state->params + code->params;
+				effect.fn = code->fn;
+				effect_state->effects.add(effect);
+			}
+			float xadvance = g->xadvance;
+			for (int i = 0; i < effect_state->effects.count();) {
+				TextEffect* effect = effect_state->effects + i;
+				bool keep_going = true;
+				if (effect->fn) {
+					effect->character = g->cp;
+					effect->index_into_effect = g->index - effect->index_into_string - 1;
+					effect->center = g->pen + position + V2(xadvance*0.5f, h*0.25f);
+					effect->q0 = q0;
+					effect->q1 = q1;
+					effect->w = g->w;
+					effect->h = g->h;
+					effect->color = color;
+					effect->opacity = alpha;
+					effect->xadvance = xadvance;
+					effect->visible = visible;
+					effect->font_size = layout->font_size;
+					effect->on_begin = effect->on_start();
+					keep_going = effect->fn(effect);
+					q0 = effect->q0;
+					q1 = effect->q1;
+					color = effect->color;
+					alpha = effect->opacity;
+					visible = effect->visible;
+					if (!keep_going) {
+						effect_state->effects.unordered_remove(i);
+					}
+				}
+				if (keep_going) {
+					++i;
+				}
+			}
+		}
+
+		if (visible) {
+			spritebatch_sprite_t s = { };
+			s.image_id = g->image_id;
+			s.w = g->w;
+			s.h = g->h;
+			s.geom.type = BATCH_GEOMETRY_TYPE_SPRITE;
+			s.geom.alpha = alpha;
+			s.geom.a = mul(m, V2(q0.x, q1.y));
+			s.geom.b = mul(m, V2(q1.x, q1.y));
+			s.geom.c = mul(m, V2(q1.x, q0.y));
+			s.geom.d = mul(m, V2(q0.x, q0.y));
+			s.geom.color = premultiply(to_pixel(color));
+			s.geom.clip = make_aabb(mul(m, clip.min), mul(m, clip.max));
+			s.geom.do_clipping = do_clipping;
+			s.geom.is_text = true;
+			s.geom.is_text_sdf = g->sdf;
+			s.sort_bits = draw->layers.last();
+			s_push_sprite(s);
+		}
+
+		if (do_effects) effect_cleanup(g->index);
+	}
+	if (do_effects) effect_cleanup(INT_MAX);
+
+	// Draw strike-lines just after the text.
+	for (int i = 0; i < draw->strikes.size(); ++i) {
+		cf_draw_line(draw->strikes[i].p0, draw->strikes[i].p1, draw->strikes[i].thickness);
+	}
+	draw->strikes.clear();
+}
+
 void cf_text_effect_register(const char* name, CF_TextEffectFn* fn)
 {
 	app->text_effect_fns.insert(sintern(name), fn);
@@ -2146,6 +3939,25 @@ int cf_draw_peek_layer()
 	return draw->layers.last();
 }
 
+void cf_draw_push_clip_box(CF_Aabb clip_box)
+{
+	draw->clip_boxes.add(clip_box);
+}
+
+CF_Aabb cf_draw_pop_clip_box()
+{
+	if (draw->clip_boxes.count() > 1) {
+		return draw->clip_boxes.pop();
+	} else {
+		return draw->clip_boxes.last();
+	}
+}
+
+CF_Aabb cf_draw_peek_clip_box()
+{
+	return draw->clip_boxes.last();
+}
+
 void cf_draw_push_color(CF_Color c)
 {
 	draw->colors.add(c);
@@ -2228,6 +4040,21 @@ float cf_draw_peek_antialias_scale()
 	return draw->antialias_scale.last();
 }
 
+void cf_draw_push_opaque(bool opaque)
+{
+	draw->opaque.add(opaque);
+}
+
+bool cf_draw_pop_opaque()
+{
+	return draw->opaque.count() > 1 ? draw->opaque.pop() : draw->opaque.last();
+}
+
+bool cf_draw_peek_opaque()
+{
+	return draw->opaque.last();
+}
+
 void cf_draw_push_vertex_attributes(float r, float g, float b, float a)
 {
 	draw->user_params.add(cf_make_color_rgba_f(r, g, b, a));
@@ -2256,19 +4083,205 @@ void cf_set_vertex_callback(CF_VertexFn* vertex_fn)
 void cf_render_settings_filter(CF_Filter filter)
 {
 	draw->filter = filter;
+	spritebatch_set_atlas_limit(&draw->sb, s_atlas_page_limit());
 }
 
-void cf_render_settings_push_viewport(CF_Rect viewport)
+void cf_render_settings_atlas_mip_levels(int levels)
 {
-	draw->viewports.add(viewport);
+	draw->atlas_mip_levels = max(levels, 1);
+	spritebatch_set_atlas_limit(&draw->sb, s_atlas_page_limit());
 }
 
-CF_Rect cf_render_settings_pop_viewport()
+void cf_render_settings_parallel_vertex_threshold(int sprite_count)
 {
-	if (draw->viewports.count()) {
-		CF_Rect result = draw->viewports.pop();
-		return result;
-	} else {
+	draw->parallel_vertex_threshold = sprite_count;
+}
+
+void cf_render_settings_culling(bool enabled)
+{
+	draw->culling = enabled;
+}
+
+CF_DrawCullStats cf_draw_query_cull_stats()
+{
+	return draw->last_cull_stats;
+}
+
+void cf_draw_set_debug_mode(CF_DrawDebugMode mode)
+{
+	draw->debug_mode = mode;
+	if (mode == CF_DRAW_DEBUG_MODE_NONE) {
+		draw->batch_breaks.clear();
+		draw->last_batch_breaks.clear();
+	}
+}
+
+CF_DrawDebugMode cf_draw_get_debug_mode()
+{
+	return draw->debug_mode;
+}
+
+const CF_BatchBreak* cf_draw_get_batch_breaks(int* count)
+{
+	*count = draw->last_batch_breaks.count();
+	return *count ? draw->last_batch_breaks.data() : NULL;
+}
+
+// Skips the "CF_BATCH_BREAK_REASON_" prefix.
+static const char* s_reason_name(CF_BatchBreakReason reason)
+{
+	return cf_batch_break_reason_to_string(reason) + sizeof("CF_BATCH_BREAK_REASON_") - 1;
+}
+
+void cf_draw_log_batch_breaks()
+{
+	int count;
+	const CF_BatchBreak* breaks = cf_draw_get_batch_breaks(&count);
+	int tally[CF_BATCH_BREAK_REASON_STATIC + 1] = { };
+	for (int i = 0; i < count; ++i) {
+		cf_log(CF_LOG_LEVEL_DEBUG, "batch %d: %s, %d sprites from layer %d", i, s_reason_name(breaks[i].reason), breaks[i].sprite_count, breaks[i].layer);
+		tally[breaks[i].reason]++;
+	}
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(tally); ++i) {
+		if (tally[i]) cf_log(CF_LOG_LEVEL_DEBUG, "%d batches broken by %s", tally[i], s_reason_name((CF_BatchBreakReason)i));
+	}
+}
+
+void cf_draw_debug_imgui_window()
+{
+	if (!app->using_imgui) return;
+
+	ImGui::Begin("Draw Debug");
+	const char* modes[] = { "None", "Overdraw", "Batches" };
+	int mode = (int)draw->debug_mode;
+	if (ImGui::Combo("Mode", &mode, modes, CF_ARRAY_SIZE(modes))) {
+		cf_draw_set_debug_mode((CF_DrawDebugMode)mode);
+	}
+	int count;
+	const CF_BatchBreak* breaks = cf_draw_get_batch_breaks(&count);
+	ImGui::Text("Batches: %d", count);
+	ImGui::SameLine();
+	if (ImGui::Button("Log")) cf_draw_log_batch_breaks();
+	for (int i = 0; i < count; ++i) {
+		CF_Color c = breaks[i].color;
+		ImGui::ColorButton("##batch", ImVec4(c.r, c.g, c.b, 1.0f), ImGuiColorEditFlags_NoTooltip, ImVec2(12, 12));
+		ImGui::SameLine();
+		ImGui::Text("%s, %d sprites, layer %d", s_reason_name(breaks[i].reason), breaks[i].sprite_count, breaks[i].layer);
+	}
+	ImGui::End();
+}
+
+void cf_render_settings_defrag_budget(float milliseconds)
+{
+	draw->defrag_budget_ms = max(milliseconds, 0.0f);
+}
+
+void cf_render_settings_pixel_budget(size_t bytes)
+{
+	app->pixel_budget = bytes;
+	if (!bytes) {
+		app->resident_pixels.clear();
+		app->resident_pixel_size = 0;
+	} else if (app->resident_pixel_size > bytes) {
+		s_evict_pixels();
+	}
+}
+
+size_t cf_draw_resident_pixel_size()
+{
+	return app->resident_pixel_size;
+}
+
+int cf_draw_defrag_pending()
+{
+	return spritebatch_defrag_pending(&draw->sb);
+}
+
+void cf_draw_end_frame()
+{
+	draw->last_cull_stats = draw->cull_stats;
+	draw->cull_stats = { };
+	Cute::Array<CF_BatchBreak> t;
+	t.steal_from(draw->last_batch_breaks);
+	draw->last_batch_breaks.steal_from(draw->batch_breaks);
+	draw->batch_breaks.steal_from(t);
+	draw->batch_breaks.clear();
+	draw->batch_tracker = { };
+	app->dynamic_sprite_frame++;
+
+	// Drop polyline tessellations that weren't drawn this frame.
+	for (int i = draw->polyline_cache.count() - 1; i >= 0; --i) {
+		if (draw->polyline_cache.items()[i].frame != draw->frame) {
+			draw->polyline_cache.remove(draw->polyline_cache.keys()[i]);
+		}
+	}
+	draw->frame++;
+}
+
+void cf_draw_take_frame_stats(CF_FrameStats* stats)
+{
+	stats->batches = draw->batch_count;
+	stats->defrag_milliseconds = (float)(draw->defrag_seconds * 1000.0);
+	stats->glyphs_rasterized = cf_atomic_set(&s_glyphs_rasterized, 0);
+	draw->batch_count = 0;
+	draw->defrag_seconds = 0;
+
+	// Atlases sit in a circular list.
+	int atlas_count = 0;
+	spritebatch_internal_atlas_t* atlas = draw->sb.atlases;
+	if (atlas) {
+		do {
+			++atlas_count;
+			atlas = atlas->next;
+		} while (atlas != draw->sb.atlases);
+	}
+	stats->atlas_count = atlas_count;
+}
+
+void cf_draw_tick_and_defrag()
+{
+	if (draw->headless) return;
+	spritebatch_tick(&draw->sb);
+
+	// Translate the time budget into a number of atlas operations, based on a running average of how
+	// long each operation has taken so far. Always allow at least one so the atlases make progress.
+	int max_ops = 0;
+	if (draw->defrag_budget_ms > 0) {
+		max_ops = 1;
+		if (draw->defrag_seconds_per_op > 0) {
+			max_ops = max(1, (int)((double)draw->defrag_budget_ms / 1000.0 / draw->defrag_seconds_per_op));
+		}
+	}
+	spritebatch_set_defrag_budget(&draw->sb, max_ops);
+
+	uint64_t start = cf_get_ticks();
+	cf_profile_begin("spritebatch_defrag");
+	spritebatch_defrag(&draw->sb);
+	cf_profile_end();
+	double seconds = (double)(cf_get_ticks() - start) / (double)cf_get_tick_frequency();
+	draw->defrag_seconds += seconds;
+	int ops = draw->sb.defrag_operations;
+	if (ops > 0) {
+		double seconds_per_op = seconds / (double)ops;
+		if (draw->defrag_seconds_per_op > 0) {
+			draw->defrag_seconds_per_op = draw->defrag_seconds_per_op * 0.75 + seconds_per_op * 0.25;
+		} else {
+			draw->defrag_seconds_per_op = seconds_per_op;
+		}
+	}
+}
+
+void cf_render_settings_push_viewport(CF_Rect viewport)
+{
+	draw->viewports.add(viewport);
+}
+
+CF_Rect cf_render_settings_pop_viewport()
+{
+	if (draw->viewports.count()) {
+		CF_Rect result = draw->viewports.pop();
+		return result;
+	} else {
 		return draw->viewports.last();
 	}
 }
@@ -2321,6 +4334,7 @@ CF_RenderState cf_render_settings_peek_render_state()
 void cf_render_settings_set_atlas_dimensions(int width_in_pixels, int height_in_pixels)
 {
 	spritebatch_term(&draw->sb);
+	s_atlas_array_reset();
 	s_init_sb(width_in_pixels, height_in_pixels);
 	draw->atlas_dims.x = (float)width_in_pixels;
 	draw->atlas_dims.y = (float)height_in_pixels;
@@ -2328,6 +4342,27 @@ void cf_render_settings_set_atlas_dimensions(int width_in_pixels, int height_in_
 	draw->texel_dims.y = 1.0f / draw->atlas_dims.y;
 }
 
+bool cf_render_settings_atlas_array(bool enable)
+{
+	enable = enable && !draw->headless && cf_query_device_feature(CF_DEVICE_FEATURE_TEXTURE_ARRAY);
+	if (enable == draw->atlas_array.enabled) return enable;
+
+	// Every page moves, so start the atlases over.
+	int w = draw->sb.atlas_width_in_pixels;
+	int h = draw->sb.atlas_height_in_pixels;
+	spritebatch_term(&draw->sb);
+	s_atlas_array_reset();
+	draw->atlas_array.enabled = enable;
+	s_init_sb(w, h);
+	return enable;
+}
+
+void cf_render_settings_atlas_budget(size_t bytes)
+{
+	draw->atlas_budget = bytes;
+	spritebatch_set_atlas_limit(&draw->sb, s_atlas_page_limit());
+}
+
 void cf_render_settings_push_shader(CF_Shader shader)
 {
 	draw->shaders.add(shader);
@@ -2343,6 +4378,35 @@ CF_Shader cf_render_settings_peek_shader()
 	return draw->shaders.last();
 }
 
+void cf_draw_prewarm(CF_Canvas canvas)
+{
+	if (draw->headless) return;
+	cf_material_set_render_state(draw->material, draw->render_states.last());
+	CF_Mesh meshes[2] = { draw->mesh, draw->sprite_mesh };
+	CF_Shader shader = draw->shaders.last();
+	for (int i = 0; i < 2; ++i) {
+		if (shader.id == draw->shaders[0].id) {
+			for (int j = 0; j < SPRITE_SHADER_VARIANT_COUNT; ++j) {
+				if (j == SPRITE_SHADER_VARIANT_INSTANCED || j == SPRITE_SHADER_VARIANT_PARTICLES || j == SPRITE_SHADER_VARIANT_PARTICLES_ARRAY) continue;
+				cf_prewarm_pipeline(canvas, meshes[i], draw->sprite_shader_variants[j], draw->material);
+			}
+		} else {
+			cf_prewarm_pipeline(canvas, meshes[i], shader, draw->material);
+		}
+	}
+
+	// Only the default shader draws instanced, see `s_can_draw_instanced`.
+	if (shader.id == draw->shaders[0].id) {
+		cf_prewarm_pipeline(canvas, draw->quad_mesh, draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_INSTANCED], draw->material);
+	}
+
+	// Particles always use their own variants, and every emitter's mesh shares one layout.
+	CF_Mesh particle_mesh = s_make_particle_mesh(4);
+	cf_prewarm_pipeline(canvas, particle_mesh, draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_PARTICLES], draw->material);
+	cf_prewarm_pipeline(canvas, particle_mesh, draw->sprite_shader_variants[SPRITE_SHADER_VARIANT_PARTICLES_ARRAY], draw->material);
+	cf_destroy_mesh(particle_mesh);
+}
+
 void cf_render_settings_push_texture(const char* name, CF_Texture texture)
 {
 	material_set_texture_fs(draw->material, name, texture);
@@ -2373,13 +4437,250 @@ void cf_render_settings_push_uniform_color(const char* name, CF_Color val)
 	material_set_uniform_fs(draw->material, "shader_uniforms", name, &val, CF_UNIFORM_TYPE_FLOAT4, 1);
 }
 
+static void s_render_static_draws(Array<CF_StaticDraw>& static_draws);
+
 void cf_render_to(CF_Canvas canvas, bool clear)
 {
-	cf_apply_canvas(canvas, clear);
-	spritebatch_flush(&draw->sb);
+	CF_ASSERT(!draw->recording);
+	if (draw->headless) return;
+	cf_dynamic_sprites_upload();
+	cf_gpu_timer_push("cf_render_to");
+	if (draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) s_track_flush(canvas);
+	bool opaque_pass = s_opaque_pass_supported(canvas);
+	if (opaque_pass) {
+		cf_apply_canvas_clear_depth(canvas, clear);
+	} else {
+		cf_apply_canvas(canvas, clear);
+	}
+	s_render_static_draws(draw->static_draws);
+	s_flush_sb(opaque_pass);
+	draw->particle_draws.clear();
+	draw->verts.clear();
+	cf_gpu_timer_pop();
+}
+
+static void s_pipelined_vertex_job(void* udata)
+{
+	CF_PipelinedFrame* frame = (CF_PipelinedFrame*)udata;
+	for (int i = 0; i < frame->batches.count(); ++i) {
+		CF_PipelinedBatch* batch = frame->batches + i;
+		if (batch->particles >= 0) continue;
+		CF_Vertex* verts = frame->verts.data() + batch->first_vert;
+		batch->vert_count = s_fill_vertices(frame->sprites.data() + batch->first, batch->count, verts);
+		if (frame->vertex_fn) {
+			frame->vertex_fn(verts, batch->vert_count);
+		}
+		if (frame->debug_mode != CF_DRAW_DEBUG_MODE_NONE) {
+			s_debug_vertices(verts, batch->vert_count, frame->debug_mode, batch->debug_color);
+		}
+		batch->compact = s_pack_sprite_vertices(verts, batch->vert_count, frame->sprite_verts.data() + batch->first_vert);
+		batch->variant = s_sprite_shader_variant(frame->sprites.data() + batch->first, batch->count);
+	}
+}
+
+void cf_draw_pipeline_record(bool clear)
+{
+	CF_ASSERT(!draw->recording);
+	CF_PipelinedFrame* frame = &draw->pipelined;
+	CF_ASSERT(!frame->pending);
+	cf_dynamic_sprites_upload();
+
+	// Everything `s_submit_draw` reads is captured now, as the next frame's pushes will have
+	// replaced it by the time this frame is drawn.
+	frame->clear = clear;
+	frame->viewport = draw->viewports.last();
+	frame->scissor = draw->scissors.last();
+	frame->render_state = draw->render_states.last();
+	frame->shader = draw->shaders.last();
+	if (!frame->material.id) frame->material = cf_make_material();
+	cf_material_copy(frame->material, draw->material);
+	frame->vertex_fn = draw->vertex_fn;
+	frame->opaque_pass = s_opaque_pass_supported(cf_app_get_canvas());
+	frame->debug_mode = draw->debug_mode;
+	if (frame->debug_mode != CF_DRAW_DEBUG_MODE_NONE) s_track_flush(cf_app_get_canvas());
+	frame->static_draws = draw->static_draws;
+	draw->static_draws.clear();
+
+	frame->sprites.clear();
+	frame->batches.clear();
+	frame->particles.clear();
+	frame->vert_capacity = 0;
+	draw->pipeline_recording = true;
+	s_flush_sb(frame->opaque_pass);
+	draw->particle_draws.clear();
+	draw->pipeline_recording = false;
+	frame->verts.ensure_count(frame->vert_capacity);
+	frame->sprite_verts.ensure_count(frame->vert_capacity);
+
+	frame->pending = true;
+	frame->threaded = app->threadpool != NULL;
+	if (frame->threaded) {
+		frame->job = cf_threadpool_add_task(app->threadpool, s_pipelined_vertex_job, frame);
+		cf_threadpool_kick(app->threadpool);
+	} else {
+		s_pipelined_vertex_job(frame);
+	}
+}
+
+void cf_draw_pipeline_submit(CF_Canvas canvas)
+{
+	CF_PipelinedFrame* frame = &draw->pipelined;
+	if (!frame->pending) return;
+	if (frame->threaded) {
+		CF_PROFILE_SCOPE("cf_draw_pipeline_wait");
+		cf_threadpool_wait_job(app->threadpool, frame->job);
+	}
+	frame->pending = false;
+
+	cf_gpu_timer_push("cf_draw_pipeline_submit");
+	if (frame->opaque_pass) {
+		cf_apply_canvas_clear_depth(canvas, frame->clear);
+	} else {
+		cf_apply_canvas(canvas, frame->clear);
+	}
+
+	// Draw with the settings captured at record time.
+	draw->viewports.add(frame->viewport);
+	draw->scissors.add(frame->scissor);
+	draw->render_states.add(frame->render_state);
+	draw->shaders.add(frame->shader);
+	CF_Material material = draw->material;
+	int uniform_texture_w = draw->uniform_texture_w;
+	int uniform_texture_h = draw->uniform_texture_h;
+	draw->material = frame->material;
+	draw->uniform_texture_w = 0;
+	draw->uniform_texture_h = 0;
+
+	s_render_static_draws(frame->static_draws);
+	draw->opaque_pass = frame->opaque_pass;
+	for (int i = 0; i < frame->batches.count(); ++i) {
+		CF_PipelinedBatch* batch = frame->batches + i;
+		if (batch->particles >= 0) {
+			s_submit_particles(frame->particles[batch->particles], batch->texture_id, batch->texture_w, batch->texture_h, batch->variant);
+			continue;
+		}
+		if (!batch->vert_count) continue;
+		CF_Mesh mesh;
+		if (batch->compact) {
+			cf_mesh_append_vertex_data(draw->sprite_mesh, frame->sprite_verts.data() + batch->first_vert, batch->vert_count);
+			mesh = draw->sprite_mesh;
+		} else {
+			cf_mesh_append_vertex_data(draw->mesh, frame->verts.data() + batch->first_vert, batch->vert_count);
+			mesh = draw->mesh;
+		}
+		CF_Texture atlas = s_atlas_texture(batch->texture_id);
+		s_submit_draw(mesh, atlas, batch->texture_w, batch->texture_h, batch->variant, batch->opaque);
+	}
+	draw->opaque_pass = false;
 	draw->verts.clear();
+	for (int i = 0; i < frame->dead_meshes.count(); ++i) {
+		cf_destroy_mesh(frame->dead_meshes[i]);
+	}
+	frame->dead_meshes.clear();
+
+	draw->material = material;
+	draw->uniform_texture_w = uniform_texture_w;
+	draw->uniform_texture_h = uniform_texture_h;
+	draw->viewports.pop();
+	draw->scissors.pop();
+	draw->render_states.pop();
+	draw->shaders.pop();
+	cf_gpu_timer_pop();
+}
+
+#ifndef CF_NO_DEBUG_DRAW
+
+void cf_debug_draw_line(CF_V2 p0, CF_V2 p1, CF_Color color)
+{
+	if (draw->headless) return;
+	p0 = mul(draw->mvp, p0);
+	p1 = mul(draw->mvp, p1);
+
+	// Expand the line sideways by half a pixel on either side. Clip space spans two units across the canvas, so
+	// the normal is found in pixels and scaled back down, otherwise lines would thin out along the longer axis.
+	float scale = app->dynamic_resolution.scale;
+	v2 half_pixel = V2(1.0f / ((float)app->canvas_w * scale), 1.0f / ((float)app->canvas_h * scale));
+	v2 d = (p1 - p0) / half_pixel;
+	float l = len(d);
+	v2 n = l > 0 ? skew(d / l) * 0.5f : V2(0.5f, 0);
+	n = n * half_pixel;
+
+	CF_DebugVertex v[6];
+	v[0].posH = p0 - n;
+	v[1].posH = p1 - n;
+	v[2].posH = p1 + n;
+	v[3].posH = p1 + n;
+	v[4].posH = p0 + n;
+	v[5].posH = p0 - n;
+	CF_Pixel pixel = cf_color_to_pixel(cf_color_premultiply(color));
+	for (int i = 0; i < 6; ++i) {
+		v[i].color = pixel;
+		draw->debug_verts.add(v[i]);
+	}
+}
+
+void cf_debug_draw_box(CF_Aabb box, CF_Color color)
+{
+	v2 a = box.min;
+	v2 b = V2(box.max.x, box.min.y);
+	v2 c = box.max;
+	v2 d = V2(box.min.x, box.max.y);
+	cf_debug_draw_line(a, b, color);
+	cf_debug_draw_line(b, c, color);
+	cf_debug_draw_line(c, d, color);
+	cf_debug_draw_line(d, a, color);
+}
+
+void cf_debug_draw_circle(CF_V2 p, float r, CF_Color color)
+{
+	const int iters = 24;
+	v2 p0 = p + V2(r, 0);
+	for (int i = 1; i <= iters; ++i) {
+		float a = (float)i / (float)iters * CF_PI * 2.0f;
+		v2 p1 = p + V2(CF_COSF(a), CF_SINF(a)) * r;
+		cf_debug_draw_line(p0, p1, color);
+		p0 = p1;
+	}
+}
+
+void cf_debug_draw_flush(CF_Canvas canvas)
+{
+	if (draw->debug_verts.empty()) return;
+
+	if (!draw->debug_mesh.id) {
+		draw->debug_mesh = cf_make_mesh(CF_USAGE_TYPE_STREAM, CF_KB * 64, 0, 0);
+		CF_VertexAttribute attrs[2] = { };
+		attrs[0].name = "in_posH";
+		attrs[0].format = CF_VERTEX_FORMAT_FLOAT2;
+		attrs[0].offset = CF_OFFSET_OF(CF_DebugVertex, posH);
+		attrs[1].name = "in_col";
+		attrs[1].format = CF_VERTEX_FORMAT_UBYTE4N;
+		attrs[1].offset = CF_OFFSET_OF(CF_DebugVertex, color);
+		cf_mesh_set_attributes(draw->debug_mesh, attrs, CF_ARRAY_SIZE(attrs), sizeof(CF_DebugVertex), 0);
+		draw->debug_shader = CF_MAKE_SOKOL_SHADER(debug_shader);
+		draw->debug_material = cf_make_material();
+		cf_material_set_render_state(draw->debug_material, draw->render_states[0]);
+	}
+
+	cf_gpu_timer_push("cf_debug_draw_flush");
+	cf_apply_canvas(canvas, false);
+	cf_mesh_update_vertex_data(draw->debug_mesh, draw->debug_verts.data(), draw->debug_verts.count());
+	cf_apply_mesh(draw->debug_mesh);
+	cf_apply_shader(draw->debug_shader, draw->debug_material);
+	cf_draw_elements();
+	cf_gpu_timer_pop();
+	draw->debug_verts.clear();
+}
+
+#else // CF_NO_DEBUG_DRAW
+
+void cf_debug_draw_flush(CF_Canvas canvas)
+{
+	CF_UNUSED(canvas);
 }
 
+#endif // CF_NO_DEBUG_DRAW
+
 void cf_draw_transform(CF_M3x2 m)
 {
 	m = mul(draw->cam_stack.last(), m);
@@ -2474,6 +4775,12 @@ CF_V2 cf_screen_to_world(CF_V2 point)
 
 CF_TemporaryImage cf_fetch_image(const CF_Sprite* sprite)
 {
+	if (draw->headless) {
+		CF_TemporaryImage image = { };
+		image.w = sprite->w;
+		image.h = sprite->h;
+		return image;
+	}
 	draw->delay_defrag = true;
 	uint64_t image_id;
 	if (sprite->animation) {
@@ -2483,7 +4790,8 @@ CF_TemporaryImage cf_fetch_image(const CF_Sprite* sprite)
 	}
 	spritebatch_sprite_t s = spritebatch_fetch(&draw->sb, image_id, sprite->w, sprite->h);
 	CF_TemporaryImage image;
-	image.tex = { s.texture_id };
+	image.tex = s_atlas_texture(s.texture_id);
+	image.layer = s_atlas_layer(s.texture_id);
 	image.w = sprite->w;
 	image.h = sprite->h;
 	image.u = cf_v2(s.minx, s.miny);
@@ -2491,14 +4799,16 @@ CF_TemporaryImage cf_fetch_image(const CF_Sprite* sprite)
 	return image;
 }
 
-void cf_register_premade_atlas(const char* png_path, int sub_image_count, CF_AtlasSubImage* sub_images)
+// Uploads an atlas page to the GPU and registers its sub-images with spritebatch, which then never
+// needs to pack or fetch pixels for them.
+static void s_register_premade_atlas_pixels(CF_Pixel* pix, int w, int h, int sub_image_count, const CF_AtlasSubImage* sub_images)
 {
-	Png png;
-	if (is_error(png_cache_load(png_path, &png))) {
-		CF_ASSERT(false);
-		return;
-	}
+	CF_Texture texture = s_make_atlas_texture(pix, w, h);
+	draw->premade_textures.add(texture);
+
 	Array<spritebatch_premade_sprite_t> premades;
+	premades.ensure_capacity(sub_image_count);
+	draw->premade_sub_image_id_to_sub_image.ensure_capacity(draw->premade_sub_image_id_to_sub_image.count() + sub_image_count);
 	for (int i = 0; i < sub_image_count; ++i) {
 		spritebatch_premade_sprite_t s = { 0 };
 		s.image_id = sub_images[i].image_id + CF_PREMADE_ID_RANGE_LO;
@@ -2509,10 +4819,275 @@ void cf_register_premade_atlas(const char* png_path, int sub_image_count, CF_Atl
 		s.miny = sub_images[i].miny;
 		s.maxy = sub_images[i].maxy;
 		premades.add(s);
-		draw->premade_sub_image_id_to_png_atlas_map.add(s.image_id, png.id);
-		draw->premade_sub_image_id_to_sub_image.add(s.image_id, sub_images[i]);
+		draw->premade_sub_image_id_to_sub_image.insert(s.image_id, sub_images[i]);
+	}
+	spritebatch_register_premade_atlas(&draw->sb, texture.id, w, h, sub_image_count, premades.data());
+}
+
+void cf_register_premade_atlas(const char* png_path, int sub_image_count, CF_AtlasSubImage* sub_images)
+{
+	Png png;
+	if (is_error(png_cache_load(png_path, &png))) {
+		CF_ASSERT(false);
+		return;
+	}
+	draw->premade_sub_image_id_to_png_atlas_map.ensure_capacity(draw->premade_sub_image_id_to_png_atlas_map.count() + sub_image_count);
+	for (int i = 0; i < sub_image_count; ++i) {
+		draw->premade_sub_image_id_to_png_atlas_map.insert(sub_images[i].image_id + CF_PREMADE_ID_RANGE_LO, png.id);
+	}
+	s_register_premade_atlas_pixels(png.pix, png.w, png.h, sub_image_count, sub_images);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Baked atlases.
+//
+// File layout, all integers are little-endian uint32 unless noted:
+//
+//     "CFAT", version, page_width, page_height, page_count, sub_image_count
+//     page_count * { png_size, png_size bytes of PNG data }
+//     sub_image_count * { page, w, h, float minx, float miny, float maxx, float maxy, name_len, name_len bytes of name }
+
+#define CF_BAKED_ATLAS_MAGIC   "CFAT"
+#define CF_BAKED_ATLAS_VERSION (1)
+
+// Pixel padding around each baked image to avoid bleeding when filtering.
+#define CF_BAKED_ATLAS_PADDING (1)
+
+struct CF_BakeImage
+{
+	const char* name;
+	int w, h;
+	CF_Pixel* pix;
+	int page;
+	int x, y;
+};
+
+// Shelf-packs tallest images first, opening a new page whenever the current one fills up. Returns
+// the number of pages used, or -1 if an image doesn't fit on a page at all.
+static int s_shelf_pack(Array<CF_BakeImage>& images, int page_width, int page_height, int pad)
+{
+	Array<int> order;
+	order.ensure_count(images.count());
+	for (int i = 0; i < images.count(); ++i) order[i] = i;
+	std::sort(order.begin(), order.end(), [&](int a, int b) { return images[a].h > images[b].h; });
+	int page_count = images.count() ? 1 : 0;
+	int x = 0, y = 0, shelf_h = 0;
+	for (int i = 0; i < order.count(); ++i) {
+		CF_BakeImage* img = images + order[i];
+		if (img->w + pad * 2 > page_width || img->h + pad * 2 > page_height) {
+			return -1;
+		}
+		if (x + img->w + pad * 2 > page_width) {
+			y += shelf_h;
+			x = 0;
+			shelf_h = 0;
+		}
+		if (y + img->h + pad * 2 > page_height) {
+			page_count++;
+			x = y = shelf_h = 0;
+		}
+		img->page = page_count - 1;
+		img->x = x + pad;
+		img->y = y + pad;
+		x += img->w + pad * 2;
+		shelf_h = max(shelf_h, img->h + pad * 2);
 	}
-	spritebatch_register_premade_atlas(&draw->sb, png.id, png.w, png.h, sub_image_count, premades.data());
+	return page_count;
+}
+
+static void s_write_bytes(Array<uint8_t>& out, const void* data, int size)
+{
+	int count = out.count();
+	out.ensure_count(count + size);
+	CF_MEMCPY(out.data() + count, data, size);
+}
+
+static void s_write_u32(Array<uint8_t>& out, uint32_t val)
+{
+	s_write_bytes(out, &val, sizeof(val));
+}
+
+static void s_write_f32(Array<uint8_t>& out, float val)
+{
+	s_write_bytes(out, &val, sizeof(val));
+}
+
+static bool s_read_bytes(const uint8_t** in, const uint8_t* end, void* data, int size)
+{
+	if (end - *in < size) return false;
+	CF_MEMCPY(data, *in, size);
+	*in += size;
+	return true;
+}
+
+static bool s_read_u32(const uint8_t** in, const uint8_t* end, uint32_t* val)
+{
+	return s_read_bytes(in, end, val, sizeof(*val));
+}
+
+static bool s_read_f32(const uint8_t** in, const uint8_t* end, float* val)
+{
+	return s_read_bytes(in, end, val, sizeof(*val));
+}
+
+CF_Result cf_bake_atlas(const char* out_path, const char** image_paths, int image_count, int page_width, int page_height)
+{
+	// Decode all source images. Aseprite files contribute one image per frame.
+	Array<CF_BakeImage> images;
+	Array<ase_t*> ases;
+	Array<CF_Image> pngs;
+	CF_DEFER(for (int i = 0; i < ases.count(); ++i) cute_aseprite_free(ases[i]));
+	CF_DEFER(for (int i = 0; i < pngs.count(); ++i) cf_image_free(&pngs[i]));
+	for (int i = 0; i < image_count; ++i) {
+		const char* path = image_paths[i];
+		if (cf_path_ext_equ(path, ".ase") || cf_path_ext_equ(path, ".aseprite")) {
+			size_t sz = 0;
+			void* data = cf_fs_read_entire_file_to_memory(path, &sz);
+			if (!data) return cf_result_error("Unable to open aseprite file.");
+			ase_t* ase = cute_aseprite_load_from_memory(data, (int)sz, NULL);
+			CF_FREE(data);
+			if (!ase) return cf_result_error("Unable to parse aseprite file.");
+			ases.add(ase);
+			for (int j = 0; j < ase->frame_count; ++j) {
+				CF_BakeImage img = { };
+				char* name = NULL;
+				sfmt(name, "%s#%d", path, j);
+				img.name = sintern(name);
+				sfree(name);
+				img.w = ase->w;
+				img.h = ase->h;
+				img.pix = (CF_Pixel*)ase->frames[j].pixels;
+				images.add(img);
+			}
+		} else {
+			CF_Image png;
+			CF_Result err = cf_image_load_png(path, &png);
+			if (cf_is_error(err)) return err;
+			pngs.add(png);
+			CF_BakeImage img = { };
+			img.name = sintern(path);
+			img.w = png.w;
+			img.h = png.h;
+			img.pix = png.pix;
+			images.add(img);
+		}
+	}
+
+	int page_count = s_shelf_pack(images, page_width, page_height, CF_BAKED_ATLAS_PADDING);
+	if (page_count < 0) {
+		return cf_result_error("An image is too large to fit on an atlas page.");
+	}
+
+	// Header.
+	Array<uint8_t> out;
+	s_write_bytes(out, CF_BAKED_ATLAS_MAGIC, 4);
+	s_write_u32(out, CF_BAKED_ATLAS_VERSION);
+	s_write_u32(out, (uint32_t)page_width);
+	s_write_u32(out, (uint32_t)page_height);
+	s_write_u32(out, (uint32_t)page_count);
+	s_write_u32(out, (uint32_t)images.count());
+
+	// Blit each page and compress it as a PNG.
+	CF_Pixel* page = (CF_Pixel*)CF_ALLOC(sizeof(CF_Pixel) * page_width * page_height);
+	CF_DEFER(CF_FREE(page));
+	for (int i = 0; i < page_count; ++i) {
+		CF_MEMSET(page, 0, sizeof(CF_Pixel) * page_width * page_height);
+		for (int j = 0; j < images.count(); ++j) {
+			CF_BakeImage* img = images + j;
+			if (img->page != i) continue;
+			for (int row = 0; row < img->h; ++row) {
+				CF_MEMCPY(page + (img->y + row) * page_width + img->x, img->pix + row * img->w, sizeof(CF_Pixel) * img->w);
+			}
+		}
+		cp_image_t cp_page = { page_width, page_height, (cp_pixel_t*)page };
+		cp_saved_png_t png = cp_save_png_to_memory(&cp_page);
+		if (!png.data) return cf_result_error("Unable to compress atlas page.");
+		s_write_u32(out, (uint32_t)png.size);
+		s_write_bytes(out, png.data, png.size);
+		CUTE_PNG_FREE(png.data);
+	}
+
+	// Sub-image table. UVs follow spritebatch's convention of flipping the y-axis.
+	float iw = 1.0f / (float)page_width;
+	float ih = 1.0f / (float)page_height;
+	for (int i = 0; i < images.count(); ++i) {
+		CF_BakeImage* img = images + i;
+		s_write_u32(out, (uint32_t)img->page);
+		s_write_u32(out, (uint32_t)img->w);
+		s_write_u32(out, (uint32_t)img->h);
+		s_write_f32(out, img->x * iw);
+		s_write_f32(out, (img->y + img->h) * ih);
+		s_write_f32(out, (img->x + img->w) * iw);
+		s_write_f32(out, img->y * ih);
+		int name_len = (int)CF_STRLEN(img->name);
+		s_write_u32(out, (uint32_t)name_len);
+		s_write_bytes(out, img->name, name_len);
+	}
+
+	return cf_fs_write_entire_buffer_to_file(out_path, out.data(), (size_t)out.count());
+}
+
+CF_Result cf_load_baked_atlas(const char* path)
+{
+	size_t sz = 0;
+	uint8_t* data = (uint8_t*)cf_fs_read_entire_file_to_memory(path, &sz);
+	if (!data) return cf_result_error("Unable to open baked atlas file.");
+	CF_DEFER(CF_FREE(data));
+	const uint8_t* in = data;
+	const uint8_t* end = data + sz;
+
+	char magic[4];
+	uint32_t version, page_width, page_height, page_count, sub_image_count;
+	if (!s_read_bytes(&in, end, magic, 4) || CF_MEMCMP(magic, CF_BAKED_ATLAS_MAGIC, 4)) return cf_result_error("Not a baked atlas file.");
+	if (!s_read_u32(&in, end, &version) || version != CF_BAKED_ATLAS_VERSION) return cf_result_error("Unsupported baked atlas version.");
+	if (!s_read_u32(&in, end, &page_width) || !s_read_u32(&in, end, &page_height)) return cf_result_error("Truncated baked atlas file.");
+	if (!s_read_u32(&in, end, &page_count) || !s_read_u32(&in, end, &sub_image_count)) return cf_result_error("Truncated baked atlas file.");
+
+	// Decode all pages up front so a corrupt file doesn't register half an atlas.
+	Array<CF_Image> pages;
+	CF_DEFER(for (int i = 0; i < pages.count(); ++i) cf_image_free(&pages[i]));
+	for (uint32_t i = 0; i < page_count; ++i) {
+		uint32_t png_size;
+		if (!s_read_u32(&in, end, &png_size) || (size_t)(end - in) < png_size) return cf_result_error("Truncated baked atlas file.");
+		CF_Image page;
+		CF_Result err = cf_image_load_png_from_memory(in, (int)png_size, &page);
+		if (cf_is_error(err)) return err;
+		cf_image_premultiply(&page);
+		pages.add(page);
+		in += png_size;
+	}
+
+	// Read the sub-image table, assigning each image a premade id.
+	uint64_t base_id = draw->baked_image_id_gen;
+	Array<Array<CF_AtlasSubImage>> page_sub_images;
+	page_sub_images.ensure_count((int)page_count);
+	Array<const char*> names;
+	for (uint32_t i = 0; i < sub_image_count; ++i) {
+		uint32_t page, w, h, name_len;
+		CF_AtlasSubImage sub_image;
+		if (!s_read_u32(&in, end, &page) || !s_read_u32(&in, end, &w) || !s_read_u32(&in, end, &h)) return cf_result_error("Truncated baked atlas file.");
+		if (!s_read_f32(&in, end, &sub_image.minx) || !s_read_f32(&in, end, &sub_image.miny)) return cf_result_error("Truncated baked atlas file.");
+		if (!s_read_f32(&in, end, &sub_image.maxx) || !s_read_f32(&in, end, &sub_image.maxy)) return cf_result_error("Truncated baked atlas file.");
+		if (!s_read_u32(&in, end, &name_len) || (size_t)(end - in) < name_len) return cf_result_error("Truncated baked atlas file.");
+		if (page >= page_count) return cf_result_error("Corrupt baked atlas file.");
+		names.add(sintern_range((const char*)in, (const char*)in + name_len));
+		in += name_len;
+		sub_image.image_id = base_id + i;
+		sub_image.w = (int)w;
+		sub_image.h = (int)h;
+		page_sub_images[page].add(sub_image);
+	}
+
+	// Register everything with the draw system.
+	draw->baked_image_id_gen += sub_image_count;
+	for (uint32_t i = 0; i < page_count; ++i) {
+		s_register_premade_atlas_pixels(pages[i].pix, pages[i].w, pages[i].h, page_sub_images[i].count(), page_sub_images[i].data());
+	}
+	draw->baked_image_names.ensure_capacity(draw->baked_image_names.count() + (int)sub_image_count);
+	for (uint32_t i = 0; i < sub_image_count; ++i) {
+		draw->baked_image_names.insert(names[i], base_id + i);
+	}
+	return cf_result_success();
 }
 
 CF_Sprite cf_make_premade_sprite(uint64_t image_id)
@@ -2521,8 +5096,264 @@ CF_Sprite cf_make_premade_sprite(uint64_t image_id)
 	CF_AtlasSubImage sub_image = draw->premade_sub_image_id_to_sub_image.find(image_id);
 	CF_Sprite s = cf_sprite_defaults();
 	s.name = "premade_sprite";
-	s.easy_sprite_id = sub_image.image_id;
+	s.easy_sprite_id = image_id;
 	s.w = sub_image.w;
 	s.h = sub_image.h;
 	return s;
 }
+
+CF_Sprite cf_make_baked_sprite(const char* name)
+{
+	uint64_t* image_id = draw->baked_image_names.try_find(sintern(name));
+	if (!image_id) return cf_sprite_defaults();
+	return cf_make_premade_sprite(*image_id);
+}
+
+struct CF_DrawListInternal
+{
+	CF_Draw state;
+	CF_Draw* prev = NULL;
+};
+
+CF_DrawList cf_make_draw_list()
+{
+	CF_DrawListInternal* list = (CF_DrawListInternal*)CF_NEW(CF_DrawListInternal);
+	list->state.recording = true;
+	CF_DrawList result;
+	result.id = (uint64_t)list;
+	cf_draw_list_reset(result);
+	return result;
+}
+
+void cf_destroy_draw_list(CF_DrawList list_handle)
+{
+	CF_DrawListInternal* list = (CF_DrawListInternal*)list_handle.id;
+	if (!list) return;
+	CF_ASSERT(draw != &list->state);
+	list->~CF_DrawListInternal();
+	CF_FREE(list);
+}
+
+void cf_draw_list_reset(CF_DrawList list_handle)
+{
+	CF_DrawListInternal* list = (CF_DrawListInternal*)list_handle.id;
+	CF_ASSERT(draw && !draw->recording);
+	CF_Draw* state = &list->state;
+	state->recorded.clear();
+	state->particle_draws.clear();
+
+	// Snapshot everything that affects how sprites are generated. Settings consumed later on, at
+	// flush time (shaders, scissors, viewports, render states), stay with the main draw state.
+	state->colors = draw->colors;
+	state->tints = draw->tints;
+	state->antialias = draw->antialias;
+	state->antialias_scale = draw->antialias_scale;
+	state->opaque = draw->opaque;
+	state->layers = draw->layers;
+	state->cam_stack = draw->cam_stack;
+	state->aaf = draw->aaf;
+	state->projection = draw->projection;
+	state->mvp = draw->mvp;
+	state->user_params = draw->user_params;
+	state->atlas_dims = draw->atlas_dims;
+	state->texel_dims = draw->texel_dims;
+	state->culling = draw->culling;
+	state->cull_stats = { };
+}
+
+void cf_draw_list_begin(CF_DrawList list_handle)
+{
+	CF_DrawListInternal* list = (CF_DrawListInternal*)list_handle.id;
+	CF_ASSERT(!list->prev);
+	list->prev = draw;
+	draw = &list->state;
+}
+
+void cf_draw_list_end(CF_DrawList list_handle)
+{
+	CF_DrawListInternal* list = (CF_DrawListInternal*)list_handle.id;
+	CF_ASSERT(draw == &list->state);
+	draw = list->prev;
+	list->prev = NULL;
+}
+
+void cf_draw_list_submit(CF_DrawList list_handle)
+{
+	CF_DrawListInternal* list = (CF_DrawListInternal*)list_handle.id;
+	CF_ASSERT(draw && !draw->recording);
+	const Array<spritebatch_sprite_t>& recorded = list->state.recorded;
+	for (int i = 0; i < recorded.count(); ++i) {
+		if (recorded[i].geom.type == BATCH_GEOMETRY_TYPE_PARTICLES) {
+			spritebatch_sprite_t s = recorded[i];
+			s.geom.particle_draw = draw->particle_draws.count();
+			draw->particle_draws.add(list->state.particle_draws[recorded[i].geom.particle_draw]);
+			spritebatch_push(&draw->sb, s);
+			continue;
+		}
+		spritebatch_push(&draw->sb, recorded[i]);
+		if (recorded[i].geom.opaque) draw->opaque_count++;
+	}
+	draw->cull_stats.tested += list->state.cull_stats.tested;
+	draw->cull_stats.culled += list->state.cull_stats.culled;
+	list->state.cull_stats = { };
+}
+
+struct CF_StaticGeometryInternal
+{
+	CF_Mesh mesh = { };
+	CF_Texture atlas = { };
+	int atlas_w = 0;
+	int atlas_h = 0;
+	CF_M3x2 mvp = cf_make_identity();
+	SpriteShaderVariant variant = SPRITE_SHADER_VARIANT_ALL;
+	Array<CF_Vertex> verts;
+};
+
+// Static geometry is recorded with a draw list on the main thread.
+static CF_DrawList s_static_recording;
+static CF_M3x2 s_static_recording_mvp;
+
+void cf_static_geometry_begin()
+{
+	CF_ASSERT(!s_static_recording.id);
+	s_static_recording = cf_make_draw_list();
+	s_static_recording_mvp = draw->mvp;
+
+	// Everything is kept, the geometry may be drawn later on from a different camera.
+	((CF_DrawListInternal*)s_static_recording.id)->state.culling = false;
+	cf_draw_list_begin(s_static_recording);
+}
+
+CF_StaticGeometry cf_static_geometry_end()
+{
+	CF_DrawList list_handle = s_static_recording;
+	CF_ASSERT(list_handle.id);
+	cf_draw_list_end(list_handle);
+	s_static_recording.id = 0;
+	CF_DrawListInternal* list = (CF_DrawListInternal*)list_handle.id;
+	CF_DEFER(cf_destroy_draw_list(list_handle));
+	Array<spritebatch_sprite_t>& sprites = list->state.recorded;
+
+	CF_StaticGeometryInternal* geometry = (CF_StaticGeometryInternal*)CF_NEW(CF_StaticGeometryInternal);
+	geometry->mvp = s_static_recording_mvp;
+	CF_StaticGeometry result;
+	result.id = (uint64_t)geometry;
+	if (!sprites.count()) return result;
+	geometry->variant = s_sprite_shader_variant(sprites.data(), sprites.count());
+
+	// Gather each unique image into a private atlas. Nothing else ever touches this atlas, so the
+	// geometry stays valid no matter how the draw API rearranges its own atlases.
+	Map<uint64_t, int> image_to_index;
+	Array<CF_BakeImage> images;
+	CF_DEFER(for (int i = 0; i < images.count(); ++i) CF_FREE(images[i].pix));
+	for (int i = 0; i < sprites.count(); ++i) {
+		spritebatch_sprite_t* s = sprites + i;
+		CF_ASSERT(s->geom.type != BATCH_GEOMETRY_TYPE_PARTICLES); // Emitters are drawn live, see `cf_draw_particles`.
+		if (image_to_index.has(s->image_id)) continue;
+		CF_ASSERT(!draw->premade_sub_image_id_to_sub_image.has(s->image_id)); // Premade atlases aren't supported.
+		CF_BakeImage img = { };
+		img.w = s->w;
+		img.h = s->h;
+		img.pix = (CF_Pixel*)CF_ALLOC(sizeof(CF_Pixel) * s->w * s->h);
+		cf_get_pixels(s->image_id, img.pix, (int)sizeof(CF_Pixel) * s->w * s->h, NULL);
+		image_to_index.insert(s->image_id, images.count());
+		images.add(img);
+	}
+	int atlas_size = 256;
+	while (s_shelf_pack(images, atlas_size, atlas_size, 1) != 1) {
+		atlas_size *= 2;
+		CF_ASSERT(atlas_size <= 8192);
+	}
+	CF_Pixel* pixels = (CF_Pixel*)CF_CALLOC(sizeof(CF_Pixel) * atlas_size * atlas_size);
+	CF_DEFER(CF_FREE(pixels));
+	for (int i = 0; i < images.count(); ++i) {
+		CF_BakeImage* img = images + i;
+		for (int row = 0; row < img->h; ++row) {
+			CF_MEMCPY(pixels + (img->y + row) * atlas_size + img->x, img->pix + row * img->w, sizeof(CF_Pixel) * img->w);
+		}
+	}
+	geometry->atlas = s_make_atlas_texture(pixels, atlas_size, atlas_size);
+	geometry->atlas_w = geometry->atlas_h = atlas_size;
+
+	// Same layering as the batcher, and within a layer the order things were drawn in. UVs cover
+	// the 1-pixel transparent border the draw API expects around each image, as the spritebatch
+	// does (see `atlas_use_border_pixels`).
+	std::stable_sort(sprites.begin(), sprites.end(), [](const spritebatch_sprite_t& a, const spritebatch_sprite_t& b) {
+		return a.sort_bits < b.sort_bits;
+	});
+	float inv = 1.0f / (float)atlas_size;
+	for (int i = 0; i < sprites.count(); ++i) {
+		spritebatch_sprite_t* s = sprites + i;
+		CF_BakeImage* img = images + image_to_index.get(s->image_id);
+		s->texture_id = geometry->atlas.id;
+		s->minx = (img->x - 1) * inv;
+		s->miny = (img->y + img->h + 1) * inv;
+		s->maxx = (img->x + img->w + 1) * inv;
+		s->maxy = (img->y - 1) * inv;
+	}
+	geometry->verts.ensure_count(s_vertex_capacity(sprites.data(), sprites.count()));
+	int vert_count = s_fill_vertices(sprites.data(), sprites.count(), geometry->verts.data());
+	geometry->verts.set_count(vert_count);
+
+	geometry->mesh = cf_make_mesh(CF_USAGE_TYPE_IMMUTABLE, vert_count * (int)sizeof(CF_Vertex), 0, 0);
+	cf_mesh_set_attributes(geometry->mesh, draw->vertex_attributes, CF_ARRAY_SIZE(draw->vertex_attributes), sizeof(CF_Vertex), 0);
+	cf_mesh_update_vertex_data(geometry->mesh, geometry->verts.data(), vert_count);
+	return result;
+}
+
+void cf_destroy_static_geometry(CF_StaticGeometry geometry_handle)
+{
+	CF_StaticGeometryInternal* geometry = (CF_StaticGeometryInternal*)geometry_handle.id;
+	if (!geometry) return;
+	if (geometry->mesh.id) cf_destroy_mesh(geometry->mesh);
+	if (geometry->atlas.id) cf_destroy_texture(geometry->atlas);
+	geometry->~CF_StaticGeometryInternal();
+	CF_FREE(geometry);
+}
+
+void cf_draw_static_geometry(CF_StaticGeometry geometry_handle)
+{
+	CF_ASSERT(!draw->recording);
+	CF_StaticGeometryInternal* geometry = (CF_StaticGeometryInternal*)geometry_handle.id;
+	if (!geometry->verts.count()) return;
+	CF_StaticDraw static_draw;
+	static_draw.geometry = geometry_handle;
+	static_draw.mvp = draw->mvp;
+	draw->static_draws.add(static_draw);
+}
+
+static bool s_m3x2_equal(CF_M3x2 a, CF_M3x2 b)
+{
+	return a.m.x.x == b.m.x.x && a.m.x.y == b.m.x.y && a.m.y.x == b.m.y.x && a.m.y.y == b.m.y.y && a.p.x == b.p.x && a.p.y == b.p.y;
+}
+
+static void s_render_static_draws(Array<CF_StaticDraw>& static_draws)
+{
+	for (int i = 0; i < static_draws.count(); ++i) {
+		CF_StaticDraw static_draw = static_draws[i];
+		CF_StaticGeometryInternal* geometry = (CF_StaticGeometryInternal*)static_draw.geometry.id;
+		if (draw->debug_mode != CF_DRAW_DEBUG_MODE_NONE) {
+			s_track_batch(NULL, 0, false, CF_BATCH_BREAK_REASON_STATIC);
+		}
+		if (s_m3x2_equal(static_draw.mvp, geometry->mvp)) {
+			// Camera hasn't moved since recording, draw straight from the GPU copy.
+			s_submit_draw(geometry->mesh, geometry->atlas, geometry->atlas_w, geometry->atlas_h, geometry->variant, false);
+			continue;
+		}
+
+		// The shader takes clip-space positions, so a new camera means re-transforming them. That's one
+		// matrix multiply per vertex, everything else about the geometry is reused as-is.
+		CF_M3x2 delta = mul(static_draw.mvp, cf_invert(geometry->mvp));
+		int vert_count = geometry->verts.count();
+		draw->verts.ensure_count(vert_count);
+		CF_Vertex* verts = draw->verts.data();
+		CF_MEMCPY(verts, geometry->verts.data(), sizeof(CF_Vertex) * vert_count);
+		for (int j = 0; j < vert_count; ++j) {
+			verts[j].posH = mul(delta, verts[j].posH);
+		}
+		cf_mesh_append_vertex_data(draw->mesh, verts, vert_count);
+		s_submit_draw(draw->mesh, geometry->atlas, geometry->atlas_w, geometry->atlas_h, geometry->variant, false);
+	}
+	static_draws.clear();
+}
+
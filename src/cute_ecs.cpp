@@ -9,9 +9,17 @@
 #include <cute_c_runtime.h>
 #include <cute_defer.h>
 #include <cute_string.h>
+#include <cute_multithreading.h>
+#include <cute_time.h>
+#include <cute_profile.h>
 
 #include <internal/cute_app_internal.h>
 #include <internal/cute_alloc_internal.h>
+#include <internal/cute_handle_table_internal.h>
+
+#include <imgui/imgui.h>
+
+#include <algorithm>
 
 using namespace Cute;
 
@@ -21,6 +29,12 @@ void* cf_get_components(CF_ComponentList component_list, const char* component_t
 	return list->find_components(component_type);
 }
 
+void* cf_get_components_by_id(CF_ComponentList component_list, int component_id)
+{
+	CF_ComponentListInternal* list = (CF_ComponentListInternal*)component_list.id;
+	return list->find_components(component_id);
+}
+
 CF_Entity* cf_get_entities(CF_ComponentList component_list)
 {
 	CF_ComponentListInternal* list = (CF_ComponentListInternal*)component_list.id;
@@ -32,9 +46,14 @@ void cf_system_begin()
 	app->system_internal_builder.clear();
 }
 
+// Bumped whenever systems, entity types or component names change, invalidating each world's
+// cached system matches.
+static uint64_t s_schema_version = 1;
+
 void cf_system_end()
 {
 	app->systems.add(app->system_internal_builder);
+	s_schema_version++;
 }
 
 void cf_system_set_name(const char* name)
@@ -50,6 +69,34 @@ void cf_system_set_update(CF_SystemUpdateFn* update_fn)
 void cf_system_require_component(const char* component_type)
 {
 	app->system_internal_builder.component_type_tuple.add(sintern(component_type));
+	app->system_internal_builder.component_read_only.add(false);
+	app->system_internal_builder.component_changed_filter.add(false);
+}
+
+void cf_system_require_component_read_only(const char* component_type)
+{
+	app->system_internal_builder.component_type_tuple.add(sintern(component_type));
+	app->system_internal_builder.component_read_only.add(true);
+	app->system_internal_builder.component_changed_filter.add(false);
+}
+
+void cf_system_set_optional_changed_filter(const char* component_type)
+{
+	component_type = sintern(component_type);
+	CF_SystemInternal& builder = app->system_internal_builder;
+	for (int i = 0; i < builder.component_type_tuple.count(); ++i) {
+		if (builder.component_type_tuple[i] == component_type) {
+			builder.component_changed_filter[i] = true;
+			return;
+		}
+	}
+	cf_system_require_component(component_type);
+	builder.component_changed_filter.last() = true;
+}
+
+void cf_system_set_optional_parallel(bool parallel)
+{
+	app->system_internal_builder.parallel = parallel;
 }
 
 void cf_system_set_optional_pre_update(void (*pre_update_fn)(void* udata))
@@ -67,19 +114,114 @@ void cf_system_set_optional_udata(void* udata)
 	app->system_internal_builder.udata = udata;
 }
 
+// ECS state private to each thread, so different worlds can update on different threads at once.
+struct CF_EcsThreadState
+{
+	// Overrides the current world on this thread, see `cf_world_bind_to_thread` and `cf_run_systems_world`.
+	CF_WorldInternal* world = NULL;
+	// The collection a system or query is iterating on this thread, a fast path for `s_collection`.
+	CF_EntityType collection_type = CF_INVALID_ENTITY_TYPE;
+	CF_EntityCollection* collection = NULL;
+};
+
+static thread_local CF_EcsThreadState s_thread;
+
 static CF_WorldInternal* s_world()
 {
-	return (CF_WorldInternal*)app->world.id;
+	return s_thread.world ? s_thread.world : (CF_WorldInternal*)app->world.id;
+}
+
+static int s_component_id(const char* component_type);
+
+// Delayed operations queued from worker threads must lock while the world's parallel systems run.
+static void s_lock_delayed(CF_WorldInternal* world)
+{
+	if (world->running_parallel) cf_mutex_lock(&world->delayed_mutex);
+}
+
+static void s_unlock_delayed(CF_WorldInternal* world)
+{
+	if (world->running_parallel) cf_mutex_unlock(&world->delayed_mutex);
+}
+
+// The threadpool is shared by all worlds, so only one world's jobs use it at a time. Whoever loses the
+// race runs their jobs inline instead, as do jobs started from within other jobs.
+static CF_AtomicInt s_threadpool_busy;
+
+static bool s_claim_threadpool()
+{
+	return app->threadpool && !cf_is_error(cf_atomic_cas(&s_threadpool_busy, 0, 1));
+}
+
+static void s_release_threadpool()
+{
+	cf_atomic_set(&s_threadpool_busy, 0);
 }
 
 static CF_INLINE uint16_t s_entity_type(CF_Entity entity)
 {
 	CF_WorldInternal* world = s_world();
-	return world->handles.get_type(entity.handle);
+	return cf_handle_table_get_type(world->handles.m_alloc, entity.handle);
+}
+
+// Allocates chunks until slots [0, slot_count) all have storage.
+static void s_ensure_chunks(CF_EntityCollection* collection, int slot_count)
+{
+	while (collection->chunks.count() * collection->chunk_capacity < slot_count) {
+		collection->chunks.add((uint8_t*)cf_aligned_alloc(max(collection->chunk_size, 1), 16));
+	}
+	collection->chunk_versions.ensure_count(collection->chunks.count() * collection->component_type_tuple.count());
+}
+
+// Frees any chunks past the entities, except for a single spare.
+static void s_trim_chunks(CF_EntityCollection* collection)
+{
+	int chunks_in_use = (collection->entity_handles.count() + collection->chunk_capacity - 1) / collection->chunk_capacity;
+	while (collection->chunks.count() > chunks_in_use + 1) {
+		cf_aligned_free(collection->chunks.pop());
+	}
+	collection->chunk_versions.ensure_count(collection->chunks.count() * collection->component_type_tuple.count());
+}
+
+// Moves the last entity into slot `index`, then frees any trailing chunks past a single spare.
+// The caller is responsible for updating the handle of the moved entity.
+static void s_remove_slot(CF_EntityCollection* collection, int index, uint64_t version)
+{
+	int last = collection->entity_handles.count() - 1;
+	if (index != last) {
+		for (int i = 0; i < collection->component_type_tuple.count(); ++i) {
+			CF_MEMCPY(collection->component(i, index), collection->component(i, last), collection->component_sizes[i]);
+		}
+		collection->mark_changed(index, version);
+	}
+	collection->entity_handles.unordered_remove(index);
+	s_trim_chunks(collection);
+}
+
+static void s_swap_slots(CF_EntityCollection* collection, int index_a, int index_b, uint64_t version)
+{
+	if (index_a == index_b) return;
+	collection->mark_changed(index_a, version);
+	collection->mark_changed(index_b, version);
+	for (int i = 0; i < collection->component_type_tuple.count(); ++i) {
+		uint8_t* a = (uint8_t*)collection->component(i, index_a);
+		uint8_t* b = (uint8_t*)collection->component(i, index_b);
+		uint8_t tmp[256];
+		for (int size = collection->component_sizes[i]; size > 0;) {
+			int n = min(size, (int)sizeof(tmp));
+			CF_MEMCPY(tmp, a, n);
+			CF_MEMCPY(a, b, n);
+			CF_MEMCPY(b, tmp, n);
+			a += n;
+			b += n;
+			size -= n;
+		}
+	}
 }
 
 CF_Entity cf_make_entity(const char* entity_type)
 {
+	CF_ALLOC_TAG_SCOPE("ecs");
 	auto type_ptr = app->entity_type_string_to_id.try_find(sintern(entity_type));
 	if (!type_ptr) {
 		return CF_INVALID_ENTITY;
@@ -93,16 +235,18 @@ CF_Entity cf_make_entity(const char* entity_type)
 	// Create the entity handle.
 	int index = collection->entity_handles.count();
 	CF_Handle h = world->handles.alloc_handle(index, type);
+	s_ensure_chunks(collection, index + 1);
 	collection->entity_handles.add(h);
+	collection->mark_changed(index, world->change_version);
 	CF_Entity entity = { h };
 
 	// Create and initialize each component.
-	const Array<const char*>& tuple = collection->component_type_tuple;
+	const CF_ComponentTypeTuple& tuple = collection->component_type_tuple;
 	for (int i = 0; i < tuple.count(); ++i) {
 		const char* component_type = tuple[i];
 		CF_ComponentConfig* config = app->component_configs.try_find(component_type);
 		CF_ASSERT(config); // `component_type` is not a valid type.
-		void* component = collection->component_tables[i].add();
+		void* component = collection->component(i, index);
 		CF_MEMSET(component, 0, config->size_of_component);
 		if (config->initializer) {
 			config->initializer(entity, component, config->initializer_udata);
@@ -112,13 +256,188 @@ CF_Entity cf_make_entity(const char* entity_type)
 	return entity;
 }
 
+// Reserves storage and handles for `count` new entities at once, returning the slot of the first.
+static int s_add_entities(CF_WorldInternal* world, CF_EntityCollection* collection, CF_EntityType type, int count, CF_Entity* out_entities)
+{
+	int first = collection->entity_handles.count();
+	s_ensure_chunks(collection, first + count);
+	collection->entity_handles.ensure_count(first + count);
+	world->handles.alloc_handles(first, count, type, collection->entity_handles.data() + first);
+	if (out_entities) {
+		CF_MEMCPY(out_entities, collection->entity_handles.data() + first, sizeof(CF_Entity) * count);
+	}
+	return first;
+}
+
+void cf_make_entities(const char* entity_type, int count, CF_Entity* out_entities)
+{
+	auto type_ptr = app->entity_type_string_to_id.try_find(sintern(entity_type));
+	if (!type_ptr) {
+		for (int i = 0; out_entities && i < count; ++i) {
+			out_entities[i] = CF_INVALID_ENTITY;
+		}
+		return;
+	}
+	if (count <= 0) return;
+	CF_EntityType type = *type_ptr;
+
+	CF_WorldInternal* world = s_world();
+	CF_EntityCollection* collection = world->entity_collections.find(type);
+	CF_ASSERT(collection);
+	int first = s_add_entities(world, collection, type, count, out_entities);
+
+	// Initialize one component type at a time, one run of contiguous slots within a chunk at a time.
+	const CF_ComponentTypeTuple& tuple = collection->component_type_tuple;
+	int capacity = collection->chunk_capacity;
+	for (int i = 0; i < tuple.count(); ++i) {
+		CF_ComponentConfig* config = app->component_configs.try_find(tuple[i]);
+		CF_ASSERT(config); // `component_type` is not a valid type.
+		int size = collection->component_sizes[i];
+		for (int index = first; index < first + count;) {
+			int run = min(capacity - index % capacity, first + count - index);
+			collection->chunk_version(index / capacity, i) = world->change_version;
+			uint8_t* components = (uint8_t*)collection->component(i, index);
+			CF_MEMSET(components, 0, size * run);
+			if (config->initializer) {
+				for (int j = 0; j < run; ++j) {
+					CF_Entity entity = { collection->entity_handles[index + j] };
+					config->initializer(entity, components + size * j, config->initializer_udata);
+				}
+			}
+			index += run;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Prefabs.
+
+CF_Prefab cf_make_prefab(const char* entity_type)
+{
+	CF_ALLOC_TAG_SCOPE("ecs");
+	CF_Prefab result = { 0 };
+	auto type_ptr = app->entity_type_string_to_id.try_find(sintern(entity_type));
+	if (!type_ptr) return result;
+
+	CF_PrefabInternal* prefab = CF_NEW(CF_PrefabInternal);
+	prefab->type = *type_ptr;
+	const CF_ComponentTypeTuple& tuple = app->entity_type_tuples[prefab->type];
+	int size = 0;
+	for (int i = 0; i < tuple.count(); ++i) {
+		const CF_ComponentConfig* config = app->component_configs.try_find(tuple[i]);
+		size = CF_ALIGN_FORWARD(size, 16);
+		prefab->offsets.add(size);
+		prefab->sizes.add((int)config->size_of_component);
+		size += (int)config->size_of_component;
+	}
+	prefab->components = (uint8_t*)cf_aligned_alloc(max(size, 1), 16);
+	CF_MEMSET(prefab->components, 0, size);
+	for (int i = 0; i < tuple.count(); ++i) {
+		const CF_ComponentConfig* config = app->component_configs.try_find(tuple[i]);
+		if (config->initializer) {
+			config->initializer(CF_INVALID_ENTITY, prefab->components + prefab->offsets[i], config->initializer_udata);
+		}
+	}
+
+	result.id = (uint64_t)prefab;
+	return result;
+}
+
+void cf_destroy_prefab(CF_Prefab prefab_handle)
+{
+	CF_PrefabInternal* prefab = (CF_PrefabInternal*)prefab_handle.id;
+	if (!prefab) return;
+	const CF_ComponentTypeTuple& tuple = app->entity_type_tuples[prefab->type];
+	for (int i = tuple.count() - 1; i >= 0; --i) {
+		const CF_ComponentConfig* config = app->component_configs.try_find(tuple[i]);
+		if (config && config->cleanup) {
+			config->cleanup(CF_INVALID_ENTITY, prefab->components + prefab->offsets[i], config->cleanup_udata);
+		}
+	}
+	prefab->~CF_PrefabInternal();
+	CF_FREE(prefab);
+}
+
+void* cf_prefab_get_component(CF_Prefab prefab_handle, const char* component_type)
+{
+	CF_PrefabInternal* prefab = (CF_PrefabInternal*)prefab_handle.id;
+	const CF_ComponentTypeTuple& tuple = app->entity_type_tuples[prefab->type];
+	component_type = sintern(component_type);
+	for (int i = 0; i < tuple.count(); ++i) {
+		if (tuple[i] == component_type) {
+			return prefab->components + prefab->offsets[i];
+		}
+	}
+	return NULL;
+}
+
+CF_Entity cf_make_entity_from_prefab(CF_Prefab prefab)
+{
+	CF_Entity entity = CF_INVALID_ENTITY;
+	cf_make_entities_from_prefab(prefab, 1, &entity, NULL, NULL);
+	return entity;
+}
+
+void cf_make_entities_from_prefab(CF_Prefab prefab_handle, int count, CF_Entity* out_entities, CF_PrefabOverrideFn* override_fn, void* udata)
+{
+	CF_ALLOC_TAG_SCOPE("ecs");
+	CF_PrefabInternal* prefab = (CF_PrefabInternal*)prefab_handle.id;
+	if (!prefab) {
+		for (int i = 0; out_entities && i < count; ++i) {
+			out_entities[i] = CF_INVALID_ENTITY;
+		}
+		return;
+	}
+	if (count <= 0) return;
+	CF_WorldInternal* world = s_world();
+	CF_EntityCollection* collection = world->entity_collections.find(prefab->type);
+	CF_ASSERT(collection);
+	int first = s_add_entities(world, collection, prefab->type, count, out_entities);
+
+	// Copy in one component type at a time, one run of contiguous slots within a chunk at a time. Each run is filled
+	// by doubling, so the number of copies grows with the log of the run length.
+	int capacity = collection->chunk_capacity;
+	for (int i = 0; i < collection->component_type_tuple.count(); ++i) {
+		int size = collection->component_sizes[i];
+		const uint8_t* src = prefab->components + prefab->offsets[i];
+		for (int index = first; index < first + count;) {
+			int run = min(capacity - index % capacity, first + count - index);
+			collection->chunk_version(index / capacity, i) = world->change_version;
+			uint8_t* components = (uint8_t*)collection->component(i, index);
+			if (size) {
+				CF_MEMCPY(components, src, size);
+				for (int filled = 1; filled < run;) {
+					int n = min(filled, run - filled);
+					CF_MEMCPY(components + size * filled, components, size * n);
+					filled += n;
+				}
+			}
+			index += run;
+		}
+	}
+
+	if (override_fn) {
+		for (int index = first; index < first + count;) {
+			int run = min(capacity - index % capacity, first + count - index);
+			CF_ComponentListInternal list;
+			list.collection = collection;
+			list.chunk = collection->chunks[index / capacity];
+			list.first = index % capacity;
+			list.entities = collection->entity_handles.data() + index;
+			CF_ComponentList component_list = { (uint64_t)&list };
+			override_fn(component_list, index - first, run, udata);
+			index += run;
+		}
+	}
+}
+
 static CF_EntityCollection* s_collection(CF_Entity entity)
 {
 	CF_EntityCollection* collection = NULL;
 	uint16_t entity_type = s_entity_type(entity);
-	if (entity_type == app->current_collection_type_being_iterated) {
+	if (entity_type == s_thread.collection_type) {
 		// Fast path -- check the current entity collection for this entity type first.
-		collection = app->current_collection_being_updated;
+		collection = s_thread.collection;
 		CF_ASSERT(collection);
 	} else {
 		// Slightly slower path -- lookup collection first.
@@ -129,79 +448,110 @@ static CF_EntityCollection* s_collection(CF_Entity entity)
 	return collection;
 }
 
-void cf_destroy_entity(CF_Entity entity)
+static void s_destroy_entity(CF_WorldInternal* world, CF_EntityCollection* collection, CF_Entity entity)
 {
-	CF_WorldInternal* world = s_world();
-	if (world->handles.valid(entity.handle)) {
-		uint16_t entity_type = s_entity_type(entity);
-		CF_EntityCollection* collection = world->entity_collections.find(entity_type);
-		CF_ASSERT(collection);
-		int index = world->handles.get_index(entity.handle);
+	int index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
 
-		// Call cleanup function on each component in reverse order.
-		for (int i = collection->component_tables.count() - 1; i >= 0 ; --i) {
-			CF_ComponentConfig* config = app->component_configs.try_find(collection->component_type_tuple[i]);
-			if (config->cleanup) {
-				config->cleanup(entity, collection->component_tables[i][index], config->cleanup_udata);
-			}
+	// Call cleanup function on each component in reverse order.
+	for (int i = collection->component_type_tuple.count() - 1; i >= 0 ; --i) {
+		CF_ComponentConfig* config = app->component_configs.try_find(collection->component_type_tuple[i]);
+		if (config->cleanup) {
+			config->cleanup(entity, collection->component(i, index), config->cleanup_udata);
 		}
+	}
+
+	// Update index in case user changed it (by destroying enties).
+	index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
 
-		// Update index in case user changed it (by destroying enties).
-		index = world->handles.get_index(entity.handle);
+	// Move the entity to the end of the active section first, so inactive entities stay packed at the end.
+	if (!cf_handle_table_active(world->handles.m_alloc, entity.handle)) {
+		collection->inactive_count--;
+	}
+	int last_active_index = collection->entity_handles.count() - collection->inactive_count - 1;
+	if (index != last_active_index) {
+		s_swap_slots(collection, index, last_active_index, world->change_version);
+		CF_Handle last_active_handle = collection->entity_handles[last_active_index];
+		collection->entity_handles[index] = last_active_handle;
+		collection->entity_handles[last_active_index] = entity.handle;
+		world->handles.update_index(last_active_handle, index);
+		index = last_active_index;
+	}
 
-		// Free the handle.
-		collection->entity_handles.unordered_remove(index);
-		world->handles.free_handle(entity.handle);
+	// Free the handle and its components.
+	s_remove_slot(collection, index, world->change_version);
+	world->handles.free_handle(entity.handle);
 
-		// Free each component.
-		for (int i = 0; i < collection->component_tables.count(); ++i) {
-			collection->component_tables[i].unordered_remove(index);
-		}
+	// Update handle of the swapped entity.
+	if (index < collection->entity_handles.size()) {
+		CF_Handle h = collection->entity_handles[index];
+		world->handles.update_index(h, index);
+	}
+}
 
-		// Update handle of the swapped entity.
-		if (index < collection->entity_handles.size()) {
-			CF_Handle h = collection->entity_handles[index];
-			world->handles.update_index(h, index);
+void cf_destroy_entity(CF_Entity entity)
+{
+	CF_WorldInternal* world = s_world();
+	if (cf_handle_table_valid(world->handles.m_alloc, entity.handle)) {
+		CF_EntityCollection* collection = world->entity_collections.find(s_entity_type(entity));
+		CF_ASSERT(collection);
+		s_destroy_entity(world, collection, entity);
+	}
+}
+
+void cf_destroy_entities(const CF_Entity* entities, int count)
+{
+	CF_WorldInternal* world = s_world();
+	CF_EntityType type = CF_INVALID_ENTITY_TYPE;
+	CF_EntityCollection* collection = NULL;
+	for (int i = 0; i < count; ++i) {
+		CF_Entity entity = entities[i];
+		if (!cf_handle_table_valid(world->handles.m_alloc, entity.handle)) continue;
+		CF_EntityType entity_type = s_entity_type(entity);
+		if (entity_type != type) {
+			type = entity_type;
+			collection = world->entity_collections.find(type);
+			CF_ASSERT(collection);
 		}
+		s_destroy_entity(world, collection, entity);
 	}
 }
 
 void cf_destroy_entity_delayed(CF_Entity entity)
 {
 	CF_WorldInternal* world = s_world();
+	s_lock_delayed(world);
 	world->delayed_destroy_entities.add(entity);
+	s_unlock_delayed(world);
 }
 
 void cf_entity_delayed_deactivate(CF_Entity entity)
 {
 	CF_WorldInternal* world = s_world();
+	s_lock_delayed(world);
 	world->delayed_deactivate_entities.add(entity);
+	s_unlock_delayed(world);
 }
 
 void cf_entity_delayed_activate(CF_Entity entity)
 {
 	CF_WorldInternal* world = s_world();
+	s_lock_delayed(world);
 	world->delayed_activate_entities.add(entity);
+	s_unlock_delayed(world);
 }
 
-void cf_entity_deactivate(CF_Entity entity)
+static void s_entity_deactivate(CF_WorldInternal* world, CF_EntityCollection* collection, CF_Entity entity)
 {
-	uint16_t entity_type = s_entity_type(entity);
-	CF_WorldInternal* world = s_world();
-	CF_EntityCollection* collection = world->entity_collections.find(entity_type);
-
-	if (world->handles.valid(entity.handle)) {
-		if (!world->handles.active(entity.handle)) {
+	if (cf_handle_table_valid(world->handles.m_alloc, entity.handle)) {
+		if (!cf_handle_table_active(world->handles.m_alloc, entity.handle)) {
 			return;
 		}
 
-		int index = world->handles.get_index(entity.handle);
+		int index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
 		int last_active_index = collection->entity_handles.count() - collection->inactive_count - 1;
 
 		// Swap the component to the end of the active section.
-		for (int i = 0; i < collection->component_tables.count(); ++i) {
-			collection->component_tables[i].swap(index, last_active_index);
-		}
+		s_swap_slots(collection, index, last_active_index, world->change_version);
 
 		collection->inactive_count++;
 
@@ -219,24 +569,26 @@ void cf_entity_deactivate(CF_Entity entity)
 	}
 }
 
-void cf_entity_activate(CF_Entity entity)
+void cf_entity_deactivate(CF_Entity entity)
 {
-	uint16_t entity_type = s_entity_type(entity);
 	CF_WorldInternal* world = s_world();
-	CF_EntityCollection* collection = world->entity_collections.find(entity_type);
+	if (cf_handle_table_valid(world->handles.m_alloc, entity.handle)) {
+		s_entity_deactivate(world, world->entity_collections.find(s_entity_type(entity)), entity);
+	}
+}
 
-	if (world->handles.valid(entity.handle)) {
-		if (world->handles.active(entity.handle)) {
+static void s_entity_activate(CF_WorldInternal* world, CF_EntityCollection* collection, CF_Entity entity)
+{
+	if (cf_handle_table_valid(world->handles.m_alloc, entity.handle)) {
+		if (cf_handle_table_active(world->handles.m_alloc, entity.handle)) {
 			return;
 		}
 
-		int index = world->handles.get_index(entity.handle);
+		int index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
 		int last_inactive_index = collection->entity_handles.count() - collection->inactive_count;
 
 		// Swap the inactive component to the beginning of the inactive section.
-		for (int i = 0; i < collection->component_tables.count(); ++i) {
-			collection->component_tables[i].swap(index, last_inactive_index);
-		}
+		s_swap_slots(collection, index, last_inactive_index, world->change_version);
 
 		collection->inactive_count--;
 
@@ -254,16 +606,24 @@ void cf_entity_activate(CF_Entity entity)
 	}
 }
 
+void cf_entity_activate(CF_Entity entity)
+{
+	CF_WorldInternal* world = s_world();
+	if (cf_handle_table_valid(world->handles.m_alloc, entity.handle)) {
+		s_entity_activate(world, world->entity_collections.find(s_entity_type(entity)), entity);
+	}
+}
+
 bool cf_entity_is_active(CF_Entity entity)
 {
 	CF_WorldInternal* world = s_world();
-	return world->handles.active(entity.handle);
+	return cf_handle_table_active(world->handles.m_alloc, entity.handle);
 }
 
 bool cf_entity_is_valid(CF_Entity entity)
 {
 	CF_WorldInternal* world = s_world();
-	return world->handles.valid(entity.handle);
+	return cf_handle_table_valid(world->handles.m_alloc, entity.handle);
 }
 
 void cf_entity_delayed_change_type(CF_Entity entity, const char* entity_type)
@@ -274,92 +634,75 @@ void cf_entity_delayed_change_type(CF_Entity entity, const char* entity_type)
 		CF_ChangeType change;
 		change.entity = entity;
 		change.type = *type_ptr;
+		s_lock_delayed(world);
 		world->delayed_change_type.add(change);
+		s_unlock_delayed(world);
 	}
 }
 
-void cf_entity_change_type(CF_Entity entity, const char* entity_type)
+// Fetches the cached component mapping from `old_collection` to `new_collection`, rebuilding it
+// whenever the ECS schema changed.
+static CF_TypeTransition* s_transition(CF_WorldInternal* world, CF_EntityType old_type, const CF_EntityCollection* old_collection, CF_EntityType new_type, const CF_EntityCollection* new_collection)
 {
-	// Lookup new/old entity types.
-	entity_type = sintern(entity_type);
-	CF_EntityType old_type = s_entity_type(entity);
-	auto type_ptr = app->entity_type_string_to_id.try_find(sintern(entity_type));
-	if (!type_ptr) return;
-	CF_EntityType new_type = *type_ptr;
-	if (old_type == new_type) return;
+	uint32_t key = ((uint32_t)old_type << 16) | new_type;
+	CF_TypeTransition** transition_ptr = world->type_transitions.try_find(key);
+	CF_TypeTransition* transition = transition_ptr ? *transition_ptr : NULL;
+	if (!transition) {
+		transition = CF_NEW(CF_TypeTransition);
+		world->type_transitions.insert(key, transition);
+	}
+	if (transition->version == s_schema_version) return transition;
+	transition->version = s_schema_version;
+	transition->old_tables.clear();
+	transition->dropped_tables.clear();
+	for (int i = 0; i < new_collection->component_ids.count(); ++i) {
+		transition->old_tables.add(old_collection->component_index(new_collection->component_ids[i]));
+	}
+	for (int i = old_collection->component_ids.count() - 1; i >= 0; --i) {
+		if (new_collection->component_index(old_collection->component_ids[i]) < 0) {
+			transition->dropped_tables.add(i);
+		}
+	}
+	return transition;
+}
 
-	// Look new/old collections.
-	CF_WorldInternal* world = s_world();
-	CF_EntityCollection* new_collection = world->entity_collections.find(new_type);
-	CF_ASSERT(new_collection);
-	CF_EntityCollection* old_collection = world->entity_collections.find(old_type);
-	CF_ASSERT(old_collection);
+static void s_change_type(CF_WorldInternal* world, CF_Entity entity, CF_EntityCollection* old_collection, CF_EntityType new_type, CF_EntityCollection* new_collection, const CF_TypeTransition* transition)
+{
+	const CF_ComponentConfig* configs = app->component_configs.items();
 
 	// Place entity handle into the new collection.
-	int old_index = world->handles.get_index(entity.handle);
+	int old_index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
 	int new_index = new_collection->entity_handles.count();
+	s_ensure_chunks(new_collection, new_index + 1);
 	new_collection->entity_handles.add(entity.handle);
-
-	// Construct the new components.
-	const Array<const char*>& new_tuple = new_collection->component_type_tuple;
-	const Array<const char*>& old_tuple = old_collection->component_type_tuple;
-	for (int i = 0; i < new_tuple.count(); ++i) {
-		// Allocate the new component.
-		const char* new_component_type = new_tuple[i];
-		CF_ComponentConfig* config = app->component_configs.try_find(new_component_type);
-		CF_ASSERT(config); // `new_component_type` is not a valid type.
-		void* new_component = new_collection->component_tables[i].add();
-
-		// Look for a matching old component.
-		bool match = false;
-		for (int i = 0; i < old_tuple.count(); ++i) {
-			const char* old_component_type = old_tuple[i];
-			if (new_component_type == old_component_type) {
-				// Copy over contents to the new component.
-				void* old_component = old_collection->component_tables[i][old_index];
-				CF_MEMCPY(new_component, old_component, config->size_of_component);
-				match = true;
-				break;
-			}
-		}
-
-		// Only perform initialization if a matching old component wasn't copied.
-		if (!match) {
-			CF_MEMSET(new_component, 0, config->size_of_component);
+	new_collection->mark_changed(new_index, world->change_version);
+
+	// Construct the new components, copying over matching old ones and initializing the rest.
+	for (int i = 0; i < transition->old_tables.count(); ++i) {
+		void* new_component = new_collection->component(i, new_index);
+		int old_table = transition->old_tables[i];
+		if (old_table >= 0) {
+			CF_MEMCPY(new_component, old_collection->component(old_table, old_index), new_collection->component_sizes[i]);
+		} else {
+			const CF_ComponentConfig* config = configs + new_collection->component_ids[i];
+			CF_MEMSET(new_component, 0, new_collection->component_sizes[i]);
 			if (config->initializer) {
 				config->initializer(entity, new_component, config->initializer_udata);
 			}
 		}
 	}
 
-	// Cleanup the old components.
-	for (int i = old_tuple.count() - 1; i >= 0 ; --i) {
-		const char* old_component_type = old_tuple[i];
-		CF_ComponentConfig* config = app->component_configs.try_find(old_component_type);
-		
-		// Look for a matching old component.
-		bool match = false;
-		for (int i = 0; i < new_tuple.count(); ++i) {
-			const char* new_component_type = new_tuple[i];
-			if (old_component_type == new_component_type) {
-				match = true;
-				break;
-			}
-		}
-
-		// Only call cleanup if an old component was not copied over.
-		if (!match && config->cleanup) {
-			config->cleanup(entity, old_collection->component_tables[i][old_index], config->cleanup_udata);
+	// Cleanup the old components that weren't copied over.
+	for (int i = 0; i < transition->dropped_tables.count(); ++i) {
+		int old_table = transition->dropped_tables[i];
+		const CF_ComponentConfig* config = configs + old_collection->component_ids[old_table];
+		if (config->cleanup) {
+			config->cleanup(entity, old_collection->component(old_table, old_index), config->cleanup_udata);
 		}
 	}
-	
-	// Remove handle from the old collection.
-	old_collection->entity_handles.unordered_remove(old_index);
 
-	// Remove the old components.
-	for (int i = 0; i < old_collection->component_tables.count(); ++i) {
-		old_collection->component_tables[i].unordered_remove(old_index);
-	}
+	// Remove handle and the old components from the old collection.
+	s_remove_slot(old_collection, old_index, world->change_version);
 
 	// Update handle of the swapped entity.
 	if (old_index < old_collection->entity_handles.size()) {
@@ -372,27 +715,75 @@ void cf_entity_change_type(CF_Entity entity, const char* entity_type)
 	world->handles.update_type(entity.handle, new_type);
 }
 
-void* cf_entity_get_component(CF_Entity entity, const char* component_type)
+void cf_entity_change_type(CF_Entity entity, const char* entity_type)
+{
+	cf_entities_change_type(&entity, 1, entity_type);
+}
+
+void cf_entities_change_type(const CF_Entity* entities, int count, const char* entity_type)
 {
+	auto type_ptr = app->entity_type_string_to_id.try_find(sintern(entity_type));
+	if (!type_ptr) return;
+	CF_EntityType new_type = *type_ptr;
 	CF_WorldInternal* world = s_world();
-	CF_EntityCollection* collection = s_collection(entity);
-	if (!collection) return NULL;
+	CF_EntityCollection* new_collection = world->entity_collections.find(new_type);
+	CF_ASSERT(new_collection);
+	if (count > 1) {
+		s_ensure_chunks(new_collection, new_collection->entity_handles.count() + count);
+		new_collection->entity_handles.ensure_capacity(new_collection->entity_handles.count() + count);
+	}
 
-	component_type = sintern(component_type);
-	const Array<const char*>& component_type_tuple = collection->component_type_tuple;
-	for (int i = 0; i < component_type_tuple.count(); ++i) {
-		if (component_type_tuple[i] == component_type) {
-			int index = world->handles.get_index(entity.handle);
-			return collection->component_tables[i][index];
+	// Runs of entities of the same old type share the transition lookup.
+	CF_EntityType old_type = CF_INVALID_ENTITY_TYPE;
+	CF_EntityCollection* old_collection = NULL;
+	CF_TypeTransition* transition = NULL;
+	for (int i = 0; i < count; ++i) {
+		CF_Entity entity = entities[i];
+		if (!cf_handle_table_valid(world->handles.m_alloc, entity.handle)) continue;
+		CF_EntityType type = s_entity_type(entity);
+		if (type == new_type) continue;
+		if (type != old_type) {
+			old_type = type;
+			old_collection = world->entity_collections.find(old_type);
+			CF_ASSERT(old_collection);
+			transition = s_transition(world, old_type, old_collection, new_type, new_collection);
 		}
+		s_change_type(world, entity, old_collection, new_type, new_collection, transition);
 	}
+}
 
-	return NULL;
+// Returns a component for writing, so also marks it as changed (see `cf_system_set_optional_changed_filter`).
+static void* s_get_component(CF_Entity entity, int component_id)
+{
+	CF_WorldInternal* world = s_world();
+	CF_EntityCollection* collection = s_collection(entity);
+	if (!collection) return NULL;
+	int table = collection->component_index(component_id);
+	if (table < 0) return NULL;
+	int index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
+	collection->chunk_version(index / collection->chunk_capacity, table) = world->change_version;
+	return collection->component(table, index);
+}
+
+void* cf_entity_get_component(CF_Entity entity, const char* component_type)
+{
+	return s_get_component(entity, s_component_id(sintern(component_type)));
 }
 
 bool cf_entity_has_component(CF_Entity entity, const char* component_type)
 {
-	return cf_entity_get_component(entity, component_type) ? true : false;
+	return cf_entity_has_component_by_id(entity, s_component_id(sintern(component_type)));
+}
+
+void* cf_entity_get_component_by_id(CF_Entity entity, int component_id)
+{
+	return s_get_component(entity, component_id);
+}
+
+bool cf_entity_has_component_by_id(CF_Entity entity, int component_id)
+{
+	CF_EntityCollection* collection = s_collection(entity);
+	return collection && collection->component_index(component_id) >= 0;
 }
 
 void cf_entity_type_rename(const char* entity_type, const char* new_entity_type_name)
@@ -412,95 +803,845 @@ void cf_entity_type_rename(const char* entity_type, const char* new_entity_type_
 
 //--------------------------------------------------------------------------------------------------
 
-static inline int s_match(const Array<const char*>& a, const Array<const char*>& b)
+// Component IDs are simply each config's position in `app->component_configs`, which
+// only ever grows.
+static int s_component_id(const char* component_type)
 {
-	int matches = 0;
-	for (int i = 0; i < a.count(); ++i) {
-		for (int j = 0; j < b.count(); ++j) {
-			if (a[i] == b[j]) {
-				++matches;
-				break;
-			}
-		}
-	}
-	return matches;
+	CF_ComponentConfig* config = app->component_configs.try_find(component_type);
+	return config ? (int)(config - app->component_configs.items()) : -1;
 }
 
-void cf_run_systems()
+static void s_build_component_index(CF_EntityCollection* collection)
 {
-	CF_WorldInternal* world = s_world();
-	int system_count = app->systems.count();
-	for (int i = 0; i < system_count; ++i) {
-		CF_SystemInternal* system = app->systems + i;
-		CF_SystemUpdateFn* update_fn = system->update_fn;
-		auto pre_update_fn = system->pre_update_fn;
-		auto post_update_fn = system->post_update_fn;
-		void* udata = system->udata;
-
-		if (pre_update_fn) pre_update_fn(udata);
-
-		if (update_fn) {
-			for (int j = 0; j < world->entity_collections.count(); ++j) {
-				CF_EntityCollection* collection = world->entity_collections.items()[j];
-				CF_ASSERT(collection->component_tables.count() == collection->component_type_tuple.count());
-				int component_count = collection->component_tables.count();
-				app->current_collection_type_being_iterated = world->entity_collections.keys()[j];
-				app->current_collection_being_updated = collection;
-				CF_DEFER(app->current_collection_type_being_iterated = CF_INVALID_ENTITY_TYPE);
-				CF_DEFER(app->current_collection_being_updated = NULL);
-
-				int matches = s_match(system->component_type_tuple, collection->component_type_tuple);
-				CF_ComponentList component_list = { (uint64_t)&app->component_list };
-
-				if (matches == system->component_type_tuple.count()) {
-					app->component_list.count = collection->component_type_tuple.count();
-					app->component_list.ptrs = &collection->component_tables;
-					app->component_list.types = collection->component_type_tuple;
-					app->component_list.entities = collection->entity_handles.data();
-					int active_count = collection->component_tables[0].count() - collection->inactive_count;
-					update_fn(component_list, active_count, udata);
-				}
-			}
-		}
-
-		if (post_update_fn) post_update_fn(udata);
+	collection->component_index_by_id.ensure_count(app->component_configs.count());
+	for (int i = 0; i < collection->component_index_by_id.count(); ++i) {
+		collection->component_index_by_id[i] = -1;
 	}
-
-	// Perform delayed operations.
-	for (int i = 0; i < world->delayed_destroy_entities.count(); ++i) {
-		CF_Entity e = world->delayed_destroy_entities[i];
-		cf_destroy_entity(e);
+	collection->component_ids.clear();
+	for (int i = 0; i < collection->component_type_tuple.count(); ++i) {
+		int id = s_component_id(collection->component_type_tuple[i]);
+		collection->component_ids.add(id);
+		if (id >= 0) collection->component_index_by_id[id] = i;
 	}
-	world->delayed_destroy_entities.clear();
+}
 
-	for (int i = 0; i < world->delayed_deactivate_entities.count(); ++i) {
-		CF_Entity e = world->delayed_deactivate_entities[i];
-		cf_entity_deactivate(e);
-	}
-	world->delayed_deactivate_entities.clear();
+int cf_component_get_id(const char* component_type)
+{
+	return s_component_id(sintern(component_type));
+}
 
-	for (int i = 0; i < world->delayed_activate_entities.count(); ++i) {
-		CF_Entity e = world->delayed_activate_entities[i];
-		cf_entity_activate(e);
-	}
-	world->delayed_activate_entities.clear();
+// Scratch lists rebuilt on every system run or schema change, kept inline so they rarely touch the heap.
+using CF_Signature = SmallArray<uint64_t, 4>;
+using CF_TableList = SmallArray<int, 16>;
 
-	for (int i = 0; i < world->delayed_change_type.count(); ++i) {
-		CF_ChangeType change = world->delayed_change_type[i];
-		const char* type = app->entity_type_id_to_string[change.type];
-		cf_entity_change_type(change.entity, type);
+// Sets one bit per component type, indexed by its component ID.
+// Returns false if any of the types were never registered.
+static bool s_signature(const CF_ComponentTypeTuple& types, CF_Signature* signature)
+{
+	int word_count = (app->component_configs.count() + 63) / 64;
+	signature->ensure_count(word_count);
+	CF_MEMSET(signature->data(), 0, sizeof(uint64_t) * word_count);
+	bool all_found = true;
+	for (int i = 0; i < types.count(); ++i) {
+		int bit = s_component_id(types[i]);
+		if (bit < 0) {
+			all_found = false;
+			continue;
+		}
+		(*signature)[bit / 64] |= 1ull << (bit % 64);
 	}
-	world->delayed_change_type.clear();
+	return all_found;
 }
 
-void cf_component_begin()
+// Returns true if signature `a` has every bit of `b` set.
+static bool s_signature_contains(const uint64_t* a, const uint64_t* b, int word_count)
 {
-	app->component_config_builder.clear();
+	for (int i = 0; i < word_count; ++i) {
+		if ((a[i] & b[i]) != b[i]) return false;
+	}
+	return true;
 }
 
+static bool s_signature_intersects(const uint64_t* a, const uint64_t* b, int word_count)
+{
+	for (int i = 0; i < word_count; ++i) {
+		if (a[i] & b[i]) return true;
+	}
+	return false;
+}
+
+static void s_update_system_matches(CF_WorldInternal* world)
+{
+	if (world->system_matches_version == s_schema_version) return;
+	world->system_matches_version = s_schema_version;
+	world->system_matches.clear();
+	world->system_match_offsets.clear();
+
+	int collection_count = world->entity_collections.count();
+	Array<uint64_t> signatures;
+	CF_Signature signature;
+	int word_count = (app->component_configs.count() + 63) / 64;
+	signatures.ensure_count(collection_count * word_count);
+	for (int i = 0; i < collection_count; ++i) {
+		s_signature(world->entity_collections.items()[i]->component_type_tuple, &signature);
+		if (word_count) CF_MEMCPY(signatures.data() + i * word_count, signature.data(), sizeof(uint64_t) * word_count);
+	}
+
+	for (int i = 0; i < app->systems.count(); ++i) {
+		world->system_match_offsets.add(world->system_matches.count());
+		if (!s_signature(app->systems[i].component_type_tuple, &signature)) continue;
+		for (int j = 0; j < collection_count; ++j) {
+			const uint64_t* collection_signature = signatures.data() + j * word_count;
+			if (s_signature_contains(collection_signature, signature.data(), word_count)) {
+				CF_SystemMatch m;
+				m.type = world->entity_collections.keys()[j];
+				m.collection = world->entity_collections.items()[j];
+				world->system_matches.add(m);
+			}
+		}
+	}
+	world->system_match_offsets.add(world->system_matches.count());
+}
+
+// Finds which of a collection's component tables a system filters on changes to, and which it writes.
+static void s_system_tables(const CF_SystemInternal* system, const CF_EntityCollection* collection, CF_TableList* filter_tables, CF_TableList* write_tables)
+{
+	filter_tables->clear();
+	write_tables->clear();
+	for (int i = 0; i < system->component_type_tuple.count(); ++i) {
+		int table = collection->component_index(s_component_id(system->component_type_tuple[i]));
+		if (table < 0) continue;
+		if (system->component_changed_filter[i]) filter_tables->add(table);
+		if (!system->component_read_only[i]) write_tables->add(table);
+	}
+}
+
+// Returns true if a system last run at change version `since` should update `chunk`, which is
+// whenever any of its filtered components changed since. The components the system writes are
+// then stamped with `version`.
+static bool s_visit_chunk(CF_EntityCollection* collection, int chunk, const CF_TableList& filter_tables, const CF_TableList& write_tables, uint64_t since, uint64_t version)
+{
+	bool changed = filter_tables.count() == 0;
+	for (int i = 0; i < filter_tables.count() && !changed; ++i) {
+		changed = collection->chunk_version(chunk, filter_tables[i]) > since;
+	}
+	if (!changed) return false;
+	for (int i = 0; i < write_tables.count(); ++i) {
+		collection->chunk_version(chunk, write_tables[i]) = version;
+	}
+	return true;
+}
+
+// Returns the milliseconds elapsed since `*ticks`, and restarts `*ticks` from now.
+static float s_profile_lap(uint64_t* ticks)
+{
+	uint64_t now = cf_get_ticks();
+	float milliseconds = (float)((double)(now - *ticks) * 1000.0 / (double)cf_get_tick_frequency());
+	*ticks = now;
+	return milliseconds;
+}
+
+static void s_run_system(CF_WorldInternal* world, int system_index)
+{
+	CF_SystemInternal* system = app->systems + system_index;
+	CF_SystemUpdateFn* update_fn = system->update_fn;
+	auto pre_update_fn = system->pre_update_fn;
+	auto post_update_fn = system->post_update_fn;
+	void* udata = system->udata;
+
+	// The system's own writes are stamped with the version it ran at, so it won't see them on its
+	// next run, while anything written after it finishes is newer.
+	uint64_t since = world->system_versions[system_index];
+	uint64_t version = ++world->change_version;
+	world->system_versions[system_index] = version;
+	CF_DEFER(world->change_version++);
+
+	CF_SystemProfile* profile = app->system_profiling ? world->system_profiles + system_index : NULL;
+	uint64_t ticks = profile ? cf_get_ticks() : 0;
+
+	if (pre_update_fn) pre_update_fn(udata);
+	if (profile) profile->pre_update_milliseconds = s_profile_lap(&ticks);
+
+	if (update_fn) {
+		CF_TableList filter_tables;
+		CF_TableList write_tables;
+		for (int j = world->system_match_offsets[system_index]; j < world->system_match_offsets[system_index + 1]; ++j) {
+			CF_EntityCollection* collection = world->system_matches[j].collection;
+			s_thread.collection_type = world->system_matches[j].type;
+			s_thread.collection = collection;
+			CF_DEFER(s_thread.collection_type = CF_INVALID_ENTITY_TYPE);
+			CF_DEFER(s_thread.collection = NULL);
+
+			// Update once per chunk of active entities.
+			s_system_tables(system, collection, &filter_tables, &write_tables);
+			int capacity = collection->chunk_capacity;
+			int chunk_count = 0;
+			for (int first = 0; first < collection->active_count(); first += capacity) {
+				if (!s_visit_chunk(collection, first / capacity, filter_tables, write_tables, since, version)) continue;
+				CF_ComponentListInternal list;
+				list.collection = collection;
+				list.chunk = collection->chunks[first / capacity];
+				list.entities = collection->entity_handles.data() + first;
+				CF_ComponentList component_list = { (uint64_t)&list };
+				int count = min(capacity, collection->active_count() - first);
+				update_fn(component_list, count, udata);
+				cf_atomic_add(&app->entities_iterated, count);
+				if (profile) profile->entity_count += count;
+				++chunk_count;
+			}
+			if (profile && chunk_count) {
+				profile->chunk_count += chunk_count;
+				profile->collection_count++;
+			}
+		}
+	}
+	if (profile) profile->update_milliseconds = s_profile_lap(&ticks);
+
+	if (post_update_fn) post_update_fn(udata);
+	if (profile) profile->post_update_milliseconds = s_profile_lap(&ticks);
+}
+
+// Two systems conflict if either one writes a component type the other accesses.
+static bool s_systems_conflict(const CF_SystemInternal* a, const CF_SystemInternal* b)
+{
+	for (int i = 0; i < a->component_type_tuple.count(); ++i) {
+		for (int j = 0; j < b->component_type_tuple.count(); ++j) {
+			if (a->component_type_tuple[i] != b->component_type_tuple[j]) continue;
+			if (!a->component_read_only[i] || !b->component_read_only[j]) return true;
+		}
+	}
+	return false;
+}
+
+struct CF_SystemJob
+{
+	CF_WorldInternal* world;
+	CF_SystemUpdateFn* update_fn;
+	void* udata;
+	CF_ComponentListInternal list;
+	int active_count;
+	// Set while profiling to record how long `update_fn` took, see `cf_system_profiling_enable`.
+	bool timed;
+	uint64_t ticks;
+};
+
+static void s_system_job(void* param)
+{
+	CF_SystemJob* job = (CF_SystemJob*)param;
+	CF_ComponentList component_list = { (uint64_t)&job->list };
+	// Worker threads see the world of whoever started the job.
+	CF_WorldInternal* world = s_thread.world;
+	s_thread.world = job->world;
+	uint64_t start = job->timed ? cf_get_ticks() : 0;
+	job->update_fn(component_list, job->active_count, job->udata);
+	if (job->timed) job->ticks = cf_get_ticks() - start;
+	s_thread.world = world;
+}
+
+static void s_add_chunk_job(Array<CF_SystemJob>* jobs, CF_SystemUpdateFn* update_fn, void* udata, CF_EntityCollection* collection, int slot)
+{
+	int capacity = collection->chunk_capacity;
+	CF_SystemJob& job = jobs->add();
+	job.update_fn = update_fn;
+	job.udata = udata;
+	job.list.collection = collection;
+	job.list.chunk = collection->chunks[slot / capacity];
+	job.list.entities = collection->entity_handles.data() + slot;
+	job.active_count = min(capacity, collection->active_count() - slot);
+	job.timed = false;
+	job.ticks = 0;
+}
+
+// Jobs only ever touch their own component list, and queue any structural changes
+// through the delayed operations.
+static void s_run_jobs(CF_WorldInternal* world, Array<CF_SystemJob>& jobs)
+{
+	for (int i = 0; i < jobs.count(); ++i) {
+		jobs[i].world = world;
+	}
+	if (jobs.count() > 1 && s_claim_threadpool()) {
+		world->running_parallel = true;
+		for (int i = 0; i < jobs.count(); ++i) {
+			cf_threadpool_add_task(app->threadpool, s_system_job, jobs + i);
+		}
+		cf_threadpool_kick_and_wait(app->threadpool);
+		world->running_parallel = false;
+		s_release_threadpool();
+	} else {
+		for (int i = 0; i < jobs.count(); ++i) {
+			s_system_job(jobs + i);
+		}
+	}
+}
+
+// Runs all systems in [first, last) assigned to `level` at once -- one job per chunk of each
+// entity collection matching each system.
+static void s_run_system_level(CF_WorldInternal* world, int first, int last, const SmallArray<int, 32>& levels, int level)
+{
+	CF_SystemProfile* profiles = app->system_profiling ? world->system_profiles.data() : NULL;
+	uint64_t ticks = profiles ? cf_get_ticks() : 0;
+
+	for (int i = first; i < last; ++i) {
+		CF_SystemInternal* system = app->systems + i;
+		if (levels[i - first] != level) continue;
+		if (system->pre_update_fn) system->pre_update_fn(system->udata);
+		if (profiles) profiles[i].pre_update_milliseconds = s_profile_lap(&ticks);
+	}
+
+	// Systems within a level share a single change version, see `s_run_system`.
+	uint64_t version = ++world->change_version;
+	Array<CF_SystemJob> jobs;
+	Array<int> job_systems;
+	CF_TableList filter_tables;
+	CF_TableList write_tables;
+	for (int i = first; i < last; ++i) {
+		CF_SystemInternal* system = app->systems + i;
+		if (levels[i - first] != level) continue;
+		uint64_t since = world->system_versions[i];
+		world->system_versions[i] = version;
+		if (!system->update_fn) continue;
+		for (int j = world->system_match_offsets[i]; j < world->system_match_offsets[i + 1]; ++j) {
+			CF_EntityCollection* collection = world->system_matches[j].collection;
+			s_system_tables(system, collection, &filter_tables, &write_tables);
+			int capacity = collection->chunk_capacity;
+			int job_count = jobs.count();
+			for (int slot = 0; slot < collection->active_count(); slot += capacity) {
+				if (!s_visit_chunk(collection, slot / capacity, filter_tables, write_tables, since, version)) continue;
+				s_add_chunk_job(&jobs, system->update_fn, system->udata, collection, slot);
+				cf_atomic_add(&app->entities_iterated, jobs.last().active_count);
+				if (profiles) {
+					jobs.last().timed = true;
+					job_systems.add(i);
+					profiles[i].entity_count += jobs.last().active_count;
+				}
+			}
+			if (profiles && jobs.count() > job_count) {
+				profiles[i].chunk_count += jobs.count() - job_count;
+				profiles[i].collection_count++;
+			}
+		}
+	}
+	s_run_jobs(world, jobs);
+
+	if (profiles) {
+		double milliseconds_per_tick = 1000.0 / (double)cf_get_tick_frequency();
+		for (int i = 0; i < jobs.count(); ++i) {
+			profiles[job_systems[i]].update_milliseconds += (float)((double)jobs[i].ticks * milliseconds_per_tick);
+		}
+		ticks = cf_get_ticks();
+	}
+
+	for (int i = first; i < last; ++i) {
+		CF_SystemInternal* system = app->systems + i;
+		if (levels[i - first] != level) continue;
+		if (system->post_update_fn) system->post_update_fn(system->udata);
+		if (profiles) profiles[i].post_update_milliseconds = s_profile_lap(&ticks);
+	}
+	world->change_version++;
+}
+
+// A queued entity along with its type, for sorting delayed operations by collection.
+struct CF_DelayedEntity
+{
+	CF_EntityType type;
+	CF_Handle handle;
+};
+
+// Sorts `entities` by type, dropping invalid and duplicate entities.
+static void s_sort_delayed(CF_WorldInternal* world, const Array<CF_Entity>& entities, Array<CF_DelayedEntity>* sorted)
+{
+	sorted->clear();
+	sorted->ensure_capacity(entities.count());
+	for (int i = 0; i < entities.count(); ++i) {
+		CF_Handle h = entities[i].handle;
+		if (!cf_handle_table_valid(world->handles.m_alloc, h)) continue;
+		sorted->add({ cf_handle_table_get_type(world->handles.m_alloc, h), h });
+	}
+	std::sort(sorted->begin(), sorted->end(), [](const CF_DelayedEntity& a, const CF_DelayedEntity& b) {
+		return a.type != b.type ? a.type < b.type : a.handle < b.handle;
+	});
+	int count = 0;
+	for (int i = 0; i < sorted->count(); ++i) {
+		if (count && (*sorted)[count - 1].handle == (*sorted)[i].handle) continue;
+		(*sorted)[count++] = (*sorted)[i];
+	}
+	sorted->set_count(count);
+}
+
+// Runs `fn` on each queued entity, looking up each collection once per batch of entities.
+static void s_activate_delayed(CF_WorldInternal* world, Array<CF_Entity>& entities, void (*fn)(CF_WorldInternal*, CF_EntityCollection*, CF_Entity))
+{
+	if (!entities.count()) return;
+	Array<CF_DelayedEntity> sorted;
+	s_sort_delayed(world, entities, &sorted);
+	entities.clear();
+	CF_EntityType type = CF_INVALID_ENTITY_TYPE;
+	CF_EntityCollection* collection = NULL;
+	for (int i = 0; i < sorted.count(); ++i) {
+		if (sorted[i].type != type) {
+			type = sorted[i].type;
+			collection = world->entity_collections.find(type);
+		}
+		fn(world, collection, { sorted[i].handle });
+	}
+}
+
+struct CF_SlotMove
+{
+	int src;
+	int dst;
+};
+
+// Packs one collection after a batch of its entities are destroyed. Moves are planned up-front on the
+// main thread, leaving only component copies for the job, so collections can be packed in parallel.
+struct CF_CompactJob
+{
+	CF_EntityCollection* collection;
+	int first_move;
+	int move_count;
+	const CF_SlotMove* moves;
+	int new_count;
+	uint64_t version;
+};
+
+static void s_compact_job(void* param)
+{
+	CF_CompactJob* job = (CF_CompactJob*)param;
+	CF_EntityCollection* collection = job->collection;
+	const CF_SlotMove* moves = job->moves + job->first_move;
+	for (int i = 0; i < collection->component_type_tuple.count(); ++i) {
+		int size = collection->component_sizes[i];
+		for (int j = 0; j < job->move_count; ++j) {
+			CF_MEMCPY(collection->component(i, moves[j].dst), collection->component(i, moves[j].src), size);
+		}
+	}
+	for (int j = 0; j < job->move_count; ++j) {
+		collection->mark_changed(moves[j].dst, job->version);
+	}
+}
+
+// Plans the moves filling the slots in `removed` (sorted), keeping active entities packed in front of inactive ones.
+// Moves must be applied in order, as active entities move out of slots inactive entities then move into.
+static void s_plan_compaction(const CF_EntityCollection* collection, const Array<int>& removed, Array<CF_SlotMove>* moves, int* removed_active_count)
+{
+	int count = collection->entity_handles.count();
+	int active_count = collection->active_count();
+	int removed_active = 0;
+	while (removed_active < removed.count() && removed[removed_active] < active_count) ++removed_active;
+	int new_active_count = active_count - removed_active;
+	int new_count = count - removed.count();
+	*removed_active_count = removed_active;
+
+	// Fills `dst` with the next surviving entity at or after `src`.
+	int src, r;
+	auto fill = [&](int dst) {
+		while (r < removed.count() && removed[r] == src) { ++r; ++src; }
+		moves->add({ src++, dst });
+	};
+
+	// Holes in the new active section are filled by the active entities past it.
+	src = new_active_count;
+	r = 0;
+	while (r < removed.count() && removed[r] < src) ++r;
+	for (int i = 0; i < removed_active && removed[i] < new_active_count; ++i) {
+		fill(removed[i]);
+	}
+
+	// The inactive section shifts down over the slots just vacated, and its own holes, from its end.
+	src = max(new_count, active_count);
+	r = 0;
+	while (r < removed.count() && removed[r] < src) ++r;
+	for (int dst = new_active_count; dst < min(active_count, new_count); ++dst) {
+		fill(dst);
+	}
+	for (int i = removed_active; i < removed.count() && removed[i] < new_count; ++i) {
+		fill(removed[i]);
+	}
+}
+
+// Destroys all queued entities a collection at a time. Component cleanups for each collection run together,
+// then each collection is packed in a single pass instead of one swap per entity.
+static void s_destroy_delayed(CF_WorldInternal* world)
+{
+	if (!world->delayed_destroy_entities.count()) return;
+	Array<CF_DelayedEntity> sorted;
+	s_sort_delayed(world, world->delayed_destroy_entities, &sorted);
+	world->delayed_destroy_entities.clear();
+	const CF_ComponentConfig* configs = app->component_configs.items();
+
+	// Cleanups run first, for every collection, as they're free to touch any entity.
+	for (int first = 0, last = 0; first < sorted.count(); first = last) {
+		CF_EntityType type = sorted[first].type;
+		while (last < sorted.count() && sorted[last].type == type) ++last;
+		CF_EntityCollection* collection = world->entity_collections.find(type);
+		for (int i = collection->component_type_tuple.count() - 1; i >= 0 ; --i) {
+			const CF_ComponentConfig* config = configs + collection->component_ids[i];
+			if (!config->cleanup) continue;
+			for (int j = first; j < last; ++j) {
+				CF_Entity entity = { sorted[j].handle };
+				// Cleanups may have destroyed entities, moving others around.
+				if (!cf_handle_table_valid(world->handles.m_alloc, entity.handle)) continue;
+				int index = cf_handle_table_get_index(world->handles.m_alloc, entity.handle);
+				config->cleanup(entity, collection->component(i, index), config->cleanup_udata);
+			}
+		}
+	}
+
+	// Plan how each collection gets packed, and update handles to match.
+	Array<CF_CompactJob> jobs;
+	Array<CF_SlotMove> moves;
+	Array<int> removed;
+	for (int first = 0, last = 0; first < sorted.count(); first = last) {
+		CF_EntityType type = sorted[first].type;
+		while (last < sorted.count() && sorted[last].type == type) ++last;
+		CF_EntityCollection* collection = world->entity_collections.find(type);
+		removed.clear();
+		for (int j = first; j < last; ++j) {
+			CF_Handle h = sorted[j].handle;
+			if (!cf_handle_table_valid(world->handles.m_alloc, h) || cf_handle_table_get_type(world->handles.m_alloc, h) != type) continue;
+			removed.add(cf_handle_table_get_index(world->handles.m_alloc, h));
+			world->handles.free_handle(h);
+		}
+		if (!removed.count()) continue;
+		std::sort(removed.begin(), removed.end());
+
+		CF_CompactJob& job = jobs.add();
+		job.collection = collection;
+		job.first_move = moves.count();
+		job.version = world->change_version;
+		job.new_count = collection->entity_handles.count() - removed.count();
+		int removed_active;
+		s_plan_compaction(collection, removed, &moves, &removed_active);
+		job.move_count = moves.count() - job.first_move;
+		for (int j = job.first_move; j < moves.count(); ++j) {
+			CF_Handle h = collection->entity_handles[moves[j].src];
+			collection->entity_handles[moves[j].dst] = h;
+			world->handles.update_index(h, moves[j].dst);
+		}
+		collection->inactive_count -= removed.count() - removed_active;
+	}
+
+	// Copy components over, then drop the emptied slots.
+	for (int i = 0; i < jobs.count(); ++i) {
+		jobs[i].moves = moves.data();
+	}
+	if (jobs.count() > 1 && moves.count() >= 1024 && s_claim_threadpool()) {
+		for (int i = 0; i < jobs.count(); ++i) {
+			cf_threadpool_add_task(app->threadpool, s_compact_job, jobs + i);
+		}
+		cf_threadpool_kick_and_wait(app->threadpool);
+		s_release_threadpool();
+	} else {
+		for (int i = 0; i < jobs.count(); ++i) {
+			s_compact_job(jobs + i);
+		}
+	}
+	for (int i = 0; i < jobs.count(); ++i) {
+		CF_EntityCollection* collection = jobs[i].collection;
+		collection->entity_handles.set_count(jobs[i].new_count);
+		s_trim_chunks(collection);
+	}
+}
+
+void cf_run_systems()
+{
+	CF_PROFILE_SCOPE("cf_run_systems");
+	CF_ALLOC_TAG_SCOPE("ecs");
+	CF_WorldInternal* world = s_world();
+	int system_count = app->systems.count();
+	s_update_system_matches(world);
+	if (world->system_versions.count() < system_count) {
+		world->system_versions.ensure_count(system_count);
+	}
+
+	bool profiling = app->system_profiling;
+	uint64_t start_ticks = profiling ? cf_get_ticks() : 0;
+	if (profiling) {
+		world->system_profiles.ensure_count(system_count);
+		for (int i = 0; i < system_count; ++i) {
+			CF_SystemProfile profile = { };
+			profile.name = app->systems[i].name;
+			profile.parallel = app->systems[i].parallel && app->threadpool;
+			world->system_profiles[i] = profile;
+		}
+	}
+
+	for (int i = 0; i < system_count;) {
+		CF_SystemInternal* system = app->systems + i;
+		if (!system->parallel || !app->threadpool) {
+			s_run_system(world, i);
+			++i;
+			continue;
+		}
+
+		// Schedule a run of consecutive parallel systems. Each system goes one level after
+		// the last earlier system it conflicts with, so conflicting systems keep their order
+		// while everything else within a level runs at once.
+		int first = i, last = i;
+		while (last < system_count && app->systems[last].parallel) ++last;
+		SmallArray<int, 32> levels;
+		levels.ensure_count(last - first);
+		int level_count = 0;
+		for (int j = first; j < last; ++j) {
+			int level = 0;
+			for (int k = first; k < j; ++k) {
+				if (s_systems_conflict(app->systems + k, app->systems + j)) {
+					level = max(level, levels[k - first] + 1);
+				}
+			}
+			levels[j - first] = level;
+			level_count = max(level_count, level + 1);
+		}
+		for (int level = 0; level < level_count; ++level) {
+			s_run_system_level(world, first, last, levels, level);
+		}
+		i = last;
+	}
+
+	// Perform delayed operations.
+	uint64_t delayed_ticks = profiling ? cf_get_ticks() : 0;
+	CF_SystemsProfile frame_profile = { };
+	frame_profile.delayed_destroy_count = world->delayed_destroy_entities.count();
+	frame_profile.delayed_deactivate_count = world->delayed_deactivate_entities.count();
+	frame_profile.delayed_activate_count = world->delayed_activate_entities.count();
+	frame_profile.delayed_change_type_count = world->delayed_change_type.count();
+
+	s_destroy_delayed(world);
+	s_activate_delayed(world, world->delayed_deactivate_entities, s_entity_deactivate);
+	s_activate_delayed(world, world->delayed_activate_entities, s_entity_activate);
+
+	// Consecutive changes to the same type go through together, in the order they were queued.
+	Array<CF_Entity> run;
+	for (int i = 0; i < world->delayed_change_type.count();) {
+		CF_EntityType type = world->delayed_change_type[i].type;
+		run.clear();
+		for (; i < world->delayed_change_type.count() && world->delayed_change_type[i].type == type; ++i) {
+			run.add(world->delayed_change_type[i].entity);
+		}
+		cf_entities_change_type(run.data(), run.count(), app->entity_type_id_to_string[type]);
+	}
+	world->delayed_change_type.clear();
+
+	if (profiling) {
+		frame_profile.delayed_milliseconds = s_profile_lap(&delayed_ticks);
+		frame_profile.milliseconds = s_profile_lap(&start_ticks);
+		frame_profile.count = system_count;
+		frame_profile.systems = world->system_profiles.data();
+		world->systems_profile = frame_profile;
+	}
+}
+
+void cf_run_systems_world(CF_World world)
+{
+	CF_WorldInternal* prev = s_thread.world;
+	s_thread.world = (CF_WorldInternal*)world.id;
+	cf_run_systems();
+	s_thread.world = prev;
+}
+
+void cf_system_profiling_enable(bool enable)
+{
+	app->system_profiling = enable;
+}
+
+CF_SystemsProfile cf_query_system_profile()
+{
+	return s_world()->systems_profile;
+}
+
+void cf_system_profile_imgui_window()
+{
+	if (!app->using_imgui) return;
+	const CF_SystemsProfile& profile = s_world()->systems_profile;
+
+	ImGui::Begin("Systems Profile");
+	if (!app->system_profiling) {
+		ImGui::Text("Profiling is off, see cf_system_profiling_enable.");
+	}
+	ImGui::Text("cf_run_systems: %.3f ms", profile.milliseconds);
+	ImGui::Text("Delayed: %.3f ms (%d destroyed, %d deactivated, %d activated, %d changed type)", profile.delayed_milliseconds, profile.delayed_destroy_count, profile.delayed_deactivate_count, profile.delayed_activate_count, profile.delayed_change_type_count);
+	if (ImGui::BeginTable("systems", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit)) {
+		ImGui::TableSetupColumn("System");
+		ImGui::TableSetupColumn("Parallel");
+		ImGui::TableSetupColumn("Pre (ms)");
+		ImGui::TableSetupColumn("Update (ms)");
+		ImGui::TableSetupColumn("Post (ms)");
+		ImGui::TableSetupColumn("Collections");
+		ImGui::TableSetupColumn("Chunks");
+		ImGui::TableSetupColumn("Entities");
+		ImGui::TableHeadersRow();
+		for (int i = 0; i < profile.count; ++i) {
+			const CF_SystemProfile& system = profile.systems[i];
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::Text("%s", system.name ? system.name : "(unnamed)");
+			ImGui::TableNextColumn(); ImGui::Text("%s", system.parallel ? "yes" : "no");
+			ImGui::TableNextColumn(); ImGui::Text("%.3f", system.pre_update_milliseconds);
+			ImGui::TableNextColumn(); ImGui::Text("%.3f", system.update_milliseconds);
+			ImGui::TableNextColumn(); ImGui::Text("%.3f", system.post_update_milliseconds);
+			ImGui::TableNextColumn(); ImGui::Text("%d", system.collection_count);
+			ImGui::TableNextColumn(); ImGui::Text("%d", system.chunk_count);
+			ImGui::TableNextColumn(); ImGui::Text("%d", system.entity_count);
+		}
+		ImGui::EndTable();
+	}
+	ImGui::End();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Queries.
+
+CF_Query cf_make_query()
+{
+	CF_QueryInternal* query = CF_NEW(CF_QueryInternal);
+	CF_Query result;
+	result.id = (uint64_t)query;
+	return result;
+}
+
+void cf_destroy_query(CF_Query query_handle)
+{
+	CF_QueryInternal* query = (CF_QueryInternal*)query_handle.id;
+	query->~CF_QueryInternal();
+	CF_FREE(query);
+}
+
+static void s_query_add(CF_Query query_handle, const char* component_type, bool read_only)
+{
+	CF_QueryInternal* query = (CF_QueryInternal*)query_handle.id;
+	query->requirements.component_type_tuple.add(sintern(component_type));
+	query->requirements.component_read_only.add(read_only);
+	query->requirements.component_changed_filter.add(false);
+	query->world_id = 0;
+}
+
+void cf_query_require_component(CF_Query query, const char* component_type)
+{
+	s_query_add(query, component_type, false);
+}
+
+void cf_query_require_component_read_only(CF_Query query, const char* component_type)
+{
+	s_query_add(query, component_type, true);
+}
+
+void cf_query_exclude_component(CF_Query query_handle, const char* component_type)
+{
+	CF_QueryInternal* query = (CF_QueryInternal*)query_handle.id;
+	query->excluded.add(sintern(component_type));
+	query->world_id = 0;
+}
+
+static void s_update_query_matches(CF_WorldInternal* world, CF_QueryInternal* query)
+{
+	if (query->world_id == world->id && query->version == s_schema_version) return;
+	query->world_id = world->id;
+	query->version = s_schema_version;
+	query->matches.clear();
+
+	CF_Signature required;
+	CF_Signature excluded;
+	CF_Signature signature;
+	if (!s_signature(query->requirements.component_type_tuple, &required)) return;
+	// Excluded types which were never registered can't be on any entity anyway.
+	s_signature(query->excluded, &excluded);
+	int word_count = (app->component_configs.count() + 63) / 64;
+	for (int i = 0; i < world->entity_collections.count(); ++i) {
+		CF_EntityCollection* collection = world->entity_collections.items()[i];
+		s_signature(collection->component_type_tuple, &signature);
+		if (!s_signature_contains(signature.data(), required.data(), word_count)) continue;
+		if (s_signature_intersects(signature.data(), excluded.data(), word_count)) continue;
+		CF_SystemMatch m;
+		m.type = world->entity_collections.keys()[i];
+		m.collection = collection;
+		query->matches.add(m);
+	}
+}
+
+int cf_query_count(CF_Query query_handle)
+{
+	CF_QueryInternal* query = (CF_QueryInternal*)query_handle.id;
+	CF_WorldInternal* world = s_world();
+	s_update_query_matches(world, query);
+	int count = 0;
+	for (int i = 0; i < query->matches.count(); ++i) {
+		count += query->matches[i].collection->active_count();
+	}
+	return count;
+}
+
+void cf_query_for_each(CF_Query query_handle, CF_SystemUpdateFn* update_fn, void* udata)
+{
+	CF_QueryInternal* query = (CF_QueryInternal*)query_handle.id;
+	CF_WorldInternal* world = s_world();
+	s_update_query_matches(world, query);
+
+	// Queries may run from within systems, so restore the system's collection afterwards.
+	CF_EcsThreadState thread = s_thread;
+	CF_TableList filter_tables;
+	CF_TableList write_tables;
+	for (int i = 0; i < query->matches.count(); ++i) {
+		CF_EntityCollection* collection = query->matches[i].collection;
+		s_thread.collection_type = query->matches[i].type;
+		s_thread.collection = collection;
+		s_system_tables(&query->requirements, collection, &filter_tables, &write_tables);
+		int capacity = collection->chunk_capacity;
+		for (int slot = 0; slot < collection->active_count(); slot += capacity) {
+			s_visit_chunk(collection, slot / capacity, filter_tables, write_tables, 0, world->change_version);
+			CF_ComponentListInternal list;
+			list.collection = collection;
+			list.chunk = collection->chunks[slot / capacity];
+			list.entities = collection->entity_handles.data() + slot;
+			CF_ComponentList component_list = { (uint64_t)&list };
+			int count = min(capacity, collection->active_count() - slot);
+			update_fn(component_list, count, udata);
+			// Queries may run from within parallel systems, so this is counted atomically.
+			cf_atomic_add(&app->entities_iterated, count);
+		}
+	}
+	s_thread = thread;
+}
+
+void cf_query_for_each_parallel(CF_Query query_handle, CF_SystemUpdateFn* update_fn, void* udata)
+{
+	CF_QueryInternal* query = (CF_QueryInternal*)query_handle.id;
+	CF_WorldInternal* world = s_world();
+	s_update_query_matches(world, query);
+
+	Array<CF_SystemJob> jobs;
+	CF_TableList filter_tables;
+	CF_TableList write_tables;
+	for (int i = 0; i < query->matches.count(); ++i) {
+		CF_EntityCollection* collection = query->matches[i].collection;
+		s_system_tables(&query->requirements, collection, &filter_tables, &write_tables);
+		int capacity = collection->chunk_capacity;
+		for (int slot = 0; slot < collection->active_count(); slot += capacity) {
+			s_visit_chunk(collection, slot / capacity, filter_tables, write_tables, 0, world->change_version);
+			s_add_chunk_job(&jobs, update_fn, udata, collection, slot);
+			cf_atomic_add(&app->entities_iterated, jobs.last().active_count);
+		}
+	}
+	s_run_jobs(world, jobs);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void cf_component_begin()
+{
+	app->component_config_builder.clear();
+}
+
+static int s_field_type_size(CF_ComponentFieldType type);
+
 void cf_component_end()
 {
+	const CF_ComponentConfig& config = app->component_config_builder;
+	for (int i = 0; i < config.fields.count(); ++i) {
+		const CF_ComponentField& field = config.fields[i];
+		CF_ASSERT(field.count > 0 && s_field_type_size(field.type)); // Invalid field, see `cf_component_add_field`.
+		CF_ASSERT(field.offset + s_field_type_size(field.type) * field.count <= (int)config.size_of_component); // Field lies outside the component.
+	}
 	app->component_configs.insert(app->component_config_builder.name, app->component_config_builder);
+	s_schema_version++;
 }
 
 void cf_component_rename(const char* component_name, const char* new_component_name)
@@ -523,6 +1664,7 @@ void cf_component_rename(const char* component_name, const char* new_component_n
 				if (type == component_name) {
 					collection->component_type_tuple[i] = new_component_name;
 				}
+				s_build_component_index(collection);
 			}
 		}
 		for (int i = 0; i < app->systems.count(); ++i) {
@@ -533,14 +1675,10 @@ void cf_component_rename(const char* component_name, const char* new_component_n
 				}
 			}
 		}
+		s_schema_version++;
 		if (app->component_config_builder.name == component_name) {
 			app->component_config_builder.name = new_component_name;
 		}
-		for (int i = 0; i < app->component_list.types.count(); ++i) {
-			if (app->component_list.types[i] == component_name) {
-				app->component_list.types[i] = new_component_name;
-			}
-		}
 	}
 }
 
@@ -566,12 +1704,63 @@ void cf_component_set_optional_cleanup(CF_ComponentFn* cleanup, void* udata)
 	app->component_config_builder.cleanup_udata = udata;
 }
 
-static void s_register_entity_type(Array<const char*> component_type_tuple, const char* entity_type_string)
+void cf_component_add_field(const char* name, CF_ComponentFieldType type, size_t offset, int count)
+{
+	CF_ComponentField field;
+	field.name = sintern(name);
+	field.type = type;
+	field.offset = (int)offset;
+	field.count = count;
+	app->component_config_builder.fields.add(field);
+}
+
+// Picks how many entities fit in each chunk, and where each component's array starts within it.
+static void s_layout_chunks(CF_EntityCollection* collection)
+{
+	int stride = 0;
+	for (int i = 0; i < collection->component_sizes.count(); ++i) {
+		stride += collection->component_sizes[i];
+	}
+	int capacity = stride ? max(1, CF_ECS_CHUNK_SIZE / stride) : CF_ECS_CHUNK_SIZE;
+
+	// Each component array starts 16-byte aligned, so shrink the capacity until the padding fits.
+	collection->component_offsets.ensure_count(collection->component_sizes.count());
+	while (true) {
+		int size = 0;
+		for (int i = 0; i < collection->component_sizes.count(); ++i) {
+			size = CF_ALIGN_FORWARD(size, 16);
+			collection->component_offsets[i] = size;
+			size += collection->component_sizes[i] * capacity;
+		}
+		if (size <= CF_ECS_CHUNK_SIZE || capacity == 1) {
+			collection->chunk_size = size;
+			break;
+		}
+		--capacity;
+	}
+	collection->chunk_capacity = capacity;
+}
+
+static void s_make_collection(CF_WorldInternal* world, CF_EntityType entity_type)
+{
+	const CF_ComponentTypeTuple& component_type_ids = app->entity_type_tuples[entity_type];
+	CF_EntityCollection* collection = CF_NEW(CF_EntityCollection);
+	world->entity_collections.insert(entity_type, collection);
+	for (int i = 0; i < component_type_ids.count(); ++i) {
+		collection->component_type_tuple.add(component_type_ids[i]);
+		CF_ComponentConfig* config = app->component_configs.try_find(component_type_ids[i]);
+		collection->component_sizes.add((int)config->size_of_component);
+	}
+	s_layout_chunks(collection);
+	s_build_component_index(collection);
+}
+
+static void s_register_entity_type(const CF_ComponentTypeTuple& component_type_tuple, const char* entity_type_string)
 {
 	// Search for all component types present in the schema.
 	int component_config_count = app->component_configs.count();
 	const CF_ComponentConfig* component_configs = app->component_configs.items();
-	Array<const char*> component_type_ids;
+	CF_ComponentTypeTuple component_type_ids;
 	for (int i = 0; i < component_config_count; ++i) {
 		const CF_ComponentConfig* config = component_configs + i;
 
@@ -593,15 +1782,9 @@ static void s_register_entity_type(Array<const char*> component_type_tuple, cons
 	CF_EntityType entity_type = app->entity_type_gen++;
 	app->entity_type_string_to_id.insert(entity_type_string_id, entity_type);
 	app->entity_type_id_to_string.add(entity_type_string_id);
-	CF_WorldInternal* world = s_world();
-	CF_EntityCollection* collection = CF_NEW(CF_EntityCollection);
-	world->entity_collections.insert(entity_type, collection);
-	for (int i = 0; i < component_type_ids.count(); ++i) {
-		collection->component_type_tuple.add(component_type_ids[i]);
-		CF_TypelessArray& table = collection->component_tables.add();
-		CF_ComponentConfig* config = app->component_configs.try_find(component_type_ids[i]);
-		table.m_element_size = config->size_of_component;
-	}
+	app->entity_type_tuples.add(component_type_ids);
+	s_schema_version++;
+	s_make_collection(s_world(), entity_type);
 }
 
 
@@ -647,9 +1830,16 @@ bool cf_is_entity_type_valid(const char* entity_type)
 	}
 }
 
+static uint64_t s_world_id_gen = 1;
+
 CF_World cf_make_world()
 {
 	CF_WorldInternal* world = CF_NEW(CF_WorldInternal);
+	world->id = s_world_id_gen++;
+	world->delayed_mutex = cf_make_mutex();
+	for (CF_EntityType type = 0; type < app->entity_type_gen; ++type) {
+		s_make_collection(world, type);
+	}
 	CF_World result;
 	result.id = (uint64_t)world;
 	return result;
@@ -663,6 +1853,12 @@ void cf_destroy_world(CF_World world_handle)
 		collection->~CF_EntityCollection();
 		CF_FREE(collection);
 	}
+	for (int i = 0; i < world->type_transitions.count(); ++i) {
+		CF_TypeTransition* transition = world->type_transitions.items()[i];
+		transition->~CF_TypeTransition();
+		CF_FREE(transition);
+	}
+	cf_destroy_mutex(&world->delayed_mutex);
 	world->~CF_WorldInternal();
 	CF_FREE(world);
 }
@@ -683,7 +1879,535 @@ CF_World cf_world_pop()
 
 CF_World cf_world_peek()
 {
-	return app->world;
+	CF_World result = { (uint64_t)s_world() };
+	return result;
+}
+
+void cf_world_bind_to_thread(CF_World world)
+{
+	s_thread.world = (CF_WorldInternal*)world.id;
+}
+
+CF_WorldSnapshot cf_make_world_snapshot()
+{
+	CF_WorldSnapshotInternal* snapshot = CF_NEW(CF_WorldSnapshotInternal);
+	CF_WorldSnapshot result;
+	result.id = (uint64_t)snapshot;
+	return result;
+}
+
+void cf_destroy_world_snapshot(CF_WorldSnapshot snapshot_handle)
+{
+	CF_WorldSnapshotInternal* snapshot = (CF_WorldSnapshotInternal*)snapshot_handle.id;
+	for (int i = 0; i < snapshot->collections.count(); ++i) {
+		CF_CollectionSnapshot* collection = snapshot->collections.items()[i];
+		collection->~CF_CollectionSnapshot();
+		CF_FREE(collection);
+	}
+	snapshot->~CF_WorldSnapshotInternal();
+	CF_FREE(snapshot);
+}
+
+// Change versions are unique within a world, so a saved chunk with the same versions as a live
+// chunk of the same world holds the same bytes.
+static bool s_chunk_matches(const CF_EntityCollection* collection, const CF_CollectionSnapshot* saved, int chunk)
+{
+	int n = collection->component_type_tuple.count();
+	return !CF_MEMCMP(collection->chunk_versions.data() + chunk * n, saved->chunk_versions.data() + chunk * n, sizeof(uint64_t) * n);
+}
+
+// Versions of spare chunk buffers mean nothing once a snapshot moves to another world.
+static void s_forget_spare_chunk_versions(const CF_EntityCollection* collection, CF_CollectionSnapshot* saved)
+{
+	int n = collection->component_type_tuple.count();
+	for (int i = saved->chunk_count * n; i < saved->chunk_versions.count(); ++i) {
+		saved->chunk_versions[i] = 0;
+	}
+}
+
+void cf_world_save_snapshot(CF_WorldSnapshot snapshot_handle)
+{
+	CF_WorldSnapshotInternal* snapshot = (CF_WorldSnapshotInternal*)snapshot_handle.id;
+	CF_WorldInternal* world = s_world();
+	bool same_world = snapshot->world_id == world->id;
+	snapshot->world_id = world->id;
+
+	cf_handle_allocator_copy(snapshot->handles.m_alloc, world->handles.m_alloc);
+	snapshot->delayed_destroy_entities = world->delayed_destroy_entities;
+	snapshot->delayed_deactivate_entities = world->delayed_deactivate_entities;
+	snapshot->delayed_activate_entities = world->delayed_activate_entities;
+	snapshot->delayed_change_type = world->delayed_change_type;
+
+	for (int i = 0; i < world->entity_collections.count(); ++i) {
+		CF_EntityType type = world->entity_collections.keys()[i];
+		CF_EntityCollection* collection = world->entity_collections.items()[i];
+		CF_CollectionSnapshot** saved_ptr = snapshot->collections.try_find(type);
+		CF_CollectionSnapshot* saved = saved_ptr ? *saved_ptr : NULL;
+		if (!saved) {
+			saved = CF_NEW(CF_CollectionSnapshot);
+			snapshot->collections.insert(type, saved);
+		}
+
+		saved->entity_handles = collection->entity_handles;
+		saved->inactive_count = collection->inactive_count;
+		int n = collection->component_type_tuple.count();
+		int capacity = collection->chunk_capacity;
+		saved->chunk_count = (collection->entity_handles.count() + capacity - 1) / capacity;
+		while (saved->chunks.count() < saved->chunk_count) {
+			saved->chunks.add((uint8_t*)cf_aligned_alloc(max(collection->chunk_size, 1), 16));
+		}
+		if (saved->chunk_versions.count() < saved->chunk_count * n) {
+			saved->chunk_versions.ensure_count(saved->chunk_count * n);
+		}
+
+		// Copy just the chunks this snapshot doesn't already hold.
+		for (int j = 0; j < saved->chunk_count; ++j) {
+			if (same_world && s_chunk_matches(collection, saved, j)) continue;
+			CF_MEMCPY(saved->chunks[j], collection->chunks[j], collection->chunk_size);
+			CF_MEMCPY(saved->chunk_versions.data() + j * n, collection->chunk_versions.data() + j * n, sizeof(uint64_t) * n);
+		}
+		if (!same_world) s_forget_spare_chunk_versions(collection, saved);
+	}
+
+	// Writes after the save must get versions the snapshot hasn't seen.
+	world->change_version++;
+}
+
+void cf_world_restore_snapshot(CF_WorldSnapshot snapshot_handle)
+{
+	CF_WorldSnapshotInternal* snapshot = (CF_WorldSnapshotInternal*)snapshot_handle.id;
+	CF_WorldInternal* world = s_world();
+	bool same_world = snapshot->world_id == world->id;
+	uint64_t version = ++world->change_version;
+
+	cf_handle_allocator_copy(world->handles.m_alloc, snapshot->handles.m_alloc);
+	world->delayed_destroy_entities = snapshot->delayed_destroy_entities;
+	world->delayed_deactivate_entities = snapshot->delayed_deactivate_entities;
+	world->delayed_activate_entities = snapshot->delayed_activate_entities;
+	world->delayed_change_type = snapshot->delayed_change_type;
+
+	for (int i = 0; i < world->entity_collections.count(); ++i) {
+		CF_EntityType type = world->entity_collections.keys()[i];
+		CF_EntityCollection* collection = world->entity_collections.items()[i];
+		CF_CollectionSnapshot** saved_ptr = snapshot->collections.try_find(type);
+		if (!saved_ptr) {
+			collection->entity_handles.clear();
+			collection->inactive_count = 0;
+			continue;
+		}
+
+		CF_CollectionSnapshot* saved = *saved_ptr;
+		collection->entity_handles = saved->entity_handles;
+		collection->inactive_count = saved->inactive_count;
+		s_ensure_chunks(collection, collection->entity_handles.count());
+
+		// Copy just the chunks that differ, stamping them as changed in both the world and the
+		// snapshot, since they now hold the same bytes.
+		int n = collection->component_type_tuple.count();
+		for (int j = 0; j < saved->chunk_count; ++j) {
+			if (same_world && s_chunk_matches(collection, saved, j)) continue;
+			CF_MEMCPY(collection->chunks[j], saved->chunks[j], collection->chunk_size);
+			for (int k = 0; k < n; ++k) {
+				collection->chunk_version(j, k) = version;
+				saved->chunk_versions[j * n + k] = version;
+			}
+		}
+		if (!same_world) s_forget_spare_chunk_versions(collection, saved);
+	}
+	snapshot->world_id = world->id;
+
+	world->change_version++;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Serialization.
+
+static int s_field_type_size(CF_ComponentFieldType type)
+{
+	switch (type) {
+	case CF_COMPONENT_FIELD_TYPE_INT8:   // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_UINT8:  // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_BOOL:   return 1;
+	case CF_COMPONENT_FIELD_TYPE_INT16:  // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_UINT16: return 2;
+	case CF_COMPONENT_FIELD_TYPE_INT32:  // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_UINT32: // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_FLOAT:  return 4;
+	case CF_COMPONENT_FIELD_TYPE_INT64:  // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_UINT64: // fall-thru
+	case CF_COMPONENT_FIELD_TYPE_DOUBLE: return 8;
+	default:                             return 0;
+	}
+}
+
+static CF_JVal s_field_value_to_json(CF_JDoc doc, CF_ComponentFieldType type, const void* p)
+{
+	switch (type) {
+	case CF_COMPONENT_FIELD_TYPE_INT8:   return cf_json_from_i64(doc, *(const int8_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_UINT8:  return cf_json_from_u64(doc, *(const uint8_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_INT16:  return cf_json_from_i64(doc, *(const int16_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_UINT16: return cf_json_from_u64(doc, *(const uint16_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_INT32:  return cf_json_from_i64(doc, *(const int32_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_UINT32: return cf_json_from_u64(doc, *(const uint32_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_INT64:  return cf_json_from_i64(doc, *(const int64_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_UINT64: return cf_json_from_u64(doc, *(const uint64_t*)p);
+	case CF_COMPONENT_FIELD_TYPE_FLOAT:  return cf_json_from_float(doc, *(const float*)p);
+	case CF_COMPONENT_FIELD_TYPE_DOUBLE: return cf_json_from_double(doc, *(const double*)p);
+	case CF_COMPONENT_FIELD_TYPE_BOOL:   return cf_json_from_bool(doc, *(const bool*)p);
+	default:                             return cf_json_from_null(doc);
+	}
+}
+
+static void s_field_value_from_json(CF_JVal val, CF_ComponentFieldType type, void* p)
+{
+	if (!cf_json_is_int(val) && !cf_json_is_float(val) && !cf_json_is_bool(val)) return;
+	switch (type) {
+	case CF_COMPONENT_FIELD_TYPE_INT8:   *(int8_t*)p = (int8_t)cf_json_get_i64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_UINT8:  *(uint8_t*)p = (uint8_t)cf_json_get_u64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_INT16:  *(int16_t*)p = (int16_t)cf_json_get_i64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_UINT16: *(uint16_t*)p = (uint16_t)cf_json_get_u64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_INT32:  *(int32_t*)p = (int32_t)cf_json_get_i64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_UINT32: *(uint32_t*)p = (uint32_t)cf_json_get_u64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_INT64:  *(int64_t*)p = cf_json_get_i64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_UINT64: *(uint64_t*)p = cf_json_get_u64(val); break;
+	case CF_COMPONENT_FIELD_TYPE_FLOAT:  *(float*)p = cf_json_get_float(val); break;
+	case CF_COMPONENT_FIELD_TYPE_DOUBLE: *(double*)p = cf_json_get_double(val); break;
+	case CF_COMPONENT_FIELD_TYPE_BOOL:   *(bool*)p = cf_json_get_bool(val); break;
+	default: break;
+	}
+}
+
+static CF_JVal s_component_to_json(CF_JDoc doc, const CF_ComponentConfig* config, const void* component)
+{
+	CF_JVal obj = cf_json_object(doc);
+	for (int i = 0; i < config->fields.count(); ++i) {
+		const CF_ComponentField& field = config->fields[i];
+		const uint8_t* p = (const uint8_t*)component + field.offset;
+		if (field.count == 1) {
+			cf_json_object_add(doc, obj, field.name, s_field_value_to_json(doc, field.type, p));
+		} else {
+			CF_JVal arr = cf_json_array(doc);
+			int size = s_field_type_size(field.type);
+			for (int j = 0; j < field.count; ++j) {
+				cf_json_array_add(arr, s_field_value_to_json(doc, field.type, p + size * j));
+			}
+			cf_json_object_add(doc, obj, field.name, arr);
+		}
+	}
+	return obj;
+}
+
+static void s_component_from_json(const CF_ComponentConfig* config, CF_JVal obj, void* component)
+{
+	if (!cf_json_is_object(obj)) return;
+	for (int i = 0; i < config->fields.count(); ++i) {
+		const CF_ComponentField& field = config->fields[i];
+		CF_JVal val = cf_json_get(obj, field.name);
+		uint8_t* p = (uint8_t*)component + field.offset;
+		if (field.count == 1) {
+			s_field_value_from_json(val, field.type, p);
+		} else if (cf_json_is_array(val)) {
+			int size = s_field_type_size(field.type);
+			int count = min(field.count, cf_json_get_len(val));
+			for (int j = 0; j < count; ++j) {
+				s_field_value_from_json(cf_json_array_at(val, j), field.type, p + size * j);
+			}
+		}
+	}
+}
+
+CF_JVal cf_component_to_json(CF_JDoc doc, const char* component_type, const void* component)
+{
+	const CF_ComponentConfig* config = app->component_configs.try_find(sintern(component_type));
+	if (!config) return cf_json_object(doc);
+	return s_component_to_json(doc, config, component);
+}
+
+void cf_component_from_json(const char* component_type, CF_JVal val, void* component)
+{
+	const CF_ComponentConfig* config = app->component_configs.try_find(sintern(component_type));
+	if (config) s_component_from_json(config, val, component);
+}
+
+// Makes `count` entities of `type` to load saved components into, returning the slot of each within `collection`.
+static void s_make_loaded_entities(CF_WorldInternal* world, const char* type, int count, Array<int>* slots)
+{
+	Array<CF_Entity> entities;
+	entities.ensure_count(count);
+	cf_make_entities(type, count, entities.data());
+	slots->ensure_count(count);
+	for (int i = 0; i < count; ++i) {
+		(*slots)[i] = cf_handle_table_get_index(world->handles.m_alloc, entities[i].handle);
+	}
+}
+
+// Inactive entities were saved last, so deactivate that many from the end.
+static void s_deactivate_loaded_entities(CF_WorldInternal* world, CF_EntityCollection* collection, const Array<int>& slots, int inactive_count)
+{
+	Array<CF_Entity> entities;
+	for (int i = slots.count() - min(inactive_count, slots.count()); i < slots.count(); ++i) {
+		entities.add(CF_Entity { collection->entity_handles[slots[i]] });
+	}
+	for (int i = entities.count() - 1; i >= 0; --i) {
+		cf_entity_deactivate(entities[i]);
+	}
+}
+
+CF_JVal cf_world_to_json(CF_JDoc doc)
+{
+	CF_ALLOC_TAG_SCOPE("ecs");
+	CF_WorldInternal* world = s_world();
+	CF_JVal root = cf_json_object(doc);
+	for (int i = 0; i < world->entity_collections.count(); ++i) {
+		CF_EntityType type = world->entity_collections.keys()[i];
+		CF_EntityCollection* collection = world->entity_collections.items()[i];
+		int count = collection->entity_handles.count();
+		if (!count) continue;
+
+		CF_JVal saved = cf_json_object(doc);
+		cf_json_object_add_int(doc, saved, "inactive", collection->inactive_count);
+		CF_JVal entities = cf_json_array(doc);
+		cf_json_object_add(doc, saved, "entities", entities);
+		for (int j = 0; j < count; ++j) {
+			cf_json_array_add_object(doc, entities);
+		}
+		// Component by component, so each field list is walked over contiguous storage.
+		for (int table = 0; table < collection->component_type_tuple.count(); ++table) {
+			const CF_ComponentConfig* config = app->component_configs.try_find(collection->component_type_tuple[table]);
+			if (!config || !config->fields.count()) continue;
+			int j = 0;
+			for (CF_JIter it = cf_json_iter(entities); !cf_json_iter_done(it); it = cf_json_iter_next(it), ++j) {
+				cf_json_object_add(doc, cf_json_iter_val(it), config->name, s_component_to_json(doc, config, collection->component(table, j)));
+			}
+		}
+		cf_json_object_add(doc, root, app->entity_type_id_to_string[type], saved);
+	}
+	return root;
+}
+
+CF_Result cf_world_from_json(CF_JVal val)
+{
+	CF_ALLOC_TAG_SCOPE("ecs");
+	if (!cf_json_is_object(val)) return cf_result_error("Expected a JSON object from `cf_world_to_json`.");
+	CF_WorldInternal* world = s_world();
+	Array<int> slots;
+	for (CF_JIter it = cf_json_iter(val); !cf_json_iter_done(it); it = cf_json_iter_next(it)) {
+		const char* type_name = sintern(cf_json_iter_key(it));
+		CF_EntityType* type = app->entity_type_string_to_id.try_find(type_name);
+		if (!type) continue;
+		CF_EntityCollection* collection = world->entity_collections.find(*type);
+		CF_JVal saved = cf_json_iter_val(it);
+		CF_JVal entities = cf_json_get(saved, "entities");
+		int count = cf_json_is_array(entities) ? cf_json_get_len(entities) : 0;
+		if (!collection || !count) continue;
+
+		s_make_loaded_entities(world, type_name, count, &slots);
+		for (int table = 0; table < collection->component_type_tuple.count(); ++table) {
+			const CF_ComponentConfig* config = app->component_configs.try_find(collection->component_type_tuple[table]);
+			if (!config || !config->fields.count()) continue;
+			int j = 0;
+			for (CF_JIter e = cf_json_iter(entities); !cf_json_iter_done(e); e = cf_json_iter_next(e), ++j) {
+				s_component_from_json(config, cf_json_get(cf_json_iter_val(e), config->name), collection->component(table, slots[j]));
+			}
+		}
+		s_deactivate_loaded_entities(world, collection, slots, cf_json_get_int(cf_json_get(saved, "inactive")));
+	}
+	return cf_result_success();
+}
+
+// Binary saves start with this, followed by the version and the number of entity types. Each entity type then has its
+// name, entity count, inactive count and component count. Each component has its name and field descriptions (name,
+// type and count), then the values of those fields for every entity, packed one entity after another.
+#define CF_WORLD_BINARY_MAGIC "CFEW"
+#define CF_WORLD_BINARY_VERSION 1
+
+struct CF_BinaryWriter
+{
+	uint8_t* data = NULL;
+	size_t size = 0;
+	size_t capacity = 0;
+
+	void write(const void* p, size_t n)
+	{
+		if (size + n > capacity) {
+			capacity = max(capacity * 2, size + n + 256);
+			data = (uint8_t*)cf_realloc(data, capacity);
+		}
+		CF_MEMCPY(data + size, p, n);
+		size += n;
+	}
+
+	void write_u8(uint8_t v) { write(&v, sizeof(v)); }
+	void write_u16(uint16_t v) { write(&v, sizeof(v)); }
+	void write_u32(uint32_t v) { write(&v, sizeof(v)); }
+	void write_string(const char* s) { uint16_t n = (uint16_t)CF_STRLEN(s); write_u16(n); write(s, n); }
+};
+
+struct CF_BinaryReader
+{
+	const uint8_t* p = NULL;
+	const uint8_t* end = NULL;
+	bool ok = true;
+
+	const uint8_t* read(size_t n)
+	{
+		if (!ok || (size_t)(end - p) < n) {
+			ok = false;
+			return NULL;
+		}
+		const uint8_t* result = p;
+		p += n;
+		return result;
+	}
+
+	template <typename T>
+	T read_value()
+	{
+		T v = 0;
+		const uint8_t* bytes = read(sizeof(T));
+		if (bytes) CF_MEMCPY(&v, bytes, sizeof(T));
+		return v;
+	}
+
+	const char* read_string()
+	{
+		uint16_t n = read_value<uint16_t>();
+		const char* s = (const char*)read(n);
+		return s ? sintern_range(s, s + n) : NULL;
+	}
+};
+
+void* cf_world_to_binary(size_t* size)
+{
+	CF_ALLOC_TAG_SCOPE("ecs");
+	CF_WorldInternal* world = s_world();
+	CF_BinaryWriter w;
+	w.write(CF_WORLD_BINARY_MAGIC, 4);
+	w.write_u32(CF_WORLD_BINARY_VERSION);
+	uint32_t type_count = 0;
+	for (int i = 0; i < world->entity_collections.count(); ++i) {
+		if (world->entity_collections.items()[i]->entity_handles.count()) ++type_count;
+	}
+	w.write_u32(type_count);
+
+	for (int i = 0; i < world->entity_collections.count(); ++i) {
+		CF_EntityType type = world->entity_collections.keys()[i];
+		CF_EntityCollection* collection = world->entity_collections.items()[i];
+		int count = collection->entity_handles.count();
+		if (!count) continue;
+
+		w.write_string(app->entity_type_id_to_string[type]);
+		w.write_u32((uint32_t)count);
+		w.write_u32((uint32_t)collection->inactive_count);
+		SmallArray<int, 8> tables;
+		for (int table = 0; table < collection->component_type_tuple.count(); ++table) {
+			const CF_ComponentConfig* config = app->component_configs.try_find(collection->component_type_tuple[table]);
+			if (config && config->fields.count()) tables.add(table);
+		}
+		w.write_u16((uint16_t)tables.count());
+
+		for (int t = 0; t < tables.count(); ++t) {
+			int table = tables[t];
+			const CF_ComponentConfig* config = app->component_configs.try_find(collection->component_type_tuple[table]);
+			w.write_string(config->name);
+			w.write_u16((uint16_t)config->fields.count());
+			for (int f = 0; f < config->fields.count(); ++f) {
+				const CF_ComponentField& field = config->fields[f];
+				w.write_string(field.name);
+				w.write_u8((uint8_t)field.type);
+				w.write_u16((uint16_t)field.count);
+			}
+			for (int j = 0; j < count; ++j) {
+				const uint8_t* component = (const uint8_t*)collection->component(table, j);
+				for (int f = 0; f < config->fields.count(); ++f) {
+					const CF_ComponentField& field = config->fields[f];
+					w.write(component + field.offset, s_field_type_size(field.type) * field.count);
+				}
+			}
+		}
+	}
+
+	if (size) *size = w.size;
+	return w.data;
+}
+
+// A saved field, and the registered field (if any) its values load into.
+struct CF_LoadedField
+{
+	int size;
+	const CF_ComponentField* field;
+	int count;
+};
+
+CF_Result cf_world_from_binary(const void* data, size_t size)
+{
+	CF_ALLOC_TAG_SCOPE("ecs");
+	CF_BinaryReader r;
+	r.p = (const uint8_t*)data;
+	r.end = r.p + size;
+	const uint8_t* magic = r.read(4);
+	if (!magic || CF_MEMCMP(magic, CF_WORLD_BINARY_MAGIC, 4)) return cf_result_error("Not a world saved by `cf_world_to_binary`.");
+	if (r.read_value<uint32_t>() != CF_WORLD_BINARY_VERSION) return cf_result_error("Unsupported version of `cf_world_to_binary`.");
+
+	CF_WorldInternal* world = s_world();
+	Array<int> slots;
+	Array<CF_LoadedField> fields;
+	uint32_t type_count = r.read_value<uint32_t>();
+	for (uint32_t i = 0; i < type_count && r.ok; ++i) {
+		const char* type_name = r.read_string();
+		int count = (int)r.read_value<uint32_t>();
+		int inactive_count = (int)r.read_value<uint32_t>();
+		int component_count = r.read_value<uint16_t>();
+		if (!r.ok) break;
+		CF_EntityType* type = app->entity_type_string_to_id.try_find(type_name);
+		CF_EntityCollection* collection = type ? world->entity_collections.find(*type) : NULL;
+		if (collection && count) s_make_loaded_entities(world, type_name, count, &slots);
+
+		for (int c = 0; c < component_count && r.ok; ++c) {
+			const char* component_name = r.read_string();
+			int field_count = r.read_value<uint16_t>();
+			const CF_ComponentConfig* config = app->component_configs.try_find(component_name);
+			int table = collection && config ? collection->component_index(s_component_id(component_name)) : -1;
+			fields.clear();
+			int stride = 0;
+			for (int f = 0; f < field_count && r.ok; ++f) {
+				const char* field_name = r.read_string();
+				CF_ComponentFieldType field_type = (CF_ComponentFieldType)r.read_value<uint8_t>();
+				int field_count = r.read_value<uint16_t>();
+				CF_LoadedField loaded = { s_field_type_size(field_type) * field_count, NULL, 0 };
+				for (int j = 0; table >= 0 && j < config->fields.count(); ++j) {
+					const CF_ComponentField& field = config->fields[j];
+					if (field.name == field_name && field.type == field_type) {
+						loaded.field = &field;
+						loaded.count = min(field.count, field_count);
+						break;
+					}
+				}
+				fields.add(loaded);
+				stride += loaded.size;
+			}
+			if (!r.ok) break;
+
+			if (table < 0) {
+				r.read((size_t)stride * count);
+				continue;
+			}
+			for (int j = 0; j < count && r.ok; ++j) {
+				uint8_t* component = (uint8_t*)collection->component(table, slots[j]);
+				for (int f = 0; f < fields.count(); ++f) {
+					const uint8_t* bytes = r.read(fields[f].size);
+					const CF_ComponentField* field = fields[f].field;
+					if (bytes && field) {
+						CF_MEMCPY(component + field->offset, bytes, s_field_type_size(field->type) * fields[f].count);
+					}
+				}
+			}
+		}
+		if (collection && count) s_deactivate_loaded_entities(world, collection, slots, inactive_count);
+	}
+
+	if (!r.ok) return cf_result_error("The world saved by `cf_world_to_binary` is truncated.");
+	return cf_result_success();
 }
 
 dyna const char** cf_get_entity_list()
@@ -734,7 +2458,7 @@ dyna const char** cf_get_component_list_for_entity_type(const char* entity_type)
 	CF_EntityCollection* collection = world->entity_collections.find(type);
 	CF_ASSERT(collection);
 
-	const Array<const char*>& component_type_tuple = collection->component_type_tuple;
+	const CF_ComponentTypeTuple& component_type_tuple = collection->component_type_tuple;
 	for (int i = 0; i < component_type_tuple.count(); ++i) {
 		const char* component_type = component_type_tuple[i];
 		CF_ComponentConfig* config = app->component_configs.try_find(component_type);
@@ -8,64 +8,112 @@
 #include <cute_result.h>
 #include <cute_c_runtime.h>
 #include <cute_alloc.h>
+#include <cute_array.h>
+#include <cute_hashtable.h>
+#include <cute_multithreading.h>
+#include <cute_time.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
+#include <internal/cute_file_system_internal.h>
+#include <internal/cute_png_cache_internal.h>
+#include <internal/cute_aseprite_cache_internal.h>
 
 #include <physfs/physfs.h>
 
+#include <stdio.h>
+
+#ifdef CF_WINDOWS
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#elif !defined(CF_EMSCRIPTEN)
+#	define CF_FILE_SYSTEM_MMAP
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#	include <dirent.h>
+#endif
+
+#if defined(CF_LINUX) || defined(CF_ANDROID)
+#	define CF_FILE_SYSTEM_INOTIFY
+#	include <sys/inotify.h>
+#	include <errno.h>
+#elif defined(CF_MACOS)
+#	define CF_FILE_SYSTEM_FSEVENTS
+#	include <CoreServices/CoreServices.h>
+#	include <dispatch/dispatch.h>
+#	include <stdlib.h>
+#endif
+
 #define CF_FILE_SYSTEM_BUFFERED_IO_SIZE (2 * CF_MB)
 
-char* cf_path_get_filename(const char* path)
+using namespace Cute;
+
+const char* cf_path_view_filename(const char* path)
 {
 	if (!path || path[0] == '\0') { return NULL; }
 
 	int at = slast_index_of(path, '/');
 
-	const char *f = path + at + 1;
-	if (f[0] != '\0') {
-		return smake(f);
-	}
-
 	// The last character was "/" so there was no filename
-	return NULL;
+	const char *f = path + at + 1;
+	return f[0] != '\0' ? f : NULL;
 }
 
-char* cf_path_get_filename_no_ext(const char* path)
+const char* cf_path_view_filename_no_ext(const char* path, int* len)
 {
-	char* s = cf_path_get_filename(path);
-	
-	if (!s) { return NULL; }
+	const char* f = cf_path_view_filename(path);
+	if (!f) { return NULL; }
 
-	int at = slast_index_of(s, '.');
+	int at = slast_index_of(f, '.');
 	if (at == 0) {
 		// The filename only has an extension
-		sfree(s);
 		return NULL;
 	}
 
-	if (at == -1) {
-		// The filename has no extension
-		return s;
-	}
-
-	// Remove the extension from the filename
-	serase(s, at, slen(s) - at);
-	return s;
+	// No '.' means the filename has no extension
+	*len = at == -1 ? (int)CF_STRLEN(f) : at;
+	return f;
 }
 
-char* cf_path_get_ext(const char* path)
+const char* cf_path_view_ext(const char* path)
 {
 	int at = slast_index_of(path, '.');
 	if (at == -1 || path[at + 1] == 0 || path[at + 1] == '/') return NULL;
-	return smake(path + at);
+	return path + at;
+}
+
+char* cf_path_get_filename(const char* path)
+{
+	const char* f = cf_path_view_filename(path);
+	return f ? smake(f) : NULL;
+}
+
+char* cf_path_get_filename_no_ext(const char* path)
+{
+	int len;
+	const char* f = cf_path_view_filename_no_ext(path, &len);
+	if (!f) { return NULL; }
+	char* s = NULL;
+	return sappend_range(s, f, f + len);
+}
+
+char* cf_path_get_ext(const char* path)
+{
+	const char* ext = cf_path_view_ext(path);
+	return ext ? smake(ext) : NULL;
 }
 
 bool cf_path_ext_equ(const char* path, const char* ext)
 {
-	int at = slast_index_of(path, '.');
-	if (at == -1 || path[at + 1] == 0 || path[at + 1] == '/') return false;
-	return sequ(path + at, ext);
+	const char* path_ext = cf_path_view_ext(path);
+	return path_ext && sequ(path_ext, ext);
 }
 
 char* cf_path_pop(const char* path)
@@ -201,6 +249,199 @@ char* cf_path_normalize(const char* path)
 
 //--------------------------------------------------------------------------------------------------
 
+//--------------------------------------------------------------------------------------------------
+// Index of every mounted path, see `cf_fs_set_index_enabled`.
+
+struct CF_FileIndexEntry
+{
+	const char* path;            // Interned, to tell apart paths with colliding hashes.
+	CF_Stat stat;
+	const char* real_dir;        // Owned by PhysFS until the mount is removed, which rebuilds the index anyway.
+	dyna const char** children;  // Interned names, for directories.
+};
+
+struct CF_FileIndex
+{
+	CF_Mutex lock;
+	bool built = false;
+	Map<uint64_t, CF_FileIndexEntry> entries;
+	// Files open for writing, during which lookups go to the mounts.
+	Map<uint64_t, int> writers;
+};
+
+static CF_FileIndex* s_index;
+
+static CF_INLINE CF_FileType s_file_type(PHYSFS_FileType type)
+{
+	switch (type)
+	{
+	case PHYSFS_FILETYPE_REGULAR: return CF_FILE_TYPE_REGULAR;
+	case PHYSFS_FILETYPE_DIRECTORY: return CF_FILE_TYPE_DIRECTORY;
+	case PHYSFS_FILETYPE_SYMLINK: return CF_FILE_TYPE_SYMLINK;
+	default: return CF_FILE_TYPE_OTHER;
+	}
+}
+
+static void s_to_stat(const PHYSFS_Stat* physfs_stat, CF_Stat* stat)
+{
+	stat->type = s_file_type(physfs_stat->filetype);
+	stat->is_read_only = physfs_stat->readonly;
+	stat->size = physfs_stat->filesize;
+	stat->last_modified_time = physfs_stat->modtime;
+	stat->created_time = physfs_stat->createtime;
+	stat->last_accessed_time = physfs_stat->accesstime;
+}
+
+// Writes `virtual_path` as PhysFS sees it, without leading, trailing or doubled slashes. Returns false for
+// paths the index can't answer, such as with "." or "..", which PhysFS rejects with its own errors.
+static bool s_index_key(const char* virtual_path, char* key, int capacity, int* len)
+{
+	int n = 0;
+	const char* p = virtual_path;
+	while (*p) {
+		while (*p == '/') ++p;
+		if (!*p) break;
+		const char* end = p;
+		while (*end && *end != '/') {
+			if (*end == '\\' || *end == ':') return false;
+			++end;
+		}
+		int part = (int)(end - p);
+		if ((part == 1 && p[0] == '.') || (part == 2 && p[0] == '.' && p[1] == '.')) return false;
+		if (n + part + 2 > capacity) return false;
+		if (n) key[n++] = '/';
+		CF_MEMCPY(key + n, p, part);
+		n += part;
+		p = end;
+	}
+	key[n] = 0;
+	*len = n;
+	return true;
+}
+
+static void s_index_add(CF_FileIndex* index, const char* path)
+{
+	PHYSFS_Stat physfs_stat;
+	if (!PHYSFS_stat(path, &physfs_stat)) return;
+	CF_FileIndexEntry entry;
+	entry.path = sintern(path);
+	s_to_stat(&physfs_stat, &entry.stat);
+	entry.real_dir = PHYSFS_getRealDir(path);
+	entry.children = NULL;
+
+	char** list = NULL;
+	if (physfs_stat.filetype == PHYSFS_FILETYPE_DIRECTORY) {
+		list = PHYSFS_enumerateFiles(path);
+		for (char** name = list; list && *name; ++name) {
+			apush(entry.children, sintern(*name));
+		}
+	}
+	uint64_t key = cf_fnv1a(path, (int)CF_STRLEN(path));
+	if (index->entries.has(key)) {
+		// A hash collision, so leave both paths to the mounts.
+		index->entries.get(key).path = NULL;
+		afree(entry.children);
+	} else {
+		index->entries.insert(key, entry);
+	}
+
+	if (list) {
+		char* child = NULL;
+		for (char** name = list; *name; ++name) {
+			sset(child, path);
+			if (*path) sappend(child, "/");
+			sappend(child, *name);
+			s_index_add(index, child);
+		}
+		sfree(child);
+		PHYSFS_freeList(list);
+	}
+}
+
+static void s_index_clear(CF_FileIndex* index)
+{
+	for (int i = 0; i < index->entries.count(); ++i) {
+		afree(index->entries.items()[i].children);
+	}
+	index->entries.clear();
+	index->built = false;
+}
+
+static void s_index_invalidate()
+{
+	CF_FileIndex* index = s_index;
+	if (!index) return;
+	cf_mutex_lock(&index->lock);
+	s_index_clear(index);
+	cf_mutex_unlock(&index->lock);
+}
+
+static void s_index_begin_write(CF_File* file)
+{
+	CF_FileIndex* index = s_index;
+	if (!index || !file) return;
+	cf_mutex_lock(&index->lock);
+	index->writers.insert((uint64_t)file, 0);
+	s_index_clear(index);
+	cf_mutex_unlock(&index->lock);
+}
+
+static void s_index_end_write(CF_File* file)
+{
+	CF_FileIndex* index = s_index;
+	if (!index) return;
+	cf_mutex_lock(&index->lock);
+	if (index->writers.has((uint64_t)file)) {
+		index->writers.remove((uint64_t)file);
+		s_index_clear(index);
+	}
+	cf_mutex_unlock(&index->lock);
+}
+
+// Looks up `virtual_path` with the index lock held, building the index first if needed. Returns false when the index can't
+// answer, in which case the lock isn't held. Otherwise `*entry` is `NULL` for paths that don't exist.
+static bool s_index_lock_and_find(const char* virtual_path, CF_FileIndexEntry** entry)
+{
+	CF_FileIndex* index = s_index;
+	if (!index) return false;
+	char key[1024];
+	int len;
+	if (!s_index_key(virtual_path, key, sizeof(key), &len)) return false;
+	cf_mutex_lock(&index->lock);
+	if (index->writers.count()) {
+		cf_mutex_unlock(&index->lock);
+		return false;
+	}
+	if (!index->built) {
+		s_index_add(index, "");
+		index->built = true;
+	}
+	*entry = index->entries.try_find(cf_fnv1a(key, len));
+	if (*entry && (!(*entry)->path || CF_STRCMP((*entry)->path, key))) {
+		if (!(*entry)->path) {
+			// Colliding paths.
+			cf_mutex_unlock(&index->lock);
+			return false;
+		}
+		*entry = NULL;
+	}
+	return true;
+}
+
+void cf_fs_set_index_enabled(bool enabled)
+{
+	if (enabled && !s_index) {
+		s_index = CF_NEW(CF_FileIndex);
+		s_index->lock = cf_make_mutex();
+	} else if (!enabled && s_index) {
+		s_index_clear(s_index);
+		cf_destroy_mutex(&s_index->lock);
+		s_index->~CF_FileIndex();
+		CF_FREE(s_index);
+		s_index = NULL;
+	}
+}
+
 const char* cf_fs_get_base_directory()
 {
 	return PHYSFS_getBaseDir();
@@ -211,15 +452,21 @@ CF_Result cf_fs_set_write_directory(const char* platform_dependent_directory)
 	if (!PHYSFS_setWriteDir(platform_dependent_directory)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
+		s_index_invalidate();
 		return cf_result_success();
 	}
 }
 
+static void s_watch_on_mount(const char* archive);
+static void s_watch_on_dismount(const char* archive);
+
 CF_Result cf_fs_mount(const char* archive, const char* mount_point, bool append_to_path)
 {
 	if (!PHYSFS_mount(archive, mount_point, (int)append_to_path)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
+		s_index_invalidate();
+		s_watch_on_mount(archive);
 		return cf_result_success();
 	}
 }
@@ -229,33 +476,26 @@ CF_Result cf_fs_dismount(const char* archive)
 	if (!PHYSFS_unmount(archive)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
+		s_index_invalidate();
+		s_watch_on_dismount(archive);
 		return cf_result_success();
 	}
 }
 
-static CF_INLINE CF_FileType s_file_type(PHYSFS_FileType type)
+CF_Result cf_fs_stat(const char* virtual_path, CF_Stat* stat)
 {
-	switch (type)
-	{
-	case PHYSFS_FILETYPE_REGULAR: return CF_FILE_TYPE_REGULAR;
-	case PHYSFS_FILETYPE_DIRECTORY: return CF_FILE_TYPE_DIRECTORY;
-	case PHYSFS_FILETYPE_SYMLINK: return CF_FILE_TYPE_SYMLINK;
-	default: return CF_FILE_TYPE_OTHER;
+	CF_FileIndexEntry* entry;
+	if (s_index_lock_and_find(virtual_path, &entry)) {
+		if (entry) *stat = entry->stat;
+		cf_mutex_unlock(&s_index->lock);
+		return entry ? cf_result_success() : cf_result_error(PHYSFS_getErrorByCode(PHYSFS_ERR_NOT_FOUND));
 	}
-}
 
-CF_Result cf_fs_stat(const char* virtual_path, CF_Stat* stat)
-{
 	PHYSFS_Stat physfs_stat;
 	if (!PHYSFS_stat(virtual_path, &physfs_stat)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
-		stat->type = s_file_type(physfs_stat.filetype);
-		stat->is_read_only = physfs_stat.readonly;
-		stat->size = physfs_stat.filesize;
-		stat->last_modified_time = physfs_stat.modtime;
-		stat->created_time = physfs_stat.createtime;
-		stat->last_accessed_time = physfs_stat.accesstime;
+		s_to_stat(&physfs_stat, stat);
 		return cf_result_success();
 	}
 }
@@ -269,6 +509,7 @@ CF_File* cf_fs_create_file(const char* virtual_path)
 		PHYSFS_close(file);
 		return NULL;
 	}
+	s_index_begin_write((CF_File*)file);
 	return (CF_File*)file;
 }
 
@@ -281,6 +522,7 @@ CF_File* cf_fs_open_file_for_write(const char* virtual_path)
 		PHYSFS_close(file);
 		return NULL;
 	}
+	s_index_begin_write((CF_File*)file);
 	return (CF_File*)file;
 }
 
@@ -293,6 +535,7 @@ CF_File* cf_fs_open_file_for_append(const char* virtual_path)
 		PHYSFS_close(file);
 		return NULL;
 	}
+	s_index_begin_write((CF_File*)file);
 	return (CF_File*)file;
 }
 
@@ -310,6 +553,7 @@ CF_File* cf_fs_open_file_for_read(const char* virtual_path)
 
 CF_Result cf_fs_close(CF_File* file)
 {
+	s_index_end_write(file);
 	if (!PHYSFS_close((PHYSFS_file*)file)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
@@ -322,6 +566,7 @@ CF_Result cf_fs_remove(const char* virtual_path)
 	if (!PHYSFS_delete(virtual_path)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
+		s_index_invalidate();
 		return cf_result_success();
 	}
 }
@@ -331,12 +576,29 @@ CF_Result cf_fs_create_directory(const char* virtual_path)
 	if (!PHYSFS_mkdir(virtual_path)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
+		s_index_invalidate();
 		return cf_result_success();
 	}
 }
 
 const char** cf_fs_enumerate_directory(const char* virtual_path)
 {
+	CF_FileIndexEntry* entry;
+	if (s_index_lock_and_find(virtual_path, &entry)) {
+		// Allocated as PhysFS would, for `cf_fs_free_enumerated_directory`.
+		const PHYSFS_Allocator* allocator = PHYSFS_getAllocator();
+		int count = entry && entry->children ? alen(entry->children) : 0;
+		char** list = (char**)allocator->Malloc(sizeof(char*) * (count + 1));
+		for (int i = 0; i < count; ++i) {
+			size_t len = CF_STRLEN(entry->children[i]) + 1;
+			list[i] = (char*)allocator->Malloc(len);
+			CF_MEMCPY(list[i], entry->children[i], len);
+		}
+		list[count] = NULL;
+		cf_mutex_unlock(&s_index->lock);
+		return (const char**)list;
+	}
+
 	const char** file_list = (const char**)PHYSFS_enumerateFiles(virtual_path);
 	if (!file_list) {
 		return NULL;
@@ -361,11 +623,22 @@ const char* cf_fs_get_user_directory(const char* company_name, const char* game_
 
 const char* cf_fs_get_actual_path(const char* virtual_path)
 {
+	CF_FileIndexEntry* entry;
+	if (s_index_lock_and_find(virtual_path, &entry)) {
+		const char* real_dir = entry ? entry->real_dir : NULL;
+		cf_mutex_unlock(&s_index->lock);
+		return real_dir;
+	}
 	return PHYSFS_getRealDir(virtual_path);
 }
 
 bool cf_fs_file_exists(const char* virtual_path)
 {
+	CF_FileIndexEntry* entry;
+	if (s_index_lock_and_find(virtual_path, &entry)) {
+		cf_mutex_unlock(&s_index->lock);
+		return entry != NULL;
+	}
 	return PHYSFS_exists(virtual_path) ? true : false;
 }
 
@@ -462,11 +735,1168 @@ CF_Result cf_fs_init(const char* argv0)
 	if (!PHYSFS_init(argv0)) {
 		return cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
 	} else {
+		cf_register_pack_archiver();
 		return cf_result_success();
 	}
 }
 
+//--------------------------------------------------------------------------------------------------
+// Memory-mapped reads.
+
+struct CF_FileMapping
+{
+	// The whole OS mapping, which for archive entries is the entire archive. For files that couldn't be
+	// mapped, the allocation from `cf_fs_read_entire_file_to_memory` instead.
+	void* base;
+	size_t length;
+	bool mapped;
+#ifdef CF_WINDOWS
+	HANDLE handle;
+#endif
+};
+
+// Keyed by the pointer handed out from `cf_fs_map_file`.
+static Map<uint64_t, CF_FileMapping> s_mappings;
+
+// Maps an entire file on disk, if it's a regular non-empty file.
+static bool s_os_map(const char* os_path, CF_FileMapping* mapping)
+{
+#if defined(CF_WINDOWS)
+	int wide_count = MultiByteToWideChar(CP_UTF8, 0, os_path, -1, NULL, 0);
+	if (!wide_count) return false;
+	wchar_t* wide_path = (wchar_t*)CF_ALLOC(sizeof(wchar_t) * wide_count);
+	MultiByteToWideChar(CP_UTF8, 0, os_path, -1, wide_path, wide_count);
+	HANDLE file = CreateFileW(wide_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	CF_FREE(wide_path);
+	if (file == INVALID_HANDLE_VALUE) return false;
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || (uint64_t)size.QuadPart > (uint64_t)SIZE_MAX) {
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE handle = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	CloseHandle(file);
+	if (!handle) return false;
+	void* base = MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+	if (!base) {
+		CloseHandle(handle);
+		return false;
+	}
+	mapping->base = base;
+	mapping->length = (size_t)size.QuadPart;
+	mapping->mapped = true;
+	mapping->handle = handle;
+	return true;
+#elif defined(CF_FILE_SYSTEM_MMAP)
+	int fd = open(os_path, O_RDONLY);
+	if (fd < 0) return false;
+	struct stat st;
+	if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size <= 0 || (uint64_t)st.st_size > (uint64_t)SIZE_MAX) {
+		close(fd);
+		return false;
+	}
+	void* base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED) return false;
+	mapping->base = base;
+	mapping->length = (size_t)st.st_size;
+	mapping->mapped = true;
+	return true;
+#else
+	CF_UNUSED(os_path);
+	CF_UNUSED(mapping);
+	return false;
+#endif
+}
+
+static void s_os_unmap(CF_FileMapping* mapping)
+{
+#if defined(CF_WINDOWS)
+	UnmapViewOfFile(mapping->base);
+	CloseHandle(mapping->handle);
+#elif defined(CF_FILE_SYSTEM_MMAP)
+	munmap(mapping->base, mapping->length);
+#else
+	CF_UNUSED(mapping);
+#endif
+}
+
+static CF_INLINE uint16_t s_read_u16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+static CF_INLINE uint32_t s_read_u32(const uint8_t* p) { return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+// Finds an entry stored without compression in a mapped .zip archive. Anything unusual, such as
+// compressed, encrypted or ZIP64 entries, is left to PhysFS.
+static const uint8_t* s_find_stored_zip_entry(const CF_FileMapping* archive, const char* name, size_t size)
+{
+	const uint8_t* zip = (const uint8_t*)archive->base;
+	size_t length = archive->length;
+	if (length < 22) return NULL;
+
+	// The end of central directory record sits at the end of the file, before a comment of up to 64KB.
+	size_t eocd = length - 22;
+	size_t eocd_min = length - 22 > 0xFFFF ? length - 22 - 0xFFFF : 0;
+	while (s_read_u32(zip + eocd) != 0x06054B50) {
+		if (eocd == eocd_min) return NULL;
+		--eocd;
+	}
+	uint16_t entry_count = s_read_u16(zip + eocd + 10);
+	uint32_t cd_size = s_read_u32(zip + eocd + 12);
+	uint32_t cd_offset = s_read_u32(zip + eocd + 16);
+	if (entry_count == 0xFFFF || cd_offset == 0xFFFFFFFF || (size_t)cd_offset + cd_size > eocd) return NULL;
+
+	size_t name_len = CF_STRLEN(name);
+	const uint8_t* p = zip + cd_offset;
+	const uint8_t* cd_end = p + cd_size;
+	for (int i = 0; i < entry_count; ++i) {
+		if (cd_end - p < 46 || s_read_u32(p) != 0x02014B50) return NULL;
+		uint16_t flags = s_read_u16(p + 8);
+		uint16_t method = s_read_u16(p + 10);
+		uint32_t compressed_size = s_read_u32(p + 20);
+		uint32_t uncompressed_size = s_read_u32(p + 24);
+		uint16_t entry_name_len = s_read_u16(p + 28);
+		size_t entry_len = 46 + (size_t)entry_name_len + s_read_u16(p + 30) + s_read_u16(p + 32);
+		uint32_t local_offset = s_read_u32(p + 42);
+		if ((size_t)(cd_end - p) < entry_len) return NULL;
+		if (entry_name_len == name_len && !CF_MEMCMP(p + 46, name, name_len)) {
+			if (method != 0 || (flags & 1) || compressed_size != uncompressed_size || uncompressed_size != size) return NULL;
+			if ((size_t)local_offset + 30 > length) return NULL;
+			const uint8_t* local = zip + local_offset;
+			if (s_read_u32(local) != 0x04034B50) return NULL;
+			size_t data_offset = (size_t)local_offset + 30 + s_read_u16(local + 26) + s_read_u16(local + 28);
+			if (data_offset > length || length - data_offset < size) return NULL;
+			return zip + data_offset;
+		}
+		p += entry_len;
+	}
+	return NULL;
+}
+
+// Tries to map the file behind a virtual path directly. Returns NULL to fall back to reading it.
+static const void* s_map_native(const char* virtual_path, size_t size, CF_FileMapping* mapping)
+{
+	const char* real_dir = PHYSFS_getRealDir(virtual_path);
+	if (!real_dir) return NULL;
+
+	// Strip the mount point to get the path within the directory or archive.
+	const char* path = virtual_path;
+	while (*path == '/') ++path;
+	const char* mount_point = PHYSFS_getMountPoint(real_dir);
+	if (mount_point) {
+		while (*mount_point == '/') ++mount_point;
+		size_t mount_len = CF_STRLEN(mount_point);
+		if (CF_STRNCMP(path, mount_point, mount_len)) return NULL;
+		path += mount_len;
+	}
+
+	// A file within a mounted directory.
+	char* os_path = smake(real_dir);
+	if (slen(os_path) && slast(os_path) != '/' && slast(os_path) != '\\') sappend(os_path, "/");
+	sappend(os_path, path);
+	bool mapped = s_os_map(os_path, mapping);
+	sfree(os_path);
+	if (mapped) {
+		if (mapping->length == size) return mapping->base;
+		s_os_unmap(mapping);
+		return NULL;
+	}
+
+	// An entry within a mounted archive.
+	if (!s_os_map(real_dir, mapping)) return NULL;
+	const void* data = cf_pack_find_stored_entry(mapping->base, mapping->length, path, size);
+	if (!data) data = s_find_stored_zip_entry(mapping, path, size);
+	if (!data) s_os_unmap(mapping);
+	return data;
+}
+
+const void* cf_fs_map_file(const char* virtual_path, size_t* size)
+{
+	// PhysFS decides whether the path is allowed at all, such as rejecting symlinks, before looking on disk directly.
+	PHYSFS_Stat stat;
+	if (!PHYSFS_stat(virtual_path, &stat) || stat.filetype != PHYSFS_FILETYPE_REGULAR || stat.filesize < 0) return NULL;
+
+	CF_FileMapping mapping = { };
+	const void* data = s_map_native(virtual_path, (size_t)stat.filesize, &mapping);
+	size_t data_size = (size_t)stat.filesize;
+	if (!data) {
+		// Always at least a byte, so even an empty file has a unique pointer.
+		data = cf_fs_read_entire_file_to_memory_and_nul_terminate(virtual_path, &data_size);
+		if (!data) return NULL;
+		data_size -= 1;
+		mapping.base = (void*)data;
+		mapping.length = data_size;
+		mapping.mapped = false;
+	}
+	s_mappings.insert((uint64_t)data, mapping);
+	if (size) *size = data_size;
+	return data;
+}
+
+void cf_fs_unmap_file(const void* data)
+{
+	if (!data) return;
+	CF_FileMapping* mapping = s_mappings.try_get((uint64_t)data);
+	CF_ASSERT(mapping);
+	if (!mapping) return;
+	if (mapping->mapped) {
+		s_os_unmap(mapping);
+	} else {
+		CF_FREE(mapping->base);
+	}
+	s_mappings.remove((uint64_t)data);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Asynchronous reads and writes.
+
+// Writes share the queues of reads, in a slot of their own that's served before every read priority.
+#define CF_FILE_ASYNC_WRITE_QUEUE CF_FILE_PRIORITY_COUNT
+
+struct CF_FileRequestInternal
+{
+	uint64_t id;
+	char* path;
+	CF_FileReadFn* fn;
+	void* udata;
+	bool canceled;
+	CF_Result result;
+	void* data;
+	size_t size;
+	// Writes only.
+	bool is_write;
+	bool compress;
+	CF_FileWriteFn* write_fn;
+	CF_FileSerializeFn* serialize;
+	void* serialize_udata;
+};
+
+struct CF_FileAsync
+{
+	CF_Mutex lock;
+	CF_ConditionVariable cv;
+	CF_Thread* thread = NULL;
+	bool running = true;
+	uint64_t id_gen = 0;
+	// Waiting requests per priority plus writes, each read front to back starting at `pending_index`.
+	Array<CF_FileRequestInternal*> pending[CF_FILE_PRIORITY_COUNT + 1];
+	int pending_index[CF_FILE_PRIORITY_COUNT + 1] = { };
+	Array<CF_FileRequestInternal*> finished;
+	// Every request not yet cancelled or handed to its callback.
+	Map<uint64_t, CF_FileRequestInternal*> requests;
+};
+
+static CF_FileAsync* s_async;
+
+static void s_free_request(CF_FileRequestInternal* request)
+{
+	if (request->serialize) {
+		// Never serialized, so hand the snapshot back to be freed.
+		size_t size = 0;
+		request->serialize(request->serialize_udata, true, &size);
+	}
+	sfree(request->path);
+	CF_FREE(request->data);
+	CF_FREE(request);
+}
+
+// Call with the lock held.
+static CF_FileRequestInternal* s_pop_pending(CF_FileAsync* async)
+{
+	for (int i = CF_FILE_ASYNC_WRITE_QUEUE; i >= 0; --i) {
+		Array<CF_FileRequestInternal*>& pending = async->pending[i];
+		int& index = async->pending_index[i];
+		if (index == pending.count()) continue;
+		CF_FileRequestInternal* request = pending[index++];
+		if (index * 2 >= pending.count()) {
+			// Drop the read half of the queue so a steady trickle of requests doesn't grow it forever.
+			int remaining = pending.count() - index;
+			CF_MEMMOVE(pending.data(), pending.data() + index, sizeof(CF_FileRequestInternal*) * remaining);
+			pending.set_count(remaining);
+			index = 0;
+		}
+		return request;
+	}
+	return NULL;
+}
+
+static void s_read(CF_FileAsync* async, CF_FileRequestInternal* request)
+{
+	request->result = cf_result_success();
+	PHYSFS_File* file = PHYSFS_openRead(request->path);
+	if (!file) {
+		request->result = cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+		return;
+	}
+	PHYSFS_sint64 length = PHYSFS_fileLength(file);
+	if (length < 0) {
+		request->result = cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+		PHYSFS_close(file);
+		return;
+	}
+	size_t size = (size_t)length;
+	char* data = (char*)CF_ALLOC(size + 1);
+	size_t offset = 0;
+
+	// Read in chunks, so a cancelled read of a big file stops early.
+	while (offset < size) {
+		cf_mutex_lock(&async->lock);
+		bool canceled = request->canceled || !async->running;
+		cf_mutex_unlock(&async->lock);
+		if (canceled) break;
+		size_t chunk = size - offset < CF_FILE_SYSTEM_BUFFERED_IO_SIZE ? size - offset : CF_FILE_SYSTEM_BUFFERED_IO_SIZE;
+		PHYSFS_sint64 bytes_read = PHYSFS_readBytes(file, data + offset, (PHYSFS_uint64)chunk);
+		if (bytes_read != (PHYSFS_sint64)chunk) {
+			request->result = cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+			break;
+		}
+		offset += chunk;
+	}
+	PHYSFS_close(file);
+
+	if (offset < size) {
+		CF_FREE(data);
+		if (!cf_is_error(request->result)) request->result = cf_result_error("The read was cancelled.");
+		return;
+	}
+	data[size] = 0;
+	request->data = data;
+	request->size = size;
+}
+
+// Compressed files are a small header followed by a single LZ4 block.
+#define CF_FILE_COMPRESSED_MAGIC "CFLZ"
+#define CF_FILE_COMPRESSED_HEADER_SIZE 16
+
+static void* s_compress(const void* data, size_t size, size_t* compressed_size)
+{
+	uint8_t* compressed = (uint8_t*)CF_ALLOC(CF_FILE_COMPRESSED_HEADER_SIZE + cf_lz4_bound(size));
+	CF_MEMCPY(compressed, CF_FILE_COMPRESSED_MAGIC, 4);
+	uint32_t version = 1;
+	uint64_t size64 = (uint64_t)size;
+	CF_MEMCPY(compressed + 4, &version, sizeof(version));
+	CF_MEMCPY(compressed + 8, &size64, sizeof(size64));
+	*compressed_size = CF_FILE_COMPRESSED_HEADER_SIZE + cf_lz4_compress((const uint8_t*)data, size, compressed + CF_FILE_COMPRESSED_HEADER_SIZE);
+	return compressed;
+}
+
+bool cf_fs_is_compressed(const void* data, size_t size)
+{
+	return data && size >= CF_FILE_COMPRESSED_HEADER_SIZE && !CF_MEMCMP(data, CF_FILE_COMPRESSED_MAGIC, 4);
+}
+
+void* cf_fs_decompress(const void* data, size_t size, size_t* decompressed_size)
+{
+	if (!cf_fs_is_compressed(data, size)) return NULL;
+	const uint8_t* bytes = (const uint8_t*)data;
+	uint32_t version;
+	uint64_t size64;
+	CF_MEMCPY(&version, bytes + 4, sizeof(version));
+	CF_MEMCPY(&size64, bytes + 8, sizeof(size64));
+	// Every LZ4 byte expands to at most 255 or so, which rejects absurd sizes from corrupt headers before allocating.
+	size_t stored_size = size - CF_FILE_COMPRESSED_HEADER_SIZE;
+	if (version != 1 || size64 > (uint64_t)stored_size * 256 + 16) return NULL;
+	uint8_t* result = (uint8_t*)CF_ALLOC((size_t)size64 + 1);
+	if (!cf_lz4_decompress(bytes + CF_FILE_COMPRESSED_HEADER_SIZE, stored_size, result, (size_t)size64)) {
+		CF_FREE(result);
+		return NULL;
+	}
+	result[size64] = 0;
+	if (decompressed_size) *decompressed_size = (size_t)size64;
+	return result;
+}
+
+// Returns the path of a file within the write directory on disk.
+static char* s_os_write_path(const char* virtual_path)
+{
+	char* os_path = smake(PHYSFS_getWriteDir());
+	if (slen(os_path) && slast(os_path) != '/' && slast(os_path) != '\\') sappend(os_path, "/");
+	while (*virtual_path == '/') ++virtual_path;
+	sappend(os_path, virtual_path);
+	return os_path;
+}
+
+// Replaces `to` with `from` in one step, as far as the OS allows.
+static bool s_replace_file(const char* from_virtual_path, const char* to_virtual_path)
+{
+	char* from = s_os_write_path(from_virtual_path);
+	char* to = s_os_write_path(to_virtual_path);
+#if defined(CF_WINDOWS)
+	int from_count = MultiByteToWideChar(CP_UTF8, 0, from, -1, NULL, 0);
+	int to_count = MultiByteToWideChar(CP_UTF8, 0, to, -1, NULL, 0);
+	wchar_t* wide_from = (wchar_t*)CF_ALLOC(sizeof(wchar_t) * from_count);
+	wchar_t* wide_to = (wchar_t*)CF_ALLOC(sizeof(wchar_t) * to_count);
+	MultiByteToWideChar(CP_UTF8, 0, from, -1, wide_from, from_count);
+	MultiByteToWideChar(CP_UTF8, 0, to, -1, wide_to, to_count);
+	bool ok = MoveFileExW(wide_from, wide_to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+	CF_FREE(wide_from);
+	CF_FREE(wide_to);
+#else
+	bool ok = rename(from, to) == 0;
+#endif
+	sfree(from);
+	sfree(to);
+	return ok;
+}
+
+static void s_write(CF_FileAsync* async, CF_FileRequestInternal* request)
+{
+	request->result = cf_result_success();
+	if (request->serialize) {
+		CF_FileSerializeFn* serialize = request->serialize;
+		request->serialize = NULL;
+		request->data = serialize(request->serialize_udata, false, &request->size);
+		if (!request->data) {
+			request->result = cf_result_error("Unable to serialize the file.");
+			return;
+		}
+	}
+	if (request->compress) {
+		size_t compressed_size;
+		void* compressed = s_compress(request->data, request->size, &compressed_size);
+		CF_FREE(request->data);
+		request->data = compressed;
+		request->size = compressed_size;
+	}
+
+	// Written to a temporary file, then renamed over the real one, so a crash mid-write never leaves half a file behind.
+	char* temp_path = smake(request->path);
+	sappend(temp_path, ".tmp");
+	PHYSFS_File* file = PHYSFS_openWrite(temp_path);
+	if (!file) {
+		request->result = cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+		sfree(temp_path);
+		return;
+	}
+	PHYSFS_sint64 written = PHYSFS_writeBytes(file, request->data, (PHYSFS_uint64)request->size);
+	bool ok = written == (PHYSFS_sint64)request->size && PHYSFS_flush(file);
+	ok = PHYSFS_close(file) && ok;
+	if (!ok) request->result = cf_result_error(PHYSFS_getErrorByCode(PHYSFS_getLastErrorCode()));
+
+	cf_mutex_lock(&async->lock);
+	bool canceled = request->canceled;
+	cf_mutex_unlock(&async->lock);
+	if (ok && !canceled && !s_replace_file(temp_path, request->path)) {
+		request->result = cf_result_error("Unable to replace the file with the newly written one.");
+		ok = false;
+	}
+	if (!ok || canceled) PHYSFS_delete(temp_path);
+	sfree(temp_path);
+	CF_FREE(request->data);
+	request->data = NULL;
+	request->size = 0;
+}
+
+static int s_io_thread(void* udata)
+{
+	CF_FileAsync* async = (CF_FileAsync*)udata;
+	cf_mutex_lock(&async->lock);
+	while (true) {
+		CF_FileRequestInternal* request = s_pop_pending(async);
+		if (!request) {
+			// Pending writes are finished before shutting down, so a save right before quitting still lands on disk.
+			if (!async->running) break;
+			cf_cv_wait(&async->cv, &async->lock);
+			continue;
+		}
+		if (request->canceled || (!async->running && !request->is_write)) {
+			s_free_request(request);
+			continue;
+		}
+
+		cf_mutex_unlock(&async->lock);
+		if (request->is_write) {
+			s_write(async, request);
+		} else {
+			s_read(async, request);
+		}
+		cf_mutex_lock(&async->lock);
+
+		if (request->canceled || !async->running) {
+			s_free_request(request);
+		} else {
+			async->finished.add(request);
+		}
+	}
+	cf_mutex_unlock(&async->lock);
+	return 0;
+}
+
+static CF_FileAsync* s_get_async()
+{
+	if (!s_async) {
+		s_async = CF_NEW(CF_FileAsync);
+		s_async->lock = cf_make_mutex();
+		s_async->cv = cf_make_cv();
+		s_async->thread = cf_thread_create(s_io_thread, "CF file I/O", s_async);
+	}
+	return s_async;
+}
+
+CF_FileRequest cf_fs_read_async(const char* virtual_path, CF_FilePriority priority, CF_FileReadFn* fn, void* udata)
+{
+	CF_ASSERT(fn);
+	CF_ASSERT(priority >= 0 && priority < CF_FILE_PRIORITY_COUNT);
+	CF_FileAsync* async = s_get_async();
+	CF_FileRequestInternal* request = (CF_FileRequestInternal*)CF_ALLOC(sizeof(CF_FileRequestInternal));
+	CF_MEMSET(request, 0, sizeof(*request));
+	request->path = smake(virtual_path);
+	request->fn = fn;
+	request->udata = udata;
+
+	cf_mutex_lock(&async->lock);
+	request->id = ++async->id_gen;
+	async->pending[priority].add(request);
+	async->requests.insert(request->id, request);
+	cf_mutex_unlock(&async->lock);
+	cf_cv_wake_one(&async->cv);
+
+	CF_FileRequest result;
+	result.id = request->id;
+	return result;
+}
+
+static CF_FileRequest s_write_async(CF_FileRequestInternal* request)
+{
+	CF_FileAsync* async = s_get_async();
+	request->is_write = true;
+	cf_mutex_lock(&async->lock);
+	request->id = ++async->id_gen;
+	async->pending[CF_FILE_ASYNC_WRITE_QUEUE].add(request);
+	async->requests.insert(request->id, request);
+	cf_mutex_unlock(&async->lock);
+	cf_cv_wake_one(&async->cv);
+
+	CF_FileRequest result;
+	result.id = request->id;
+	return result;
+}
+
+CF_FileRequest cf_fs_write_async(const char* virtual_path, const void* data, size_t size, bool compress, CF_FileWriteFn* fn, void* udata)
+{
+	CF_FileRequestInternal* request = (CF_FileRequestInternal*)CF_ALLOC(sizeof(CF_FileRequestInternal));
+	CF_MEMSET(request, 0, sizeof(*request));
+	request->path = smake(virtual_path);
+	request->data = CF_ALLOC(size ? size : 1);
+	CF_MEMCPY(request->data, data, size);
+	request->size = size;
+	request->compress = compress;
+	request->write_fn = fn;
+	request->udata = udata;
+	return s_write_async(request);
+}
+
+CF_FileRequest cf_fs_write_async_serialized(const char* virtual_path, CF_FileSerializeFn* serialize, void* serialize_udata, bool compress, CF_FileWriteFn* fn, void* udata)
+{
+	CF_ASSERT(serialize);
+	CF_FileRequestInternal* request = (CF_FileRequestInternal*)CF_ALLOC(sizeof(CF_FileRequestInternal));
+	CF_MEMSET(request, 0, sizeof(*request));
+	request->path = smake(virtual_path);
+	request->serialize = serialize;
+	request->serialize_udata = serialize_udata;
+	request->compress = compress;
+	request->write_fn = fn;
+	request->udata = udata;
+	return s_write_async(request);
+}
+
+bool cf_fs_cancel_async(CF_FileRequest request_handle)
+{
+	CF_FileAsync* async = s_async;
+	if (!async || !request_handle.id) return false;
+	cf_mutex_lock(&async->lock);
+	CF_FileRequestInternal** request = async->requests.try_get(request_handle.id);
+	bool found = request != NULL;
+	if (found) {
+		// Whichever of the I/O thread or `cf_fs_poll_async` holds the request next frees it.
+		(*request)->canceled = true;
+		async->requests.remove(request_handle.id);
+	}
+	cf_mutex_unlock(&async->lock);
+	return found;
+}
+
+int cf_fs_poll_async(int max_count)
+{
+	CF_FileAsync* async = s_async;
+	if (!async) return 0;
+
+	Array<CF_FileRequestInternal*> finished;
+	cf_mutex_lock(&async->lock);
+	int count = async->finished.count();
+	if (max_count > 0 && count > max_count) count = max_count;
+	for (int i = 0; i < count; ++i) {
+		finished.add(async->finished[i]);
+	}
+	int remaining = async->finished.count() - count;
+	CF_MEMMOVE(async->finished.data(), async->finished.data() + count, sizeof(CF_FileRequestInternal*) * remaining);
+	async->finished.set_count(remaining);
+	cf_mutex_unlock(&async->lock);
+
+	int callback_count = 0;
+	for (int i = 0; i < finished.count(); ++i) {
+		// Checked one at a time, since an earlier callback may cancel a later request.
+		CF_FileRequestInternal* request = finished[i];
+		cf_mutex_lock(&async->lock);
+		bool canceled = request->canceled;
+		if (!canceled) async->requests.remove(request->id);
+		cf_mutex_unlock(&async->lock);
+		if (!canceled) {
+			CF_FileRequest handle;
+			handle.id = request->id;
+			if (request->is_write) {
+				if (request->write_fn) request->write_fn(handle, request->path, request->result, request->udata);
+			} else {
+				request->fn(handle, request->path, request->result, request->data, request->size, request->udata);
+				request->data = NULL;
+			}
+			callback_count++;
+		}
+		s_free_request(request);
+	}
+	return callback_count;
+}
+
+int cf_fs_async_pending_count()
+{
+	CF_FileAsync* async = s_async;
+	if (!async) return 0;
+	cf_mutex_lock(&async->lock);
+	int count = async->requests.count();
+	cf_mutex_unlock(&async->lock);
+	return count;
+}
+
+static void s_destroy_async()
+{
+	CF_FileAsync* async = s_async;
+	if (!async) return;
+	cf_mutex_lock(&async->lock);
+	async->running = false;
+	cf_mutex_unlock(&async->lock);
+	cf_cv_wake_all(&async->cv);
+	cf_thread_wait(async->thread);
+
+	for (int i = 0; i <= CF_FILE_ASYNC_WRITE_QUEUE; ++i) {
+		for (int j = async->pending_index[i]; j < async->pending[i].count(); ++j) {
+			s_free_request(async->pending[i][j]);
+		}
+	}
+	for (int i = 0; i < async->finished.count(); ++i) {
+		s_free_request(async->finished[i]);
+	}
+	cf_destroy_mutex(&async->lock);
+	cf_destroy_cv(&async->cv);
+	async->~CF_FileAsync();
+	CF_FREE(async);
+	s_async = NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Watching mounted directories for changed files.
+
+struct CF_WatchedDir
+{
+	char* archive;      // As passed to `cf_fs_mount`.
+	char* mount_point;  // The virtual path to prepend, "/" or such as "/content/".
+#if defined(CF_WINDOWS)
+	HANDLE handle;
+	OVERLAPPED overlapped;
+	DWORD buffer[16 * 1024 / sizeof(DWORD)];
+#elif defined(CF_FILE_SYSTEM_FSEVENTS)
+	char* real_path;
+	FSEventStreamRef stream;
+#endif
+};
+
+#ifdef CF_FILE_SYSTEM_INOTIFY
+// inotify doesn't watch subdirectories, so each gets its own watch.
+struct CF_WatchedSubdir
+{
+	CF_WatchedDir* dir;
+	char* rel;          // Path of the subdirectory within `dir`, empty or ending in '/'.
+};
+#endif
+
+struct CF_FileWatch
+{
+	CF_Mutex lock;
+	CF_FileChangedFn* fn = NULL;
+	void* udata = NULL;
+	Array<CF_WatchedDir*> dirs;
+	// Virtual paths reported by the OS and not yet debounced. Filled by the FSEvents thread on macOS, so guarded by `lock`.
+	Array<char*> changed;
+	// Interned virtual path to the time of its latest change.
+	Map<const char*, double> pending;
+#if defined(CF_FILE_SYSTEM_INOTIFY)
+	int fd = -1;
+	Map<int, CF_WatchedSubdir> subdirs;
+#elif defined(CF_FILE_SYSTEM_FSEVENTS)
+	dispatch_queue_t queue;
+#endif
+};
+
+static CF_FileWatch* s_watch;
+static float s_watch_debounce = 0.1f;
+
+static char* s_changed_path(CF_WatchedDir* dir, const char* rel, int rel_len)
+{
+	char* path = NULL;
+	sset(path, dir->mount_point);
+	sappend_range(path, rel, rel + rel_len);
+	return path;
+}
+
+#if defined(CF_FILE_SYSTEM_INOTIFY)
+
+#define CF_INOTIFY_MASK (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE)
+
+static void s_inotify_add_tree(CF_FileWatch* watch, CF_WatchedDir* dir, const char* rel)
+{
+	char* os_path = NULL;
+	sset(os_path, dir->archive);
+	sappend(os_path, "/");
+	sappend(os_path, rel);
+	int wd = inotify_add_watch(watch->fd, os_path, CF_INOTIFY_MASK);
+	if (wd < 0) {
+		sfree(os_path);
+		return;
+	}
+	CF_WatchedSubdir* subdir = watch->subdirs.try_find(wd);
+	if (subdir) {
+		// The same directory was reached twice, such as through a symlink.
+		sset(subdir->rel, rel);
+		subdir->dir = dir;
+	} else {
+		CF_WatchedSubdir entry;
+		entry.dir = dir;
+		entry.rel = smake(rel);
+		watch->subdirs.insert(wd, entry);
+	}
+
+	DIR* d = opendir(os_path);
+	if (d) {
+		struct dirent* e;
+		while ((e = readdir(d))) {
+			if (!CF_STRCMP(e->d_name, ".") || !CF_STRCMP(e->d_name, "..")) continue;
+			char* child = NULL;
+			sset(child, os_path);
+			sappend(child, e->d_name);
+			struct stat st;
+			bool is_dir = !lstat(child, &st) && S_ISDIR(st.st_mode);
+			sfree(child);
+			if (!is_dir) continue;
+			char* child_rel = NULL;
+			sset(child_rel, rel);
+			sappend(child_rel, e->d_name);
+			sappend(child_rel, "/");
+			s_inotify_add_tree(watch, dir, child_rel);
+			sfree(child_rel);
+		}
+		closedir(d);
+	}
+	sfree(os_path);
+}
+
+static bool s_os_watch(CF_FileWatch* watch, CF_WatchedDir* dir)
+{
+	int count = watch->subdirs.count();
+	s_inotify_add_tree(watch, dir, "");
+	return watch->subdirs.count() > count;
+}
+
+static void s_os_unwatch(CF_FileWatch* watch, CF_WatchedDir* dir)
+{
+	Array<int> wds;
+	for (int i = 0; i < watch->subdirs.count(); ++i) {
+		if (watch->subdirs.items()[i].dir == dir) wds.add(watch->subdirs.keys()[i]);
+	}
+	for (int i = 0; i < wds.count(); ++i) {
+		inotify_rm_watch(watch->fd, wds[i]);
+		sfree(watch->subdirs.get(wds[i]).rel);
+		watch->subdirs.remove(wds[i]);
+	}
+}
+
+static void s_os_poll(CF_FileWatch* watch)
+{
+	alignas(struct inotify_event) char buffer[16 * 1024];
+	while (1) {
+		ssize_t bytes = read(watch->fd, buffer, sizeof(buffer));
+		if (bytes <= 0) break;
+		for (char* p = buffer; p < buffer + bytes; ) {
+			struct inotify_event* e = (struct inotify_event*)p;
+			p += sizeof(struct inotify_event) + e->len;
+			CF_WatchedSubdir* subdir = watch->subdirs.try_find(e->wd);
+			if (!subdir) continue;
+			if (e->mask & IN_IGNORED) {
+				// The directory itself is gone.
+				sfree(subdir->rel);
+				watch->subdirs.remove(e->wd);
+				continue;
+			}
+			if (!e->len) continue;
+			char* rel = NULL;
+			sset(rel, subdir->rel);
+			sappend(rel, e->name);
+			if (e->mask & IN_ISDIR) {
+				if (e->mask & (IN_CREATE | IN_MOVED_TO)) {
+					sappend(rel, "/");
+					s_inotify_add_tree(watch, subdir->dir, rel);
+				}
+			} else if (!(e->mask & IN_CREATE)) {
+				// Skip creation, as the file is empty until written and closed.
+				watch->changed.add(s_changed_path(subdir->dir, rel, slen(rel)));
+			}
+			sfree(rel);
+		}
+	}
+}
+
+static bool s_os_init(CF_FileWatch* watch)
+{
+	watch->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	return watch->fd >= 0;
+}
+
+static void s_os_destroy(CF_FileWatch* watch)
+{
+	for (int i = 0; i < watch->subdirs.count(); ++i) {
+		sfree(watch->subdirs.items()[i].rel);
+	}
+	close(watch->fd);
+}
+
+static bool s_is_directory(const char* os_path)
+{
+	struct stat st;
+	return !stat(os_path, &st) && S_ISDIR(st.st_mode);
+}
+
+#elif defined(CF_WINDOWS)
+
+static bool s_arm(CF_WatchedDir* dir)
+{
+	DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+	return ReadDirectoryChangesW(dir->handle, dir->buffer, sizeof(dir->buffer), TRUE, filter, NULL, &dir->overlapped, NULL);
+}
+
+static WCHAR* s_widen(const char* utf8)
+{
+	int count = MultiByteToWideChar(CP_UTF8, 0, utf8, -1, NULL, 0);
+	WCHAR* wide = (WCHAR*)CF_ALLOC(sizeof(WCHAR) * count);
+	MultiByteToWideChar(CP_UTF8, 0, utf8, -1, wide, count);
+	return wide;
+}
+
+static bool s_os_watch(CF_FileWatch* watch, CF_WatchedDir* dir)
+{
+	WCHAR* os_path = s_widen(dir->archive);
+	dir->handle = CreateFileW(os_path, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+	CF_FREE(os_path);
+	if (dir->handle == INVALID_HANDLE_VALUE) return false;
+	CF_MEMSET(&dir->overlapped, 0, sizeof(dir->overlapped));
+	dir->overlapped.hEvent = CreateEventW(NULL, TRUE, FALSE, NULL);
+	if (!s_arm(dir)) {
+		CloseHandle(dir->overlapped.hEvent);
+		CloseHandle(dir->handle);
+		return false;
+	}
+	return true;
+}
+
+static void s_os_unwatch(CF_FileWatch* watch, CF_WatchedDir* dir)
+{
+	CancelIoEx(dir->handle, &dir->overlapped);
+	DWORD bytes;
+	GetOverlappedResult(dir->handle, &dir->overlapped, &bytes, TRUE);
+	CloseHandle(dir->overlapped.hEvent);
+	CloseHandle(dir->handle);
+}
+
+static void s_os_poll(CF_FileWatch* watch)
+{
+	for (int i = 0; i < watch->dirs.count(); ++i) {
+		CF_WatchedDir* dir = watch->dirs[i];
+		DWORD bytes = 0;
+		if (!GetOverlappedResult(dir->handle, &dir->overlapped, &bytes, FALSE)) {
+			if (GetLastError() != ERROR_IO_INCOMPLETE) s_arm(dir);
+			continue;
+		}
+
+		// Zero bytes means the buffer overflowed and changes were lost.
+		uint8_t* p = (uint8_t*)dir->buffer;
+		while (bytes) {
+			FILE_NOTIFY_INFORMATION* info = (FILE_NOTIFY_INFORMATION*)p;
+			int wide_len = (int)(info->FileNameLength / sizeof(WCHAR));
+			char name[1024];
+			int len = WideCharToMultiByte(CP_UTF8, 0, info->FileName, wide_len, name, sizeof(name) - 1, NULL, NULL);
+			if (len > 0) {
+				for (int j = 0; j < len; ++j) if (name[j] == '\\') name[j] = '/';
+				watch->changed.add(s_changed_path(dir, name, len));
+			}
+			if (!info->NextEntryOffset) break;
+			p += info->NextEntryOffset;
+		}
+		ResetEvent(dir->overlapped.hEvent);
+		s_arm(dir);
+	}
+}
+
+static bool s_os_init(CF_FileWatch* watch) { return true; }
+static void s_os_destroy(CF_FileWatch* watch) { }
+
+static bool s_is_directory(const char* os_path)
+{
+	WCHAR* wide = s_widen(os_path);
+	DWORD attributes = GetFileAttributesW(wide);
+	CF_FREE(wide);
+	return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+}
+
+#elif defined(CF_FILE_SYSTEM_FSEVENTS)
+
+// Runs on `watch->queue`.
+static void s_fsevents_callback(ConstFSEventStreamRef stream, void* udata, size_t count, void* event_paths, const FSEventStreamEventFlags* flags, const FSEventStreamEventId* ids)
+{
+	CF_WatchedDir* dir = (CF_WatchedDir*)udata;
+	const char** paths = (const char**)event_paths;
+	int prefix_len = slen(dir->real_path);
+	cf_mutex_lock(&s_watch->lock);
+	for (size_t i = 0; i < count; ++i) {
+		if (flags[i] & kFSEventStreamEventFlagItemIsDir) continue;
+		const char* path = paths[i];
+		if (CF_STRNCMP(path, dir->real_path, prefix_len) || path[prefix_len] != '/') continue;
+		const char* rel = path + prefix_len + 1;
+		s_watch->changed.add(s_changed_path(dir, rel, (int)CF_STRLEN(rel)));
+	}
+	cf_mutex_unlock(&s_watch->lock);
+}
+
+static void s_noop(void* udata) { }
+
+static bool s_os_watch(CF_FileWatch* watch, CF_WatchedDir* dir)
+{
+	// Events come with symlinks resolved.
+	char* real_path = realpath(dir->archive, NULL);
+	if (!real_path) return false;
+	dir->real_path = smake(real_path);
+	free(real_path);
+
+	FSEventStreamContext context = { 0, dir, NULL, NULL, NULL };
+	CFStringRef path = CFStringCreateWithCString(NULL, dir->real_path, kCFStringEncodingUTF8);
+	CFArrayRef paths = CFArrayCreate(NULL, (const void**)&path, 1, &kCFTypeArrayCallBacks);
+	dir->stream = FSEventStreamCreate(NULL, s_fsevents_callback, &context, paths, kFSEventStreamEventIdSinceNow, 0.05, kFSEventStreamCreateFlagFileEvents | kFSEventStreamCreateFlagNoDefer);
+	CFRelease(paths);
+	CFRelease(path);
+	if (!dir->stream) {
+		sfree(dir->real_path);
+		return false;
+	}
+	FSEventStreamSetDispatchQueue(dir->stream, watch->queue);
+	FSEventStreamStart(dir->stream);
+	return true;
+}
+
+static void s_os_unwatch(CF_FileWatch* watch, CF_WatchedDir* dir)
+{
+	FSEventStreamStop(dir->stream);
+	FSEventStreamInvalidate(dir->stream);
+	FSEventStreamRelease(dir->stream);
+	// Wait out a callback already running for this directory.
+	dispatch_sync_f(watch->queue, NULL, s_noop);
+	sfree(dir->real_path);
+}
+
+static void s_os_poll(CF_FileWatch* watch) { }
+
+static bool s_os_init(CF_FileWatch* watch)
+{
+	watch->queue = dispatch_queue_create("CF file watch", DISPATCH_QUEUE_SERIAL);
+	return watch->queue != NULL;
+}
+
+static void s_os_destroy(CF_FileWatch* watch)
+{
+	dispatch_release(watch->queue);
+}
+
+static bool s_is_directory(const char* os_path)
+{
+	struct stat st;
+	return !stat(os_path, &st) && S_ISDIR(st.st_mode);
+}
+
+#endif
+
+#if defined(CF_FILE_SYSTEM_INOTIFY) || defined(CF_WINDOWS) || defined(CF_FILE_SYSTEM_FSEVENTS)
+#	define CF_FILE_SYSTEM_WATCH
+#endif
+
+#ifdef CF_FILE_SYSTEM_WATCH
+
+static void s_watch_add(CF_FileWatch* watch, const char* archive)
+{
+	// Archives can't change under PhysFS, so only directories are watched.
+	if (!s_is_directory(archive)) return;
+	for (int i = 0; i < watch->dirs.count(); ++i) {
+		if (!CF_STRCMP(watch->dirs[i]->archive, archive)) return;
+	}
+	const char* mount_point = PHYSFS_getMountPoint(archive);
+	if (!mount_point) return;
+
+	CF_WatchedDir* dir = (CF_WatchedDir*)CF_ALLOC(sizeof(CF_WatchedDir));
+	CF_MEMSET(dir, 0, sizeof(*dir));
+	dir->archive = smake(archive);
+	sset(dir->mount_point, "/");
+	if (CF_STRCMP(mount_point, "/")) {
+		sappend(dir->mount_point, mount_point[0] == '/' ? mount_point + 1 : mount_point);
+		if (slast(dir->mount_point) != '/') sappend(dir->mount_point, "/");
+	}
+	if (!s_os_watch(watch, dir)) {
+		sfree(dir->archive);
+		sfree(dir->mount_point);
+		CF_FREE(dir);
+		return;
+	}
+	watch->dirs.add(dir);
+}
+
+static void s_watch_remove(CF_FileWatch* watch, int index)
+{
+	CF_WatchedDir* dir = watch->dirs[index];
+	s_os_unwatch(watch, dir);
+	sfree(dir->archive);
+	sfree(dir->mount_point);
+	CF_FREE(dir);
+	watch->dirs.unordered_remove(index);
+}
+
+#endif // CF_FILE_SYSTEM_WATCH
+
+static void s_watch_on_mount(const char* archive)
+{
+#ifdef CF_FILE_SYSTEM_WATCH
+	if (s_watch) s_watch_add(s_watch, archive);
+#endif
+}
+
+static void s_watch_on_dismount(const char* archive)
+{
+#ifdef CF_FILE_SYSTEM_WATCH
+	CF_FileWatch* watch = s_watch;
+	if (!watch) return;
+	for (int i = 0; i < watch->dirs.count(); ++i) {
+		if (!CF_STRCMP(watch->dirs[i]->archive, archive)) {
+			s_watch_remove(watch, i);
+			return;
+		}
+	}
+#endif
+}
+
+CF_Result cf_fs_watch_mounts(CF_FileChangedFn* fn, void* udata)
+{
+#ifdef CF_FILE_SYSTEM_WATCH
+	if (s_watch) {
+		s_watch->fn = fn;
+		s_watch->udata = udata;
+		return cf_result_success();
+	}
+	CF_FileWatch* watch = CF_NEW(CF_FileWatch);
+	if (!s_os_init(watch)) {
+		watch->~CF_FileWatch();
+		CF_FREE(watch);
+		return cf_result_error("Unable to start the OS's file watcher.");
+	}
+	watch->lock = cf_make_mutex();
+	watch->fn = fn;
+	watch->udata = udata;
+	s_watch = watch;
+
+	char** search_path = PHYSFS_getSearchPath();
+	for (char** archive = search_path; archive && *archive; ++archive) {
+		s_watch_add(watch, *archive);
+	}
+	PHYSFS_freeList(search_path);
+	return cf_result_success();
+#else
+	CF_UNUSED(fn);
+	CF_UNUSED(udata);
+	return cf_result_error("Watching files isn't supported on this platform.");
+#endif
+}
+
+void cf_fs_unwatch_mounts()
+{
+#ifdef CF_FILE_SYSTEM_WATCH
+	CF_FileWatch* watch = s_watch;
+	if (!watch) return;
+	while (watch->dirs.count()) {
+		s_watch_remove(watch, watch->dirs.count() - 1);
+	}
+	s_os_destroy(watch);
+	for (int i = 0; i < watch->changed.count(); ++i) {
+		sfree(watch->changed[i]);
+	}
+	cf_destroy_mutex(&watch->lock);
+	watch->~CF_FileWatch();
+	CF_FREE(watch);
+	s_watch = NULL;
+#endif
+}
+
+void cf_fs_set_watch_debounce(float seconds)
+{
+	s_watch_debounce = seconds;
+}
+
+int cf_fs_poll_changes()
+{
+#ifdef CF_FILE_SYSTEM_WATCH
+	CF_FileWatch* watch = s_watch;
+	if (!watch) return 0;
+	double now = (double)cf_get_ticks() / (double)cf_get_tick_frequency();
+
+	// Each new change to a file restarts its delay.
+	cf_mutex_lock(&watch->lock);
+	s_os_poll(watch);
+	for (int i = 0; i < watch->changed.count(); ++i) {
+		const char* path = sintern(watch->changed[i]);
+		sfree(watch->changed[i]);
+		double* time = watch->pending.try_find(path);
+		if (time) *time = now;
+		else watch->pending.insert(path, now);
+	}
+	if (watch->changed.count()) s_index_invalidate();
+	watch->changed.clear();
+	cf_mutex_unlock(&watch->lock);
+
+	Array<const char*> settled;
+	for (int i = 0; i < watch->pending.count(); ++i) {
+		if (now - watch->pending.items()[i] >= s_watch_debounce) settled.add(watch->pending.keys()[i]);
+	}
+	int count = 0;
+	for (int i = 0; i < settled.count(); ++i) {
+		const char* path = settled[i];
+		watch->pending.remove(path);
+		CF_Stat stat;
+		if (!cf_is_error(cf_fs_stat(path, &stat)) && stat.type == CF_FILE_TYPE_DIRECTORY) continue;
+		cf_png_cache_file_changed(path);
+		cf_aseprite_cache_file_changed(path);
+		if (watch->fn) watch->fn(path, watch->udata);
+		++count;
+		// The callback may have stopped watching.
+		if (!s_watch) break;
+	}
+	return count;
+#else
+	return 0;
+#endif
+}
+
 void cf_fs_destroy()
 {
+	cf_fs_unwatch_mounts();
+	s_destroy_async();
+	cf_fs_set_index_enabled(false);
 	PHYSFS_deinit();
 }
@@ -8,9 +8,12 @@
 #include <cute_defines.h>
 #include <cute_c_runtime.h>
 #include <cute_graphics.h>
+#include <cute_file_system.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
+#include <internal/cute_dx11.h>
+#include <internal/cute_metal.h>
 
 #include <shaders/blit_shader.h>
 
@@ -44,6 +47,10 @@ static CF_CanvasInternal* s_default_canvas = NULL;
 
 #include <float.h>
 
+#ifdef SOKOL_GLCORE33
+#include <SDL.h>
+#endif
+
 #define CF_VERTEX_BUFFER_SLOT (0)
 #define CF_INSTANCE_BUFFER_SLOT (1)
 
@@ -65,9 +72,21 @@ struct CF_Buffer
 	int size;
 	int offset;
 	int stride;
+	int high_water;
+	int grow_count;
 	sg_buffer handle;
 };
 
+// Buffers replaced while growing are kept alive until the GPU can no longer be reading from them.
+struct CF_RetiredBuffer
+{
+	sg_buffer handle;
+	uint64_t frame;
+};
+
+static Array<CF_RetiredBuffer> s_retired_buffers;
+static uint64_t s_frame = 0;
+
 struct CF_MeshInternal
 {
 	sg_usage usage;
@@ -81,6 +100,25 @@ struct CF_MeshInternal
 	CF_VertexAttribute attributes[SG_MAX_VERTEX_ATTRIBUTES];
 };
 
+struct CF_PipelineCacheEntry
+{
+	sg_pipeline_desc desc;
+	sg_pipeline pip;
+	uint64_t last_used_frame;
+};
+
+struct CF_PipelineCache
+{
+	Map<uint64_t, CF_PipelineCacheEntry> entries;
+	int capacity = 32;
+	uint64_t frame = 0;
+	CF_PipelineCacheStats stats = { };
+};
+
+static CF_PipelineCache* s_pipeline_cache = NULL;
+static CF_RenderStats s_render_stats = { };
+static CF_RenderStats s_last_render_stats = { };
+
 struct CF_CanvasInternal
 {
 	sg_pass_action action;
@@ -89,9 +127,16 @@ struct CF_CanvasInternal
 	CF_Texture cf_depth_stencil;
 	sg_image texture;
 	sg_image depth_stencil;
+	sg_pixel_format color_format;
 	sg_pass pass;
 	sg_pipeline pip;
 	CF_MeshInternal* mesh;
+	bool has_viewport;
+	bool has_scissor;
+	int viewport[4];
+	int scissor[4];
+	// Version of each uniform block last sent to the GPU in this pass, see `CF_MaterialState`.
+	uint64_t ub_versions[SG_NUM_SHADER_STAGES][SG_MAX_SHADERSTAGE_UBS];
 };
 
 static CF_INLINE sg_usage s_wrap(CF_UsageType type)
@@ -116,12 +161,20 @@ static CF_INLINE sg_pixel_format s_wrap(CF_PixelFormat fmt)
 static CF_INLINE sg_filter s_wrap(CF_Filter filter)
 {
 	switch (filter) {
-	case CF_FILTER_NEAREST: return SG_FILTER_NEAREST;
-	case CF_FILTER_LINEAR:  return SG_FILTER_LINEAR;
-	default:                return SG_FILTER_NEAREST;
+	case CF_FILTER_NEAREST:   return SG_FILTER_NEAREST;
+	case CF_FILTER_LINEAR:    return SG_FILTER_LINEAR;
+	case CF_FILTER_TRILINEAR: return SG_FILTER_LINEAR;
+	default:                  return SG_FILTER_NEAREST;
 	}
 }
 
+static CF_INLINE sg_filter s_wrap_min_filter(CF_Filter filter, int mip_count)
+{
+	// Mipmapped min filters on a texture without mips leave it incomplete on GL, so only use them with a chain.
+	if (filter == CF_FILTER_TRILINEAR && mip_count > 1) return SG_FILTER_LINEAR_MIPMAP_LINEAR;
+	return s_wrap(filter);
+}
+
 static CF_INLINE CF_PixelFormat s_wrap(sg_pixel_format fmt)
 {
 	CF_STATIC_ASSERT(CF_PIXELFORMAT_COUNT == _SG_PIXELFORMAT_NUM - 1, "Must be equal.");
@@ -278,6 +331,7 @@ bool cf_query_device_feature(CF_DeviceFeature feature)
 	bool result = false;
 	switch (feature) {
 	case CF_DEVICE_FEATURE_TEXTURE_CLAMP:    result = sgf.image_clamp_to_border;       break;
+	case CF_DEVICE_FEATURE_TEXTURE_ARRAY:    result = sg_query_limits().max_image_array_layers > 1; break;
 	}
 	return result;
 }
@@ -289,6 +343,7 @@ int cf_query_resource_limit(CF_ResourceLimit resource_limit)
 	switch (resource_limit) {
 	case CF_RESOURCE_LIMIT_TEXTURE_DIMENSION:       result = sgl.max_image_size_2d; break;
 	case CF_RESOURCE_LIMIT_VERTEX_ATTRIBUTE_MAX:    result = sgl.max_vertex_attrs; break;
+	case CF_RESOURCE_LIMIT_TEXTURE_ARRAY_LAYERS:    result = sgl.max_image_array_layers; break;
 	}
 	return result;
 }
@@ -303,6 +358,8 @@ CF_TextureParams cf_texture_defaults(int w, int h)
 	params.wrap_v = CF_WRAP_MODE_DEFAULT;
 	params.width = w;
 	params.height = h;
+	params.mip_count = 1;
+	params.layer_count = 1;
 	params.render_target = false;
 	params.initial_data = NULL;
 	params.initial_data_size = 0;
@@ -313,15 +370,16 @@ CF_Texture cf_make_texture(CF_TextureParams texture_params)
 {
 	sg_image_desc desc;
 	CF_MEMSET(&desc, 0, sizeof(desc));
-	desc.type = SG_IMAGETYPE_2D;
+	int layers = max(texture_params.layer_count, 1);
+	desc.type = layers > 1 ? SG_IMAGETYPE_ARRAY : SG_IMAGETYPE_2D;
 	desc.render_target = texture_params.render_target;
 	desc.width = texture_params.width;
 	desc.height = texture_params.height;
-	desc.num_slices = 0;
-	desc.num_mipmaps = 0;
+	desc.num_slices = layers > 1 ? layers : 0;
+	desc.num_mipmaps = texture_params.mip_count > 1 ? texture_params.mip_count : 0;
 	desc.usage = s_wrap(texture_params.usage);
 	desc.pixel_format = s_wrap(texture_params.pixel_format);
-	desc.min_filter = s_wrap(texture_params.filter);
+	desc.min_filter = s_wrap_min_filter(texture_params.filter, desc.num_mipmaps);
 	desc.mag_filter = s_wrap(texture_params.filter);
 	desc.wrap_u = s_wrap(texture_params.wrap_u);
 	desc.wrap_v = s_wrap(texture_params.wrap_v);
@@ -330,13 +388,242 @@ CF_Texture cf_make_texture(CF_TextureParams texture_params)
 	desc.max_anisotropy = 1;
 	desc.min_lod = 0;
 	desc.max_lod = FLT_MAX;
-	desc.data.subimage[0][0].ptr = texture_params.initial_data;
-	desc.data.subimage[0][0].size = texture_params.initial_data_size;
+	if ((desc.num_mipmaps > 1 || layers > 1) && texture_params.initial_data) {
+		// Mip levels are packed back to back, largest first, each holding every layer.
+		CF_ASSERT(desc.num_mipmaps <= SG_MAX_MIPMAPS);
+		uint8_t* data = (uint8_t*)texture_params.initial_data;
+		int w = desc.width, h = desc.height;
+		for (int i = 0; i < max(desc.num_mipmaps, 1); ++i) {
+			int size = cf_texture_data_size(texture_params.pixel_format, w, h) * layers;
+			desc.data.subimage[0][i].ptr = data;
+			desc.data.subimage[0][i].size = size;
+			data += size;
+			w = max(w / 2, 1);
+			h = max(h / 2, 1);
+		}
+		CF_ASSERT(data <= (uint8_t*)texture_params.initial_data + texture_params.initial_data_size);
+	} else {
+		desc.data.subimage[0][0].ptr = texture_params.initial_data;
+		desc.data.subimage[0][0].size = texture_params.initial_data_size;
+	}
 	sg_image sgi = sg_make_image(desc);
 	CF_Texture texture = { sgi.id };
 	return texture;
 }
 
+int cf_texture_data_size(CF_PixelFormat format, int w, int h)
+{
+	// Block compressed formats store 4x4 pixel blocks.
+	int blocks = ((w + 3) / 4) * ((h + 3) / 4);
+	switch (format) {
+	case CF_PIXELFORMAT_BC1_RGBA:
+	case CF_PIXELFORMAT_BC4_R:
+	case CF_PIXELFORMAT_BC4_RSN:
+	case CF_PIXELFORMAT_ETC2_RGB8:
+	case CF_PIXELFORMAT_ETC2_RGB8A1:
+		return blocks * 8;
+	case CF_PIXELFORMAT_BC2_RGBA:
+	case CF_PIXELFORMAT_BC3_RGBA:
+	case CF_PIXELFORMAT_BC5_RG:
+	case CF_PIXELFORMAT_BC5_RGSN:
+	case CF_PIXELFORMAT_BC6H_RGBF:
+	case CF_PIXELFORMAT_BC6H_RGBUF:
+	case CF_PIXELFORMAT_BC7_RGBA:
+	case CF_PIXELFORMAT_ETC2_RGBA8:
+	case CF_PIXELFORMAT_ETC2_RG11:
+	case CF_PIXELFORMAT_ETC2_RG11SN:
+		return blocks * 16;
+	case CF_PIXELFORMAT_PVRTC_RGB_2BPP:
+	case CF_PIXELFORMAT_PVRTC_RGBA_2BPP:
+		return (max(w, 16) * max(h, 8) * 2 + 7) / 8;
+	case CF_PIXELFORMAT_PVRTC_RGB_4BPP:
+	case CF_PIXELFORMAT_PVRTC_RGBA_4BPP:
+		return (max(w, 8) * max(h, 8) * 4 + 7) / 8;
+	case CF_PIXELFORMAT_R8: case CF_PIXELFORMAT_R8SN: case CF_PIXELFORMAT_R8UI: case CF_PIXELFORMAT_R8SI:
+		return w * h;
+	case CF_PIXELFORMAT_R16: case CF_PIXELFORMAT_R16SN: case CF_PIXELFORMAT_R16UI: case CF_PIXELFORMAT_R16SI: case CF_PIXELFORMAT_R16F:
+	case CF_PIXELFORMAT_RG8: case CF_PIXELFORMAT_RG8SN: case CF_PIXELFORMAT_RG8UI: case CF_PIXELFORMAT_RG8SI:
+		return w * h * 2;
+	case CF_PIXELFORMAT_RG16: case CF_PIXELFORMAT_RG16SN: case CF_PIXELFORMAT_RG16UI: case CF_PIXELFORMAT_RG16SI: case CF_PIXELFORMAT_RG16F:
+	case CF_PIXELFORMAT_R32UI: case CF_PIXELFORMAT_R32SI: case CF_PIXELFORMAT_R32F:
+	case CF_PIXELFORMAT_DEFAULT: case CF_PIXELFORMAT_RGBA8: case CF_PIXELFORMAT_SRGB8A8: case CF_PIXELFORMAT_RGBA8SN: case CF_PIXELFORMAT_RGBA8UI: case CF_PIXELFORMAT_RGBA8SI:
+	case CF_PIXELFORMAT_BGRA8: case CF_PIXELFORMAT_RGB10A2: case CF_PIXELFORMAT_RG11B10F: case CF_PIXELFORMAT_RGB9E5:
+	case CF_PIXELFORMAT_DEPTH: case CF_PIXELFORMAT_DEPTH_STENCIL:
+		return w * h * 4;
+	case CF_PIXELFORMAT_RG32UI: case CF_PIXELFORMAT_RG32SI: case CF_PIXELFORMAT_RG32F:
+	case CF_PIXELFORMAT_RGBA16: case CF_PIXELFORMAT_RGBA16SN: case CF_PIXELFORMAT_RGBA16UI: case CF_PIXELFORMAT_RGBA16SI: case CF_PIXELFORMAT_RGBA16F:
+		return w * h * 8;
+	case CF_PIXELFORMAT_RGBA32UI: case CF_PIXELFORMAT_RGBA32SI: case CF_PIXELFORMAT_RGBA32F:
+		return w * h * 16;
+	default:
+		return 0;
+	}
+}
+
+static uint32_t s_read_u32(const uint8_t* p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static CF_PixelFormat s_dds_format(uint32_t fourcc, uint32_t dxgi_format)
+{
+	#define CF_FOURCC(a, b, c, d) ((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+	switch (fourcc) {
+	case CF_FOURCC('D', 'X', 'T', '1'): return CF_PIXELFORMAT_BC1_RGBA;
+	case CF_FOURCC('D', 'X', 'T', '3'): return CF_PIXELFORMAT_BC2_RGBA;
+	case CF_FOURCC('D', 'X', 'T', '5'): return CF_PIXELFORMAT_BC3_RGBA;
+	case CF_FOURCC('A', 'T', 'I', '1'): return CF_PIXELFORMAT_BC4_R;
+	case CF_FOURCC('B', 'C', '4', 'U'): return CF_PIXELFORMAT_BC4_R;
+	case CF_FOURCC('B', 'C', '4', 'S'): return CF_PIXELFORMAT_BC4_RSN;
+	case CF_FOURCC('A', 'T', 'I', '2'): return CF_PIXELFORMAT_BC5_RG;
+	case CF_FOURCC('B', 'C', '5', 'U'): return CF_PIXELFORMAT_BC5_RG;
+	case CF_FOURCC('B', 'C', '5', 'S'): return CF_PIXELFORMAT_BC5_RGSN;
+	case CF_FOURCC('D', 'X', '1', '0'): break;
+	default: return CF_PIXELFORMAT_COUNT;
+	}
+	#undef CF_FOURCC
+	// DXGI_FORMAT values, including the typeless and sRGB variants of each block format.
+	switch (dxgi_format) {
+	case 28: case 29:          return CF_PIXELFORMAT_RGBA8;
+	case 70: case 71: case 72: return CF_PIXELFORMAT_BC1_RGBA;
+	case 73: case 74: case 75: return CF_PIXELFORMAT_BC2_RGBA;
+	case 76: case 77: case 78: return CF_PIXELFORMAT_BC3_RGBA;
+	case 79: case 80:          return CF_PIXELFORMAT_BC4_R;
+	case 81:                   return CF_PIXELFORMAT_BC4_RSN;
+	case 82: case 83:          return CF_PIXELFORMAT_BC5_RG;
+	case 84:                   return CF_PIXELFORMAT_BC5_RGSN;
+	case 94: case 95:          return CF_PIXELFORMAT_BC6H_RGBUF;
+	case 96:                   return CF_PIXELFORMAT_BC6H_RGBF;
+	case 97: case 98: case 99: return CF_PIXELFORMAT_BC7_RGBA;
+	default:                   return CF_PIXELFORMAT_COUNT;
+	}
+}
+
+static CF_PixelFormat s_ktx_format(uint32_t gl_internal_format)
+{
+	switch (gl_internal_format) {
+	case 0x8058:                return CF_PIXELFORMAT_RGBA8;
+	case 0x83F1:                return CF_PIXELFORMAT_BC1_RGBA;
+	case 0x83F2:                return CF_PIXELFORMAT_BC2_RGBA;
+	case 0x83F3:                return CF_PIXELFORMAT_BC3_RGBA;
+	case 0x8DBB:                return CF_PIXELFORMAT_BC4_R;
+	case 0x8DBC:                return CF_PIXELFORMAT_BC4_RSN;
+	case 0x8DBD:                return CF_PIXELFORMAT_BC5_RG;
+	case 0x8DBE:                return CF_PIXELFORMAT_BC5_RGSN;
+	case 0x8E8C: case 0x8E8D:   return CF_PIXELFORMAT_BC7_RGBA;
+	case 0x8E8E:                return CF_PIXELFORMAT_BC6H_RGBF;
+	case 0x8E8F:                return CF_PIXELFORMAT_BC6H_RGBUF;
+	case 0x8C00:                return CF_PIXELFORMAT_PVRTC_RGB_4BPP;
+	case 0x8C01:                return CF_PIXELFORMAT_PVRTC_RGB_2BPP;
+	case 0x8C02:                return CF_PIXELFORMAT_PVRTC_RGBA_4BPP;
+	case 0x8C03:                return CF_PIXELFORMAT_PVRTC_RGBA_2BPP;
+	case 0x9272:                return CF_PIXELFORMAT_ETC2_RG11;
+	case 0x9273:                return CF_PIXELFORMAT_ETC2_RG11SN;
+	case 0x9274: case 0x9275:   return CF_PIXELFORMAT_ETC2_RGB8;
+	case 0x9276: case 0x9277:   return CF_PIXELFORMAT_ETC2_RGB8A1;
+	case 0x9278: case 0x9279:   return CF_PIXELFORMAT_ETC2_RGBA8;
+	default:                    return CF_PIXELFORMAT_COUNT;
+	}
+}
+
+CF_Result cf_load_texture(const char* virtual_path, CF_Filter filter, CF_Texture* texture_out, CF_TextureParams* params_out)
+{
+	size_t size = 0;
+	uint8_t* file = (uint8_t*)cf_fs_read_entire_file_to_memory(virtual_path, &size);
+	if (!file) return cf_result_error("Unable to open texture file.");
+
+	CF_TextureParams params = cf_texture_defaults(0, 0);
+	params.filter = filter;
+	uint8_t* data = NULL;
+	int data_size = 0;
+	bool copied = false;
+	static const uint8_t ktx_id[12] = { 0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+	if (size >= 128 && s_read_u32(file) == 0x20534444) {
+		// DDS: "DDS " + DDS_HEADER, optionally followed by DDS_HEADER_DXT10.
+		uint32_t fourcc = s_read_u32(file + 84);
+		int header_size = fourcc == 0x30315844 ? 148 : 128;
+		if (size < (size_t)header_size) {
+			cf_free(file);
+			return cf_result_error("Truncated DDS header.");
+		}
+		params.height = (int)s_read_u32(file + 12);
+		params.width = (int)s_read_u32(file + 16);
+		params.mip_count = max((int)s_read_u32(file + 28), 1);
+		params.pixel_format = s_dds_format(fourcc, header_size == 148 ? s_read_u32(file + 128) : 0);
+		data = file + header_size;
+		data_size = (int)(size - header_size);
+	} else if (size >= 64 && CF_MEMCMP(file, ktx_id, sizeof(ktx_id)) == 0) {
+		// KTX 1.1: header, key/value data, then per mip level a u32 image size followed by the image.
+		if (s_read_u32(file + 12) != 0x04030201) {
+			cf_free(file);
+			return cf_result_error("Big-endian KTX files are not supported.");
+		}
+		params.pixel_format = s_ktx_format(s_read_u32(file + 28));
+		params.width = (int)s_read_u32(file + 36);
+		params.height = max((int)s_read_u32(file + 40), 1);
+		params.mip_count = max((int)s_read_u32(file + 56), 1);
+		size_t offset = 64 + s_read_u32(file + 60);
+		if (params.pixel_format != CF_PIXELFORMAT_COUNT) {
+			// Strip the per-level size prefixes so levels end up tightly packed.
+			data = (uint8_t*)CF_ALLOC(size);
+			copied = true;
+			int w = params.width, h = params.height;
+			for (int i = 0; i < params.mip_count && i < SG_MAX_MIPMAPS; ++i) {
+				int level_size = cf_texture_data_size(params.pixel_format, w, h);
+				if (offset + 4 + level_size > size) break;
+				CF_MEMCPY(data + data_size, file + offset + 4, level_size);
+				data_size += level_size;
+				offset += (4 + s_read_u32(file + offset) + 3) & ~(size_t)3;
+				w = max(w / 2, 1);
+				h = max(h / 2, 1);
+			}
+		}
+	} else {
+		cf_free(file);
+		return cf_result_error("Unrecognized texture file, expected DDS or KTX.");
+	}
+
+	if (params.pixel_format == CF_PIXELFORMAT_COUNT) {
+		cf_free(file);
+		return cf_result_error("Unsupported pixel format in texture file.");
+	}
+	if (!cf_query_pixel_format(params.pixel_format, CF_PIXELFORMAT_OP_NEAREST_FILTER)) {
+		if (copied) CF_FREE(data);
+		cf_free(file);
+		return cf_result_error("Texture file's pixel format is not supported on this device.");
+	}
+
+	// Drop any mip levels the file is too short to contain.
+	params.mip_count = min(params.mip_count, SG_MAX_MIPMAPS);
+	int total = 0, w = params.width, h = params.height;
+	for (int i = 0; i < params.mip_count; ++i) {
+		int level_size = cf_texture_data_size(params.pixel_format, w, h);
+		if (total + level_size > data_size) {
+			params.mip_count = i;
+			break;
+		}
+		total += level_size;
+		w = max(w / 2, 1);
+		h = max(h / 2, 1);
+	}
+	if (params.width <= 0 || params.mip_count == 0) {
+		if (copied) CF_FREE(data);
+		cf_free(file);
+		return cf_result_error("Truncated texture data.");
+	}
+
+	params.initial_data = data;
+	params.initial_data_size = total;
+	*texture_out = cf_make_texture(params);
+	params.initial_data = NULL;
+	params.initial_data_size = 0;
+	if (params_out) *params_out = params;
+	if (copied) CF_FREE(data);
+	cf_free(file);
+	return cf_result_success();
+}
+
 void cf_destroy_texture(CF_Texture texture)
 {
 	sg_image sgi = { (uint32_t)texture.id };
@@ -352,21 +639,279 @@ void cf_update_texture(CF_Texture texture, void* data, int size)
 	sg_update_image(sgi, sgid);
 }
 
+// Texture data staged from any thread, uploaded by the render thread a budgeted number of bytes per frame.
+
+struct CF_TextureUploadInternal
+{
+	bool make = false;
+	CF_TextureParams params = { };
+	sg_image image = { };
+	void* data = NULL;
+	int size = 0;
+	bool ready = false;
+	bool orphaned = false; // Destroyed by the user while the render thread held it.
+};
+
+static Array<CF_TextureUploadInternal*> s_uploads; // Staged, oldest first.
+static CF_Mutex s_uploads_lock;
+static int s_upload_budget = 4 * 1024 * 1024;
+static Array<uint32_t> s_uploads_touched; // Images updated this frame, as sokol allows one update per image per frame.
+static uint64_t s_uploads_touched_frame = ~0ULL;
+
+// Held only to push, pop or flag an upload, never across a GPU call.
+static void s_uploads_lock_acquire()
+{
+	cf_mutex_lock(&s_uploads_lock);
+}
+
+static void s_uploads_lock_release()
+{
+	cf_mutex_unlock(&s_uploads_lock);
+}
+
+static void s_upload_free(CF_TextureUploadInternal* upload)
+{
+	CF_FREE(upload->data);
+	upload->~CF_TextureUploadInternal();
+	CF_FREE(upload);
+}
+
+static CF_TextureUpload s_upload_stage(CF_TextureUploadInternal* upload, const void* data, int size)
+{
+	if (data && size > 0) {
+		upload->data = CF_ALLOC(size);
+		CF_MEMCPY(upload->data, data, size);
+		upload->size = size;
+	}
+	s_uploads_lock_acquire();
+	s_uploads.add(upload);
+	s_uploads_lock_release();
+	CF_TextureUpload result;
+	result.id = (uint64_t)upload;
+	return result;
+}
+
+CF_TextureUpload cf_make_texture_async(CF_TextureParams texture_params)
+{
+	CF_TextureUploadInternal* upload = CF_NEW(CF_TextureUploadInternal);
+	upload->make = true;
+	upload->params = texture_params;
+	return s_upload_stage(upload, texture_params.initial_data, texture_params.initial_data_size);
+}
+
+CF_TextureUpload cf_update_texture_async(CF_Texture texture, const void* data, int size)
+{
+	CF_TextureUploadInternal* upload = CF_NEW(CF_TextureUploadInternal);
+	upload->image = { (uint32_t)texture.id };
+	return s_upload_stage(upload, data, size);
+}
+
+bool cf_texture_upload_ready(CF_TextureUpload upload_handle)
+{
+	CF_TextureUploadInternal* upload = (CF_TextureUploadInternal*)upload_handle.id;
+	if (!upload) return false;
+	s_uploads_lock_acquire();
+	bool ready = upload->ready;
+	s_uploads_lock_release();
+	return ready;
+}
+
+CF_Texture cf_texture_upload_get_texture(CF_TextureUpload upload_handle)
+{
+	CF_TextureUploadInternal* upload = (CF_TextureUploadInternal*)upload_handle.id;
+	CF_Texture result = { 0 };
+	if (!upload) return result;
+	s_uploads_lock_acquire();
+	if (upload->ready) result.id = upload->image.id;
+	s_uploads_lock_release();
+	return result;
+}
+
+void cf_destroy_texture_upload(CF_TextureUpload upload_handle)
+{
+	CF_TextureUploadInternal* upload = (CF_TextureUploadInternal*)upload_handle.id;
+	if (!upload) return;
+	s_uploads_lock_acquire();
+	bool staged = false;
+	for (int i = 0; i < s_uploads.count(); ++i) {
+		if (s_uploads[i] == upload) {
+			for (int j = i; j < s_uploads.count() - 1; ++j) s_uploads[j] = s_uploads[j + 1];
+			s_uploads.pop();
+			staged = true;
+			break;
+		}
+	}
+	// Neither staged nor ready means the render thread is uploading it right now, and frees it when done.
+	bool in_flight = !staged && !upload->ready;
+	if (in_flight) upload->orphaned = true;
+	s_uploads_lock_release();
+	if (!in_flight) s_upload_free(upload);
+}
+
+void cf_set_texture_upload_budget(int bytes_per_frame)
+{
+	s_upload_budget = bytes_per_frame;
+}
+
+static bool s_upload_touched(uint32_t image)
+{
+	for (int i = 0; i < s_uploads_touched.count(); ++i) {
+		if (s_uploads_touched[i] == image) return true;
+	}
+	return false;
+}
+
+static void s_uploads_update(bool flush)
+{
+	if (s_uploads_touched_frame != s_frame) {
+		s_uploads_touched.clear();
+		s_uploads_touched_frame = s_frame;
+	}
+	int budget = flush || s_upload_budget <= 0 ? INT_MAX : s_upload_budget;
+	int spent = 0;
+	bool first = true;
+	while (true) {
+		// Take the oldest upload whose image hasn't been updated this frame, keeping updates to one image in order.
+		CF_TextureUploadInternal* upload = NULL;
+		s_uploads_lock_acquire();
+		if (first || spent < budget) {
+			for (int i = 0; i < s_uploads.count(); ++i) {
+				CF_TextureUploadInternal* candidate = s_uploads[i];
+				if (!candidate->make && s_upload_touched(candidate->image.id)) continue;
+				for (int j = i; j < s_uploads.count() - 1; ++j) s_uploads[j] = s_uploads[j + 1];
+				s_uploads.pop();
+				upload = candidate;
+				break;
+			}
+		}
+		s_uploads_lock_release();
+		if (!upload) break;
+		first = false;
+
+		if (upload->make) {
+			upload->params.initial_data = upload->data;
+			upload->params.initial_data_size = upload->size;
+			upload->image.id = (uint32_t)cf_make_texture(upload->params).id;
+		} else {
+			cf_update_texture({ upload->image.id }, upload->data, upload->size);
+			s_uploads_touched.add(upload->image.id);
+		}
+		spent += max(upload->size, 1);
+		CF_FREE(upload->data);
+		upload->data = NULL;
+
+		s_uploads_lock_acquire();
+		bool orphaned = upload->orphaned;
+		upload->ready = true;
+		s_uploads_lock_release();
+		if (orphaned) {
+			if (upload->make) sg_destroy_image(upload->image);
+			s_upload_free(upload);
+		}
+	}
+}
+
+void cf_flush_texture_uploads()
+{
+	s_uploads_update(true);
+}
+
+// Where compiled shaders are kept across runs, see `cf_set_shader_cache_directory`.
+static const char* s_shader_cache_directory = NULL;
+
+void cf_set_shader_cache_directory(const char* virtual_path)
+{
+	s_shader_cache_directory = virtual_path ? sintern(virtual_path) : NULL;
+	if (virtual_path) cf_fs_create_directory(virtual_path);
+}
+
+// Returns the compiled bytecode for a stage given as HLSL source, read from the shader cache, or compiled and
+// written to the cache on a miss. Free the result's `ptr` with `CF_FREE`.
+static sg_range s_shader_cache_bytecode(const sg_shader_stage_desc* stage)
+{
+	sg_range result = { };
+	if (!stage->source || !stage->d3d11_target) return result;
+	const char* entry = stage->entry ? stage->entry : "main";
+	uint64_t key = fnv1a(stage->source, (int)CF_STRLEN(stage->source));
+	key ^= fnv1a(stage->d3d11_target, (int)CF_STRLEN(stage->d3d11_target)) * 31;
+	key ^= fnv1a(entry, (int)CF_STRLEN(entry)) * 17;
+	char path[1024];
+	CF_SNPRINTF(path, sizeof(path), "%s/%016llx.dxbc", s_shader_cache_directory, (unsigned long long)key);
+	size_t size = 0;
+	void* bytecode = cf_fs_read_entire_file_to_memory(path, &size);
+	if (!bytecode) {
+		bytecode = cf_dx11_compile_shader(stage->source, entry, stage->d3d11_target, &size);
+		if (!bytecode) return result;
+		cf_fs_write_entire_buffer_to_file(path, bytecode, size);
+	}
+	result.ptr = bytecode;
+	result.size = size;
+	return result;
+}
+
+// D3D11 shaders are compiled from HLSL on creation, which is slow enough to hitch. With a shader cache
+// the bytecode is instead compiled once and then read from disk.
+static sg_shader s_make_cached_shader(const sg_shader_desc* desc)
+{
+	if (!s_shader_cache_directory || sg_query_backend() != SG_BACKEND_D3D11 || desc->vs.bytecode.ptr) {
+		return sg_make_shader(desc);
+	}
+	sg_shader_desc cached = *desc;
+	cached.vs.bytecode = s_shader_cache_bytecode(&desc->vs);
+	cached.fs.bytecode = s_shader_cache_bytecode(&desc->fs);
+	sg_shader shd = sg_make_shader(cached);
+	CF_FREE((void*)cached.vs.bytecode.ptr);
+	CF_FREE((void*)cached.fs.bytecode.ptr);
+	if (sg_query_shader_state(shd) != SG_RESOURCESTATE_VALID) {
+		// A stale or broken cache file, compile from the source instead.
+		sg_destroy_shader(shd);
+		shd = sg_make_shader(desc);
+	}
+	return shd;
+}
+
 CF_Shader cf_make_shader(CF_SokolShader sokol_shader)
 {
 	CF_ShaderInternal* shader = (CF_ShaderInternal*)CF_ALLOC(sizeof(CF_ShaderInternal));
 	shader->table = sokol_shader;
-	const sg_shader_desc* desc = shader->table.get_desc_fn(sg_query_backend());
+	sg_backend backend = sg_query_backend();
+	// sokol-shdc emits nothing for the dummy backend, which never compiles shaders anyways. Any desc will do
+	// as long as its slots and uniform blocks match, so borrow the GL one.
+	if (backend == SG_BACKEND_DUMMY) backend = SG_BACKEND_GLCORE33;
+	const sg_shader_desc* desc = shader->table.get_desc_fn(backend);
 	shader->desc = desc;
-	shader->shd = sg_make_shader(desc);
+	shader->shd = s_make_cached_shader(desc);
 	CF_Shader result;
 	result.id = { (uint64_t)shader };
 	return result;
 }
 
+static void s_pipeline_cache_evict_shader(sg_shader shd)
+{
+	if (!s_pipeline_cache) return;
+	Map<uint64_t, CF_PipelineCacheEntry>& entries = s_pipeline_cache->entries;
+	for (int i = 0; i < entries.count();) {
+		if (entries.items()[i].desc.shader.id == shd.id) {
+			sg_destroy_pipeline(entries.items()[i].pip);
+			entries.remove(entries.keys()[i]);
+			s_pipeline_cache->stats.evictions++;
+		} else {
+			++i;
+		}
+	}
+}
+
+bool cf_shader_has_vertex_input(CF_Shader shader, const char* name)
+{
+	CF_ShaderInternal* shader_internal = (CF_ShaderInternal*)shader.id;
+	return shader_internal->table.get_attr_slot(name) >= 0;
+}
+
 void cf_destroy_shader(CF_Shader shader)
 {
 	CF_ShaderInternal* shader_internal = (CF_ShaderInternal*)shader.id;
+	// Pipelines hold onto their shader, so any cached pipelines using it must go too.
+	s_pipeline_cache_evict_shader(shader_internal->shd);
 	sg_destroy_shader(shader_internal->shd);
 	CF_FREE(shader_internal);
 }
@@ -408,6 +953,7 @@ CF_Canvas cf_make_canvas(CF_CanvasParams canvas_params)
 	if (canvas_params.target.width > 0 && canvas_params.target.height > 0) {
 		canvas->cf_texture = cf_make_texture(canvas_params.target);
 		canvas->cf_depth_stencil = cf_make_texture(canvas_params.depth_stencil_target);
+		canvas->color_format = s_wrap(canvas_params.target.pixel_format);
 
 		sg_pass_desc desc;
 		CF_MEMSET(&desc, 0, sizeof(desc));
@@ -438,6 +984,92 @@ void cf_destroy_canvas(CF_Canvas canvas_handle)
 	CF_FREE(canvas);
 }
 
+// Canvases handed out by `cf_acquire_transient_canvas`. Free entries matching the requested
+// params are recycled, and entries left unused for a few frames are destroyed, so a window
+// resize only reallocates once per distinct size.
+#define CF_TRANSIENT_CANVAS_MAX_IDLE_FRAMES 4
+
+struct CF_TransientCanvas
+{
+	CF_CanvasParams params;
+	CF_Canvas canvas;
+	bool in_use;
+	uint64_t last_used_frame;
+};
+
+static Array<CF_TransientCanvas> s_transient_canvases;
+
+static bool s_texture_params_match(const CF_TextureParams& a, const CF_TextureParams& b)
+{
+	return a.pixel_format == b.pixel_format
+		&& a.usage == b.usage
+		&& a.filter == b.filter
+		&& a.wrap_u == b.wrap_u
+		&& a.wrap_v == b.wrap_v
+		&& a.width == b.width
+		&& a.height == b.height
+		&& a.render_target == b.render_target;
+}
+
+static void s_destroy_transient_canvas(CF_TransientCanvas* entry)
+{
+	if (s_canvas == (CF_CanvasInternal*)entry->canvas.id) s_canvas = NULL;
+	cf_destroy_texture(cf_canvas_get_target(entry->canvas));
+	cf_destroy_texture(cf_canvas_get_depth_stencil_target(entry->canvas));
+	cf_destroy_canvas(entry->canvas);
+}
+
+CF_Canvas cf_acquire_transient_canvas(CF_CanvasParams canvas_params)
+{
+	CF_ASSERT(canvas_params.target.width > 0 && canvas_params.target.height > 0);
+	for (int i = 0; i < s_transient_canvases.count(); ++i) {
+		CF_TransientCanvas* entry = s_transient_canvases + i;
+		if (entry->in_use) continue;
+		if (!s_texture_params_match(entry->params.target, canvas_params.target)) continue;
+		if (!s_texture_params_match(entry->params.depth_stencil_target, canvas_params.depth_stencil_target)) continue;
+		entry->in_use = true;
+		entry->last_used_frame = s_frame;
+		return entry->canvas;
+	}
+	// Initial pixel data makes no sense for a recycled render target.
+	canvas_params.target.initial_data = NULL;
+	canvas_params.target.initial_data_size = 0;
+	canvas_params.depth_stencil_target.initial_data = NULL;
+	canvas_params.depth_stencil_target.initial_data_size = 0;
+	CF_TransientCanvas entry;
+	entry.params = canvas_params;
+	entry.canvas = cf_make_canvas(canvas_params);
+	entry.in_use = true;
+	entry.last_used_frame = s_frame;
+	s_transient_canvases.add(entry);
+	return entry.canvas;
+}
+
+void cf_release_transient_canvas(CF_Canvas canvas)
+{
+	for (int i = 0; i < s_transient_canvases.count(); ++i) {
+		if (s_transient_canvases[i].canvas.id == canvas.id) {
+			s_transient_canvases[i].in_use = false;
+			return;
+		}
+	}
+	CF_ASSERT(false); // Not a transient canvas.
+}
+
+static void s_recycle_transient_canvases(bool all)
+{
+	for (int i = 0; i < s_transient_canvases.count();) {
+		CF_TransientCanvas* entry = s_transient_canvases + i;
+		entry->in_use = false;
+		if (all || s_frame - entry->last_used_frame > CF_TRANSIENT_CANVAS_MAX_IDLE_FRAMES) {
+			s_destroy_transient_canvas(entry);
+			s_transient_canvases.unordered_remove(i);
+		} else {
+			++i;
+		}
+	}
+}
+
 CF_Texture cf_canvas_get_target(CF_Canvas canvas_handle)
 {
 	CF_CanvasInternal* canvas = (CF_CanvasInternal*)canvas_handle.id;
@@ -450,6 +1082,13 @@ CF_Texture cf_canvas_get_depth_stencil_target(CF_Canvas canvas_handle)
 	return canvas->cf_depth_stencil;
 }
 
+bool cf_canvas_has_depth(CF_Canvas canvas_handle)
+{
+	CF_CanvasInternal* canvas = (CF_CanvasInternal*)canvas_handle.id;
+	if (canvas->pass_is_default) return app->gfx_ctx_params.depth_format != SG_PIXELFORMAT_NONE;
+	return canvas->depth_stencil.id != SG_INVALID_ID;
+}
+
 uint64_t cf_canvas_get_backend_target_handle(CF_Canvas canvas_handle)
 {
 	CF_CanvasInternal* canvas = (CF_CanvasInternal*)canvas_handle.id;
@@ -583,6 +1222,42 @@ void cf_mesh_set_attributes(CF_Mesh mesh_handle, const CF_VertexAttribute* attri
 	}
 }
 
+static void s_destroy_retired_buffers(bool all)
+{
+	int i = 0;
+	while (i < s_retired_buffers.count()) {
+		if (all || s_frame - s_retired_buffers[i].frame > SG_NUM_INFLIGHT_FRAMES) {
+			sg_destroy_buffer(s_retired_buffers[i].handle);
+			s_retired_buffers.unordered_remove(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+// Streams data onto the end of a buffer. Rather than dropping data that doesn't fit within this frame's
+// remaining space, the buffer is swapped out for one at least twice as large. Draws already recorded
+// this frame keep referencing the old buffer, so it's retired instead of being destroyed immediately.
+static int s_append_buffer_data(CF_Buffer* buffer, sg_buffer_type type, sg_usage usage, void* data, int size)
+{
+	if (sg_query_buffer_will_overflow(buffer->handle, size)) {
+		s_retired_buffers.add({ buffer->handle, s_frame });
+		buffer->size = max(buffer->size * 2, size);
+		buffer->grow_count++;
+		sg_buffer_desc desc = { };
+		desc.size = buffer->size;
+		desc.type = type;
+		desc.usage = usage;
+		buffer->handle = sg_make_buffer(desc);
+	}
+	sg_range range = { data, (size_t)size };
+	int offset = sg_append_buffer(buffer->handle, range);
+	buffer->offset = offset;
+	buffer->high_water = max(buffer->high_water, offset + size);
+	buffer->was_appended = true;
+	return offset;
+}
+
 static void s_sync_vertex_buffer(CF_MeshInternal* mesh, void* data, int size)
 {
 	mesh->need_vertex_sync = false;
@@ -608,11 +1283,14 @@ void cf_mesh_update_vertex_data(CF_Mesh mesh_handle, void* data, int count)
 	CF_ASSERT(mesh->attribute_count);
 	if (mesh->need_vertex_sync) {
 		s_sync_vertex_buffer(mesh, mesh->usage == SG_USAGE_IMMUTABLE ? data : NULL, size);
-	} else {
+	}
+	// Immutable buffers take their data as they're made, the others are written once they exist.
+	if (mesh->usage != SG_USAGE_IMMUTABLE) {
 		sg_range range = { data, (size_t)size };
 		sg_update_buffer(mesh->vertices.handle, range);
 	}
 	mesh->vertices.element_count = count;
+	s_render_stats.vertices_uploaded += count;
 }
 
 int cf_mesh_append_vertex_data(CF_Mesh mesh_handle, void* data, int append_count)
@@ -620,20 +1298,14 @@ int cf_mesh_append_vertex_data(CF_Mesh mesh_handle, void* data, int append_count
 	CF_MeshInternal* mesh = (CF_MeshInternal*)mesh_handle.id;
 	int size = append_count * mesh->vertices.stride;
 	CF_ASSERT(mesh->attribute_count);
-	CF_ASSERT(mesh->vertices.size >= size);
+	CF_ASSERT(mesh->usage != SG_USAGE_IMMUTABLE);
 	if (mesh->need_vertex_sync) {
 		s_sync_vertex_buffer(mesh, NULL, mesh->vertices.size);
 	}
-	sg_range range = { data, (size_t)size };
-	if (!sg_query_buffer_will_overflow(mesh->vertices.handle, size)) {
-		int offset = sg_append_buffer(mesh->vertices.handle, range);
-		mesh->vertices.offset = offset;
-		mesh->vertices.element_count = append_count;
-		mesh->vertices.was_appended = true;
-		return offset;
-	} else {
-		return 0;
-	}
+	int offset = s_append_buffer_data(&mesh->vertices, SG_BUFFERTYPE_VERTEXBUFFER, mesh->usage, data, size);
+	mesh->vertices.element_count = append_count;
+	s_render_stats.vertices_uploaded += append_count;
+	return offset;
 }
 
 bool cf_mesh_will_overflow_vertex_data(CF_Mesh mesh_handle, int append_count)
@@ -667,7 +1339,9 @@ void cf_mesh_update_instance_data(CF_Mesh mesh_handle, void* data, int count)
 	CF_ASSERT(mesh->attribute_count);
 	if (mesh->need_instance_sync) {
 		s_sync_instance_buffer(mesh, mesh->usage == SG_USAGE_IMMUTABLE ? data : NULL, size);
-	} else {
+	}
+	// Immutable buffers take their data as they're made, the others are written once they exist.
+	if (mesh->usage != SG_USAGE_IMMUTABLE) {
 		sg_range range = { data, (size_t)size };
 		sg_update_buffer(mesh->instances.handle, range);
 	}
@@ -679,20 +1353,13 @@ int cf_mesh_append_instance_data(CF_Mesh mesh_handle, void* data, int append_cou
 	CF_MeshInternal* mesh = (CF_MeshInternal*)mesh_handle.id;
 	int size = append_count * mesh->instances.stride;
 	CF_ASSERT(mesh->attribute_count);
-	CF_ASSERT(mesh->instances.size >= size);
+	CF_ASSERT(mesh->usage != SG_USAGE_IMMUTABLE);
 	if (mesh->need_instance_sync) {
 		s_sync_instance_buffer(mesh, NULL, mesh->instances.size);
 	}
-	sg_range range = { data, (size_t)size };
-	if (!sg_query_buffer_will_overflow(mesh->instances.handle, size)) {
-		int offset = sg_append_buffer(mesh->instances.handle, range);
-		mesh->instances.offset = offset;
-		mesh->instances.element_count = append_count;
-		mesh->instances.was_appended = true;
-		return offset;
-	} else {
-		return 0;
-	}
+	int offset = s_append_buffer_data(&mesh->instances, SG_BUFFERTYPE_VERTEXBUFFER, mesh->usage, data, size);
+	mesh->instances.element_count = append_count;
+	return offset;
 }
 
 bool cf_mesh_will_overflow_instance_data(CF_Mesh mesh_handle, int append_count)
@@ -726,7 +1393,9 @@ void cf_mesh_update_index_data(CF_Mesh mesh_handle, uint32_t* indices, int count
 	CF_ASSERT(mesh->attribute_count);
 	if (mesh->need_index_sync) {
 		s_sync_index_buffer(mesh, mesh->usage == SG_USAGE_IMMUTABLE ? indices : NULL, size);
-	} else {
+	}
+	// Immutable buffers take their data as they're made, the others are written once they exist.
+	if (mesh->usage != SG_USAGE_IMMUTABLE) {
 		sg_range range = { indices, (size_t)size };
 		sg_update_buffer(mesh->indices.handle, range);
 	}
@@ -737,20 +1406,13 @@ int cf_mesh_append_index_data(CF_Mesh mesh_handle, uint32_t* indices, int append
 {
 	CF_MeshInternal* mesh = (CF_MeshInternal*)mesh_handle.id;
 	int size = append_count * sizeof(uint32_t);
-	CF_ASSERT(mesh->indices.size >= size);
+	CF_ASSERT(mesh->usage != SG_USAGE_IMMUTABLE);
 	if (mesh->need_index_sync) {
 		s_sync_index_buffer(mesh, NULL, mesh->indices.size);
 	}
-	sg_range range = { indices, (size_t)size };
-	if (!sg_query_buffer_will_overflow(mesh->indices.handle, size)) {
-		int offset = sg_append_buffer(mesh->indices.handle, range);
-		mesh->indices.offset = offset;
-		mesh->indices.element_count = append_count;
-		mesh->indices.was_appended = true;
-		return offset;
-	} else {
-		return 0;
-	}
+	int offset = s_append_buffer_data(&mesh->indices, SG_BUFFERTYPE_INDEXBUFFER, mesh->usage, indices, size);
+	mesh->indices.element_count = append_count;
+	return offset;
 }
 
 bool cf_mesh_will_overflow_index_data(CF_Mesh mesh_handle, int append_count)
@@ -759,6 +1421,20 @@ bool cf_mesh_will_overflow_index_data(CF_Mesh mesh_handle, int append_count)
 	return sg_query_buffer_will_overflow(mesh->indices.handle, append_count * sizeof(uint32_t));
 }
 
+CF_MeshStats cf_mesh_query_stats(CF_Mesh mesh_handle)
+{
+	CF_MeshInternal* mesh = (CF_MeshInternal*)mesh_handle.id;
+	CF_MeshStats stats;
+	stats.vertex_capacity = mesh->vertices.size;
+	stats.vertex_high_water = mesh->vertices.high_water;
+	stats.index_capacity = mesh->indices.size;
+	stats.index_high_water = mesh->indices.high_water;
+	stats.instance_capacity = mesh->instances.size;
+	stats.instance_high_water = mesh->instances.high_water;
+	stats.grow_count = mesh->vertices.grow_count + mesh->indices.grow_count + mesh->instances.grow_count;
+	return stats;
+}
+
 CF_RenderState cf_render_state_defaults()
 {
 	CF_RenderState state;
@@ -800,18 +1476,27 @@ struct CF_UniformInfo
 	int array_length;
 	void* data;
 	int size;
+	int slot;
+	int offset;
 };
 
 struct CF_MaterialTex
 {
 	const char* name;
 	CF_Texture handle;
+	int slot;
 };
 
+// Uniform blocks are kept assembled between draws. Each block gets a fresh version from
+// `s_uniform_version` whenever its contents change, so a block is only re-uploaded when
+// the canvas hasn't already seen that exact version.
 struct CF_MaterialState
 {
 	Array<CF_UniformInfo> uniforms;
 	Array<CF_MaterialTex> textures;
+	void* blocks[SG_MAX_SHADERSTAGE_UBS];
+	int block_sizes[SG_MAX_SHADERSTAGE_UBS];
+	uint64_t block_versions[SG_MAX_SHADERSTAGE_UBS];
 };
 
 struct CF_MaterialInternal
@@ -821,14 +1506,23 @@ struct CF_MaterialInternal
 	CF_MaterialState fs;
 	CF_Arena uniform_arena;
 	CF_Arena block_arena;
+	// Slots, offsets and blocks above were resolved against this shader, unless `layout_dirty` is set.
+	CF_ShaderInternal* resolved_shader;
+	bool layout_dirty;
 };
 
+static uint64_t s_uniform_version = 0;
+
 CF_Material cf_make_material()
 {
 	CF_MaterialInternal* material = CF_NEW(CF_MaterialInternal);
 	cf_arena_init(&material->uniform_arena, 4, 1024);
 	cf_arena_init(&material->block_arena, 4, 1024);
 	material->state = cf_render_state_defaults();
+	material->resolved_shader = NULL;
+	material->layout_dirty = true;
+	CF_MEMSET(material->vs.blocks, 0, sizeof(material->vs.blocks));
+	CF_MEMSET(material->fs.blocks, 0, sizeof(material->fs.blocks));
 	CF_Material result = { (uint64_t)material };
 	return result;
 }
@@ -848,7 +1542,7 @@ void cf_material_set_render_state(CF_Material material_handle, CF_RenderState re
 	material->state = render_state;
 }
 
-static void s_material_set_texture(CF_MaterialState* state, const char* name, CF_Texture texture)
+static void s_material_set_texture(CF_MaterialInternal* material, CF_MaterialState* state, const char* name, CF_Texture texture)
 {
 	bool found = false;
 	for (int i = 0; i < state->textures.count(); ++i) {
@@ -862,7 +1556,9 @@ static void s_material_set_texture(CF_MaterialState* state, const char* name, CF
 		CF_MaterialTex tex;
 		tex.name = name;
 		tex.handle = texture;
+		tex.slot = -1;
 		state->textures.add(tex);
+		material->layout_dirty = true;
 	}
 }
 
@@ -870,14 +1566,14 @@ void cf_material_set_texture_vs(CF_Material material_handle, const char* name, C
 {
 	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
 	name = sintern(name);
-	s_material_set_texture(&material->vs, name, texture);
+	s_material_set_texture(material, &material->vs, name, texture);
 }
 
 void cf_material_set_texture_fs(CF_Material material_handle, const char* name, CF_Texture texture)
 {
 	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
 	name = sintern(name);
-	s_material_set_texture(&material->fs, name, texture);
+	s_material_set_texture(material, &material->fs, name, texture);
 }
 
 void cf_material_clear_textures(CF_Material material_handle)
@@ -885,6 +1581,7 @@ void cf_material_clear_textures(CF_Material material_handle)
 	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
 	material->vs.textures.clear();
 	material->fs.textures.clear();
+	material->layout_dirty = true;
 }
 
 static int s_uniform_size(CF_UniformType type)
@@ -901,7 +1598,7 @@ static int s_uniform_size(CF_UniformType type)
 	}
 }
 
-static void s_material_set_uniform(CF_Arena* arena, CF_MaterialState* state, const char* block_name, const char* name, void* data, CF_UniformType type, int array_length)
+static void s_material_set_uniform(CF_MaterialInternal* material, CF_MaterialState* state, const char* block_name, const char* name, void* data, CF_UniformType type, int array_length)
 {
 	if (array_length <= 0) array_length = 1;
 	CF_UniformInfo* uniform = NULL;
@@ -917,14 +1614,27 @@ static void s_material_set_uniform(CF_Arena* arena, CF_MaterialState* state, con
 		uniform = &state->uniforms.add();
 		uniform->block_name = block_name;
 		uniform->name = name;
-		uniform->data = cf_arena_alloc(arena, size);
+		uniform->data = cf_arena_alloc(&material->uniform_arena, size);
 		uniform->size = size;
 		uniform->type = type;
 		uniform->array_length = array_length;
+		uniform->slot = -1;
+		uniform->offset = -1;
+		CF_MEMCPY(uniform->data, data, size);
+		material->layout_dirty = true;
+		return;
 	}
 	CF_ASSERT(uniform->type == type);
 	CF_ASSERT(uniform->array_length == array_length);
+	if (CF_MEMCMP(uniform->data, data, size) == 0) return;
 	CF_MEMCPY(uniform->data, data, size);
+
+	// Patch the assembled block in place, marking it for upload.
+	if (!material->layout_dirty && uniform->offset >= 0) {
+		void* dst = (void*)(((uintptr_t)state->blocks[uniform->slot]) + uniform->offset);
+		CF_MEMCPY(dst, data, size);
+		state->block_versions[uniform->slot] = ++s_uniform_version;
+	}
 }
 
 void cf_material_set_uniform_vs(CF_Material material_handle, const char* block_name, const char* name, void* data, CF_UniformType type, int array_length)
@@ -932,7 +1642,7 @@ void cf_material_set_uniform_vs(CF_Material material_handle, const char* block_n
 	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
 	block_name = sintern(block_name);
 	name = sintern(name);
-	s_material_set_uniform(&material->uniform_arena, &material->vs, block_name, name, data, type, array_length);
+	s_material_set_uniform(material, &material->vs, block_name, name, data, type, array_length);
 }
 
 void cf_material_set_uniform_fs(CF_Material material_handle, const char* block_name, const char* name, void* data, CF_UniformType type, int array_length)
@@ -940,7 +1650,7 @@ void cf_material_set_uniform_fs(CF_Material material_handle, const char* block_n
 	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
 	block_name = sintern(block_name);
 	name = sintern(name);
-	s_material_set_uniform(&material->uniform_arena, &material->fs, block_name, name, data, type, array_length);
+	s_material_set_uniform(material, &material->fs, block_name, name, data, type, array_length);
 }
 
 void cf_material_clear_uniforms(CF_Material material_handle)
@@ -949,6 +1659,28 @@ void cf_material_clear_uniforms(CF_Material material_handle)
 	arena_reset(&material->uniform_arena);
 	material->vs.uniforms.clear();
 	material->fs.uniforms.clear();
+	material->layout_dirty = true;
+}
+
+void cf_material_copy(CF_Material dst_handle, CF_Material src_handle)
+{
+	CF_MaterialInternal* dst = (CF_MaterialInternal*)dst_handle.id;
+	CF_MaterialInternal* src = (CF_MaterialInternal*)src_handle.id;
+	cf_material_clear_textures(dst_handle);
+	cf_material_clear_uniforms(dst_handle);
+	dst->state = src->state;
+	CF_MaterialState* src_states[2] = { &src->vs, &src->fs };
+	CF_MaterialState* dst_states[2] = { &dst->vs, &dst->fs };
+	for (int i = 0; i < 2; ++i) {
+		for (int j = 0; j < src_states[i]->textures.count(); ++j) {
+			CF_MaterialTex tex = src_states[i]->textures[j];
+			s_material_set_texture(dst, dst_states[i], tex.name, tex.handle);
+		}
+		for (int j = 0; j < src_states[i]->uniforms.count(); ++j) {
+			CF_UniformInfo u = src_states[i]->uniforms[j];
+			s_material_set_uniform(dst, dst_states[i], u.block_name, u.name, u.data, u.type, u.array_length);
+		}
+	}
 }
 
 static void s_end_pass()
@@ -995,10 +1727,13 @@ void cf_clear_depth_stencil(float depth, float stencil)
 	s_clear_stencil = stencil;
 }
 
-void cf_apply_canvas(CF_Canvas pass_handle, bool clear)
+static bool s_gpu_timer_begin_frame();
+
+static void s_apply_canvas(CF_Canvas pass_handle, bool clear, bool clear_depth)
 {
 	CF_CanvasInternal* canvas = (CF_CanvasInternal*)pass_handle.id;
 	s_end_pass();
+	s_gpu_timer_begin_frame();
 	s_canvas = canvas;
 	s_canvas_clear_settings(canvas);
 	if (clear) {
@@ -1007,7 +1742,7 @@ void cf_apply_canvas(CF_Canvas pass_handle, bool clear)
 		canvas->action.stencil.load_action = SG_LOADACTION_CLEAR;
 	} else {
 		canvas->action.colors[0].load_action = SG_LOADACTION_LOAD;
-		canvas->action.depth.load_action = SG_LOADACTION_LOAD;
+		canvas->action.depth.load_action = clear_depth ? SG_LOADACTION_CLEAR : SG_LOADACTION_LOAD;
 		canvas->action.stencil.load_action = SG_LOADACTION_LOAD;
 	}
 	if (canvas->pass_is_default) {
@@ -1015,16 +1750,54 @@ void cf_apply_canvas(CF_Canvas pass_handle, bool clear)
 	} else {
 		sg_begin_pass(canvas->pass, &canvas->action);
 	}
+
+	// Beginning a pass resets all applied state.
+	canvas->pip.id = SG_INVALID_ID;
+	CF_MEMSET(canvas->ub_versions, 0, sizeof(canvas->ub_versions));
+	canvas->has_viewport = false;
+	canvas->has_scissor = false;
+}
+
+void cf_apply_canvas(CF_Canvas canvas, bool clear)
+{
+	s_apply_canvas(canvas, clear, false);
+}
+
+void cf_apply_canvas_clear_depth(CF_Canvas canvas, bool clear)
+{
+	s_apply_canvas(canvas, clear, true);
+}
+
+// Returns true if `rect` differs from the cached rect, and updates the cache.
+static bool s_rect_changed(bool* has_rect, int* cached, int x, int y, int w, int h)
+{
+	if (*has_rect && cached[0] == x && cached[1] == y && cached[2] == w && cached[3] == h) {
+		s_render_stats.skipped_applies++;
+		return false;
+	}
+	*has_rect = true;
+	cached[0] = x;
+	cached[1] = y;
+	cached[2] = w;
+	cached[3] = h;
+	s_render_stats.state_changes++;
+	return true;
 }
 
 void cf_apply_viewport(int x, int y, int width, int height)
 {
-	sg_apply_viewport(x, y, width, height, false);
+	CF_ASSERT(s_canvas);
+	if (s_rect_changed(&s_canvas->has_viewport, s_canvas->viewport, x, y, width, height)) {
+		sg_apply_viewport(x, y, width, height, false);
+	}
 }
 
 void cf_apply_scissor(int x, int y, int width, int height)
 {
-	sg_apply_scissor_rect(x, y, width, height, false);
+	CF_ASSERT(s_canvas);
+	if (s_rect_changed(&s_canvas->has_scissor, s_canvas->scissor, x, y, width, height)) {
+		sg_apply_scissor_rect(x, y, width, height, false);
+	}
 }
 
 void cf_apply_mesh(CF_Mesh mesh_handle)
@@ -1034,52 +1807,151 @@ void cf_apply_mesh(CF_Mesh mesh_handle)
 	s_canvas->mesh = mesh;
 }
 
-static void s_copy_uniforms(CF_Arena* arena, CF_SokolShader table, CF_MaterialState* mstate, sg_shader_stage stage)
+static void s_resolve_material_state(CF_Arena* arena, CF_SokolShader table, CF_MaterialState* mstate, sg_shader_stage stage)
 {
+	for (int i = 0; i < mstate->textures.count(); ++i) {
+		mstate->textures[i].slot = table.get_image_slot(stage, mstate->textures[i].name);
+	}
+
 	// Create any required uniform blocks for all uniforms matching between which uniforms
 	// the material has and the shader needs.
-	void* ub_ptrs[SG_MAX_SHADERSTAGE_UBS] = { };
-	int ub_sizes[SG_MAX_SHADERSTAGE_UBS] = { };
+	CF_MEMSET(mstate->blocks, 0, sizeof(mstate->blocks));
 	for (int i = 0; i < mstate->uniforms.count(); ++i) {
-		CF_UniformInfo uniform = mstate->uniforms[i];
-		int slot = table.get_uniformblock_slot(stage, uniform.block_name);
-		if (slot >= 0) {
-			if (!ub_ptrs[slot]) {
-				// Create temporary space for a uniform block.
-				int size = (int)table.get_uniformblock_size(stage, uniform.block_name);
-				void* block = cf_arena_alloc(arena, size);
-				CF_MEMSET(block, 0, size);
-				ub_ptrs[slot] = block;
-				ub_sizes[slot] = size;
-			}
-			// Copy a single matched uniform into the block.
-			int offset = table.get_uniform_offset(stage, uniform.block_name, uniform.name);
-			if (offset >= 0) {
-				void* block = ub_ptrs[slot];
-				void* dst = (void*)(((uintptr_t)block) + offset);
-				CF_MEMCPY(dst, uniform.data, uniform.size);
-			}
+		CF_UniformInfo* uniform = mstate->uniforms + i;
+		uniform->offset = -1;
+		uniform->slot = table.get_uniformblock_slot(stage, uniform->block_name);
+		if (uniform->slot < 0) continue;
+		if (!mstate->blocks[uniform->slot]) {
+			int size = (int)table.get_uniformblock_size(stage, uniform->block_name);
+			void* block = cf_arena_alloc(arena, size);
+			CF_MEMSET(block, 0, size);
+			mstate->blocks[uniform->slot] = block;
+			mstate->block_sizes[uniform->slot] = size;
+			mstate->block_versions[uniform->slot] = ++s_uniform_version;
+		}
+		// Copy a single matched uniform into the block.
+		uniform->offset = table.get_uniform_offset(stage, uniform->block_name, uniform->name);
+		if (uniform->offset >= 0) {
+			void* dst = (void*)(((uintptr_t)mstate->blocks[uniform->slot]) + uniform->offset);
+			CF_MEMCPY(dst, uniform->data, uniform->size);
 		}
 	}
-	// Send each fully constructed uniform block to the GPU.
+}
+
+// Looks up texture slots and uniform offsets by name only when the shader or the set of names changed.
+static void s_resolve_material(CF_MaterialInternal* material, CF_ShaderInternal* shader)
+{
+	if (!material->layout_dirty && material->resolved_shader == shader) return;
+	// Rewind rather than reset to reuse the arena's blocks.
+	CF_ArenaMarker start = { };
+	cf_arena_rewind(&material->block_arena, start);
+	s_resolve_material_state(&material->block_arena, shader->table, &material->vs, SG_SHADERSTAGE_VS);
+	s_resolve_material_state(&material->block_arena, shader->table, &material->fs, SG_SHADERSTAGE_FS);
+	material->resolved_shader = shader;
+	material->layout_dirty = false;
+}
+
+static void s_apply_uniforms(CF_MaterialState* mstate, sg_shader_stage stage)
+{
+	// Send each uniform block to the GPU, skipping blocks unchanged since their last upload in this pass.
 	// Any missing uniforms have been MEMSET to 0.
 	for (int i = 0; i < SG_MAX_SHADERSTAGE_UBS; ++i) {
-		if (ub_ptrs[i]) {
-			sg_range range = { ub_ptrs[i], (size_t)ub_sizes[i] };
+		if (mstate->blocks[i] && s_canvas->ub_versions[stage][i] != mstate->block_versions[i]) {
+			sg_range range = { mstate->blocks[i], (size_t)mstate->block_sizes[i] };
 			sg_apply_uniforms(stage, i, range);
+			s_canvas->ub_versions[stage][i] = mstate->block_versions[i];
+			s_render_stats.uniform_uploads++;
+		} else if (mstate->blocks[i]) {
+			s_render_stats.skipped_uniform_uploads++;
 		}
 	}
-	cf_arena_reset(arena);
 }
 
-void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
+static void s_pipeline_cache_evict_lru()
 {
-	// TODO - LOW PRIORITY - Somehow cache results from all the get_*** callbacks.
+	Map<uint64_t, CF_PipelineCacheEntry>& entries = s_pipeline_cache->entries;
+	int lru = -1;
+	for (int i = 0; i < entries.count(); ++i) {
+		if (lru < 0 || entries.items()[i].last_used_frame < entries.items()[lru].last_used_frame) {
+			lru = i;
+		}
+	}
+	if (lru >= 0) {
+		sg_destroy_pipeline(entries.items()[lru].pip);
+		entries.remove(entries.keys()[lru]);
+		s_pipeline_cache->stats.evictions++;
+	}
+}
 
-	CF_ASSERT(s_canvas);
-	CF_MeshInternal* mesh = s_canvas->mesh;
-	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
-	CF_ShaderInternal* shader = (CF_ShaderInternal*)shader_handle.id;
+static sg_pipeline s_pipeline_cache_get(const sg_pipeline_desc* desc)
+{
+	if (!s_pipeline_cache) {
+		s_pipeline_cache = CF_NEW(CF_PipelineCache);
+	}
+
+	// The desc is fully memset to zero before being filled out, so hashing/comparing the raw bytes
+	// (including padding) is a valid way to identify unique pipelines.
+	uint64_t key = fnv1a(desc, sizeof(*desc));
+	CF_PipelineCacheEntry* entry = s_pipeline_cache->entries.try_find(key);
+	if (entry) {
+		if (!CF_MEMCMP(&entry->desc, desc, sizeof(*desc))) {
+			entry->last_used_frame = s_pipeline_cache->frame;
+			s_pipeline_cache->stats.hits++;
+			return entry->pip;
+		}
+		// Hash collision, just toss out the old pipeline.
+		sg_destroy_pipeline(entry->pip);
+		s_pipeline_cache->entries.remove(key);
+		s_pipeline_cache->stats.evictions++;
+	}
+
+	while (s_pipeline_cache->entries.count() >= s_pipeline_cache->capacity) {
+		s_pipeline_cache_evict_lru();
+	}
+
+	CF_PipelineCacheEntry new_entry;
+	new_entry.desc = *desc;
+	new_entry.pip = sg_make_pipeline(*desc);
+	new_entry.last_used_frame = s_pipeline_cache->frame;
+	s_pipeline_cache->entries.insert(key, new_entry);
+	s_pipeline_cache->stats.misses++;
+	s_pipeline_cache->stats.count = s_pipeline_cache->entries.count();
+	return new_entry.pip;
+}
+
+void cf_set_pipeline_cache_capacity(int capacity)
+{
+	if (!s_pipeline_cache) {
+		s_pipeline_cache = CF_NEW(CF_PipelineCache);
+	}
+	s_pipeline_cache->capacity = max(capacity, 1);
+	while (s_pipeline_cache->entries.count() > s_pipeline_cache->capacity) {
+		s_pipeline_cache_evict_lru();
+	}
+	s_pipeline_cache->stats.count = s_pipeline_cache->entries.count();
+}
+
+CF_PipelineCacheStats cf_query_pipeline_cache_stats()
+{
+	if (!s_pipeline_cache) {
+		CF_PipelineCacheStats stats = { };
+		return stats;
+	}
+	s_pipeline_cache->stats.count = s_pipeline_cache->entries.count();
+	return s_pipeline_cache->stats;
+}
+
+void cf_reset_pipeline_cache_stats()
+{
+	if (!s_pipeline_cache) return;
+	int count = s_pipeline_cache->entries.count();
+	CF_MEMSET(&s_pipeline_cache->stats, 0, sizeof(s_pipeline_cache->stats));
+	s_pipeline_cache->stats.count = count;
+}
+
+// Fills out the pipeline for drawing `mesh` with `shader` and `material` onto a canvas of `color_format`.
+static void s_pipeline_desc(CF_ShaderInternal* shader, CF_MeshInternal* mesh, CF_MaterialInternal* material, sg_pixel_format color_format, sg_pipeline_desc* out)
+{
 	CF_SokolShader table = shader->table;
 
 	// Apply the render state and vertex attributes.
@@ -1103,7 +1975,8 @@ void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
 	}
 
 	// Copy over render state from the material into the pipeline.
-	sg_pipeline_desc desc = { };
+	sg_pipeline_desc& desc = *out;
+	CF_MEMSET(&desc, 0, sizeof(desc));
 	CF_RenderState* state = &material->state;
 	desc.shader = shader->shd;
 	desc.layout = layout;
@@ -1123,6 +1996,7 @@ void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
 	desc.stencil.back.depth_fail_op = s_wrap(state->stencil.back.depth_fail_op);
 	desc.stencil.back.pass_op = s_wrap(state->stencil.back.pass_op);
 	desc.color_count = 1;
+	desc.colors[0].pixel_format = color_format;
 	int mask_r = (int)state->blend.write_R_enabled << 0;
 	int mask_g = (int)state->blend.write_R_enabled << 1;
 	int mask_b = (int)state->blend.write_R_enabled << 2;
@@ -1137,11 +2011,37 @@ void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
 	desc.colors[0].blend.op_alpha = s_wrap(state->blend.alpha_op);
 	if (mesh->indices.size > 0) desc.index_type = SG_INDEXTYPE_UINT32;
 	desc.cull_mode = s_wrap(state->cull_mode);
+}
 
-	// Apply the pipeline.
-	sg_pipeline pip = sg_make_pipeline(desc);
-	sg_apply_pipeline(pip);
-	s_canvas->pip = pip;
+void cf_prewarm_pipeline(CF_Canvas canvas_handle, CF_Mesh mesh_handle, CF_Shader shader_handle, CF_Material material_handle)
+{
+	CF_CanvasInternal* canvas = (CF_CanvasInternal*)canvas_handle.id;
+	sg_pipeline_desc desc;
+	s_pipeline_desc((CF_ShaderInternal*)shader_handle.id, (CF_MeshInternal*)mesh_handle.id, (CF_MaterialInternal*)material_handle.id, canvas->color_format, &desc);
+	s_pipeline_cache_get(&desc);
+}
+
+void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
+{
+	CF_ASSERT(s_canvas);
+	CF_MeshInternal* mesh = s_canvas->mesh;
+	CF_MaterialInternal* material = (CF_MaterialInternal*)material_handle.id;
+	CF_ShaderInternal* shader = (CF_ShaderInternal*)shader_handle.id;
+	sg_pipeline_desc desc;
+	s_pipeline_desc(shader, mesh, material, s_canvas->color_format, &desc);
+
+	// Apply the pipeline, reusing a cached one if this exact configuration has been seen before.
+	// Consecutive draws with matching state within a pass skip the redundant apply.
+	sg_pipeline pip = s_pipeline_cache_get(&desc);
+	if (pip.id != s_canvas->pip.id) {
+		sg_apply_pipeline(pip);
+		s_canvas->pip = pip;
+		// Uniforms must be re-sent after switching pipelines.
+		CF_MEMSET(s_canvas->ub_versions, 0, sizeof(s_canvas->ub_versions));
+		s_render_stats.state_changes++;
+	} else {
+		s_render_stats.skipped_applies++;
+	}
 
 	// Align all buffers, and setup any matched texture names from the material to
 	// the shader's expected textures.
@@ -1152,14 +2052,15 @@ void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
 	bind.vertex_buffer_offsets[CF_INSTANCE_BUFFER_SLOT] = mesh->instances.offset;
 	bind.index_buffer = mesh->indices.handle;
 	bind.index_buffer_offset = mesh->indices.offset;
+	s_resolve_material(material, shader);
 	for (int i = 0; i < material->vs.textures.count(); ++i) {
-		int slot = table.get_image_slot(SG_SHADERSTAGE_VS, material->vs.textures[i].name);
+		int slot = material->vs.textures[i].slot;
 		if (slot >= 0) {
 			bind.vs_images[slot].id = (uint32_t)material->vs.textures[i].handle.id;
 		}
 	}
 	for (int i = 0; i < material->fs.textures.count(); ++i) {
-		int slot = table.get_image_slot(SG_SHADERSTAGE_FS, material->fs.textures[i].name);
+		int slot = material->fs.textures[i].slot;
 		if (slot >= 0) {
 			bind.fs_images[slot].id = (uint32_t)material->fs.textures[i].handle.id;
 		}
@@ -1167,16 +2068,19 @@ void cf_apply_shader(CF_Shader shader_handle, CF_Material material_handle)
 	sg_apply_bindings(bind);
 
 	// Copy over uniform data.
-	s_copy_uniforms(&material->block_arena, table, &material->vs, SG_SHADERSTAGE_VS);
-	s_copy_uniforms(&material->block_arena, table, &material->fs, SG_SHADERSTAGE_FS);
+	s_apply_uniforms(&material->vs, SG_SHADERSTAGE_VS);
+	s_apply_uniforms(&material->fs, SG_SHADERSTAGE_FS);
 }
 
 void cf_draw_elements()
 {
 	CF_MeshInternal* mesh = s_canvas->mesh;
-	sg_draw(0, mesh->vertices.element_count, mesh->instances.element_count + 1); // TODO - +1??
-	sg_destroy_pipeline(s_canvas->pip);
+	// Indexed meshes draw by index count, and meshes without an instance buffer still draw a single instance.
+	int element_count = mesh->indices.size > 0 ? mesh->indices.element_count : mesh->vertices.element_count;
+	int instance_count = mesh->instances.size > 0 ? mesh->instances.element_count : 1;
+	sg_draw(0, element_count, instance_count);
 	app->draw_call_count++;
+	s_render_stats.draw_calls++;
 }
 
 void cf_unapply_canvas()
@@ -1185,10 +2089,608 @@ void cf_unapply_canvas()
 	s_canvas = NULL;
 }
 
+//--------------------------------------------------------------------------------------------------
+// GPU timers.
+
+struct CF_GpuTimerScope
+{
+	const char* label;
+	int depth;
+	int begin;
+	int end;
+};
+
+struct CF_GpuTimerFrame
+{
+	bool pending = false;
+	uint64_t frame = 0;
+	int timestamp_count = 0;
+	Array<CF_GpuTimerScope> scopes;
+};
+
+struct CF_GpuTimer
+{
+	bool supported = false;
+	bool enabled = false;
+	bool enable_requested = false;
+	bool in_frame = false;
+	bool skip_frame = false;
+	int slot = 0;
+	Array<int> stack;
+	CF_GpuTimerFrame frames[CF_GPU_TIMER_FRAME_COUNT];
+	Array<CF_GpuTiming> results;
+	uint64_t results_frame = 0;
+};
+
+static CF_GpuTimer* s_gpu_timer = NULL;
+
+#ifdef SOKOL_GLCORE33
+
+// Timer queries are core in GL 3.3, but sokol doesn't load them, so fetch them ourselves.
+#define CF_GL_TIMESTAMP 0x8E28
+#define CF_GL_QUERY_RESULT 0x8866
+#define CF_GL_QUERY_RESULT_AVAILABLE 0x8867
+
+static struct
+{
+	void (*GenQueries)(int n, unsigned* ids);
+	void (*DeleteQueries)(int n, const unsigned* ids);
+	void (*QueryCounter)(unsigned id, unsigned target);
+	void (*GetQueryObjectiv)(unsigned id, unsigned pname, int* params);
+	void (*GetQueryObjectui64v)(unsigned id, unsigned pname, uint64_t* params);
+	unsigned queries[CF_GPU_TIMER_FRAME_COUNT][CF_GPU_TIMER_MAX_TIMESTAMPS];
+} s_gl_timer;
+
+static bool s_gl_timestamps_init()
+{
+	if (!app->use_gl) return false;
+	*(void**)&s_gl_timer.GenQueries = SDL_GL_GetProcAddress("glGenQueries");
+	*(void**)&s_gl_timer.DeleteQueries = SDL_GL_GetProcAddress("glDeleteQueries");
+	*(void**)&s_gl_timer.QueryCounter = SDL_GL_GetProcAddress("glQueryCounter");
+	*(void**)&s_gl_timer.GetQueryObjectiv = SDL_GL_GetProcAddress("glGetQueryObjectiv");
+	*(void**)&s_gl_timer.GetQueryObjectui64v = SDL_GL_GetProcAddress("glGetQueryObjectui64v");
+	if (!s_gl_timer.GenQueries || !s_gl_timer.DeleteQueries || !s_gl_timer.QueryCounter || !s_gl_timer.GetQueryObjectiv || !s_gl_timer.GetQueryObjectui64v) {
+		return false;
+	}
+	s_gl_timer.GenQueries(CF_GPU_TIMER_FRAME_COUNT * CF_GPU_TIMER_MAX_TIMESTAMPS, &s_gl_timer.queries[0][0]);
+	return true;
+}
+
+static int s_gl_timestamps_resolve(int slot, int count, uint64_t* ns)
+{
+	for (int i = 0; i < count; ++i) {
+		int available = 0;
+		s_gl_timer.GetQueryObjectiv(s_gl_timer.queries[slot][i], CF_GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) return 0;
+		s_gl_timer.GetQueryObjectui64v(s_gl_timer.queries[slot][i], CF_GL_QUERY_RESULT, ns + i);
+	}
+	return 1;
+}
+
+#endif // SOKOL_GLCORE33
+
+// Thin dispatch over the backends that support timestamp queries. Metal and GLES3 report
+// as unsupported -- sokol owns the Metal command buffers and GLES3 has no timer queries.
+
+static bool s_timestamps_init()
+{
+#if defined(SOKOL_D3D11)
+	return cf_dx11_timestamps_init();
+#elif defined(SOKOL_GLCORE33)
+	return s_gl_timestamps_init();
+#else
+	return false;
+#endif
+}
+
+static void s_timestamps_begin_frame(int slot)
+{
+#if defined(SOKOL_D3D11)
+	cf_dx11_timestamps_begin_frame(slot);
+#else
+	CF_UNUSED(slot);
+#endif
+}
+
+static void s_timestamp(int slot, int index)
+{
+#if defined(SOKOL_D3D11)
+	cf_dx11_timestamp(slot, index);
+#elif defined(SOKOL_GLCORE33)
+	s_gl_timer.QueryCounter(s_gl_timer.queries[slot][index], CF_GL_TIMESTAMP);
+#else
+	CF_UNUSED(slot);
+	CF_UNUSED(index);
+#endif
+}
+
+static void s_timestamps_end_frame(int slot)
+{
+#if defined(SOKOL_D3D11)
+	cf_dx11_timestamps_end_frame(slot);
+#else
+	CF_UNUSED(slot);
+#endif
+}
+
+static int s_timestamps_resolve(int slot, int count, uint64_t* ns)
+{
+#if defined(SOKOL_D3D11)
+	return cf_dx11_timestamps_resolve(slot, count, ns);
+#elif defined(SOKOL_GLCORE33)
+	return s_gl_timestamps_resolve(slot, count, ns);
+#else
+	CF_UNUSED(slot);
+	CF_UNUSED(count);
+	CF_UNUSED(ns);
+	return -1;
+#endif
+}
+
+static void s_timestamps_shutdown()
+{
+#if defined(SOKOL_D3D11)
+	cf_dx11_timestamps_shutdown();
+#elif defined(SOKOL_GLCORE33)
+	if (s_gl_timer.DeleteQueries) {
+		s_gl_timer.DeleteQueries(CF_GPU_TIMER_FRAME_COUNT * CF_GPU_TIMER_MAX_TIMESTAMPS, &s_gl_timer.queries[0][0]);
+	}
+	CF_MEMSET(&s_gl_timer, 0, sizeof(s_gl_timer));
+#endif
+}
+
+static CF_GpuTimer* s_get_gpu_timer()
+{
+	if (!s_gpu_timer) {
+		s_gpu_timer = CF_NEW(CF_GpuTimer);
+		s_gpu_timer->supported = s_timestamps_init();
+	}
+	return s_gpu_timer;
+}
+
+static int s_gpu_timer_open_scope(const char* label)
+{
+	CF_GpuTimerFrame* frame = s_gpu_timer->frames + s_gpu_timer->slot;
+	// Keep room to close every open scope when the frame ends.
+	if (frame->timestamp_count + s_gpu_timer->stack.count() + 2 > CF_GPU_TIMER_MAX_TIMESTAMPS) {
+		return -1;
+	}
+	CF_GpuTimerScope scope;
+	scope.label = label;
+	scope.depth = s_gpu_timer->stack.count();
+	scope.begin = frame->timestamp_count++;
+	scope.end = -1;
+	s_timestamp(s_gpu_timer->slot, scope.begin);
+	frame->scopes.add(scope);
+	return frame->scopes.count() - 1;
+}
+
+static void s_gpu_timer_close_scope()
+{
+	int index = s_gpu_timer->stack.pop();
+	if (index < 0) return;
+	CF_GpuTimerFrame* frame = s_gpu_timer->frames + s_gpu_timer->slot;
+	frame->scopes[index].end = frame->timestamp_count++;
+	s_timestamp(s_gpu_timer->slot, frame->scopes[index].end);
+}
+
+// Returns true if the current frame records timestamps, lazily starting it on first use.
+static bool s_gpu_timer_begin_frame()
+{
+	if (!s_gpu_timer || !s_gpu_timer->enabled) return false;
+	if (s_gpu_timer->in_frame) return true;
+	if (s_gpu_timer->skip_frame) return false;
+	CF_GpuTimerFrame* frame = s_gpu_timer->frames + s_gpu_timer->slot;
+	if (frame->pending) {
+		// The GPU is more than `CF_GPU_TIMER_FRAME_COUNT` frames behind, so this slot's queries
+		// are still in flight. Drop timing for this frame instead of stalling on them.
+		s_gpu_timer->skip_frame = true;
+		return false;
+	}
+	frame->scopes.clear();
+	frame->timestamp_count = 0;
+	s_timestamps_begin_frame(s_gpu_timer->slot);
+	s_gpu_timer->in_frame = true;
+	s_gpu_timer->stack.add(s_gpu_timer_open_scope(sintern("frame")));
+	return true;
+}
+
+static void s_gpu_timer_resolve(CF_GpuTimerFrame* frame, int slot)
+{
+	uint64_t* ns = (uint64_t*)CF_ALLOC(sizeof(uint64_t) * frame->timestamp_count);
+	int result = s_timestamps_resolve(slot, frame->timestamp_count, ns);
+	if (result != 0) {
+		frame->pending = false;
+		if (result > 0) {
+			s_gpu_timer->results.clear();
+			for (int i = 0; i < frame->scopes.count(); ++i) {
+				CF_GpuTimerScope scope = frame->scopes[i];
+				CF_GpuTiming timing;
+				timing.label = scope.label;
+				timing.depth = scope.depth;
+				timing.milliseconds = ns[scope.end] > ns[scope.begin] ? (float)((double)(ns[scope.end] - ns[scope.begin]) * 1.0e-6) : 0;
+				s_gpu_timer->results.add(timing);
+			}
+			s_gpu_timer->results_frame = frame->frame;
+		}
+	}
+	CF_FREE(ns);
+}
+
+static void s_gpu_timer_end_frame()
+{
+	if (!s_gpu_timer) return;
+	if (s_gpu_timer->in_frame) {
+		while (s_gpu_timer->stack.count()) {
+			s_gpu_timer_close_scope();
+		}
+		s_timestamps_end_frame(s_gpu_timer->slot);
+		CF_GpuTimerFrame* frame = s_gpu_timer->frames + s_gpu_timer->slot;
+		frame->pending = true;
+		frame->frame = s_frame;
+		s_gpu_timer->slot = (s_gpu_timer->slot + 1) % CF_GPU_TIMER_FRAME_COUNT;
+		s_gpu_timer->in_frame = false;
+	}
+	s_gpu_timer->skip_frame = false;
+
+	// Resolve finished frames oldest first, stopping at the first one the GPU hasn't reached yet.
+	// The current slot is the oldest in the ring.
+	for (int i = 0; i < CF_GPU_TIMER_FRAME_COUNT; ++i) {
+		int slot = (s_gpu_timer->slot + i) % CF_GPU_TIMER_FRAME_COUNT;
+		CF_GpuTimerFrame* frame = s_gpu_timer->frames + slot;
+		if (!frame->pending) continue;
+		s_gpu_timer_resolve(frame, slot);
+		if (frame->pending) break;
+	}
+
+	// Toggling takes effect on frame boundaries to keep scopes balanced.
+	s_gpu_timer->enabled = s_gpu_timer->enable_requested && s_gpu_timer->supported;
+}
+
+void cf_gpu_timing_enable(bool enable)
+{
+	s_get_gpu_timer()->enable_requested = enable;
+}
+
+bool cf_gpu_timing_supported()
+{
+	return s_get_gpu_timer()->supported;
+}
+
+void cf_gpu_timer_push(const char* label)
+{
+	if (!s_gpu_timer_begin_frame()) return;
+	s_gpu_timer->stack.add(s_gpu_timer_open_scope(sintern(label)));
+}
+
+void cf_gpu_timer_pop()
+{
+	if (!s_gpu_timer || !s_gpu_timer->in_frame) return;
+	// The root "frame" scope is closed by `cf_app_draw_onto_screen`.
+	if (s_gpu_timer->stack.count() <= 1) return;
+	s_gpu_timer_close_scope();
+}
+
+CF_GpuTimings cf_query_gpu_timings()
+{
+	CF_GpuTimings timings = { };
+	if (s_gpu_timer) {
+		timings.count = s_gpu_timer->results.count();
+		timings.timings = s_gpu_timer->results.data();
+		timings.frame = s_gpu_timer->results_frame;
+	}
+	return timings;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Canvas readback.
+
+struct CF_ReadbackInternal
+{
+	sg_image image = { };
+	int canvas_h = 0;
+	int x = 0, y = 0, w = 0, h = 0;
+	bool swap_red_blue = false;
+	bool issued = false;
+	bool ready = false;
+	CF_Pixel* pixels = NULL;
+	void* staging = NULL; // D3D11 staging texture or Metal buffer.
+	unsigned pbo = 0;     // GL pixel buffer and its fence.
+	void* sync = NULL;
+};
+
+static Array<CF_ReadbackInternal*> s_readbacks;
+
+#ifdef SOKOL_GLCORE33
+
+// Pixel buffers and fences are core in GL 3.3, but like the timer queries sokol doesn't load them.
+#define CF_GL_TEXTURE_2D 0x0DE1
+#define CF_GL_UNSIGNED_BYTE 0x1401
+#define CF_GL_RGBA 0x1908
+#define CF_GL_STREAM_READ 0x88E1
+#define CF_GL_PIXEL_PACK_BUFFER 0x88EB
+#define CF_GL_READ_FRAMEBUFFER 0x8CA8
+#define CF_GL_READ_FRAMEBUFFER_BINDING 0x8CAA
+#define CF_GL_COLOR_ATTACHMENT0 0x8CE0
+#define CF_GL_MAP_READ_BIT 0x0001
+#define CF_GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define CF_GL_SYNC_FLUSH_COMMANDS_BIT 0x0001
+#define CF_GL_ALREADY_SIGNALED 0x911A
+#define CF_GL_CONDITION_SATISFIED 0x911C
+#define CF_GL_WAIT_FAILED 0x911D
+
+static struct
+{
+	bool initialized;
+	bool supported;
+	unsigned fbo;
+	void (*GenBuffers)(int n, unsigned* ids);
+	void (*DeleteBuffers)(int n, const unsigned* ids);
+	void (*BindBuffer)(unsigned target, unsigned id);
+	void (*BufferData)(unsigned target, ptrdiff_t size, const void* data, unsigned usage);
+	void* (*MapBufferRange)(unsigned target, ptrdiff_t offset, ptrdiff_t length, unsigned access);
+	unsigned char (*UnmapBuffer)(unsigned target);
+	void (*GenFramebuffers)(int n, unsigned* ids);
+	void (*DeleteFramebuffers)(int n, const unsigned* ids);
+	void (*BindFramebuffer)(unsigned target, unsigned id);
+	void (*FramebufferTexture2D)(unsigned target, unsigned attachment, unsigned textarget, unsigned texture, int level);
+	void (*ReadPixels)(int x, int y, int w, int h, unsigned format, unsigned type, void* pixels);
+	void (*GetIntegerv)(unsigned pname, int* data);
+	void* (*FenceSync)(unsigned condition, unsigned flags);
+	unsigned (*ClientWaitSync)(void* sync, unsigned flags, uint64_t timeout);
+	void (*DeleteSync)(void* sync);
+} s_gl_readback;
+
+static bool s_gl_readback_init()
+{
+	if (s_gl_readback.initialized) return s_gl_readback.supported;
+	s_gl_readback.initialized = true;
+	if (!app->use_gl) return false;
+	*(void**)&s_gl_readback.GenBuffers = SDL_GL_GetProcAddress("glGenBuffers");
+	*(void**)&s_gl_readback.DeleteBuffers = SDL_GL_GetProcAddress("glDeleteBuffers");
+	*(void**)&s_gl_readback.BindBuffer = SDL_GL_GetProcAddress("glBindBuffer");
+	*(void**)&s_gl_readback.BufferData = SDL_GL_GetProcAddress("glBufferData");
+	*(void**)&s_gl_readback.MapBufferRange = SDL_GL_GetProcAddress("glMapBufferRange");
+	*(void**)&s_gl_readback.UnmapBuffer = SDL_GL_GetProcAddress("glUnmapBuffer");
+	*(void**)&s_gl_readback.GenFramebuffers = SDL_GL_GetProcAddress("glGenFramebuffers");
+	*(void**)&s_gl_readback.DeleteFramebuffers = SDL_GL_GetProcAddress("glDeleteFramebuffers");
+	*(void**)&s_gl_readback.BindFramebuffer = SDL_GL_GetProcAddress("glBindFramebuffer");
+	*(void**)&s_gl_readback.FramebufferTexture2D = SDL_GL_GetProcAddress("glFramebufferTexture2D");
+	*(void**)&s_gl_readback.ReadPixels = SDL_GL_GetProcAddress("glReadPixels");
+	*(void**)&s_gl_readback.GetIntegerv = SDL_GL_GetProcAddress("glGetIntegerv");
+	*(void**)&s_gl_readback.FenceSync = SDL_GL_GetProcAddress("glFenceSync");
+	*(void**)&s_gl_readback.ClientWaitSync = SDL_GL_GetProcAddress("glClientWaitSync");
+	*(void**)&s_gl_readback.DeleteSync = SDL_GL_GetProcAddress("glDeleteSync");
+	if (!s_gl_readback.GenBuffers || !s_gl_readback.DeleteBuffers || !s_gl_readback.BindBuffer || !s_gl_readback.BufferData
+		|| !s_gl_readback.MapBufferRange || !s_gl_readback.UnmapBuffer || !s_gl_readback.GenFramebuffers || !s_gl_readback.DeleteFramebuffers
+		|| !s_gl_readback.BindFramebuffer || !s_gl_readback.FramebufferTexture2D || !s_gl_readback.ReadPixels || !s_gl_readback.GetIntegerv
+		|| !s_gl_readback.FenceSync || !s_gl_readback.ClientWaitSync || !s_gl_readback.DeleteSync) {
+		return false;
+	}
+	s_gl_readback.GenFramebuffers(1, &s_gl_readback.fbo);
+	s_gl_readback.supported = true;
+	return true;
+}
+
+static bool s_gl_readback_begin(CF_ReadbackInternal* readback)
+{
+	if (!s_gl_readback_init()) return false;
+	unsigned texture = (unsigned)(uintptr_t)cf_sg_image_native_texture(readback->image);
+	if (!texture) return false;
+	int prev_fbo = 0;
+	s_gl_readback.GetIntegerv(CF_GL_READ_FRAMEBUFFER_BINDING, &prev_fbo);
+	s_gl_readback.BindFramebuffer(CF_GL_READ_FRAMEBUFFER, s_gl_readback.fbo);
+	s_gl_readback.FramebufferTexture2D(CF_GL_READ_FRAMEBUFFER, CF_GL_COLOR_ATTACHMENT0, CF_GL_TEXTURE_2D, texture, 0);
+	s_gl_readback.GenBuffers(1, &readback->pbo);
+	s_gl_readback.BindBuffer(CF_GL_PIXEL_PACK_BUFFER, readback->pbo);
+	s_gl_readback.BufferData(CF_GL_PIXEL_PACK_BUFFER, readback->w * readback->h * 4, NULL, CF_GL_STREAM_READ);
+	// Reading into a bound pixel buffer returns right away. GL stores rows bottom first.
+	s_gl_readback.ReadPixels(readback->x, readback->canvas_h - readback->y - readback->h, readback->w, readback->h, CF_GL_RGBA, CF_GL_UNSIGNED_BYTE, NULL);
+	s_gl_readback.BindBuffer(CF_GL_PIXEL_PACK_BUFFER, 0);
+	s_gl_readback.BindFramebuffer(CF_GL_READ_FRAMEBUFFER, (unsigned)prev_fbo);
+	readback->sync = s_gl_readback.FenceSync(CF_GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	return true;
+}
+
+static int s_gl_readback_resolve(CF_ReadbackInternal* readback)
+{
+	// A zero timeout only polls the fence.
+	unsigned status = s_gl_readback.ClientWaitSync(readback->sync, CF_GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+	if (status == CF_GL_WAIT_FAILED) return -1;
+	if (status != CF_GL_ALREADY_SIGNALED && status != CF_GL_CONDITION_SATISFIED) return 0;
+	int pitch = readback->w * 4;
+	s_gl_readback.BindBuffer(CF_GL_PIXEL_PACK_BUFFER, readback->pbo);
+	uint8_t* data = (uint8_t*)s_gl_readback.MapBufferRange(CF_GL_PIXEL_PACK_BUFFER, 0, pitch * readback->h, CF_GL_MAP_READ_BIT);
+	if (data) {
+		for (int i = 0; i < readback->h; ++i) {
+			CF_MEMCPY((uint8_t*)readback->pixels + i * pitch, data + (readback->h - 1 - i) * pitch, pitch);
+		}
+		s_gl_readback.UnmapBuffer(CF_GL_PIXEL_PACK_BUFFER);
+	}
+	s_gl_readback.BindBuffer(CF_GL_PIXEL_PACK_BUFFER, 0);
+	return data ? 1 : -1;
+}
+
+static void s_gl_readback_release(CF_ReadbackInternal* readback)
+{
+	if (readback->sync) s_gl_readback.DeleteSync(readback->sync);
+	if (readback->pbo) s_gl_readback.DeleteBuffers(1, &readback->pbo);
+}
+
+#endif // SOKOL_GLCORE33
+
+// Thin dispatch over the backends, like the timestamps above. GL reads pixels as RGBA and flips
+// rows itself, the others copy the canvas's own format top row first.
+
+static bool s_readback_supported(sg_pixel_format format)
+{
+#if defined(SOKOL_D3D11) || defined(SOKOL_METAL) || defined(SOKOL_GLCORE33)
+	return format == SG_PIXELFORMAT_RGBA8 || format == SG_PIXELFORMAT_BGRA8;
+#else
+	CF_UNUSED(format);
+	return false;
+#endif
+}
+
+static bool s_readback_begin(CF_ReadbackInternal* readback)
+{
+#if defined(SOKOL_D3D11)
+	readback->staging = cf_dx11_readback_begin(cf_sg_image_native_texture(readback->image), readback->x, readback->y, readback->w, readback->h);
+	return readback->staging != NULL;
+#elif defined(SOKOL_METAL)
+	readback->staging = cf_metal_readback_begin(readback->image, readback->x, readback->y, readback->w, readback->h);
+	return readback->staging != NULL;
+#elif defined(SOKOL_GLCORE33)
+	readback->swap_red_blue = false;
+	return s_gl_readback_begin(readback);
+#else
+	CF_UNUSED(readback);
+	return false;
+#endif
+}
+
+static int s_readback_resolve(CF_ReadbackInternal* readback)
+{
+#if defined(SOKOL_D3D11)
+	return cf_dx11_readback_resolve(readback->staging, readback->w, readback->h, readback->pixels);
+#elif defined(SOKOL_METAL)
+	return cf_metal_readback_resolve(readback->staging, readback->w, readback->h, readback->pixels);
+#elif defined(SOKOL_GLCORE33)
+	return s_gl_readback_resolve(readback);
+#else
+	CF_UNUSED(readback);
+	return -1;
+#endif
+}
+
+static void s_readback_release(CF_ReadbackInternal* readback)
+{
+#if defined(SOKOL_D3D11)
+	if (readback->staging) cf_dx11_readback_release(readback->staging);
+#elif defined(SOKOL_METAL)
+	if (readback->staging) cf_metal_readback_release(readback->staging);
+#elif defined(SOKOL_GLCORE33)
+	s_gl_readback_release(readback);
+#endif
+	readback->staging = NULL;
+	readback->pbo = 0;
+	readback->sync = NULL;
+}
+
+// Called right after `sg_commit`, so copies see the finished frame and Metal's copies are queued
+// behind it. Never waits on the GPU.
+static void s_readbacks_update()
+{
+	for (int i = 0; i < s_readbacks.count();) {
+		CF_ReadbackInternal* readback = s_readbacks[i];
+		if (!readback->issued) {
+			readback->issued = true;
+			if (!s_readback_begin(readback)) {
+				// Nothing will ever arrive, so hand back an empty image rather than waiting forever.
+				s_readback_release(readback);
+				CF_MEMSET(readback->pixels, 0, sizeof(CF_Pixel) * readback->w * readback->h);
+				readback->ready = true;
+				s_readbacks.unordered_remove(i);
+				continue;
+			}
+			++i;
+			continue;
+		}
+		int result = s_readback_resolve(readback);
+		if (result == 0) {
+			++i;
+			continue;
+		}
+		if (result < 0) {
+			CF_MEMSET(readback->pixels, 0, sizeof(CF_Pixel) * readback->w * readback->h);
+		} else if (readback->swap_red_blue) {
+			for (int j = 0; j < readback->w * readback->h; ++j) {
+				CF_Pixel p = readback->pixels[j];
+				readback->pixels[j].colors.r = p.colors.b;
+				readback->pixels[j].colors.b = p.colors.r;
+			}
+		}
+		s_readback_release(readback);
+		readback->ready = true;
+		s_readbacks.unordered_remove(i);
+	}
+}
+
+CF_Readback cf_canvas_readback_async(CF_Canvas canvas_handle, CF_Rect rect)
+{
+	CF_CanvasInternal* canvas = (CF_CanvasInternal*)canvas_handle.id;
+	CF_Readback result = { 0 };
+	if (!canvas || !s_readback_supported(canvas->color_format)) return result;
+	sg_image_desc desc = sg_query_image_desc(canvas->texture);
+	int x0 = max(rect.x, 0);
+	int y0 = max(rect.y, 0);
+	int x1 = min(rect.x + rect.w, desc.width);
+	int y1 = min(rect.y + rect.h, desc.height);
+	if (x0 >= x1 || y0 >= y1) return result;
+
+	CF_ReadbackInternal* readback = CF_NEW(CF_ReadbackInternal);
+	readback->image = canvas->texture;
+	readback->canvas_h = desc.height;
+	readback->x = x0;
+	readback->y = y0;
+	readback->w = x1 - x0;
+	readback->h = y1 - y0;
+	readback->swap_red_blue = canvas->color_format == SG_PIXELFORMAT_BGRA8;
+	readback->pixels = (CF_Pixel*)CF_ALLOC(sizeof(CF_Pixel) * readback->w * readback->h);
+	s_readbacks.add(readback);
+	result.id = (uint64_t)readback;
+	return result;
+}
+
+bool cf_readback_ready(CF_Readback readback_handle)
+{
+	CF_ReadbackInternal* readback = (CF_ReadbackInternal*)readback_handle.id;
+	return readback && readback->ready;
+}
+
+const CF_Pixel* cf_readback_pixels(CF_Readback readback_handle, int* w, int* h)
+{
+	CF_ReadbackInternal* readback = (CF_ReadbackInternal*)readback_handle.id;
+	if (!readback || !readback->ready) return NULL;
+	if (w) *w = readback->w;
+	if (h) *h = readback->h;
+	return readback->pixels;
+}
+
+void cf_destroy_readback(CF_Readback readback_handle)
+{
+	CF_ReadbackInternal* readback = (CF_ReadbackInternal*)readback_handle.id;
+	if (!readback) return;
+	for (int i = 0; i < s_readbacks.count(); ++i) {
+		if (s_readbacks[i] == readback) {
+			s_readbacks.unordered_remove(i);
+			break;
+		}
+	}
+	s_readback_release(readback);
+	CF_FREE(readback->pixels);
+	readback->~CF_ReadbackInternal();
+	CF_FREE(readback);
+}
+
 void cf_commit()
 {
 	s_end_pass();
+	s_gpu_timer_end_frame();
 	sg_commit();
+	s_readbacks_update();
+	s_uploads_update(false);
+	if (s_pipeline_cache) s_pipeline_cache->frame++;
+	s_frame++;
+	s_destroy_retired_buffers(false);
+	s_recycle_transient_canvases(false);
+	s_last_render_stats = s_render_stats;
+	s_render_stats = { };
+}
+
+CF_RenderStats cf_query_render_stats()
+{
+	return s_last_render_stats;
 }
 
 void cf_clear_graphics_static_pointers()
@@ -1205,6 +2707,43 @@ void cf_clear_graphics_static_pointers()
 
 void cf_destroy_graphics()
 {
+	s_destroy_retired_buffers(true);
+	s_recycle_transient_canvases(true);
+	s_transient_canvases.clear();
+	while (s_readbacks.count()) {
+		// Pending readbacks are freed here, but their handles are left to the user.
+		s_readback_release(s_readbacks.last());
+		s_readbacks.pop();
+	}
+	s_uploads_lock_acquire();
+	while (s_uploads.count()) {
+		// Staged uploads are dropped here, and marked ready with no texture. Their handles are left to the user.
+		CF_TextureUploadInternal* upload = s_uploads.pop();
+		CF_FREE(upload->data);
+		upload->data = NULL;
+		upload->image.id = 0;
+		upload->ready = true;
+	}
+	s_uploads_lock_release();
+	s_uploads_touched.clear();
+#ifdef SOKOL_GLCORE33
+	if (s_gl_readback.fbo) s_gl_readback.DeleteFramebuffers(1, &s_gl_readback.fbo);
+	CF_MEMSET(&s_gl_readback, 0, sizeof(s_gl_readback));
+#endif
+	if (s_gpu_timer) {
+		s_timestamps_shutdown();
+		s_gpu_timer->~CF_GpuTimer();
+		CF_FREE(s_gpu_timer);
+		s_gpu_timer = NULL;
+	}
+	if (s_pipeline_cache) {
+		for (int i = 0; i < s_pipeline_cache->entries.count(); ++i) {
+			sg_destroy_pipeline(s_pipeline_cache->entries.items()[i].pip);
+		}
+		s_pipeline_cache->~CF_PipelineCache();
+		CF_FREE(s_pipeline_cache);
+		s_pipeline_cache = NULL;
+	}
 	if (s_default_canvas) {
 		cf_destroy_canvas({ (uint64_t)s_default_canvas });
 		s_default_canvas = NULL;
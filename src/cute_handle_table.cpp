@@ -12,60 +12,13 @@
 #include <cute_array.h>
 
 #include <internal/cute_alloc_internal.h>
-
-union CF_HandleEntry
-{
-	struct
-	{
-		uint64_t user_index : 32;
-		uint64_t user_type : 15;
-		uint64_t active : 1;
-		uint64_t generation : 16;
-	} data;
-	uint64_t val = 0;
-};
-
-struct CF_HandleTable
-{
-	CF_HandleTable()
-		: m_handles()
-	{
-	}
-
-	uint32_t m_freelist = ~0;
-	Cute::Array<CF_HandleEntry> m_handles;
-};
-
-static void s_add_elements_to_freelist(CF_HandleTable* table, int first_index, int last_index)
-{
-	CF_HandleEntry* m_handles = table->m_handles.data();
-	for (int i = first_index; i < last_index; ++i)
-	{
-		CF_HandleEntry handle;
-		handle.data.user_index = i + 1;
-		handle.data.generation = 0;
-		m_handles[i] = handle;
-	}
-
-	CF_HandleEntry last_handle;
-	last_handle.data.user_index = UINT32_MAX;
-	last_handle.data.generation = 0;
-	m_handles[last_index] = last_handle;
-
-	table->m_freelist = first_index;
-}
+#include <internal/cute_handle_table_internal.h>
 
 CF_HandleTable* cf_make_handle_allocator(int initial_capacity)
 {
 	CF_HandleTable* table = (CF_HandleTable*)CF_ALLOC(sizeof(CF_HandleTable));
 	CF_PLACEMENT_NEW(table) CF_HandleTable();
-
-	if (initial_capacity) {
-		table->m_handles.ensure_count(initial_capacity);
-		int last_index = table->m_handles.capacity() - 1;
-		s_add_elements_to_freelist(table, 0, last_index);
-	}
-
+	if (initial_capacity) table->m_handles.ensure_capacity(initial_capacity);
 	return table;
 }
 
@@ -76,30 +29,50 @@ void cf_destroy_handle_allocator(CF_HandleTable* table)
 	CF_FREE(table);
 }
 
-CF_Handle cf_handle_allocator_alloc(CF_HandleTable* table, uint32_t index, uint16_t type)
+void cf_handle_allocator_reserve(CF_HandleTable* table, int capacity)
 {
-	int freelist_index = table->m_freelist;
-	if (freelist_index == UINT32_MAX) {
-		int first_index = table->m_handles.capacity();
-		if (!first_index) first_index = 1;
-		table->m_handles.ensure_count(first_index * 2);
-		int last_index = table->m_handles.count() - 1;
-		s_add_elements_to_freelist(table, first_index, last_index);
-		freelist_index = table->m_freelist;
-	}
+	table->m_handles.ensure_capacity(capacity);
+}
 
-	// Pop m_freelist.
-	CF_HandleEntry* m_handles = table->m_handles.data();
-	table->m_freelist = m_handles[freelist_index].data.user_index;
+static CF_Handle s_alloc(CF_HandleTable* table, uint32_t index, uint16_t type)
+{
+	// Reuse freed entries first, and only then touch entries never handed out before.
+	uint32_t slot = table->m_freelist;
+	CF_HandleEntry* entry;
+	if (slot != UINT32_MAX) {
+		entry = table->m_handles.data() + slot;
+		table->m_freelist = entry->data.user_index;
+	} else {
+		slot = (uint32_t)table->m_handles.count();
+		entry = &table->m_handles.add();
+	}
 
 	// Setup handle indices.
-	m_handles[freelist_index].data.user_index = index;
-	m_handles[freelist_index].data.user_type = type;
-	m_handles[freelist_index].data.active = true;
-	CF_Handle handle = (((uint64_t)freelist_index) << 32) | m_handles[freelist_index].data.generation;
+	entry->data.user_index = index;
+	entry->data.user_type = type;
+	entry->data.active = true;
+	CF_Handle handle = (((uint64_t)slot) << 32) | entry->data.generation;
 	return handle;
 }
 
+CF_Handle cf_handle_allocator_alloc(CF_HandleTable* table, uint32_t index, uint16_t type)
+{
+	return s_alloc(table, index, type);
+}
+
+void cf_handle_allocator_alloc_many(CF_HandleTable* table, uint32_t first_index, int count, uint16_t type, CF_Handle* out_handles)
+{
+	// Grow at most once for whatever the freelist can't cover.
+	int capacity = table->m_handles.capacity();
+	if (table->m_handles.count() + count > capacity) {
+		int needed = table->m_handles.count() + count;
+		table->m_handles.ensure_capacity(needed > capacity * 2 ? needed : capacity * 2);
+	}
+	for (int i = 0; i < count; ++i) {
+		out_handles[i] = s_alloc(table, first_index + i, type);
+	}
+}
+
 static CF_INLINE uint32_t s_table_index(CF_Handle handle)
 {
 	return (uint32_t)((handle & 0xFFFFFFFF00000000ULL) >> 32);
@@ -180,9 +153,12 @@ void cf_handle_allocator_free(CF_HandleTable* table, CF_Handle handle)
 
 int cf_handle_allocator_handle_valid(CF_HandleTable* table, CF_Handle handle)
 {
-	CF_HandleEntry* m_handles = table->m_handles.data();
-	uint32_t table_index = s_table_index(handle);
-	uint64_t generation = handle & 0xFFFF;
-	bool match_generation = m_handles[table_index].data.generation == generation;
-	return match_generation;
+	return cf_handle_table_valid(table, handle);
+}
+
+void cf_handle_allocator_copy(CF_HandleTable* dst, const CF_HandleTable* src)
+{
+	// The freelist only ever points at entries below the count, so copying those is enough.
+	dst->m_freelist = src->m_freelist;
+	dst->m_handles = src->m_handles;
 }
@@ -15,24 +15,114 @@
 
 using namespace Cute;
 
-// Original implementation by Mattias Gustavsson
+// Items and keys live in dense arrays, originally from Mattias Gustavsson's hashtable.
 // https://github.com/mattiasgustavsson/libs/blob/main/hashtable.h
+//
+// Slots pointing into the dense arrays are found through a power-of-two table of control bytes, in the
+// style of Swiss tables. Each control byte is either empty, deleted, or holds 7 bits of the key's hash.
+// Slots are probed a group of 16 control bytes at a time, with one SSE2/NEON compare per group, so most
+// lookups compare a single key. Hashes are mixed before use, since a power-of-two table only looks at
+// some of the bits.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_HASHTABLE_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_HASHTABLE_NEON
+#endif
+
+#ifdef _MSC_VER
+#	include <intrin.h>
+#endif
+
+#define CF_HGROUP_SIZE 16
+#define CF_HCTRL_EMPTY ((uint8_t)0x80)
+#define CF_HCTRL_DELETED ((uint8_t)0xFE)
+
+static CF_INLINE uint32_t s_hash(const void* key, int key_size)
+{
+	uint64_t h = fnv1a(key, key_size);
+	h ^= h >> 32;
+	h *= 0xD6E8FEB86659FD93ULL;
+	h ^= h >> 32;
+	return (uint32_t)h;
+}
+
+// The low 7 bits are stored in the control byte, the rest picks the group to start probing at.
+static CF_INLINE uint8_t s_h2(uint32_t hash) { return (uint8_t)(hash & 0x7F); }
+static CF_INLINE int s_h1(const CF_Hhdr* table, uint32_t hash) { return (int)((hash >> 7) & (uint32_t)(table->slot_capacity / CF_HGROUP_SIZE - 1)); }
+
+static CF_INLINE int s_lowest_bit(uint32_t mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return (int)index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+// Returns a bitmask of which control bytes in a group equal `value`.
+static CF_INLINE uint32_t s_group_match(const uint8_t* group, uint8_t value)
+{
+#if defined(CF_HASHTABLE_SSE2)
+	__m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)value)));
+#elif defined(CF_HASHTABLE_NEON)
+	static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	uint8x16_t match = vandq_u8(vceqq_u8(vld1q_u8(group), vdupq_n_u8(value)), vld1q_u8(bits));
+	return (uint32_t)vaddv_u8(vget_low_u8(match)) | ((uint32_t)vaddv_u8(vget_high_u8(match)) << 8);
+#else
+	uint32_t mask = 0;
+	for (int i = 0; i < CF_HGROUP_SIZE; ++i) {
+		if (group[i] == value) mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
 
-// Prime table sizes are used to help security of the table at the expense of the % operator,
-// as opposed to the speed << operator, for lookups.
-// By using prime table sizes we ensure all bits of each hash are utilized. This helps mitigate
-// DoS attacks on the table lookup function.
-static int s_primes[] = {
-	31, 67, 127, 257, 509, 1021, 2053, 4099, 8191, 16381, 32771, 65537, 131071,
-	262147, 524287, 1048573, 2097143, 4194301, 8388617, 16777213, 33554467,
-	67108859, 134217757, 268435459, 536870909, 1073741827, 2147483647
-};
+// Returns a bitmask of which control bytes in a group are empty or deleted, as both have the high bit set.
+static CF_INLINE uint32_t s_group_match_free(const uint8_t* group)
+{
+#if defined(CF_HASHTABLE_SSE2)
+	return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#elif defined(CF_HASHTABLE_NEON)
+	static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	uint8x16_t match = vandq_u8(vtstq_u8(vld1q_u8(group), vdupq_n_u8(0x80)), vld1q_u8(bits));
+	return (uint32_t)vaddv_u8(vget_low_u8(match)) | ((uint32_t)vaddv_u8(vget_high_u8(match)) << 8);
+#else
+	uint32_t mask = 0;
+	for (int i = 0; i < CF_HGROUP_SIZE; ++i) {
+		if (group[i] & 0x80) mask |= 1u << i;
+	}
+	return mask;
+#endif
+}
 
-static CF_INLINE int s_next_prime(int a)
+// Groups are probed in triangular steps, which visits every group when the group count is a power of two.
+static CF_INLINE int s_next_group(const CF_Hhdr* table, int group, int step)
 {
-	int i = 0;
-	while (s_primes[i] <= a) ++i;
-	return s_primes[i];
+	return (group + step) & (table->slot_capacity / CF_HGROUP_SIZE - 1);
+}
+
+// Enough slots to keep the table under 7/8 full.
+static int s_slot_capacity_for(int count)
+{
+	int needed = count + count / 7 + 1;
+	int capacity = CF_HGROUP_SIZE;
+	while (capacity < needed) capacity *= 2;
+	return capacity;
+}
+
+static void s_alloc_slots(CF_Hhdr* table, int slot_capacity)
+{
+	table->slot_capacity = slot_capacity;
+	table->tombstone_count = 0;
+	table->slot_ctrl = (uint8_t*)CF_ALLOC(slot_capacity);
+	CF_MEMSET(table->slot_ctrl, CF_HCTRL_EMPTY, slot_capacity);
+	table->slots = (CF_Hslot*)CF_ALLOC(slot_capacity * sizeof(CF_Hslot));
 }
 
 static CF_INLINE void* s_get_item(const CF_Hhdr* table, int index)
@@ -61,11 +151,7 @@ void* cf_hashtable_make_impl(int key_size, int item_size, int capacity)
 	// We also "pass" in values to `hadd` through this space.
 	table->hidden_item = (void*)((uintptr_t)(table + 1));
 	table->items_data = (void*)((uintptr_t)(table + 1) + item_size);
-	table->slot_capacity = s_next_prime(capacity);
-	table->slots = (CF_Hslot*)CF_CALLOC(table->slot_capacity * sizeof(CF_Hslot));
-	for (int i = 0; i < table->slot_capacity; ++i) {
-		table->slots[i].item_index = -1;
-	}
+	s_alloc_slots(table, s_slot_capacity_for(capacity));
 	table->item_capacity = capacity;
 	table->items_key = CF_ALLOC(capacity * key_size);
 	table->items_slot_index = (int*)CF_ALLOC(capacity * sizeof(*table->items_slot_index));
@@ -78,6 +164,7 @@ void* cf_hashtable_make_impl(int key_size, int item_size, int capacity)
 void cf_hashtable_free_impl(CF_Hhdr* table)
 {
 	if (!table) return;
+	CF_FREE(table->slot_ctrl);
 	CF_FREE(table->slots);
 	CF_FREE(table->items_key);
 	CF_FREE(table->items_slot_index);
@@ -93,66 +180,58 @@ static CF_INLINE int s_keys_equal(const CF_Hhdr* table, const void* a, const voi
 
 static int s_find_slot(const CF_Hhdr *table, uint32_t hash, const void* key)
 {
-	uint32_t slot_capacity = (uint32_t)table->slot_capacity;
-	int base_slot = (int)(hash % slot_capacity);
-	int base_count = table->slots[base_slot].base_count;
-	int slot = base_slot;
-
-	while (base_count > 0) {
-		if (table->slots[slot].item_index >= 0) {
-			uint32_t slot_hash = table->slots[slot].key_hash;
-			int slot_base = (int)(slot_hash % slot_capacity);
-			if (slot_base == base_slot) {
-				CF_ASSERT(base_count > 0);
-				--base_count;
-				const void* slot_key = s_get_key(table, table->slots[slot].item_index);
-				if (slot_hash == hash && s_keys_equal(table, slot_key, key)) {
-					return slot;
-				}
+	uint8_t h2 = s_h2(hash);
+	int group = s_h1(table, hash);
+	for (int step = 1; ; ++step) {
+		const uint8_t* ctrl = table->slot_ctrl + group * CF_HGROUP_SIZE;
+		uint32_t match = s_group_match(ctrl, h2);
+		while (match) {
+			int slot = group * CF_HGROUP_SIZE + s_lowest_bit(match);
+			if (table->slots[slot].key_hash == hash && s_keys_equal(table, s_get_key(table, table->slots[slot].item_index), key)) {
+				return slot;
 			}
+			match &= match - 1;
 		}
-		slot = (int)((slot + 1) % table->slot_capacity);
+		// The key would have been placed in this group if it had any room when the key was added.
+		if (s_group_match(ctrl, CF_HCTRL_EMPTY)) return -1;
+		if (step == table->slot_capacity / CF_HGROUP_SIZE) return -1;
+		group = s_next_group(table, group, step);
 	}
-
-	return -1;
 }
 
-static void s_expand_slots(CF_Hhdr* table)
+// Returns the first empty or deleted slot along the probe sequence for `hash`.
+static int s_find_free_slot(const CF_Hhdr* table, uint32_t hash)
 {
-	int old_capacity = table->slot_capacity;
-	CF_Hslot* old_slots = table->slots;
-
-	table->slot_capacity = s_next_prime(table->slot_capacity);
-	uint32_t slot_capacity = (uint32_t)table->slot_capacity;
-
-	table->slots = (CF_Hslot*)CF_CALLOC(table->slot_capacity * sizeof(CF_Hslot));
-	CF_ASSERT(table->slots);
-	for (int i = 0; i < table->slot_capacity; ++i) {
-		table->slots[i].item_index = -1;
+	int group = s_h1(table, hash);
+	for (int step = 1; ; ++step) {
+		uint32_t match = s_group_match_free(table->slot_ctrl + group * CF_HGROUP_SIZE);
+		if (match) return group * CF_HGROUP_SIZE + s_lowest_bit(match);
+		group = s_next_group(table, group, step);
 	}
+}
 
-	for (int i = 0; i < old_capacity; ++i) {
-		if (old_slots[i].item_index >= 0) {
-			uint32_t hash = old_slots[i].key_hash;
-			int base_slot = (int)(hash % slot_capacity);
-			int slot = base_slot;
-			while (table->slots[slot].item_index >= 0) {
-				slot = (slot + 1) % slot_capacity;
-			}
-			table->slots[slot].key_hash = hash;
-			int item_index = old_slots[i].item_index;
-			table->slots[slot].item_index = item_index;
-			table->items_slot_index[item_index] = slot; 
-			++table->slots[base_slot].base_count;
-		}
+static void s_rehash(CF_Hhdr* table, int slot_capacity)
+{
+	uint8_t* old_ctrl = table->slot_ctrl;
+	CF_Hslot* old_slots = table->slots;
+	s_alloc_slots(table, slot_capacity);
+
+	// The dense arrays are untouched, only the slots pointing into them move.
+	for (int i = 0; i < table->count; ++i) {
+		uint32_t hash = old_slots[table->items_slot_index[i]].key_hash;
+		int slot = s_find_free_slot(table, hash);
+		table->slot_ctrl[slot] = s_h2(hash);
+		table->slots[slot].key_hash = hash;
+		table->slots[slot].item_index = i;
+		table->items_slot_index[i] = slot;
 	}
 
+	CF_FREE(old_ctrl);
 	CF_FREE(old_slots);
 }
 
-static CF_Hhdr* s_expand_items(CF_Hhdr* table)
+static CF_Hhdr* s_expand_items(CF_Hhdr* table, int capacity)
 {
-	int capacity = table->item_capacity * 2;
 	table = (CF_Hhdr*)CF_REALLOC(table, sizeof(CF_Hhdr) + (capacity + 1) * table->item_size);
 	table->item_capacity = capacity;
 	table->hidden_item = (void*)((uintptr_t)(table + 1));
@@ -164,35 +243,22 @@ static CF_Hhdr* s_expand_items(CF_Hhdr* table)
 
 void* cf_hashtable_insert_impl2(CF_Hhdr* table, const void* key, const void* item)
 {
-	uint32_t hash = (uint32_t)fnv1a(key, table->key_size);
+	uint32_t hash = s_hash(key, table->key_size);
 	CF_ASSERT(s_find_slot(table, hash, key) < 0);
 
-	if (table->count >= (table->slot_capacity - table->slot_capacity / 3)) {
-		s_expand_slots(table);
-	}
-
-	uint32_t slot_capacity = (uint32_t)table->slot_capacity;
-	int base_slot = (int)(hash % slot_capacity);
-	int base_count = table->slots[base_slot].base_count;
-	int slot = base_slot;
-	int first_free = slot;
-	while (base_count) {
-		if (table->slots[slot].item_index < 0 && table->slots[first_free].item_index >= 0) first_free = slot;
-		uint32_t slot_hash = table->slots[slot].key_hash;
-		int slot_base = (int)(slot_hash % slot_capacity);
-		if (slot_base == base_slot) {
-			--base_count;
-		}
-		slot = (slot + 1) % table->slot_capacity;
+	// Deleted slots count towards the load, since they lengthen probes just the same.
+	int used = table->count + table->tombstone_count + 1;
+	if (used > table->slot_capacity - table->slot_capacity / 8) {
+		// Grow if at least half the slots hold live items, otherwise just sweep out the deleted slots.
+		int capacity = table->count + 1 > table->slot_capacity / 2 ? table->slot_capacity * 2 : table->slot_capacity;
+		s_rehash(table, capacity);
 	}
 
-	slot = first_free;
-	while (table->slots[slot].item_index >= 0) {
-		slot = (slot + 1) % slot_capacity;
-	}
+	int slot = s_find_free_slot(table, hash);
+	if (table->slot_ctrl[slot] == CF_HCTRL_DELETED) --table->tombstone_count;
 
 	if (table->count >= table->item_capacity) {
-		table = s_expand_items(table);
+		table = s_expand_items(table, table->item_capacity * 2);
 
 		// Update the "hidden item" pointer, as it was invalidated by the item array expansion
 		// since the hidden item is at index -1.
@@ -200,10 +266,9 @@ void* cf_hashtable_insert_impl2(CF_Hhdr* table, const void* key, const void* ite
 	}
 
 	CF_ASSERT(table->count < table->item_capacity);
-	CF_ASSERT(table->slots[slot].item_index < 0 && (hash % slot_capacity) == (uint32_t)base_slot);
+	table->slot_ctrl[slot] = s_h2(hash);
 	table->slots[slot].key_hash = hash;
 	table->slots[slot].item_index = table->count;
-	++table->slots[base_slot].base_count;
 
 	void* item_dst = s_get_item(table, table->count);
 	void* key_dst = s_get_key(table, table->count);
@@ -215,6 +280,61 @@ void* cf_hashtable_insert_impl2(CF_Hhdr* table, const void* key, const void* ite
 	return s_get_item(table, 0);
 }
 
+static CF_Hhdr* s_reserve(CF_Hhdr* table, int capacity)
+{
+	if (capacity > table->item_capacity) table = s_expand_items(table, capacity);
+	int slot_capacity = s_slot_capacity_for(capacity);
+	if (slot_capacity > table->slot_capacity) s_rehash(table, slot_capacity);
+	return table;
+}
+
+void* cf_hashtable_reserve_impl(CF_Hhdr* table, int capacity)
+{
+	table = s_reserve(table, capacity);
+	return s_get_item(table, 0);
+}
+
+void* cf_hashtable_build_impl(CF_Hhdr* table, const void* keys, const void* items, int count)
+{
+	cf_hashtable_clear_impl(table);
+	table = s_reserve(table, count);
+	if (!count) return s_get_item(table, 0);
+	CF_MEMCPY(table->items_key, keys, (size_t)count * table->key_size);
+	if (items) CF_MEMCPY(table->items_data, items, (size_t)count * table->item_size);
+
+	// Bucket the keys by the group they hash to with a counting sort, then fill the groups in order,
+	// so slot writes walk forward through memory rather than jumping all over the table.
+	int group_count = table->slot_capacity / CF_HGROUP_SIZE;
+	uint32_t* hashes = (uint32_t*)CF_ALLOC(count * sizeof(uint32_t));
+	int* order = (int*)CF_ALLOC(count * sizeof(int));
+	int* offsets = (int*)CF_CALLOC((group_count + 1) * sizeof(int));
+	for (int i = 0; i < count; ++i) {
+		hashes[i] = s_hash(s_get_key(table, i), table->key_size);
+		offsets[s_h1(table, hashes[i]) + 1]++;
+	}
+	for (int i = 0; i < group_count; ++i) {
+		offsets[i + 1] += offsets[i];
+	}
+	for (int i = 0; i < count; ++i) {
+		order[offsets[s_h1(table, hashes[i])]++] = i;
+	}
+	for (int i = 0; i < count; ++i) {
+		int index = order[i];
+		uint32_t hash = hashes[index];
+		int slot = s_find_free_slot(table, hash);
+		table->slot_ctrl[slot] = s_h2(hash);
+		table->slots[slot].key_hash = hash;
+		table->slots[slot].item_index = index;
+		table->items_slot_index[index] = slot;
+	}
+	table->count = count;
+	CF_FREE(hashes);
+	CF_FREE(order);
+	CF_FREE(offsets);
+
+	return s_get_item(table, 0);
+}
+
 void* cf_hashtable_insert_impl3(CF_Hhdr* table, const void* key)
 {
 	return cf_hashtable_insert_impl2(table, key, table->hidden_item);
@@ -227,15 +347,21 @@ void* cf_hashtable_insert_impl(CF_Hhdr* table, uint64_t key)
 
 void cf_hashtable_remove_impl2(CF_Hhdr* table, const void* key)
 {
-	uint32_t hash = (uint32_t)fnv1a(key, table->key_size);
+	uint32_t hash = s_hash(key, table->key_size);
 	int slot = s_find_slot(table, hash, key);
 	CF_ASSERT(slot >= 0);
 
-	int base_slot = (int)(hash % (uint32_t)table->slot_capacity);
+	// A group that still has an empty slot never had a probe pass through it, so the slot can go back
+	// to empty. Otherwise it must be marked deleted to keep later groups reachable.
 	int index = table->slots[slot].item_index;
 	int last_index = table->count - 1;
-	--table->slots[base_slot].base_count;
-	table->slots[slot].item_index = -1;
+	const uint8_t* group = table->slot_ctrl + (slot / CF_HGROUP_SIZE) * CF_HGROUP_SIZE;
+	if (s_group_match(group, CF_HCTRL_EMPTY)) {
+		table->slot_ctrl[slot] = CF_HCTRL_EMPTY;
+	} else {
+		table->slot_ctrl[slot] = CF_HCTRL_DELETED;
+		++table->tombstone_count;
+	}
 
 	if (index != last_index) {
 		void* dst_key = s_get_key(table, index);
@@ -258,15 +384,13 @@ void cf_hashtable_remove_impl(CF_Hhdr* table, uint64_t key)
 void cf_hashtable_clear_impl(CF_Hhdr* table)
 {
 	table->count = 0;
-	for (int i = 0; i < table->slot_capacity; ++i) {
-		table->slots[i].base_count = 0;
-		table->slots[i].item_index = -1;
-	}
+	table->tombstone_count = 0;
+	CF_MEMSET(table->slot_ctrl, CF_HCTRL_EMPTY, table->slot_capacity);
 }
 
 int cf_hashtable_find_impl2(const CF_Hhdr* table, const void* key)
 {
-	int slot = s_find_slot(table, (uint32_t)fnv1a(key, table->key_size), key);
+	int slot = s_find_slot(table, s_hash(key, table->key_size), key);
 	if (slot < 0) {
 		// We will be "returning" a zero'd out item through `hget` with this
 		// hidden item.
@@ -330,72 +454,115 @@ void cf_hashtable_swap_impl(CF_Hhdr* table, int index_a, int index_b)
 	table->slots[slot_b].item_index = index_a;
 }
 
-static void s_sort(CF_Hhdr* table, int offset, int count)
+void cf_hashtable_permute_impl(CF_Hhdr* table, int* order)
 {
-	if (count <= 1) return;
-
-	auto key = [=](int index) { return *(uint64_t*)s_get_key(table, offset + index); };
-	auto swap = [=](int ia, int ib) { cf_hashtable_swap_impl(table, offset + ia, offset + ib); };
-
-	uint64_t pivot_key = key(count - 1);
-	int lo = 0;
-	for (int hi = 0; hi < count - 1; ++hi) {
-		uint64_t hi_key = key(hi);
-		if (hi_key < pivot_key) {
-			swap(lo, hi);
-			lo++;
+	// Follow each cycle of the permutation, so every key and item is moved exactly once, plus once
+	// more per cycle through the temp key/item. Placed entries are marked by pointing `order` at themselves.
+	int count = table->count;
+	for (int start = 0; start < count; ++start) {
+		if (order[start] == start) continue;
+		CF_MEMCPY(table->temp_key, s_get_key(table, start), table->key_size);
+		CF_MEMCPY(table->temp_item, s_get_item(table, start), table->item_size);
+		int temp_slot = table->items_slot_index[start];
+		int dst = start;
+		while (order[dst] != start) {
+			int src = order[dst];
+			CF_MEMCPY(s_get_key(table, dst), s_get_key(table, src), table->key_size);
+			CF_MEMCPY(s_get_item(table, dst), s_get_item(table, src), table->item_size);
+			table->items_slot_index[dst] = table->items_slot_index[src];
+			order[dst] = dst;
+			dst = src;
 		}
+		CF_MEMCPY(s_get_key(table, dst), table->temp_key, table->key_size);
+		CF_MEMCPY(s_get_item(table, dst), table->temp_item, table->item_size);
+		table->items_slot_index[dst] = temp_slot;
+		order[dst] = dst;
 	}
+	for (int i = 0; i < count; ++i) {
+		table->slots[table->items_slot_index[i]].item_index = i;
+	}
+}
 
-	swap(count - 1, lo);
-
-	s_sort(table, 0, lo);
-	s_sort(table, lo + 1, count - 1 - lo);
+// LSD radix sort of the keys as `uint64_t`, a byte at a time. Bytes every key shares are skipped,
+// so small keys only take a couple of passes.
+static void s_radix_sort(CF_Hhdr* table, int* out_order)
+{
+	int count = table->count;
+	uint64_t* key_buffer = (uint64_t*)CF_ALLOC(sizeof(uint64_t) * count * 2);
+	int* order_buffer = (int*)CF_ALLOC(sizeof(int) * count);
+	uint64_t* keys = key_buffer;
+	uint64_t* keys_tmp = key_buffer + count;
+	int* order = out_order;
+	int* order_tmp = order_buffer;
+	uint64_t all_and = ~0ULL, all_or = 0;
+	for (int i = 0; i < count; ++i) {
+		keys[i] = *(uint64_t*)s_get_key(table, i);
+		order[i] = i;
+		all_and &= keys[i];
+		all_or |= keys[i];
+	}
+	for (int shift = 0; shift < 64; shift += 8) {
+		if ((((all_and ^ all_or) >> shift) & 0xFF) == 0) continue;
+		int offsets[256] = { 0 };
+		for (int i = 0; i < count; ++i) {
+			offsets[(keys[i] >> shift) & 0xFF]++;
+		}
+		int sum = 0;
+		for (int i = 0; i < 256; ++i) {
+			int n = offsets[i];
+			offsets[i] = sum;
+			sum += n;
+		}
+		for (int i = 0; i < count; ++i) {
+			int dst = offsets[(keys[i] >> shift) & 0xFF]++;
+			keys_tmp[dst] = keys[i];
+			order_tmp[dst] = order[i];
+		}
+		uint64_t* k = keys; keys = keys_tmp; keys_tmp = k;
+		int* o = order; order = order_tmp; order_tmp = o;
+	}
+	// After an odd number of passes the result sits in the scratch buffer.
+	if (order != out_order) CF_MEMCPY(out_order, order, sizeof(int) * count);
+	CF_FREE(key_buffer);
+	CF_FREE(order_buffer);
 }
 
 void* cf_hashtable_sort_impl(CF_Hhdr* table)
 {
-	s_sort(table, 0, table->count);
+	if (table->count > 1) {
+		int* order = (int*)CF_ALLOC(sizeof(int) * table->count);
+		CF_ASSERT(table->key_size == sizeof(uint64_t));
+		s_radix_sort(table, order);
+		cf_hashtable_permute_impl(table, order);
+		CF_FREE(order);
+	}
 	return s_get_item(table, 0);
 }
 
-static void s_ssort(CF_Hhdr* table, int offset, int count, bool ignore_case)
+static void s_ssort(CF_Hhdr* table, bool ignore_case)
 {
+	int count = table->count;
 	if (count <= 1) return;
-
-	auto key = [=](int index) { return (const char*)s_get_key(table, offset + index); };
-	auto swap = [=](int ia, int ib) { cf_hashtable_swap_impl(table, offset + ia, offset + ib); };
-
-	const char* pivot_key = key(count - 1);
-	int lo = 0;
-	for (int hi = 0; hi < count - 1; ++hi) {
-		const char* hi_key = key(hi);
-		bool pred;
-		if (ignore_case) {
-			pred = sicmp(hi_key, pivot_key) < 0 ? true : false;
-		} else {
-			pred = scmp(hi_key, pivot_key) < 0 ? true : false;
-		}
-		if (pred) {
-			swap(lo, hi);
-			lo++;
-		}
+	int* order = (int*)CF_ALLOC(sizeof(int) * count);
+	const char** keys = (const char**)table->items_key;
+	for (int i = 0; i < count; ++i) order[i] = i;
+	if (ignore_case) {
+		sort_indices(order, count, [=](int a, int b) { return sicmp(keys[a], keys[b]) < 0; });
+	} else {
+		sort_indices(order, count, [=](int a, int b) { return scmp(keys[a], keys[b]) < 0; });
 	}
-
-	swap(count - 1, lo);
-
-	s_sort(table, 0, lo);
-	s_sort(table, lo + 1, count - 1 - lo);
+	cf_hashtable_permute_impl(table, order);
+	CF_FREE(order);
 }
 
 void* cf_hashtable_ssort_impl(CF_Hhdr* table)
 {
-	s_ssort(table, 0, table->count, false);
+	s_ssort(table, false);
 	return s_get_item(table, 0);
 }
 
 void* cf_hashtable_sisort_impl(CF_Hhdr* table)
 {
-	s_ssort(table, 0, table->count, true);
+	s_ssort(table, true);
 	return s_get_item(table, 0);
 }
@@ -11,10 +11,17 @@
 #include <cute_array.h>
 #include <cute_string.h>
 #include <cute_coroutine.h>
+#include <cute_profile.h>
+#include <cute_time.h>
+#include <cute_file_system.h>
+#include <cute_multithreading.h>
 
 #include <internal/cute_alloc_internal.h>
+#include <internal/cute_coroutine_internal.h>
+#include <internal/cute_https_internal.h>
 
 #include <SDL.h>
+#include <physfs/physfs.h>
 
 #ifndef CF_APPLE
 #	define CUTE_TLS_IMPLEMENTATION
@@ -26,6 +33,9 @@ extern "C" {
 }
 #endif
 
+// Included last, it defines zlib compatibility macros such as `inflate`.
+#include <physfs/physfs_miniz.h>
+
 // Credit to Mattias Gustavsson for the original API design of cute_https.h
 
 using namespace Cute;
@@ -37,6 +47,296 @@ using namespace Cute;
 #define CF_RESPONSE_DEFLATE             4
 #define CF_RESPONSE_DEPRECATED_COMPRESS 8
 
+//--------------------------------------------------------------------------------------------------
+// Compressed bodies, gzip (RFC 1952) wrapping deflate (RFC 1951), or deflate in a zlib wrapper (RFC 1950).
+
+static uint32_t s_crc32(uint32_t crc, const uint8_t* data, size_t size)
+{
+	static uint32_t table[256];
+	static bool init = []() {
+		for (uint32_t i = 0; i < 256; ++i) {
+			uint32_t c = i;
+			for (int j = 0; j < 8; ++j) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+			table[i] = c;
+		}
+		return true;
+	}();
+	CF_UNUSED(init);
+	crc = ~crc;
+	for (size_t i = 0; i < size; ++i) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+#define CF_BODY_DECODER_HEADER  0
+#define CF_BODY_DECODER_INFLATE 1
+#define CF_BODY_DECODER_TRAILER 2
+#define CF_BODY_DECODER_DONE    3
+
+// Generous, the only unbounded parts of a gzip header are an optional file name and comment.
+#define CF_BODY_DECODER_MAX_HEADER (64 * 1024)
+
+// Decompresses a body as it streams in. Output goes through a wrapping window the size of the deflate dictionary, so
+// memory stays fixed no matter how large the body is.
+struct CF_BodyDecoder
+{
+	bool gzip = false;
+	int stage = CF_BODY_DECODER_HEADER;
+	uint32_t flags = 0; // For `tinfl_decompress`.
+	Array<uint8_t> header; // Collects the header across packets.
+	uint8_t trailer[8] = { };
+	int trailer_size = 0;
+	uint32_t crc = 0;
+	uint32_t size = 0;
+	size_t window_offset = 0;
+	tinfl_decompressor inflater;
+	uint8_t window[TINFL_LZ_DICT_SIZE];
+};
+
+// Returns the size of the header, -1 if more bytes are needed, or -2 for a malformed header.
+static int s_body_header_size(CF_BodyDecoder* decoder)
+{
+	const uint8_t* p = decoder->header.data();
+	int n = decoder->header.count();
+	if (!decoder->gzip) {
+		// Servers disagree on what "deflate" means, so accept a zlib wrapper as well as raw deflate.
+		if (n < 2) return -1;
+		bool zlib = (p[0] & 0x0F) == 8 && (p[0] >> 4) <= 7 && ((p[0] << 8) | p[1]) % 31 == 0;
+		decoder->flags = zlib ? TINFL_FLAG_PARSE_ZLIB_HEADER : 0;
+		return 0;
+	}
+
+	if (n < 10) return -1;
+	if (p[0] != 0x1F || p[1] != 0x8B || p[2] != 8) return -2;
+	int flags = p[3];
+	int size = 10;
+	if (flags & 4) {
+		// FEXTRA, skipped.
+		if (n < size + 2) return -1;
+		size += 2 + (p[size] | (p[size + 1] << 8));
+	}
+	for (int bit = 8; bit <= 16; bit <<= 1) {
+		// FNAME and FCOMMENT, each zero-terminated.
+		if (!(flags & bit)) continue;
+		const uint8_t* end = size < n ? (const uint8_t*)CF_MEMCHR(p + size, 0, n - size) : NULL;
+		if (!end) return -1;
+		size = (int)(end - p) + 1;
+	}
+	if (flags & 2) size += 2; // FHCRC, not checked.
+	return n >= size ? size : -1;
+}
+
+// Returns the number of bytes consumed, or -1 on corrupt data.
+static int s_inflate(CF_BodyDecoder* decoder, String* out, const uint8_t* in, int size)
+{
+	int consumed = 0;
+	while (1) {
+		size_t in_bytes = (size_t)(size - consumed);
+		size_t out_bytes = TINFL_LZ_DICT_SIZE - decoder->window_offset;
+		uint8_t* next = decoder->window + decoder->window_offset;
+		tinfl_status status = tinfl_decompress(&decoder->inflater, in + consumed, &in_bytes, decoder->window, next, &out_bytes, decoder->flags | TINFL_FLAG_HAS_MORE_INPUT);
+		consumed += (int)in_bytes;
+		if (out_bytes) {
+			out->append((const char*)next, (const char*)next + out_bytes);
+			if (decoder->gzip) {
+				decoder->crc = s_crc32(decoder->crc, next, out_bytes);
+				decoder->size += (uint32_t)out_bytes;
+			}
+			decoder->window_offset = (decoder->window_offset + out_bytes) & (TINFL_LZ_DICT_SIZE - 1);
+		}
+		if (status == TINFL_STATUS_DONE) {
+			decoder->stage = decoder->gzip ? CF_BODY_DECODER_TRAILER : CF_BODY_DECODER_DONE;
+			// The inflater reads ahead, so whole bytes left over in its bit buffer come after the compressed data.
+			tinfl_decompressor* r = &decoder->inflater;
+			tinfl_bit_buf_t bits = r->m_bit_buf >> (r->m_num_bits & 7);
+			for (mz_uint32 i = 0; i < r->m_num_bits / 8; ++i, bits >>= 8) {
+				if (decoder->trailer_size == 8 || !decoder->gzip) return -1;
+				decoder->trailer[decoder->trailer_size++] = (uint8_t)bits;
+			}
+			return consumed;
+		} else if (status < 0) {
+			return -1;
+		} else if (status == TINFL_STATUS_NEEDS_MORE_INPUT) {
+			return consumed;
+		}
+		// Otherwise the window filled up, keep going.
+	}
+}
+
+// Decompresses the next piece of a body into `out`.
+static bool s_body_decode(CF_BodyDecoder* decoder, String* out, const uint8_t* in, int size)
+{
+	if (decoder->stage == CF_BODY_DECODER_HEADER) {
+		int count = decoder->header.count();
+		decoder->header.set_count(count + size);
+		CF_MEMCPY(decoder->header.data() + count, in, size);
+		int header_size = s_body_header_size(decoder);
+		if (header_size == -1) return decoder->header.count() <= CF_BODY_DECODER_MAX_HEADER;
+		if (header_size < 0) return false;
+		decoder->stage = CF_BODY_DECODER_INFLATE;
+		tinfl_init(&decoder->inflater);
+		bool ok = s_body_decode(decoder, out, decoder->header.data() + header_size, decoder->header.count() - header_size);
+		decoder->header.clear();
+		return ok;
+	}
+
+	while (size) {
+		int consumed = 0;
+		if (decoder->stage == CF_BODY_DECODER_INFLATE) {
+			consumed = s_inflate(decoder, out, in, size);
+			if (consumed < 0 || (!consumed && decoder->stage == CF_BODY_DECODER_INFLATE)) return false;
+		} else if (decoder->stage == CF_BODY_DECODER_TRAILER) {
+			consumed = min(size, 8 - decoder->trailer_size);
+			CF_MEMCPY(decoder->trailer + decoder->trailer_size, in, consumed);
+			decoder->trailer_size += consumed;
+		} else {
+			// Bytes past the end of the compressed data.
+			return false;
+		}
+		in += consumed;
+		size -= consumed;
+
+		if (decoder->stage == CF_BODY_DECODER_TRAILER && decoder->trailer_size == 8) {
+			// CRC32 and size of the uncompressed data, both little-endian.
+			const uint8_t* t = decoder->trailer;
+			uint32_t crc = t[0] | (t[1] << 8) | (t[2] << 16) | ((uint32_t)t[3] << 24);
+			uint32_t isize = t[4] | (t[5] << 8) | (t[6] << 16) | ((uint32_t)t[7] << 24);
+			if (crc != decoder->crc || isize != decoder->size) return false;
+			decoder->stage = CF_BODY_DECODER_DONE;
+		}
+	}
+	return true;
+}
+
+// Compression of request bodies. A single block of greedy LZ77 matches found over hash chains, coded with deflate's
+// fixed Huffman tables. Request bodies are mostly text or JSON, where this gets most of the way to zlib.
+#define CF_DEFLATE_WINDOW     32768
+#define CF_DEFLATE_HASH_BITS  15
+#define CF_DEFLATE_MAX_CHAIN  32
+#define CF_DEFLATE_MIN_MATCH  3
+#define CF_DEFLATE_MAX_MATCH  258
+
+static const int s_deflate_length_base[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+static const int s_deflate_length_extra[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+static const int s_deflate_dist_base[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+static const int s_deflate_dist_extra[30] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+struct CF_BitWriter
+{
+	Array<uint8_t>* out = NULL;
+	uint64_t bits = 0;
+	int count = 0;
+};
+
+// Deflate packs bits starting from the least significant.
+static CF_INLINE void s_put_bits(CF_BitWriter* w, uint32_t bits, int count)
+{
+	w->bits |= (uint64_t)bits << w->count;
+	w->count += count;
+	while (w->count >= 8) {
+		w->out->add((uint8_t)w->bits);
+		w->bits >>= 8;
+		w->count -= 8;
+	}
+}
+
+// Huffman codes are the exception, they go most significant bit first.
+static CF_INLINE void s_put_code(CF_BitWriter* w, uint32_t code, int count)
+{
+	uint32_t reversed = 0;
+	for (int i = 0; i < count; ++i) {
+		reversed |= ((code >> i) & 1) << (count - 1 - i);
+	}
+	s_put_bits(w, reversed, count);
+}
+
+static void s_put_symbol(CF_BitWriter* w, int symbol)
+{
+	if (symbol < 144) s_put_code(w, 0x30 + symbol, 8);
+	else if (symbol < 256) s_put_code(w, 0x190 + symbol - 144, 9);
+	else if (symbol < 280) s_put_code(w, symbol - 256, 7);
+	else s_put_code(w, 0xC0 + symbol - 280, 8);
+}
+
+static void s_put_match(CF_BitWriter* w, int length, int distance)
+{
+	int l = 0;
+	while (l < 28 && s_deflate_length_base[l + 1] <= length) ++l;
+	s_put_symbol(w, 257 + l);
+	s_put_bits(w, length - s_deflate_length_base[l], s_deflate_length_extra[l]);
+	int d = 0;
+	while (d < 29 && s_deflate_dist_base[d + 1] <= distance) ++d;
+	s_put_code(w, d, 5);
+	s_put_bits(w, distance - s_deflate_dist_base[d], s_deflate_dist_extra[d]);
+}
+
+static CF_INLINE uint32_t s_deflate_hash(const uint8_t* p)
+{
+	return (((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2]) * 2654435761u >> (32 - CF_DEFLATE_HASH_BITS);
+}
+
+static void s_gzip(Array<uint8_t>* out, const uint8_t* in, int size)
+{
+	// Deflate, no flags, no timestamp, unknown OS.
+	static const uint8_t header[10] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF };
+	for (int i = 0; i < 10; ++i) out->add(header[i]);
+
+	Array<int> head;
+	head.set_count(1 << CF_DEFLATE_HASH_BITS);
+	CF_MEMSET(head.data(), 0xFF, sizeof(int) * head.count());
+	Array<int> prev;
+	prev.set_count(CF_DEFLATE_WINDOW);
+
+	CF_BitWriter w;
+	w.out = out;
+	s_put_bits(&w, 1, 1); // Final block.
+	s_put_bits(&w, 1, 2); // Fixed Huffman codes.
+	int i = 0;
+	while (i < size) {
+		int best_length = 0;
+		int best_distance = 0;
+		if (i + CF_DEFLATE_MIN_MATCH <= size) {
+			int max_length = min(CF_DEFLATE_MAX_MATCH, size - i);
+			int candidate = head[s_deflate_hash(in + i)];
+			for (int chain = 0; candidate >= 0 && i - candidate <= CF_DEFLATE_WINDOW && chain < CF_DEFLATE_MAX_CHAIN; ++chain) {
+				int length = 0;
+				while (length < max_length && in[candidate + length] == in[i + length]) ++length;
+				if (length > best_length) {
+					best_length = length;
+					best_distance = i - candidate;
+					if (length == max_length) break;
+				}
+				candidate = prev[candidate & (CF_DEFLATE_WINDOW - 1)];
+			}
+		}
+
+		int advance = 1;
+		if (best_length >= CF_DEFLATE_MIN_MATCH) {
+			s_put_match(&w, best_length, best_distance);
+			advance = best_length;
+		} else {
+			s_put_symbol(&w, in[i]);
+		}
+
+		// Every position covered goes into the chains, so later matches can start in the middle of this one.
+		for (int j = 0; j < advance; ++j, ++i) {
+			if (i + CF_DEFLATE_MIN_MATCH <= size) {
+				uint32_t h = s_deflate_hash(in + i);
+				prev[i & (CF_DEFLATE_WINDOW - 1)] = head[h];
+				head[h] = i;
+			}
+		}
+	}
+	s_put_symbol(&w, 256); // End of block.
+	if (w.count) s_put_bits(&w, 0, 8 - w.count);
+
+	uint32_t crc = s_crc32(0, in, (size_t)size);
+	for (int k = 0; k < 4; ++k) out->add((uint8_t)(crc >> (k * 8)));
+	for (int k = 0; k < 4; ++k) out->add((uint8_t)((uint32_t)size >> (k * 8)));
+}
+
+//--------------------------------------------------------------------------------------------------
+// Requests and responses.
+
 typedef struct CF_Response
 {
 	const char* in = NULL;
@@ -44,9 +344,14 @@ typedef struct CF_Response
 	int code = 0;
 	bool ok = true;
 	int flags = 0;
-	bool gzip = false;
-	bool deflate = false;
-	int content_length = 0;
+	int content_encoding = 0; // CF_RESPONSE_GZIP or CF_RESPONSE_DEFLATE, when recognized.
+	bool decode_content = false; // We sent Accept-Encoding, so undo the Content-Encoding.
+	CF_BodyDecoder* decoder = NULL;
+	uint64_t body_received = 0; // Body bytes as they came over the wire, before decompression.
+	uint64_t content_length = 0;
+	bool has_content_length = false;
+	bool until_close = false; // No length given, so the body ends when the server disconnects.
+	bool close = false; // The server asked for the connection to be closed after this response.
 	bool trailers = false;
 	Map<const char*, CF_HttpsHeader> headers;
 	String parse;
@@ -61,11 +366,26 @@ typedef struct CF_Request
 	int content_length = 0;
 	const void* content = NULL;
 	bool verify_cert = true;
+	bool gzip_content = false;
 	CF_HttpsResult result = CF_HTTPS_RESULT_PENDING;
 	CF_Response response = { };
 	CF_Coroutine co = { };
 	TLS_Connection connection = { };
 	Array<CF_HttpsHeader> headers;
+
+	// Streaming, the body is handed off packet-by-packet instead of accumulating in `response.content`.
+	CF_HttpsBodyFn* body_fn = NULL;
+	void* body_udata = NULL;
+	bool download = false;
+	bool resume = false;
+	String download_path;
+	CF_File* file = NULL;
+	uint64_t offset = 0; // Bytes already on disk from a previous attempt, when resuming.
+	uint64_t received = 0; // Body bytes streamed so far.
+
+	// Processed on the network thread, see `cf_https_process_async`.
+	CF_HttpsDoneFn* done_fn = NULL;
+	void* done_udata = NULL;
 } CF_Request;
 
 static CF_INLINE CF_HttpsResult s_tls_state_to_https_result(TLS_State state)
@@ -93,14 +413,15 @@ static void s_get_line(Coroutine co, CF_Response* response)
 	response->parse.clear();
 	while (1) {
 		while (response->in != response->end) {
-			const char* found_cr = (const char*)CF_MEMCHR(response->in, '\r', response->end - response->in);
-			if (found_cr) {
-				response->parse.append(response->in, found_cr);
-				response->in = found_cr + 1;
-				if (*response->in == '\n') {
-					response->in++;
-					return;
+			// Search for the LF rather than the CR, since the CRLF pair may be split across two packets.
+			const char* found_lf = (const char*)CF_MEMCHR(response->in, '\n', response->end - response->in);
+			if (found_lf) {
+				response->parse.append(response->in, found_lf);
+				response->in = found_lf + 1;
+				if (response->parse.len() && response->parse.last() == '\r') {
+					response->parse.pop();
 				}
+				return;
 			} else {
 				response->parse.append(response->in, response->end);
 				response->in = response->end;
@@ -159,24 +480,27 @@ static bool s_header(Coroutine co, CF_Response* response)
 			// Content-Length and transfer encoding flags are not compatible.
 			return false;
 		}
-		response->content_length = content.to_int();
+		response->content_length = (uint64_t)CF_STRTOLL(content.c_str(), NULL, 10);
+		response->has_content_length = true;
 	} else if (name == "Transfer-Encoding") {
 		Array<String> encodings = content.split(',');
 		for (int i = 0; i < encodings.size(); ++i) {
 			int prev_flags = response->flags;
-			if (content == "deflate") {
+			String& encoding = encodings[i];
+			encoding.trim();
+			if (encoding == "deflate") {
 				if (response->flags & CF_RESPONSE_GZIP) return false;
 				response->flags |= CF_RESPONSE_DEFLATE;
-			} else if (content == "gzip") {
+			} else if (encoding == "gzip" || encoding == "x-gzip") {
 				if (response->flags & CF_RESPONSE_DEFLATE) return false;
 				response->flags |= CF_RESPONSE_GZIP;
-			} else if (content == "chunked") {
+			} else if (encoding == "chunked") {
 				if (response->content_length > 0) {
 					// Content-Length and transfer encoding flags are not compatible.
 					return false;
 				}
 				response->flags |= CF_RESPONSE_CHUNKED;
-			} else if (content.len() > 0) {
+			} else if (encoding.len() > 0) {
 				// Invalid encoding found.
 				return false;
 			}
@@ -185,6 +509,17 @@ static bool s_header(Coroutine co, CF_Response* response)
 				return false;
 			}
 		}
+	} else if (name == "Content-Encoding") {
+		// Only a single coding we know gets decoded, anything else is passed through untouched.
+		if (content == "gzip" || content == "x-gzip") {
+			response->content_encoding = CF_RESPONSE_GZIP;
+		} else if (content == "deflate") {
+			response->content_encoding = CF_RESPONSE_DEFLATE;
+		}
+	} else if (name == "Connection") {
+		if (!CF_STRICMP(content.c_str(), "close")) {
+			response->close = true;
+		}
 	} else if (name == "Trailer") {
 		response->trailers = true;
 		// Don't bother parsing the trailer list, just forward them all along to the user when get them later.
@@ -217,6 +552,35 @@ static void s_headers(Coroutine co, CF_Response* response)
 	}
 }
 
+// Sets up decompression of the body, if it's compressed in a way we undo. Transfer codings are always undone, while the
+// content coding is only undone if we asked for it with Accept-Encoding.
+static void s_begin_body(CF_Response* response)
+{
+	int compression = response->flags & (CF_RESPONSE_GZIP | CF_RESPONSE_DEFLATE);
+	if (!compression && response->decode_content) compression = response->content_encoding;
+	if (!compression) return;
+	response->decoder = CF_NEW(CF_BodyDecoder);
+	response->decoder->gzip = compression == CF_RESPONSE_GZIP;
+}
+
+// Takes the next piece of the body, decompressing it if needed.
+static bool s_body(CF_Response* response, const char* data, uint64_t size)
+{
+	response->body_received += size;
+	if (response->decoder) {
+		return s_body_decode(response->decoder, &response->content, (const uint8_t*)data, (int)size);
+	} else {
+		response->content.append(data, data + size);
+		return true;
+	}
+}
+
+// A truncated compressed body can otherwise look like a complete one.
+static bool s_body_complete(CF_Response* response)
+{
+	return !response->decoder || !response->body_received || response->decoder->stage == CF_BODY_DECODER_DONE;
+}
+
 static void s_decode(Coroutine co)
 {
 	CF_Response* response = (CF_Response*)coroutine_get_udata(co);
@@ -229,6 +593,7 @@ static void s_decode(Coroutine co)
 	// Read headers.
 	s_headers(co, response);
 	if (!response->ok) return;
+	s_begin_body(response);
 
 	// Read in response body.
 	if (response->flags & CF_RESPONSE_CHUNKED) {
@@ -251,19 +616,19 @@ static void s_decode(Coroutine co)
 			}
 
 			// Read in chunk data.
-			while (1) {
+			uint64_t chunk_read = 0;
+			while (chunk_read < chunk_size) {
 				if (response->in == response->end) {
 					coroutine_yield(co);
 				}
 
-				uint64_t bytes = min(chunk_size, response->end - response->in);
-				response->content.append(response->in, response->in + bytes);
-				response->in += bytes;
-
-				int len = response->content.len();
-				if (len == chunk_size) {
-					break;
+				uint64_t bytes = min(chunk_size - chunk_read, (uint64_t)(response->end - response->in));
+				if (!s_body(response, response->in, bytes)) {
+					response->ok = false;
+					return;
 				}
+				response->in += bytes;
+				chunk_read += bytes;
 			}
 
 			s_get_line(co, response);
@@ -273,13 +638,33 @@ static void s_decode(Coroutine co)
 				return;
 			}
 		}
+	} else if (!response->has_content_length && response->code >= 200 && response->code != 204 && response->code != 304) {
+		// No framing given, so the body runs until the server closes the connection.
+		response->until_close = true;
+		while (1) {
+			if (!s_body(response, response->in, response->end - response->in)) {
+				response->ok = false;
+				return;
+			}
+			response->in = response->end;
+			coroutine_yield(co);
+		}
 	} else {
 		// Read in content bytes (non-chunked).
 		uint64_t bytes_read = 0;
 		while (1) {
 			uint64_t bytes = response->end - response->in;
-			response->content.append(response->in, response->in + bytes);
 			bytes_read += bytes;
+			if (bytes_read > response->content_length) {
+				// Content length did not match expectation.
+				response->ok = false;
+				return;
+			}
+			if (!s_body(response, response->in, bytes)) {
+				response->ok = false;
+				return;
+			}
+			response->in += bytes;
 
 			if (bytes_read == response->content_length) {
 				break;
@@ -293,20 +678,14 @@ static void s_decode(Coroutine co)
 		}
 	}
 
-	// Note what compression was used.
-	// TODO - Just decompress things ourselves. Code for DEFLATE already exists in cute_aseprite.h, but,
-	//        gzip header parsing + CRC would need to be written (super annoying). So, this will probably
-	//        never get implemented.
-	if (response->flags & CF_RESPONSE_DEFLATE) {
-		response->deflate = true;
-	} else if (response->flags & CF_RESPONSE_GZIP) {
-		response->gzip = true;
+	if (!s_body_complete(response)) {
+		response->ok = false;
+		return;
 	}
 
-	// Parsing code implemented incorrectly.
-	CF_ASSERT(!(response->deflate && response->gzip));
-
-	if (response->trailers) {
+	if (!(response->flags & CF_RESPONSE_CHUNKED)) {
+		// Content-Length bodies have no trailer section.
+	} else if (response->trailers) {
 		// Read in any trailing headers.
 		s_headers(co, response);
 	} else {
@@ -319,93 +698,311 @@ static void s_decode(Coroutine co)
 	}
 }
 
-static void s_https_process(Coroutine co)
+// Idle keep-alive connections, handed to later requests for the same host so they can skip the
+// TCP and TLS handshakes. Connections the server has closed, or that sat idle too long, are pruned
+// lazily whenever the pool is touched.
+#define CF_HTTPS_MAX_IDLE_CONNECTIONS          16
+#define CF_HTTPS_MAX_IDLE_CONNECTIONS_PER_HOST 4
+#define CF_HTTPS_IDLE_TIMEOUT                  30.0
+
+struct CF_IdleConnection
 {
-	CF_Request* request = (CF_Request*)coroutine_get_udata(co);
+	const char* host = NULL; // Interned.
+	int port = 0;
+	bool verify_cert = true;
+	TLS_Connection connection = { };
+	uint64_t idle_since = 0;
+};
+
+static CF_IdleConnection s_idle[CF_HTTPS_MAX_IDLE_CONNECTIONS];
+static int s_idle_count;
+
+static void s_remove_idle(int index)
+{
+	tls_disconnect(s_idle[index].connection);
+	for (int i = index; i < s_idle_count - 1; ++i) {
+		s_idle[i] = s_idle[i + 1];
+	}
+	s_idle_count--;
+}
+
+static void s_prune_idle()
+{
+	uint64_t now = cf_get_ticks();
+	uint64_t timeout = (uint64_t)(CF_HTTPS_IDLE_TIMEOUT * (double)cf_get_tick_frequency());
+	for (int i = 0; i < s_idle_count;) {
+		// Any bytes arriving on an idle connection mean it's no longer usable (usually a close notify).
+		char c;
+		TLS_Connection connection = s_idle[i].connection;
+		if (now - s_idle[i].idle_since > timeout || tls_process(connection) != TLS_STATE_CONNECTED || tls_read(connection, &c, 1) != 0) {
+			s_remove_idle(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+static bool s_take_idle(CF_Request* request)
+{
+	s_prune_idle();
+	const char* host = sintern(request->host);
+	// Prefer the most recently used connection, it's the least likely to have been closed by the server.
+	for (int i = s_idle_count - 1; i >= 0; --i) {
+		CF_IdleConnection* idle = s_idle + i;
+		if (idle->host == host && idle->port == request->port && idle->verify_cert == request->verify_cert) {
+			request->connection = idle->connection;
+			for (int j = i; j < s_idle_count - 1; ++j) {
+				s_idle[j] = s_idle[j + 1];
+			}
+			s_idle_count--;
+			return true;
+		}
+	}
+	return false;
+}
+
+static void s_release_idle(CF_Request* request)
+{
+	s_prune_idle();
+	const char* host = sintern(request->host);
+	int oldest_for_host = -1;
+	int count_for_host = 0;
+	for (int i = 0; i < s_idle_count; ++i) {
+		if (s_idle[i].host == host && s_idle[i].port == request->port) {
+			if (oldest_for_host < 0) oldest_for_host = i;
+			count_for_host++;
+		}
+	}
+	if (count_for_host >= CF_HTTPS_MAX_IDLE_CONNECTIONS_PER_HOST) {
+		s_remove_idle(oldest_for_host);
+	} else if (s_idle_count == CF_HTTPS_MAX_IDLE_CONNECTIONS) {
+		s_remove_idle(0);
+	}
+
+	CF_IdleConnection* idle = s_idle + s_idle_count++;
+	idle->host = host;
+	idle->port = request->port;
+	idle->verify_cert = request->verify_cert;
+	idle->connection = request->connection;
+	idle->idle_since = cf_get_ticks();
+	request->connection.id = 0;
+}
 
-	// Start up the TLS connection.
+static bool s_connect(Coroutine co, CF_Request* request)
+{
 	request->connection = tls_connect(request->host, request->port);
+	if (!request->connection.id) {
+		request->result = CF_HTTPS_RESULT_SOCKET_ERROR;
+		return false;
+	}
 	while (1) {
 		TLS_State state = tls_process(request->connection);
 		request->result = s_tls_state_to_https_result(state);
 		if (state == TLS_STATE_CONNECTED) {
 			// Connected!
-			break;
+			return true;
 		} else if (state < 0) {
-			return;
+			return false;
 		}
 		coroutine_yield(co);
 	}
+}
+
+// Hands off any decoded body bytes to the body callback or download file, keeping memory bounded by a packet.
+static bool s_stream(CF_Request* request)
+{
+	CF_Response* response = &request->response;
+	int size = response->content.len();
+	if (!size || (!request->body_fn && !request->download)) return true;
 
-	// Send of the HTTP request.
-	String s;
-	if (request->content) {
-		s = String::fmt(
-			"POST %s HTTP/1.1\r\n"
-			"Host: %s\r\n"
-			"Connection: close\r\n"
-			"TE: trailers, deflate, gzip\r\n"
-			"Content-Length: %d\r\n"
-			"\r\n",
-			request->uri, request->host, request->content_length
-		);
-		const char* content = (const char*)request->content;
-		s.append(content, content + request->content_length); 
+	if (request->download) {
+		if (!request->file) {
+			if (response->code == 206) {
+				// The server honored our range, continue where the last attempt left off.
+				request->file = cf_fs_open_file_for_append(request->download_path.c_str());
+			} else if (response->code >= 200 && response->code < 300) {
+				request->offset = 0;
+				request->file = cf_fs_open_file_for_write(request->download_path.c_str());
+			} else {
+				// Keep error pages in memory so they can be inspected with `cf_https_response_content`.
+				return true;
+			}
+			if (!request->file) return false;
+		}
+		if (cf_fs_write(request->file, response->content.c_str(), (size_t)size) != (size_t)size) {
+			return false;
+		}
 	} else {
-		s = String::fmt(
-			"GET %s HTTP/1.1\r\n"
-			"Host: %s\r\n"
-			"Connection: close\r\n"
-			"TE: trailers, deflate, gzip\r\n"
-			"\r\n",
-			request->uri, request->host
-		);
+		CF_HttpsRequest handle;
+		handle.id = (uint64_t)request;
+		request->body_fn(handle, response->content.c_str(), size, request->body_udata);
 	}
 
-	if (tls_send(request->connection, s.c_str(), s.len()) < 0) {
-		request->result = CF_HTTPS_RESULT_SOCKET_ERROR;
-		return;
-	}
+	request->received += size;
+	response->content.clear();
+	return true;
+}
 
-	// Receive all response bytes.
+// Returns false if the connection dropped before any of the response arrived, otherwise sets the request's result.
+static bool s_receive(Coroutine co, CF_Request* request)
+{
 	CF_Response* response = &request->response;
 	CF_Coroutine decoder = make_coroutine(s_decode, 0, response);
 	char buf[TLS_MAX_PACKET_SIZE];
+	bool received = false;
 	while (1) {
 		TLS_State state = tls_process(request->connection);
-		if (state == TLS_STATE_DISCONNECTED) {
-			tls_disconnect(request->connection);
-			request->connection.id = 0;
-			break;
+		if (state == TLS_STATE_DISCONNECTED || state < 0) {
+			destroy_coroutine(decoder);
+			if (!received) return false;
+			// Only a body without any framing is allowed to end with the connection.
+			if (!response->until_close) {
+				request->result = CF_HTTPS_RESULT_SOCKET_ERROR;
+			} else {
+				request->result = s_body_complete(response) ? CF_HTTPS_RESULT_OK : CF_HTTPS_RESULT_FAILED;
+			}
+			response->close = true;
+			return true;
 		}
 
 		int bytes = tls_read(request->connection, buf, sizeof(buf));
 		if (bytes < 0) {
-			request->result = CF_HTTPS_RESULT_SOCKET_ERROR;
 			destroy_coroutine(decoder);
-			return;
+			if (!received) return false;
+			request->result = CF_HTTPS_RESULT_SOCKET_ERROR;
+			return true;
 		}
 		if (bytes) {
 			// Parse the response as it arrives, packet-by-packet.
+			received = true;
 			response->in = buf;
 			response->end = buf + bytes;
-			response->parse.clear();
 			coroutine_resume(decoder); // s_decode
-			if (!response->ok) {
+			if (!response->ok || !s_stream(request)) {
 				request->result = CF_HTTPS_RESULT_FAILED;
 				destroy_coroutine(decoder);
-				return;
+				return true;
 			}
+			if (coroutine_state(decoder) == COROUTINE_STATE_DEAD) {
+				// The whole response arrived, the connection stays open for reuse.
+				request->result = CF_HTTPS_RESULT_OK;
+				if (response->in != response->end) {
+					// Unexpected trailing bytes, don't trust the connection for another request.
+					response->close = true;
+				}
+				destroy_coroutine(decoder);
+				return true;
+			}
+		} else {
+			coroutine_yield(co);
 		}
-		coroutine_yield(co);
 	}
+}
 
-	request->result = CF_HTTPS_RESULT_OK;
-	destroy_coroutine(decoder);
+static void s_https_process(Coroutine co)
+{
+	CF_Request* request = (CF_Request*)coroutine_get_udata(co);
+
+	// Compress the body, unless it doesn't get any smaller.
+	const char* content = (const char*)request->content;
+	int content_length = request->content_length;
+	Array<uint8_t> compressed;
+	if (content && request->gzip_content) {
+		s_gzip(&compressed, (const uint8_t*)content, content_length);
+		if (compressed.count() < content_length) {
+			content = (const char*)compressed.data();
+			content_length = compressed.count();
+		} else {
+			compressed.clear();
+		}
+	}
+
+	// Build the HTTP request.
+	String s = String::fmt(
+		"%s %s HTTP/1.1\r\n"
+		"Host: %s\r\n"
+		"Connection: keep-alive\r\n"
+		"TE: trailers, deflate, gzip\r\n",
+		content ? "POST" : "GET", request->uri, request->host
+	);
+	if (content) {
+		s.fmt_append("Content-Length: %d\r\n", content_length);
+	}
+	if (compressed.count()) {
+		s.append("Content-Encoding: gzip\r\n");
+	}
+	bool accept_encoding = false;
+	for (int i = 0; i < request->headers.size(); ++i) {
+		s.fmt_append("%s: %s\r\n", request->headers[i].name, request->headers[i].value);
+		if (!CF_STRICMP(request->headers[i].name, "Accept-Encoding")) accept_encoding = true;
+	}
+	if (!accept_encoding && !request->download) {
+		// Ask for a compressed body, decoded as it arrives. Downloads are left alone, since resuming them needs byte
+		// ranges of the file itself.
+		s.append("Accept-Encoding: gzip, deflate\r\n");
+		request->response.decode_content = true;
+	}
+	if (request->download && request->resume) {
+		// Only ask for the bytes missing from a previously interrupted download.
+		CF_Stat stat;
+		if (!cf_is_error(cf_fs_stat(request->download_path.c_str(), &stat)) && stat.size) {
+			request->offset = stat.size;
+			s.fmt_append("Range: bytes=%" PRIu64 "-\r\n", request->offset);
+		}
+	}
+	s.append("\r\n");
+	if (content) {
+		s.append(content, content + content_length);
+	}
+
+	// Reuse an idle connection to the same host if possible. The server may have closed it in the
+	// meantime without us noticing yet, so if it drops before responding retry once on a fresh one.
+	bool reused = s_take_idle(request);
+	while (1) {
+		if (!reused && !s_connect(co, request)) {
+			return;
+		}
+
+		if (tls_send(request->connection, s.c_str(), s.len()) >= 0 && s_receive(co, request)) {
+			break;
+		}
+
+		tls_disconnect(request->connection);
+		request->connection.id = 0;
+		if (!reused) {
+			request->result = CF_HTTPS_RESULT_SOCKET_ERROR;
+			return;
+		}
+		reused = false;
+	}
+
+	if (request->download && request->result == CF_HTTPS_RESULT_OK) {
+		if (!request->file && request->response.code == 200) {
+			// Empty body, still produce the (empty) file.
+			request->file = cf_fs_open_file_for_write(request->download_path.c_str());
+			if (!request->file) request->result = CF_HTTPS_RESULT_FAILED;
+		}
+		if (request->file) {
+			cf_fs_close(request->file);
+			request->file = NULL;
+		}
+	}
+
+	if (request->result == CF_HTTPS_RESULT_OK && !request->response.close && !request->response.until_close) {
+		s_release_idle(request);
+	}
+}
+
+static int s_live_request_count;
+
+int cf_https_live_request_count()
+{
+	return s_live_request_count;
 }
 
 static CF_Request* s_request(const char* host, int port, const char* uri, const void* content, int content_length, bool verify_cert)
 {
+	s_live_request_count++;
 	CF_Request* request = CF_NEW(CF_Request);
 	request->host = host;
 	request->port = port;
@@ -433,18 +1030,67 @@ CF_HttpsRequest cf_https_post(const char* host, int port, const char* uri, const
 	return result;
 }
 
+CF_HttpsRequest cf_https_download(const char* host, int port, const char* uri, const char* virtual_path, bool resume, bool verify_cert)
+{
+	CF_Request* request = s_request(host, port, uri, NULL, 0, verify_cert);
+	request->download = true;
+	request->resume = resume;
+	request->download_path = virtual_path;
+	CF_HttpsRequest result;
+	result.id = (uint64_t)request;
+	return result;
+}
+
+void cf_https_set_body_callback(CF_HttpsRequest request_handle, CF_HttpsBodyFn* fn, void* udata)
+{
+	CF_Request* request = (CF_Request*)request_handle.id;
+	request->body_fn = fn;
+	request->body_udata = udata;
+}
+
+void cf_https_set_gzip_content(CF_HttpsRequest request_handle, bool gzip)
+{
+	CF_Request* request = (CF_Request*)request_handle.id;
+	request->gzip_content = gzip;
+}
+
+void cf_https_progress(CF_HttpsRequest request_handle, uint64_t* received, uint64_t* total)
+{
+	CF_Request* request = (CF_Request*)request_handle.id;
+	CF_Response* response = &request->response;
+	// A full response (not a range) starts over from scratch.
+	uint64_t offset = response->code == 200 ? 0 : request->offset;
+	// Compressed bodies are counted before decompression, to line up with the total.
+	uint64_t body = response->decoder ? response->body_received : request->received;
+	if (received) *received = offset + body;
+	if (total) *total = response->has_content_length ? offset + response->content_length : 0;
+}
+
 void cf_https_destroy(CF_HttpsRequest request_handle)
 {
 	CF_Request* request = (CF_Request*)request_handle.id;
 	if (request->connection.id) tls_disconnect(request->connection);
+	if (request->file) cf_fs_close(request->file);
 	destroy_coroutine(request->co);
 	for (int i = 0; i < request->response.headers.count(); ++i) {
 		CF_HttpsHeader header = request->response.headers.items()[i];
 		char* val = (char*)header.value;
 		sfree(val); // This was stolen earlier from a String, so we manually cleanup here.
 	}
+	if (request->response.decoder) {
+		request->response.decoder->~CF_BodyDecoder();
+		cf_free(request->response.decoder);
+	}
 	request->~CF_Request();
 	cf_free(request);
+	s_live_request_count--;
+}
+
+void cf_https_close_idle_connections()
+{
+	while (s_idle_count) {
+		s_remove_idle(s_idle_count - 1);
+	}
 }
 
 void cf_https_add_header(CF_HttpsRequest request_handle, const char* name, const char* value)
@@ -457,6 +1103,8 @@ void cf_https_add_header(CF_HttpsRequest request_handle, const char* name, const
 
 CF_HttpsResult cf_https_process(CF_HttpsRequest request_handle)
 {
+	CF_PROFILE_SCOPE("cf_https_process");
+	CF_ALLOC_TAG_SCOPE("net");
 	CF_Request* request = (CF_Request*)request_handle.id;
 	coroutine_resume(request->co); // s_https_process
 	return request->result;
@@ -506,8 +1154,224 @@ htbl const CF_HttpsHeader* cf_https_response_headers(CF_HttpsResponse response_h
 	return response->headers.items();
 }
 
+//--------------------------------------------------------------------------------------------------
+// Processing requests on a background network thread.
+
+#define CF_HTTPS_DEFAULT_MAX_CONCURRENT 8
+#define CF_HTTPS_WAIT_MS                10
+
+struct CF_HttpsAsync
+{
+	CF_Mutex lock;
+	CF_ConditionVariable cv;
+	CF_Thread* thread = NULL;
+	bool running = true;
+	int max_concurrent = CF_HTTPS_DEFAULT_MAX_CONCURRENT;
+	// Submitted requests waiting for a free slot, read front to back starting at `pending_index`.
+	Array<CF_Request*> pending;
+	int pending_index = 0;
+	Array<CF_Request*> finished;
+	// Every request submitted but not yet handed to its callback.
+	int outstanding = 0;
+};
+
+static CF_HttpsAsync* s_async;
+
+static int s_network_thread(void* udata)
+{
+	CF_ALLOC_TAG_SCOPE("net");
+	CF_HttpsAsync* async = (CF_HttpsAsync*)udata;
+	Array<CF_Request*> active;
+	Array<TLS_Connection> connections;
+	while (1) {
+		// Admit waiting requests up to the concurrency limit, or sleep until there's work.
+		cf_mutex_lock(&async->lock);
+		while (async->running && !active.count() && async->pending_index == async->pending.count()) {
+			cf_cv_wait(&async->cv, &async->lock);
+		}
+		if (!async->running) {
+			cf_mutex_unlock(&async->lock);
+			break;
+		}
+		while (active.count() < async->max_concurrent && async->pending_index < async->pending.count()) {
+			active.add(async->pending[async->pending_index++]);
+		}
+		if (async->pending_index == async->pending.count()) {
+			async->pending.clear();
+			async->pending_index = 0;
+		}
+		cf_mutex_unlock(&async->lock);
+
+		// Drive each request as far as it goes without blocking.
+		for (int i = 0; i < active.count();) {
+			CF_Request* request = active[i];
+			coroutine_resume(request->co); // s_https_process
+			if (request->result != CF_HTTPS_RESULT_PENDING) {
+				cf_mutex_lock(&async->lock);
+				async->finished.add(request);
+				cf_mutex_unlock(&async->lock);
+				active.unordered_remove(i);
+			} else {
+				++i;
+			}
+		}
+
+		// Sleep until a socket is ready instead of spinning. The timeout bounds how long newly submitted
+		// requests wait to be admitted.
+		if (active.count()) {
+			connections.clear();
+			for (int i = 0; i < active.count(); ++i) {
+				if (active[i]->connection.id) connections.add(active[i]->connection);
+			}
+			tls_wait(connections.data(), connections.count(), CF_HTTPS_WAIT_MS);
+		}
+	}
+	return 0;
+}
+
+static CF_HttpsAsync* s_get_async()
+{
+	if (!s_async) {
+		s_async = CF_NEW(CF_HttpsAsync);
+		s_async->lock = cf_make_mutex();
+		s_async->cv = cf_make_cv();
+		s_async->thread = cf_thread_create(s_network_thread, "CF network", s_async);
+	}
+	return s_async;
+}
+
+void cf_https_process_async(CF_HttpsRequest request_handle, CF_HttpsDoneFn* fn, void* udata)
+{
+	CF_Request* request = (CF_Request*)request_handle.id;
+	request->done_fn = fn;
+	request->done_udata = udata;
+	CF_HttpsAsync* async = s_get_async();
+	cf_mutex_lock(&async->lock);
+	async->pending.add(request);
+	async->outstanding++;
+	cf_mutex_unlock(&async->lock);
+	cf_cv_wake_one(&async->cv);
+}
+
+int cf_https_poll_async(int max_count)
+{
+	CF_HttpsAsync* async = s_async;
+	if (!async) return 0;
+
+	Array<CF_Request*> finished;
+	cf_mutex_lock(&async->lock);
+	int count = async->finished.count();
+	if (max_count > 0 && count > max_count) count = max_count;
+	for (int i = 0; i < count; ++i) {
+		finished.add(async->finished[i]);
+	}
+	int remaining = async->finished.count() - count;
+	if (remaining) CF_MEMMOVE(async->finished.data(), async->finished.data() + count, sizeof(CF_Request*) * remaining);
+	async->finished.set_count(remaining);
+	async->outstanding -= count;
+	cf_mutex_unlock(&async->lock);
+
+	for (int i = 0; i < finished.count(); ++i) {
+		CF_Request* request = finished[i];
+		if (request->done_fn) {
+			CF_HttpsRequest handle;
+			handle.id = (uint64_t)request;
+			request->done_fn(handle, request->result, request->done_udata);
+		}
+	}
+	return finished.count();
+}
+
+int cf_https_async_pending_count()
+{
+	CF_HttpsAsync* async = s_async;
+	if (!async) return 0;
+	cf_mutex_lock(&async->lock);
+	int count = async->outstanding;
+	cf_mutex_unlock(&async->lock);
+	return count;
+}
+
+void cf_https_set_max_concurrent_requests(int max_concurrent)
+{
+	CF_HttpsAsync* async = s_get_async();
+	cf_mutex_lock(&async->lock);
+	async->max_concurrent = max(max_concurrent, 1);
+	cf_mutex_unlock(&async->lock);
+	cf_cv_wake_one(&async->cv);
+}
+
+// A coroutine parked in `cf_https_wait`. Lives on that coroutine's stack until it's woken.
+struct CF_HttpsWait
+{
+	CF_Coroutine co;
+	CF_HttpsResult result;
+};
+
+static int s_https_wait_count;
+
+static void s_https_wait_done(CF_HttpsRequest request, CF_HttpsResult result, void* udata)
+{
+	CF_UNUSED(request);
+	CF_HttpsWait* wait = (CF_HttpsWait*)udata;
+	wait->result = result;
+	s_https_wait_count--;
+	cf_coroutine_wake(wait->co);
+}
+
+static void s_https_scheduler_poll()
+{
+	if (s_https_wait_count) {
+		cf_https_poll_async(0);
+	}
+}
+
+CF_HttpsResult cf_https_wait(CF_Coroutine co, CF_HttpsRequest request)
+{
+	static bool s_poll_added = false;
+	if (!s_poll_added) {
+		cf_coroutine_scheduler_add_poll(s_https_scheduler_poll);
+		s_poll_added = true;
+	}
+	CF_HttpsWait wait;
+	wait.co = co;
+	wait.result = CF_HTTPS_RESULT_PENDING;
+	s_https_wait_count++;
+	cf_https_process_async(request, s_https_wait_done, &wait);
+	cf_coroutine_wait_woken(co);
+	return wait.result;
+}
+
+void cf_https_shutdown()
+{
+	CF_HttpsAsync* async = s_async;
+	if (async) {
+		// Requests still in flight stay suspended, they belong to the user and are freed by `cf_https_destroy`.
+		cf_mutex_lock(&async->lock);
+		async->running = false;
+		cf_mutex_unlock(&async->lock);
+		cf_cv_wake_all(&async->cv);
+		cf_thread_wait(async->thread);
+		cf_destroy_mutex(&async->lock);
+		cf_destroy_cv(&async->cv);
+		async->~CF_HttpsAsync();
+		CF_FREE(async);
+		s_async = NULL;
+	}
+	cf_https_close_idle_connections();
+}
+
 #else // CF_EMSCRIPTEN
 
+void cf_https_shutdown()
+{
+}
+
+int cf_https_live_request_count()
+{
+	return 0;
+}
+
 #endif // CF_EMSCRIPTEN
 
 namespace Cute
@@ -13,6 +13,14 @@
 
 #include <internal/cute_alloc_internal.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_IMAGE_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_IMAGE_NEON
+#endif
+
 CF_STATIC_ASSERT(sizeof(CF_Pixel) == sizeof(cp_pixel_t), "Must be equal.");
 CF_STATIC_ASSERT(sizeof(CF_Image) == sizeof(cp_image_t), "Must be equal.");
 CF_STATIC_ASSERT(sizeof(CF_ImageIndexed) == sizeof(cp_indexed_image_t), "Must be equal.");
@@ -37,6 +45,26 @@ CF_Result cf_image_load_png_from_memory(const void* data, int size, CF_Image* im
 	return cf_result_success();
 }
 
+CF_Result cf_image_load_png_premultiplied(const char* path, CF_Image* img)
+{
+	size_t sz;
+	void* data = cf_fs_read_entire_file_to_memory(path, &sz);
+	if (!data) return cf_result_error("Unable to open png file.");
+	CF_Result err = cf_image_load_png_from_memory_premultiplied(data, (int)sz, img);
+	CF_FREE(data);
+	return err;
+}
+
+CF_Result cf_image_load_png_from_memory_premultiplied(const void* data, int size, CF_Image* img)
+{
+	cp_image_t cp_img = cp_load_png_mem_premultiplied(data, size);
+	if (!cp_img.pix) return cf_result_error(cp_error_reason);
+	img->w = cp_img.w;
+	img->h = cp_img.h;
+	img->pix = (CF_Pixel*)cp_img.pix;
+	return cf_result_success();
+}
+
 CF_Result cf_image_load_png_wh(const void* data, int size, int* w, int* h)
 {
 	cp_load_png_wh(data, size, w, h);
@@ -83,13 +111,111 @@ CF_Image cf_image_depallete(CF_ImageIndexed* indexed_img)
 	return img;
 }
 
+// `x * a / 255` rounded down, exact for any two bytes `x` and `a`. Gives the same bytes as the float math in `cp_premultiply`.
+static CF_INLINE uint8_t s_mul_div_255(uint32_t x, uint32_t a)
+{
+	uint32_t t = x * a;
+	return (uint8_t)((t + (t >> 8) + 1) >> 8);
+}
+
+void cf_pixels_premultiply(CF_Pixel* pixels, int count)
+{
+	uint8_t* data = (uint8_t*)pixels;
+	int i = 0;
+#if defined(CF_IMAGE_SSE2)
+	// Two pixels per 16-bit half. Alpha multiplies by 255 to stay the same.
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i rgb_mask = _mm_setr_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+	const __m128i alpha_255 = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+	const __m128i one = _mm_set1_epi16(1);
+	for (; i + 4 <= count; i += 4) {
+		__m128i p = _mm_loadu_si128((const __m128i*)(data + i * 4));
+		__m128i halves[2] = { _mm_unpacklo_epi8(p, zero), _mm_unpackhi_epi8(p, zero) };
+		for (int j = 0; j < 2; ++j) {
+			__m128i x = halves[j];
+			__m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+			a = _mm_or_si128(_mm_and_si128(a, rgb_mask), alpha_255);
+			__m128i t = _mm_mullo_epi16(x, a);
+			halves[j] = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), one), 8);
+		}
+		_mm_storeu_si128((__m128i*)(data + i * 4), _mm_packus_epi16(halves[0], halves[1]));
+	}
+#elif defined(CF_IMAGE_NEON)
+	for (; i + 16 <= count; i += 16) {
+		uint8x16x4_t p = vld4q_u8(data + i * 4);
+		for (int j = 0; j < 3; ++j) {
+			uint16x8_t lo = vmull_u8(vget_low_u8(p.val[j]), vget_low_u8(p.val[3]));
+			uint16x8_t hi = vmull_u8(vget_high_u8(p.val[j]), vget_high_u8(p.val[3]));
+			lo = vaddq_u16(vaddq_u16(lo, vshrq_n_u16(lo, 8)), vdupq_n_u16(1));
+			hi = vaddq_u16(vaddq_u16(hi, vshrq_n_u16(hi, 8)), vdupq_n_u16(1));
+			p.val[j] = vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+		}
+		vst4q_u8(data + i * 4, p);
+	}
+#endif
+	for (; i < count; ++i) {
+		uint8_t* p = data + i * 4;
+		p[0] = s_mul_div_255(p[0], p[3]);
+		p[1] = s_mul_div_255(p[1], p[3]);
+		p[2] = s_mul_div_255(p[2], p[3]);
+	}
+}
+
+void cf_pixels_swap_red_blue(CF_Pixel* pixels, int count)
+{
+	uint32_t* data = (uint32_t*)pixels;
+	int i = 0;
+#if defined(CF_IMAGE_SSE2)
+	// Red is the low byte of each 32-bit pixel, since x86 is little-endian.
+	const __m128i green_alpha = _mm_set1_epi32((int)0xFF00FF00);
+	const __m128i low_byte = _mm_set1_epi32(0xFF);
+	for (; i + 4 <= count; i += 4) {
+		__m128i p = _mm_loadu_si128((const __m128i*)(data + i));
+		__m128i red = _mm_slli_epi32(_mm_and_si128(p, low_byte), 16);
+		__m128i blue = _mm_and_si128(_mm_srli_epi32(p, 16), low_byte);
+		_mm_storeu_si128((__m128i*)(data + i), _mm_or_si128(_mm_and_si128(p, green_alpha), _mm_or_si128(red, blue)));
+	}
+#elif defined(CF_IMAGE_NEON)
+	for (; i + 16 <= count; i += 16) {
+		uint8x16x4_t p = vld4q_u8((const uint8_t*)(data + i));
+		uint8x16_t t = p.val[0];
+		p.val[0] = p.val[2];
+		p.val[2] = t;
+		vst4q_u8((uint8_t*)(data + i), p);
+	}
+#endif
+	for (; i < count; ++i) {
+		uint8_t* p = (uint8_t*)(data + i);
+		uint8_t t = p[0];
+		p[0] = p[2];
+		p[2] = t;
+	}
+}
+
 void cf_image_premultiply(CF_Image* img)
 {
-	cp_premultiply((cp_image_t*)img);
+	cf_pixels_premultiply(img->pix, img->w * img->h);
+}
+
+void cf_image_swap_red_blue(CF_Image* img)
+{
+	cf_pixels_swap_red_blue(img->pix, img->w * img->h);
 }
 
 void cf_image_flip_horizontal(CF_Image* img)
 {
-	cp_flip_image_horizontal((cp_image_t*)img);
+	// Swap whole rows in chunks, rather than one pixel at a time.
+	uint8_t buffer[1024];
+	size_t stride = sizeof(CF_Pixel) * img->w;
+	for (int i = 0; i < img->h / 2; ++i) {
+		uint8_t* a = (uint8_t*)(img->pix + img->w * i);
+		uint8_t* b = (uint8_t*)(img->pix + img->w * (img->h - i - 1));
+		for (size_t offset = 0; offset < stride; offset += sizeof(buffer)) {
+			size_t size = stride - offset < sizeof(buffer) ? stride - offset : sizeof(buffer);
+			CF_MEMCPY(buffer, a + offset, size);
+			CF_MEMCPY(a + offset, b + offset, size);
+			CF_MEMCPY(b + offset, buffer, size);
+		}
+	}
 }
 
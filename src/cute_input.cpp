@@ -12,6 +12,8 @@
 
 #include <internal/cute_app_internal.h>
 #include <internal/cute_input_internal.h>
+#include <internal/cute_string_internal.h>
+#include <internal/cute_time_internal.h>
 #include <imgui/backends/imgui_impl_sdl.h>
 
 #include <SDL.h>
@@ -349,7 +351,7 @@ void cf_input_text_add_utf8(const char* text)
 {
 	while (*text) {
 		int cp;
-		text = cf_decode_UTF8(text, &cp);
+		text = cf_decode_UTF8_fast(text, &cp);
 		app->input_text.add((int)cp);
 	}
 }
@@ -445,242 +447,353 @@ static CF_JoypadInstance* s_joy(SDL_JoystickID id)
 	return NULL;
 }
 
-void cf_pump_input_msgs()
+// OS input waiting to be applied, see `cf_input_poll`.
+struct CF_QueuedInputEvent
 {
-	// Clear any necessary single-frame state and copy to `prev` states.
-	app->mouse.xrel = 0;
-	app->mouse.yrel = 0;
-	CF_MEMCPY(app->keys_prev, app->keys, sizeof(app->keys));
-	CF_MEMCPY(&app->mouse_prev, &app->mouse, sizeof(app->mouse));
-	CF_MEMCPY(&app->window_state_prev, &app->window_state, sizeof(app->window_state));
-	for (CF_ListNode* n = cf_list_begin(&app->joypads); n != cf_list_end(&app->joypads); n = n->next) {
-		CF_JoypadInstance* joypad = CF_LIST_HOST(CF_JoypadInstance, node, n);
-		CF_MEMCPY(joypad->buttons_prev, joypad->buttons, sizeof(joypad->buttons));
-	}
-	app->mouse.wheel_motion = 0;
-	app->window_state.moved = false;
-	app->window_state.restored = false;
-	app->window_state.resized = false;
+	SDL_Event event;
+	uint64_t ticks;
+};
 
-	// Update key durations to simulate "press and hold" style for `key_repeating`.
-	for (int i = 0; i < 512; ++i) {
-		if (!cf_key_down((CF_KeyButton)i)) {
-			app->keys_timestamp[i] = 0;
-		}
-	}
+static Array<CF_QueuedInputEvent> s_input_queue;
+static uint64_t s_input_last_ticks;
 
-	// Handle SDL messages.
+void cf_input_poll()
+{
+	// SDL stamps events in milliseconds since startup. Convert that to ticks by how long ago each
+	// event happened, and never let an event be stamped before one already queued.
+	uint64_t now = cf_get_ticks();
+	uint32_t now_ms = SDL_GetTicks();
+	uint64_t ticks_per_ms = cf_get_tick_frequency() / 1000;
 	SDL_Event event;
 	while (SDL_PollEvent(&event)) {
-		if (app->using_imgui) {
-			ImGui_ImplSDL2_ProcessEvent(&event);
-		}
+		int32_t age_ms = (int32_t)(now_ms - event.common.timestamp);
+		uint64_t age = (uint64_t)max(age_ms, 0) * ticks_per_ms;
+		uint64_t ticks = age < now ? now - age : 0;
+		ticks = max(ticks, s_input_last_ticks);
+		s_input_last_ticks = ticks;
+		CF_QueuedInputEvent& queued = s_input_queue.add();
+		queued.event = event;
+		queued.ticks = ticks;
+	}
+}
+
+static CF_InputEvent* s_add_event(CF_InputEventType type, uint64_t ticks)
+{
+	CF_InputEvent& e = app->input_events.add();
+	CF_MEMSET(&e, 0, sizeof(e));
+	e.type = type;
+	e.timestamp = (double)ticks / (double)cf_get_tick_frequency();
+	return &e;
+}
+
+static CF_MouseButton s_mouse_button(int button)
+{
+	switch (button) {
+	case SDL_BUTTON_RIGHT: return CF_MOUSE_BUTTON_RIGHT;
+	case SDL_BUTTON_MIDDLE: return CF_MOUSE_BUTTON_MIDDLE;
+	default: return CF_MOUSE_BUTTON_LEFT;
+	}
+}
+
+// Identifies the button an event presses or releases, or returns zero for any other event.
+static uint64_t s_button_id(const SDL_Event& event)
+{
+	switch (event.type) {
+	case SDL_KEYDOWN: case SDL_KEYUP: return ((uint64_t)1 << 48) | (uint64_t)event.key.keysym.scancode;
+	case SDL_MOUSEBUTTONDOWN: case SDL_MOUSEBUTTONUP: return ((uint64_t)2 << 48) | (uint64_t)event.button.button;
+	case SDL_CONTROLLERBUTTONDOWN: case SDL_CONTROLLERBUTTONUP: return ((uint64_t)3 << 48) | ((uint64_t)(uint32_t)event.cbutton.which << 8) | (uint64_t)event.cbutton.button;
+	default: return 0;
+	}
+}
+
+static void s_apply_event(const CF_QueuedInputEvent& queued)
+{
+	const SDL_Event& event = queued.event;
+	if (app->using_imgui) {
+		ImGui_ImplSDL2_ProcessEvent(&event);
+	}
 
-		switch (event.type)
+	switch (event.type)
+	{
+	case SDL_QUIT:
+		app->running = false;
+		break;
+
+	case SDL_WINDOWEVENT:
+		switch (event.window.event)
 		{
-		case SDL_QUIT:
-			app->running = false;
+		case SDL_WINDOWEVENT_RESIZED:
+			app->window_state.resized = true;
+			app->w = event.window.data1;
+			app->h = event.window.data2;
 			break;
 
-		case SDL_WINDOWEVENT:
-			switch (event.window.event)
-			{
-			case SDL_WINDOWEVENT_RESIZED:
-				app->window_state.resized = true;
-				app->w = event.window.data1;
-				app->h = event.window.data2;
-				break;
-
-			case SDL_WINDOWEVENT_MOVED:
-				app->window_state.moved = true;
-				app->x = event.window.data1;
-				app->y = event.window.data2;
-				break;
-
-			case SDL_WINDOWEVENT_MINIMIZED:
-				app->window_state.minimized = true;
-				break;
-
-			case SDL_WINDOWEVENT_MAXIMIZED:
-				app->window_state.maximized = true;
-				break;
-
-			case SDL_WINDOWEVENT_RESTORED:
-				app->window_state.restored = true;
-				break;
-
-			case SDL_WINDOWEVENT_ENTER:
-				app->window_state.mouse_inside_window = true;
-				break;
-
-			case SDL_WINDOWEVENT_LEAVE:
-				app->window_state.mouse_inside_window = false;
-				break;
-
-			case SDL_WINDOWEVENT_FOCUS_GAINED:
-				app->window_state.has_keyboard_focus = true;
-				break;
-
-			case SDL_WINDOWEVENT_FOCUS_LOST:
-				app->window_state.has_keyboard_focus = false;
-				break;
-			}
+		case SDL_WINDOWEVENT_MOVED:
+			app->window_state.moved = true;
+			app->x = event.window.data1;
+			app->y = event.window.data2;
 			break;
 
-		case SDL_KEYDOWN:
-		{
-			if (event.key.repeat) continue;
-			int key = SDL_GetKeyFromScancode(event.key.keysym.scancode);
-			key = s_map_SDL_keys(key);
-			CF_ASSERT(key >= 0 && key < 512);
-			app->keys[key] = 1;
-			app->keys[KEY_ANY] = 1;
-			app->keys_timestamp[key] = app->keys_timestamp[KEY_ANY] = CF_SECONDS;
-			if (app->key_callback) app->key_callback((CF_KeyButton)key, true);
-		}	break;
-
-		case SDL_KEYUP:
-		{
-			if (event.key.repeat) continue;
-			int key = SDL_GetKeyFromScancode(event.key.keysym.scancode);
-			key = s_map_SDL_keys(key);
-			CF_ASSERT(key >= 0 && key < 512);
-			app->keys[key] = 0;
-			if (app->key_callback) app->key_callback((CF_KeyButton)key, false);
-		}	break;
-
-		case SDL_TEXTINPUT:
-		{
-			cf_input_text_add_utf8(event.text.text);
-			app->ime_composition.clear();
-			app->ime_composition_cursor = 0;
-			app->ime_composition_selection_len = 0;
-		}	break;
+		case SDL_WINDOWEVENT_MINIMIZED:
+			app->window_state.minimized = true;
+			break;
 
-		case SDL_TEXTEDITING:
-		{
-			const char* text = event.edit.text;
-			while (*text) app->ime_composition.add(*text++);
-			app->ime_composition_cursor = event.edit.start;
-			app->ime_composition_selection_len = event.edit.length;
-		}	break;
-
-		case SDL_MOUSEMOTION:
-			app->mouse.x = event.motion.x;
-			app->mouse.y = event.motion.y;
-			app->mouse.xrel = event.motion.xrel;
-			app->mouse.yrel = -event.motion.yrel;
+		case SDL_WINDOWEVENT_MAXIMIZED:
+			app->window_state.maximized = true;
 			break;
 
-		case SDL_MOUSEBUTTONDOWN:
-			switch (event.button.button)
-			{
-			case SDL_BUTTON_LEFT: app->mouse.left_button = 1; break;
-			case SDL_BUTTON_RIGHT: app->mouse.right_button = 1; break;
-			case SDL_BUTTON_MIDDLE: app->mouse.middle_button = 1; break;
-			}
-			app->mouse.x = event.button.x;
-			app->mouse.y = event.button.y;
-			if (event.button.clicks == 1) {
-				app->mouse.click_type = CF_MOUSE_CLICK_SINGLE;
-			} else if (event.button.clicks == 2) {
-				app->mouse.click_type = CF_MOUSE_CLICK_DOUBLE;
-			}
+		case SDL_WINDOWEVENT_RESTORED:
+			app->window_state.restored = true;
 			break;
 
-		case SDL_MOUSEBUTTONUP:
-			switch (event.button.button)
-			{
-			case SDL_BUTTON_LEFT: app->mouse.left_button = 0; break;
-			case SDL_BUTTON_RIGHT: app->mouse.right_button = 0; break;
-			case SDL_BUTTON_MIDDLE: app->mouse.middle_button = 0; break;
-			}
-			app->mouse.x = event.button.x;
-			app->mouse.y = event.button.y;
-			if (event.button.clicks == 1) {
-				app->mouse.click_type = CF_MOUSE_CLICK_SINGLE;
-			} else if (event.button.clicks == 2) {
-				app->mouse.click_type = CF_MOUSE_CLICK_DOUBLE;
-			}
+		case SDL_WINDOWEVENT_ENTER:
+			app->window_state.mouse_inside_window = true;
 			break;
 
-		case SDL_MOUSEWHEEL:
-			app->mouse.wheel_motion = event.wheel.y;
+		case SDL_WINDOWEVENT_LEAVE:
+			app->window_state.mouse_inside_window = false;
 			break;
 
-		case SDL_CONTROLLERBUTTONUP:
-		{
-			SDL_JoystickID id = event.cbutton.which;
-			CF_JoypadInstance* joypad = s_joy(id);
-			if (joypad) {
-				int button = (int)event.cbutton.button;
-				CF_ASSERT(button >= 0 && button < CF_JOYPAD_BUTTON_COUNT);
-				joypad->buttons[button] = 0;
-			}
-		}	break;
+		case SDL_WINDOWEVENT_FOCUS_GAINED:
+			app->window_state.has_keyboard_focus = true;
+			break;
 
-		case SDL_CONTROLLERBUTTONDOWN:
-		{
-			SDL_JoystickID id = event.cbutton.which;
-			CF_JoypadInstance* joypad = s_joy(id);
-			if (joypad) {
-				int button = (int)event.cbutton.button;
-				CF_ASSERT(button >= 0 && button < CF_JOYPAD_BUTTON_COUNT);
-				joypad->buttons[button] = 1;
-			}
-		}	break;
+		case SDL_WINDOWEVENT_FOCUS_LOST:
+			app->window_state.has_keyboard_focus = false;
+			break;
+		}
+		break;
+
+	case SDL_KEYDOWN:
+	{
+		if (event.key.repeat) break;
+		int key = SDL_GetKeyFromScancode(event.key.keysym.scancode);
+		key = s_map_SDL_keys(key);
+		CF_ASSERT(key >= 0 && key < 512);
+		app->keys[key] = 1;
+		app->keys[KEY_ANY] = 1;
+		app->keys_timestamp[key] = app->keys_timestamp[KEY_ANY] = CF_SECONDS;
+		s_add_event(CF_INPUT_EVENT_TYPE_KEY_PRESSED, queued.ticks)->key = (CF_KeyButton)key;
+		if (app->key_callback) app->key_callback((CF_KeyButton)key, true);
+	}	break;
+
+	case SDL_KEYUP:
+	{
+		if (event.key.repeat) break;
+		int key = SDL_GetKeyFromScancode(event.key.keysym.scancode);
+		key = s_map_SDL_keys(key);
+		CF_ASSERT(key >= 0 && key < 512);
+		app->keys[key] = 0;
+		s_add_event(CF_INPUT_EVENT_TYPE_KEY_RELEASED, queued.ticks)->key = (CF_KeyButton)key;
+		if (app->key_callback) app->key_callback((CF_KeyButton)key, false);
+	}	break;
+
+	case SDL_TEXTINPUT:
+	{
+		cf_input_text_add_utf8(event.text.text);
+		app->ime_composition.clear();
+		app->ime_composition_cursor = 0;
+		app->ime_composition_selection_len = 0;
+	}	break;
 
-		case SDL_CONTROLLERAXISMOTION:
+	case SDL_TEXTEDITING:
+	{
+		const char* text = event.edit.text;
+		while (*text) app->ime_composition.add(*text++);
+		app->ime_composition_cursor = event.edit.start;
+		app->ime_composition_selection_len = event.edit.length;
+	}	break;
+
+	case SDL_MOUSEMOTION:
+		app->mouse.x = event.motion.x;
+		app->mouse.y = event.motion.y;
+		app->mouse.xrel = event.motion.xrel;
+		app->mouse.yrel = -event.motion.yrel;
+		break;
+
+	case SDL_MOUSEBUTTONDOWN:
+		switch (event.button.button)
 		{
-			SDL_JoystickID id = event.caxis.which;
-			CF_JoypadInstance* joypad = s_joy(id);
-			if (joypad) {
-				int axis = (int)event.caxis.axis;
-				int value = (int)event.caxis.value;
-				CF_ASSERT(axis >= 0 && axis < CF_JOYPAD_AXIS_COUNT);
-				joypad->axes[axis] = value;
-			}
-		}	break;
+		case SDL_BUTTON_LEFT: app->mouse.left_button = 1; break;
+		case SDL_BUTTON_RIGHT: app->mouse.right_button = 1; break;
+		case SDL_BUTTON_MIDDLE: app->mouse.middle_button = 1; break;
+		}
+		if (event.button.button >= SDL_BUTTON_LEFT && event.button.button <= SDL_BUTTON_RIGHT) {
+			s_add_event(CF_INPUT_EVENT_TYPE_MOUSE_PRESSED, queued.ticks)->mouse_button = s_mouse_button(event.button.button);
+		}
+		app->mouse.x = event.button.x;
+		app->mouse.y = event.button.y;
+		if (event.button.clicks == 1) {
+			app->mouse.click_type = CF_MOUSE_CLICK_SINGLE;
+		} else if (event.button.clicks == 2) {
+			app->mouse.click_type = CF_MOUSE_CLICK_DOUBLE;
+		}
+		break;
 
-		case SDL_FINGERDOWN:
+	case SDL_MOUSEBUTTONUP:
+		switch (event.button.button)
 		{
-			uint64_t id = (uint64_t)event.tfinger.fingerId;
-			s_touch_remove(id);
+		case SDL_BUTTON_LEFT: app->mouse.left_button = 0; break;
+		case SDL_BUTTON_RIGHT: app->mouse.right_button = 0; break;
+		case SDL_BUTTON_MIDDLE: app->mouse.middle_button = 0; break;
+		}
+		if (event.button.button >= SDL_BUTTON_LEFT && event.button.button <= SDL_BUTTON_RIGHT) {
+			s_add_event(CF_INPUT_EVENT_TYPE_MOUSE_RELEASED, queued.ticks)->mouse_button = s_mouse_button(event.button.button);
+		}
+		app->mouse.x = event.button.x;
+		app->mouse.y = event.button.y;
+		if (event.button.clicks == 1) {
+			app->mouse.click_type = CF_MOUSE_CLICK_SINGLE;
+		} else if (event.button.clicks == 2) {
+			app->mouse.click_type = CF_MOUSE_CLICK_DOUBLE;
+		}
+		break;
+
+	case SDL_MOUSEWHEEL:
+		app->mouse.wheel_motion = event.wheel.y;
+		break;
+
+	case SDL_CONTROLLERBUTTONUP:
+	{
+		SDL_JoystickID id = event.cbutton.which;
+		CF_JoypadInstance* joypad = s_joy(id);
+		if (joypad) {
+			int button = (int)event.cbutton.button;
+			CF_ASSERT(button >= 0 && button < CF_JOYPAD_BUTTON_COUNT);
+			joypad->buttons[button] = 0;
+			CF_InputEvent* e = s_add_event(CF_INPUT_EVENT_TYPE_JOYPAD_RELEASED, queued.ticks);
+			e->joypad.id = (uint64_t)joypad;
+			e->joypad_button = (CF_JoypadButton)button;
+		}
+	}	break;
+
+	case SDL_CONTROLLERBUTTONDOWN:
+	{
+		SDL_JoystickID id = event.cbutton.which;
+		CF_JoypadInstance* joypad = s_joy(id);
+		if (joypad) {
+			int button = (int)event.cbutton.button;
+			CF_ASSERT(button >= 0 && button < CF_JOYPAD_BUTTON_COUNT);
+			joypad->buttons[button] = 1;
+			CF_InputEvent* e = s_add_event(CF_INPUT_EVENT_TYPE_JOYPAD_PRESSED, queued.ticks);
+			e->joypad.id = (uint64_t)joypad;
+			e->joypad_button = (CF_JoypadButton)button;
+		}
+	}	break;
+
+	case SDL_CONTROLLERAXISMOTION:
+	{
+		SDL_JoystickID id = event.caxis.which;
+		CF_JoypadInstance* joypad = s_joy(id);
+		if (joypad) {
+			int axis = (int)event.caxis.axis;
+			int value = (int)event.caxis.value;
+			CF_ASSERT(axis >= 0 && axis < CF_JOYPAD_AXIS_COUNT);
+			joypad->axes[axis] = value;
+			CF_InputEvent* e = s_add_event(CF_INPUT_EVENT_TYPE_JOYPAD_AXIS, queued.ticks);
+			e->joypad.id = (uint64_t)joypad;
+			e->joypad_axis = (CF_JoypadAxis)axis;
+			e->axis_value = value;
+		}
+	}	break;
+
+	case SDL_FINGERDOWN:
+	{
+		uint64_t id = (uint64_t)event.tfinger.fingerId;
+		s_touch_remove(id);
+		CF_Touch& touch = app->touches.add();
+		touch.id = id;
+		touch.pressure = event.tfinger.pressure;
+		touch.x = event.tfinger.x * app->w; // NOTE: Probably wrong for high-DPI.
+		touch.y = event.tfinger.y * app->h; // NOTE: Probably wrong for high-DPI.
+	}	break;
+
+	case SDL_FINGERMOTION:
+	{
+		uint64_t id = (uint64_t)event.tfinger.fingerId;
+		CF_Touch touch;
+		if (cf_touch_get(id, &touch)) {
+			touch.pressure = event.tfinger.pressure;
+			touch.x = event.tfinger.x * app->w; // NOTE: Probably wrong for high-DPI.
+			touch.y = event.tfinger.y * app->h; // NOTE: Probably wrong for high-DPI.
+		} else {
 			CF_Touch& touch = app->touches.add();
 			touch.id = id;
 			touch.pressure = event.tfinger.pressure;
 			touch.x = event.tfinger.x * app->w; // NOTE: Probably wrong for high-DPI.
 			touch.y = event.tfinger.y * app->h; // NOTE: Probably wrong for high-DPI.
-		}	break;
+		}
+	}	break;
 
-		case SDL_FINGERMOTION:
-		{
-			uint64_t id = (uint64_t)event.tfinger.fingerId;
-			CF_Touch touch;
-			if (cf_touch_get(id, &touch)) {
-				touch.pressure = event.tfinger.pressure;
-				touch.x = event.tfinger.x * app->w; // NOTE: Probably wrong for high-DPI.
-				touch.y = event.tfinger.y * app->h; // NOTE: Probably wrong for high-DPI.
+	case SDL_FINGERUP:
+	{
+		uint64_t id = (uint64_t)event.tfinger.fingerId;
+		s_touch_remove(id);
+	}	break;
+	}
+}
+
+void cf_pump_input_msgs()
+{
+	// Clear any necessary single-frame state and copy to `prev` states.
+	app->mouse.xrel = 0;
+	app->mouse.yrel = 0;
+	CF_MEMCPY(app->keys_prev, app->keys, sizeof(app->keys));
+	CF_MEMCPY(&app->mouse_prev, &app->mouse, sizeof(app->mouse));
+	CF_MEMCPY(&app->window_state_prev, &app->window_state, sizeof(app->window_state));
+	for (CF_ListNode* n = cf_list_begin(&app->joypads); n != cf_list_end(&app->joypads); n = n->next) {
+		CF_JoypadInstance* joypad = CF_LIST_HOST(CF_JoypadInstance, node, n);
+		CF_MEMCPY(joypad->buttons_prev, joypad->buttons, sizeof(joypad->buttons));
+	}
+	app->mouse.wheel_motion = 0;
+	app->window_state.moved = false;
+	app->window_state.restored = false;
+	app->window_state.resized = false;
+
+	// Update key durations to simulate "press and hold" style for `key_repeating`.
+	for (int i = 0; i < 512; ++i) {
+		if (!cf_key_down((CF_KeyButton)i)) {
+			app->keys_timestamp[i] = 0;
+		}
+	}
+
+	// Apply queued input up to the moment in time this update simulates, in the order it happened.
+	// The release of a button pressed earlier in this same update is held back for the next update,
+	// along with everything after it, so quick taps still register as a press.
+	cf_input_poll();
+	app->input_events.clear();
+	uint64_t end = cf_time_update_end_ticks();
+	uint64_t pressed[64];
+	int pressed_count = 0;
+	int applied = 0;
+	for (; applied < s_input_queue.count(); ++applied) {
+		const CF_QueuedInputEvent& queued = s_input_queue[applied];
+		if (queued.ticks > end) break;
+		uint64_t button = s_button_id(queued.event);
+		if (button) {
+			bool press = (queued.event.type == SDL_KEYDOWN && !queued.event.key.repeat) || queued.event.type == SDL_MOUSEBUTTONDOWN || queued.event.type == SDL_CONTROLLERBUTTONDOWN;
+			if (press) {
+				if (pressed_count < (int)CF_ARRAY_SIZE(pressed)) pressed[pressed_count++] = button;
 			} else {
-				CF_Touch& touch = app->touches.add();
-				touch.id = id;
-				touch.pressure = event.tfinger.pressure;
-				touch.x = event.tfinger.x * app->w; // NOTE: Probably wrong for high-DPI.
-				touch.y = event.tfinger.y * app->h; // NOTE: Probably wrong for high-DPI.
+				bool held_back = false;
+				for (int i = 0; i < pressed_count; ++i) {
+					if (pressed[i] == button) {
+						held_back = true;
+						break;
+					}
+				}
+				if (held_back) break;
 			}
-		}	break;
-
-		case SDL_FINGERUP:
-		{
-			uint64_t id = (uint64_t)event.tfinger.fingerId;
-			s_touch_remove(id);
-		}	break;
 		}
+		s_apply_event(queued);
 	}
+	int remaining = s_input_queue.count() - applied;
+	CF_MEMMOVE(s_input_queue.data(), s_input_queue.data() + applied, sizeof(CF_QueuedInputEvent) * remaining);
+	s_input_queue.set_count(remaining);
 
 	// Support held timer on KEY_ANY.
 	bool none_pressed = true;
-	for (int i = 0; i < CF_ARRAY_SIZE(app->keys); ++i) {
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(app->keys); ++i) {
 		if (i != KEY_ANY && app->keys[i]) {
 			none_pressed = false;
 			break;
@@ -691,6 +804,22 @@ void cf_pump_input_msgs()
 	}
 }
 
+int cf_input_event_get_all(CF_InputEvent** events)
+{
+	*events = app->input_events.data();
+	return app->input_events.count();
+}
+
+void cf_input_set_high_frequency_polling(bool true_to_enable)
+{
+	app->input_high_frequency_polling = true_to_enable;
+}
+
+bool cf_input_get_high_frequency_polling()
+{
+	return app->input_high_frequency_polling;
+}
+
 namespace Cute
 {
 	Array<CF_Touch> CF_CALL touch_get_all() { return app->touches; }
@@ -0,0 +1,200 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_interest.h>
+#include <cute_spatial_hash.h>
+#include <cute_alloc.h>
+#include <cute_array.h>
+
+#include <internal/cute_alloc_internal.h>
+
+#include <algorithm>
+#include <limits.h>
+
+using namespace Cute;
+
+struct CF_InterestClient
+{
+	bool has_view = false;
+	CF_Aabb view = { };
+
+	// Each sorted by entity index.
+	Array<int> visible;
+	Array<int> entered;
+	Array<int> left;
+
+	// Scratch space for `cf_interest_update`, kept to avoid allocating every tick.
+	Array<int> found;
+	Array<int> next;
+};
+
+struct CF_InterestInternal
+{
+	float leave_margin = 0;
+	CF_SpatialHash hash = { };
+	// The hash leaf of each entity, with an id of -1 for entities not present.
+	Array<CF_Leaf> leaves;
+	Array<CF_InterestClient> clients;
+};
+
+static CF_INLINE CF_InterestInternal* s_interest(CF_Interest interest)
+{
+	return (CF_InterestInternal*)interest.id;
+}
+
+static CF_InterestClient* s_client(CF_InterestInternal* interest, int client_index)
+{
+	CF_ASSERT(client_index >= 0);
+	if (client_index >= interest->clients.count()) interest->clients.set_count(client_index + 1);
+	return &interest->clients[client_index];
+}
+
+CF_Interest cf_make_interest(float cell_size, float leave_margin)
+{
+	CF_ASSERT(cell_size > 0 && leave_margin >= 0);
+	CF_InterestInternal* interest = CF_NEW(CF_InterestInternal);
+	interest->leave_margin = leave_margin;
+	interest->hash = cf_make_spatial_hash(cell_size, 0);
+	CF_Interest result;
+	result.id = (uint64_t)interest;
+	return result;
+}
+
+void cf_destroy_interest(CF_Interest interest_handle)
+{
+	CF_InterestInternal* interest = s_interest(interest_handle);
+	cf_destroy_spatial_hash(interest->hash);
+	interest->~CF_InterestInternal();
+	CF_FREE(interest);
+}
+
+void cf_interest_set_entity(CF_Interest interest_handle, int entity, CF_V2 position)
+{
+	CF_InterestInternal* interest = s_interest(interest_handle);
+	CF_ASSERT(entity >= 0);
+	while (interest->leaves.count() <= entity) interest->leaves.add({ -1 });
+	CF_Leaf* leaf = &interest->leaves[entity];
+	CF_Aabb aabb = cf_make_aabb(position, position);
+	if (leaf->id < 0) {
+		*leaf = cf_spatial_hash_insert(interest->hash, aabb, (void*)(uintptr_t)entity);
+	} else {
+		cf_spatial_hash_update(interest->hash, *leaf, aabb);
+	}
+}
+
+void cf_interest_remove_entity(CF_Interest interest_handle, int entity)
+{
+	CF_InterestInternal* interest = s_interest(interest_handle);
+	if (entity < 0 || entity >= interest->leaves.count() || interest->leaves[entity].id < 0) return;
+	cf_spatial_hash_remove(interest->hash, interest->leaves[entity]);
+	interest->leaves[entity].id = -1;
+}
+
+void cf_interest_set_view(CF_Interest interest_handle, int client_index, CF_Aabb view)
+{
+	CF_InterestClient* client = s_client(s_interest(interest_handle), client_index);
+	client->has_view = true;
+	client->view = view;
+}
+
+void cf_interest_remove_view(CF_Interest interest_handle, int client_index)
+{
+	CF_InterestInternal* interest = s_interest(interest_handle);
+	if (client_index < 0 || client_index >= interest->clients.count()) return;
+	interest->clients[client_index].has_view = false;
+}
+
+// Found entities are stored as `entity << 1`, with the low bit set if the entity is inside the view itself and
+// not just the leave margin around it.
+static bool s_found_fn(CF_Leaf leaf, CF_Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	CF_UNUSED(leaf);
+	CF_InterestClient* client = (CF_InterestClient*)fn_udata;
+	int entity = (int)(uintptr_t)leaf_udata;
+	bool in_view = cf_contains_point(client->view, aabb.min);
+	client->found.add((entity << 1) | (in_view ? 1 : 0));
+	return true;
+}
+
+static void CF_CALL s_update_fn(int begin, int end, void* udata)
+{
+	CF_InterestInternal* interest = (CF_InterestInternal*)udata;
+	for (int c = begin; c < end; ++c) {
+		CF_InterestClient* client = &interest->clients[c];
+		client->found.clear();
+		client->next.clear();
+		client->entered.clear();
+		client->left.clear();
+		if (client->has_view) {
+			cf_spatial_hash_query_aabb(interest->hash, s_found_fn, cf_expand_aabb_f(client->view, interest->leave_margin), client);
+			std::sort(client->found.begin(), client->found.end());
+		}
+
+		// Merge with what was visible: new entities enter only from inside the view, and visible ones stay until
+		// they're past the margin.
+		const Array<int>& visible = client->visible;
+		const Array<int>& found = client->found;
+		int i = 0, j = 0;
+		while (i < visible.count() || j < found.count()) {
+			int v = i < visible.count() ? visible[i] : INT_MAX;
+			int f = j < found.count() ? found[j] >> 1 : INT_MAX;
+			if (v < f) {
+				client->left.add(v);
+				++i;
+			} else if (f < v) {
+				if (found[j] & 1) {
+					client->next.add(f);
+					client->entered.add(f);
+				}
+				++j;
+			} else {
+				client->next.add(f);
+				++i;
+				++j;
+			}
+		}
+		Array<int> t;
+		t.steal_from(client->visible);
+		client->visible.steal_from(client->next);
+		client->next.steal_from(t);
+	}
+}
+
+void cf_interest_update(CF_Interest interest_handle, CF_Threadpool* pool)
+{
+	CF_InterestInternal* interest = s_interest(interest_handle);
+
+	// Rebuild up front, so the queries below only read the hash and can run side by side.
+	cf_spatial_hash_rebuild(interest->hash);
+	cf_parallel_for(pool, interest->clients.count(), 1, s_update_fn, interest);
+}
+
+static const int* s_list(CF_InterestInternal* interest, int client_index, int* count, Array<int> CF_InterestClient::* list)
+{
+	if (client_index < 0 || client_index >= interest->clients.count()) {
+		*count = 0;
+		return NULL;
+	}
+	const Array<int>& result = interest->clients[client_index].*list;
+	*count = result.count();
+	return result.data();
+}
+
+const int* cf_interest_get_entered(CF_Interest interest_handle, int client_index, int* count)
+{
+	return s_list(s_interest(interest_handle), client_index, count, &CF_InterestClient::entered);
+}
+
+const int* cf_interest_get_left(CF_Interest interest_handle, int client_index, int* count)
+{
+	return s_list(s_interest(interest_handle), client_index, count, &CF_InterestClient::left);
+}
+
+const int* cf_interest_get_visible(CF_Interest interest_handle, int client_index, int* count)
+{
+	return s_list(s_interest(interest_handle), client_index, count, &CF_InterestClient::visible);
+}
@@ -7,18 +7,107 @@
 
 #include "cute_json.h"
 #include "cute_file_system.h"
+#include "cute_base64.h"
+#include "cute_hashtable.h"
+#include "cute_multithreading.h"
 #include "internal/yyjson.h"
 
 #include <stddef.h>
+#include <float.h>
+#include <stdlib.h>
+
+// The read-only document yyjson parses into is thrown away as soon as it's copied into a mutable one,
+// so it's allocated from a per-thread scratch arena that keeps its blocks between parses.
+struct CF_JsonScratch
+{
+	CF_Arena arena;
+	CF_JsonScratch() { cf_arena_init(&arena, 16, 64 * 1024); }
+	~CF_JsonScratch() { cf_arena_reset(&arena); }
+};
+
+static thread_local CF_JsonScratch s_scratch;
+
+static void* s_scratch_malloc(void* ctx, size_t size)
+{
+	return cf_arena_alloc((CF_Arena*)ctx, size);
+}
+
+static void* s_scratch_realloc(void* ctx, void* ptr, size_t old_size, size_t size)
+{
+	void* result = cf_arena_alloc((CF_Arena*)ctx, size);
+	if (ptr) CF_MEMCPY(result, ptr, old_size < size ? old_size : size);
+	return result;
+}
+
+static void s_scratch_free(void* ctx, void* ptr)
+{
+	// Freed all at once by rewinding the arena.
+}
+
+static const yyjson_read_flag s_read_flags = YYJSON_READ_ALLOW_TRAILING_COMMAS | YYJSON_READ_ALLOW_COMMENTS | YYJSON_READ_ALLOW_INF_AND_NAN | YYJSON_READ_ALLOW_INVALID_UNICODE;
+
+// Documents from `cf_make_json_readonly` keep yyjson's immutable tree. Its nodes are laid out differently from
+// mutable ones, so handles to them (and to the document) are told apart by setting their lowest bit.
+struct CF_JsonReadOnlyDoc
+{
+	yyjson_doc* doc;
+	char* text; // The in-situ parsed file the document's strings point into, or NULL.
+};
+
+static CF_INLINE bool s_is_read_only(uint64_t id)
+{
+	return id & 1;
+}
+
+static CF_INLINE CF_JsonReadOnlyDoc* s_ro_doc(CF_JDoc doc)
+{
+	return (CF_JsonReadOnlyDoc*)(doc.id & ~(uint64_t)1);
+}
+
+static CF_INLINE yyjson_val* s_ro(CF_JVal val)
+{
+	return (yyjson_val*)(val.id & ~(uint64_t)1);
+}
+
+static CF_INLINE CF_JVal s_ro_handle(yyjson_val* val)
+{
+	CF_JVal result = { val ? (uint64_t)val | 1 : 0 };
+	return result;
+}
+
+// Scalars only touch the tag and payload, which both node types share, so reads can go through the mutable accessors.
+static CF_INLINE yyjson_mut_val* s_val(CF_JVal val)
+{
+	return (yyjson_mut_val*)(val.id & ~(uint64_t)1);
+}
+
+static CF_INLINE yyjson_mut_val* s_mut(CF_JVal val)
+{
+	CF_ASSERT(!s_is_read_only(val.id));
+	return (yyjson_mut_val*)val.id;
+}
+
+static CF_INLINE yyjson_mut_doc* s_mut_doc(CF_JDoc doc)
+{
+	CF_ASSERT(!s_is_read_only(doc.id));
+	return (yyjson_mut_doc*)doc.id;
+}
+
+// Bumped whenever array elements are removed or a document is destroyed, to drop the lookup caches of `cf_json_get` and `cf_json_array_at` on every thread.
+static CF_AtomicInt s_json_generation;
 
 CF_JDoc cf_make_json(const void* data, size_t size)
 {
 	yyjson_mut_doc* doc = NULL;
 	if (data) {
-		yyjson_read_flag flags = YYJSON_READ_ALLOW_TRAILING_COMMAS | YYJSON_READ_ALLOW_COMMENTS | YYJSON_READ_ALLOW_INF_AND_NAN | YYJSON_READ_ALLOW_INVALID_UNICODE;
-		yyjson_doc* read_only_doc = yyjson_read((char*)data, size, flags);
+		CF_ArenaMarker marker = cf_arena_mark(&s_scratch.arena);
+		yyjson_alc alc = { s_scratch_malloc, s_scratch_realloc, s_scratch_free, &s_scratch.arena };
+		yyjson_doc* read_only_doc = yyjson_read_opts((char*)data, size, s_read_flags, &alc, NULL);
 		doc = yyjson_doc_mut_copy(read_only_doc, NULL);
 		yyjson_doc_free(read_only_doc);
+		cf_arena_rewind(&s_scratch.arena, marker);
+		// Don't hang on to the memory of unusually big documents.
+		if (!marker.used_blocks && size > CF_MB) cf_arena_reset(&s_scratch.arena);
 	} else {
 		doc = yyjson_mut_doc_new(NULL);
 	}
@@ -26,36 +115,114 @@ CF_JDoc cf_make_json(const void* data, size_t size)
 	return result;
 }
 
+// Swaps a file compressed by `cf_json_save_async` for its decompressed text. Returns false if it's corrupt.
+static bool s_decompress_file(char** text, size_t* size)
+{
+	if (!cf_fs_is_compressed(*text, *size)) return true;
+	char* decompressed = (char*)cf_fs_decompress(*text, *size, size);
+	cf_free(*text);
+	*text = decompressed;
+	return decompressed != NULL;
+}
+
 CF_JDoc cf_make_json_from_file(const char* virtual_path)
 {
+	CF_ALLOC_TAG_SCOPE("json");
 	CF_JDoc result = { 0 };
 	size_t size;
 	char* file = cf_fs_read_entire_file_to_memory_and_nul_terminate(virtual_path, &size);
 	if (!file) return result;
+	size -= 1;
+	if (!s_decompress_file(&file, &size)) return result;
 	result = cf_make_json(file, CF_STRLEN(file));
 	cf_free(file);
 	return result;
 }
 
+static CF_JDoc s_make_json_readonly(yyjson_doc* doc, char* text)
+{
+	CF_JDoc result = { 0 };
+	if (!doc) {
+		cf_free(text);
+		return result;
+	}
+	CF_JsonReadOnlyDoc* ro = (CF_JsonReadOnlyDoc*)cf_alloc(sizeof(CF_JsonReadOnlyDoc));
+	ro->doc = doc;
+	ro->text = text;
+	result.id = (uint64_t)ro | 1;
+	return result;
+}
+
+CF_JDoc cf_make_json_readonly(const void* data, size_t size)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	if (!data) {
+		CF_JDoc result = { 0 };
+		return result;
+	}
+	return s_make_json_readonly(yyjson_read_opts((char*)data, size, s_read_flags, NULL, NULL), NULL);
+}
+
+CF_JDoc cf_make_json_readonly_from_file(const char* virtual_path)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	CF_JDoc result = { 0 };
+	CF_File* file = cf_fs_open_file_for_read(virtual_path);
+	if (!file) return result;
+	size_t size = cf_fs_size(file);
+	// Parsed in-situ, so strings point straight into the file instead of being copied out of it.
+	char* text = (char*)cf_alloc(size + YYJSON_PADDING_SIZE);
+	size_t read = cf_fs_read(file, text, size);
+	cf_fs_close(file);
+	if (read != size) {
+		cf_free(text);
+		return result;
+	}
+	if (cf_fs_is_compressed(text, size)) {
+		if (!s_decompress_file(&text, &size)) return result;
+		yyjson_doc* doc = yyjson_read_opts(text, size, s_read_flags, NULL, NULL);
+		cf_free(text);
+		return s_make_json_readonly(doc, NULL);
+	}
+	CF_MEMSET(text + size, 0, YYJSON_PADDING_SIZE);
+	return s_make_json_readonly(yyjson_read_opts(text, size, s_read_flags | YYJSON_READ_INSITU, NULL, NULL), text);
+}
+
+bool cf_json_is_readonly(CF_JDoc doc_handle)
+{
+	return s_is_read_only(doc_handle.id);
+}
+
 void cf_destroy_json(CF_JDoc doc_handle)
 {
-	yyjson_mut_doc_free((yyjson_mut_doc*)doc_handle.id);
+	cf_atomic_add(&s_json_generation, 1);
+	if (s_is_read_only(doc_handle.id)) {
+		CF_JsonReadOnlyDoc* ro = s_ro_doc(doc_handle);
+		yyjson_doc_free(ro->doc);
+		cf_free(ro->text);
+		cf_free(ro);
+	} else {
+		yyjson_mut_doc_free((yyjson_mut_doc*)doc_handle.id);
+	}
 }
 
 CF_JVal cf_json_get_root(CF_JDoc doc_handle)
 {
+	if (s_is_read_only(doc_handle.id)) {
+		return s_ro_handle(yyjson_doc_get_root(s_ro_doc(doc_handle)->doc));
+	}
 	CF_JVal result = { (uint64_t)yyjson_mut_doc_get_root((yyjson_mut_doc*)doc_handle.id) };
 	return result;
 }
 
 void cf_json_set_root(CF_JDoc doc_handle, CF_JVal val)
 {
-	yyjson_mut_doc_set_root((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)val.id);
+	yyjson_mut_doc_set_root(s_mut_doc(doc_handle), s_mut(val));
 }
 
 CF_JType cf_json_type(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	yyjson_type type = yyjson_mut_get_type(val);
 	switch (type) {
 	case YYJSON_TYPE_NULL: return CF_JTYPE_NULL;
@@ -72,42 +239,42 @@ CF_JType cf_json_type(CF_JVal val_handle)
 
 CF_API bool CF_CALL cf_json_is_null(CF_JVal val_handle)
 {
-	return yyjson_mut_is_null((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_null(s_val(val_handle));
 }
 
 CF_API bool CF_CALL cf_json_is_int(CF_JVal val_handle)
 {
-	return yyjson_mut_is_int((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_int(s_val(val_handle));
 }
 
 CF_API bool CF_CALL cf_json_is_float(CF_JVal val_handle)
 {
-	return yyjson_mut_is_real((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_real(s_val(val_handle));
 }
 
 CF_API bool CF_CALL cf_json_is_bool(CF_JVal val_handle)
 {
-	return yyjson_mut_is_bool((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_bool(s_val(val_handle));
 }
 
 CF_API bool CF_CALL cf_json_is_string(CF_JVal val_handle)
 {
-	return yyjson_mut_is_str((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_str(s_val(val_handle));
 }
 
 CF_API bool CF_CALL cf_json_is_array(CF_JVal val_handle)
 {
-	return yyjson_mut_is_arr((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_arr(s_val(val_handle));
 }
 
 CF_API bool CF_CALL cf_json_is_object(CF_JVal val_handle)
 {
-	return yyjson_mut_is_obj((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_is_obj(s_val(val_handle));
 }
 
 int cf_json_get_int(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	if (yyjson_mut_is_num(val)) {
 		if (yyjson_mut_is_real(val)) {
 			return (int)yyjson_mut_get_real(val);
@@ -123,7 +290,7 @@ int cf_json_get_int(CF_JVal val_handle)
 
 int64_t cf_json_get_i64(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	if (yyjson_mut_is_num(val)) {
 		if (yyjson_mut_is_real(val)) {
 			return (int64_t)yyjson_mut_get_real(val);
@@ -139,7 +306,7 @@ int64_t cf_json_get_i64(CF_JVal val_handle)
 
 uint64_t cf_json_get_u64(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	if (yyjson_mut_is_num(val)) {
 		if (yyjson_mut_is_real(val)) {
 			return (uint64_t)yyjson_mut_get_real(val);
@@ -155,7 +322,7 @@ uint64_t cf_json_get_u64(CF_JVal val_handle)
 
 float cf_json_get_float(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	if (yyjson_mut_is_num(val)) {
 		if (yyjson_mut_is_real(val)) {
 			return (float)yyjson_mut_get_real(val);
@@ -171,7 +338,7 @@ float cf_json_get_float(CF_JVal val_handle)
 
 double cf_json_get_double(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	if (yyjson_mut_is_num(val)) {
 		if (yyjson_mut_is_real(val)) {
 			return (double)yyjson_mut_get_real(val);
@@ -187,7 +354,7 @@ double cf_json_get_double(CF_JVal val_handle)
 
 bool cf_json_get_bool(CF_JVal val_handle)
 {
-	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
+	yyjson_mut_val* val = s_val(val_handle);
 	if (yyjson_mut_is_num(val)) {
 		if (yyjson_mut_is_real(val)) {
 			return (bool)yyjson_mut_get_real(val);
@@ -203,30 +370,147 @@ bool cf_json_get_bool(CF_JVal val_handle)
 
 const char* cf_json_get_string(CF_JVal val_handle)
 {
-	return yyjson_mut_get_str((yyjson_mut_val*)val_handle.id);
+	return yyjson_mut_get_str(s_val(val_handle));
 }
 
 int cf_json_get_len(CF_JVal val_handle)
 {
-	return (int)yyjson_mut_get_len((yyjson_mut_val*)val_handle.id);
+	return (int)yyjson_mut_get_len(s_val(val_handle));
+}
+
+// Wide read-only objects get a hashed index of their keys once `cf_json_get` is called on them twice in a row, so
+// fetching many fields costs one pass over the keys instead of one pass per field.
+#define CF_JSON_KEY_INDEX_MIN_KEYS 16
+
+struct CF_JsonKeyIndex
+{
+	uint64_t last_obj = 0;
+	uint64_t obj = 0;
+	int generation = 0;
+	htbl yyjson_val** keys = NULL;
+	~CF_JsonKeyIndex() { hfree(keys); }
+};
+
+static thread_local CF_JsonKeyIndex s_key_index;
+
+static yyjson_val* s_ro_obj_get(CF_JVal obj_handle, const char* key)
+{
+	yyjson_val* obj = s_ro(obj_handle);
+	if (!key || !yyjson_is_obj(obj) || unsafe_yyjson_get_len(obj) < CF_JSON_KEY_INDEX_MIN_KEYS) {
+		return yyjson_obj_get(obj, key);
+	}
+	CF_JsonKeyIndex* index = &s_key_index;
+	int generation = cf_atomic_get(&s_json_generation);
+	if (index->obj != obj_handle.id || index->generation != generation) {
+		bool repeated = index->last_obj == obj_handle.id;
+		index->last_obj = obj_handle.id;
+		if (!repeated) return yyjson_obj_get(obj, key);
+		if (index->keys) hclear(index->keys);
+		size_t count = unsafe_yyjson_get_len(obj);
+		yyjson_val* k = unsafe_yyjson_get_first(obj);
+		for (size_t i = 0; i < count; ++i) {
+			uint64_t h = cf_fnv1a(unsafe_yyjson_get_str(k), (int)unsafe_yyjson_get_len(k));
+			// Keep the first of duplicate keys (or colliding hashes), matching `yyjson_obj_get`.
+			if (!hhas(index->keys, h)) hadd(index->keys, h, k);
+			k = unsafe_yyjson_get_next(k + 1);
+		}
+		index->obj = obj_handle.id;
+		index->generation = generation;
+	}
+	size_t len = CF_STRLEN(key);
+	yyjson_val* k = hget(index->keys, cf_fnv1a(key, (int)len));
+	if (k && unsafe_yyjson_equals_strn(k, key, len)) return k + 1;
+	// A miss, or a different key with the same hash.
+	return k ? yyjson_obj_getn(obj, key, len) : NULL;
 }
 
 CF_JVal cf_json_get(CF_JVal val_handle, const char* key)
 {
+	if (s_is_read_only(val_handle.id)) return s_ro_handle(s_ro_obj_get(val_handle, key));
 	CF_JVal result = { (uint64_t)yyjson_mut_obj_get((yyjson_mut_val*)val_handle.id, key) };
 	return result;
 }
 
+// Remembers the last element fetched by index. Both kinds of array are lists underneath, so looping over one with
+// `cf_json_array_at` steps forward from here rather than walking from the front for every element.
+struct CF_JsonArrayCursor
+{
+	uint64_t arr;
+	size_t index;
+	uint64_t val;
+	int generation;
+};
+
+static thread_local CF_JsonArrayCursor s_cursor;
+
 CF_JVal cf_json_array_at(CF_JVal val_handle, int index)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_get((yyjson_mut_val*)val_handle.id, index) };
-	return result;
+	CF_JVal result = { 0 };
+	bool read_only = s_is_read_only(val_handle.id);
+	yyjson_mut_val* arr = s_val(val_handle);
+	if (index < 0 || !yyjson_mut_is_arr(arr) || (size_t)index >= unsafe_yyjson_get_len(arr)) return result;
+	if (read_only && unsafe_yyjson_arr_is_flat(s_ro(val_handle))) {
+		return s_ro_handle(unsafe_yyjson_get_first(s_ro(val_handle)) + index);
+	}
+
+	CF_JsonArrayCursor* cursor = &s_cursor;
+	int generation = cf_atomic_get(&s_json_generation);
+	size_t at = 0;
+	uint64_t val;
+	if (cursor->arr == val_handle.id && cursor->index <= (size_t)index && cursor->generation == generation) {
+		at = cursor->index;
+		val = cursor->val;
+	} else if (read_only) {
+		val = (uint64_t)unsafe_yyjson_get_first(s_ro(val_handle));
+	} else {
+		val = (uint64_t)((yyjson_mut_val*)arr->uni.ptr)->next;
+	}
+	for (; at < (size_t)index; ++at) {
+		val = read_only ? (uint64_t)unsafe_yyjson_get_next((yyjson_val*)val) : (uint64_t)((yyjson_mut_val*)val)->next;
+	}
+	cursor->arr = val_handle.id;
+	cursor->index = at;
+	cursor->val = val;
+	cursor->generation = generation;
+	return read_only ? s_ro_handle((yyjson_val*)val) : CF_JVal { val };
 }
 
 CF_JVal cf_json_array_get(CF_JVal val_handle, int index)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_get((yyjson_mut_val*)val_handle.id, index) };
-	return result;
+	return cf_json_array_at(val_handle, index);
+}
+
+template <typename T, typename F>
+static int s_array_get(CF_JVal val_handle, T* out, int count, F get)
+{
+	yyjson_mut_val* arr = s_val(val_handle);
+	if (!yyjson_mut_is_arr(arr) || !out || count <= 0) return 0;
+	size_t len = unsafe_yyjson_get_len(arr);
+	int n = len < (size_t)count ? (int)len : count;
+	if (s_is_read_only(val_handle.id)) {
+		yyjson_val* val = n ? unsafe_yyjson_get_first(s_ro(val_handle)) : NULL;
+		for (int i = 0; i < n; ++i) {
+			out[i] = get(s_ro_handle(val));
+			val = unsafe_yyjson_get_next(val);
+		}
+	} else {
+		yyjson_mut_val* val = n ? ((yyjson_mut_val*)arr->uni.ptr)->next : NULL;
+		for (int i = 0; i < n; ++i) {
+			out[i] = get(CF_JVal { (uint64_t)val });
+			val = val->next;
+		}
+	}
+	return n;
+}
+
+int cf_json_array_get_ints(CF_JVal arr, int* out, int count)
+{
+	return s_array_get(arr, out, count, cf_json_get_int);
+}
+
+int cf_json_array_get_floats(CF_JVal arr, float* out, int count)
+{
+	return s_array_get(arr, out, count, cf_json_get_float);
 }
 
 // Make sure memory layout is identical.
@@ -243,8 +527,54 @@ static_assert(offsetof(CF_JIter, val) == offsetof(yyjson_mut_obj_iter, cur));
 static_assert(offsetof(CF_JIter, prev) == offsetof(yyjson_mut_obj_iter, pre));
 static_assert(offsetof(CF_JIter, parent) == offsetof(yyjson_mut_obj_iter, obj));
 
+// Read-only values are stored contiguously, so their iterators just hold the current element (or key) in `val`.
+static CF_JIter s_ro_iter(CF_JVal val_handle)
+{
+	yyjson_val* val = s_ro(val_handle);
+	CF_JIter iter = { 0 };
+	if (yyjson_is_arr(val) || yyjson_is_obj(val)) {
+		iter.count = unsafe_yyjson_get_len(val);
+		iter.val = s_ro_handle(iter.count ? unsafe_yyjson_get_first(val) : NULL);
+		iter.parent = val_handle;
+	}
+	return iter;
+}
+
+static void s_ro_iter_next(CF_JIter* iter)
+{
+	if (iter->index >= iter->count) return;
+	yyjson_val* cur = s_ro(iter->val);
+	if (yyjson_is_obj(s_ro(iter->parent))) ++cur;
+	iter->val = s_ro_handle(unsafe_yyjson_get_next(cur));
+	++iter->index;
+}
+
+static CF_JVal s_ro_iter_next_by_name(CF_JIter* iter, const char* key)
+{
+	CF_JVal result = { 0 };
+	yyjson_val* obj = s_ro(iter->parent);
+	if (!yyjson_is_obj(obj)) return result;
+	yyjson_val* cur = s_ro(iter->val);
+	uint64_t index = iter->index;
+	for (uint64_t i = 0; i < iter->count; ++i) {
+		if (index >= iter->count) {
+			index = 0;
+			cur = unsafe_yyjson_get_first(obj);
+		}
+		if (yyjson_equals_str(cur, key)) {
+			iter->index = index;
+			iter->val = s_ro_handle(cur);
+			return s_ro_handle(cur + 1);
+		}
+		cur = unsafe_yyjson_get_next(cur + 1);
+		++index;
+	}
+	return result;
+}
+
 CF_JIter cf_json_iter(CF_JVal val_handle)
 {
+	if (s_is_read_only(val_handle.id)) return s_ro_iter(val_handle);
 	yyjson_mut_val* val = (yyjson_mut_val*)val_handle.id;
 	CF_JIter iter = { 0 };
 	if (yyjson_mut_is_arr(val)) {
@@ -265,6 +595,10 @@ CF_JIter cf_json_iter(CF_JVal val_handle)
 
 CF_JIter cf_json_iter_next(CF_JIter iter)
 {
+	if (s_is_read_only(iter.parent.id)) {
+		s_ro_iter_next(&iter);
+		return iter;
+	}
 	yyjson_mut_val* parent = (yyjson_mut_val*)iter.parent.id;
 	if (yyjson_mut_is_arr(parent)) {
 		yyjson_mut_arr_iter_next((yyjson_mut_arr_iter*)&iter);
@@ -276,6 +610,7 @@ CF_JIter cf_json_iter_next(CF_JIter iter)
 
 CF_JVal cf_json_iter_next_by_name(CF_JIter* iter, const char* key)
 {
+	if (s_is_read_only(iter->parent.id)) return s_ro_iter_next_by_name(iter, key);
 	yyjson_mut_val* parent = (yyjson_mut_val*)iter->parent.id;
 	CF_JVal result = { 0 };
 	if (yyjson_mut_is_obj(parent)) {
@@ -287,9 +622,10 @@ CF_JVal cf_json_iter_next_by_name(CF_JIter* iter, const char* key)
 CF_JVal cf_json_iter_remove(CF_JIter* iter)
 {
 	CF_JVal result = { 0 };
-	if (yyjson_mut_is_arr((yyjson_mut_val*)iter->parent.id)) {
+	if (yyjson_mut_is_arr(s_mut(iter->parent))) {
+		cf_atomic_add(&s_json_generation, 1);
 		result = { (uint64_t)yyjson_mut_arr_iter_remove((yyjson_mut_arr_iter*)iter) };
-	} else if (yyjson_mut_is_obj((yyjson_mut_val*)iter->parent.id)) {
+	} else if (yyjson_mut_is_obj(s_mut(iter->parent))) {
 		result = { (uint64_t)yyjson_mut_obj_iter_remove((yyjson_mut_obj_iter*)iter) };
 	}
 	return result;
@@ -297,6 +633,10 @@ CF_JVal cf_json_iter_remove(CF_JIter* iter)
 
 CF_JVal cf_json_iter_val(CF_JIter iter)
 {
+	if (s_is_read_only(iter.parent.id)) {
+		if (yyjson_is_obj(s_ro(iter.parent))) return s_ro_handle(s_ro(iter.val) + 1);
+		return iter.val;
+	}
 	yyjson_mut_val* parent = (yyjson_mut_val*)iter.parent.id;
 	CF_JVal val = { 0 };
 	if (yyjson_mut_is_arr(parent)) {
@@ -310,6 +650,9 @@ CF_JVal cf_json_iter_val(CF_JIter iter)
 
 const char* cf_json_iter_key(CF_JIter iter)
 {
+	if (s_is_read_only(iter.parent.id)) {
+		return yyjson_is_obj(s_ro(iter.parent)) ? yyjson_get_str(s_ro(iter.val)) : NULL;
+	}
 	yyjson_mut_val* parent = (yyjson_mut_val*)iter.parent.id;
 	if (yyjson_mut_is_obj(parent)) {
 		return yyjson_mut_get_str(((yyjson_mut_arr_iter*)&iter)->cur);
@@ -319,321 +662,329 @@ const char* cf_json_iter_key(CF_JIter iter)
 
 CF_JVal cf_json_from_null(CF_JDoc doc_handle)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_null((yyjson_mut_doc*)doc_handle.id) };
+	CF_JVal result = { (uint64_t)yyjson_mut_null(s_mut_doc(doc_handle)) };
 	return result;
 }
 
 CF_JVal cf_json_from_int(CF_JDoc doc_handle, int val)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_int((yyjson_mut_doc*)doc_handle.id, (int64_t)val) };
+	CF_JVal result = { (uint64_t)yyjson_mut_int(s_mut_doc(doc_handle), (int64_t)val) };
 	return result;
 }
 
 CF_JVal cf_json_from_i64(CF_JDoc doc_handle, int64_t val)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_sint((yyjson_mut_doc*)doc_handle.id, val) };
+	CF_JVal result = { (uint64_t)yyjson_mut_sint(s_mut_doc(doc_handle), val) };
 	return result;
 }
 
 CF_JVal cf_json_from_u64(CF_JDoc doc_handle, uint64_t val)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_uint((yyjson_mut_doc*)doc_handle.id, val) };
+	CF_JVal result = { (uint64_t)yyjson_mut_uint(s_mut_doc(doc_handle), val) };
 	return result;
 }
 
 CF_JVal cf_json_from_float(CF_JDoc doc_handle, float val)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_real((yyjson_mut_doc*)doc_handle.id, (double)val) };
+	CF_JVal result = { (uint64_t)yyjson_mut_real(s_mut_doc(doc_handle), (double)val) };
 	return result;
 }
 
 CF_JVal cf_json_from_double(CF_JDoc doc_handle, double val)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_real((yyjson_mut_doc*)doc_handle.id, val) };
+	CF_JVal result = { (uint64_t)yyjson_mut_real(s_mut_doc(doc_handle), val) };
 	return result;
 }
 
 CF_JVal cf_json_from_bool(CF_JDoc doc_handle, bool val)
 {
-	yyjson_mut_doc* doc = (yyjson_mut_doc*)doc_handle.id;
+	yyjson_mut_doc* doc = s_mut_doc(doc_handle);
 	CF_JVal result = { (uint64_t)(val ? yyjson_mut_true(doc) : yyjson_mut_false(doc)) };
 	return result;
 }
 
 CF_JVal cf_json_from_string(CF_JDoc doc_handle, const char* val)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_str((yyjson_mut_doc*)doc_handle.id, val) };
+	CF_JVal result = { (uint64_t)yyjson_mut_str(s_mut_doc(doc_handle), val) };
 	return result;
 }
 
 CF_JVal cf_json_from_string_range(CF_JDoc doc_handle, const char* begin, const char* end)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_strn((yyjson_mut_doc*)doc_handle.id, begin, end - begin) };
+	CF_JVal result = { (uint64_t)yyjson_mut_strn(s_mut_doc(doc_handle), begin, end - begin) };
 	return result;
 }
 
 void cf_json_set_null(CF_JVal jval)
 {
-	yyjson_mut_set_null((yyjson_mut_val*)jval.id);
+	yyjson_mut_set_null(s_mut(jval));
 }
 
 void cf_json_set_int(CF_JVal jval, int val)
 {
-	yyjson_mut_set_int((yyjson_mut_val*)jval.id, (int64_t)val);
+	yyjson_mut_set_int(s_mut(jval), (int64_t)val);
 }
 
 void cf_json_set_i64(CF_JVal jval, int64_t val)
 {
-	yyjson_mut_set_sint((yyjson_mut_val*)jval.id, val);
+	yyjson_mut_set_sint(s_mut(jval), val);
 }
 
 void cf_json_set_u64(CF_JVal jval, uint64_t val)
 {
-	yyjson_mut_set_uint((yyjson_mut_val*)jval.id, val);
+	yyjson_mut_set_uint(s_mut(jval), val);
 }
 
 void cf_json_set_float(CF_JVal jval, float val)
 {
-	yyjson_mut_set_real((yyjson_mut_val*)jval.id, (double)val);
+	yyjson_mut_set_real(s_mut(jval), (double)val);
 }
 
 void cf_json_set_double(CF_JVal jval, double val)
 {
-	yyjson_mut_set_real((yyjson_mut_val*)jval.id, val);
+	yyjson_mut_set_real(s_mut(jval), val);
 }
 
 void  cf_json_set_bool(CF_JVal jval, bool val)
 {
-	yyjson_mut_set_bool((yyjson_mut_val*)jval.id, val);
+	yyjson_mut_set_bool(s_mut(jval), val);
 }
 
 void cf_json_set_string(CF_JVal jval, const char* val)
 {
-	yyjson_mut_set_str((yyjson_mut_val*)jval.id, val);
+	yyjson_mut_set_str(s_mut(jval), val);
 }
 
 void cf_json_set_string_range(CF_JVal jval, const char* begin, const char* end)
 {
-	yyjson_mut_set_strn((yyjson_mut_val*)jval.id, begin, end - begin);
+	yyjson_mut_set_strn(s_mut(jval), begin, end - begin);
 }
 
 CF_JVal cf_json_array(CF_JDoc doc_handle)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr((yyjson_mut_doc*)doc_handle.id) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr(s_mut_doc(doc_handle)) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_int(CF_JDoc doc_handle, int* vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_sint32((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_sint32(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_i64(CF_JDoc doc_handle, int64_t* vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_sint((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_sint(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_u64(CF_JDoc doc_handle, uint64_t* vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_uint((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_uint(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_float(CF_JDoc doc_handle, float* vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_float((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_float(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_double(CF_JDoc doc_handle, double* vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_double((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_double(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_bool(CF_JDoc doc_handle, bool* vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_bool((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_bool(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_array_from_string(CF_JDoc doc_handle, const char** vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_str((yyjson_mut_doc*)doc_handle.id, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_with_str(s_mut_doc(doc_handle), vals, count) };
 	return result;
 }
 
 void cf_json_array_add(CF_JVal arr, CF_JVal val)
 {
-	yyjson_mut_arr_add_val((yyjson_mut_val*)arr.id, (yyjson_mut_val*)val.id);
+	yyjson_mut_arr_add_val(s_mut(arr), s_mut(val));
 }
 
 void cf_json_array_add_null(CF_JDoc doc_handle, CF_JVal arr_handle)
 {
-	yyjson_mut_arr_add_null((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id);
+	yyjson_mut_arr_add_null(s_mut_doc(doc_handle), s_mut(arr_handle));
 }
 
 void cf_json_array_add_int(CF_JDoc doc_handle, CF_JVal arr_handle, int val)
 {
-	yyjson_mut_arr_add_int((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, (int64_t)val);
+	yyjson_mut_arr_add_int(s_mut_doc(doc_handle), s_mut(arr_handle), (int64_t)val);
 }
 
 void cf_json_array_add_i64(CF_JDoc doc_handle, CF_JVal arr_handle, int64_t val)
 {
-	yyjson_mut_arr_add_sint((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, val);
+	yyjson_mut_arr_add_sint(s_mut_doc(doc_handle), s_mut(arr_handle), val);
 }
 
 void cf_json_array_add_u64(CF_JDoc doc_handle, CF_JVal arr_handle, uint64_t val)
 {
-	yyjson_mut_arr_add_uint((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, val);
+	yyjson_mut_arr_add_uint(s_mut_doc(doc_handle), s_mut(arr_handle), val);
 }
 
 void cf_json_array_add_float(CF_JDoc doc_handle, CF_JVal arr_handle, float val)
 {
-	yyjson_mut_arr_add_real((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, (double)val);
+	yyjson_mut_arr_add_real(s_mut_doc(doc_handle), s_mut(arr_handle), (double)val);
 }
 
 void cf_json_array_add_double(CF_JDoc doc_handle, CF_JVal arr_handle, double val)
 {
-	yyjson_mut_arr_add_real((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, val);
+	yyjson_mut_arr_add_real(s_mut_doc(doc_handle), s_mut(arr_handle), val);
 }
 
 void cf_json_array_add_bool(CF_JDoc doc_handle, CF_JVal arr_handle, bool val)
 {
 	if (val) {
-		yyjson_mut_arr_add_true((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id);
+		yyjson_mut_arr_add_true(s_mut_doc(doc_handle), s_mut(arr_handle));
 	} else {
-		yyjson_mut_arr_add_false((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id);
+		yyjson_mut_arr_add_false(s_mut_doc(doc_handle), s_mut(arr_handle));
 	}
 }
 
 void cf_json_array_add_string(CF_JDoc doc_handle, CF_JVal arr_handle, const char* val)
 {
-	yyjson_mut_arr_add_str((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, val);
+	yyjson_mut_arr_add_str(s_mut_doc(doc_handle), s_mut(arr_handle), val);
 }
 
 void cf_json_array_add_string_range(CF_JDoc doc_handle, CF_JVal arr_handle, const char* begin, const char* end)
 {
-	yyjson_mut_arr_add_strn((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id, begin, end - begin);
+	yyjson_mut_arr_add_strn(s_mut_doc(doc_handle), s_mut(arr_handle), begin, end - begin);
 }
 
 CF_JVal cf_json_array_add_array(CF_JDoc doc_handle, CF_JVal arr_handle)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_add_arr((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_add_arr(s_mut_doc(doc_handle), s_mut(arr_handle)) };
 	return result;
 }
 
 CF_JVal cf_json_array_add_object(CF_JDoc doc_handle, CF_JVal arr_handle)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_add_obj((yyjson_mut_doc*)doc_handle.id, (yyjson_mut_val*)arr_handle.id) };
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_add_obj(s_mut_doc(doc_handle), s_mut(arr_handle)) };
 	return result;
 }
 
 CF_JVal cf_json_array_pop(CF_JVal arr)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_arr_remove_last((yyjson_mut_val*)arr.id) };
+	cf_atomic_add(&s_json_generation, 1);
+	CF_JVal result = { (uint64_t)yyjson_mut_arr_remove_last(s_mut(arr)) };
 	return result;
 }
 
 CF_JVal cf_json_object(CF_JDoc doc_handle)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_obj((yyjson_mut_doc*)doc_handle.id) };
+	CF_JVal result = { (uint64_t)yyjson_mut_obj(s_mut_doc(doc_handle)) };
 	return result;
 }
 
 CF_JVal cf_json_object_from_strings(CF_JDoc doc_handle, const char** keys, const char** vals, int count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_obj_with_str((yyjson_mut_doc*)doc_handle.id, keys, vals, count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_obj_with_str(s_mut_doc(doc_handle), keys, vals, count) };
 	return result;
 }
 
 CF_JVal cf_json_object_from_string_pairs(CF_JDoc doc_handle, const char** kv_pairs, int pair_count)
 {
-	CF_JVal result = { (uint64_t)yyjson_mut_obj_with_kv((yyjson_mut_doc*)doc_handle.id, kv_pairs, pair_count) };
+	CF_JVal result = { (uint64_t)yyjson_mut_obj_with_kv(s_mut_doc(doc_handle), kv_pairs, pair_count) };
 	return result;
 }
 
 void cf_json_object_add(CF_JDoc doc, CF_JVal obj, const char* key, CF_JVal val)
 {
 	CF_JVal k = cf_json_from_string(doc, key);
-	yyjson_mut_obj_add((yyjson_mut_val*)obj.id, (yyjson_mut_val*)k.id, (yyjson_mut_val*)val.id);
+	yyjson_mut_obj_add(s_mut(obj), s_mut(k), s_mut(val));
 }
 
 void cf_json_object_add_null(CF_JDoc doc, CF_JVal obj, const char* key)
 {
-	yyjson_mut_obj_add_null((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key);
+	yyjson_mut_obj_add_null(s_mut_doc(doc), s_mut(obj), key);
 }
 
 void cf_json_object_add_int(CF_JDoc doc, CF_JVal obj, const char* key, int val)
 {
-	yyjson_mut_obj_add_int((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, (int64_t)val);
+	yyjson_mut_obj_add_int(s_mut_doc(doc), s_mut(obj), key, (int64_t)val);
 }
 
 void cf_json_object_add_i64(CF_JDoc doc, CF_JVal obj, const char* key, int64_t val)
 {
-	yyjson_mut_obj_add_sint((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, val);
+	yyjson_mut_obj_add_sint(s_mut_doc(doc), s_mut(obj), key, val);
 }
 
 void cf_json_object_add_u64(CF_JDoc doc, CF_JVal obj, const char* key, uint64_t val)
 {
-	yyjson_mut_obj_add_uint((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, val);
+	yyjson_mut_obj_add_uint(s_mut_doc(doc), s_mut(obj), key, val);
 }
 
 void cf_json_object_add_float(CF_JDoc doc, CF_JVal obj, const char* key, float val)
 {
-	yyjson_mut_obj_add_real((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, (double)val);
+	yyjson_mut_obj_add_real(s_mut_doc(doc), s_mut(obj), key, (double)val);
 }
 
 void cf_json_object_add_double(CF_JDoc doc, CF_JVal obj, const char* key, double val)
 {
-	yyjson_mut_obj_add_real((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, val);
+	yyjson_mut_obj_add_real(s_mut_doc(doc), s_mut(obj), key, val);
 }
 
 void cf_json_object_add_bool(CF_JDoc doc, CF_JVal obj, const char* key, bool val)
 {
 	if (val) {
-		yyjson_mut_obj_add_true((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key);
+		yyjson_mut_obj_add_true(s_mut_doc(doc), s_mut(obj), key);
 	} else {
-		yyjson_mut_obj_add_false((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key);
+		yyjson_mut_obj_add_false(s_mut_doc(doc), s_mut(obj), key);
 	}
 }
 
 void cf_json_object_add_string(CF_JDoc doc, CF_JVal obj, const char* key, const char* val)
 {
-	yyjson_mut_obj_add_str((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, val);
+	yyjson_mut_obj_add_str(s_mut_doc(doc), s_mut(obj), key, val);
 }
 
 void cf_json_object_add_string_range(CF_JDoc doc, CF_JVal obj, const char* key, const char* begin, const char* end)
 {
-	yyjson_mut_obj_add_strn((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, begin, end - begin);
+	yyjson_mut_obj_add_strn(s_mut_doc(doc), s_mut(obj), key, begin, end - begin);
 }
 
 void cf_json_object_remove_key(CF_JVal obj, const char* key)
 {
-	yyjson_mut_obj_remove_key((yyjson_mut_val*)obj.id, key);
+	yyjson_mut_obj_remove_key(s_mut(obj), key);
 }
 
 void cf_json_object_remove_key_range(CF_JVal obj, const char* key_begin, const char* key_end)
 {
-	yyjson_mut_obj_remove_keyn((yyjson_mut_val*)obj.id, key_begin, key_end - key_begin);
+	yyjson_mut_obj_remove_keyn(s_mut(obj), key_begin, key_end - key_begin);
 }
 
 void cf_json_object_rename_key(CF_JDoc doc, CF_JVal obj, const char* key, const char* rename)
 {
-	yyjson_mut_obj_rename_key((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key, rename);
+	yyjson_mut_obj_rename_key(s_mut_doc(doc), s_mut(obj), key, rename);
 }
 
 void cf_json_object_rename_key_range(CF_JDoc doc, CF_JVal obj, const char* key_begin, const char* key_end, const char* rename_begin, const char* rename_end)
 {
-	yyjson_mut_obj_rename_keyn((yyjson_mut_doc*)doc.id, (yyjson_mut_val*)obj.id, key_begin, key_end - key_begin, rename_begin, rename_end - rename_begin);
+	yyjson_mut_obj_rename_keyn(s_mut_doc(doc), s_mut(obj), key_begin, key_end - key_begin, rename_begin, rename_end - rename_begin);
+}
+
+static char* s_write(CF_JDoc doc, yyjson_write_flag flags)
+{
+	if (s_is_read_only(doc.id)) return yyjson_write(s_ro_doc(doc)->doc, flags, NULL);
+	return yyjson_mut_write((yyjson_mut_doc*)doc.id, flags, NULL);
 }
 
 dyna char* cf_json_to_string(CF_JDoc doc)
 {
+	CF_ALLOC_TAG_SCOPE("json");
 	yyjson_write_flag flags = YYJSON_WRITE_PRETTY_TWO_SPACES | YYJSON_WRITE_ALLOW_INF_AND_NAN | YYJSON_WRITE_ALLOW_INVALID_UNICODE;
-	char* string = yyjson_mut_write((yyjson_mut_doc*)doc.id, flags, NULL);
+	char* string = s_write(doc, flags);
 	char* result = NULL;
 	sset(result, string);
 	free(string);
@@ -643,8 +994,9 @@ dyna char* cf_json_to_string(CF_JDoc doc)
 
 dyna char* cf_json_to_string_minimal(CF_JDoc doc)
 {
+	CF_ALLOC_TAG_SCOPE("json");
 	yyjson_write_flag flags = YYJSON_WRITE_ALLOW_INF_AND_NAN | YYJSON_WRITE_ALLOW_INVALID_UNICODE;
-	char* string = yyjson_mut_write((yyjson_mut_doc*)doc.id, flags, NULL);
+	char* string = s_write(doc, flags);
 	char* result = NULL;
 	sset(result, string);
 	free(string);
@@ -666,3 +1018,775 @@ CF_Result cf_json_to_file_minimal(CF_JDoc doc, const char* virtual_path)
 	sfree(s);
 	return result;
 }
+
+struct CF_JsonSave
+{
+	CF_JDoc doc;
+	bool pretty;
+};
+
+// Runs on the I/O thread, and owns the document from here on.
+static void* s_serialize_save(void* udata, bool canceled, size_t* size)
+{
+	CF_JsonSave* save = (CF_JsonSave*)udata;
+	void* data = NULL;
+	if (!canceled) {
+		char* string = save->pretty ? cf_json_to_string(save->doc) : cf_json_to_string_minimal(save->doc);
+		*size = (size_t)slen(string);
+		data = cf_alloc(*size + 1);
+		CF_MEMCPY(data, string, *size + 1);
+		sfree(string);
+	}
+	cf_destroy_json(save->doc);
+	cf_free(save);
+	return data;
+}
+
+CF_FileRequest cf_json_save_async(CF_JDoc doc, const char* virtual_path, bool pretty, bool compress, CF_FileWriteFn* fn, void* udata)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	CF_JsonSave* save = (CF_JsonSave*)cf_alloc(sizeof(CF_JsonSave));
+	save->doc = doc;
+	save->pretty = pretty;
+	return cf_fs_write_async_serialized(virtual_path, s_serialize_save, save, compress, fn, udata);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Streaming writer.
+
+#define CF_JSON_WRITER_MAX_DEPTH 64
+#define CF_JSON_WRITER_BUFFER_SIZE 4096
+
+struct CF_JsonWriterScope
+{
+	bool is_object;
+	bool has_values;
+};
+
+struct CF_JsonWriterInternal
+{
+	bool pretty = false;
+	bool finished = false;
+	bool root_written = false;
+	bool key_pending = false;
+	int depth = 0;
+	CF_JsonWriterScope scopes[CF_JSON_WRITER_MAX_DEPTH];
+
+	// Text goes to either a string, or to a file through a fixed-size buffer.
+	char* string = NULL;
+	CF_File* file = NULL;
+	int buffer_count = 0;
+	char buffer[CF_JSON_WRITER_BUFFER_SIZE];
+
+	CF_Result result = cf_result_success();
+};
+
+static void s_fail(CF_JsonWriterInternal* w, const char* details)
+{
+	if (!cf_is_error(w->result)) w->result = cf_result_error(details);
+}
+
+static void s_flush(CF_JsonWriterInternal* w)
+{
+	if (w->file && w->buffer_count) {
+		if (cf_fs_write(w->file, w->buffer, w->buffer_count) != (size_t)w->buffer_count) {
+			s_fail(w, "Failed to write to the json file.");
+		}
+	}
+	w->buffer_count = 0;
+}
+
+static void s_put(CF_JsonWriterInternal* w, const char* text, int size)
+{
+	if (!w->file) {
+		sappend_range(w->string, text, text + size);
+		return;
+	}
+	if (w->buffer_count + size > CF_JSON_WRITER_BUFFER_SIZE) {
+		s_flush(w);
+		if (size > CF_JSON_WRITER_BUFFER_SIZE) {
+			if (cf_fs_write(w->file, text, size) != (size_t)size) s_fail(w, "Failed to write to the json file.");
+			return;
+		}
+	}
+	CF_MEMCPY(w->buffer + w->buffer_count, text, size);
+	w->buffer_count += size;
+}
+
+static CF_INLINE void s_put(CF_JsonWriterInternal* w, const char* text)
+{
+	s_put(w, text, (int)CF_STRLEN(text));
+}
+
+static CF_INLINE void s_put(CF_JsonWriterInternal* w, char c)
+{
+	s_put(w, &c, 1);
+}
+
+static void s_newline(CF_JsonWriterInternal* w, int indent)
+{
+	s_put(w, '\n');
+	for (int i = 0; i < indent; ++i) s_put(w, '\t');
+}
+
+static void s_put_escaped(CF_JsonWriterInternal* w, const char* begin, const char* end)
+{
+	static const char* s_hex = "0123456789abcdef";
+	s_put(w, '"');
+	const char* run = begin;
+	for (const char* p = begin; p < end; ++p) {
+		uint8_t c = (uint8_t)*p;
+		if (c >= 0x20 && c != '"' && c != '\\') continue;
+		s_put(w, run, (int)(p - run));
+		run = p + 1;
+		switch (c) {
+		case '"': s_put(w, "\\\""); break;
+		case '\\': s_put(w, "\\\\"); break;
+		case '\n': s_put(w, "\\n"); break;
+		case '\r': s_put(w, "\\r"); break;
+		case '\t': s_put(w, "\\t"); break;
+		case '\b': s_put(w, "\\b"); break;
+		case '\f': s_put(w, "\\f"); break;
+		default: {
+			char u[6] = { '\\', 'u', '0', '0', s_hex[c >> 4], s_hex[c & 0xF] };
+			s_put(w, u, 6);
+		} break;
+		}
+	}
+	s_put(w, run, (int)(end - run));
+	s_put(w, '"');
+}
+
+// Separates the next value from the previous one, checking it's allowed here.
+static bool s_begin_value(CF_JsonWriterInternal* w)
+{
+	// Writes after a failed open are dropped quietly, leaving the error for `cf_json_writer_finish`.
+	CF_ASSERT(!w->finished || cf_is_error(w->result));
+	if (w->finished) return false;
+	if (!w->depth) {
+		CF_ASSERT(!w->root_written);
+		if (w->root_written) {
+			s_fail(w, "A json writer can only write one root value.");
+			return false;
+		}
+		w->root_written = true;
+		return true;
+	}
+	CF_JsonWriterScope* scope = w->scopes + w->depth - 1;
+	if (scope->is_object) {
+		CF_ASSERT(w->key_pending);
+		if (!w->key_pending) {
+			s_fail(w, "Values within a json object need a key first.");
+			return false;
+		}
+		w->key_pending = false;
+		return true;
+	}
+	if (scope->has_values) s_put(w, ',');
+	if (w->pretty) s_newline(w, w->depth);
+	scope->has_values = true;
+	return true;
+}
+
+static void s_begin_scope(CF_JsonWriterInternal* w, bool is_object)
+{
+	if (!s_begin_value(w)) return;
+	s_put(w, is_object ? '{' : '[');
+	CF_ASSERT(w->depth < CF_JSON_WRITER_MAX_DEPTH);
+	if (w->depth == CF_JSON_WRITER_MAX_DEPTH) {
+		s_fail(w, "Json writer nested too deeply.");
+		return;
+	}
+	w->scopes[w->depth].is_object = is_object;
+	w->scopes[w->depth].has_values = false;
+	w->depth++;
+}
+
+static void s_end_scope(CF_JsonWriterInternal* w, bool is_object)
+{
+	CF_ASSERT(w->depth && w->scopes[w->depth - 1].is_object == is_object && !w->key_pending);
+	if (!w->depth || w->scopes[w->depth - 1].is_object != is_object || w->key_pending) {
+		s_fail(w, "Mismatched end of a json object or array.");
+		return;
+	}
+	w->depth--;
+	if (w->pretty && w->scopes[w->depth].has_values) s_newline(w, w->depth);
+	s_put(w, is_object ? '}' : ']');
+}
+
+static CF_JsonWriter s_make_writer(CF_JsonWriterInternal* w)
+{
+	CF_JsonWriter result;
+	result.id = (uint64_t)w;
+	return result;
+}
+
+CF_JsonWriter cf_make_json_writer(bool pretty)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	CF_JsonWriterInternal* w = CF_NEW(CF_JsonWriterInternal);
+	w->pretty = pretty;
+	sfit(w->string, CF_JSON_WRITER_BUFFER_SIZE);
+	return s_make_writer(w);
+}
+
+CF_JsonWriter cf_make_json_writer_to_file(const char* virtual_path, bool pretty)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	CF_JsonWriterInternal* w = CF_NEW(CF_JsonWriterInternal);
+	w->pretty = pretty;
+	w->file = cf_fs_open_file_for_write(virtual_path);
+	if (!w->file) {
+		s_fail(w, "Unable to open the json file for writing.");
+		w->finished = true;
+	}
+	return s_make_writer(w);
+}
+
+CF_Result cf_json_writer_finish(CF_JsonWriter writer)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (w->finished) return w->result;
+	if (w->depth) s_fail(w, "A json object or array was left open.");
+	s_flush(w);
+	if (w->file) {
+		if (cf_is_error(cf_fs_close(w->file))) s_fail(w, "Failed to close the json file.");
+		w->file = NULL;
+	}
+	w->finished = true;
+	return w->result;
+}
+
+void cf_destroy_json_writer(CF_JsonWriter writer)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	cf_json_writer_finish(writer);
+	sfree(w->string);
+	w->~CF_JsonWriterInternal();
+	cf_free(w);
+}
+
+const char* cf_json_writer_get_string(CF_JsonWriter writer)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	return w->file || !w->string ? NULL : w->string;
+}
+
+void cf_json_write_begin_object(CF_JsonWriter writer)
+{
+	s_begin_scope((CF_JsonWriterInternal*)writer.id, true);
+}
+
+void cf_json_write_end_object(CF_JsonWriter writer)
+{
+	s_end_scope((CF_JsonWriterInternal*)writer.id, true);
+}
+
+void cf_json_write_begin_array(CF_JsonWriter writer)
+{
+	s_begin_scope((CF_JsonWriterInternal*)writer.id, false);
+}
+
+void cf_json_write_end_array(CF_JsonWriter writer)
+{
+	s_end_scope((CF_JsonWriterInternal*)writer.id, false);
+}
+
+void cf_json_write_key(CF_JsonWriter writer, const char* key)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	CF_ASSERT(w->depth && w->scopes[w->depth - 1].is_object && !w->key_pending);
+	if (!w->depth || !w->scopes[w->depth - 1].is_object || w->key_pending) {
+		s_fail(w, "Json keys can only be written within an object, before each value.");
+		return;
+	}
+	CF_JsonWriterScope* scope = w->scopes + w->depth - 1;
+	if (scope->has_values) s_put(w, ',');
+	if (w->pretty) s_newline(w, w->depth);
+	scope->has_values = true;
+	s_put_escaped(w, key, key + CF_STRLEN(key));
+	s_put(w, w->pretty ? ": " : ":");
+	w->key_pending = true;
+}
+
+void cf_json_write_null(CF_JsonWriter writer)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (s_begin_value(w)) s_put(w, "null");
+}
+
+void cf_json_write_int(CF_JsonWriter writer, int val)
+{
+	cf_json_write_i64(writer, val);
+}
+
+void cf_json_write_i64(CF_JsonWriter writer, int64_t val)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (!s_begin_value(w)) return;
+	char text[32];
+	int n = CF_SNPRINTF(text, sizeof(text), "%lld", (long long)val);
+	s_put(w, text, n);
+}
+
+void cf_json_write_u64(CF_JsonWriter writer, uint64_t val)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (!s_begin_value(w)) return;
+	char text[32];
+	int n = CF_SNPRINTF(text, sizeof(text), "%llu", (unsigned long long)val);
+	s_put(w, text, n);
+}
+
+// Writes the fewest digits that parse back to the same value, with a decimal point so it reads back as a float.
+static void s_put_real(CF_JsonWriterInternal* w, double val, bool is_float)
+{
+	if (val != val) { s_put(w, "NaN"); return; }
+	if (val > DBL_MAX) { s_put(w, "Infinity"); return; }
+	if (val < -DBL_MAX) { s_put(w, "-Infinity"); return; }
+	char text[40];
+	int n = 0;
+	for (int precision = is_float ? 6 : 15; precision <= (is_float ? 9 : 17); ++precision) {
+		n = CF_SNPRINTF(text, sizeof(text), "%.*g", precision, val);
+		if (is_float ? strtof(text, NULL) == (float)val : strtod(text, NULL) == val) break;
+	}
+	if (!CF_STRCHR(text, '.') && !CF_STRCHR(text, 'e')) {
+		text[n++] = '.';
+		text[n++] = '0';
+	}
+	s_put(w, text, n);
+}
+
+void cf_json_write_float(CF_JsonWriter writer, float val)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (s_begin_value(w)) s_put_real(w, val, true);
+}
+
+void cf_json_write_double(CF_JsonWriter writer, double val)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (s_begin_value(w)) s_put_real(w, val, false);
+}
+
+void cf_json_write_bool(CF_JsonWriter writer, bool val)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (s_begin_value(w)) s_put(w, val ? "true" : "false");
+}
+
+void cf_json_write_string(CF_JsonWriter writer, const char* val)
+{
+	cf_json_write_string_range(writer, val, val + CF_STRLEN(val));
+}
+
+void cf_json_write_string_range(CF_JsonWriter writer, const char* begin, const char* end)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (s_begin_value(w)) s_put_escaped(w, begin, end);
+}
+
+void cf_json_write_base64(CF_JsonWriter writer, const void* data, size_t size)
+{
+	CF_JsonWriterInternal* w = (CF_JsonWriterInternal*)writer.id;
+	if (!s_begin_value(w)) return;
+	// Base64 never needs escaping, so chunks are encoded straight into the output.
+	char chunk[CF_BASE64_ENCODED_SIZE(3 * 1024)];
+	CF_Base64Encoder encoder = cf_make_base64_encoder();
+	const uint8_t* bytes = (const uint8_t*)data;
+	s_put(w, '"');
+	for (size_t offset = 0; offset < size; offset += 3 * 1024) {
+		size_t count = size - offset < 3 * 1024 ? size - offset : 3 * 1024;
+		s_put(w, chunk, (int)cf_base64_encoder_update(&encoder, chunk, bytes + offset, count));
+	}
+	s_put(w, chunk, (int)cf_base64_encoder_finish(&encoder, chunk));
+	s_put(w, '"');
+}
+
+//--------------------------------------------------------------------------------------------------
+// Streaming reader.
+
+#define CF_JSON_READER_CHUNK_SIZE (64 * 1024)
+
+enum
+{
+	CF_JSON_READER_SCOPE_OBJECT = 1,
+	CF_JSON_READER_SCOPE_HAS_VALUES = 2,
+};
+
+struct CF_JsonReaderInternal
+{
+	// Text comes from either memory, or from a file a chunk at a time.
+	const char* text = NULL;
+	size_t pos = 0;
+	size_t len = 0;
+	CF_File* file = NULL;
+	char* chunk = NULL;
+	int line = 1;
+
+	dyna uint8_t* scopes = NULL;
+	bool key_pending = false;
+	bool root_read = false;
+	CF_JToken token = CF_JTOKEN_END;
+
+	// The value of the last token.
+	char* string = NULL;
+	char number[64];
+	bool is_true = false;
+
+	CF_Result result = cf_result_success();
+	char* error = NULL;
+};
+
+static int s_peek(CF_JsonReaderInternal* r)
+{
+	if (r->pos == r->len) {
+		if (!r->file) return -1;
+		size_t n = cf_fs_read(r->file, r->chunk, CF_JSON_READER_CHUNK_SIZE);
+		if (!n) return -1;
+		r->text = r->chunk;
+		r->pos = 0;
+		r->len = n;
+	}
+	return (uint8_t)r->text[r->pos];
+}
+
+static int s_get(CF_JsonReaderInternal* r)
+{
+	int c = s_peek(r);
+	if (c >= 0) {
+		r->pos++;
+		if (c == '\n') r->line++;
+	}
+	return c;
+}
+
+static CF_JToken s_error(CF_JsonReaderInternal* r, const char* details)
+{
+	if (r->token != CF_JTOKEN_ERROR) {
+		sfmt(r->error, "%s (line %d).", details, r->line);
+		r->result = cf_result_error(r->error);
+		r->token = CF_JTOKEN_ERROR;
+	}
+	return CF_JTOKEN_ERROR;
+}
+
+// Skips whitespace and comments, returning the next character without consuming it.
+static int s_skip_whitespace(CF_JsonReaderInternal* r)
+{
+	while (true) {
+		int c = s_peek(r);
+		if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+			s_get(r);
+		} else if (c == '/') {
+			s_get(r);
+			int kind = s_get(r);
+			if (kind == '/') {
+				while ((c = s_get(r)) >= 0 && c != '\n') {}
+			} else if (kind == '*') {
+				int prev = 0;
+				while ((c = s_get(r)) >= 0 && !(prev == '*' && c == '/')) prev = c;
+				if (c < 0) return -2;
+			} else {
+				return -2;
+			}
+		} else {
+			return c;
+		}
+	}
+}
+
+static int s_hex_digit(int c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+static int s_read_hex4(CF_JsonReaderInternal* r)
+{
+	int value = 0;
+	for (int i = 0; i < 4; ++i) {
+		int digit = s_hex_digit(s_get(r));
+		if (digit < 0) return -1;
+		value = (value << 4) | digit;
+	}
+	return value;
+}
+
+// Reads a string after its opening quote into `r->string`, decoding escapes.
+static bool s_read_string(CF_JsonReaderInternal* r)
+{
+	sclear(r->string);
+	while (true) {
+		// Copy runs of plain characters straight out of the buffer.
+		if (s_peek(r) < 0) return false;
+		size_t start = r->pos;
+		while (r->pos < r->len) {
+			char c = r->text[r->pos];
+			if (c == '"' || c == '\\' || c == '\n') break;
+			r->pos++;
+		}
+		if (r->pos > start) sappend_range(r->string, r->text + start, r->text + r->pos);
+		if (r->pos == r->len) continue;
+
+		int c = s_get(r);
+		if (c == '"') return true;
+		if (c == '\n') {
+			spush(r->string, '\n');
+			continue;
+		}
+		switch (s_get(r)) {
+		case '"': spush(r->string, '"'); break;
+		case '\\': spush(r->string, '\\'); break;
+		case '/': spush(r->string, '/'); break;
+		case 'b': spush(r->string, '\b'); break;
+		case 'f': spush(r->string, '\f'); break;
+		case 'n': spush(r->string, '\n'); break;
+		case 'r': spush(r->string, '\r'); break;
+		case 't': spush(r->string, '\t'); break;
+		case 'u': {
+			int cp = s_read_hex4(r);
+			if (cp < 0) return false;
+			if (cp >= 0xD800 && cp < 0xDC00 && s_peek(r) == '\\') {
+				s_get(r);
+				if (s_get(r) != 'u') return false;
+				int low = s_read_hex4(r);
+				if (low < 0xDC00 || low >= 0xE000) return false;
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+			}
+			sappend_UTF8(r->string, cp);
+		} break;
+		default: return false;
+		}
+	}
+}
+
+static bool s_is_number_char(int c)
+{
+	return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static CF_JToken s_read_value(CF_JsonReaderInternal* r, int c)
+{
+	if (c == '{' || c == '[') {
+		s_get(r);
+		apush(r->scopes, (uint8_t)(c == '{' ? CF_JSON_READER_SCOPE_OBJECT : 0));
+		return c == '{' ? CF_JTOKEN_BEGIN_OBJECT : CF_JTOKEN_BEGIN_ARRAY;
+	}
+	if (c == '"') {
+		s_get(r);
+		if (!s_read_string(r)) return s_error(r, "Invalid json string");
+		return CF_JTOKEN_STRING;
+	}
+
+	// Literals and numbers are read whole into a small buffer.
+	int n = 0;
+	while (s_is_number_char(c = s_peek(r))) {
+		if (n == sizeof(r->number) - 1) return s_error(r, "Json number too long");
+		r->number[n++] = (char)s_get(r);
+	}
+	r->number[n] = 0;
+	if (!n) return s_error(r, "Unexpected character in json");
+	if (!CF_STRCMP(r->number, "null")) return CF_JTOKEN_NULL;
+	if (!CF_STRCMP(r->number, "true") || !CF_STRCMP(r->number, "false")) {
+		r->is_true = r->number[0] == 't';
+		return CF_JTOKEN_BOOL;
+	}
+	if (!CF_STRCMP(r->number, "NaN") || !CF_STRCMP(r->number, "Infinity") || !CF_STRCMP(r->number, "-Infinity")) return CF_JTOKEN_FLOAT;
+	char* end = NULL;
+	bool is_float = CF_STRCHR(r->number, '.') || CF_STRCHR(r->number, 'e') || CF_STRCHR(r->number, 'E');
+	strtod(r->number, &end);
+	if (*end || !(r->number[0] == '-' || (r->number[0] >= '0' && r->number[0] <= '9'))) return s_error(r, "Invalid json value");
+	return is_float ? CF_JTOKEN_FLOAT : CF_JTOKEN_INT;
+}
+
+static CF_JToken s_next(CF_JsonReaderInternal* r)
+{
+	if (r->token == CF_JTOKEN_ERROR) return CF_JTOKEN_ERROR;
+	sclear(r->string);
+	int c = s_skip_whitespace(r);
+	if (c == -2) return s_error(r, "Unterminated json comment");
+
+	int depth = asize(r->scopes);
+	if (!depth) {
+		if (r->root_read) {
+			if (c >= 0) return s_error(r, "Unexpected characters after the json root value");
+			return CF_JTOKEN_END;
+		}
+		if (c < 0) return s_error(r, "Empty json text");
+		r->root_read = true;
+		return s_read_value(r, c);
+	}
+
+	uint8_t* scope = r->scopes + depth - 1;
+	bool is_object = *scope & CF_JSON_READER_SCOPE_OBJECT;
+	if (is_object && r->key_pending) {
+		if (c < 0) return s_error(r, "Unexpected end of json");
+		r->key_pending = false;
+		return s_read_value(r, c);
+	}
+
+	// Closes the scope, or moves past the comma between values. Trailing commas are allowed.
+	int close = is_object ? '}' : ']';
+	if (c != close && (*scope & CF_JSON_READER_SCOPE_HAS_VALUES)) {
+		if (c != ',') return s_error(r, c < 0 ? "Unexpected end of json" : "Expected a comma in json");
+		s_get(r);
+		c = s_skip_whitespace(r);
+		if (c == -2) return s_error(r, "Unterminated json comment");
+	}
+	if (c == close) {
+		s_get(r);
+		apop(r->scopes);
+		return is_object ? CF_JTOKEN_END_OBJECT : CF_JTOKEN_END_ARRAY;
+	}
+	if (c < 0) return s_error(r, "Unexpected end of json");
+	*scope |= CF_JSON_READER_SCOPE_HAS_VALUES;
+
+	if (!is_object) return s_read_value(r, c);
+	if (c != '"') return s_error(r, "Expected a key in json object");
+	s_get(r);
+	if (!s_read_string(r)) return s_error(r, "Invalid json key");
+	c = s_skip_whitespace(r);
+	if (c != ':') return s_error(r, "Expected a colon after json key");
+	s_get(r);
+	r->key_pending = true;
+	return CF_JTOKEN_KEY;
+}
+
+static CF_JsonReader s_make_reader(CF_JsonReaderInternal* r)
+{
+	CF_JsonReader result;
+	result.id = (uint64_t)r;
+	return result;
+}
+
+CF_JsonReader cf_make_json_reader(const void* data, size_t size)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	CF_JsonReaderInternal* r = CF_NEW(CF_JsonReaderInternal);
+	r->text = (const char*)data;
+	r->len = size;
+	return s_make_reader(r);
+}
+
+CF_JsonReader cf_make_json_reader_from_file(const char* virtual_path)
+{
+	CF_ALLOC_TAG_SCOPE("json");
+	CF_JsonReaderInternal* r = CF_NEW(CF_JsonReaderInternal);
+	r->file = cf_fs_open_file_for_read(virtual_path);
+	if (r->file) {
+		r->chunk = (char*)cf_alloc(CF_JSON_READER_CHUNK_SIZE);
+	} else {
+		r->line = 0;
+		s_error(r, "Unable to open json file");
+	}
+	return s_make_reader(r);
+}
+
+void cf_destroy_json_reader(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	if (r->file) cf_fs_close(r->file);
+	cf_free(r->chunk);
+	afree(r->scopes);
+	sfree(r->string);
+	sfree(r->error);
+	r->~CF_JsonReaderInternal();
+	cf_free(r);
+}
+
+CF_JToken cf_json_reader_next(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	CF_JToken token = s_next(r);
+	if (r->token != CF_JTOKEN_ERROR) r->token = token;
+	return token;
+}
+
+void cf_json_reader_skip(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	int depth = asize(r->scopes);
+	if (r->token == CF_JTOKEN_KEY) {
+		CF_JToken token = cf_json_reader_next(reader);
+		if (token != CF_JTOKEN_BEGIN_OBJECT && token != CF_JTOKEN_BEGIN_ARRAY) return;
+		depth++;
+	} else if (r->token != CF_JTOKEN_BEGIN_OBJECT && r->token != CF_JTOKEN_BEGIN_ARRAY) {
+		return;
+	}
+	while (asize(r->scopes) >= depth) {
+		if (cf_json_reader_next(reader) <= CF_JTOKEN_ERROR) return;
+	}
+}
+
+int cf_json_reader_depth(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	return asize(r->scopes);
+}
+
+const char* cf_json_reader_get_string(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	return r->string ? r->string : "";
+}
+
+int cf_json_reader_get_len(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	return r->string ? slen(r->string) : 0;
+}
+
+int64_t cf_json_reader_get_i64(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	if (r->token == CF_JTOKEN_INT) return strtoll(r->number, NULL, 10);
+	if (r->token == CF_JTOKEN_FLOAT) return (int64_t)cf_json_reader_get_double(reader);
+	return 0;
+}
+
+uint64_t cf_json_reader_get_u64(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	if (r->token == CF_JTOKEN_INT) return r->number[0] == '-' ? (uint64_t)strtoll(r->number, NULL, 10) : strtoull(r->number, NULL, 10);
+	if (r->token == CF_JTOKEN_FLOAT) return (uint64_t)cf_json_reader_get_double(reader);
+	return 0;
+}
+
+double cf_json_reader_get_double(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	if (r->token != CF_JTOKEN_INT && r->token != CF_JTOKEN_FLOAT) return 0;
+	if (!CF_STRCMP(r->number, "NaN")) return (double)NAN;
+	if (!CF_STRCMP(r->number, "Infinity")) return (double)INFINITY;
+	if (!CF_STRCMP(r->number, "-Infinity")) return -(double)INFINITY;
+	return strtod(r->number, NULL);
+}
+
+bool cf_json_reader_get_bool(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	return r->token == CF_JTOKEN_BOOL && r->is_true;
+}
+
+CF_Result cf_json_reader_get_base64(CF_JsonReader reader, void* dst, size_t dst_size, size_t* out_size)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	if (out_size) *out_size = 0;
+	if (r->token != CF_JTOKEN_STRING) return cf_result_error("The last json token isn't a string.");
+	int len = r->string ? slen(r->string) : 0;
+	CF_Result result = cf_base64_decode(dst, dst_size, r->string, len);
+	if (!cf_is_error(result) && out_size) {
+		size_t pads = len >= 2 ? (r->string[len - 1] == '=') + (r->string[len - 2] == '=') : 0;
+		*out_size = CF_BASE64_DECODED_SIZE(len) - pads;
+	}
+	return result;
+}
+
+CF_Result cf_json_reader_result(CF_JsonReader reader)
+{
+	CF_JsonReaderInternal* r = (CF_JsonReaderInternal*)reader.id;
+	return r->result;
+}
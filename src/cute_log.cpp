@@ -0,0 +1,570 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_log.h>
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+#include <cute_file_system.h>
+#include <cute_multithreading.h>
+#include <cute_string.h>
+#include <cute_time.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_log_internal.h>
+
+#include <physfs/physfs.h>
+
+#include <atomic>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+
+using namespace Cute;
+
+// Logging a message doesn't format it. The format string pointer and the raw arguments are copied into a
+// fixed-size record and pushed onto an SPSC queue owned by the calling thread. A background thread pops the
+// records every few milliseconds, walks the same format string to decode the arguments, formats the text,
+// and hands it to each sink.
+
+#define CF_LOG_RECORD_SIZE 256
+#define CF_LOG_QUEUE_CAPACITY 1024
+#define CF_LOG_INTERVAL_MS 5
+
+struct CF_LogRecord
+{
+	const char* fmt;
+	uint16_t size; // Bytes of `payload` in use.
+	uint8_t level;
+	uint8_t truncated;
+	uint8_t payload[CF_LOG_RECORD_SIZE - 16];
+};
+
+static_assert(sizeof(CF_LogRecord) <= CF_LOG_RECORD_SIZE, "Log records should fit in CF_LOG_RECORD_SIZE.");
+
+struct CF_LogThread
+{
+	CF_SPSCQueue* queue;
+	// Only written by the owning thread.
+	std::atomic<uint64_t> dropped_count;
+	std::atomic<uint64_t> truncated_count;
+};
+
+struct CF_Logger
+{
+	std::atomic<int> level;
+	std::atomic<int> running;
+	// Bumped whenever the thread list is freed, so threads know to register again.
+	std::atomic<int> generation;
+
+	// Guards the thread list and starting the background thread.
+	CF_Mutex threads_mutex;
+	CF_Thread* thread;
+	Array<CF_LogThread*> threads;
+
+	// Guards everything below, so only one thread at a time drains the queues and writes to the sinks.
+	CF_Mutex write_mutex;
+	bool no_stdout;
+	CF_File* file;
+	CF_LogSinkFn* sink;
+	void* sink_udata;
+	std::atomic<uint64_t> written_count;
+	Array<CF_LogThread*> snapshot;
+	char* message;
+	char* out;
+};
+
+static CF_Logger s_log;
+static thread_local CF_LogThread* s_thread;
+static thread_local int s_thread_generation;
+
+//--------------------------------------------------------------------------------------------------
+// Format strings.
+
+enum CF_LogLength
+{
+	CF_LOG_LENGTH_NONE,
+	CF_LOG_LENGTH_HH,
+	CF_LOG_LENGTH_H,
+	CF_LOG_LENGTH_L,
+	CF_LOG_LENGTH_LL,
+	CF_LOG_LENGTH_J,
+	CF_LOG_LENGTH_Z,
+	CF_LOG_LENGTH_T,
+	CF_LOG_LENGTH_BIG_L,
+};
+
+struct CF_LogSpec
+{
+	const char* begin; // The '%'.
+	const char* length; // The length modifier, or the conversion if there isn't one.
+	const char* end; // One past the conversion.
+	bool star_width;
+	bool star_precision;
+	CF_LogLength length_type;
+	char conversion;
+};
+
+// Finds the next conversion in `fmt`, skipping over "%%".
+static bool s_next_spec(const char* fmt, CF_LogSpec* spec)
+{
+	while (*fmt) {
+		if (*fmt != '%') {
+			++fmt;
+			continue;
+		}
+		const char* c = fmt + 1;
+		if (*c == '%') {
+			fmt = c + 1;
+			continue;
+		}
+		spec->begin = fmt;
+		while (*c && CF_STRCHR("-+ #0'", *c)) ++c;
+		spec->star_width = *c == '*';
+		if (spec->star_width) ++c;
+		else while (*c >= '0' && *c <= '9') ++c;
+		spec->star_precision = false;
+		if (*c == '.') {
+			++c;
+			spec->star_precision = *c == '*';
+			if (spec->star_precision) ++c;
+			else while (*c >= '0' && *c <= '9') ++c;
+		}
+		spec->length = c;
+		spec->length_type = CF_LOG_LENGTH_NONE;
+		switch (*c) {
+		case 'h': if (c[1] == 'h') { spec->length_type = CF_LOG_LENGTH_HH; ++c; } else spec->length_type = CF_LOG_LENGTH_H; ++c; break;
+		case 'l': if (c[1] == 'l') { spec->length_type = CF_LOG_LENGTH_LL; ++c; } else spec->length_type = CF_LOG_LENGTH_L; ++c; break;
+		case 'j': spec->length_type = CF_LOG_LENGTH_J; ++c; break;
+		case 'z': spec->length_type = CF_LOG_LENGTH_Z; ++c; break;
+		case 't': spec->length_type = CF_LOG_LENGTH_T; ++c; break;
+		case 'L': spec->length_type = CF_LOG_LENGTH_BIG_L; ++c; break;
+		}
+		spec->conversion = *c;
+		spec->end = *c ? c + 1 : c;
+		return true;
+	}
+	return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Encoding arguments on the logging thread.
+
+static bool s_put(CF_LogRecord* record, const void* data, int size)
+{
+	if (record->size + size > (int)sizeof(record->payload)) return false;
+	CF_MEMCPY(record->payload + record->size, data, size);
+	record->size += (uint16_t)size;
+	return true;
+}
+
+static bool s_put_string(CF_LogRecord* record, const char* s)
+{
+	if (!s) s = "(null)";
+	int room = (int)sizeof(record->payload) - record->size - (int)sizeof(uint16_t);
+	if (room < 0) return false;
+	int len = (int)CF_STRLEN(s);
+	if (len > room) {
+		len = room;
+		record->truncated = 1;
+	}
+	uint16_t len16 = (uint16_t)len;
+	s_put(record, &len16, sizeof(len16));
+	s_put(record, s, len);
+	return !record->truncated;
+}
+
+static bool s_encode_arg(CF_LogRecord* record, const CF_LogSpec& spec, va_list* args)
+{
+	if (spec.star_width) {
+		int width = va_arg(*args, int);
+		if (!s_put(record, &width, sizeof(width))) return false;
+	}
+	if (spec.star_precision) {
+		int precision = va_arg(*args, int);
+		if (!s_put(record, &precision, sizeof(precision))) return false;
+	}
+	switch (spec.conversion) {
+	case 'd': case 'i':
+	{
+		int64_t v;
+		switch (spec.length_type) {
+		case CF_LOG_LENGTH_HH: v = (signed char)va_arg(*args, int); break;
+		case CF_LOG_LENGTH_H: v = (short)va_arg(*args, int); break;
+		case CF_LOG_LENGTH_L: v = va_arg(*args, long); break;
+		case CF_LOG_LENGTH_LL: v = va_arg(*args, long long); break;
+		case CF_LOG_LENGTH_J: v = va_arg(*args, intmax_t); break;
+		case CF_LOG_LENGTH_Z: case CF_LOG_LENGTH_T: v = va_arg(*args, ptrdiff_t); break;
+		default: v = va_arg(*args, int); break;
+		}
+		return s_put(record, &v, sizeof(v));
+	}
+	case 'u': case 'o': case 'x': case 'X':
+	{
+		uint64_t v;
+		switch (spec.length_type) {
+		case CF_LOG_LENGTH_HH: v = (unsigned char)va_arg(*args, unsigned); break;
+		case CF_LOG_LENGTH_H: v = (unsigned short)va_arg(*args, unsigned); break;
+		case CF_LOG_LENGTH_L: v = va_arg(*args, unsigned long); break;
+		case CF_LOG_LENGTH_LL: v = va_arg(*args, unsigned long long); break;
+		case CF_LOG_LENGTH_J: v = va_arg(*args, uintmax_t); break;
+		case CF_LOG_LENGTH_Z: v = va_arg(*args, size_t); break;
+		case CF_LOG_LENGTH_T: v = (uint64_t)va_arg(*args, ptrdiff_t); break;
+		default: v = va_arg(*args, unsigned); break;
+		}
+		return s_put(record, &v, sizeof(v));
+	}
+	case 'c':
+	{
+		int v = va_arg(*args, int);
+		return s_put(record, &v, sizeof(v));
+	}
+	case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+	{
+		double v = spec.length_type == CF_LOG_LENGTH_BIG_L ? (double)va_arg(*args, long double) : va_arg(*args, double);
+		return s_put(record, &v, sizeof(v));
+	}
+	case 's':
+		// Wide strings aren't supported, but still have to be skipped over.
+		if (spec.length_type == CF_LOG_LENGTH_L) {
+			va_arg(*args, void*);
+			return s_put_string(record, "(wide string)");
+		}
+		return s_put_string(record, va_arg(*args, const char*));
+	case 'p':
+	{
+		uint64_t v = (uint64_t)(uintptr_t)va_arg(*args, void*);
+		return s_put(record, &v, sizeof(v));
+	}
+	case 'n':
+		va_arg(*args, void*);
+		return true;
+	default:
+		// Unknown conversions leave no way to know what's in the argument list.
+		record->truncated = 1;
+		return false;
+	}
+}
+
+static CF_LogThread* s_log_thread();
+
+void cf_log(CF_LogLevel level, const char* fmt, ...)
+{
+	if ((int)level < s_log.level.load(std::memory_order_relaxed)) return;
+	CF_LogThread* thread = s_log_thread();
+	CF_LogRecord record;
+	record.fmt = fmt;
+	record.size = 0;
+	record.level = (uint8_t)level;
+	record.truncated = 0;
+	va_list args;
+	va_start(args, fmt);
+	CF_LogSpec spec;
+	const char* c = fmt;
+	while (s_next_spec(c, &spec)) {
+		if (!s_encode_arg(&record, spec, &args)) {
+			record.truncated = 1;
+			break;
+		}
+		c = spec.end;
+	}
+	va_end(args);
+	if (record.truncated) {
+		thread->truncated_count.store(thread->truncated_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+	// Dropped rather than blocking when the background thread can't keep up.
+	if (!cf_spsc_queue_push(thread->queue, &record)) {
+		thread->dropped_count.store(thread->dropped_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Decoding and writing on the background thread.
+
+static bool s_get(const CF_LogRecord* record, int* offset, void* data, int size)
+{
+	if (*offset + size > record->size) return false;
+	CF_MEMCPY(data, record->payload + *offset, size);
+	*offset += size;
+	return true;
+}
+
+// Appends plain text from a format string, collapsing "%%".
+static void s_append_literal(char*& s, const char* begin, const char* end)
+{
+	for (const char* c = begin; c < end; ++c) {
+		spush(s, *c);
+		if (*c == '%' && c + 1 < end && c[1] == '%') ++c;
+	}
+}
+
+static bool s_format_arg(char*& s, const CF_LogRecord* record, int* offset, const CF_LogSpec& spec)
+{
+	// Rebuild the conversion with any '*' filled in, and the length modifier swapped for the decoded type.
+	char buf[64];
+	int n = 0;
+	int stars[2];
+	int star_count = 0;
+	if (spec.star_width && !s_get(record, offset, &stars[star_count++], sizeof(int))) return false;
+	if (spec.star_precision && !s_get(record, offset, &stars[star_count++], sizeof(int))) return false;
+	int star = 0;
+	for (const char* c = spec.begin; c < spec.length; ++c) {
+		if (n > (int)sizeof(buf) - 16) return false;
+		if (*c == '*') n += CF_SNPRINTF(buf + n, sizeof(buf) - n, "%d", stars[star++]);
+		else buf[n++] = *c;
+	}
+	switch (spec.conversion) {
+	case 'd': case 'i':
+	{
+		int64_t v;
+		if (!s_get(record, offset, &v, sizeof(v))) return false;
+		CF_SNPRINTF(buf + n, sizeof(buf) - n, "ll%c", spec.conversion);
+		sfmt_append(s, buf, (long long)v);
+		return true;
+	}
+	case 'u': case 'o': case 'x': case 'X':
+	{
+		uint64_t v;
+		if (!s_get(record, offset, &v, sizeof(v))) return false;
+		CF_SNPRINTF(buf + n, sizeof(buf) - n, "ll%c", spec.conversion);
+		sfmt_append(s, buf, (unsigned long long)v);
+		return true;
+	}
+	case 'c':
+	{
+		int v;
+		if (!s_get(record, offset, &v, sizeof(v))) return false;
+		CF_SNPRINTF(buf + n, sizeof(buf) - n, "c");
+		sfmt_append(s, buf, v);
+		return true;
+	}
+	case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+	{
+		double v;
+		if (!s_get(record, offset, &v, sizeof(v))) return false;
+		CF_SNPRINTF(buf + n, sizeof(buf) - n, "%c", spec.conversion);
+		sfmt_append(s, buf, v);
+		return true;
+	}
+	case 's':
+	{
+		uint16_t len;
+		char str[sizeof(record->payload) + 1];
+		if (!s_get(record, offset, &len, sizeof(len)) || !s_get(record, offset, str, len)) return false;
+		str[len] = 0;
+		CF_SNPRINTF(buf + n, sizeof(buf) - n, "s");
+		sfmt_append(s, buf, str);
+		return true;
+	}
+	case 'p':
+	{
+		uint64_t v;
+		if (!s_get(record, offset, &v, sizeof(v))) return false;
+		CF_SNPRINTF(buf + n, sizeof(buf) - n, "p");
+		sfmt_append(s, buf, (void*)(uintptr_t)v);
+		return true;
+	}
+	case 'n':
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void s_format(char*& s, const CF_LogRecord* record)
+{
+	sclear(s);
+	int offset = 0;
+	bool cut = false;
+	CF_LogSpec spec;
+	const char* c = record->fmt;
+	while (s_next_spec(c, &spec)) {
+		s_append_literal(s, c, spec.begin);
+		if (!s_format_arg(s, record, &offset, spec)) {
+			cut = true;
+			break;
+		}
+		c = spec.end;
+	}
+	if (!cut) s_append_literal(s, c, c + CF_STRLEN(c));
+	if (record->truncated) sappend(s, "...");
+	// Each message is its own line, so drop the newline printf-style messages usually end with.
+	while (slen(s) && slast(s) == '\n') spop(s);
+}
+
+static const char* s_level_name(int level)
+{
+	switch (level) {
+	case CF_LOG_LEVEL_DEBUG: return "debug";
+	case CF_LOG_LEVEL_INFO: return "info";
+	case CF_LOG_LEVEL_WARNING: return "warning";
+	case CF_LOG_LEVEL_ERROR: return "error";
+	default: return "?";
+	}
+}
+
+// Call with the write mutex held.
+static void s_drain()
+{
+	cf_mutex_lock(&s_log.threads_mutex);
+	s_log.snapshot.clear();
+	for (int i = 0; i < s_log.threads.count(); ++i) s_log.snapshot.add(s_log.threads[i]);
+	cf_mutex_unlock(&s_log.threads_mutex);
+
+	sclear(s_log.out);
+	CF_LogRecord record;
+	for (int i = 0; i < s_log.snapshot.count(); ++i) {
+		CF_SPSCQueue* queue = s_log.snapshot[i]->queue;
+		while (cf_spsc_queue_pop(queue, &record)) {
+			s_format(s_log.message, &record);
+			sfmt_append(s_log.out, "[%s] %s\n", s_level_name(record.level), s_log.message);
+			if (s_log.sink) s_log.sink((CF_LogLevel)record.level, s_log.message, s_log.sink_udata);
+			s_log.written_count.store(s_log.written_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		}
+	}
+	if (!slen(s_log.out)) return;
+
+	// Written in one go per drain, rather than per message.
+	if (!s_log.no_stdout) {
+		fwrite(s_log.out, 1, (size_t)slen(s_log.out), stdout);
+		fflush(stdout);
+	}
+	if (s_log.file) {
+		cf_fs_write(s_log.file, s_log.out, (size_t)slen(s_log.out));
+		// Flushed right away, so the file has everything up to a crash.
+		PHYSFS_flush((PHYSFS_File*)s_log.file);
+	}
+}
+
+static int s_log_thread_fn(void* udata)
+{
+	CF_UNUSED(udata);
+	while (s_log.running.load()) {
+		cf_log_flush();
+		cf_sleep(CF_LOG_INTERVAL_MS);
+	}
+	return 0;
+}
+
+static CF_LogThread* s_log_thread()
+{
+	int generation = s_log.generation.load(std::memory_order_relaxed);
+	if (s_thread && s_thread_generation == generation) return s_thread;
+	CF_LogThread* thread = (CF_LogThread*)CF_ALLOC(sizeof(CF_LogThread));
+	CF_PLACEMENT_NEW(thread) CF_LogThread();
+	thread->queue = cf_make_spsc_queue(CF_LOG_QUEUE_CAPACITY, sizeof(CF_LogRecord));
+	cf_mutex_lock(&s_log.threads_mutex);
+	s_log.threads.add(thread);
+	if (!s_log.thread) {
+		static bool s_registered_atexit;
+		if (!s_registered_atexit) {
+			// Programs that never make an app still get their last messages written out.
+			atexit(cf_log_shutdown);
+			s_registered_atexit = true;
+		}
+		s_log.running = 1;
+		s_log.thread = cf_thread_create(s_log_thread_fn, "Cute Log", NULL);
+	}
+	cf_mutex_unlock(&s_log.threads_mutex);
+	s_thread = thread;
+	s_thread_generation = generation;
+	return thread;
+}
+
+void cf_log_flush()
+{
+	cf_mutex_lock(&s_log.write_mutex);
+	s_drain();
+	cf_mutex_unlock(&s_log.write_mutex);
+}
+
+void cf_log_set_level(CF_LogLevel level)
+{
+	s_log.level = (int)level;
+}
+
+void cf_log_set_stdout(bool enabled)
+{
+	cf_mutex_lock(&s_log.write_mutex);
+	s_log.no_stdout = !enabled;
+	cf_mutex_unlock(&s_log.write_mutex);
+}
+
+CF_Result cf_log_set_file(const char* virtual_path)
+{
+	CF_Result result = cf_result_success();
+	cf_mutex_lock(&s_log.write_mutex);
+	if (s_log.file) {
+		s_drain();
+		cf_fs_close(s_log.file);
+		s_log.file = NULL;
+	}
+	if (virtual_path) {
+		s_log.file = cf_fs_open_file_for_append(virtual_path);
+		if (!s_log.file) result = cf_result_error("Unable to open log file.");
+	}
+	cf_mutex_unlock(&s_log.write_mutex);
+	return result;
+}
+
+void cf_log_set_sink(CF_LogSinkFn* fn, void* udata)
+{
+	cf_mutex_lock(&s_log.write_mutex);
+	s_log.sink = fn;
+	s_log.sink_udata = udata;
+	cf_mutex_unlock(&s_log.write_mutex);
+}
+
+CF_LogStats cf_log_stats()
+{
+	CF_LogStats stats;
+	stats.written_count = s_log.written_count.load(std::memory_order_relaxed);
+	stats.dropped_count = 0;
+	stats.truncated_count = 0;
+	cf_mutex_lock(&s_log.threads_mutex);
+	for (int i = 0; i < s_log.threads.count(); ++i) {
+		stats.dropped_count += s_log.threads[i]->dropped_count.load(std::memory_order_relaxed);
+		stats.truncated_count += s_log.threads[i]->truncated_count.load(std::memory_order_relaxed);
+	}
+	cf_mutex_unlock(&s_log.threads_mutex);
+	return stats;
+}
+
+void cf_log_shutdown()
+{
+	cf_mutex_lock(&s_log.threads_mutex);
+	CF_Thread* thread = s_log.thread;
+	s_log.thread = NULL;
+	s_log.running = 0;
+	cf_mutex_unlock(&s_log.threads_mutex);
+	if (thread) cf_thread_wait(thread);
+
+	cf_mutex_lock(&s_log.write_mutex);
+	s_drain();
+	if (s_log.file) {
+		cf_fs_close(s_log.file);
+		s_log.file = NULL;
+	}
+	sfree(s_log.message);
+	sfree(s_log.out);
+	s_log.message = NULL;
+	s_log.out = NULL;
+	cf_mutex_unlock(&s_log.write_mutex);
+
+	cf_mutex_lock(&s_log.threads_mutex);
+	s_log.generation.fetch_add(1);
+	for (int i = 0; i < s_log.threads.count(); ++i) {
+		cf_destroy_spsc_queue(s_log.threads[i]->queue);
+		s_log.threads[i]->~CF_LogThread();
+		CF_FREE(s_log.threads[i]);
+	}
+	// Steal the lists into locals to free their memory on the way out.
+	Array<CF_LogThread*> threads;
+	Array<CF_LogThread*> snapshot;
+	threads.steal_from(&s_log.threads);
+	snapshot.steal_from(&s_log.snapshot);
+	cf_mutex_unlock(&s_log.threads_mutex);
+}
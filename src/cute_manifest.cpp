@@ -0,0 +1,354 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_manifest.h>
+#include <cute_file_system.h>
+#include <cute_sprite.h>
+#include <cute_draw.h>
+#include <cute_array.h>
+#include <cute_hashtable.h>
+#include <cute_string.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_app_internal.h>
+#include <internal/cute_aseprite_cache_internal.h>
+#include <internal/cute_manifest_internal.h>
+
+using namespace Cute;
+
+enum CF_AssetType
+{
+	CF_ASSET_TYPE_SPRITE,
+	CF_ASSET_TYPE_FONT,
+	CF_ASSET_TYPE_AUDIO,
+	CF_ASSET_TYPE_JSON,
+	CF_ASSET_TYPE_COUNT
+};
+
+// An asset shared by every loaded manifest listing it.
+struct CF_Asset
+{
+	CF_AssetType type;
+	const char* path;
+	const char* name;      // Fonts only.
+	int ref_count;
+	bool loading;
+	bool made_font;        // False for fonts already made some other way, which are left alone.
+	CF_FileRequest request;
+	CF_Result result;
+	CF_Audio audio;
+	CF_JDoc json;
+};
+
+struct CF_ManifestAsset
+{
+	CF_AssetType type;
+	const char* path;
+	const char* name;
+};
+
+struct CF_ManifestInternal
+{
+	Array<CF_ManifestAsset> assets;
+	Array<CF_Asset*> loaded;
+	bool is_loaded = false;
+	CF_Result result = cf_result_success();
+};
+
+// Loaded assets per type, keyed by their interned path, or name for fonts.
+CF_GLOBAL static Map<const char*, CF_Asset*> s_assets[CF_ASSET_TYPE_COUNT];
+CF_GLOBAL static Array<CF_ManifestInternal*> s_manifests;
+
+static const char* s_asset_key(CF_AssetType type, const char* path, const char* name)
+{
+	return type == CF_ASSET_TYPE_FONT ? name : path;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Reading manifests.
+
+static void s_error(CF_ManifestInternal* m, const char* details)
+{
+	if (!cf_is_error(m->result)) m->result = cf_result_error(details);
+}
+
+static void s_add(CF_ManifestInternal* m, CF_AssetType type, const char* path, const char* name)
+{
+	path = sintern(path);
+	name = name ? sintern(name) : path;
+	const char* key = s_asset_key(type, path, name);
+	for (int i = 0; i < m->assets.count(); ++i) {
+		const CF_ManifestAsset& asset = m->assets[i];
+		if (asset.type == type && s_asset_key(asset.type, asset.path, asset.name) == key) return;
+	}
+	CF_ManifestAsset asset;
+	asset.type = type;
+	asset.path = path;
+	asset.name = name;
+	m->assets.add(asset);
+}
+
+static void s_read(CF_ManifestInternal* m, const char* path, Array<const char*>* visited)
+{
+	// Each manifest is read once, so shared and circular includes are fine.
+	path = sintern(path);
+	for (int i = 0; i < visited->count(); ++i) {
+		if ((*visited)[i] == path) return;
+	}
+	visited->add(path);
+
+	CF_JDoc doc = cf_make_json_readonly_from_file(path);
+	if (!doc.id) {
+		s_error(m, "Unable to read manifest, or it's not valid JSON.");
+		return;
+	}
+	CF_JVal root = cf_json_get_root(doc);
+
+	const char* arrays[] = { "sprites", "fonts", "audio", "json" };
+	for (int type = 0; type < CF_ASSET_TYPE_COUNT; ++type) {
+		CF_JVal list = cf_json_get(root, arrays[type]);
+		int count = cf_json_is_array(list) ? cf_json_get_len(list) : 0;
+		for (int i = 0; i < count; ++i) {
+			CF_JVal entry = cf_json_array_at(list, i);
+			if (cf_json_is_string(entry)) {
+				s_add(m, (CF_AssetType)type, cf_json_get_string(entry), NULL);
+			} else if (type == CF_ASSET_TYPE_FONT && cf_json_is_object(entry) && cf_json_is_string(cf_json_get(entry, "path"))) {
+				CF_JVal name = cf_json_get(entry, "name");
+				s_add(m, CF_ASSET_TYPE_FONT, cf_json_get_string(cf_json_get(entry, "path")), cf_json_is_string(name) ? cf_json_get_string(name) : NULL);
+			} else {
+				s_error(m, "Manifest has an entry that isn't a path.");
+			}
+		}
+	}
+
+	CF_JVal includes = cf_json_get(root, "include");
+	int count = cf_json_is_array(includes) ? cf_json_get_len(includes) : 0;
+	Array<const char*> paths;
+	for (int i = 0; i < count; ++i) {
+		CF_JVal include = cf_json_array_at(includes, i);
+		if (cf_json_is_string(include)) paths.add(sintern(cf_json_get_string(include)));
+		else s_error(m, "Manifest has an include that isn't a path.");
+	}
+	cf_destroy_json(doc);
+
+	for (int i = 0; i < paths.count(); ++i) {
+		s_read(m, paths[i], visited);
+	}
+}
+
+CF_Manifest cf_make_manifest(const char* virtual_path, CF_Result* result_out)
+{
+	CF_ManifestInternal* m = CF_NEW(CF_ManifestInternal);
+	Array<const char*> visited;
+	s_read(m, virtual_path, &visited);
+	s_manifests.add(m);
+	if (result_out) *result_out = m->result;
+	CF_Manifest result;
+	result.id = (uint64_t)m;
+	return result;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Loading assets.
+
+static void s_on_read(CF_FileRequest request, const char* virtual_path, CF_Result result, void* data, size_t size, void* udata)
+{
+	CF_Asset* asset = (CF_Asset*)udata;
+	asset->loading = false;
+	asset->request.id = 0;
+	if (cf_is_error(result)) {
+		asset->result = result;
+		return;
+	}
+
+	switch (asset->type) {
+	case CF_ASSET_TYPE_SPRITE:
+	{
+		CF_Sprite sprite = cf_sprite_defaults();
+		asset->result = cf_aseprite_cache_load_from_file_data(asset->path, data, (int)size, &sprite);
+		CF_FREE(data);
+	}	break;
+
+	case CF_ASSET_TYPE_FONT:
+		if (app->fonts.has(asset->name)) {
+			CF_FREE(data);
+		} else {
+			asset->result = cf_make_font_from_memory(data, (int)size, asset->name);
+			asset->made_font = !cf_is_error(asset->result);
+		}
+		break;
+
+	case CF_ASSET_TYPE_JSON:
+		asset->json = cf_make_json(data, size);
+		if (!asset->json.id) asset->result = cf_result_error("Unable to parse a JSON file listed in a manifest.");
+		CF_FREE(data);
+		break;
+
+	default:
+		CF_FREE(data);
+		break;
+	}
+}
+
+static CF_Asset* s_acquire(const CF_ManifestAsset& entry)
+{
+	Map<const char*, CF_Asset*>& assets = s_assets[entry.type];
+	const char* key = s_asset_key(entry.type, entry.path, entry.name);
+	CF_Asset** existing = assets.try_find(key);
+	if (existing) {
+		(*existing)->ref_count++;
+		return *existing;
+	}
+
+	CF_Asset* asset = CF_NEW(CF_Asset);
+	CF_MEMSET(asset, 0, sizeof(*asset));
+	asset->type = entry.type;
+	asset->path = entry.path;
+	asset->name = entry.name;
+	asset->ref_count = 1;
+	asset->result = cf_result_success();
+	assets.insert(key, asset);
+
+	if (entry.type == CF_ASSET_TYPE_AUDIO) {
+		if (cf_path_ext_equ(entry.path, ".ogg")) asset->audio = cf_audio_load_ogg_async(entry.path);
+		else if (cf_path_ext_equ(entry.path, ".wav")) asset->audio = cf_audio_load_wav_async(entry.path);
+		else asset->result = cf_result_error("Audio listed in a manifest must be .wav or .ogg.");
+	} else {
+		asset->loading = true;
+		asset->request = cf_fs_read_async(entry.path, CF_FILE_PRIORITY_NORMAL, s_on_read, asset);
+	}
+	return asset;
+}
+
+static void s_release(CF_Asset* asset)
+{
+	if (--asset->ref_count) return;
+	if (asset->loading) cf_fs_cancel_async(asset->request);
+
+	switch (asset->type) {
+	case CF_ASSET_TYPE_SPRITE: if (!asset->loading) cf_aseprite_cache_unload(asset->path); break;
+	case CF_ASSET_TYPE_FONT: if (asset->made_font) cf_destroy_font(asset->name); break;
+	case CF_ASSET_TYPE_AUDIO: if (asset->audio.id) cf_audio_destroy(asset->audio); break;
+	case CF_ASSET_TYPE_JSON: if (asset->json.id) cf_destroy_json(asset->json); break;
+	default: break;
+	}
+
+	s_assets[asset->type].remove(s_asset_key(asset->type, asset->path, asset->name));
+	CF_FREE(asset);
+}
+
+static bool s_is_done(CF_Asset* asset)
+{
+	if (asset->type == CF_ASSET_TYPE_AUDIO) return !asset->audio.id || cf_audio_is_ready(asset->audio);
+	return !asset->loading;
+}
+
+void cf_manifest_load(CF_Manifest manifest)
+{
+	CF_ManifestInternal* m = (CF_ManifestInternal*)manifest.id;
+	if (m->is_loaded) return;
+	m->is_loaded = true;
+	m->loaded.ensure_capacity(m->assets.count());
+	for (int i = 0; i < m->assets.count(); ++i) {
+		m->loaded.add(s_acquire(m->assets[i]));
+	}
+}
+
+void cf_manifest_unload(CF_Manifest manifest)
+{
+	CF_ManifestInternal* m = (CF_ManifestInternal*)manifest.id;
+	if (!m->is_loaded) return;
+	for (int i = 0; i < m->loaded.count(); ++i) {
+		s_release(m->loaded[i]);
+	}
+	m->loaded.clear();
+	m->is_loaded = false;
+}
+
+void cf_destroy_manifest(CF_Manifest manifest)
+{
+	CF_ManifestInternal* m = (CF_ManifestInternal*)manifest.id;
+	cf_manifest_unload(manifest);
+	for (int i = 0; i < s_manifests.count(); ++i) {
+		if (s_manifests[i] == m) {
+			s_manifests.unordered_remove(i);
+			break;
+		}
+	}
+	m->~CF_ManifestInternal();
+	CF_FREE(m);
+}
+
+float cf_manifest_progress(CF_Manifest manifest)
+{
+	CF_ManifestInternal* m = (CF_ManifestInternal*)manifest.id;
+	if (!m->is_loaded) return 0;
+	if (!m->loaded.count()) return 1.0f;
+	int done = 0;
+	for (int i = 0; i < m->loaded.count(); ++i) {
+		done += s_is_done(m->loaded[i]);
+	}
+	return (float)done / (float)m->loaded.count();
+}
+
+bool cf_manifest_is_loaded(CF_Manifest manifest)
+{
+	CF_ManifestInternal* m = (CF_ManifestInternal*)manifest.id;
+	if (!m->is_loaded) return false;
+	for (int i = 0; i < m->loaded.count(); ++i) {
+		if (!s_is_done(m->loaded[i])) return false;
+	}
+	return true;
+}
+
+CF_Result cf_manifest_result(CF_Manifest manifest)
+{
+	CF_ManifestInternal* m = (CF_ManifestInternal*)manifest.id;
+	if (cf_is_error(m->result)) return m->result;
+	for (int i = 0; i < m->loaded.count(); ++i) {
+		CF_Asset* asset = m->loaded[i];
+		if (cf_is_error(asset->result)) return asset->result;
+		if (asset->type == CF_ASSET_TYPE_AUDIO && s_is_done(asset) && !cf_audio_sample_count(asset->audio)) {
+			return cf_result_error("Unable to load audio listed in a manifest.");
+		}
+	}
+	return cf_result_success();
+}
+
+static CF_Asset* s_find(CF_ManifestInternal* m, CF_AssetType type, const char* path)
+{
+	if (!m->is_loaded) return NULL;
+	path = sintern(path);
+	for (int i = 0; i < m->loaded.count(); ++i) {
+		CF_Asset* asset = m->loaded[i];
+		if (asset->type == type && asset->path == path) return asset;
+	}
+	return NULL;
+}
+
+CF_Audio cf_manifest_get_audio(CF_Manifest manifest, const char* virtual_path)
+{
+	CF_Asset* asset = s_find((CF_ManifestInternal*)manifest.id, CF_ASSET_TYPE_AUDIO, virtual_path);
+	CF_Audio result = { 0 };
+	return asset ? asset->audio : result;
+}
+
+CF_JDoc cf_manifest_get_json(CF_Manifest manifest, const char* virtual_path)
+{
+	CF_Asset* asset = s_find((CF_ManifestInternal*)manifest.id, CF_ASSET_TYPE_JSON, virtual_path);
+	CF_JDoc result = { 0 };
+	return asset ? asset->json : result;
+}
+
+void cf_destroy_manifests()
+{
+	while (s_manifests.count()) {
+		CF_Manifest manifest;
+		manifest.id = (uint64_t)s_manifests.last();
+		cf_destroy_manifest(manifest);
+	}
+}
@@ -13,11 +13,35 @@
 
 #include <cute_math.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_MATH_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_MATH_NEON
+#endif
+
 CF_STATIC_ASSERT(CF_POLY_MAX_VERTS == C2_MAX_POLYGON_VERTS, "Must be equal.");
 
 CF_STATIC_ASSERT(sizeof(CF_V2) == sizeof(c2v), "Must be equal.");
 CF_STATIC_ASSERT(sizeof(CF_SinCos) == sizeof(c2r), "Must be equal.");
-CF_STATIC_ASSERT(sizeof(CF_Transform) == sizeof(c2x), "Must be equal.");
+// `CF_Transform` keeps its rotation first and as (s, c), while `c2x` keeps its position first and its rotation as (c, s).
+// Transforms are converted instead of cast, the temporary lives until the end of the call it's passed to.
+struct CF_C2x
+{
+	c2x x;
+	const c2x* ptr;
+	CF_C2x(const CF_Transform* t)
+	{
+		ptr = NULL;
+		if (t) {
+			x.p = c2V(t->p.x, t->p.y);
+			x.r.c = t->r.c;
+			x.r.s = t->r.s;
+			ptr = &x;
+		}
+	}
+};
 CF_STATIC_ASSERT(sizeof(CF_M2x2) == sizeof(c2m), "Must be equal.");
 CF_STATIC_ASSERT(sizeof(CF_Halfspace) == sizeof(c2h), "Must be equal.");
 CF_STATIC_ASSERT(sizeof(CF_Ray) == sizeof(c2Ray), "Must be equal.");
@@ -200,22 +224,22 @@ bool cf_capsule_to_capsule(CF_Capsule A, CF_Capsule B)
 
 bool cf_circle_to_poly(CF_Circle A, const CF_Poly* B, const CF_Transform* bx)
 {
-	return !!c2CircletoPoly(*(c2Circle*)&A, (c2Poly*)B, (c2x*)bx);
+	return !!c2CircletoPoly(*(c2Circle*)&A, (c2Poly*)B, CF_C2x(bx).ptr);
 }
 
 bool cf_aabb_to_poly(CF_Aabb A, const CF_Poly* B, const CF_Transform* bx)
 {
-	return !!c2AABBtoPoly(*(c2AABB*)&A, (c2Poly*)B, (c2x*)bx);
+	return !!c2AABBtoPoly(*(c2AABB*)&A, (c2Poly*)B, CF_C2x(bx).ptr);
 }
 
 bool cf_capsule_to_poly(CF_Capsule A, const CF_Poly* B, const CF_Transform* bx)
 {
-	return !!c2CapsuletoPoly(*(c2Capsule*)&A, (c2Poly*)B, (c2x*)bx);
+	return !!c2CapsuletoPoly(*(c2Capsule*)&A, (c2Poly*)B, CF_C2x(bx).ptr);
 }
 
 bool cf_poly_to_poly(const CF_Poly* A, const CF_Transform* ax, const CF_Poly* B, const CF_Transform* bx)
 {
-	return !!c2PolytoPoly((c2Poly*)A, (c2x*)ax, (c2Poly*)B, (c2x*)bx);
+	return !!c2PolytoPoly((c2Poly*)A, CF_C2x(ax).ptr, (c2Poly*)B, CF_C2x(bx).ptr);
 }
 
 CF_Raycast cf_ray_to_circle(CF_Ray A, CF_Circle B)
@@ -252,7 +276,7 @@ CF_Raycast cf_ray_to_poly(CF_Ray A, const CF_Poly* B, const CF_Transform* bx_ptr
 {
 	CF_Raycast result;
 	c2Raycast cast;
-	result.hit = !!c2RaytoPoly(*(c2Ray*)&A, (c2Poly*)B, (c2x*)bx_ptr, (c2Raycast*)&cast);
+	result.hit = !!c2RaytoPoly(*(c2Ray*)&A, (c2Poly*)B, CF_C2x(bx_ptr).ptr, (c2Raycast*)&cast);
 	result.n = *(v2*)&cast.n;
 	result.t = cast.t;
 	return result;
@@ -302,55 +326,298 @@ CF_Manifold cf_capsule_to_capsule_manifold(CF_Capsule A, CF_Capsule B)
 CF_Manifold cf_circle_to_poly_manifold(CF_Circle A, const CF_Poly* B, const CF_Transform* bx)
 {
 	c2Manifold m;
-	c2CircletoPolyManifold(*(c2Circle*)&A, (c2Poly*)B, (c2x*)bx, &m);
+	c2CircletoPolyManifold(*(c2Circle*)&A, (c2Poly*)B, CF_C2x(bx).ptr, &m);
 	return *(CF_Manifold*)&m;
 }
 
 CF_Manifold cf_aabb_to_poly_manifold(CF_Aabb A, const CF_Poly* B, const CF_Transform* bx)
 {
 	c2Manifold m;
-	c2AABBtoPolyManifold(*(c2AABB*)&A, (c2Poly*)B, (c2x*)bx, &m);
+	c2AABBtoPolyManifold(*(c2AABB*)&A, (c2Poly*)B, CF_C2x(bx).ptr, &m);
 	return *(CF_Manifold*)&m;
 }
 
 CF_Manifold cf_capsule_to_poly_manifold(CF_Capsule A, const CF_Poly* B, const CF_Transform* bx)
 {
 	c2Manifold m;
-	c2CapsuletoPolyManifold(*(c2Capsule*)&A, (c2Poly*)B, (c2x*)bx, &m);
+	c2CapsuletoPolyManifold(*(c2Capsule*)&A, (c2Poly*)B, CF_C2x(bx).ptr, &m);
 	return *(CF_Manifold*)&m;
 }
 
 CF_Manifold cf_poly_to_poly_manifold(const CF_Poly* A, const CF_Transform* ax, const CF_Poly* B, const CF_Transform* bx)
 {
 	c2Manifold m;
-	c2PolytoPolyManifold((c2Poly*)A, (c2x*)ax, (c2Poly*)B, (c2x*)bx, &m);
+	c2PolytoPolyManifold((c2Poly*)A, CF_C2x(ax).ptr, (c2Poly*)B, CF_C2x(bx).ptr, &m);
 	return *(CF_Manifold*)&m;
 }
 
+// Four floats processed at once, used to reject non-overlapping pairs in the batched manifold functions, and
+// by the batched transforms.
+#if defined(CF_MATH_SSE2)
+typedef __m128 f4;
+static CF_INLINE f4 s_f4(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+static CF_INLINE f4 s_splat(float a) { return _mm_set1_ps(a); }
+static CF_INLINE f4 s_add(f4 a, f4 b) { return _mm_add_ps(a, b); }
+static CF_INLINE f4 s_sub(f4 a, f4 b) { return _mm_sub_ps(a, b); }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+static CF_INLINE f4 s_div(f4 a, f4 b) { return _mm_div_ps(a, b); }
+static CF_INLINE f4 s_min(f4 a, f4 b) { return _mm_min_ps(a, b); }
+static CF_INLINE f4 s_max(f4 a, f4 b) { return _mm_max_ps(a, b); }
+static CF_INLINE f4 s_sqrt(f4 a) { return _mm_sqrt_ps(a); }
+static CF_INLINE f4 s_abs(f4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+static CF_INLINE int s_le_mask(f4 a, f4 b) { return _mm_movemask_ps(_mm_cmple_ps(a, b)); }
+static CF_INLINE f4 s_load(const float* v) { return _mm_loadu_ps(v); }
+static CF_INLINE void s_store(float* v, f4 a) { _mm_storeu_ps(v, a); }
+static CF_INLINE f4 s_dup_even(f4 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 0, 0)); }
+static CF_INLINE f4 s_dup_odd(f4 a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 1, 1)); }
+#elif defined(CF_MATH_NEON)
+typedef float32x4_t f4;
+static CF_INLINE f4 s_f4(float a, float b, float c, float d) { float v[4] = { a, b, c, d }; return vld1q_f32(v); }
+static CF_INLINE f4 s_splat(float a) { return vdupq_n_f32(a); }
+static CF_INLINE f4 s_add(f4 a, f4 b) { return vaddq_f32(a, b); }
+static CF_INLINE f4 s_sub(f4 a, f4 b) { return vsubq_f32(a, b); }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { return vmulq_f32(a, b); }
+static CF_INLINE f4 s_div(f4 a, f4 b) { return vdivq_f32(a, b); }
+static CF_INLINE f4 s_min(f4 a, f4 b) { return vminq_f32(a, b); }
+static CF_INLINE f4 s_max(f4 a, f4 b) { return vmaxq_f32(a, b); }
+static CF_INLINE f4 s_sqrt(f4 a) { return vsqrtq_f32(a); }
+static CF_INLINE f4 s_abs(f4 a) { return vabsq_f32(a); }
+static CF_INLINE int s_le_mask(f4 a, f4 b)
+{
+	static const uint32_t bits[4] = { 1, 2, 4, 8 };
+	return (int)vaddvq_u32(vandq_u32(vcleq_f32(a, b), vld1q_u32(bits)));
+}
+static CF_INLINE f4 s_load(const float* v) { return vld1q_f32(v); }
+static CF_INLINE void s_store(float* v, f4 a) { vst1q_f32(v, a); }
+static CF_INLINE f4 s_dup_even(f4 a) { return vtrn1q_f32(a, a); }
+static CF_INLINE f4 s_dup_odd(f4 a) { return vtrn2q_f32(a, a); }
+#else
+struct f4 { float v[4]; };
+static CF_INLINE f4 s_f4(float a, float b, float c, float d) { f4 r = { { a, b, c, d } }; return r; }
+static CF_INLINE f4 s_splat(float a) { return s_f4(a, a, a, a); }
+#define CF_F4_OP(name, expr) static CF_INLINE f4 name(f4 a, f4 b) { f4 r; for (int i = 0; i < 4; ++i) { float x = a.v[i], y = b.v[i]; (void)y; r.v[i] = (expr); } return r; }
+CF_F4_OP(s_add, x + y)
+CF_F4_OP(s_sub, x - y)
+CF_F4_OP(s_mul, x * y)
+CF_F4_OP(s_div, x / y)
+CF_F4_OP(s_min, x < y ? x : y)
+CF_F4_OP(s_max, x > y ? x : y)
+#undef CF_F4_OP
+static CF_INLINE f4 s_sqrt(f4 a) { f4 r; for (int i = 0; i < 4; ++i) r.v[i] = CF_SQRTF(a.v[i]); return r; }
+static CF_INLINE f4 s_abs(f4 a) { f4 r; for (int i = 0; i < 4; ++i) r.v[i] = CF_FABSF(a.v[i]); return r; }
+static CF_INLINE int s_le_mask(f4 a, f4 b) { int mask = 0; for (int i = 0; i < 4; ++i) mask |= (a.v[i] <= b.v[i]) << i; return mask; }
+static CF_INLINE f4 s_load(const float* v) { return s_f4(v[0], v[1], v[2], v[3]); }
+static CF_INLINE void s_store(float* v, f4 a) { for (int i = 0; i < 4; ++i) v[i] = a.v[i]; }
+static CF_INLINE f4 s_dup_even(f4 a) { return s_f4(a.v[0], a.v[0], a.v[2], a.v[2]); }
+static CF_INLINE f4 s_dup_odd(f4 a) { return s_f4(a.v[1], a.v[1], a.v[3], a.v[3]); }
+#endif
+
+#define CF_GATHER4(shapes, field) s_f4(shapes[0].field, shapes[1].field, shapes[2].field, shapes[3].field)
+
+// Squared distance from point p to the segment a-b.
+static CF_INLINE f4 s_segment_dist2(f4 px, f4 py, f4 ax, f4 ay, f4 bx, f4 by)
+{
+	f4 abx = s_sub(bx, ax), aby = s_sub(by, ay);
+	f4 apx = s_sub(px, ax), apy = s_sub(py, ay);
+	f4 len2 = s_max(s_add(s_mul(abx, abx), s_mul(aby, aby)), s_splat(FLT_MIN));
+	f4 t = s_div(s_add(s_mul(apx, abx), s_mul(apy, aby)), len2);
+	t = s_min(s_max(t, s_splat(0)), s_splat(1.0f));
+	f4 dx = s_sub(apx, s_mul(abx, t)), dy = s_sub(apy, s_mul(aby, t));
+	return s_add(s_mul(dx, dx), s_mul(dy, dy));
+}
+
+// Conservative `d2 < r * r`. These masks only reject pairs, cute_c2 still computes the manifold for every pair
+// that passes, so a little slack here keeps the results identical to the one-pair-at-a-time functions.
+static CF_INLINE int s_within_mask(f4 d2, f4 r)
+{
+	f4 rr = s_mul(r, r);
+	return s_le_mask(d2, s_add(s_mul(rr, s_splat(1.001f)), s_splat(1.0e-6f)));
+}
+
+static CF_INLINE int s_circle_to_circle_mask(const c2Circle* A, const c2Circle* B)
+{
+	f4 dx = s_sub(CF_GATHER4(B, p.x), CF_GATHER4(A, p.x));
+	f4 dy = s_sub(CF_GATHER4(B, p.y), CF_GATHER4(A, p.y));
+	f4 d2 = s_add(s_mul(dx, dx), s_mul(dy, dy));
+	return s_within_mask(d2, s_add(CF_GATHER4(A, r), CF_GATHER4(B, r)));
+}
+
+static CF_INLINE int s_circle_to_aabb_mask(const c2Circle* A, const c2AABB* B)
+{
+	f4 px = CF_GATHER4(A, p.x), py = CF_GATHER4(A, p.y);
+	f4 dx = s_sub(s_min(s_max(px, CF_GATHER4(B, min.x)), CF_GATHER4(B, max.x)), px);
+	f4 dy = s_sub(s_min(s_max(py, CF_GATHER4(B, min.y)), CF_GATHER4(B, max.y)), py);
+	f4 d2 = s_add(s_mul(dx, dx), s_mul(dy, dy));
+	return s_within_mask(d2, CF_GATHER4(A, r));
+}
+
+static CF_INLINE int s_circle_to_capsule_mask(const c2Circle* A, const c2Capsule* B)
+{
+	f4 d2 = s_segment_dist2(CF_GATHER4(A, p.x), CF_GATHER4(A, p.y), CF_GATHER4(B, a.x), CF_GATHER4(B, a.y), CF_GATHER4(B, b.x), CF_GATHER4(B, b.y));
+	return s_within_mask(d2, s_add(CF_GATHER4(A, r), CF_GATHER4(B, r)));
+}
+
+static CF_INLINE int s_aabb_to_aabb_mask(const c2AABB* A, const c2AABB* B)
+{
+	// Same overlap test as c2AABBtoAABBManifold, with slack for rounding.
+	f4 half = s_splat(0.5f);
+	f4 slack = s_splat(1.0e-5f);
+	f4 mid_ax = s_mul(s_add(CF_GATHER4(A, min.x), CF_GATHER4(A, max.x)), half);
+	f4 mid_ay = s_mul(s_add(CF_GATHER4(A, min.y), CF_GATHER4(A, max.y)), half);
+	f4 mid_bx = s_mul(s_add(CF_GATHER4(B, min.x), CF_GATHER4(B, max.x)), half);
+	f4 mid_by = s_mul(s_add(CF_GATHER4(B, min.y), CF_GATHER4(B, max.y)), half);
+	f4 ex = s_add(s_abs(s_mul(s_sub(CF_GATHER4(A, max.x), CF_GATHER4(A, min.x)), half)), s_abs(s_mul(s_sub(CF_GATHER4(B, max.x), CF_GATHER4(B, min.x)), half)));
+	f4 ey = s_add(s_abs(s_mul(s_sub(CF_GATHER4(A, max.y), CF_GATHER4(A, min.y)), half)), s_abs(s_mul(s_sub(CF_GATHER4(B, max.y), CF_GATHER4(B, min.y)), half)));
+	f4 dx = s_abs(s_sub(mid_bx, mid_ax));
+	f4 dy = s_abs(s_sub(mid_by, mid_ay));
+	f4 tx = s_add(ex, s_mul(s_add(s_add(s_abs(mid_ax), s_abs(mid_bx)), ex), slack));
+	f4 ty = s_add(ey, s_mul(s_add(s_add(s_abs(mid_ay), s_abs(mid_by)), ey), slack));
+	return s_le_mask(dx, tx) & s_le_mask(dy, ty);
+}
+
+static CF_INLINE int s_aabb_to_capsule_mask(const c2AABB* A, const c2Capsule* B)
+{
+	// Bounds the AABB with a circle, which is enough to reject most pairs.
+	f4 half = s_splat(0.5f);
+	f4 ex = s_mul(s_sub(CF_GATHER4(A, max.x), CF_GATHER4(A, min.x)), half);
+	f4 ey = s_mul(s_sub(CF_GATHER4(A, max.y), CF_GATHER4(A, min.y)), half);
+	f4 px = s_mul(s_add(CF_GATHER4(A, min.x), CF_GATHER4(A, max.x)), half);
+	f4 py = s_mul(s_add(CF_GATHER4(A, min.y), CF_GATHER4(A, max.y)), half);
+	f4 d2 = s_segment_dist2(px, py, CF_GATHER4(B, a.x), CF_GATHER4(B, a.y), CF_GATHER4(B, b.x), CF_GATHER4(B, b.y));
+	return s_within_mask(d2, s_add(s_sqrt(s_add(s_mul(ex, ex), s_mul(ey, ey))), CF_GATHER4(B, r)));
+}
+
+static CF_INLINE int s_capsule_to_capsule_mask(const c2Capsule* A, const c2Capsule* B)
+{
+	// Bounds capsule B with a circle, which is enough to reject most pairs.
+	f4 half = s_splat(0.5f);
+	f4 bax = CF_GATHER4(B, a.x), bay = CF_GATHER4(B, a.y);
+	f4 bbx = CF_GATHER4(B, b.x), bby = CF_GATHER4(B, b.y);
+	f4 ex = s_mul(s_sub(bbx, bax), half), ey = s_mul(s_sub(bby, bay), half);
+	f4 px = s_add(bax, ex), py = s_add(bay, ey);
+	f4 d2 = s_segment_dist2(px, py, CF_GATHER4(A, a.x), CF_GATHER4(A, a.y), CF_GATHER4(A, b.x), CF_GATHER4(A, b.y));
+	f4 r = s_add(s_add(s_sqrt(s_add(s_mul(ex, ex), s_mul(ey, ey))), CF_GATHER4(B, r)), CF_GATHER4(A, r));
+	return s_within_mask(d2, r);
+}
+
+template <typename TA, typename TB, int (*MASK)(const TA*, const TB*), void (*MANIFOLD)(TA, TB, c2Manifold*)>
+static void s_manifold_batch(const void* A_ptr, const void* B_ptr, int count, CF_Manifold* out_ptr)
+{
+	const TA* A = (const TA*)A_ptr;
+	const TB* B = (const TB*)B_ptr;
+	c2Manifold* out = (c2Manifold*)out_ptr;
+	int i = 0;
+	for (; i + 4 <= count; i += 4) {
+		int hits = MASK(A + i, B + i);
+		if (!hits) {
+			out[i].count = out[i + 1].count = out[i + 2].count = out[i + 3].count = 0;
+			continue;
+		}
+		for (int j = 0; j < 4; ++j) {
+			if (hits & (1 << j)) MANIFOLD(A[i + j], B[i + j], out + i + j);
+			else out[i + j].count = 0;
+		}
+	}
+	for (; i < count; ++i) {
+		MANIFOLD(A[i], B[i], out + i);
+	}
+}
+
+void cf_circle_to_circle_manifold_batch(const CF_Circle* A, const CF_Circle* B, int count, CF_Manifold* out)
+{
+	s_manifold_batch<c2Circle, c2Circle, s_circle_to_circle_mask, c2CircletoCircleManifold>(A, B, count, out);
+}
+
+void cf_circle_to_aabb_manifold_batch(const CF_Circle* A, const CF_Aabb* B, int count, CF_Manifold* out)
+{
+	s_manifold_batch<c2Circle, c2AABB, s_circle_to_aabb_mask, c2CircletoAABBManifold>(A, B, count, out);
+}
+
+void cf_circle_to_capsule_manifold_batch(const CF_Circle* A, const CF_Capsule* B, int count, CF_Manifold* out)
+{
+	s_manifold_batch<c2Circle, c2Capsule, s_circle_to_capsule_mask, c2CircletoCapsuleManifold>(A, B, count, out);
+}
+
+void cf_aabb_to_aabb_manifold_batch(const CF_Aabb* A, const CF_Aabb* B, int count, CF_Manifold* out)
+{
+	s_manifold_batch<c2AABB, c2AABB, s_aabb_to_aabb_mask, c2AABBtoAABBManifold>(A, B, count, out);
+}
+
+void cf_aabb_to_capsule_manifold_batch(const CF_Aabb* A, const CF_Capsule* B, int count, CF_Manifold* out)
+{
+	s_manifold_batch<c2AABB, c2Capsule, s_aabb_to_capsule_mask, c2AABBtoCapsuleManifold>(A, B, count, out);
+}
+
+void cf_capsule_to_capsule_manifold_batch(const CF_Capsule* A, const CF_Capsule* B, int count, CF_Manifold* out)
+{
+	s_manifold_batch<c2Capsule, c2Capsule, s_capsule_to_capsule_mask, c2CapsuletoCapsuleManifold>(A, B, count, out);
+}
+
 float cf_gjk(const void* A, CF_ShapeType typeA, const CF_Transform* ax_ptr, const void* B, CF_ShapeType typeB, const CF_Transform* bx_ptr, CF_V2* outA, CF_V2* outB, bool use_radius, int* iterations, CF_GjkCache* cache)
 {
-	return c2GJK(A, (C2_TYPE)typeA, (c2x*)ax_ptr, B, (C2_TYPE)typeB, (c2x*)bx_ptr, (c2v*)outA, (c2v*)outB, (int)use_radius, iterations, (c2GJKCache*)cache);
+	return c2GJK(A, (C2_TYPE)typeA, CF_C2x(ax_ptr).ptr, B, (C2_TYPE)typeB, CF_C2x(bx_ptr).ptr, (c2v*)outA, (c2v*)outB, (int)use_radius, iterations, (c2GJKCache*)cache);
 }
 
 CF_ToiResult cf_toi(const void* A, CF_ShapeType typeA, const CF_Transform* ax_ptr, CF_V2 vA, const void* B, CF_ShapeType typeB, const CF_Transform* bx_ptr, CF_V2 vB, int use_radius)
 {
 	CF_ToiResult result;
-	c2TOIResult c2result = c2TOI(A, (C2_TYPE)typeA, (c2x*)ax_ptr, *(c2v*)&vA, B, (C2_TYPE)typeB, (c2x*)bx_ptr, *(c2v*)&vB, use_radius);
+	c2TOIResult c2result = c2TOI(A, (C2_TYPE)typeA, CF_C2x(ax_ptr).ptr, *(c2v*)&vA, B, (C2_TYPE)typeB, CF_C2x(bx_ptr).ptr, *(c2v*)&vB, use_radius);
 	result = *(CF_ToiResult*)&c2result;
 	return result;
 }
 
 int cf_collided(const void* A, const CF_Transform* ax, CF_ShapeType typeA, const void* B, const CF_Transform* bx, CF_ShapeType typeB)
 {
-	return c2Collided(A, (c2x*)ax, (C2_TYPE)typeA, B, (c2x*)bx, (C2_TYPE)typeB);
+	return c2Collided(A, CF_C2x(ax).ptr, (C2_TYPE)typeA, B, CF_C2x(bx).ptr, (C2_TYPE)typeB);
 }
 
 void cf_collide(const void* A, const CF_Transform* ax, CF_ShapeType typeA, const void* B, const CF_Transform* bx, CF_ShapeType typeB, CF_Manifold* m)
 {
-	c2Collide(A, (c2x*)ax, (C2_TYPE)typeA, B, (c2x*)bx, (C2_TYPE)typeB, (c2Manifold*)m);
+	c2Collide(A, CF_C2x(ax).ptr, (C2_TYPE)typeA, B, CF_C2x(bx).ptr, (C2_TYPE)typeB, (c2Manifold*)m);
+}
+
+void cf_collide_batch(const void* const* A, const CF_Transform* ax, const CF_ShapeType* typeA, const void* const* B, const CF_Transform* bx, const CF_ShapeType* typeB, int count, CF_Manifold* out)
+{
+	for (int i = 0; i < count; ++i) {
+		c2Collide(A[i], CF_C2x(ax ? ax + i : NULL).ptr, (C2_TYPE)typeA[i], B[i], CF_C2x(bx ? bx + i : NULL).ptr, (C2_TYPE)typeB[i], (c2Manifold*)(out + i));
+	}
 }
 
 bool cf_cast_ray(CF_Ray A, const void* B, const CF_Transform* bx, CF_ShapeType typeB, CF_Raycast* out)
 {
-	return c2CastRay(*(c2Ray*)&A, B, (c2x*)bx, (C2_TYPE)typeB, (c2Raycast*)out);
+	return c2CastRay(*(c2Ray*)&A, B, CF_C2x(bx).ptr, (C2_TYPE)typeB, (c2Raycast*)out);
+}
+
+// Two vectors per register, laid out as x0 y0 x1 y1. Each lane is the matching row of the x column
+// scaled by x, plus the same row of the y column scaled by y -- the same operations in the same order
+// as `cf_mul_m2_v2`.
+static CF_INLINE f4 s_mul_m2_v2x2(f4 cx, f4 cy, f4 v)
+{
+	return s_add(s_mul(cx, s_dup_even(v)), s_mul(cy, s_dup_odd(v)));
+}
+
+void cf_mul_m32_v2_batch(CF_M3x2 m, const CF_V2* in, CF_V2* out, int count)
+{
+	f4 cx = s_f4(m.m.x.x, m.m.x.y, m.m.x.x, m.m.x.y);
+	f4 cy = s_f4(m.m.y.x, m.m.y.y, m.m.y.x, m.m.y.y);
+	f4 p = s_f4(m.p.x, m.p.y, m.p.x, m.p.y);
+	int i = 0;
+	for (; i + 2 <= count; i += 2) {
+		s_store(&out[i].x, s_add(s_mul_m2_v2x2(cx, cy, s_load(&in[i].x)), p));
+	}
+	for (; i < count; ++i) {
+		out[i] = cf_mul_m32_v2(m, in[i]);
+	}
+}
+
+void cf_mul_m32_batch(CF_M3x2 m, const CF_M3x2* in, CF_M3x2* out, int count)
+{
+	// The two columns of each 2x2 matrix fill one register, the position is done on its own.
+	f4 cx = s_f4(m.m.x.x, m.m.x.y, m.m.x.x, m.m.x.y);
+	f4 cy = s_f4(m.m.y.x, m.m.y.y, m.m.y.x, m.m.y.y);
+	for (int i = 0; i < count; ++i) {
+		CF_V2 p = cf_add_v2(cf_mul_m2_v2(m.m, in[i].p), m.p);
+		s_store(&out[i].m.x.x, s_mul_m2_v2x2(cx, cy, s_load(&in[i].m.x.x)));
+		out[i].p = p;
+	}
 }
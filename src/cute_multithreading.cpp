@@ -7,118 +7,419 @@
 
 #include <cute_multithreading.h>
 #include <cute_alloc.h>
+#include <cute_c_runtime.h>
+#include <cute_coroutine.h>
+#include <cute_math.h>
+
+#include <internal/cute_alloc_internal.h>
 
 #include <SDL.h>
 
+#include <atomic>
+#include <limits.h>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#	include <intrin.h>
+#endif
+
+#if defined(CF_WINDOWS)
+#	include <windows.h>
+#elif defined(CF_LINUX) || defined(CF_ANDROID)
+#	include <linux/futex.h>
+#	include <sched.h>
+#	include <stdio.h>
+#	include <stdlib.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#elif defined(CF_APPLE)
+#	include <sys/sysctl.h>
+#	include <pthread.h>
+#elif defined(__EMSCRIPTEN_PTHREADS__)
+#	include <emscripten/threading.h>
+#endif
+
 #define CUTE_SYNC_IMPLEMENTATION
 #define CUTE_SYNC_SDL
 #define CUTE_THREAD_ALLOC CF_ALLOC
 #define CUTE_THREAD_FREE CF_FREE
 #include <cute/cute_sync.h>
 
+//--------------------------------------------------------------------------------------------------
+// Mutexes, condition variables and semaphores.
+
+// These are built on a single 32-bit word each. Waiting threads spin on the word for a short while,
+// then park on it with the OS's wait-on-address primitive: a futex on Linux and Android, and
+// WaitOnAddress on Windows 8 and later. Web builds with threads park on Atomics.wait through
+// Emscripten's futex, which busy-waits on the browser's main thread since it may not block. Elsewhere, threads park in a small table of SDL condition
+// variables keyed by address instead.
+
+#define CF_MUTEX_MAX_SPIN 100
+#define CF_SEM_SPIN 40
+#define CF_PARKING_BUCKETS 64
+
+struct CF_MutexState
+{
+	std::atomic<uint32_t> word; // 0 is unlocked, 1 is locked, 2 is locked with threads parked.
+	std::atomic<CF_ThreadId> owner; // Zero while unlocked. Only ever equals a thread's own id if that thread holds the lock.
+	int depth; // How many times the owner has locked it, only touched by the owner.
+	std::atomic<int> spin; // Average spins it took to get the lock, only written by the owner.
+	// Only written by the owner, so these don't need atomic increments.
+	std::atomic<uint64_t> lock_count;
+	std::atomic<uint64_t> contended_count;
+	std::atomic<uint64_t> park_count;
+};
+
+struct CF_CvState
+{
+	std::atomic<uint32_t> seq; // Bumped on every wake.
+};
+
+struct CF_SemState
+{
+	std::atomic<uint32_t> value;
+	std::atomic<uint32_t> waiters;
+};
+
+static_assert(sizeof(CF_MutexState) <= sizeof(CF_Mutex), "CF_MutexState must fit within CF_Mutex.");
+static_assert(sizeof(CF_CvState) <= sizeof(CF_ConditionVariable), "CF_CvState must fit within CF_ConditionVariable.");
+static_assert(sizeof(CF_SemState) <= sizeof(CF_Semaphore), "CF_SemState must fit within CF_Semaphore.");
+
+static CF_INLINE void s_cpu_relax()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_pause();
+#elif defined(__i386__) || defined(__x86_64__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+	__asm__ __volatile__("yield");
+#endif
+}
+
+#if !defined(CF_LINUX) && !defined(CF_ANDROID) && !defined(__EMSCRIPTEN_PTHREADS__)
+struct CF_ParkingBucket
+{
+	SDL_mutex* mutex;
+	SDL_cond* cond;
+};
+
+static CF_ParkingBucket* s_parking_bucket(void* address)
+{
+	static CF_ParkingBucket* buckets = [] {
+		static CF_ParkingBucket b[CF_PARKING_BUCKETS];
+		for (int i = 0; i < CF_PARKING_BUCKETS; ++i) {
+			b[i].mutex = SDL_CreateMutex();
+			b[i].cond = SDL_CreateCond();
+		}
+		return b;
+	}();
+	uintptr_t h = (uintptr_t)address;
+	h ^= h >> 7;
+	return buckets + (h & (CF_PARKING_BUCKETS - 1));
+}
+#endif
+
+#ifdef CF_WINDOWS
+typedef BOOL (WINAPI* CF_WaitOnAddressFn)(volatile VOID* address, PVOID compare, SIZE_T size, DWORD ms);
+typedef VOID (WINAPI* CF_WakeByAddressFn)(PVOID address);
+
+struct CF_WaitOnAddress
+{
+	CF_WaitOnAddressFn wait;
+	CF_WakeByAddressFn wake_one;
+	CF_WakeByAddressFn wake_all;
+};
+
+// Loaded at runtime, since Windows 7 doesn't have these.
+static const CF_WaitOnAddress* s_wait_on_address()
+{
+	static CF_WaitOnAddress fns = [] {
+		CF_WaitOnAddress result = { };
+		HMODULE module = LoadLibraryA("api-ms-win-core-synch-l1-2-0.dll");
+		if (module) {
+			result.wait = (CF_WaitOnAddressFn)(void*)GetProcAddress(module, "WaitOnAddress");
+			result.wake_one = (CF_WakeByAddressFn)(void*)GetProcAddress(module, "WakeByAddressSingle");
+			result.wake_all = (CF_WakeByAddressFn)(void*)GetProcAddress(module, "WakeByAddressAll");
+			if (!result.wait || !result.wake_one || !result.wake_all) result.wait = NULL;
+		}
+		return result;
+	}();
+	return &fns;
+}
+#endif
+
+// Sleeps until woken by `s_wake`, unless `word` no longer holds `value`. May return spuriously.
+static void s_park(std::atomic<uint32_t>* word, uint32_t value)
+{
+#if defined(CF_LINUX) || defined(CF_ANDROID)
+	syscall(SYS_futex, (uint32_t*)word, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+#elif defined(__EMSCRIPTEN_PTHREADS__)
+	emscripten_futex_wait((volatile void*)word, value, INFINITY);
+#else
+#	ifdef CF_WINDOWS
+	const CF_WaitOnAddress* fns = s_wait_on_address();
+	if (fns->wait) {
+		fns->wait((volatile VOID*)word, &value, sizeof(value), INFINITE);
+		return;
+	}
+#	endif
+	CF_ParkingBucket* bucket = s_parking_bucket(word);
+	SDL_LockMutex(bucket->mutex);
+	if (word->load() == value) SDL_CondWait(bucket->cond, bucket->mutex);
+	SDL_UnlockMutex(bucket->mutex);
+#endif
+}
+
+// Wakes one or all threads parked on `word`.
+static void s_wake(std::atomic<uint32_t>* word, bool all)
+{
+#if defined(CF_LINUX) || defined(CF_ANDROID)
+	syscall(SYS_futex, (uint32_t*)word, FUTEX_WAKE_PRIVATE, all ? INT_MAX : 1, NULL, NULL, 0);
+#elif defined(__EMSCRIPTEN_PTHREADS__)
+	emscripten_futex_wake((volatile void*)word, all ? INT_MAX : 1);
+#else
+#	ifdef CF_WINDOWS
+	const CF_WaitOnAddress* fns = s_wait_on_address();
+	if (fns->wait) {
+		if (all) fns->wake_all((PVOID)word);
+		else fns->wake_one((PVOID)word);
+		return;
+	}
+#	endif
+	// Buckets are shared by many addresses, so wake everyone and let them recheck.
+	CF_ParkingBucket* bucket = s_parking_bucket(word);
+	SDL_LockMutex(bucket->mutex);
+	SDL_CondBroadcast(bucket->cond);
+	SDL_UnlockMutex(bucket->mutex);
+#endif
+}
+
+static CF_INLINE CF_MutexState* s_mutex(CF_Mutex* mutex)
+{
+	return (CF_MutexState*)mutex->data;
+}
+
+static CF_INLINE void s_bump(std::atomic<uint64_t>* counter)
+{
+	counter->store(counter->load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
 CF_Mutex cf_make_mutex()
 {
-	return cute_mutex_create();
+	CF_Mutex mutex;
+	CF_MEMSET(&mutex, 0, sizeof(mutex));
+	return mutex;
 }
 
 void cf_destroy_mutex(CF_Mutex* mutex)
 {
-	cute_mutex_destroy(mutex);
+	CF_ASSERT(s_mutex(mutex)->word.load() == 0);
+}
+
+// Mutexes are recursive, like the SDL mutexes they replaced, so a thread re-locking a mutex it already
+// holds just bumps the depth.
+static CF_INLINE bool s_mutex_relock(CF_MutexState* m, CF_ThreadId self)
+{
+	if (m->owner.load(std::memory_order_relaxed) != self) return false;
+	++m->depth;
+	s_bump(&m->lock_count);
+	return true;
+}
+
+static CF_INLINE void s_mutex_own(CF_MutexState* m, CF_ThreadId self)
+{
+	m->owner.store(self, std::memory_order_relaxed);
+	m->depth = 1;
+	s_bump(&m->lock_count);
 }
 
 CF_Result cf_mutex_lock(CF_Mutex* mutex)
 {
-	CF_Result result;
-	result.code = cute_lock(mutex);
-	result.details = NULL;
-	return result;
+	CF_MutexState* m = s_mutex(mutex);
+	CF_ThreadId self = cf_thread_id();
+	if (s_mutex_relock(m, self)) return cf_result_success();
+	uint32_t expected = 0;
+	if (!m->word.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+		// Spin a little longer than it usually takes for the lock to free up, then park.
+		int spin = m->spin.load(std::memory_order_relaxed);
+		int limit = cf_min(spin * 2 + 10, CF_MUTEX_MAX_SPIN);
+		int n = 0;
+		bool locked = false;
+		for (; n < limit; ++n) {
+			s_cpu_relax();
+			expected = 0;
+			if (m->word.load(std::memory_order_relaxed) == 0 && m->word.compare_exchange_weak(expected, 1, std::memory_order_acquire)) {
+				locked = true;
+				break;
+			}
+		}
+		bool parked = false;
+		if (!locked) {
+			// Mark the lock as having waiters, so whoever unlocks it knows to wake one.
+			while (m->word.exchange(2, std::memory_order_acquire) != 0) {
+				parked = true;
+				s_park(&m->word, 2);
+			}
+		}
+		m->spin.store(spin + (n - spin) / 8, std::memory_order_relaxed);
+		s_bump(&m->contended_count);
+		if (parked) s_bump(&m->park_count);
+	}
+	s_mutex_own(m, self);
+	return cf_result_success();
 }
 
 CF_Result cf_mutex_unlock(CF_Mutex* mutex)
 {
-	CF_Result result;
-	result.code = cute_unlock(mutex);
-	result.details = NULL;
-	return result;
+	CF_MutexState* m = s_mutex(mutex);
+	CF_ASSERT(m->owner.load(std::memory_order_relaxed) == cf_thread_id());
+	if (--m->depth) return cf_result_success();
+	m->owner.store(0, std::memory_order_relaxed);
+	if (m->word.exchange(0, std::memory_order_release) == 2) {
+		s_wake(&m->word, false);
+	}
+	return cf_result_success();
 }
 
 bool cf_mutex_try_lock(CF_Mutex* mutex)
 {
-	return !!cute_trylock(mutex);
+	CF_MutexState* m = s_mutex(mutex);
+	CF_ThreadId self = cf_thread_id();
+	if (s_mutex_relock(m, self)) return true;
+	uint32_t expected = 0;
+	if (!m->word.compare_exchange_strong(expected, 1, std::memory_order_acquire)) return false;
+	s_mutex_own(m, self);
+	return true;
+}
+
+CF_MutexStats cf_mutex_stats(CF_Mutex* mutex)
+{
+	CF_MutexState* m = s_mutex(mutex);
+	CF_MutexStats stats;
+	stats.lock_count = m->lock_count.load(std::memory_order_relaxed);
+	stats.contended_count = m->contended_count.load(std::memory_order_relaxed);
+	stats.park_count = m->park_count.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void cf_mutex_reset_stats(CF_Mutex* mutex)
+{
+	CF_MutexState* m = s_mutex(mutex);
+	m->lock_count.store(0, std::memory_order_relaxed);
+	m->contended_count.store(0, std::memory_order_relaxed);
+	m->park_count.store(0, std::memory_order_relaxed);
+}
+
+static CF_INLINE CF_CvState* s_cv(CF_ConditionVariable* cv)
+{
+	return (CF_CvState*)cv->data;
 }
 
 CF_ConditionVariable cf_make_cv()
 {
-	return cute_cv_create();
+	CF_ConditionVariable cv;
+	CF_MEMSET(&cv, 0, sizeof(cv));
+	return cv;
 }
 
 void cf_destroy_cv(CF_ConditionVariable* cv)
 {
-	cute_cv_destroy(cv);
+	CF_UNUSED(cv);
 }
 
 CF_Result cf_cv_wake_all(CF_ConditionVariable* cv)
 {
-	CF_Result result;
-	result.code = cute_cv_wake_all(cv);
-	result.details = NULL;
-	return result;
+	CF_CvState* c = s_cv(cv);
+	c->seq.fetch_add(1, std::memory_order_release);
+	s_wake(&c->seq, true);
+	return cf_result_success();
 }
 
 CF_Result cf_cv_wake_one(CF_ConditionVariable* cv)
 {
-	CF_Result result;
-	result.code = cute_cv_wake_one(cv);
-	result.details = NULL;
-	return result;
+	CF_CvState* c = s_cv(cv);
+	c->seq.fetch_add(1, std::memory_order_release);
+	s_wake(&c->seq, false);
+	return cf_result_success();
 }
 
 CF_Result cf_cv_wait(CF_ConditionVariable* cv, CF_Mutex* mutex)
 {
-	CF_Result result;
-	result.code = cute_cv_wait(cv, mutex);
-	result.details = NULL;
-	return result;
+	// A wake between unlocking and parking bumps `seq`, so the park returns right away instead of
+	// missing it. The mutex is released fully even if it was locked recursively, and the depth is
+	// restored once it's locked again.
+	CF_CvState* c = s_cv(cv);
+	CF_MutexState* m = s_mutex(mutex);
+	uint32_t seq = c->seq.load(std::memory_order_acquire);
+	int depth = m->depth;
+	m->depth = 1;
+	cf_mutex_unlock(mutex);
+	s_park(&c->seq, seq);
+	cf_mutex_lock(mutex);
+	m->depth = depth;
+	return cf_result_success();
+}
+
+static CF_INLINE CF_SemState* s_sem(CF_Semaphore* semaphore)
+{
+	return (CF_SemState*)semaphore;
+}
+
+static bool s_sem_try(CF_SemState* s)
+{
+	uint32_t value = s->value.load(std::memory_order_relaxed);
+	while (value) {
+		if (s->value.compare_exchange_weak(value, value - 1, std::memory_order_acquire)) return true;
+	}
+	return false;
 }
 
 CF_Semaphore cf_make_sem(int initial_count)
 {
-	return cute_semaphore_create(initial_count);
+	CF_Semaphore semaphore;
+	CF_MEMSET(&semaphore, 0, sizeof(semaphore));
+	s_sem(&semaphore)->value.store((uint32_t)initial_count);
+	return semaphore;
 }
 
 void cf_destroy_sem(CF_Semaphore* semaphore)
 {
-	cute_semaphore_destroy(semaphore);
+	CF_UNUSED(semaphore);
 }
 
 CF_Result cf_sem_post(CF_Semaphore* semaphore)
 {
-	CF_Result result;
-	result.code = cute_semaphore_post(semaphore);
-	result.details = NULL;
-	return result;
+	CF_SemState* s = s_sem(semaphore);
+	s->value.fetch_add(1);
+	if (s->waiters.load()) s_wake(&s->value, false);
+	return cf_result_success();
 }
 
 CF_Result cf_sem_try(CF_Semaphore* semaphore)
 {
-	CF_Result result;
-	result.code = cute_semaphore_try(semaphore);
-	result.details = NULL;
-	return result;
+	if (s_sem_try(s_sem(semaphore))) return cf_result_success();
+	return cf_result_error("Semaphore is zero.");
 }
 
 CF_Result cf_sem_wait(CF_Semaphore* semaphore)
 {
-	CF_Result result;
-	result.code = cute_semaphore_wait(semaphore);
-	result.details = NULL;
-	return result;
+	CF_SemState* s = s_sem(semaphore);
+	for (int i = 0; i < CF_SEM_SPIN; ++i) {
+		if (s_sem_try(s)) return cf_result_success();
+		s_cpu_relax();
+	}
+	while (!s_sem_try(s)) {
+		// Posters check for waiters after bumping the value, and waiters check the value after
+		// registering, so one of the two always sees the other.
+		s->waiters.fetch_add(1);
+		if (!s->value.load()) s_park(&s->value, 0);
+		s->waiters.fetch_sub(1);
+	}
+	return cf_result_success();
 }
 
 CF_Result cf_sem_value(CF_Semaphore* semaphore)
 {
 	CF_Result result;
-	result.code = cute_semaphore_value(semaphore);
+	result.code = (int)s_sem(semaphore)->value.load();
 	result.details = NULL;
 	return result;
 }
@@ -153,7 +454,14 @@ CF_Result cf_thread_wait(CF_Thread* thread)
 
 int cf_core_count()
 {
+#if defined(__EMSCRIPTEN_PTHREADS__)
+	return emscripten_num_logical_cores();
+#elif defined(CF_EMSCRIPTEN)
+	// Built without threads, so no other core can be used.
+	return 1;
+#else
 	return cute_core_count();
+#endif
 }
 
 int cf_cacheline_size()
@@ -161,6 +469,269 @@ int cf_cacheline_size()
 	return cute_cacheline_size();
 }
 
+//--------------------------------------------------------------------------------------------------
+// CPU topology.
+
+#define CF_MAX_LOGICAL_CORES 512
+
+// Logical cores are numbered the way the OS pins threads to them. On Windows that's the processor
+// group times 64 plus the index within the group.
+struct CF_Topology
+{
+	CF_CpuTopology info;
+	int performance_cores[CF_MAX_LOGICAL_CORES];
+	int efficiency_cores[CF_MAX_LOGICAL_CORES];
+};
+
+static void s_count_unique(int* keys, int* count, int key)
+{
+	for (int i = 0; i < *count; ++i) {
+		if (keys[i] == key) return;
+	}
+	keys[(*count)++] = key;
+}
+
+#if defined(CF_LINUX) || defined(CF_ANDROID)
+
+static bool s_read_sys_file(const char* path, char* buf, int size)
+{
+	FILE* fp = fopen(path, "r");
+	if (!fp) return false;
+	size_t n = fread(buf, 1, size - 1, fp);
+	fclose(fp);
+	buf[n] = 0;
+	return n > 0;
+}
+
+static int s_read_sys_int(const char* path, int fallback)
+{
+	char buf[32];
+	if (!s_read_sys_file(path, buf, sizeof(buf))) return fallback;
+	return atoi(buf);
+}
+
+// Parses a list of cpus such as "0-3,8,10-11" into `cpus`.
+static void s_parse_cpu_list(const char* list, bool* cpus)
+{
+	while (*list) {
+		char* end;
+		long lo = strtol(list, &end, 10);
+		if (end == list) break;
+		long hi = lo;
+		list = end;
+		if (*list == '-') {
+			hi = strtol(list + 1, &end, 10);
+			list = end;
+		}
+		for (long i = lo; i <= hi && i < CF_MAX_LOGICAL_CORES; ++i) {
+			if (i >= 0) cpus[i] = true;
+		}
+		if (*list != ',') break;
+		++list;
+	}
+}
+
+static void s_query_topology(CF_Topology* t)
+{
+	char path[128];
+	char buf[256];
+	int cpu_count = cf_min((int)sysconf(_SC_NPROCESSORS_CONF), CF_MAX_LOGICAL_CORES);
+	int cpus[CF_MAX_LOGICAL_CORES];
+	int keys[CF_MAX_LOGICAL_CORES]; // Physical core of each cpu.
+	int count = 0;
+	int cores[CF_MAX_LOGICAL_CORES];
+	int core_count = 0;
+	int clusters[CF_MAX_LOGICAL_CORES];
+	int cluster_count = 0;
+	int capacity[CF_MAX_LOGICAL_CORES];
+	int max_capacity = 0;
+	for (int i = 0; i < cpu_count; ++i) {
+		CF_SNPRINTF(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_id", i);
+		int core = s_read_sys_int(path, -1);
+		if (core < 0) continue;
+		CF_SNPRINTF(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", i);
+		int package = s_read_sys_int(path, 0);
+		cpus[count] = i;
+		keys[count] = (package << 20) | core;
+
+		// Cores of the last-level cache are told apart by the first cpu sharing it.
+		int cluster = package << 20;
+		int level = 0;
+		for (int j = 0; j < 8; ++j) {
+			CF_SNPRINTF(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/level", i, j);
+			int l = s_read_sys_int(path, -1);
+			if (l < 0) break;
+			if (l < level) continue;
+			CF_SNPRINTF(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cache/index%d/shared_cpu_list", i, j);
+			if (s_read_sys_file(path, buf, sizeof(buf))) {
+				level = l;
+				cluster = atoi(buf);
+			}
+		}
+
+		// ARM cores report their relative speed, the fastest ones are 1024.
+		CF_SNPRINTF(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpu_capacity", i);
+		capacity[count] = s_read_sys_int(path, 1024);
+		max_capacity = cf_max(max_capacity, capacity[count]);
+
+		s_count_unique(cores, &core_count, keys[count]);
+		s_count_unique(clusters, &cluster_count, cluster);
+		++count;
+	}
+	if (!count) return;
+
+	// Intel hybrid CPUs list their E-cores under a separate PMU.
+	bool atom[CF_MAX_LOGICAL_CORES] = { };
+	bool hybrid = s_read_sys_file("/sys/devices/cpu_atom/cpus", buf, sizeof(buf));
+	if (hybrid) s_parse_cpu_list(buf, atom);
+
+	int performance_cores[CF_MAX_LOGICAL_CORES];
+	int performance_core_count = 0;
+	int efficiency_cores[CF_MAX_LOGICAL_CORES];
+	int efficiency_core_count = 0;
+	for (int i = 0; i < count; ++i) {
+		bool efficiency = hybrid ? atom[cpus[i]] : capacity[i] < max_capacity;
+		if (efficiency) {
+			t->efficiency_cores[t->info.efficiency_thread_count++] = cpus[i];
+			s_count_unique(efficiency_cores, &efficiency_core_count, keys[i]);
+		} else {
+			t->performance_cores[t->info.performance_thread_count++] = cpus[i];
+			s_count_unique(performance_cores, &performance_core_count, keys[i]);
+		}
+	}
+	t->info.logical_core_count = count;
+	t->info.physical_core_count = core_count;
+	t->info.performance_core_count = performance_core_count;
+	t->info.efficiency_core_count = efficiency_core_count;
+	t->info.cache_cluster_count = cluster_count;
+}
+
+#elif defined(CF_WINDOWS)
+
+static void s_query_topology(CF_Topology* t)
+{
+	DWORD size = 0;
+	GetLogicalProcessorInformationEx(RelationAll, NULL, &size);
+	if (!size) return;
+	uint8_t* buf = (uint8_t*)CF_ALLOC(size);
+	if (!GetLogicalProcessorInformationEx(RelationAll, (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)buf, &size)) {
+		CF_FREE(buf);
+		return;
+	}
+
+	// Cores with the highest efficiency class are the fastest ones.
+	int max_class = 0;
+	int cache_level = 0;
+	for (DWORD offset = 0; offset < size;) {
+		SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* info = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buf + offset);
+		offset += info->Size;
+		if (info->Relationship == RelationProcessorCore) {
+			max_class = cf_max(max_class, (int)info->Processor.EfficiencyClass);
+		} else if (info->Relationship == RelationCache) {
+			if (info->Cache.Level > cache_level) {
+				cache_level = info->Cache.Level;
+				t->info.cache_cluster_count = 0;
+			}
+			if (info->Cache.Level == cache_level) t->info.cache_cluster_count++;
+		}
+	}
+
+	for (DWORD offset = 0; offset < size;) {
+		SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* info = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buf + offset);
+		offset += info->Size;
+		if (info->Relationship != RelationProcessorCore) continue;
+		bool efficiency = info->Processor.EfficiencyClass < max_class;
+		t->info.physical_core_count++;
+		if (efficiency) {
+			t->info.efficiency_core_count++;
+		} else {
+			t->info.performance_core_count++;
+		}
+		for (int g = 0; g < info->Processor.GroupCount; ++g) {
+			KAFFINITY mask = info->Processor.GroupMask[g].Mask;
+			for (int bit = 0; bit < 64; ++bit) {
+				if (!(mask & ((KAFFINITY)1 << bit))) continue;
+				int cpu = info->Processor.GroupMask[g].Group * 64 + bit;
+				if (t->info.logical_core_count == CF_MAX_LOGICAL_CORES) continue;
+				t->info.logical_core_count++;
+				if (efficiency) {
+					t->efficiency_cores[t->info.efficiency_thread_count++] = cpu;
+				} else {
+					t->performance_cores[t->info.performance_thread_count++] = cpu;
+				}
+			}
+		}
+	}
+	CF_FREE(buf);
+}
+
+#elif defined(CF_APPLE)
+
+static int s_sysctl_int(const char* name, int fallback)
+{
+	int value = 0;
+	size_t size = sizeof(value);
+	if (sysctlbyname(name, &value, &size, NULL, 0) != 0) return fallback;
+	return value;
+}
+
+// Threads can't be pinned on Apple platforms, so only the counts are filled in.
+static void s_query_topology(CF_Topology* t)
+{
+	t->info.logical_core_count = s_sysctl_int("hw.logicalcpu", 0);
+	t->info.physical_core_count = s_sysctl_int("hw.physicalcpu", 0);
+	int levels = s_sysctl_int("hw.nperflevels", 1);
+	char name[64];
+	for (int i = 0; i < levels && i < 2; ++i) {
+		CF_SNPRINTF(name, sizeof(name), "hw.perflevel%d.physicalcpu", i);
+		int physical = s_sysctl_int(name, i ? 0 : t->info.physical_core_count);
+		CF_SNPRINTF(name, sizeof(name), "hw.perflevel%d.logicalcpu", i);
+		int logical = s_sysctl_int(name, i ? 0 : t->info.logical_core_count);
+		CF_SNPRINTF(name, sizeof(name), "hw.perflevel%d.cpusperl2", i);
+		int per_cluster = s_sysctl_int(name, logical);
+		if (i == 0) {
+			t->info.performance_core_count = physical;
+			t->info.performance_thread_count = logical;
+		} else {
+			t->info.efficiency_core_count = physical;
+			t->info.efficiency_thread_count = logical;
+		}
+		if (per_cluster > 0) t->info.cache_cluster_count += (logical + per_cluster - 1) / per_cluster;
+	}
+}
+
+#else
+
+static void s_query_topology(CF_Topology* t)
+{
+	CF_UNUSED(t);
+}
+
+#endif
+
+static const CF_Topology* s_topology()
+{
+	static const CF_Topology* topology = [] {
+		static CF_Topology t = { };
+		s_query_topology(&t);
+		// Fill in whatever the OS didn't report.
+		CF_CpuTopology* info = &t.info;
+		int logical = cute_core_count();
+		if (!info->logical_core_count) info->logical_core_count = logical;
+		if (!info->physical_core_count) info->physical_core_count = info->logical_core_count;
+		if (!info->performance_core_count) info->performance_core_count = info->physical_core_count - info->efficiency_core_count;
+		if (!info->performance_thread_count) info->performance_thread_count = info->logical_core_count - info->efficiency_thread_count;
+		if (!info->cache_cluster_count) info->cache_cluster_count = 1;
+		return &t;
+	}();
+	return topology;
+}
+
+CF_CpuTopology cf_cpu_topology()
+{
+	return s_topology()->info;
+}
+
 CF_AtomicInt cf_atomic_zero()
 {
 	CF_AtomicInt result;
@@ -185,10 +756,9 @@ int cf_atomic_get(CF_AtomicInt* atomic)
 
 CF_Result cf_atomic_cas(CF_AtomicInt* atomic, int expected, int value)
 {
-	CF_Result result;
-	result.code = cute_atomic_cas(atomic, expected, value);
-	result.details = NULL;
-	return result;
+	// The backend returns true when the value was swapped, not a result code.
+	if (cute_atomic_cas(atomic, expected, value)) return cf_result_success();
+	return cf_result_error("Atomic value did not match `expected`.");
 }
 
 void* cf_atomic_ptr_set(void** atomic, void* value)
@@ -203,10 +773,8 @@ void* cf_atomic_ptr_get(void** atomic)
 
 CF_Result cf_atomic_ptr_cas(void** atomic, void* expected, void* value)
 {
-	CF_Result result;
-	result.code = cute_atomic_ptr_cas(atomic, expected, value);
-	result.details = NULL;
-	return result;
+	if (cute_atomic_ptr_cas(atomic, expected, value)) return cf_result_success();
+	return cf_result_error("Atomic pointer did not match `expected`.");
 }
 
 CF_ReadWriteLock cf_make_rw_lock()
@@ -239,27 +807,952 @@ void cf_write_unlock(CF_ReadWriteLock* rw)
 	cute_write_unlock(rw);
 }
 
+//--------------------------------------------------------------------------------------------------
+// Threadpool.
+
+// Each worker owns a Chase-Lev deque of jobs: the owner pushes and pops at the bottom without taking
+// any locks, while idle threads steal from the top of other deques with a single CAS. Two extra
+// deques are owned by the thread that made the pool, and shared by all other threads under a mutex.
+//
+// A job with dependencies is held back until the last of them finishes, at which point whichever
+// thread finished it pushes the job onto its own deque.
+//
+// Fiber jobs run on a pooled coroutine. When one waits on a job or counter that isn't done yet, the
+// coroutine yields back to the worker instead of helping out, and the job is parked until whatever it
+// waits on finishes. A parked fiber may be picked back up by any thread in the pool.
+
+#define CF_JOB_QUEUE_CAPACITY 1024 // Must be a power of two.
+#define CF_JOB_INLINE_LINKS 4
+#define CF_JOB_CLOSED ((void*)1)
+#define CF_FIBER_STACK_SIZE (256 * 1024)
+
+struct CF_JobRecord;
+struct CF_Threadpool;
+
+struct CF_Fiber
+{
+	CF_Coroutine co;
+	CF_Threadpool* pool;
+	CF_JobRecord* record;
+	CF_TaskFn* task;
+	void* param;
+	// Set when the fiber yields to wait, cleared once its task returns.
+	bool parked;
+	// What the fiber waits on while parked, either a counter or a list of jobs.
+	cute_atomic_int_t* wait_counter;
+	const CF_Job* wait_jobs;
+	int wait_job_count;
+	// Next fiber in the pool's free list, or in its parked list.
+	CF_Fiber* next;
+};
+
+// Entry in a job's list of dependents, one per dependency of the dependent job.
+struct CF_JobLink
+{
+	CF_JobLink* next;
+	CF_JobRecord* dependent;
+};
+
+struct CF_JobRecord
+{
+	CF_TaskFn* task;
+	void* param;
+	cute_atomic_int_t* counter;
+	cute_atomic_int_t seq;
+	cute_atomic_int_t done;
+	// Dependencies left to finish before this job may run, plus one while the job is still being added.
+	cute_atomic_int_t unfinished;
+	// Threads currently adding a dependent to this job, which hold off reuse of the record.
+	cute_atomic_int_t registering;
+	// List of `CF_JobLink` waiting on this job, or `CF_JOB_CLOSED` once it's done.
+	void* dependents;
+	CF_JobLink links[CF_JOB_INLINE_LINKS];
+	CF_JobLink* extra_links;
+	// Set for jobs added by `cf_threadpool_add_fiber_task`.
+	CF_Fiber* fiber;
+};
+
+struct CF_JobQueue
+{
+	alignas(CUTE_SYNC_CACHELINE_SIZE) cute_atomic_int_t top;
+	alignas(CUTE_SYNC_CACHELINE_SIZE) cute_atomic_int_t bottom;
+	// Only touched by the owning thread.
+	alignas(CUTE_SYNC_CACHELINE_SIZE) uint32_t next_seq;
+	void* slots[CF_JOB_QUEUE_CAPACITY];
+	// Records live in a ring indexed by sequence number, and are reused once the job they held is done.
+	CF_JobRecord records[CF_JOB_QUEUE_CAPACITY];
+};
+
+struct CF_Threadpool
+{
+	int thread_count;
+	cute_thread_t** threads;
+	CF_CoreType core_type;
+	CF_ThreadPriority priority;
+	// `thread_count` worker queues, then the owner's queue, then the queue shared by all other threads.
+	CF_JobQueue* queues;
+	int queue_count;
+	cute_thread_id_t owner;
+	CF_Mutex shared_mutex;
+	alignas(CUTE_SYNC_CACHELINE_SIZE) cute_atomic_int_t pending;
+	alignas(CUTE_SYNC_CACHELINE_SIZE) cute_atomic_int_t running;
+	CF_Semaphore semaphore;
+	CF_Mutex fiber_mutex;
+	CF_Fiber* free_fibers;
+	CF_Fiber* parked_fibers;
+	alignas(CUTE_SYNC_CACHELINE_SIZE) cute_atomic_int_t parked_count;
+};
+
+struct CF_WorkerState
+{
+	CF_Threadpool* pool;
+	int index;
+};
+
+static thread_local CF_WorkerState s_worker;
+// The fiber the calling thread is currently running, if any. Fibers move between threads, so this is
+// read once on entry to each wait, and never again after the fiber has yielded.
+static thread_local CF_Fiber* s_fiber;
+
+// Queue indices wrap around, so compare them by distance rather than by value.
+static int s_queue_size(int bottom, int top)
+{
+	return (int)((uint32_t)bottom - (uint32_t)top);
+}
+
+static bool s_queue_is_full(CF_JobQueue* queue)
+{
+	return s_queue_size(cute_atomic_get(&queue->bottom), cute_atomic_get(&queue->top)) >= CF_JOB_QUEUE_CAPACITY;
+}
+
+static void s_queue_push(CF_JobQueue* queue, CF_JobRecord* record)
+{
+	int b = cute_atomic_get(&queue->bottom);
+	cute_atomic_ptr_set(queue->slots + (b & (CF_JOB_QUEUE_CAPACITY - 1)), record);
+	cute_atomic_set(&queue->bottom, (int)((uint32_t)b + 1));
+}
+
+static CF_JobRecord* s_queue_pop(CF_JobQueue* queue)
+{
+	int b = (int)((uint32_t)cute_atomic_get(&queue->bottom) - 1);
+	cute_atomic_set(&queue->bottom, b);
+	int t = cute_atomic_get(&queue->top);
+	int size = s_queue_size(b, t);
+	if (size < 0) {
+		cute_atomic_set(&queue->bottom, t);
+		return NULL;
+	}
+	CF_JobRecord* record = (CF_JobRecord*)cute_atomic_ptr_get(queue->slots + (b & (CF_JOB_QUEUE_CAPACITY - 1)));
+	if (size > 0) return record;
+
+	// Last job in the queue, race any thieves for it.
+	if (!cute_atomic_cas(&queue->top, t, (int)((uint32_t)t + 1))) record = NULL;
+	cute_atomic_set(&queue->bottom, (int)((uint32_t)t + 1));
+	return record;
+}
+
+static CF_JobRecord* s_queue_steal(CF_JobQueue* queue)
+{
+	int t = cute_atomic_get(&queue->top);
+	int b = cute_atomic_get(&queue->bottom);
+	if (s_queue_size(b, t) <= 0) return NULL;
+	CF_JobRecord* record = (CF_JobRecord*)cute_atomic_ptr_get(queue->slots + (t & (CF_JOB_QUEUE_CAPACITY - 1)));
+	if (!cute_atomic_cas(&queue->top, t, (int)((uint32_t)t + 1))) return NULL;
+	return record;
+}
+
+// Returns the index of the queue the calling thread pushes to and pops from.
+static int s_queue_index(CF_Threadpool* pool)
+{
+	if (s_worker.pool == pool) return s_worker.index;
+	if (cute_thread_id() == pool->owner) return pool->thread_count;
+	return pool->thread_count + 1;
+}
+
+static bool s_jobs_are_done(CF_Threadpool* pool, const CF_Job* jobs, int count);
+
+static bool s_fiber_is_ready(CF_Threadpool* pool, CF_Fiber* fiber)
+{
+	if (fiber->wait_counter) return !cute_atomic_get(fiber->wait_counter);
+	return s_jobs_are_done(pool, fiber->wait_jobs, fiber->wait_job_count);
+}
+
+// Takes the first parked fiber whose wait is over off the parked list, and returns its job to run again.
+static CF_JobRecord* s_unpark_job(CF_Threadpool* pool)
+{
+	if (!cute_atomic_get(&pool->parked_count)) return NULL;
+	CF_JobRecord* record = NULL;
+	cf_mutex_lock(&pool->fiber_mutex);
+	for (CF_Fiber** fiber = &pool->parked_fibers; *fiber; fiber = &(*fiber)->next) {
+		if (s_fiber_is_ready(pool, *fiber)) {
+			record = (*fiber)->record;
+			*fiber = (*fiber)->next;
+			cute_atomic_add(&pool->parked_count, -1);
+			break;
+		}
+	}
+	cf_mutex_unlock(&pool->fiber_mutex);
+	return record;
+}
+
+static void s_park_fiber(CF_Threadpool* pool, CF_Fiber* fiber)
+{
+	cf_mutex_lock(&pool->fiber_mutex);
+	fiber->next = pool->parked_fibers;
+	pool->parked_fibers = fiber;
+	cute_atomic_add(&pool->parked_count, 1);
+	// Whatever the fiber waits on may have finished before it was parked, without anyone seeing it here.
+	bool ready = s_fiber_is_ready(pool, fiber);
+	cf_mutex_unlock(&pool->fiber_mutex);
+	if (ready) cf_sem_post(&pool->semaphore);
+}
+
+static void s_fiber_main(CF_Coroutine co)
+{
+	CF_Fiber* fiber = (CF_Fiber*)cf_coroutine_get_udata(co);
+	// Fibers are pooled, so loop forever running one task after another.
+	while (1) {
+		fiber->task(fiber->param);
+		fiber->parked = false;
+		cf_coroutine_yield(co);
+	}
+}
+
+static CF_Fiber* s_make_fiber(CF_Threadpool* pool, CF_TaskFn* task, void* param)
+{
+	cf_mutex_lock(&pool->fiber_mutex);
+	CF_Fiber* fiber = pool->free_fibers;
+	if (fiber) pool->free_fibers = fiber->next;
+	cf_mutex_unlock(&pool->fiber_mutex);
+	if (!fiber) {
+		fiber = (CF_Fiber*)CF_ALLOC(sizeof(CF_Fiber));
+		CF_MEMSET(fiber, 0, sizeof(CF_Fiber));
+		fiber->pool = pool;
+		fiber->co = cf_make_coroutine(s_fiber_main, CF_FIBER_STACK_SIZE, fiber);
+	}
+	fiber->task = task;
+	fiber->param = param;
+	return fiber;
+}
+
+static void s_free_fiber(CF_Threadpool* pool, CF_Fiber* fiber)
+{
+	cf_mutex_lock(&pool->fiber_mutex);
+	fiber->next = pool->free_fibers;
+	pool->free_fibers = fiber;
+	cf_mutex_unlock(&pool->fiber_mutex);
+}
+
+// Runs `fiber` until its task returns or it yields to wait. Returns true if it's waiting.
+static bool s_resume_fiber(CF_Fiber* fiber)
+{
+	CF_Fiber* prev = s_fiber;
+	s_fiber = fiber;
+	cf_coroutine_resume(fiber->co);
+	s_fiber = prev;
+	return fiber->parked;
+}
+
+// Returns the fiber of `pool` the calling thread is running, or NULL if it isn't running one.
+static CF_Fiber* s_running_fiber(CF_Threadpool* pool)
+{
+	CF_Fiber* fiber = s_fiber;
+	return fiber && fiber->pool == pool ? fiber : NULL;
+}
+
+// Yields the calling fiber until `counter` drops to zero, or all of `jobs` are done.
+static void s_fiber_wait(CF_Fiber* fiber, cute_atomic_int_t* counter, const CF_Job* jobs, int job_count)
+{
+	fiber->wait_counter = counter;
+	fiber->wait_jobs = jobs;
+	fiber->wait_job_count = job_count;
+	fiber->parked = true;
+	cf_coroutine_yield(fiber->co);
+}
+
+static CF_JobRecord* s_pop_job(CF_Threadpool* pool, int index)
+{
+	CF_JobQueue* queue = pool->queues + index;
+	bool shared = index == pool->thread_count + 1;
+	if (shared) cf_mutex_lock(&pool->shared_mutex);
+	CF_JobRecord* record = s_queue_pop(queue);
+	if (shared) cf_mutex_unlock(&pool->shared_mutex);
+	if (record) return record;
+
+	// Steal starting from the next queue over, so thieves spread out across victims.
+	for (int i = 1; i < pool->queue_count; ++i) {
+		record = s_queue_steal(pool->queues + (index + i) % pool->queue_count);
+		if (record) return record;
+	}
+	return s_unpark_job(pool);
+}
+
+static void s_run_job(CF_Threadpool* pool, CF_JobRecord* record);
+
+// Queues a job whose dependencies have all finished onto the calling thread's deque.
+static void s_release_job(CF_Threadpool* pool, CF_JobRecord* record)
+{
+	int index = s_queue_index(pool);
+	CF_JobQueue* queue = pool->queues + index;
+	bool shared = index == pool->thread_count + 1;
+	if (shared) cf_mutex_lock(&pool->shared_mutex);
+	bool full = s_queue_is_full(queue);
+	if (!full) s_queue_push(queue, record);
+	if (shared) cf_mutex_unlock(&pool->shared_mutex);
+	if (full) {
+		s_run_job(pool, record);
+	} else {
+		cf_sem_post(&pool->semaphore);
+	}
+}
+
+static void s_run_job(CF_Threadpool* pool, CF_JobRecord* record)
+{
+	CF_Fiber* fiber = record->fiber;
+	if (fiber) {
+		if (s_resume_fiber(fiber)) {
+			s_park_fiber(pool, fiber);
+			return;
+		}
+		record->fiber = NULL;
+		s_free_fiber(pool, fiber);
+	} else {
+		record->task(record->param);
+	}
+
+	CF_JobLink* link = (CF_JobLink*)cute_atomic_ptr_set(&record->dependents, CF_JOB_CLOSED);
+	cute_atomic_int_t* counter = record->counter;
+	// All of this job's own links were consumed by its dependencies before it could run.
+	CF_FREE(record->extra_links);
+	record->extra_links = NULL;
+	cute_atomic_set(&record->done, 1);
+
+	while (link) {
+		// The dependent may run and reuse its links as soon as its count drops, so step past the link first.
+		CF_JobLink* next = link->next;
+		CF_JobRecord* dependent = link->dependent;
+		if (cute_atomic_add(&dependent->unfinished, -1) == 1) {
+			s_release_job(pool, dependent);
+		}
+		link = next;
+	}
+
+	if (counter) cute_atomic_add(counter, -1);
+	cute_atomic_add(&pool->pending, -1);
+
+	// Wake a thread to check whether this finished what a parked fiber waits on.
+	if (cute_atomic_get(&pool->parked_count)) cf_sem_post(&pool->semaphore);
+}
+
+// Runs one job queued anywhere in the pool, or yields if there are none.
+static void s_help(CF_Threadpool* pool, int index)
+{
+	CF_JobRecord* record = s_pop_job(pool, index);
+	if (record) {
+		s_run_job(pool, record);
+	} else {
+		CUTE_SYNC_YIELD();
+	}
+}
+
+// Pins the calling worker to the pool's kind of core, and sets its priority.
+static void s_place_thread(CF_Threadpool* pool, int index)
+{
+	const CF_Topology* topology = s_topology();
+	const int* cores = NULL;
+	int core_count = 0;
+	if (pool->core_type == CF_CORE_TYPE_PERFORMANCE) {
+		cores = topology->performance_cores;
+		core_count = topology->info.performance_thread_count;
+	} else if (pool->core_type == CF_CORE_TYPE_EFFICIENCY) {
+		cores = topology->efficiency_cores;
+		core_count = topology->info.efficiency_thread_count;
+	}
+	// Cores of a kind the CPU doesn't have weren't recorded, and pinning to every core is a no-op.
+	if (core_count == topology->info.logical_core_count) core_count = 0;
+
+#if defined(CF_LINUX) || defined(CF_ANDROID)
+	if (core_count) {
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for (int i = 0; i < core_count; ++i) CPU_SET(cores[i], &set);
+		sched_setaffinity(0, sizeof(set), &set);
+	}
+#elif defined(CF_WINDOWS)
+	if (core_count) {
+		// A thread can only be pinned within one processor group, so spread workers across the groups.
+		GROUP_AFFINITY affinity = { };
+		affinity.Group = (WORD)(cores[index % core_count] / 64);
+		for (int i = 0; i < core_count; ++i) {
+			if (cores[i] / 64 == affinity.Group) affinity.Mask |= (KAFFINITY)1 << (cores[i] % 64);
+		}
+		SetThreadGroupAffinity(GetCurrentThread(), &affinity, NULL);
+	}
+#elif defined(CF_APPLE)
+	// Threads can't be pinned, but the OS places them by quality of service. Setting a scheduling
+	// priority would opt the thread out of quality of service, so it's folded in here instead.
+	if (pool->core_type != CF_CORE_TYPE_ANY) {
+		qos_class_t qos = pool->core_type == CF_CORE_TYPE_PERFORMANCE ? QOS_CLASS_USER_INTERACTIVE : QOS_CLASS_BACKGROUND;
+		pthread_set_qos_class_self_np(qos, pool->priority == CF_THREAD_PRIORITY_LOW ? QOS_MIN_RELATIVE_PRIORITY : 0);
+		return;
+	}
+#endif
+	CF_UNUSED(cores);
+	CF_UNUSED(index);
+
+	if (pool->priority == CF_THREAD_PRIORITY_LOW) {
+		SDL_SetThreadPriority(SDL_THREAD_PRIORITY_LOW);
+	} else if (pool->priority == CF_THREAD_PRIORITY_HIGH) {
+		SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+	}
+}
+
+static int s_worker_thread(void* udata)
+{
+	CF_WorkerState* state = (CF_WorkerState*)udata;
+	s_worker = *state;
+	CF_FREE(state);
+	CF_Threadpool* pool = s_worker.pool;
+	s_place_thread(pool, s_worker.index);
+	while (cute_atomic_get(&pool->running)) {
+		CF_JobRecord* record = s_pop_job(pool, s_worker.index);
+		if (record) {
+			s_run_job(pool, record);
+		} else {
+			cf_sem_wait(&pool->semaphore);
+		}
+	}
+	return 0;
+}
+
+static CF_JobRecord* s_job_record(CF_Threadpool* pool, CF_Job job)
+{
+	int index = (int)(job.id >> 32);
+	uint32_t seq = (uint32_t)job.id;
+	return pool->queues[index].records + (seq & (CF_JOB_QUEUE_CAPACITY - 1));
+}
+
+static bool s_job_is_done(CF_Threadpool* pool, CF_Job job)
+{
+	if (!job.id) return true;
+	CF_JobRecord* record = s_job_record(pool, job);
+	// A reused record means the job it held finished long ago.
+	if ((uint32_t)cute_atomic_get(&record->seq) != (uint32_t)job.id) return true;
+	return !!cute_atomic_get(&record->done);
+}
+
+// Adds `link` to the dependents of `job`. Returns false if `job` is already done.
+static bool s_link_dependent(CF_Threadpool* pool, CF_Job job, CF_JobLink* link)
+{
+	if (!job.id) return false;
+	CF_JobRecord* record = s_job_record(pool, job);
+	cute_atomic_add(&record->registering, 1);
+	bool linked = false;
+	if ((uint32_t)cute_atomic_get(&record->seq) == (uint32_t)job.id) {
+		while (1) {
+			void* head = cute_atomic_ptr_get(&record->dependents);
+			if (head == CF_JOB_CLOSED) break;
+			link->next = (CF_JobLink*)head;
+			if (cute_atomic_ptr_cas(&record->dependents, head, link)) {
+				linked = true;
+				break;
+			}
+		}
+	}
+	cute_atomic_add(&record->registering, -1);
+	return linked;
+}
+
+static bool s_jobs_are_done(CF_Threadpool* pool, const CF_Job* jobs, int count)
+{
+	for (int i = 0; i < count; ++i) {
+		if (!s_job_is_done(pool, jobs[i])) return false;
+	}
+	return true;
+}
+
 CF_Threadpool* cf_make_threadpool(int thread_count)
 {
-	return cute_threadpool_create(thread_count, NULL);
+	CF_ThreadpoolParams params = cf_threadpool_params_defaults();
+	params.thread_count = thread_count;
+	return cf_make_threadpool_with_params(&params);
+}
+
+CF_Threadpool* cf_make_threadpool_with_params(const CF_ThreadpoolParams* params_ptr)
+{
+	CF_ThreadpoolParams params = params_ptr ? *params_ptr : cf_threadpool_params_defaults();
+	int thread_count = params.thread_count;
+	if (thread_count <= 0) {
+		CF_CpuTopology topology = s_topology()->info;
+		int threads = topology.logical_core_count;
+		if (params.core_type == CF_CORE_TYPE_PERFORMANCE) threads = topology.performance_thread_count;
+		if (params.core_type == CF_CORE_TYPE_EFFICIENCY && topology.efficiency_thread_count) threads = topology.efficiency_thread_count;
+		thread_count = cf_max(threads - 1, 1);
+	}
+
+	CF_Threadpool* pool = (CF_Threadpool*)cf_aligned_alloc(sizeof(CF_Threadpool), CUTE_SYNC_CACHELINE_SIZE);
+	CF_MEMSET(pool, 0, sizeof(CF_Threadpool));
+	pool->thread_count = thread_count;
+	pool->core_type = params.core_type;
+	pool->priority = params.priority;
+	pool->queue_count = thread_count + 2;
+	pool->queues = (CF_JobQueue*)cf_aligned_alloc(sizeof(CF_JobQueue) * pool->queue_count, CUTE_SYNC_CACHELINE_SIZE);
+	CF_MEMSET(pool->queues, 0, sizeof(CF_JobQueue) * pool->queue_count);
+	for (int i = 0; i < pool->queue_count; ++i) {
+		CF_JobQueue* queue = pool->queues + i;
+		queue->next_seq = 1;
+		for (int j = 0; j < CF_JOB_QUEUE_CAPACITY; ++j) {
+			cute_atomic_set(&queue->records[j].done, 1);
+			queue->records[j].dependents = CF_JOB_CLOSED;
+		}
+	}
+	pool->owner = cute_thread_id();
+	pool->shared_mutex = cf_make_mutex();
+	cute_atomic_set(&pool->running, 1);
+	pool->semaphore = cf_make_sem(0);
+	pool->fiber_mutex = cf_make_mutex();
+
+	pool->threads = (cute_thread_t**)CF_ALLOC(sizeof(cute_thread_t*) * thread_count);
+	for (int i = 0; i < thread_count; ++i) {
+		CF_WorkerState* state = (CF_WorkerState*)CF_ALLOC(sizeof(CF_WorkerState));
+		state->pool = pool;
+		state->index = i;
+		pool->threads[i] = cute_thread_create(s_worker_thread, NULL, state);
+	}
+
+	return pool;
+}
+
+CF_Job cf_threadpool_add_task(CF_Threadpool* pool, CF_TaskFn* task, void* param)
+{
+	return cf_threadpool_add_dependent_task(pool, task, param, NULL, 0, NULL);
+}
+
+static CF_Job s_add_job(CF_Threadpool* pool, CF_TaskFn* task, void* param, bool fiber, const CF_Job* dependencies, int dependency_count, CF_AtomicInt* counter)
+{
+	int index = s_queue_index(pool);
+	CF_JobQueue* queue = pool->queues + index;
+	bool shared = index == pool->thread_count + 1;
+	if (shared) cf_mutex_lock(&pool->shared_mutex);
+
+	uint32_t seq = queue->next_seq;
+	CF_JobRecord* record = queue->records + (seq & (CF_JOB_QUEUE_CAPACITY - 1));
+
+	// Every record in the ring is still in flight, so just run the task right away once its dependencies
+	// are done. Waiting for a record to free up instead could deadlock, as it may belong to a task further
+	// down this thread's stack.
+	if (!cute_atomic_get(&record->done) || s_queue_is_full(queue)) {
+		if (shared) cf_mutex_unlock(&pool->shared_mutex);
+		CF_Fiber* running = s_running_fiber(pool);
+		while (!s_jobs_are_done(pool, dependencies, dependency_count)) {
+			if (running) {
+				s_fiber_wait(running, NULL, dependencies, dependency_count);
+			} else {
+				s_help(pool, index);
+			}
+		}
+		task(param);
+		CF_Job job = { 0 };
+		return job;
+	}
+
+	queue->next_seq = seq + 1 ? seq + 1 : 1;
+	record->task = task;
+	record->param = param;
+	record->counter = counter;
+	record->fiber = fiber ? s_make_fiber(pool, task, param) : NULL;
+	if (fiber) record->fiber->record = record;
+	if (counter) cute_atomic_add(counter, 1);
+	cute_atomic_add(&pool->pending, 1);
+
+	// Publish the new sequence number before reopening the record, so anyone still checking on its
+	// previous job either sees the new number, or finishes with the record before it's reopened.
+	cute_atomic_set(&record->seq, (int)seq);
+	while (cute_atomic_get(&record->registering)) {
+	}
+	cute_atomic_set(&record->unfinished, dependency_count + 1);
+	cute_atomic_ptr_set(&record->dependents, NULL);
+	cute_atomic_set(&record->done, 0);
+
+	CF_JobLink* links = record->links;
+	if (dependency_count > CF_JOB_INLINE_LINKS) {
+		record->extra_links = (CF_JobLink*)CF_ALLOC(sizeof(CF_JobLink) * dependency_count);
+		links = record->extra_links;
+	}
+	int finished = 1;
+	for (int i = 0; i < dependency_count; ++i) {
+		links[i].dependent = record;
+		if (!s_link_dependent(pool, dependencies[i], links + i)) ++finished;
+	}
+	if (cute_atomic_add(&record->unfinished, -finished) == finished) {
+		s_queue_push(queue, record);
+	}
+
+	if (shared) cf_mutex_unlock(&pool->shared_mutex);
+
+	CF_Job job;
+	job.id = ((uint64_t)index << 32) | seq;
+	return job;
+}
+
+CF_Job cf_threadpool_add_dependent_task(CF_Threadpool* pool, CF_TaskFn* task, void* param, const CF_Job* dependencies, int dependency_count, CF_AtomicInt* counter)
+{
+	return s_add_job(pool, task, param, false, dependencies, dependency_count, counter);
+}
+
+CF_Job cf_threadpool_add_fiber_task(CF_Threadpool* pool, CF_TaskFn* task, void* param, const CF_Job* dependencies, int dependency_count, CF_AtomicInt* counter)
+{
+	return s_add_job(pool, task, param, true, dependencies, dependency_count, counter);
+}
+
+bool cf_threadpool_job_is_done(CF_Threadpool* pool, CF_Job job)
+{
+	return s_job_is_done(pool, job);
 }
 
-void cf_threadpool_add_task(CF_Threadpool* pool, CF_TaskFn* task, void* param)
+void cf_threadpool_wait_job(CF_Threadpool* pool, CF_Job job)
 {
-	cute_threadpool_add_task(pool, task, param);
+	CF_Fiber* fiber = s_running_fiber(pool);
+	if (fiber) {
+		while (!s_job_is_done(pool, job)) {
+			s_fiber_wait(fiber, NULL, &job, 1);
+		}
+		return;
+	}
+	int index = s_queue_index(pool);
+	while (!s_job_is_done(pool, job)) {
+		s_help(pool, index);
+	}
+}
+
+void cf_threadpool_wait_counter(CF_Threadpool* pool, CF_AtomicInt* counter)
+{
+	CF_Fiber* fiber = s_running_fiber(pool);
+	if (fiber) {
+		while (cute_atomic_get(counter)) {
+			s_fiber_wait(fiber, counter, NULL, 0);
+		}
+		return;
+	}
+	int index = s_queue_index(pool);
+	while (cute_atomic_get(counter)) {
+		s_help(pool, index);
+	}
 }
 
 void cf_threadpool_kick_and_wait(CF_Threadpool* pool)
 {
-	cute_threadpool_kick_and_wait(pool);
+	cf_threadpool_kick(pool);
+	int index = s_queue_index(pool);
+	while (cute_atomic_get(&pool->pending)) {
+		s_help(pool, index);
+	}
 }
 
 void cf_threadpool_kick(CF_Threadpool* pool)
 {
-	cute_threadpool_kick(pool);
+	int pending = cute_atomic_get(&pool->pending);
+	int count = pending < pool->thread_count ? pending : pool->thread_count;
+	for (int i = 0; i < count; ++i) {
+		cf_sem_post(&pool->semaphore);
+	}
 }
 
 void cf_destroy_threadpool(CF_Threadpool* pool)
 {
-	cute_threadpool_destroy(pool);
+	cute_atomic_set(&pool->running, 0);
+
+	for (int i = 0; i < pool->thread_count; ++i) {
+		cf_sem_post(&pool->semaphore);
+	}
+
+	for (int i = 0; i < pool->thread_count; ++i) {
+		cute_thread_wait(pool->threads[i]);
+	}
+
+	CF_ASSERT(!pool->parked_fibers);
+	for (CF_Fiber* fiber = pool->free_fibers; fiber;) {
+		CF_Fiber* next = fiber->next;
+		cf_destroy_coroutine(fiber->co);
+		CF_FREE(fiber);
+		fiber = next;
+	}
+
+	cf_destroy_sem(&pool->semaphore);
+	cf_destroy_mutex(&pool->shared_mutex);
+	cf_destroy_mutex(&pool->fiber_mutex);
+	CF_FREE(pool->threads);
+	cf_aligned_free(pool->queues);
+	cf_aligned_free(pool);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Parallel for and reduce.
+
+// Threads (including the caller) grab the next range off an atomic index until none are left, so a
+// few slow ranges don't hold up the rest.
+struct CF_ParallelRun
+{
+	int count;
+	int range_size;
+	int range_count;
+	cute_atomic_int_t next;
+	CF_ParallelForFn* for_fn;
+	CF_ParallelReduceFn* reduce_fn;
+	uint8_t* partials;
+	int result_size;
+	void* udata;
+};
+
+static void s_parallel_task(void* param)
+{
+	CF_ParallelRun* run = (CF_ParallelRun*)param;
+	while (1) {
+		int range = cute_atomic_add(&run->next, 1);
+		if (range >= run->range_count) break;
+		int begin = range * run->range_size;
+		int end = begin + run->range_size < run->count ? begin + run->range_size : run->count;
+		if (run->for_fn) {
+			run->for_fn(begin, end, run->udata);
+		} else {
+			run->reduce_fn(begin, end, run->partials + (size_t)range * run->result_size, run->udata);
+		}
+	}
+}
+
+static void s_parallel_ranges(CF_Threadpool* pool, int count, int grain, CF_ParallelRun* run)
+{
+	// Aim for a few ranges per thread, to balance out uneven work without paying for many tiny ranges.
+	int thread_count = pool ? pool->thread_count + 1 : 1;
+	int range_size = (count + thread_count * 4 - 1) / (thread_count * 4);
+	if (range_size < grain) range_size = grain;
+	if (range_size < 1) range_size = 1;
+	run->count = count;
+	run->range_size = range_size;
+	run->range_count = (count + range_size - 1) / range_size;
+	cute_atomic_set(&run->next, 0);
+}
+
+static void s_parallel_run(CF_Threadpool* pool, CF_ParallelRun* run)
+{
+	// Spawn helpers for all but the range the calling thread takes on itself.
+	int helper_count = pool ? run->range_count - 1 : 0;
+	if (pool && helper_count > pool->thread_count) helper_count = pool->thread_count;
+	cute_atomic_int_t counter;
+	cute_atomic_set(&counter, 0);
+	for (int i = 0; i < helper_count; ++i) {
+		cf_threadpool_add_dependent_task(pool, s_parallel_task, run, NULL, 0, &counter);
+	}
+	if (helper_count) cf_threadpool_kick(pool);
+	s_parallel_task(run);
+	if (helper_count) cf_threadpool_wait_counter(pool, &counter);
+}
+
+void cf_parallel_for(CF_Threadpool* pool, int count, int grain, CF_ParallelForFn* fn, void* udata)
+{
+	if (count <= 0) return;
+	CF_ParallelRun run;
+	CF_MEMSET(&run, 0, sizeof(run));
+	run.for_fn = fn;
+	run.udata = udata;
+	s_parallel_ranges(pool, count, grain, &run);
+	s_parallel_run(pool, &run);
+}
+
+void cf_parallel_reduce(CF_Threadpool* pool, int count, int grain, void* result, int result_size, CF_ParallelReduceFn* fn, CF_ParallelJoinFn* join, void* udata)
+{
+	if (count <= 0) return;
+	CF_ParallelRun run;
+	CF_MEMSET(&run, 0, sizeof(run));
+	run.reduce_fn = fn;
+	run.udata = udata;
+	run.result_size = result_size;
+	s_parallel_ranges(pool, count, grain, &run);
+
+	// Every range gets its own partial result seeded with the identity value.
+	run.partials = (uint8_t*)CF_ALLOC((size_t)run.range_count * result_size);
+	for (int i = 0; i < run.range_count; ++i) {
+		CF_MEMCPY(run.partials + (size_t)i * result_size, result, result_size);
+	}
+
+	s_parallel_run(pool, &run);
+
+	for (int i = 0; i < run.range_count; ++i) {
+		join(result, run.partials + (size_t)i * result_size, udata);
+	}
+	CF_FREE(run.partials);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Lock-free queues.
+
+// Each end of a queue sits on its own cache line, so the producer and consumer don't make each other
+// reload the line on every push and pop.
+struct CF_QueueEnd
+{
+	cute_atomic_int_t index;
+	// The last index seen for the opposite end. Only used by `CF_SPSCQueue`.
+	int cached;
+};
+
+struct CF_SPSCQueue
+{
+	int mask;
+	int element_size;
+	CF_QueueEnd* head;
+	CF_QueueEnd* tail;
+	uint8_t* elements;
+};
+
+// Dmitry Vyukov's bounded MPMC queue: each slot has a sequence number telling whether it's ready to be
+// written or read for the current lap around the ring.
+// https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+struct CF_MPMCQueue
+{
+	int mask;
+	int element_size;
+	CF_QueueEnd* head;
+	CF_QueueEnd* tail;
+	cute_atomic_int_t* seqs;
+	uint8_t* elements;
+};
+
+static int s_line_size()
+{
+	int line = cf_cacheline_size();
+	return line < (int)sizeof(CF_QueueEnd) ? (int)sizeof(CF_QueueEnd) : line;
+}
+
+static int s_round_up(int size, int line)
+{
+	return (size + line - 1) / line * line;
+}
+
+static int s_pow2_capacity(int capacity)
+{
+	int result = 1;
+	while (result < capacity) result <<= 1;
+	return result;
+}
+
+CF_SPSCQueue* cf_make_spsc_queue(int capacity, int element_size)
+{
+	capacity = s_pow2_capacity(capacity);
+	int line = s_line_size();
+	int header = s_round_up((int)sizeof(CF_SPSCQueue), line);
+	uint8_t* mem = (uint8_t*)cf_aligned_alloc(header + line * 2 + capacity * element_size, line);
+	CF_MEMSET(mem, 0, header + line * 2);
+	CF_SPSCQueue* queue = (CF_SPSCQueue*)mem;
+	queue->mask = capacity - 1;
+	queue->element_size = element_size;
+	queue->head = (CF_QueueEnd*)(mem + header);
+	queue->tail = (CF_QueueEnd*)(mem + header + line);
+	queue->elements = mem + header + line * 2;
+	return queue;
+}
+
+void cf_destroy_spsc_queue(CF_SPSCQueue* queue)
+{
+	cf_aligned_free(queue);
+}
+
+bool cf_spsc_queue_push(CF_SPSCQueue* queue, const void* element)
+{
+	CF_QueueEnd* tail = queue->tail;
+	int t = cute_atomic_get(&tail->index);
+	if (s_queue_size(t, tail->cached) > queue->mask) {
+		tail->cached = cute_atomic_get(&queue->head->index);
+		if (s_queue_size(t, tail->cached) > queue->mask) return false;
+	}
+	CF_MEMCPY(queue->elements + (t & queue->mask) * queue->element_size, element, queue->element_size);
+	cute_atomic_set(&tail->index, (int)((uint32_t)t + 1));
+	return true;
+}
+
+bool cf_spsc_queue_pop(CF_SPSCQueue* queue, void* element)
+{
+	CF_QueueEnd* head = queue->head;
+	int h = cute_atomic_get(&head->index);
+	if (h == head->cached) {
+		head->cached = cute_atomic_get(&queue->tail->index);
+		if (h == head->cached) return false;
+	}
+	CF_MEMCPY(element, queue->elements + (h & queue->mask) * queue->element_size, queue->element_size);
+	cute_atomic_set(&head->index, (int)((uint32_t)h + 1));
+	return true;
+}
+
+int cf_spsc_queue_count(CF_SPSCQueue* queue)
+{
+	return s_queue_size(cute_atomic_get(&queue->tail->index), cute_atomic_get(&queue->head->index));
+}
+
+CF_MPMCQueue* cf_make_mpmc_queue(int capacity, int element_size)
+{
+	capacity = s_pow2_capacity(capacity);
+	int line = s_line_size();
+	int header = s_round_up((int)sizeof(CF_MPMCQueue), line);
+	int seqs_size = s_round_up((int)sizeof(cute_atomic_int_t) * capacity, line);
+	uint8_t* mem = (uint8_t*)cf_aligned_alloc(header + line * 2 + seqs_size + capacity * element_size, line);
+	CF_MEMSET(mem, 0, header + line * 2);
+	CF_MPMCQueue* queue = (CF_MPMCQueue*)mem;
+	queue->mask = capacity - 1;
+	queue->element_size = element_size;
+	queue->head = (CF_QueueEnd*)(mem + header);
+	queue->tail = (CF_QueueEnd*)(mem + header + line);
+	queue->seqs = (cute_atomic_int_t*)(mem + header + line * 2);
+	queue->elements = mem + header + line * 2 + seqs_size;
+	for (int i = 0; i < capacity; ++i) {
+		cute_atomic_set(queue->seqs + i, i);
+	}
+	return queue;
+}
+
+void cf_destroy_mpmc_queue(CF_MPMCQueue* queue)
+{
+	cf_aligned_free(queue);
+}
+
+bool cf_mpmc_queue_push(CF_MPMCQueue* queue, const void* element)
+{
+	int t = cute_atomic_get(&queue->tail->index);
+	while (1) {
+		int seq = cute_atomic_get(queue->seqs + (t & queue->mask));
+		int lap = s_queue_size(seq, t);
+		if (lap == 0) {
+			if (cute_atomic_cas(&queue->tail->index, t, (int)((uint32_t)t + 1))) break;
+		} else if (lap < 0) {
+			// The slot still holds an element from the previous lap.
+			return false;
+		}
+		t = cute_atomic_get(&queue->tail->index);
+	}
+	CF_MEMCPY(queue->elements + (t & queue->mask) * queue->element_size, element, queue->element_size);
+	cute_atomic_set(queue->seqs + (t & queue->mask), (int)((uint32_t)t + 1));
+	return true;
+}
+
+bool cf_mpmc_queue_pop(CF_MPMCQueue* queue, void* element)
+{
+	int h = cute_atomic_get(&queue->head->index);
+	while (1) {
+		int seq = cute_atomic_get(queue->seqs + (h & queue->mask));
+		int lap = s_queue_size(seq, (int)((uint32_t)h + 1));
+		if (lap == 0) {
+			if (cute_atomic_cas(&queue->head->index, h, (int)((uint32_t)h + 1))) break;
+		} else if (lap < 0) {
+			// The slot hasn't been written yet for this lap.
+			return false;
+		}
+		h = cute_atomic_get(&queue->head->index);
+	}
+	CF_MEMCPY(element, queue->elements + (h & queue->mask) * queue->element_size, queue->element_size);
+	cute_atomic_set(queue->seqs + (h & queue->mask), (int)((uint32_t)h + queue->mask + 1));
+	return true;
+}
+
+int cf_mpmc_queue_count(CF_MPMCQueue* queue)
+{
+	int size = s_queue_size(cute_atomic_get(&queue->tail->index), cute_atomic_get(&queue->head->index));
+	return size < 0 ? 0 : size;
 }
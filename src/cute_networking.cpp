@@ -6,6 +6,14 @@
 */
 
 #include <cute_networking.h>
+#include <cute_alloc.h>
+#include <cute_array.h>
+#include <cute_math.h>
+#include <cute_multithreading.h>
+#include <cute_profile.h>
+#include <cute_time.h>
+
+#include <internal/cute_networking_internal.h>
 
 #define CUTE_NET_IMPLEMENTATION
 #include <cute/cute_net.h>
@@ -20,6 +28,7 @@ static CF_INLINE CF_Result cf_wrap(cn_result_t cn_result)
 
 CF_STATIC_ASSERT(CF_CONNECT_TOKEN_SIZE == CN_CONNECT_TOKEN_SIZE, "Must be equal.");
 CF_STATIC_ASSERT(CF_CONNECT_TOKEN_USER_DATA_SIZE == CN_CONNECT_TOKEN_USER_DATA_SIZE, "Must be equal.");
+CF_STATIC_ASSERT(CF_RELIABLE_CHANNEL_COUNT == CN_RELIABLE_CHANNEL_COUNT, "Must be equal.");
 
 int cf_address_init(CF_Address* endpoint, const char* address_and_port_string)
 {
@@ -82,6 +91,53 @@ CF_Result cf_generate_connect_token(
 	return cf_wrap(result);
 }
 
+struct CF_ConnectTokenJob
+{
+	const cn_connect_token_batch_t* batch;
+	const CF_ConnectTokenRequest* requests;
+	const uint8_t* random;
+	uint8_t* tokens_out;
+};
+
+static void CF_CALL s_generate_connect_tokens(int begin, int end, void* udata)
+{
+	CF_ConnectTokenJob* job = (CF_ConnectTokenJob*)udata;
+	for (int i = begin; i < end; ++i) {
+		const CF_ConnectTokenRequest* request = job->requests + i;
+		cn_generate_connect_token_from_batch(job->batch, &request->client_to_server_key, &request->server_to_client_key, request->client_id, request->user_data, job->random + i * CN_CONNECT_TOKEN_RANDOM_SIZE, job->tokens_out + i * CF_CONNECT_TOKEN_SIZE);
+	}
+}
+
+CF_Result cf_generate_connect_tokens(
+	uint64_t application_id,
+	uint64_t creation_timestamp,
+	uint64_t expiration_timestamp,
+	uint32_t handshake_timeout,
+	int address_count,
+	const char** address_list,
+	const CF_CryptoSignSecret* shared_secret_key,
+	int count,
+	const CF_ConnectTokenRequest* requests,
+	uint8_t* tokens_out,
+	CF_Threadpool* pool
+)
+{
+	cn_connect_token_batch_t batch;
+	cn_result_t result = cn_connect_token_batch_init(&batch, application_id, creation_timestamp, expiration_timestamp, handshake_timeout, address_count, address_list, shared_secret_key);
+	if (cn_is_error(result)) return cf_wrap(result);
+	if (count <= 0) return cf_result_success();
+
+	// The crypto library's random generator isn't thread-safe, so draw every token's random bytes up front.
+	uint8_t* random = (uint8_t*)cf_alloc((size_t)count * CN_CONNECT_TOKEN_RANDOM_SIZE);
+	cf_crypto_random_bytes(random, count * CN_CONNECT_TOKEN_RANDOM_SIZE);
+	CF_ConnectTokenJob job = { &batch, requests, random, tokens_out };
+	cf_parallel_for(pool, count, 16, s_generate_connect_tokens, &job);
+	CF_MEMSET(random, 0, (size_t)count * CN_CONNECT_TOKEN_RANDOM_SIZE);
+	cf_free(random);
+	CF_MEMSET(&batch, 0, sizeof(batch));
+	return cf_result_success();
+}
+
 CF_Client* cf_make_client(
 	uint16_t port,
 	uint64_t application_id,
@@ -108,6 +164,8 @@ void cf_client_disconnect(CF_Client* client)
 
 void cf_client_update(CF_Client* client, double dt, uint64_t current_time)
 {
+	CF_PROFILE_SCOPE("cf_client_update");
+	CF_ALLOC_TAG_SCOPE("net");
 	cn_client_update(client, dt, current_time);
 }
 
@@ -126,6 +184,11 @@ CF_Result cf_client_send(CF_Client* client, const void* packet, int size, bool s
 	return cf_wrap(cn_client_send(client, packet, size, send_reliably));
 }
 
+CF_Result cf_client_send_on_channel(CF_Client* client, const void* packet, int size, int channel)
+{
+	return cf_wrap(cn_client_send_on_channel(client, packet, size, channel));
+}
+
 CF_ClientState cf_client_state_get(const CF_Client* client)
 {
 	return (CF_ClientState)cn_client_state_get(client);
@@ -136,11 +199,419 @@ void cf_client_enable_network_simulator(CF_Client* client, double latency, doubl
 	cn_client_enable_network_simulator(client, latency, jitter, drop_chance, duplicate_chance);
 }
 
+static CF_NetworkStats s_wrap_stats(const cn_connection_stats_t& cn_stats)
+{
+	CF_NetworkStats stats = { };
+	stats.rtt = cn_stats.rtt / 1000.0f;
+	stats.jitter = cn_stats.rtt_jitter / 1000.0f;
+	stats.packet_loss = cn_stats.packet_loss;
+	stats.incoming_bytes_per_second = cn_stats.incoming_kbps * (1000.0f / 8.0f);
+	stats.outgoing_bytes_per_second = cn_stats.outgoing_kbps * (1000.0f / 8.0f);
+	stats.reliable_queue_depth = cn_stats.reliable_queue_depth;
+	stats.reassembly_bytes = cn_stats.reassembly_bytes;
+	stats.resend_count = cn_stats.resend_count;
+	stats.packets_sent = cn_stats.packets_sent;
+	stats.packets_received = cn_stats.packets_received;
+	return stats;
+}
+
+CF_NetworkStats cf_client_get_stats(CF_Client* client)
+{
+	return s_wrap_stats(cn_client_get_stats(client));
+}
+
+void cf_net_get_byte_totals(uint64_t* sent, uint64_t* received)
+{
+	cn_get_socket_byte_totals(sent, received);
+}
+
 //--------------------------------------------------------------------------------------------------
 // SERVER
 
 CF_STATIC_ASSERT(CF_SERVER_MAX_CLIENTS == CN_SERVER_MAX_CLIENTS, "Must be equal.");
 
+struct CF_QueuedPacket
+{
+	void* data;
+	int size;
+	bool reliable;
+	int channel;
+};
+
+// Packets waiting on a client's outgoing budget. Popped from `head`, and compacted once drained.
+struct CF_SendQueue
+{
+	Cute::Array<CF_QueuedPacket> packets;
+	int head = 0;
+};
+
+// Token buckets for one client. Tokens may go negative, so a packet bigger than the burst still
+// gets through, and is paid back out of the following updates.
+struct CF_ClientBandwidth
+{
+	double outgoing_tokens = 0;
+	double incoming_tokens = 0;
+	int queued_bytes = 0;
+	CF_SendQueue queues[CF_SEND_PRIORITY_HIGH + 1];
+};
+
+enum CF_ServerCommandType
+{
+	CF_SERVER_COMMAND_SEND,
+	CF_SERVER_COMMAND_DISCONNECT,
+	CF_SERVER_COMMAND_NETWORK_SIMULATOR,
+};
+
+// Handed from the game thread to the I/O thread, when `use_io_thread` is on.
+struct CF_ServerCommand
+{
+	CF_ServerCommandType type;
+	int client_index;
+	void* data;
+	int size;
+	bool reliable;
+	int channel;
+	bool notify_client;
+	double simulator[4];
+};
+
+#define CF_SERVER_IO_QUEUE_CAPACITY 4096
+
+struct CF_ServerHostThread;
+
+struct CF_Server
+{
+	cn_server_t* cn = NULL;
+	int max_incoming_bytes_per_second = 0;
+	int max_outgoing_bytes_per_second = 0;
+	CF_ClientBandwidth clients[CF_SERVER_MAX_CLIENTS];
+
+	// Only used with `use_io_thread`. The game thread owns everything above, the I/O thread owns `cn` and the `io_` state
+	// while running. With a `host` one of the host's threads stands in for `io_thread`.
+	bool use_io_thread = false;
+	bool io_running = false;
+	CF_Thread* io_thread = NULL;
+	CF_ServerHost* host = NULL;
+	CF_ServerHostThread* host_thread = NULL;
+	CF_AtomicInt running = { };
+	CF_AtomicInt connected[CF_SERVER_MAX_CLIENTS] = { };
+	CF_SPSCQueue* commands = NULL;
+	CF_SPSCQueue* events = NULL;
+	CF_Mutex time_lock = { };
+	uint64_t current_time = 0;
+	CF_Mutex stats_lock = { };
+	cn_connection_stats_t stats[CF_SERVER_MAX_CLIENTS] = { };
+	uint64_t io_prev_ticks = 0;
+	bool io_holding_event = false;
+	CF_ServerEvent io_held_event = { };
+};
+
+// A shared I/O thread, taking turns updating each of its servers.
+struct CF_ServerHostThread
+{
+	CF_Thread* thread = NULL;
+	CF_AtomicInt running = { };
+	CF_Mutex lock = { };
+	Cute::Array<CF_Server*> servers;
+};
+
+struct CF_ServerHost
+{
+	Cute::Array<CF_ServerHostThread*> threads;
+};
+
+static bool s_threaded(CF_Server* server)
+{
+	return server->io_running;
+}
+
+static bool s_is_client_connected(CF_Server* server, int client_index)
+{
+	if (s_threaded(server)) return cf_atomic_get(&server->connected[client_index]) != 0;
+	return cn_server_is_client_connected(server->cn, client_index);
+}
+
+static void s_push_command(CF_Server* server, const CF_ServerCommand& command)
+{
+	// Only waits when the I/O thread is thousands of commands behind.
+	while (!cf_spsc_queue_push(server->commands, &command)) {
+		cf_sleep(0);
+	}
+}
+
+// `channel` only matters for reliable packets.
+static void s_cn_send(cn_server_t* cn, const void* data, int size, int client_index, bool reliable, int channel)
+{
+	if (reliable) {
+		cn_server_send_on_channel(cn, data, size, client_index, channel);
+	} else {
+		cn_server_send(cn, data, size, client_index, false);
+	}
+}
+
+// Takes ownership of `data`, which must come from `cf_alloc`.
+static void s_send(CF_Server* server, void* data, int size, int client_index, bool reliable, int channel)
+{
+	if (s_threaded(server)) {
+		CF_ServerCommand command = { };
+		command.type = CF_SERVER_COMMAND_SEND;
+		command.client_index = client_index;
+		command.data = data;
+		command.size = size;
+		command.reliable = reliable;
+		command.channel = channel;
+		s_push_command(server, command);
+	} else {
+		s_cn_send(server->cn, data, size, client_index, reliable, channel);
+		cf_free(data);
+	}
+}
+
+static void s_free_payload(CF_Server* server, int client_index, void* data)
+{
+	// The I/O thread hands over copies, so cn's packets never cross threads.
+	if (server->use_io_thread) {
+		cf_free(data);
+	} else {
+		cn_server_free_packet(server->cn, client_index, data);
+	}
+}
+
+// Caps how far a quiet client can save up, so a send budget can't be spent in one big spike.
+static double s_burst(int bytes_per_second)
+{
+	return (double)cf_max(bytes_per_second / 10, CN_TRANSPORT_PACKET_PAYLOAD_MAX);
+}
+
+static void s_clear_client(CF_Server* server, int client_index)
+{
+	CF_ClientBandwidth* client = server->clients + client_index;
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(client->queues); ++i) {
+		CF_SendQueue* queue = client->queues + i;
+		for (int j = queue->head; j < queue->packets.count(); ++j) {
+			cf_free(queue->packets[j].data);
+		}
+		queue->packets.clear();
+		queue->head = 0;
+	}
+	client->queued_bytes = 0;
+	client->outgoing_tokens = s_burst(server->max_outgoing_bytes_per_second);
+	client->incoming_tokens = (double)server->max_incoming_bytes_per_second;
+}
+
+// Sends queued packets highest priority first, until the client's budget runs out.
+static void s_flush_client(CF_Server* server, int client_index, double dt)
+{
+	CF_ClientBandwidth* client = server->clients + client_index;
+	int rate = server->max_outgoing_bytes_per_second;
+	client->outgoing_tokens = cf_min(client->outgoing_tokens + rate * dt, s_burst(rate));
+	if (!client->queued_bytes) return;
+
+	for (int i = (int)CF_ARRAY_SIZE(client->queues) - 1; i >= 0; --i) {
+		CF_SendQueue* queue = client->queues + i;
+		while (queue->head < queue->packets.count()) {
+			CF_QueuedPacket packet = queue->packets[queue->head];
+			if (client->outgoing_tokens <= 0 && packet.reliable) break;
+			if (client->outgoing_tokens > 0) {
+				s_send(server, packet.data, packet.size, client_index, packet.reliable, packet.channel);
+				client->outgoing_tokens -= packet.size;
+			} else {
+				// Unreliable packets that didn't fit are dropped -- by the next update they're stale anyway.
+				cf_free(packet.data);
+			}
+			client->queued_bytes -= packet.size;
+			queue->head++;
+		}
+		if (queue->head == queue->packets.count()) {
+			queue->packets.clear();
+			queue->head = 0;
+		} else if (queue->head > queue->packets.count() / 2) {
+			int remaining = queue->packets.count() - queue->head;
+			CF_MEMMOVE(queue->packets.data(), queue->packets.data() + queue->head, sizeof(CF_QueuedPacket) * remaining);
+			queue->packets.set_count(remaining);
+			queue->head = 0;
+		}
+	}
+}
+
+// Runs the queued commands from the game thread, or just frees them when `execute` is false.
+static void s_run_commands(CF_Server* server, bool execute)
+{
+	CF_ServerCommand command;
+	while (cf_spsc_queue_pop(server->commands, &command)) {
+		if (execute) {
+			switch (command.type) {
+			case CF_SERVER_COMMAND_SEND:
+				// The client may have dropped since the game thread last looked.
+				if (cn_server_is_client_connected(server->cn, command.client_index)) {
+					s_cn_send(server->cn, command.data, command.size, command.client_index, command.reliable, command.channel);
+				}
+				break;
+			case CF_SERVER_COMMAND_DISCONNECT:
+				if (cn_server_is_client_connected(server->cn, command.client_index)) {
+					cn_server_disconnect_client(server->cn, command.client_index, command.notify_client);
+				}
+				break;
+			case CF_SERVER_COMMAND_NETWORK_SIMULATOR:
+				cn_server_enable_network_simulator(server->cn, command.simulator[0], command.simulator[1], command.simulator[2], command.simulator[3]);
+				break;
+			}
+		}
+		cf_free(command.data);
+	}
+}
+
+// One round of the I/O thread's work, see `use_io_thread`.
+static void s_io_update(CF_Server* server)
+{
+	s_run_commands(server, true);
+
+	uint64_t ticks = cf_get_ticks();
+	double dt = (double)(ticks - server->io_prev_ticks) / (double)cf_get_tick_frequency();
+	server->io_prev_ticks = ticks;
+	cf_mutex_lock(&server->time_lock);
+	uint64_t current_time = server->current_time;
+	cf_mutex_unlock(&server->time_lock);
+	cn_server_update(server->cn, dt, current_time);
+
+	// When the game thread falls behind an event is held onto, and cn buffers the rest until there's room.
+	CF_ServerEvent* event = &server->io_held_event;
+	while (server->io_holding_event || cn_server_pop_event(server->cn, (cn_server_event_t*)event)) {
+		if (!server->io_holding_event && event->type == CF_SERVER_EVENT_TYPE_PAYLOAD_PACKET) {
+			void* copy = cf_alloc(event->u.payload_packet.size);
+			CF_MEMCPY(copy, event->u.payload_packet.data, event->u.payload_packet.size);
+			cn_server_free_packet(server->cn, event->u.payload_packet.client_index, event->u.payload_packet.data);
+			event->u.payload_packet.data = copy;
+		}
+		server->io_holding_event = !cf_spsc_queue_push(server->events, event);
+		if (server->io_holding_event) break;
+	}
+	cf_mutex_lock(&server->stats_lock);
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		bool connected = cn_server_is_client_connected(server->cn, i);
+		if (connected) server->stats[i] = cn_server_get_stats(server->cn, i);
+		cf_atomic_set(&server->connected[i], connected ? 1 : 0);
+	}
+	cf_mutex_unlock(&server->stats_lock);
+}
+
+static int s_io_thread(void* udata)
+{
+	CF_Server* server = (CF_Server*)udata;
+	while (cf_atomic_get(&server->running)) {
+		s_io_update(server);
+		cf_sleep(1);
+	}
+	return 0;
+}
+
+static int s_host_thread(void* udata)
+{
+	CF_ServerHostThread* thread = (CF_ServerHostThread*)udata;
+	while (cf_atomic_get(&thread->running)) {
+		cf_mutex_lock(&thread->lock);
+		for (int i = 0; i < thread->servers.count(); ++i) {
+			s_io_update(thread->servers[i]);
+		}
+		cf_mutex_unlock(&thread->lock);
+		cf_sleep(1);
+	}
+	return 0;
+}
+
+static void s_start_io_thread(CF_Server* server)
+{
+	server->io_prev_ticks = cf_get_ticks();
+	server->io_holding_event = false;
+	server->io_running = true;
+	if (server->host) {
+		// The least busy thread takes the server.
+		CF_ServerHostThread* best = NULL;
+		int best_count = 0;
+		for (int i = 0; i < server->host->threads.count(); ++i) {
+			CF_ServerHostThread* thread = server->host->threads[i];
+			cf_mutex_lock(&thread->lock);
+			int count = thread->servers.count();
+			cf_mutex_unlock(&thread->lock);
+			if (!best || count < best_count) {
+				best = thread;
+				best_count = count;
+			}
+		}
+		cf_mutex_lock(&best->lock);
+		best->servers.add(server);
+		cf_mutex_unlock(&best->lock);
+		server->host_thread = best;
+	} else {
+		cf_atomic_set(&server->running, 1);
+		server->io_thread = cf_thread_create(s_io_thread, "CF server I/O", server);
+	}
+}
+
+static void s_stop_io_thread(CF_Server* server)
+{
+	if (!s_threaded(server)) return;
+	if (server->host_thread) {
+		// Holding the lock means the host thread is between rounds.
+		CF_ServerHostThread* thread = server->host_thread;
+		cf_mutex_lock(&thread->lock);
+		for (int i = 0; i < thread->servers.count(); ++i) {
+			if (thread->servers[i] == server) {
+				thread->servers.unordered_remove(i);
+				break;
+			}
+		}
+		cf_mutex_unlock(&thread->lock);
+		server->host_thread = NULL;
+	} else {
+		cf_atomic_set(&server->running, 0);
+		cf_thread_wait(server->io_thread);
+		server->io_thread = NULL;
+	}
+	server->io_running = false;
+	if (server->io_holding_event && server->io_held_event.type == CF_SERVER_EVENT_TYPE_PAYLOAD_PACKET) {
+		cf_free(server->io_held_event.u.payload_packet.data);
+	}
+	server->io_holding_event = false;
+	s_run_commands(server, false);
+	CF_ServerEvent event;
+	while (cf_spsc_queue_pop(server->events, &event)) {
+		if (event.type == CF_SERVER_EVENT_TYPE_PAYLOAD_PACKET) cf_free(event.u.payload_packet.data);
+	}
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		cf_atomic_set(&server->connected[i], 0);
+	}
+}
+
+CF_ServerHost* cf_make_server_host(int thread_count)
+{
+	if (thread_count <= 0) thread_count = cf_max(cf_core_count(), 1);
+	CF_ServerHost* host = CF_NEW(CF_ServerHost);
+	for (int i = 0; i < thread_count; ++i) {
+		CF_ServerHostThread* thread = CF_NEW(CF_ServerHostThread);
+		thread->lock = cf_make_mutex();
+		cf_atomic_set(&thread->running, 1);
+		thread->thread = cf_thread_create(s_host_thread, "CF server host I/O", thread);
+		host->threads.add(thread);
+	}
+	return host;
+}
+
+void cf_destroy_server_host(CF_ServerHost* host)
+{
+	for (int i = 0; i < host->threads.count(); ++i) {
+		CF_ServerHostThread* thread = host->threads[i];
+		CF_ASSERT(!thread->servers.count());
+		cf_atomic_set(&thread->running, 0);
+		cf_thread_wait(thread->thread);
+		cf_destroy_mutex(&thread->lock);
+		thread->~CF_ServerHostThread();
+		cf_free(thread);
+	}
+	host->~CF_ServerHost();
+	cf_free(host);
+}
+
 CF_Server* cf_make_server(CF_ServerConfig config)
 {
 	cn_server_config_t cn_config;
@@ -152,56 +623,248 @@ CF_Server* cf_make_server(CF_ServerConfig config)
 	cn_config.public_key = config.public_key;
 	cn_config.secret_key = config.secret_key;
 	cn_config.user_allocator_context = NULL;
-	return cn_server_create(cn_config);
+	cn_server_t* cn = cn_server_create(cn_config);
+	if (!cn) return NULL;
+
+	CF_Server* server = CF_NEW(CF_Server);
+	server->cn = cn;
+	server->max_incoming_bytes_per_second = cf_max(config.max_incoming_bytes_per_second, 0);
+	server->max_outgoing_bytes_per_second = cf_max(config.max_outgoing_bytes_per_second, 0);
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		s_clear_client(server, i);
+	}
+	if (config.use_io_thread || config.host) {
+		server->use_io_thread = true;
+		server->host = config.host;
+		server->commands = cf_make_spsc_queue(CF_SERVER_IO_QUEUE_CAPACITY, sizeof(CF_ServerCommand));
+		server->events = cf_make_spsc_queue(CF_SERVER_IO_QUEUE_CAPACITY, sizeof(CF_ServerEvent));
+		server->time_lock = cf_make_mutex();
+		server->stats_lock = cf_make_mutex();
+	}
+	return server;
 }
 
 void cf_destroy_server(CF_Server* server)
 {
-	cn_server_destroy(server);
+	s_stop_io_thread(server);
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		s_clear_client(server, i);
+	}
+	cn_server_destroy(server->cn);
+	if (server->use_io_thread) {
+		cf_destroy_spsc_queue(server->commands);
+		cf_destroy_spsc_queue(server->events);
+		cf_destroy_mutex(&server->time_lock);
+		cf_destroy_mutex(&server->stats_lock);
+	}
+	server->~CF_Server();
+	cf_free(server);
 }
 
 CF_Result cf_server_start(CF_Server* server, const char* address_and_port)
 {
-	return cf_wrap(cn_server_start(server, address_and_port));
+	CF_ASSERT(!s_threaded(server));
+	CF_Result result = cf_wrap(cn_server_start(server->cn, address_and_port));
+	if (cf_is_error(result) || !server->use_io_thread) return result;
+	s_start_io_thread(server);
+	return result;
 }
 
 void cf_server_stop(CF_Server* server)
 {
-	return cn_server_stop(server);
+	s_stop_io_thread(server);
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		s_clear_client(server, i);
+	}
+	cn_server_stop(server->cn);
 }
 
 CF_STATIC_ASSERT(sizeof(CF_ServerEvent) == sizeof(cn_server_event_t), "Must be equal.");
 
+static bool s_pop_event(CF_Server* server, CF_ServerEvent* event)
+{
+	if (s_threaded(server)) return cf_spsc_queue_pop(server->events, event);
+	return cn_server_pop_event(server->cn, (cn_server_event_t*)event);
+}
+
 bool cf_server_pop_event(CF_Server* server, CF_ServerEvent* event)
 {
-	return cn_server_pop_event(server, (cn_server_event_t*)event);
+	while (s_pop_event(server, event)) {
+		if (event->type != CF_SERVER_EVENT_TYPE_PAYLOAD_PACKET || !server->max_incoming_bytes_per_second) {
+			return true;
+		}
+
+		// Drop payloads from clients flooding past their budget, before they cost any more than this.
+		int client_index = event->u.payload_packet.client_index;
+		CF_ClientBandwidth* client = server->clients + client_index;
+		if (client->incoming_tokens > 0) {
+			client->incoming_tokens -= event->u.payload_packet.size;
+			return true;
+		}
+		s_free_payload(server, client_index, event->u.payload_packet.data);
+	}
+	return false;
 }
 
 void cf_server_free_packet(CF_Server* server, int client_index, void* data)
 {
-	cn_server_free_packet(server, client_index, data);
+	s_free_payload(server, client_index, data);
 }
 
 void cf_server_update(CF_Server* server, double dt, uint64_t current_time)
 {
-	cn_server_update(server, dt, current_time);
+	CF_PROFILE_SCOPE("cf_server_update");
+	CF_ALLOC_TAG_SCOPE("net");
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		if (!s_is_client_connected(server, i)) {
+			s_clear_client(server, i);
+			continue;
+		}
+		if (server->max_outgoing_bytes_per_second) {
+			s_flush_client(server, i, dt);
+		}
+		if (server->max_incoming_bytes_per_second) {
+			CF_ClientBandwidth* client = server->clients + i;
+			double rate = (double)server->max_incoming_bytes_per_second;
+			client->incoming_tokens = cf_min(client->incoming_tokens + rate * dt, rate);
+		}
+	}
+
+	if (s_threaded(server)) {
+		cf_mutex_lock(&server->time_lock);
+		server->current_time = current_time;
+		cf_mutex_unlock(&server->time_lock);
+	} else {
+		cn_server_update(server->cn, dt, current_time);
+	}
 }
 
 void cf_server_disconnect_client(CF_Server* server, int client_index, bool notify_client /* = true */)
 {
-	cn_server_disconnect_client(server, client_index, notify_client);
+	s_clear_client(server, client_index);
+	if (s_threaded(server)) {
+		CF_ServerCommand command = { };
+		command.type = CF_SERVER_COMMAND_DISCONNECT;
+		command.client_index = client_index;
+		command.notify_client = notify_client;
+		s_push_command(server, command);
+		cf_atomic_set(&server->connected[client_index], 0);
+	} else {
+		cn_server_disconnect_client(server->cn, client_index, notify_client);
+	}
 }
 
 void cf_server_send(CF_Server* server, const void* packet, int size, int client_index, bool send_reliably)
 {
-	cn_server_send(server, packet, size, client_index, send_reliably);
+	cf_server_send_with_priority(server, packet, size, client_index, send_reliably, CF_SEND_PRIORITY_NORMAL);
 }
+
+static void s_server_send(CF_Server* server, const void* packet, int size, int client_index, bool send_reliably, int channel, CF_SendPriority priority)
+{
+	CF_ASSERT(priority >= CF_SEND_PRIORITY_LOW && priority <= CF_SEND_PRIORITY_HIGH);
+	CF_ASSERT(channel >= 0 && channel < CF_RELIABLE_CHANNEL_COUNT);
+	if (!server->max_outgoing_bytes_per_second && !s_threaded(server)) {
+		s_cn_send(server->cn, packet, size, client_index, send_reliably, channel);
+		return;
+	}
+
+	CF_ASSERT(s_is_client_connected(server, client_index));
+	void* copy = cf_alloc(size);
+	CF_MEMCPY(copy, packet, size);
+	if (!server->max_outgoing_bytes_per_second) {
+		s_send(server, copy, size, client_index, send_reliably, channel);
+		return;
+	}
+
+	CF_QueuedPacket queued;
+	queued.data = copy;
+	queued.size = size;
+	queued.reliable = send_reliably;
+	queued.channel = channel;
+	CF_ClientBandwidth* client = server->clients + client_index;
+	client->queues[priority].packets.add(queued);
+	client->queued_bytes += size;
+}
+
+void cf_server_send_with_priority(CF_Server* server, const void* packet, int size, int client_index, bool send_reliably, CF_SendPriority priority)
+{
+	s_server_send(server, packet, size, client_index, send_reliably, 0, priority);
+}
+
+void cf_server_send_on_channel(CF_Server* server, const void* packet, int size, int client_index, int channel, CF_SendPriority priority)
+{
+	s_server_send(server, packet, size, client_index, true, channel, priority);
+}
+
+int cf_server_get_queued_bytes(CF_Server* server, int client_index)
+{
+	return server->clients[client_index].queued_bytes;
+}
+
 bool cf_server_is_client_connected(CF_Server* server, int client_index)
 {
-	return cn_server_is_client_connected(server, client_index);
+	return s_is_client_connected(server, client_index);
 }
 
 void cf_server_enable_network_simulator(CF_Server* server, double latency, double jitter, double drop_chance, double duplicate_chance)
 {
-	cn_server_enable_network_simulator(server, latency, jitter, drop_chance, duplicate_chance);
+	if (s_threaded(server)) {
+		CF_ServerCommand command = { };
+		command.type = CF_SERVER_COMMAND_NETWORK_SIMULATOR;
+		command.simulator[0] = latency;
+		command.simulator[1] = jitter;
+		command.simulator[2] = drop_chance;
+		command.simulator[3] = duplicate_chance;
+		s_push_command(server, command);
+	} else {
+		cn_server_enable_network_simulator(server->cn, latency, jitter, drop_chance, duplicate_chance);
+	}
+}
+
+CF_NetworkStats cf_server_get_client_stats(CF_Server* server, int client_index)
+{
+	CF_ASSERT(client_index >= 0 && client_index < CF_SERVER_MAX_CLIENTS);
+	if (!s_is_client_connected(server, client_index)) {
+		CF_NetworkStats stats = { };
+		return stats;
+	}
+	cn_connection_stats_t cn_stats;
+	if (s_threaded(server)) {
+		cf_mutex_lock(&server->stats_lock);
+		cn_stats = server->stats[client_index];
+		cf_mutex_unlock(&server->stats_lock);
+	} else {
+		cn_stats = cn_server_get_stats(server->cn, client_index);
+	}
+	CF_NetworkStats stats = s_wrap_stats(cn_stats);
+	stats.queued_bytes = server->clients[client_index].queued_bytes;
+	return stats;
+}
+
+CF_NetworkStats cf_server_get_stats(CF_Server* server)
+{
+	CF_NetworkStats total = { };
+	int count = 0;
+	for (int i = 0; i < CF_SERVER_MAX_CLIENTS; ++i) {
+		if (!s_is_client_connected(server, i)) continue;
+		CF_NetworkStats stats = cf_server_get_client_stats(server, i);
+		total.rtt += stats.rtt;
+		total.jitter += stats.jitter;
+		total.packet_loss += stats.packet_loss;
+		total.incoming_bytes_per_second += stats.incoming_bytes_per_second;
+		total.outgoing_bytes_per_second += stats.outgoing_bytes_per_second;
+		total.reliable_queue_depth += stats.reliable_queue_depth;
+		total.reassembly_bytes += stats.reassembly_bytes;
+		total.queued_bytes += stats.queued_bytes;
+		total.resend_count += stats.resend_count;
+		total.packets_sent += stats.packets_sent;
+		total.packets_received += stats.packets_received;
+		++count;
+	}
+	if (count) {
+		total.rtt /= count;
+		total.jitter /= count;
+		total.packet_loss /= count;
+	}
+	return total;
 }
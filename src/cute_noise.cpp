@@ -20,6 +20,21 @@
 #include <cute_defines.h>
 #include <cute_c_runtime.h>
 #include <cute_alloc.h>
+#include <cute_multithreading.h>
+#include <cute_hashtable.h>
+#include <cute_doubly_list.h>
+
+#include <internal/cute_app_internal.h>
+
+#include <shaders/noise_shader.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_NOISE_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_NOISE_NEON
+#endif
 
 #define STRETCH_CONSTANT_2D (-0.211324865405187)    /* (1 / sqrt(2 + 1) - 1 ) / 2; */
 #define SQUISH_CONSTANT_2D  (0.366025403784439)     /* (sqrt(2 + 1) -1) / 2; */
@@ -42,6 +57,7 @@ struct osn_context {
 	float falloff;
 	int16_t *perm;
 	int16_t *permGradIndex3D;
+	CF_Texture perm_texture;
 };
 
 #define ARRAYSIZE(x) (sizeof((x)) / sizeof((x)[0]))
@@ -2226,6 +2242,321 @@ double open_simplex_noise4(const struct osn_context *ctx, double x, double y, do
 //--------------------------------------------------------------------------------------------------
 // Wrapper of the above C implementation.
 
+//--------------------------------------------------------------------------------------------------
+// Batched noise, used to fill whole images at once.
+
+// Four floats processed at once.
+#if defined(CF_NOISE_SSE2)
+typedef __m128 f4;
+static CF_INLINE f4 s_load(const float* v) { return _mm_loadu_ps(v); }
+static CF_INLINE void s_store(float* v, f4 a) { _mm_storeu_ps(v, a); }
+static CF_INLINE f4 s_f4(float a, float b, float c, float d) { return _mm_setr_ps(a, b, c, d); }
+static CF_INLINE f4 s_splat(float a) { return _mm_set1_ps(a); }
+static CF_INLINE f4 s_add(f4 a, f4 b) { return _mm_add_ps(a, b); }
+static CF_INLINE f4 s_sub(f4 a, f4 b) { return _mm_sub_ps(a, b); }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+static CF_INLINE f4 s_max(f4 a, f4 b) { return _mm_max_ps(a, b); }
+static CF_INLINE f4 s_floor(f4 a)
+{
+	// Truncate, then step down one for negative numbers with a fraction.
+	f4 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+	return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+}
+static CF_INLINE bool s_any_positive(f4 a) { return _mm_movemask_ps(_mm_cmpgt_ps(a, _mm_setzero_ps())) != 0; }
+#elif defined(CF_NOISE_NEON)
+typedef float32x4_t f4;
+static CF_INLINE f4 s_load(const float* v) { return vld1q_f32(v); }
+static CF_INLINE void s_store(float* v, f4 a) { vst1q_f32(v, a); }
+static CF_INLINE f4 s_f4(float a, float b, float c, float d) { float v[4] = { a, b, c, d }; return vld1q_f32(v); }
+static CF_INLINE f4 s_splat(float a) { return vdupq_n_f32(a); }
+static CF_INLINE f4 s_add(f4 a, f4 b) { return vaddq_f32(a, b); }
+static CF_INLINE f4 s_sub(f4 a, f4 b) { return vsubq_f32(a, b); }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { return vmulq_f32(a, b); }
+static CF_INLINE f4 s_max(f4 a, f4 b) { return vmaxq_f32(a, b); }
+static CF_INLINE f4 s_floor(f4 a) { return vrndmq_f32(a); }
+static CF_INLINE bool s_any_positive(f4 a) { return vmaxvq_f32(a) > 0; }
+#else
+struct f4 { float v[4]; };
+static CF_INLINE f4 s_load(const float* v) { f4 r = { { v[0], v[1], v[2], v[3] } }; return r; }
+static CF_INLINE void s_store(float* v, f4 a) { for (int i = 0; i < 4; ++i) v[i] = a.v[i]; }
+static CF_INLINE f4 s_f4(float a, float b, float c, float d) { f4 r = { { a, b, c, d } }; return r; }
+static CF_INLINE f4 s_splat(float a) { return s_f4(a, a, a, a); }
+#define CF_F4_OP(name, expr) static CF_INLINE f4 name(f4 a, f4 b) { f4 r; for (int i = 0; i < 4; ++i) { float x = a.v[i], y = b.v[i]; r.v[i] = (expr); } return r; }
+CF_F4_OP(s_add, x + y)
+CF_F4_OP(s_sub, x - y)
+CF_F4_OP(s_mul, x * y)
+CF_F4_OP(s_max, x > y ? x : y)
+#undef CF_F4_OP
+static CF_INLINE f4 s_floor(f4 a) { f4 r; for (int i = 0; i < 4; ++i) r.v[i] = CF_FLOORF(a.v[i]); return r; }
+static CF_INLINE bool s_any_positive(f4 a) { return a.v[0] > 0 || a.v[1] > 0 || a.v[2] > 0 || a.v[3] > 0; }
+#endif
+
+// Every lattice point `open_simplex_noise2` can pick, relative to the rhombus origin. Points out of reach
+// have a zero attenuation, so summing over all of them matches the branchy version without branches.
+static const int s_noise2_lattice[8][2] = {
+	{ 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, -1 }, { -1, 1 }, { 2, 0 }, { 0, 2 },
+};
+
+// Four samples of `open_simplex_noise2` at once, in floats.
+static f4 s_noise2_f4(const osn_context* ctx, f4 x, f4 y)
+{
+	const int16_t* perm = ctx->perm;
+	f4 stretch = s_mul(s_add(x, y), s_splat((float)STRETCH_CONSTANT_2D));
+	f4 xsb = s_floor(s_add(x, stretch));
+	f4 ysb = s_floor(s_add(y, stretch));
+	f4 squish = s_mul(s_add(xsb, ysb), s_splat((float)SQUISH_CONSTANT_2D));
+	f4 dx0 = s_sub(x, s_add(xsb, squish));
+	f4 dy0 = s_sub(y, s_add(ysb, squish));
+	float xsb_lanes[4], ysb_lanes[4];
+	s_store(xsb_lanes, xsb);
+	s_store(ysb_lanes, ysb);
+	int xi[4], yi[4];
+	for (int i = 0; i < 4; ++i) {
+		xi[i] = (int)xsb_lanes[i];
+		yi[i] = (int)ysb_lanes[i];
+	}
+	bool shared = xi[0] == xi[1] && xi[0] == xi[2] && xi[0] == xi[3] && yi[0] == yi[1] && yi[0] == yi[2] && yi[0] == yi[3];
+	f4 value = s_splat(0);
+	for (int k = 0; k < 8; ++k) {
+		int ox = s_noise2_lattice[k][0];
+		int oy = s_noise2_lattice[k][1];
+		float squish_k = (float)((ox + oy) * SQUISH_CONSTANT_2D);
+		f4 dx = s_sub(dx0, s_splat(ox + squish_k));
+		f4 dy = s_sub(dy0, s_splat(oy + squish_k));
+		f4 attn = s_sub(s_splat(2.0f), s_add(s_mul(dx, dx), s_mul(dy, dy)));
+		if (!s_any_positive(attn)) continue; // Neighboring samples usually share their lattice points.
+		attn = s_max(attn, s_splat(0));
+		attn = s_mul(attn, attn);
+		attn = s_mul(attn, attn);
+		f4 gx, gy;
+		if (shared) {
+			// All four samples sit in the same rhombus, so they share the gradient.
+			int g = perm[(perm[(xi[0] + ox) & 0xFF] + yi[0] + oy) & 0xFF] & 0x0E;
+			gx = s_splat(gradients2D[g]);
+			gy = s_splat(gradients2D[g + 1]);
+		} else {
+			int g[4];
+			for (int i = 0; i < 4; ++i) {
+				g[i] = perm[(perm[(xi[i] + ox) & 0xFF] + yi[i] + oy) & 0xFF] & 0x0E;
+			}
+			gx = s_f4(gradients2D[g[0]], gradients2D[g[1]], gradients2D[g[2]], gradients2D[g[3]]);
+			gy = s_f4(gradients2D[g[0] + 1], gradients2D[g[1] + 1], gradients2D[g[2] + 1], gradients2D[g[3] + 1]);
+		}
+		value = s_add(value, s_mul(attn, s_add(s_mul(gx, dx), s_mul(gy, dy))));
+	}
+	return s_mul(value, s_splat((float)(1.0 / NORM_CONSTANT_2D)));
+}
+
+// Same as `cf_noise2`, four samples at a time, including the octaves of fractal brownian motion.
+static f4 s_noise2_fbm_f4(const osn_context* ctx, f4 x, f4 y)
+{
+	if (!ctx->fbm) return s_noise2_f4(ctx, x, y);
+	float scale = ctx->scale;
+	float amplitude = 1.0f;
+	float div = 0;
+	f4 sum = s_splat(0);
+	for (int i = 0; i < ctx->octaves; i++) {
+		f4 s = s_splat(scale);
+		sum = s_add(sum, s_mul(s_noise2_f4(ctx, s_mul(x, s), s_mul(y, s)), s_splat(amplitude)));
+		scale *= ctx->lacunarity;
+		div += amplitude;
+		amplitude *= ctx->falloff;
+	}
+	return s_mul(sum, s_splat(1.0f / div));
+}
+
+// Rows handed out to each task when filling across a threadpool.
+#define CF_NOISE_ROWS_PER_TASK 16
+
+struct CF_NoiseFill
+{
+	const osn_context* ctx;
+	float* values;
+	int w, h;
+	int row_begin, row_end;
+
+	// For `cf_noise_fill`.
+	float x, y, step;
+
+	// For `cf_noise_fill_wrapped`, the per-column terms are shared by every row.
+	const float* column_sin;
+	const float* column_cos;
+	float scale, st, ct;
+};
+
+static void s_fill_rows(void* param)
+{
+	CF_NoiseFill* fill = (CF_NoiseFill*)param;
+	f4 lane_offsets = s_f4(0, 1, 2, 3);
+	f4 step = s_splat(fill->step);
+	for (int row = fill->row_begin; row < fill->row_end; ++row) {
+		float* out = fill->values + row * fill->w;
+		f4 y = s_splat(fill->y + row * fill->step);
+		int x = 0;
+		for (; x + 4 <= fill->w; x += 4) {
+			f4 px = s_add(s_splat(fill->x), s_mul(s_add(s_splat((float)x), lane_offsets), step));
+			s_store(out + x, s_noise2_fbm_f4(fill->ctx, px, y));
+		}
+		if (x < fill->w) {
+			float tail[4];
+			f4 px = s_add(s_splat(fill->x), s_mul(s_add(s_splat((float)x), lane_offsets), step));
+			s_store(tail, s_noise2_fbm_f4(fill->ctx, px, y));
+			for (int i = 0; x + i < fill->w; ++i) out[x + i] = tail[i];
+		}
+	}
+}
+
+static void s_fill_rows_wrapped(void* param)
+{
+	CF_NoiseFill* fill = (CF_NoiseFill*)param;
+	CF_Noise noise = { (uint64_t)fill->ctx };
+	int dim = fill->w < fill->h ? fill->w : fill->h;
+	float scale = fill->scale;
+	for (int row = fill->row_begin; row < fill->row_end; ++row) {
+		float* out = fill->values + row * fill->w;
+		float ny = ((float)row/(float)dim-0.5f);
+		float sy = sinf(ny*CF_TAU)/CF_TAU;
+		float cy = cosf(ny*CF_TAU)/CF_TAU;
+		for (int x = 0; x < fill->w; ++x) {
+			float sx = fill->column_sin[x];
+			float cx = fill->column_cos[x];
+			out[x] = cf_noise4(noise, cx*scale+fill->ct, cy*scale+fill->ct, sx*scale+fill->st, sy*scale+fill->st);
+		}
+	}
+}
+
+// Splits the rows of `fill` into tasks, spread across `pool` if there is one and the image is big enough to be worth it.
+static void s_fill(CF_NoiseFill fill, CF_TaskFn* fn, CF_Threadpool* pool)
+{
+	int task_count = (fill.h + CF_NOISE_ROWS_PER_TASK - 1) / CF_NOISE_ROWS_PER_TASK;
+	if (!pool || task_count < 2) {
+		fill.row_begin = 0;
+		fill.row_end = fill.h;
+		fn(&fill);
+		return;
+	}
+	CF_NoiseFill* tasks = (CF_NoiseFill*)cf_alloc(sizeof(CF_NoiseFill) * task_count);
+	CF_AtomicInt counter = { 0 };
+	for (int i = 0; i < task_count; ++i) {
+		tasks[i] = fill;
+		tasks[i].row_begin = i * CF_NOISE_ROWS_PER_TASK;
+		tasks[i].row_end = cf_min(tasks[i].row_begin + CF_NOISE_ROWS_PER_TASK, fill.h);
+		cf_threadpool_add_dependent_task(pool, fn, tasks + i, NULL, 0, &counter);
+	}
+	cf_threadpool_kick(pool);
+	cf_threadpool_wait_counter(pool, &counter);
+	cf_free(tasks);
+}
+
+void cf_noise_fill(CF_Noise noise, float* values, int w, int h, float x, float y, float step, CF_Threadpool* pool)
+{
+	CF_NoiseFill fill = { };
+	fill.ctx = (const osn_context*)noise.id;
+	fill.values = values;
+	fill.w = w;
+	fill.h = h;
+	fill.x = x;
+	fill.y = y;
+	fill.step = step;
+	s_fill(fill, s_fill_rows, pool);
+}
+
+void cf_noise_fill_wrapped(CF_Noise noise, float* values, int w, int h, float scale, float time, float time_amplitude, CF_Threadpool* pool)
+{
+	// The columns map around a circle the same way for every row, so only do the trig once per column.
+	int dim = w < h ? w : h;
+	float* columns = (float*)cf_alloc(sizeof(float) * w * 2);
+	for (int x = 0; x < w; ++x) {
+		float nx = ((float)x/(float)dim-0.5f);
+		columns[x] = sinf(nx*CF_TAU)/CF_TAU;
+		columns[w + x] = cosf(nx*CF_TAU)/CF_TAU;
+	}
+	CF_NoiseFill fill = { };
+	fill.ctx = (const osn_context*)noise.id;
+	fill.values = values;
+	fill.w = w;
+	fill.h = h;
+	fill.column_sin = columns;
+	fill.column_cos = columns + w;
+	fill.scale = scale;
+	fill.st = sinf(time*CF_TAU)*time_amplitude;
+	fill.ct = cosf(time*CF_TAU)*time_amplitude;
+	s_fill(fill, s_fill_rows_wrapped, pool);
+	cf_free(columns);
+}
+
+void cf_noise_render_to(CF_Noise noise, CF_Canvas canvas, float x, float y, float step)
+{
+	osn_context* ctx = (osn_context*)noise.id;
+
+	if (!app->noise_shader_init) {
+		app->noise_shader_init = true;
+		app->noise_material = cf_make_material();
+		app->noise_shader = CF_MAKE_SOKOL_SHADER(noise_shd);
+	}
+
+	// The shader looks up gradients through the same permutation table as the CPU, one entry per texel.
+	if (!ctx->perm_texture.id) {
+		CF_Pixel pix[256];
+		for (int i = 0; i < 256; ++i) {
+			pix[i].val = 0;
+			pix[i].colors.r = (uint8_t)ctx->perm[i];
+		}
+		CF_TextureParams params = cf_texture_defaults(256, 1);
+		params.initial_data = pix;
+		params.initial_data_size = sizeof(pix);
+		ctx->perm_texture = cf_make_texture(params);
+	}
+
+	sg_image target = { (uint32_t)cf_canvas_get_backend_target_handle(canvas) };
+	sg_image_desc desc = sg_query_image_desc(target);
+	CF_V2 texture_size = cf_v2((float)desc.width, (float)desc.height);
+	CF_V2 origin = cf_v2(x, y);
+
+	// Plain noise is a single octave at unit scale.
+	float scale = ctx->fbm ? ctx->scale : 1.0f;
+	float lacunarity = ctx->fbm ? ctx->lacunarity : 1.0f;
+	float falloff = ctx->fbm ? ctx->falloff : 1.0f;
+	float octaves = ctx->fbm ? (float)ctx->octaves : 1.0f;
+
+	CF_Material material = app->noise_material;
+	cf_material_set_texture_fs(material, "u_perm", ctx->perm_texture);
+	cf_material_set_uniform_fs(material, "fs_params", "u_texture_size", &texture_size, CF_UNIFORM_TYPE_FLOAT2, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_origin", &origin, CF_UNIFORM_TYPE_FLOAT2, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_step", &step, CF_UNIFORM_TYPE_FLOAT, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_scale", &scale, CF_UNIFORM_TYPE_FLOAT, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_lacunarity", &lacunarity, CF_UNIFORM_TYPE_FLOAT, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_falloff", &falloff, CF_UNIFORM_TYPE_FLOAT, 1);
+	cf_material_set_uniform_fs(material, "fs_params", "u_octaves", &octaves, CF_UNIFORM_TYPE_FLOAT, 1);
+
+	// Every pixel is overwritten, so there's no need to clear.
+	cf_apply_canvas(canvas, false);
+	cf_apply_mesh(app->backbuffer_quad);
+	cf_apply_shader(app->noise_shader, material);
+	cf_draw_elements();
+}
+
+// Noise in [-1,1] is written over the pixels in place, then converted to grayscale. A float and a pixel are the same size.
+CF_STATIC_ASSERT(sizeof(CF_Pixel) == sizeof(float), "Must be equal.");
+
+static void s_floats_to_pixels(CF_Pixel* pix, int count)
+{
+	for (int i = 0; i < count; ++i) {
+		float n;
+		CF_MEMCPY(&n, pix + i, sizeof(n));
+		float v = (n + 1.0f) * 0.5f;
+		CF_Pixel p;
+		p.colors.r = p.colors.g = p.colors.b = (uint8_t)(v * 255.0f);
+		p.colors.a = 0xFF;
+		pix[i] = p;
+	}
+}
+
+static CF_Threadpool* s_pool()
+{
+	return app ? app->threadpool : NULL;
+}
+
 CF_Noise cf_make_noise(uint64_t seed)
 {
 	osn_context* ctx = open_simplex_noise(seed);
@@ -2248,6 +2579,7 @@ CF_Noise cf_make_noise_fbm(uint64_t seed, float scale, float lacunarity, int oct
 void cf_destroy_noise(CF_Noise noise)
 {
 	osn_context* ctx = (osn_context*)noise.id;
+	if (ctx->perm_texture.id) cf_destroy_texture(ctx->perm_texture);
 	open_simplex_noise_free(ctx);
 }
 
@@ -2321,19 +2653,9 @@ CF_Pixel* cf_noise_pixels(int w, int h, uint64_t seed, float scale)
 {
 	CF_Noise noise = cf_make_noise(seed);
 	CF_Pixel* pix = (CF_Pixel*)cf_alloc(sizeof(CF_Pixel) * w * h);
-	CF_Pixel* ptr = pix;
-	CF_Pixel p;
-	p.colors.a = 0xFF;
 	int dim = w < h ? w : h;
-	for (int y = 0; y < h; ++y) {
-		float ny = ((float)y/(float)dim-0.5f)*scale;
-		for (int x = 0; x < w; ++x) {
-			float nx = ((float)x/(float)dim-0.5f)*scale;
-			float v = (cf_noise2(noise, nx, ny) + 1.0f) * 0.5f;
-			p.colors.r = p.colors.g = p.colors.b = (uint8_t)(v * 255.0f);
-			*ptr++ = p;
-		}
-	}
+	cf_noise_fill(noise, (float*)pix, w, h, -0.5f*scale, -0.5f*scale, scale/(float)dim, s_pool());
+	s_floats_to_pixels(pix, w * h);
 	cf_destroy_noise(noise);
 	return pix;
 }
@@ -2342,25 +2664,8 @@ CF_Pixel* cf_noise_pixels_wrapped(int w, int h, uint64_t seed, float scale, floa
 {
 	CF_Noise noise = cf_make_noise(seed);
 	CF_Pixel* pix = (CF_Pixel*)cf_alloc(sizeof(CF_Pixel) * w * h);
-	CF_Pixel* ptr = pix;
-	CF_Pixel p;
-	p.colors.a = 0xFF;
-	int dim = w < h ? w : h;
-	float st = sinf(time*CF_TAU)*time_amplitude;
-	float ct = cosf(time*CF_TAU)*time_amplitude;
-	for (int y = 0; y < h; ++y) {
-		float ny = ((float)y/(float)dim-0.5f);
-		float sy = sinf(ny*CF_TAU)/CF_TAU;
-		float cy = cosf(ny*CF_TAU)/CF_TAU;
-		for (int x = 0; x < w; ++x) {
-			float nx = ((float)x/(float)dim-0.5f);
-			float sx = sinf(nx*CF_TAU)/CF_TAU;
-			float cx = cosf(nx*CF_TAU)/CF_TAU;
-			float v = (cf_noise4(noise, cx*scale+ct, cy*scale+ct, sx*scale+st, sy*scale+st) + 1.0f) * 0.5f;
-			p.colors.r = p.colors.g = p.colors.b = (uint8_t)(v * 255.0f);
-			*ptr++ = p;
-		}
-	}
+	cf_noise_fill_wrapped(noise, (float*)pix, w, h, scale, time, time_amplitude, s_pool());
+	s_floats_to_pixels(pix, w * h);
 	cf_destroy_noise(noise);
 	return pix;
 }
@@ -2369,19 +2674,9 @@ CF_Pixel* cf_noise_fbm_pixels(int w, int h, uint64_t seed, float scale, float la
 {
 	CF_Noise noise = cf_make_noise_fbm(seed, scale, lacunarity, octaves, falloff);
 	CF_Pixel* pix = (CF_Pixel*)cf_alloc(sizeof(CF_Pixel) * w * h);
-	CF_Pixel* ptr = pix;
-	CF_Pixel p;
-	p.colors.a = 0xFF;
 	int dim = w < h ? w : h;
-	for (int y = 0; y < h; ++y) {
-		float ny = ((float)y/(float)dim-0.5f);
-		for (int x = 0; x < w; ++x) {
-			float nx = ((float)x/(float)dim-0.5f);
-			float v = (cf_noise2(noise, nx, ny) + 1.0f) * 0.5f;
-			p.colors.r = p.colors.g = p.colors.b = (uint8_t)(v * 255.0f);
-			*ptr++ = p;
-		}
-	}
+	cf_noise_fill(noise, (float*)pix, w, h, -0.5f, -0.5f, 1.0f/(float)dim, s_pool());
+	s_floats_to_pixels(pix, w * h);
 	cf_destroy_noise(noise);
 	return pix;
 }
@@ -2390,25 +2685,194 @@ CF_Pixel* cf_noise_fbm_pixels_wrapped(int w, int h, uint64_t seed, float scale,
 {
 	CF_Noise noise = cf_make_noise_fbm(seed, scale, lacunarity, octaves, falloff);
 	CF_Pixel* pix = (CF_Pixel*)cf_alloc(sizeof(CF_Pixel) * w * h);
-	CF_Pixel* ptr = pix;
-	CF_Pixel p;
-	p.colors.a = 0xFF;
-	int dim = w < h ? w : h;
-	float st = sinf(time*CF_TAU)*time_amplitude;
-	float ct = cosf(time*CF_TAU)*time_amplitude;
-	for (int y = 0; y < h; ++y) {
-		float ny = ((float)y/(float)dim-0.5f);
-		float sy = sinf(ny*CF_TAU)/CF_TAU;
-		float cy = cosf(ny*CF_TAU)/CF_TAU;
-		for (int x = 0; x < w; ++x) {
-			float nx = ((float)x/(float)dim-0.5f);
-			float sx = sinf(nx*CF_TAU)/CF_TAU;
-			float cx = cosf(nx*CF_TAU)/CF_TAU;
-			float v = (cf_noise4(noise, cx*scale+ct, cy*scale+ct, sx*scale+st, sy*scale+st) + 1.0f) * 0.5f;
-			p.colors.r = p.colors.g = p.colors.b = (uint8_t)(v * 255.0f);
-			*ptr++ = p;
-		}
-	}
+	cf_noise_fill_wrapped(noise, (float*)pix, w, h, scale, time, time_amplitude, s_pool());
+	s_floats_to_pixels(pix, w * h);
 	cf_destroy_noise(noise);
 	return pix;
 }
+
+//--------------------------------------------------------------------------------------------------
+// Tiled noise cache.
+
+using namespace Cute;
+
+struct CF_NoiseTile
+{
+	CF_ListNode node;
+	int tx, ty;
+	CF_AtomicInt counter; // Non-zero while a worker is still filling `values`.
+	float* values;        // (tile_size + 1)^2 samples, sharing the last row and column with the neighboring tiles.
+	struct CF_NoiseCacheInternal* cache;
+};
+
+struct CF_NoiseCacheInternal
+{
+	CF_Noise noise;
+	int tile_size;
+	float step;
+	int max_tiles;
+	CF_Threadpool* pool;
+	Map<uint64_t, CF_NoiseTile*> tiles;
+	CF_List lru; // Most recently used at the front.
+};
+
+static CF_INLINE uint64_t s_tile_key(int tx, int ty)
+{
+	return ((uint64_t)(uint32_t)tx << 32) | (uint64_t)(uint32_t)ty;
+}
+
+static CF_INLINE int s_floor_div(int a, int b)
+{
+	return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+static void s_tile_fill(void* param)
+{
+	CF_NoiseTile* tile = (CF_NoiseTile*)param;
+	CF_NoiseCacheInternal* cache = tile->cache;
+	int n = cache->tile_size;
+	cf_noise_fill(cache->noise, tile->values, n + 1, n + 1, (float)(tile->tx * n) * cache->step, (float)(tile->ty * n) * cache->step, cache->step, NULL);
+}
+
+static void s_tile_free(CF_NoiseCacheInternal* cache, CF_NoiseTile* tile)
+{
+	if (cf_atomic_get(&tile->counter)) cf_threadpool_wait_counter(cache->pool, &tile->counter);
+	cf_list_remove(&tile->node);
+	cache->tiles.remove(s_tile_key(tile->tx, tile->ty));
+	cf_free(tile);
+}
+
+// Evicts least recently used tiles down to the budget. Tiles still being filled are skipped rather than waited on.
+static void s_evict(CF_NoiseCacheInternal* cache)
+{
+	CF_ListNode* node = cf_list_back(&cache->lru);
+	while (cache->tiles.count() > cache->max_tiles && node != cf_list_end(&cache->lru)) {
+		CF_ListNode* prev = node->prev;
+		CF_NoiseTile* tile = CF_LIST_HOST(CF_NoiseTile, node, node);
+		if (!cf_atomic_get(&tile->counter)) s_tile_free(cache, tile);
+		node = prev;
+	}
+}
+
+// Returns the tile, marking it most recently used. Missing tiles are created, and filled on a worker when `async` is set.
+static CF_NoiseTile* s_tile(CF_NoiseCacheInternal* cache, int tx, int ty, bool async)
+{
+	CF_NoiseTile** found = cache->tiles.try_get(s_tile_key(tx, ty));
+	if (found) {
+		CF_NoiseTile* tile = *found;
+		cf_list_remove(&tile->node);
+		cf_list_push_front(&cache->lru, &tile->node);
+		return tile;
+	}
+	int n = cache->tile_size + 1;
+	CF_NoiseTile* tile = (CF_NoiseTile*)cf_alloc(sizeof(CF_NoiseTile) + sizeof(float) * n * n);
+	cf_list_init_node(&tile->node);
+	tile->tx = tx;
+	tile->ty = ty;
+	tile->counter = cf_atomic_zero();
+	tile->values = (float*)(tile + 1);
+	tile->cache = cache;
+	cache->tiles.insert(s_tile_key(tx, ty), tile);
+	cf_list_push_front(&cache->lru, &tile->node);
+	if (async && cache->pool) {
+		cf_threadpool_add_dependent_task(cache->pool, s_tile_fill, tile, NULL, 0, &tile->counter);
+	} else {
+		s_tile_fill(tile);
+	}
+	s_evict(cache);
+	return tile;
+}
+
+static const float* s_tile_values(CF_NoiseCacheInternal* cache, int tx, int ty)
+{
+	CF_NoiseTile* tile = s_tile(cache, tx, ty, false);
+	if (cf_atomic_get(&tile->counter)) {
+		cf_threadpool_kick(cache->pool);
+		cf_threadpool_wait_counter(cache->pool, &tile->counter);
+	}
+	return tile->values;
+}
+
+CF_NoiseCache cf_make_noise_cache(CF_Noise noise, int tile_size, float step, int max_tiles, CF_Threadpool* pool)
+{
+	CF_NoiseCacheInternal* cache = CF_NEW(CF_NoiseCacheInternal);
+	cache->noise = noise;
+	cache->tile_size = tile_size;
+	cache->step = step;
+	cache->max_tiles = cf_max(max_tiles, 1);
+	cache->pool = pool;
+	cf_list_init(&cache->lru);
+	CF_NoiseCache result = { (uint64_t)cache };
+	return result;
+}
+
+void cf_destroy_noise_cache(CF_NoiseCache cache_handle)
+{
+	CF_NoiseCacheInternal* cache = (CF_NoiseCacheInternal*)cache_handle.id;
+	while (!cf_list_empty(&cache->lru)) {
+		s_tile_free(cache, CF_LIST_HOST(CF_NoiseTile, node, cf_list_back(&cache->lru)));
+	}
+	cache->~CF_NoiseCacheInternal();
+	cf_free(cache);
+}
+
+const float* cf_noise_cache_get_tile(CF_NoiseCache cache_handle, int tile_x, int tile_y)
+{
+	CF_NoiseCacheInternal* cache = (CF_NoiseCacheInternal*)cache_handle.id;
+	return s_tile_values(cache, tile_x, tile_y);
+}
+
+float cf_noise_cache_sample(CF_NoiseCache cache_handle, float x, float y)
+{
+	CF_NoiseCacheInternal* cache = (CF_NoiseCacheInternal*)cache_handle.id;
+	int n = cache->tile_size;
+	float gx = x / cache->step;
+	float gy = y / cache->step;
+	float fx = CF_FLOORF(gx);
+	float fy = CF_FLOORF(gy);
+	int ix = (int)fx;
+	int iy = (int)fy;
+	int tx = s_floor_div(ix, n);
+	int ty = s_floor_div(iy, n);
+	const float* values = s_tile_values(cache, tx, ty);
+
+	// The tile stores one extra row and column, so all four corners come from the same tile.
+	int stride = n + 1;
+	const float* p = values + (iy - ty * n) * stride + (ix - tx * n);
+	float u = gx - fx;
+	float v = gy - fy;
+	float top = p[0] + (p[1] - p[0]) * u;
+	float bottom = p[stride] + (p[stride + 1] - p[stride]) * u;
+	return top + (bottom - top) * v;
+}
+
+void cf_noise_cache_prefetch(CF_NoiseCache cache_handle, float x, float y, float radius)
+{
+	CF_NoiseCacheInternal* cache = (CF_NoiseCacheInternal*)cache_handle.id;
+	float tile_extent = cache->tile_size * cache->step;
+	int tx0 = (int)CF_FLOORF((x - radius) / tile_extent);
+	int ty0 = (int)CF_FLOORF((y - radius) / tile_extent);
+	int tx1 = (int)CF_FLOORF((x + radius) / tile_extent);
+	int ty1 = (int)CF_FLOORF((y + radius) / tile_extent);
+	int cx = (int)CF_FLOORF(x / tile_extent);
+	int cy = (int)CF_FLOORF(y / tile_extent);
+
+	// Queue rings outward from the focus so the closest tiles are filled first, then touch them again from the outside in so
+	// the closest tiles end up at the front of the LRU.
+	int rings = cf_max(cf_max(cx - tx0, tx1 - cx), cf_max(cy - ty0, ty1 - cy));
+	for (int pass = 0; pass < 2; ++pass) {
+		for (int i = 0; i <= rings; ++i) {
+			int r = pass == 0 ? i : rings - i;
+			for (int ty = cy - r; ty <= cy + r; ++ty) {
+				for (int tx = cx - r; tx <= cx + r; ++tx) {
+					int dx = tx < cx ? cx - tx : tx - cx;
+					int dy = ty < cy ? cy - ty : ty - cy;
+					if (cf_max(dx, dy) != r) continue;
+					if (tx < tx0 || tx > tx1 || ty < ty0 || ty > ty1) continue;
+					s_tile(cache, tx, ty, true);
+				}
+			}
+		}
+	}
+	if (cache->pool) cf_threadpool_kick(cache->pool);
+}
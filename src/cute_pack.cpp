@@ -0,0 +1,701 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_file_system.h>
+#include <cute_alloc.h>
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_file_system_internal.h>
+
+#include <physfs/physfs.h>
+
+using namespace Cute;
+
+// A pack is laid out as:
+//
+//     CF_PackHeader
+//     uint32_t buckets[bucket_count]    Open addressed hash table of entry index + 1, zero for empty.
+//     CF_PackEntry entries[entry_count]
+//     char names[names_size]            Nul-terminated paths within the pack, such as "images/tree.png".
+//     Entry data.
+//
+// Looking up a path hashes it and probes the buckets, so opening a file costs the same in a pack of ten
+// files or ten thousand, and mounting a pack is a single read of everything before the entry data.
+
+#define CF_PACK_VERSION 1
+#define CF_PACK_PAGE_SIZE 4096
+#define CF_PACK_ALIGNMENT 16
+#define CF_PACK_ENTRY_DIRECTORY 1
+#define CF_PACK_COMPRESSION_NONE 0
+#define CF_PACK_COMPRESSION_LZ4 1
+
+struct CF_PackHeader
+{
+	char magic[4];
+	uint32_t version;
+	uint32_t entry_count;
+	uint32_t bucket_count;
+	uint64_t names_offset;
+	uint64_t names_size;
+};
+
+struct CF_PackEntry
+{
+	uint64_t hash;
+	uint64_t offset;
+	uint64_t size;
+	uint64_t stored_size;
+	uint32_t name_offset;
+	uint32_t name_len;
+	uint32_t flags;
+	uint32_t compression;
+};
+
+static uint64_t s_hash(const char* path, size_t len)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for (size_t i = 0; i < len; ++i) {
+		h = (h ^ (uint8_t)path[i]) * 1099511628211ULL;
+	}
+	return h;
+}
+
+static size_t s_align(size_t offset, size_t alignment)
+{
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+// Bounds of the directory, the part of the pack before any entry data.
+static size_t s_directory_size(const CF_PackHeader* header)
+{
+	return (size_t)header->names_offset + (size_t)header->names_size;
+}
+
+static bool s_header_is_valid(const CF_PackHeader* header, uint64_t pack_size)
+{
+	if (CF_MEMCMP(header->magic, "CFPK", 4) || header->version != CF_PACK_VERSION) return false;
+	uint32_t bucket_count = header->bucket_count;
+	if (!bucket_count || (bucket_count & (bucket_count - 1)) || bucket_count <= header->entry_count) return false;
+	uint64_t names_offset = sizeof(CF_PackHeader) + (uint64_t)bucket_count * sizeof(uint32_t) + (uint64_t)header->entry_count * sizeof(CF_PackEntry);
+	if (header->names_offset != names_offset) return false;
+	if (header->names_size > pack_size || names_offset > pack_size - header->names_size) return false;
+	return true;
+}
+
+static const CF_PackEntry* s_find(const CF_PackHeader* header, const char* path, size_t len)
+{
+	const uint32_t* buckets = (const uint32_t*)(header + 1);
+	const CF_PackEntry* entries = (const CF_PackEntry*)(buckets + header->bucket_count);
+	const char* names = (const char*)header + header->names_offset;
+	uint64_t hash = s_hash(path, len);
+	uint32_t mask = header->bucket_count - 1;
+	for (uint32_t i = 0, index = (uint32_t)hash & mask; i < header->bucket_count; ++i, index = (index + 1) & mask) {
+		uint32_t bucket = buckets[index];
+		if (!bucket) return NULL;
+		if (bucket > header->entry_count) return NULL;
+		const CF_PackEntry* entry = entries + bucket - 1;
+		if (entry->hash != hash || entry->name_len != len) continue;
+		if ((uint64_t)entry->name_offset + len >= header->names_size) return NULL;
+		if (!CF_MEMCMP(names + entry->name_offset, path, len)) return entry;
+	}
+	return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------
+// LZ4 block format, the same bytes the reference LZ4 library reads and writes.
+
+#define CF_LZ4_MIN_MATCH 4
+#define CF_LZ4_MF_LIMIT 12
+#define CF_LZ4_LAST_LITERALS 5
+#define CF_LZ4_HASH_BITS 14
+#define CF_LZ4_MAX_OFFSET 65535
+
+size_t cf_lz4_bound(size_t size)
+{
+	return size + size / 255 + 16;
+}
+
+static CF_INLINE uint32_t s_read32(const uint8_t* p)
+{
+	uint32_t v;
+	CF_MEMCPY(&v, p, sizeof(v));
+	return v;
+}
+
+static uint8_t* s_lz4_write_length(uint8_t* op, size_t len)
+{
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+	*op++ = (uint8_t)len;
+	return op;
+}
+
+static uint8_t* s_lz4_write_sequence(uint8_t* op, const uint8_t* literals, size_t literal_len, size_t offset, size_t match_len)
+{
+	uint8_t* token = op++;
+	*token = (uint8_t)((literal_len < 15 ? literal_len : 15) << 4);
+	if (literal_len >= 15) op = s_lz4_write_length(op, literal_len - 15);
+	CF_MEMCPY(op, literals, literal_len);
+	op += literal_len;
+	if (!match_len) return op;
+	*op++ = (uint8_t)offset;
+	*op++ = (uint8_t)(offset >> 8);
+	match_len -= CF_LZ4_MIN_MATCH;
+	*token |= (uint8_t)(match_len < 15 ? match_len : 15);
+	if (match_len >= 15) op = s_lz4_write_length(op, match_len - 15);
+	return op;
+}
+
+// Greedy single-probe compressor. `dst` must hold `cf_lz4_bound(size)` bytes.
+size_t cf_lz4_compress(const uint8_t* src, size_t size, uint8_t* dst)
+{
+	uint8_t* op = dst;
+	size_t anchor = 0;
+	if (size > CF_LZ4_MF_LIMIT) {
+		uint32_t* table = (uint32_t*)CF_ALLOC(sizeof(uint32_t) << CF_LZ4_HASH_BITS);
+		CF_MEMSET(table, 0, sizeof(uint32_t) << CF_LZ4_HASH_BITS);
+		size_t match_limit = size - CF_LZ4_LAST_LITERALS;
+		size_t ip = 0;
+		while (ip < size - CF_LZ4_MF_LIMIT) {
+			uint32_t sequence = s_read32(src + ip);
+			uint32_t h = (sequence * 2654435761U) >> (32 - CF_LZ4_HASH_BITS);
+			size_t ref = table[h];
+			table[h] = (uint32_t)(ip + 1);
+			if (ref && ip - (ref - 1) <= CF_LZ4_MAX_OFFSET && s_read32(src + ref - 1) == sequence) {
+				ref -= 1;
+				size_t len = CF_LZ4_MIN_MATCH;
+				while (ip + len < match_limit && src[ref + len] == src[ip + len]) ++len;
+				op = s_lz4_write_sequence(op, src + anchor, ip - anchor, ip - ref, len);
+				ip += len;
+				anchor = ip;
+			} else {
+				++ip;
+			}
+		}
+		CF_FREE(table);
+	}
+	op = s_lz4_write_sequence(op, src + anchor, size - anchor, 0, 0);
+	return (size_t)(op - dst);
+}
+
+static bool s_lz4_read_length(const uint8_t** ip, const uint8_t* end, size_t* len)
+{
+	uint8_t b;
+	do {
+		if (*ip == end) return false;
+		b = *(*ip)++;
+		*len += b;
+	} while (b == 255);
+	return true;
+}
+
+// Returns false for corrupt input instead of reading or writing out of bounds.
+bool cf_lz4_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size)
+{
+	const uint8_t* ip = src;
+	const uint8_t* ip_end = src + src_size;
+	uint8_t* op = dst;
+	uint8_t* op_end = dst + dst_size;
+	while (ip < ip_end) {
+		uint8_t token = *ip++;
+		size_t literal_len = token >> 4;
+		if (literal_len == 15 && !s_lz4_read_length(&ip, ip_end, &literal_len)) return false;
+		if (literal_len > (size_t)(ip_end - ip) || literal_len > (size_t)(op_end - op)) return false;
+		CF_MEMCPY(op, ip, literal_len);
+		ip += literal_len;
+		op += literal_len;
+		if (ip == ip_end) break;
+
+		if (ip_end - ip < 2) return false;
+		size_t offset = ip[0] | ((size_t)ip[1] << 8);
+		ip += 2;
+		if (!offset || offset > (size_t)(op - dst)) return false;
+		size_t match_len = token & 15;
+		if (match_len == 15 && !s_lz4_read_length(&ip, ip_end, &match_len)) return false;
+		match_len += CF_LZ4_MIN_MATCH;
+		if (match_len > (size_t)(op_end - op)) return false;
+		const uint8_t* match = op - offset;
+		for (size_t i = 0; i < match_len; ++i) op[i] = match[i];
+		op += match_len;
+	}
+	return op == op_end;
+}
+
+//--------------------------------------------------------------------------------------------------
+// PhysFS archiver.
+
+struct CF_Pack
+{
+	PHYSFS_Io* io;
+	// Everything before the entry data, in one allocation.
+	CF_PackHeader* header;
+	const CF_PackEntry* entries;
+	const char* names;
+};
+
+struct CF_PackFile
+{
+	CF_Pack* pack;
+	const CF_PackEntry* entry;
+	// A duplicate of the pack's io for entries stored as-is, kept positioned at `position`.
+	PHYSFS_Io* io;
+	// The whole entry for compressed entries, decompressed when opened.
+	uint8_t* data;
+	uint64_t position;
+};
+
+static PHYSFS_Io* s_make_file_io(CF_Pack* pack, const CF_PackEntry* entry);
+
+static PHYSFS_sint64 s_file_read(PHYSFS_Io* io, void* buffer, PHYSFS_uint64 len)
+{
+	CF_PackFile* file = (CF_PackFile*)io->opaque;
+	uint64_t remaining = file->entry->size - file->position;
+	if (len > remaining) len = remaining;
+	if (!len) return 0;
+	if (file->data) {
+		CF_MEMCPY(buffer, file->data + file->position, (size_t)len);
+	} else {
+		PHYSFS_sint64 bytes_read = file->io->read(file->io, buffer, len);
+		if (bytes_read < 0) return -1;
+		len = (PHYSFS_uint64)bytes_read;
+	}
+	file->position += len;
+	return (PHYSFS_sint64)len;
+}
+
+static PHYSFS_sint64 s_file_write(PHYSFS_Io* io, const void* buffer, PHYSFS_uint64 len)
+{
+	CF_UNUSED(io);
+	CF_UNUSED(buffer);
+	CF_UNUSED(len);
+	PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+	return -1;
+}
+
+static int s_file_seek(PHYSFS_Io* io, PHYSFS_uint64 position)
+{
+	CF_PackFile* file = (CF_PackFile*)io->opaque;
+	if (position > file->entry->size) {
+		PHYSFS_setErrorCode(PHYSFS_ERR_PAST_EOF);
+		return 0;
+	}
+	if (file->io && !file->io->seek(file->io, file->entry->offset + position)) return 0;
+	file->position = position;
+	return 1;
+}
+
+static PHYSFS_sint64 s_file_tell(PHYSFS_Io* io)
+{
+	return (PHYSFS_sint64)((CF_PackFile*)io->opaque)->position;
+}
+
+static PHYSFS_sint64 s_file_length(PHYSFS_Io* io)
+{
+	return (PHYSFS_sint64)((CF_PackFile*)io->opaque)->entry->size;
+}
+
+static PHYSFS_Io* s_file_duplicate(PHYSFS_Io* io)
+{
+	CF_PackFile* file = (CF_PackFile*)io->opaque;
+	PHYSFS_Io* result = s_make_file_io(file->pack, file->entry);
+	if (result && !result->seek(result, file->position)) {
+		result->destroy(result);
+		return NULL;
+	}
+	return result;
+}
+
+static int s_file_flush(PHYSFS_Io* io)
+{
+	CF_UNUSED(io);
+	return 1;
+}
+
+static void s_file_destroy(PHYSFS_Io* io)
+{
+	CF_PackFile* file = (CF_PackFile*)io->opaque;
+	if (file->io) file->io->destroy(file->io);
+	CF_FREE(file->data);
+	CF_FREE(file);
+	CF_FREE(io);
+}
+
+static PHYSFS_Io* s_make_file_io(CF_Pack* pack, const CF_PackEntry* entry)
+{
+	CF_PackFile* file = (CF_PackFile*)CF_ALLOC(sizeof(CF_PackFile));
+	CF_MEMSET(file, 0, sizeof(*file));
+	file->pack = pack;
+	file->entry = entry;
+
+	if (entry->compression == CF_PACK_COMPRESSION_NONE) {
+		file->io = pack->io->duplicate(pack->io);
+		if (!file->io || !file->io->seek(file->io, entry->offset)) {
+			if (file->io) file->io->destroy(file->io);
+			CF_FREE(file);
+			return NULL;
+		}
+	} else {
+		// Read through a duplicate, since `s_file_duplicate` can get here from any thread.
+		PHYSFS_Io* pack_io = pack->io->duplicate(pack->io);
+		uint8_t* stored = (uint8_t*)CF_ALLOC((size_t)entry->stored_size);
+		file->data = (uint8_t*)CF_ALLOC((size_t)entry->size);
+		bool ok = pack_io && pack_io->seek(pack_io, entry->offset) && pack_io->read(pack_io, stored, entry->stored_size) == (PHYSFS_sint64)entry->stored_size;
+		if (ok && !cf_lz4_decompress(stored, (size_t)entry->stored_size, file->data, (size_t)entry->size)) {
+			PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+			ok = false;
+		}
+		if (pack_io) pack_io->destroy(pack_io);
+		CF_FREE(stored);
+		if (!ok) {
+			CF_FREE(file->data);
+			CF_FREE(file);
+			return NULL;
+		}
+	}
+
+	PHYSFS_Io* io = (PHYSFS_Io*)CF_ALLOC(sizeof(PHYSFS_Io));
+	io->version = 0;
+	io->opaque = file;
+	io->read = s_file_read;
+	io->write = s_file_write;
+	io->seek = s_file_seek;
+	io->tell = s_file_tell;
+	io->length = s_file_length;
+	io->duplicate = s_file_duplicate;
+	io->flush = s_file_flush;
+	io->destroy = s_file_destroy;
+	return io;
+}
+
+static void* s_open_archive(PHYSFS_Io* io, const char* name, int for_write, int* claimed)
+{
+	CF_UNUSED(name);
+	CF_PackHeader header;
+	if (!io->seek(io, 0) || io->read(io, &header, sizeof(header)) != (PHYSFS_sint64)sizeof(header)) return NULL;
+	if (CF_MEMCMP(header.magic, "CFPK", 4)) return NULL;
+	*claimed = 1;
+	if (for_write) {
+		PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+		return NULL;
+	}
+	PHYSFS_sint64 length = io->length(io);
+	if (length < 0 || !s_header_is_valid(&header, (uint64_t)length)) {
+		PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+		return NULL;
+	}
+
+	size_t directory_size = s_directory_size(&header);
+	CF_PackHeader* directory = (CF_PackHeader*)CF_ALLOC(directory_size);
+	if (!io->seek(io, 0) || io->read(io, directory, directory_size) != (PHYSFS_sint64)directory_size) {
+		CF_FREE(directory);
+		return NULL;
+	}
+
+	// Validate once here, so the rest of the archiver can trust the directory.
+	const uint32_t* buckets = (const uint32_t*)(directory + 1);
+	const CF_PackEntry* entries = (const CF_PackEntry*)(buckets + directory->bucket_count);
+	bool valid = true;
+	for (uint32_t i = 0; valid && i < directory->bucket_count; ++i) {
+		valid = buckets[i] <= directory->entry_count;
+	}
+	for (uint32_t i = 0; valid && i < directory->entry_count; ++i) {
+		const CF_PackEntry* entry = entries + i;
+		valid = (uint64_t)entry->name_offset + entry->name_len < directory->names_size
+			&& ((const char*)directory)[directory->names_offset + entry->name_offset + entry->name_len] == 0
+			&& entry->offset <= (uint64_t)length && entry->stored_size <= (uint64_t)length - entry->offset
+			&& (entry->compression == CF_PACK_COMPRESSION_LZ4 || (entry->compression == CF_PACK_COMPRESSION_NONE && entry->stored_size == entry->size))
+			&& entry->size < SIZE_MAX;
+	}
+	if (!valid) {
+		CF_FREE(directory);
+		PHYSFS_setErrorCode(PHYSFS_ERR_CORRUPT);
+		return NULL;
+	}
+
+	CF_Pack* pack = (CF_Pack*)CF_ALLOC(sizeof(CF_Pack));
+	pack->io = io;
+	pack->header = directory;
+	pack->entries = entries;
+	pack->names = (const char*)directory + directory->names_offset;
+	return pack;
+}
+
+static PHYSFS_EnumerateCallbackResult s_enumerate(void* opaque, const char* dirname, PHYSFS_EnumerateCallback cb, const char* origdir, void* callbackdata)
+{
+	CF_Pack* pack = (CF_Pack*)opaque;
+	size_t dir_len = CF_STRLEN(dirname);
+	if (dir_len) {
+		const CF_PackEntry* dir = s_find(pack->header, dirname, dir_len);
+		if (!dir || !(dir->flags & CF_PACK_ENTRY_DIRECTORY)) {
+			PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+			return PHYSFS_ENUM_ERROR;
+		}
+	}
+
+	// Listing a directory is rare next to opening files, so it scans every entry rather than storing a tree.
+	for (uint32_t i = 0; i < pack->header->entry_count; ++i) {
+		const CF_PackEntry* entry = pack->entries + i;
+		const char* name = pack->names + entry->name_offset;
+		if (dir_len) {
+			if (entry->name_len <= dir_len || name[dir_len] != '/' || CF_MEMCMP(name, dirname, dir_len)) continue;
+			name += dir_len + 1;
+		}
+		if (CF_STRCHR(name, '/')) continue;
+		PHYSFS_EnumerateCallbackResult result = cb(callbackdata, origdir, name);
+		if (result == PHYSFS_ENUM_ERROR) PHYSFS_setErrorCode(PHYSFS_ERR_APP_CALLBACK);
+		if (result != PHYSFS_ENUM_OK) return result;
+	}
+	return PHYSFS_ENUM_OK;
+}
+
+static PHYSFS_Io* s_open_read(void* opaque, const char* path)
+{
+	CF_Pack* pack = (CF_Pack*)opaque;
+	const CF_PackEntry* entry = s_find(pack->header, path, CF_STRLEN(path));
+	if (!entry) {
+		PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+		return NULL;
+	}
+	if (entry->flags & CF_PACK_ENTRY_DIRECTORY) {
+		PHYSFS_setErrorCode(PHYSFS_ERR_NOT_A_FILE);
+		return NULL;
+	}
+	return s_make_file_io(pack, entry);
+}
+
+static PHYSFS_Io* s_open_write(void* opaque, const char* path)
+{
+	CF_UNUSED(opaque);
+	CF_UNUSED(path);
+	PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+	return NULL;
+}
+
+static int s_modify(void* opaque, const char* path)
+{
+	CF_UNUSED(opaque);
+	CF_UNUSED(path);
+	PHYSFS_setErrorCode(PHYSFS_ERR_READ_ONLY);
+	return 0;
+}
+
+static int s_stat(void* opaque, const char* path, PHYSFS_Stat* stat)
+{
+	CF_Pack* pack = (CF_Pack*)opaque;
+	size_t len = CF_STRLEN(path);
+	const CF_PackEntry* entry = len ? s_find(pack->header, path, len) : NULL;
+	if (len && !entry) {
+		PHYSFS_setErrorCode(PHYSFS_ERR_NOT_FOUND);
+		return 0;
+	}
+	bool is_directory = !entry || (entry->flags & CF_PACK_ENTRY_DIRECTORY);
+	stat->filesize = is_directory ? 0 : (PHYSFS_sint64)entry->size;
+	stat->modtime = -1;
+	stat->createtime = -1;
+	stat->accesstime = -1;
+	stat->filetype = is_directory ? PHYSFS_FILETYPE_DIRECTORY : PHYSFS_FILETYPE_REGULAR;
+	stat->readonly = 1;
+	return 1;
+}
+
+static void s_close_archive(void* opaque)
+{
+	CF_Pack* pack = (CF_Pack*)opaque;
+	pack->io->destroy(pack->io);
+	CF_FREE(pack->header);
+	CF_FREE(pack);
+}
+
+void cf_register_pack_archiver()
+{
+	static const PHYSFS_Archiver archiver = {
+		0,
+		{
+			"CFPK",
+			"Cute Framework pack",
+			"Cute Framework",
+			"https://github.com/RandyGaul/cute_framework",
+			0,
+		},
+		s_open_archive,
+		s_enumerate,
+		s_open_read,
+		s_open_write,
+		s_open_write,
+		s_modify,
+		s_modify,
+		s_stat,
+		s_close_archive,
+	};
+	PHYSFS_registerArchiver(&archiver);
+}
+
+const void* cf_pack_find_stored_entry(const void* pack, size_t pack_size, const char* path, size_t size)
+{
+	const CF_PackHeader* header = (const CF_PackHeader*)pack;
+	if (pack_size < sizeof(CF_PackHeader) || !s_header_is_valid(header, pack_size)) return NULL;
+	const CF_PackEntry* entry = s_find(header, path, CF_STRLEN(path));
+	if (!entry || (entry->flags & CF_PACK_ENTRY_DIRECTORY) || entry->compression != CF_PACK_COMPRESSION_NONE || entry->size != size) return NULL;
+	if (entry->offset > pack_size || pack_size - entry->offset < size) return NULL;
+	return (const uint8_t*)pack + entry->offset;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Writing packs.
+
+struct CF_PackSource
+{
+	char* virtual_path;
+	char* name;
+	bool is_directory;
+};
+
+static void s_gather(const char* virtual_directory, const char* prefix, Array<CF_PackSource>& sources)
+{
+	const char** list = cf_fs_enumerate_directory(virtual_directory);
+	if (!list) return;
+	for (const char** it = list; *it; ++it) {
+		CF_PackSource source;
+		source.virtual_path = smake(virtual_directory);
+		if (slen(source.virtual_path) && slast(source.virtual_path) != '/') sappend(source.virtual_path, "/");
+		sappend(source.virtual_path, *it);
+		source.name = smake(prefix);
+		if (slen(source.name)) sappend(source.name, "/");
+		sappend(source.name, *it);
+		CF_Stat stat;
+		if (cf_is_error(cf_fs_stat(source.virtual_path, &stat)) || (stat.type != CF_FILE_TYPE_DIRECTORY && stat.type != CF_FILE_TYPE_REGULAR)) {
+			sfree(source.virtual_path);
+			sfree(source.name);
+			continue;
+		}
+		source.is_directory = stat.type == CF_FILE_TYPE_DIRECTORY;
+		sources.add(source);
+		if (source.is_directory) s_gather(source.virtual_path, source.name, sources);
+	}
+	cf_fs_free_enumerated_directory(list);
+}
+
+static bool s_write_zeros(CF_File* file, size_t count)
+{
+	static const uint8_t zeros[CF_PACK_PAGE_SIZE] = { };
+	while (count) {
+		size_t n = count < sizeof(zeros) ? count : sizeof(zeros);
+		if (cf_fs_write(file, zeros, n) != n) return false;
+		count -= n;
+	}
+	return true;
+}
+
+CF_Result cf_fs_write_pack(const char* virtual_directory, const char* pack_virtual_path, bool compress)
+{
+	Array<CF_PackSource> sources;
+	s_gather(virtual_directory, "", sources);
+	CF_Result result = cf_result_success();
+	int entry_count = sources.count();
+
+	// Size the directory up front, so entry data can be streamed out right after it.
+	uint32_t bucket_count = 16;
+	while (bucket_count < (uint32_t)entry_count * 2) bucket_count *= 2;
+	size_t names_size = 0;
+	for (int i = 0; i < entry_count; ++i) {
+		names_size += slen(sources[i].name) + 1;
+	}
+	size_t names_offset = sizeof(CF_PackHeader) + sizeof(uint32_t) * bucket_count + sizeof(CF_PackEntry) * entry_count;
+	size_t directory_size = names_offset + names_size;
+	uint8_t* directory = (uint8_t*)CF_ALLOC(directory_size);
+	CF_MEMSET(directory, 0, directory_size);
+	CF_PackHeader* header = (CF_PackHeader*)directory;
+	CF_MEMCPY(header->magic, "CFPK", 4);
+	header->version = CF_PACK_VERSION;
+	header->entry_count = (uint32_t)entry_count;
+	header->bucket_count = bucket_count;
+	header->names_offset = names_offset;
+	header->names_size = names_size;
+	uint32_t* buckets = (uint32_t*)(header + 1);
+	CF_PackEntry* entries = (CF_PackEntry*)(buckets + bucket_count);
+	char* names = (char*)directory + names_offset;
+
+	size_t name_offset = 0;
+	for (int i = 0; i < entry_count; ++i) {
+		CF_PackEntry* entry = entries + i;
+		const char* name = sources[i].name;
+		size_t len = slen(name);
+		CF_MEMCPY(names + name_offset, name, len + 1);
+		entry->hash = s_hash(name, len);
+		entry->name_offset = (uint32_t)name_offset;
+		entry->name_len = (uint32_t)len;
+		entry->flags = sources[i].is_directory ? CF_PACK_ENTRY_DIRECTORY : 0;
+		name_offset += len + 1;
+		uint32_t index = (uint32_t)entry->hash & (bucket_count - 1);
+		while (buckets[index]) index = (index + 1) & (bucket_count - 1);
+		buckets[index] = (uint32_t)i + 1;
+	}
+
+	CF_File* file = cf_fs_open_file_for_write(pack_virtual_path);
+	size_t offset = s_align(directory_size, CF_PACK_PAGE_SIZE);
+	if (!file) {
+		result = cf_result_error("Unable to open the pack for writing.");
+	} else if (!s_write_zeros(file, offset)) {
+		result = cf_result_error("Unable to write the pack.");
+	}
+
+	for (int i = 0; !cf_is_error(result) && i < entry_count; ++i) {
+		CF_PackEntry* entry = entries + i;
+		if (entry->flags & CF_PACK_ENTRY_DIRECTORY) continue;
+		size_t size = 0;
+		void* data = cf_fs_read_entire_file_to_memory(sources[i].virtual_path, &size);
+		if (!data) {
+			result = cf_result_error("Unable to read a file to pack.");
+			break;
+		}
+		const void* stored = data;
+		size_t stored_size = size;
+		uint8_t* compressed = NULL;
+		entry->compression = CF_PACK_COMPRESSION_NONE;
+		if (compress && size) {
+			compressed = (uint8_t*)CF_ALLOC(cf_lz4_bound(size));
+			size_t compressed_size = cf_lz4_compress((const uint8_t*)data, size, compressed);
+			// Only worth decompressing on load if it saves a good chunk.
+			if (compressed_size < size - size / 8) {
+				stored = compressed;
+				stored_size = compressed_size;
+				entry->compression = CF_PACK_COMPRESSION_LZ4;
+			}
+		}
+
+		// Entries read in place, spanning at least a page, start on a page so they can be memory-mapped.
+		size_t alignment = entry->compression == CF_PACK_COMPRESSION_NONE && size >= CF_PACK_PAGE_SIZE ? CF_PACK_PAGE_SIZE : CF_PACK_ALIGNMENT;
+		size_t aligned = s_align(offset, alignment);
+		if (!s_write_zeros(file, aligned - offset) || cf_fs_write(file, stored, stored_size) != stored_size) {
+			result = cf_result_error("Unable to write the pack.");
+		}
+		entry->offset = aligned;
+		entry->size = size;
+		entry->stored_size = stored_size;
+		offset = aligned + stored_size;
+		CF_FREE(compressed);
+		CF_FREE(data);
+	}
+
+	if (!cf_is_error(result)) {
+		if (cf_is_error(cf_fs_seek(file, 0)) || cf_fs_write(file, directory, directory_size) != directory_size) {
+			result = cf_result_error("Unable to write the pack.");
+		}
+	}
+	if (file) cf_fs_close(file);
+
+	CF_FREE(directory);
+	for (int i = 0; i < entry_count; ++i) {
+		sfree(sources[i].virtual_path);
+		sfree(sources[i].name);
+	}
+	return result;
+}
@@ -0,0 +1,207 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_particles.h>
+#include <cute_alloc.h>
+#include <cute_c_runtime.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_particles_internal.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_PARTICLES_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_PARTICLES_NEON
+#endif
+
+// Four floats processed at once.
+#if defined(CF_PARTICLES_SSE2)
+typedef __m128 f4;
+static CF_INLINE f4 s_load(const float* v) { return _mm_loadu_ps(v); }
+static CF_INLINE void s_store(float* v, f4 a) { _mm_storeu_ps(v, a); }
+static CF_INLINE f4 s_splat(float a) { return _mm_set1_ps(a); }
+static CF_INLINE f4 s_add(f4 a, f4 b) { return _mm_add_ps(a, b); }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { return _mm_mul_ps(a, b); }
+#elif defined(CF_PARTICLES_NEON)
+typedef float32x4_t f4;
+static CF_INLINE f4 s_load(const float* v) { return vld1q_f32(v); }
+static CF_INLINE void s_store(float* v, f4 a) { vst1q_f32(v, a); }
+static CF_INLINE f4 s_splat(float a) { return vdupq_n_f32(a); }
+static CF_INLINE f4 s_add(f4 a, f4 b) { return vaddq_f32(a, b); }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { return vmulq_f32(a, b); }
+#else
+struct f4 { float v[4]; };
+static CF_INLINE f4 s_load(const float* v) { f4 r = { { v[0], v[1], v[2], v[3] } }; return r; }
+static CF_INLINE void s_store(float* v, f4 a) { for (int i = 0; i < 4; ++i) v[i] = a.v[i]; }
+static CF_INLINE f4 s_splat(float a) { f4 r = { { a, a, a, a } }; return r; }
+static CF_INLINE f4 s_add(f4 a, f4 b) { f4 r; for (int i = 0; i < 4; ++i) r.v[i] = a.v[i] + b.v[i]; return r; }
+static CF_INLINE f4 s_mul(f4 a, f4 b) { f4 r; for (int i = 0; i < 4; ++i) r.v[i] = a.v[i] * b.v[i]; return r; }
+#endif
+
+#define CF_PARTICLE_ARRAY_COUNT 6
+
+static CF_INLINE int s_round_capacity(int capacity)
+{
+	return (cf_max(capacity, 1) + 3) & ~3;
+}
+
+static void s_resize(CF_ParticleEmitterInternal* e, int capacity)
+{
+	// All arrays share one allocation.
+	capacity = s_round_capacity(capacity);
+	float* mem = (float*)CF_ALLOC(sizeof(float) * capacity * CF_PARTICLE_ARRAY_COUNT);
+	CF_MEMSET(mem, 0, sizeof(float) * capacity * CF_PARTICLE_ARRAY_COUNT);
+	float* arrays[CF_PARTICLE_ARRAY_COUNT] = { e->px, e->py, e->vx, e->vy, e->age, e->lifetime };
+	float** dst[CF_PARTICLE_ARRAY_COUNT] = { &e->px, &e->py, &e->vx, &e->vy, &e->age, &e->lifetime };
+	int count = cf_min(e->count, capacity);
+	for (int i = 0; i < CF_PARTICLE_ARRAY_COUNT; ++i) {
+		*dst[i] = mem + capacity * i;
+		if (arrays[i]) CF_MEMCPY(*dst[i], arrays[i], sizeof(float) * count);
+	}
+	CF_FREE(arrays[0]);
+	e->count = count;
+	e->capacity = capacity;
+}
+
+static void s_spawn(CF_ParticleEmitterInternal* e, int n)
+{
+	const CF_ParticleParams& params = e->params;
+	n = cf_min(n, params.capacity - e->count);
+	for (int k = 0; k < n; ++k) {
+		int i = e->count++;
+		CF_V2 p = e->position;
+		if (params.spawn_radius > 0) {
+			// Square root of the radius keeps spawn points evenly spread over the disc.
+			float r = params.spawn_radius * CF_SQRTF(cf_rnd_float(&e->rnd));
+			float a = cf_rnd_range_float(&e->rnd, -CF_PI, CF_PI);
+			p.x += CF_COSF(a) * r;
+			p.y += CF_SINF(a) * r;
+		}
+		float angle = params.angle + cf_rnd_range_float(&e->rnd, -params.spread, params.spread);
+		float speed = cf_rnd_range_float(&e->rnd, params.speed_min, params.speed_max);
+		e->px[i] = p.x;
+		e->py[i] = p.y;
+		e->vx[i] = CF_COSF(angle) * speed;
+		e->vy[i] = CF_SINF(angle) * speed;
+		e->age[i] = 0;
+		e->lifetime[i] = cf_max(cf_rnd_range_float(&e->rnd, params.lifetime_min, params.lifetime_max), 1.0e-4f);
+	}
+}
+
+CF_ParticleEmitter cf_make_particle_emitter(CF_ParticleParams params)
+{
+	CF_ParticleEmitterInternal* e = CF_NEW(CF_ParticleEmitterInternal);
+	e->params = params;
+	e->rnd = cf_rnd_seed(params.seed);
+	s_resize(e, params.capacity);
+	CF_ParticleEmitter result;
+	result.id = (uint64_t)e;
+	return result;
+}
+
+void cf_destroy_particle_emitter(CF_ParticleEmitter emitter)
+{
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	if (!e) return;
+	CF_FREE(e->px);
+	if (e->mesh.id) cf_draw_destroy_particle_mesh(e->mesh);
+	e->~CF_ParticleEmitterInternal();
+	CF_FREE(e);
+}
+
+void cf_particle_emitter_set_params(CF_ParticleEmitter emitter, CF_ParticleParams params)
+{
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	bool reseed = params.seed != e->params.seed;
+	e->params = params;
+	if (reseed) e->rnd = cf_rnd_seed(params.seed);
+	if (s_round_capacity(params.capacity) != e->capacity) {
+		s_resize(e, params.capacity);
+	}
+	e->count = cf_max(cf_min(e->count, params.capacity), 0);
+}
+
+void cf_particle_emitter_set_sprite(CF_ParticleEmitter emitter, const CF_Sprite* sprite)
+{
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	if (!sprite) {
+		e->image_id = 0;
+		e->image_w = e->image_h = 0;
+		return;
+	}
+	e->image_id = sprite->animation ? sprite->animation->frames[sprite->frame_index].id : sprite->easy_sprite_id;
+	e->image_w = sprite->w;
+	e->image_h = sprite->h;
+}
+
+void cf_particle_emitter_set_position(CF_ParticleEmitter emitter, CF_V2 position)
+{
+	cf_particle_emitter_internal(emitter)->position = position;
+}
+
+void cf_particle_emitter_set_emitting(CF_ParticleEmitter emitter, bool emitting)
+{
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	e->emitting = emitting;
+	e->spawn_accumulator = 0;
+}
+
+void cf_particle_emitter_burst(CF_ParticleEmitter emitter, int count)
+{
+	s_spawn(cf_particle_emitter_internal(emitter), count);
+}
+
+void cf_particle_emitter_update(CF_ParticleEmitter emitter, float dt)
+{
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	const CF_ParticleParams& params = e->params;
+
+	// Integrate four particles at a time. `capacity` is a multiple of four, so the last group never
+	// runs off the end of the arrays.
+	f4 vdt = s_splat(dt);
+	f4 damping = s_splat(cf_max(1.0f - params.drag * dt, 0.0f));
+	f4 gx = s_splat(params.gravity.x * dt);
+	f4 gy = s_splat(params.gravity.y * dt);
+	for (int i = 0; i < e->count; i += 4) {
+		f4 vx = s_add(s_mul(s_load(e->vx + i), damping), gx);
+		f4 vy = s_add(s_mul(s_load(e->vy + i), damping), gy);
+		s_store(e->vx + i, vx);
+		s_store(e->vy + i, vy);
+		s_store(e->px + i, s_add(s_load(e->px + i), s_mul(vx, vdt)));
+		s_store(e->py + i, s_add(s_load(e->py + i), s_mul(vy, vdt)));
+		s_store(e->age + i, s_add(s_load(e->age + i), vdt));
+	}
+
+	// Expired particles are replaced by the last live one.
+	for (int i = 0; i < e->count;) {
+		if (e->age[i] < e->lifetime[i]) {
+			++i;
+			continue;
+		}
+		int last = --e->count;
+		e->px[i] = e->px[last];
+		e->py[i] = e->py[last];
+		e->vx[i] = e->vx[last];
+		e->vy[i] = e->vy[last];
+		e->age[i] = e->age[last];
+		e->lifetime[i] = e->lifetime[last];
+	}
+
+	if (e->emitting && params.rate > 0) {
+		e->spawn_accumulator += params.rate * dt;
+		int n = (int)e->spawn_accumulator;
+		e->spawn_accumulator -= (float)n;
+		s_spawn(e, n);
+	}
+}
+
+int cf_particle_emitter_count(CF_ParticleEmitter emitter)
+{
+	return cf_particle_emitter_internal(emitter)->count;
+}
@@ -0,0 +1,930 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_physics.h>
+#include <cute_aabb_tree.h>
+#include <cute_array.h>
+#include <cute_hashtable.h>
+#include <cute_alloc.h>
+
+#include <internal/cute_alloc_internal.h>
+
+#include <float.h>
+
+// Fraction of the overlap between two shapes pushed out each step. Higher fixes overlap faster, but adds energy to stacks.
+#define PHYSICS_BAUMGARTE 0.2f
+
+// Contacts closing slower than the speed gravity adds over this many steps don't bounce, so resting bodies don't jitter.
+#define PHYSICS_RESTITUTION_STEPS 4.0f
+
+// New contact points take the impulses of last step's point closest to them, if within this many `linear_slop`s.
+#define PHYSICS_WARM_START_SLOPS 8.0f
+
+// Most leaves reinserted into better spots in the broadphase tree per step, see `cf_aabb_tree_update_leaves`.
+#define PHYSICS_MAX_REINSERTS 64
+
+using namespace Cute;
+
+struct CF_PhysicsWorldInternal;
+
+struct CF_BodyInternal
+{
+	CF_PhysicsWorldInternal* world;
+	uint64_t serial; // Never reused, names pairs of bodies across steps.
+	int index;       // Into `CF_PhysicsWorldInternal::bodies`.
+	CF_BodyType type;
+
+	CF_Transform xf;
+	float angle;
+	CF_V2 local_center;
+	CF_V2 center;
+	CF_V2 v;
+	float w;
+	CF_V2 force;
+
+	float mass, inv_mass;
+	float inv_inertia;
+	float linear_damping;
+	float angular_damping;
+	bool fixed_rotation;
+	float friction;
+	float restitution;
+
+	// AABBs are stored as polygons so they can rotate.
+	CF_ShapeType shape_type;
+	union
+	{
+		CF_Circle circle;
+		CF_Capsule capsule;
+		CF_Poly poly;
+	};
+
+	CF_Leaf leaf;
+	bool awake;
+	float sleep_time;
+	void* udata;
+};
+
+struct CF_PhysicsContact
+{
+	CF_BodyInternal* a;
+	CF_BodyInternal* b;
+	uint64_t key;
+	CF_Manifold m;
+	float friction;
+	float restitution;
+	float normal_impulse[2];
+	float tangent_impulse[2];
+
+	// Solver scratch.
+	CF_V2 ra[2], rb[2];
+	float normal_mass[2];
+	float tangent_mass[2];
+	float bias[2];
+};
+
+struct CF_PhysicsIsland
+{
+	int body_offset, body_count;
+	int contact_offset, contact_count;
+	bool awake;
+};
+
+struct CF_PhysicsWorldInternal
+{
+	CF_PhysicsWorldParams params;
+	CF_AabbTree tree;
+	Array<CF_BodyInternal*> bodies;
+	uint64_t serial_gen = 1;
+	float dt = 0;
+
+	// Contacts from this step, and from the step before to warm-start from.
+	Array<CF_PhysicsContact> contacts;
+	Array<CF_PhysicsContact> old_contacts;
+	Map<uint64_t, int> old_contact_indices;
+	Array<bool> needs_collide;
+
+	// Islands, with their bodies and contacts packed one island after another.
+	Array<int> parents;
+	Array<int> island_of_root;
+	Array<CF_PhysicsIsland> islands;
+	Array<CF_BodyInternal*> island_bodies;
+	Array<int> island_contacts;
+
+	// Broadphase scratch.
+	Array<CF_AabbTreePair> pairs;
+	Array<CF_Leaf> moved_leaves;
+	Array<CF_Aabb> moved_aabbs;
+	Array<CF_V2> moved_offsets;
+};
+
+static CF_INLINE CF_PhysicsWorldInternal* s_world(CF_PhysicsWorld world) { return (CF_PhysicsWorldInternal*)world.id; }
+static CF_INLINE CF_BodyInternal* s_body(CF_Body body) { return (CF_BodyInternal*)body.id; }
+
+static CF_INLINE uint64_t s_pair_key(uint64_t serial_a, uint64_t serial_b)
+{
+	return (serial_a << 32) ^ serial_b;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Shapes and mass.
+
+static void s_compute_mass(CF_BodyInternal* body, float density)
+{
+	float mass = 0, inertia = 0;
+	CF_V2 center = cf_v2(0, 0);
+	switch (body->shape_type) {
+	case CF_SHAPE_TYPE_CIRCLE:
+	{
+		float r = body->circle.r;
+		mass = density * CF_PI * r * r;
+		inertia = mass * r * r * 0.5f;
+		center = body->circle.p;
+	}	break;
+
+	case CF_SHAPE_TYPE_CAPSULE:
+	{
+		// A box between the end-caps, and a circle split across both ends.
+		float r = body->capsule.r;
+		float length = cf_distance(body->capsule.a, body->capsule.b);
+		float box_mass = density * 2.0f * r * length;
+		float circle_mass = density * CF_PI * r * r;
+		mass = box_mass + circle_mass;
+		inertia = box_mass * (length * length + 4.0f * r * r) / 12.0f + circle_mass * (0.5f * r * r + 0.25f * length * length);
+		center = cf_mul_v2_f(cf_add_v2(body->capsule.a, body->capsule.b), 0.5f);
+	}	break;
+
+	case CF_SHAPE_TYPE_POLY:
+	{
+		// Sum up triangles fanned out from the first vertex, then move the inertia from there to the center of mass.
+		const CF_Poly* poly = &body->poly;
+		CF_V2 origin = poly->verts[0];
+		float area = 0, i_origin = 0;
+		CF_V2 c = cf_v2(0, 0);
+		for (int i = 1; i + 1 < poly->count; ++i) {
+			CF_V2 e1 = cf_sub_v2(poly->verts[i], origin);
+			CF_V2 e2 = cf_sub_v2(poly->verts[i + 1], origin);
+			float d = cf_cross(e1, e2);
+			float tri_area = 0.5f * d;
+			area += tri_area;
+			c = cf_add_v2(c, cf_mul_v2_f(cf_add_v2(e1, e2), tri_area / 3.0f));
+			float int_x2 = e1.x * e1.x + e2.x * e1.x + e2.x * e2.x;
+			float int_y2 = e1.y * e1.y + e2.y * e1.y + e2.y * e2.y;
+			i_origin += (0.25f / 3.0f) * d * (int_x2 + int_y2);
+		}
+		if (area > 0) {
+			c = cf_div_v2_f(c, area);
+			mass = density * area;
+			inertia = density * i_origin - mass * cf_dot(c, c);
+			center = cf_add_v2(origin, c);
+		}
+	}	break;
+
+	default: break;
+	}
+
+	body->local_center = center;
+	if (body->type == CF_BODY_TYPE_DYNAMIC && mass > 0) {
+		body->mass = mass;
+		body->inv_mass = 1.0f / mass;
+		body->inv_inertia = body->fixed_rotation || inertia <= 0 ? 0 : 1.0f / inertia;
+	} else {
+		body->mass = 0;
+		body->inv_mass = 0;
+		body->inv_inertia = 0;
+	}
+}
+
+// The body's shape in world space, ready for `cf_collide`. Circles and capsules are moved by hand since `cf_collide` only
+// transforms polygons.
+struct CF_WorldShape
+{
+	CF_ShapeType type;
+	const void* shape;
+	const CF_Transform* xf;
+	union
+	{
+		CF_Circle circle;
+		CF_Capsule capsule;
+	};
+};
+
+static void s_world_shape(const CF_BodyInternal* body, CF_WorldShape* out)
+{
+	out->type = body->shape_type;
+	out->xf = NULL;
+	switch (body->shape_type) {
+	case CF_SHAPE_TYPE_CIRCLE:
+		out->circle.p = cf_mul_tf_v2(body->xf, body->circle.p);
+		out->circle.r = body->circle.r;
+		out->shape = &out->circle;
+		break;
+
+	case CF_SHAPE_TYPE_CAPSULE:
+		out->capsule.a = cf_mul_tf_v2(body->xf, body->capsule.a);
+		out->capsule.b = cf_mul_tf_v2(body->xf, body->capsule.b);
+		out->capsule.r = body->capsule.r;
+		out->shape = &out->capsule;
+		break;
+
+	default:
+		out->shape = &body->poly;
+		out->xf = &body->xf;
+		break;
+	}
+}
+
+static CF_Aabb s_body_aabb(const CF_BodyInternal* body)
+{
+	switch (body->shape_type) {
+	case CF_SHAPE_TYPE_CIRCLE:
+	{
+		CF_V2 p = cf_mul_tf_v2(body->xf, body->circle.p);
+		CF_V2 r = cf_v2(body->circle.r, body->circle.r);
+		return cf_make_aabb(cf_sub_v2(p, r), cf_add_v2(p, r));
+	}
+
+	case CF_SHAPE_TYPE_CAPSULE:
+	{
+		CF_V2 a = cf_mul_tf_v2(body->xf, body->capsule.a);
+		CF_V2 b = cf_mul_tf_v2(body->xf, body->capsule.b);
+		CF_V2 r = cf_v2(body->capsule.r, body->capsule.r);
+		return cf_make_aabb(cf_sub_v2(cf_min_v2(a, b), r), cf_add_v2(cf_max_v2(a, b), r));
+	}
+
+	default:
+	{
+		CF_V2 lo = cf_mul_tf_v2(body->xf, body->poly.verts[0]);
+		CF_V2 hi = lo;
+		for (int i = 1; i < body->poly.count; ++i) {
+			CF_V2 p = cf_mul_tf_v2(body->xf, body->poly.verts[i]);
+			lo = cf_min_v2(lo, p);
+			hi = cf_max_v2(hi, p);
+		}
+		return cf_make_aabb(lo, hi);
+	}
+	}
+}
+
+static void s_set_transform(CF_BodyInternal* body, CF_V2 position, float angle)
+{
+	body->angle = angle;
+	body->xf = cf_make_transform_TR(position, angle);
+	body->center = cf_mul_tf_v2(body->xf, body->local_center);
+}
+
+static void s_wake(CF_BodyInternal* body)
+{
+	if (body->type == CF_BODY_TYPE_STATIC) return;
+	body->awake = true;
+	body->sleep_time = 0;
+}
+
+static bool s_wake_fn(CF_Leaf leaf, CF_Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	CF_UNUSED(leaf);
+	CF_UNUSED(aabb);
+	CF_UNUSED(fn_udata);
+	s_wake((CF_BodyInternal*)leaf_udata);
+	return true;
+}
+
+// Wakes everything near `aabb`, such as when a body is added, removed or teleported out from under others.
+static void s_wake_near(CF_PhysicsWorldInternal* world, CF_Aabb aabb)
+{
+	cf_aabb_tree_query_aabb(world->tree, s_wake_fn, aabb, NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Stepping.
+
+static int s_find(Array<int>& parents, int i)
+{
+	while (parents[i] != i) {
+		parents[i] = parents[parents[i]];
+		i = parents[i];
+	}
+	return i;
+}
+
+static void s_union(Array<int>& parents, int a, int b)
+{
+	a = s_find(parents, a);
+	b = s_find(parents, b);
+	// The lower index becomes the root, so islands don't depend on the order contacts are joined in.
+	if (a < b) parents[b] = a;
+	else if (b < a) parents[a] = b;
+}
+
+static void s_integrate_velocities(CF_PhysicsWorldInternal* world, float dt)
+{
+	CF_V2 gravity = world->params.gravity;
+	for (int i = 0; i < world->bodies.count(); ++i) {
+		CF_BodyInternal* body = world->bodies[i];
+		if (body->type == CF_BODY_TYPE_KINEMATIC) {
+			body->awake = body->v.x != 0 || body->v.y != 0 || body->w != 0;
+		}
+		if (body->type != CF_BODY_TYPE_DYNAMIC || !body->awake) {
+			body->force = cf_v2(0, 0);
+			continue;
+		}
+		CF_V2 accel = cf_add_v2(gravity, cf_mul_v2_f(body->force, body->inv_mass));
+		body->v = cf_add_v2(body->v, cf_mul_v2_f(accel, dt));
+		body->v = cf_mul_v2_f(body->v, 1.0f / (1.0f + dt * body->linear_damping));
+		body->w *= 1.0f / (1.0f + dt * body->angular_damping);
+		body->force = cf_v2(0, 0);
+	}
+}
+
+static void s_find_contacts(CF_PhysicsWorldInternal* world)
+{
+	int pair_count = cf_aabb_tree_find_pairs(world->tree, world->pairs.data(), world->pairs.capacity(), world->params.pool);
+	if (pair_count > world->pairs.capacity()) {
+		world->pairs.ensure_capacity(pair_count);
+		pair_count = cf_aabb_tree_find_pairs(world->tree, world->pairs.data(), world->pairs.capacity(), world->params.pool);
+	}
+	world->pairs.set_count(pair_count);
+
+	world->contacts.clear();
+	world->needs_collide.clear();
+	for (int i = 0; i < pair_count; ++i) {
+		CF_BodyInternal* a = (CF_BodyInternal*)cf_aabb_tree_get_udata(world->tree, world->pairs[i].a);
+		CF_BodyInternal* b = (CF_BodyInternal*)cf_aabb_tree_get_udata(world->tree, world->pairs[i].b);
+		if (a->type != CF_BODY_TYPE_DYNAMIC && b->type != CF_BODY_TYPE_DYNAMIC) continue;
+		if (b->serial < a->serial) {
+			CF_BodyInternal* t = a;
+			a = b;
+			b = t;
+		}
+		uint64_t key = s_pair_key(a->serial, b->serial);
+		bool awake = a->awake || b->awake;
+		if (!awake) {
+			// Neither body moved since they fell asleep, so last step's contact is still good. Keeping it keeps the island together.
+			int* old = world->old_contact_indices.try_get(key);
+			if (!old) continue;
+			CF_PhysicsContact& contact = world->contacts.add(world->old_contacts[*old]);
+			contact.a = a;
+			contact.b = b;
+			world->needs_collide.add(false);
+			continue;
+		}
+		CF_PhysicsContact& contact = world->contacts.add();
+		contact.a = a;
+		contact.b = b;
+		contact.key = key;
+		contact.friction = CF_SQRTF(a->friction * b->friction);
+		contact.restitution = cf_max(a->restitution, b->restitution);
+		world->needs_collide.add(true);
+	}
+}
+
+static void CF_CALL s_collide_fn(int begin, int end, void* udata)
+{
+	CF_PhysicsWorldInternal* world = (CF_PhysicsWorldInternal*)udata;
+	float match_dist = PHYSICS_WARM_START_SLOPS * world->params.linear_slop;
+	for (int i = begin; i < end; ++i) {
+		if (!world->needs_collide[i]) continue;
+		CF_PhysicsContact* contact = world->contacts.data() + i;
+		CF_WorldShape sa, sb;
+		s_world_shape(contact->a, &sa);
+		s_world_shape(contact->b, &sb);
+		cf_collide(sa.shape, sa.xf, sa.type, sb.shape, sb.xf, sb.type, &contact->m);
+
+		// Warm-start each point from last step's nearest point.
+		const int* old_index = world->old_contact_indices.try_get(contact->key);
+		const CF_PhysicsContact* old = old_index ? world->old_contacts.data() + *old_index : NULL;
+		for (int j = 0; j < contact->m.count; ++j) {
+			contact->normal_impulse[j] = 0;
+			contact->tangent_impulse[j] = 0;
+			if (!old) continue;
+			float best = match_dist * match_dist;
+			for (int k = 0; k < old->m.count; ++k) {
+				float d = cf_len_sq(cf_sub_v2(contact->m.contact_points[j], old->m.contact_points[k]));
+				if (d < best) {
+					best = d;
+					contact->normal_impulse[j] = old->normal_impulse[k];
+					contact->tangent_impulse[j] = old->tangent_impulse[k];
+				}
+			}
+		}
+	}
+}
+
+static void s_build_islands(CF_PhysicsWorldInternal* world)
+{
+	// Drop pairs whose shapes didn't actually touch.
+	int contact_count = 0;
+	for (int i = 0; i < world->contacts.count(); ++i) {
+		if (world->contacts[i].m.count > 0) {
+			world->contacts[contact_count++] = world->contacts[i];
+		}
+	}
+	world->contacts.set_count(contact_count);
+
+	// Join dynamic bodies that touch. Static and kinematic bodies don't join islands, or everything on the ground would be one island.
+	int body_count = world->bodies.count();
+	world->parents.set_count(body_count);
+	for (int i = 0; i < body_count; ++i) world->parents[i] = i;
+	for (int i = 0; i < contact_count; ++i) {
+		CF_PhysicsContact* contact = world->contacts.data() + i;
+		if (contact->a->type == CF_BODY_TYPE_DYNAMIC && contact->b->type == CF_BODY_TYPE_DYNAMIC) {
+			s_union(world->parents, contact->a->index, contact->b->index);
+		}
+	}
+
+	// Number islands in order of their first body.
+	world->islands.clear();
+	world->island_of_root.set_count(body_count);
+	for (int i = 0; i < body_count; ++i) {
+		CF_BodyInternal* body = world->bodies[i];
+		if (body->type != CF_BODY_TYPE_DYNAMIC) continue;
+		int root = s_find(world->parents, i);
+		if (root == i) {
+			world->island_of_root[i] = world->islands.count();
+			CF_PhysicsIsland& island = world->islands.add();
+			island.body_count = 0;
+			island.contact_count = 0;
+			island.awake = false;
+		}
+		CF_PhysicsIsland& island = world->islands[world->island_of_root[root]];
+		island.body_count++;
+		island.awake = island.awake || body->awake;
+	}
+	for (int i = 0; i < contact_count; ++i) {
+		CF_PhysicsContact* contact = world->contacts.data() + i;
+		CF_BodyInternal* dynamic = contact->a->type == CF_BODY_TYPE_DYNAMIC ? contact->a : contact->b;
+		CF_BodyInternal* other = dynamic == contact->a ? contact->b : contact->a;
+		CF_PhysicsIsland& island = world->islands[world->island_of_root[s_find(world->parents, dynamic->index)]];
+		island.contact_count++;
+		// A moving kinematic body pushes sleeping bodies awake.
+		if (other->type == CF_BODY_TYPE_KINEMATIC && other->awake) island.awake = true;
+	}
+
+	// Pack each island's bodies and contacts together, then wake every body in an awake island.
+	int body_offset = 0, contact_offset = 0;
+	for (int i = 0; i < world->islands.count(); ++i) {
+		CF_PhysicsIsland& island = world->islands[i];
+		island.body_offset = body_offset;
+		island.contact_offset = contact_offset;
+		body_offset += island.body_count;
+		contact_offset += island.contact_count;
+		island.body_count = 0;
+		island.contact_count = 0;
+	}
+	world->island_bodies.set_count(body_offset);
+	world->island_contacts.set_count(contact_offset);
+	for (int i = 0; i < body_count; ++i) {
+		CF_BodyInternal* body = world->bodies[i];
+		if (body->type != CF_BODY_TYPE_DYNAMIC) continue;
+		CF_PhysicsIsland& island = world->islands[world->island_of_root[s_find(world->parents, i)]];
+		world->island_bodies[island.body_offset + island.body_count++] = body;
+		if (island.awake && !body->awake) s_wake(body);
+	}
+	for (int i = 0; i < contact_count; ++i) {
+		CF_PhysicsContact* contact = world->contacts.data() + i;
+		CF_BodyInternal* dynamic = contact->a->type == CF_BODY_TYPE_DYNAMIC ? contact->a : contact->b;
+		CF_PhysicsIsland& island = world->islands[world->island_of_root[s_find(world->parents, dynamic->index)]];
+		world->island_contacts[island.contact_offset + island.contact_count++] = i;
+	}
+}
+
+static CF_INLINE CF_V2 s_point_velocity(const CF_BodyInternal* body, CF_V2 r)
+{
+	return cf_add_v2(body->v, cf_cross_f_v2(body->w, r));
+}
+
+// Only dynamic bodies are written to. Static and kinematic bodies are shared between islands solved on different threads.
+static CF_INLINE void s_apply_impulse(CF_BodyInternal* a, CF_BodyInternal* b, CF_V2 ra, CF_V2 rb, CF_V2 p)
+{
+	if (a->type == CF_BODY_TYPE_DYNAMIC) {
+		a->v = cf_sub_v2(a->v, cf_mul_v2_f(p, a->inv_mass));
+		a->w -= a->inv_inertia * cf_cross(ra, p);
+	}
+	if (b->type == CF_BODY_TYPE_DYNAMIC) {
+		b->v = cf_add_v2(b->v, cf_mul_v2_f(p, b->inv_mass));
+		b->w += b->inv_inertia * cf_cross(rb, p);
+	}
+}
+
+static void s_solve_island(CF_PhysicsWorldInternal* world, const CF_PhysicsIsland* island)
+{
+	float dt = world->dt;
+	float inv_dt = 1.0f / dt;
+	float slop = world->params.linear_slop;
+	float bounce_speed = PHYSICS_RESTITUTION_STEPS * cf_len(world->params.gravity) * dt;
+	CF_BodyInternal** bodies = world->island_bodies.data() + island->body_offset;
+	const int* contact_indices = world->island_contacts.data() + island->contact_offset;
+
+	// Precompute effective masses and position correction, then apply last step's impulses.
+	for (int i = 0; i < island->contact_count; ++i) {
+		CF_PhysicsContact* c = world->contacts.data() + contact_indices[i];
+		CF_BodyInternal* a = c->a;
+		CF_BodyInternal* b = c->b;
+		CF_V2 n = c->m.n;
+		CF_V2 t = cf_skew(n);
+		float inv_mass = a->inv_mass + b->inv_mass;
+		for (int j = 0; j < c->m.count; ++j) {
+			CF_V2 p = c->m.contact_points[j];
+			CF_V2 ra = cf_sub_v2(p, a->center);
+			CF_V2 rb = cf_sub_v2(p, b->center);
+			c->ra[j] = ra;
+			c->rb[j] = rb;
+			float rna = cf_cross(ra, n), rnb = cf_cross(rb, n);
+			float rta = cf_cross(ra, t), rtb = cf_cross(rb, t);
+			float kn = inv_mass + a->inv_inertia * rna * rna + b->inv_inertia * rnb * rnb;
+			float kt = inv_mass + a->inv_inertia * rta * rta + b->inv_inertia * rtb * rtb;
+			c->normal_mass[j] = kn > 0 ? 1.0f / kn : 0;
+			c->tangent_mass[j] = kt > 0 ? 1.0f / kt : 0;
+
+			float bias = PHYSICS_BAUMGARTE * inv_dt * cf_max(c->m.depths[j] - slop, 0.0f);
+			float vn = cf_dot(cf_sub_v2(s_point_velocity(b, rb), s_point_velocity(a, ra)), n);
+			if (vn < -bounce_speed) bias = cf_max(bias, -c->restitution * vn);
+			c->bias[j] = bias;
+
+			CF_V2 impulse = cf_add_v2(cf_mul_v2_f(n, c->normal_impulse[j]), cf_mul_v2_f(t, c->tangent_impulse[j]));
+			s_apply_impulse(a, b, ra, rb, impulse);
+		}
+	}
+
+	for (int iter = 0; iter < world->params.velocity_iterations; ++iter) {
+		for (int i = 0; i < island->contact_count; ++i) {
+			CF_PhysicsContact* c = world->contacts.data() + contact_indices[i];
+			CF_BodyInternal* a = c->a;
+			CF_BodyInternal* b = c->b;
+			CF_V2 n = c->m.n;
+			CF_V2 t = cf_skew(n);
+
+			// Friction first, since it's less important than keeping shapes apart.
+			for (int j = 0; j < c->m.count; ++j) {
+				CF_V2 dv = cf_sub_v2(s_point_velocity(b, c->rb[j]), s_point_velocity(a, c->ra[j]));
+				float lambda = -c->tangent_mass[j] * cf_dot(dv, t);
+				float max_friction = c->friction * c->normal_impulse[j];
+				float old_impulse = c->tangent_impulse[j];
+				c->tangent_impulse[j] = cf_clamp(old_impulse + lambda, -max_friction, max_friction);
+				s_apply_impulse(a, b, c->ra[j], c->rb[j], cf_mul_v2_f(t, c->tangent_impulse[j] - old_impulse));
+			}
+
+			for (int j = 0; j < c->m.count; ++j) {
+				CF_V2 dv = cf_sub_v2(s_point_velocity(b, c->rb[j]), s_point_velocity(a, c->ra[j]));
+				float lambda = c->normal_mass[j] * (c->bias[j] - cf_dot(dv, n));
+				float old_impulse = c->normal_impulse[j];
+				c->normal_impulse[j] = cf_max(old_impulse + lambda, 0.0f);
+				s_apply_impulse(a, b, c->ra[j], c->rb[j], cf_mul_v2_f(n, c->normal_impulse[j] - old_impulse));
+			}
+		}
+	}
+
+	// Move the bodies, and put the island to sleep once all of it has held still for long enough.
+	float sleep_linear_sq = world->params.sleep_linear_velocity * world->params.sleep_linear_velocity;
+	float sleep_angular_sq = world->params.sleep_angular_velocity * world->params.sleep_angular_velocity;
+	float min_sleep_time = FLT_MAX;
+	for (int i = 0; i < island->body_count; ++i) {
+		CF_BodyInternal* body = bodies[i];
+		body->center = cf_add_v2(body->center, cf_mul_v2_f(body->v, dt));
+		body->angle += body->w * dt;
+		body->xf.r = cf_sincos_f(body->angle);
+		body->xf.p = cf_sub_v2(body->center, cf_mul_sc_v2(body->xf.r, body->local_center));
+
+		if (cf_len_sq(body->v) > sleep_linear_sq || body->w * body->w > sleep_angular_sq) {
+			body->sleep_time = 0;
+		} else {
+			body->sleep_time += dt;
+		}
+		min_sleep_time = cf_min(min_sleep_time, body->sleep_time);
+	}
+	if (world->params.sleep_enabled && min_sleep_time >= world->params.time_to_sleep) {
+		for (int i = 0; i < island->body_count; ++i) {
+			CF_BodyInternal* body = bodies[i];
+			body->awake = false;
+			body->v = cf_v2(0, 0);
+			body->w = 0;
+		}
+	}
+}
+
+static void CF_CALL s_solve_fn(int begin, int end, void* udata)
+{
+	CF_PhysicsWorldInternal* world = (CF_PhysicsWorldInternal*)udata;
+	for (int i = begin; i < end; ++i) {
+		const CF_PhysicsIsland* island = world->islands.data() + i;
+		if (island->awake) s_solve_island(world, island);
+	}
+}
+
+static void s_update_broadphase(CF_PhysicsWorldInternal* world, float dt)
+{
+	world->moved_leaves.clear();
+	world->moved_aabbs.clear();
+	world->moved_offsets.clear();
+	for (int i = 0; i < world->bodies.count(); ++i) {
+		CF_BodyInternal* body = world->bodies[i];
+		if (body->type == CF_BODY_TYPE_STATIC || !body->awake) continue;
+		if (body->type == CF_BODY_TYPE_KINEMATIC) {
+			body->center = cf_add_v2(body->center, cf_mul_v2_f(body->v, dt));
+			body->angle += body->w * dt;
+			body->xf.r = cf_sincos_f(body->angle);
+			body->xf.p = cf_sub_v2(body->center, cf_mul_sc_v2(body->xf.r, body->local_center));
+		}
+		world->moved_leaves.add(body->leaf);
+		world->moved_aabbs.add(s_body_aabb(body));
+		world->moved_offsets.add(cf_mul_v2_f(body->v, dt));
+	}
+	cf_aabb_tree_update_leaves(world->tree, world->moved_leaves.data(), world->moved_aabbs.data(), world->moved_offsets.data(), world->moved_leaves.count(), PHYSICS_MAX_REINSERTS);
+}
+
+static void s_store_contacts(CF_PhysicsWorldInternal* world)
+{
+	// This step's contacts warm-start the next.
+	Array<CF_PhysicsContact> t;
+	t.steal_from(world->old_contacts);
+	world->old_contacts.steal_from(world->contacts);
+	world->contacts.steal_from(t);
+	world->old_contact_indices.clear();
+	for (int i = 0; i < world->old_contacts.count(); ++i) {
+		world->old_contact_indices.insert(world->old_contacts[i].key, i);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+// World.
+
+CF_PhysicsWorld cf_make_physics_world(const CF_PhysicsWorldParams* params)
+{
+	CF_PhysicsWorldInternal* world = CF_NEW(CF_PhysicsWorldInternal);
+	world->params = params ? *params : cf_physics_world_defaults();
+	world->tree = cf_make_aabb_tree(0);
+	CF_PhysicsWorld result;
+	result.id = (uint64_t)world;
+	return result;
+}
+
+void cf_destroy_physics_world(CF_PhysicsWorld world_handle)
+{
+	CF_PhysicsWorldInternal* world = s_world(world_handle);
+	for (int i = 0; i < world->bodies.count(); ++i) {
+		CF_FREE(world->bodies[i]);
+	}
+	cf_destroy_aabb_tree(world->tree);
+	world->~CF_PhysicsWorldInternal();
+	CF_FREE(world);
+}
+
+void cf_physics_world_step(CF_PhysicsWorld world_handle, float dt)
+{
+	CF_PhysicsWorldInternal* world = s_world(world_handle);
+	if (dt <= 0) return;
+	world->dt = dt;
+
+	s_integrate_velocities(world, dt);
+	s_find_contacts(world);
+	cf_parallel_for(world->params.pool, world->contacts.count(), 32, s_collide_fn, world);
+	s_build_islands(world);
+	cf_parallel_for(world->params.pool, world->islands.count(), 1, s_solve_fn, world);
+	s_update_broadphase(world, dt);
+	s_store_contacts(world);
+}
+
+void cf_physics_world_set_gravity(CF_PhysicsWorld world, CF_V2 gravity)
+{
+	s_world(world)->params.gravity = gravity;
+}
+
+CF_V2 cf_physics_world_get_gravity(CF_PhysicsWorld world)
+{
+	return s_world(world)->params.gravity;
+}
+
+int cf_physics_world_body_count(CF_PhysicsWorld world)
+{
+	return s_world(world)->bodies.count();
+}
+
+int cf_physics_world_awake_body_count(CF_PhysicsWorld world_handle)
+{
+	CF_PhysicsWorldInternal* world = s_world(world_handle);
+	int count = 0;
+	for (int i = 0; i < world->bodies.count(); ++i) {
+		if (world->bodies[i]->awake) count++;
+	}
+	return count;
+}
+
+int cf_physics_world_contact_count(CF_PhysicsWorld world)
+{
+	// Contacts are swapped into `old_contacts` at the end of each step.
+	return s_world(world)->old_contacts.count();
+}
+
+struct CF_PhysicsQuery
+{
+	CF_Aabb aabb;
+	CF_BodyQueryFn* fn;
+	void* udata;
+};
+
+static bool s_query_fn(CF_Leaf leaf, CF_Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	CF_UNUSED(leaf);
+	CF_UNUSED(aabb);
+	CF_BodyInternal* body = (CF_BodyInternal*)leaf_udata;
+	CF_PhysicsQuery* query = (CF_PhysicsQuery*)fn_udata;
+	// The tree holds padded AABBs, check against the shape's own.
+	if (!cf_overlaps(query->aabb, s_body_aabb(body))) return true;
+	CF_Body handle;
+	handle.id = (uint64_t)body;
+	return query->fn(handle, query->udata);
+}
+
+void cf_physics_world_query_aabb(CF_PhysicsWorld world, CF_Aabb aabb, CF_BodyQueryFn* fn, void* udata)
+{
+	CF_PhysicsQuery query;
+	query.aabb = aabb;
+	query.fn = fn;
+	query.udata = udata;
+	cf_aabb_tree_query_aabb(s_world(world)->tree, s_query_fn, aabb, &query);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Bodies.
+
+CF_Body cf_make_body(CF_PhysicsWorld world_handle, const CF_BodyParams* params)
+{
+	CF_PhysicsWorldInternal* world = s_world(world_handle);
+	CF_ASSERT(params->shape);
+	CF_BodyInternal* body = (CF_BodyInternal*)CF_CALLOC(sizeof(CF_BodyInternal));
+	body->world = world;
+	body->serial = world->serial_gen++;
+	body->index = world->bodies.count();
+	body->type = params->type;
+	body->linear_damping = params->linear_damping;
+	body->angular_damping = params->angular_damping;
+	body->fixed_rotation = params->fixed_rotation;
+	body->friction = params->friction;
+	body->restitution = params->restitution;
+	body->udata = params->udata;
+
+	switch (params->shape_type) {
+	case CF_SHAPE_TYPE_CIRCLE:
+		body->shape_type = CF_SHAPE_TYPE_CIRCLE;
+		body->circle = *(const CF_Circle*)params->shape;
+		break;
+
+	case CF_SHAPE_TYPE_CAPSULE:
+		body->shape_type = CF_SHAPE_TYPE_CAPSULE;
+		body->capsule = *(const CF_Capsule*)params->shape;
+		break;
+
+	case CF_SHAPE_TYPE_AABB:
+	{
+		CF_Aabb box = *(const CF_Aabb*)params->shape;
+		body->shape_type = CF_SHAPE_TYPE_POLY;
+		body->poly.count = 4;
+		cf_aabb_verts(body->poly.verts, box);
+		cf_make_poly(&body->poly);
+	}	break;
+
+	case CF_SHAPE_TYPE_POLY:
+		body->shape_type = CF_SHAPE_TYPE_POLY;
+		body->poly = *(const CF_Poly*)params->shape;
+		break;
+
+	default:
+		CF_ASSERT(false);
+		body->shape_type = CF_SHAPE_TYPE_CIRCLE;
+		body->circle = cf_make_circle(cf_v2(0, 0), 0);
+		break;
+	}
+
+	s_compute_mass(body, params->density);
+	s_set_transform(body, params->position, params->angle);
+	if (body->type != CF_BODY_TYPE_STATIC) {
+		body->v = params->velocity;
+		body->w = body->inv_inertia > 0 || body->type == CF_BODY_TYPE_KINEMATIC ? params->angular_velocity : 0;
+		body->awake = true;
+	}
+
+	CF_Aabb aabb = s_body_aabb(body);
+	if (body->type == CF_BODY_TYPE_STATIC) s_wake_near(world, aabb);
+	body->leaf = cf_aabb_tree_insert(world->tree, aabb, body);
+	world->bodies.add(body);
+
+	CF_Body result;
+	result.id = (uint64_t)body;
+	return result;
+}
+
+void cf_destroy_body(CF_Body body_handle)
+{
+	CF_BodyInternal* body = s_body(body_handle);
+	CF_PhysicsWorldInternal* world = body->world;
+	cf_aabb_tree_remove(world->tree, body->leaf);
+	s_wake_near(world, s_body_aabb(body));
+	int index = body->index;
+	world->bodies.unordered_remove(index);
+	if (index < world->bodies.count()) world->bodies[index]->index = index;
+	CF_FREE(body);
+}
+
+CF_BodyType cf_body_get_type(CF_Body body)
+{
+	return s_body(body)->type;
+}
+
+CF_Transform cf_body_get_transform(CF_Body body)
+{
+	return s_body(body)->xf;
+}
+
+void cf_body_set_transform(CF_Body body_handle, CF_V2 position, float angle)
+{
+	CF_BodyInternal* body = s_body(body_handle);
+	CF_PhysicsWorldInternal* world = body->world;
+	s_wake_near(world, s_body_aabb(body));
+	s_set_transform(body, position, angle);
+	CF_Aabb aabb = s_body_aabb(body);
+	cf_aabb_tree_update_leaf(world->tree, body->leaf, aabb);
+	s_wake_near(world, aabb);
+	s_wake(body);
+}
+
+CF_V2 cf_body_get_position(CF_Body body)
+{
+	return s_body(body)->xf.p;
+}
+
+float cf_body_get_angle(CF_Body body)
+{
+	return s_body(body)->angle;
+}
+
+CF_V2 cf_body_get_velocity(CF_Body body)
+{
+	return s_body(body)->v;
+}
+
+void cf_body_set_velocity(CF_Body body_handle, CF_V2 velocity)
+{
+	CF_BodyInternal* body = s_body(body_handle);
+	if (body->type == CF_BODY_TYPE_STATIC) return;
+	body->v = velocity;
+	s_wake(body);
+}
+
+float cf_body_get_angular_velocity(CF_Body body)
+{
+	return s_body(body)->w;
+}
+
+void cf_body_set_angular_velocity(CF_Body body_handle, float angular_velocity)
+{
+	CF_BodyInternal* body = s_body(body_handle);
+	if (body->type == CF_BODY_TYPE_STATIC || body->fixed_rotation) return;
+	body->w = angular_velocity;
+	s_wake(body);
+}
+
+void cf_body_apply_force(CF_Body body_handle, CF_V2 force)
+{
+	CF_BodyInternal* body = s_body(body_handle);
+	if (body->type != CF_BODY_TYPE_DYNAMIC) return;
+	body->force = cf_add_v2(body->force, force);
+	s_wake(body);
+}
+
+void cf_body_apply_impulse(CF_Body body_handle, CF_V2 impulse, CF_V2 point)
+{
+	CF_BodyInternal* body = s_body(body_handle);
+	if (body->type != CF_BODY_TYPE_DYNAMIC) return;
+	body->v = cf_add_v2(body->v, cf_mul_v2_f(impulse, body->inv_mass));
+	body->w += body->inv_inertia * cf_cross(cf_sub_v2(point, body->center), impulse);
+	s_wake(body);
+}
+
+float cf_body_get_mass(CF_Body body)
+{
+	return s_body(body)->mass;
+}
+
+bool cf_body_is_awake(CF_Body body)
+{
+	return s_body(body)->awake;
+}
+
+void cf_body_wake(CF_Body body)
+{
+	s_wake(s_body(body));
+}
+
+void* cf_body_get_udata(CF_Body body)
+{
+	return s_body(body)->udata;
+}
+
+void cf_body_set_udata(CF_Body body, void* udata)
+{
+	s_body(body)->udata = udata;
+}
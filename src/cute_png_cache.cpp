@@ -9,14 +9,23 @@
 #include <cute_image.h>
 #include <cute_sprite.h>
 #include <cute_hashtable.h>
+#include <cute_multithreading.h>
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_png_cache_internal.h>
 #include <internal/cute_app_internal.h>
 
+// How to decode a png loaded from memory again, after its pixels were dropped.
+struct CF_PngSource
+{
+	void* data;
+	size_t size;
+};
+
 struct CF_PngCache
 {
 	htbl void** id_to_pixels = NULL;
+	htbl CF_PngSource* sources = NULL;
 	dyna CF_Animation** animations = NULL;
 	htbl CF_Animation*** animation_tables = NULL;
 	htbl CF_Png* pngs = NULL;
@@ -25,14 +34,93 @@ struct CF_PngCache
 
 CF_GLOBAL static CF_PngCache* cache;
 
+// Decodes a png again after its pixels were dropped by `cf_png_cache_drop_pixels`.
+static void* s_redecode(uint64_t image_id)
+{
+	CF_Png* png = hget_ptr(cache->pngs, image_id);
+	CF_Image img;
+	CF_Result err;
+	if (hhas(cache->sources, image_id)) {
+		CF_PngSource source = hget(cache->sources, image_id);
+		err = cf_image_load_png_from_memory(source.data, (int)source.size, &img);
+	} else {
+		err = cf_image_load_png_premultiplied(png->path, &img);
+	}
+	if (cf_is_error(err)) return NULL;
+	if (img.w != png->w || img.h != png->h) {
+		cf_image_free(&img);
+		return NULL;
+	}
+	png->pix = img.pix;
+	*hget_ptr(cache->id_to_pixels, image_id) = img.pix;
+	return img.pix;
+}
+
 void cf_png_cache_get_pixels(uint64_t image_id, void* buffer, int bytes_to_fill)
 {
 	void* pixels = hget(cache->id_to_pixels, image_id);
+	if (!pixels && hhas(cache->id_to_pixels, image_id)) {
+		pixels = s_redecode(image_id);
+	}
 	if (!pixels) {
 		CF_DEBUG_PRINTF("png cache -- unable to find id %lld.", (long long int)image_id);
 		CF_MEMSET(buffer, 0, bytes_to_fill);
 	} else {
 		CF_MEMCPY(buffer, pixels, bytes_to_fill);
+		CF_Png png = hget(cache->pngs, image_id);
+		cf_image_pixels_used(image_id, sizeof(CF_Pixel) * png.w * png.h);
+	}
+}
+
+bool cf_png_cache_drop_pixels(uint64_t image_id)
+{
+	CF_Png* png = hget_ptr(cache->pngs, image_id);
+	if (!png || !png->pix) return false;
+	// Pngs loaded from memory without a copy of their file have nothing to decode again from.
+	if (hhas(cache->sources, image_id) && !hget(cache->sources, image_id).data) return false;
+	CF_Image img;
+	img.pix = png->pix;
+	img.w = png->w;
+	img.h = png->h;
+	cf_image_free(&img);
+	png->pix = NULL;
+	*hget_ptr(cache->id_to_pixels, image_id) = NULL;
+	return true;
+}
+
+// Paths match with or without their leading slash.
+static bool s_same_path(const char* a, const char* b)
+{
+	if (*a == '/') ++a;
+	if (*b == '/') ++b;
+	return !CF_STRCMP(a, b);
+}
+
+void cf_png_cache_file_changed(const char* virtual_path)
+{
+	if (!cache) return;
+	for (int i = 0; i < hcount(cache->pngs); ++i) {
+		CF_Png* png = cache->pngs + i;
+		if (hhas(cache->sources, png->id) || !s_same_path(png->path, virtual_path)) continue;
+
+		CF_Image img;
+		CF_Result err = cf_image_load_png_premultiplied(png->path, &img);
+		if (cf_is_error(err)) continue;
+		if (img.w != png->w || img.h != png->h) {
+			// Sprites and draw calls already sized for the old image can't take on new dimensions.
+			CF_DEBUG_PRINTF("png cache -- can't reload \"%s\", its size changed.\n", png->path);
+			cf_image_free(&img);
+			continue;
+		}
+
+		CF_Image old = { };
+		old.pix = png->pix;
+		old.w = png->w;
+		old.h = png->h;
+		if (old.pix) cf_image_free(&old);
+		png->pix = img.pix;
+		*hget_ptr(cache->id_to_pixels, png->id) = img.pix;
+		if (draw) spritebatch_invalidate(&draw->sb, png->id);
 	}
 }
 
@@ -60,6 +148,7 @@ void cf_destroy_png_cache()
 		cf_png_cache_unload(png);
 	}
 	hfree(cache->pngs);
+	hfree(cache->sources);
 	hfree(cache->id_to_pixels);
 
 	CF_FREE(cache);
@@ -69,9 +158,8 @@ void cf_destroy_png_cache()
 CF_Result cf_png_cache_load(const char* png_path, CF_Png* png)
 {
 	CF_Image img;
-	CF_Result err = cf_image_load_png(png_path, &img);
+	CF_Result err = cf_image_load_png_premultiplied(png_path, &img);
 	if (cf_is_error(err)) return err;
-	cf_image_premultiply(&img);
 	CF_Png entry;
 	entry.path = sintern(png_path);
 	entry.id = cache->id_gen++;
@@ -84,6 +172,66 @@ CF_Result cf_png_cache_load(const char* png_path, CF_Png* png)
 	return cf_result_success();
 }
 
+struct CF_PngLoad
+{
+	const char* path;
+	CF_Image img;
+	CF_Result result;
+};
+
+static void s_png_load_task(void* udata)
+{
+	CF_PngLoad* load = (CF_PngLoad*)udata;
+	load->result = cf_image_load_png_premultiplied(load->path, &load->img);
+}
+
+CF_Result cf_png_cache_load_batch(const char** png_paths, int count, CF_Png* pngs)
+{
+	Cute::Array<CF_PngLoad> loads;
+	loads.ensure_count(count);
+	for (int i = 0; i < count; ++i) {
+		loads[i].path = sintern(png_paths[i]);
+		loads[i].img = { };
+		loads[i].result = cf_result_success();
+	}
+
+	// Read, decode and premultiply each png on the threadpool.
+	CF_Threadpool* pool = app ? app->threadpool : NULL;
+	if (pool && count > 1) {
+		CF_AtomicInt counter = { 0 };
+		for (int i = 0; i < count; ++i) {
+			cf_threadpool_add_dependent_task(pool, s_png_load_task, loads + i, NULL, 0, &counter);
+		}
+		cf_threadpool_kick(pool);
+		cf_threadpool_wait_counter(pool, &counter);
+	} else {
+		for (int i = 0; i < count; ++i) {
+			s_png_load_task(loads + i);
+		}
+	}
+
+	// Then add all of them to the cache at once, in order.
+	CF_Result result = cf_result_success();
+	for (int i = 0; i < count; ++i) {
+		CF_PngLoad* load = loads + i;
+		if (cf_is_error(load->result)) {
+			if (!cf_is_error(result)) result = load->result;
+			if (pngs) pngs[i] = cf_png_defaults();
+			continue;
+		}
+		CF_Png entry;
+		entry.path = load->path;
+		entry.id = cache->id_gen++;
+		entry.pix = load->img.pix;
+		entry.w = load->img.w;
+		entry.h = load->img.h;
+		hadd(cache->id_to_pixels, entry.id, load->img.pix);
+		hadd(cache->pngs, entry.id, entry);
+		if (pngs) pngs[i] = entry;
+	}
+	return result;
+}
+
 CF_Result cf_png_cache_load_from_memory(const char* png_path, const void* memory, size_t size, CF_Png* png)
 {
 	CF_Image img;
@@ -97,19 +245,37 @@ CF_Result cf_png_cache_load_from_memory(const char* png_path, const void* memory
 	entry.h = img.h;
 	hadd(cache->id_to_pixels, entry.id, img.pix);
 	hadd(cache->pngs, entry.id, entry);
+
+	// With a pixel budget keep the file around, to decode again if the pixels get dropped.
+	CF_PngSource source = { };
+	if (app && app->pixel_budget) {
+		source.data = CF_ALLOC(size);
+		source.size = size;
+		CF_MEMCPY(source.data, memory, size);
+	}
+	hadd(cache->sources, entry.id, source);
+
 	if (png) *png = entry;
 	return cf_result_success();
 }
 
 void cf_png_cache_unload(CF_Png png)
 {
+	// Free the cached pixels, as `png.pix` may be out of date if they were dropped and decoded again.
+	CF_Png* entry = hget_ptr(cache->pngs, png.id);
+	if (!entry) return;
 	CF_Image img;
-	img.pix = png.pix;
-	img.w = png.w;
-	img.h = png.h;
-	cf_image_free(&img);
+	img.pix = entry->pix;
+	img.w = entry->w;
+	img.h = entry->h;
+	if (img.pix) cf_image_free(&img);
+	if (hhas(cache->sources, png.id)) {
+		CF_FREE(hget(cache->sources, png.id).data);
+		hdel(cache->sources, png.id);
+	}
 	hdel(cache->id_to_pixels, png.id);
 	hdel(cache->pngs, png.id);
+	cf_image_pixels_forget(png.id);
 }
 
 const CF_Animation* cf_make_png_cache_animation(const char* name, const CF_Png* pngs, int pngs_count, const float* delays, int delays_count)
@@ -0,0 +1,206 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_profile.h>
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+#include <cute_file_system.h>
+#include <cute_multithreading.h>
+#include <cute_string.h>
+#include <cute_time.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_profile_internal.h>
+
+using namespace Cute;
+
+// Each thread records finished zones into its own SPSC queue, so recording never takes a lock. The queues
+// are drained into one big list once a frame by `cf_app_update`, and whenever the trace is saved.
+
+#define CF_PROFILE_QUEUE_CAPACITY 8192
+#define CF_PROFILE_MAX_DEPTH 64
+
+struct CF_ProfileEvent
+{
+	const char* name;
+	uint64_t begin;
+	uint64_t end;
+};
+
+struct CF_ProfileThread
+{
+	int index;
+	CF_SPSCQueue* queue;
+	// Zones begun but not yet ended. Zones nested deeper than the max are counted, but not recorded.
+	int depth;
+	const char* names[CF_PROFILE_MAX_DEPTH];
+	uint64_t starts[CF_PROFILE_MAX_DEPTH];
+};
+
+struct CF_ProfileRecord
+{
+	CF_ProfileEvent event;
+	int thread;
+};
+
+struct CF_Profiler
+{
+	CF_AtomicInt enabled;
+	// Bumped whenever the thread list is freed, so threads know to register again.
+	CF_AtomicInt generation;
+	// Guards everything below. Only taken when a thread registers, and when draining the queues.
+	CF_Mutex lock;
+	uint64_t start_ticks;
+	Array<CF_ProfileThread*> threads;
+	Array<CF_ProfileRecord> records;
+};
+
+static CF_Profiler s_profiler;
+static thread_local CF_ProfileThread* s_thread;
+static thread_local int s_thread_generation;
+
+static void s_lock()
+{
+	cf_mutex_lock(&s_profiler.lock);
+}
+
+static void s_unlock()
+{
+	cf_mutex_unlock(&s_profiler.lock);
+}
+
+static CF_ProfileThread* s_profile_thread()
+{
+	int generation = cf_atomic_get(&s_profiler.generation);
+	if (s_thread && s_thread_generation == generation) return s_thread;
+	CF_ProfileThread* thread = (CF_ProfileThread*)CF_ALLOC(sizeof(CF_ProfileThread));
+	CF_MEMSET(thread, 0, sizeof(CF_ProfileThread));
+	thread->queue = cf_make_spsc_queue(CF_PROFILE_QUEUE_CAPACITY, sizeof(CF_ProfileEvent));
+	s_lock();
+	thread->index = s_profiler.threads.count();
+	s_profiler.threads.add(thread);
+	s_unlock();
+	s_thread = thread;
+	s_thread_generation = generation;
+	return thread;
+}
+
+// Call with the lock held.
+static void s_drain(bool keep)
+{
+	for (int i = 0; i < s_profiler.threads.count(); ++i) {
+		CF_ProfileThread* thread = s_profiler.threads[i];
+		CF_ProfileRecord record;
+		record.thread = thread->index;
+		while (cf_spsc_queue_pop(thread->queue, &record.event)) {
+			// Zones begun before the recording started are only partly recorded.
+			if (keep && record.event.begin >= s_profiler.start_ticks) s_profiler.records.add(record);
+		}
+	}
+}
+
+void cf_profile_enable(bool enabled)
+{
+	s_lock();
+	if (enabled && !cf_atomic_get(&s_profiler.enabled)) {
+		s_drain(false);
+		s_profiler.records.clear();
+		s_profiler.start_ticks = cf_get_ticks();
+	}
+	cf_atomic_set(&s_profiler.enabled, enabled ? 1 : 0);
+	s_unlock();
+}
+
+bool cf_profile_is_enabled()
+{
+	return !!cf_atomic_get(&s_profiler.enabled);
+}
+
+void cf_profile_begin(const char* name)
+{
+	if (!cf_atomic_get(&s_profiler.enabled)) return;
+	CF_ProfileThread* thread = s_profile_thread();
+	if (thread->depth < CF_PROFILE_MAX_DEPTH) {
+		thread->names[thread->depth] = name;
+		thread->starts[thread->depth] = cf_get_ticks();
+	}
+	thread->depth++;
+}
+
+void cf_profile_end()
+{
+	// Zones that began while recording was off were never counted.
+	CF_ProfileThread* thread = s_thread;
+	if (!thread || s_thread_generation != cf_atomic_get(&s_profiler.generation) || !thread->depth) return;
+	int depth = --thread->depth;
+	if (depth >= CF_PROFILE_MAX_DEPTH || !cf_atomic_get(&s_profiler.enabled)) return;
+	CF_ProfileEvent event;
+	event.name = thread->names[depth];
+	event.begin = thread->starts[depth];
+	event.end = cf_get_ticks();
+	// Dropped if the queue is full, which only happens when nobody drains it for a long while.
+	cf_spsc_queue_push(thread->queue, &event);
+}
+
+static void s_append_string(char*& s, const char* str)
+{
+	for (const char* c = str; *c; ++c) {
+		if (*c == '"' || *c == '\\') spush(s, '\\');
+		if ((unsigned char)*c >= 0x20) spush(s, *c);
+	}
+}
+
+CF_Result cf_profile_save_chrome_trace(const char* virtual_path)
+{
+	char* s = NULL;
+	sappend(s, "{\"traceEvents\":[\n");
+	s_lock();
+	s_drain(true);
+	double us_per_tick = 1000000.0 / (double)cf_get_tick_frequency();
+	for (int i = 0; i < s_profiler.threads.count(); ++i) {
+		sfmt_append(s, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}},\n", i, i);
+	}
+	for (int i = 0; i < s_profiler.records.count(); ++i) {
+		const CF_ProfileRecord& record = s_profiler.records[i];
+		double ts = (double)(record.event.begin - s_profiler.start_ticks) * us_per_tick;
+		double dur = (double)(record.event.end - record.event.begin) * us_per_tick;
+		sappend(s, "{\"name\":\"");
+		s_append_string(s, record.event.name);
+		sfmt_append(s, "\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f},\n", record.thread, ts, dur);
+	}
+	s_unlock();
+	// JSON doesn't allow a trailing comma, so close the list with the process name.
+	sappend(s, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"Cute Framework\"}}\n]}\n");
+	CF_Result result = cf_fs_write_entire_buffer_to_file(virtual_path, s, (size_t)slen(s));
+	sfree(s);
+	return result;
+}
+
+void cf_profile_collect()
+{
+	if (!cf_atomic_get(&s_profiler.enabled)) return;
+	s_lock();
+	s_drain(true);
+	s_unlock();
+}
+
+void cf_profile_shutdown()
+{
+	s_lock();
+	cf_atomic_set(&s_profiler.enabled, 0);
+	cf_atomic_add(&s_profiler.generation, 1);
+	for (int i = 0; i < s_profiler.threads.count(); ++i) {
+		cf_destroy_spsc_queue(s_profiler.threads[i]->queue);
+		CF_FREE(s_profiler.threads[i]);
+	}
+	// Steal the lists into locals to free their memory on the way out.
+	Array<CF_ProfileThread*> threads;
+	Array<CF_ProfileRecord> records;
+	threads.steal_from(&s_profiler.threads);
+	records.steal_from(&s_profiler.records);
+	s_unlock();
+}
@@ -0,0 +1,475 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_replay.h>
+#include <cute_alloc.h>
+#include <cute_file_system.h>
+#include <cute_joypad.h>
+#include <cute_c_runtime.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_app_internal.h>
+#include <internal/cute_input_internal.h>
+#include <internal/cute_replay_internal.h>
+
+using namespace Cute;
+
+#define CF_REPLAY_DEFAULT_MAX_BYTES (16 * 1024 * 1024)
+#define CF_REPLAY_SEGMENT_STEPS 256
+#define CF_REPLAY_MAX_SNAPSHOT_SIZE (16 * 1024 * 1024)
+#define CF_REPLAY_MAGIC 0x50524643 // "CFRP"
+#define CF_REPLAY_VERSION 1
+
+//--------------------------------------------------------------------------------------------------
+// Snapshots of the input and time globals.
+
+static void s_write(Array<uint8_t>& out, const void* data, int size)
+{
+	if (!size) return;
+	int at = out.count();
+	out.ensure_count(at + size);
+	CF_MEMCPY(out.data() + at, data, size);
+}
+
+static bool s_read(const uint8_t*& in, const uint8_t* end, void* data, int size)
+{
+	if (end - in < size) return false;
+	if (!size) return true;
+	CF_MEMCPY(data, in, size);
+	in += size;
+	return true;
+}
+
+static bool s_read_count(const uint8_t*& in, const uint8_t* end, int element_size, int* count)
+{
+	if (!s_read(in, end, count, sizeof(int))) return false;
+	return *count >= 0 && *count <= (end - in) / element_size;
+}
+
+static int s_joypad_count()
+{
+	int count = 0;
+	for (CF_ListNode* n = cf_list_begin(&app->joypads); n != cf_list_end(&app->joypads); n = n->next) ++count;
+	return count;
+}
+
+static CF_JoypadInstance* s_joypad_at(int index)
+{
+	for (CF_ListNode* n = cf_list_begin(&app->joypads); n != cf_list_end(&app->joypads); n = n->next) {
+		if (!index--) return CF_LIST_HOST(CF_JoypadInstance, node, n);
+	}
+	return NULL;
+}
+
+// Joypad handles are pointers, so events store the joypad's position in the list instead, plus one.
+static uint64_t s_joypad_to_index(CF_Joypad joypad)
+{
+	int index = 0;
+	for (CF_ListNode* n = cf_list_begin(&app->joypads); n != cf_list_end(&app->joypads); n = n->next, ++index) {
+		if ((uint64_t)CF_LIST_HOST(CF_JoypadInstance, node, n) == joypad.id) return index + 1;
+	}
+	return 0;
+}
+
+static void s_write_snapshot(Array<uint8_t>& out)
+{
+	out.clear();
+	// `CF_SECONDS` comes from the ticks, and the previous time is always the time of the step before.
+	uint64_t frequency = cf_get_tick_frequency();
+	s_write(out, &CF_TICKS, sizeof(CF_TICKS));
+	s_write(out, &frequency, sizeof(frequency));
+	s_write(out, &CF_DELTA_TIME, sizeof(CF_DELTA_TIME));
+	s_write(out, &CF_DELTA_TIME_FIXED, sizeof(CF_DELTA_TIME_FIXED));
+
+	uint8_t keys[CF_ARRAY_SIZE(app->keys)];
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(keys); ++i) keys[i] = (uint8_t)app->keys[i];
+	s_write(out, keys, sizeof(keys));
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(keys); ++i) keys[i] = (uint8_t)app->keys_prev[i];
+	s_write(out, keys, sizeof(keys));
+	s_write(out, app->keys_timestamp, sizeof(app->keys_timestamp));
+	s_write(out, &app->mouse, sizeof(app->mouse));
+	s_write(out, &app->mouse_prev, sizeof(app->mouse_prev));
+	s_write(out, &app->window_state, sizeof(app->window_state));
+	s_write(out, &app->window_state_prev, sizeof(app->window_state_prev));
+
+	int joypad_count = s_joypad_count();
+	s_write(out, &joypad_count, sizeof(joypad_count));
+	for (CF_ListNode* n = cf_list_begin(&app->joypads); n != cf_list_end(&app->joypads); n = n->next) {
+		CF_JoypadInstance* joypad = CF_LIST_HOST(CF_JoypadInstance, node, n);
+		s_write(out, joypad->buttons, sizeof(joypad->buttons));
+		s_write(out, joypad->buttons_prev, sizeof(joypad->buttons_prev));
+		s_write(out, joypad->axes, sizeof(joypad->axes));
+	}
+
+	int text_count = app->input_text.count();
+	s_write(out, &text_count, sizeof(text_count));
+	s_write(out, app->input_text.data(), sizeof(int) * text_count);
+
+	int touch_count = app->touches.count();
+	s_write(out, &touch_count, sizeof(touch_count));
+	s_write(out, app->touches.data(), sizeof(CF_Touch) * touch_count);
+
+	int event_count = app->input_events.count();
+	s_write(out, &event_count, sizeof(event_count));
+	for (int i = 0; i < event_count; ++i) {
+		CF_InputEvent event = app->input_events[i];
+		event.joypad.id = s_joypad_to_index(event.joypad);
+		s_write(out, &event, sizeof(event));
+	}
+}
+
+static bool s_read_snapshot(const Array<uint8_t>& snapshot)
+{
+	const uint8_t* in = snapshot.data();
+	const uint8_t* end = in + snapshot.count();
+
+	uint64_t ticks, frequency;
+	float dt, dt_fixed;
+	if (!s_read(in, end, &ticks, sizeof(ticks))) return false;
+	if (!s_read(in, end, &frequency, sizeof(frequency)) || !frequency) return false;
+	if (!s_read(in, end, &dt, sizeof(dt))) return false;
+	if (!s_read(in, end, &dt_fixed, sizeof(dt_fixed))) return false;
+	// Same math as stepping time in `cf_update_time`, so `CF_SECONDS` comes out bit for bit.
+	CF_PREV_TICKS = CF_TICKS;
+	CF_TICKS = ticks;
+	CF_PREV_SECONDS = CF_SECONDS;
+	CF_SECONDS = ticks * (1.0 / (double)frequency);
+	CF_DELTA_TIME = dt;
+	CF_DELTA_TIME_FIXED = dt_fixed;
+
+	uint8_t keys[CF_ARRAY_SIZE(app->keys)];
+	if (!s_read(in, end, keys, sizeof(keys))) return false;
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(keys); ++i) app->keys[i] = keys[i];
+	if (!s_read(in, end, keys, sizeof(keys))) return false;
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(keys); ++i) app->keys_prev[i] = keys[i];
+	if (!s_read(in, end, app->keys_timestamp, sizeof(app->keys_timestamp))) return false;
+	if (!s_read(in, end, &app->mouse, sizeof(app->mouse))) return false;
+	if (!s_read(in, end, &app->mouse_prev, sizeof(app->mouse_prev))) return false;
+	if (!s_read(in, end, &app->window_state, sizeof(app->window_state))) return false;
+	if (!s_read(in, end, &app->window_state_prev, sizeof(app->window_state_prev))) return false;
+
+	int joypad_count;
+	if (!s_read(in, end, &joypad_count, sizeof(joypad_count)) || joypad_count < 0) return false;
+	for (int i = 0; i < joypad_count; ++i) {
+		CF_JoypadInstance recorded;
+		if (!s_read(in, end, recorded.buttons, sizeof(recorded.buttons))) return false;
+		if (!s_read(in, end, recorded.buttons_prev, sizeof(recorded.buttons_prev))) return false;
+		if (!s_read(in, end, recorded.axes, sizeof(recorded.axes))) return false;
+		CF_JoypadInstance* joypad = s_joypad_at(i);
+		if (!joypad) continue;
+		CF_MEMCPY(joypad->buttons, recorded.buttons, sizeof(joypad->buttons));
+		CF_MEMCPY(joypad->buttons_prev, recorded.buttons_prev, sizeof(joypad->buttons_prev));
+		CF_MEMCPY(joypad->axes, recorded.axes, sizeof(joypad->axes));
+	}
+
+	int text_count;
+	if (!s_read_count(in, end, sizeof(int), &text_count)) return false;
+	app->input_text.set_count(text_count);
+	s_read(in, end, app->input_text.data(), sizeof(int) * text_count);
+
+	int touch_count;
+	if (!s_read_count(in, end, sizeof(CF_Touch), &touch_count)) return false;
+	app->touches.set_count(touch_count);
+	s_read(in, end, app->touches.data(), sizeof(CF_Touch) * touch_count);
+
+	int event_count;
+	if (!s_read_count(in, end, sizeof(CF_InputEvent), &event_count)) return false;
+	app->input_events.set_count(event_count);
+	for (int i = 0; i < event_count; ++i) {
+		CF_InputEvent& event = app->input_events[i];
+		s_read(in, end, &event, sizeof(event));
+		CF_JoypadInstance* joypad = event.joypad.id ? s_joypad_at((int)event.joypad.id - 1) : NULL;
+		event.joypad.id = (uint64_t)joypad;
+	}
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Step encoding.
+//
+// A step is stored as its snapshot xor'd against the snapshot of the step before it, which is
+// mostly zeroes as little changes from one update to the next. The xor is written as its size,
+// then pairs of (zero run length, literal run length) followed by the literal bytes, all lengths
+// as LEB128 varints.
+
+static void s_write_varint(Array<uint8_t>& out, uint32_t value)
+{
+	while (value >= 0x80) {
+		out.add((uint8_t)(value | 0x80));
+		value >>= 7;
+	}
+	out.add((uint8_t)value);
+}
+
+static bool s_read_varint(const uint8_t*& in, const uint8_t* end, uint32_t* value)
+{
+	uint32_t result = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (in == end) return false;
+		uint8_t byte = *in++;
+		result |= (uint32_t)(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+
+// `prev` is zero extended or truncated to the size of `snapshot`, so the two line up byte for byte.
+static void s_encode(Array<uint8_t>& out, const Array<uint8_t>& snapshot, Array<uint8_t>& prev)
+{
+	int size = snapshot.count();
+	prev.set_count(size);
+	const uint8_t* a = snapshot.data();
+	const uint8_t* b = prev.data();
+	s_write_varint(out, (uint32_t)size);
+	int i = 0;
+	while (i < size) {
+		int start = i;
+		while (i < size && a[i] == b[i]) ++i;
+		int zeros = i - start;
+		start = i;
+		// A literal run ends at two unchanged bytes in a row. Keeping a lone unchanged byte costs less than starting a new pair.
+		while (i < size && !(a[i] == b[i] && (i + 1 == size || a[i + 1] == b[i + 1]))) ++i;
+		s_write_varint(out, (uint32_t)zeros);
+		s_write_varint(out, (uint32_t)(i - start));
+		for (int j = start; j < i; ++j) {
+			out.add(a[j] ^ b[j]);
+		}
+	}
+}
+
+// Decodes a step on top of `prev`, leaving the step's snapshot in it.
+static bool s_decode(const uint8_t*& in, const uint8_t* end, Array<uint8_t>& prev)
+{
+	uint32_t size;
+	if (!s_read_varint(in, end, &size) || size > CF_REPLAY_MAX_SNAPSHOT_SIZE) return false;
+	prev.set_count((int)size);
+	uint8_t* b = prev.data();
+	uint32_t pos = 0;
+	while (pos < size) {
+		uint32_t zeros, literals;
+		if (!s_read_varint(in, end, &zeros) || !s_read_varint(in, end, &literals)) return false;
+		if (zeros > size - pos) return false;
+		pos += zeros;
+		if (literals > size - pos || literals > (uint32_t)(end - in)) return false;
+		for (uint32_t j = 0; j < literals; ++j) {
+			b[pos + j] ^= in[j];
+		}
+		in += literals;
+		pos += literals;
+	}
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+// Segments.
+
+static CF_ReplaySegment* s_new_segment(CF_ReplayInternal* replay)
+{
+	CF_ReplaySegment* segment = replay->spare;
+	if (segment) {
+		replay->spare = NULL;
+		segment->bytes.clear();
+		segment->step_count = 0;
+	} else {
+		segment = CF_NEW(CF_ReplaySegment);
+	}
+	replay->segments.add(segment);
+	return segment;
+}
+
+static void s_free_segment(CF_ReplaySegment* segment)
+{
+	if (!segment) return;
+	segment->~CF_ReplaySegment();
+	CF_FREE(segment);
+}
+
+static void s_drop_oldest_segment(CF_ReplayInternal* replay)
+{
+	CF_ReplaySegment* segment = replay->segments[0];
+	replay->byte_count -= segment->bytes.count();
+	replay->step_count -= segment->step_count;
+	int remaining = replay->segments.count() - 1;
+	CF_MEMMOVE(replay->segments.data(), replay->segments.data() + 1, sizeof(CF_ReplaySegment*) * remaining);
+	replay->segments.set_count(remaining);
+	s_free_segment(replay->spare);
+	replay->spare = segment;
+}
+
+static void s_clear(CF_ReplayInternal* replay)
+{
+	while (replay->segments.count()) {
+		s_drop_oldest_segment(replay);
+	}
+	replay->prev.clear();
+	replay->play_segment = 0;
+	replay->play_offset = 0;
+}
+
+void cf_replay_capture(CF_ReplayInternal* replay)
+{
+	s_write_snapshot(replay->snapshot);
+
+	CF_ReplaySegment* segment = replay->segments.count() ? replay->segments.last() : NULL;
+	if (!segment || segment->step_count == CF_REPLAY_SEGMENT_STEPS) {
+		segment = s_new_segment(replay);
+		replay->prev.clear();
+	}
+	int before = segment->bytes.count();
+	s_encode(segment->bytes, replay->snapshot, replay->prev);
+	CF_MEMCPY(replay->prev.data(), replay->snapshot.data(), replay->snapshot.count());
+	segment->step_count++;
+	replay->step_count++;
+	replay->byte_count += segment->bytes.count() - before;
+
+	// The segment being written to is always kept, even if it alone is over budget.
+	while (replay->byte_count > replay->max_bytes && replay->segments.count() > 1) {
+		s_drop_oldest_segment(replay);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Public API.
+
+CF_Replay cf_make_replay(int max_bytes)
+{
+	CF_ReplayInternal* replay = CF_NEW(CF_ReplayInternal);
+	replay->max_bytes = max_bytes > 0 ? max_bytes : CF_REPLAY_DEFAULT_MAX_BYTES;
+	CF_Replay result;
+	result.id = (uint64_t)replay;
+	return result;
+}
+
+void cf_destroy_replay(CF_Replay replay_handle)
+{
+	CF_ReplayInternal* replay = cf_replay_internal(replay_handle);
+	if (!replay) return;
+	if (app && app->replay_recording == replay) app->replay_recording = NULL;
+	for (int i = 0; i < replay->segments.count(); ++i) {
+		s_free_segment(replay->segments[i]);
+	}
+	s_free_segment(replay->spare);
+	replay->~CF_ReplayInternal();
+	CF_FREE(replay);
+}
+
+void cf_replay_start_recording(CF_Replay replay_handle)
+{
+	CF_ReplayInternal* replay = cf_replay_internal(replay_handle);
+	s_clear(replay);
+	app->replay_recording = replay;
+}
+
+void cf_replay_stop_recording()
+{
+	app->replay_recording = NULL;
+}
+
+int cf_replay_step_count(CF_Replay replay)
+{
+	return cf_replay_internal(replay)->step_count;
+}
+
+int cf_replay_size(CF_Replay replay)
+{
+	return cf_replay_internal(replay)->byte_count;
+}
+
+void cf_replay_rewind(CF_Replay replay_handle)
+{
+	CF_ReplayInternal* replay = cf_replay_internal(replay_handle);
+	replay->play_segment = 0;
+	replay->play_offset = 0;
+}
+
+bool cf_replay_step(CF_Replay replay_handle, CF_OnUpdateFn* on_update)
+{
+	CF_ReplayInternal* replay = cf_replay_internal(replay_handle);
+	CF_ASSERT(app->replay_recording != replay);
+	if (replay->play_segment >= replay->segments.count()) return false;
+
+	CF_ReplaySegment* segment = replay->segments[replay->play_segment];
+	if (replay->play_offset == 0) replay->prev.clear();
+	const uint8_t* in = segment->bytes.data() + replay->play_offset;
+	const uint8_t* end = segment->bytes.data() + segment->bytes.count();
+	if (!s_decode(in, end, replay->prev) || !s_read_snapshot(replay->prev)) {
+		// Corrupted, there's no telling where the next step starts.
+		replay->play_segment = replay->segments.count();
+		return false;
+	}
+	replay->play_offset = (int)(in - segment->bytes.data());
+	if (replay->play_offset == segment->bytes.count()) {
+		replay->play_segment++;
+		replay->play_offset = 0;
+	}
+
+	if (on_update) on_update(app->update_udata);
+	return true;
+}
+
+CF_Result cf_replay_save(CF_Replay replay_handle, const char* virtual_path)
+{
+	CF_ReplayInternal* replay = cf_replay_internal(replay_handle);
+	Array<uint8_t> file;
+	uint32_t header[2] = { CF_REPLAY_MAGIC, CF_REPLAY_VERSION };
+	s_write(file, header, sizeof(header));
+	int segment_count = replay->segments.count();
+	s_write(file, &segment_count, sizeof(segment_count));
+	for (int i = 0; i < segment_count; ++i) {
+		CF_ReplaySegment* segment = replay->segments[i];
+		int byte_count = segment->bytes.count();
+		s_write(file, &segment->step_count, sizeof(segment->step_count));
+		s_write(file, &byte_count, sizeof(byte_count));
+		s_write(file, segment->bytes.data(), byte_count);
+	}
+	return cf_fs_write_entire_buffer_to_file(virtual_path, file.data(), (size_t)file.count());
+}
+
+CF_Replay cf_replay_load(const char* virtual_path, CF_Result* result_out)
+{
+	CF_Replay result = { 0 };
+	size_t size = 0;
+	uint8_t* data = (uint8_t*)cf_fs_read_entire_file_to_memory(virtual_path, &size);
+	if (!data) {
+		if (result_out) *result_out = cf_result_error("Unable to read replay file.");
+		return result;
+	}
+
+	const uint8_t* in = data;
+	const uint8_t* end = data + size;
+	uint32_t header[2];
+	int segment_count;
+	bool ok = s_read(in, end, header, sizeof(header)) && header[0] == CF_REPLAY_MAGIC && header[1] == CF_REPLAY_VERSION;
+	ok = ok && s_read(in, end, &segment_count, sizeof(segment_count)) && segment_count >= 0;
+	CF_ReplayInternal* replay = cf_replay_internal(cf_make_replay(0));
+	for (int i = 0; ok && i < segment_count; ++i) {
+		int step_count, byte_count;
+		ok = s_read(in, end, &step_count, sizeof(step_count)) && step_count > 0;
+		ok = ok && s_read_count(in, end, 1, &byte_count);
+		if (!ok) break;
+		CF_ReplaySegment* segment = s_new_segment(replay);
+		segment->step_count = step_count;
+		segment->bytes.set_count(byte_count);
+		s_read(in, end, segment->bytes.data(), byte_count);
+		replay->step_count += step_count;
+		replay->byte_count += byte_count;
+	}
+	CF_FREE(data);
+
+	result.id = (uint64_t)replay;
+	if (!ok) {
+		cf_destroy_replay(result);
+		if (result_out) *result_out = cf_result_error("Not a valid replay file.");
+		result.id = 0;
+		return result;
+	}
+	if (result_out) *result_out = cf_result_success();
+	return result;
+}
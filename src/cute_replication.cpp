@@ -0,0 +1,505 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_replication.h>
+#include <cute_alloc.h>
+#include <cute_array.h>
+#include <cute_bitstream.h>
+#include <cute_c_runtime.h>
+
+#include <algorithm>
+
+using namespace Cute;
+
+// Packets fit in a single unfragmented datagram, see CN_TRANSPORT_MAX_FRAGMENT_SIZE.
+#define CF_REPLICATION_PACKET_SIZE 1100
+
+// Packets are numbered with 16 bits on the wire, but with 32 bits internally so comparisons and ages never wrap.
+static uint32_t s_expand_sequence(uint32_t reference, uint16_t sequence)
+{
+	return reference + (uint32_t)(int32_t)(int16_t)(uint16_t)(sequence - (uint16_t)reference);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Server.
+
+struct CF_ReplicationHistory
+{
+	bool in_use = false;
+	uint32_t sequence = 0;
+	Array<int> entities;
+	Array<bool> alive;
+	Array<int32_t> fields;
+};
+
+struct CF_ReplicationEntityState
+{
+	float priority = 1.0f;
+	float accumulator = 0;
+
+	// For scoped servers, whether the client should have the entity, and whether it's in the client's `tracked` list.
+	bool in_scope = false;
+	bool tracked = false;
+
+	// The last state written for this client, and the first packet that carried it.
+	bool has_sent = false;
+	bool sent_alive = false;
+	uint32_t changed_sequence = 0;
+
+	// The newest acked packet carrying this entity, alive or not.
+	bool has_ack = false;
+	uint32_t ack_sequence = 0;
+
+	// The newest acked alive state, used as the baseline for deltas.
+	bool has_baseline = false;
+	uint32_t baseline_sequence = 0;
+};
+
+struct CF_ReplicationClientState
+{
+	uint32_t sequence = 0;
+	Array<CF_ReplicationEntityState> entities;
+	Array<int32_t> sent_fields;
+	Array<int32_t> baseline_fields;
+	Array<CF_ReplicationHistory> history;
+	Array<int> candidates;
+	// For scoped servers, the entities in scope plus those that left it and whose removal isn't acked yet.
+	// Only these are considered when writing, instead of every entity.
+	Array<int> tracked;
+};
+
+struct CF_ReplicationServerInternal
+{
+	CF_ReplicationConfig config;
+	Array<bool> active;
+	Array<int32_t> fields;
+	Array<CF_ReplicationClientState> clients;
+	Array<int32_t> zeroes;
+};
+
+static void s_reset_client(CF_ReplicationServerInternal* rs, CF_ReplicationClientState* client)
+{
+	int entity_count = rs->config.entity_capacity;
+	int field_count = rs->config.field_count;
+	client->sequence = 0;
+	client->entities.clear();
+	client->entities.set_count(entity_count);
+	client->sent_fields.set_count(entity_count * field_count);
+	client->baseline_fields.set_count(entity_count * field_count);
+	client->history.set_count(rs->config.history_size);
+	client->tracked.clear();
+	for (int i = 0; i < client->history.count(); ++i) {
+		client->history[i].in_use = false;
+	}
+}
+
+CF_ReplicationServer cf_make_replication_server(CF_ReplicationConfig config)
+{
+	CF_ASSERT(config.entity_capacity > 0 && config.field_count >= 0);
+	CF_ASSERT(config.client_capacity > 0 && config.history_size > 0);
+	CF_ReplicationServerInternal* rs = CF_NEW(CF_ReplicationServerInternal);
+	rs->config = config;
+	rs->active.set_count(config.entity_capacity);
+	rs->fields.set_count(config.entity_capacity * config.field_count);
+	rs->zeroes.set_count(config.field_count);
+	rs->clients.set_count(config.client_capacity);
+	for (int i = 0; i < config.client_capacity; ++i) {
+		s_reset_client(rs, &rs->clients[i]);
+	}
+	CF_ReplicationServer result;
+	result.id = (uint64_t)rs;
+	return result;
+}
+
+void cf_destroy_replication_server(CF_ReplicationServer rs_handle)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	rs->~CF_ReplicationServerInternal();
+	cf_free(rs);
+}
+
+void cf_replication_server_set_entity(CF_ReplicationServer rs_handle, int entity, const int32_t* fields)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(entity >= 0 && entity < rs->config.entity_capacity);
+	int field_count = rs->config.field_count;
+	rs->active[entity] = true;
+	if (field_count) CF_MEMCPY(rs->fields.data() + entity * field_count, fields, sizeof(int32_t) * field_count);
+}
+
+void cf_replication_server_remove_entity(CF_ReplicationServer rs_handle, int entity)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(entity >= 0 && entity < rs->config.entity_capacity);
+	rs->active[entity] = false;
+}
+
+void cf_replication_server_set_priority(CF_ReplicationServer rs_handle, int client_index, int entity, float priority)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(client_index >= 0 && client_index < rs->config.client_capacity);
+	CF_ASSERT(entity >= 0 && entity < rs->config.entity_capacity);
+	CF_ASSERT(priority >= 0);
+	rs->clients[client_index].entities[entity].priority = priority;
+}
+
+void cf_replication_server_scope_add(CF_ReplicationServer rs_handle, int client_index, int entity)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(rs->config.scoped);
+	CF_ASSERT(client_index >= 0 && client_index < rs->config.client_capacity);
+	CF_ASSERT(entity >= 0 && entity < rs->config.entity_capacity);
+	CF_ReplicationClientState* client = &rs->clients[client_index];
+	CF_ReplicationEntityState* e = &client->entities[entity];
+	e->in_scope = true;
+	if (!e->tracked) {
+		e->tracked = true;
+		client->tracked.add(entity);
+	}
+}
+
+void cf_replication_server_scope_remove(CF_ReplicationServer rs_handle, int client_index, int entity)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(rs->config.scoped);
+	CF_ASSERT(client_index >= 0 && client_index < rs->config.client_capacity);
+	CF_ASSERT(entity >= 0 && entity < rs->config.entity_capacity);
+	rs->clients[client_index].entities[entity].in_scope = false;
+}
+
+void cf_replication_server_reset_client(CF_ReplicationServer rs_handle, int client_index)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(client_index >= 0 && client_index < rs->config.client_capacity);
+	s_reset_client(rs, &rs->clients[client_index]);
+}
+
+// Whether the entity should exist for the client, as opposed to being removed.
+static CF_INLINE bool s_alive_for(CF_ReplicationServerInternal* rs, CF_ReplicationClientState* client, int entity)
+{
+	return rs->active[entity] && (!rs->config.scoped || client->entities[entity].in_scope);
+}
+
+// True if the client is known to already hold the entity's current state.
+static bool s_up_to_date(CF_ReplicationServerInternal* rs, CF_ReplicationClientState* client, int entity)
+{
+	int field_count = rs->config.field_count;
+	CF_ReplicationEntityState* e = &client->entities[entity];
+	bool active = s_alive_for(rs, client, entity);
+	if (!e->has_sent) return !active;
+	if (e->sent_alive != active) return false;
+	if (active && CF_MEMCMP(client->sent_fields.data() + entity * field_count, rs->fields.data() + entity * field_count, sizeof(int32_t) * field_count)) return false;
+
+	// Every packet since the state last changed carries it, and clients keep the newest, so acking any of them is enough.
+	return e->has_ack && e->ack_sequence >= e->changed_sequence;
+}
+
+static void s_write_entity(CF_ReplicationServerInternal* rs, CF_ReplicationClientState* client, CF_BitWriter* w, int entity)
+{
+	int field_count = rs->config.field_count;
+	CF_ReplicationEntityState* e = &client->entities[entity];
+	bool active = s_alive_for(rs, client, entity);
+	cf_bit_write_bool(w, true);
+	cf_bit_write_int(w, entity, 0, rs->config.entity_capacity - 1);
+	cf_bit_write_bool(w, active);
+	if (!active) return;
+
+	// Baselines older than the history are forgotten by the client, so those fall back to a full send.
+	bool has_baseline = e->has_baseline && client->sequence - e->baseline_sequence < (uint32_t)rs->config.history_size;
+	const int32_t* baseline = has_baseline ? client->baseline_fields.data() + entity * field_count : rs->zeroes.data();
+	cf_bit_write_bool(w, has_baseline);
+	if (has_baseline) cf_bit_write(w, (uint16_t)e->baseline_sequence, 16);
+	const int32_t* fields = rs->fields.data() + entity * field_count;
+	for (int i = 0; i < field_count; ++i) {
+		cf_bit_write_delta(w, fields[i], baseline[i]);
+	}
+}
+
+int cf_replication_server_write(CF_ReplicationServer rs_handle, int client_index, void* buffer, int size)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(client_index >= 0 && client_index < rs->config.client_capacity);
+	CF_ReplicationClientState* client = &rs->clients[client_index];
+	int entity_count = rs->config.entity_capacity;
+	int field_count = rs->config.field_count;
+
+	// Everything out of date builds up priority, and the highest totals go first.
+	client->candidates.clear();
+	if (rs->config.scoped) {
+		for (int k = 0; k < client->tracked.count();) {
+			int i = client->tracked[k];
+			CF_ReplicationEntityState* e = &client->entities[i];
+			bool up_to_date = s_up_to_date(rs, client, i);
+			if (!e->in_scope && up_to_date) {
+				// The client has let go of it.
+				e->tracked = false;
+				client->tracked.unordered_remove(k);
+				continue;
+			}
+			++k;
+			if (e->priority <= 0 || up_to_date) continue;
+			e->accumulator += e->priority;
+			client->candidates.add(i);
+		}
+	} else {
+		for (int i = 0; i < entity_count; ++i) {
+			CF_ReplicationEntityState* e = &client->entities[i];
+			if (e->priority <= 0 || s_up_to_date(rs, client, i)) continue;
+			e->accumulator += e->priority;
+			client->candidates.add(i);
+		}
+	}
+	if (!client->candidates.count()) return 0;
+	std::sort(client->candidates.begin(), client->candidates.end(), [&](int a, int b) {
+		return client->entities[a].accumulator > client->entities[b].accumulator;
+	});
+
+	// The writer only notices overflow as it empties its scratch, so entries are checked against the bit budget
+	// directly, holding back one bit for the terminator.
+	int budget = size * 8 - 1;
+	CF_BitWriter w = cf_make_bit_writer(buffer, size);
+	cf_bit_write(&w, (uint16_t)client->sequence, 16);
+	CF_ReplicationHistory* history = &client->history[client->sequence % client->history.count()];
+	history->entities.clear();
+	history->alive.clear();
+	history->fields.clear();
+	for (int i = 0; i < client->candidates.count(); ++i) {
+		int entity = client->candidates[i];
+		CF_BitWriter checkpoint = w;
+		s_write_entity(rs, client, &w, entity);
+		if (cf_bit_writer_overflowed(&w) || cf_bit_writer_bits_written(&w) > budget) {
+			// Smaller entries further down may still fit.
+			w = checkpoint;
+			continue;
+		}
+		history->entities.add(entity);
+		history->alive.add(s_alive_for(rs, client, entity));
+		for (int j = 0; j < field_count; ++j) {
+			history->fields.add(rs->fields[entity * field_count + j]);
+		}
+	}
+	if (!history->entities.count()) {
+		history->in_use = false;
+		return 0;
+	}
+	cf_bit_write_bool(&w, false);
+	int bytes = cf_bit_writer_flush(&w);
+	CF_ASSERT(!cf_bit_writer_overflowed(&w));
+
+	for (int i = 0; i < history->entities.count(); ++i) {
+		int entity = history->entities[i];
+		CF_ReplicationEntityState* e = &client->entities[entity];
+		e->accumulator = 0;
+		int32_t* sent = client->sent_fields.data() + entity * field_count;
+		const int32_t* fields = rs->fields.data() + entity * field_count;
+		bool alive = history->alive[i];
+		bool changed = !e->has_sent || e->sent_alive != alive || (alive && CF_MEMCMP(sent, fields, sizeof(int32_t) * field_count));
+		if (changed) {
+			e->changed_sequence = client->sequence;
+			e->has_sent = true;
+			e->sent_alive = alive;
+			if (alive && field_count) CF_MEMCPY(sent, fields, sizeof(int32_t) * field_count);
+		}
+	}
+	history->in_use = true;
+	history->sequence = client->sequence++;
+	return bytes;
+}
+
+void cf_replication_server_send(CF_ReplicationServer rs, CF_Server* server, int client_index)
+{
+	uint8_t buffer[CF_REPLICATION_PACKET_SIZE];
+	int size = cf_replication_server_write(rs, client_index, buffer, sizeof(buffer));
+	if (size) cf_server_send(server, buffer, size, client_index, false);
+}
+
+void cf_replication_server_ack(CF_ReplicationServer rs_handle, int client_index, uint16_t sequence)
+{
+	CF_ReplicationServerInternal* rs = (CF_ReplicationServerInternal*)rs_handle.id;
+	CF_ASSERT(client_index >= 0 && client_index < rs->config.client_capacity);
+	CF_ReplicationClientState* client = &rs->clients[client_index];
+	int field_count = rs->config.field_count;
+	if (!client->sequence) return;
+
+	// Acks for packets that were never sent, or were already forgotten, don't match their history slot.
+	uint32_t ack = s_expand_sequence(client->sequence - 1, sequence);
+	CF_ReplicationHistory* history = &client->history[ack % client->history.count()];
+	if (!history->in_use || history->sequence != ack) return;
+
+	for (int i = 0; i < history->entities.count(); ++i) {
+		int entity = history->entities[i];
+		CF_ReplicationEntityState* e = &client->entities[entity];
+		if (!e->has_ack || ack > e->ack_sequence) {
+			e->has_ack = true;
+			e->ack_sequence = ack;
+		}
+		if (!history->alive[i] || (e->has_baseline && ack <= e->baseline_sequence)) continue;
+
+		e->has_baseline = true;
+		e->baseline_sequence = ack;
+		if (field_count) CF_MEMCPY(client->baseline_fields.data() + entity * field_count, history->fields.data() + i * field_count, sizeof(int32_t) * field_count);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Client.
+
+struct CF_ReplicationSnapshot
+{
+	bool valid = false;
+	uint32_t sequence = 0;
+};
+
+struct CF_ReplicationEntry
+{
+	int entity;
+	bool alive;
+	bool missing_baseline;
+};
+
+struct CF_ReplicationClientInternal
+{
+	CF_ReplicationConfig config;
+	bool has_sequence = false;
+	uint32_t sequence = 0;
+	Array<bool> alive;
+	Array<bool> has_latest;
+	Array<uint32_t> latest;
+	Array<int32_t> fields;
+
+	// The last `history_size` alive states of each entity, which the server may delta-encode against.
+	Array<CF_ReplicationSnapshot> snapshots;
+	Array<int32_t> snapshot_fields;
+
+	Array<CF_ReplicationEntry> entries;
+	Array<int32_t> entry_fields;
+};
+
+CF_ReplicationClient cf_make_replication_client(CF_ReplicationConfig config)
+{
+	CF_ASSERT(config.entity_capacity > 0 && config.field_count >= 0 && config.history_size > 0);
+	CF_ReplicationClientInternal* rc = CF_NEW(CF_ReplicationClientInternal);
+	rc->config = config;
+	rc->alive.set_count(config.entity_capacity);
+	rc->has_latest.set_count(config.entity_capacity);
+	rc->latest.set_count(config.entity_capacity);
+	rc->fields.set_count(config.entity_capacity * config.field_count);
+	rc->snapshots.set_count(config.entity_capacity * config.history_size);
+	rc->snapshot_fields.set_count(config.entity_capacity * config.history_size * config.field_count);
+	CF_ReplicationClient result;
+	result.id = (uint64_t)rc;
+	return result;
+}
+
+void cf_destroy_replication_client(CF_ReplicationClient rc_handle)
+{
+	CF_ReplicationClientInternal* rc = (CF_ReplicationClientInternal*)rc_handle.id;
+	rc->~CF_ReplicationClientInternal();
+	cf_free(rc);
+}
+
+static int s_snapshot_index(CF_ReplicationClientInternal* rc, int entity, uint32_t sequence)
+{
+	return entity * rc->config.history_size + (int)(sequence % (uint32_t)rc->config.history_size);
+}
+
+// Reads past a delta whose baseline is unknown.
+static void s_skip_delta(CF_BitReader* r)
+{
+	if (cf_bit_read_bool(r)) cf_bit_read_varint(r);
+}
+
+bool cf_replication_client_read(CF_ReplicationClient rc_handle, const void* data, int size, uint16_t* ack)
+{
+	CF_ReplicationClientInternal* rc = (CF_ReplicationClientInternal*)rc_handle.id;
+	int field_count = rc->config.field_count;
+	CF_BitReader r = cf_make_bit_reader(data, size);
+	uint16_t wire_sequence = (uint16_t)cf_bit_read(&r, 16);
+	if (cf_bit_reader_failed(&r)) return false;
+	uint32_t sequence = rc->has_sequence ? s_expand_sequence(rc->sequence, wire_sequence) : (uint32_t)wire_sequence + 0x10000;
+
+	// Everything is parsed before anything is applied, so a malformed packet changes nothing.
+	rc->entries.clear();
+	rc->entry_fields.clear();
+	bool missing_baseline = false;
+	while (cf_bit_read_bool(&r)) {
+		CF_ReplicationEntry entry;
+		entry.entity = cf_bit_read_int(&r, 0, rc->config.entity_capacity - 1);
+		entry.alive = cf_bit_read_bool(&r);
+		entry.missing_baseline = false;
+		if (cf_bit_reader_failed(&r)) break;
+		if (entry.alive) {
+			const int32_t* baseline = NULL;
+			if (cf_bit_read_bool(&r)) {
+				uint32_t baseline_sequence = s_expand_sequence(sequence, (uint16_t)cf_bit_read(&r, 16));
+				int index = s_snapshot_index(rc, entry.entity, baseline_sequence);
+				CF_ReplicationSnapshot* snapshot = &rc->snapshots[index];
+				if (snapshot->valid && snapshot->sequence == baseline_sequence) {
+					baseline = rc->snapshot_fields.data() + index * field_count;
+				} else {
+					entry.missing_baseline = true;
+					missing_baseline = true;
+				}
+			}
+			for (int i = 0; i < field_count; ++i) {
+				if (entry.missing_baseline) {
+					s_skip_delta(&r);
+					rc->entry_fields.add(0);
+				} else {
+					rc->entry_fields.add(cf_bit_read_delta(&r, baseline ? baseline[i] : 0));
+				}
+			}
+		}
+		rc->entries.add(entry);
+	}
+	if (cf_bit_reader_failed(&r)) return false;
+
+	if (!rc->has_sequence || sequence > rc->sequence) {
+		rc->has_sequence = true;
+		rc->sequence = sequence;
+	}
+	int entry_fields_index = 0;
+	for (int i = 0; i < rc->entries.count(); ++i) {
+		CF_ReplicationEntry entry = rc->entries[i];
+		const int32_t* fields = rc->entry_fields.data() + entry_fields_index;
+		if (entry.alive) entry_fields_index += field_count;
+		if (entry.missing_baseline) continue;
+
+		// Late packets are still kept as baselines, but never overwrite newer state.
+		if (entry.alive) {
+			int index = s_snapshot_index(rc, entry.entity, sequence);
+			CF_ReplicationSnapshot* snapshot = &rc->snapshots[index];
+			if (!snapshot->valid || sequence > snapshot->sequence) {
+				snapshot->valid = true;
+				snapshot->sequence = sequence;
+				if (field_count) CF_MEMCPY(rc->snapshot_fields.data() + index * field_count, fields, sizeof(int32_t) * field_count);
+			}
+		}
+		if (rc->has_latest[entry.entity] && sequence <= rc->latest[entry.entity]) continue;
+		rc->has_latest[entry.entity] = true;
+		rc->latest[entry.entity] = sequence;
+		rc->alive[entry.entity] = entry.alive;
+		if (entry.alive && field_count) CF_MEMCPY(rc->fields.data() + entry.entity * field_count, fields, sizeof(int32_t) * field_count);
+	}
+
+	if (ack) *ack = wire_sequence;
+	return !missing_baseline;
+}
+
+bool cf_replication_client_has_entity(CF_ReplicationClient rc_handle, int entity)
+{
+	CF_ReplicationClientInternal* rc = (CF_ReplicationClientInternal*)rc_handle.id;
+	CF_ASSERT(entity >= 0 && entity < rc->config.entity_capacity);
+	return rc->alive[entity];
+}
+
+const int32_t* cf_replication_client_get_entity(CF_ReplicationClient rc_handle, int entity)
+{
+	CF_ReplicationClientInternal* rc = (CF_ReplicationClientInternal*)rc_handle.id;
+	CF_ASSERT(entity >= 0 && entity < rc->config.entity_capacity);
+	return rc->fields.data() + entity * rc->config.field_count;
+}
@@ -0,0 +1,188 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_rnd.h>
+#include <cute_c_runtime.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_RND_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_RND_NEON
+#endif
+
+// Below this many numbers the fill functions just call `cf_rnd` in a loop, as setting up the extra
+// streams costs a few hundred steps of the generator.
+#define CF_RND_FILL_MIN_COUNT 1024
+
+// Jump polynomials for this generator's xorshift128+ (23, 17, 26) transform, x^(2^64) and x^(2^96)
+// modulo its characteristic polynomial. Bit `i` is the coefficient of x^i.
+static const uint64_t s_jump64[2] = { 0x8c405782bca686adULL, 0xc44f35946fef49c6ULL };
+static const uint64_t s_jump96[2] = { 0xeec5431970b882bcULL, 0x397adbe826b37b9eULL };
+
+static void s_jump(CF_RndState* rnd, const uint64_t poly[2])
+{
+	uint64_t s0 = 0;
+	uint64_t s1 = 0;
+	for (int i = 0; i < 2; ++i) {
+		for (int b = 0; b < 64; ++b) {
+			if (poly[i] & (1ULL << b)) {
+				s0 ^= rnd->state[0];
+				s1 ^= rnd->state[1];
+			}
+			cf_rnd(rnd);
+		}
+	}
+	rnd->state[0] = s0;
+	rnd->state[1] = s1;
+}
+
+void cf_rnd_jump(CF_RndState* rnd)
+{
+	s_jump(rnd, s_jump96);
+}
+
+CF_RndState cf_rnd_split(CF_RndState* rnd)
+{
+	CF_RndState result = *rnd;
+	s_jump(rnd, s_jump96);
+	return result;
+}
+
+// Steps four streams at once, and writes the high 32 bits of each one's output. The streams start
+// 2^64 apart, so they never run into each other. Afterwards `rnd` continues from the first stream.
+static void s_fill_uint32(CF_RndState* rnd, uint32_t* out, int count)
+{
+	CF_RndState lanes[4];
+	lanes[0] = *rnd;
+	for (int i = 1; i < 4; ++i) {
+		lanes[i] = lanes[i - 1];
+		s_jump(lanes + i, s_jump64);
+	}
+
+	int blocks = (count + 3) / 4;
+	uint32_t tail[4];
+#if defined(CF_RND_SSE2)
+	// Two 64-bit lanes per register.
+	__m128i x01 = _mm_set_epi64x((long long)lanes[1].state[0], (long long)lanes[0].state[0]);
+	__m128i y01 = _mm_set_epi64x((long long)lanes[1].state[1], (long long)lanes[0].state[1]);
+	__m128i x23 = _mm_set_epi64x((long long)lanes[3].state[0], (long long)lanes[2].state[0]);
+	__m128i y23 = _mm_set_epi64x((long long)lanes[3].state[1], (long long)lanes[2].state[1]);
+	for (int i = 0; i < blocks; ++i) {
+		__m128i a = x01, b = x23;
+		x01 = y01;
+		x23 = y23;
+		a = _mm_xor_si128(a, _mm_slli_epi64(a, 23));
+		b = _mm_xor_si128(b, _mm_slli_epi64(b, 23));
+		a = _mm_xor_si128(a, _mm_srli_epi64(a, 17));
+		b = _mm_xor_si128(b, _mm_srli_epi64(b, 17));
+		a = _mm_xor_si128(a, _mm_xor_si128(y01, _mm_srli_epi64(y01, 26)));
+		b = _mm_xor_si128(b, _mm_xor_si128(y23, _mm_srli_epi64(y23, 26)));
+		__m128i r01 = _mm_srli_epi64(_mm_add_epi64(a, y01), 32);
+		__m128i r23 = _mm_srli_epi64(_mm_add_epi64(b, y23), 32);
+		y01 = a;
+		y23 = b;
+		// The low 32 bits of each 64-bit lane now hold a result, gather them in lane order.
+		__m128i r = _mm_unpacklo_epi64(_mm_shuffle_epi32(r01, _MM_SHUFFLE(3, 1, 2, 0)), _mm_shuffle_epi32(r23, _MM_SHUFFLE(3, 1, 2, 0)));
+		_mm_storeu_si128((__m128i*)(i * 4 + 4 <= count ? out + i * 4 : tail), r);
+	}
+	uint64_t x[2], y[2];
+	_mm_storeu_si128((__m128i*)x, x01);
+	_mm_storeu_si128((__m128i*)y, y01);
+	rnd->state[0] = x[0];
+	rnd->state[1] = y[0];
+#elif defined(CF_RND_NEON)
+	uint64_t x[4], y[4];
+	for (int i = 0; i < 4; ++i) {
+		x[i] = lanes[i].state[0];
+		y[i] = lanes[i].state[1];
+	}
+	uint64x2_t x01 = vld1q_u64(x), x23 = vld1q_u64(x + 2);
+	uint64x2_t y01 = vld1q_u64(y), y23 = vld1q_u64(y + 2);
+	for (int i = 0; i < blocks; ++i) {
+		uint64x2_t a = x01, b = x23;
+		x01 = y01;
+		x23 = y23;
+		a = veorq_u64(a, vshlq_n_u64(a, 23));
+		b = veorq_u64(b, vshlq_n_u64(b, 23));
+		a = veorq_u64(a, vshrq_n_u64(a, 17));
+		b = veorq_u64(b, vshrq_n_u64(b, 17));
+		a = veorq_u64(a, veorq_u64(y01, vshrq_n_u64(y01, 26)));
+		b = veorq_u64(b, veorq_u64(y23, vshrq_n_u64(y23, 26)));
+		uint32x4_t r = vcombine_u32(vshrn_n_u64(vaddq_u64(a, y01), 32), vshrn_n_u64(vaddq_u64(b, y23), 32));
+		y01 = a;
+		y23 = b;
+		vst1q_u32(i * 4 + 4 <= count ? out + i * 4 : tail, r);
+	}
+	vst1q_u64(x, x01);
+	vst1q_u64(y, y01);
+	rnd->state[0] = x[0];
+	rnd->state[1] = y[0];
+#else
+	for (int i = 0; i < blocks; ++i) {
+		uint32_t* dst = i * 4 + 4 <= count ? out + i * 4 : tail;
+		for (int j = 0; j < 4; ++j) {
+			dst[j] = (uint32_t)(cf_rnd(lanes + j) >> 32);
+		}
+	}
+	*rnd = lanes[0];
+#endif
+	for (int i = (count / 4) * 4; i < count; ++i) {
+		out[i] = tail[i & 3];
+	}
+}
+
+void cf_rnd_fill_uint32(CF_RndState* rnd, uint32_t* out, int count)
+{
+	if (count < CF_RND_FILL_MIN_COUNT) {
+		for (int i = 0; i < count; ++i) {
+			out[i] = (uint32_t)(cf_rnd(rnd) >> 32);
+		}
+		return;
+	}
+	s_fill_uint32(rnd, out, count);
+}
+
+void cf_rnd_fill_floats(CF_RndState* rnd, float* out, int count)
+{
+	if (count < CF_RND_FILL_MIN_COUNT) {
+		for (int i = 0; i < count; ++i) {
+			out[i] = cf_rnd_float(rnd);
+		}
+		return;
+	}
+
+	// Same conversion as `cf_rnd_float`, done in place over the random bits.
+	CF_STATIC_ASSERT(sizeof(float) == sizeof(uint32_t), "Must be equal.");
+	uint32_t* bits = (uint32_t*)out;
+	s_fill_uint32(rnd, bits, count);
+	int i = 0;
+#if defined(CF_RND_SSE2)
+	__m128i one_bits = _mm_set1_epi32(127 << 23);
+	__m128 one = _mm_set1_ps(1.0f);
+	for (; i + 4 <= count; i += 4) {
+		__m128i v = _mm_or_si128(_mm_srli_epi32(_mm_loadu_si128((__m128i*)(bits + i)), 9), one_bits);
+		_mm_storeu_ps(out + i, _mm_sub_ps(_mm_castsi128_ps(v), one));
+	}
+#elif defined(CF_RND_NEON)
+	uint32x4_t one_bits = vdupq_n_u32(127 << 23);
+	float32x4_t one = vdupq_n_f32(1.0f);
+	for (; i + 4 <= count; i += 4) {
+		uint32x4_t v = vorrq_u32(vshrq_n_u32(vld1q_u32(bits + i), 9), one_bits);
+		vst1q_f32(out + i, vsubq_f32(vreinterpretq_f32_u32(v), one));
+	}
+#endif
+	for (; i < count; ++i) {
+		uint32_t v;
+		CF_MEMCPY(&v, bits + i, sizeof(v));
+		v = (v >> 9) | (127 << 23);
+		float f;
+		CF_MEMCPY(&f, &v, sizeof(f));
+		out[i] = f - 1.0f;
+	}
+}
@@ -0,0 +1,352 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_spatial_hash.h>
+#include <cute_array.h>
+#include <cute_alloc.h>
+
+#include <internal/cute_alloc_internal.h>
+
+#include <limits.h>
+#include <math.h>
+
+// Leaves overlapping more cells than this are kept in a separate list, tested against every query.
+#define SPATIAL_HASH_MAX_CELLS_PER_LEAF 16
+#define SPATIAL_HASH_MAX_CELL_COORD (1 << 30)
+
+using namespace Cute;
+
+struct CF_SpatialHashLeaf
+{
+	CF_Aabb aabb;
+	void* udata;
+	bool alive;
+};
+
+// A run of entries, all within one cell.
+struct CF_SpatialHashCell
+{
+	uint64_t key;
+	int first;
+	int count;
+};
+
+struct CF_SpatialHashInternal
+{
+	float inv_cell_size = 0;
+	bool dirty = false;
+	Array<CF_SpatialHashLeaf> leaves;
+	Array<int> free_leaves;
+
+	// Built by `s_rebuild`. Cells are keyed by their row-major index within the bounds of all occupied
+	// cells, and each cell's entries are stored contiguously, with a copy of the leaf's AABB.
+	int min_x = 0, min_y = 0, max_x = -1, max_y = -1;
+	uint64_t span_x = 0;
+	Array<int> entry_leaves;
+	Array<CF_Aabb> entry_aabbs;
+	Array<CF_SpatialHashCell> cells;
+	Array<int> slots;
+	int slot_shift = 64;
+	Array<int> large;
+
+	// Scratch space for sorting, kept to avoid allocating every rebuild.
+	Array<uint64_t> keys;
+	Array<uint64_t> keys_tmp;
+	Array<int> order;
+	Array<int> order_tmp;
+};
+
+static CF_INLINE int s_cell(float v, float inv_cell_size)
+{
+	float c = floorf(v * inv_cell_size);
+	c = cf_clamp(c, (float)-SPATIAL_HASH_MAX_CELL_COORD, (float)SPATIAL_HASH_MAX_CELL_COORD);
+	return (int)c;
+}
+
+static CF_INLINE void s_cell_range(const CF_SpatialHashInternal* hash, CF_Aabb aabb, int* x0, int* y0, int* x1, int* y1)
+{
+	*x0 = s_cell(aabb.min.x, hash->inv_cell_size);
+	*y0 = s_cell(aabb.min.y, hash->inv_cell_size);
+	*x1 = s_cell(aabb.max.x, hash->inv_cell_size);
+	*y1 = s_cell(aabb.max.y, hash->inv_cell_size);
+}
+
+static CF_INLINE uint64_t s_key(const CF_SpatialHashInternal* hash, int x, int y)
+{
+	return (uint64_t)(y - hash->min_y) * hash->span_x + (uint64_t)(x - hash->min_x);
+}
+
+static CF_INLINE int s_slot(const CF_SpatialHashInternal* hash, uint64_t key)
+{
+	return (int)((key * 0x9E3779B97F4A7C15ULL) >> hash->slot_shift);
+}
+
+// Returns the cell at `key`, or NULL if it holds no entries.
+static CF_INLINE const CF_SpatialHashCell* s_find_cell(const CF_SpatialHashInternal* hash, uint64_t key)
+{
+	int mask = hash->slots.count() - 1;
+	for (int slot = s_slot(hash, key); ; slot = (slot + 1) & mask) {
+		int index = hash->slots[slot];
+		if (index < 0) return NULL;
+		if (hash->cells[index].key == key) return hash->cells.data() + index;
+	}
+}
+
+// LSD radix sort of `keys`, a byte at a time, carrying `order` along. Bytes every key shares are skipped,
+// and keys are small row-major cell indices, so this usually only takes two or three passes.
+static void s_radix_sort(CF_SpatialHashInternal* hash, int count)
+{
+	uint64_t* keys = hash->keys.data();
+	uint64_t* keys_tmp = hash->keys_tmp.data();
+	int* order = hash->order.data();
+	int* order_tmp = hash->order_tmp.data();
+	uint64_t all_and = ~0ULL, all_or = 0;
+	for (int i = 0; i < count; ++i) {
+		all_and &= keys[i];
+		all_or |= keys[i];
+	}
+	for (int shift = 0; shift < 64; shift += 8) {
+		if ((((all_and ^ all_or) >> shift) & 0xFF) == 0) continue;
+		int offsets[256] = { 0 };
+		for (int i = 0; i < count; ++i) {
+			offsets[(keys[i] >> shift) & 0xFF]++;
+		}
+		int sum = 0;
+		for (int i = 0; i < 256; ++i) {
+			int n = offsets[i];
+			offsets[i] = sum;
+			sum += n;
+		}
+		for (int i = 0; i < count; ++i) {
+			int dst = offsets[(keys[i] >> shift) & 0xFF]++;
+			keys_tmp[dst] = keys[i];
+			order_tmp[dst] = order[i];
+		}
+		uint64_t* k = keys; keys = keys_tmp; keys_tmp = k;
+		int* o = order; order = order_tmp; order_tmp = o;
+	}
+	// After an odd number of passes the result sits in the scratch arrays.
+	if (keys != hash->keys.data()) {
+		CF_MEMCPY(hash->keys.data(), keys, sizeof(uint64_t) * count);
+		CF_MEMCPY(hash->order.data(), order, sizeof(int) * count);
+	}
+}
+
+static void s_rebuild(CF_SpatialHashInternal* hash)
+{
+	if (!hash->dirty) return;
+	hash->dirty = false;
+
+	// Find the bounds of all occupied cells, and how many entries there will be.
+	hash->large.clear();
+	int min_x = INT_MAX, min_y = INT_MAX, max_x = INT_MIN, max_y = INT_MIN;
+	int entry_count = 0;
+	for (int i = 0; i < hash->leaves.count(); ++i) {
+		const CF_SpatialHashLeaf& leaf = hash->leaves[i];
+		if (!leaf.alive) continue;
+		int x0, y0, x1, y1;
+		s_cell_range(hash, leaf.aabb, &x0, &y0, &x1, &y1);
+		int64_t cell_count = (int64_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+		if (cell_count > SPATIAL_HASH_MAX_CELLS_PER_LEAF) {
+			hash->large.add(i);
+			continue;
+		}
+		min_x = cf_min(min_x, x0);
+		min_y = cf_min(min_y, y0);
+		max_x = cf_max(max_x, x1);
+		max_y = cf_max(max_y, y1);
+		entry_count += (int)cell_count;
+	}
+	hash->cells.clear();
+	hash->entry_leaves.clear();
+	hash->entry_aabbs.clear();
+	if (!entry_count) {
+		hash->max_x = hash->min_x - 1;
+		hash->max_y = hash->min_y - 1;
+		return;
+	}
+	hash->min_x = min_x;
+	hash->min_y = min_y;
+	hash->max_x = max_x;
+	hash->max_y = max_y;
+	hash->span_x = (uint64_t)((int64_t)max_x - min_x + 1);
+
+	// Emit an entry per leaf per overlapped cell, then sort them all by cell at once.
+	hash->keys.ensure_count(entry_count);
+	hash->keys_tmp.ensure_count(entry_count);
+	hash->order.ensure_count(entry_count);
+	hash->order_tmp.ensure_count(entry_count);
+	int n = 0;
+	for (int i = 0; i < hash->leaves.count(); ++i) {
+		const CF_SpatialHashLeaf& leaf = hash->leaves[i];
+		if (!leaf.alive) continue;
+		int x0, y0, x1, y1;
+		s_cell_range(hash, leaf.aabb, &x0, &y0, &x1, &y1);
+		if ((int64_t)(x1 - x0 + 1) * (y1 - y0 + 1) > SPATIAL_HASH_MAX_CELLS_PER_LEAF) continue;
+		for (int y = y0; y <= y1; ++y) {
+			for (int x = x0; x <= x1; ++x) {
+				hash->keys[n] = s_key(hash, x, y);
+				hash->order[n] = i;
+				++n;
+			}
+		}
+	}
+	CF_ASSERT(n == entry_count);
+	s_radix_sort(hash, entry_count);
+
+	// Lay the entries out in cell order, and index each cell's run of entries.
+	hash->entry_leaves.ensure_count(entry_count);
+	hash->entry_aabbs.ensure_count(entry_count);
+	for (int i = 0; i < entry_count; ++i) {
+		int leaf = hash->order[i];
+		hash->entry_leaves[i] = leaf;
+		hash->entry_aabbs[i] = hash->leaves[leaf].aabb;
+		if (!hash->cells.count() || hash->cells.last().key != hash->keys[i]) {
+			hash->cells.add({ hash->keys[i], i, 0 });
+		}
+		hash->cells.last().count++;
+	}
+
+	int slot_count = 16;
+	int slot_bits = 4;
+	while (slot_count < hash->cells.count() * 2) {
+		slot_count *= 2;
+		++slot_bits;
+	}
+	hash->slot_shift = 64 - slot_bits;
+	hash->slots.clear();
+	hash->slots.ensure_count(slot_count);
+	CF_MEMSET(hash->slots.data(), -1, sizeof(int) * slot_count);
+	int mask = slot_count - 1;
+	for (int i = 0; i < hash->cells.count(); ++i) {
+		int slot = s_slot(hash, hash->cells[i].key);
+		while (hash->slots[slot] >= 0) slot = (slot + 1) & mask;
+		hash->slots[slot] = i;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------
+
+CF_SpatialHash cf_make_spatial_hash(float cell_size, int initial_capacity)
+{
+	CF_ASSERT(cell_size > 0);
+	CF_SpatialHashInternal* hash = CF_NEW(CF_SpatialHashInternal);
+	hash->inv_cell_size = 1.0f / cell_size;
+	if (initial_capacity > 0) hash->leaves.ensure_capacity(initial_capacity);
+	CF_SpatialHash result;
+	result.id = (uint64_t)hash;
+	return result;
+}
+
+void cf_destroy_spatial_hash(CF_SpatialHash hash_handle)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	hash->~CF_SpatialHashInternal();
+	CF_FREE(hash);
+}
+
+CF_Leaf cf_spatial_hash_insert(CF_SpatialHash hash_handle, CF_Aabb aabb, void* udata)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	int index = hash->free_leaves.count() ? hash->free_leaves.pop() : hash->leaves.count();
+	if (index == hash->leaves.count()) hash->leaves.add();
+	hash->leaves[index] = { aabb, udata, true };
+	hash->dirty = true;
+	return { index };
+}
+
+void cf_spatial_hash_remove(CF_SpatialHash hash_handle, CF_Leaf leaf)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	CF_ASSERT(hash->leaves[leaf.id].alive);
+	hash->leaves[leaf.id].alive = false;
+	hash->leaves[leaf.id].udata = NULL;
+	hash->free_leaves.add(leaf.id);
+	hash->dirty = true;
+}
+
+void cf_spatial_hash_update(CF_SpatialHash hash_handle, CF_Leaf leaf, CF_Aabb aabb)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	CF_ASSERT(hash->leaves[leaf.id].alive);
+	hash->leaves[leaf.id].aabb = aabb;
+	hash->dirty = true;
+}
+
+CF_Aabb cf_spatial_hash_get_aabb(CF_SpatialHash hash_handle, CF_Leaf leaf)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	return hash->leaves[leaf.id].aabb;
+}
+
+void* cf_spatial_hash_get_udata(CF_SpatialHash hash_handle, CF_Leaf leaf)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	return hash->leaves[leaf.id].udata;
+}
+
+void cf_spatial_hash_rebuild(CF_SpatialHash hash_handle)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	s_rebuild(hash);
+}
+
+void cf_spatial_hash_query_aabb(const CF_SpatialHash hash_handle, CF_AabbTreeQueryFn* fn, CF_Aabb aabb, void* fn_udata)
+{
+	CF_SpatialHashInternal* hash = (CF_SpatialHashInternal*)hash_handle.id;
+	s_rebuild(hash);
+
+	int qx0, qy0, qx1, qy1;
+	s_cell_range(hash, aabb, &qx0, &qy0, &qx1, &qy1);
+	qx0 = cf_max(qx0, hash->min_x);
+	qy0 = cf_max(qy0, hash->min_y);
+	qx1 = cf_min(qx1, hash->max_x);
+	qy1 = cf_min(qy1, hash->max_y);
+
+	// Reports the hits within a cell. A leaf spanning several cells is only reported from the first
+	// cell it shares with the query, so it's reported once without remembering what was reported.
+	auto visit = [&](int x, int y, const CF_SpatialHashCell* cell) {
+		for (int i = cell->first; i < cell->first + cell->count; ++i) {
+			CF_Aabb entry_aabb = hash->entry_aabbs[i];
+			if (!cf_collide_aabb(aabb, entry_aabb)) continue;
+			int x0 = s_cell(entry_aabb.min.x, hash->inv_cell_size);
+			int y0 = s_cell(entry_aabb.min.y, hash->inv_cell_size);
+			if (x != cf_max(x0, qx0) || y != cf_max(y0, qy0)) continue;
+			int leaf = hash->entry_leaves[i];
+			if (!fn({ leaf }, entry_aabb, hash->leaves[leaf].udata, fn_udata)) return false;
+		}
+		return true;
+	};
+
+	if (qx0 <= qx1 && qy0 <= qy1) {
+		int64_t range_count = (int64_t)(qx1 - qx0 + 1) * (qy1 - qy0 + 1);
+		if (range_count <= hash->cells.count()) {
+			for (int y = qy0; y <= qy1; ++y) {
+				for (int x = qx0; x <= qx1; ++x) {
+					const CF_SpatialHashCell* cell = s_find_cell(hash, s_key(hash, x, y));
+					if (cell && !visit(x, y, cell)) return;
+				}
+			}
+		} else {
+			// The query covers more cells than are occupied, so walk the occupied ones instead.
+			for (int i = 0; i < hash->cells.count(); ++i) {
+				const CF_SpatialHashCell* cell = hash->cells.data() + i;
+				int x = (int)(cell->key % hash->span_x) + hash->min_x;
+				int y = (int)(cell->key / hash->span_x) + hash->min_y;
+				if (x < qx0 || x > qx1 || y < qy0 || y > qy1) continue;
+				if (!visit(x, y, cell)) return;
+			}
+		}
+	}
+
+	for (int i = 0; i < hash->large.count(); ++i) {
+		int leaf = hash->large[i];
+		CF_Aabb leaf_aabb = hash->leaves[leaf].aabb;
+		if (!cf_collide_aabb(aabb, leaf_aabb)) continue;
+		if (!fn({ leaf }, leaf_aabb, hash->leaves[leaf].udata, fn_udata)) return;
+	}
+}
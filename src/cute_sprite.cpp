@@ -72,6 +72,11 @@ CF_Sprite cf_make_sprite(const char* aseprite_path)
 	return s;
 }
 
+CF_Result cf_make_sprites(const char** aseprite_paths, int count, CF_Sprite* sprites_out)
+{
+	return cf_aseprite_cache_load_batch(aseprite_paths, count, sprites_out);
+}
+
 CF_Sprite cf_make_sprite_from_memory(const char* unique_name, const void* aseprite_data, int size)
 {
 	CF_Sprite s = cf_sprite_defaults();
@@ -89,16 +94,51 @@ CF_Sprite cf_make_demo_sprite()
 	return cf_make_sprite_from_memory("internal/demo_sprite_girl.ase", girl_data, girl_sz);
 }
 
+static void s_clear_def(CF_SpriteDefInternal* def)
+{
+	def->sprite = cf_sprite_defaults();
+	def->animations.clear();
+}
+
+static void s_fill_def(CF_SpriteDefInternal* def, const CF_Sprite* sprite)
+{
+	s_clear_def(def);
+	def->sprite.name = sprite->name;
+	def->sprite.w = sprite->w;
+	def->sprite.h = sprite->h;
+	def->sprite.local_offset = sprite->local_offset;
+	def->sprite.easy_sprite_id = sprite->easy_sprite_id;
+	def->sprite.animations = sprite->animations;
+	for (int i = 0; i < hcount(sprite->animations); ++i) {
+		def->animations.add(sprite->animations[i]);
+	}
+}
+
 void cf_sprite_unload(const char* aseprite_path)
 {
 	cf_aseprite_cache_unload(aseprite_path);
+	int* index = app->sprite_defs_by_path.try_find(sintern(aseprite_path));
+	if (index) s_clear_def(&app->sprite_defs[*index]);
 }
 
 CF_Sprite cf_sprite_reload(const CF_Sprite* sprite)
 {
 	const char* name = sprite->name;
 	cf_aseprite_cache_unload(name);
-	return cf_make_sprite(name);
+	CF_Sprite result = cf_make_sprite(name);
+	int* index = app->sprite_defs_by_path.try_find(sintern(name));
+	if (index) s_fill_def(&app->sprite_defs[*index], &result);
+	return result;
+}
+
+void cf_sprite_set_cook_directory(const char* virtual_directory)
+{
+	cf_aseprite_cache_set_cook_directory(virtual_directory);
+}
+
+void cf_sprite_set_parallel_decoding(bool true_to_parallelize)
+{
+	cf_aseprite_cache_set_parallel_decoding(true_to_parallelize);
 }
 
 void cf_easy_sprite_unload(CF_Sprite *sprite)
@@ -109,3 +149,392 @@ void cf_easy_sprite_unload(CF_Sprite *sprite)
 		cf_image_free(img);
 	}
 }
+
+CF_Sprite cf_make_dynamic_sprite(const CF_Pixel* pixels, int w, int h)
+{
+	CF_ASSERT(w > 0 && h > 0);
+	uint64_t id = app->dynamic_sprite_id_gen++;
+	CF_DynamicSprite* dynamic = app->dynamic_sprites.insert(id);
+	dynamic->w = w;
+	dynamic->h = h;
+	dynamic->pix = (CF_Pixel*)CF_ALLOC(sizeof(CF_Pixel) * w * h);
+	if (pixels) {
+		CF_MEMCPY(dynamic->pix, pixels, sizeof(CF_Pixel) * w * h);
+	} else {
+		CF_MEMSET(dynamic->pix, 0, sizeof(CF_Pixel) * w * h);
+	}
+
+	// Streamed textures are multi-buffered by the backend, so writing this frame's pixels never
+	// waits on the GPU still reading last frame's. They can't take initial data, the first upload
+	// happens before the sprite is first drawn.
+	if (app->gfx_enabled) {
+		CF_TextureParams params = cf_texture_defaults(w, h);
+		params.usage = CF_USAGE_TYPE_STREAM;
+		params.filter = draw->filter;
+		dynamic->texture = cf_make_texture(params);
+	}
+	dynamic->dirty = true;
+	app->dynamic_sprites_to_upload.add(id);
+
+	// The whole texture is a premade atlas with a single image, so spritebatch never packs it.
+	spritebatch_premade_sprite_t premade = { 0 };
+	premade.image_id = id;
+	premade.w = w;
+	premade.h = h;
+	premade.minx = 0;
+	premade.miny = 1;
+	premade.maxx = 1;
+	premade.maxy = 0;
+	spritebatch_register_premade_atlas(cf_get_draw_sb(), dynamic->texture.id, w, h, 1, &premade);
+
+	CF_Sprite sprite = cf_sprite_defaults();
+	sprite.name = "dynamic_sprite";
+	sprite.w = w;
+	sprite.h = h;
+	sprite.easy_sprite_id = id;
+	return sprite;
+}
+
+static void s_dynamic_sprite_dirty(uint64_t id, CF_DynamicSprite* dynamic)
+{
+	if (!dynamic->dirty) {
+		dynamic->dirty = true;
+		app->dynamic_sprites_to_upload.add(id);
+	}
+}
+
+void cf_dynamic_sprite_update_pixels(CF_Sprite* sprite, const CF_Pixel* pixels)
+{
+	CF_DynamicSprite* dynamic = app->dynamic_sprites.try_find(sprite->easy_sprite_id);
+	if (!dynamic) return;
+	CF_MEMCPY(dynamic->pix, pixels, sizeof(CF_Pixel) * dynamic->w * dynamic->h);
+	s_dynamic_sprite_dirty(sprite->easy_sprite_id, dynamic);
+}
+
+void cf_dynamic_sprite_update_rect(CF_Sprite* sprite, int x, int y, int w, int h, const CF_Pixel* pixels)
+{
+	CF_DynamicSprite* dynamic = app->dynamic_sprites.try_find(sprite->easy_sprite_id);
+	if (!dynamic) return;
+	int x0 = cf_max(x, 0);
+	int y0 = cf_max(y, 0);
+	int x1 = cf_min(x + w, dynamic->w);
+	int y1 = cf_min(y + h, dynamic->h);
+	if (x0 >= x1 || y0 >= y1) return;
+	for (int row = y0; row < y1; ++row) {
+		const CF_Pixel* src = pixels + (row - y) * w + (x0 - x);
+		CF_MEMCPY(dynamic->pix + row * dynamic->w + x0, src, sizeof(CF_Pixel) * (x1 - x0));
+	}
+	s_dynamic_sprite_dirty(sprite->easy_sprite_id, dynamic);
+}
+
+void cf_dynamic_sprite_unload(CF_Sprite* sprite)
+{
+	CF_DynamicSprite* dynamic = app->dynamic_sprites.try_find(sprite->easy_sprite_id);
+	if (!dynamic) return;
+	if (dynamic->texture.id) cf_destroy_texture(dynamic->texture);
+	CF_FREE(dynamic->pix);
+	app->dynamic_sprites.remove(sprite->easy_sprite_id);
+}
+
+void cf_dynamic_sprites_upload()
+{
+	Cute::Array<uint64_t>& ids = app->dynamic_sprites_to_upload;
+	for (int i = 0; i < ids.count();) {
+		CF_DynamicSprite* dynamic = app->dynamic_sprites.try_find(ids[i]);
+		if (dynamic && dynamic->upload_frame == app->dynamic_sprite_frame) {
+			++i;
+			continue;
+		}
+		if (dynamic) {
+			if (dynamic->texture.id) cf_update_texture(dynamic->texture, dynamic->pix, (int)sizeof(CF_Pixel) * dynamic->w * dynamic->h);
+			dynamic->upload_frame = app->dynamic_sprite_frame;
+			dynamic->dirty = false;
+		}
+		ids.unordered_remove(i);
+	}
+}
+
+static CF_SpriteDef s_add_def(const CF_Sprite* sprite, const char* path)
+{
+	int index;
+	if (app->sprite_def_free_list.count()) {
+		index = app->sprite_def_free_list.pop();
+	} else {
+		index = app->sprite_defs.count();
+		app->sprite_defs.add();
+	}
+	CF_SpriteDefInternal* def = &app->sprite_defs[index];
+	def->alive = true;
+	def->path = path;
+	s_fill_def(def, sprite);
+	CF_SpriteDef result;
+	result.id = (uint64_t)index + 1;
+	return result;
+}
+
+static CF_INLINE CF_SpriteDefInternal* s_def(uint32_t id)
+{
+	if (!id || (int)id > app->sprite_defs.count()) return NULL;
+	CF_SpriteDefInternal* def = &app->sprite_defs[id - 1];
+	return def->alive ? def : NULL;
+}
+
+CF_SpriteDef cf_make_sprite_def(const char* aseprite_path)
+{
+	aseprite_path = sintern(aseprite_path);
+	int* index = app->sprite_defs_by_path.try_find(aseprite_path);
+	if (index) {
+		// Unloaded since, so load it back in.
+		CF_SpriteDefInternal* def = &app->sprite_defs[*index];
+		if (!def->animations.count()) {
+			CF_Sprite sprite = cf_make_sprite(aseprite_path);
+			s_fill_def(def, &sprite);
+		}
+		CF_SpriteDef result;
+		result.id = (uint64_t)*index + 1;
+		return result;
+	}
+	CF_Sprite sprite = cf_make_sprite(aseprite_path);
+	CF_SpriteDef result = s_add_def(&sprite, aseprite_path);
+	app->sprite_defs_by_path.insert(aseprite_path, (int)result.id - 1);
+	return result;
+}
+
+CF_SpriteDef cf_make_sprite_def_from_sprite(const CF_Sprite* sprite)
+{
+	return s_add_def(sprite, NULL);
+}
+
+void cf_destroy_sprite_def(CF_SpriteDef def_handle)
+{
+	CF_SpriteDefInternal* def = s_def((uint32_t)def_handle.id);
+	if (!def) return;
+	if (def->path) app->sprite_defs_by_path.remove(def->path);
+	s_clear_def(def);
+	def->alive = false;
+	def->path = NULL;
+	app->sprite_def_free_list.add((int)def_handle.id - 1);
+}
+
+CF_SpriteInstance cf_make_sprite_instance(CF_SpriteDef def)
+{
+	CF_SpriteInstance instance = { };
+	instance.def = (uint32_t)def.id;
+	CF_SpriteDefInternal* d = s_def(instance.def);
+	if (d && d->animations.count()) instance.play_direction = (uint8_t)d->animations[0]->play_direction;
+	return instance;
+}
+
+void cf_sprite_instance_play(CF_SpriteInstance* instance, const char* animation)
+{
+	CF_SpriteDefInternal* def = s_def(instance->def);
+	if (!def || !def->sprite.animations) return;
+	const CF_Animation* found = hfind(def->sprite.animations, sintern(animation));
+	CF_ASSERT(found);
+	for (int i = 0; i < def->animations.count(); ++i) {
+		if (def->animations[i] == found) {
+			instance->animation = (uint16_t)i;
+			break;
+		}
+	}
+	instance->paused = false;
+	instance->frame_index = 0;
+	instance->loop_count = 0;
+	instance->t = 0;
+	instance->play_direction = (uint8_t)found->play_direction;
+}
+
+bool cf_sprite_instance_is_playing(const CF_SpriteInstance* instance, const char* animation)
+{
+	CF_SpriteDefInternal* def = s_def(instance->def);
+	if (!def || instance->animation >= def->animations.count()) return false;
+	return !CF_STRCMP(animation, def->animations[instance->animation]->name);
+}
+
+CF_Sprite cf_sprite_instance_to_sprite(const CF_SpriteInstance* instance)
+{
+	CF_SpriteDefInternal* def = s_def(instance->def);
+	if (!def) return cf_sprite_defaults();
+	CF_Sprite sprite = def->sprite;
+	if (instance->animation < def->animations.count()) {
+		sprite.animation = def->animations[instance->animation];
+		sprite.frame_index = cf_min((int)instance->frame_index, alen(sprite.animation->frames) - 1);
+	}
+	sprite.t = instance->t;
+	sprite.loop_count = instance->loop_count;
+	sprite.play_direction = (CF_PlayDirection)instance->play_direction;
+	sprite.paused = instance->paused;
+	return sprite;
+}
+
+void cf_draw_sprite_instance(const CF_SpriteInstance* instance, CF_V2 position, CF_V2 scale)
+{
+	CF_Sprite sprite = cf_sprite_instance_to_sprite(instance);
+	// Nothing to draw for unloaded sprites.
+	if (!sprite.animation && !sprite.easy_sprite_id) return;
+	sprite.transform.p = position;
+	sprite.scale = scale;
+	cf_draw_sprite(&sprite);
+}
+
+// Sprites per threadpool task in `cf_sprites_update`.
+#define CF_SPRITES_UPDATE_TASK_SIZE 2048
+
+struct CF_SpriteUpdateTask
+{
+	CF_Sprite* sprites;
+	const int* indices;
+	int count;
+	float dt;
+	CF_PlayDirection direction;
+};
+
+// Steps through as many frames as `t` covers, carrying leftover time. The direction is a template parameter
+// so each direction gets its own loop without a branch per sprite.
+template <CF_PlayDirection D>
+static CF_INLINE void s_step(const CF_Frame* frames, int frame_count, int* frame_index, int* loop_count_inout, float* t_inout)
+{
+	int frame = *frame_index;
+	int loop_count = *loop_count_inout;
+	float t = *t_inout;
+	while (t >= frames[frame].delay) {
+		float delay = frames[frame].delay;
+		t -= delay;
+		if (D == CF_PLAY_DIRECTION_FORWARDS) {
+			if (++frame == frame_count) {
+				loop_count++;
+				frame = 0;
+			}
+		} else if (D == CF_PLAY_DIRECTION_BACKWARDS) {
+			if (--frame < 0) {
+				loop_count++;
+				frame = frame_count - 1;
+			}
+		} else {
+			// Odd loops play backwards.
+			if (loop_count & 1) {
+				if (--frame < 0) {
+					loop_count++;
+					frame = cf_min(1, frame_count - 1);
+				}
+			} else if (++frame == frame_count) {
+				loop_count++;
+				frame = cf_max(0, frame_count - 2);
+			}
+		}
+		if (delay <= 0) {
+			// Zero delay frames would never use up any time, step just once like `cf_sprite_update`.
+			t = 0;
+			break;
+		}
+	}
+	*frame_index = frame;
+	*loop_count_inout = loop_count;
+	*t_inout = t;
+}
+
+template <CF_PlayDirection D>
+static CF_INLINE void s_advance(CF_Sprite* sprite, float dt)
+{
+	const CF_Frame* frames = sprite->animation->frames;
+	float t = sprite->t + dt * sprite->play_speed_multiplier;
+	s_step<D>(frames, alen(frames), &sprite->frame_index, &sprite->loop_count, &t);
+	sprite->t = t;
+}
+
+template <CF_PlayDirection D>
+static void s_advance_all(CF_Sprite* sprites, const int* indices, int count, float dt)
+{
+	for (int i = 0; i < count; ++i) {
+		s_advance<D>(sprites + indices[i], dt);
+	}
+}
+
+static void CF_CALL s_sprite_update_task(void* param)
+{
+	CF_SpriteUpdateTask* task = (CF_SpriteUpdateTask*)param;
+	switch (task->direction) {
+	case CF_PLAY_DIRECTION_FORWARDS: s_advance_all<CF_PLAY_DIRECTION_FORWARDS>(task->sprites, task->indices, task->count, task->dt); break;
+	case CF_PLAY_DIRECTION_BACKWARDS: s_advance_all<CF_PLAY_DIRECTION_BACKWARDS>(task->sprites, task->indices, task->count, task->dt); break;
+	case CF_PLAY_DIRECTION_PINGPONG: s_advance_all<CF_PLAY_DIRECTION_PINGPONG>(task->sprites, task->indices, task->count, task->dt); break;
+	}
+}
+
+void cf_sprites_update(CF_Sprite* sprites, int count, float dt, CF_Threadpool* pool)
+{
+	// Bucket the sprites by play direction, skipping any with nothing to animate.
+	Cute::Array<int> buckets[3];
+	for (int i = 0; i < count; ++i) {
+		const CF_Sprite* sprite = sprites + i;
+		if (sprite->paused || !sprite->animation || !alen(sprite->animation->frames)) continue;
+		buckets[sprite->play_direction].add(i);
+	}
+
+	Cute::Array<CF_SpriteUpdateTask> tasks;
+	for (int i = 0; i < 3; ++i) {
+		for (int j = 0; j < buckets[i].count(); j += CF_SPRITES_UPDATE_TASK_SIZE) {
+			CF_SpriteUpdateTask task;
+			task.sprites = sprites;
+			task.indices = buckets[i].data() + j;
+			task.count = cf_min(CF_SPRITES_UPDATE_TASK_SIZE, buckets[i].count() - j);
+			task.dt = dt;
+			task.direction = (CF_PlayDirection)i;
+			tasks.add(task);
+		}
+	}
+
+	if (pool && tasks.count() > 1) {
+		CF_AtomicInt counter = { 0 };
+		for (int i = 0; i < tasks.count(); ++i) {
+			cf_threadpool_add_dependent_task(pool, s_sprite_update_task, tasks.data() + i, NULL, 0, &counter);
+		}
+		cf_threadpool_kick(pool);
+		cf_threadpool_wait_counter(pool, &counter);
+	} else {
+		for (int i = 0; i < tasks.count(); ++i) {
+			s_sprite_update_task(tasks.data() + i);
+		}
+	}
+}
+
+struct CF_SpriteInstancesUpdate
+{
+	CF_SpriteInstance* instances;
+	float dt;
+};
+
+static void CF_CALL s_sprite_instances_update_fn(int begin, int end, void* udata)
+{
+	CF_SpriteInstancesUpdate* update = (CF_SpriteInstancesUpdate*)udata;
+	for (int i = begin; i < end; ++i) {
+		CF_SpriteInstance* instance = update->instances + i;
+		if (instance->paused) continue;
+		const CF_SpriteDefInternal* def = s_def(instance->def);
+		if (!def || instance->animation >= def->animations.count()) continue;
+		const CF_Frame* frames = def->animations[instance->animation]->frames;
+		int frame_count = alen(frames);
+		if (!frame_count) continue;
+
+		// The definition may have been reloaded with fewer frames.
+		int frame = instance->frame_index < frame_count ? instance->frame_index : 0;
+		int loop_count = instance->loop_count;
+		float t = instance->t + update->dt;
+		switch (instance->play_direction) {
+		case CF_PLAY_DIRECTION_FORWARDS: s_step<CF_PLAY_DIRECTION_FORWARDS>(frames, frame_count, &frame, &loop_count, &t); break;
+		case CF_PLAY_DIRECTION_BACKWARDS: s_step<CF_PLAY_DIRECTION_BACKWARDS>(frames, frame_count, &frame, &loop_count, &t); break;
+		case CF_PLAY_DIRECTION_PINGPONG: s_step<CF_PLAY_DIRECTION_PINGPONG>(frames, frame_count, &frame, &loop_count, &t); break;
+		}
+		instance->frame_index = (uint16_t)frame;
+		instance->loop_count = (uint16_t)loop_count;
+		instance->t = t;
+	}
+}
+
+void cf_sprite_instances_update(CF_SpriteInstance* instances, int count, float dt, CF_Threadpool* pool)
+{
+	static_assert(sizeof(CF_SpriteInstance) == 16, "Sprite instances are meant to stay small.");
+	CF_SpriteInstancesUpdate update;
+	update.instances = instances;
+	update.dt = dt;
+	cf_parallel_for(pool, count, CF_SPRITES_UPDATE_TASK_SIZE, s_sprite_instances_update_fn, &update);
+}
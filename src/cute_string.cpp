@@ -15,6 +15,15 @@
 
 #include <internal/cute_alloc_internal.h>
 #include <internal/cute_app_internal.h>
+#include <internal/cute_string_internal.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	include <emmintrin.h>
+#	define CF_STRING_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#	include <arm_neon.h>
+#	define CF_STRING_NEON
+#endif
 
 using namespace Cute;
 
@@ -25,6 +34,23 @@ char* cf_sfit(char* a, int n)
 	return a;
 }
 
+char* cf_sarena(CF_Arena* arena, int capacity)
+{
+	int size = (int)sizeof(CF_Ahdr) + capacity + 1;
+	void* buffer = cf_arena_alloc_aligned(arena, (size_t)size, (int)sizeof(void*));
+	char* s = NULL;
+	sstatic(s, buffer, size);
+	return s;
+}
+
+char* cf_sframe(int capacity)
+{
+	int size = (int)sizeof(CF_Ahdr) + capacity + 1;
+	char* s = NULL;
+	sstatic(s, cf_frame_alloc((size_t)size), size);
+	return s;
+}
+
 char* cf_sset(char* a, const char* b)
 {
 	CF_ACANARY(a);
@@ -41,20 +67,291 @@ char* cf_sset(char* a, const char* b)
 	return a;
 }
 
+// A subset of printf formatted straight into the string, so the common case formats once without `vsnprintf`.
+// It covers the flags "-+ 0", widths and precisions given as digits, the length modifiers hh h l ll z, and the
+// conversions d i u x X c s f F %. Any format string using something else goes through `vsnprintf` instead.
+
+struct CF_FmtSpec
+{
+	bool left = false;
+	bool plus = false;
+	bool space = false;
+	bool zero = false;
+	int width = 0;
+	int precision = -1;
+	int length = 0; // -2 for hh, -1 for h, 1 for l, 2 for ll, 3 for z.
+	char conversion = 0;
+};
+
+static const char s_digit_pairs[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+static const uint64_t s_pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+// Parses the spec following a '%', returning where it ends, or NULL if it's outside the subset.
+static const char* s_fmt_parse(const char* p, CF_FmtSpec* spec)
+{
+	const char* start = p;
+	for (;; ++p) {
+		if (*p == '-') spec->left = true;
+		else if (*p == '+') spec->plus = true;
+		else if (*p == ' ') spec->space = true;
+		else if (*p == '0') spec->zero = true;
+		else break;
+	}
+	while (*p >= '0' && *p <= '9') {
+		spec->width = spec->width * 10 + (*p++ - '0');
+		if (spec->width > 64) return NULL;
+	}
+	if (*p == '.') {
+		++p;
+		spec->precision = 0;
+		while (*p >= '0' && *p <= '9') {
+			spec->precision = spec->precision * 10 + (*p++ - '0');
+			if (spec->precision > 64) return NULL;
+		}
+	}
+	if (*p == 'h') {
+		spec->length = -1;
+		if (*++p == 'h') { spec->length = -2; ++p; }
+	} else if (*p == 'l') {
+		spec->length = 1;
+		if (*++p == 'l') { spec->length = 2; ++p; }
+	} else if (*p == 'z') {
+		spec->length = 3;
+		++p;
+	}
+	switch (*p) {
+	case 'd': case 'i': case 'u': case 'x': case 'X':
+		if (spec->precision >= 0) return NULL;
+		break;
+	case 'c': case 's':
+		if (spec->length) return NULL;
+		break;
+	case '%':
+		if (p != start) return NULL;
+		break;
+	case 'f': case 'F':
+		if (spec->length < 0 || spec->length > 1) return NULL;
+		break;
+	default:
+		return NULL;
+	}
+	// Keeps the spec short enough to hand to `snprintf` from a small buffer, see `s_fmt`.
+	if (p - start > 30) return NULL;
+	spec->conversion = *p;
+	return p + 1;
+}
+
+static bool s_fmt_supported(const char* fmt)
+{
+	for (const char* p = fmt; *p; ++p) {
+		if (*p != '%') continue;
+		CF_FmtSpec spec;
+		p = s_fmt_parse(p + 1, &spec);
+		if (!p) return false;
+		--p;
+	}
+	return true;
+}
+
+// Writes the digits of `v` backwards, ending at `end`, two at a time. Returns the number of digits.
+static int s_fmt_u64(uint64_t v, char* end)
+{
+	char* p = end;
+	while (v >= 100) {
+		const char* pair = s_digit_pairs + (v % 100) * 2;
+		v /= 100;
+		*--p = pair[1];
+		*--p = pair[0];
+	}
+	if (v >= 10) {
+		*--p = s_digit_pairs[v * 2 + 1];
+		*--p = s_digit_pairs[v * 2];
+	} else {
+		*--p = (char)('0' + v);
+	}
+	return (int)(end - p);
+}
+
+static int s_fmt_hex(uint64_t v, char* end, bool upper)
+{
+	const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+	char* p = end;
+	do {
+		*--p = digits[v & 0xF];
+		v >>= 4;
+	} while (v);
+	return (int)(end - p);
+}
+
+// Writes `v` in fixed point backwards, ending at `end`. Returns the number of characters, or -1 if `v` can't be
+// rounded exactly with doubles and is left to `snprintf`.
+static int s_fmt_f64(double v, int precision, char* end, bool* negative)
+{
+	if (precision > 9 || !(v - v == 0)) return -1;
+	*negative = signbit(v) != 0;
+	double scaled = fabs(v) * (double)s_pow10[precision];
+	if (scaled >= 4503599627370496.0) return -1; // 2^52
+	double whole = floor(scaled);
+	double fraction = scaled - whole;
+	// The product is off by at most half an ulp, so only trust the rounding when the fraction is clearly off one half.
+	if (fabs(fraction - 0.5) <= scaled * 2.3e-16) return -1;
+	uint64_t n = (uint64_t)whole + (fraction > 0.5 ? 1 : 0);
+	char* p = end;
+	if (precision) {
+		p -= s_fmt_u64(n % s_pow10[precision], p);
+		while (end - p < precision) *--p = '0';
+		*--p = '.';
+	}
+	p -= s_fmt_u64(n / s_pow10[precision], p);
+	return (int)(end - p);
+}
+
+// Output is written straight into the string, with its length kept here until the end.
+struct CF_FmtOut
+{
+	char* s;
+	int len;
+	int cap;
+};
+
+static void s_fmt_grow(CF_FmtOut* out, int len)
+{
+	alen(out->s) = out->len + 1;
+	out->s = cf_sfit(out->s, out->len + len);
+	out->cap = scap(out->s);
+}
+
+static void s_fmt_write(CF_FmtOut* out, const char* text, int len)
+{
+	if (out->len + len >= out->cap) s_fmt_grow(out, len);
+	CF_MEMCPY(out->s + out->len, text, len);
+	out->len += len;
+}
+
+static void s_fmt_fill(CF_FmtOut* out, char c, int len)
+{
+	if (len <= 0) return;
+	if (out->len + len >= out->cap) s_fmt_grow(out, len);
+	CF_MEMSET(out->s + out->len, c, len);
+	out->len += len;
+}
+
+// Writes a sign and `len` characters of `text`, padded out to the spec's width.
+static void s_fmt_put(CF_FmtOut* out, const CF_FmtSpec& spec, bool numeric, const char* sign, const char* text, int len)
+{
+	int sign_len = *sign ? 1 : 0;
+	int pad = max(spec.width - len - sign_len, 0);
+	bool zero = numeric && spec.zero && !spec.left;
+	if (!spec.left && !zero) s_fmt_fill(out, ' ', pad);
+	if (sign_len) s_fmt_write(out, sign, 1);
+	if (zero) s_fmt_fill(out, '0', pad);
+	s_fmt_write(out, text, len);
+	if (spec.left) s_fmt_fill(out, ' ', pad);
+}
+
+// Appends to `s`, which must already exist. The format string must pass `s_fmt_supported`.
+static char* s_fmt(char* s, const char* fmt, va_list args)
+{
+	CF_FmtOut out;
+	out.s = s;
+	out.len = slen(s);
+	out.cap = scap(s);
+	const char* p = fmt;
+	while (*p) {
+		const char* run = p;
+		while (*p && *p != '%') ++p;
+		if (p != run) s_fmt_write(&out, run, (int)(p - run));
+		if (!*p) break;
+
+		const char* spec_start = p;
+		CF_FmtSpec spec;
+		p = s_fmt_parse(p + 1, &spec);
+		char buffer[512];
+		char* end = buffer + sizeof(buffer);
+		switch (spec.conversion) {
+		case '%':
+			s_fmt_put(&out, spec, false, "", "%", 1);
+			break;
+
+		case 'c':
+		{
+			char c = (char)va_arg(args, int);
+			s_fmt_put(&out, spec, false, "", &c, 1);
+		}	break;
+
+		case 's':
+		{
+			const char* str = va_arg(args, const char*);
+			if (!str) str = "(null)";
+			int len = 0;
+			while (str[len] && (spec.precision < 0 || len < spec.precision)) ++len;
+			s_fmt_put(&out, spec, false, "", str, len);
+		}	break;
+
+		case 'd': case 'i':
+		{
+			int64_t v;
+			switch (spec.length) {
+			case -2: v = (signed char)va_arg(args, int); break;
+			case -1: v = (short)va_arg(args, int); break;
+			case 1: v = va_arg(args, long); break;
+			case 2: v = va_arg(args, long long); break;
+			case 3: v = va_arg(args, ptrdiff_t); break;
+			default: v = va_arg(args, int); break;
+			}
+			int len = s_fmt_u64(v < 0 ? 0 - (uint64_t)v : (uint64_t)v, end);
+			const char* sign = v < 0 ? "-" : spec.plus ? "+" : spec.space ? " " : "";
+			s_fmt_put(&out, spec, true, sign, end - len, len);
+		}	break;
+
+		case 'u': case 'x': case 'X':
+		{
+			uint64_t v;
+			switch (spec.length) {
+			case -2: v = (unsigned char)va_arg(args, unsigned); break;
+			case -1: v = (unsigned short)va_arg(args, unsigned); break;
+			case 1: v = va_arg(args, unsigned long); break;
+			case 2: v = va_arg(args, unsigned long long); break;
+			case 3: v = va_arg(args, size_t); break;
+			default: v = va_arg(args, unsigned); break;
+			}
+			int len = spec.conversion == 'u' ? s_fmt_u64(v, end) : s_fmt_hex(v, end, spec.conversion == 'X');
+			s_fmt_put(&out, spec, true, "", end - len, len);
+		}	break;
+
+		case 'f': case 'F':
+		{
+			double v = va_arg(args, double);
+			bool negative = false;
+			int len = s_fmt_f64(v, spec.precision < 0 ? 6 : spec.precision, end, &negative);
+			if (len >= 0) {
+				const char* sign = negative ? "-" : spec.plus ? "+" : spec.space ? " " : "";
+				s_fmt_put(&out, spec, true, sign, end - len, len);
+			} else {
+				// Ties, huge numbers, infinities and NaNs, formatted by the spec as written.
+				char spec_text[40];
+				CF_MEMCPY(spec_text, spec_start, p - spec_start);
+				spec_text[p - spec_start] = 0;
+				len = snprintf(buffer, sizeof(buffer), spec_text, v);
+				s_fmt_write(&out, buffer, len);
+			}
+		}	break;
+		}
+	}
+	out.s[out.len] = 0;
+	alen(out.s) = out.len + 1;
+	return out.s;
+}
+
 char* cf_sfmt(char* s, const char* fmt, ...)
 {
 	CF_ACANARY(s);
 	va_list args;
 	va_start(args, fmt);
-	int n = 1 + vsnprintf(s, scap(s), fmt, args);
+	s = cf_svfmt(s, fmt, args);
 	va_end(args);
-	if (n > scap(s)) {
-		sfit(s, n);
-		va_start(args, fmt);
-		n = 1 + vsnprintf(s, scap(s), fmt, args);
-		va_end(args);
-	}
-	alen(s) = n;
 	return s;
 }
 
@@ -63,32 +360,28 @@ char* cf_sfmt_append(char* s, const char* fmt, ...)
 	CF_ACANARY(s);
 	va_list args;
 	va_start(args, fmt);
-	int capacity = scap(s) - scount(s);
-	int n = 1 + vsnprintf(s + slen(s), capacity, fmt, args);
+	s = cf_svfmt_append(s, fmt, args);
 	va_end(args);
-	if (n > capacity) {
-		afit(s, n + scount(s));
-		va_start(args, fmt);
-		int new_capacity = scap(s) - scount(s);
-		n = 1 + vsnprintf(s + slen(s), new_capacity, fmt, args);
-		CF_ASSERT(n <= new_capacity);
-		va_end(args);
-	}
-	alen(s) += n - 1;
 	return s;
 }
 
 char* cf_svfmt(char* s, const char* fmt, va_list args)
 {
 	CF_ACANARY(s);
+	if (s_fmt_supported(fmt)) {
+		s = cf_sfit(s, 0);
+		alen(s) = 1;
+		s[0] = 0;
+		return s_fmt(s, fmt, args);
+	}
 	va_list copy_args;
 	va_copy(copy_args, args);
 	int n = 1 + vsnprintf(s, scap(s), fmt, args);
 	if (n > scap(s)) {
 		sfit(s, n);
 		n = 1 + vsnprintf(s, scap(s), fmt, copy_args);
-		va_end(copy_args);
 	}
+	va_end(copy_args);
 	alen(s) = n;
 	return s;
 }
@@ -96,6 +389,10 @@ char* cf_svfmt(char* s, const char* fmt, va_list args)
 char* cf_svfmt_append(char* s, const char* fmt, va_list args)
 {
 	CF_ACANARY(s);
+	if (s_fmt_supported(fmt)) {
+		s = cf_sfit(s, slen(s));
+		return s_fmt(s, fmt, args);
+	}
 	va_list copy_args;
 	va_copy(copy_args, args);
 	int capacity = scap(s) - scount(s);
@@ -347,7 +644,7 @@ char* cf_sreplace(char* s, const char* replace_me, const char* with_me)
 	while ((find = sfind(search, replace_me))) {
 		int find_offset = (int)(find - s);
 		if (replace_len > with_len) {
-			int remaining = scount(s) - find_offset - (int)with_len;
+			int remaining = scount(s) - find_offset - (int)replace_len;
 			int diff = (int)(replace_len - with_len);
 			CF_MEMCPY(find, with_me, with_len);
 			CF_MEMMOVE(find + with_len, find + replace_len, remaining);
@@ -432,44 +729,95 @@ char* cf_spopn(char* s, int n)
 
 using intern_t = cf_intern_t;
 
-struct intern_table_t
+// The intern table is split into shards picked by the top bits of each string's hash, and each shard
+// is an open-addressed array of intern pointers. Lookups never lock -- they probe the shard's current
+// array with atomic loads. Inserts lock only their own shard, publish the new intern after it's fully
+// written, and grow by publishing a bigger array. Old arrays are kept until `sinuke`, since readers
+// may still be probing them. A small per-thread cache sits in front to skip the shard for hot strings.
+
+#define CF_INTERN_SHARD_BITS 6
+#define CF_INTERN_SHARD_COUNT (1 << CF_INTERN_SHARD_BITS)
+#define CF_INTERN_MIN_SLOTS 64
+#define CF_INTERN_CACHE_SIZE 64
+
+struct intern_slots_t
+{
+	int capacity; // Always a power of two.
+	intern_slots_t* next_retired;
+	intern_t* entries[1];
+};
+
+struct intern_shard_t
 {
-	htbl intern_t** interns;
+	CF_Mutex lock; // Zero-initialized, so the static shards need no setup.
+	int count;
+	intern_slots_t* slots;
+	intern_slots_t* retired;
 	Arena arena;
-	ReadWriteLock lock;
+};
 
-	CF_INLINE void read_lock() { cf_read_lock(&lock); }
-	CF_INLINE void read_unlock() { cf_read_unlock(&lock); }
-	CF_INLINE void write_lock() { cf_write_lock(&lock); }
-	CF_INLINE void write_unlock() { cf_write_unlock(&lock); }
+struct intern_cache_entry_t
+{
+	uint64_t hash;
+	const char* string;
 };
 
-static intern_table_t* g_intern_table;
-
-static intern_table_t* s_inst()
-{
-	// Locklessly get/instantiate a global instance.
-	intern_table_t* inst = (intern_table_t*)cf_atomic_ptr_get((void**)&g_intern_table);
-	if (!inst) {
-		// Create a new instance of the table.
-		inst = (intern_table_t*)CF_ALLOC(sizeof(intern_table_t));
-		CF_MEMSET(inst, 0, sizeof(*inst));
-		inst->interns = NULL;
-		inst->arena.alignment = 8;
-		inst->arena.block_size = CF_MB;
-		inst->lock = cf_make_rw_lock();
-
-		// Try and set the global pointer. If this fails it means another thread
-		// has raced us and completed first, so then just destroy ours and use theirs.
-		Result result = cf_atomic_ptr_cas((void**)&g_intern_table, NULL, inst);
-		if (is_error(result)) {
-			cf_destroy_rw_lock(&inst->lock);
-			CF_FREE(inst);
-			inst = (intern_table_t*)cf_atomic_ptr_get((void**)&g_intern_table);
-			CF_ASSERT(inst);
+struct intern_cache_t
+{
+	int generation;
+	intern_cache_entry_t entries[CF_INTERN_CACHE_SIZE];
+};
+
+static intern_shard_t s_intern_shards[CF_INTERN_SHARD_COUNT];
+
+// Bumped by `sinuke` so each thread knows to drop its cache.
+static CF_AtomicInt s_intern_generation;
+static thread_local intern_cache_t s_intern_cache;
+
+static intern_t* s_intern_find(intern_slots_t* slots, uint64_t hash, const char* start, int len)
+{
+	if (!slots) return NULL;
+	int mask = slots->capacity - 1;
+	for (int i = (int)hash & mask; ; i = (i + 1) & mask) {
+		intern_t* intern = (intern_t*)cf_atomic_ptr_get((void**)(slots->entries + i));
+		if (!intern) return NULL;
+		if (intern->len == len && !CF_MEMCMP(intern->string, start, len)) return intern;
+	}
+}
+
+static intern_slots_t* s_intern_make_slots(int capacity)
+{
+	size_t size = sizeof(intern_slots_t) + sizeof(intern_t*) * (capacity - 1);
+	intern_slots_t* slots = (intern_slots_t*)CF_ALLOC(size);
+	CF_MEMSET(slots, 0, size);
+	slots->capacity = capacity;
+	return slots;
+}
+
+// Call with the shard lock held. Readers may be probing concurrently, hence the atomics.
+static void s_intern_insert(intern_slots_t* slots, uint64_t hash, intern_t* intern)
+{
+	int mask = slots->capacity - 1;
+	int i = (int)hash & mask;
+	while (cf_atomic_ptr_get((void**)(slots->entries + i))) i = (i + 1) & mask;
+	cf_atomic_ptr_set((void**)(slots->entries + i), intern);
+}
+
+// Call with the shard lock held. Keeps the load under half so probes stay short.
+static void s_intern_grow(intern_shard_t* shard)
+{
+	intern_slots_t* old = (intern_slots_t*)cf_atomic_ptr_get((void**)&shard->slots);
+	if (old && (shard->count + 1) * 2 <= old->capacity) return;
+	intern_slots_t* slots = s_intern_make_slots(old ? old->capacity * 2 : CF_INTERN_MIN_SLOTS);
+	if (old) {
+		for (int i = 0; i < old->capacity; ++i) {
+			intern_t* intern = (intern_t*)cf_atomic_ptr_get((void**)(old->entries + i));
+			if (intern) s_intern_insert(slots, fnv1a(intern->string, intern->len), intern);
 		}
+		old->next_retired = shard->retired;
+		shard->retired = old;
 	}
-	return inst;
+	cf_atomic_ptr_set((void**)&shard->slots, slots);
 }
 
 const char* cf_sintern(const char* s)
@@ -479,44 +827,50 @@ const char* cf_sintern(const char* s)
 
 const char* cf_sintern_range(const char* start, const char* end)
 {
-	intern_table_t* table = s_inst();
-	intern_t* intern = NULL;
 	int len = (int)(end - start);
 	uint64_t hash = fnv1a(start, len);
 
-	// Fast-path, fetch already intern'd strings and return them as-is.
-	// Uses a mere read-lock, which is just a couple atomic read operations
-	// and supports *many* simultaneous lockless readers.
-	if (table->interns) {
-		table->read_lock();
-		intern = hget(table->interns, hash);
-		table->read_unlock();
-		if (intern) {
-			// This loop is highly unlikely to ever actually run more than one iteration.
-			intern_t* i = intern;
-			while (i) {
-				if (len == i->len && !CF_STRNCMP(i->string, start, len)) {
-					return i->string;
-				}
-				i = i->next;
+	// Fast-path, this thread recently intern'd the same string.
+	intern_cache_t* cache = &s_intern_cache;
+	int generation = cf_atomic_get(&s_intern_generation);
+	if (cache->generation != generation) {
+		CF_MEMSET(cache->entries, 0, sizeof(cache->entries));
+		cache->generation = generation;
+	}
+	intern_cache_entry_t* entry = cache->entries + ((hash >> 32) & (CF_INTERN_CACHE_SIZE - 1));
+	if (entry->string && entry->hash == hash && silen(entry->string) == len && !CF_MEMCMP(entry->string, start, len)) {
+		return entry->string;
+	}
+
+	// Lockless lookup in the shard.
+	intern_shard_t* shard = s_intern_shards + (hash >> (64 - CF_INTERN_SHARD_BITS));
+	intern_t* intern = s_intern_find((intern_slots_t*)cf_atomic_ptr_get((void**)&shard->slots), hash, start, len);
+
+	if (!intern) {
+		// Look again under the lock, another thread may have just inserted the same string.
+		cf_mutex_lock(&shard->lock);
+		intern = s_intern_find((intern_slots_t*)cf_atomic_ptr_get((void**)&shard->slots), hash, start, len);
+		if (!intern) {
+			if (!shard->arena.block_size) {
+				shard->arena.alignment = 8;
+				shard->arena.block_size = CF_KB * 64;
 			}
+			intern = (intern_t*)arena_alloc(&shard->arena, sizeof(intern_t) + len + 1);
+			intern->cookie = CF_INTERN_COOKIE;
+			intern->len = len;
+			intern->next = NULL;
+			intern->string = (char*)(intern + 1);
+			CF_MEMCPY((char*)intern->string, start, len);
+			((char*)intern->string)[len] = 0;
+			s_intern_grow(shard);
+			s_intern_insert((intern_slots_t*)cf_atomic_ptr_get((void**)&shard->slots), hash, intern);
+			shard->count++;
 		}
+		cf_mutex_unlock(&shard->lock);
 	}
 
-	// String is not yet interned, create a new allocation for it.
-	// We write-lock the data structure, this will wait for all readers to flush.
-	CF_ASSERT(!intern || intern->cookie == CF_INTERN_COOKIE);
-	intern_t* list = intern;
-	table->write_lock();
-	intern = (intern_t*)arena_alloc(&table->arena, sizeof(intern_t) + len + 1);
-	hset(table->interns, hash, intern);
-	intern->cookie = CF_INTERN_COOKIE;
-	intern->len = len;
-	intern->string = (char*)(intern + 1);
-	CF_MEMCPY((char*)intern->string, start, len);
-	((char*)intern->string)[len] = 0;
-	intern->next = list;
-	table->write_unlock();
+	entry->hash = hash;
+	entry->string = intern->string;
 
 	// Return a copy of the string as a stable pointer.
 	return intern->string;
@@ -524,14 +878,21 @@ const char* cf_sintern_range(const char* start, const char* end)
 
 void cf_sinuke_intern_table()
 {
-	intern_table_t* table = s_inst();
-	table->write_lock();
-	cf_atomic_ptr_set((void**)&g_intern_table, NULL);
-	table->write_unlock();
-	arena_reset(&table->arena);
-	hfree(table->interns);
-	cf_destroy_rw_lock(&table->lock);
-	CF_FREE(table);
+	cf_atomic_add(&s_intern_generation, 1);
+	for (int i = 0; i < CF_INTERN_SHARD_COUNT; ++i) {
+		intern_shard_t* shard = s_intern_shards + i;
+		cf_mutex_lock(&shard->lock);
+		while (shard->retired) {
+			intern_slots_t* next = shard->retired->next_retired;
+			CF_FREE(shard->retired);
+			shard->retired = next;
+		}
+		CF_FREE(shard->slots);
+		cf_atomic_ptr_set((void**)&shard->slots, NULL);
+		shard->count = 0;
+		arena_reset(&shard->arena);
+		cf_mutex_unlock(&shard->lock);
+	}
 }
 
 // All invalid characters are encoded as the "replacement character" 0xFFFD for both
@@ -549,9 +910,50 @@ char* cf_string_append_UTF8_impl(char *s, int codepoint)
 	return s;
 }
 
+const char* cf_scan_ascii(const char* s, const char* end, const char* stops, int stop_count)
+{
+	CF_ASSERT(stop_count >= 0 && stop_count <= CF_SCAN_MAX_STOPS);
+#if defined(CF_STRING_SSE2)
+	__m128i stop_v[CF_SCAN_MAX_STOPS];
+	for (int i = 0; i < stop_count; ++i) stop_v[i] = _mm_set1_epi8(stops[i]);
+	__m128i zero = _mm_setzero_si128();
+	while (end - s >= 16) {
+		__m128i v = _mm_loadu_si128((const __m128i*)s);
+		// Non-ASCII bytes already have their top bit set, so fold them straight into the mask.
+		__m128i hit = _mm_or_si128(v, _mm_cmpeq_epi8(v, zero));
+		for (int i = 0; i < stop_count; ++i) hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, stop_v[i]));
+		if (_mm_movemask_epi8(hit)) break;
+		s += 16;
+	}
+#elif defined(CF_STRING_NEON)
+	uint8x16_t stop_v[CF_SCAN_MAX_STOPS];
+	for (int i = 0; i < stop_count; ++i) stop_v[i] = vdupq_n_u8((uint8_t)stops[i]);
+	while (end - s >= 16) {
+		uint8x16_t v = vld1q_u8((const uint8_t*)s);
+		uint8x16_t hit = vorrq_u8(vceqq_u8(v, vdupq_n_u8(0)), vcgeq_u8(v, vdupq_n_u8(0x80)));
+		for (int i = 0; i < stop_count; ++i) hit = vorrq_u8(hit, vceqq_u8(v, stop_v[i]));
+		if (vmaxvq_u8(hit)) break;
+		s += 16;
+	}
+#endif
+	// The last few bytes, or the group of 16 the vector loop stopped on.
+	for (; s < end; ++s) {
+		unsigned char c = (unsigned char)*s;
+		if (!c || c >= 0x80) return s;
+		for (int i = 0; i < stop_count; ++i) {
+			if (*s == stops[i]) return s;
+		}
+	}
+	return end;
+}
+
 const char* cf_decode_UTF8(const char* s, int* codepoint)
 {
 	unsigned char c = *s++;
+	if (c < 0x80) {
+		*codepoint = c;
+		return s;
+	}
 	int extra = 0;
 	int min = 0;
 	*codepoint = 0;
@@ -0,0 +1,165 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include <cute_tilemap.h>
+#include <cute_draw.h>
+#include <cute_alloc.h>
+
+#include <internal/cute_alloc_internal.h>
+#include <internal/cute_draw_internal.h>
+#include <internal/cute_tilemap_internal.h>
+
+using namespace Cute;
+
+#define CF_TILEMAP_DEFAULT_CHUNK_SIZE 16
+
+CF_Tilemap cf_make_tilemap(int width, int height, CF_V2 tile_size, int chunk_size)
+{
+	CF_ASSERT(width > 0 && height > 0);
+	CF_TilemapInternal* map = CF_NEW(CF_TilemapInternal);
+	map->width = width;
+	map->height = height;
+	map->tile_size = tile_size;
+	map->chunk_size = chunk_size > 0 ? chunk_size : CF_TILEMAP_DEFAULT_CHUNK_SIZE;
+	map->chunks_x = (width + map->chunk_size - 1) / map->chunk_size;
+	map->chunks_y = (height + map->chunk_size - 1) / map->chunk_size;
+	CF_Tilemap result;
+	result.id = (uint64_t)map;
+	return result;
+}
+
+void cf_destroy_tilemap(CF_Tilemap tilemap)
+{
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	if (!map) return;
+	for (int i = 0; i < map->layers.count(); ++i) {
+		Array<CF_TilemapChunk>& chunks = map->layers[i].chunks;
+		for (int j = 0; j < chunks.count(); ++j) {
+			if (chunks[j].geometry.id) cf_destroy_static_geometry(chunks[j].geometry);
+		}
+	}
+	map->~CF_TilemapInternal();
+	CF_FREE(map);
+}
+
+int cf_tilemap_add_layer(CF_Tilemap tilemap)
+{
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	CF_TilemapLayer& layer = map->layers.add();
+	layer.tiles.ensure_count(map->width * map->height);
+	CF_MEMSET(layer.tiles.data(), 0, sizeof(int) * map->width * map->height);
+	layer.chunks.ensure_count(map->chunks_x * map->chunks_y);
+	return map->layers.count() - 1;
+}
+
+int cf_tilemap_layer_count(CF_Tilemap tilemap)
+{
+	return cf_tilemap_internal(tilemap)->layers.count();
+}
+
+int cf_tilemap_add_tile(CF_Tilemap tilemap, const CF_Sprite* sprite)
+{
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	map->tiles.add(*sprite);
+	return map->tiles.count();
+}
+
+void cf_tilemap_set_tile(CF_Tilemap tilemap, int layer_index, int x, int y, int tile)
+{
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	CF_ASSERT(layer_index >= 0 && layer_index < map->layers.count());
+	CF_ASSERT(tile >= 0 && tile <= map->tiles.count());
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height) return;
+	CF_TilemapLayer& layer = map->layers[layer_index];
+	int& slot = layer.tiles[y * map->width + x];
+	if (slot == tile) return;
+	CF_TilemapChunk& chunk = layer.chunks[(y / map->chunk_size) * map->chunks_x + x / map->chunk_size];
+	chunk.tile_count += (tile != 0) - (slot != 0);
+	chunk.dirty = true;
+	slot = tile;
+}
+
+int cf_tilemap_get_tile(CF_Tilemap tilemap, int layer_index, int x, int y)
+{
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	CF_ASSERT(layer_index >= 0 && layer_index < map->layers.count());
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height) return 0;
+	return map->layers[layer_index].tiles[y * map->width + x];
+}
+
+static void s_bake_chunk(CF_TilemapInternal* map, CF_TilemapLayer& layer, int cx, int cy)
+{
+	CF_TilemapChunk& chunk = layer.chunks[cy * map->chunks_x + cx];
+	if (chunk.geometry.id) cf_destroy_static_geometry(chunk.geometry);
+	chunk.geometry.id = 0;
+	chunk.dirty = false;
+	map->rebake_count++;
+	if (!chunk.tile_count) return;
+
+	int x0 = cx * map->chunk_size;
+	int y0 = cy * map->chunk_size;
+	int x1 = cf_min(x0 + map->chunk_size, map->width);
+	int y1 = cf_min(y0 + map->chunk_size, map->height);
+	cf_static_geometry_begin();
+	for (int y = y0; y < y1; ++y) {
+		for (int x = x0; x < x1; ++x) {
+			int tile = layer.tiles[y * map->width + x];
+			if (!tile) continue;
+			CF_Sprite sprite = map->tiles[tile - 1];
+			sprite.transform = cf_make_transform();
+			sprite.transform.p = cf_v2(((float)x + 0.5f) * map->tile_size.x, ((float)y + 0.5f) * map->tile_size.y);
+			cf_draw_sprite(&sprite);
+		}
+	}
+	chunk.geometry = cf_static_geometry_end();
+}
+
+// Clamped to one past either end, so far away cameras don't overflow the int.
+static int s_chunk_coord(float v, int chunk_count)
+{
+	v = cf_clamp(CF_FLOORF(v), -1.0f, (float)chunk_count);
+	return (int)v;
+}
+
+void cf_draw_tilemap(CF_Tilemap tilemap)
+{
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	if (draw->headless) return;
+	CF_ASSERT(!draw->recording);
+
+	// The camera's view in the map's space, found by taking the corners of clip space back through
+	// the camera. Chunks are tested against its bounding box.
+	CF_M3x2 inv = cf_invert(draw->mvp);
+	CF_V2 corners[4] = {
+		cf_mul_m32_v2(inv, cf_v2(-1, -1)),
+		cf_mul_m32_v2(inv, cf_v2( 1, -1)),
+		cf_mul_m32_v2(inv, cf_v2( 1,  1)),
+		cf_mul_m32_v2(inv, cf_v2(-1,  1)),
+	};
+	CF_V2 lo = corners[0];
+	CF_V2 hi = corners[0];
+	for (int i = 1; i < 4; ++i) {
+		lo = cf_min_v2(lo, corners[i]);
+		hi = cf_max_v2(hi, corners[i]);
+	}
+	CF_V2 chunk_extent = cf_mul_v2_f(map->tile_size, (float)map->chunk_size);
+	int cx0 = cf_max(s_chunk_coord(lo.x / chunk_extent.x, map->chunks_x), 0);
+	int cy0 = cf_max(s_chunk_coord(lo.y / chunk_extent.y, map->chunks_y), 0);
+	int cx1 = cf_min(s_chunk_coord(hi.x / chunk_extent.x, map->chunks_x), map->chunks_x - 1);
+	int cy1 = cf_min(s_chunk_coord(hi.y / chunk_extent.y, map->chunks_y), map->chunks_y - 1);
+
+	for (int i = 0; i < map->layers.count(); ++i) {
+		CF_TilemapLayer& layer = map->layers[i];
+		for (int cy = cy0; cy <= cy1; ++cy) {
+			for (int cx = cx0; cx <= cx1; ++cx) {
+				CF_TilemapChunk& chunk = layer.chunks[cy * map->chunks_x + cx];
+				if (chunk.dirty) s_bake_chunk(map, layer, cx, cy);
+				if (chunk.geometry.id) cf_draw_static_geometry(chunk.geometry);
+			}
+		}
+	}
+}
@@ -10,6 +10,7 @@
 #include <cute_c_runtime.h>
 
 #include <internal/cute_app_internal.h>
+#include <internal/cute_time_internal.h>
 
 using namespace Cute;
 
@@ -17,6 +18,20 @@ using namespace Cute;
 
 #include <stdio.h>
 #include <inttypes.h>
+#include <algorithm>
+
+#ifdef CF_WINDOWS
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#	ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#		define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#	endif
+#endif
 
 // Initial API design by Noel Berry's blah_time.h
 // https://github.com/NoelFB/blah/blob/master/include/blah_time.h
@@ -42,6 +57,49 @@ int max_updates = 5;
 uint64_t unsimulated_ticks;
 int target_framerate = -1;
 
+// Frame pacing, see `s_fps_limit`.
+static uint64_t s_next_frame_ticks;
+static uint64_t s_frame_start_ticks;
+static uint64_t s_present_end_ticks;
+static bool s_low_latency;
+
+// The moment the update in progress simulates up to, see `cf_time_update_end_ticks`.
+static uint64_t s_update_end_ticks;
+
+// Rolling window of recent timings (in seconds) for `cf_get_frame_time_stats`.
+#define CF_FRAME_SAMPLE_COUNT 256
+
+struct CF_FrameSamples
+{
+	float times[CF_FRAME_SAMPLE_COUNT];
+	int count;
+	int index;
+};
+
+static CF_FrameSamples s_frame_samples;
+static CF_FrameSamples s_work_samples;
+
+static void s_add_sample(CF_FrameSamples* samples, float seconds)
+{
+	samples->times[samples->index] = seconds;
+	samples->index = (samples->index + 1) % CF_FRAME_SAMPLE_COUNT;
+	samples->count = min(samples->count + 1, CF_FRAME_SAMPLE_COUNT);
+}
+
+// Fills `sorted` with the samples in ascending order, returning how many there are.
+static int s_sort_samples(const CF_FrameSamples* samples, float* sorted)
+{
+	CF_MEMCPY(sorted, samples->times, sizeof(float) * samples->count);
+	std::sort(sorted, sorted + samples->count);
+	return samples->count;
+}
+
+static float s_percentile(const float* sorted, int count, float p)
+{
+	if (!count) return 0;
+	return sorted[(int)(p * (count - 1) + 0.5f)];
+}
+
 static void s_init()
 {
 	if (inv_freq == 0) {
@@ -93,9 +151,30 @@ static void s_precise_sleep(double seconds)
 	static double m2 = 0;
 	static int64_t count = 1;
 
+	bool use_estimate = true;
+
+#ifdef CF_WINDOWS
+	// High resolution waitable timers wake up within a fraction of a millisecond, so wait on one for all
+	// but the last millisecond and spin from there. Requires Windows 10 1803 or newer, older versions
+	// fail to make the timer and fall back to sleeping 1ms at a time below.
+	static HANDLE timer = CreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (timer) {
+		use_estimate = false;
+		if (seconds > 1e-3) {
+			uint64_t start = cf_get_ticks();
+			LARGE_INTEGER due;
+			due.QuadPart = -(LONGLONG)((seconds - 1e-3) * 1e7); // Negative means relative, in 100ns units.
+			if (SetWaitableTimerEx(timer, &due, 0, NULL, NULL, NULL, 0)) {
+				WaitForSingleObject(timer, INFINITE);
+			}
+			seconds -= (cf_get_ticks() - start) * inv_freq;
+		}
+	}
+#endif
+
 	// Sleep for 1ms while there's some level of certainty it won't overshoot.
 	// Then break from this loop and perform a spin-lock for the remaining time.
-	while (seconds > estimate) {
+	while (use_estimate && seconds > estimate) {
 		uint64_t start = cf_get_ticks();
 		cf_sleep(1);
 		uint64_t end = cf_get_ticks();
@@ -136,14 +215,67 @@ static void s_precise_sleep(double seconds)
 	}
 }
 
+// Waits for the frame limiter. With high frequency polling the wait is spent polling input instead,
+// see `cf_input_set_high_frequency_polling`.
+static void s_limiter_sleep(double seconds)
+{
+	if (!app || !app->input_high_frequency_polling) {
+		s_precise_sleep(seconds);
+		return;
+	}
+	uint64_t end = cf_get_ticks() + (uint64_t)(seconds * freq);
+	while (1) {
+		cf_input_poll();
+		uint64_t now = cf_get_ticks();
+		if (now >= end) break;
+		double left = (end - now) * inv_freq;
+		s_precise_sleep(left < 1e-3 ? left : 1e-3);
+	}
+}
+
+static double s_refresh_period()
+{
+	if (!app || !app->window) return 0;
+	SDL_DisplayMode mode;
+	int display = SDL_GetWindowDisplayIndex(app->window);
+	if (display < 0 || SDL_GetCurrentDisplayMode(display, &mode) != 0 || mode.refresh_rate <= 0) return 0;
+	return 1.0 / mode.refresh_rate;
+}
+
 static void s_fps_limit()
 {
-	if (target_framerate != -1) {
-		double seconds = 1.0 / target_framerate;
+	if (target_framerate > 0) {
+		// Frames start on a fixed schedule, so oversleeping one frame is made up for on the next one instead
+		// of slowly drifting below the target. After falling more than a frame behind the schedule restarts.
+		uint64_t period = (uint64_t)(freq / target_framerate);
 		uint64_t now = cf_get_ticks();
-		uint64_t delta = now - prev_ticks;
-		s_precise_sleep(seconds - delta * inv_freq);
+		if (!s_next_frame_ticks || now > s_next_frame_ticks + period) {
+			s_next_frame_ticks = now;
+		}
+		if (s_next_frame_ticks > now) {
+			s_limiter_sleep((s_next_frame_ticks - now) * inv_freq);
+		}
+		s_next_frame_ticks += period;
+	} else {
+		s_next_frame_ticks = 0;
+	}
+
+	if (s_low_latency && app && app->vsync && s_present_end_ticks && s_work_samples.count >= 8) {
+		// With vsync the present blocks until the display refreshes. Rather than starting right away and
+		// waiting there, start the frame just in time to be done by the next refresh, so input is read as
+		// late as possible. The budget leaves headroom above the slowest recent frames, as missing the
+		// refresh costs a whole extra frame.
+		double period = target_framerate > 0 ? 1.0 / target_framerate : s_refresh_period();
+		float sorted[CF_FRAME_SAMPLE_COUNT];
+		int count = s_sort_samples(&s_work_samples, sorted);
+		double budget = s_percentile(sorted, count, 0.99f) * 1.25 + 1e-3;
+		double wait = period - budget - (cf_get_ticks() - s_present_end_ticks) * inv_freq;
+		if (period > 0 && wait > 0) {
+			s_limiter_sleep(wait);
+		}
 	}
+
+	s_frame_start_ticks = cf_get_ticks();
 }
 
 void cf_update_time(CF_OnUpdateFn* on_update)
@@ -163,6 +295,7 @@ void cf_update_time(CF_OnUpdateFn* on_update)
 
 		// Record traditional delta time for this update.
 		CF_DELTA_TIME = (float)((now - old_prev_ticks) * inv_freq);
+		s_add_sample(&s_frame_samples, CF_DELTA_TIME);
 
 		// Cap the number of steps we can take forward.
 		// If the app is running slower than the target framerate (especially if just for a moment),
@@ -174,12 +307,14 @@ void cf_update_time(CF_OnUpdateFn* on_update)
 		// This will run input + gameplay loops, but not do any rendering.
 		while (unsimulated_ticks >= ticks_per_timestep) {
 			unsimulated_ticks -= ticks_per_timestep;
+			s_update_end_ticks = now - unsimulated_ticks;
 			if (pause_ticks > 0) {
 				pause_ticks -= (int64_t)ticks_per_timestep;
 				if (pause_ticks < 0) {
 					uint64_t leftover = (uint64_t)(-pause_ticks);
 					if (leftover + unsimulated_ticks > ticks_per_timestep) {
 						unsimulated_ticks -= ticks_per_timestep - leftover;
+						s_update_end_ticks = now - unsimulated_ticks;
 						s_step(ticks_per_timestep);
 						if (on_update) on_update(app->update_udata);
 					} else {
@@ -206,15 +341,65 @@ void cf_update_time(CF_OnUpdateFn* on_update)
 		prev_ticks = now;
 
 		CF_DELTA_TIME = (float)(delta * inv_freq);
+		s_add_sample(&s_frame_samples, CF_DELTA_TIME);
 		if (pause_ticks > 0) {
 			pause_ticks -= (int64_t)delta;
 			if (pause_ticks < 0) pause_ticks = 0;
 			CF_PAUSE_TIME_LEFT = (float)(pause_ticks * inv_freq);
 		} else {
 			s_step(delta);
+			s_update_end_ticks = now;
 			if (on_update) on_update(app->update_udata);
 		}
 	}
+	s_update_end_ticks = 0;
+}
+
+void cf_set_low_latency_mode(bool true_to_enable)
+{
+	s_low_latency = true_to_enable;
+}
+
+bool cf_get_low_latency_mode()
+{
+	return s_low_latency;
+}
+
+CF_FrameTimeStats cf_get_frame_time_stats()
+{
+	CF_FrameTimeStats stats = { };
+	float sorted[CF_FRAME_SAMPLE_COUNT];
+	int count = s_sort_samples(&s_frame_samples, sorted);
+	stats.sample_count = count;
+	if (count) {
+		double sum = 0;
+		for (int i = 0; i < count; ++i) sum += sorted[i];
+		stats.average = (float)(sum / count);
+		stats.p50 = s_percentile(sorted, count, 0.5f);
+		stats.p99 = s_percentile(sorted, count, 0.99f);
+		stats.max = sorted[count - 1];
+	}
+	count = s_sort_samples(&s_work_samples, sorted);
+	stats.work_p50 = s_percentile(sorted, count, 0.5f);
+	stats.work_p99 = s_percentile(sorted, count, 0.99f);
+	return stats;
+}
+
+void cf_time_present_begin()
+{
+	if (s_frame_start_ticks) {
+		s_add_sample(&s_work_samples, (float)((cf_get_ticks() - s_frame_start_ticks) * inv_freq));
+	}
+}
+
+void cf_time_present_end()
+{
+	s_present_end_ticks = cf_get_ticks();
+}
+
+uint64_t cf_time_update_end_ticks()
+{
+	return s_update_end_ticks ? s_update_end_ticks : cf_get_ticks();
 }
 
 void cf_pause_for(float seconds)
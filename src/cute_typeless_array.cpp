@@ -11,6 +11,17 @@
 
 #include <internal/cute_alloc_internal.h>
 
+static void* s_alloc(size_t size, int alignment)
+{
+	return alignment ? cf_aligned_alloc(size, alignment) : CF_ALLOC(size);
+}
+
+static void s_free(void* ptr, int alignment)
+{
+	if (alignment) cf_aligned_free(ptr);
+	else CF_FREE(ptr);
+}
+
 CF_TypelessArray::CF_TypelessArray()
 {
 }
@@ -30,7 +41,7 @@ CF_TypelessArray::CF_TypelessArray(size_t element_size, int capacity)
 
 CF_TypelessArray::~CF_TypelessArray()
 {
-	CF_FREE(m_items);
+	s_free(m_items, m_alignment);
 }
 
 void* CF_TypelessArray::add()
@@ -48,6 +59,16 @@ void* CF_TypelessArray::add(const void* item)
 	return slot;
 }
 
+void* CF_TypelessArray::add_n(int n, const void* items)
+{
+	CF_ASSERT(n >= 0);
+	ensure_capacity(m_count + n);
+	void* slot = (void*)(((uintptr_t)m_items) + m_count * m_element_size);
+	if (items) CF_MEMCPY(slot, items, m_element_size * n);
+	m_count += n;
+	return slot;
+}
+
 void* CF_TypelessArray::insert(int index)
 {
 	CF_ASSERT(index >= 0 && index < m_count);
@@ -80,17 +101,23 @@ void CF_TypelessArray::set(int index, const void* item)
 
 void CF_TypelessArray::remove(int index)
 {
-	CF_ASSERT(index >= 0 && index < m_count);
+	remove_n(index, 1);
+}
+
+void CF_TypelessArray::remove_n(int index, int n)
+{
+	CF_ASSERT(n >= 0 && index >= 0 && index + n <= m_count);
 	void* slot = (void*)(((uintptr_t)m_items) + index * m_element_size);
-	void* slot_plus_one = (void*)(((uintptr_t)m_items) + (index + 1) * m_element_size);
-	int count_to_move = m_count - 1 - index;
-	CF_MEMMOVE(slot_plus_one, slot, m_element_size * count_to_move);
+	void* slot_plus_n = (void*)(((uintptr_t)m_items) + (index + n) * m_element_size);
+	int count_to_move = m_count - n - index;
+	CF_MEMMOVE(slot, slot_plus_n, m_element_size * count_to_move);
+	m_count -= n;
 }
 
 void* CF_TypelessArray::pop()
 {
 	CF_ASSERT(m_count > 0);
-	void* slot = (void*)(((uintptr_t)m_items) + --m_count);
+	void* slot = (void*)(((uintptr_t)m_items) + --m_count * m_element_size);
 	return slot;
 }
 void CF_TypelessArray::unordered_remove(int index)
@@ -102,6 +129,18 @@ void CF_TypelessArray::unordered_remove(int index)
 	--m_count;
 }
 
+void CF_TypelessArray::swap_remove_n(int index, int n)
+{
+	CF_ASSERT(n >= 0 && index >= 0 && index + n <= m_count);
+	// Only elements past the hole need moving, and never more than fit in it.
+	int tail = m_count - (index + n);
+	int count_to_move = tail < n ? tail : n;
+	void* slot = (void*)(((uintptr_t)m_items) + index * m_element_size);
+	void* slot_src = (void*)(((uintptr_t)m_items) + (m_count - count_to_move) * m_element_size);
+	CF_MEMCPY(slot, slot_src, m_element_size * count_to_move);
+	m_count -= n;
+}
+
 void CF_TypelessArray::copy(int src, int dst, int count)
 {
 	CF_ASSERT(src >= 0 && src + count - 1 < m_count);
@@ -139,20 +178,40 @@ void CF_TypelessArray::ensure_capacity(int num_elements)
 		}
 
 		size_t new_size = m_element_size * new_capacity;
-		void* new_items = CF_ALLOC(new_size);
+		void* new_items = s_alloc(new_size, m_alignment);
 		CF_ASSERT(new_items);
 		CF_MEMCPY(new_items, m_items, m_element_size * m_count);
-		CF_FREE(m_items);
+		s_free(m_items, m_alignment);
 		m_items = new_items;
 		m_capacity = new_capacity;
 	}
 }
 
+void CF_TypelessArray::reserve(int num_elements, int alignment)
+{
+	CF_ASSERT(!alignment || (alignment <= 128 && !(alignment & (alignment - 1))));
+	if (alignment && alignment != m_alignment) {
+		int new_capacity = num_elements > m_capacity ? num_elements : m_capacity;
+		if (new_capacity) {
+			void* new_items = s_alloc(m_element_size * new_capacity, alignment);
+			CF_ASSERT(new_items);
+			CF_MEMCPY(new_items, m_items, m_element_size * m_count);
+			s_free(m_items, m_alignment);
+			m_items = new_items;
+			m_capacity = new_capacity;
+		}
+		m_alignment = alignment;
+	}
+	ensure_capacity(num_elements);
+}
+
 void CF_TypelessArray::steal_from(CF_TypelessArray* steal_from_me)
 {
 	this->~CF_TypelessArray();
+	m_element_size = steal_from_me->m_element_size;
 	m_capacity = steal_from_me->m_capacity;
 	m_count = steal_from_me->m_count;
+	m_alignment = steal_from_me->m_alignment;
 	m_items = steal_from_me->m_items;
 	CF_PLACEMENT_NEW(steal_from_me) CF_TypelessArray();
 }
@@ -11,11 +11,20 @@
 #include <cute_defines.h>
 #include <cute_alloc.h>
 
+// Same as `cf_alloc` and friends, but records the call site when allocation tracking is on.
+void* cf_alloc_at(size_t size, const char* file, int line);
+void* cf_calloc_at(size_t size, size_t count, const char* file, int line);
+void* cf_realloc_at(void* ptr, size_t size, const char* file, int line);
+
+// Returns the number of allocations and bytes allocated on any thread since the last call, for `CF_FrameStats`.
+// Not safe to call from multiple threads at once.
+void cf_alloc_take_frame_counts(int* count, uint64_t* bytes);
+
 #if !defined(CF_ALLOC) && !defined(CF_FREE)
-#	define CF_CALLOC(size) cf_calloc(size, 1)
-#	define CF_ALLOC(size) cf_alloc(size)
+#	define CF_CALLOC(size) cf_calloc_at(size, 1, __FILE__, __LINE__)
+#	define CF_ALLOC(size) cf_alloc_at(size, __FILE__, __LINE__)
 #	define CF_FREE(ptr) cf_free(ptr)
-#	define CF_REALLOC(ptr, size) cf_realloc(ptr, size)
+#	define CF_REALLOC(ptr, size) cf_realloc_at(ptr, size, __FILE__, __LINE__)
 #endif
 
 #endif // CF_ALLOC_INTERNAL_H
@@ -28,6 +28,9 @@
 
 struct SDL_Window;
 struct cs_context_t;
+struct CF_AudioLoad;
+struct CF_AudioBankInternal;
+struct CF_ReplayInternal;
 
 extern struct CF_App* app;
 
@@ -55,6 +58,26 @@ struct CF_WindowState
 	bool moved = false;
 };
 
+// An image whose CPU-side pixels were copied into an atlas, and may be dropped, see `cf_render_settings_pixel_budget`.
+struct CF_ResidentPixels
+{
+	size_t size = 0;
+	uint64_t last_use = 0;
+};
+
+// See `cf_app_set_dynamic_resolution`.
+struct CF_DynamicResolutionState
+{
+	bool enabled = false;
+	CF_DynamicResolution params = { };
+	int level = 0; // Index into `canvases`, where higher levels are larger.
+	float scale = 1.0f;
+	float smoothed_milliseconds = 0;
+	int settle = 0; // Fresh GPU timings to skip after a step, as they may still measure the old size.
+	uint64_t timings_frame = 0;
+	Cute::Array<CF_Canvas> canvases; // Made on first use, zero until then. Levels at full scale use `full_canvas` instead.
+};
+
 struct CF_App
 {
 	// App stuff.
@@ -76,9 +99,14 @@ struct CF_App
 	int x;
 	int y;
 	int draw_call_count = 0;
+	CF_FrameStats frame_stats = { }; // The last completed frame, see `cf_app_get_frame_stats`.
+	uint64_t net_bytes_sent_total = 0; // Socket totals as of when `frame_stats` was taken.
+	uint64_t net_bytes_received_total = 0;
 	int canvas_w;
 	int canvas_h;
-	CF_Canvas offscreen_canvas = { };
+	CF_Canvas offscreen_canvas = { }; // Rendered into this frame, either `full_canvas` or a smaller one for dynamic resolution.
+	CF_Canvas full_canvas = { };
+	CF_DynamicResolutionState dynamic_resolution;
 	CF_Canvas backbuffer_canvas = { };
 	CF_Mesh backbuffer_quad = { };
 	CF_Shader backbuffer_shader = { };
@@ -89,21 +117,28 @@ struct CF_App
 	sg_imgui_t sg_imgui;
 	uint64_t default_image_id = CF_PNG_ID_RANGE_LO;
 	bool vsync = false;
+	bool pipelined_rendering = false;
 	bool use_gl = false;
 	bool audio_needs_updates = false;
+	bool audio_headless = false;
+	bool audio_lazy = false; // Waiting on `cf_app_init_audio`, see `APP_OPTIONS_LAZY_AUDIO`.
+	bool default_font_loaded = false; // Parsed on first use, see `cf_font_get`.
+	CF_StartupTimings startup_timings = { };
 	void* update_udata = NULL;
 	bool canvas_blit_init = false;
 	CF_Mesh blit_mesh;
 	CF_Material blit_material;
 	CF_Shader blit_shader;
+	bool noise_shader_init = false;
+	CF_Material noise_material;
+	CF_Shader noise_shader;
 	bool on_sound_finish_single_threaded = false;
-	Cute::Array<CF_Sound> on_sound_finish_queue;
 	void (*on_sound_finish)(CF_Sound, void*) = NULL;
 	void (*on_music_finish)(void*) = NULL;
-	bool on_music_finish_signal = false;
 	void* on_sound_finish_udata = NULL;
 	void* on_music_finish_udata = NULL;
-	CF_Mutex on_sound_finish_mutex = cf_make_mutex();
+	Cute::Map<uint64_t, CF_AudioLoad*> audio_loads;
+	Cute::Array<CF_AudioBankInternal*> audio_banks_to_free;
 
 	// Input stuff.
 	Cute::Array<char> ime_composition;
@@ -117,17 +152,20 @@ struct CF_App
 	CF_MouseState mouse, mouse_prev;
 	CF_List joypads;
 	Cute::Array<CF_Touch> touches;
+	Cute::Array<CF_InputEvent> input_events;
+	bool input_high_frequency_polling = false;
+	CF_ReplayInternal* replay_recording = NULL;
 
 	// ECS stuff.
+	CF_AtomicInt entities_iterated = { }; // Since `frame_stats` was taken.
 	CF_SystemInternal system_internal_builder;
 	Cute::Array<CF_SystemInternal> systems;
 	CF_EntityConfig entity_config_builder;
 	CF_EntityType entity_type_gen = 0;
 	Cute::Map<const char*, CF_EntityType> entity_type_string_to_id;
 	Cute::Array<const char*> entity_type_id_to_string;
-	CF_EntityType current_collection_type_being_iterated = ~0;
-	CF_EntityCollection* current_collection_being_updated = NULL;
-	CF_ComponentListInternal component_list;
+	Cute::Array<CF_ComponentTypeTuple> entity_type_tuples; // Indexed by entity type, to set up new worlds.
+	bool system_profiling = false;
 
 	CF_ComponentConfig component_config_builder;
 	Cute::Map<const char*, CF_ComponentConfig> component_configs;
@@ -139,12 +177,31 @@ struct CF_App
 	uint64_t font_image_id_gen = CF_FONT_ID_RANGE_LO;
 	Cute::Map<const char*, CF_Font*> fonts;
 	Cute::Map<uint64_t, CF_Pixel*> font_pixels;
-	Cute::Map<const char*, CF_TextEffectState> text_effect_states;
+	Cute::Map<uint64_t, int> text_effect_states; // Key'd by hash of the text, indexes `text_effect_pool`.
+	Cute::Array<CF_TextEffectState*> text_effect_pool;
+	Cute::Array<int> text_effect_free_list; // Dead states in `text_effect_pool`, ready for reuse.
 	Cute::Map<const char*, CF_TextEffectFn*> text_effect_fns;
 
 	// Easy sprite stuff.
 	uint64_t easy_sprite_id_gen = CF_EASY_ID_RANGE_LO;
 	Cute::Map<uint64_t, CF_Image> easy_sprites;
+
+	// Dynamic sprite stuff, see `cf_make_dynamic_sprite`.
+	uint64_t dynamic_sprite_id_gen = CF_DYNAMIC_ID_RANGE_LO;
+	Cute::Map<uint64_t, CF_DynamicSprite> dynamic_sprites;
+	Cute::Array<uint64_t> dynamic_sprites_to_upload;
+	uint64_t dynamic_sprite_frame = 0;
+
+	// Sprite definition stuff, see `cf_make_sprite_def`.
+	Cute::Array<CF_SpriteDefInternal> sprite_defs;
+	Cute::Array<int> sprite_def_free_list;
+	Cute::Map<const char*, int> sprite_defs_by_path;
+
+	// Pixel residency stuff, see `cf_render_settings_pixel_budget`.
+	size_t pixel_budget = 0;
+	size_t resident_pixel_size = 0;
+	uint64_t resident_pixel_tick = 0;
+	Cute::Map<uint64_t, CF_ResidentPixels> resident_pixels;
 };
 
 #endif // CF_APP_INTERNAL_H
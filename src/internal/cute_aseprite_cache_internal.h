@@ -14,12 +14,18 @@
 
 CF_Result cf_aseprite_cache_load(const char* aseprite_path, CF_Sprite* sprite_out);
 CF_Result cf_aseprite_cache_load_from_memory(const char* unique_name, const void* data, int sz, CF_Sprite* sprite_out);
+CF_Result cf_aseprite_cache_load_from_file_data(const char* aseprite_path, const void* data, int sz, CF_Sprite* sprite_out);
+CF_Result cf_aseprite_cache_load_batch(const char** aseprite_paths, int count, CF_Sprite* sprites_out);
 void cf_aseprite_cache_unload(const char* aseprite_path);
 CF_Result cf_aseprite_cache_load_ase(const char* aseprite_path, ase_t** ase);
+void cf_aseprite_cache_set_cook_directory(const char* virtual_directory);
+void cf_aseprite_cache_set_parallel_decoding(bool true_to_parallelize);
 
 void cf_make_aseprite_cache();
 void cf_destroy_aseprite_cache();
 void cf_aseprite_cache_get_pixels(uint64_t image_id, void* buffer, int bytes_to_fill);
+bool cf_aseprite_cache_drop_pixels(uint64_t image_id);
+void cf_aseprite_cache_file_changed(const char* virtual_path);
 
 
 #endif // CF_ASEPRITE_CACHE_INTERNAL_H
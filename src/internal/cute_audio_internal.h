@@ -0,0 +1,25 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_AUDIO_INTERNAL_H
+#define CF_AUDIO_INTERNAL_H
+
+#include <cute_defines.h>
+
+struct CF_AudioLoad;
+
+// Blocks until every load from `cf_audio_load_ogg_async` or `cf_audio_load_wav_async` has completed.
+void cf_audio_finish_loads();
+
+// Frees banks from `cf_audio_bank_destroy` once none of their sounds are playing, or right away with `force` set.
+void cf_audio_free_banks(bool force);
+
+// Mixer settings from `cf_audio_set_buffer_size` and `cf_audio_set_mix_thread_sleep`, for `cf_make_app` to start the mixer with.
+int cf_audio_buffer_size();
+int cf_audio_mix_thread_sleep();
+
+#endif // CF_AUDIO_INTERNAL_H
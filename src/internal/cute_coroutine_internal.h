@@ -0,0 +1,23 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_COROUTINE_INTERNAL_H
+#define CF_COROUTINE_INTERNAL_H
+
+#include <cute_coroutine.h>
+
+// Parks a scheduled coroutine until `cf_coroutine_wake` is called on it. Lets other modules hand
+// a coroutine a wake-up without going through a user visible signal.
+void cf_coroutine_wait_woken(CF_Coroutine co);
+void cf_coroutine_wake(CF_Coroutine co);
+
+// Called at the top of every `cf_coroutine_scheduler_update`, for modules that deliver wake-ups
+// from their own polling.
+typedef void (CF_SchedulerPollFn)();
+void cf_coroutine_scheduler_add_poll(CF_SchedulerPollFn* fn);
+
+#endif // CF_COROUTINE_INTERNAL_H
@@ -11,10 +11,13 @@
 #include <cute_array.h>
 #include <cute_math.h>
 #include <cute_draw.h>
+#include <cute_multithreading.h>
 
 #include <float.h>
 
-extern struct CF_Draw* draw;
+// Each thread has its own draw state pointer, see `cf_draw_list_begin`. Only the main thread's
+// points at the real draw state.
+extern thread_local struct CF_Draw* draw;
 
 enum BatchGeometryType : int
 {
@@ -25,13 +28,28 @@ enum BatchGeometryType : int
 	BATCH_GEOMETRY_TYPE_CIRCLE,
 	BATCH_GEOMETRY_TYPE_CAPSULE,
 	BATCH_GEOMETRY_TYPE_SEGMENT,
+	BATCH_GEOMETRY_TYPE_PARTICLES, // Placeholder for a whole particle emitter, see `cf_draw_particles`.
+};
+
+// Specializations of the default draw shader, picked per batch from the geometry it holds. See
+// `src/shaders/compile.sh` for how they're generated.
+enum SpriteShaderVariant : int
+{
+	SPRITE_SHADER_VARIANT_ALL,       // Everything, the only choice for mixed batches.
+	SPRITE_SHADER_VARIANT_SPRITES,   // Sprites and text only, skips the SDF shapes.
+	SPRITE_SHADER_VARIANT_SHAPES,    // Shapes only, skips sampling the atlas.
+	SPRITE_SHADER_VARIANT_ARRAY,     // Everything, sampling atlas pages from layers of `CF_AtlasArray::texture`.
+	SPRITE_SHADER_VARIANT_INSTANCED, // Everything, drawn as instances of `CF_Draw::quad_mesh`.
+	SPRITE_SHADER_VARIANT_PARTICLES, // A particle emitter, drawn as instances of its own mesh, see `s_draw_particles`.
+	SPRITE_SHADER_VARIANT_PARTICLES_ARRAY, // The same, for emitters whose image is on an atlas array layer.
+	SPRITE_SHADER_VARIANT_COUNT,
 };
 
 struct BatchGeometry
 {
 	BatchGeometryType type;
 	CF_Pixel color;
-	CF_Aabb clip;
+	CF_Aabb clip; // In clip space, applied if `do_clipping` is set. See `cf_draw_push_clip_box`.
 	CF_V2 box[4];
 	CF_V2 boxH[4];
 	CF_V2 a, b, c, d;
@@ -41,39 +59,252 @@ struct BatchGeometry
 	float aa;
 	bool do_clipping;
 	bool is_text;
+	bool is_text_sdf; // Text drawn from a distance field glyph, see `cf_font_set_sdf`.
 	bool is_sprite;
 	bool fill;
+	bool opaque; // Drawn in the opaque pass, see `cf_draw_push_opaque`.
+	int particle_draw; // Index into `CF_Draw::particle_draws`, for `BATCH_GEOMETRY_TYPE_PARTICLES`.
 	CF_Color user_params;
 };
 
 #define SPRITEBATCH_SPRITE_GEOMETRY BatchGeometry
 
+// Atlas pages kept as layers of `CF_AtlasArray::texture` are handed to spritebatch as this bit plus
+// their layer, instead of a texture id. Pages all batch together, the layer goes into each vertex.
+#define CF_ATLAS_LAYER_BIT (1ULL << 63)
+#define CF_ATLAS_LAYER_MAX 256 // The layer is passed to the shader as a normalized byte.
+#define CF_IS_ATLAS_LAYER(texture_id) (((texture_id) & ~(uint64_t)(CF_ATLAS_LAYER_MAX - 1)) == CF_ATLAS_LAYER_BIT)
+#define SPRITEBATCH_BATCH_KEY(texture_id) (CF_IS_ATLAS_LAYER(texture_id) ? CF_ATLAS_LAYER_BIT : (texture_id))
+
 #define SPRITEBATCH_ASSERT CF_ASSERT
 #include <cute/cute_spritebatch.h>
 
+// Draw state captured by `cf_draw_particles`, applied as the emitter is drawn by `s_draw_particles`.
+struct CF_ParticleDraw
+{
+	struct CF_ParticleEmitterInternal* emitter;
+	CF_M3x2 mvp;
+	CF_Color tint;
+	CF_Color user_params;
+	float aaf;
+};
+
+// Uniforms for one emitter drawn by `s_draw_particles`, see `particle_params` in draw.glsl.
+struct CF_ParticleBatch
+{
+	CF_Mesh mesh;
+	float mvp[4];
+	float mvp_p[4];
+	float size[4];
+	CF_Color color_start;
+	CF_Color color_end;
+	CF_Color tint;
+	float uv_rect[4];
+	CF_Color user_params;
+	float aa;
+	float layer;
+	CF_Aabb clip;
+};
+
+// One triangle of a tessellated polyline in world space. `a`, `b` and `c` are the segment points the
+// shader measures distance to, `box` is the triangle itself.
+struct CF_PolylineTri
+{
+	CF_V2 box[3];
+	CF_V2 a, b, c;
+};
+
+// A recently drawn polyline, see `cf_draw_polyline`. Identical polylines drawn again reuse `tris` and
+// only re-transform them. Entries not drawn for a whole frame are evicted by `cf_draw_end_frame`.
+struct CF_PolylineTessellation
+{
+	Cute::Array<CF_V2> pts;
+	float radius;
+	float aaf;
+	bool loop;
+	uint64_t frame;
+	Cute::Array<CF_PolylineTri> tris;
+};
+
 struct CF_Strike
 {
 	CF_V2 p0, p1;
 	float thickness;
 };
 
+// Compact GPU-side layout for batches made up entirely of sprites and text. These don't read any of
+// the SDF fields, so they're dropped, and atlas UVs are stored as 16-bit normalized integers. The
+// result is about half the size of `CF_Vertex`.
+struct CF_SpriteVertex
+{
+	CF_V2 p;
+	CF_V2 posH;
+	uint16_t uv[2];
+	CF_Pixel color;
+	uint8_t type;
+	uint8_t alpha;
+	uint8_t fill;
+	uint8_t not_used;
+	CF_Color attributes;
+	float depth;
+};
+
+// One sprite or SDF shape drawn as an instance of `CF_Draw::quad_mesh`, see `s_fill_instances`. The quad's
+// vertices pick out one corner each, so this holds all four. Corners go a, b, c, d as in `BatchGeometry`.
+struct CF_QuadInstance
+{
+	CF_V2 p[4];
+	CF_V2 posH[4];
+	CF_V2 a, b, c;
+	CF_V2 uv_min, uv_max;
+	CF_Pixel color;
+	float radius;
+	float stroke;
+	float aa;
+	uint8_t type;
+	uint8_t alpha;
+	uint8_t fill;
+	uint8_t not_used;
+	CF_Color attributes;
+	float depth;
+};
+
+// One particle in an emitter's instance buffer, see `s_draw_particles`. `t` is how far along its life it is, 0 to 1.
+struct CF_ParticleInstance
+{
+	CF_V2 p;
+	float t;
+};
+
+// Vertex for the debug draw buffer, see `cf_debug_draw_line`. Already in clip space, with a premultiplied color.
+struct CF_DebugVertex
+{
+	CF_V2 posH;
+	CF_Pixel color;
+};
+
+struct CF_VertexJob
+{
+	spritebatch_sprite_t* sprites;
+	int count;
+	CF_Vertex* verts;
+	int vert_count;
+};
+
+// Premade ids handed out to baked atlas images start here, well above any ids users pick by hand
+// for `cf_register_premade_atlas`.
+#define CF_BAKED_IMAGE_ID_BASE (1ULL << 56)
+
+// A call to `cf_draw_static_geometry`, rendered at the next `cf_render_to`.
+struct CF_StaticDraw
+{
+	CF_StaticGeometry geometry;
+	CF_M3x2 mvp;
+};
+
+// One batch of the app canvas recorded by `cf_draw_pipeline_record`. Sprites live in the frame's
+// `sprites` array starting at `first`, and their vertices at `first_vert`.
+struct CF_PipelinedBatch
+{
+	int first;
+	int count;
+	int first_vert;
+	uint64_t texture_id;
+	int texture_w;
+	int texture_h;
+	int vert_count;
+	bool compact;
+	bool opaque;
+	CF_Color debug_color; // Flat color for debug modes, see `cf_draw_set_debug_mode`.
+	SpriteShaderVariant variant;
+	int particles; // Index into `CF_PipelinedFrame::particles` for an emitter, otherwise -1.
+};
+
+// A frame of app canvas geometry in flight, see `cf_app_set_pipelined_rendering`. The frame is
+// batched on the main thread, expanded into vertices on a worker, then drawn by the main thread
+// at the next `cf_app_draw_onto_screen`.
+struct CF_PipelinedFrame
+{
+	bool pending = false;
+	bool threaded = false;
+	bool clear = false;
+	bool opaque_pass = false;
+	CF_DrawDebugMode debug_mode = CF_DRAW_DEBUG_MODE_NONE;
+	CF_Job job = { };
+	CF_Rect viewport;
+	CF_Rect scissor;
+	CF_RenderState render_state;
+	CF_Shader shader;
+	CF_Material material = { };
+	CF_VertexFn* vertex_fn = NULL;
+	Cute::Array<spritebatch_sprite_t> sprites;
+	Cute::Array<CF_PipelinedBatch> batches;
+	int vert_capacity = 0; // Room reserved in `verts` for every batch so far.
+	Cute::Array<CF_Vertex> verts;
+	Cute::Array<CF_SpriteVertex> sprite_verts;
+	Cute::Array<CF_StaticDraw> static_draws;
+	Cute::Array<CF_ParticleBatch> particles;
+	Cute::Array<CF_Mesh> dead_meshes; // Emitter meshes destroyed while the frame was pending.
+};
+
+// Spritebatch's atlas pages as layers of one texture array, see `cf_render_settings_atlas_array`.
+// Textures can only be updated as a whole, so a CPU copy of every layer is kept to rebuild from.
+struct CF_AtlasArray
+{
+	bool enabled = false;
+	CF_Texture texture = { };
+	int layer_count = 0; // Layers of `texture`, grown on demand.
+	bool dirty = false;  // `pixels` changed since `texture` was made.
+	Cute::Array<CF_Pixel> pixels; // Every layer, back to back.
+	Cute::Array<bool> used;
+};
+
+// Remembers the previous batch to tell why the next one couldn't join it, see `cf_draw_get_batch_breaks`.
+struct CF_BatchTracker
+{
+	bool has_flush = false; // Settings of a previous flush this frame are below.
+	bool has_batch = false; // A batch of the current flush is below.
+	CF_BatchBreakReason flush_reason = CF_BATCH_BREAK_REASON_CANVAS; // For the first batch of the current flush.
+	uint64_t canvas_id = 0;
+	uint64_t shader_id = 0;
+	CF_Rect scissor;
+	CF_Rect viewport;
+	CF_RenderState render_state;
+	uint64_t texture_id = 0;
+	int layer = 0; // Of the last sprite in the batch.
+	bool opaque = false;
+};
+
 struct CF_Draw
 {
 	CF_V2 atlas_dims = cf_v2(2048, 2048);
 	CF_V2 texel_dims = cf_v2(1.0f/2048.0f, 1.0f/2048.0f);
 	bool delay_defrag = false;
+	bool headless = false; // No GPU, every draw call is ignored. See `APP_OPTIONS_HEADLESS`.
 	spritebatch_t sb;
 	CF_Mesh mesh;
+	CF_Mesh sprite_mesh;
+	CF_Mesh quad_mesh; // A unit quad plus per-instance `CF_QuadInstance`s, see `s_draw_instances`.
 	CF_Material material;
+	// Atlas size last written to `material`'s fs_params, to skip re-setting it every batch.
+	int uniform_texture_w = 0;
+	int uniform_texture_h = 0;
 	CF_Filter filter = CF_FILTER_NEAREST;
+	int atlas_mip_levels = 4;
+	size_t atlas_budget = 0; // In bytes, zero for no limit.
+	CF_AtlasArray atlas_array;
 	Cute::Array<CF_Color> colors = { cf_color_white() };
 	Cute::Array<CF_Color> tints = { cf_color_grey() };
 	Cute::Array<bool> antialias = { true };
 	Cute::Array<float> antialias_scale = { 1.5f };
+	Cute::Array<bool> opaque = { false };
+	int opaque_count = 0; // Opaque sprites pushed to `sb` since the last flush.
+	bool opaque_pass = false; // Set while flushing with an opaque pass, see `cf_draw_push_opaque`.
 	Cute::Array<CF_RenderState> render_states;
 	Cute::Array<CF_Rect> scissors = { { 0, 0, -1, -1 } };
 	Cute::Array<CF_Rect> viewports = { { 0, 0, -1, -1 } };
 	Cute::Array<int> layers = { 0 };
+	Cute::Array<CF_Aabb> clip_boxes = { cf_make_aabb(cf_v2(-FLT_MAX, -FLT_MAX), cf_v2(FLT_MAX, FLT_MAX)) };
 	Cute::Array<CF_M3x2> cam_stack = { cf_make_identity() };
 	float aaf = 0;
 	CF_M3x2 projection;
@@ -82,8 +313,13 @@ struct CF_Draw
 	void set_aaf();
 	Cute::Array<CF_Color> user_params = { cf_make_color_hex(0) };
 	Cute::Array<CF_Shader> shaders;
+	// Variants of `shaders[0]`, the default shader. Variants that weren't generated are `shaders[0]` itself.
+	CF_Shader sprite_shader_variants[SPRITE_SHADER_VARIANT_COUNT] = { };
 	Cute::Array<CF_V2> temp;
 	Cute::Array<CF_Vertex> verts;
+	Cute::Array<CF_SpriteVertex> sprite_verts;
+	Cute::Array<CF_QuadInstance> quad_instances;
+	Cute::Array<CF_ParticleInstance> particle_instances;
 	Cute::Array<float> font_sizes = { 18 };
 	Cute::Array<const char*> fonts = { sintern("Calibri") };
 	Cute::Array<int> blurs = { 0 };
@@ -94,11 +330,56 @@ struct CF_Draw
 	Cute::Array<bool> text_effects = { true };
 	Cute::Map<uint64_t, uint64_t> premade_sub_image_id_to_png_atlas_map;
 	Cute::Map<uint64_t, CF_AtlasSubImage> premade_sub_image_id_to_sub_image;
+	Cute::Array<CF_Texture> premade_textures;
+	Cute::Map<const char*, uint64_t> baked_image_names;
+	uint64_t baked_image_id_gen = CF_BAKED_IMAGE_ID_BASE;
 	CF_VertexFn* vertex_fn = NULL;
+	int parallel_vertex_threshold = 4096;
+	Cute::Array<CF_VertexJob> vertex_jobs;
+	float defrag_budget_ms = 0;
+	double defrag_seconds_per_op = 0;
+	bool culling = false;
+	CF_DrawCullStats cull_stats = { };
+	CF_DrawCullStats last_cull_stats = { };
+	int batch_count = 0; // Since the last `cf_draw_take_frame_stats`, as is the defrag time.
+	double defrag_seconds = 0;
+	bool recording = false; // This is the state of a draw list, see `cf_make_draw_list`.
+	Cute::Array<spritebatch_sprite_t> recorded;
+	CF_VertexAttribute vertex_attributes[13];
+	Cute::Array<CF_StaticDraw> static_draws;
+	Cute::Array<CF_ParticleDraw> particle_draws;
+	Cute::Map<uint64_t, CF_PolylineTessellation> polyline_cache;
+	uint64_t frame = 0; // Counts calls to `cf_draw_end_frame`.
+	bool pipeline_recording = false; // Batches go into `pipelined` instead of to the GPU.
+	CF_PipelinedFrame pipelined;
+	CF_DrawDebugMode debug_mode = CF_DRAW_DEBUG_MODE_NONE;
+	CF_BatchTracker batch_tracker;
+	Cute::Array<CF_BatchBreak> batch_breaks;
+	Cute::Array<CF_BatchBreak> last_batch_breaks;
+	Cute::Array<CF_DebugVertex> debug_verts;
+	CF_Mesh debug_mesh = { };
+	CF_Shader debug_shader = { };
+	CF_Material debug_material = { };
 };
 
 void cf_make_draw();
 void cf_destroy_draw();
+void cf_draw_tick_and_defrag();
+void cf_draw_end_frame();
+
+// Fills in the draw API's counters of `CF_FrameStats`, and starts counting over.
+void cf_draw_take_frame_stats(struct CF_FrameStats* stats);
+
+// Batches the remaining draw API geometry like `cf_render_to`, but expands vertices on a worker
+// thread and holds off on drawing until `cf_draw_pipeline_submit`.
+void cf_draw_pipeline_record(bool clear);
+
+// Waits on the frame from `cf_draw_pipeline_record` and draws it onto `canvas`. Does nothing if
+// no frame is in flight.
+void cf_draw_pipeline_submit(CF_Canvas canvas);
+
+// Draws every debug line since the last call onto `canvas` in a single draw call, then clears them.
+void cf_debug_draw_flush(CF_Canvas canvas);
 
 // We slice up a 64-bit int into lo + hi ranges to map where we can fetch pixels
 // from. This slices up the 64-bit range into 16 unique range. The ranges are inclusive.
@@ -113,9 +394,46 @@ void cf_destroy_draw();
 #define CF_EASY_ID_RANGE_HI      (CF_EASY_ID_RANGE_LO     + CF_IMAGE_ID_RANGE_SIZE)
 #define CF_PREMADE_ID_RANGE_LO   (CF_EASY_ID_RANGE_HI     + 1)
 #define CF_PREMADE_ID_RANGE_HI   (CF_PREMADE_ID_RANGE_LO  + CF_IMAGE_ID_RANGE_SIZE)
+#define CF_DYNAMIC_ID_RANGE_LO   (CF_PREMADE_ID_RANGE_HI  + 1)
+#define CF_DYNAMIC_ID_RANGE_HI   (CF_DYNAMIC_ID_RANGE_LO  + CF_IMAGE_ID_RANGE_SIZE)
+
+// A sprite with its own streamed texture, outside of the atlases. See `cf_make_dynamic_sprite`.
+struct CF_DynamicSprite
+{
+	CF_Texture texture = { };
+	CF_Pixel* pix = NULL; // CPU copy, updates land here and are uploaded once per frame.
+	int w = 0;
+	int h = 0;
+	bool dirty = false;
+	uint64_t upload_frame = ~0ULL;
+};
+
+// The shared half of a sprite, see `cf_make_sprite_def`. Instances index `app->sprite_defs` with `def - 1`.
+struct CF_SpriteDefInternal
+{
+	bool alive = false;
+	const char* path = NULL; // Set for definitions made by path, see `app->sprite_defs_by_path`.
+	CF_Sprite sprite = { }; // Only the shared fields are used, the playback fields come from each instance.
+	Cute::Array<const CF_Animation*> animations; // Indexed by `CF_SpriteInstance::animation`.
+};
+
+// Uploads dynamic sprites changed since their last upload. Textures only take one update per frame,
+// so sprites already uploaded this frame wait for the next one.
+void cf_dynamic_sprites_upload();
+
+// Builds up to `max_levels` mip levels from a premultiplied atlas page, packed back to back and largest first
+// (the layout `CF_TextureParams::mip_count` expects). Returns the level count, free `*chain_out` with `cf_free`.
+int cf_atlas_mip_chain(const CF_Pixel* pixels, int w, int h, int max_levels, CF_Pixel** chain_out);
 
 SPRITEBATCH_U64 cf_generate_texture_handle(void* pixels, int w, int h, void* udata);
 void cf_destroy_texture_handle(SPRITEBATCH_U64 texture_id, void* udata);
 spritebatch_t* cf_get_draw_sb();
 
+// Called by the image caches once an image's pixels were handed to spritebatch. While over the
+// budget from `cf_render_settings_pixel_budget`, the least recently used pixels are dropped.
+void cf_image_pixels_used(uint64_t image_id, size_t size);
+
+// Stops tracking an image's pixels, for images being unloaded.
+void cf_image_pixels_forget(uint64_t image_id);
+
 #endif // CF_DRAW_INTERNAL_H
@@ -6,6 +6,7 @@
 */
 
 #include <cute_c_runtime.h>
+#include <cute_alloc.h>
 
 #include <internal/cute_dx11.h>
 
@@ -15,6 +16,7 @@
 #define COBJMACROS
 #define D3D11_NO_HELPERS
 #include <d3d11.h>
+#include <d3dcompiler.h>
 #include <dxgi.h>
 
 #include <windowsx.h>
@@ -36,6 +38,8 @@ static struct
 	ID3D11RenderTargetView* render_target_view;
 	ID3D11Texture2D* depth_stencil_buffer;
 	ID3D11DepthStencilView* depth_stencil_view;
+	ID3D11Query* disjoint[CF_GPU_TIMER_FRAME_COUNT];
+	ID3D11Query* timestamps[CF_GPU_TIMER_FRAME_COUNT][CF_GPU_TIMER_MAX_TIMESTAMPS];
 } state;
 
 void cf_d3d11_create_default_render_target()
@@ -202,8 +206,143 @@ void cf_dx11_present(bool vsync)
 	}
 }
 
+bool cf_dx11_timestamps_init()
+{
+	D3D11_QUERY_DESC desc = { };
+	desc.Query = D3D11_QUERY_TIMESTAMP_DISJOINT;
+	for (int i = 0; i < CF_GPU_TIMER_FRAME_COUNT; ++i) {
+		if (!state.disjoint[i] && FAILED(ID3D11Device_CreateQuery(state.device, &desc, &state.disjoint[i]))) {
+			cf_dx11_timestamps_shutdown();
+			return false;
+		}
+	}
+	return true;
+}
+
+void cf_dx11_timestamps_begin_frame(int slot)
+{
+	ID3D11DeviceContext_Begin(state.device_context, (ID3D11Asynchronous*)state.disjoint[slot]);
+}
+
+void cf_dx11_timestamp(int slot, int index)
+{
+	// Timestamp queries are created lazily, since most frames only use a handful.
+	ID3D11Query** query = &state.timestamps[slot][index];
+	if (!*query) {
+		D3D11_QUERY_DESC desc = { };
+		desc.Query = D3D11_QUERY_TIMESTAMP;
+		if (FAILED(ID3D11Device_CreateQuery(state.device, &desc, query))) return;
+	}
+	ID3D11DeviceContext_End(state.device_context, (ID3D11Asynchronous*)*query);
+}
+
+void cf_dx11_timestamps_end_frame(int slot)
+{
+	ID3D11DeviceContext_End(state.device_context, (ID3D11Asynchronous*)state.disjoint[slot]);
+}
+
+int cf_dx11_timestamps_resolve(int slot, int count, uint64_t* ns)
+{
+	// Never flush or stall here -- the caller simply tries again next frame.
+	D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint;
+	if (ID3D11DeviceContext_GetData(state.device_context, (ID3D11Asynchronous*)state.disjoint[slot], &disjoint, sizeof(disjoint), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) {
+		return 0;
+	}
+	for (int i = 0; i < count; ++i) {
+		ID3D11Query* query = state.timestamps[slot][i];
+		if (!query) return -1;
+		UINT64 ticks;
+		if (ID3D11DeviceContext_GetData(state.device_context, (ID3D11Asynchronous*)query, &ticks, sizeof(ticks), D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_OK) {
+			return 0;
+		}
+		ns[i] = (uint64_t)((double)ticks * (1.0e9 / (double)disjoint.Frequency));
+	}
+	// The GPU clock changed frequency mid-frame (e.g. power management), so the timestamps are garbage.
+	return disjoint.Disjoint ? -1 : 1;
+}
+
+void cf_dx11_timestamps_shutdown()
+{
+	for (int i = 0; i < CF_GPU_TIMER_FRAME_COUNT; ++i) {
+		SAFE_RELEASE(ID3D11Query, state.disjoint[i]);
+		for (int j = 0; j < CF_GPU_TIMER_MAX_TIMESTAMPS; ++j) {
+			SAFE_RELEASE(ID3D11Query, state.timestamps[i][j]);
+		}
+	}
+}
+
+void* cf_dx11_readback_begin(const void* texture, int x, int y, int w, int h)
+{
+	ID3D11Texture2D* src = (ID3D11Texture2D*)texture;
+	if (!src) return NULL;
+	D3D11_TEXTURE2D_DESC desc;
+	ID3D11Texture2D_GetDesc(src, &desc);
+	desc.Width = w;
+	desc.Height = h;
+	desc.MipLevels = 1;
+	desc.ArraySize = 1;
+	desc.SampleDesc.Count = 1;
+	desc.SampleDesc.Quality = 0;
+	desc.Usage = D3D11_USAGE_STAGING;
+	desc.BindFlags = 0;
+	desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+	desc.MiscFlags = 0;
+	ID3D11Texture2D* staging = NULL;
+	if (FAILED(ID3D11Device_CreateTexture2D(state.device, &desc, NULL, &staging))) return NULL;
+	D3D11_BOX box = { (UINT)x, (UINT)y, 0, (UINT)(x + w), (UINT)(y + h), 1 };
+	ID3D11DeviceContext_CopySubresourceRegion(state.device_context, (ID3D11Resource*)staging, 0, 0, 0, 0, (ID3D11Resource*)src, 0, &box);
+	return staging;
+}
+
+int cf_dx11_readback_resolve(void* staging, int w, int h, void* out)
+{
+	// Like the timestamps, never stall here -- the caller simply tries again next frame.
+	D3D11_MAPPED_SUBRESOURCE mapped;
+	HRESULT hr = ID3D11DeviceContext_Map(state.device_context, (ID3D11Resource*)staging, 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped);
+	if (hr == DXGI_ERROR_WAS_STILL_DRAWING) return 0;
+	if (FAILED(hr)) return -1;
+	for (int i = 0; i < h; ++i) {
+		CF_MEMCPY((uint8_t*)out + i * w * 4, (uint8_t*)mapped.pData + i * mapped.RowPitch, w * 4);
+	}
+	ID3D11DeviceContext_Unmap(state.device_context, (ID3D11Resource*)staging, 0);
+	return 1;
+}
+
+void cf_dx11_readback_release(void* staging)
+{
+	ID3D11Texture2D* texture = (ID3D11Texture2D*)staging;
+	SAFE_RELEASE(ID3D11Texture2D, texture);
+}
+
+void* cf_dx11_compile_shader(const char* source, const char* entry, const char* target, size_t* size)
+{
+	// Loaded on demand just like sokol_gfx does, the DLL only matters when there's something to compile.
+	static HMODULE dll = NULL;
+	static pD3DCompile compile = NULL;
+	if (!dll) {
+		dll = LoadLibraryA("d3dcompiler_47.dll");
+		if (!dll) return NULL;
+		compile = (pD3DCompile)(void*)GetProcAddress(dll, "D3DCompile");
+	}
+	if (!compile) return NULL;
+	ID3DBlob* output = NULL;
+	ID3DBlob* errors = NULL;
+	HRESULT hr = compile(source, CF_STRLEN(source), NULL, NULL, NULL, entry, target, D3DCOMPILE_PACK_MATRIX_COLUMN_MAJOR | D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &output, &errors);
+	SAFE_RELEASE(ID3D10Blob, errors);
+	if (FAILED(hr) || !output) {
+		SAFE_RELEASE(ID3D10Blob, output);
+		return NULL;
+	}
+	*size = (size_t)ID3D10Blob_GetBufferSize(output);
+	void* bytecode = CF_ALLOC(*size);
+	CF_MEMCPY(bytecode, ID3D10Blob_GetBufferPointer(output), *size);
+	SAFE_RELEASE(ID3D10Blob, output);
+	return bytecode;
+}
+
 void cf_dx11_shutdown()
 {
+	cf_dx11_timestamps_shutdown();
 	cf_d3d11_destroy_default_render_target();
 	SAFE_RELEASE(IDXGISwapChain, state.swap_chain);
 	SAFE_RELEASE(ID3D11DeviceContext, state.device_context);
@@ -216,5 +355,15 @@ void cf_dx11_init(void* hwnd, int w, int h, int sample_count) { CF_UNUSED(hwnd);
 sg_context_desc cf_dx11_get_context() { sg_context_desc desc; CF_MEMSET(&desc, 0, sizeof(desc)); return desc; }
 void cf_dx11_present(bool vsync) { CF_UNUSED(vsync); }
 void cf_dx11_shutdown() {}
+bool cf_dx11_timestamps_init() { return false; }
+void cf_dx11_timestamps_begin_frame(int slot) { CF_UNUSED(slot); }
+void cf_dx11_timestamp(int slot, int index) { CF_UNUSED(slot); CF_UNUSED(index); }
+void cf_dx11_timestamps_end_frame(int slot) { CF_UNUSED(slot); }
+int cf_dx11_timestamps_resolve(int slot, int count, uint64_t* ns) { CF_UNUSED(slot); CF_UNUSED(count); CF_UNUSED(ns); return -1; }
+void cf_dx11_timestamps_shutdown() {}
+void* cf_dx11_readback_begin(const void* texture, int x, int y, int w, int h) { CF_UNUSED(texture); CF_UNUSED(x); CF_UNUSED(y); CF_UNUSED(w); CF_UNUSED(h); return NULL; }
+int cf_dx11_readback_resolve(void* staging, int w, int h, void* out) { CF_UNUSED(staging); CF_UNUSED(w); CF_UNUSED(h); CF_UNUSED(out); return -1; }
+void cf_dx11_readback_release(void* staging) { CF_UNUSED(staging); }
+void* cf_dx11_compile_shader(const char* source, const char* entry, const char* target, size_t* size) { CF_UNUSED(source); CF_UNUSED(entry); CF_UNUSED(target); CF_UNUSED(size); return NULL; }
 
 #endif // SOKOL_D3D11
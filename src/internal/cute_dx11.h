@@ -16,4 +16,32 @@ sg_context_desc cf_dx11_get_context();
 void cf_dx11_present(bool vsync);
 void cf_dx11_shutdown();
 
+// GPU timestamp queries, see cf_gpu_timer_push in cute_graphics.cpp.
+// Queries are grouped into `CF_GPU_TIMER_FRAME_COUNT` frame slots, each holding up to
+// `CF_GPU_TIMER_MAX_TIMESTAMPS` timestamps, and are read back a few frames later.
+#define CF_GPU_TIMER_FRAME_COUNT 4
+#define CF_GPU_TIMER_MAX_TIMESTAMPS 256
+
+bool cf_dx11_timestamps_init();
+void cf_dx11_timestamps_begin_frame(int slot);
+void cf_dx11_timestamp(int slot, int index);
+void cf_dx11_timestamps_end_frame(int slot);
+// Returns 0 if the results aren't ready yet, 1 on success (`ns` filled in with nanoseconds),
+// or -1 if the results were invalidated and should be discarded.
+int cf_dx11_timestamps_resolve(int slot, int count, uint64_t* ns);
+void cf_dx11_timestamps_shutdown();
+
+// Canvas readback, see cf_canvas_readback_async in cute_graphics.cpp.
+// Copies a rectangle of `texture` (an ID3D11Texture2D*) into a new staging texture, or returns NULL on failure.
+void* cf_dx11_readback_begin(const void* texture, int x, int y, int w, int h);
+// Returns 0 if the copy isn't done yet, 1 on success (`out` filled in with `w * h` tightly packed 4-byte pixels),
+// or -1 if the copy failed.
+int cf_dx11_readback_resolve(void* staging, int w, int h, void* out);
+void cf_dx11_readback_release(void* staging);
+
+// Shader cache, see cf_set_shader_cache_directory in cute_graphics.cpp.
+// Compiles HLSL `source` for `target` (vs_5_0 or ps_5_0) with the same flags sokol_gfx uses. Returns NULL on failure,
+// otherwise `*size` bytes of bytecode to be freed with `CF_FREE`.
+void* cf_dx11_compile_shader(const char* source, const char* entry, const char* target, size_t* size);
+
 #endif // CF_DX11_H
@@ -11,13 +11,65 @@
 #include <cute_string.h>
 #include <cute_array.h>
 #include <cute_ecs.h>
+#include <cute_multithreading.h>
 
+// Size in bytes of each block of component storage within an entity collection.
+#define CF_ECS_CHUNK_SIZE (16 * 1024)
+
+// Components are stored in fixed-size chunks, each holding up to `chunk_capacity` entities. Within
+// a chunk each component type is laid out contiguously (SoA) starting at `component_offsets[i]`.
+// Entities rarely have more than a handful of components, so lists of component types are kept inline.
+using CF_ComponentTypeTuple = Cute::SmallArray<const char*, 8>;
+
+// Entity `index` lives in chunk `index / chunk_capacity` at slot `index % chunk_capacity`. Chunks
+// are never reallocated, so adding entities never moves existing components.
 struct CF_EntityCollection
 {
-	Cute::Array<const char*> component_type_tuple;
+	~CF_EntityCollection()
+	{
+		for (int i = 0; i < chunks.count(); ++i) {
+			cf_aligned_free(chunks[i]);
+		}
+	}
+
+	CF_ComponentTypeTuple component_type_tuple;
 	Cute::Array<CF_Handle> entity_handles;
-	Cute::Array<CF_TypelessArray> component_tables;
+	Cute::Array<uint8_t*> chunks;
+	Cute::Array<int> component_offsets;
+	Cute::Array<int> component_sizes;
+	int chunk_capacity = 1;
+	int chunk_size = 0;
+	// World change version of the last write to each component within each chunk, for chunk `c` and
+	// component `i` see `chunk_versions[c * component_type_tuple.count() + i]`.
+	Cute::Array<uint64_t> chunk_versions;
+	// Parallel to `component_type_tuple`, the ID of each component (see `cf_component_get_id`).
+	Cute::Array<int> component_ids;
+	// Maps a component ID (see `cf_component_get_id`) to its index in `component_type_tuple`, or -1.
+	// IDs at or past the end of this table belong to components not in this collection.
+	Cute::Array<int> component_index_by_id;
 	int inactive_count = 0;
+
+	CF_INLINE int component_index(int component_id) const
+	{
+		return (unsigned)component_id < (unsigned)component_index_by_id.count() ? component_index_by_id[component_id] : -1;
+	}
+
+	CF_INLINE void* component(int table, int index) const
+	{
+		uint8_t* chunk = chunks[index / chunk_capacity];
+		return chunk + component_offsets[table] + component_sizes[table] * (index % chunk_capacity);
+	}
+
+	CF_INLINE int active_count() const { return entity_handles.count() - inactive_count; }
+
+	CF_INLINE uint64_t& chunk_version(int chunk, int table) { return chunk_versions[chunk * component_type_tuple.count() + table]; }
+
+	CF_INLINE void mark_changed(int index, uint64_t version)
+	{
+		for (int i = 0; i < component_type_tuple.count(); ++i) {
+			chunk_version(index / chunk_capacity, i) = version;
+		}
+	}
 };
 
 struct CF_SystemInternal
@@ -29,7 +81,10 @@ struct CF_SystemInternal
 		pre_update_fn = NULL;
 		update_fn = NULL;
 		post_update_fn = NULL;
+		parallel = false;
 		component_type_tuple.clear();
+		component_read_only.clear();
+		component_changed_filter.clear();
 	}
 
 	const char* name = { 0 };
@@ -37,7 +92,21 @@ struct CF_SystemInternal
 	void (*pre_update_fn)(void* udata) = NULL;
 	CF_SystemUpdateFn* update_fn = NULL;
 	void (*post_update_fn)(void* udata) = NULL;
-	Cute::Array<const char*> component_type_tuple;
+	bool parallel = false;
+	CF_ComponentTypeTuple component_type_tuple;
+	// Parallel to `component_type_tuple`, true if the system only reads that component.
+	Cute::SmallArray<bool, 8> component_read_only;
+	// Parallel to `component_type_tuple`, true to skip chunks where that component hasn't changed.
+	Cute::SmallArray<bool, 8> component_changed_filter;
+};
+
+// A field registered with `cf_component_add_field`, for saving and loading components.
+struct CF_ComponentField
+{
+	const char* name = NULL;
+	CF_ComponentFieldType type = CF_COMPONENT_FIELD_TYPE_INT32;
+	int offset = 0;
+	int count = 1;
 };
 
 struct CF_ComponentConfig
@@ -50,6 +119,7 @@ struct CF_ComponentConfig
 		cleanup = NULL;
 		initializer_udata = NULL;
 		cleanup_udata = NULL;
+		fields.clear();
 	}
 
 	const char* name = NULL;
@@ -58,6 +128,7 @@ struct CF_ComponentConfig
 	CF_ComponentFn* cleanup = NULL;
 	void* initializer_udata = NULL;
 	void* cleanup_udata = NULL;
+	Cute::Array<CF_ComponentField> fields;
 };
 
 struct CF_EntityConfig
@@ -69,29 +140,37 @@ struct CF_EntityConfig
 	}
 
 	const char* entity_type = NULL;
-	Cute::Array<const char*> component_types;
+	CF_ComponentTypeTuple component_types;
 };
 
 using CF_EntityType = uint16_t;
 #define CF_INVALID_ENTITY_TYPE ((uint16_t)~0)
 
+// The components of a single chunk of an entity collection, as handed to a system's update function.
+// Usually the whole chunk, but may start partway in at slot `first`.
 struct CF_ComponentListInternal
 {
-	int count = 0;
 	CF_Handle* entities = NULL;
-	Cute::Array<const char*> types;
-	Cute::Array<CF_TypelessArray>* ptrs;
+	uint8_t* chunk = NULL;
+	int first = 0;
+	const CF_EntityCollection* collection = NULL;
 
 	void* find_components(const char* type)
 	{
 		type = sintern(type);
-		for (int i = 0; i < count; ++i) {
-			if (types[i] == type) {
-				return (*ptrs)[i].data();
+		for (int i = 0; i < collection->component_type_tuple.count(); ++i) {
+			if (collection->component_type_tuple[i] == type) {
+				return chunk + collection->component_offsets[i] + collection->component_sizes[i] * first;
 			}
 		}
 		return NULL;
 	}
+
+	void* find_components(int component_id)
+	{
+		int index = collection->component_index(component_id);
+		return index >= 0 ? chunk + collection->component_offsets[index] + collection->component_sizes[index] * first : NULL;
+	}
 };
 
 struct CF_ChangeType
@@ -100,10 +179,100 @@ struct CF_ChangeType
 	CF_EntityType type;
 };
 
+// How components map from one entity type to another, cached per pair of types for `cf_entity_change_type`.
+struct CF_TypeTransition
+{
+	uint64_t version = 0;
+	// For each component of the new type, its index in the old type, or -1 if it must be initialized.
+	Cute::Array<int> old_tables;
+	// Indices of old components which aren't carried over to the new type, in cleanup order.
+	Cute::Array<int> dropped_tables;
+};
+
+struct CF_SystemMatch
+{
+	CF_EntityType type;
+	CF_EntityCollection* collection;
+};
+
+struct CF_QueryInternal
+{
+	// Only the component requirements are used, so queries can share `s_system_tables` with systems.
+	CF_SystemInternal requirements;
+	CF_ComponentTypeTuple excluded;
+	// Collections matching the query within the world `world_id`, rebuilt whenever the ECS schema changes.
+	uint64_t world_id = 0;
+	uint64_t version = 0;
+	Cute::Array<CF_SystemMatch> matches;
+};
+
+// Components of an entity type, initialized once and then copied into each new instance.
+struct CF_PrefabInternal
+{
+	~CF_PrefabInternal()
+	{
+		cf_aligned_free(components);
+	}
+
+	CF_EntityType type = CF_INVALID_ENTITY_TYPE;
+	// Each component starts 16-byte aligned at `offsets[i]`, parallel to the entity type's component tuple.
+	uint8_t* components = NULL;
+	Cute::Array<int> offsets;
+	Cute::Array<int> sizes;
+};
+
 struct CF_WorldInternal
 {
 	Cute::HandleTable handles;
 	Cute::Map<CF_EntityType, CF_EntityCollection*> entity_collections;
+	// Keyed by the old entity type in the upper 16 bits and the new type in the lower 16 bits.
+	Cute::Map<uint32_t, CF_TypeTransition*> type_transitions;
+	// Collections matching each system, for system i see [system_match_offsets[i], system_match_offsets[i + 1]).
+	// Rebuilt whenever `system_matches_version` falls behind the ECS schema (new systems, entity types or component names).
+	Cute::Array<CF_SystemMatch> system_matches;
+	Cute::Array<int> system_match_offsets;
+	uint64_t system_matches_version = 0;
+	// Stamped onto chunks as their components are written, and bumped around each system run.
+	uint64_t change_version = 1;
+	// The change version each system last ran at, indexed like `app->systems`.
+	Cute::Array<uint64_t> system_versions;
+	// Unique per world, so snapshots can tell whether their change versions refer to this world.
+	uint64_t id = 0;
+	Cute::Array<CF_Entity> delayed_destroy_entities;
+	Cute::Array<CF_Entity> delayed_deactivate_entities;
+	Cute::Array<CF_Entity> delayed_activate_entities;
+	Cute::Array<CF_ChangeType> delayed_change_type;
+	// Locks the delayed operations while `running_parallel`, as systems on worker threads queue them.
+	CF_Mutex delayed_mutex;
+	bool running_parallel = false;
+	// Recorded by `cf_run_systems` while profiling is on, see `cf_system_profiling_enable`.
+	Cute::Array<CF_SystemProfile> system_profiles;
+	CF_SystemsProfile systems_profile = { };
+};
+
+// A saved copy of an entity collection. Chunk buffers persist across saves and may outnumber
+// `chunk_count`, each paired with the change versions of the components it holds.
+struct CF_CollectionSnapshot
+{
+	~CF_CollectionSnapshot()
+	{
+		for (int i = 0; i < chunks.count(); ++i) {
+			cf_aligned_free(chunks[i]);
+		}
+	}
+
+	Cute::Array<CF_Handle> entity_handles;
+	int inactive_count = 0;
+	Cute::Array<uint8_t*> chunks;
+	Cute::Array<uint64_t> chunk_versions;
+	int chunk_count = 0;
+};
+
+struct CF_WorldSnapshotInternal
+{
+	uint64_t world_id = 0;
+	Cute::HandleTable handles;
+	Cute::Map<CF_EntityType, CF_CollectionSnapshot*> collections;
 	Cute::Array<CF_Entity> delayed_destroy_entities;
 	Cute::Array<CF_Entity> delayed_deactivate_entities;
 	Cute::Array<CF_Entity> delayed_activate_entities;
@@ -0,0 +1,24 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_FILE_SYSTEM_INTERNAL_H
+#define CF_FILE_SYSTEM_INTERNAL_H
+
+#include <cute_defines.h>
+
+// Lets PhysFS mount .cfpk packs, see `cf_fs_write_pack`.
+void cf_register_pack_archiver();
+
+// Returns an entry stored uncompressed within an entire pack in memory, or NULL.
+const void* cf_pack_find_stored_entry(const void* pack, size_t pack_size, const char* path, size_t size);
+
+// LZ4 block compression, shared by packs and compressed writes. `dst` must hold `cf_lz4_bound(size)` bytes.
+size_t cf_lz4_bound(size_t size);
+size_t cf_lz4_compress(const uint8_t* src, size_t size, uint8_t* dst);
+bool cf_lz4_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size);
+
+#endif // CF_FILE_SYSTEM_INTERNAL_H
@@ -14,6 +14,7 @@
 #include <cute_color.h>
 #include <cute_alloc.h>
 #include <cute_draw.h>
+#include <cute_multithreading.h>
 
 #include <stb/stb_truetype.h>
 
@@ -25,15 +26,45 @@ struct CF_Glyph
 	int w, h;
 	float xadvance;
 	bool visible;
+	bool pending; // Pixels are being rasterized in the background by `cf_font_prewarm`.
+	bool sdf; // A distance field shared by every font size, see `cf_font_set_sdf`.
 };
 
+struct CF_Font;
+
+struct CF_GlyphJob
+{
+	struct Entry
+	{
+		uint64_t key;
+		int index;
+		int w, h;
+		CF_Pixel* pixels;
+	};
+
+	CF_Font* font;
+	float font_size;
+	int blur;
+	bool sdf;
+	int count;
+	Entry* entries;
+	CF_Job handle; // From `cf_threadpool_add_task`, to poll or wait on.
+};
+
+#define CF_FONT_BMP_SIZE 0x10000
+
 struct CF_Font
 {
 	uint8_t* file_data = NULL;
 	stbtt_fontinfo info;
-	Cute::Map<uint64_t, int> kerning;
+	Cute::Map<uint64_t, int> kerning; // Key'd by `CF_KERN_KEY` of two glyph indices.
+	Cute::Array<uint16_t> bmp_glyph_indices; // Codepoint to glyph index, for the first `CF_FONT_BMP_SIZE` codepoints.
+	int replacement_glyph_index = 0;
 	Cute::Map<uint64_t, CF_Glyph> glyphs;
 	Cute::Array<uint64_t> image_ids;
+	Cute::Array<CF_GlyphJob*> glyph_jobs;
+	int pending_glyph_count = 0;
+	bool sdf = false; // See `cf_font_set_sdf`.
 	int ascent;
 	int descent;
 	int line_gap;
@@ -43,6 +74,8 @@ struct CF_Font
 };
 
 CF_Font* cf_font_get(const char* font_name);
+int cf_font_glyph_index(const CF_Font* font, int codepoint);
+float cf_font_raster_size(const CF_Font* font, float font_size);
 CF_Glyph* cf_font_get_glyph(CF_Font* font, int codepoint, float font_size, int blur);
 float cf_font_get_kern(CF_Font* font, float font_size, int codepoint0, int codepoint1);
 
@@ -54,7 +87,7 @@ struct CF_TextCode
 	int index_in_string;
 	int glyph_count;
 	CF_TextEffectFn* fn;
-	Cute::Map<const char*, CF_TextCodeVal> params;
+	int params; // Index into `CF_TextEffectState::params`.
 };
 
 struct CF_TextEffectState
@@ -67,6 +100,31 @@ struct CF_TextEffectState
 	Cute::Array<CF_TextCode> codes;
 	Cute::Array<CF_TextCode> parse_stack;
 
+	// Params of each code, indexed by `CF_TextCode::params`. Maps are cleared instead of freed, so parsing
+	// into a recycled state doesn't go to the heap.
+	Cute::Array<Cute::Map<const char*, CF_TextCodeVal>> params;
+	int params_count = 0;
+
+	// Empties the state for reuse, holding onto all of its memory.
+	CF_INLINE void reset()
+	{
+		sanitized.clear();
+		hash = 0;
+		elapsed = 0;
+		alive = false;
+		effects.clear();
+		codes.clear();
+		parse_stack.clear();
+		params_count = 0;
+	}
+
+	CF_INLINE int params_add()
+	{
+		if (params_count == params.count()) params.add();
+		else params[params_count].clear();
+		return params_count++;
+	}
+
 	CF_INLINE void parse_add(CF_TextCode code) { parse_stack.add(code); }
 	CF_INLINE bool parse_finish(const char* effect_name, int final_index)
 	{
@@ -83,4 +141,38 @@ struct CF_TextEffectState
 	}
 };
 
+// One glyph of a `CF_TextLayout`, positioned relative to the layout's origin.
+struct CF_TextLayoutGlyph
+{
+	uint64_t glyph_key;
+	uint64_t image_id;
+	int cp;
+	int index; // One past this glyph's index into the sanitized string, as used by text effects.
+	int w, h;
+	CF_V2 pen;
+	CF_V2 q0, q1;
+	float xadvance;
+	bool visible;
+	bool pending;
+	bool sdf;
+};
+
+struct CF_TextLayoutInternal
+{
+	Cute::String text;
+	uint64_t hash = 0;
+
+	// Inputs the layout was built with, a mismatch triggers a rebuild.
+	const char* font_name = NULL;
+	float font_size = 0;
+	int blur = 0;
+	float wrap_width = 0;
+	bool vertical = false;
+	bool text_effects = false;
+
+	CF_V2 size = { };
+	CF_TextEffectState effect_state;
+	Cute::Array<CF_TextLayoutGlyph> glyphs;
+};
+
 #endif // CF_FONT_INTERNAL_H
@@ -8,8 +8,22 @@
 #ifndef CF_GRAPHICS_INTERNAL_H
 #define CF_GRAPHICS_INTERNAL_H
 
+#include <cute_graphics.h>
+
 void cf_destroy_graphics();
 void cf_commit();
 void cf_clear_graphics_static_pointers();
 
+// Overwrites the render state, textures and uniforms of `dst` with those of `src`.
+void cf_material_copy(CF_Material dst, CF_Material src);
+
+// Returns true if `shader` reads the vertex attribute `name`.
+bool cf_shader_has_vertex_input(CF_Shader shader, const char* name);
+
+// Returns true if `canvas` has a depth buffer, including the screen's.
+bool cf_canvas_has_depth(CF_Canvas canvas);
+
+// Same as `cf_apply_canvas`, but the depth buffer is cleared even when `clear` is false.
+void cf_apply_canvas_clear_depth(CF_Canvas canvas, bool clear);
+
 #endif // CF_GRAPHICS_INTERNAL_H
@@ -0,0 +1,69 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_HANDLE_TABLE_INTERNAL_H
+#define CF_HANDLE_TABLE_INTERNAL_H
+
+#include <cute_handle_table.h>
+#include <cute_array.h>
+
+union CF_HandleEntry
+{
+	struct
+	{
+		uint64_t user_index : 32;
+		uint64_t user_type : 15;
+		uint64_t active : 1;
+		uint64_t generation : 16;
+	} data;
+	uint64_t val = 0;
+};
+
+// Entries past `m_handles.count()` have never been handed out. They're implicitly free, so
+// growing the table only reserves memory instead of threading every new entry onto the freelist.
+struct CF_HandleTable
+{
+	uint32_t m_freelist = ~0;
+	Cute::Array<CF_HandleEntry> m_handles;
+};
+
+// Inlined versions of the `cf_handle_allocator_*` getters, for hot paths within CF.
+
+CF_INLINE uint32_t cf_handle_table_slot(CF_Handle handle)
+{
+	return (uint32_t)(handle >> 32);
+}
+
+CF_INLINE bool cf_handle_table_valid(const CF_HandleTable* table, CF_Handle handle)
+{
+	uint32_t slot = cf_handle_table_slot(handle);
+	return slot < (uint32_t)table->m_handles.count() && table->m_handles.data()[slot].data.generation == (handle & 0xFFFF);
+}
+
+CF_INLINE const CF_HandleEntry& cf_handle_table_entry(const CF_HandleTable* table, CF_Handle handle)
+{
+	const CF_HandleEntry& entry = table->m_handles.data()[cf_handle_table_slot(handle)];
+	CF_ASSERT(entry.data.generation == (handle & 0xFFFF));
+	return entry;
+}
+
+CF_INLINE uint32_t cf_handle_table_get_index(const CF_HandleTable* table, CF_Handle handle)
+{
+	return (uint32_t)cf_handle_table_entry(table, handle).data.user_index;
+}
+
+CF_INLINE uint16_t cf_handle_table_get_type(const CF_HandleTable* table, CF_Handle handle)
+{
+	return (uint16_t)cf_handle_table_entry(table, handle).data.user_type;
+}
+
+CF_INLINE bool cf_handle_table_active(const CF_HandleTable* table, CF_Handle handle)
+{
+	return !!cf_handle_table_entry(table, handle).data.active;
+}
+
+#endif // CF_HANDLE_TABLE_INTERNAL_H
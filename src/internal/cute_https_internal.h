@@ -0,0 +1,18 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_HTTPS_INTERNAL_H
+#define CF_HTTPS_INTERNAL_H
+
+#include <cute_defines.h>
+
+void cf_https_shutdown();
+
+// Requests made and not yet destroyed, for `CF_FrameStats`.
+int cf_https_live_request_count();
+
+#endif // CF_HTTPS_INTERNAL_H
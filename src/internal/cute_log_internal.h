@@ -0,0 +1,15 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_LOG_INTERNAL_H
+#define CF_LOG_INTERNAL_H
+
+// Stops the background log thread, writes out anything left, closes the log file and frees all per-thread
+// buffers. Logging again afterwards starts things back up.
+void cf_log_shutdown();
+
+#endif // CF_LOG_INTERNAL_H
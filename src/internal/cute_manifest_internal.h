@@ -0,0 +1,14 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_MANIFEST_INTERNAL_H
+#define CF_MANIFEST_INTERNAL_H
+
+// Destroys every manifest still alive, unloading their assets.
+void cf_destroy_manifests();
+
+#endif // CF_MANIFEST_INTERNAL_H
@@ -19,4 +19,15 @@ void cf_metal_present(bool vsync);
 float cf_metal_get_dpi_scale();
 void cf_metal_get_drawable_size(int* w, int* h);
 
+// Canvas readback, see cf_canvas_readback_async in cute_graphics.cpp. Same contract as the
+// cf_dx11_readback_* functions. Must be called after sg_commit, as the copy goes into its own
+// command buffer and has to run after the frame's.
+void* cf_metal_readback_begin(sg_image image, int x, int y, int w, int h);
+int cf_metal_readback_resolve(void* readback, int w, int h, void* out);
+void cf_metal_readback_release(void* readback);
+
+// Returns the backend texture behind a sokol image, an ID3D11Texture2D* or a GL texture name. Lives
+// next to the sokol_gfx.h implementation in cute_metal.mm, as sokol keeps it private.
+const void* cf_sg_image_native_texture(sg_image image);
+
 #endif // CF_METAL_H
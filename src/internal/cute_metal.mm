@@ -121,6 +121,9 @@ const void* cf_metal_get_drawable() { return NULL; }
 void cf_metal_present(bool vsync) { CF_UNUSED(vsync); }
 float cf_metal_get_dpi_scale() { return 0; }
 void cf_metal_get_drawable_size(int* w, int* h) { CF_UNUSED(w); CF_UNUSED(h); }
+void* cf_metal_readback_begin(sg_image image, int x, int y, int w, int h) { CF_UNUSED(image); CF_UNUSED(x); CF_UNUSED(y); CF_UNUSED(w); CF_UNUSED(h); return NULL; }
+int cf_metal_readback_resolve(void* readback, int w, int h, void* out) { CF_UNUSED(readback); CF_UNUSED(w); CF_UNUSED(h); CF_UNUSED(out); return -1; }
+void cf_metal_readback_release(void* readback) { CF_UNUSED(readback); }
 
 #endif // SOKOL_METAL
 
@@ -139,3 +142,57 @@ void cf_metal_get_drawable_size(int* w, int* h) { CF_UNUSED(w); CF_UNUSED(h); }
 #define SOKOL_IMGUI_NO_SOKOL_APP
 #include <internal/imgui/sokol_imgui.h>
 #include <sokol/sokol_gfx_imgui.h>
+
+const void* cf_sg_image_native_texture(sg_image image)
+{
+	_sg_image_t* img = _sg_lookup_image(&_sg.pools, image.id);
+	if (!img) return NULL;
+#if defined(SOKOL_D3D11)
+	return (const void*)img->d3d11.tex2d;
+#elif defined(_SOKOL_ANY_GL)
+	return (const void*)(uintptr_t)img->gl.tex[img->cmn.active_slot];
+#else
+	return NULL;
+#endif
+}
+
+#ifdef SOKOL_METAL
+
+struct CF_MetalReadback
+{
+	id<MTLBuffer> buffer;
+	id<MTLCommandBuffer> cmd_buffer;
+};
+
+void* cf_metal_readback_begin(sg_image image, int x, int y, int w, int h)
+{
+	_sg_image_t* img = _sg_lookup_image(&_sg.pools, image.id);
+	if (!img) return NULL;
+	id<MTLTexture> texture = _sg_mtl_id(img->mtl.tex[img->cmn.active_slot]);
+	CF_MetalReadback* readback = new CF_MetalReadback;
+	readback->buffer = [_sg.mtl.device newBufferWithLength:(NSUInteger)(w * h * 4) options:MTLResourceStorageModeShared];
+	// sokol already committed this frame's command buffer, so this one runs after it on the same queue.
+	readback->cmd_buffer = [_sg.mtl.cmd_queue commandBuffer];
+	id<MTLBlitCommandEncoder> blit = [readback->cmd_buffer blitCommandEncoder];
+	[blit copyFromTexture:texture sourceSlice:0 sourceLevel:0 sourceOrigin:MTLOriginMake((NSUInteger)x, (NSUInteger)y, 0) sourceSize:MTLSizeMake((NSUInteger)w, (NSUInteger)h, 1) toBuffer:readback->buffer destinationOffset:0 destinationBytesPerRow:(NSUInteger)(w * 4) destinationBytesPerImage:(NSUInteger)(w * h * 4)];
+	[blit endEncoding];
+	[readback->cmd_buffer commit];
+	return readback;
+}
+
+int cf_metal_readback_resolve(void* handle, int w, int h, void* out)
+{
+	CF_MetalReadback* readback = (CF_MetalReadback*)handle;
+	MTLCommandBufferStatus status = readback->cmd_buffer.status;
+	if (status == MTLCommandBufferStatusError) return -1;
+	if (status != MTLCommandBufferStatusCompleted) return 0;
+	CF_MEMCPY(out, readback->buffer.contents, (size_t)(w * h * 4));
+	return 1;
+}
+
+void cf_metal_readback_release(void* handle)
+{
+	delete (CF_MetalReadback*)handle;
+}
+
+#endif // SOKOL_METAL
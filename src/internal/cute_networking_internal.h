@@ -0,0 +1,16 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_NETWORKING_INTERNAL_H
+#define CF_NETWORKING_INTERNAL_H
+
+#include <cute_defines.h>
+
+// Bytes sent and received over every client and server's socket since startup, including packet headers.
+void cf_net_get_byte_totals(uint64_t* sent, uint64_t* received);
+
+#endif // CF_NETWORKING_INTERNAL_H
@@ -0,0 +1,50 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_PARTICLES_INTERNAL_H
+#define CF_PARTICLES_INTERNAL_H
+
+#include <cute_particles.h>
+#include <cute_graphics.h>
+#include <cute_rnd.h>
+
+struct CF_ParticleEmitterInternal
+{
+	CF_ParticleParams params;
+	CF_RndState rnd;
+	CF_V2 position = { };
+	bool emitting = true;
+	float spawn_accumulator = 0;
+
+	// Image drawn per particle, or zero for filled circles.
+	uint64_t image_id = 0;
+	int image_w = 0;
+	int image_h = 0;
+
+	// Live particles are packed at the front, as a structure of arrays so the simulation can step four at a
+	// time. `capacity` is rounded up to a multiple of four, the lanes past `count` are stepped and ignored.
+	int count = 0;
+	int capacity = 0;
+	float* px = NULL;
+	float* py = NULL;
+	float* vx = NULL;
+	float* vy = NULL;
+	float* age = NULL;
+	float* lifetime = NULL;
+
+	// Instanced mesh the particles are drawn from, made by the first draw. Instances are uploaded at most once a
+	// frame, `upload_frame` being the `CF_Draw::frame` of the last upload.
+	CF_Mesh mesh = { };
+	uint64_t upload_frame = ~0ULL;
+};
+
+CF_INLINE CF_ParticleEmitterInternal* cf_particle_emitter_internal(CF_ParticleEmitter emitter) { return (CF_ParticleEmitterInternal*)emitter.id; }
+
+// Destroys an emitter's mesh, waiting for a pipelined frame still drawing from it, see `cf_app_set_pipelined_rendering`.
+void cf_draw_destroy_particle_mesh(CF_Mesh mesh);
+
+#endif // CF_PARTICLES_INTERNAL_H
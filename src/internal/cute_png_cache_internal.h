@@ -13,5 +13,7 @@
 void cf_make_png_cache();
 void cf_destroy_png_cache();
 void cf_png_cache_get_pixels(uint64_t image_id, void* buffer, int bytes_to_fill);
+bool cf_png_cache_drop_pixels(uint64_t image_id);
+void cf_png_cache_file_changed(const char* virtual_path);
 
 #endif // CF_PNG_CACHE_INTERNAL_H
@@ -0,0 +1,17 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_PROFILE_INTERNAL_H
+#define CF_PROFILE_INTERNAL_H
+
+// Moves zones recorded by every thread into the main list, so the per-thread queues don't fill up.
+void cf_profile_collect();
+
+// Frees all per-thread buffers. Other threads must not be recording.
+void cf_profile_shutdown();
+
+#endif // CF_PROFILE_INTERNAL_H
@@ -0,0 +1,44 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_REPLAY_INTERNAL_H
+#define CF_REPLAY_INTERNAL_H
+
+#include <cute_replay.h>
+#include <cute_array.h>
+
+// A run of encoded steps. The first step is encoded against all zeroes so the segment can be decoded
+// on its own, which lets the oldest segment be dropped once the replay is over budget.
+struct CF_ReplaySegment
+{
+	Cute::Array<uint8_t> bytes;
+	int step_count = 0;
+};
+
+struct CF_ReplayInternal
+{
+	int max_bytes = 0;
+	int byte_count = 0; // Across all segments.
+	int step_count = 0; // Across all segments.
+	Cute::Array<CF_ReplaySegment*> segments; // Oldest first.
+	CF_ReplaySegment* spare = NULL; // The last dropped segment, reused to avoid reallocating.
+
+	// The snapshot of the step being recorded or played, and of the step before it.
+	Cute::Array<uint8_t> snapshot;
+	Cute::Array<uint8_t> prev;
+
+	// Playback position.
+	int play_segment = 0;
+	int play_offset = 0;
+};
+
+CF_INLINE CF_ReplayInternal* cf_replay_internal(CF_Replay replay) { return (CF_ReplayInternal*)replay.id; }
+
+// Records the current input and time as the next step, called once per update.
+void cf_replay_capture(CF_ReplayInternal* replay);
+
+#endif // CF_REPLAY_INTERNAL_H
@@ -0,0 +1,31 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_STRING_INTERNAL_H
+#define CF_STRING_INTERNAL_H
+
+#include <cute_string.h>
+
+#define CF_SCAN_MAX_STOPS 4
+
+// Returns the first byte in [s, end) that's a nul-terminator, not ASCII (so starts a multi-byte UTF8 character),
+// or one of `stops` (up to `CF_SCAN_MAX_STOPS` of them). Returns `end` if there's no such byte. Checks 16 bytes
+// at a time with SSE2/NEON, so copying or skipping runs of plain ASCII text doesn't need a decode per byte.
+const char* cf_scan_ascii(const char* s, const char* end, const char* stops, int stop_count);
+
+// Same as `cf_decode_UTF8`, with the ASCII case inlined for per-character loops such as text layout.
+CF_INLINE const char* cf_decode_UTF8_fast(const char* s, int* codepoint)
+{
+	unsigned char c = (unsigned char)*s;
+	if (c < 0x80) {
+		*codepoint = c;
+		return s + 1;
+	}
+	return cf_decode_UTF8(s, codepoint);
+}
+
+#endif // CF_STRING_INTERNAL_H
@@ -0,0 +1,43 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_TILEMAP_INTERNAL_H
+#define CF_TILEMAP_INTERNAL_H
+
+#include <cute_tilemap.h>
+#include <cute_array.h>
+#include <cute_draw.h>
+
+struct CF_TilemapChunk
+{
+	CF_StaticGeometry geometry = { };
+	bool dirty = true;
+	int tile_count = 0; // Non-empty tiles, empty chunks are never baked.
+};
+
+struct CF_TilemapLayer
+{
+	Cute::Array<int> tiles; // Row-major, `width * height`.
+	Cute::Array<CF_TilemapChunk> chunks; // Row-major, `chunks_x * chunks_y`.
+};
+
+struct CF_TilemapInternal
+{
+	int width = 0;
+	int height = 0;
+	CF_V2 tile_size = { };
+	int chunk_size = 0;
+	int chunks_x = 0;
+	int chunks_y = 0;
+	Cute::Array<CF_Sprite> tiles; // Tile `i` is `tiles[i - 1]`.
+	Cute::Array<CF_TilemapLayer> layers;
+	int rebake_count = 0; // Chunks rebaked so far, handy for testing.
+};
+
+CF_INLINE CF_TilemapInternal* cf_tilemap_internal(CF_Tilemap tilemap) { return (CF_TilemapInternal*)tilemap.id; }
+
+#endif // CF_TILEMAP_INTERNAL_H
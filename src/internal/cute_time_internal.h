@@ -0,0 +1,22 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#ifndef CF_TIME_INTERNAL_H
+#define CF_TIME_INTERNAL_H
+
+#include <cute_defines.h>
+
+// Called by `cf_app_draw_onto_screen` just before and after flipping to the screen. Feeds the work
+// times of `cf_get_frame_time_stats`, and lets low latency mode line frames up with the display.
+void cf_time_present_begin();
+void cf_time_present_end();
+
+// The moment in `cf_get_ticks` units the update in progress simulates up to. Input from after this
+// point is held back for later updates.
+uint64_t cf_time_update_end_ticks();
+
+#endif // CF_TIME_INTERNAL_H
@@ -1,7 +1,21 @@
 @echo off
+setlocal
+rem Set SOKOL_SHDC to use a sokol-shdc other than the prebuilt one for Windows.
+if "%SOKOL_SHDC%"=="" set SOKOL_SHDC=../../tools/sokol-shdc/win32/sokol-shdc.exe
 for %%f in ("*.glsl") do call :compile %%~nf
+call :variant sprites CF_DRAW_SPRITES_ONLY
+call :variant shapes CF_DRAW_SHAPES_ONLY
+call :variant array CF_DRAW_ATLAS_ARRAY
+call :variant instanced CF_DRAW_INSTANCED
+call :variant particles CF_DRAW_PARTICLES
+call :variant particles_array CF_DRAW_PARTICLES:CF_DRAW_ATLAS_ARRAY
+exit /B
+
+:variant
+@echo Compiling sprite.glsl (%~1 variant) into sprite_%~1_shader.h ...
+call "%SOKOL_SHDC%" --input sprite.glsl --output sprite_%~1_shader.h --slang glsl330:hlsl5:metal_macos:metal_ios:metal_sim:glsl300es --reflection --module sprite_%~1 --defines %~2
 exit /B
 
 :compile
 @echo Compiling %~1.glsl into %~1_shader.h ...
-call "../../tools/sokol-shdc/win32/sokol-shdc.exe" --input %~1.glsl --output %~1_shader.h --slang glsl330:hlsl5:metal_macos:metal_ios:metal_sim:glsl300es --reflection
+call "%SOKOL_SHDC%" --input %~1.glsl --output %~1_shader.h --slang glsl330:hlsl5:metal_macos:metal_ios:metal_sim:glsl300es --reflection
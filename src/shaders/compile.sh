@@ -1,7 +1,19 @@
 #!/bin/bash
 
 shopt -s nullglob
+# Set SOKOL_SHDC to use a sokol-shdc other than the prebuilt one for macOS.
+shdc="${SOKOL_SHDC:-../../tools/sokol-shdc/osx/sokol-shdc}"
+slang="glsl330:hlsl5:metal_macos:metal_ios:metal_sim:glsl300es"
 for f in *.glsl; do
 	echo "Compiling $f to ${f%%.*}_shader.h"
-	../../tools/sokol-shdc/osx/sokol-shdc --input "$f" --output "${f%%.*}_shader.h" --slang glsl330:hlsl5:metal_macos:metal_ios:metal_sim:glsl300es --reflection
+	$shdc --input "$f" --output "${f%%.*}_shader.h" --slang $slang --reflection
+done
+
+# Specialized variants of the sprite shader, picked per batch by the draw API. Each variant gets its
+# own module name so all of them can be included side by side.
+for variant in sprites:CF_DRAW_SPRITES_ONLY shapes:CF_DRAW_SHAPES_ONLY array:CF_DRAW_ATLAS_ARRAY instanced:CF_DRAW_INSTANCED particles:CF_DRAW_PARTICLES \
+	particles_array:CF_DRAW_PARTICLES:CF_DRAW_ATLAS_ARRAY; do
+	name="${variant%%:*}"
+	echo "Compiling sprite.glsl ($name variant) to sprite_${name}_shader.h"
+	$shdc --input sprite.glsl --output "sprite_${name}_shader.h" --slang $slang --reflection --module "sprite_${name}" --defines "${variant#*:}"
 done
@@ -0,0 +1,27 @@
+@module debug
+@ctype vec4 CF_Color
+
+@vs vs
+@glsl_options flip_vert_y
+	layout (location = 0) in vec2 in_posH;
+	layout (location = 1) in vec4 in_col;
+
+	layout (location = 0) out vec4 col;
+
+	void main() {
+		col = in_col;
+		gl_Position = vec4(in_posH, 0, 1);
+	}
+@end
+
+@fs fs
+	layout (location = 0) in vec4 col;
+
+	out vec4 result;
+
+	void main() {
+		result = col;
+	}
+@end
+
+@program shader vs fs
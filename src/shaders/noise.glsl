@@ -0,0 +1,103 @@
+@module noise
+@ctype vec2 CF_V2
+
+@vs vs
+	layout (location = 0) in vec2 in_pos;
+	layout (location = 1) in vec2 in_uv;
+
+	layout (location = 0) out vec2 uv;
+
+	void main() {
+		vec4 posH = vec4(in_pos, 0, 1);
+		uv = in_uv;
+		gl_Position = posH;
+	}
+@end
+
+@fs fs
+	layout (location = 0) in vec2 uv;
+
+	out vec4 result;
+
+	// The seeded permutation table of a `CF_Noise`, one entry per texel in the red channel.
+	layout (binding = 0) uniform sampler2D u_perm;
+
+	layout (binding = 0) uniform fs_params {
+		vec2 u_texture_size;
+		vec2 u_origin;
+		float u_step;
+		float u_scale;
+		float u_lacunarity;
+		float u_falloff;
+		float u_octaves;
+	};
+
+	#define STRETCH_CONSTANT_2D (-0.211324865405187)
+	#define SQUISH_CONSTANT_2D  (0.366025403784439)
+	#define NORM_CONSTANT_2D    (47.0)
+
+	int perm(int i)
+	{
+		return int(texture(u_perm, vec2((float(i & 255) + 0.5) / 256.0, 0.5)).x * 255.0 + 0.5);
+	}
+
+	vec2 gradient(int xsb, int ysb)
+	{
+		int index = (perm(perm(xsb) + ysb) >> 1) & 7;
+		vec2 g = vec2(2.0, 5.0);
+		if (index == 0) g = vec2( 5.0,  2.0);
+		if (index == 1) g = vec2( 2.0,  5.0);
+		if (index == 2) g = vec2(-5.0,  2.0);
+		if (index == 3) g = vec2(-2.0,  5.0);
+		if (index == 4) g = vec2( 5.0, -2.0);
+		if (index == 5) g = vec2( 2.0, -5.0);
+		if (index == 6) g = vec2(-5.0, -2.0);
+		if (index == 7) g = vec2(-2.0, -5.0);
+		return g;
+	}
+
+	// Branch-free `open_simplex_noise2`, summing over every lattice point the CPU version can pick.
+	// Points out of reach have a zero attenuation.
+	float noise2(vec2 p)
+	{
+		vec2 sb = floor(p + (p.x + p.y) * STRETCH_CONSTANT_2D);
+		vec2 d0 = p - (sb + (sb.x + sb.y) * SQUISH_CONSTANT_2D);
+		ivec2 isb = ivec2(sb);
+		float value = 0.0;
+		for (int k = 0; k < 8; ++k) {
+			ivec2 o = ivec2(0, 0);
+			if (k == 1) o = ivec2( 1,  0);
+			if (k == 2) o = ivec2( 0,  1);
+			if (k == 3) o = ivec2( 1,  1);
+			if (k == 4) o = ivec2( 1, -1);
+			if (k == 5) o = ivec2(-1,  1);
+			if (k == 6) o = ivec2( 2,  0);
+			if (k == 7) o = ivec2( 0,  2);
+			vec2 d = d0 - (vec2(o) + float(o.x + o.y) * SQUISH_CONSTANT_2D);
+			float attn = max(2.0 - dot(d, d), 0.0);
+			attn *= attn;
+			value += attn * attn * dot(gradient(isb.x + o.x, isb.y + o.y), d);
+		}
+		return value / NORM_CONSTANT_2D;
+	}
+
+	void main() {
+		// Row zero is the top of the canvas, like the rows of `cf_noise_fill`.
+		vec2 pixel = floor(vec2(uv.x, 1.0 - uv.y) * u_texture_size);
+		vec2 p = u_origin + pixel * u_step;
+		float scale = u_scale;
+		float amplitude = 1.0;
+		float div = 0.0;
+		float sum = 0.0;
+		for (int i = 0; i < int(u_octaves); ++i) {
+			sum += noise2(p * scale) * amplitude;
+			scale *= u_lacunarity;
+			div += amplitude;
+			amplitude *= u_falloff;
+		}
+		float v = (sum / div + 1.0) * 0.5;
+		result = vec4(v, v, v, 1.0);
+	}
+@end
+
+@program shd vs fs
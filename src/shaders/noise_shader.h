@@ -0,0 +1,2632 @@
+#pragma once
+/*
+    NOT machine generated. Written by hand from noise.glsl in the same layout sokol-shdc produces, as sokol-shdc
+    could not be run when this shader was added. On Mesa the glsl330 and glsl300es sources compile and link, and
+    plain and fractal noise rendered through them lands within 1/255 of `cf_noise2` run on the CPU with the same
+    seed. The hlsl5 and metal sources have not been through a shader compiler. Running compile.sh or compile.cmd
+    regenerates this file from noise.glsl with real sokol-shdc output, which should replace it.
+
+    Overview:
+
+        Shader program 'shd':
+            Get shader desc: noise_shd_shader_desc(sg_query_backend());
+            Vertex shader: vs
+                Attribute slots:
+                    ATTR_noise_vs_in_pos = 0
+                    ATTR_noise_vs_in_uv = 1
+            Fragment shader: fs
+                Uniform block 'fs_params':
+                    C struct: noise_fs_params_t
+                    Bind slot: SLOT_noise_fs_params = 0
+                Image 'u_perm':
+                    Type: SG_IMAGETYPE_2D
+                    Component Type: SG_SAMPLERTYPE_FLOAT
+                    Bind slot: SLOT_noise_u_perm = 0
+
+
+    Shader descriptor structs:
+
+        sg_shader shd = sg_make_shader(noise_shd_shader_desc(sg_query_backend()));
+
+    Vertex attribute locations for vertex shader 'vs':
+
+        sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+            .layout = {
+                .attrs = {
+                    [ATTR_noise_vs_in_pos] = { ... },
+                    [ATTR_noise_vs_in_uv] = { ... },
+                },
+            },
+            ...});
+
+    Image bind slots, use as index in sg_bindings.vs_images[] or .fs_images[]
+
+        SLOT_noise_u_perm = 0;
+
+    Bind slot and C-struct for uniform block 'fs_params':
+
+        noise_fs_params_t fs_params = {
+            .u_texture_size = ...;
+            .u_origin = ...;
+            .u_step = ...;
+            .u_scale = ...;
+            .u_lacunarity = ...;
+            .u_falloff = ...;
+            .u_octaves = ...;
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_[VS|FS], SLOT_noise_fs_params, &SG_RANGE(fs_params));
+
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+#if !defined(SOKOL_SHDC_ALIGN)
+  #if defined(_MSC_VER)
+    #define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+  #else
+    #define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+  #endif
+#endif
+#define ATTR_noise_vs_in_pos (0)
+#define ATTR_noise_vs_in_uv (1)
+#define SLOT_noise_u_perm (0)
+#define SLOT_noise_fs_params (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct noise_fs_params_t {
+    CF_V2 u_texture_size;
+    CF_V2 u_origin;
+    float u_step;
+    float u_scale;
+    float u_lacunarity;
+    float u_falloff;
+    float u_octaves;
+    uint8_t _pad_36[12];
+} noise_fs_params_t;
+#pragma pack(pop)
+/*
+    #version 330
+    
+    layout(location = 0) in vec2 in_pos;
+    out vec2 uv;
+    layout(location = 1) in vec2 in_uv;
+    
+    void main()
+    {
+        uv = in_uv;
+        gl_Position = vec4(in_pos, 0.0, 1.0);
+    }
+    
+*/
+static const char noise_vs_source_glsl330[177] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x69,0x6e,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x69,0x6e,0x5f,
+    0x75,0x76,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #version 330
+    
+    uniform vec4 fs_params[3];
+    uniform sampler2D u_perm;
+    
+    in vec2 uv;
+    layout(location = 0) out vec4 result;
+    
+    int perm(int i)
+    {
+        return int(texture(u_perm, vec2((float(i & 255) + 0.5) * 0.00390625, 0.5)).x * 255.0 + 0.5);
+    }
+    
+    vec2 gradient(int xsb, int ysb)
+    {
+        int index = (perm(perm(xsb) + ysb) >> 1) & 7;
+        vec2 g = vec2(2.0, 5.0);
+        if (index == 0)
+        {
+            g = vec2(5.0, 2.0);
+        }
+        if (index == 1)
+        {
+            g = vec2(2.0, 5.0);
+        }
+        if (index == 2)
+        {
+            g = vec2(-5.0, 2.0);
+        }
+        if (index == 3)
+        {
+            g = vec2(-2.0, 5.0);
+        }
+        if (index == 4)
+        {
+            g = vec2(5.0, -2.0);
+        }
+        if (index == 5)
+        {
+            g = vec2(2.0, -5.0);
+        }
+        if (index == 6)
+        {
+            g = vec2(-5.0, -2.0);
+        }
+        if (index == 7)
+        {
+            g = vec2(-2.0, -5.0);
+        }
+        return g;
+    }
+    
+    float noise2(vec2 p)
+    {
+        vec2 sb = floor(p + vec2((p.x + p.y) * (-0.211324865405187)));
+        vec2 d0 = p - (sb + vec2((sb.x + sb.y) * 0.366025403784439));
+        ivec2 isb = ivec2(sb);
+        float value = 0.0;
+        for (int k = 0; k < 8; k++)
+        {
+            ivec2 o = ivec2(0);
+            if (k == 1)
+            {
+                o = ivec2(1, 0);
+            }
+            if (k == 2)
+            {
+                o = ivec2(0, 1);
+            }
+            if (k == 3)
+            {
+                o = ivec2(1);
+            }
+            if (k == 4)
+            {
+                o = ivec2(1, -1);
+            }
+            if (k == 5)
+            {
+                o = ivec2(-1, 1);
+            }
+            if (k == 6)
+            {
+                o = ivec2(2, 0);
+            }
+            if (k == 7)
+            {
+                o = ivec2(0, 2);
+            }
+            vec2 d = d0 - (vec2(o) + vec2(float(o.x + o.y) * 0.366025403784439));
+            float attn = max(2.0 - dot(d, d), 0.0);
+            attn *= attn;
+            value += attn * attn * dot(gradient(isb.x + o.x, isb.y + o.y), d);
+        }
+        return value / 47.0;
+    }
+    
+    void main()
+    {
+        vec2 p = fs_params[0].zw + floor(vec2(uv.x, 1.0 - uv.y) * fs_params[0].xy) * fs_params[1].x;
+        float scale = fs_params[1].y;
+        float amplitude = 1.0;
+        float div = 0.0;
+        float sum = 0.0;
+        for (int i = 0; i < int(fs_params[2].x); i++)
+        {
+            sum += noise2(p * scale) * amplitude;
+            scale *= fs_params[1].z;
+            div += amplitude;
+            amplitude *= fs_params[1].w;
+        }
+        float v = (sum / div + 1.0) * 0.5;
+        result = vec4(v, v, v, 1.0);
+    }
+    
+*/
+static const char noise_fs_source_glsl330[2360] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x70,0x65,0x72,
+    0x6d,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x65,
+    0x73,0x75,0x6c,0x74,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,0x65,0x72,0x6d,0x28,
+    0x69,0x6e,0x74,0x20,0x69,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x69,0x20,0x26,0x20,0x32,0x35,0x35,0x29,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x30,0x36,0x32,0x35,
+    0x2c,0x20,0x30,0x2e,0x35,0x29,0x29,0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,
+    0x30,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,
+    0x32,0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x69,0x6e,0x74,0x20,0x78,
+    0x73,0x62,0x2c,0x20,0x69,0x6e,0x74,0x20,0x79,0x73,0x62,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x28,
+    0x70,0x65,0x72,0x6d,0x28,0x70,0x65,0x72,0x6d,0x28,0x78,0x73,0x62,0x29,0x20,0x2b,
+    0x20,0x79,0x73,0x62,0x29,0x20,0x3e,0x3e,0x20,0x31,0x29,0x20,0x26,0x20,0x37,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x30,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,0x30,0x2c,0x20,0x32,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,
+    0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x32,
+    0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,
+    0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,0x30,0x2c,0x20,
+    0x2d,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x2d,0x35,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x2d,0x32,0x2e,0x30,0x2c,0x20,0x2d,0x35,0x2e,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x67,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x69,
+    0x73,0x65,0x32,0x28,0x76,0x65,0x63,0x32,0x20,0x70,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x62,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,
+    0x72,0x28,0x70,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x70,0x2e,0x78,0x20,
+    0x2b,0x20,0x70,0x2e,0x79,0x29,0x20,0x2a,0x20,0x28,0x2d,0x30,0x2e,0x32,0x31,0x31,
+    0x33,0x32,0x34,0x38,0x36,0x35,0x34,0x30,0x35,0x31,0x38,0x37,0x29,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x64,0x30,0x20,0x3d,0x20,0x70,
+    0x20,0x2d,0x20,0x28,0x73,0x62,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x73,
+    0x62,0x2e,0x78,0x20,0x2b,0x20,0x73,0x62,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,
+    0x33,0x36,0x36,0x30,0x32,0x35,0x34,0x30,0x33,0x37,0x38,0x34,0x34,0x33,0x39,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x69,0x73,0x62,
+    0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x73,0x62,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,
+    0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x38,0x3b,0x20,
+    0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x28,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,
+    0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,
+    0x76,0x65,0x63,0x32,0x28,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,
+    0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,
+    0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x2d,0x31,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x35,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x2d,0x31,0x2c,
+    0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,
+    0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x28,0x32,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x6b,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,
+    0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x2c,0x20,0x32,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x64,0x20,0x3d,0x20,0x64,0x30,0x20,0x2d,0x20,0x28,
+    0x76,0x65,0x63,0x32,0x28,0x6f,0x29,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x78,0x20,0x2b,0x20,0x6f,0x2e,0x79,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,0x30,0x32,0x35,0x34,0x30,0x33,0x37,0x38,0x34,
+    0x34,0x33,0x39,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,
+    0x32,0x2e,0x30,0x20,0x2d,0x20,0x64,0x6f,0x74,0x28,0x64,0x2c,0x20,0x64,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,
+    0x74,0x74,0x6e,0x20,0x2a,0x3d,0x20,0x61,0x74,0x74,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x3d,0x20,0x61,0x74,
+    0x74,0x6e,0x20,0x2a,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,
+    0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x69,0x73,0x62,0x2e,0x78,0x20,0x2b,
+    0x20,0x6f,0x2e,0x78,0x2c,0x20,0x69,0x73,0x62,0x2e,0x79,0x20,0x2b,0x20,0x6f,0x2e,
+    0x79,0x29,0x2c,0x20,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2f,
+    0x20,0x34,0x37,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,
+    0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x70,0x20,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x7a,0x77,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x76,0x65,0x63,
+    0x32,0x28,0x75,0x76,0x2e,0x78,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x75,0x76,
+    0x2e,0x79,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x69,0x76,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,
+    0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x69,0x6e,0x74,0x28,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x29,0x3b,0x20,0x69,0x2b,0x2b,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x70,0x20,
+    0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,0x29,0x20,0x2a,0x20,0x61,0x6d,0x70,0x6c,0x69,
+    0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x20,0x2a,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x69,0x76,0x20,0x2b,0x3d,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,
+    0x64,0x65,0x20,0x2a,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x28,0x73,0x75,0x6d,0x20,0x2f,
+    0x20,0x64,0x69,0x76,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,
+    0x76,0x65,0x63,0x34,0x28,0x76,0x2c,0x20,0x76,0x2c,0x20,0x76,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    
+    layout(location = 0) in vec2 in_pos;
+    out vec2 uv;
+    layout(location = 1) in vec2 in_uv;
+    
+    void main()
+    {
+        uv = in_uv;
+        gl_Position = vec4(in_pos, 0.0, 1.0);
+    }
+    
+*/
+static const char noise_vs_source_glsl300es[180] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x69,0x6e,
+    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,0x3d,0x20,0x69,
+    0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+    
+    uniform highp vec4 fs_params[3];
+    uniform highp sampler2D u_perm;
+    
+    in highp vec2 uv;
+    layout(location = 0) out highp vec4 result;
+    
+    int perm(int i)
+    {
+        return int(texture(u_perm, vec2((float(i & 255) + 0.5) * 0.00390625, 0.5)).x * 255.0 + 0.5);
+    }
+    
+    highp vec2 gradient(int xsb, int ysb)
+    {
+        int index = (perm(perm(xsb) + ysb) >> 1) & 7;
+        highp vec2 g = vec2(2.0, 5.0);
+        if (index == 0)
+        {
+            g = vec2(5.0, 2.0);
+        }
+        if (index == 1)
+        {
+            g = vec2(2.0, 5.0);
+        }
+        if (index == 2)
+        {
+            g = vec2(-5.0, 2.0);
+        }
+        if (index == 3)
+        {
+            g = vec2(-2.0, 5.0);
+        }
+        if (index == 4)
+        {
+            g = vec2(5.0, -2.0);
+        }
+        if (index == 5)
+        {
+            g = vec2(2.0, -5.0);
+        }
+        if (index == 6)
+        {
+            g = vec2(-5.0, -2.0);
+        }
+        if (index == 7)
+        {
+            g = vec2(-2.0, -5.0);
+        }
+        return g;
+    }
+    
+    highp float noise2(highp vec2 p)
+    {
+        highp vec2 sb = floor(p + vec2((p.x + p.y) * (-0.211324865405187)));
+        highp vec2 d0 = p - (sb + vec2((sb.x + sb.y) * 0.366025403784439));
+        ivec2 isb = ivec2(sb);
+        highp float value = 0.0;
+        for (int k = 0; k < 8; k++)
+        {
+            ivec2 o = ivec2(0);
+            if (k == 1)
+            {
+                o = ivec2(1, 0);
+            }
+            if (k == 2)
+            {
+                o = ivec2(0, 1);
+            }
+            if (k == 3)
+            {
+                o = ivec2(1);
+            }
+            if (k == 4)
+            {
+                o = ivec2(1, -1);
+            }
+            if (k == 5)
+            {
+                o = ivec2(-1, 1);
+            }
+            if (k == 6)
+            {
+                o = ivec2(2, 0);
+            }
+            if (k == 7)
+            {
+                o = ivec2(0, 2);
+            }
+            highp vec2 d = d0 - (vec2(o) + vec2(float(o.x + o.y) * 0.366025403784439));
+            highp float attn = max(2.0 - dot(d, d), 0.0);
+            attn *= attn;
+            value += attn * attn * dot(gradient(isb.x + o.x, isb.y + o.y), d);
+        }
+        return value / 47.0;
+    }
+    
+    void main()
+    {
+        highp vec2 p = fs_params[0].zw + floor(vec2(uv.x, 1.0 - uv.y) * fs_params[0].xy) * fs_params[1].x;
+        highp float scale = fs_params[1].y;
+        highp float amplitude = 1.0;
+        highp float div = 0.0;
+        highp float sum = 0.0;
+        for (int i = 0; i < int(fs_params[2].x); i++)
+        {
+            sum += noise2(p * scale) * amplitude;
+            scale *= fs_params[1].z;
+            div += amplitude;
+            amplitude *= fs_params[1].w;
+        }
+        highp float v = (sum / div + 1.0) * 0.5;
+        result = vec4(v, v, v, 1.0);
+    }
+    
+*/
+static const char noise_fs_source_glsl300es[2523] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x3b,0x0a,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x0a,
+    0x69,0x6e,0x74,0x20,0x70,0x65,0x72,0x6d,0x28,0x69,0x6e,0x74,0x20,0x69,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,
+    0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x20,0x26,
+    0x20,0x32,0x35,0x35,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x30,0x30,0x33,0x39,0x30,0x36,0x32,0x35,0x2c,0x20,0x30,0x2e,0x35,0x29,0x29,
+    0x2e,0x78,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x69,0x6e,0x74,0x20,0x78,0x73,
+    0x62,0x2c,0x20,0x69,0x6e,0x74,0x20,0x79,0x73,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x28,0x70,
+    0x65,0x72,0x6d,0x28,0x70,0x65,0x72,0x6d,0x28,0x78,0x73,0x62,0x29,0x20,0x2b,0x20,
+    0x79,0x73,0x62,0x29,0x20,0x3e,0x3e,0x20,0x31,0x29,0x20,0x26,0x20,0x37,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x67,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,
+    0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x35,0x2e,
+    0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,
+    0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x2d,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,
+    0x65,0x78,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x35,0x2e,0x30,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x32,0x2e,0x30,
+    0x2c,0x20,0x2d,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,
+    0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x67,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,
+    0x2d,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x37,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x32,0x2e,0x30,0x2c,0x20,0x2d,0x35,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x62,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2b,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x28,0x70,0x2e,0x78,0x20,0x2b,0x20,0x70,0x2e,0x79,0x29,0x20,0x2a,0x20,
+    0x28,0x2d,0x30,0x2e,0x32,0x31,0x31,0x33,0x32,0x34,0x38,0x36,0x35,0x34,0x30,0x35,
+    0x31,0x38,0x37,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x64,0x30,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x28,0x73,0x62,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x28,0x73,0x62,0x2e,0x78,
+    0x20,0x2b,0x20,0x73,0x62,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,
+    0x30,0x32,0x35,0x34,0x30,0x33,0x37,0x38,0x34,0x34,0x33,0x39,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x69,0x73,0x62,0x20,0x3d,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x73,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,
+    0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,
+    0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,
+    0x38,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x76,0x65,0x63,0x32,0x20,0x6f,0x20,0x3d,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,
+    0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,
+    0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,
+    0x63,0x32,0x28,0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x6b,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,
+    0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x31,0x2c,0x20,0x2d,0x31,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x35,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,
+    0x2d,0x31,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,
+    0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,
+    0x69,0x76,0x65,0x63,0x32,0x28,0x32,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6f,0x20,0x3d,0x20,0x69,0x76,0x65,0x63,0x32,0x28,0x30,0x2c,0x20,0x32,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x64,
+    0x20,0x3d,0x20,0x64,0x30,0x20,0x2d,0x20,0x28,0x76,0x65,0x63,0x32,0x28,0x6f,0x29,
+    0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,
+    0x78,0x20,0x2b,0x20,0x6f,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,
+    0x30,0x32,0x35,0x34,0x30,0x33,0x37,0x38,0x34,0x34,0x33,0x39,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x6e,0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x32,
+    0x2e,0x30,0x20,0x2d,0x20,0x64,0x6f,0x74,0x28,0x64,0x2c,0x20,0x64,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,
+    0x74,0x6e,0x20,0x2a,0x3d,0x20,0x61,0x74,0x74,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x3d,0x20,0x61,0x74,0x74,
+    0x6e,0x20,0x2a,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x67,
+    0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x69,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,
+    0x6f,0x2e,0x78,0x2c,0x20,0x69,0x73,0x62,0x2e,0x79,0x20,0x2b,0x20,0x6f,0x2e,0x79,
+    0x29,0x2c,0x20,0x64,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2f,0x20,
+    0x34,0x37,0x2e,0x30,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x77,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x6f,
+    0x72,0x28,0x76,0x65,0x63,0x32,0x28,0x75,0x76,0x2e,0x78,0x2c,0x20,0x31,0x2e,0x30,
+    0x20,0x2d,0x20,0x75,0x76,0x2e,0x79,0x29,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x29,0x20,0x2a,0x20,0x66,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,
+    0x61,0x6c,0x65,0x20,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x20,
+    0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x76,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,
+    0x20,0x69,0x20,0x3c,0x20,0x69,0x6e,0x74,0x28,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x78,0x29,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,
+    0x20,0x2b,0x3d,0x20,0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x70,0x20,0x2a,0x20,0x73,
+    0x63,0x61,0x6c,0x65,0x29,0x20,0x2a,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x63,0x61,0x6c,0x65,
+    0x20,0x2a,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,
+    0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x76,0x20,
+    0x2b,0x3d,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x20,
+    0x2a,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,
+    0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x28,0x73,0x75,
+    0x6d,0x20,0x2f,0x20,0x64,0x69,0x76,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x20,0x2a,
+    0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x2c,0x20,0x76,0x2c,0x20,0x76,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    static float4 gl_Position;
+    static float2 in_pos;
+    static float2 uv;
+    static float2 in_uv;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 in_pos : TEXCOORD0;
+        float2 in_uv : TEXCOORD1;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float2 uv : TEXCOORD0;
+        float4 gl_Position : SV_Position;
+    };
+    
+    void vert_main()
+    {
+        uv = in_uv;
+        gl_Position = float4(in_pos, 0.0f, 1.0f);
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        in_pos = stage_input.in_pos;
+        in_uv = stage_input.in_uv;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.uv = uv;
+        return stage_output;
+    }
+*/
+static const char noise_vs_source_hlsl5[635] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,
+    0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,
+    0x6e,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,
+    0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,
+    0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x75,0x76,0x20,
+    0x3d,0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,
+    0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x75,0x76,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x75,
+    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x75,0x76,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    cbuffer fs_params : register(b0)
+    {
+        float2 _134_u_texture_size : packoffset(c0);
+        float2 _134_u_origin : packoffset(c0.z);
+        float _134_u_step : packoffset(c1);
+        float _134_u_scale : packoffset(c1.y);
+        float _134_u_lacunarity : packoffset(c1.z);
+        float _134_u_falloff : packoffset(c1.w);
+        float _134_u_octaves : packoffset(c2);
+    };
+    
+    Texture2D<float4> u_perm : register(t0);
+    SamplerState _u_perm_sampler : register(s0);
+    
+    static float2 uv;
+    static float4 result;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 uv : TEXCOORD0;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float4 result : SV_Target0;
+    };
+    
+    int perm(int i)
+    {
+        return int(mad(u_perm.Sample(_u_perm_sampler, float2((float(i & 255) + 0.5f) * 0.00390625f, 0.5f)).x, 255.0f, 0.5f));
+    }
+    
+    float2 gradient(int xsb, int ysb)
+    {
+        int index = (perm(perm(xsb) + ysb) >> 1) & 7;
+        float2 g = float2(2.0f, 5.0f);
+        if (index == 0)
+        {
+            g = float2(5.0f, 2.0f);
+        }
+        if (index == 1)
+        {
+            g = float2(2.0f, 5.0f);
+        }
+        if (index == 2)
+        {
+            g = float2(-5.0f, 2.0f);
+        }
+        if (index == 3)
+        {
+            g = float2(-2.0f, 5.0f);
+        }
+        if (index == 4)
+        {
+            g = float2(5.0f, -2.0f);
+        }
+        if (index == 5)
+        {
+            g = float2(2.0f, -5.0f);
+        }
+        if (index == 6)
+        {
+            g = float2(-5.0f, -2.0f);
+        }
+        if (index == 7)
+        {
+            g = float2(-2.0f, -5.0f);
+        }
+        return g;
+    }
+    
+    float noise2(float2 p)
+    {
+        float2 sb = floor(p + ((p.x + p.y) * (-0.211324870586395263671875f)).xx);
+        float2 d0 = p - (sb + ((sb.x + sb.y) * 0.3660254180431365966796875f).xx);
+        int2 isb = int2(sb);
+        float value = 0.0f;
+        for (int k = 0; k < 8; k++)
+        {
+            int2 o = int2(0, 0);
+            if (k == 1)
+            {
+                o = int2(1, 0);
+            }
+            if (k == 2)
+            {
+                o = int2(0, 1);
+            }
+            if (k == 3)
+            {
+                o = int2(1, 1);
+            }
+            if (k == 4)
+            {
+                o = int2(1, -1);
+            }
+            if (k == 5)
+            {
+                o = int2(-1, 1);
+            }
+            if (k == 6)
+            {
+                o = int2(2, 0);
+            }
+            if (k == 7)
+            {
+                o = int2(0, 2);
+            }
+            float2 d = d0 - (float2(o) + (float(o.x + o.y) * 0.3660254180431365966796875f).xx);
+            float attn = max(2.0f - dot(d, d), 0.0f);
+            attn *= attn;
+            value += attn * attn * dot(gradient(isb.x + o.x, isb.y + o.y), d);
+        }
+        return value / 47.0f;
+    }
+    
+    void frag_main()
+    {
+        float2 p = _134_u_origin + floor(float2(uv.x, 1.0f - uv.y) * _134_u_texture_size) * _134_u_step;
+        float scale = _134_u_scale;
+        float amplitude = 1.0f;
+        float div = 0.0f;
+        float sum = 0.0f;
+        for (int i = 0; i < int(_134_u_octaves); i++)
+        {
+            sum += noise2(p * scale) * amplitude;
+            scale *= _134_u_lacunarity;
+            div += amplitude;
+            amplitude *= _134_u_falloff;
+        }
+        float v = (sum / div + 1.0f) * 0.5f;
+        result = float4(v, v, v, 1.0f);
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        uv = stage_input.uv;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.result = result;
+        return stage_output;
+    }
+*/
+static const char noise_fs_source_hlsl5[3161] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x31,
+    0x33,0x34,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x31,0x33,0x34,0x5f,0x75,0x5f,0x6f,0x72,0x69,0x67,0x69,0x6e,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x2e,0x7a,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,0x34,0x5f,
+    0x75,0x5f,0x73,0x74,0x65,0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x31,0x33,0x34,0x5f,0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,
+    0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x33,0x34,0x5f,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,0x69,0x74,0x79,0x20,
+    0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,
+    0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,
+    0x33,0x34,0x5f,0x75,0x5f,0x66,0x61,0x6c,0x6c,0x6f,0x66,0x66,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x33,0x34,0x5f,
+    0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,
+    0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,
+    0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x75,0x5f,0x70,0x65,0x72,0x6d,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,
+    0x28,0x73,0x30,0x29,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,
+    0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,
+    0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x69,0x6e,0x74,0x20,0x70,0x65,
+    0x72,0x6d,0x28,0x69,0x6e,0x74,0x20,0x69,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x69,0x6e,0x74,0x28,0x6d,0x61,0x64,0x28,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x5f,0x75,0x5f,
+    0x70,0x65,0x72,0x6d,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x69,0x20,0x26,0x20,
+    0x32,0x35,0x35,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x20,0x2a,0x20,0x30,
+    0x2e,0x30,0x30,0x33,0x39,0x30,0x36,0x32,0x35,0x66,0x2c,0x20,0x30,0x2e,0x35,0x66,
+    0x29,0x29,0x2e,0x78,0x2c,0x20,0x32,0x35,0x35,0x2e,0x30,0x66,0x2c,0x20,0x30,0x2e,
+    0x35,0x66,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x69,0x6e,0x74,0x20,0x78,0x73,0x62,
+    0x2c,0x20,0x69,0x6e,0x74,0x20,0x79,0x73,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x28,0x70,0x65,
+    0x72,0x6d,0x28,0x70,0x65,0x72,0x6d,0x28,0x78,0x73,0x62,0x29,0x20,0x2b,0x20,0x79,
+    0x73,0x62,0x29,0x20,0x3e,0x3e,0x20,0x31,0x29,0x20,0x26,0x20,0x37,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x66,0x2c,0x20,0x35,0x2e,0x30,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,
+    0x2e,0x30,0x66,0x2c,0x20,0x32,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,
+    0x2e,0x30,0x66,0x2c,0x20,0x35,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,
+    0x35,0x2e,0x30,0x66,0x2c,0x20,0x32,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,
+    0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x2d,0x32,0x2e,0x30,0x66,0x2c,0x20,0x35,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x35,0x2e,0x30,0x66,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,
+    0x65,0x78,0x20,0x3d,0x3d,0x20,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x32,0x2e,0x30,0x66,0x2c,0x20,0x2d,0x35,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,
+    0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x2d,0x35,0x2e,0x30,0x66,0x2c,0x20,0x2d,0x32,0x2e,0x30,0x66,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,0x66,0x2c,0x20,0x2d,0x35,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x67,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,
+    0x62,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2b,0x20,0x28,0x28,
+    0x70,0x2e,0x78,0x20,0x2b,0x20,0x70,0x2e,0x79,0x29,0x20,0x2a,0x20,0x28,0x2d,0x30,
+    0x2e,0x32,0x31,0x31,0x33,0x32,0x34,0x38,0x37,0x30,0x35,0x38,0x36,0x33,0x39,0x35,
+    0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x66,0x29,0x29,0x2e,0x78,0x78,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x30,0x20,
+    0x3d,0x20,0x70,0x20,0x2d,0x20,0x28,0x73,0x62,0x20,0x2b,0x20,0x28,0x28,0x73,0x62,
+    0x2e,0x78,0x20,0x2b,0x20,0x73,0x62,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,
+    0x36,0x36,0x30,0x32,0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,0x36,0x35,0x39,
+    0x36,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,0x78,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x69,0x73,0x62,0x20,0x3d,0x20,0x69,
+    0x6e,0x74,0x32,0x28,0x73,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,
+    0x3d,0x20,0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x38,0x3b,0x20,0x6b,0x2b,0x2b,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x74,0x32,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x6b,0x20,0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,
+    0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x31,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,
+    0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,
+    0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x31,0x2c,0x20,0x2d,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x6b,0x20,0x3d,0x3d,0x20,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,
+    0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x2d,0x31,0x2c,0x20,0x31,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x32,0x2c,0x20,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x37,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,
+    0x28,0x30,0x2c,0x20,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x64,0x20,0x3d,0x20,0x64,0x30,0x20,0x2d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x6f,0x29,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,
+    0x78,0x20,0x2b,0x20,0x6f,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,
+    0x30,0x32,0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,0x36,0x35,0x39,0x36,0x36,
+    0x37,0x39,0x36,0x38,0x37,0x35,0x66,0x29,0x2e,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x6e,
+    0x20,0x3d,0x20,0x6d,0x61,0x78,0x28,0x32,0x2e,0x30,0x66,0x20,0x2d,0x20,0x64,0x6f,
+    0x74,0x28,0x64,0x2c,0x20,0x64,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x3d,0x20,
+    0x61,0x74,0x74,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,
+    0x6c,0x75,0x65,0x20,0x2b,0x3d,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x20,0x61,0x74,
+    0x74,0x6e,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,
+    0x74,0x28,0x69,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,0x6f,0x2e,0x78,0x2c,0x20,0x69,
+    0x73,0x62,0x2e,0x79,0x20,0x2b,0x20,0x6f,0x2e,0x79,0x29,0x2c,0x20,0x64,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2f,0x20,0x34,0x37,0x2e,0x30,0x66,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x5f,0x75,0x5f,0x6f,0x72,0x69,
+    0x67,0x69,0x6e,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x2e,0x78,0x2c,0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,
+    0x75,0x76,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,0x5f,0x75,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x20,0x2a,0x20,0x5f,
+    0x31,0x33,0x34,0x5f,0x75,0x5f,0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x3d,0x20,0x5f,0x31,
+    0x33,0x34,0x5f,0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x20,
+    0x3d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x69,0x76,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x30,0x2e,
+    0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,
+    0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x69,0x6e,0x74,0x28,
+    0x5f,0x31,0x33,0x34,0x5f,0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,0x29,0x3b,
+    0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x6e,0x6f,0x69,0x73,0x65,
+    0x32,0x28,0x70,0x20,0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,0x29,0x20,0x2a,0x20,0x61,
+    0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x2a,0x3d,0x20,0x5f,0x31,0x33,0x34,0x5f,
+    0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x76,0x20,0x2b,0x3d,0x20,0x61,0x6d,0x70,
+    0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x20,0x2a,0x3d,0x20,0x5f,0x31,0x33,
+    0x34,0x5f,0x75,0x5f,0x66,0x61,0x6c,0x6c,0x6f,0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x20,0x3d,
+    0x20,0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x64,0x69,0x76,0x20,0x2b,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x76,0x2c,0x20,0x76,0x2c,0x20,0x76,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,
+    0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct main0_out
+    {
+        float2 uv [[user(locn0)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float2 in_pos [[attribute(0)]];
+        float2 in_uv [[attribute(1)]];
+    };
+    
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.uv = in.in_uv;
+        out.gl_Position = float4(in.in_pos, 0.0, 1.0);
+        return out;
+    }
+    
+*/
+static const char noise_vs_source_metal_macos[425] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+        float2 u_origin;
+        float u_step;
+        float u_scale;
+        float u_lacunarity;
+        float u_falloff;
+        float u_octaves;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 uv [[user(locn0)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    int perm(thread const int& i, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        return int(fma(u_perm.sample(u_permSmplr, float2((float(i & 255) + 0.5) * 0.00390625, 0.5)).x, 255.0, 0.5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 gradient(thread const int& xsb, thread const int& ysb, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        int param = xsb;
+        int param_1 = perm(param, u_perm, u_permSmplr) + ysb;
+        int index = (perm(param_1, u_perm, u_permSmplr) >> 1) & 7;
+        float2 g = float2(2.0, 5.0);
+        if (index == 0)
+        {
+            g = float2(5.0, 2.0);
+        }
+        if (index == 1)
+        {
+            g = float2(2.0, 5.0);
+        }
+        if (index == 2)
+        {
+            g = float2(-5.0, 2.0);
+        }
+        if (index == 3)
+        {
+            g = float2(-2.0, 5.0);
+        }
+        if (index == 4)
+        {
+            g = float2(5.0, -2.0);
+        }
+        if (index == 5)
+        {
+            g = float2(2.0, -5.0);
+        }
+        if (index == 6)
+        {
+            g = float2(-5.0, -2.0);
+        }
+        if (index == 7)
+        {
+            g = float2(-2.0, -5.0);
+        }
+        return g;
+    }
+    
+    static inline __attribute__((always_inline))
+    float noise2(thread const float2& p, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        float2 sb = floor(p + float2((p.x + p.y) * (-0.211324870586395263671875)));
+        float2 d0 = p - (sb + float2((sb.x + sb.y) * 0.3660254180431365966796875));
+        int2 isb = int2(sb);
+        float value = 0.0;
+        for (int k = 0; k < 8; k++)
+        {
+            int2 o = int2(0);
+            if (k == 1)
+            {
+                o = int2(1, 0);
+            }
+            if (k == 2)
+            {
+                o = int2(0, 1);
+            }
+            if (k == 3)
+            {
+                o = int2(1);
+            }
+            if (k == 4)
+            {
+                o = int2(1, -1);
+            }
+            if (k == 5)
+            {
+                o = int2(-1, 1);
+            }
+            if (k == 6)
+            {
+                o = int2(2, 0);
+            }
+            if (k == 7)
+            {
+                o = int2(0, 2);
+            }
+            float2 d = d0 - (float2(o) + float2(float(o.x + o.y) * 0.3660254180431365966796875));
+            float attn = fast::max(2.0 - dot(d, d), 0.0);
+            attn *= attn;
+            int param = isb.x + o.x;
+            int param_1 = isb.y + o.y;
+            value += ((attn * attn) * dot(gradient(param, param_1, u_perm, u_permSmplr), d));
+        }
+        return value / 47.0;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _134 [[buffer(0)]], texture2d<float> u_perm [[texture(0)]], sampler u_permSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        float2 p = _134.u_origin + (floor(float2(in.uv.x, 1.0 - in.uv.y) * _134.u_texture_size) * _134.u_step);
+        float scale = _134.u_scale;
+        float amplitude = 1.0;
+        float div = 0.0;
+        float sum = 0.0;
+        for (int i = 0; i < int(_134.u_octaves); i++)
+        {
+            float2 param = p * scale;
+            sum += (noise2(param, u_perm, u_permSmplr) * amplitude);
+            scale *= _134.u_lacunarity;
+            div += amplitude;
+            amplitude *= _134.u_falloff;
+        }
+        float v = (sum / div + 1.0) * 0.5;
+        out.result = float4(v, v, v, 1.0);
+        return out;
+    }
+    
+*/
+static const char noise_fs_source_metal_macos[3500] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x5f,0x6f,0x72,0x69,0x67,
+    0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,
+    0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,0x69,0x74,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,0x66,0x61,0x6c,
+    0x6c,0x6f,0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x69,0x6e,0x74,0x20,0x70,0x65,0x72,0x6d,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,
+    0x74,0x26,0x20,0x69,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,
+    0x6c,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x69,0x6e,0x74,0x28,0x66,0x6d,0x61,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x69,0x20,0x26,0x20,0x32,0x35,0x35,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x30,0x36,0x32,0x35,0x2c,0x20,
+    0x30,0x2e,0x35,0x29,0x29,0x2e,0x78,0x2c,0x20,0x32,0x35,0x35,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x72,
+    0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x26,0x20,0x78,0x73,0x62,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x26,0x20,
+    0x79,0x73,0x62,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,
+    0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x78,0x73,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x65,0x72,0x6d,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x20,0x2b,0x20,0x79,
+    0x73,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x20,0x28,0x70,0x65,0x72,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,
+    0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x20,0x3e,0x3e,0x20,0x31,0x29,0x20,0x26,0x20,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x35,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,
+    0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,
+    0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x35,0x2e,
+    0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,
+    0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,
+    0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x34,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,0x2e,0x30,0x2c,0x20,
+    0x2d,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x2d,
+    0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,0x2d,
+    0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,0x2c,0x20,0x2d,
+    0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,
+    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x62,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x28,0x70,0x2e,0x78,0x20,0x2b,0x20,0x70,0x2e,0x79,0x29,0x20,0x2a,0x20,0x28,0x2d,
+    0x30,0x2e,0x32,0x31,0x31,0x33,0x32,0x34,0x38,0x37,0x30,0x35,0x38,0x36,0x33,0x39,
+    0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x30,0x20,0x3d,0x20,0x70,
+    0x20,0x2d,0x20,0x28,0x73,0x62,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x28,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,0x73,0x62,0x2e,0x79,0x29,0x20,0x2a,0x20,
+    0x30,0x2e,0x33,0x36,0x36,0x30,0x32,0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,
+    0x36,0x35,0x39,0x36,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x69,0x73,0x62,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x73,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,
+    0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x38,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x32,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,
+    0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,
+    0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x2d,0x31,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,
+    0x2d,0x31,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,
+    0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x32,0x28,0x32,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x32,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x20,0x3d,0x20,0x64,0x30,0x20,
+    0x2d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x6f,0x29,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x78,0x20,
+    0x2b,0x20,0x6f,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,0x30,0x32,
+    0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,0x36,0x35,0x39,0x36,0x36,0x37,0x39,
+    0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x6e,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x32,0x2e,0x30,0x20,0x2d,0x20,0x64,0x6f,0x74,
+    0x28,0x64,0x2c,0x20,0x64,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x3d,0x20,0x61,0x74,
+    0x74,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,
+    0x6f,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x69,0x73,0x62,0x2e,0x79,
+    0x20,0x2b,0x20,0x6f,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x3d,0x20,0x28,0x28,0x61,0x74,0x74,0x6e,0x20,
+    0x2a,0x20,0x61,0x74,0x74,0x6e,0x29,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x67,0x72,
+    0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x2c,0x20,0x64,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2f,0x20,0x34,0x37,0x2e,0x30,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x33,0x34,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6f,0x72,0x69,0x67,0x69,
+    0x6e,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x69,0x6e,0x2e,0x75,0x76,0x2e,0x78,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x69,0x6e,0x2e,0x75,0x76,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,
+    0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,
+    0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x73,0x74,0x65,0x70,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,
+    0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6d,0x70,0x6c,0x69,
+    0x74,0x75,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x76,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,
+    0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,
+    0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x69,0x6e,
+    0x74,0x28,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,
+    0x29,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x70,0x20,0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x28,
+    0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x75,0x5f,
+    0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,
+    0x72,0x29,0x20,0x2a,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x2a,
+    0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,
+    0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x76,
+    0x20,0x2b,0x3d,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,
+    0x20,0x2a,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x66,0x61,0x6c,0x6c,0x6f,
+    0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x64,
+    0x69,0x76,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x76,0x2c,0x20,0x76,0x2c,0x20,0x76,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct main0_out
+    {
+        float2 uv [[user(locn0)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float2 in_pos [[attribute(0)]];
+        float2 in_uv [[attribute(1)]];
+    };
+    
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.uv = in.in_uv;
+        out.gl_Position = float4(in.in_pos, 0.0, 1.0);
+        return out;
+    }
+    
+*/
+static const char noise_vs_source_metal_ios[425] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+        float2 u_origin;
+        float u_step;
+        float u_scale;
+        float u_lacunarity;
+        float u_falloff;
+        float u_octaves;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 uv [[user(locn0)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    int perm(thread const int& i, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        return int(fma(u_perm.sample(u_permSmplr, float2((float(i & 255) + 0.5) * 0.00390625, 0.5)).x, 255.0, 0.5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 gradient(thread const int& xsb, thread const int& ysb, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        int param = xsb;
+        int param_1 = perm(param, u_perm, u_permSmplr) + ysb;
+        int index = (perm(param_1, u_perm, u_permSmplr) >> 1) & 7;
+        float2 g = float2(2.0, 5.0);
+        if (index == 0)
+        {
+            g = float2(5.0, 2.0);
+        }
+        if (index == 1)
+        {
+            g = float2(2.0, 5.0);
+        }
+        if (index == 2)
+        {
+            g = float2(-5.0, 2.0);
+        }
+        if (index == 3)
+        {
+            g = float2(-2.0, 5.0);
+        }
+        if (index == 4)
+        {
+            g = float2(5.0, -2.0);
+        }
+        if (index == 5)
+        {
+            g = float2(2.0, -5.0);
+        }
+        if (index == 6)
+        {
+            g = float2(-5.0, -2.0);
+        }
+        if (index == 7)
+        {
+            g = float2(-2.0, -5.0);
+        }
+        return g;
+    }
+    
+    static inline __attribute__((always_inline))
+    float noise2(thread const float2& p, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        float2 sb = floor(p + float2((p.x + p.y) * (-0.211324870586395263671875)));
+        float2 d0 = p - (sb + float2((sb.x + sb.y) * 0.3660254180431365966796875));
+        int2 isb = int2(sb);
+        float value = 0.0;
+        for (int k = 0; k < 8; k++)
+        {
+            int2 o = int2(0);
+            if (k == 1)
+            {
+                o = int2(1, 0);
+            }
+            if (k == 2)
+            {
+                o = int2(0, 1);
+            }
+            if (k == 3)
+            {
+                o = int2(1);
+            }
+            if (k == 4)
+            {
+                o = int2(1, -1);
+            }
+            if (k == 5)
+            {
+                o = int2(-1, 1);
+            }
+            if (k == 6)
+            {
+                o = int2(2, 0);
+            }
+            if (k == 7)
+            {
+                o = int2(0, 2);
+            }
+            float2 d = d0 - (float2(o) + float2(float(o.x + o.y) * 0.3660254180431365966796875));
+            float attn = fast::max(2.0 - dot(d, d), 0.0);
+            attn *= attn;
+            int param = isb.x + o.x;
+            int param_1 = isb.y + o.y;
+            value += ((attn * attn) * dot(gradient(param, param_1, u_perm, u_permSmplr), d));
+        }
+        return value / 47.0;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _134 [[buffer(0)]], texture2d<float> u_perm [[texture(0)]], sampler u_permSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        float2 p = _134.u_origin + (floor(float2(in.uv.x, 1.0 - in.uv.y) * _134.u_texture_size) * _134.u_step);
+        float scale = _134.u_scale;
+        float amplitude = 1.0;
+        float div = 0.0;
+        float sum = 0.0;
+        for (int i = 0; i < int(_134.u_octaves); i++)
+        {
+            float2 param = p * scale;
+            sum += (noise2(param, u_perm, u_permSmplr) * amplitude);
+            scale *= _134.u_lacunarity;
+            div += amplitude;
+            amplitude *= _134.u_falloff;
+        }
+        float v = (sum / div + 1.0) * 0.5;
+        out.result = float4(v, v, v, 1.0);
+        return out;
+    }
+    
+*/
+static const char noise_fs_source_metal_ios[3500] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x5f,0x6f,0x72,0x69,0x67,
+    0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,
+    0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,0x69,0x74,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,0x66,0x61,0x6c,
+    0x6c,0x6f,0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x69,0x6e,0x74,0x20,0x70,0x65,0x72,0x6d,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,
+    0x74,0x26,0x20,0x69,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,
+    0x6c,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x69,0x6e,0x74,0x28,0x66,0x6d,0x61,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x69,0x20,0x26,0x20,0x32,0x35,0x35,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x30,0x36,0x32,0x35,0x2c,0x20,
+    0x30,0x2e,0x35,0x29,0x29,0x2e,0x78,0x2c,0x20,0x32,0x35,0x35,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x72,
+    0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x26,0x20,0x78,0x73,0x62,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x26,0x20,
+    0x79,0x73,0x62,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,
+    0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x78,0x73,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x65,0x72,0x6d,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x20,0x2b,0x20,0x79,
+    0x73,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x20,0x28,0x70,0x65,0x72,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,
+    0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x20,0x3e,0x3e,0x20,0x31,0x29,0x20,0x26,0x20,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x35,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,
+    0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,
+    0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x35,0x2e,
+    0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,
+    0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,
+    0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x34,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,0x2e,0x30,0x2c,0x20,
+    0x2d,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x2d,
+    0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,0x2d,
+    0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,0x2c,0x20,0x2d,
+    0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,
+    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x62,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x28,0x70,0x2e,0x78,0x20,0x2b,0x20,0x70,0x2e,0x79,0x29,0x20,0x2a,0x20,0x28,0x2d,
+    0x30,0x2e,0x32,0x31,0x31,0x33,0x32,0x34,0x38,0x37,0x30,0x35,0x38,0x36,0x33,0x39,
+    0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x30,0x20,0x3d,0x20,0x70,
+    0x20,0x2d,0x20,0x28,0x73,0x62,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x28,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,0x73,0x62,0x2e,0x79,0x29,0x20,0x2a,0x20,
+    0x30,0x2e,0x33,0x36,0x36,0x30,0x32,0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,
+    0x36,0x35,0x39,0x36,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x69,0x73,0x62,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x73,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,
+    0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x38,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x32,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,
+    0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,
+    0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x2d,0x31,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,
+    0x2d,0x31,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,
+    0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x32,0x28,0x32,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x32,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x20,0x3d,0x20,0x64,0x30,0x20,
+    0x2d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x6f,0x29,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x78,0x20,
+    0x2b,0x20,0x6f,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,0x30,0x32,
+    0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,0x36,0x35,0x39,0x36,0x36,0x37,0x39,
+    0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x6e,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x32,0x2e,0x30,0x20,0x2d,0x20,0x64,0x6f,0x74,
+    0x28,0x64,0x2c,0x20,0x64,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x3d,0x20,0x61,0x74,
+    0x74,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,
+    0x6f,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x69,0x73,0x62,0x2e,0x79,
+    0x20,0x2b,0x20,0x6f,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x3d,0x20,0x28,0x28,0x61,0x74,0x74,0x6e,0x20,
+    0x2a,0x20,0x61,0x74,0x74,0x6e,0x29,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x67,0x72,
+    0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x2c,0x20,0x64,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2f,0x20,0x34,0x37,0x2e,0x30,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x33,0x34,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6f,0x72,0x69,0x67,0x69,
+    0x6e,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x69,0x6e,0x2e,0x75,0x76,0x2e,0x78,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x69,0x6e,0x2e,0x75,0x76,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,
+    0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,
+    0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x73,0x74,0x65,0x70,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,
+    0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6d,0x70,0x6c,0x69,
+    0x74,0x75,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x76,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,
+    0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,
+    0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x69,0x6e,
+    0x74,0x28,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,
+    0x29,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x70,0x20,0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x28,
+    0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x75,0x5f,
+    0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,
+    0x72,0x29,0x20,0x2a,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x2a,
+    0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,
+    0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x76,
+    0x20,0x2b,0x3d,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,
+    0x20,0x2a,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x66,0x61,0x6c,0x6c,0x6f,
+    0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x64,
+    0x69,0x76,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x76,0x2c,0x20,0x76,0x2c,0x20,0x76,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct main0_out
+    {
+        float2 uv [[user(locn0)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float2 in_pos [[attribute(0)]];
+        float2 in_uv [[attribute(1)]];
+    };
+    
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        out.uv = in.in_uv;
+        out.gl_Position = float4(in.in_pos, 0.0, 1.0);
+        return out;
+    }
+    
+*/
+static const char noise_vs_source_metal_sim[425] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,
+    0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,
+    0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,
+    0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+        float2 u_origin;
+        float u_step;
+        float u_scale;
+        float u_lacunarity;
+        float u_falloff;
+        float u_octaves;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 uv [[user(locn0)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    int perm(thread const int& i, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        return int(fma(u_perm.sample(u_permSmplr, float2((float(i & 255) + 0.5) * 0.00390625, 0.5)).x, 255.0, 0.5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 gradient(thread const int& xsb, thread const int& ysb, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        int param = xsb;
+        int param_1 = perm(param, u_perm, u_permSmplr) + ysb;
+        int index = (perm(param_1, u_perm, u_permSmplr) >> 1) & 7;
+        float2 g = float2(2.0, 5.0);
+        if (index == 0)
+        {
+            g = float2(5.0, 2.0);
+        }
+        if (index == 1)
+        {
+            g = float2(2.0, 5.0);
+        }
+        if (index == 2)
+        {
+            g = float2(-5.0, 2.0);
+        }
+        if (index == 3)
+        {
+            g = float2(-2.0, 5.0);
+        }
+        if (index == 4)
+        {
+            g = float2(5.0, -2.0);
+        }
+        if (index == 5)
+        {
+            g = float2(2.0, -5.0);
+        }
+        if (index == 6)
+        {
+            g = float2(-5.0, -2.0);
+        }
+        if (index == 7)
+        {
+            g = float2(-2.0, -5.0);
+        }
+        return g;
+    }
+    
+    static inline __attribute__((always_inline))
+    float noise2(thread const float2& p, texture2d<float> u_perm, sampler u_permSmplr)
+    {
+        float2 sb = floor(p + float2((p.x + p.y) * (-0.211324870586395263671875)));
+        float2 d0 = p - (sb + float2((sb.x + sb.y) * 0.3660254180431365966796875));
+        int2 isb = int2(sb);
+        float value = 0.0;
+        for (int k = 0; k < 8; k++)
+        {
+            int2 o = int2(0);
+            if (k == 1)
+            {
+                o = int2(1, 0);
+            }
+            if (k == 2)
+            {
+                o = int2(0, 1);
+            }
+            if (k == 3)
+            {
+                o = int2(1);
+            }
+            if (k == 4)
+            {
+                o = int2(1, -1);
+            }
+            if (k == 5)
+            {
+                o = int2(-1, 1);
+            }
+            if (k == 6)
+            {
+                o = int2(2, 0);
+            }
+            if (k == 7)
+            {
+                o = int2(0, 2);
+            }
+            float2 d = d0 - (float2(o) + float2(float(o.x + o.y) * 0.3660254180431365966796875));
+            float attn = fast::max(2.0 - dot(d, d), 0.0);
+            attn *= attn;
+            int param = isb.x + o.x;
+            int param_1 = isb.y + o.y;
+            value += ((attn * attn) * dot(gradient(param, param_1, u_perm, u_permSmplr), d));
+        }
+        return value / 47.0;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _134 [[buffer(0)]], texture2d<float> u_perm [[texture(0)]], sampler u_permSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        float2 p = _134.u_origin + (floor(float2(in.uv.x, 1.0 - in.uv.y) * _134.u_texture_size) * _134.u_step);
+        float scale = _134.u_scale;
+        float amplitude = 1.0;
+        float div = 0.0;
+        float sum = 0.0;
+        for (int i = 0; i < int(_134.u_octaves); i++)
+        {
+            float2 param = p * scale;
+            sum += (noise2(param, u_perm, u_permSmplr) * amplitude);
+            scale *= _134.u_lacunarity;
+            div += amplitude;
+            amplitude *= _134.u_falloff;
+        }
+        float v = (sum / div + 1.0) * 0.5;
+        out.result = float4(v, v, v, 1.0);
+        return out;
+    }
+    
+*/
+static const char noise_fs_source_metal_sim[3500] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x5f,0x6f,0x72,0x69,0x67,
+    0x69,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,
+    0x73,0x74,0x65,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,0x69,0x74,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x75,0x5f,0x66,0x61,0x6c,
+    0x6c,0x6f,0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x69,0x6e,0x74,0x20,0x70,0x65,0x72,0x6d,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,
+    0x74,0x26,0x20,0x69,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,
+    0x6c,0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x69,0x6e,0x74,0x28,0x66,0x6d,0x61,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2e,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x69,0x20,0x26,0x20,0x32,0x35,0x35,0x29,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x20,0x2a,0x20,0x30,0x2e,0x30,0x30,0x33,0x39,0x30,0x36,0x32,0x35,0x2c,0x20,
+    0x30,0x2e,0x35,0x29,0x29,0x2e,0x78,0x2c,0x20,0x32,0x35,0x35,0x2e,0x30,0x2c,0x20,
+    0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x72,
+    0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x26,0x20,0x78,0x73,0x62,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x6e,0x74,0x26,0x20,
+    0x79,0x73,0x62,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,
+    0x72,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x78,0x73,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x65,0x72,0x6d,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x20,0x2b,0x20,0x79,
+    0x73,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x20,0x28,0x70,0x65,0x72,0x6d,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,
+    0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x20,0x3e,0x3e,0x20,0x31,0x29,0x20,0x26,0x20,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x35,0x2e,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,
+    0x78,0x20,0x3d,0x3d,0x20,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x35,0x2e,0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,
+    0x3d,0x3d,0x20,0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,
+    0x2e,0x30,0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,
+    0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x35,0x2e,
+    0x30,0x2c,0x20,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,
+    0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,
+    0x2c,0x20,0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x34,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x67,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x35,0x2e,0x30,0x2c,0x20,
+    0x2d,0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x32,0x2e,0x30,0x2c,0x20,0x2d,
+    0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x36,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x35,0x2e,0x30,0x2c,0x20,0x2d,
+    0x32,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x32,0x2e,0x30,0x2c,0x20,0x2d,
+    0x35,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x67,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,
+    0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,
+    0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x62,0x20,0x3d,0x20,0x66,
+    0x6c,0x6f,0x6f,0x72,0x28,0x70,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x28,0x70,0x2e,0x78,0x20,0x2b,0x20,0x70,0x2e,0x79,0x29,0x20,0x2a,0x20,0x28,0x2d,
+    0x30,0x2e,0x32,0x31,0x31,0x33,0x32,0x34,0x38,0x37,0x30,0x35,0x38,0x36,0x33,0x39,
+    0x35,0x32,0x36,0x33,0x36,0x37,0x31,0x38,0x37,0x35,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x30,0x20,0x3d,0x20,0x70,
+    0x20,0x2d,0x20,0x28,0x73,0x62,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x28,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,0x73,0x62,0x2e,0x79,0x29,0x20,0x2a,0x20,
+    0x30,0x2e,0x33,0x36,0x36,0x30,0x32,0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,
+    0x36,0x35,0x39,0x36,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x74,0x32,0x20,0x69,0x73,0x62,0x20,0x3d,0x20,0x69,0x6e,
+    0x74,0x32,0x28,0x73,0x62,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x6e,0x74,0x20,0x6b,0x20,0x3d,0x20,
+    0x30,0x3b,0x20,0x6b,0x20,0x3c,0x20,0x38,0x3b,0x20,0x6b,0x2b,0x2b,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x32,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,
+    0x31,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,
+    0x32,0x28,0x31,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,
+    0x20,0x3d,0x3d,0x20,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,
+    0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x33,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x31,0x2c,0x20,0x2d,0x31,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x35,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,
+    0x2d,0x31,0x2c,0x20,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6b,0x20,
+    0x3d,0x3d,0x20,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6f,0x20,0x3d,0x20,
+    0x69,0x6e,0x74,0x32,0x28,0x32,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x6b,0x20,0x3d,0x3d,0x20,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x6f,0x20,0x3d,0x20,0x69,0x6e,0x74,0x32,0x28,0x30,0x2c,0x20,0x32,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x64,0x20,0x3d,0x20,0x64,0x30,0x20,
+    0x2d,0x20,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x6f,0x29,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x78,0x20,
+    0x2b,0x20,0x6f,0x2e,0x79,0x29,0x20,0x2a,0x20,0x30,0x2e,0x33,0x36,0x36,0x30,0x32,
+    0x35,0x34,0x31,0x38,0x30,0x34,0x33,0x31,0x33,0x36,0x35,0x39,0x36,0x36,0x37,0x39,
+    0x36,0x38,0x37,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x74,0x74,0x6e,0x20,0x3d,0x20,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x32,0x2e,0x30,0x20,0x2d,0x20,0x64,0x6f,0x74,
+    0x28,0x64,0x2c,0x20,0x64,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x74,0x74,0x6e,0x20,0x2a,0x3d,0x20,0x61,0x74,
+    0x74,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x73,0x62,0x2e,0x78,0x20,0x2b,0x20,
+    0x6f,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x6e,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x69,0x73,0x62,0x2e,0x79,
+    0x20,0x2b,0x20,0x6f,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x2b,0x3d,0x20,0x28,0x28,0x61,0x74,0x74,0x6e,0x20,
+    0x2a,0x20,0x61,0x74,0x74,0x6e,0x29,0x20,0x2a,0x20,0x64,0x6f,0x74,0x28,0x67,0x72,
+    0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x29,0x2c,0x20,0x64,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x2f,0x20,0x34,0x37,0x2e,0x30,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,
+    0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x31,0x33,0x34,0x20,
+    0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,
+    0x75,0x5f,0x70,0x65,0x72,0x6d,0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,
+    0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6f,0x72,0x69,0x67,0x69,
+    0x6e,0x20,0x2b,0x20,0x28,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x69,0x6e,0x2e,0x75,0x76,0x2e,0x78,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x69,0x6e,0x2e,0x75,0x76,0x2e,0x79,0x29,0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,
+    0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,
+    0x20,0x2a,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x73,0x74,0x65,0x70,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x63,0x61,0x6c,0x65,
+    0x20,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x73,0x63,0x61,0x6c,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x6d,0x70,0x6c,0x69,
+    0x74,0x75,0x64,0x65,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x76,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,
+    0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,
+    0x6e,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x69,0x6e,
+    0x74,0x28,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6f,0x63,0x74,0x61,0x76,0x65,0x73,
+    0x29,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x70,0x20,0x2a,0x20,0x73,0x63,0x61,0x6c,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x75,0x6d,0x20,0x2b,0x3d,0x20,0x28,
+    0x6e,0x6f,0x69,0x73,0x65,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x75,0x5f,
+    0x70,0x65,0x72,0x6d,0x2c,0x20,0x75,0x5f,0x70,0x65,0x72,0x6d,0x53,0x6d,0x70,0x6c,
+    0x72,0x29,0x20,0x2a,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x63,0x61,0x6c,0x65,0x20,0x2a,
+    0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x6c,0x61,0x63,0x75,0x6e,0x61,0x72,
+    0x69,0x74,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x76,
+    0x20,0x2b,0x3d,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6d,0x70,0x6c,0x69,0x74,0x75,0x64,0x65,
+    0x20,0x2a,0x3d,0x20,0x5f,0x31,0x33,0x34,0x2e,0x75,0x5f,0x66,0x61,0x6c,0x6c,0x6f,
+    0x66,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x20,0x3d,0x20,0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x64,
+    0x69,0x76,0x20,0x2b,0x20,0x31,0x2e,0x30,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x76,0x2c,0x20,0x76,0x2c,0x20,0x76,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+#if !defined(SOKOL_GFX_INCLUDED)
+  #error "Please include sokol_gfx.h before noise_shader.h"
+#endif
+static inline const sg_shader_desc* noise_shd_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "in_pos";
+      desc.attrs[1].name = "in_uv";
+      desc.vs.source = noise_vs_source_glsl330;
+      desc.vs.entry = "main";
+      desc.fs.source = noise_fs_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 48;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 3;
+      desc.fs.images[0].name = "u_perm";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "noise_shd_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_GLES3) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "in_pos";
+      desc.attrs[1].name = "in_uv";
+      desc.vs.source = noise_vs_source_glsl300es;
+      desc.vs.entry = "main";
+      desc.fs.source = noise_fs_source_glsl300es;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 48;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 3;
+      desc.fs.images[0].name = "u_perm";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "noise_shd_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_D3D11) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].sem_name = "TEXCOORD";
+      desc.attrs[0].sem_index = 0;
+      desc.attrs[1].sem_name = "TEXCOORD";
+      desc.attrs[1].sem_index = 1;
+      desc.vs.source = noise_vs_source_hlsl5;
+      desc.vs.d3d11_target = "vs_5_0";
+      desc.vs.entry = "main";
+      desc.fs.source = noise_fs_source_hlsl5;
+      desc.fs.d3d11_target = "ps_5_0";
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 48;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_perm";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "noise_shd_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_MACOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = noise_vs_source_metal_macos;
+      desc.vs.entry = "main0";
+      desc.fs.source = noise_fs_source_metal_macos;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 48;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_perm";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "noise_shd_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_IOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = noise_vs_source_metal_ios;
+      desc.vs.entry = "main0";
+      desc.fs.source = noise_fs_source_metal_ios;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 48;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_perm";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "noise_shd_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_SIMULATOR) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = noise_vs_source_metal_sim;
+      desc.vs.entry = "main0";
+      desc.fs.source = noise_fs_source_metal_sim;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 48;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_perm";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "noise_shd_shader";
+    }
+    return &desc;
+  }
+  return 0;
+}
+static inline int noise_shd_attr_slot(const char* attr_name) {
+  (void)attr_name;
+  if (0 == strcmp(attr_name, "in_pos")) {
+    return 0;
+  }
+  if (0 == strcmp(attr_name, "in_uv")) {
+    return 1;
+  }
+  return -1;
+}
+static inline int noise_shd_image_slot(sg_shader_stage stage, const char* img_name) {
+  (void)stage; (void)img_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(img_name, "u_perm")) {
+      return 0;
+    }
+  }
+  return -1;
+}
+static inline int noise_shd_uniformblock_slot(sg_shader_stage stage, const char* ub_name) {
+  (void)stage; (void)ub_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      return 0;
+    }
+  }
+  return -1;
+}
+static inline size_t noise_shd_uniformblock_size(sg_shader_stage stage, const char* ub_name) {
+  (void)stage; (void)ub_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      return sizeof(noise_fs_params_t);
+    }
+  }
+  return 0;
+}
+static inline int noise_shd_uniform_offset(sg_shader_stage stage, const char* ub_name, const char* u_name) {
+  (void)stage; (void)ub_name; (void)u_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      if (0 == strcmp(u_name, "u_texture_size")) {
+        return 0;
+      }
+      if (0 == strcmp(u_name, "u_origin")) {
+        return 8;
+      }
+      if (0 == strcmp(u_name, "u_step")) {
+        return 16;
+      }
+      if (0 == strcmp(u_name, "u_scale")) {
+        return 20;
+      }
+      if (0 == strcmp(u_name, "u_lacunarity")) {
+        return 24;
+      }
+      if (0 == strcmp(u_name, "u_falloff")) {
+        return 28;
+      }
+      if (0 == strcmp(u_name, "u_octaves")) {
+        return 32;
+      }
+    }
+  }
+  return -1;
+}
+static inline sg_shader_uniform_desc noise_shd_uniform_desc(sg_shader_stage stage, const char* ub_name, const char* u_name) {
+  (void)stage; (void)ub_name; (void)u_name;
+  #if defined(__cplusplus)
+  sg_shader_uniform_desc desc = {};
+  #else
+  sg_shader_uniform_desc desc = {0};
+  #endif
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      if (0 == strcmp(u_name, "u_texture_size")) {
+        desc.name = "u_texture_size";
+        desc.type = SG_UNIFORMTYPE_FLOAT2;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_origin")) {
+        desc.name = "u_origin";
+        desc.type = SG_UNIFORMTYPE_FLOAT2;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_step")) {
+        desc.name = "u_step";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_scale")) {
+        desc.name = "u_scale";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_lacunarity")) {
+        desc.name = "u_lacunarity";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_falloff")) {
+        desc.name = "u_falloff";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_octaves")) {
+        desc.name = "u_octaves";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+    }
+  }
+  return desc;
+}
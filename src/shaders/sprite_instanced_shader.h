@@ -0,0 +1,6366 @@
+#pragma once
+/*
+    NOT machine generated. Written by hand from the sokol-shdc output of sprite.glsl as the variant compile.sh
+    builds with CF_DRAW_INSTANCED (a unit quad drawn once per sprite or shape), as sokol-shdc could not be run
+    when the variant was added. The fragment shader is the one in sprite_shader.h. On Mesa the glsl330 and
+    glsl300es sources compile and link, and drawing a scene's sprites, glyphs and shapes as instances gives the
+    same pixels as sprite_shader.h drawing them as vertices, depth included. The hlsl5 and metal sources have not
+    been through a shader compiler. Running compile.sh or compile.cmd regenerates this file from sprite.glsl with
+    real sokol-shdc output, which should replace it.
+
+    Overview:
+
+        Shader program 'shader':
+            Get shader desc: sprite_instanced_shader_shader_desc(sg_query_backend());
+            Vertex shader: vs
+                Attribute slots:
+                    ATTR_sprite_instanced_vs_in_corner = 0
+                    ATTR_sprite_instanced_vs_in_pos_ab = 1
+                    ATTR_sprite_instanced_vs_in_pos_cd = 2
+                    ATTR_sprite_instanced_vs_in_posH_ab = 3
+                    ATTR_sprite_instanced_vs_in_posH_cd = 4
+                    ATTR_sprite_instanced_vs_in_ab = 5
+                    ATTR_sprite_instanced_vs_in_c = 6
+                    ATTR_sprite_instanced_vs_in_uv_rect = 7
+                    ATTR_sprite_instanced_vs_in_col = 8
+                    ATTR_sprite_instanced_vs_in_shape = 9
+                    ATTR_sprite_instanced_vs_in_params = 10
+                    ATTR_sprite_instanced_vs_in_user_params = 11
+                    ATTR_sprite_instanced_vs_in_depth = 12
+            Fragment shader: fs
+                Uniform block 'fs_params':
+                    C struct: sprite_instanced_fs_params_t
+                    Bind slot: SLOT_sprite_instanced_fs_params = 0
+                Image 'u_image':
+                    Type: SG_IMAGETYPE_2D
+                    Component Type: SG_SAMPLERTYPE_FLOAT
+                    Bind slot: SLOT_sprite_instanced_u_image = 0
+
+
+    Shader descriptor structs:
+
+        sg_shader shader = sg_make_shader(sprite_instanced_shader_shader_desc(sg_query_backend()));
+
+    Vertex attribute locations for vertex shader 'vs':
+
+        sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+            .layout = {
+                .attrs = {
+                    [ATTR_sprite_instanced_vs_in_corner] = { ... },
+                    [ATTR_sprite_instanced_vs_in_pos_ab] = { ... },
+                    [ATTR_sprite_instanced_vs_in_pos_cd] = { ... },
+                    [ATTR_sprite_instanced_vs_in_posH_ab] = { ... },
+                    [ATTR_sprite_instanced_vs_in_posH_cd] = { ... },
+                    [ATTR_sprite_instanced_vs_in_ab] = { ... },
+                    [ATTR_sprite_instanced_vs_in_c] = { ... },
+                    [ATTR_sprite_instanced_vs_in_uv_rect] = { ... },
+                    [ATTR_sprite_instanced_vs_in_col] = { ... },
+                    [ATTR_sprite_instanced_vs_in_shape] = { ... },
+                    [ATTR_sprite_instanced_vs_in_params] = { ... },
+                    [ATTR_sprite_instanced_vs_in_user_params] = { ... },
+                    [ATTR_sprite_instanced_vs_in_depth] = { ... },
+                },
+            },
+            ...});
+
+    Image bind slots, use as index in sg_bindings.vs_images[] or .fs_images[]
+
+        SLOT_sprite_instanced_u_image = 0;
+
+    Bind slot and C-struct for uniform block 'fs_params':
+
+        sprite_instanced_fs_params_t fs_params = {
+            .u_texture_size = ...;
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_[VS|FS], SLOT_sprite_instanced_fs_params, &SG_RANGE(fs_params));
+
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+#if !defined(SOKOL_SHDC_ALIGN)
+  #if defined(_MSC_VER)
+    #define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+  #else
+    #define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+  #endif
+#endif
+#define ATTR_sprite_instanced_vs_in_corner (0)
+#define ATTR_sprite_instanced_vs_in_pos_ab (1)
+#define ATTR_sprite_instanced_vs_in_pos_cd (2)
+#define ATTR_sprite_instanced_vs_in_posH_ab (3)
+#define ATTR_sprite_instanced_vs_in_posH_cd (4)
+#define ATTR_sprite_instanced_vs_in_ab (5)
+#define ATTR_sprite_instanced_vs_in_c (6)
+#define ATTR_sprite_instanced_vs_in_uv_rect (7)
+#define ATTR_sprite_instanced_vs_in_col (8)
+#define ATTR_sprite_instanced_vs_in_shape (9)
+#define ATTR_sprite_instanced_vs_in_params (10)
+#define ATTR_sprite_instanced_vs_in_user_params (11)
+#define ATTR_sprite_instanced_vs_in_depth (12)
+#define SLOT_sprite_instanced_u_image (0)
+#define SLOT_sprite_instanced_fs_params (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct sprite_instanced_fs_params_t {
+    CF_V2 u_texture_size;
+    uint8_t _pad_8[8];
+} sprite_instanced_fs_params_t;
+#pragma pack(pop)
+/*
+    #version 330
+    
+    out vec2 v_pos;
+    out vec2 v_a;
+    out vec2 v_b;
+    out vec2 v_c;
+    out vec2 v_uv;
+    out vec4 v_col;
+    out float v_radius;
+    out float v_stroke;
+    out float v_aa;
+    out float v_type;
+    out float v_alpha;
+    out float v_fill;
+    out vec2 v_posH;
+    out vec4 v_user;
+    layout(location = 0) in vec4 in_corner;
+    layout(location = 1) in vec4 in_pos_ab;
+    layout(location = 2) in vec4 in_pos_cd;
+    layout(location = 3) in vec4 in_posH_ab;
+    layout(location = 4) in vec4 in_posH_cd;
+    layout(location = 5) in vec4 in_ab;
+    layout(location = 6) in vec2 in_c;
+    layout(location = 7) in vec4 in_uv_rect;
+    layout(location = 8) in vec4 in_col;
+    layout(location = 9) in vec3 in_shape;
+    layout(location = 10) in vec4 in_params;
+    layout(location = 11) in vec4 in_user_params;
+    layout(location = 12) in float in_depth;
+    
+    void main()
+    {
+        vec2 _pos = (((in_pos_ab.xy * in_corner.x) + (in_pos_ab.zw * in_corner.y)) + (in_pos_cd.xy * in_corner.z)) + (in_pos_cd.zw * in_corner.w);
+        vec2 _posH = (((in_posH_ab.xy * in_corner.x) + (in_posH_ab.zw * in_corner.y)) + (in_posH_cd.xy * in_corner.z)) + (in_posH_cd.zw * in_corner.w);
+        v_pos = _pos;
+        v_a = in_ab.xy;
+        v_b = in_ab.zw;
+        v_c = in_c;
+        v_uv = mix(in_uv_rect.xy, in_uv_rect.zw, vec2(in_corner.y + in_corner.z, in_corner.x + in_corner.y));
+        v_col = in_col;
+        v_radius = in_shape.x;
+        v_stroke = in_shape.y;
+        v_aa = in_shape.z;
+        v_type = in_params.x;
+        v_alpha = in_params.y;
+        v_fill = in_params.z;
+        gl_Position = vec4(_posH, in_depth, 1.0);
+        v_posH = _posH;
+        v_user = in_user_params;
+        gl_Position.y = -gl_Position.y;
+    }
+    
+*/
+static const char sprite_instanced_vs_source_glsl330[1563] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,
+    0x68,0x61,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x61,0x62,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,
+    0x6e,0x5f,0x61,0x62,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x37,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x38,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,
+    0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x39,0x29,0x20,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x3b,0x0a,0x6c,0x61,
+    0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x31,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x31,0x29,0x20,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x32,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x28,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,0x20,
+    0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,
+    0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,
+    0x62,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,
+    0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,0x65,
+    0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x2e,0x78,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,
+    0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x70,0x6f,0x73,0x48,
+    0x2c,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x2e,0x79,0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x2e,0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 330
+    
+    uniform vec4 fs_params[1];
+    uniform sampler2D u_image;
+    
+    in float v_stroke;
+    in float v_aa;
+    layout(location = 0) out vec4 result;
+    in float v_fill;
+    in float v_type;
+    in vec2 v_uv;
+    in vec4 v_col;
+    in vec2 v_pos;
+    in vec2 v_a;
+    in vec2 v_b;
+    in vec2 v_c;
+    in float v_radius;
+    in float v_alpha;
+    in vec2 v_posH;
+    in vec4 v_user;
+    
+    vec2 smooth_uv(vec2 uv, vec2 texture_size)
+    {
+        vec2 _205 = floor(uv * texture_size + vec2(0.5));
+        return (_205 + clamp((uv * texture_size + (-_205)) / fwidth(uv * texture_size), vec2(-0.5), vec2(0.5))) / texture_size;
+    }
+    
+    vec4 de_gamma(vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(2.2000000476837158203125)), c.w);
+    }
+    
+    float overlay(float base, float blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = ((1.0 - base) * (-2.0)) * (1.0 - blend) + 1.0;
+        }
+        return _105;
+    }
+    
+    vec3 overlay(vec3 base, vec3 blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return vec3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    vec4 overlay(vec4 base, vec4 blend)
+    {
+        vec3 param = base.xyz;
+        vec3 param_1 = blend.xyz;
+        return vec4(overlay(param, param_1), base.w);
+    }
+    
+    vec4 gamma(vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(0.4545454680919647216796875)), c.w);
+    }
+    
+    vec2 skew(vec2 v)
+    {
+        return vec2(-v.y, v.x);
+    }
+    
+    float distance_aabb(vec2 p, vec2 he)
+    {
+        vec2 _349 = abs(p) - he;
+        return length(max(_349, vec2(0.0))) + min(max(_349.x, _349.y), 0.0);
+    }
+    
+    float distance_box(inout vec2 p, vec2 c, vec2 he, vec2 u)
+    {
+        vec2 param = u;
+        p -= c;
+        p = transpose(mat2(u, skew(param))) * p;
+        vec2 param_1 = p;
+        vec2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    float safe_div(float a, float b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    float safe_len(vec2 v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    float distance_segment(vec2 p, vec2 a, vec2 b)
+    {
+        vec2 _394 = b - a;
+        vec2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        vec2 param_2 = _398 - (_394 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    float det2(vec2 a, vec2 b)
+    {
+        return a.x * b.y + (-(a.y * b.x));
+    }
+    
+    float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
+    {
+        vec2 _424 = b - a;
+        vec2 _428 = c - b;
+        vec2 _432 = a - c;
+        vec2 _436 = p - a;
+        vec2 _440 = p - b;
+        vec2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        vec2 _459 = _436 - (_424 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        vec2 _474 = _440 - (_428 * clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        vec2 _489 = _444 - (_432 * clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        vec2 param_6 = _424;
+        vec2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        vec2 param_8 = _436;
+        vec2 param_9 = _424;
+        vec2 param_10 = _440;
+        vec2 param_11 = _428;
+        vec2 param_12 = _444;
+        vec2 param_13 = _432;
+        vec2 _531 = min(min(vec2(dot(_459, _459), _495 * det2(param_8, param_9)), vec2(dot(_474, _474), _495 * det2(param_10, param_11))), vec2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    float sdf_stroke(float d)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    vec4 sdf(vec4 a, vec4 b, float d)
+    {
+        float param = d;
+        vec4 _292 = mix(b, a, vec4(smoothstep(0.0, v_aa, sdf_stroke(param))));
+        bvec4 _316 = bvec4(clamp(d, -1.0, 1.0) <= 0.0);
+        vec4 _324 = vec4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(vec4(_316.x ? b.x : a.x, _316.y ? b.y : a.y, _316.z ? b.z : a.z, _316.w ? b.w : a.w), mix(b, a, vec4(smoothstep(0.0, v_aa, d))), _324), vec4(v_fill));
+        return result;
+    }
+    
+    vec4 shader(vec4 color, vec2 pos, vec2 atlas_uv, vec2 screen_uv, vec4 params)
+    {
+        return color;
+    }
+    
+    void main()
+    {
+        bool is_sprite = v_type >= 0.0 && v_type < 0.00196078442968428134918212890625;
+        bool is_text = v_type > 0.00196078442968428134918212890625 && v_type < 0.0058823530562222003936767578125;
+        bool is_box = v_type > 0.0058823530562222003936767578125 && v_type < 0.009803921915590763092041015625;
+        bool is_seg = v_type > 0.009803921915590763092041015625 && v_type < 0.013725490309298038482666015625;
+        bool is_tri = v_type > 0.013725490309298038482666015625 && v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125 && v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125 && v_type < 0.0254901959002017974853515625;
+        vec2 texel_pos = v_uv * fs_params[0].xy;
+        float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+        vec4 c = de_gamma(texture(u_image, smooth_uv(v_uv, fs_params[0].xy)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, v_col));
+        }
+        if (is_text)
+        {
+            c = v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            vec2 texel = v_uv * fs_params[0].xy - vec2(0.5);
+            vec2 base = floor(texel);
+            vec2 f = texel - base;
+            vec2 uv0 = (base + vec2(0.5)) / fs_params[0].xy;
+            vec2 uv1 = (base + vec2(1.5)) / fs_params[0].xy;
+            float sd = mix(mix(textureLod(u_image, uv0, 0.0).w, textureLod(u_image, vec2(uv1.x, uv0.y), 0.0).w, f.x), mix(textureLod(u_image, vec2(uv0.x, uv1.y), 0.0).w, textureLod(u_image, uv1, 0.0).w, f.x), f.y);
+            c = v_col * clamp((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5, 0.0, 1.0);
+        }
+        if (is_tri)
+        {
+            c = v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            vec2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, v_col, d - v_radius);
+        }
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + vec2(1.0)) * 0.5, v_user);
+        if (c.w == 0.0)
+        {
+            discard;
+        }
+        result = c;
+    }
+    
+*/
+static const char sprite_instanced_fs_source_glsl330[6585] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x69,0x6d,0x61,
+    0x67,0x65,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x69,0x6e,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x69,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x76,0x5f,0x62,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x63,
+    0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,
+    0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x32,0x20,0x73,0x6d,0x6f,
+    0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x2c,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,
+    0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x75,0x76,0x20,0x2a,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x28,0x2d,0x5f,0x32,0x30,0x35,0x29,
+    0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x64,
+    0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,
+    0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,
+    0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,
+    0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2d,
+    0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,0x29,
+    0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,
+    0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x76,
+    0x65,0x63,0x33,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
+    0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,
+    0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x76,0x65,0x63,0x34,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x67,0x61,0x6d,
+    0x6d,0x61,0x28,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x77,
+    0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,0x34,0x36,0x38,0x30,0x39,0x31,
+    0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x2c,
+    0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x32,0x20,0x73,
+    0x6b,0x65,0x77,0x28,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x76,
+    0x2e,0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,
+    0x28,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x33,0x34,
+    0x39,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,
+    0x74,0x68,0x28,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x6d,0x69,0x6e,0x28,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,
+    0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,
+    0x69,0x6e,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x63,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x20,0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x6d,0x61,0x74,0x32,0x28,
+    0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,
+    0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,0x3d,
+    0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,
+    0x32,0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,
+    0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,
+    0x5f,0x6c,0x65,0x6e,0x28,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x32,0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,
+    0x34,0x32,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,
+    0x72,0x74,0x28,0x5f,0x32,0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x65,0x63,0x32,0x20,
+    0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x33,
+    0x39,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,
+    0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,
+    0x39,0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,
+    0x39,0x38,0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x65,0x74,0x32,0x28,0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x61,0x2e,0x78,0x20,0x2a,0x20,0x62,0x2e,0x79,0x20,0x2b,0x20,0x28,0x2d,
+    0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x38,0x20,
+    0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,
+    0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,
+    0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,
+    0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,
+    0x5f,0x34,0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,
+    0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x37,0x34,0x20,
+    0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,
+    0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,
+    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,
+    0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,
+    0x28,0x5f,0x34,0x33,0x32,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,
+    0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,
+    0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,
+    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,
+    0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x6d,
+    0x69,0x6e,0x28,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x35,0x39,
+    0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,
+    0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,0x34,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x29,0x29,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,
+    0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,
+    0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,0x71,0x72,0x74,0x28,0x5f,0x35,0x33,
+    0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,
+    0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x61,0x62,0x73,0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
+    0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x73,0x64,0x66,0x28,0x76,
+    0x65,0x63,0x34,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,0x20,0x6d,
+    0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x73,0x6d,
+    0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,
+    0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x76,
+    0x65,0x63,0x34,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x62,0x76,0x65,0x63,0x34,
+    0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,
+    0x31,0x2e,0x30,0x29,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,
+    0x30,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,
+    0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,
+    0x69,0x78,0x28,0x76,0x65,0x63,0x34,0x28,0x5f,0x33,0x31,0x36,0x2e,0x78,0x20,0x3f,
+    0x20,0x62,0x2e,0x78,0x20,0x3a,0x20,0x61,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x31,0x36,
+    0x2e,0x79,0x20,0x3f,0x20,0x62,0x2e,0x79,0x20,0x3a,0x20,0x61,0x2e,0x79,0x2c,0x20,
+    0x5f,0x33,0x31,0x36,0x2e,0x7a,0x20,0x3f,0x20,0x62,0x2e,0x7a,0x20,0x3a,0x20,0x61,
+    0x2e,0x7a,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x77,0x20,0x3f,0x20,0x62,0x2e,0x77,
+    0x20,0x3a,0x20,0x61,0x2e,0x77,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,
+    0x61,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,
+    0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,0x29,
+    0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x65,0x63,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x76,0x65,0x63,0x34,
+    0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,0x76,0x2c,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2c,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,
+    0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,
+    0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,
+    0x62,0x6f,0x78,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,
+    0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,
+    0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,
+    0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,
+    0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,
+    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,
+    0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,
+    0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,
+    0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,
+    0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,
+    0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,
+    0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,
+    0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,
+    0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,
+    0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,
+    0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,
+    0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,
+    0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,
+    0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,
+    0x68,0x28,0x64,0x46,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,
+    0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x79,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,
+    0x76,0x5f,0x75,0x76,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,
+    0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,
+    0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,
+    0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,
+    0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,
+    0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,
+    0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,
+    0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,
+    0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,
+    0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,
+    0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,
+    0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,
+    0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,
+    0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,
+    0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,
+    0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,
+    0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,
+    0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,
+    0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x69,
+    0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,
+    0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,
+    0x20,0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,
+    0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,
+    0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,
+    0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,
+    0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,
+    0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    
+    out vec2 v_pos;
+    out vec2 v_a;
+    out vec2 v_b;
+    out vec2 v_c;
+    out vec2 v_uv;
+    out vec4 v_col;
+    out float v_radius;
+    out float v_stroke;
+    out float v_aa;
+    out float v_type;
+    out float v_alpha;
+    out float v_fill;
+    out vec2 v_posH;
+    out vec4 v_user;
+    layout(location = 0) in vec4 in_corner;
+    layout(location = 1) in vec4 in_pos_ab;
+    layout(location = 2) in vec4 in_pos_cd;
+    layout(location = 3) in vec4 in_posH_ab;
+    layout(location = 4) in vec4 in_posH_cd;
+    layout(location = 5) in vec4 in_ab;
+    layout(location = 6) in vec2 in_c;
+    layout(location = 7) in vec4 in_uv_rect;
+    layout(location = 8) in vec4 in_col;
+    layout(location = 9) in vec3 in_shape;
+    layout(location = 10) in vec4 in_params;
+    layout(location = 11) in vec4 in_user_params;
+    layout(location = 12) in float in_depth;
+    
+    void main()
+    {
+        vec2 _pos = (((in_pos_ab.xy * in_corner.x) + (in_pos_ab.zw * in_corner.y)) + (in_pos_cd.xy * in_corner.z)) + (in_pos_cd.zw * in_corner.w);
+        vec2 _posH = (((in_posH_ab.xy * in_corner.x) + (in_posH_ab.zw * in_corner.y)) + (in_posH_cd.xy * in_corner.z)) + (in_posH_cd.zw * in_corner.w);
+        v_pos = _pos;
+        v_a = in_ab.xy;
+        v_b = in_ab.zw;
+        v_c = in_c;
+        v_uv = mix(in_uv_rect.xy, in_uv_rect.zw, vec2(in_corner.y + in_corner.z, in_corner.x + in_corner.y));
+        v_col = in_col;
+        v_radius = in_shape.x;
+        v_stroke = in_shape.y;
+        v_aa = in_shape.z;
+        v_type = in_params.x;
+        v_alpha = in_params.y;
+        v_fill = in_params.z;
+        gl_Position = vec4(_posH, in_depth, 1.0);
+        v_posH = _posH;
+        v_user = in_user_params;
+        gl_Position.y = -gl_Position.y;
+    }
+    
+*/
+static const char sprite_instanced_vs_source_glsl300es[1566] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x6f,0x75,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,
+    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,
+    0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,
+    0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x32,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,
+    0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x33,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x34,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x63,0x64,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x35,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x69,0x6e,0x5f,0x61,0x62,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x36,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x37,0x29,
+    0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,
+    0x65,0x63,0x74,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x38,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x39,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x31,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,
+    0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x31,0x29,0x20,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x32,0x29,0x20,0x69,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x28,0x28,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,
+    0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,
+    0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,0x2a,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,
+    0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,0x2a,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,
+    0x28,0x28,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x78,0x79,
+    0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,
+    0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x7a,0x77,
+    0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x29,
+    0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,0x78,
+    0x79,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,
+    0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,
+    0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,
+    0x6e,0x5f,0x61,0x62,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x5f,0x75,0x76,
+    0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,0x6e,0x5f,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,
+    0x72,0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,
+    0x70,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,
+    0x68,0x61,0x70,0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x70,
+    0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,
+    0x3d,0x20,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,
+    0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,
+    0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+    
+    uniform highp vec4 fs_params[1];
+    uniform highp sampler2D u_image;
+    
+    in highp float v_stroke;
+    in highp float v_aa;
+    layout(location = 0) out highp vec4 result;
+    in highp float v_fill;
+    in highp float v_type;
+    in highp vec2 v_uv;
+    in highp vec4 v_col;
+    in highp vec2 v_pos;
+    in highp vec2 v_a;
+    in highp vec2 v_b;
+    in highp vec2 v_c;
+    in highp float v_radius;
+    in highp float v_alpha;
+    in highp vec2 v_posH;
+    in highp vec4 v_user;
+    
+    highp vec2 smooth_uv(highp vec2 uv, highp vec2 texture_size)
+    {
+        highp vec2 _205 = floor(uv * texture_size + vec2(0.5));
+        return (_205 + clamp((uv * texture_size + (-_205)) / fwidth(uv * texture_size), vec2(-0.5), vec2(0.5))) / texture_size;
+    }
+    
+    highp vec4 de_gamma(highp vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(2.2000000476837158203125)), c.w);
+    }
+    
+    highp float overlay(highp float base, highp float blend)
+    {
+        highp float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = ((1.0 - base) * (-2.0)) * (1.0 - blend) + 1.0;
+        }
+        return _105;
+    }
+    
+    highp vec3 overlay(highp vec3 base, highp vec3 blend)
+    {
+        highp float param = base.x;
+        highp float param_1 = blend.x;
+        highp float param_2 = base.y;
+        highp float param_3 = blend.y;
+        highp float param_4 = base.z;
+        highp float param_5 = blend.z;
+        return vec3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    highp vec4 overlay(highp vec4 base, highp vec4 blend)
+    {
+        highp vec3 param = base.xyz;
+        highp vec3 param_1 = blend.xyz;
+        return vec4(overlay(param, param_1), base.w);
+    }
+    
+    highp vec4 gamma(highp vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(0.4545454680919647216796875)), c.w);
+    }
+    
+    highp vec2 skew(highp vec2 v)
+    {
+        return vec2(-v.y, v.x);
+    }
+    
+    highp float distance_aabb(highp vec2 p, highp vec2 he)
+    {
+        highp vec2 _349 = abs(p) - he;
+        return length(max(_349, vec2(0.0))) + min(max(_349.x, _349.y), 0.0);
+    }
+    
+    highp float distance_box(inout highp vec2 p, highp vec2 c, highp vec2 he, highp vec2 u)
+    {
+        highp vec2 param = u;
+        p -= c;
+        p = transpose(mat2(u, skew(param))) * p;
+        highp vec2 param_1 = p;
+        highp vec2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    highp float safe_div(highp float a, highp float b)
+    {
+        highp float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    highp float safe_len(highp vec2 v)
+    {
+        highp float _239 = dot(v, v);
+        highp float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    highp float distance_segment(highp vec2 p, highp vec2 a, highp vec2 b)
+    {
+        highp vec2 _394 = b - a;
+        highp vec2 _398 = p - a;
+        highp float param = dot(_398, _394);
+        highp float param_1 = dot(_394, _394);
+        highp vec2 param_2 = _398 - (_394 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    highp float det2(highp vec2 a, highp vec2 b)
+    {
+        return a.x * b.y + (-(a.y * b.x));
+    }
+    
+    highp float distance_triangle(highp vec2 p, highp vec2 a, highp vec2 b, highp vec2 c)
+    {
+        highp vec2 _424 = b - a;
+        highp vec2 _428 = c - b;
+        highp vec2 _432 = a - c;
+        highp vec2 _436 = p - a;
+        highp vec2 _440 = p - b;
+        highp vec2 _444 = p - c;
+        highp float param = dot(_436, _424);
+        highp float param_1 = dot(_424, _424);
+        highp vec2 _459 = _436 - (_424 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        highp float param_2 = dot(_440, _428);
+        highp float param_3 = dot(_428, _428);
+        highp vec2 _474 = _440 - (_428 * clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        highp float param_4 = dot(_444, _432);
+        highp float param_5 = dot(_432, _432);
+        highp vec2 _489 = _444 - (_432 * clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        highp vec2 param_6 = _424;
+        highp vec2 param_7 = _432;
+        highp float _495 = det2(param_6, param_7);
+        highp vec2 param_8 = _436;
+        highp vec2 param_9 = _424;
+        highp vec2 param_10 = _440;
+        highp vec2 param_11 = _428;
+        highp vec2 param_12 = _444;
+        highp vec2 param_13 = _432;
+        highp vec2 _531 = min(min(vec2(dot(_459, _459), _495 * det2(param_8, param_9)), vec2(dot(_474, _474), _495 * det2(param_10, param_11))), vec2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    highp float sdf_stroke(highp float d)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    highp vec4 sdf(highp vec4 a, highp vec4 b, highp float d)
+    {
+        highp float param = d;
+        highp vec4 _292 = mix(b, a, vec4(smoothstep(0.0, v_aa, sdf_stroke(param))));
+        bvec4 _316 = bvec4(clamp(d, -1.0, 1.0) <= 0.0);
+        highp vec4 _324 = vec4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(vec4(_316.x ? b.x : a.x, _316.y ? b.y : a.y, _316.z ? b.z : a.z, _316.w ? b.w : a.w), mix(b, a, vec4(smoothstep(0.0, v_aa, d))), _324), vec4(v_fill));
+        return result;
+    }
+    
+    highp vec4 shader(highp vec4 color, highp vec2 pos, highp vec2 atlas_uv, highp vec2 screen_uv, highp vec4 params)
+    {
+        return color;
+    }
+    
+    void main()
+    {
+        bool is_sprite = v_type >= 0.0 && v_type < 0.00196078442968428134918212890625;
+        bool is_text = v_type > 0.00196078442968428134918212890625 && v_type < 0.0058823530562222003936767578125;
+        bool is_box = v_type > 0.0058823530562222003936767578125 && v_type < 0.009803921915590763092041015625;
+        bool is_seg = v_type > 0.009803921915590763092041015625 && v_type < 0.013725490309298038482666015625;
+        bool is_tri = v_type > 0.013725490309298038482666015625 && v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125 && v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125 && v_type < 0.0254901959002017974853515625;
+        highp vec2 texel_pos = v_uv * fs_params[0].xy;
+        highp float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+        highp vec4 c = de_gamma(texture(u_image, smooth_uv(v_uv, fs_params[0].xy)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, v_col));
+        }
+        if (is_text)
+        {
+            c = v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            highp vec2 texel = v_uv * fs_params[0].xy - vec2(0.5);
+            highp vec2 base = floor(texel);
+            highp vec2 f = texel - base;
+            highp vec2 uv0 = (base + vec2(0.5)) / fs_params[0].xy;
+            highp vec2 uv1 = (base + vec2(1.5)) / fs_params[0].xy;
+            highp float sd = mix(mix(textureLod(u_image, uv0, 0.0).w, textureLod(u_image, vec2(uv1.x, uv0.y), 0.0).w, f.x), mix(textureLod(u_image, vec2(uv0.x, uv1.y), 0.0).w, textureLod(u_image, uv1, 0.0).w, f.x), f.y);
+            c = v_col * clamp((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5, 0.0, 1.0);
+        }
+        if (is_tri)
+        {
+            c = v_col;
+        }
+        highp float d = 0.0;
+        if (is_box)
+        {
+            highp vec2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, v_col, d - v_radius);
+        }
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + vec2(1.0)) * 0.5, v_user);
+        if (c.w == 0.0)
+        {
+            discard;
+        }
+        result = c;
+    }
+    
+*/
+static const char sprite_instanced_fs_source_glsl300es[7432] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x3b,
+    0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,
+    0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x69,0x6e,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x69,0x6e,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x63,0x3b,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,
+    0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x0a,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,
+    0x5f,0x75,0x76,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x30,
+    0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x28,0x2d,0x5f,0x32,0x30,0x35,0x29,0x29,
+    0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x77,
+    0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,
+    0x33,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,
+    0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,
+    0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,
+    0x3d,0x20,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x28,0x31,0x2e,
+    0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,
+    0x30,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x33,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,
+    0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x61,0x73,0x65,0x2c,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,
+    0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,0x34,0x36,0x38,
+    0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,0x38,0x37,0x35,
+    0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x76,0x2e,
+    0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x5f,0x61,0x61,0x62,0x62,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x70,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x68,
+    0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x70,
+    0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x6d,0x61,0x78,0x28,0x5f,0x33,
+    0x34,0x39,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x20,
+    0x2b,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2e,0x78,
+    0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x69,0x6e,0x6f,
+    0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,0x2c,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x2d,0x3d,
+    0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,0x61,0x6e,
+    0x73,0x70,0x6f,0x73,0x65,0x28,0x6d,0x61,0x74,0x32,0x28,0x75,0x2c,0x20,0x73,0x6b,
+    0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x70,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,
+    0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x2c,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
+    0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,0x3d,0x3d,
+    0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,
+    0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x36,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x34,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x33,0x39,0x20,0x3d,
+    0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,
+    0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,0x32,0x33,0x39,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x62,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,
+    0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,0x20,
+    0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x61,0x2e,0x78,0x20,0x2a,0x20,0x62,0x2e,0x79,0x20,0x2b,0x20,0x28,0x2d,0x28,
+    0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x62,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,0x20,
+    0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,
+    0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x34,0x30,0x20,
+    0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,
+    0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,
+    0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,
+    0x5f,0x34,0x33,0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,
+    0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,0x28,0x5f,
+    0x34,0x32,0x38,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,
+    0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,
+    0x32,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x38,0x39,0x20,0x3d,0x20,
+    0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,0x33,0x32,0x20,0x2a,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,0x20,
+    0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
+    0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,
+    0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,
+    0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,
+    0x3d,0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,
+    0x3d,0x20,0x5f,0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,
+    0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x28,0x6d,0x69,0x6e,0x28,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,0x34,0x29,
+    0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,
+    0x29,0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,
+    0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,0x71,0x72,0x74,0x28,
+    0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x28,
+    0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,
+    0x62,0x73,0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x73,0x64,0x66,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x61,
+    0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x2c,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,
+    0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,
+    0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x76,0x65,0x63,0x34,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x62,0x76,
+    0x65,0x63,0x34,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x6d,0x69,0x78,
+    0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,
+    0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,0x63,0x34,
+    0x28,0x5f,0x33,0x31,0x36,0x2e,0x78,0x20,0x3f,0x20,0x62,0x2e,0x78,0x20,0x3a,0x20,
+    0x61,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x79,0x20,0x3f,0x20,0x62,0x2e,
+    0x79,0x20,0x3a,0x20,0x61,0x2e,0x79,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x7a,0x20,
+    0x3f,0x20,0x62,0x2e,0x7a,0x20,0x3a,0x20,0x61,0x2e,0x7a,0x2c,0x20,0x5f,0x33,0x31,
+    0x36,0x2e,0x77,0x20,0x3f,0x20,0x62,0x2e,0x77,0x20,0x3a,0x20,0x61,0x2e,0x77,0x29,
+    0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,
+    0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,
+    0x34,0x29,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,
+    0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x2c,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,0x76,
+    0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x63,0x72,
+    0x65,0x65,0x6e,0x5f,0x75,0x76,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
+    0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,
+    0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,
+    0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,
+    0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,
+    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,
+    0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,
+    0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,
+    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,
+    0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,
+    0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,
+    0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,
+    0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,
+    0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,
+    0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,
+    0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,
+    0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,
+    0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,
+    0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x20,
+    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,
+    0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,
+    0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,
+    0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x78,0x28,
+    0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x79,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,
+    0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x76,
+    0x5f,0x75,0x76,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x78,0x79,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,
+    0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,
+    0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,
+    0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x31,
+    0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,
+    0x20,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x75,0x76,
+    0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x64,0x20,
+    0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,
+    0x31,0x37,0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,
+    0x31,0x31,0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,0x61,
+    0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,0x2c,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,
+    0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,
+    0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,
+    0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,
+    0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,
+    0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x69,0x73,
+    0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,
+    0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,
+    0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,
+    0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,
+    0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,
+    0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    static float4 gl_Position;
+    static float2 v_pos;
+    static float2 v_a;
+    static float2 v_b;
+    static float2 v_c;
+    static float2 v_uv;
+    static float4 v_col;
+    static float v_radius;
+    static float v_stroke;
+    static float v_aa;
+    static float v_type;
+    static float v_alpha;
+    static float v_fill;
+    static float2 v_posH;
+    static float4 v_user;
+    static float4 in_corner;
+    static float4 in_pos_ab;
+    static float4 in_pos_cd;
+    static float4 in_posH_ab;
+    static float4 in_posH_cd;
+    static float4 in_ab;
+    static float2 in_c;
+    static float4 in_uv_rect;
+    static float4 in_col;
+    static float3 in_shape;
+    static float4 in_params;
+    static float4 in_user_params;
+    static float in_depth;
+    
+    struct SPIRV_Cross_Input
+    {
+        float4 in_corner : TEXCOORD0;
+        float4 in_pos_ab : TEXCOORD1;
+        float4 in_pos_cd : TEXCOORD2;
+        float4 in_posH_ab : TEXCOORD3;
+        float4 in_posH_cd : TEXCOORD4;
+        float4 in_ab : TEXCOORD5;
+        float2 in_c : TEXCOORD6;
+        float4 in_uv_rect : TEXCOORD7;
+        float4 in_col : TEXCOORD8;
+        float3 in_shape : TEXCOORD9;
+        float4 in_params : TEXCOORD10;
+        float4 in_user_params : TEXCOORD11;
+        float in_depth : TEXCOORD12;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float2 v_pos : TEXCOORD0;
+        float2 v_a : TEXCOORD1;
+        float2 v_b : TEXCOORD2;
+        float2 v_c : TEXCOORD3;
+        float2 v_uv : TEXCOORD4;
+        float4 v_col : TEXCOORD5;
+        float v_radius : TEXCOORD6;
+        float v_stroke : TEXCOORD7;
+        float v_aa : TEXCOORD8;
+        float v_type : TEXCOORD9;
+        float v_alpha : TEXCOORD10;
+        float v_fill : TEXCOORD11;
+        float2 v_posH : TEXCOORD12;
+        float4 v_user : TEXCOORD13;
+        float4 gl_Position : SV_Position;
+    };
+    
+    void vert_main()
+    {
+        float2 _pos = (((in_pos_ab.xy * in_corner.x) + (in_pos_ab.zw * in_corner.y)) + (in_pos_cd.xy * in_corner.z)) + (in_pos_cd.zw * in_corner.w);
+        float2 _posH = (((in_posH_ab.xy * in_corner.x) + (in_posH_ab.zw * in_corner.y)) + (in_posH_cd.xy * in_corner.z)) + (in_posH_cd.zw * in_corner.w);
+        v_pos = _pos;
+        v_a = in_ab.xy;
+        v_b = in_ab.zw;
+        v_c = in_c;
+        v_uv = lerp(in_uv_rect.xy, in_uv_rect.zw, float2(in_corner.y + in_corner.z, in_corner.x + in_corner.y));
+        v_col = in_col;
+        v_radius = in_shape.x;
+        v_stroke = in_shape.y;
+        v_aa = in_shape.z;
+        v_type = in_params.x;
+        v_alpha = in_params.y;
+        v_fill = in_params.z;
+        gl_Position = float4(_posH, in_depth, 1.0f);
+        v_posH = _posH;
+        v_user = in_user_params;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        in_corner = stage_input.in_corner;
+        in_pos_ab = stage_input.in_pos_ab;
+        in_pos_cd = stage_input.in_pos_cd;
+        in_posH_ab = stage_input.in_posH_ab;
+        in_posH_cd = stage_input.in_posH_cd;
+        in_ab = stage_input.in_ab;
+        in_c = stage_input.in_c;
+        in_uv_rect = stage_input.in_uv_rect;
+        in_col = stage_input.in_col;
+        in_shape = stage_input.in_shape;
+        in_params = stage_input.in_params;
+        in_user_params = stage_input.in_user_params;
+        in_depth = stage_input.in_depth;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_pos = v_pos;
+        stage_output.v_a = v_a;
+        stage_output.v_b = v_b;
+        stage_output.v_c = v_c;
+        stage_output.v_uv = v_uv;
+        stage_output.v_col = v_col;
+        stage_output.v_radius = v_radius;
+        stage_output.v_stroke = v_stroke;
+        stage_output.v_aa = v_aa;
+        stage_output.v_type = v_type;
+        stage_output.v_alpha = v_alpha;
+        stage_output.v_fill = v_fill;
+        stage_output.v_posH = v_posH;
+        stage_output.v_user = v_user;
+        return stage_output;
+    }
+*/
+static const char sprite_instanced_vs_source_hlsl5[3507] = {
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,
+    0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x76,0x5f,0x62,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,
+    0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,
+    0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,
+    0x61,0x62,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x61,
+    0x62,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,
+    0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x73,0x74,
+    0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,
+    0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,
+    0x48,0x5f,0x61,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x69,0x6e,0x5f,0x61,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,
+    0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,
+    0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x38,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,0x5f,
+    0x73,0x68,0x61,0x70,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x31,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x32,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,
+    0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x78,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,
+    0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,
+    0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,
+    0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,
+    0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,
+    0x48,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x5f,0x70,0x6f,
+    0x73,0x48,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x5f,0x63,0x6f,
+    0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x78,0x79,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x7a,
+    0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x6c,0x65,
+    0x72,0x70,0x28,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,
+    0x2c,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,
+    0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x7a,0x2c,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x20,0x2b,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,
+    0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,
+    0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,
+    0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,
+    0x3d,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
+    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,
+    0x61,0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,
+    0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x63,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x61,0x62,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,
+    0x61,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x63,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,
+    0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x75,0x73,
+    0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x64,
+    0x65,0x70,0x74,0x68,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x3d,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x61,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x76,0x5f,
+    0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x76,0x5f,0x72,
+    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x20,0x3d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x61,0x61,0x20,0x3d,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x76,
+    0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x00,
+};
+/*
+    cbuffer fs_params : register(b0)
+    {
+        float2 _619_u_texture_size : packoffset(c0);
+    };
+    
+    Texture2D<float4> u_image : register(t0);
+    SamplerState _u_image_sampler : register(s0);
+    
+    static float v_stroke;
+    static float v_aa;
+    static float4 result;
+    static float v_fill;
+    static float v_type;
+    static float2 v_uv;
+    static float4 v_col;
+    static float2 v_pos;
+    static float2 v_a;
+    static float2 v_b;
+    static float2 v_c;
+    static float v_radius;
+    static float v_alpha;
+    static float2 v_posH;
+    static float4 v_user;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 v_pos : TEXCOORD0;
+        float2 v_a : TEXCOORD1;
+        float2 v_b : TEXCOORD2;
+        float2 v_c : TEXCOORD3;
+        float2 v_uv : TEXCOORD4;
+        float4 v_col : TEXCOORD5;
+        float v_radius : TEXCOORD6;
+        float v_stroke : TEXCOORD7;
+        float v_aa : TEXCOORD8;
+        float v_type : TEXCOORD9;
+        float v_alpha : TEXCOORD10;
+        float v_fill : TEXCOORD11;
+        float2 v_posH : TEXCOORD12;
+        float4 v_user : TEXCOORD13;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float4 result : SV_Target0;
+    };
+    
+    float2 smooth_uv(float2 uv, float2 texture_size)
+    {
+        float2 _205 = floor(mad(uv, texture_size, 0.5f.xx));
+        return (_205 + clamp(mad(uv, texture_size, -_205) / fwidth(uv * texture_size), (-0.5f).xx, 0.5f.xx)) / texture_size;
+    }
+    
+    float4 de_gamma(float4 c)
+    {
+        return float4(pow(abs(c.xyz), 2.2000000476837158203125f.xxx), c.w);
+    }
+    
+    float overlay(float base, float blend)
+    {
+        float _105;
+        if (base <= 0.5f)
+        {
+            _105 = (2.0f * base) * blend;
+        }
+        else
+        {
+            _105 = mad((1.0f - base) * (-2.0f), 1.0f - blend, 1.0f);
+        }
+        return _105;
+    }
+    
+    float3 overlay(float3 base, float3 blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    float4 overlay(float4 base, float4 blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    float4 gamma(float4 c)
+    {
+        return float4(pow(abs(c.xyz), 0.4545454680919647216796875f.xxx), c.w);
+    }
+    
+    float2 skew(float2 v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    float distance_aabb(float2 p, float2 he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(max(_349, 0.0f.xx)) + min(max(_349.x, _349.y), 0.0f);
+    }
+    
+    float distance_box(inout float2 p, float2 c, float2 he, float2 u)
+    {
+        float2 param = u;
+        p -= c;
+        p = mul(p, transpose(float2x2(u, skew(param))));
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    float safe_div(float a, float b)
+    {
+        float _226;
+        if (b == 0.0f)
+        {
+            _226 = 0.0f;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    float safe_len(float2 v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0f)
+        {
+            _242 = 0.0f;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    float distance_segment(float2 p, float2 a, float2 b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * clamp(safe_div(param, param_1), 0.0f, 1.0f));
+        return safe_len(param_2);
+    }
+    
+    float det2(float2 a, float2 b)
+    {
+        return mad(a.x, b.y, -(a.y * b.x));
+    }
+    
+    float distance_triangle(float2 p, float2 a, float2 b, float2 c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * clamp(safe_div(param, param_1), 0.0f, 1.0f));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * clamp(safe_div(param_2, param_3), 0.0f, 1.0f));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * clamp(safe_div(param_4, param_5), 0.0f, 1.0f));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = min(min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    float sdf_stroke(float d)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    float4 sdf(float4 a, float4 b, float d)
+    {
+        float param = d;
+        float4 _292 = lerp(b, a, smoothstep(0.0f, v_aa, sdf_stroke(param)).xxxx);
+        bool4 _316 = (clamp(d, -1.0f, 1.0f) <= 0.0f).xxxx;
+        float4 _324 = float(v_aa > 0.0f).xxxx;
+        result = lerp(lerp(_292, _292, _324), lerp(float4(_316.x ? b.x : a.x, _316.y ? b.y : a.y, _316.z ? b.z : a.z, _316.w ? b.w : a.w), lerp(b, a, smoothstep(0.0f, v_aa, d).xxxx), _324), v_fill.xxxx);
+        return result;
+    }
+    
+    float4 shader(float4 color, float2 pos, float2 atlas_uv, float2 screen_uv, float4 params)
+    {
+        return color;
+    }
+    
+    void frag_main()
+    {
+        bool is_sprite = v_type >= 0.0f && v_type < 0.00196078442968428134918212890625f;
+        bool is_text = v_type > 0.00196078442968428134918212890625f && v_type < 0.0058823530562222003936767578125f;
+        bool is_box = v_type > 0.0058823530562222003936767578125f && v_type < 0.009803921915590763092041015625f;
+        bool is_seg = v_type > 0.009803921915590763092041015625f && v_type < 0.013725490309298038482666015625f;
+        bool is_tri = v_type > 0.013725490309298038482666015625f && v_type < 0.01764705963432788848876953125f;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125f && v_type < 0.02156862802803516387939453125f;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125f && v_type < 0.0254901959002017974853515625f;
+        float2 texel_pos = v_uv * _619_u_texture_size;
+        float texels_per_pixel = 0.5f * (length(ddx(texel_pos)) + length(ddy(texel_pos)));
+        float4 c = de_gamma(u_image.Sample(_u_image_sampler, smooth_uv(v_uv, _619_u_texture_size)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, v_col));
+        }
+        if (is_text)
+        {
+            c = v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = v_uv * _619_u_texture_size - 0.5f.xx;
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + 0.5f.xx) / _619_u_texture_size;
+            float2 uv1 = (base + 1.5f.xx) / _619_u_texture_size;
+            float sd = lerp(lerp(u_image.SampleLevel(_u_image_sampler, uv0, 0.0f).w, u_image.SampleLevel(_u_image_sampler, float2(uv1.x, uv0.y), 0.0f).w, f.x), lerp(u_image.SampleLevel(_u_image_sampler, float2(uv0.x, uv1.y), 0.0f).w, u_image.SampleLevel(_u_image_sampler, uv1, 0.0f).w, f.x), f.y);
+            c = v_col * saturate((sd - 0.501960813999176025390625f) * 11.953125f / texels_per_pixel + 0.5f);
+        }
+        if (is_tri)
+        {
+            c = v_col;
+        }
+        float d = 0.0f;
+        if (is_box)
+        {
+            float2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, v_col, d - v_radius);
+        }
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + 1.0f.xx) * 0.5f, v_user);
+        if (c.w == 0.0f)
+        {
+            discard;
+        }
+        result = c;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_stroke = stage_input.v_stroke;
+        v_aa = stage_input.v_aa;
+        v_fill = stage_input.v_fill;
+        v_type = stage_input.v_type;
+        v_uv = stage_input.v_uv;
+        v_col = stage_input.v_col;
+        v_pos = stage_input.v_pos;
+        v_a = stage_input.v_a;
+        v_b = stage_input.v_b;
+        v_c = stage_input.v_c;
+        v_radius = stage_input.v_radius;
+        v_alpha = stage_input.v_alpha;
+        v_posH = stage_input.v_posH;
+        v_user = stage_input.v_user;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.result = result;
+        return stage_output;
+    }
+*/
+static const char sprite_instanced_fs_source_hlsl5[8210] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x36,
+    0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,
+    0x44,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,
+    0x3b,0x0a,0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x38,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x39,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x33,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3a,
+    0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,
+    0x76,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x6d,0x61,0x64,0x28,
+    0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x2c,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,0x61,0x64,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,
+    0x28,0x2d,0x30,0x2e,0x35,0x66,0x29,0x2e,0x78,0x78,0x2c,0x20,0x30,0x2e,0x35,0x66,
+    0x2e,0x78,0x78,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,
+    0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x66,
+    0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,
+    0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,
+    0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x6d,
+    0x61,0x64,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,
+    0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x66,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,
+    0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,
+    0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x61,0x73,0x65,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,
+    0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,
+    0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,
+    0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x66,0x2e,0x78,0x78,0x78,
+    0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,
+    0x3d,0x20,0x61,0x62,0x73,0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,
+    0x28,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2e,
+    0x78,0x78,0x29,0x29,0x20,0x2b,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x61,0x78,0x28,0x5f,
+    0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x69,0x6e,0x6f,
+    0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x68,0x65,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x2d,0x3d,0x20,0x63,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,0x70,0x2c,0x20,0x74,
+    0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x78,
+    0x32,0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,
+    0x64,0x69,0x76,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x62,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x32,0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x76,0x2c,0x20,0x76,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x34,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x33,0x39,0x20,0x3d,
+    0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
+    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,0x32,0x33,0x39,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x33,0x39,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,
+    0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,
+    0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
+    0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,
+    0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,
+    0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6d,0x61,0x64,
+    0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,0x2e,0x79,0x2c,0x20,0x2d,0x28,0x61,0x2e,0x79,
+    0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
+    0x6e,0x67,0x6c,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x62,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,
+    0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,
+    0x20,0x3d,0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,
+    0x34,0x30,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,
+    0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,
+    0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,
+    0x5f,0x34,0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,
+    0x34,0x33,0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,
+    0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,0x28,
+    0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,
+    0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,
+    0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x38,0x39,
+    0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,0x33,0x32,0x20,
+    0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,
+    0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,
+    0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,
+    0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x69,0x6e,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x35,0x39,
+    0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,
+    0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,0x34,0x29,0x2c,
+    0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x29,
+    0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,0x71,0x72,0x74,
+    0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,
+    0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x61,0x62,0x73,0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x73,0x64,0x66,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x61,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,
+    0x62,0x2c,0x20,0x61,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,
+    0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x2e,
+    0x78,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x34,
+    0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,
+    0x2c,0x20,0x2d,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x20,0x3c,
+    0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,0x30,
+    0x66,0x29,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x6c,0x65,0x72,0x70,0x28,
+    0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,
+    0x29,0x2c,0x20,0x6c,0x65,0x72,0x70,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,
+    0x33,0x31,0x36,0x2e,0x78,0x20,0x3f,0x20,0x62,0x2e,0x78,0x20,0x3a,0x20,0x61,0x2e,
+    0x78,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x79,0x20,0x3f,0x20,0x62,0x2e,0x79,0x20,
+    0x3a,0x20,0x61,0x2e,0x79,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x7a,0x20,0x3f,0x20,
+    0x62,0x2e,0x7a,0x20,0x3a,0x20,0x61,0x2e,0x7a,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,
+    0x77,0x20,0x3f,0x20,0x62,0x2e,0x77,0x20,0x3a,0x20,0x61,0x2e,0x77,0x29,0x2c,0x20,
+    0x6c,0x65,0x72,0x70,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,
+    0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x76,0x5f,0x61,0x61,
+    0x2c,0x20,0x64,0x29,0x2e,0x78,0x78,0x78,0x78,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,
+    0x29,0x2c,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x2e,0x78,0x78,0x78,0x78,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,
+    0x61,0x64,0x65,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,0x73,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,0x76,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,
+    0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x3d,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x66,0x20,0x26,
+    0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,
+    0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,
+    0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,
+    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,
+    0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x66,0x20,
+    0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,
+    0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,
+    0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,
+    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,
+    0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,
+    0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,
+    0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,
+    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,
+    0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,
+    0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,
+    0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,
+    0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,
+    0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,
+    0x35,0x36,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,
+    0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,
+    0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,
+    0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,
+    0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,
+    0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
+    0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,
+    0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,
+    0x78,0x74,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,
+    0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,
+    0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
+    0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,
+    0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,
+    0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,
+    0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x30,0x2e,0x35,0x66,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x2b,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x64,0x79,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x76,0x5f,0x75,
+    0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+    0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,
+    0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,
+    0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,
+    0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x5f,
+    0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x31,0x2e,0x35,
+    0x66,0x2e,0x78,0x78,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,0x20,
+    0x6c,0x65,0x72,0x70,0x28,0x6c,0x65,0x72,0x70,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x75,0x76,0x30,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,
+    0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,
+    0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,
+    0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6c,0x65,0x72,0x70,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,
+    0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,
+    0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,
+    0x77,0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,
+    0x28,0x73,0x64,0x20,0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,
+    0x33,0x39,0x39,0x39,0x31,0x37,0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,
+    0x66,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x66,0x20,
+    0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,
+    0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
+    0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,
+    0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,
+    0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,
+    0x2c,0x20,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,
+    0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,
+    0x2c,0x20,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,
+    0x2e,0x78,0x78,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x2c,0x20,0x76,0x5f,0x75,
+    0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,
+    0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
+    0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
+    0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x72,0x65,
+    0x73,0x75,0x6c,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct main0_out
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float4 in_corner [[attribute(0)]];
+        float4 in_pos_ab [[attribute(1)]];
+        float4 in_pos_cd [[attribute(2)]];
+        float4 in_posH_ab [[attribute(3)]];
+        float4 in_posH_cd [[attribute(4)]];
+        float4 in_ab [[attribute(5)]];
+        float2 in_c [[attribute(6)]];
+        float4 in_uv_rect [[attribute(7)]];
+        float4 in_col [[attribute(8)]];
+        float3 in_shape [[attribute(9)]];
+        float4 in_params [[attribute(10)]];
+        float4 in_user_params [[attribute(11)]];
+        float in_depth [[attribute(12)]];
+    };
+    
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        float2 _pos = (((in.in_pos_ab.xy * in.in_corner.x) + (in.in_pos_ab.zw * in.in_corner.y)) + (in.in_pos_cd.xy * in.in_corner.z)) + (in.in_pos_cd.zw * in.in_corner.w);
+        float2 _posH = (((in.in_posH_ab.xy * in.in_corner.x) + (in.in_posH_ab.zw * in.in_corner.y)) + (in.in_posH_cd.xy * in.in_corner.z)) + (in.in_posH_cd.zw * in.in_corner.w);
+        out.v_pos = _pos;
+        out.v_a = in.in_ab.xy;
+        out.v_b = in.in_ab.zw;
+        out.v_c = in.in_c;
+        out.v_uv = mix(in.in_uv_rect.xy, in.in_uv_rect.zw, float2(in.in_corner.y + in.in_corner.z, in.in_corner.x + in.in_corner.y));
+        out.v_col = in.in_col;
+        out.v_radius = in.in_shape.x;
+        out.v_stroke = in.in_shape.y;
+        out.v_aa = in.in_shape.z;
+        out.v_type = in.in_params.x;
+        out.v_alpha = in.in_params.y;
+        out.v_fill = in.in_params.z;
+        out.gl_Position = float4(_posH, in.in_depth, 1.0);
+        out.v_posH = _posH;
+        out.v_user = in.in_user_params;
+        return out;
+    }
+    
+*/
+static const char sprite_instanced_vs_source_metal_macos[2142] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,
+    0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x32,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x63,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x20,0x5b,
+    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x48,0x5f,0x63,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x61,0x62,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x63,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x39,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,
+    0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,
+    0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,
+    0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,
+    0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x78,0x79,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,
+    0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x20,0x2b,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x7a,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x78,0x20,0x2b,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,
+    0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,
+    0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,
+    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float2 smooth_uv(thread const float2& uv, thread const float2& texture_size)
+    {
+        float2 _205 = floor(fma(uv, texture_size, float2(0.5)));
+        return (_205 + fast::clamp(fma(uv, texture_size, -_205) / fwidth(uv * texture_size), float2(-0.5), float2(0.5))) / texture_size;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 de_gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(2.2000000476837158203125)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(0.4545454680919647216796875)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 skew(thread const float2& v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_aabb(thread const float2& p, thread const float2& he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(fast::max(_349, float2(0.0))) + fast::min(fast::max(_349.x, _349.y), 0.0);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_box(thread float2& p, thread const float2& c, thread const float2& he, thread const float2& u)
+    {
+        float2 param = u;
+        p -= c;
+        p = transpose(float2x2(u, skew(param))) * p;
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_div(thread const float& a, thread const float& b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_len(thread const float2& v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_segment(thread const float2& p, thread const float2& a, thread const float2& b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float det2(thread const float2& a, thread const float2& b)
+    {
+        return fma(a.x, b.y, -(a.y * b.x));
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_triangle(thread const float2& p, thread const float2& a, thread const float2& b, thread const float2& c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * fast::clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * fast::clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = fast::min(fast::min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    static inline __attribute__((always_inline))
+    float sdf_stroke(thread const float& d, thread float& v_stroke)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 sdf(thread const float4& a, thread const float4& b, thread const float& d, thread float& v_stroke, thread float& v_aa, thread float4& result, thread float& v_fill)
+    {
+        float param = d;
+        float4 _292 = mix(b, a, float4(smoothstep(0.0, v_aa, sdf_stroke(param, v_stroke))));
+        float4 _324 = float4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(select(a, b, bool4(fast::clamp(d, -1.0, 1.0) <= 0.0)), mix(b, a, float4(smoothstep(0.0, v_aa, d))), _324), float4(v_fill));
+        return result;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 shader(thread const float4& color, thread const float2& pos, thread const float2& atlas_uv, thread const float2& screen_uv, thread const float4& params)
+    {
+        return color;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, in.v_col));
+        }
+        if (is_text)
+        {
+            c = in.v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
+        }
+        if (is_tri)
+        {
+            c = in.v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
+        }
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
+        {
+            discard_fragment();
+        }
+        out.result = c;
+        return out;
+    }
+    
+*/
+static const char sprite_instanced_fs_source_metal_macos[9058] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,
+    0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,
+    0x72,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,
+    0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,
+    0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,
+    0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,
+    0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,
+    0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,
+    0x2e,0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,
+    0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,
+    0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,
+    0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,
+    0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,
+    0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,
+    0x35,0x34,0x35,0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,
+    0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,
+    0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,
+    0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,
+    0x5f,0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x63,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x20,0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x78,0x32,0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,
+    0x61,0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,
+    0x65,0x5f,0x64,0x69,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,
+    0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,
+    0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x32,0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,
+    0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,
+    0x65,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x32,0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,
+    0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,
+    0x28,0x5f,0x32,0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,
+    0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,
+    0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,
+    0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,
+    0x33,0x39,0x38,0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x66,0x61,
+    0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,
+    0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,
+    0x2e,0x79,0x2c,0x20,0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,
+    0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x30,
+    0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,
+    0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,
+    0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,
+    0x20,0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,
+    0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,
+    0x28,0x5f,0x34,0x33,0x32,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
+    0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,
+    0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,
+    0x20,0x3d,0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,
+    0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,
+    0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,
+    0x5f,0x34,0x37,0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,
+    0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,
+    0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x28,0x2d,0x73,0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,
+    0x2a,0x20,0x73,0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x64,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,
+    0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,
+    0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x64,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,
+    0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,
+    0x32,0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,
+    0x6d,0x69,0x78,0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x61,0x2c,0x20,0x62,0x2c,
+    0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,
+    0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,
+    0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,
+    0x2c,0x20,0x64,0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x70,0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x74,0x6c,0x61,
+    0x73,0x5f,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x36,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,
+    0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,
+    0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,
+    0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,
+    0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,
+    0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,
+    0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,
+    0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,
+    0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,
+    0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,
+    0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,
+    0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,
+    0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,0x2e,0x76,0x5f,
+    0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
+    0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,
+    0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,
+    0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,
+    0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x6c,0x65,
+    0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x6c,
+    0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,
+    0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
+    0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,
+    0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,
+    0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,
+    0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,
+    0x6c,0x65,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,
+    0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,
+    0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct main0_out
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float4 in_corner [[attribute(0)]];
+        float4 in_pos_ab [[attribute(1)]];
+        float4 in_pos_cd [[attribute(2)]];
+        float4 in_posH_ab [[attribute(3)]];
+        float4 in_posH_cd [[attribute(4)]];
+        float4 in_ab [[attribute(5)]];
+        float2 in_c [[attribute(6)]];
+        float4 in_uv_rect [[attribute(7)]];
+        float4 in_col [[attribute(8)]];
+        float3 in_shape [[attribute(9)]];
+        float4 in_params [[attribute(10)]];
+        float4 in_user_params [[attribute(11)]];
+        float in_depth [[attribute(12)]];
+    };
+    
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        float2 _pos = (((in.in_pos_ab.xy * in.in_corner.x) + (in.in_pos_ab.zw * in.in_corner.y)) + (in.in_pos_cd.xy * in.in_corner.z)) + (in.in_pos_cd.zw * in.in_corner.w);
+        float2 _posH = (((in.in_posH_ab.xy * in.in_corner.x) + (in.in_posH_ab.zw * in.in_corner.y)) + (in.in_posH_cd.xy * in.in_corner.z)) + (in.in_posH_cd.zw * in.in_corner.w);
+        out.v_pos = _pos;
+        out.v_a = in.in_ab.xy;
+        out.v_b = in.in_ab.zw;
+        out.v_c = in.in_c;
+        out.v_uv = mix(in.in_uv_rect.xy, in.in_uv_rect.zw, float2(in.in_corner.y + in.in_corner.z, in.in_corner.x + in.in_corner.y));
+        out.v_col = in.in_col;
+        out.v_radius = in.in_shape.x;
+        out.v_stroke = in.in_shape.y;
+        out.v_aa = in.in_shape.z;
+        out.v_type = in.in_params.x;
+        out.v_alpha = in.in_params.y;
+        out.v_fill = in.in_params.z;
+        out.gl_Position = float4(_posH, in.in_depth, 1.0);
+        out.v_posH = _posH;
+        out.v_user = in.in_user_params;
+        return out;
+    }
+    
+*/
+static const char sprite_instanced_vs_source_metal_ios[2142] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,
+    0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x32,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x63,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x20,0x5b,
+    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x48,0x5f,0x63,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x61,0x62,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x63,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x39,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,
+    0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,
+    0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,
+    0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,
+    0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x78,0x79,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,
+    0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x20,0x2b,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x7a,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x78,0x20,0x2b,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,
+    0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,
+    0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,
+    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float2 smooth_uv(thread const float2& uv, thread const float2& texture_size)
+    {
+        float2 _205 = floor(fma(uv, texture_size, float2(0.5)));
+        return (_205 + fast::clamp(fma(uv, texture_size, -_205) / fwidth(uv * texture_size), float2(-0.5), float2(0.5))) / texture_size;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 de_gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(2.2000000476837158203125)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(0.4545454680919647216796875)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 skew(thread const float2& v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_aabb(thread const float2& p, thread const float2& he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(fast::max(_349, float2(0.0))) + fast::min(fast::max(_349.x, _349.y), 0.0);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_box(thread float2& p, thread const float2& c, thread const float2& he, thread const float2& u)
+    {
+        float2 param = u;
+        p -= c;
+        p = transpose(float2x2(u, skew(param))) * p;
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_div(thread const float& a, thread const float& b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_len(thread const float2& v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_segment(thread const float2& p, thread const float2& a, thread const float2& b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float det2(thread const float2& a, thread const float2& b)
+    {
+        return fma(a.x, b.y, -(a.y * b.x));
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_triangle(thread const float2& p, thread const float2& a, thread const float2& b, thread const float2& c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * fast::clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * fast::clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = fast::min(fast::min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    static inline __attribute__((always_inline))
+    float sdf_stroke(thread const float& d, thread float& v_stroke)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 sdf(thread const float4& a, thread const float4& b, thread const float& d, thread float& v_stroke, thread float& v_aa, thread float4& result, thread float& v_fill)
+    {
+        float param = d;
+        float4 _292 = mix(b, a, float4(smoothstep(0.0, v_aa, sdf_stroke(param, v_stroke))));
+        float4 _324 = float4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(select(a, b, bool4(fast::clamp(d, -1.0, 1.0) <= 0.0)), mix(b, a, float4(smoothstep(0.0, v_aa, d))), _324), float4(v_fill));
+        return result;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 shader(thread const float4& color, thread const float2& pos, thread const float2& atlas_uv, thread const float2& screen_uv, thread const float4& params)
+    {
+        return color;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, in.v_col));
+        }
+        if (is_text)
+        {
+            c = in.v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
+        }
+        if (is_tri)
+        {
+            c = in.v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
+        }
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
+        {
+            discard_fragment();
+        }
+        out.result = c;
+        return out;
+    }
+    
+*/
+static const char sprite_instanced_fs_source_metal_ios[9058] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,
+    0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,
+    0x72,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,
+    0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,
+    0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,
+    0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,
+    0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,
+    0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,
+    0x2e,0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,
+    0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,
+    0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,
+    0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,
+    0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,
+    0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,
+    0x35,0x34,0x35,0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,
+    0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,
+    0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,
+    0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,
+    0x5f,0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x63,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x20,0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x78,0x32,0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,
+    0x61,0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,
+    0x65,0x5f,0x64,0x69,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,
+    0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,
+    0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x32,0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,
+    0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,
+    0x65,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x32,0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,
+    0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,
+    0x28,0x5f,0x32,0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,
+    0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,
+    0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,
+    0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,
+    0x33,0x39,0x38,0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x66,0x61,
+    0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,
+    0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,
+    0x2e,0x79,0x2c,0x20,0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,
+    0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x30,
+    0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,
+    0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,
+    0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,
+    0x20,0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,
+    0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,
+    0x28,0x5f,0x34,0x33,0x32,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
+    0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,
+    0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,
+    0x20,0x3d,0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,
+    0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,
+    0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,
+    0x5f,0x34,0x37,0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,
+    0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,
+    0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x28,0x2d,0x73,0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,
+    0x2a,0x20,0x73,0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x64,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,
+    0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,
+    0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x64,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,
+    0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,
+    0x32,0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,
+    0x6d,0x69,0x78,0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x61,0x2c,0x20,0x62,0x2c,
+    0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,
+    0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,
+    0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,
+    0x2c,0x20,0x64,0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x70,0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x74,0x6c,0x61,
+    0x73,0x5f,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x36,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,
+    0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,
+    0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,
+    0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,
+    0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,
+    0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,
+    0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,
+    0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,
+    0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,
+    0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,
+    0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,
+    0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,
+    0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,0x2e,0x76,0x5f,
+    0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
+    0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,
+    0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,
+    0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,
+    0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x6c,0x65,
+    0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x6c,
+    0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,
+    0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
+    0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,
+    0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,
+    0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,
+    0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,
+    0x6c,0x65,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,
+    0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,
+    0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+/*
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct main0_out
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float4 in_corner [[attribute(0)]];
+        float4 in_pos_ab [[attribute(1)]];
+        float4 in_pos_cd [[attribute(2)]];
+        float4 in_posH_ab [[attribute(3)]];
+        float4 in_posH_cd [[attribute(4)]];
+        float4 in_ab [[attribute(5)]];
+        float2 in_c [[attribute(6)]];
+        float4 in_uv_rect [[attribute(7)]];
+        float4 in_col [[attribute(8)]];
+        float3 in_shape [[attribute(9)]];
+        float4 in_params [[attribute(10)]];
+        float4 in_user_params [[attribute(11)]];
+        float in_depth [[attribute(12)]];
+    };
+    
+    vertex main0_out main0(main0_in in [[stage_in]])
+    {
+        main0_out out = {};
+        float2 _pos = (((in.in_pos_ab.xy * in.in_corner.x) + (in.in_pos_ab.zw * in.in_corner.y)) + (in.in_pos_cd.xy * in.in_corner.z)) + (in.in_pos_cd.zw * in.in_corner.w);
+        float2 _posH = (((in.in_posH_ab.xy * in.in_corner.x) + (in.in_posH_ab.zw * in.in_corner.y)) + (in.in_posH_cd.xy * in.in_corner.z)) + (in.in_posH_cd.zw * in.in_corner.w);
+        out.v_pos = _pos;
+        out.v_a = in.in_ab.xy;
+        out.v_b = in.in_ab.zw;
+        out.v_c = in.in_c;
+        out.v_uv = mix(in.in_uv_rect.xy, in.in_uv_rect.zw, float2(in.in_corner.y + in.in_corner.z, in.in_corner.x + in.in_corner.y));
+        out.v_col = in.in_col;
+        out.v_radius = in.in_shape.x;
+        out.v_stroke = in.in_shape.y;
+        out.v_aa = in.in_shape.z;
+        out.v_type = in.in_params.x;
+        out.v_alpha = in.in_params.y;
+        out.v_fill = in.in_params.z;
+        out.gl_Position = float4(_posH, in.in_depth, 1.0);
+        out.v_posH = _posH;
+        out.v_user = in.in_user_params;
+        return out;
+    }
+    
+*/
+static const char sprite_instanced_vs_source_metal_sim[2142] = {
+    0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
+    0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+    0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
+    0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,
+    0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,
+    0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,
+    0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,
+    0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x5b,0x5b,0x75,0x73,
+    0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x32,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,
+    0x5b,0x5b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,
+    0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x63,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x20,0x5b,
+    0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x48,0x5f,0x63,0x64,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,
+    0x74,0x65,0x28,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x61,0x62,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x63,0x20,0x5b,0x5b,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x76,0x5f,0x72,
+    0x65,0x63,0x74,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x20,0x5b,0x5b,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x39,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x28,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,
+    0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x28,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,
+    0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,
+    0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,
+    0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x61,0x62,
+    0x2e,0x7a,0x77,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,
+    0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,
+    0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x5f,0x63,0x64,0x2e,0x78,0x79,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x29,0x29,0x20,0x2b,0x20,0x28,0x69,0x6e,0x2e,
+    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x5f,0x63,0x64,0x2e,0x7a,0x77,0x20,0x2a,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x77,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
+    0x20,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x78,0x79,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x62,0x2e,0x7a,0x77,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,
+    0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,
+    0x20,0x2b,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x7a,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,
+    0x78,0x20,0x2b,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x2e,0x79,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,
+    0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,
+    0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x68,0x61,0x70,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,
+    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float2 smooth_uv(thread const float2& uv, thread const float2& texture_size)
+    {
+        float2 _205 = floor(fma(uv, texture_size, float2(0.5)));
+        return (_205 + fast::clamp(fma(uv, texture_size, -_205) / fwidth(uv * texture_size), float2(-0.5), float2(0.5))) / texture_size;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 de_gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(2.2000000476837158203125)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(0.4545454680919647216796875)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 skew(thread const float2& v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_aabb(thread const float2& p, thread const float2& he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(fast::max(_349, float2(0.0))) + fast::min(fast::max(_349.x, _349.y), 0.0);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_box(thread float2& p, thread const float2& c, thread const float2& he, thread const float2& u)
+    {
+        float2 param = u;
+        p -= c;
+        p = transpose(float2x2(u, skew(param))) * p;
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_div(thread const float& a, thread const float& b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_len(thread const float2& v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_segment(thread const float2& p, thread const float2& a, thread const float2& b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float det2(thread const float2& a, thread const float2& b)
+    {
+        return fma(a.x, b.y, -(a.y * b.x));
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_triangle(thread const float2& p, thread const float2& a, thread const float2& b, thread const float2& c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * fast::clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * fast::clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = fast::min(fast::min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    static inline __attribute__((always_inline))
+    float sdf_stroke(thread const float& d, thread float& v_stroke)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 sdf(thread const float4& a, thread const float4& b, thread const float& d, thread float& v_stroke, thread float& v_aa, thread float4& result, thread float& v_fill)
+    {
+        float param = d;
+        float4 _292 = mix(b, a, float4(smoothstep(0.0, v_aa, sdf_stroke(param, v_stroke))));
+        float4 _324 = float4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(select(a, b, bool4(fast::clamp(d, -1.0, 1.0) <= 0.0)), mix(b, a, float4(smoothstep(0.0, v_aa, d))), _324), float4(v_fill));
+        return result;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 shader(thread const float4& color, thread const float2& pos, thread const float2& atlas_uv, thread const float2& screen_uv, thread const float4& params)
+    {
+        return color;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, in.v_col));
+        }
+        if (is_text)
+        {
+            c = in.v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
+        }
+        if (is_tri)
+        {
+            c = in.v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
+        }
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
+        {
+            discard_fragment();
+        }
+        out.result = c;
+        return out;
+    }
+    
+*/
+static const char sprite_instanced_fs_source_metal_sim[9058] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,
+    0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,0x6f,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x36,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,
+    0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,
+    0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,
+    0x72,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,
+    0x2e,0x35,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x63,0x6c,0x61,0x6d,0x70,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,
+    0x35,0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,
+    0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,
+    0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,
+    0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,
+    0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,
+    0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,
+    0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,
+    0x2e,0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,
+    0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,
+    0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,
+    0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,
+    0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,
+    0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,
+    0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,
+    0x35,0x34,0x35,0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,
+    0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,
+    0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,
+    0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,
+    0x5f,0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,
+    0x20,0x63,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x70,0x20,0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x78,0x32,0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,
+    0x61,0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,
+    0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,
+    0x65,0x5f,0x64,0x69,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,
+    0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,
+    0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x32,0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,
+    0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,
+    0x65,0x6e,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x5f,0x32,0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,
+    0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,
+    0x28,0x5f,0x32,0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,
+    0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,
+    0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,
+    0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,
+    0x33,0x39,0x38,0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x66,0x61,
+    0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,
+    0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,
+    0x2e,0x79,0x2c,0x20,0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,
+    0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x30,
+    0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,
+    0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,
+    0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,
+    0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,
+    0x20,0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,
+    0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,
+    0x28,0x5f,0x34,0x33,0x32,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,
+    0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
+    0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,
+    0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,
+    0x20,0x3d,0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,
+    0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,
+    0x20,0x3d,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,
+    0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,
+    0x5f,0x34,0x37,0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,
+    0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,
+    0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x28,0x2d,0x73,0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,
+    0x2a,0x20,0x73,0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x64,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,
+    0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,
+    0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x64,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,
+    0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,
+    0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,
+    0x32,0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,
+    0x6d,0x69,0x78,0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x61,0x2c,0x20,0x62,0x2c,
+    0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,
+    0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,
+    0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,
+    0x2c,0x20,0x64,0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,
+    0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,
+    0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,
+    0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x70,0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x74,0x6c,0x61,
+    0x73,0x5f,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,
+    0x6e,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,
+    0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x61,0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,
+    0x20,0x5f,0x36,0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,
+    0x29,0x5d,0x5d,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x3c,0x66,
+    0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x20,0x5b,0x5b,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,
+    0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
+    0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
+    0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,
+    0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,
+    0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,
+    0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,
+    0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,
+    0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,
+    0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,
+    0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,
+    0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,
+    0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,
+    0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,
+    0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,0x2e,0x76,0x5f,
+    0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
+    0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,
+    0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,
+    0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,
+    0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x6c,0x65,
+    0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x6c,
+    0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,
+    0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
+    0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,
+    0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,
+    0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,
+    0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,
+    0x6c,0x65,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,
+    0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,
+    0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
+};
+#if !defined(SOKOL_GFX_INCLUDED)
+  #error "Please include sokol_gfx.h before sprite_instanced_shader.h"
+#endif
+static inline const sg_shader_desc* sprite_instanced_shader_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "in_corner";
+      desc.attrs[1].name = "in_pos_ab";
+      desc.attrs[2].name = "in_pos_cd";
+      desc.attrs[3].name = "in_posH_ab";
+      desc.attrs[4].name = "in_posH_cd";
+      desc.attrs[5].name = "in_ab";
+      desc.attrs[6].name = "in_c";
+      desc.attrs[7].name = "in_uv_rect";
+      desc.attrs[8].name = "in_col";
+      desc.attrs[9].name = "in_shape";
+      desc.attrs[10].name = "in_params";
+      desc.attrs[11].name = "in_user_params";
+      desc.attrs[12].name = "in_depth";
+      desc.vs.source = sprite_instanced_vs_source_glsl330;
+      desc.vs.entry = "main";
+      desc.fs.source = sprite_instanced_fs_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 1;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_instanced_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_GLES3) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "in_corner";
+      desc.attrs[1].name = "in_pos_ab";
+      desc.attrs[2].name = "in_pos_cd";
+      desc.attrs[3].name = "in_posH_ab";
+      desc.attrs[4].name = "in_posH_cd";
+      desc.attrs[5].name = "in_ab";
+      desc.attrs[6].name = "in_c";
+      desc.attrs[7].name = "in_uv_rect";
+      desc.attrs[8].name = "in_col";
+      desc.attrs[9].name = "in_shape";
+      desc.attrs[10].name = "in_params";
+      desc.attrs[11].name = "in_user_params";
+      desc.attrs[12].name = "in_depth";
+      desc.vs.source = sprite_instanced_vs_source_glsl300es;
+      desc.vs.entry = "main";
+      desc.fs.source = sprite_instanced_fs_source_glsl300es;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 1;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_instanced_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_D3D11) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].sem_name = "TEXCOORD";
+      desc.attrs[0].sem_index = 0;
+      desc.attrs[1].sem_name = "TEXCOORD";
+      desc.attrs[1].sem_index = 1;
+      desc.attrs[2].sem_name = "TEXCOORD";
+      desc.attrs[2].sem_index = 2;
+      desc.attrs[3].sem_name = "TEXCOORD";
+      desc.attrs[3].sem_index = 3;
+      desc.attrs[4].sem_name = "TEXCOORD";
+      desc.attrs[4].sem_index = 4;
+      desc.attrs[5].sem_name = "TEXCOORD";
+      desc.attrs[5].sem_index = 5;
+      desc.attrs[6].sem_name = "TEXCOORD";
+      desc.attrs[6].sem_index = 6;
+      desc.attrs[7].sem_name = "TEXCOORD";
+      desc.attrs[7].sem_index = 7;
+      desc.attrs[8].sem_name = "TEXCOORD";
+      desc.attrs[8].sem_index = 8;
+      desc.attrs[9].sem_name = "TEXCOORD";
+      desc.attrs[9].sem_index = 9;
+      desc.attrs[10].sem_name = "TEXCOORD";
+      desc.attrs[10].sem_index = 10;
+      desc.attrs[11].sem_name = "TEXCOORD";
+      desc.attrs[11].sem_index = 11;
+      desc.attrs[12].sem_name = "TEXCOORD";
+      desc.attrs[12].sem_index = 12;
+      desc.vs.source = sprite_instanced_vs_source_hlsl5;
+      desc.vs.d3d11_target = "vs_5_0";
+      desc.vs.entry = "main";
+      desc.fs.source = sprite_instanced_fs_source_hlsl5;
+      desc.fs.d3d11_target = "ps_5_0";
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_instanced_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_MACOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_instanced_vs_source_metal_macos;
+      desc.vs.entry = "main0";
+      desc.fs.source = sprite_instanced_fs_source_metal_macos;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_instanced_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_IOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_instanced_vs_source_metal_ios;
+      desc.vs.entry = "main0";
+      desc.fs.source = sprite_instanced_fs_source_metal_ios;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_instanced_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_SIMULATOR) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_instanced_vs_source_metal_sim;
+      desc.vs.entry = "main0";
+      desc.fs.source = sprite_instanced_fs_source_metal_sim;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 16;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_2D;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_instanced_shader_shader";
+    }
+    return &desc;
+  }
+  return 0;
+}
+static inline int sprite_instanced_shader_attr_slot(const char* attr_name) {
+  (void)attr_name;
+  if (0 == strcmp(attr_name, "in_corner")) {
+    return 0;
+  }
+  if (0 == strcmp(attr_name, "in_pos_ab")) {
+    return 1;
+  }
+  if (0 == strcmp(attr_name, "in_pos_cd")) {
+    return 2;
+  }
+  if (0 == strcmp(attr_name, "in_posH_ab")) {
+    return 3;
+  }
+  if (0 == strcmp(attr_name, "in_posH_cd")) {
+    return 4;
+  }
+  if (0 == strcmp(attr_name, "in_ab")) {
+    return 5;
+  }
+  if (0 == strcmp(attr_name, "in_c")) {
+    return 6;
+  }
+  if (0 == strcmp(attr_name, "in_uv_rect")) {
+    return 7;
+  }
+  if (0 == strcmp(attr_name, "in_col")) {
+    return 8;
+  }
+  if (0 == strcmp(attr_name, "in_shape")) {
+    return 9;
+  }
+  if (0 == strcmp(attr_name, "in_params")) {
+    return 10;
+  }
+  if (0 == strcmp(attr_name, "in_user_params")) {
+    return 11;
+  }
+  if (0 == strcmp(attr_name, "in_depth")) {
+    return 12;
+  }
+  return -1;
+}
+static inline int sprite_instanced_shader_image_slot(sg_shader_stage stage, const char* img_name) {
+  (void)stage; (void)img_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(img_name, "u_image")) {
+      return 0;
+    }
+  }
+  return -1;
+}
+static inline int sprite_instanced_shader_uniformblock_slot(sg_shader_stage stage, const char* ub_name) {
+  (void)stage; (void)ub_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      return 0;
+    }
+  }
+  return -1;
+}
+static inline size_t sprite_instanced_shader_uniformblock_size(sg_shader_stage stage, const char* ub_name) {
+  (void)stage; (void)ub_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      return sizeof(sprite_instanced_fs_params_t);
+    }
+  }
+  return 0;
+}
+static inline int sprite_instanced_shader_uniform_offset(sg_shader_stage stage, const char* ub_name, const char* u_name) {
+  (void)stage; (void)ub_name; (void)u_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      if (0 == strcmp(u_name, "u_texture_size")) {
+        return 0;
+      }
+    }
+  }
+  return -1;
+}
+static inline sg_shader_uniform_desc sprite_instanced_shader_uniform_desc(sg_shader_stage stage, const char* ub_name, const char* u_name) {
+  (void)stage; (void)ub_name; (void)u_name;
+  #if defined(__cplusplus)
+  sg_shader_uniform_desc desc = {};
+  #else
+  sg_shader_uniform_desc desc = {0};
+  #endif
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      if (0 == strcmp(u_name, "u_texture_size")) {
+        desc.name = "u_texture_size";
+        desc.type = SG_UNIFORMTYPE_FLOAT2;
+        desc.array_count = 1;
+        return desc;
+      }
+    }
+  }
+  return desc;
+}
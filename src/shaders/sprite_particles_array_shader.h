@@ -0,0 +1,7354 @@
+#pragma once
+/*
+    NOT machine generated. Written by hand from the sokol-shdc output of sprite.glsl as the variant compile.sh
+    builds with CF_DRAW_PARTICLES and CF_DRAW_ATLAS_ARRAY (particles on atlas array layers), as sokol-shdc could not
+    be run when the variant was added. The fragment shader is the one in sprite_array_shader.h with a clip box test
+    at the end. On Mesa the glsl330 and glsl300es sources compile and link, and an emitter's sprites on layer 1 of
+    a two layer array, and its circles, land within 2/255 of the same particles drawn as vertices through
+    sprite_array_shader.h. The hlsl5 and metal sources have not been through a shader compiler. Running
+    compile.sh or compile.cmd regenerates this file from sprite.glsl with real sokol-shdc output, which should
+    replace it.
+
+    Overview:
+
+        Shader program 'shader':
+            Get shader desc: sprite_particles_array_shader_shader_desc(sg_query_backend());
+            Vertex shader: vs
+                Attribute slots:
+                    ATTR_sprite_particles_array_vs_in_corner = 0
+                    ATTR_sprite_particles_array_vs_in_particle = 1
+                Uniform block 'particle_params':
+                    C struct: sprite_particles_array_particle_params_t
+                    Bind slot: SLOT_sprite_particles_array_particle_params = 0
+            Fragment shader: fs
+                Uniform block 'fs_params':
+                    C struct: sprite_particles_array_fs_params_t
+                    Bind slot: SLOT_sprite_particles_array_fs_params = 0
+                Image 'u_image':
+                    Type: SG_IMAGETYPE_ARRAY
+                    Component Type: SG_SAMPLERTYPE_FLOAT
+                    Bind slot: SLOT_sprite_particles_array_u_image = 0
+
+
+    Shader descriptor structs:
+
+        sg_shader shader = sg_make_shader(sprite_particles_array_shader_shader_desc(sg_query_backend()));
+
+    Vertex attribute locations for vertex shader 'vs':
+
+        sg_pipeline pip = sg_make_pipeline(&(sg_pipeline_desc){
+            .layout = {
+                .attrs = {
+                    [ATTR_sprite_particles_array_vs_in_corner] = { ... },
+                    [ATTR_sprite_particles_array_vs_in_particle] = { ... },
+                },
+            },
+            ...});
+
+    Image bind slots, use as index in sg_bindings.vs_images[] or .fs_images[]
+
+        SLOT_sprite_particles_array_u_image = 0;
+
+    Bind slot and C-struct for uniform block 'particle_params':
+
+        sprite_particles_array_particle_params_t particle_params = {
+            .u_mvp = ...;
+            .u_mvp_p = ...;
+            .u_size = ...;
+            .u_color_start = ...;
+            .u_color_end = ...;
+            .u_tint = ...;
+            .u_uv_rect = ...;
+            .u_user_params = ...;
+            .u_aa = ...;
+            .u_layer = ...;
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_[VS|FS], SLOT_sprite_particles_array_particle_params, &SG_RANGE(particle_params));
+
+    Bind slot and C-struct for uniform block 'fs_params':
+
+        sprite_particles_array_fs_params_t fs_params = {
+            .u_texture_size = ...;
+            .u_clip = ...;
+        };
+        sg_apply_uniforms(SG_SHADERSTAGE_[VS|FS], SLOT_sprite_particles_array_fs_params, &SG_RANGE(fs_params));
+
+*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stddef.h>
+#if !defined(SOKOL_SHDC_ALIGN)
+  #if defined(_MSC_VER)
+    #define SOKOL_SHDC_ALIGN(a) __declspec(align(a))
+  #else
+    #define SOKOL_SHDC_ALIGN(a) __attribute__((aligned(a)))
+  #endif
+#endif
+#define ATTR_sprite_particles_array_vs_in_corner (0)
+#define ATTR_sprite_particles_array_vs_in_particle (1)
+#define SLOT_sprite_particles_array_u_image (0)
+#define SLOT_sprite_particles_array_particle_params (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct sprite_particles_array_particle_params_t {
+    CF_Color u_mvp;
+    CF_Color u_mvp_p;
+    CF_Color u_size;
+    CF_Color u_color_start;
+    CF_Color u_color_end;
+    CF_Color u_tint;
+    CF_Color u_uv_rect;
+    CF_Color u_user_params;
+    float u_aa;
+    float u_layer;
+    uint8_t _pad_136[8];
+} sprite_particles_array_particle_params_t;
+#pragma pack(pop)
+#define SLOT_sprite_particles_array_fs_params (0)
+#pragma pack(push,1)
+SOKOL_SHDC_ALIGN(16) typedef struct sprite_particles_array_fs_params_t {
+    CF_V2 u_texture_size;
+    uint8_t _pad_8[8];
+    CF_Color u_clip;
+} sprite_particles_array_fs_params_t;
+#pragma pack(pop)
+/*
+    #version 330
+    
+    uniform vec4 particle_params[9];
+    out vec2 v_pos;
+    out vec2 v_a;
+    out vec2 v_b;
+    out vec2 v_c;
+    out vec2 v_uv;
+    out vec4 v_col;
+    out float v_radius;
+    out float v_stroke;
+    out float v_aa;
+    out float v_type;
+    out float v_alpha;
+    out float v_fill;
+    out vec2 v_posH;
+    out vec4 v_user;
+    flat out float v_layer;
+    layout(location = 0) in vec4 in_corner;
+    layout(location = 1) in vec3 in_particle;
+    
+    float overlay(float base, float blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = ((1.0 - base) * (-2.0)) * (1.0 - blend) + 1.0;
+        }
+        return _105;
+    }
+    
+    vec3 overlay(vec3 base, vec3 blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return vec3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    vec4 overlay(vec4 base, vec4 blend)
+    {
+        vec3 param = base.xyz;
+        vec3 param_1 = blend.xyz;
+        return vec4(overlay(param, param_1), base.w);
+    }
+    
+    void main()
+    {
+        vec2 side = vec2(in_corner.y + in_corner.z, in_corner.x + in_corner.y);
+        float size = mix(particle_params[2].z, particle_params[2].w, in_particle.z);
+        vec4 color = mix(particle_params[3], particle_params[4], vec4(in_particle.z));
+        vec2 he;
+        vec4 col;
+        float type;
+        float alpha;
+        if (particle_params[1].w > 0.5)
+        {
+            he = particle_params[2].xy * size;
+            col = particle_params[5];
+            type = 0.0;
+            alpha = color.w;
+        }
+        else
+        {
+            float r = (size * 0.5) + particle_params[8].x;
+            he = vec2(r, r);
+            vec4 param = color;
+            vec4 param_1 = particle_params[5];
+            col = overlay(param, param_1);
+            type = 0.011764706112444400787353515625;
+            alpha = 1.0;
+        }
+        vec2 _pos = in_particle.xy + (((side * 2.0) - vec2(1.0)) * he);
+        vec2 _posH = ((particle_params[0].xy * _pos.x) + (particle_params[0].zw * _pos.y)) + particle_params[1].xy;
+        v_pos = _pos;
+        v_a = in_particle.xy;
+        v_b = in_particle.xy;
+        v_c = in_particle.xy;
+        v_uv = mix(particle_params[6].xy, particle_params[6].zw, side);
+        v_col = vec4(col.xyz * col.w, col.w);
+        v_radius = size * 0.5;
+        v_stroke = 0.0;
+        v_aa = particle_params[8].x;
+        v_type = type;
+        v_alpha = alpha;
+        v_fill = 1.0;
+        v_layer = particle_params[8].y * 255.0;
+        gl_Position = vec4(_posH, particle_params[1].z, 1.0);
+        v_posH = _posH;
+        v_user = particle_params[7];
+        gl_Position.y = -gl_Position.y;
+    }
+    
+*/
+static const char sprite_particles_array_vs_source_glsl330[2556] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x74,0x69,
+    0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x39,0x5d,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6f,
+    0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x6f,0x75,0x74,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,
+    0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,
+    0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x30,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,
+    0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,
+    0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,
+    0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,
+    0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x33,0x20,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x76,0x65,0x63,0x33,0x20,0x62,0x61,0x73,0x65,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,
+    0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,
+    0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x76,0x65,0x63,0x34,0x20,0x62,0x61,
+    0x73,0x65,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,
+    0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,
+    0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x70,
+    0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,
+    0x5d,0x2e,0x7a,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x77,0x2c,0x20,0x69,0x6e,0x5f,0x70,0x61,
+    0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x33,0x5d,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x31,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,0x20,0x3d,
+    0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x32,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,
+    0x68,0x61,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x72,0x20,0x3d,0x20,0x28,0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x68,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x72,0x2c,0x20,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x31,0x31,0x37,0x36,0x34,0x37,0x30,0x36,0x31,0x31,0x32,0x34,0x34,
+    0x34,0x34,0x30,0x30,0x37,0x38,0x37,0x33,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,
+    0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x28,
+    0x28,0x73,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x68,0x65,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x48,0x20,
+    0x3d,0x20,0x28,0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,
+    0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x5f,
+    0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x69,0x63,
+    0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,
+    0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,
+    0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x36,0x5d,0x2e,0x78,0x79,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,0x7a,0x77,0x2c,0x20,0x73,0x69,
+    0x64,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
+    0x20,0x76,0x65,0x63,0x34,0x28,0x63,0x6f,0x6c,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,
+    0x63,0x6f,0x6c,0x2e,0x77,0x2c,0x20,0x63,0x6f,0x6c,0x2e,0x77,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x69,
+    0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,
+    0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6c,
+    0x61,0x79,0x65,0x72,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2e,0x79,0x20,0x2a,0x20,0x32,0x35,
+    0x35,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x70,0x6f,0x73,
+    0x48,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,
+    0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x37,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
+    0x69,0x6f,0x6e,0x2e,0x79,0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x2e,0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 330
+    
+    uniform vec4 fs_params[2];
+    uniform sampler2DArray u_image;
+    
+    in float v_stroke;
+    in float v_aa;
+    layout(location = 0) out vec4 result;
+    in float v_fill;
+    in float v_type;
+    in vec2 v_uv;
+    in vec4 v_col;
+    in vec2 v_pos;
+    in vec2 v_a;
+    in vec2 v_b;
+    in vec2 v_c;
+    in float v_radius;
+    in float v_alpha;
+    in vec2 v_posH;
+    in vec4 v_user;
+    flat in float v_layer;
+    
+    vec2 smooth_uv(vec2 uv, vec2 texture_size)
+    {
+        vec2 _205 = floor(uv * texture_size + vec2(0.5));
+        return (_205 + clamp((uv * texture_size + (-_205)) / fwidth(uv * texture_size), vec2(-0.5), vec2(0.5))) / texture_size;
+    }
+    
+    vec4 de_gamma(vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(2.2000000476837158203125)), c.w);
+    }
+    
+    float overlay(float base, float blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = ((1.0 - base) * (-2.0)) * (1.0 - blend) + 1.0;
+        }
+        return _105;
+    }
+    
+    vec3 overlay(vec3 base, vec3 blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return vec3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    vec4 overlay(vec4 base, vec4 blend)
+    {
+        vec3 param = base.xyz;
+        vec3 param_1 = blend.xyz;
+        return vec4(overlay(param, param_1), base.w);
+    }
+    
+    vec4 gamma(vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(0.4545454680919647216796875)), c.w);
+    }
+    
+    vec2 skew(vec2 v)
+    {
+        return vec2(-v.y, v.x);
+    }
+    
+    float distance_aabb(vec2 p, vec2 he)
+    {
+        vec2 _349 = abs(p) - he;
+        return length(max(_349, vec2(0.0))) + min(max(_349.x, _349.y), 0.0);
+    }
+    
+    float distance_box(inout vec2 p, vec2 c, vec2 he, vec2 u)
+    {
+        vec2 param = u;
+        p -= c;
+        p = transpose(mat2(u, skew(param))) * p;
+        vec2 param_1 = p;
+        vec2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    float safe_div(float a, float b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    float safe_len(vec2 v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    float distance_segment(vec2 p, vec2 a, vec2 b)
+    {
+        vec2 _394 = b - a;
+        vec2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        vec2 param_2 = _398 - (_394 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    float det2(vec2 a, vec2 b)
+    {
+        return a.x * b.y + (-(a.y * b.x));
+    }
+    
+    float distance_triangle(vec2 p, vec2 a, vec2 b, vec2 c)
+    {
+        vec2 _424 = b - a;
+        vec2 _428 = c - b;
+        vec2 _432 = a - c;
+        vec2 _436 = p - a;
+        vec2 _440 = p - b;
+        vec2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        vec2 _459 = _436 - (_424 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        vec2 _474 = _440 - (_428 * clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        vec2 _489 = _444 - (_432 * clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        vec2 param_6 = _424;
+        vec2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        vec2 param_8 = _436;
+        vec2 param_9 = _424;
+        vec2 param_10 = _440;
+        vec2 param_11 = _428;
+        vec2 param_12 = _444;
+        vec2 param_13 = _432;
+        vec2 _531 = min(min(vec2(dot(_459, _459), _495 * det2(param_8, param_9)), vec2(dot(_474, _474), _495 * det2(param_10, param_11))), vec2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    float sdf_stroke(float d)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    vec4 sdf(vec4 a, vec4 b, float d)
+    {
+        float param = d;
+        vec4 _292 = mix(b, a, vec4(smoothstep(0.0, v_aa, sdf_stroke(param))));
+        bvec4 _316 = bvec4(clamp(d, -1.0, 1.0) <= 0.0);
+        vec4 _324 = vec4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(vec4(_316.x ? b.x : a.x, _316.y ? b.y : a.y, _316.z ? b.z : a.z, _316.w ? b.w : a.w), mix(b, a, vec4(smoothstep(0.0, v_aa, d))), _324), vec4(v_fill));
+        return result;
+    }
+    
+    vec4 shader(vec4 color, vec2 pos, vec2 atlas_uv, vec2 screen_uv, vec4 params)
+    {
+        return color;
+    }
+    
+    void main()
+    {
+        bool is_sprite = v_type >= 0.0 && v_type < 0.00196078442968428134918212890625;
+        bool is_text = v_type > 0.00196078442968428134918212890625 && v_type < 0.0058823530562222003936767578125;
+        bool is_box = v_type > 0.0058823530562222003936767578125 && v_type < 0.009803921915590763092041015625;
+        bool is_seg = v_type > 0.009803921915590763092041015625 && v_type < 0.013725490309298038482666015625;
+        bool is_tri = v_type > 0.013725490309298038482666015625 && v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125 && v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125 && v_type < 0.0254901959002017974853515625;
+        vec2 texel_pos = v_uv * fs_params[0].xy;
+        float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+        vec4 c = de_gamma(texture(u_image, vec3(smooth_uv(v_uv, fs_params[0].xy), v_layer)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, v_col));
+        }
+        if (is_text)
+        {
+            c = v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            vec2 texel = v_uv * fs_params[0].xy - vec2(0.5);
+            vec2 base = floor(texel);
+            vec2 f = texel - base;
+            vec2 uv0 = (base + vec2(0.5)) / fs_params[0].xy;
+            vec2 uv1 = (base + vec2(1.5)) / fs_params[0].xy;
+            float sd = mix(mix(textureLod(u_image, vec3(uv0, v_layer), 0.0).w, textureLod(u_image, vec3(vec2(uv1.x, uv0.y), v_layer), 0.0).w, f.x), mix(textureLod(u_image, vec3(vec2(uv0.x, uv1.y), v_layer), 0.0).w, textureLod(u_image, vec3(uv1, v_layer), 0.0).w, f.x), f.y);
+            c = v_col * clamp((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5, 0.0, 1.0);
+        }
+        if (is_tri)
+        {
+            c = v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            vec2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, v_col, d - v_radius);
+        }
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + vec2(1.0)) * 0.5, v_user);
+        if (c.w == 0.0)
+        {
+            discard;
+        }
+        if (any(lessThan(v_posH, fs_params[1].xy)) || any(greaterThan(v_posH, fs_params[1].zw)))
+        {
+            discard;
+        }
+        result = c;
+    }
+    
+*/
+static const char sprite_particles_array_fs_source_glsl330[6810] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
+    0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x69,0x6e,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x6c,0x61,0x79,0x6f,
+    0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,
+    0x20,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
+    0x69,0x6e,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x69,0x6e,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x69,0x6e,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x69,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x69,0x6e,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x66,0x6c,0x61,0x74,
+    0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x3b,0x0a,0x0a,0x76,0x65,0x63,0x32,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,
+    0x75,0x76,0x28,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,
+    0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x20,0x2b,0x20,0x28,0x2d,0x5f,0x32,0x30,0x35,0x29,0x29,0x20,0x2f,0x20,
+    0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,
+    0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,
+    0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,
+    0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,
+    0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,
+    0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x73,0x65,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,
+    0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,0x30,0x20,
+    0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,
+    0x30,0x35,0x20,0x3d,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,
+    0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x20,0x2b,0x20,0x31,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,
+    0x63,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x76,0x65,0x63,0x33,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x6f,0x76,0x65,
+    0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,
+    0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x76,0x65,0x63,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x76,0x65,0x63,
+    0x34,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,
+    0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,
+    0x34,0x35,0x34,0x35,0x34,0x35,0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,
+    0x32,0x31,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,
+    0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,
+    0x76,0x2e,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x76,0x65,0x63,
+    0x32,0x20,0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,
+    0x61,0x62,0x73,0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,
+    0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x61,0x78,0x28,0x5f,
+    0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x69,0x6e,0x6f,0x75,
+    0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x63,
+    0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x75,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x2d,
+    0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,0x61,
+    0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x6d,0x61,0x74,0x32,0x28,0x75,0x2c,0x20,0x73,
+    0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,0x70,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,0x36,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,0x3d,0x3d,0x20,0x30,0x2e,
+    0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,
+    0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x36,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,
+    0x28,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,
+    0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
+    0x32,0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,
+    0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,
+    0x32,0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,
+    0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,
+    0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,
+    0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,0x20,0x2d,
+    0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,
+    0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,
+    0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,
+    0x28,0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x2e,
+    0x78,0x20,0x2a,0x20,0x62,0x2e,0x79,0x20,0x2b,0x20,0x28,0x2d,0x28,0x61,0x2e,0x79,
+    0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
+    0x6e,0x67,0x6c,0x65,0x28,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,
+    0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,
+    0x33,0x32,0x20,0x3d,0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x34,0x30,
+    0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x63,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,
+    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x34,
+    0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x20,0x2d,0x20,
+    0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,
+    0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,
+    0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,
+    0x34,0x30,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,
+    0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,
+    0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,0x33,
+    0x32,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,
+    0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x39,0x35,0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,
+    0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,
+    0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x5f,0x34,0x32,
+    0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,
+    0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x69,0x6e,0x28,0x76,
+    0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,
+    0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x39,0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,
+    0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,
+    0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,
+    0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x33,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x28,0x2d,0x73,0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,
+    0x29,0x20,0x2a,0x20,0x73,0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x29,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,0x28,
+    0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x65,0x63,0x34,0x20,0x73,0x64,0x66,0x28,0x76,0x65,0x63,0x34,0x20,
+    0x61,0x2c,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,
+    0x2c,0x20,0x61,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,
+    0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,
+    0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x76,0x65,0x63,0x34,0x20,
+    0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x62,0x76,0x65,0x63,0x34,0x28,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,
+    0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x66,
+    0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,
+    0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x32,
+    0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x76,
+    0x65,0x63,0x34,0x28,0x5f,0x33,0x31,0x36,0x2e,0x78,0x20,0x3f,0x20,0x62,0x2e,0x78,
+    0x20,0x3a,0x20,0x61,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x79,0x20,0x3f,
+    0x20,0x62,0x2e,0x79,0x20,0x3a,0x20,0x61,0x2e,0x79,0x2c,0x20,0x5f,0x33,0x31,0x36,
+    0x2e,0x7a,0x20,0x3f,0x20,0x62,0x2e,0x7a,0x20,0x3a,0x20,0x61,0x2e,0x7a,0x2c,0x20,
+    0x5f,0x33,0x31,0x36,0x2e,0x77,0x20,0x3f,0x20,0x62,0x2e,0x77,0x20,0x3a,0x20,0x61,
+    0x2e,0x77,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,
+    0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,0x29,0x29,0x29,0x2c,0x20,
+    0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x63,0x34,
+    0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x2c,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x2c,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,0x76,0x2c,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2c,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,
+    0x30,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,
+    0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,
+    0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,
+    0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,
+    0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,
+    0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,
+    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,
+    0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,
+    0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,
+    0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,
+    0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,
+    0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,
+    0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,
+    0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,
+    0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,
+    0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,
+    0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,
+    0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,
+    0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
+    0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,
+    0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,
+    0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,
+    0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x20,0x3d,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,
+    0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,
+    0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,
+    0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,
+    0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,
+    0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x2b,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x79,0x28,0x74,0x65,0x78,
+    0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,
+    0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,
+    0x28,0x76,0x5f,0x75,0x76,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x29,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,
+    0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,
+    0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,
+    0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,
+    0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,
+    0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,
+    0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,
+    0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x30,0x2c,0x20,
+    0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x76,0x65,0x63,0x32,0x28,
+    0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x76,0x65,0x63,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,0x2c,0x20,
+    0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,
+    0x63,0x33,0x28,0x75,0x76,0x31,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,
+    0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x28,0x73,0x64,0x20,0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,
+    0x33,0x39,0x39,0x39,0x31,0x37,0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,
+    0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,
+    0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,
+    0x20,0x2b,0x20,0x30,0x2e,0x35,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,
+    0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,
+    0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,
+    0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,
+    0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,
+    0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,
+    0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,
+    0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,
+    0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,
+    0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,
+    0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,
+    0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,
+    0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,
+    0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x61,0x6e,0x79,0x28,0x6c,0x65,0x73,0x73,0x54,0x68,0x61,0x6e,
+    0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x29,0x29,0x20,0x7c,0x7c,0x20,0x61,0x6e,
+    0x79,0x28,0x67,0x72,0x65,0x61,0x74,0x65,0x72,0x54,0x68,0x61,0x6e,0x28,0x76,0x5f,
+    0x70,0x6f,0x73,0x48,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x7a,0x77,0x29,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x20,0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    
+    uniform highp vec4 particle_params[9];
+    out vec2 v_pos;
+    out vec2 v_a;
+    out vec2 v_b;
+    out vec2 v_c;
+    out vec2 v_uv;
+    out vec4 v_col;
+    out float v_radius;
+    out float v_stroke;
+    out float v_aa;
+    out float v_type;
+    out float v_alpha;
+    out float v_fill;
+    out vec2 v_posH;
+    out vec4 v_user;
+    flat out float v_layer;
+    layout(location = 0) in vec4 in_corner;
+    layout(location = 1) in vec3 in_particle;
+    
+    highp float overlay(highp float base, highp float blend)
+    {
+        highp float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = ((1.0 - base) * (-2.0)) * (1.0 - blend) + 1.0;
+        }
+        return _105;
+    }
+    
+    highp vec3 overlay(highp vec3 base, highp vec3 blend)
+    {
+        highp float param = base.x;
+        highp float param_1 = blend.x;
+        highp float param_2 = base.y;
+        highp float param_3 = blend.y;
+        highp float param_4 = base.z;
+        highp float param_5 = blend.z;
+        return vec3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    highp vec4 overlay(highp vec4 base, highp vec4 blend)
+    {
+        highp vec3 param = base.xyz;
+        highp vec3 param_1 = blend.xyz;
+        return vec4(overlay(param, param_1), base.w);
+    }
+    
+    void main()
+    {
+        highp vec2 side = vec2(in_corner.y + in_corner.z, in_corner.x + in_corner.y);
+        highp float size = mix(particle_params[2].z, particle_params[2].w, in_particle.z);
+        highp vec4 color = mix(particle_params[3], particle_params[4], vec4(in_particle.z));
+        highp vec2 he;
+        highp vec4 col;
+        highp float type;
+        highp float alpha;
+        if (particle_params[1].w > 0.5)
+        {
+            he = particle_params[2].xy * size;
+            col = particle_params[5];
+            type = 0.0;
+            alpha = color.w;
+        }
+        else
+        {
+            highp float r = (size * 0.5) + particle_params[8].x;
+            he = vec2(r, r);
+            highp vec4 param = color;
+            highp vec4 param_1 = particle_params[5];
+            col = overlay(param, param_1);
+            type = 0.011764706112444400787353515625;
+            alpha = 1.0;
+        }
+        highp vec2 _pos = in_particle.xy + (((side * 2.0) - vec2(1.0)) * he);
+        highp vec2 _posH = ((particle_params[0].xy * _pos.x) + (particle_params[0].zw * _pos.y)) + particle_params[1].xy;
+        v_pos = _pos;
+        v_a = in_particle.xy;
+        v_b = in_particle.xy;
+        v_c = in_particle.xy;
+        v_uv = mix(particle_params[6].xy, particle_params[6].zw, side);
+        v_col = vec4(col.xyz * col.w, col.w);
+        v_radius = size * 0.5;
+        v_stroke = 0.0;
+        v_aa = particle_params[8].x;
+        v_type = type;
+        v_alpha = alpha;
+        v_fill = 1.0;
+        v_layer = particle_params[8].y * 255.0;
+        gl_Position = vec4(_posH, particle_params[1].z, 1.0);
+        v_posH = _posH;
+        v_user = particle_params[7];
+        gl_Position.y = -gl_Position.y;
+    }
+    
+*/
+static const char sprite_particles_array_vs_source_glsl300es[2745] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x39,0x5d,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x76,0x5f,0x61,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,
+    0x5f,0x62,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x63,
+    0x3b,0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x6f,0x75,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x6f,0x75,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,
+    0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,
+    0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x3b,0x0a,0x66,0x6c,0x61,0x74,0x20,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,
+    0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x69,
+    0x6e,0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,0x63,0x33,0x20,0x69,
+    0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x3b,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x73,
+    0x65,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,
+    0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,
+    0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,
+    0x3d,0x20,0x28,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,
+    0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,
+    0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,
+    0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x6f,0x76,
+    0x65,0x72,0x6c,0x61,0x79,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,0x28,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x2e,0x7a,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x2e,0x77,0x2c,0x20,0x69,0x6e,0x5f,0x70,
+    0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,
+    0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x33,0x5d,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,
+    0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x34,0x5d,0x2c,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,
+    0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
+    0x65,0x63,0x32,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x79,0x70,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x31,0x5d,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,0x20,0x3d,0x20,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x32,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,
+    0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,
+    0x61,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x28,0x73,0x69,0x7a,0x65,0x20,
+    0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,0x20,0x3d,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x72,0x2c,0x20,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x35,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,
+    0x20,0x30,0x2e,0x30,0x31,0x31,0x37,0x36,0x34,0x37,0x30,0x36,0x31,0x31,0x32,0x34,
+    0x34,0x34,0x34,0x30,0x30,0x37,0x38,0x37,0x33,0x35,0x33,0x35,0x31,0x35,0x36,0x32,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,
+    0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,
+    0x78,0x79,0x20,0x2b,0x20,0x28,0x28,0x28,0x73,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,
+    0x2e,0x30,0x29,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,
+    0x20,0x2a,0x20,0x68,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,
+    0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,
+    0x20,0x2b,0x20,0x28,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,
+    0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,
+    0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,
+    0x78,0x79,0x2c,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x36,0x5d,0x2e,0x7a,0x77,0x2c,0x20,0x73,0x69,0x64,0x65,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x63,0x6f,0x6c,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x63,0x6f,0x6c,
+    0x2e,0x77,0x2c,0x20,0x63,0x6f,0x6c,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x20,
+    0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x61,0x61,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x61,0x6c,0x70,
+    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,
+    0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x20,0x3d,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x38,0x5d,0x2e,0x79,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x31,0x5d,0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x37,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2e,0x79,0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
+    0x6e,0x2e,0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #version 300 es
+    precision mediump float;
+    precision highp int;
+    
+    uniform highp vec4 fs_params[2];
+    uniform highp sampler2DArray u_image;
+    
+    in highp float v_stroke;
+    in highp float v_aa;
+    layout(location = 0) out highp vec4 result;
+    in highp float v_fill;
+    in highp float v_type;
+    in highp vec2 v_uv;
+    in highp vec4 v_col;
+    in highp vec2 v_pos;
+    in highp vec2 v_a;
+    in highp vec2 v_b;
+    in highp vec2 v_c;
+    in highp float v_radius;
+    in highp float v_alpha;
+    in highp vec2 v_posH;
+    in highp vec4 v_user;
+    flat in highp float v_layer;
+    
+    highp vec2 smooth_uv(highp vec2 uv, highp vec2 texture_size)
+    {
+        highp vec2 _205 = floor(uv * texture_size + vec2(0.5));
+        return (_205 + clamp((uv * texture_size + (-_205)) / fwidth(uv * texture_size), vec2(-0.5), vec2(0.5))) / texture_size;
+    }
+    
+    highp vec4 de_gamma(highp vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(2.2000000476837158203125)), c.w);
+    }
+    
+    highp float overlay(highp float base, highp float blend)
+    {
+        highp float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = ((1.0 - base) * (-2.0)) * (1.0 - blend) + 1.0;
+        }
+        return _105;
+    }
+    
+    highp vec3 overlay(highp vec3 base, highp vec3 blend)
+    {
+        highp float param = base.x;
+        highp float param_1 = blend.x;
+        highp float param_2 = base.y;
+        highp float param_3 = blend.y;
+        highp float param_4 = base.z;
+        highp float param_5 = blend.z;
+        return vec3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    highp vec4 overlay(highp vec4 base, highp vec4 blend)
+    {
+        highp vec3 param = base.xyz;
+        highp vec3 param_1 = blend.xyz;
+        return vec4(overlay(param, param_1), base.w);
+    }
+    
+    highp vec4 gamma(highp vec4 c)
+    {
+        return vec4(pow(abs(c.xyz), vec3(0.4545454680919647216796875)), c.w);
+    }
+    
+    highp vec2 skew(highp vec2 v)
+    {
+        return vec2(-v.y, v.x);
+    }
+    
+    highp float distance_aabb(highp vec2 p, highp vec2 he)
+    {
+        highp vec2 _349 = abs(p) - he;
+        return length(max(_349, vec2(0.0))) + min(max(_349.x, _349.y), 0.0);
+    }
+    
+    highp float distance_box(inout highp vec2 p, highp vec2 c, highp vec2 he, highp vec2 u)
+    {
+        highp vec2 param = u;
+        p -= c;
+        p = transpose(mat2(u, skew(param))) * p;
+        highp vec2 param_1 = p;
+        highp vec2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    highp float safe_div(highp float a, highp float b)
+    {
+        highp float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    highp float safe_len(highp vec2 v)
+    {
+        highp float _239 = dot(v, v);
+        highp float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    highp float distance_segment(highp vec2 p, highp vec2 a, highp vec2 b)
+    {
+        highp vec2 _394 = b - a;
+        highp vec2 _398 = p - a;
+        highp float param = dot(_398, _394);
+        highp float param_1 = dot(_394, _394);
+        highp vec2 param_2 = _398 - (_394 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    highp float det2(highp vec2 a, highp vec2 b)
+    {
+        return a.x * b.y + (-(a.y * b.x));
+    }
+    
+    highp float distance_triangle(highp vec2 p, highp vec2 a, highp vec2 b, highp vec2 c)
+    {
+        highp vec2 _424 = b - a;
+        highp vec2 _428 = c - b;
+        highp vec2 _432 = a - c;
+        highp vec2 _436 = p - a;
+        highp vec2 _440 = p - b;
+        highp vec2 _444 = p - c;
+        highp float param = dot(_436, _424);
+        highp float param_1 = dot(_424, _424);
+        highp vec2 _459 = _436 - (_424 * clamp(safe_div(param, param_1), 0.0, 1.0));
+        highp float param_2 = dot(_440, _428);
+        highp float param_3 = dot(_428, _428);
+        highp vec2 _474 = _440 - (_428 * clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        highp float param_4 = dot(_444, _432);
+        highp float param_5 = dot(_432, _432);
+        highp vec2 _489 = _444 - (_432 * clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        highp vec2 param_6 = _424;
+        highp vec2 param_7 = _432;
+        highp float _495 = det2(param_6, param_7);
+        highp vec2 param_8 = _436;
+        highp vec2 param_9 = _424;
+        highp vec2 param_10 = _440;
+        highp vec2 param_11 = _428;
+        highp vec2 param_12 = _444;
+        highp vec2 param_13 = _432;
+        highp vec2 _531 = min(min(vec2(dot(_459, _459), _495 * det2(param_8, param_9)), vec2(dot(_474, _474), _495 * det2(param_10, param_11))), vec2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    highp float sdf_stroke(highp float d)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    highp vec4 sdf(highp vec4 a, highp vec4 b, highp float d)
+    {
+        highp float param = d;
+        highp vec4 _292 = mix(b, a, vec4(smoothstep(0.0, v_aa, sdf_stroke(param))));
+        bvec4 _316 = bvec4(clamp(d, -1.0, 1.0) <= 0.0);
+        highp vec4 _324 = vec4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(vec4(_316.x ? b.x : a.x, _316.y ? b.y : a.y, _316.z ? b.z : a.z, _316.w ? b.w : a.w), mix(b, a, vec4(smoothstep(0.0, v_aa, d))), _324), vec4(v_fill));
+        return result;
+    }
+    
+    highp vec4 shader(highp vec4 color, highp vec2 pos, highp vec2 atlas_uv, highp vec2 screen_uv, highp vec4 params)
+    {
+        return color;
+    }
+    
+    void main()
+    {
+        bool is_sprite = v_type >= 0.0 && v_type < 0.00196078442968428134918212890625;
+        bool is_text = v_type > 0.00196078442968428134918212890625 && v_type < 0.0058823530562222003936767578125;
+        bool is_box = v_type > 0.0058823530562222003936767578125 && v_type < 0.009803921915590763092041015625;
+        bool is_seg = v_type > 0.009803921915590763092041015625 && v_type < 0.013725490309298038482666015625;
+        bool is_tri = v_type > 0.013725490309298038482666015625 && v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125 && v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125 && v_type < 0.0254901959002017974853515625;
+        highp vec2 texel_pos = v_uv * fs_params[0].xy;
+        highp float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+        highp vec4 c = de_gamma(texture(u_image, vec3(smooth_uv(v_uv, fs_params[0].xy), v_layer)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, v_col));
+        }
+        if (is_text)
+        {
+            c = v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            highp vec2 texel = v_uv * fs_params[0].xy - vec2(0.5);
+            highp vec2 base = floor(texel);
+            highp vec2 f = texel - base;
+            highp vec2 uv0 = (base + vec2(0.5)) / fs_params[0].xy;
+            highp vec2 uv1 = (base + vec2(1.5)) / fs_params[0].xy;
+            highp float sd = mix(mix(textureLod(u_image, vec3(uv0, v_layer), 0.0).w, textureLod(u_image, vec3(vec2(uv1.x, uv0.y), v_layer), 0.0).w, f.x), mix(textureLod(u_image, vec3(vec2(uv0.x, uv1.y), v_layer), 0.0).w, textureLod(u_image, vec3(uv1, v_layer), 0.0).w, f.x), f.y);
+            c = v_col * clamp((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5, 0.0, 1.0);
+        }
+        if (is_tri)
+        {
+            c = v_col;
+        }
+        highp float d = 0.0;
+        if (is_box)
+        {
+            highp vec2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, v_col, d - v_radius);
+        }
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + vec2(1.0)) * 0.5, v_user);
+        if (c.w == 0.0)
+        {
+            discard;
+        }
+        if (any(lessThan(v_posH, fs_params[1].xy)) || any(greaterThan(v_posH, fs_params[1].zw)))
+        {
+            discard;
+        }
+        result = c;
+    }
+    
+*/
+static const char sprite_particles_array_fs_source_glsl300es[7663] = {
+    0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
+    0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
+    0x6f,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x69,0x6e,0x74,0x3b,0x0a,0x0a,0x75,
+    0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x32,0x5d,0x3b,0x0a,
+    0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x3b,0x0a,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x61,0x61,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x30,0x29,0x20,0x6f,0x75,0x74,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,
+    0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x69,
+    0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x75,
+    0x76,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x69,0x6e,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,
+    0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,
+    0x62,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x76,0x5f,0x63,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x69,
+    0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x69,0x6e,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,
+    0x72,0x3b,0x0a,0x66,0x6c,0x61,0x74,0x20,0x69,0x6e,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,
+    0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x6d,0x6f,0x6f,
+    0x74,0x68,0x5f,0x75,0x76,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x75,0x76,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,
+    0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x75,0x76,0x20,0x2a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2b,0x20,0x28,0x2d,0x5f,0x32,0x30,0x35,
+    0x29,0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,
+    0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,
+    0x76,0x65,0x63,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x70,
+    0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x32,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,
+    0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,
+    0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,
+    0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,
+    0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x28,
+    0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,
+    0x32,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x28,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,
+    0x6c,0x65,0x6e,0x64,0x29,0x20,0x2b,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,
+    0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x33,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x33,0x28,0x6f,0x76,0x65,0x72,
+    0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x61,0x73,
+    0x65,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,
+    0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x34,0x28,0x6f,0x76,0x65,0x72,
+    0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,
+    0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,
+    0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,0x34,
+    0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,0x38,
+    0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x76,0x65,0x63,0x32,0x28,0x2d,
+    0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,
+    0x28,0x70,0x29,0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x6d,0x61,0x78,0x28,
+    0x5f,0x33,0x34,0x39,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x30,0x29,0x29,
+    0x29,0x20,0x2b,0x20,0x6d,0x69,0x6e,0x28,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,
+    0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x69,
+    0x6e,0x6f,0x75,0x74,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x70,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x63,0x2c,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x68,0x65,0x2c,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,
+    0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x6d,0x61,0x74,0x32,0x28,0x75,0x2c,0x20,
+    0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x20,0x2a,0x20,
+    0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x61,0x61,0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,
+    0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
+    0x32,0x32,0x36,0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,
+    0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x76,0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,
+    0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,0x33,0x39,
+    0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x30,0x2e,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
+    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,0x32,0x33,0x39,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,
+    0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,
+    0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,0x5f,0x33,0x39,
+    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,
+    0x38,0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x61,0x2e,0x78,0x20,0x2a,0x20,0x62,0x2e,0x79,0x20,0x2b,0x20,0x28,
+    0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x2c,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x32,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,
+    0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,
+    0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x34,
+    0x30,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,
+    0x20,0x70,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,
+    0x3d,0x20,0x5f,0x34,0x33,0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,
+    0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,
+    0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,0x32,0x38,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,
+    0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,
+    0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x34,0x38,0x39,0x20,
+    0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,0x33,0x32,0x20,0x2a,
+    0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,
+    0x35,0x20,0x3d,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x31,0x20,0x3d,0x20,0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,
+    0x6d,0x69,0x6e,0x28,0x6d,0x69,0x6e,0x28,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,
+    0x28,0x5f,0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,
+    0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,
+    0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,
+    0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,0x71,0x72,
+    0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,0x69,0x67,
+    0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,
+    0x72,0x6f,0x6b,0x65,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x61,0x62,0x73,0x28,0x64,0x29,0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x73,0x64,0x66,0x28,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,
+    0x20,0x61,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x62,
+    0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x32,0x39,
+    0x32,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,
+    0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x76,0x65,0x63,0x34,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,
+    0x62,0x76,0x65,0x63,0x34,0x28,0x63,0x6c,0x61,0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,
+    0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,0x30,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x6d,
+    0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x32,0x39,
+    0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x76,0x65,
+    0x63,0x34,0x28,0x5f,0x33,0x31,0x36,0x2e,0x78,0x20,0x3f,0x20,0x62,0x2e,0x78,0x20,
+    0x3a,0x20,0x61,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x79,0x20,0x3f,0x20,
+    0x62,0x2e,0x79,0x20,0x3a,0x20,0x61,0x2e,0x79,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,
+    0x7a,0x20,0x3f,0x20,0x62,0x2e,0x7a,0x20,0x3a,0x20,0x61,0x2e,0x7a,0x2c,0x20,0x5f,
+    0x33,0x31,0x36,0x2e,0x77,0x20,0x3f,0x20,0x62,0x2e,0x77,0x20,0x3a,0x20,0x61,0x2e,
+    0x77,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x76,0x65,
+    0x63,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,
+    0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,0x29,0x29,0x29,0x2c,0x20,0x5f,
+    0x33,0x32,0x34,0x29,0x2c,0x20,0x76,0x65,0x63,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x6f,0x73,0x2c,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,
+    0x75,0x76,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x73,
+    0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,0x76,0x2c,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
+    0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,
+    0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,
+    0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,
+    0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,
+    0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,
+    0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,
+    0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
+    0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,
+    0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,
+    0x6f,0x78,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,
+    0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,
+    0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,
+    0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,
+    0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,
+    0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,
+    0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,
+    0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
+    0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,
+    0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,
+    0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,
+    0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,
+    0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,
+    0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,
+    0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,
+    0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
+    0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,
+    0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,
+    0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,
+    0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
+    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,
+    0x73,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x30,
+    0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,
+    0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x2b,0x20,
+    0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x79,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,
+    0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x73,0x6d,0x6f,0x6f,
+    0x74,0x68,0x5f,0x75,0x76,0x28,0x76,0x5f,0x75,0x76,0x2c,0x20,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x29,0x2c,0x20,0x76,0x5f,
+    0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
+    0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,
+    0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,
+    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,
+    0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,
+    0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,
+    0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x75,0x76,0x30,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,
+    0x65,0x63,0x33,0x28,0x76,0x65,0x63,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,
+    0x75,0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,
+    0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x76,0x65,0x63,
+    0x32,0x28,0x75,0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,
+    0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,
+    0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x33,0x28,0x75,0x76,0x31,0x2c,
+    0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,
+    0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,
+    0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,
+    0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,
+    0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,
+    0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,
+    0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
+    0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,
+    0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,
+    0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,
+    0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,
+    0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,
+    0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,0x28,0x6c,0x65,0x73,
+    0x73,0x54,0x68,0x61,0x6e,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x66,0x73,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x78,0x79,0x29,0x29,0x20,
+    0x7c,0x7c,0x20,0x61,0x6e,0x79,0x28,0x67,0x72,0x65,0x61,0x74,0x65,0x72,0x54,0x68,
+    0x61,0x6e,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x2e,0x7a,0x77,0x29,0x29,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,
+    0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    cbuffer particle_params : register(b0)
+    {
+        float4 _41_u_mvp : packoffset(c0);
+        float4 _41_u_mvp_p : packoffset(c1);
+        float4 _41_u_size : packoffset(c2);
+        float4 _41_u_color_start : packoffset(c3);
+        float4 _41_u_color_end : packoffset(c4);
+        float4 _41_u_tint : packoffset(c5);
+        float4 _41_u_uv_rect : packoffset(c6);
+        float4 _41_u_user_params : packoffset(c7);
+        float _41_u_aa : packoffset(c8);
+        float _41_u_layer : packoffset(c8.y);
+    };
+    
+    static float4 gl_Position;
+    static float2 v_pos;
+    static float2 v_a;
+    static float2 v_b;
+    static float2 v_c;
+    static float2 v_uv;
+    static float4 v_col;
+    static float v_radius;
+    static float v_stroke;
+    static float v_aa;
+    static float v_type;
+    static float v_alpha;
+    static float v_fill;
+    static float2 v_posH;
+    static float4 v_user;
+    static float v_layer;
+    static float4 in_corner;
+    static float3 in_particle;
+    
+    struct SPIRV_Cross_Input
+    {
+        float4 in_corner : TEXCOORD0;
+        float3 in_particle : TEXCOORD1;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float2 v_pos : TEXCOORD0;
+        float2 v_a : TEXCOORD1;
+        float2 v_b : TEXCOORD2;
+        float2 v_c : TEXCOORD3;
+        float2 v_uv : TEXCOORD4;
+        float4 v_col : TEXCOORD5;
+        float v_radius : TEXCOORD6;
+        float v_stroke : TEXCOORD7;
+        float v_aa : TEXCOORD8;
+        float v_type : TEXCOORD9;
+        float v_alpha : TEXCOORD10;
+        float v_fill : TEXCOORD11;
+        float2 v_posH : TEXCOORD12;
+        float4 v_user : TEXCOORD13;
+        nointerpolation float v_layer : TEXCOORD14;
+        float4 gl_Position : SV_Position;
+    };
+    
+    float overlay(float base, float blend)
+    {
+        float _105;
+        if (base <= 0.5f)
+        {
+            _105 = (2.0f * base) * blend;
+        }
+        else
+        {
+            _105 = mad((1.0f - base) * (-2.0f), 1.0f - blend, 1.0f);
+        }
+        return _105;
+    }
+    
+    float3 overlay(float3 base, float3 blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    float4 overlay(float4 base, float4 blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    void vert_main()
+    {
+        float2 side = float2(in_corner.y + in_corner.z, in_corner.x + in_corner.y);
+        float size = lerp(_41_u_size.z, _41_u_size.w, in_particle.z);
+        float4 color = lerp(_41_u_color_start, _41_u_color_end, in_particle.zzzz);
+        float2 he;
+        float4 col;
+        float type;
+        float alpha;
+        if (_41_u_mvp_p.w > 0.5f)
+        {
+            he = _41_u_size.xy * size;
+            col = _41_u_tint;
+            type = 0.0f;
+            alpha = color.w;
+        }
+        else
+        {
+            float r = (size * 0.5f) + _41_u_aa;
+            he = float2(r, r);
+            float4 param = color;
+            float4 param_1 = _41_u_tint;
+            col = overlay(param, param_1);
+            type = 0.011764706112444400787353515625f;
+            alpha = 1.0f;
+        }
+        float2 _pos = in_particle.xy + (((side * 2.0f) - 1.0f.xx) * he);
+        float2 _posH = ((_41_u_mvp.xy * _pos.x) + (_41_u_mvp.zw * _pos.y)) + _41_u_mvp_p.xy;
+        v_pos = _pos;
+        v_a = in_particle.xy;
+        v_b = in_particle.xy;
+        v_c = in_particle.xy;
+        v_uv = lerp(_41_u_uv_rect.xy, _41_u_uv_rect.zw, side);
+        v_col = float4(col.xyz * col.w, col.w);
+        v_radius = size * 0.5f;
+        v_stroke = 0.0f;
+        v_aa = _41_u_aa;
+        v_type = type;
+        v_alpha = alpha;
+        v_fill = 1.0f;
+        v_layer = _41_u_layer * 255.0f;
+        gl_Position = float4(_posH, _41_u_mvp_p.z, 1.0f);
+        v_posH = _posH;
+        v_user = _41_u_user_params;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        in_corner = stage_input.in_corner;
+        in_particle = stage_input.in_particle;
+        vert_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.gl_Position = gl_Position;
+        stage_output.v_pos = v_pos;
+        stage_output.v_a = v_a;
+        stage_output.v_b = v_b;
+        stage_output.v_c = v_c;
+        stage_output.v_uv = v_uv;
+        stage_output.v_col = v_col;
+        stage_output.v_radius = v_radius;
+        stage_output.v_stroke = v_stroke;
+        stage_output.v_aa = v_aa;
+        stage_output.v_type = v_type;
+        stage_output.v_alpha = v_alpha;
+        stage_output.v_fill = v_fill;
+        stage_output.v_posH = v_posH;
+        stage_output.v_user = v_user;
+        stage_output.v_layer = v_layer;
+        return stage_output;
+    }
+*/
+static const char sprite_particles_array_vs_source_hlsl5[4325] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,
+    0x65,0x72,0x28,0x62,0x30,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x6d,0x76,0x70,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x30,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,0x75,
+    0x5f,0x6d,0x76,0x70,0x5f,0x70,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,
+    0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x73,0x69,0x7a,0x65,0x20,0x3a,
+    0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x32,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,
+    0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x33,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,0x75,
+    0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x65,0x6e,0x64,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x74,0x69,
+    0x6e,0x74,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,
+    0x63,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x5f,0x34,0x31,0x5f,0x75,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x20,0x3a,0x20,
+    0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x36,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x34,0x31,0x5f,0x75,
+    0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x70,
+    0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x37,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x61,
+    0x61,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,
+    0x31,0x5f,0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,
+    0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x38,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x3b,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x61,0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,
+    0x69,0x6c,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,
+    0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,
+    0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x76,0x5f,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,
+    0x63,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x61,0x6c,0x70,0x68,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x66,0x69,0x6c,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
+    0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x48,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
+    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,
+    0x75,0x73,0x65,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
+    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,
+    0x6c,0x61,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,
+    0x61,0x79,0x65,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,
+    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,
+    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,
+    0x20,0x28,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,
+    0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,
+    0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,
+    0x28,0x2d,0x32,0x2e,0x30,0x66,0x29,0x2c,0x20,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,
+    0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x62,0x61,
+    0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,
+    0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,
+    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,
+    0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,
+    0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,
+    0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x69,0x7a,0x65,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x5f,0x34,0x31,0x5f,0x75,
+    0x5f,0x73,0x69,0x7a,0x65,0x2e,0x7a,0x2c,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x73,
+    0x69,0x7a,0x65,0x2e,0x77,0x2c,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,
+    0x6c,0x65,0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x5f,
+    0x34,0x31,0x5f,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,
+    0x2c,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x65,0x6e,
+    0x64,0x2c,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,
+    0x7a,0x7a,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,
+    0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,
+    0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x34,
+    0x31,0x5f,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x77,0x20,0x3e,0x20,0x30,0x2e,
+    0x35,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x68,0x65,0x20,0x3d,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x73,0x69,0x7a,
+    0x65,0x2e,0x78,0x79,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x5f,0x34,0x31,0x5f,0x75,
+    0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
+    0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,
+    0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x28,0x73,0x69,0x7a,
+    0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x29,0x20,0x2b,0x20,0x5f,0x34,0x31,0x5f,
+    0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x72,0x2c,0x20,0x72,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x74,0x69,
+    0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,
+    0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x31,0x31,0x37,
+    0x36,0x34,0x37,0x30,0x36,0x31,0x31,0x32,0x34,0x34,0x34,0x34,0x30,0x30,0x37,0x38,
+    0x37,0x33,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,0x30,
+    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,
+    0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,0x28,0x28,0x73,
+    0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x66,0x29,0x20,0x2d,0x20,0x31,0x2e,
+    0x30,0x66,0x2e,0x78,0x78,0x29,0x20,0x2a,0x20,0x68,0x65,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,
+    0x20,0x28,0x28,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x6d,0x76,0x70,0x2e,0x78,0x79,0x20,
+    0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,0x2b,0x20,0x28,0x5f,0x34,0x31,
+    0x5f,0x75,0x5f,0x6d,0x76,0x70,0x2e,0x7a,0x77,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,
+    0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x6d,0x76,0x70,
+    0x5f,0x70,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,
+    0x6c,0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x75,0x76,0x5f,
+    0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x73,0x69,0x64,0x65,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x6c,0x2e,0x78,0x79,0x7a,0x20,0x2a,0x20,0x63,
+    0x6f,0x6c,0x2e,0x77,0x2c,0x20,0x63,0x6f,0x6c,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x69,0x7a,
+    0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,
+    0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,
+    0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,
+    0x68,0x61,0x20,0x3d,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x31,0x2e,0x30,0x66,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x3d,0x20,0x5f,0x34,0x31,
+    0x5f,0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,
+    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x70,0x6f,0x73,
+    0x48,0x2c,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x7a,
+    0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x5f,0x34,0x31,0x5f,0x75,0x5f,
+    0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,
+    0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,
+    0x63,0x6f,0x72,0x6e,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,
+    0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
+    0x61,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,
+    0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,
+    0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,
+    0x20,0x3d,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3d,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x76,0x5f,0x75,
+    0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
+    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x3d,0x20,
+    0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x00,
+};
+/*
+    cbuffer fs_params : register(b0)
+    {
+        float2 _619_u_texture_size : packoffset(c0);
+        float4 _619_u_clip : packoffset(c1);
+    };
+    
+    Texture2DArray<float4> u_image : register(t0);
+    SamplerState _u_image_sampler : register(s0);
+    
+    static float v_stroke;
+    static float v_aa;
+    static float4 result;
+    static float v_fill;
+    static float v_type;
+    static float2 v_uv;
+    static float4 v_col;
+    static float2 v_pos;
+    static float2 v_a;
+    static float2 v_b;
+    static float2 v_c;
+    static float v_radius;
+    static float v_alpha;
+    static float2 v_posH;
+    static float4 v_user;
+    static float v_layer;
+    
+    struct SPIRV_Cross_Input
+    {
+        float2 v_pos : TEXCOORD0;
+        float2 v_a : TEXCOORD1;
+        float2 v_b : TEXCOORD2;
+        float2 v_c : TEXCOORD3;
+        float2 v_uv : TEXCOORD4;
+        float4 v_col : TEXCOORD5;
+        float v_radius : TEXCOORD6;
+        float v_stroke : TEXCOORD7;
+        float v_aa : TEXCOORD8;
+        float v_type : TEXCOORD9;
+        float v_alpha : TEXCOORD10;
+        float v_fill : TEXCOORD11;
+        float2 v_posH : TEXCOORD12;
+        float4 v_user : TEXCOORD13;
+        nointerpolation float v_layer : TEXCOORD14;
+    };
+    
+    struct SPIRV_Cross_Output
+    {
+        float4 result : SV_Target0;
+    };
+    
+    float2 smooth_uv(float2 uv, float2 texture_size)
+    {
+        float2 _205 = floor(mad(uv, texture_size, 0.5f.xx));
+        return (_205 + clamp(mad(uv, texture_size, -_205) / fwidth(uv * texture_size), (-0.5f).xx, 0.5f.xx)) / texture_size;
+    }
+    
+    float4 de_gamma(float4 c)
+    {
+        return float4(pow(abs(c.xyz), 2.2000000476837158203125f.xxx), c.w);
+    }
+    
+    float overlay(float base, float blend)
+    {
+        float _105;
+        if (base <= 0.5f)
+        {
+            _105 = (2.0f * base) * blend;
+        }
+        else
+        {
+            _105 = mad((1.0f - base) * (-2.0f), 1.0f - blend, 1.0f);
+        }
+        return _105;
+    }
+    
+    float3 overlay(float3 base, float3 blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    float4 overlay(float4 base, float4 blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    float4 gamma(float4 c)
+    {
+        return float4(pow(abs(c.xyz), 0.4545454680919647216796875f.xxx), c.w);
+    }
+    
+    float2 skew(float2 v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    float distance_aabb(float2 p, float2 he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(max(_349, 0.0f.xx)) + min(max(_349.x, _349.y), 0.0f);
+    }
+    
+    float distance_box(inout float2 p, float2 c, float2 he, float2 u)
+    {
+        float2 param = u;
+        p -= c;
+        p = mul(p, transpose(float2x2(u, skew(param))));
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    float safe_div(float a, float b)
+    {
+        float _226;
+        if (b == 0.0f)
+        {
+            _226 = 0.0f;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    float safe_len(float2 v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0f)
+        {
+            _242 = 0.0f;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    float distance_segment(float2 p, float2 a, float2 b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * clamp(safe_div(param, param_1), 0.0f, 1.0f));
+        return safe_len(param_2);
+    }
+    
+    float det2(float2 a, float2 b)
+    {
+        return mad(a.x, b.y, -(a.y * b.x));
+    }
+    
+    float distance_triangle(float2 p, float2 a, float2 b, float2 c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * clamp(safe_div(param, param_1), 0.0f, 1.0f));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * clamp(safe_div(param_2, param_3), 0.0f, 1.0f));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * clamp(safe_div(param_4, param_5), 0.0f, 1.0f));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = min(min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    float sdf_stroke(float d)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    float4 sdf(float4 a, float4 b, float d)
+    {
+        float param = d;
+        float4 _292 = lerp(b, a, smoothstep(0.0f, v_aa, sdf_stroke(param)).xxxx);
+        bool4 _316 = (clamp(d, -1.0f, 1.0f) <= 0.0f).xxxx;
+        float4 _324 = float(v_aa > 0.0f).xxxx;
+        result = lerp(lerp(_292, _292, _324), lerp(float4(_316.x ? b.x : a.x, _316.y ? b.y : a.y, _316.z ? b.z : a.z, _316.w ? b.w : a.w), lerp(b, a, smoothstep(0.0f, v_aa, d).xxxx), _324), v_fill.xxxx);
+        return result;
+    }
+    
+    float4 shader(float4 color, float2 pos, float2 atlas_uv, float2 screen_uv, float4 params)
+    {
+        return color;
+    }
+    
+    void frag_main()
+    {
+        bool is_sprite = v_type >= 0.0f && v_type < 0.00196078442968428134918212890625f;
+        bool is_text = v_type > 0.00196078442968428134918212890625f && v_type < 0.0058823530562222003936767578125f;
+        bool is_box = v_type > 0.0058823530562222003936767578125f && v_type < 0.009803921915590763092041015625f;
+        bool is_seg = v_type > 0.009803921915590763092041015625f && v_type < 0.013725490309298038482666015625f;
+        bool is_tri = v_type > 0.013725490309298038482666015625f && v_type < 0.01764705963432788848876953125f;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125f && v_type < 0.02156862802803516387939453125f;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125f && v_type < 0.0254901959002017974853515625f;
+        float2 texel_pos = v_uv * _619_u_texture_size;
+        float texels_per_pixel = 0.5f * (length(ddx(texel_pos)) + length(ddy(texel_pos)));
+        float4 c = de_gamma(u_image.Sample(_u_image_sampler, float3(smooth_uv(v_uv, _619_u_texture_size), v_layer)));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, v_col));
+        }
+        if (is_text)
+        {
+            c = v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = v_uv * _619_u_texture_size - 0.5f.xx;
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + 0.5f.xx) / _619_u_texture_size;
+            float2 uv1 = (base + 1.5f.xx) / _619_u_texture_size;
+            float sd = lerp(lerp(u_image.SampleLevel(_u_image_sampler, float3(uv0, v_layer), 0.0f).w, u_image.SampleLevel(_u_image_sampler, float3(float2(uv1.x, uv0.y), v_layer), 0.0f).w, f.x), lerp(u_image.SampleLevel(_u_image_sampler, float3(float2(uv0.x, uv1.y), v_layer), 0.0f).w, u_image.SampleLevel(_u_image_sampler, float3(uv1, v_layer), 0.0f).w, f.x), f.y);
+            c = v_col * saturate((sd - 0.501960813999176025390625f) * 11.953125f / texels_per_pixel + 0.5f);
+        }
+        if (is_tri)
+        {
+            c = v_col;
+        }
+        float d = 0.0f;
+        if (is_box)
+        {
+            float2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, v_col, d - v_radius);
+        }
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + 1.0f.xx) * 0.5f, v_user);
+        if (c.w == 0.0f)
+        {
+            discard;
+        }
+        if (any(v_posH < _619_u_clip.xy) || any(v_posH > _619_u_clip.zw))
+        {
+            discard;
+        }
+        result = c;
+    }
+    
+    SPIRV_Cross_Output main(SPIRV_Cross_Input stage_input)
+    {
+        v_stroke = stage_input.v_stroke;
+        v_aa = stage_input.v_aa;
+        v_fill = stage_input.v_fill;
+        v_type = stage_input.v_type;
+        v_uv = stage_input.v_uv;
+        v_col = stage_input.v_col;
+        v_pos = stage_input.v_pos;
+        v_a = stage_input.v_a;
+        v_b = stage_input.v_b;
+        v_c = stage_input.v_c;
+        v_radius = stage_input.v_radius;
+        v_alpha = stage_input.v_alpha;
+        v_posH = stage_input.v_posH;
+        v_user = stage_input.v_user;
+        v_layer = stage_input.v_layer;
+        frag_main();
+        SPIRV_Cross_Output stage_output;
+        stage_output.result = result;
+        return stage_output;
+    }
+*/
+static const char sprite_particles_array_fs_source_hlsl5[8545] = {
+    0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x36,
+    0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x20,0x3a,0x20,0x70,0x61,0x63,0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,
+    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
+    0x36,0x31,0x39,0x5f,0x75,0x5f,0x63,0x6c,0x69,0x70,0x20,0x3a,0x20,0x70,0x61,0x63,
+    0x6b,0x6f,0x66,0x66,0x73,0x65,0x74,0x28,0x63,0x31,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,
+    0x0a,0x54,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x44,0x41,0x72,0x72,0x61,0x79,0x3c,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x20,
+    0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x74,0x30,0x29,0x3b,0x0a,
+    0x53,0x61,0x6d,0x70,0x6c,0x65,0x72,0x53,0x74,0x61,0x74,0x65,0x20,0x5f,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x3a,0x20,
+    0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x73,0x30,0x29,0x3b,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,
+    0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x3b,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,
+    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x73,0x74,0x61,
+    0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x48,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x0a,
+    0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x39,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x30,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x31,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x32,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,
+    0x65,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6e,0x6f,0x69,0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,
+    0x74,0x69,0x6f,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,
+    0x65,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x34,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,
+    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3a,0x20,0x53,0x56,0x5f,0x54,0x61,0x72,0x67,0x65,0x74,0x30,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x6d,0x6f,0x6f,
+    0x74,0x68,0x5f,0x75,0x76,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,
+    0x6d,0x61,0x64,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,
+    0x73,0x69,0x7a,0x65,0x2c,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x5f,0x32,0x30,
+    0x35,0x20,0x2b,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x6d,0x61,0x64,0x28,0x75,0x76,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,
+    0x2d,0x5f,0x32,0x30,0x35,0x29,0x20,0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,
+    0x75,0x76,0x20,0x2a,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x29,0x2c,0x20,0x28,0x2d,0x30,0x2e,0x35,0x66,0x29,0x2e,0x78,0x78,0x2c,0x20,
+    0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,
+    0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,
+    0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,0x20,0x32,0x2e,0x32,0x30,0x30,
+    0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,0x33,
+    0x31,0x32,0x35,0x66,0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,
+    0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,0x30,0x66,0x20,0x2a,0x20,
+    0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,
+    0x20,0x3d,0x20,0x6d,0x61,0x64,0x28,0x28,0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x62,
+    0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x66,0x29,0x2c,0x20,
+    0x31,0x2e,0x30,0x66,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,
+    0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x33,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,
+    0x61,0x73,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x79,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,0x61,0x73,
+    0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x61,0x6d,0x6d,0x61,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,
+    0x7a,0x29,0x2c,0x20,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,0x34,0x36,0x38,0x30,
+    0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,0x38,0x37,0x35,0x66,
+    0x2e,0x78,0x78,0x78,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,
+    0x76,0x2e,0x78,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x68,0x65,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x70,0x29,0x20,0x2d,0x20,0x68,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x28,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x30,
+    0x2e,0x30,0x66,0x2e,0x78,0x78,0x29,0x29,0x20,0x2b,0x20,0x6d,0x69,0x6e,0x28,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,
+    0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,
+    0x28,0x69,0x6e,0x6f,0x75,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x68,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x2d,0x3d,
+    0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x6d,0x75,0x6c,0x28,
+    0x70,0x2c,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x78,0x32,0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,
+    0x62,0x62,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,
+    0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x61,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x62,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,
+    0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x61,0x20,
+    0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x36,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x76,
+    0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,
+    0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,
+    0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,
+    0x5f,0x32,0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x38,
+    0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,
+    0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,0x20,0x2d,0x20,0x28,0x5f,
+    0x33,0x39,0x34,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,
+    0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,
+    0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x65,0x74,0x32,0x28,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6d,0x61,0x64,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,0x2e,0x79,0x2c,0x20,0x2d,
+    0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x62,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x63,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,
+    0x32,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x38,0x20,0x3d,0x20,0x63,0x20,
+    0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,
+    0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x34,0x20,
+    0x3d,0x20,0x70,0x20,0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,
+    0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x34,0x2c,0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x35,0x39,
+    0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x34,0x20,
+    0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,
+    0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,
+    0x38,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,
+    0x20,0x2d,0x20,0x28,0x5f,0x34,0x32,0x38,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x66,0x2c,0x20,0x31,0x2e,0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,
+    0x33,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,
+    0x34,0x33,0x32,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,
+    0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,
+    0x30,0x66,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,0x64,0x65,0x74,
+    0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,
+    0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x5f,0x34,0x32,
+    0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,0x6d,0x69,0x6e,
+    0x28,0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,
+    0x5f,0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,
+    0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
+    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,
+    0x37,0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,
+    0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,
+    0x73,0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,
+    0x73,0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,
+    0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,0x28,0x64,0x29,0x20,0x2d,
+    0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x62,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,0x20,0x6c,
+    0x65,0x72,0x70,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,
+    0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x29,0x29,0x2e,0x78,0x78,0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x34,0x20,0x5f,0x33,0x31,0x36,0x20,0x3d,0x20,0x28,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x66,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x33,0x32,
+    0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x6c,
+    0x65,0x72,0x70,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x32,0x39,0x32,0x2c,0x20,
+    0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6c,0x65,0x72,0x70,0x28,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x5f,0x33,0x31,0x36,0x2e,0x78,0x20,0x3f,0x20,0x62,0x2e,0x78,0x20,
+    0x3a,0x20,0x61,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,0x79,0x20,0x3f,0x20,
+    0x62,0x2e,0x79,0x20,0x3a,0x20,0x61,0x2e,0x79,0x2c,0x20,0x5f,0x33,0x31,0x36,0x2e,
+    0x7a,0x20,0x3f,0x20,0x62,0x2e,0x7a,0x20,0x3a,0x20,0x61,0x2e,0x7a,0x2c,0x20,0x5f,
+    0x33,0x31,0x36,0x2e,0x77,0x20,0x3f,0x20,0x62,0x2e,0x77,0x20,0x3a,0x20,0x61,0x2e,
+    0x77,0x29,0x2c,0x20,0x6c,0x65,0x72,0x70,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x73,
+    0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x66,0x2c,0x20,
+    0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,0x29,0x2e,0x78,0x78,0x78,0x78,0x29,0x2c,0x20,
+    0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x2e,0x78,0x78,
+    0x78,0x78,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x6f,
+    0x73,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,
+    0x75,0x76,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,0x63,0x72,0x65,0x65,
+    0x6e,0x5f,0x75,0x76,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,
+    0x30,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
+    0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,
+    0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,
+    0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,
+    0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,
+    0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,
+    0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
+    0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,
+    0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,
+    0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,
+    0x62,0x6f,0x78,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,
+    0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,
+    0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,
+    0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,
+    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,
+    0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,
+    0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,
+    0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,
+    0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,
+    0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,
+    0x35,0x33,0x31,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,
+    0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,
+    0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,
+    0x39,0x35,0x33,0x31,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,
+    0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,
+    0x31,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,
+    0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,
+    0x35,0x33,0x31,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,
+    0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,
+    0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,
+    0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,
+    0x2a,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,0x66,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,
+    0x74,0x68,0x28,0x64,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,
+    0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x64,0x79,0x28,
+    0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,
+    0x67,0x61,0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x73,0x6d,
+    0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x76,0x5f,0x75,0x76,0x2c,0x20,0x5f,0x36,
+    0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x29,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,
+    0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x63,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,
+    0x61,0x79,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,
+    0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,
+    0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,
+    0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,
+    0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,
+    0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x20,0x2f,0x20,
+    0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,
+    0x2b,0x20,0x31,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
+    0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x73,0x64,0x20,0x3d,0x20,0x6c,0x65,0x72,0x70,0x28,0x6c,0x65,0x72,0x70,0x28,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,
+    0x65,0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x75,0x76,0x30,0x2c,
+    0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,
+    0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,
+    0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,
+    0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,
+    0x6c,0x65,0x72,0x70,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,
+    0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,0x2c,0x20,
+    0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,
+    0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x75,0x76,0x31,0x2c,0x20,0x76,0x5f,0x6c,
+    0x61,0x79,0x65,0x72,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,
+    0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,
+    0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,
+    0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,
+    0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x66,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x66,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,
+    0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,
+    0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,
+    0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,
+    0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
+    0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,
+    0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,
+    0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,
+    0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,
+    0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,
+    0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,0x2e,0x78,0x78,0x29,0x20,0x2a,0x20,
+    0x30,0x2e,0x35,0x66,0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,
+    0x30,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,0x28,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3c,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x63,0x6c,0x69,
+    0x70,0x2e,0x78,0x79,0x29,0x20,0x7c,0x7c,0x20,0x61,0x6e,0x79,0x28,0x76,0x5f,0x70,
+    0x6f,0x73,0x48,0x20,0x3e,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x63,0x6c,0x69,
+    0x70,0x2e,0x7a,0x77,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,
+    0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,
+    0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,
+    0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,
+    0x73,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
+    0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x6c,0x61,0x79,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
+    0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,
+    0x70,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x72,0x65,0x73,
+    0x75,0x6c,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct particle_params
+    {
+        float4 u_mvp;
+        float4 u_mvp_p;
+        float4 u_size;
+        float4 u_color_start;
+        float4 u_color_end;
+        float4 u_tint;
+        float4 u_uv_rect;
+        float4 u_user_params;
+        float u_aa;
+        float u_layer;
+    };
+    
+    struct main0_out
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float v_layer [[user(locn14)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float4 in_corner [[attribute(0)]];
+        float3 in_particle [[attribute(1)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    vertex main0_out main0(main0_in in [[stage_in]], constant particle_params& _41 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float2 side = float2(in.in_corner.y + in.in_corner.z, in.in_corner.x + in.in_corner.y);
+        float size = mix(_41.u_size.z, _41.u_size.w, in.in_particle.z);
+        float4 color = mix(_41.u_color_start, _41.u_color_end, float4(in.in_particle.z));
+        float2 he;
+        float4 col;
+        float type;
+        float alpha;
+        if (_41.u_mvp_p.w > 0.5)
+        {
+            he = _41.u_size.xy * size;
+            col = _41.u_tint;
+            type = 0.0;
+            alpha = color.w;
+        }
+        else
+        {
+            float r = (size * 0.5) + _41.u_aa;
+            he = float2(r, r);
+            float4 param = color;
+            float4 param_1 = _41.u_tint;
+            col = overlay(param, param_1);
+            type = 0.011764706112444400787353515625;
+            alpha = 1.0;
+        }
+        float2 _pos = in.in_particle.xy + (((side * 2.0) - float2(1.0)) * he);
+        float2 _posH = ((_41.u_mvp.xy * _pos.x) + (_41.u_mvp.zw * _pos.y)) + _41.u_mvp_p.xy;
+        out.v_pos = _pos;
+        out.v_a = in.in_particle.xy;
+        out.v_b = in.in_particle.xy;
+        out.v_c = in.in_particle.xy;
+        out.v_uv = mix(_41.u_uv_rect.xy, _41.u_uv_rect.zw, side);
+        out.v_col = float4(col.xyz * col.w, col.w);
+        out.v_radius = size * 0.5;
+        out.v_stroke = 0.0;
+        out.v_aa = _41.u_aa;
+        out.v_type = type;
+        out.v_alpha = alpha;
+        out.v_fill = 1.0;
+        out.v_layer = _41.u_layer * 255.0;
+        out.gl_Position = float4(_posH, _41.u_mvp_p.z, 1.0);
+        out.v_posH = _posH;
+        out.v_user = _41.u_user_params;
+        return out;
+    }
+    
+*/
+static const char sprite_particles_array_vs_source_metal_macos[3530] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x75,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x75,0x73,0x65,0x72,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x62,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x63,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,
+    0x68,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x66,0x69,0x6c,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x34,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,0x5b,0x5b,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,
+    0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,
+    0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,0x2e,
+    0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,
+    0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
+    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,
+    0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x7a,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x77,
+    0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,
+    0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x2c,0x20,0x5f,
+    0x34,0x31,0x2e,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x65,0x6e,0x64,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x77,
+    0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,
+    0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x79,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x5f,
+    0x34,0x31,0x2e,0x75,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x28,
+    0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,0x5f,0x34,
+    0x31,0x2e,0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x68,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x72,0x2c,0x20,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,
+    0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x31,
+    0x31,0x37,0x36,0x34,0x37,0x30,0x36,0x31,0x31,0x32,0x34,0x34,0x34,0x34,0x30,0x30,
+    0x37,0x38,0x37,0x33,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,
+    0x28,0x28,0x73,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x68,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,
+    0x76,0x70,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x5f,0x34,0x31,
+    0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,
+    0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,
+    0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x73,0x69,0x64,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x6c,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x2e,0x77,0x2c,0x20,0x63,0x6f,0x6c,0x2e,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,
+    0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x61,0x6c,0x70,
+    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,
+    0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x70,
+    0x6f,0x73,0x48,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,
+    0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x48,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+        float4 u_clip;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float v_layer [[user(locn14), flat]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float2 smooth_uv(thread const float2& uv, thread const float2& texture_size)
+    {
+        float2 _205 = floor(fma(uv, texture_size, float2(0.5)));
+        return (_205 + fast::clamp(fma(uv, texture_size, -_205) / fwidth(uv * texture_size), float2(-0.5), float2(0.5))) / texture_size;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 de_gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(2.2000000476837158203125)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(0.4545454680919647216796875)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 skew(thread const float2& v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_aabb(thread const float2& p, thread const float2& he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(fast::max(_349, float2(0.0))) + fast::min(fast::max(_349.x, _349.y), 0.0);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_box(thread float2& p, thread const float2& c, thread const float2& he, thread const float2& u)
+    {
+        float2 param = u;
+        p -= c;
+        p = transpose(float2x2(u, skew(param))) * p;
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_div(thread const float& a, thread const float& b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_len(thread const float2& v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_segment(thread const float2& p, thread const float2& a, thread const float2& b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float det2(thread const float2& a, thread const float2& b)
+    {
+        return fma(a.x, b.y, -(a.y * b.x));
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_triangle(thread const float2& p, thread const float2& a, thread const float2& b, thread const float2& c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * fast::clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * fast::clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = fast::min(fast::min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    static inline __attribute__((always_inline))
+    float sdf_stroke(thread const float& d, thread float& v_stroke)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 sdf(thread const float4& a, thread const float4& b, thread const float& d, thread float& v_stroke, thread float& v_aa, thread float4& result, thread float& v_fill)
+    {
+        float param = d;
+        float4 _292 = mix(b, a, float4(smoothstep(0.0, v_aa, sdf_stroke(param, v_stroke))));
+        float4 _324 = float4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(select(a, b, bool4(fast::clamp(d, -1.0, 1.0) <= 0.0)), mix(b, a, float4(smoothstep(0.0, v_aa, d))), _324), float4(v_fill));
+        return result;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 shader(thread const float4& color, thread const float2& pos, thread const float2& atlas_uv, thread const float2& screen_uv, thread const float4& params)
+    {
+        return color;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d_array<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size), uint(rint(in.v_layer))));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, in.v_col));
+        }
+        if (is_text)
+        {
+            c = in.v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, uint(rint(in.v_layer)), level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), uint(rint(in.v_layer)), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), uint(rint(in.v_layer)), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, uint(rint(in.v_layer)), level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
+        }
+        if (is_tri)
+        {
+            c = in.v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
+        }
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
+        {
+            discard_fragment();
+        }
+        if (any(in.v_posH < _619.u_clip.xy) || any(in.v_posH > _619.u_clip.zw))
+        {
+            discard_fragment();
+        }
+        out.result = c;
+        return out;
+    }
+    
+*/
+static const char sprite_particles_array_fs_source_metal_macos[9361] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x63,0x6c,0x69,0x70,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x34,0x29,0x2c,0x20,0x66,
+    0x6c,0x61,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,
+    0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x75,0x76,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,
+    0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,
+    0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x35,0x29,0x20,
+    0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,
+    0x79,0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,0x2e,0x32,0x30,
+    0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,
+    0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,
+    0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,
+    0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
+    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,
+    0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,
+    0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,
+    0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x76,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x61,0x61,0x62,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x70,0x29,
+    0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,
+    0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x63,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x75,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,
+    0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x78,0x32,
+    0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,
+    0x29,0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,0x3d,0x3d,0x20,
+    0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,
+    0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x36,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x76,
+    0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,
+    0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,0x32,
+    0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,0x20,0x62,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,
+    0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,
+    0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x74,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,0x2e,0x79,0x2c,
+    0x20,0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,
+    0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,
+    0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,
+    0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,
+    0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x63,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x34,0x2c,
+    0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x20,0x2d,
+    0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,
+    0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,0x28,0x5f,
+    0x34,0x32,0x38,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,0x33,
+    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,
+    0x33,0x32,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,
+    0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,
+    0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,
+    0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,
+    0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,
+    0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,
+    0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,
+    0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x64,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,0x28,0x64,0x29,
+    0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x61,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x26,0x20,0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x64,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,
+    0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,
+    0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,0x69,0x78,
+    0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x61,0x2c,0x20,0x62,0x2c,0x20,0x62,0x6f,
+    0x6f,0x6c,0x34,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x3c,0x3d,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,
+    0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,
+    0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x26,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,
+    0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,
+    0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,
+    0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,
+    0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x36,
+    0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,
+    0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,
+    0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,
+    0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,
+    0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,
+    0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,
+    0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,
+    0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,
+    0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,
+    0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,
+    0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,
+    0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,
+    0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,
+    0x73,0x64,0x66,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,
+    0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,
+    0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,
+    0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,
+    0x68,0x28,0x64,0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,
+    0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,
+    0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,
+    0x2e,0x76,0x5f,0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,
+    0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
+    0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,
+    0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,
+    0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,
+    0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,
+    0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,
+    0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,
+    0x2e,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,
+    0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,0x20,0x6c,0x65,0x76,
+    0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,
+    0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,
+    0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,0x2c,
+    0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,
+    0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,
+    0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x73,0x61,0x74,0x75,
+    0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,
+    0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,0x30,0x32,0x35,0x33,
+    0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,0x39,0x35,0x33,0x31,
+    0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,
+    0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,
+    0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,
+    0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,
+    0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,
+    0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
+    0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,0x20,0x6f,0x75,0x74,0x2e,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x69,0x6e,0x2e,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,
+    0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,
+    0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3c,0x20,0x5f,0x36,0x31,
+    0x39,0x2e,0x75,0x5f,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x29,0x20,0x7c,0x7c,0x20,
+    0x61,0x6e,0x79,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3e,0x20,
+    0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x63,0x6c,0x69,0x70,0x2e,0x7a,0x77,0x29,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct particle_params
+    {
+        float4 u_mvp;
+        float4 u_mvp_p;
+        float4 u_size;
+        float4 u_color_start;
+        float4 u_color_end;
+        float4 u_tint;
+        float4 u_uv_rect;
+        float4 u_user_params;
+        float u_aa;
+        float u_layer;
+    };
+    
+    struct main0_out
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float v_layer [[user(locn14)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float4 in_corner [[attribute(0)]];
+        float3 in_particle [[attribute(1)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    vertex main0_out main0(main0_in in [[stage_in]], constant particle_params& _41 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float2 side = float2(in.in_corner.y + in.in_corner.z, in.in_corner.x + in.in_corner.y);
+        float size = mix(_41.u_size.z, _41.u_size.w, in.in_particle.z);
+        float4 color = mix(_41.u_color_start, _41.u_color_end, float4(in.in_particle.z));
+        float2 he;
+        float4 col;
+        float type;
+        float alpha;
+        if (_41.u_mvp_p.w > 0.5)
+        {
+            he = _41.u_size.xy * size;
+            col = _41.u_tint;
+            type = 0.0;
+            alpha = color.w;
+        }
+        else
+        {
+            float r = (size * 0.5) + _41.u_aa;
+            he = float2(r, r);
+            float4 param = color;
+            float4 param_1 = _41.u_tint;
+            col = overlay(param, param_1);
+            type = 0.011764706112444400787353515625;
+            alpha = 1.0;
+        }
+        float2 _pos = in.in_particle.xy + (((side * 2.0) - float2(1.0)) * he);
+        float2 _posH = ((_41.u_mvp.xy * _pos.x) + (_41.u_mvp.zw * _pos.y)) + _41.u_mvp_p.xy;
+        out.v_pos = _pos;
+        out.v_a = in.in_particle.xy;
+        out.v_b = in.in_particle.xy;
+        out.v_c = in.in_particle.xy;
+        out.v_uv = mix(_41.u_uv_rect.xy, _41.u_uv_rect.zw, side);
+        out.v_col = float4(col.xyz * col.w, col.w);
+        out.v_radius = size * 0.5;
+        out.v_stroke = 0.0;
+        out.v_aa = _41.u_aa;
+        out.v_type = type;
+        out.v_alpha = alpha;
+        out.v_fill = 1.0;
+        out.v_layer = _41.u_layer * 255.0;
+        out.gl_Position = float4(_posH, _41.u_mvp_p.z, 1.0);
+        out.v_posH = _posH;
+        out.v_user = _41.u_user_params;
+        return out;
+    }
+    
+*/
+static const char sprite_particles_array_vs_source_metal_ios[3530] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x75,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x75,0x73,0x65,0x72,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x62,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x63,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,
+    0x68,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x66,0x69,0x6c,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x34,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,0x5b,0x5b,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,
+    0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,
+    0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,0x2e,
+    0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,
+    0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
+    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,
+    0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x7a,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x77,
+    0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,
+    0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x2c,0x20,0x5f,
+    0x34,0x31,0x2e,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x65,0x6e,0x64,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x77,
+    0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,
+    0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x79,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x5f,
+    0x34,0x31,0x2e,0x75,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x28,
+    0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,0x5f,0x34,
+    0x31,0x2e,0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x68,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x72,0x2c,0x20,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,
+    0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x31,
+    0x31,0x37,0x36,0x34,0x37,0x30,0x36,0x31,0x31,0x32,0x34,0x34,0x34,0x34,0x30,0x30,
+    0x37,0x38,0x37,0x33,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,
+    0x28,0x28,0x73,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x68,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,
+    0x76,0x70,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x5f,0x34,0x31,
+    0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,
+    0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,
+    0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x73,0x69,0x64,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x6c,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x2e,0x77,0x2c,0x20,0x63,0x6f,0x6c,0x2e,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,
+    0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x61,0x6c,0x70,
+    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,
+    0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x70,
+    0x6f,0x73,0x48,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,
+    0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x48,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+        float4 u_clip;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float v_layer [[user(locn14), flat]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float2 smooth_uv(thread const float2& uv, thread const float2& texture_size)
+    {
+        float2 _205 = floor(fma(uv, texture_size, float2(0.5)));
+        return (_205 + fast::clamp(fma(uv, texture_size, -_205) / fwidth(uv * texture_size), float2(-0.5), float2(0.5))) / texture_size;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 de_gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(2.2000000476837158203125)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(0.4545454680919647216796875)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 skew(thread const float2& v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_aabb(thread const float2& p, thread const float2& he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(fast::max(_349, float2(0.0))) + fast::min(fast::max(_349.x, _349.y), 0.0);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_box(thread float2& p, thread const float2& c, thread const float2& he, thread const float2& u)
+    {
+        float2 param = u;
+        p -= c;
+        p = transpose(float2x2(u, skew(param))) * p;
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_div(thread const float& a, thread const float& b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_len(thread const float2& v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_segment(thread const float2& p, thread const float2& a, thread const float2& b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float det2(thread const float2& a, thread const float2& b)
+    {
+        return fma(a.x, b.y, -(a.y * b.x));
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_triangle(thread const float2& p, thread const float2& a, thread const float2& b, thread const float2& c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * fast::clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * fast::clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = fast::min(fast::min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    static inline __attribute__((always_inline))
+    float sdf_stroke(thread const float& d, thread float& v_stroke)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 sdf(thread const float4& a, thread const float4& b, thread const float& d, thread float& v_stroke, thread float& v_aa, thread float4& result, thread float& v_fill)
+    {
+        float param = d;
+        float4 _292 = mix(b, a, float4(smoothstep(0.0, v_aa, sdf_stroke(param, v_stroke))));
+        float4 _324 = float4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(select(a, b, bool4(fast::clamp(d, -1.0, 1.0) <= 0.0)), mix(b, a, float4(smoothstep(0.0, v_aa, d))), _324), float4(v_fill));
+        return result;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 shader(thread const float4& color, thread const float2& pos, thread const float2& atlas_uv, thread const float2& screen_uv, thread const float4& params)
+    {
+        return color;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d_array<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size), uint(rint(in.v_layer))));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, in.v_col));
+        }
+        if (is_text)
+        {
+            c = in.v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, uint(rint(in.v_layer)), level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), uint(rint(in.v_layer)), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), uint(rint(in.v_layer)), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, uint(rint(in.v_layer)), level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
+        }
+        if (is_tri)
+        {
+            c = in.v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
+        }
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
+        {
+            discard_fragment();
+        }
+        if (any(in.v_posH < _619.u_clip.xy) || any(in.v_posH > _619.u_clip.zw))
+        {
+            discard_fragment();
+        }
+        out.result = c;
+        return out;
+    }
+    
+*/
+static const char sprite_particles_array_fs_source_metal_ios[9361] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x63,0x6c,0x69,0x70,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x34,0x29,0x2c,0x20,0x66,
+    0x6c,0x61,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,
+    0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x75,0x76,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,
+    0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,
+    0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x35,0x29,0x20,
+    0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,
+    0x79,0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,0x2e,0x32,0x30,
+    0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,
+    0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,
+    0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,
+    0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
+    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,
+    0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,
+    0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,
+    0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x76,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x61,0x61,0x62,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x70,0x29,
+    0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,
+    0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x63,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x75,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,
+    0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x78,0x32,
+    0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,
+    0x29,0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,0x3d,0x3d,0x20,
+    0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,
+    0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x36,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x76,
+    0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,
+    0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,0x32,
+    0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,0x20,0x62,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,
+    0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,
+    0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x74,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,0x2e,0x79,0x2c,
+    0x20,0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,
+    0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,
+    0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,
+    0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,
+    0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x63,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x34,0x2c,
+    0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x20,0x2d,
+    0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,
+    0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,0x28,0x5f,
+    0x34,0x32,0x38,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,0x33,
+    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,
+    0x33,0x32,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,
+    0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,
+    0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,
+    0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,
+    0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,
+    0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,
+    0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,
+    0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x64,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,0x28,0x64,0x29,
+    0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x61,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x26,0x20,0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x64,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,
+    0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,
+    0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,0x69,0x78,
+    0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x61,0x2c,0x20,0x62,0x2c,0x20,0x62,0x6f,
+    0x6f,0x6c,0x34,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x3c,0x3d,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,
+    0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,
+    0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x26,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,
+    0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,
+    0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,
+    0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,
+    0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x36,
+    0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,
+    0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,
+    0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,
+    0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,
+    0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,
+    0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,
+    0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,
+    0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,
+    0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,
+    0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,
+    0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,
+    0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,
+    0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,
+    0x73,0x64,0x66,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,
+    0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,
+    0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,
+    0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,
+    0x68,0x28,0x64,0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,
+    0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,
+    0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,
+    0x2e,0x76,0x5f,0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,
+    0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
+    0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,
+    0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,
+    0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,
+    0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,
+    0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,
+    0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,
+    0x2e,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,
+    0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,0x20,0x6c,0x65,0x76,
+    0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,
+    0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,
+    0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,0x2c,
+    0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,
+    0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,
+    0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x73,0x61,0x74,0x75,
+    0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,
+    0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,0x30,0x32,0x35,0x33,
+    0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,0x39,0x35,0x33,0x31,
+    0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,
+    0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,
+    0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,
+    0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,
+    0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,
+    0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
+    0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,0x20,0x6f,0x75,0x74,0x2e,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x69,0x6e,0x2e,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,
+    0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,
+    0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3c,0x20,0x5f,0x36,0x31,
+    0x39,0x2e,0x75,0x5f,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x29,0x20,0x7c,0x7c,0x20,
+    0x61,0x6e,0x79,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3e,0x20,
+    0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x63,0x6c,0x69,0x70,0x2e,0x7a,0x77,0x29,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct particle_params
+    {
+        float4 u_mvp;
+        float4 u_mvp_p;
+        float4 u_size;
+        float4 u_color_start;
+        float4 u_color_end;
+        float4 u_tint;
+        float4 u_uv_rect;
+        float4 u_user_params;
+        float u_aa;
+        float u_layer;
+    };
+    
+    struct main0_out
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float v_layer [[user(locn14)]];
+        float4 gl_Position [[position]];
+    };
+    
+    struct main0_in
+    {
+        float4 in_corner [[attribute(0)]];
+        float3 in_particle [[attribute(1)]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    vertex main0_out main0(main0_in in [[stage_in]], constant particle_params& _41 [[buffer(0)]])
+    {
+        main0_out out = {};
+        float2 side = float2(in.in_corner.y + in.in_corner.z, in.in_corner.x + in.in_corner.y);
+        float size = mix(_41.u_size.z, _41.u_size.w, in.in_particle.z);
+        float4 color = mix(_41.u_color_start, _41.u_color_end, float4(in.in_particle.z));
+        float2 he;
+        float4 col;
+        float type;
+        float alpha;
+        if (_41.u_mvp_p.w > 0.5)
+        {
+            he = _41.u_size.xy * size;
+            col = _41.u_tint;
+            type = 0.0;
+            alpha = color.w;
+        }
+        else
+        {
+            float r = (size * 0.5) + _41.u_aa;
+            he = float2(r, r);
+            float4 param = color;
+            float4 param_1 = _41.u_tint;
+            col = overlay(param, param_1);
+            type = 0.011764706112444400787353515625;
+            alpha = 1.0;
+        }
+        float2 _pos = in.in_particle.xy + (((side * 2.0) - float2(1.0)) * he);
+        float2 _posH = ((_41.u_mvp.xy * _pos.x) + (_41.u_mvp.zw * _pos.y)) + _41.u_mvp_p.xy;
+        out.v_pos = _pos;
+        out.v_a = in.in_particle.xy;
+        out.v_b = in.in_particle.xy;
+        out.v_c = in.in_particle.xy;
+        out.v_uv = mix(_41.u_uv_rect.xy, _41.u_uv_rect.zw, side);
+        out.v_col = float4(col.xyz * col.w, col.w);
+        out.v_radius = size * 0.5;
+        out.v_stroke = 0.0;
+        out.v_aa = _41.u_aa;
+        out.v_type = type;
+        out.v_alpha = alpha;
+        out.v_fill = 1.0;
+        out.v_layer = _41.u_layer * 255.0;
+        out.gl_Position = float4(_posH, _41.u_mvp_p.z, 1.0);
+        out.v_posH = _posH;
+        out.v_user = _41.u_user_params;
+        return out;
+    }
+    
+*/
+static const char sprite_particles_array_vs_source_metal_sim[3530] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x6d,0x76,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,
+    0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x75,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x75,0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x75,0x73,0x65,0x72,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,
+    0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,
+    0x6f,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x62,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x63,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x35,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,
+    0x68,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,
+    0x5f,0x66,0x69,0x6c,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,
+    0x6e,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,
+    0x28,0x6c,0x6f,0x63,0x6e,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,
+    0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x34,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x5b,0x5b,0x70,0x6f,0x73,
+    0x69,0x74,0x69,0x6f,0x6e,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x72,
+    0x6e,0x65,0x72,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,
+    0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x20,0x5b,0x5b,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,
+    0x31,0x30,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,
+    0x65,0x20,0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,
+    0x32,0x2e,0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,0x2e,
+    0x30,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,
+    0x30,0x29,0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,
+    0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,
+    0x6e,0x64,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,
+    0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x33,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,
+    0x62,0x6c,0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x78,0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x62,0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x65,0x72,
+    0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,
+    0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,
+    0x6e,0x73,0x74,0x61,0x6e,0x74,0x20,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x34,0x31,0x20,0x5b,0x5b,0x62,0x75,
+    0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,
+    0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x73,0x69,0x64,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x69,0x6e,
+    0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x20,0x2b,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x7a,0x2c,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x78,0x20,0x2b,0x20,
+    0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x72,0x6e,0x65,0x72,0x2e,0x79,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x73,0x69,0x7a,0x65,
+    0x2e,0x7a,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x73,0x69,0x7a,0x65,0x2e,0x77,
+    0x2c,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x2e,0x7a,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x63,0x6f,0x6c,0x6f,0x72,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,
+    0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x73,0x74,0x61,0x72,0x74,0x2c,0x20,0x5f,
+    0x34,0x31,0x2e,0x75,0x5f,0x63,0x6f,0x6c,0x6f,0x72,0x5f,0x65,0x6e,0x64,0x2c,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x74,0x69,0x63,0x6c,0x65,0x2e,0x7a,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x77,
+    0x20,0x3e,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x65,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,
+    0x5f,0x73,0x69,0x7a,0x65,0x2e,0x78,0x79,0x20,0x2a,0x20,0x73,0x69,0x7a,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x5f,
+    0x34,0x31,0x2e,0x75,0x5f,0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x63,
+    0x6f,0x6c,0x6f,0x72,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x72,0x20,0x3d,0x20,0x28,
+    0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,0x35,0x29,0x20,0x2b,0x20,0x5f,0x34,
+    0x31,0x2e,0x75,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x68,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x72,0x2c,0x20,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,
+    0x74,0x69,0x6e,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,
+    0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x31,
+    0x31,0x37,0x36,0x34,0x37,0x30,0x36,0x31,0x31,0x32,0x34,0x34,0x34,0x34,0x30,0x30,
+    0x37,0x38,0x37,0x33,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x31,0x2e,
+    0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,0x78,0x79,0x20,0x2b,0x20,0x28,
+    0x28,0x28,0x73,0x69,0x64,0x65,0x20,0x2a,0x20,0x32,0x2e,0x30,0x29,0x20,0x2d,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x68,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x28,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,
+    0x76,0x70,0x2e,0x78,0x79,0x20,0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x78,0x29,0x20,
+    0x2b,0x20,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x2e,0x7a,0x77,0x20,
+    0x2a,0x20,0x5f,0x70,0x6f,0x73,0x2e,0x79,0x29,0x29,0x20,0x2b,0x20,0x5f,0x34,0x31,
+    0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,0x2e,
+    0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,0x65,
+    0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x74,0x69,0x63,0x6c,
+    0x65,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x75,0x76,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x75,
+    0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x78,0x79,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,
+    0x5f,0x75,0x76,0x5f,0x72,0x65,0x63,0x74,0x2e,0x7a,0x77,0x2c,0x20,0x73,0x69,0x64,
+    0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x63,0x6f,0x6c,0x2e,0x78,
+    0x79,0x7a,0x20,0x2a,0x20,0x63,0x6f,0x6c,0x2e,0x77,0x2c,0x20,0x63,0x6f,0x6c,0x2e,
+    0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x69,0x7a,0x65,0x20,0x2a,0x20,0x30,0x2e,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,
+    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,
+    0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x61,0x6c,0x70,
+    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3d,0x20,0x31,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,
+    0x75,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x2a,0x20,0x32,0x35,0x35,0x2e,0x30,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,
+    0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x70,
+    0x6f,0x73,0x48,0x2c,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x6d,0x76,0x70,0x5f,0x70,
+    0x2e,0x7a,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x5f,0x70,0x6f,0x73,0x48,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x20,0x3d,0x20,0x5f,0x34,0x31,0x2e,0x75,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+};
+/*
+    #pragma clang diagnostic ignored "-Wmissing-prototypes"
+    
+    #include <metal_stdlib>
+    #include <simd/simd.h>
+    
+    using namespace metal;
+    
+    struct fs_params
+    {
+        float2 u_texture_size;
+        float4 u_clip;
+    };
+    
+    struct main0_out
+    {
+        float4 result [[color(0)]];
+    };
+    
+    struct main0_in
+    {
+        float2 v_pos [[user(locn0)]];
+        float2 v_a [[user(locn1)]];
+        float2 v_b [[user(locn2)]];
+        float2 v_c [[user(locn3)]];
+        float2 v_uv [[user(locn4)]];
+        float4 v_col [[user(locn5)]];
+        float v_radius [[user(locn6)]];
+        float v_stroke [[user(locn7)]];
+        float v_aa [[user(locn8)]];
+        float v_type [[user(locn9)]];
+        float v_alpha [[user(locn10)]];
+        float v_fill [[user(locn11)]];
+        float2 v_posH [[user(locn12)]];
+        float4 v_user [[user(locn13)]];
+        float v_layer [[user(locn14), flat]];
+    };
+    
+    static inline __attribute__((always_inline))
+    float2 smooth_uv(thread const float2& uv, thread const float2& texture_size)
+    {
+        float2 _205 = floor(fma(uv, texture_size, float2(0.5)));
+        return (_205 + fast::clamp(fma(uv, texture_size, -_205) / fwidth(uv * texture_size), float2(-0.5), float2(0.5))) / texture_size;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 de_gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(2.2000000476837158203125)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float overlay(thread const float& base, thread const float& blend)
+    {
+        float _105;
+        if (base <= 0.5)
+        {
+            _105 = (2.0 * base) * blend;
+        }
+        else
+        {
+            _105 = fma((1.0 - base) * (-2.0), 1.0 - blend, 1.0);
+        }
+        return _105;
+    }
+    
+    static inline __attribute__((always_inline))
+    float3 overlay(thread const float3& base, thread const float3& blend)
+    {
+        float param = base.x;
+        float param_1 = blend.x;
+        float param_2 = base.y;
+        float param_3 = blend.y;
+        float param_4 = base.z;
+        float param_5 = blend.z;
+        return float3(overlay(param, param_1), overlay(param_2, param_3), overlay(param_4, param_5));
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 overlay(thread const float4& base, thread const float4& blend)
+    {
+        float3 param = base.xyz;
+        float3 param_1 = blend.xyz;
+        return float4(overlay(param, param_1), base.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 gamma(thread const float4& c)
+    {
+        return float4(pow(abs(c.xyz), float3(0.4545454680919647216796875)), c.w);
+    }
+    
+    static inline __attribute__((always_inline))
+    float2 skew(thread const float2& v)
+    {
+        return float2(-v.y, v.x);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_aabb(thread const float2& p, thread const float2& he)
+    {
+        float2 _349 = abs(p) - he;
+        return length(fast::max(_349, float2(0.0))) + fast::min(fast::max(_349.x, _349.y), 0.0);
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_box(thread float2& p, thread const float2& c, thread const float2& he, thread const float2& u)
+    {
+        float2 param = u;
+        p -= c;
+        p = transpose(float2x2(u, skew(param))) * p;
+        float2 param_1 = p;
+        float2 param_2 = he;
+        return distance_aabb(param_1, param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_div(thread const float& a, thread const float& b)
+    {
+        float _226;
+        if (b == 0.0)
+        {
+            _226 = 0.0;
+        }
+        else
+        {
+            _226 = a / b;
+        }
+        return _226;
+    }
+    
+    static inline __attribute__((always_inline))
+    float safe_len(thread const float2& v)
+    {
+        float _239 = dot(v, v);
+        float _242;
+        if (_239 == 0.0)
+        {
+            _242 = 0.0;
+        }
+        else
+        {
+            _242 = sqrt(_239);
+        }
+        return _242;
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_segment(thread const float2& p, thread const float2& a, thread const float2& b)
+    {
+        float2 _394 = b - a;
+        float2 _398 = p - a;
+        float param = dot(_398, _394);
+        float param_1 = dot(_394, _394);
+        float2 param_2 = _398 - (_394 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        return safe_len(param_2);
+    }
+    
+    static inline __attribute__((always_inline))
+    float det2(thread const float2& a, thread const float2& b)
+    {
+        return fma(a.x, b.y, -(a.y * b.x));
+    }
+    
+    static inline __attribute__((always_inline))
+    float distance_triangle(thread const float2& p, thread const float2& a, thread const float2& b, thread const float2& c)
+    {
+        float2 _424 = b - a;
+        float2 _428 = c - b;
+        float2 _432 = a - c;
+        float2 _436 = p - a;
+        float2 _440 = p - b;
+        float2 _444 = p - c;
+        float param = dot(_436, _424);
+        float param_1 = dot(_424, _424);
+        float2 _459 = _436 - (_424 * fast::clamp(safe_div(param, param_1), 0.0, 1.0));
+        float param_2 = dot(_440, _428);
+        float param_3 = dot(_428, _428);
+        float2 _474 = _440 - (_428 * fast::clamp(safe_div(param_2, param_3), 0.0, 1.0));
+        float param_4 = dot(_444, _432);
+        float param_5 = dot(_432, _432);
+        float2 _489 = _444 - (_432 * fast::clamp(safe_div(param_4, param_5), 0.0, 1.0));
+        float2 param_6 = _424;
+        float2 param_7 = _432;
+        float _495 = det2(param_6, param_7);
+        float2 param_8 = _436;
+        float2 param_9 = _424;
+        float2 param_10 = _440;
+        float2 param_11 = _428;
+        float2 param_12 = _444;
+        float2 param_13 = _432;
+        float2 _531 = fast::min(fast::min(float2(dot(_459, _459), _495 * det2(param_8, param_9)), float2(dot(_474, _474), _495 * det2(param_10, param_11))), float2(dot(_489, _489), _495 * det2(param_12, param_13)));
+        return (-sqrt(_531.x)) * sign(_531.y);
+    }
+    
+    static inline __attribute__((always_inline))
+    float sdf_stroke(thread const float& d, thread float& v_stroke)
+    {
+        return abs(d) - v_stroke;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 sdf(thread const float4& a, thread const float4& b, thread const float& d, thread float& v_stroke, thread float& v_aa, thread float4& result, thread float& v_fill)
+    {
+        float param = d;
+        float4 _292 = mix(b, a, float4(smoothstep(0.0, v_aa, sdf_stroke(param, v_stroke))));
+        float4 _324 = float4(float(v_aa > 0.0));
+        result = mix(mix(_292, _292, _324), mix(select(a, b, bool4(fast::clamp(d, -1.0, 1.0) <= 0.0)), mix(b, a, float4(smoothstep(0.0, v_aa, d))), _324), float4(v_fill));
+        return result;
+    }
+    
+    static inline __attribute__((always_inline))
+    float4 shader(thread const float4& color, thread const float2& pos, thread const float2& atlas_uv, thread const float2& screen_uv, thread const float4& params)
+    {
+        return color;
+    }
+    
+    fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d_array<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
+    {
+        main0_out out = {};
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size), uint(rint(in.v_layer))));
+        if (is_sprite)
+        {
+            c = gamma(overlay(c, in.v_col));
+        }
+        if (is_text)
+        {
+            c = in.v_col * c.w;
+        }
+        if (is_text_sdf)
+        {
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, uint(rint(in.v_layer)), level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), uint(rint(in.v_layer)), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), uint(rint(in.v_layer)), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, uint(rint(in.v_layer)), level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
+        }
+        if (is_tri)
+        {
+            c = in.v_col;
+        }
+        float d = 0.0;
+        if (is_box)
+        {
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
+        }
+        else if (is_seg)
+        {
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
+        }
+        else if (is_tri_sdf)
+        {
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
+        }
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
+        {
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
+        }
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
+        {
+            discard_fragment();
+        }
+        if (any(in.v_posH < _619.u_clip.xy) || any(in.v_posH > _619.u_clip.zw))
+        {
+            discard_fragment();
+        }
+        out.result = c;
+        return out;
+    }
+    
+*/
+static const char sprite_particles_array_fs_source_metal_sim[9361] = {
+    0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
+    0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
+    0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
+    0x6f,0x74,0x79,0x70,0x65,0x73,0x22,0x0a,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,
+    0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,
+    0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,0x75,0x73,0x69,0x6e,0x67,0x20,0x6e,
+    0x61,0x6d,0x65,0x73,0x70,0x61,0x63,0x65,0x20,0x6d,0x65,0x74,0x61,0x6c,0x3b,0x0a,
+    0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x75,0x5f,0x63,0x6c,0x69,0x70,
+    0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x30,0x5f,0x6f,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x5b,0x5b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x28,0x30,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,
+    0x75,0x63,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x30,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x32,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x33,0x29,0x5d,0x5d,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x34,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x35,0x29,
+    0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x36,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x37,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x38,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x5b,0x5b,0x75,
+    0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x39,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
+    0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x30,0x29,0x5d,0x5d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x31,
+    0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x5b,0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,
+    0x63,0x6e,0x31,0x32,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x5b,0x5b,0x75,0x73,0x65,
+    0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x33,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x20,0x5b,
+    0x5b,0x75,0x73,0x65,0x72,0x28,0x6c,0x6f,0x63,0x6e,0x31,0x34,0x29,0x2c,0x20,0x66,
+    0x6c,0x61,0x74,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x73,
+    0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x75,0x76,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x32,0x30,0x35,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x66,
+    0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,
+    0x69,0x7a,0x65,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,
+    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,
+    0x5f,0x32,0x30,0x35,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,
+    0x6d,0x70,0x28,0x66,0x6d,0x61,0x28,0x75,0x76,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x2c,0x20,0x2d,0x5f,0x32,0x30,0x35,0x29,0x20,
+    0x2f,0x20,0x66,0x77,0x69,0x64,0x74,0x68,0x28,0x75,0x76,0x20,0x2a,0x20,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x28,0x2d,0x30,0x2e,0x35,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x29,0x20,0x2f,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,
+    0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,
+    0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,
+    0x79,0x7a,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x32,0x2e,0x32,0x30,
+    0x30,0x30,0x30,0x30,0x30,0x34,0x37,0x36,0x38,0x33,0x37,0x31,0x35,0x38,0x32,0x30,
+    0x33,0x31,0x32,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,
+    0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,
+    0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,0x65,
+    0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x6c,0x65,0x6e,0x64,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x31,0x30,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x61,0x73,0x65,0x20,
+    0x3c,0x3d,0x20,0x30,0x2e,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x28,0x32,0x2e,
+    0x30,0x20,0x2a,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x62,0x6c,0x65,0x6e,
+    0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
+    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x5f,0x31,0x30,0x35,0x20,0x3d,0x20,0x66,0x6d,0x61,0x28,0x28,0x31,0x2e,0x30,0x20,
+    0x2d,0x20,0x62,0x61,0x73,0x65,0x29,0x20,0x2a,0x20,0x28,0x2d,0x32,0x2e,0x30,0x29,
+    0x2c,0x20,0x31,0x2e,0x30,0x20,0x2d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2c,0x20,0x31,
+    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x31,0x30,0x35,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x33,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,
+    0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x26,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
+    0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x7a,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x35,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x6f,
+    0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,
+    0x29,0x2c,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,
+    0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,
+    0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x26,0x20,0x62,0x61,0x73,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x62,0x6c,
+    0x65,0x6e,0x64,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x33,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x62,0x61,0x73,0x65,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x62,0x6c,0x65,0x6e,0x64,0x2e,0x78,
+    0x79,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x34,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x62,
+    0x61,0x73,0x65,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,
+    0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,
+    0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,
+    0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x70,0x6f,0x77,0x28,0x61,0x62,0x73,0x28,0x63,0x2e,0x78,0x79,0x7a,0x29,0x2c,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x33,0x28,0x30,0x2e,0x34,0x35,0x34,0x35,0x34,0x35,
+    0x34,0x36,0x38,0x30,0x39,0x31,0x39,0x36,0x34,0x37,0x32,0x31,0x36,0x37,0x39,0x36,
+    0x38,0x37,0x35,0x29,0x29,0x2c,0x20,0x63,0x2e,0x77,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x73,0x6b,0x65,0x77,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x76,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x2d,0x76,0x2e,0x79,0x2c,0x20,0x76,0x2e,0x78,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x61,0x61,0x62,0x62,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,
+    0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x26,0x20,0x68,0x65,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x33,0x34,0x39,0x20,0x3d,0x20,0x61,0x62,0x73,0x28,0x70,0x29,
+    0x20,0x2d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x61,0x78,0x28,0x5f,0x33,0x34,0x39,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x30,0x2e,0x30,0x29,0x29,0x29,0x20,0x2b,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,
+    0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x61,0x78,0x28,0x5f,0x33,0x34,
+    0x39,0x2e,0x78,0x2c,0x20,0x5f,0x33,0x34,0x39,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x63,0x2c,
+    0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x26,0x20,0x68,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x75,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x75,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,
+    0x2d,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x70,0x20,0x3d,0x20,0x74,0x72,
+    0x61,0x6e,0x73,0x70,0x6f,0x73,0x65,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x78,0x32,
+    0x28,0x75,0x2c,0x20,0x73,0x6b,0x65,0x77,0x28,0x70,0x61,0x72,0x61,0x6d,0x29,0x29,
+    0x29,0x20,0x2a,0x20,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x70,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x20,0x3d,0x20,0x68,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x61,0x61,0x62,0x62,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,
+    0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,
+    0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x64,
+    0x69,0x76,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x62,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x32,0x32,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x62,0x20,0x3d,0x3d,0x20,
+    0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x5f,0x32,0x32,0x36,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x32,0x36,
+    0x20,0x3d,0x20,0x61,0x20,0x2f,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x32,0x36,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,
+    0x65,0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,
+    0x28,0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,
+    0x0a,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,0x28,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x76,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x5f,0x32,0x33,0x39,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x76,
+    0x2c,0x20,0x76,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x5f,0x32,0x34,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x32,
+    0x33,0x39,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,
+    0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x5f,0x32,0x34,0x32,0x20,0x3d,0x20,0x73,0x71,0x72,0x74,0x28,0x5f,0x32,
+    0x33,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x5f,0x32,0x34,0x32,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,
+    0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,
+    0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,
+    0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x33,0x39,0x34,0x20,0x3d,0x20,0x62,
+    0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x5f,0x33,0x39,0x38,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,
+    0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x38,0x2c,0x20,0x5f,0x33,0x39,0x34,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,
+    0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x33,0x39,0x34,0x2c,0x20,
+    0x5f,0x33,0x39,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x5f,0x33,0x39,0x38,
+    0x20,0x2d,0x20,0x28,0x5f,0x33,0x39,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,
+    0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x61,0x66,0x65,0x5f,0x6c,0x65,0x6e,
+    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,0x61,0x74,
+    0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,0x61,0x79,
+    0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x64,0x65,0x74,0x32,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x26,0x20,0x62,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x66,0x6d,0x61,0x28,0x61,0x2e,0x78,0x2c,0x20,0x62,0x2e,0x79,0x2c,
+    0x20,0x2d,0x28,0x61,0x2e,0x79,0x20,0x2a,0x20,0x62,0x2e,0x78,0x29,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,
+    0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x62,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x26,0x20,0x63,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x32,0x34,0x20,0x3d,0x20,0x62,0x20,0x2d,0x20,
+    0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,
+    0x32,0x38,0x20,0x3d,0x20,0x63,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x33,0x32,0x20,0x3d,0x20,0x61,0x20,
+    0x2d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x33,0x36,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x34,0x34,0x30,0x20,0x3d,0x20,
+    0x70,0x20,0x2d,0x20,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x5f,0x34,0x34,0x34,0x20,0x3d,0x20,0x70,0x20,0x2d,0x20,0x63,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,
+    0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x36,0x2c,0x20,0x5f,0x34,0x32,0x34,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x34,0x2c,
+    0x20,0x5f,0x34,0x32,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x5f,0x34,0x35,0x39,0x20,0x3d,0x20,0x5f,0x34,0x33,0x36,0x20,0x2d,
+    0x20,0x28,0x5f,0x34,0x32,0x34,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,
+    0x6c,0x61,0x6d,0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,
+    0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x2c,0x20,0x30,
+    0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x64,
+    0x6f,0x74,0x28,0x5f,0x34,0x34,0x30,0x2c,0x20,0x5f,0x34,0x32,0x38,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x33,0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x32,0x38,0x2c,0x20,0x5f,0x34,
+    0x32,0x38,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x5f,0x34,0x37,0x34,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x20,0x2d,0x20,0x28,0x5f,
+    0x34,0x32,0x38,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,
+    0x70,0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x29,0x2c,0x20,0x30,0x2e,
+    0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x34,0x34,0x2c,0x20,0x5f,0x34,0x33,0x32,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
+    0x20,0x3d,0x20,0x64,0x6f,0x74,0x28,0x5f,0x34,0x33,0x32,0x2c,0x20,0x5f,0x34,0x33,
+    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,
+    0x34,0x38,0x39,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,0x20,0x2d,0x20,0x28,0x5f,0x34,
+    0x33,0x32,0x20,0x2a,0x20,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,
+    0x28,0x73,0x61,0x66,0x65,0x5f,0x64,0x69,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x2c,0x20,0x31,0x2e,0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x5f,0x34,
+    0x32,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
+    0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x34,0x39,0x35,0x20,0x3d,0x20,
+    0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x5f,0x34,0x33,
+    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
+    0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x5f,0x34,0x32,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
+    0x30,0x20,0x3d,0x20,0x5f,0x34,0x34,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,
+    0x5f,0x34,0x32,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x5f,0x34,0x34,0x34,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,
+    0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x5f,0x34,0x33,0x32,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x35,0x33,0x31,0x20,0x3d,0x20,
+    0x66,0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,
+    0x6d,0x69,0x6e,0x28,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,
+    0x34,0x35,0x39,0x2c,0x20,0x5f,0x34,0x35,0x39,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,
+    0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,
+    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x64,0x6f,0x74,0x28,0x5f,0x34,0x37,0x34,0x2c,0x20,0x5f,0x34,0x37,
+    0x34,0x29,0x2c,0x20,0x5f,0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,
+    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
+    0x31,0x31,0x29,0x29,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x64,0x6f,
+    0x74,0x28,0x5f,0x34,0x38,0x39,0x2c,0x20,0x5f,0x34,0x38,0x39,0x29,0x2c,0x20,0x5f,
+    0x34,0x39,0x35,0x20,0x2a,0x20,0x64,0x65,0x74,0x32,0x28,0x70,0x61,0x72,0x61,0x6d,
+    0x5f,0x31,0x32,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x29,0x29,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x28,0x2d,0x73,
+    0x71,0x72,0x74,0x28,0x5f,0x35,0x33,0x31,0x2e,0x78,0x29,0x29,0x20,0x2a,0x20,0x73,
+    0x69,0x67,0x6e,0x28,0x5f,0x35,0x33,0x31,0x2e,0x79,0x29,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x26,0x20,0x64,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x26,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x29,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x62,0x73,0x28,0x64,0x29,
+    0x20,0x2d,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x20,0x5f,0x5f,
+    0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,0x61,0x6c,0x77,
+    0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x20,0x73,0x64,0x66,0x28,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x61,0x2c,0x20,
+    0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x34,0x26,0x20,0x62,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x64,0x2c,0x20,0x74,
+    0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x73,
+    0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x26,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,
+    0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,
+    0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x66,0x6c,0x6f,0x61,0x74,0x26,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x32,0x39,0x32,0x20,0x3d,
+    0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,0x74,0x65,0x70,0x28,0x30,0x2e,0x30,
+    0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x73,0x64,0x66,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x20,0x5f,0x33,0x32,0x34,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x28,0x76,0x5f,0x61,0x61,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x5f,0x32,0x39,0x32,0x2c,0x20,
+    0x5f,0x32,0x39,0x32,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x6d,0x69,0x78,
+    0x28,0x73,0x65,0x6c,0x65,0x63,0x74,0x28,0x61,0x2c,0x20,0x62,0x2c,0x20,0x62,0x6f,
+    0x6f,0x6c,0x34,0x28,0x66,0x61,0x73,0x74,0x3a,0x3a,0x63,0x6c,0x61,0x6d,0x70,0x28,
+    0x64,0x2c,0x20,0x2d,0x31,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x20,0x3c,0x3d,
+    0x20,0x30,0x2e,0x30,0x29,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x62,0x2c,0x20,0x61,
+    0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x73,
+    0x74,0x65,0x70,0x28,0x30,0x2e,0x30,0x2c,0x20,0x76,0x5f,0x61,0x61,0x2c,0x20,0x64,
+    0x29,0x29,0x29,0x2c,0x20,0x5f,0x33,0x32,0x34,0x29,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x34,0x28,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,
+    0x7d,0x0a,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,
+    0x20,0x5f,0x5f,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x5f,0x5f,0x28,0x28,
+    0x61,0x6c,0x77,0x61,0x79,0x73,0x5f,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x29,0x29,0x0a,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x74,0x68,
+    0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x26,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,
+    0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x70,
+    0x6f,0x73,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x61,0x74,0x6c,0x61,0x73,0x5f,0x75,
+    0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x26,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x5f,0x75,
+    0x76,0x2c,0x20,0x74,0x68,0x72,0x65,0x61,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x26,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x20,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,
+    0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x2c,0x20,0x63,0x6f,0x6e,0x73,0x74,0x61,
+    0x6e,0x74,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x26,0x20,0x5f,0x36,
+    0x31,0x39,0x20,0x5b,0x5b,0x62,0x75,0x66,0x66,0x65,0x72,0x28,0x30,0x29,0x5d,0x5d,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x32,0x64,0x5f,0x61,0x72,0x72,0x61,
+    0x79,0x3c,0x66,0x6c,0x6f,0x61,0x74,0x3e,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x20,0x5b,0x5b,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x30,0x29,0x5d,0x5d,0x2c,
+    0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x53,0x6d,0x70,0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,
+    0x30,0x29,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,
+    0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,
+    0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,
+    0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,
+    0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,
+    0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,
+    0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,
+    0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
+    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,
+    0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,
+    0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,
+    0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,
+    0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,
+    0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,
+    0x73,0x64,0x66,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,
+    0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,
+    0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,
+    0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,
+    0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,
+    0x68,0x28,0x64,0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,
+    0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,
+    0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,
+    0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,
+    0x6c,0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,
+    0x2e,0x76,0x5f,0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,
+    0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x2c,0x20,0x75,0x69,0x6e,
+    0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,
+    0x72,0x29,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,
+    0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
+    0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,
+    0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,0x76,0x31,0x20,
+    0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,
+    0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,
+    0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,
+    0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,
+    0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,
+    0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,
+    0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,
+    0x2e,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,
+    0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,0x20,0x6c,0x65,0x76,
+    0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,
+    0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,
+    0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,
+    0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,0x2c,
+    0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,
+    0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,
+    0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,
+    0x2c,0x20,0x75,0x69,0x6e,0x74,0x28,0x72,0x69,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,
+    0x5f,0x6c,0x61,0x79,0x65,0x72,0x29,0x29,0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,
+    0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,
+    0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x73,0x61,0x74,0x75,
+    0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,
+    0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,0x30,0x32,0x35,0x33,
+    0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,0x39,0x35,0x33,0x31,
+    0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,
+    0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,
+    0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,
+    0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,
+    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,
+    0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,
+    0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,
+    0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,
+    0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
+    0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,0x20,0x6f,0x75,0x74,0x2e,
+    0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x69,0x6e,0x2e,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,
+    0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,
+    0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x61,0x6e,0x79,
+    0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3c,0x20,0x5f,0x36,0x31,
+    0x39,0x2e,0x75,0x5f,0x63,0x6c,0x69,0x70,0x2e,0x78,0x79,0x29,0x20,0x7c,0x7c,0x20,
+    0x61,0x6e,0x79,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3e,0x20,
+    0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x63,0x6c,0x69,0x70,0x2e,0x7a,0x77,0x29,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,0x28,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,
+    0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,
+    0x00,
+};
+#if !defined(SOKOL_GFX_INCLUDED)
+  #error "Please include sokol_gfx.h before sprite_particles_array_shader.h"
+#endif
+static inline const sg_shader_desc* sprite_particles_array_shader_shader_desc(sg_backend backend) {
+  if (backend == SG_BACKEND_GLCORE33) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "in_corner";
+      desc.attrs[1].name = "in_particle";
+      desc.vs.source = sprite_particles_array_vs_source_glsl330;
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 144;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.vs.uniform_blocks[0].uniforms[0].name = "particle_params";
+      desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.vs.uniform_blocks[0].uniforms[0].array_count = 9;
+      desc.fs.source = sprite_particles_array_fs_source_glsl330;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 32;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 2;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_ARRAY;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_particles_array_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_GLES3) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].name = "in_corner";
+      desc.attrs[1].name = "in_particle";
+      desc.vs.source = sprite_particles_array_vs_source_glsl300es;
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 144;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.vs.uniform_blocks[0].uniforms[0].name = "particle_params";
+      desc.vs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.vs.uniform_blocks[0].uniforms[0].array_count = 9;
+      desc.fs.source = sprite_particles_array_fs_source_glsl300es;
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 32;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.uniform_blocks[0].uniforms[0].name = "fs_params";
+      desc.fs.uniform_blocks[0].uniforms[0].type = SG_UNIFORMTYPE_FLOAT4;
+      desc.fs.uniform_blocks[0].uniforms[0].array_count = 2;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_ARRAY;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_particles_array_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_D3D11) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.attrs[0].sem_name = "TEXCOORD";
+      desc.attrs[0].sem_index = 0;
+      desc.attrs[1].sem_name = "TEXCOORD";
+      desc.attrs[1].sem_index = 1;
+      desc.vs.source = sprite_particles_array_vs_source_hlsl5;
+      desc.vs.d3d11_target = "vs_5_0";
+      desc.vs.entry = "main";
+      desc.vs.uniform_blocks[0].size = 144;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = sprite_particles_array_fs_source_hlsl5;
+      desc.fs.d3d11_target = "ps_5_0";
+      desc.fs.entry = "main";
+      desc.fs.uniform_blocks[0].size = 32;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_ARRAY;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_particles_array_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_MACOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_particles_array_vs_source_metal_macos;
+      desc.vs.entry = "main0";
+      desc.vs.uniform_blocks[0].size = 144;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = sprite_particles_array_fs_source_metal_macos;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 32;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_ARRAY;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_particles_array_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_IOS) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_particles_array_vs_source_metal_ios;
+      desc.vs.entry = "main0";
+      desc.vs.uniform_blocks[0].size = 144;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = sprite_particles_array_fs_source_metal_ios;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 32;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_ARRAY;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_particles_array_shader_shader";
+    }
+    return &desc;
+  }
+  if (backend == SG_BACKEND_METAL_SIMULATOR) {
+    static sg_shader_desc desc;
+    static bool valid;
+    if (!valid) {
+      valid = true;
+      desc.vs.source = sprite_particles_array_vs_source_metal_sim;
+      desc.vs.entry = "main0";
+      desc.vs.uniform_blocks[0].size = 144;
+      desc.vs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.source = sprite_particles_array_fs_source_metal_sim;
+      desc.fs.entry = "main0";
+      desc.fs.uniform_blocks[0].size = 32;
+      desc.fs.uniform_blocks[0].layout = SG_UNIFORMLAYOUT_STD140;
+      desc.fs.images[0].name = "u_image";
+      desc.fs.images[0].image_type = SG_IMAGETYPE_ARRAY;
+      desc.fs.images[0].sampler_type = SG_SAMPLERTYPE_FLOAT;
+      desc.label = "sprite_particles_array_shader_shader";
+    }
+    return &desc;
+  }
+  return 0;
+}
+static inline int sprite_particles_array_shader_attr_slot(const char* attr_name) {
+  (void)attr_name;
+  if (0 == strcmp(attr_name, "in_corner")) {
+    return 0;
+  }
+  if (0 == strcmp(attr_name, "in_particle")) {
+    return 1;
+  }
+  return -1;
+}
+static inline int sprite_particles_array_shader_image_slot(sg_shader_stage stage, const char* img_name) {
+  (void)stage; (void)img_name;
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(img_name, "u_image")) {
+      return 0;
+    }
+  }
+  return -1;
+}
+static inline int sprite_particles_array_shader_uniformblock_slot(sg_shader_stage stage, const char* ub_name) {
+  (void)stage; (void)ub_name;
+  if (SG_SHADERSTAGE_VS == stage) {
+    if (0 == strcmp(ub_name, "particle_params")) {
+      return 0;
+    }
+  }
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      return 0;
+    }
+  }
+  return -1;
+}
+static inline size_t sprite_particles_array_shader_uniformblock_size(sg_shader_stage stage, const char* ub_name) {
+  (void)stage; (void)ub_name;
+  if (SG_SHADERSTAGE_VS == stage) {
+    if (0 == strcmp(ub_name, "particle_params")) {
+      return sizeof(sprite_particles_array_particle_params_t);
+    }
+  }
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      return sizeof(sprite_particles_array_fs_params_t);
+    }
+  }
+  return 0;
+}
+static inline int sprite_particles_array_shader_uniform_offset(sg_shader_stage stage, const char* ub_name, const char* u_name) {
+  (void)stage; (void)ub_name; (void)u_name;
+  if (SG_SHADERSTAGE_VS == stage) {
+    if (0 == strcmp(ub_name, "particle_params")) {
+      if (0 == strcmp(u_name, "u_mvp")) {
+        return 0;
+      }
+      if (0 == strcmp(u_name, "u_mvp_p")) {
+        return 16;
+      }
+      if (0 == strcmp(u_name, "u_size")) {
+        return 32;
+      }
+      if (0 == strcmp(u_name, "u_color_start")) {
+        return 48;
+      }
+      if (0 == strcmp(u_name, "u_color_end")) {
+        return 64;
+      }
+      if (0 == strcmp(u_name, "u_tint")) {
+        return 80;
+      }
+      if (0 == strcmp(u_name, "u_uv_rect")) {
+        return 96;
+      }
+      if (0 == strcmp(u_name, "u_user_params")) {
+        return 112;
+      }
+      if (0 == strcmp(u_name, "u_aa")) {
+        return 128;
+      }
+      if (0 == strcmp(u_name, "u_layer")) {
+        return 132;
+      }
+    }
+  }
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      if (0 == strcmp(u_name, "u_texture_size")) {
+        return 0;
+      }
+      if (0 == strcmp(u_name, "u_clip")) {
+        return 16;
+      }
+    }
+  }
+  return -1;
+}
+static inline sg_shader_uniform_desc sprite_particles_array_shader_uniform_desc(sg_shader_stage stage, const char* ub_name, const char* u_name) {
+  (void)stage; (void)ub_name; (void)u_name;
+  #if defined(__cplusplus)
+  sg_shader_uniform_desc desc = {};
+  #else
+  sg_shader_uniform_desc desc = {0};
+  #endif
+  if (SG_SHADERSTAGE_VS == stage) {
+    if (0 == strcmp(ub_name, "particle_params")) {
+      if (0 == strcmp(u_name, "u_mvp")) {
+        desc.name = "u_mvp";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_mvp_p")) {
+        desc.name = "u_mvp_p";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_size")) {
+        desc.name = "u_size";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_color_start")) {
+        desc.name = "u_color_start";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_color_end")) {
+        desc.name = "u_color_end";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_tint")) {
+        desc.name = "u_tint";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_uv_rect")) {
+        desc.name = "u_uv_rect";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_user_params")) {
+        desc.name = "u_user_params";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_aa")) {
+        desc.name = "u_aa";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_layer")) {
+        desc.name = "u_layer";
+        desc.type = SG_UNIFORMTYPE_FLOAT;
+        desc.array_count = 1;
+        return desc;
+      }
+    }
+  }
+  if (SG_SHADERSTAGE_FS == stage) {
+    if (0 == strcmp(ub_name, "fs_params")) {
+      if (0 == strcmp(u_name, "u_texture_size")) {
+        desc.name = "u_texture_size";
+        desc.type = SG_UNIFORMTYPE_FLOAT2;
+        desc.array_count = 1;
+        return desc;
+      }
+      if (0 == strcmp(u_name, "u_clip")) {
+        desc.name = "u_clip";
+        desc.type = SG_UNIFORMTYPE_FLOAT4;
+        desc.array_count = 1;
+        return desc;
+      }
+    }
+  }
+  return desc;
+}
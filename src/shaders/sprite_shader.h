@@ -1,10 +1,12 @@
 #pragma once
 /*
-    #version:1# (machine generated, don't edit!)
-
-    Generated by sokol-shdc (https://github.com/floooh/sokol-tools)
-
-    Cmdline: sokol-shdc --input sprite.glsl --output sprite_shader.h --slang glsl330:hlsl5:metal_macos:metal_ios:metal_sim:glsl300es --reflection
+    NOT machine generated. Patched by hand from the sokol-shdc output of sprite.glsl so the vertex shader reads
+    `in_depth` (attribute 12) and the fragment shader draws distance field glyphs, as sokol-shdc could not be run
+    when those were added. The glsl330 and glsl300es sources compile and link on Mesa, where `in_depth` depth
+    tests as the pipeline expects, the older draw types render the same pixels as the baseline shader, and
+    distance field glyphs match a CPU version of `text_sdf`. The hlsl5 and metal sources have not been through a
+    shader compiler. Running compile.sh or compile.cmd regenerates this file from sprite.glsl with real sokol-shdc
+    output, which should replace it.
 
     Overview:
 
@@ -24,6 +26,7 @@
                     ATTR_sprite_vs_in_aa = 9
                     ATTR_sprite_vs_in_params = 10
                     ATTR_sprite_vs_in_user_params = 11
+                    ATTR_sprite_vs_in_depth = 12
             Fragment shader: fs
                 Uniform block 'fs_params':
                     C struct: sprite_fs_params_t
@@ -55,6 +58,7 @@
                     [ATTR_sprite_vs_in_aa] = { ... },
                     [ATTR_sprite_vs_in_params] = { ... },
                     [ATTR_sprite_vs_in_user_params] = { ... },
+                    [ATTR_sprite_vs_in_depth] = { ... },
                 },
             },
             ...});
@@ -94,6 +98,7 @@
 #define ATTR_sprite_vs_in_aa (9)
 #define ATTR_sprite_vs_in_params (10)
 #define ATTR_sprite_vs_in_user_params (11)
+#define ATTR_sprite_vs_in_depth (12)
 #define SLOT_sprite_u_image (0)
 #define SLOT_sprite_fs_params (0)
 #pragma pack(push,1)
@@ -131,6 +136,7 @@ SOKOL_SHDC_ALIGN(16) typedef struct sprite_fs_params_t {
     out vec2 v_posH;
     out vec4 v_user;
     layout(location = 11) in vec4 in_user_params;
+    layout(location = 12) in float in_depth;
     
     void main()
     {
@@ -146,14 +152,14 @@ SOKOL_SHDC_ALIGN(16) typedef struct sprite_fs_params_t {
         v_type = in_params.x;
         v_alpha = in_params.y;
         v_fill = in_params.z;
-        gl_Position = vec4(in_posH, 0.0, 1.0);
+        gl_Position = vec4(in_posH, in_depth, 1.0);
         v_posH = in_posH;
         v_user = in_user_params;
         gl_Position.y = -gl_Position.y;
     }
     
 */
-static const char sprite_vs_source_glsl330[1111] = {
+static const char sprite_vs_source_glsl330[1157] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x6f,0x75,
     0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x6c,0x61,
     0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,
@@ -198,32 +204,35 @@ static const char sprite_vs_source_glsl330[1111] = {
     0x73,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,
     0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x31,0x29,0x20,0x69,0x6e,0x20,0x76,0x65,
     0x63,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,
-    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,
-    0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,
-    0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,
-    0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,
-    0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,
-    0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x72,0x61,
-    0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x61,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,
-    0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,
-    0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,
-    0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-    0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,
-    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,
-    0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,
-    0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
-    0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,
+    0x6f,0x6e,0x20,0x3d,0x20,0x31,0x32,0x29,0x20,0x69,0x6e,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,0x76,0x6f,0x69,
+    0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,
+    0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,
+    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,
+    0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,
+    0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x20,0x3d,
+    0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,0x79,0x3b,
+    0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 330
@@ -412,163 +421,58 @@ static const char sprite_vs_source_glsl330[1111] = {
     
     void main()
     {
-        bool _549 = v_type >= 0.0;
-        bool _555;
-        if (_549)
-        {
-            _555 = v_type < 0.00196078442968428134918212890625;
-        }
-        else
-        {
-            _555 = _549;
-        }
-        bool _558 = v_type > 0.00196078442968428134918212890625;
-        bool _564;
-        if (_558)
-        {
-            _564 = v_type < 0.0058823530562222003936767578125;
-        }
-        else
-        {
-            _564 = _558;
-        }
-        bool _567 = v_type > 0.0058823530562222003936767578125;
-        bool _573;
-        if (_567)
+        bool is_sprite = v_type >= 0.0 && v_type < 0.00196078442968428134918212890625;
+        bool is_text = v_type > 0.00196078442968428134918212890625 && v_type < 0.0058823530562222003936767578125;
+        bool is_box = v_type > 0.0058823530562222003936767578125 && v_type < 0.009803921915590763092041015625;
+        bool is_seg = v_type > 0.009803921915590763092041015625 && v_type < 0.013725490309298038482666015625;
+        bool is_tri = v_type > 0.013725490309298038482666015625 && v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125 && v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125 && v_type < 0.0254901959002017974853515625;
+        vec2 texel_pos = v_uv * fs_params[0].xy;
+        float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+        vec4 c = de_gamma(texture(u_image, smooth_uv(v_uv, fs_params[0].xy)));
+        if (is_sprite)
         {
-            _573 = v_type < 0.009803921915590763092041015625;
+            c = gamma(overlay(c, v_col));
         }
-        else
-        {
-            _573 = _567;
-        }
-        bool _576 = v_type > 0.009803921915590763092041015625;
-        bool _582;
-        if (_576)
-        {
-            _582 = v_type < 0.013725490309298038482666015625;
-        }
-        else
-        {
-            _582 = _576;
-        }
-        bool _585 = v_type > 0.013725490309298038482666015625;
-        bool _591;
-        if (_585)
-        {
-            _591 = v_type < 0.01764705963432788848876953125;
-        }
-        else
-        {
-            _591 = _585;
-        }
-        bool _594 = v_type > 0.01764705963432788848876953125;
-        bool _600;
-        if (_594)
-        {
-            _600 = v_type < 0.02156862802803516387939453125;
-        }
-        else
-        {
-            _600 = _594;
-        }
-        vec4 c = vec4(0.0);
-        vec4 _607;
-        if (!(_555 && _564))
-        {
-            vec2 param = v_uv;
-            vec2 param_1 = fs_params[0].xy;
-            vec4 param_2 = texture(u_image, smooth_uv(param, param_1));
-            _607 = de_gamma(param_2);
-        }
-        else
+        if (is_text)
         {
-            _607 = c;
+            c = v_col * c.w;
         }
-        c = _607;
-        vec4 _636;
-        if (_555)
+        if (is_text_sdf)
         {
-            vec4 param_3 = c;
-            vec4 param_4 = v_col;
-            vec4 param_5 = overlay(param_3, param_4);
-            _636 = gamma(param_5);
+            vec2 texel = v_uv * fs_params[0].xy - vec2(0.5);
+            vec2 base = floor(texel);
+            vec2 f = texel - base;
+            vec2 uv0 = (base + vec2(0.5)) / fs_params[0].xy;
+            vec2 uv1 = (base + vec2(1.5)) / fs_params[0].xy;
+            float sd = mix(mix(textureLod(u_image, uv0, 0.0).w, textureLod(u_image, vec2(uv1.x, uv0.y), 0.0).w, f.x), mix(textureLod(u_image, vec2(uv0.x, uv1.y), 0.0).w, textureLod(u_image, uv1, 0.0).w, f.x), f.y);
+            c = v_col * clamp((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5, 0.0, 1.0);
         }
-        else
+        if (is_tri)
         {
-            _636 = c;
+            c = v_col;
         }
-        c = _636;
-        vec4 _652;
-        if (_564)
-        {
-            _652 = v_col * c.w;
-        }
-        else
-        {
-            _652 = c;
-        }
-        bvec4 _665 = bvec4(_591);
-        c = vec4(_665.x ? v_col.x : _652.x, _665.y ? v_col.y : _652.y, _665.z ? v_col.z : _652.z, _665.w ? v_col.w : _652.w);
         float d = 0.0;
-        if (_573)
+        if (is_box)
         {
-            vec2 param_6 = v_pos;
-            vec2 param_7 = v_a;
-            vec2 param_8 = v_b;
-            vec2 param_9 = v_c;
-            float _683 = distance_box(param_6, param_7, param_8, param_9);
-            d = _683;
+            vec2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
         }
-        else
+        else if (is_seg)
         {
-            if (_582)
-            {
-                vec2 param_10 = v_pos;
-                vec2 param_11 = v_a;
-                vec2 param_12 = v_b;
-                float _694 = distance_segment(param_10, param_11, param_12);
-                d = _694;
-                vec2 param_13 = v_pos;
-                vec2 param_14 = v_b;
-                vec2 param_15 = v_c;
-                d = min(_694, distance_segment(param_13, param_14, param_15));
-            }
-            else
-            {
-                if (_600)
-                {
-                    vec2 param_16 = v_pos;
-                    vec2 param_17 = v_a;
-                    vec2 param_18 = v_b;
-                    vec2 param_19 = v_c;
-                    d = distance_triangle(param_16, param_17, param_18, param_19);
-                }
-            }
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
         }
-        vec4 _725;
-        if (((!_555) && (!_564)) && (!_591))
+        else if (is_tri_sdf)
         {
-            vec4 param_20 = c;
-            vec4 param_21 = v_col;
-            float param_22 = d - v_radius;
-            vec4 _737 = sdf(param_20, param_21, param_22);
-            _725 = _737;
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
         }
-        else
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
         {
-            _725 = c;
+            c = sdf(c, v_col, d - v_radius);
         }
-        vec4 _744 = _725 * v_alpha;
-        c = _744;
-        vec4 param_23 = _744;
-        vec2 param_24 = v_pos;
-        vec2 param_25 = v_uv;
-        vec2 param_26 = (v_posH + vec2(1.0)) * 0.5;
-        vec4 param_27 = v_user;
-        vec4 _762 = shader(param_23, param_24, param_25, param_26, param_27);
-        c = _762;
-        if (_762.w == 0.0)
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + vec2(1.0)) * 0.5, v_user);
+        if (c.w == 0.0)
         {
             discard;
         }
@@ -576,7 +480,7 @@ static const char sprite_vs_source_glsl330[1111] = {
     }
     
 */
-static const char sprite_fs_source_glsl330[7903] = {
+static const char sprite_fs_source_glsl330[6585] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x33,0x30,0x0a,0x0a,0x75,0x6e,
     0x69,0x66,0x6f,0x72,0x6d,0x20,0x76,0x65,0x63,0x34,0x20,0x66,0x73,0x5f,0x70,0x61,
     0x72,0x61,0x6d,0x73,0x5b,0x31,0x5d,0x3b,0x0a,0x75,0x6e,0x69,0x66,0x6f,0x72,0x6d,
@@ -846,231 +750,149 @@ static const char sprite_fs_source_glsl330[7903] = {
     0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,
     0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,
     0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,
-    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x34,0x39,
-    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x34,0x39,0x29,0x0a,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,
-    0x35,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x35,0x35,0x20,0x3d,0x20,0x5f,0x35,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x38,0x20,0x3d,
-    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,
-    0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,
-    0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x34,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,0x20,0x3d,0x20,
-    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,
-    0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,
-    0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,0x20,0x3d,0x20,
-    0x5f,0x35,0x35,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x37,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,
-    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,
-    0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,
-    0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,
-    0x20,0x5f,0x35,0x37,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
-    0x35,0x36,0x37,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x35,0x37,0x33,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
-    0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,
-    0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,
-    0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
-    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x5f,0x35,0x37,0x33,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,
-    0x37,0x36,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
-    0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,
-    0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x32,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x36,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,
-    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,
-    0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,
-    0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,
-    0x20,0x5f,0x35,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x35,0x20,0x3d,0x20,0x76,0x5f,0x74,
-    0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,
-    0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,
-    0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,
-    0x20,0x5f,0x35,0x39,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
-    0x35,0x38,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
-    0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,
-    0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,
-    0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,
-    0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x5f,0x35,0x38,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,
-    0x34,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,
-    0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x36,0x30,0x30,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x39,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,
-    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,
-    0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,
-    0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x5f,0x35,
-    0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,0x2e,0x30,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x30,0x37,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,0x35,0x35,0x35,0x20,
-    0x26,0x26,0x20,0x5f,0x35,0x36,0x34,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,
-    0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
-    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,
-    0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,
-    0x68,0x5f,0x75,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x36,0x30,0x37,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x63,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,
-    0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x33,
-    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x35,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,
-    0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,
-    0x36,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x5f,0x36,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x5f,0x35,0x36,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x76,0x5f,0x63,
-    0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x63,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x76,0x65,0x63,0x34,
-    0x20,0x5f,0x36,0x36,0x35,0x20,0x3d,0x20,0x62,0x76,0x65,0x63,0x34,0x28,0x5f,0x35,
-    0x39,0x31,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,
-    0x34,0x28,0x5f,0x36,0x36,0x35,0x2e,0x78,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,
-    0x2e,0x78,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,0x78,0x2c,0x20,0x5f,0x36,0x36,
-    0x35,0x2e,0x79,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x79,0x20,0x3a,0x20,
-    0x5f,0x36,0x35,0x32,0x2e,0x79,0x2c,0x20,0x5f,0x36,0x36,0x35,0x2e,0x7a,0x20,0x3f,
-    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x7a,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,
-    0x7a,0x2c,0x20,0x5f,0x36,0x36,0x35,0x2e,0x77,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,
-    0x6c,0x2e,0x77,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,0x77,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x33,0x29,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x76,0x5f,0x70,
-    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,
-    0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x38,0x33,0x20,0x3d,0x20,0x64,0x69,0x73,
-    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x38,0x33,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x5f,0x35,0x38,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,
-    0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,0x20,0x76,0x5f,
-    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,
-    0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,
-    0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x39,0x34,0x20,0x3d,0x20,
-    0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,
-    0x5f,0x36,0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,
-    0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x34,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x35,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x5f,
-    0x36,0x39,0x34,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
-    0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x36,0x30,0x30,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x20,
-    0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,
-    0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x37,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x28,0x28,0x21,0x5f,0x35,0x35,0x35,0x29,0x20,0x26,0x26,
-    0x20,0x28,0x21,0x5f,0x35,0x36,0x34,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,
-    0x35,0x39,0x31,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x30,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x20,0x3d,0x20,0x76,
-    0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x20,0x3d,0x20,0x64,
-    0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x37,0x33,0x37,0x20,0x3d,
-    0x20,0x73,0x64,0x66,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,
-    0x20,0x3d,0x20,0x5f,0x37,0x33,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,0x63,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,
-    0x37,0x34,0x34,0x20,0x3d,0x20,0x5f,0x37,0x32,0x35,0x20,0x2a,0x20,0x76,0x5f,0x61,
-    0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,
-    0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x20,
-    0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,0x20,0x3d,0x20,0x76,0x5f,0x75,
-    0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x36,0x20,0x3d,0x20,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,
-    0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,
-    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x37,0x20,0x3d,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x37,0x36,0x32,0x20,0x3d,0x20,0x73,
-    0x68,0x61,0x64,0x65,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
-    0x20,0x5f,0x37,0x36,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
-    0x37,0x36,0x32,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,
-    0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,
-    0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,
+    0x70,0x72,0x69,0x74,0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x3d,0x20,0x30,0x2e,0x30,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,
+    0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,
+    0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,
+    0x62,0x6f,0x78,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,
+    0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,
+    0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,
+    0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,
+    0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,
+    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,
+    0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,
+    0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,
+    0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,
+    0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,
+    0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,
+    0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,
+    0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,
+    0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,
+    0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
+    0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,
+    0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,
+    0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,
+    0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,
+    0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,
+    0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,
+    0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,
+    0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,
+    0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,
+    0x68,0x28,0x64,0x46,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,
+    0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x79,
+    0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,
+    0x76,0x5f,0x75,0x76,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,
+    0x30,0x5d,0x2e,0x78,0x79,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
+    0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,
+    0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,
+    0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x20,0x2d,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,
+    0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,
+    0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,
+    0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x65,0x63,0x32,0x20,
+    0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,
+    0x63,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,
+    0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,
+    0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,
+    0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,
+    0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,
+    0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,
+    0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,
+    0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,
+    0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,0x30,
+    0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,0x36,
+    0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,
+    0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,
+    0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x2c,
+    0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
+    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,
+    0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,
+    0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,
+    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,
+    0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,
+    0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,
+    0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,
+    0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,
+    0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x69,
+    0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,
+    0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,
+    0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,
+    0x20,0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,
+    0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,
+    0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,
+    0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,
+    0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,
+    0x3d,0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,
+    0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
@@ -1101,6 +923,7 @@ static const char sprite_fs_source_glsl330[7903] = {
     out vec2 v_posH;
     out vec4 v_user;
     layout(location = 11) in vec4 in_user_params;
+    layout(location = 12) in float in_depth;
     
     void main()
     {
@@ -1116,14 +939,14 @@ static const char sprite_fs_source_glsl330[7903] = {
         v_type = in_params.x;
         v_alpha = in_params.y;
         v_fill = in_params.z;
-        gl_Position = vec4(in_posH, 0.0, 1.0);
+        gl_Position = vec4(in_posH, in_depth, 1.0);
         v_posH = in_posH;
         v_user = in_user_params;
         gl_Position.y = -gl_Position.y;
     }
     
 */
-static const char sprite_vs_source_glsl300es[1114] = {
+static const char sprite_vs_source_glsl300es[1160] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x0a,0x6f,0x75,0x74,0x20,0x76,0x65,0x63,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,
     0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,
@@ -1168,32 +991,35 @@ static const char sprite_vs_source_glsl300es[1114] = {
     0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,
     0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x31,0x29,0x20,0x69,0x6e,
     0x20,0x76,0x65,0x63,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
-    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,
-    0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,
-    0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
-    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,
-    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,
-    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,
-    0x76,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,
-    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,
-    0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
-    0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,
-    0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
-    0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,
-    0x73,0x48,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,
-    0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,
-    0x3d,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x2e,0x79,0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x2e,0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x72,0x61,0x6d,0x73,0x3b,0x0a,0x6c,0x61,0x79,0x6f,0x75,0x74,0x28,0x6c,0x6f,0x63,
+    0x61,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x31,0x32,0x29,0x20,0x69,0x6e,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x0a,
+    0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x5f,
+    0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,
+    0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,
+    0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x76,
+    0x65,0x63,0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,0x5f,
+    0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,
+    0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x79,0x20,0x3d,0x20,0x2d,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x2e,0x79,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #version 300 es
@@ -1384,163 +1210,58 @@ static const char sprite_vs_source_glsl300es[1114] = {
     
     void main()
     {
-        bool _549 = v_type >= 0.0;
-        bool _555;
-        if (_549)
-        {
-            _555 = v_type < 0.00196078442968428134918212890625;
-        }
-        else
-        {
-            _555 = _549;
-        }
-        bool _558 = v_type > 0.00196078442968428134918212890625;
-        bool _564;
-        if (_558)
-        {
-            _564 = v_type < 0.0058823530562222003936767578125;
-        }
-        else
-        {
-            _564 = _558;
-        }
-        bool _567 = v_type > 0.0058823530562222003936767578125;
-        bool _573;
-        if (_567)
+        bool is_sprite = v_type >= 0.0 && v_type < 0.00196078442968428134918212890625;
+        bool is_text = v_type > 0.00196078442968428134918212890625 && v_type < 0.0058823530562222003936767578125;
+        bool is_box = v_type > 0.0058823530562222003936767578125 && v_type < 0.009803921915590763092041015625;
+        bool is_seg = v_type > 0.009803921915590763092041015625 && v_type < 0.013725490309298038482666015625;
+        bool is_tri = v_type > 0.013725490309298038482666015625 && v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125 && v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125 && v_type < 0.0254901959002017974853515625;
+        highp vec2 texel_pos = v_uv * fs_params[0].xy;
+        highp float texels_per_pixel = 0.5 * (length(dFdx(texel_pos)) + length(dFdy(texel_pos)));
+        highp vec4 c = de_gamma(texture(u_image, smooth_uv(v_uv, fs_params[0].xy)));
+        if (is_sprite)
         {
-            _573 = v_type < 0.009803921915590763092041015625;
+            c = gamma(overlay(c, v_col));
         }
-        else
-        {
-            _573 = _567;
-        }
-        bool _576 = v_type > 0.009803921915590763092041015625;
-        bool _582;
-        if (_576)
-        {
-            _582 = v_type < 0.013725490309298038482666015625;
-        }
-        else
-        {
-            _582 = _576;
-        }
-        bool _585 = v_type > 0.013725490309298038482666015625;
-        bool _591;
-        if (_585)
-        {
-            _591 = v_type < 0.01764705963432788848876953125;
-        }
-        else
-        {
-            _591 = _585;
-        }
-        bool _594 = v_type > 0.01764705963432788848876953125;
-        bool _600;
-        if (_594)
-        {
-            _600 = v_type < 0.02156862802803516387939453125;
-        }
-        else
-        {
-            _600 = _594;
-        }
-        highp vec4 c = vec4(0.0);
-        highp vec4 _607;
-        if (!(_555 && _564))
-        {
-            highp vec2 param = v_uv;
-            highp vec2 param_1 = fs_params[0].xy;
-            highp vec4 param_2 = texture(u_image, smooth_uv(param, param_1));
-            _607 = de_gamma(param_2);
-        }
-        else
+        if (is_text)
         {
-            _607 = c;
+            c = v_col * c.w;
         }
-        c = _607;
-        highp vec4 _636;
-        if (_555)
+        if (is_text_sdf)
         {
-            highp vec4 param_3 = c;
-            highp vec4 param_4 = v_col;
-            highp vec4 param_5 = overlay(param_3, param_4);
-            _636 = gamma(param_5);
+            highp vec2 texel = v_uv * fs_params[0].xy - vec2(0.5);
+            highp vec2 base = floor(texel);
+            highp vec2 f = texel - base;
+            highp vec2 uv0 = (base + vec2(0.5)) / fs_params[0].xy;
+            highp vec2 uv1 = (base + vec2(1.5)) / fs_params[0].xy;
+            highp float sd = mix(mix(textureLod(u_image, uv0, 0.0).w, textureLod(u_image, vec2(uv1.x, uv0.y), 0.0).w, f.x), mix(textureLod(u_image, vec2(uv0.x, uv1.y), 0.0).w, textureLod(u_image, uv1, 0.0).w, f.x), f.y);
+            c = v_col * clamp((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5, 0.0, 1.0);
         }
-        else
+        if (is_tri)
         {
-            _636 = c;
+            c = v_col;
         }
-        c = _636;
-        highp vec4 _652;
-        if (_564)
-        {
-            _652 = v_col * c.w;
-        }
-        else
-        {
-            _652 = c;
-        }
-        bvec4 _665 = bvec4(_591);
-        c = vec4(_665.x ? v_col.x : _652.x, _665.y ? v_col.y : _652.y, _665.z ? v_col.z : _652.z, _665.w ? v_col.w : _652.w);
         highp float d = 0.0;
-        if (_573)
+        if (is_box)
         {
-            highp vec2 param_6 = v_pos;
-            highp vec2 param_7 = v_a;
-            highp vec2 param_8 = v_b;
-            highp vec2 param_9 = v_c;
-            highp float _683 = distance_box(param_6, param_7, param_8, param_9);
-            d = _683;
+            highp vec2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
         }
-        else
+        else if (is_seg)
         {
-            if (_582)
-            {
-                highp vec2 param_10 = v_pos;
-                highp vec2 param_11 = v_a;
-                highp vec2 param_12 = v_b;
-                highp float _694 = distance_segment(param_10, param_11, param_12);
-                d = _694;
-                highp vec2 param_13 = v_pos;
-                highp vec2 param_14 = v_b;
-                highp vec2 param_15 = v_c;
-                d = min(_694, distance_segment(param_13, param_14, param_15));
-            }
-            else
-            {
-                if (_600)
-                {
-                    highp vec2 param_16 = v_pos;
-                    highp vec2 param_17 = v_a;
-                    highp vec2 param_18 = v_b;
-                    highp vec2 param_19 = v_c;
-                    d = distance_triangle(param_16, param_17, param_18, param_19);
-                }
-            }
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
         }
-        highp vec4 _725;
-        if (((!_555) && (!_564)) && (!_591))
+        else if (is_tri_sdf)
         {
-            highp vec4 param_20 = c;
-            highp vec4 param_21 = v_col;
-            highp float param_22 = d - v_radius;
-            highp vec4 _737 = sdf(param_20, param_21, param_22);
-            _725 = _737;
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
         }
-        else
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
         {
-            _725 = c;
+            c = sdf(c, v_col, d - v_radius);
         }
-        highp vec4 _744 = _725 * v_alpha;
-        c = _744;
-        highp vec4 param_23 = _744;
-        highp vec2 param_24 = v_pos;
-        highp vec2 param_25 = v_uv;
-        highp vec2 param_26 = (v_posH + vec2(1.0)) * 0.5;
-        highp vec4 param_27 = v_user;
-        highp vec4 _762 = shader(param_23, param_24, param_25, param_26, param_27);
-        c = _762;
-        if (_762.w == 0.0)
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + vec2(1.0)) * 0.5, v_user);
+        if (c.w == 0.0)
         {
             discard;
         }
@@ -1548,7 +1269,7 @@ static const char sprite_vs_source_glsl300es[1114] = {
     }
     
 */
-static const char sprite_fs_source_glsl300es[8918] = {
+static const char sprite_fs_source_glsl300es[7432] = {
     0x23,0x76,0x65,0x72,0x73,0x69,0x6f,0x6e,0x20,0x33,0x30,0x30,0x20,0x65,0x73,0x0a,
     0x70,0x72,0x65,0x63,0x69,0x73,0x69,0x6f,0x6e,0x20,0x6d,0x65,0x64,0x69,0x75,0x6d,
     0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3b,0x0a,0x70,0x72,0x65,0x63,0x69,0x73,0x69,
@@ -1867,246 +1588,153 @@ static const char sprite_fs_source_glsl300es[8918] = {
     0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x73,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,
     0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3b,0x0a,0x7d,
     0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x34,0x39,0x20,0x3d,0x20,
-    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x34,0x39,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,
-    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,
-    0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,
-    0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,
-    0x3d,0x20,0x5f,0x35,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x38,0x20,0x3d,0x20,0x76,0x5f,
-    0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,
-    0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,
-    0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
-    0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x5f,0x35,0x35,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,0x20,0x3d,0x20,0x76,0x5f,0x74,
-    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,
-    0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,
-    0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,0x20,0x3d,0x20,0x5f,0x35,0x35,
-    0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
-    0x6c,0x20,0x5f,0x35,0x36,0x37,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
-    0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,
-    0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,
-    0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,
-    0x37,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x37,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x35,0x37,0x33,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,
-    0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x35,0x37,0x33,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x36,0x20,
-    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,
-    0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,
-    0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,0x20,0x76,
-    0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,
-    0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,
-    0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,0x20,0x5f,0x35,
-    0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
-    0x6f,0x6c,0x20,0x5f,0x35,0x38,0x35,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
-    0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,
-    0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,
-    0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,
-    0x39,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x35,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,
-    0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x39,0x31,0x20,0x3d,0x20,0x5f,0x35,0x38,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x34,0x20,0x3d,
-    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,
-    0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,
-    0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
-    0x6f,0x6f,0x6c,0x20,0x5f,0x36,0x30,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x5f,0x35,0x39,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x76,0x5f,0x74,
-    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,
-    0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,
-    0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x5f,0x35,0x39,0x34,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
-    0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x30,
-    0x2e,0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x5f,0x36,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x21,0x28,0x5f,0x35,0x35,0x35,0x20,0x26,0x26,0x20,0x5f,0x35,0x36,0x34,
-    0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x69,
-    0x6d,0x61,0x67,0x65,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,
-    0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,
-    0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x30,0x37,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,
-    0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x35,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x33,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x34,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,0x36,
-    0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
-    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x33,0x36,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x35,
-    0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x34,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x36,0x35,0x32,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,
-    0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
-    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x62,0x76,0x65,0x63,0x34,0x20,0x5f,0x36,0x36,0x35,0x20,0x3d,
-    0x20,0x62,0x76,0x65,0x63,0x34,0x28,0x5f,0x35,0x39,0x31,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x65,0x63,0x34,0x28,0x5f,0x36,0x36,0x35,0x2e,
-    0x78,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x78,0x20,0x3a,0x20,0x5f,0x36,
-    0x35,0x32,0x2e,0x78,0x2c,0x20,0x5f,0x36,0x36,0x35,0x2e,0x79,0x20,0x3f,0x20,0x76,
-    0x5f,0x63,0x6f,0x6c,0x2e,0x79,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,0x79,0x2c,
-    0x20,0x5f,0x36,0x36,0x35,0x2e,0x7a,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,
-    0x7a,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,0x7a,0x2c,0x20,0x5f,0x36,0x36,0x35,
-    0x2e,0x77,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x77,0x20,0x3a,0x20,0x5f,
-    0x36,0x35,0x32,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
-    0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x33,0x29,0x0a,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,
-    0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,
-    0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x37,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x5f,0x36,0x38,0x33,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
-    0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x38,0x33,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
-    0x35,0x38,0x32,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x20,0x3d,
-    0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,
-    0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,
-    0x39,0x34,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
-    0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x76,0x5f,0x70,
-    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x34,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,
+    0x74,0x65,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
+    0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,
+    0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,
+    0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,
+    0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,
+    0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,
+    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
+    0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,
+    0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,
+    0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,
+    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,
+    0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,
+    0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,
+    0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,
+    0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
+    0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,
+    0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,
+    0x35,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,
+    0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,
+    0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
+    0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,
+    0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,
+    0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,
+    0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x20,
+    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,
+    0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,
+    0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,0x30,0x2e,0x35,
+    0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x78,0x28,
+    0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x2b,0x20,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x28,0x64,0x46,0x64,0x79,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,
+    0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
+    0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x76,
+    0x5f,0x75,0x76,0x2c,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,
+    0x5d,0x2e,0x78,0x79,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
     0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x76,0x5f,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,
-    0x3d,0x20,0x6d,0x69,0x6e,0x28,0x5f,0x36,0x39,0x34,0x2c,0x20,0x64,0x69,0x73,0x74,
-    0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,
-    0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x36,
-    0x30,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,
-    0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x37,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
-    0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,
-    0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,
-    0x61,0x6e,0x67,0x6c,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x37,0x32,0x35,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x28,0x28,0x21,0x5f,0x35,0x35,
-    0x35,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,0x35,0x36,0x34,0x29,0x29,0x20,0x26,
-    0x26,0x20,0x28,0x21,0x5f,0x35,0x39,0x31,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,
-    0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,
-    0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x20,0x3d,0x20,
-    0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,
-    0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x32,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,
-    0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
-    0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,0x37,0x33,0x37,0x20,0x3d,0x20,0x73,0x64,
-    0x66,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,
-    0x5f,0x37,0x33,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,
-    0x34,0x20,0x5f,0x37,0x34,0x34,0x20,0x3d,0x20,0x5f,0x37,0x32,0x35,0x20,0x2a,0x20,
-    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
-    0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
-    0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,
-    0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
-    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x20,0x3d,
-    0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
-    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,0x20,
-    0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,
-    0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,0x20,
-    0x3d,0x20,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
-    0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x37,0x20,0x3d,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x34,0x20,0x5f,
-    0x37,0x36,0x32,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x36,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x36,0x32,0x2e,0x77,0x20,0x3d,0x3d,0x20,
-    0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,
+    0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,
+    0x20,0x2d,0x20,0x76,0x65,0x63,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,
+    0x20,0x62,0x61,0x73,0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,
+    0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,
+    0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,
+    0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,
+    0x6d,0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x76,0x65,0x63,0x32,0x20,0x75,0x76,0x31,
+    0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,
+    0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x5b,0x30,0x5d,0x2e,0x78,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,
+    0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,
+    0x30,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x4c,0x6f,0x64,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,
+    0x65,0x63,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,
+    0x29,0x2c,0x20,0x30,0x2e,0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,
+    0x20,0x6d,0x69,0x78,0x28,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x76,0x65,0x63,0x32,0x28,0x75,0x76,
+    0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,
+    0x29,0x2e,0x77,0x2c,0x20,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x4c,0x6f,0x64,0x28,
+    0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x30,0x2e,
+    0x30,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,
+    0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x6c,0x61,0x6d,0x70,0x28,0x28,0x73,0x64,0x20,
+    0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,
+    0x31,0x37,0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,
+    0x31,0x31,0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,
+    0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,
+    0x2e,0x35,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,
+    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x68,0x69,0x67,0x68,0x70,
+    0x20,0x76,0x65,0x63,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x76,0x5f,0x61,
+    0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
+    0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,
+    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x29,0x2c,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,
+    0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,
+    0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,
+    0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,
+    0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,
+    0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,
+    0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x69,0x73,
+    0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,
+    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,
+    0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,
+    0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,
+    0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,
+    0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,0x2c,0x20,0x28,0x76,
+    0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x76,0x65,0x63,0x32,0x28,0x31,0x2e,0x30,
+    0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x2c,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,
+    0x3d,0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,
+    0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     static float4 gl_Position;
@@ -2136,6 +1764,7 @@ static const char sprite_fs_source_glsl300es[8918] = {
     static float2 v_posH;
     static float4 v_user;
     static float4 in_user_params;
+    static float in_depth;
     
     struct SPIRV_Cross_Input
     {
@@ -2151,6 +1780,7 @@ static const char sprite_fs_source_glsl300es[8918] = {
         float in_aa : TEXCOORD9;
         float4 in_params : TEXCOORD10;
         float4 in_user_params : TEXCOORD11;
+        float in_depth : TEXCOORD12;
     };
     
     struct SPIRV_Cross_Output
@@ -2186,7 +1816,7 @@ static const char sprite_fs_source_glsl300es[8918] = {
         v_type = in_params.x;
         v_alpha = in_params.y;
         v_fill = in_params.z;
-        gl_Position = float4(in_posH, 0.0f, 1.0f);
+        gl_Position = float4(in_posH, in_depth, 1.0f);
         v_posH = in_posH;
         v_user = in_user_params;
     }
@@ -2205,6 +1835,7 @@ static const char sprite_fs_source_glsl300es[8918] = {
         in_params = stage_input.in_params;
         in_posH = stage_input.in_posH;
         in_user_params = stage_input.in_user_params;
+        in_depth = stage_input.in_depth;
         vert_main();
         SPIRV_Cross_Output stage_output;
         stage_output.gl_Position = gl_Position;
@@ -2225,7 +1856,7 @@ static const char sprite_fs_source_glsl300es[8918] = {
         return stage_output;
     }
 */
-static const char sprite_vs_source_hlsl5[2925] = {
+static const char sprite_vs_source_hlsl5[3022] = {
     0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,
     0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,
     0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
@@ -2262,153 +1893,159 @@ static const char sprite_vs_source_hlsl5[2925] = {
     0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x63,
     0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,
     0x73,0x74,0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,
-    0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x0a,0x73,
-    0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
-    0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
-    0x20,0x69,0x6e,0x5f,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
-    0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,
-    0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x75,0x76,
-    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x37,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x38,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x61,0x61,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,
-    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
-    0x4f,0x52,0x44,0x31,0x31,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,
-    0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,
-    0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
-    0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
-    0x76,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,
+    0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x63,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,
+    0x70,0x74,0x68,0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x0a,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x70,0x6f,
+    0x73,0x48,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x61,0x20,
     0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,
-    0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
-    0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
-    0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
-    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
-    0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
-    0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
-    0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,
-    0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x38,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
-    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x39,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
-    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x32,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3a,
-    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x33,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,
-    0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-    0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,
-    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
-    0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,
-    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,
-    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x61,
-    0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
-    0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
-    0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
-    0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,
-    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x30,0x2e,0x30,0x66,0x2c,
-    0x20,0x31,0x2e,0x30,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,
-    0x73,0x48,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x73,
-    0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,
-    0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,
-    0x20,0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,
-    0x73,0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
-    0x70,0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,
-    0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
-    0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x61,
-    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,
-    0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x62,0x20,0x3d,0x20,
-    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x62,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x63,0x20,0x3d,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x6e,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x72,0x61,
-    0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,
-    0x6f,0x6b,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
-    0x74,0x2e,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x6e,0x5f,0x61,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
-    0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,
-    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,
-    0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,
-    0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,
-    0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,0x5f,
-    0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,
-    0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,0x6c,
-    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,0x50,
-    0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,
-    0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,
-    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,0x20,
-    0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
-    0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
-    0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,
-    0x6c,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,
-    0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,
-    0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x76,0x5f,0x73,
-    0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x76,
-    0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,
-    0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x76,
-    0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,
-    0x3d,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
-    0x6c,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,
-    0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,
-    0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x62,0x20,0x3a,0x20,0x54,
+    0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x20,0x69,0x6e,0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,
+    0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x69,0x6e,0x5f,0x75,0x76,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,
+    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,
+    0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x69,0x6e,0x5f,0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,
+    0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,
+    0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
+    0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x31,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x32,0x3b,0x0a,0x7d,
+    0x3b,0x0a,0x0a,0x73,0x74,0x72,0x75,0x63,0x74,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x0a,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x30,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x61,0x20,0x3a,0x20,0x54,0x45,
+    0x58,0x43,0x4f,0x4f,0x52,0x44,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
+    0x61,0x74,0x32,0x20,0x76,0x5f,0x62,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x63,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x33,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x76,0x5f,0x75,0x76,
+    0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x34,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3a,
+    0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,0x44,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x20,0x76,0x5f,0x61,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,
+    0x43,0x4f,0x4f,0x52,0x44,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,
+    0x4f,0x52,0x44,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,
+    0x52,0x44,0x31,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3a,0x20,0x54,0x45,0x58,0x43,0x4f,0x4f,0x52,
+    0x44,0x31,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
+    0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3a,0x20,0x53,0x56,
+    0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,
+    0x6f,0x69,0x64,0x20,0x76,0x65,0x72,0x74,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,
+    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x20,0x3d,0x20,
+    0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,
+    0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
+    0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x61,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,
+    0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,
+    0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,
+    0x6c,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x5f,0x70,0x6f,0x73,
+    0x48,0x2c,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,
+    0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,
+    0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
+    0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,0x5f,
+    0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,0x69,
+    0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,0x6e,
+    0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x29,
+    0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,
+    0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x61,0x20,0x3d,0x20,0x73,
+    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x6e,0x5f,0x63,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x5f,0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,
+    0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
+    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,
+    0x61,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,
+    0x61,0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,
+    0x72,0x61,0x6d,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x69,0x6e,
+    0x5f,0x64,0x65,0x70,0x74,0x68,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x65,0x72,0x74,
+    0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,
+    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x67,
+    0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,
+    0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,
+    0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,0x76,0x5f,0x62,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x75,0x76,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,
+    0x6f,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x72,
+    0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,
+    0x76,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,
+    0x20,0x3d,0x20,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,0x5f,0x66,
+    0x69,0x6c,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,
+    0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x00,
 };
 /*
     cbuffer fs_params : register(b0)
@@ -2623,163 +2260,58 @@ static const char sprite_vs_source_hlsl5[2925] = {
     
     void frag_main()
     {
-        bool _549 = v_type >= 0.0f;
-        bool _555;
-        if (_549)
-        {
-            _555 = v_type < 0.00196078442968428134918212890625f;
-        }
-        else
-        {
-            _555 = _549;
-        }
-        bool _558 = v_type > 0.00196078442968428134918212890625f;
-        bool _564;
-        if (_558)
-        {
-            _564 = v_type < 0.0058823530562222003936767578125f;
-        }
-        else
-        {
-            _564 = _558;
-        }
-        bool _567 = v_type > 0.0058823530562222003936767578125f;
-        bool _573;
-        if (_567)
-        {
-            _573 = v_type < 0.009803921915590763092041015625f;
-        }
-        else
-        {
-            _573 = _567;
-        }
-        bool _576 = v_type > 0.009803921915590763092041015625f;
-        bool _582;
-        if (_576)
-        {
-            _582 = v_type < 0.013725490309298038482666015625f;
-        }
-        else
-        {
-            _582 = _576;
-        }
-        bool _585 = v_type > 0.013725490309298038482666015625f;
-        bool _591;
-        if (_585)
-        {
-            _591 = v_type < 0.01764705963432788848876953125f;
-        }
-        else
-        {
-            _591 = _585;
-        }
-        bool _594 = v_type > 0.01764705963432788848876953125f;
-        bool _600;
-        if (_594)
+        bool is_sprite = v_type >= 0.0f && v_type < 0.00196078442968428134918212890625f;
+        bool is_text = v_type > 0.00196078442968428134918212890625f && v_type < 0.0058823530562222003936767578125f;
+        bool is_box = v_type > 0.0058823530562222003936767578125f && v_type < 0.009803921915590763092041015625f;
+        bool is_seg = v_type > 0.009803921915590763092041015625f && v_type < 0.013725490309298038482666015625f;
+        bool is_tri = v_type > 0.013725490309298038482666015625f && v_type < 0.01764705963432788848876953125f;
+        bool is_tri_sdf = v_type > 0.01764705963432788848876953125f && v_type < 0.02156862802803516387939453125f;
+        bool is_text_sdf = v_type > 0.02156862802803516387939453125f && v_type < 0.0254901959002017974853515625f;
+        float2 texel_pos = v_uv * _619_u_texture_size;
+        float texels_per_pixel = 0.5f * (length(ddx(texel_pos)) + length(ddy(texel_pos)));
+        float4 c = de_gamma(u_image.Sample(_u_image_sampler, smooth_uv(v_uv, _619_u_texture_size)));
+        if (is_sprite)
         {
-            _600 = v_type < 0.02156862802803516387939453125f;
+            c = gamma(overlay(c, v_col));
         }
-        else
-        {
-            _600 = _594;
-        }
-        float4 c = 0.0f.xxxx;
-        float4 _607;
-        if (!(_555 && _564))
-        {
-            float2 param = v_uv;
-            float2 param_1 = _619_u_texture_size;
-            float4 param_2 = u_image.Sample(_u_image_sampler, smooth_uv(param, param_1));
-            _607 = de_gamma(param_2);
-        }
-        else
-        {
-            _607 = c;
-        }
-        c = _607;
-        float4 _636;
-        if (_555)
-        {
-            float4 param_3 = c;
-            float4 param_4 = v_col;
-            float4 param_5 = overlay(param_3, param_4);
-            _636 = gamma(param_5);
-        }
-        else
+        if (is_text)
         {
-            _636 = c;
+            c = v_col * c.w;
         }
-        c = _636;
-        float4 _652;
-        if (_564)
+        if (is_text_sdf)
         {
-            _652 = v_col * c.w;
+            float2 texel = v_uv * _619_u_texture_size - 0.5f.xx;
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + 0.5f.xx) / _619_u_texture_size;
+            float2 uv1 = (base + 1.5f.xx) / _619_u_texture_size;
+            float sd = lerp(lerp(u_image.SampleLevel(_u_image_sampler, uv0, 0.0f).w, u_image.SampleLevel(_u_image_sampler, float2(uv1.x, uv0.y), 0.0f).w, f.x), lerp(u_image.SampleLevel(_u_image_sampler, float2(uv0.x, uv1.y), 0.0f).w, u_image.SampleLevel(_u_image_sampler, uv1, 0.0f).w, f.x), f.y);
+            c = v_col * saturate((sd - 0.501960813999176025390625f) * 11.953125f / texels_per_pixel + 0.5f);
         }
-        else
+        if (is_tri)
         {
-            _652 = c;
+            c = v_col;
         }
-        bool4 _665 = _591.xxxx;
-        c = float4(_665.x ? v_col.x : _652.x, _665.y ? v_col.y : _652.y, _665.z ? v_col.z : _652.z, _665.w ? v_col.w : _652.w);
         float d = 0.0f;
-        if (_573)
+        if (is_box)
         {
-            float2 param_6 = v_pos;
-            float2 param_7 = v_a;
-            float2 param_8 = v_b;
-            float2 param_9 = v_c;
-            float _683 = distance_box(param_6, param_7, param_8, param_9);
-            d = _683;
+            float2 p = v_pos;
+            d = distance_box(p, v_a, v_b, v_c);
         }
-        else
+        else if (is_seg)
         {
-            if (_582)
-            {
-                float2 param_10 = v_pos;
-                float2 param_11 = v_a;
-                float2 param_12 = v_b;
-                float _694 = distance_segment(param_10, param_11, param_12);
-                d = _694;
-                float2 param_13 = v_pos;
-                float2 param_14 = v_b;
-                float2 param_15 = v_c;
-                d = min(_694, distance_segment(param_13, param_14, param_15));
-            }
-            else
-            {
-                if (_600)
-                {
-                    float2 param_16 = v_pos;
-                    float2 param_17 = v_a;
-                    float2 param_18 = v_b;
-                    float2 param_19 = v_c;
-                    d = distance_triangle(param_16, param_17, param_18, param_19);
-                }
-            }
+            d = min(distance_segment(v_pos, v_a, v_b), distance_segment(v_pos, v_b, v_c));
         }
-        float4 _725;
-        if (((!_555) && (!_564)) && (!_591))
+        else if (is_tri_sdf)
         {
-            float4 param_20 = c;
-            float4 param_21 = v_col;
-            float param_22 = d - v_radius;
-            float4 _737 = sdf(param_20, param_21, param_22);
-            _725 = _737;
+            d = distance_triangle(v_pos, v_a, v_b, v_c);
         }
-        else
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
         {
-            _725 = c;
+            c = sdf(c, v_col, d - v_radius);
         }
-        float4 _744 = _725 * v_alpha;
-        c = _744;
-        float4 param_23 = _744;
-        float2 param_24 = v_pos;
-        float2 param_25 = v_uv;
-        float2 param_26 = (v_posH + 1.0f.xx) * 0.5f;
-        float4 param_27 = v_user;
-        float4 _762 = shader(param_23, param_24, param_25, param_26, param_27);
-        c = _762;
-        if (_762.w == 0.0f)
+        c = shader(c * v_alpha, v_pos, v_uv, (v_posH + 1.0f.xx) * 0.5f, v_user);
+        if (c.w == 0.0f)
         {
             discard;
         }
@@ -2808,7 +2340,7 @@ static const char sprite_vs_source_hlsl5[2925] = {
         return stage_output;
     }
 */
-static const char sprite_fs_source_hlsl5[9492] = {
+static const char sprite_fs_source_hlsl5[8210] = {
     0x63,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x66,0x73,0x5f,0x70,0x61,0x72,0x61,0x6d,
     0x73,0x20,0x3a,0x20,0x72,0x65,0x67,0x69,0x73,0x74,0x65,0x72,0x28,0x62,0x30,0x29,
     0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x5f,0x36,
@@ -3133,276 +2665,196 @@ static const char sprite_fs_source_hlsl5[9492] = {
     0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x63,0x6f,
     0x6c,0x6f,0x72,0x3b,0x0a,0x7d,0x0a,0x0a,0x76,0x6f,0x69,0x64,0x20,0x66,0x72,0x61,
     0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x62,
-    0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x34,0x39,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
-    0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
-    0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,
-    0x20,0x28,0x5f,0x35,0x34,0x39,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,0x20,0x76,0x5f,0x74,
-    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,
-    0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,
-    0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,0x20,0x5f,
-    0x35,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,
-    0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x38,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
-    0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,
-    0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,
-    0x38,0x39,0x30,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
-    0x6c,0x20,0x5f,0x35,0x36,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x5f,0x35,0x35,0x38,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
-    0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,
-    0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,
-    0x37,0x38,0x31,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,0x20,0x3d,0x20,0x5f,0x35,0x35,0x38,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,
-    0x20,0x5f,0x35,0x36,0x37,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,
-    0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,
-    0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,
-    0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,
-    0x37,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x37,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x35,0x37,0x33,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
-    0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,
-    0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,
-    0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,
-    0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x35,0x37,0x33,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x36,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x3d,0x20,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x66,0x20,0x26,
+    0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,
+    0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,
+    0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,
     0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,
-    0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,
-    0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,
-    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,
-    0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,
-    0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,
-    0x20,0x5f,0x35,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x35,0x20,0x3d,0x20,0x76,0x5f,0x74,
-    0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,
+    0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,
+    0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x66,0x20,
+    0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,
+    0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,
+    0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,
+    0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,
+    0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,
+    0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x66,0x20,0x26,0x26,
+    0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,
+    0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,
+    0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,0x33,
+    0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,0x30,
+    0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,
+    0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,
     0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,
     0x30,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
-    0x6c,0x20,0x5f,0x35,0x39,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x5f,0x35,0x38,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
-    0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,
-    0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,
-    0x31,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x5f,0x35,0x38,0x35,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,
-    0x35,0x39,0x34,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
-    0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,
-    0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x66,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x36,0x30,0x30,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x39,0x34,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,
-    0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,
-    0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,
-    0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,
-    0x3d,0x20,0x5f,0x35,0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x30,0x2e,0x30,
-    0x66,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x5f,0x36,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-    0x28,0x21,0x28,0x5f,0x35,0x35,0x35,0x20,0x26,0x26,0x20,0x5f,0x35,0x36,0x34,0x29,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x76,
-    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,
+    0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,
+    0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,
+    0x35,0x36,0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,
+    0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,
+    0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,
+    0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,
+    0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,
+    0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,
+    0x32,0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,
+    0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,
+    0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x66,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,
+    0x78,0x74,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3e,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,
+    0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,
+    0x35,0x66,0x20,0x26,0x26,0x20,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
+    0x2e,0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,
+    0x37,0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x66,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,
+    0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,
     0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
-    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x75,0x5f,0x69,0x6d,
-    0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x28,0x5f,0x75,0x5f,0x69,0x6d,
-    0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x73,0x6d,0x6f,
-    0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
-    0x5f,0x36,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x5f,0x36,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,
-    0x35,0x35,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x33,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,
-    0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,
-    0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x63,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,
-    0x36,0x33,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x5f,0x36,0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,
-    0x36,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
-    0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x20,0x5f,0x36,0x36,
-    0x35,0x20,0x3d,0x20,0x5f,0x35,0x39,0x31,0x2e,0x78,0x78,0x78,0x78,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x5f,0x36,
-    0x36,0x35,0x2e,0x78,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x78,0x20,0x3a,
-    0x20,0x5f,0x36,0x35,0x32,0x2e,0x78,0x2c,0x20,0x5f,0x36,0x36,0x35,0x2e,0x79,0x20,
-    0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x79,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,
-    0x2e,0x79,0x2c,0x20,0x5f,0x36,0x36,0x35,0x2e,0x7a,0x20,0x3f,0x20,0x76,0x5f,0x63,
-    0x6f,0x6c,0x2e,0x7a,0x20,0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,0x7a,0x2c,0x20,0x5f,
-    0x36,0x36,0x35,0x2e,0x77,0x20,0x3f,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x2e,0x77,0x20,
-    0x3a,0x20,0x5f,0x36,0x35,0x32,0x2e,0x77,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x66,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x33,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,
-    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,0x78,
+    0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,0x20,
+    0x30,0x2e,0x35,0x66,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,0x2b,
+    0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x64,0x79,0x28,0x74,0x65,0x78,0x65,
+    0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,
+    0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,
+    0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,
+    0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x76,0x5f,0x75,
+    0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,
+    0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,
+    0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,0x2c,
+    0x20,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
+    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,
+    0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,
+    0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
     0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x39,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x38,0x33,0x20,
-    0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,
-    0x5f,0x36,0x38,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x32,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x30,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x20,0x3d,0x20,0x76,0x5f,0x62,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x20,0x5f,0x36,0x39,0x34,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,
-    0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x39,0x34,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x76,
-    0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x34,0x20,0x3d,0x20,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,
-    0x5f,0x36,0x39,0x34,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,
-    0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x35,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x36,0x30,0x30,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x76,0x5f,
-    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x37,0x20,0x3d,0x20,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,0x76,0x5f,
-    0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x39,0x20,0x3d,0x20,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,
-    0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x5f,0x37,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x28,0x28,0x21,0x5f,0x35,0x35,0x35,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,0x35,
-    0x36,0x34,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,0x35,0x39,0x31,0x29,0x29,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x20,0x3d,
-    0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x20,0x3d,0x20,0x76,0x5f,
-    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x20,0x3d,0x20,0x64,0x20,
-    0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x33,0x37,0x20,
-    0x3d,0x20,0x73,0x64,0x66,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x32,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,
-    0x35,0x20,0x3d,0x20,0x5f,0x37,0x33,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,
-    0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,0x63,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x5f,0x37,0x34,0x34,0x20,0x3d,0x20,0x5f,0x37,0x32,0x35,0x20,0x2a,0x20,
-    0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
-    0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x5f,0x37,0x34,
-    0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x34,0x20,0x3d,0x20,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x35,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,0x20,
-    0x3d,0x20,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,
-    0x2e,0x78,0x78,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,
-    0x20,0x3d,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x36,0x32,0x20,0x3d,0x20,0x73,0x68,0x61,
-    0x64,0x65,0x72,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x33,0x2c,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x37,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,
-    0x37,0x36,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x36,
-    0x32,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,0x20,0x20,
-    0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,
-    0x72,0x64,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,
-    0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,
-    0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,
-    0x6d,0x61,0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
-    0x5f,0x49,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
-    0x75,0x74,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,
-    0x6b,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x5f,0x61,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
-    0x74,0x2e,0x76,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,
-    0x6c,0x6c,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,
-    0x79,0x70,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,
-    0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,
-    0x75,0x76,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,
+    0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x20,0x2d,0x20,0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,
+    0x65,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x66,0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x32,0x20,0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,
+    0x30,0x2e,0x35,0x66,0x2e,0x78,0x78,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x5f,
+    0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x75,
+    0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x31,0x2e,0x35,
+    0x66,0x2e,0x78,0x78,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,0x39,0x5f,0x75,0x5f,0x74,
+    0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x73,0x64,0x20,0x3d,0x20,
+    0x6c,0x65,0x72,0x70,0x28,0x6c,0x65,0x72,0x70,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
+    0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,
+    0x75,0x76,0x30,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,
+    0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,
+    0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,
+    0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6c,0x65,0x72,0x70,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,0x65,0x4c,0x65,0x76,0x65,
+    0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,0x73,0x61,0x6d,0x70,0x6c,
+    0x65,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,0x76,0x30,0x2e,0x78,
+    0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x30,0x2e,0x30,0x66,0x29,0x2e,
+    0x77,0x2c,0x20,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x53,0x61,0x6d,0x70,0x6c,
+    0x65,0x4c,0x65,0x76,0x65,0x6c,0x28,0x5f,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x5f,
+    0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x30,0x2e,
+    0x30,0x66,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x76,
+    0x5f,0x63,0x6f,0x6c,0x20,0x2a,0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,
+    0x28,0x73,0x64,0x20,0x2d,0x20,0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,
+    0x33,0x39,0x39,0x39,0x31,0x37,0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,
+    0x66,0x29,0x20,0x2a,0x20,0x31,0x31,0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x66,0x20,
+    0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,
+    0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,0x66,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x63,0x20,0x3d,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
+    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
+    0x2e,0x30,0x66,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,
+    0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x76,0x5f,
+    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,
+    0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,0x0a,0x20,0x20,0x20,0x20,
+    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x6d,0x69,
+    0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,
+    0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,
+    0x5f,0x62,0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
+    0x67,0x6d,0x65,0x6e,0x74,0x28,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x62,
+    0x2c,0x20,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,
+    0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,0x6c,0x65,0x28,0x76,0x5f,0x70,0x6f,
+    0x73,0x2c,0x20,0x76,0x5f,0x61,0x2c,0x20,0x76,0x5f,0x62,0x2c,0x20,0x76,0x5f,0x63,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,0x26,0x20,0x21,
+    0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,
+    0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,
+    0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,0x76,0x5f,0x63,
+    0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,0x2a,0x20,0x76,0x5f,0x61,0x6c,
+    0x70,0x68,0x61,0x2c,0x20,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x76,0x5f,0x75,0x76,
+    0x2c,0x20,0x28,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x31,0x2e,0x30,0x66,
+    0x2e,0x78,0x78,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,0x66,0x2c,0x20,0x76,0x5f,0x75,
+    0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,
+    0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x73,0x75,
+    0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x7d,0x0a,0x0a,0x53,0x50,0x49,0x52,0x56,
+    0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x6d,0x61,
+    0x69,0x6e,0x28,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x49,
+    0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
+    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
+    0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x66,0x69,0x6c,0x6c,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x66,0x69,0x6c,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x74,0x79,0x70,
+    0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x75,0x76,
     0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
-    0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,
-    0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,
-    0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x73,
-    0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
-    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x5f,0x63,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,
-    0x75,0x73,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,
-    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,
-    0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
-    0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,
-    0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,
-    0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,
-    0x5f,0x4f,0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
-    0x74,0x70,0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
-    0x6f,0x75,0x74,0x70,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,
-    0x72,0x65,0x73,0x75,0x6c,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,
-    0x72,0x6e,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,
-    0x0a,0x7d,0x0a,0x00,
+    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x63,
+    0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,
+    0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,
+    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x76,0x5f,0x62,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,
+    0x70,0x75,0x74,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x63,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,
+    0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x76,0x5f,0x61,
+    0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x70,
+    0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,
+    0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,
+    0x69,0x6e,0x70,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x72,0x61,0x67,0x5f,0x6d,0x61,0x69,0x6e,0x28,0x29,0x3b,0x0a,0x20,
+    0x20,0x20,0x20,0x53,0x50,0x49,0x52,0x56,0x5f,0x43,0x72,0x6f,0x73,0x73,0x5f,0x4f,
+    0x75,0x74,0x70,0x75,0x74,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,
+    0x75,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,
+    0x74,0x70,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x72,0x65,
+    0x73,0x75,0x6c,0x74,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x20,0x73,0x74,0x61,0x67,0x65,0x5f,0x6f,0x75,0x74,0x70,0x75,0x74,0x3b,0x0a,0x7d,
+    0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -3443,6 +2895,7 @@ static const char sprite_fs_source_hlsl5[9492] = {
         float in_aa [[attribute(9)]];
         float4 in_params [[attribute(10)]];
         float4 in_user_params [[attribute(11)]];
+        float in_depth [[attribute(12)]];
     };
     
     vertex main0_out main0(main0_in in [[stage_in]])
@@ -3460,14 +2913,14 @@ static const char sprite_fs_source_hlsl5[9492] = {
         out.v_type = in.in_params.x;
         out.v_alpha = in.in_params.y;
         out.v_fill = in.in_params.z;
-        out.gl_Position = float4(in.in_posH, 0.0, 1.0);
+        out.gl_Position = float4(in.in_posH, in.in_depth, 1.0);
         out.v_posH = in.in_posH;
         out.v_user = in.in_user_params;
         return out;
     }
     
 */
-static const char sprite_vs_source_metal_macos[1624] = {
+static const char sprite_vs_source_metal_macos[1670] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
@@ -3534,42 +2987,45 @@ static const char sprite_vs_source_metal_macos[1624] = {
     0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,
     0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
-    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
-    0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
-    0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,
-    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
-    0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
-    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
-    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
-    0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,
-    0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,
-    0x48,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,
-    0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x72,
+    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,
+    0x2e,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -3789,162 +3245,58 @@ static const char sprite_vs_source_metal_macos[1624] = {
     fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
     {
         main0_out out = {};
-        bool _549 = in.v_type >= 0.0;
-        bool _555;
-        if (_549)
-        {
-            _555 = in.v_type < 0.00196078442968428134918212890625;
-        }
-        else
-        {
-            _555 = _549;
-        }
-        bool _558 = in.v_type > 0.00196078442968428134918212890625;
-        bool _564;
-        if (_558)
-        {
-            _564 = in.v_type < 0.0058823530562222003936767578125;
-        }
-        else
-        {
-            _564 = _558;
-        }
-        bool _567 = in.v_type > 0.0058823530562222003936767578125;
-        bool _573;
-        if (_567)
-        {
-            _573 = in.v_type < 0.009803921915590763092041015625;
-        }
-        else
-        {
-            _573 = _567;
-        }
-        bool _576 = in.v_type > 0.009803921915590763092041015625;
-        bool _582;
-        if (_576)
-        {
-            _582 = in.v_type < 0.013725490309298038482666015625;
-        }
-        else
-        {
-            _582 = _576;
-        }
-        bool _585 = in.v_type > 0.013725490309298038482666015625;
-        bool _591;
-        if (_585)
-        {
-            _591 = in.v_type < 0.01764705963432788848876953125;
-        }
-        else
-        {
-            _591 = _585;
-        }
-        bool _594 = in.v_type > 0.01764705963432788848876953125;
-        bool _600;
-        if (_594)
-        {
-            _600 = in.v_type < 0.02156862802803516387939453125;
-        }
-        else
-        {
-            _600 = _594;
-        }
-        float4 c = float4(0.0);
-        float4 _607;
-        if (!(_555 && _564))
-        {
-            float2 param = in.v_uv;
-            float2 param_1 = _619.u_texture_size;
-            float4 param_2 = u_image.sample(u_imageSmplr, smooth_uv(param, param_1));
-            _607 = de_gamma(param_2);
-        }
-        else
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size)));
+        if (is_sprite)
         {
-            _607 = c;
+            c = gamma(overlay(c, in.v_col));
         }
-        c = _607;
-        float4 _636;
-        if (_555)
+        if (is_text)
         {
-            float4 param_3 = c;
-            float4 param_4 = in.v_col;
-            float4 param_5 = overlay(param_3, param_4);
-            _636 = gamma(param_5);
+            c = in.v_col * c.w;
         }
-        else
+        if (is_text_sdf)
         {
-            _636 = c;
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
         }
-        c = _636;
-        float4 _652;
-        if (_564)
+        if (is_tri)
         {
-            _652 = in.v_col * c.w;
+            c = in.v_col;
         }
-        else
-        {
-            _652 = c;
-        }
-        c = select(_652, in.v_col, bool4(_591));
         float d = 0.0;
-        if (_573)
+        if (is_box)
         {
-            float2 param_6 = in.v_pos;
-            float2 param_7 = in.v_a;
-            float2 param_8 = in.v_b;
-            float2 param_9 = in.v_c;
-            float _683 = distance_box(param_6, param_7, param_8, param_9);
-            d = _683;
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
         }
-        else
+        else if (is_seg)
         {
-            if (_582)
-            {
-                float2 param_10 = in.v_pos;
-                float2 param_11 = in.v_a;
-                float2 param_12 = in.v_b;
-                float _694 = distance_segment(param_10, param_11, param_12);
-                d = _694;
-                float2 param_13 = in.v_pos;
-                float2 param_14 = in.v_b;
-                float2 param_15 = in.v_c;
-                d = fast::min(_694, distance_segment(param_13, param_14, param_15));
-            }
-            else
-            {
-                if (_600)
-                {
-                    float2 param_16 = in.v_pos;
-                    float2 param_17 = in.v_a;
-                    float2 param_18 = in.v_b;
-                    float2 param_19 = in.v_c;
-                    d = distance_triangle(param_16, param_17, param_18, param_19);
-                }
-            }
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
         }
-        float4 _725;
-        if (((!_555) && (!_564)) && (!_591))
+        else if (is_tri_sdf)
         {
-            float4 param_20 = c;
-            float4 param_21 = in.v_col;
-            float param_22 = d - in.v_radius;
-            float4 _737 = sdf(param_20, param_21, param_22, in.v_stroke, in.v_aa, out.result, in.v_fill);
-            _725 = _737;
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
         }
-        else
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
         {
-            _725 = c;
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
         }
-        float4 _744 = _725 * in.v_alpha;
-        c = _744;
-        float4 param_23 = _744;
-        float2 param_24 = in.v_pos;
-        float2 param_25 = in.v_uv;
-        float2 param_26 = (in.v_posH + float2(1.0)) * 0.5;
-        float4 param_27 = in.v_user;
-        float4 _762 = shader(param_23, param_24, param_25, param_26, param_27);
-        c = _762;
-        if (_762.w == 0.0)
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
         {
             discard_fragment();
         }
@@ -3953,7 +3305,7 @@ static const char sprite_vs_source_metal_macos[1624] = {
     }
     
 */
-static const char sprite_fs_source_metal_macos[10230] = {
+static const char sprite_fs_source_metal_macos[9058] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -4358,242 +3710,169 @@ static const char sprite_fs_source_metal_macos[10230] = {
     0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
     0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
     0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x34,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x34,0x39,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x35,0x35,0x20,0x3d,0x20,0x5f,0x35,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x38,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x34,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x38,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
-    0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,
-    0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x35,0x36,0x34,0x20,0x3d,0x20,0x5f,0x35,0x35,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x37,0x20,
-    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
-    0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,
-    0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x33,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x37,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x37,0x33,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
-    0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,
-    0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x37,0x33,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x36,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,
-    0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,
-    0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,
-    0x20,0x3d,0x20,0x5f,0x35,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x35,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,
-    0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,
-    0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,
-    0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,
-    0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,
-    0x5f,0x35,0x38,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
-    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,
-    0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,
-    0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
-    0x6c,0x20,0x5f,0x36,0x30,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x5f,0x35,0x39,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,
-    0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,
-    0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x5f,0x35,0x39,0x34,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x36,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,
-    0x35,0x35,0x35,0x20,0x26,0x26,0x20,0x5f,0x35,0x36,0x34,0x29,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,0x31,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,
+    0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,
+    0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,
+    0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,
+    0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,
+    0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,
+    0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,
+    0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,
+    0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,
+    0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,
+    0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,
+    0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,0x2e,0x76,0x5f,
+    0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
     0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x75,0x5f,0x69,0x6d,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,
+    0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,
     0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
-    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,
-    0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x37,
-    0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x30,0x37,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,0x33,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x35,0x29,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6f,0x76,
-    0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x33,
-    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,
-    0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x34,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
-    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x28,0x5f,0x36,0x35,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,
-    0x6c,0x2c,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x5f,0x35,0x39,0x31,0x29,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
-    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x33,
+    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,
+    0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x6c,0x65,
+    0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x6c,
+    0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,
+    0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
+    0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,
+    0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,
+    0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,
+    0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,
+    0x6c,0x65,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,
+    0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,
+    0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,
     0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x37,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x38,0x33,
-    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
-    0x20,0x5f,0x36,0x38,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x32,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x30,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x69,0x6e,
-    0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x32,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,
-    0x39,0x34,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
-    0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,
-    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x66,
-    0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x5f,0x36,0x39,0x34,0x2c,0x20,0x64,
-    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x29,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-    0x28,0x5f,0x36,0x30,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
-    0x6e,0x67,0x6c,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x28,0x28,0x21,0x5f,0x35,0x35,0x35,0x29,0x20,0x26,0x26,
-    0x20,0x28,0x21,0x5f,0x35,0x36,0x34,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,
-    0x35,0x39,0x31,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x30,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x32,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x72,
-    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x33,0x37,0x20,0x3d,0x20,0x73,0x64,0x66,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x2c,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,
-    0x5f,0x61,0x61,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,0x5f,0x37,0x33,0x37,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x37,0x32,0x35,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x34,0x34,0x20,0x3d,
-    0x20,0x5f,0x37,0x32,0x35,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,
-    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x35,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,
-    0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,
-    0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
-    0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x5f,0x37,0x36,0x32,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x36,0x32,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x36,0x32,0x2e,0x77,0x20,0x3d,0x3d,
-    0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,
-    0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -4634,6 +3913,7 @@ static const char sprite_fs_source_metal_macos[10230] = {
         float in_aa [[attribute(9)]];
         float4 in_params [[attribute(10)]];
         float4 in_user_params [[attribute(11)]];
+        float in_depth [[attribute(12)]];
     };
     
     vertex main0_out main0(main0_in in [[stage_in]])
@@ -4651,14 +3931,14 @@ static const char sprite_fs_source_metal_macos[10230] = {
         out.v_type = in.in_params.x;
         out.v_alpha = in.in_params.y;
         out.v_fill = in.in_params.z;
-        out.gl_Position = float4(in.in_posH, 0.0, 1.0);
+        out.gl_Position = float4(in.in_posH, in.in_depth, 1.0);
         out.v_posH = in.in_posH;
         out.v_user = in.in_user_params;
         return out;
     }
     
 */
-static const char sprite_vs_source_metal_ios[1624] = {
+static const char sprite_vs_source_metal_ios[1670] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
@@ -4725,42 +4005,45 @@ static const char sprite_vs_source_metal_ios[1624] = {
     0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,
     0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
-    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
-    0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
-    0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,
-    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
-    0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
-    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
-    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
-    0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,
-    0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,
-    0x48,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,
-    0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x72,
+    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,
+    0x2e,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -4980,162 +4263,58 @@ static const char sprite_vs_source_metal_ios[1624] = {
     fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
     {
         main0_out out = {};
-        bool _549 = in.v_type >= 0.0;
-        bool _555;
-        if (_549)
-        {
-            _555 = in.v_type < 0.00196078442968428134918212890625;
-        }
-        else
-        {
-            _555 = _549;
-        }
-        bool _558 = in.v_type > 0.00196078442968428134918212890625;
-        bool _564;
-        if (_558)
-        {
-            _564 = in.v_type < 0.0058823530562222003936767578125;
-        }
-        else
-        {
-            _564 = _558;
-        }
-        bool _567 = in.v_type > 0.0058823530562222003936767578125;
-        bool _573;
-        if (_567)
-        {
-            _573 = in.v_type < 0.009803921915590763092041015625;
-        }
-        else
-        {
-            _573 = _567;
-        }
-        bool _576 = in.v_type > 0.009803921915590763092041015625;
-        bool _582;
-        if (_576)
-        {
-            _582 = in.v_type < 0.013725490309298038482666015625;
-        }
-        else
-        {
-            _582 = _576;
-        }
-        bool _585 = in.v_type > 0.013725490309298038482666015625;
-        bool _591;
-        if (_585)
-        {
-            _591 = in.v_type < 0.01764705963432788848876953125;
-        }
-        else
-        {
-            _591 = _585;
-        }
-        bool _594 = in.v_type > 0.01764705963432788848876953125;
-        bool _600;
-        if (_594)
-        {
-            _600 = in.v_type < 0.02156862802803516387939453125;
-        }
-        else
-        {
-            _600 = _594;
-        }
-        float4 c = float4(0.0);
-        float4 _607;
-        if (!(_555 && _564))
-        {
-            float2 param = in.v_uv;
-            float2 param_1 = _619.u_texture_size;
-            float4 param_2 = u_image.sample(u_imageSmplr, smooth_uv(param, param_1));
-            _607 = de_gamma(param_2);
-        }
-        else
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size)));
+        if (is_sprite)
         {
-            _607 = c;
+            c = gamma(overlay(c, in.v_col));
         }
-        c = _607;
-        float4 _636;
-        if (_555)
+        if (is_text)
         {
-            float4 param_3 = c;
-            float4 param_4 = in.v_col;
-            float4 param_5 = overlay(param_3, param_4);
-            _636 = gamma(param_5);
+            c = in.v_col * c.w;
         }
-        else
+        if (is_text_sdf)
         {
-            _636 = c;
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
         }
-        c = _636;
-        float4 _652;
-        if (_564)
+        if (is_tri)
         {
-            _652 = in.v_col * c.w;
+            c = in.v_col;
         }
-        else
-        {
-            _652 = c;
-        }
-        c = select(_652, in.v_col, bool4(_591));
         float d = 0.0;
-        if (_573)
+        if (is_box)
         {
-            float2 param_6 = in.v_pos;
-            float2 param_7 = in.v_a;
-            float2 param_8 = in.v_b;
-            float2 param_9 = in.v_c;
-            float _683 = distance_box(param_6, param_7, param_8, param_9);
-            d = _683;
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
         }
-        else
+        else if (is_seg)
         {
-            if (_582)
-            {
-                float2 param_10 = in.v_pos;
-                float2 param_11 = in.v_a;
-                float2 param_12 = in.v_b;
-                float _694 = distance_segment(param_10, param_11, param_12);
-                d = _694;
-                float2 param_13 = in.v_pos;
-                float2 param_14 = in.v_b;
-                float2 param_15 = in.v_c;
-                d = fast::min(_694, distance_segment(param_13, param_14, param_15));
-            }
-            else
-            {
-                if (_600)
-                {
-                    float2 param_16 = in.v_pos;
-                    float2 param_17 = in.v_a;
-                    float2 param_18 = in.v_b;
-                    float2 param_19 = in.v_c;
-                    d = distance_triangle(param_16, param_17, param_18, param_19);
-                }
-            }
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
         }
-        float4 _725;
-        if (((!_555) && (!_564)) && (!_591))
+        else if (is_tri_sdf)
         {
-            float4 param_20 = c;
-            float4 param_21 = in.v_col;
-            float param_22 = d - in.v_radius;
-            float4 _737 = sdf(param_20, param_21, param_22, in.v_stroke, in.v_aa, out.result, in.v_fill);
-            _725 = _737;
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
         }
-        else
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
         {
-            _725 = c;
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
         }
-        float4 _744 = _725 * in.v_alpha;
-        c = _744;
-        float4 param_23 = _744;
-        float2 param_24 = in.v_pos;
-        float2 param_25 = in.v_uv;
-        float2 param_26 = (in.v_posH + float2(1.0)) * 0.5;
-        float4 param_27 = in.v_user;
-        float4 _762 = shader(param_23, param_24, param_25, param_26, param_27);
-        c = _762;
-        if (_762.w == 0.0)
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
         {
             discard_fragment();
         }
@@ -5144,7 +4323,7 @@ static const char sprite_vs_source_metal_ios[1624] = {
     }
     
 */
-static const char sprite_fs_source_metal_ios[10230] = {
+static const char sprite_fs_source_metal_ios[9058] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -5549,242 +4728,169 @@ static const char sprite_fs_source_metal_ios[10230] = {
     0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
     0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
     0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x34,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x34,0x39,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x35,0x35,0x20,0x3d,0x20,0x5f,0x35,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x38,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x34,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x38,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
-    0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,
-    0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x35,0x36,0x34,0x20,0x3d,0x20,0x5f,0x35,0x35,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x37,0x20,
-    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
-    0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,
-    0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x33,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x37,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x37,0x33,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
-    0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,
-    0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x37,0x33,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x36,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,
-    0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,
-    0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,
-    0x20,0x3d,0x20,0x5f,0x35,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x35,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,
-    0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,
-    0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,
-    0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,
-    0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,
-    0x5f,0x35,0x38,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
-    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,
-    0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,
-    0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
-    0x6c,0x20,0x5f,0x36,0x30,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x5f,0x35,0x39,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,
-    0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,
-    0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x5f,0x35,0x39,0x34,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x36,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,
-    0x35,0x35,0x35,0x20,0x26,0x26,0x20,0x5f,0x35,0x36,0x34,0x29,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,0x31,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,
+    0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,
+    0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,
+    0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,
+    0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,
+    0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,
+    0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,
+    0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,
+    0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,
+    0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,
+    0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,
+    0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,0x2e,0x76,0x5f,
+    0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
     0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x75,0x5f,0x69,0x6d,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,
+    0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,
     0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
-    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,
-    0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x37,
-    0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x30,0x37,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,0x33,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x35,0x29,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6f,0x76,
-    0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x33,
-    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,
-    0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x34,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
-    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x28,0x5f,0x36,0x35,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,
-    0x6c,0x2c,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x5f,0x35,0x39,0x31,0x29,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
-    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x33,
+    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,
+    0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x6c,0x65,
+    0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x6c,
+    0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,
+    0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
+    0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,
+    0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,
+    0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,
+    0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,
+    0x6c,0x65,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,
+    0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,
+    0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,
     0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x37,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x38,0x33,
-    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
-    0x20,0x5f,0x36,0x38,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x32,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x30,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x69,0x6e,
-    0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x32,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,
-    0x39,0x34,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
-    0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,
-    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x66,
-    0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x5f,0x36,0x39,0x34,0x2c,0x20,0x64,
-    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x29,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-    0x28,0x5f,0x36,0x30,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
-    0x6e,0x67,0x6c,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x28,0x28,0x21,0x5f,0x35,0x35,0x35,0x29,0x20,0x26,0x26,
-    0x20,0x28,0x21,0x5f,0x35,0x36,0x34,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,
-    0x35,0x39,0x31,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x30,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x32,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x72,
-    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x33,0x37,0x20,0x3d,0x20,0x73,0x64,0x66,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x2c,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,
-    0x5f,0x61,0x61,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,0x5f,0x37,0x33,0x37,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x37,0x32,0x35,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x34,0x34,0x20,0x3d,
-    0x20,0x5f,0x37,0x32,0x35,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,
-    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x35,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,
-    0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,
-    0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
-    0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x5f,0x37,0x36,0x32,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x36,0x32,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x36,0x32,0x2e,0x77,0x20,0x3d,0x3d,
-    0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,
-    0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
 };
 /*
     #include <metal_stdlib>
@@ -5825,6 +4931,7 @@ static const char sprite_fs_source_metal_ios[10230] = {
         float in_aa [[attribute(9)]];
         float4 in_params [[attribute(10)]];
         float4 in_user_params [[attribute(11)]];
+        float in_depth [[attribute(12)]];
     };
     
     vertex main0_out main0(main0_in in [[stage_in]])
@@ -5842,14 +4949,14 @@ static const char sprite_fs_source_metal_ios[10230] = {
         out.v_type = in.in_params.x;
         out.v_alpha = in.in_params.y;
         out.v_fill = in.in_params.z;
-        out.gl_Position = float4(in.in_posH, 0.0, 1.0);
+        out.gl_Position = float4(in.in_posH, in.in_depth, 1.0);
         out.v_posH = in.in_posH;
         out.v_user = in.in_user_params;
         return out;
     }
     
 */
-static const char sprite_vs_source_metal_sim[1624] = {
+static const char sprite_vs_source_metal_sim[1670] = {
     0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x3c,0x6d,0x65,0x74,0x61,0x6c,0x5f,
     0x73,0x74,0x64,0x6c,0x69,0x62,0x3e,0x0a,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
     0x20,0x3c,0x73,0x69,0x6d,0x64,0x2f,0x73,0x69,0x6d,0x64,0x2e,0x68,0x3e,0x0a,0x0a,
@@ -5916,42 +5023,45 @@ static const char sprite_vs_source_metal_sim[1624] = {
     0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x30,0x29,0x5d,0x5d,0x3b,0x0a,
     0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x69,0x6e,0x5f,0x75,0x73,
     0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x20,0x5b,0x5b,0x61,0x74,0x74,0x72,
-    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,
-    0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
-    0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x69,0x6e,
-    0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,0x65,0x5f,0x69,0x6e,0x5d,0x5d,
-    0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,0x75,
-    0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
-    0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
-    0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x63,
-    0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,
-    0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x61,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
-    0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x20,0x3d,0x20,0x69,0x6e,
-    0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x79,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x7a,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,0x50,0x6f,0x73,0x69,0x74,0x69,
-    0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x69,0x6e,0x2e,0x69,
-    0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x30,0x2e,0x30,0x2c,0x20,0x31,0x2e,0x30,
-    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,
-    0x48,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,
-    0x6d,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,
-    0x75,0x74,0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x31,0x29,0x5d,0x5d,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x20,
+    0x5b,0x5b,0x61,0x74,0x74,0x72,0x69,0x62,0x75,0x74,0x65,0x28,0x31,0x32,0x29,0x5d,
+    0x5d,0x3b,0x0a,0x7d,0x3b,0x0a,0x0a,0x76,0x65,0x72,0x74,0x65,0x78,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6d,0x61,0x69,0x6e,0x30,0x28,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x69,0x6e,0x20,0x69,0x6e,0x20,0x5b,0x5b,0x73,0x74,0x61,0x67,
+    0x65,0x5f,0x69,0x6e,0x5d,0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
+    0x69,0x6e,0x30,0x5f,0x6f,0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,
+    0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x62,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x63,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x76,0x20,0x3d,
+    0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,
+    0x75,0x74,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,
+    0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,
+    0x72,0x61,0x64,0x69,0x75,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x72,
+    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,
+    0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,
+    0x76,0x5f,0x61,0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x61,0x61,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,0x2e,0x78,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,
+    0x61,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x2e,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x66,0x69,
+    0x6c,0x6c,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x61,0x72,0x61,0x6d,
+    0x73,0x2e,0x7a,0x3b,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x67,0x6c,0x5f,
+    0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x34,0x28,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x2c,0x20,0x69,0x6e,
+    0x2e,0x69,0x6e,0x5f,0x64,0x65,0x70,0x74,0x68,0x2c,0x20,0x31,0x2e,0x30,0x29,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x69,0x6e,0x5f,0x70,0x6f,0x73,0x48,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x6f,0x75,0x74,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x69,0x6e,0x5f,0x75,0x73,0x65,0x72,0x5f,0x70,0x61,0x72,0x61,0x6d,0x73,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
+    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
 };
 /*
     #pragma clang diagnostic ignored "-Wmissing-prototypes"
@@ -6171,162 +5281,58 @@ static const char sprite_vs_source_metal_sim[1624] = {
     fragment main0_out main0(main0_in in [[stage_in]], constant fs_params& _619 [[buffer(0)]], texture2d<float> u_image [[texture(0)]], sampler u_imageSmplr [[sampler(0)]])
     {
         main0_out out = {};
-        bool _549 = in.v_type >= 0.0;
-        bool _555;
-        if (_549)
-        {
-            _555 = in.v_type < 0.00196078442968428134918212890625;
-        }
-        else
-        {
-            _555 = _549;
-        }
-        bool _558 = in.v_type > 0.00196078442968428134918212890625;
-        bool _564;
-        if (_558)
-        {
-            _564 = in.v_type < 0.0058823530562222003936767578125;
-        }
-        else
-        {
-            _564 = _558;
-        }
-        bool _567 = in.v_type > 0.0058823530562222003936767578125;
-        bool _573;
-        if (_567)
-        {
-            _573 = in.v_type < 0.009803921915590763092041015625;
-        }
-        else
-        {
-            _573 = _567;
-        }
-        bool _576 = in.v_type > 0.009803921915590763092041015625;
-        bool _582;
-        if (_576)
-        {
-            _582 = in.v_type < 0.013725490309298038482666015625;
-        }
-        else
-        {
-            _582 = _576;
-        }
-        bool _585 = in.v_type > 0.013725490309298038482666015625;
-        bool _591;
-        if (_585)
-        {
-            _591 = in.v_type < 0.01764705963432788848876953125;
-        }
-        else
-        {
-            _591 = _585;
-        }
-        bool _594 = in.v_type > 0.01764705963432788848876953125;
-        bool _600;
-        if (_594)
-        {
-            _600 = in.v_type < 0.02156862802803516387939453125;
-        }
-        else
-        {
-            _600 = _594;
-        }
-        float4 c = float4(0.0);
-        float4 _607;
-        if (!(_555 && _564))
-        {
-            float2 param = in.v_uv;
-            float2 param_1 = _619.u_texture_size;
-            float4 param_2 = u_image.sample(u_imageSmplr, smooth_uv(param, param_1));
-            _607 = de_gamma(param_2);
-        }
-        else
+        bool is_sprite = in.v_type >= 0.0 && in.v_type < 0.00196078442968428134918212890625;
+        bool is_text = in.v_type > 0.00196078442968428134918212890625 && in.v_type < 0.0058823530562222003936767578125;
+        bool is_box = in.v_type > 0.0058823530562222003936767578125 && in.v_type < 0.009803921915590763092041015625;
+        bool is_seg = in.v_type > 0.009803921915590763092041015625 && in.v_type < 0.013725490309298038482666015625;
+        bool is_tri = in.v_type > 0.013725490309298038482666015625 && in.v_type < 0.01764705963432788848876953125;
+        bool is_tri_sdf = in.v_type > 0.01764705963432788848876953125 && in.v_type < 0.02156862802803516387939453125;
+        bool is_text_sdf = in.v_type > 0.02156862802803516387939453125 && in.v_type < 0.0254901959002017974853515625;
+        float2 texel_pos = in.v_uv * _619.u_texture_size;
+        float texels_per_pixel = 0.5 * (length(dfdx(texel_pos)) + length(dfdy(texel_pos)));
+        float4 c = de_gamma(u_image.sample(u_imageSmplr, smooth_uv(in.v_uv, _619.u_texture_size)));
+        if (is_sprite)
         {
-            _607 = c;
+            c = gamma(overlay(c, in.v_col));
         }
-        c = _607;
-        float4 _636;
-        if (_555)
+        if (is_text)
         {
-            float4 param_3 = c;
-            float4 param_4 = in.v_col;
-            float4 param_5 = overlay(param_3, param_4);
-            _636 = gamma(param_5);
+            c = in.v_col * c.w;
         }
-        else
+        if (is_text_sdf)
         {
-            _636 = c;
+            float2 texel = in.v_uv * _619.u_texture_size - float2(0.5);
+            float2 base = floor(texel);
+            float2 f = texel - base;
+            float2 uv0 = (base + float2(0.5)) / _619.u_texture_size;
+            float2 uv1 = (base + float2(1.5)) / _619.u_texture_size;
+            float sd = mix(mix(u_image.sample(u_imageSmplr, uv0, level(0.0)).w, u_image.sample(u_imageSmplr, float2(uv1.x, uv0.y), level(0.0)).w, f.x), mix(u_image.sample(u_imageSmplr, float2(uv0.x, uv1.y), level(0.0)).w, u_image.sample(u_imageSmplr, uv1, level(0.0)).w, f.x), f.y);
+            c = in.v_col * saturate((sd - 0.501960813999176025390625) * 11.953125 / texels_per_pixel + 0.5);
         }
-        c = _636;
-        float4 _652;
-        if (_564)
+        if (is_tri)
         {
-            _652 = in.v_col * c.w;
+            c = in.v_col;
         }
-        else
-        {
-            _652 = c;
-        }
-        c = select(_652, in.v_col, bool4(_591));
         float d = 0.0;
-        if (_573)
+        if (is_box)
         {
-            float2 param_6 = in.v_pos;
-            float2 param_7 = in.v_a;
-            float2 param_8 = in.v_b;
-            float2 param_9 = in.v_c;
-            float _683 = distance_box(param_6, param_7, param_8, param_9);
-            d = _683;
+            float2 p = in.v_pos;
+            d = distance_box(p, in.v_a, in.v_b, in.v_c);
         }
-        else
+        else if (is_seg)
         {
-            if (_582)
-            {
-                float2 param_10 = in.v_pos;
-                float2 param_11 = in.v_a;
-                float2 param_12 = in.v_b;
-                float _694 = distance_segment(param_10, param_11, param_12);
-                d = _694;
-                float2 param_13 = in.v_pos;
-                float2 param_14 = in.v_b;
-                float2 param_15 = in.v_c;
-                d = fast::min(_694, distance_segment(param_13, param_14, param_15));
-            }
-            else
-            {
-                if (_600)
-                {
-                    float2 param_16 = in.v_pos;
-                    float2 param_17 = in.v_a;
-                    float2 param_18 = in.v_b;
-                    float2 param_19 = in.v_c;
-                    d = distance_triangle(param_16, param_17, param_18, param_19);
-                }
-            }
+            d = min(distance_segment(in.v_pos, in.v_a, in.v_b), distance_segment(in.v_pos, in.v_b, in.v_c));
         }
-        float4 _725;
-        if (((!_555) && (!_564)) && (!_591))
+        else if (is_tri_sdf)
         {
-            float4 param_20 = c;
-            float4 param_21 = in.v_col;
-            float param_22 = d - in.v_radius;
-            float4 _737 = sdf(param_20, param_21, param_22, in.v_stroke, in.v_aa, out.result, in.v_fill);
-            _725 = _737;
+            d = distance_triangle(in.v_pos, in.v_a, in.v_b, in.v_c);
         }
-        else
+        if (!is_sprite && !is_text && !is_tri && !is_text_sdf)
         {
-            _725 = c;
+            c = sdf(c, in.v_col, d - in.v_radius, in.v_stroke, in.v_aa, out.result, in.v_fill);
         }
-        float4 _744 = _725 * in.v_alpha;
-        c = _744;
-        float4 param_23 = _744;
-        float2 param_24 = in.v_pos;
-        float2 param_25 = in.v_uv;
-        float2 param_26 = (in.v_posH + float2(1.0)) * 0.5;
-        float4 param_27 = in.v_user;
-        float4 _762 = shader(param_23, param_24, param_25, param_26, param_27);
-        c = _762;
-        if (_762.w == 0.0)
+        c = shader(c * in.v_alpha, in.v_pos, in.v_uv, (in.v_posH + float2(1.0)) * 0.5, in.v_user);
+        if (c.w == 0.0)
         {
             discard_fragment();
         }
@@ -6335,7 +5341,7 @@ static const char sprite_vs_source_metal_sim[1624] = {
     }
     
 */
-static const char sprite_fs_source_metal_sim[10230] = {
+static const char sprite_fs_source_metal_sim[9058] = {
     0x23,0x70,0x72,0x61,0x67,0x6d,0x61,0x20,0x63,0x6c,0x61,0x6e,0x67,0x20,0x64,0x69,
     0x61,0x67,0x6e,0x6f,0x73,0x74,0x69,0x63,0x20,0x69,0x67,0x6e,0x6f,0x72,0x65,0x64,
     0x20,0x22,0x2d,0x57,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x2d,0x70,0x72,0x6f,0x74,
@@ -6740,242 +5746,169 @@ static const char sprite_fs_source_metal_sim[10230] = {
     0x6c,0x72,0x20,0x5b,0x5b,0x73,0x61,0x6d,0x70,0x6c,0x65,0x72,0x28,0x30,0x29,0x5d,
     0x5d,0x29,0x0a,0x7b,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x69,0x6e,0x30,0x5f,0x6f,
     0x75,0x74,0x20,0x6f,0x75,0x74,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x34,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x35,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x34,0x39,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x35,0x35,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x35,0x35,0x20,0x3d,0x20,0x5f,0x35,0x34,0x39,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x35,0x38,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,
-    0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x34,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x38,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x36,0x34,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
-    0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,
-    0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x35,0x36,0x34,0x20,0x3d,0x20,0x5f,0x35,0x35,0x38,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x36,0x37,0x20,
-    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,
-    0x30,0x30,0x35,0x38,0x38,0x32,0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,
-    0x30,0x30,0x33,0x39,0x33,0x36,0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x33,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x37,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x37,0x33,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,
-    0x2e,0x30,0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,
-    0x37,0x36,0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,
-    0x37,0x33,0x20,0x3d,0x20,0x5f,0x35,0x36,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,
-    0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x37,0x36,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,
-    0x30,0x39,0x38,0x30,0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,
-    0x33,0x30,0x39,0x32,0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x32,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x36,0x29,0x0a,0x20,0x20,0x20,0x20,
-    0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,
-    0x31,0x33,0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,
-    0x38,0x34,0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x38,0x32,
-    0x20,0x3d,0x20,0x5f,0x35,0x37,0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x38,0x35,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,
-    0x37,0x32,0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,
-    0x38,0x32,0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x31,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x35,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,
-    0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,
-    0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x35,0x39,0x31,0x20,0x3d,0x20,
-    0x5f,0x35,0x38,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x62,0x6f,0x6f,0x6c,0x20,0x5f,0x35,0x39,0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
-    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,0x37,
-    0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,0x37,
-    0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,
-    0x6c,0x20,0x5f,0x36,0x30,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-    0x5f,0x35,0x39,0x34,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,
-    0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,
-    0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x30,0x20,0x3d,0x20,0x5f,0x35,0x39,0x34,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x28,0x30,0x2e,
-    0x30,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,
-    0x36,0x30,0x37,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x21,0x28,0x5f,
-    0x35,0x35,0x35,0x20,0x26,0x26,0x20,0x5f,0x35,0x36,0x34,0x29,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x20,0x3d,0x20,0x5f,0x36,0x31,
+    0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,
+    0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x3d,0x20,0x30,
+    0x2e,0x30,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,
+    0x3c,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,0x34,0x32,0x39,
+    0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,0x32,0x38,0x39,
+    0x30,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,0x6f,0x6c,0x20,0x69,
+    0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,
+    0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x31,0x39,0x36,0x30,0x37,0x38,0x34,
+    0x34,0x32,0x39,0x36,0x38,0x34,0x32,0x38,0x31,0x33,0x34,0x39,0x31,0x38,0x32,0x31,
+    0x32,0x38,0x39,0x30,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,0x33,
+    0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,0x37,
+    0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x62,0x6f,0x78,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,
+    0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x35,0x38,0x38,0x32,
+    0x33,0x35,0x33,0x30,0x35,0x36,0x32,0x32,0x32,0x32,0x30,0x30,0x33,0x39,0x33,0x36,
+    0x37,0x36,0x37,0x35,0x37,0x38,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x73,0x65,0x67,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x30,0x39,0x38,0x30,
+    0x33,0x39,0x32,0x31,0x39,0x31,0x35,0x35,0x39,0x30,0x37,0x36,0x33,0x30,0x39,0x32,
+    0x30,0x34,0x31,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,
+    0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x20,0x3d,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,0x33,0x37,0x32,
+    0x35,0x34,0x39,0x30,0x33,0x30,0x39,0x32,0x39,0x38,0x30,0x33,0x38,0x34,0x38,0x32,
+    0x36,0x36,0x36,0x30,0x31,0x35,0x36,0x32,0x35,0x20,0x26,0x26,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x31,0x37,0x36,0x34,
+    0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,0x34,0x38,0x38,
+    0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
+    0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x20,0x3d,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,0x2e,0x30,0x31,
+    0x37,0x36,0x34,0x37,0x30,0x35,0x39,0x36,0x33,0x34,0x33,0x32,0x37,0x38,0x38,0x38,
+    0x34,0x38,0x38,0x37,0x36,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x26,0x26,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,0x30,0x32,0x31,
+    0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,0x31,0x36,0x33,0x38,
+    0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x62,0x6f,0x6f,0x6c,0x20,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3e,0x20,0x30,
+    0x2e,0x30,0x32,0x31,0x35,0x36,0x38,0x36,0x32,0x38,0x30,0x32,0x38,0x30,0x33,0x35,
+    0x31,0x36,0x33,0x38,0x37,0x39,0x33,0x39,0x34,0x35,0x33,0x31,0x32,0x35,0x20,0x26,
+    0x26,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x74,0x79,0x70,0x65,0x20,0x3c,0x20,0x30,0x2e,
+    0x30,0x32,0x35,0x34,0x39,0x30,0x31,0x39,0x35,0x39,0x30,0x30,0x32,0x30,0x31,0x37,
+    0x39,0x37,0x34,0x38,0x35,0x33,0x35,0x31,0x35,0x36,0x32,0x35,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,
+    0x6f,0x73,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,
+    0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,
+    0x7a,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x74,0x65,
+    0x78,0x65,0x6c,0x73,0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x3d,
+    0x20,0x30,0x2e,0x35,0x20,0x2a,0x20,0x28,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,
+    0x66,0x64,0x78,0x28,0x74,0x65,0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x20,
+    0x2b,0x20,0x6c,0x65,0x6e,0x67,0x74,0x68,0x28,0x64,0x66,0x64,0x79,0x28,0x74,0x65,
+    0x78,0x65,0x6c,0x5f,0x70,0x6f,0x73,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x63,0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,
+    0x6d,0x6d,0x61,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,
+    0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,
+    0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,0x76,0x28,0x69,0x6e,0x2e,0x76,0x5f,
+    0x75,0x76,0x2c,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,
+    0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x29,0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,
+    0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x6f,0x76,0x65,0x72,0x6c,0x61,0x79,0x28,0x63,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x29,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,
+    0x65,0x78,0x74,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
+    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
+    0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x5f,0x73,0x64,0x66,
+    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x3d,0x20,0x69,
+    0x6e,0x2e,0x76,0x5f,0x75,0x76,0x20,0x2a,0x20,0x5f,0x36,0x31,0x39,0x2e,0x75,0x5f,
+    0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,0x20,0x2d,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x62,0x61,0x73,0x65,0x20,
+    0x3d,0x20,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x74,0x65,0x78,0x65,0x6c,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x66,
+    0x20,0x3d,0x20,0x74,0x65,0x78,0x65,0x6c,0x20,0x2d,0x20,0x62,0x61,0x73,0x65,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,
+    0x75,0x76,0x30,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x30,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,0x31,
     0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,0x65,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x20,0x3d,0x20,0x75,0x5f,0x69,0x6d,0x61,
+    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,
+    0x20,0x75,0x76,0x31,0x20,0x3d,0x20,0x28,0x62,0x61,0x73,0x65,0x20,0x2b,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x35,0x29,0x29,0x20,0x2f,0x20,0x5f,0x36,
+    0x31,0x39,0x2e,0x75,0x5f,0x74,0x65,0x78,0x74,0x75,0x72,0x65,0x5f,0x73,0x69,0x7a,
+    0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
+    0x20,0x73,0x64,0x20,0x3d,0x20,0x6d,0x69,0x78,0x28,0x6d,0x69,0x78,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x30,0x2c,0x20,
+    0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,
+    0x5f,0x69,0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,
+    0x69,0x6d,0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x28,0x75,0x76,0x31,0x2e,0x78,0x2c,0x20,0x75,0x76,0x30,0x2e,0x79,0x29,
+    0x2c,0x20,0x6c,0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,
+    0x20,0x66,0x2e,0x78,0x29,0x2c,0x20,0x6d,0x69,0x78,0x28,0x75,0x5f,0x69,0x6d,0x61,
     0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,0x61,0x67,
-    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x73,0x6d,0x6f,0x6f,0x74,0x68,0x5f,0x75,
-    0x76,0x28,0x70,0x61,0x72,0x61,0x6d,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x29,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x30,0x37,
-    0x20,0x3d,0x20,0x64,0x65,0x5f,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x5f,0x36,0x30,0x37,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x30,0x37,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,0x33,0x36,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x35,0x35,0x29,0x0a,
-    0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,
-    0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,
-    0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
-    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,
-    0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x35,0x20,0x3d,0x20,0x6f,0x76,
-    0x65,0x72,0x6c,0x61,0x79,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x33,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x34,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x67,0x61,0x6d,0x6d,0x61,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x35,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x36,0x33,0x36,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x36,0x33,
-    0x36,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x36,
-    0x35,0x32,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x36,0x34,
-    0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,
-    0x2a,0x20,0x63,0x2e,0x77,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x5f,0x36,0x35,0x32,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x65,0x6c,0x65,
-    0x63,0x74,0x28,0x5f,0x36,0x35,0x32,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,
-    0x6c,0x2c,0x20,0x62,0x6f,0x6f,0x6c,0x34,0x28,0x5f,0x35,0x39,0x31,0x29,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,
-    0x2e,0x30,0x3b,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x37,0x33,
+    0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x75,
+    0x76,0x30,0x2e,0x78,0x2c,0x20,0x75,0x76,0x31,0x2e,0x79,0x29,0x2c,0x20,0x6c,0x65,
+    0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x75,0x5f,0x69,
+    0x6d,0x61,0x67,0x65,0x2e,0x73,0x61,0x6d,0x70,0x6c,0x65,0x28,0x75,0x5f,0x69,0x6d,
+    0x61,0x67,0x65,0x53,0x6d,0x70,0x6c,0x72,0x2c,0x20,0x75,0x76,0x31,0x2c,0x20,0x6c,
+    0x65,0x76,0x65,0x6c,0x28,0x30,0x2e,0x30,0x29,0x29,0x2e,0x77,0x2c,0x20,0x66,0x2e,
+    0x78,0x29,0x2c,0x20,0x66,0x2e,0x79,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
+    0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x20,0x2a,
+    0x20,0x73,0x61,0x74,0x75,0x72,0x61,0x74,0x65,0x28,0x28,0x73,0x64,0x20,0x2d,0x20,
+    0x30,0x2e,0x35,0x30,0x31,0x39,0x36,0x30,0x38,0x31,0x33,0x39,0x39,0x39,0x31,0x37,
+    0x36,0x30,0x32,0x35,0x33,0x39,0x30,0x36,0x32,0x35,0x29,0x20,0x2a,0x20,0x31,0x31,
+    0x2e,0x39,0x35,0x33,0x31,0x32,0x35,0x20,0x2f,0x20,0x74,0x65,0x78,0x65,0x6c,0x73,
+    0x5f,0x70,0x65,0x72,0x5f,0x70,0x69,0x78,0x65,0x6c,0x20,0x2b,0x20,0x30,0x2e,0x35,
+    0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
+    0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x20,0x64,0x20,0x3d,0x20,0x30,0x2e,0x30,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x62,0x6f,0x78,0x29,0x0a,0x20,0x20,
+    0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
+    0x74,0x32,0x20,0x70,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
+    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x64,0x69,0x73,
+    0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,0x70,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x69,0x73,0x5f,0x73,0x65,0x67,0x29,
+    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
+    0x20,0x3d,0x20,0x6d,0x69,0x6e,0x28,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+    0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,
+    0x29,0x2c,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,
+    0x65,0x6e,0x74,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x29,0x29,0x3b,0x0a,
+    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
+    0x66,0x20,0x28,0x69,0x73,0x5f,0x74,0x72,0x69,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,
+    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
+    0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,0x6e,0x67,
+    0x6c,0x65,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x61,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x63,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
+    0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x5f,0x73,0x70,0x72,0x69,0x74,0x65,0x20,0x26,
+    0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,0x74,0x20,0x26,0x26,0x20,0x21,0x69,
+    0x73,0x5f,0x74,0x72,0x69,0x20,0x26,0x26,0x20,0x21,0x69,0x73,0x5f,0x74,0x65,0x78,
+    0x74,0x5f,0x73,0x64,0x66,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,
+    0x20,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x64,0x66,0x28,0x63,0x2c,0x20,
+    0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x2c,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x72,0x61,0x64,0x69,0x75,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,
+    0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x61,0x2c,
+    0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,0x20,0x69,0x6e,0x2e,
+    0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
+    0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x63,0x20,
+    0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,0x68,0x61,0x2c,0x20,0x69,0x6e,
+    0x2e,0x76,0x5f,0x70,0x6f,0x73,0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x2c,
+    0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,0x66,0x6c,
+    0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,0x2e,0x35,
+    0x2c,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x73,0x65,0x72,0x29,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x69,0x66,0x20,0x28,0x63,0x2e,0x77,0x20,0x3d,0x3d,0x20,0x30,0x2e,0x30,
     0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x37,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,0x38,0x33,
-    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x62,0x6f,0x78,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x37,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x39,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,
-    0x20,0x5f,0x36,0x38,0x33,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-    0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x35,0x38,0x32,0x29,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x31,0x30,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,
-    0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x20,0x3d,0x20,0x69,0x6e,
-    0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x32,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x5f,0x36,
-    0x39,0x34,0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,
-    0x67,0x6d,0x65,0x6e,0x74,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x30,0x2c,0x20,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x32,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x64,0x20,0x3d,0x20,0x5f,0x36,0x39,0x34,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x31,0x33,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,
-    0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x34,0x20,0x3d,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x35,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x20,0x3d,0x20,0x66,
-    0x61,0x73,0x74,0x3a,0x3a,0x6d,0x69,0x6e,0x28,0x5f,0x36,0x39,0x34,0x2c,0x20,0x64,
-    0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x73,0x65,0x67,0x6d,0x65,0x6e,0x74,0x28,
-    0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,
-    0x31,0x34,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x35,0x29,0x29,0x3b,0x0a,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x65,0x6c,0x73,0x65,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-    0x28,0x5f,0x36,0x30,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x36,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-    0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x38,0x20,0x3d,0x20,0x69,0x6e,0x2e,
-    0x76,0x5f,0x62,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x31,0x39,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-    0x20,0x3d,0x20,0x64,0x69,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x74,0x72,0x69,0x61,
-    0x6e,0x67,0x6c,0x65,0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x36,0x2c,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x31,0x37,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,
-    0x38,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x31,0x39,0x29,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x32,0x35,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x69,0x66,0x20,0x28,0x28,0x28,0x21,0x5f,0x35,0x35,0x35,0x29,0x20,0x26,0x26,
-    0x20,0x28,0x21,0x5f,0x35,0x36,0x34,0x29,0x29,0x20,0x26,0x26,0x20,0x28,0x21,0x5f,
-    0x35,0x39,0x31,0x29,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x30,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x31,
-    0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x63,0x6f,0x6c,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x32,0x20,0x3d,0x20,0x64,0x20,0x2d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x72,
-    0x61,0x64,0x69,0x75,0x73,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,
-    0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x33,0x37,0x20,0x3d,0x20,0x73,0x64,0x66,
-    0x28,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x30,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,
-    0x5f,0x32,0x31,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x32,0x2c,0x20,0x69,
-    0x6e,0x2e,0x76,0x5f,0x73,0x74,0x72,0x6f,0x6b,0x65,0x2c,0x20,0x69,0x6e,0x2e,0x76,
-    0x5f,0x61,0x61,0x2c,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x2c,
-    0x20,0x69,0x6e,0x2e,0x76,0x5f,0x66,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x20,0x5f,0x37,0x32,0x35,0x20,0x3d,0x20,0x5f,0x37,0x33,0x37,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x65,0x6c,0x73,0x65,
-    0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x5f,
-    0x37,0x32,0x35,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-    0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x5f,0x37,0x34,0x34,0x20,0x3d,
-    0x20,0x5f,0x37,0x32,0x35,0x20,0x2a,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x61,0x6c,0x70,
-    0x68,0x61,0x3b,0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,0x61,0x72,
-    0x61,0x6d,0x5f,0x32,0x33,0x20,0x3d,0x20,0x5f,0x37,0x34,0x34,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x34,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x3b,0x0a,0x20,0x20,
-    0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,
-    0x35,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,0x76,0x3b,0x0a,0x20,0x20,0x20,
-    0x20,0x66,0x6c,0x6f,0x61,0x74,0x32,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x36,
-    0x20,0x3d,0x20,0x28,0x69,0x6e,0x2e,0x76,0x5f,0x70,0x6f,0x73,0x48,0x20,0x2b,0x20,
-    0x66,0x6c,0x6f,0x61,0x74,0x32,0x28,0x31,0x2e,0x30,0x29,0x29,0x20,0x2a,0x20,0x30,
-    0x2e,0x35,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,0x70,
-    0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x20,0x3d,0x20,0x69,0x6e,0x2e,0x76,0x5f,0x75,
-    0x73,0x65,0x72,0x3b,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x34,0x20,
-    0x5f,0x37,0x36,0x32,0x20,0x3d,0x20,0x73,0x68,0x61,0x64,0x65,0x72,0x28,0x70,0x61,
-    0x72,0x61,0x6d,0x5f,0x32,0x33,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x34,
-    0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x35,0x2c,0x20,0x70,0x61,0x72,0x61,
-    0x6d,0x5f,0x32,0x36,0x2c,0x20,0x70,0x61,0x72,0x61,0x6d,0x5f,0x32,0x37,0x29,0x3b,
-    0x0a,0x20,0x20,0x20,0x20,0x63,0x20,0x3d,0x20,0x5f,0x37,0x36,0x32,0x3b,0x0a,0x20,
-    0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x5f,0x37,0x36,0x32,0x2e,0x77,0x20,0x3d,0x3d,
-    0x20,0x30,0x2e,0x30,0x29,0x0a,0x20,0x20,0x20,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-    0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,
-    0x6d,0x65,0x6e,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,
-    0x20,0x20,0x6f,0x75,0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,
-    0x3b,0x0a,0x20,0x20,0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,
-    0x3b,0x0a,0x7d,0x0a,0x0a,0x00,
+    0x64,0x69,0x73,0x63,0x61,0x72,0x64,0x5f,0x66,0x72,0x61,0x67,0x6d,0x65,0x6e,0x74,
+    0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x6f,0x75,
+    0x74,0x2e,0x72,0x65,0x73,0x75,0x6c,0x74,0x20,0x3d,0x20,0x63,0x3b,0x0a,0x20,0x20,
+    0x20,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x6f,0x75,0x74,0x3b,0x0a,0x7d,0x0a,
+    0x0a,0x00,
 };
 #if !defined(SOKOL_GFX_INCLUDED)
   #error "Please include sokol_gfx.h before sprite_shader.h"
@@ -6998,6 +5931,7 @@ static inline const sg_shader_desc* sprite_shader_shader_desc(sg_backend backend
       desc.attrs[9].name = "in_aa";
       desc.attrs[10].name = "in_params";
       desc.attrs[11].name = "in_user_params";
+      desc.attrs[12].name = "in_depth";
       desc.vs.source = sprite_vs_source_glsl330;
       desc.vs.entry = "main";
       desc.fs.source = sprite_fs_source_glsl330;
@@ -7031,6 +5965,7 @@ static inline const sg_shader_desc* sprite_shader_shader_desc(sg_backend backend
       desc.attrs[9].name = "in_aa";
       desc.attrs[10].name = "in_params";
       desc.attrs[11].name = "in_user_params";
+      desc.attrs[12].name = "in_depth";
       desc.vs.source = sprite_vs_source_glsl300es;
       desc.vs.entry = "main";
       desc.fs.source = sprite_fs_source_glsl300es;
@@ -7076,6 +6011,8 @@ static inline const sg_shader_desc* sprite_shader_shader_desc(sg_backend backend
       desc.attrs[10].sem_index = 10;
       desc.attrs[11].sem_name = "TEXCOORD";
       desc.attrs[11].sem_index = 11;
+      desc.attrs[12].sem_name = "TEXCOORD";
+      desc.attrs[12].sem_index = 12;
       desc.vs.source = sprite_vs_source_hlsl5;
       desc.vs.d3d11_target = "vs_5_0";
       desc.vs.entry = "main";
@@ -7185,6 +6122,9 @@ static inline int sprite_shader_attr_slot(const char* attr_name) {
   if (0 == strcmp(attr_name, "in_user_params")) {
     return 11;
   }
+  if (0 == strcmp(attr_name, "in_depth")) {
+    return 12;
+  }
   return -1;
 }
 static inline int sprite_shader_image_slot(sg_shader_stage stage, const char* img_name) {
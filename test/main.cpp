@@ -26,20 +26,37 @@
 #include <cute.h>
 
 TEST_SUITE(test_aabb_tree);
+TEST_SUITE(test_alloc);
 TEST_SUITE(test_array);
 TEST_SUITE(test_aseprite);
 TEST_SUITE(test_audio);
 TEST_SUITE(test_base64);
+TEST_SUITE(test_bitstream);
+TEST_SUITE(test_collision);
 TEST_SUITE(test_coroutine);
 TEST_SUITE(test_doubly_list);
 TEST_SUITE(test_ecs);
 TEST_SUITE(test_handle);
 TEST_SUITE(test_hashtable);
+TEST_SUITE(test_math);
+TEST_SUITE(test_noise);
+TEST_SUITE(test_particles);
 TEST_SUITE(test_path);
+TEST_SUITE(test_png);
 TEST_SUITE(test_png_cache);
+TEST_SUITE(test_priority_queue);
+TEST_SUITE(test_replay);
+TEST_SUITE(test_physics);
+TEST_SUITE(test_replication);
+TEST_SUITE(test_rnd);
+TEST_SUITE(test_spatial_hash);
 TEST_SUITE(test_sprite);
 TEST_SUITE(test_string);
+TEST_SUITE(test_threadpool);
+TEST_SUITE(test_tilemap);
 TEST_SUITE(test_json);
+TEST_SUITE(test_log);
+TEST_SUITE(test_lz4);
 TEST_SUITE(test_markups);
 
 int main(int argc, char* argv[])
@@ -63,20 +80,37 @@ int main(int argc, char* argv[])
 	pu_display_colors(true);
 
 	RUN_TEST_SUITE(test_aabb_tree);
+	RUN_TEST_SUITE(test_alloc);
 	RUN_TEST_SUITE(test_array);
 	RUN_TEST_SUITE(test_aseprite);
 	RUN_TEST_SUITE(test_audio);
 	RUN_TEST_SUITE(test_base64);
+	RUN_TEST_SUITE(test_bitstream);
+	RUN_TEST_SUITE(test_collision);
 	RUN_TEST_SUITE(test_coroutine);
 	RUN_TEST_SUITE(test_doubly_list);
 	RUN_TEST_SUITE(test_ecs);
 	RUN_TEST_SUITE(test_handle);
 	RUN_TEST_SUITE(test_hashtable);
+	RUN_TEST_SUITE(test_math);
+	RUN_TEST_SUITE(test_noise);
+	RUN_TEST_SUITE(test_particles);
 	RUN_TEST_SUITE(test_path);
+	RUN_TEST_SUITE(test_png);
 	RUN_TEST_SUITE(test_png_cache);
+	RUN_TEST_SUITE(test_priority_queue);
+	RUN_TEST_SUITE(test_replay);
+	RUN_TEST_SUITE(test_physics);
+	RUN_TEST_SUITE(test_replication);
+	RUN_TEST_SUITE(test_rnd);
+	RUN_TEST_SUITE(test_spatial_hash);
 	RUN_TEST_SUITE(test_sprite);
 	RUN_TEST_SUITE(test_string);
+	RUN_TEST_SUITE(test_threadpool);
+	RUN_TEST_SUITE(test_tilemap);
 	RUN_TEST_SUITE(test_json);
+	RUN_TEST_SUITE(test_log);
+	RUN_TEST_SUITE(test_lz4);
 	RUN_TEST_SUITE(test_markups);
 
 	pu_print_stats();
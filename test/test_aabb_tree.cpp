@@ -22,7 +22,356 @@ TEST_CASE(test_aabb_tree_make_and_destroy)
 	return true;
 }
 
+static Aabb s_random_aabb(CF_RndState* rnd)
+{
+	v2 p = V2(cf_rnd_range_float(rnd, -100.0f, 100.0f), cf_rnd_range_float(rnd, -100.0f, 100.0f));
+	v2 e = V2(cf_rnd_range_float(rnd, 0.5f, 5.0f), cf_rnd_range_float(rnd, 0.5f, 5.0f));
+	return make_aabb(p - e, p + e);
+}
+
+static bool s_has_pair(const AabbTreePair* pairs, int count, int a, int b)
+{
+	for (int i = 0; i < count; ++i) {
+		if (pairs[i].a.id == a && pairs[i].b.id == b) return true;
+		if (pairs[i].a.id == b && pairs[i].b.id == a) return true;
+	}
+	return false;
+}
+
+/* Find overlapping pairs within a tree and between two trees, and compare against brute force. */
+TEST_CASE(test_aabb_tree_find_pairs)
+{
+	CF_RndState rnd = cf_rnd_seed(7);
+	Threadpool* pool = make_threadpool(4);
+	AabbTree tree = make_aabb_tree(0);
+	AabbTree other = make_aabb_tree(0);
+	Array<Leaf> leaves;
+	Array<Leaf> other_leaves;
+	for (int i = 0; i < 400; ++i) leaves.add(aabb_tree_insert(tree, s_random_aabb(&rnd)));
+	for (int i = 0; i < 100; ++i) other_leaves.add(aabb_tree_insert(other, s_random_aabb(&rnd)));
+
+	int expected = 0;
+	for (int i = 0; i < leaves.count(); ++i) {
+		for (int j = i + 1; j < leaves.count(); ++j) {
+			if (overlaps(aabb_tree_get_aabb(tree, leaves[i]), aabb_tree_get_aabb(tree, leaves[j]))) expected++;
+		}
+	}
+	REQUIRE(expected > 0);
+	REQUIRE(aabb_tree_find_pairs(tree, NULL, 0) == expected);
+	Array<AabbTreePair> pairs;
+	pairs.ensure_count(expected);
+	Array<AabbTreePair> threaded_pairs;
+	threaded_pairs.ensure_count(expected);
+	REQUIRE(aabb_tree_find_pairs(tree, pairs.data(), expected) == expected);
+	REQUIRE(aabb_tree_find_pairs(tree, threaded_pairs.data(), expected, pool) == expected);
+	for (int i = 0; i < expected; ++i) {
+		REQUIRE(pairs[i].a.id != pairs[i].b.id);
+		REQUIRE(pairs[i].a.id == threaded_pairs[i].a.id && pairs[i].b.id == threaded_pairs[i].b.id);
+	}
+	for (int i = 0; i < leaves.count(); ++i) {
+		for (int j = i + 1; j < leaves.count(); ++j) {
+			bool hit = overlaps(aabb_tree_get_aabb(tree, leaves[i]), aabb_tree_get_aabb(tree, leaves[j]));
+			REQUIRE(hit == s_has_pair(pairs.data(), expected, leaves[i].id, leaves[j].id));
+		}
+	}
+
+	expected = 0;
+	for (int i = 0; i < leaves.count(); ++i) {
+		for (int j = 0; j < other_leaves.count(); ++j) {
+			if (overlaps(aabb_tree_get_aabb(tree, leaves[i]), aabb_tree_get_aabb(other, other_leaves[j]))) expected++;
+		}
+	}
+	pairs.ensure_count(expected);
+	REQUIRE(aabb_tree_find_pairs(tree, other, pairs.data(), expected, pool) == expected);
+	for (int i = 0; i < expected; ++i) {
+		REQUIRE(overlaps(aabb_tree_get_aabb(tree, pairs[i].a), aabb_tree_get_aabb(other, pairs[i].b)));
+	}
+
+	destroy_aabb_tree(other);
+	destroy_aabb_tree(tree);
+	destroy_threadpool(pool);
+	return true;
+}
+
+static bool s_collect_leaf(Leaf leaf, Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	((Array<Leaf>*)fn_udata)->add(leaf);
+	return true;
+}
+
+static bool s_has_leaf(const Leaf* leaves, int count, Leaf leaf)
+{
+	for (int i = 0; i < count; ++i) {
+		if (leaves[i].id == leaf.id) return true;
+	}
+	return false;
+}
+
+/* Batch queries find the same leaves as one query at a time. */
+TEST_CASE(test_aabb_tree_query_batch)
+{
+	CF_RndState rnd = cf_rnd_seed(11);
+	Threadpool* pool = make_threadpool(4);
+	AabbTree tree = make_aabb_tree(0);
+	for (int i = 0; i < 300; ++i) aabb_tree_insert(tree, s_random_aabb(&rnd));
+
+	const int count = 200;
+	const int max_hits = 64;
+	Array<Aabb> aabbs;
+	Array<Ray> rays;
+	for (int i = 0; i < count; ++i) {
+		aabbs.add(s_random_aabb(&rnd));
+		Ray ray;
+		ray.p = V2(cf_rnd_range_float(&rnd, -100.0f, 100.0f), cf_rnd_range_float(&rnd, -100.0f, 100.0f));
+		ray.d = safe_norm(V2(cf_rnd_range_float(&rnd, -1.0f, 1.0f), cf_rnd_range_float(&rnd, -1.0f, 1.0f)));
+		ray.t = 50.0f;
+		rays.add(ray);
+	}
+	Array<Leaf> hits;
+	hits.ensure_count(count * max_hits);
+	Array<int> hit_counts;
+	hit_counts.ensure_count(count);
+
+	for (int pass = 0; pass < 4; ++pass) {
+		bool use_rays = pass & 1;
+		Threadpool* p = pass & 2 ? pool : NULL;
+		if (use_rays) aabb_tree_query_batch(tree, rays.data(), count, hits.data(), max_hits, hit_counts.data(), p);
+		else aabb_tree_query_batch(tree, aabbs.data(), count, hits.data(), max_hits, hit_counts.data(), p);
+		for (int i = 0; i < count; ++i) {
+			Array<Leaf> expected;
+			if (use_rays) aabb_tree_query(tree, s_collect_leaf, rays[i], &expected);
+			else aabb_tree_query(tree, s_collect_leaf, aabbs[i], &expected);
+			REQUIRE(hit_counts[i] == expected.count());
+			REQUIRE(hit_counts[i] <= max_hits);
+			for (int j = 0; j < expected.count(); ++j) {
+				REQUIRE(s_has_leaf(hits.data() + i * max_hits, hit_counts[i], expected[j]));
+			}
+		}
+	}
+
+	// A ray straight through a known box must hit it.
+	Leaf target = aabb_tree_insert(tree, make_aabb(V2(200.0f, -1.0f), V2(202.0f, 1.0f)));
+	Ray ray;
+	ray.p = V2(190.0f, 0.0f);
+	ray.d = V2(1.0f, 0.0f);
+	ray.t = 20.0f;
+	Array<Leaf> found;
+	aabb_tree_query(tree, s_collect_leaf, ray, &found);
+	REQUIRE(found.count() == 1 && found[0].id == target.id);
+
+	destroy_aabb_tree(tree);
+	destroy_threadpool(pool);
+	return true;
+}
+
+/* A flattened tree answers queries with the same leaves, and is dropped when the tree changes. */
+TEST_CASE(test_aabb_tree_flatten)
+{
+	CF_RndState rnd = cf_rnd_seed(17);
+	AabbTree tree = make_aabb_tree(0);
+	AabbTree flat = make_aabb_tree(0);
+	aabb_tree_flatten(flat);
+	REQUIRE(!aabb_tree_is_flattened(flat));
+	Array<Leaf> leaves;
+	for (int i = 0; i < 500; ++i) {
+		Aabb aabb = s_random_aabb(&rnd);
+		aabb_tree_insert(tree, aabb);
+		leaves.add(aabb_tree_insert(flat, aabb));
+	}
+	aabb_tree_flatten(flat);
+	REQUIRE(aabb_tree_is_flattened(flat));
+
+	for (int i = 0; i < 200; ++i) {
+		Array<Leaf> expected;
+		Array<Leaf> found;
+		if (i & 1) {
+			Ray ray;
+			ray.p = V2(cf_rnd_range_float(&rnd, -100.0f, 100.0f), cf_rnd_range_float(&rnd, -100.0f, 100.0f));
+			ray.d = safe_norm(V2(cf_rnd_range_float(&rnd, -1.0f, 1.0f), cf_rnd_range_float(&rnd, -1.0f, 1.0f)));
+			ray.t = 50.0f;
+			aabb_tree_query(tree, s_collect_leaf, ray, &expected);
+			aabb_tree_query(flat, s_collect_leaf, ray, &found);
+		} else {
+			Aabb aabb = s_random_aabb(&rnd);
+			aabb_tree_query(tree, s_collect_leaf, aabb, &expected);
+			aabb_tree_query(flat, s_collect_leaf, aabb, &found);
+		}
+		REQUIRE(found.count() == expected.count());
+		for (int j = 0; j < expected.count(); ++j) {
+			REQUIRE(s_has_leaf(found.data(), found.count(), expected[j]));
+		}
+	}
+
+	aabb_tree_remove(flat, leaves[0]);
+	REQUIRE(!aabb_tree_is_flattened(flat));
+
+	destroy_aabb_tree(flat);
+	destroy_aabb_tree(tree);
+	return true;
+}
+
+static bool s_tile_shape(Leaf leaf, void* leaf_udata, void* fn_udata, AabbTreeLeafShape* out)
+{
+	CF_UNUSED(leaf);
+	const Array<Aabb>* tiles = (const Array<Aabb>*)fn_udata;
+	out->shape = tiles->data() + ((int)(uintptr_t)leaf_udata - 1);
+	out->type = CF_SHAPE_TYPE_AABB;
+	return true;
+}
+
+static float s_brute_force_toi(const Array<Aabb>& tiles, const Capsule* capsule, v2 motion)
+{
+	float best = 1.0f;
+	for (int i = 0; i < tiles.count(); ++i) {
+		ToiResult toi = cf_toi(capsule, CF_SHAPE_TYPE_CAPSULE, NULL, motion, tiles.data() + i, CF_SHAPE_TYPE_AABB, NULL, V2(0, 0), true);
+		if (toi.hit && toi.toi < best) best = toi.toi;
+	}
+	return best;
+}
+
+/* Sweeps find the same first hit as testing every leaf, with or without a cache, and caches notice changes to the tree. */
+TEST_CASE(test_aabb_tree_sweep)
+{
+	CF_RndState rnd = cf_rnd_seed(23);
+	AabbTree tree = make_aabb_tree(0);
+	AabbTree flat = make_aabb_tree(0);
+	Array<Aabb> tiles;
+	for (int i = 0; i < 300; ++i) {
+		tiles.add(s_random_aabb(&rnd));
+		aabb_tree_insert(tree, tiles[i], (void*)(uintptr_t)(i + 1));
+		aabb_tree_insert(flat, tiles[i], (void*)(uintptr_t)(i + 1));
+	}
+	aabb_tree_flatten(flat);
+
+	AabbTreeSweepCache cache = make_aabb_tree_sweep_cache(20.0f);
+	v2 p = V2(0, 0);
+	int hits = 0;
+	for (int i = 0; i < 300; ++i) {
+		if (i % 50 == 0) p = V2(cf_rnd_range_float(&rnd, -100.0f, 100.0f), cf_rnd_range_float(&rnd, -100.0f, 100.0f));
+		Capsule capsule = make_capsule(p, p + V2(0, 3), 1.0f);
+		v2 motion = V2(cf_rnd_range_float(&rnd, -6.0f, 6.0f), cf_rnd_range_float(&rnd, -6.0f, 6.0f));
+		float expected = s_brute_force_toi(tiles, &capsule, motion);
+		AabbTreeSweepResult a = aabb_tree_sweep(tree, &capsule, CF_SHAPE_TYPE_CAPSULE, NULL, motion, s_tile_shape, &tiles);
+		AabbTreeSweepResult b = aabb_tree_sweep(flat, &capsule, CF_SHAPE_TYPE_CAPSULE, NULL, motion, s_tile_shape, &tiles);
+		AabbTreeSweepResult c = aabb_tree_sweep(tree, cache, &capsule, CF_SHAPE_TYPE_CAPSULE, NULL, motion, s_tile_shape, &tiles);
+		REQUIRE(a.hit == (expected < 1.0f));
+		REQUIRE(b.hit == a.hit && c.hit == a.hit);
+		if (a.hit) {
+			REQUIRE(a.toi == expected && b.toi == expected && c.toi == expected);
+			hits++;
+		}
+		p += motion * 0.25f;
+	}
+	REQUIRE(hits > 0);
+
+	// A new leaf in the cached area must be seen.
+	Capsule capsule = make_capsule(V2(300, 0), V2(300, 3), 1.0f);
+	REQUIRE(!aabb_tree_sweep(tree, cache, &capsule, CF_SHAPE_TYPE_CAPSULE, NULL, V2(10, 0), s_tile_shape, &tiles).hit);
+	tiles.add(make_aabb(V2(305, -5), V2(306, 5)));
+	aabb_tree_insert(tree, tiles.last(), (void*)(uintptr_t)tiles.count());
+	AabbTreeSweepResult hit = aabb_tree_sweep(tree, cache, &capsule, CF_SHAPE_TYPE_CAPSULE, NULL, V2(10, 0), s_tile_shape, &tiles);
+	REQUIRE(hit.hit);
+	REQUIRE(CF_FABSF(hit.toi - 0.4f) < 0.01f);
+
+	destroy_aabb_tree_sweep_cache(cache);
+	destroy_aabb_tree(flat);
+	destroy_aabb_tree(tree);
+	return true;
+}
+
+/* Bulk insert and bulk update keep every leaf findable, and keep leaf handles stable. */
+TEST_CASE(test_aabb_tree_bulk)
+{
+	CF_RndState rnd = cf_rnd_seed(23);
+	AabbTree tree = make_aabb_tree(0);
+	const int count = 1000;
+	Array<Aabb> aabbs;
+	Array<Leaf> leaves;
+	Array<void*> udatas;
+	for (int i = 0; i < count; ++i) {
+		aabbs.add(s_random_aabb(&rnd));
+		udatas.add((void*)(uintptr_t)(i + 1));
+	}
+	leaves.ensure_count(count);
+	aabb_tree_insert_many(tree, aabbs.data(), udatas.data(), count / 2, leaves.data());
+	aabb_tree_insert_many(tree, aabbs.data() + count / 2, udatas.data() + count / 2, count - count / 2, leaves.data() + count / 2);
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(aabb_tree_get_udata(tree, leaves[i]) == udatas[i]);
+		REQUIRE(contains(aabb_tree_get_aabb(tree, leaves[i]), aabbs[i]));
+	}
+
+	for (int frame = 0; frame < 4; ++frame) {
+		Array<v2> offsets;
+		for (int i = 0; i < count; ++i) {
+			v2 offset = V2(cf_rnd_range_float(&rnd, -3.0f, 3.0f), cf_rnd_range_float(&rnd, -3.0f, 3.0f));
+			aabbs[i].min += offset;
+			aabbs[i].max += offset;
+			offsets.add(offset);
+		}
+		REQUIRE(aabb_tree_update_leaves(tree, leaves.data(), aabbs.data(), offsets.data(), count, 16) > 0);
+		if (frame == 2) aabb_tree_rebuild(tree);
+	}
+
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(aabb_tree_get_udata(tree, leaves[i]) == udatas[i]);
+		REQUIRE(contains(aabb_tree_get_aabb(tree, leaves[i]), aabbs[i]));
+		Array<Leaf> found;
+		aabb_tree_query(tree, s_collect_leaf, aabbs[i], &found);
+		REQUIRE(s_has_leaf(found.data(), found.count(), leaves[i]));
+	}
+
+	destroy_aabb_tree(tree);
+	return true;
+}
+
+static bool s_count_leaf(Leaf leaf, Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	++*(int*)fn_udata;
+	return true;
+}
+
+/* Serialized trees load in place and answer queries like the original tree. */
+TEST_CASE(test_aabb_tree_serialize)
+{
+	CF_RndState rnd = cf_rnd_seed(29);
+	AabbTree tree = make_aabb_tree(0);
+	for (int i = 0; i < 500; ++i) aabb_tree_insert(tree, s_random_aabb(&rnd));
+
+	size_t size = aabb_tree_serialized_size(tree);
+	void* buffer = cf_alloc(size);
+	REQUIRE(!aabb_tree_serialize(tree, buffer, size - 1));
+	REQUIRE(aabb_tree_serialize(tree, buffer, size));
+	AabbTree view = make_aabb_tree_view(buffer, size);
+	AabbTree loaded = make_aabb_tree_from_memory(buffer, size);
+	REQUIRE(view.id && loaded.id);
+	REQUIRE(!make_aabb_tree_view(buffer, size - 1).id);
+	REQUIRE(aabb_tree_is_flattened(view));
+	REQUIRE(aabb_tree_serialized_size(view) == size);
+
+	for (int i = 0; i < 100; ++i) {
+		Aabb aabb = s_random_aabb(&rnd);
+		int expected = 0, from_view = 0, from_loaded = 0;
+		aabb_tree_query(tree, s_count_leaf, aabb, &expected);
+		aabb_tree_query(view, s_count_leaf, aabb, &from_view);
+		aabb_tree_query(loaded, s_count_leaf, aabb, &from_loaded);
+		REQUIRE(from_view == expected);
+		REQUIRE(from_loaded == expected);
+	}
+
+	destroy_aabb_tree(view);
+	cf_free(buffer);
+	destroy_aabb_tree(loaded);
+	destroy_aabb_tree(tree);
+	return true;
+}
+
 TEST_SUITE(test_aabb_tree)
 {
 	RUN_TEST_CASE(test_aabb_tree_make_and_destroy);
+	RUN_TEST_CASE(test_aabb_tree_find_pairs);
+	RUN_TEST_CASE(test_aabb_tree_query_batch);
+	RUN_TEST_CASE(test_aabb_tree_flatten);
+	RUN_TEST_CASE(test_aabb_tree_sweep);
+	RUN_TEST_CASE(test_aabb_tree_bulk);
+	RUN_TEST_CASE(test_aabb_tree_serialize);
 }
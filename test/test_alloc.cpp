@@ -0,0 +1,260 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_alloc.h>
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+#include <cute_multithreading.h>
+using namespace Cute;
+
+/* Frame allocations stay valid through the next frame, and their memory is reused after that. */
+TEST_CASE(test_frame_alloc)
+{
+	char* a = cf_frame_fmt("%s %d", "frame", 1);
+	REQUIRE(!CF_STRCMP(a, "frame 1"));
+	REQUIRE(!((uintptr_t)cf_frame_alloc(3) & 15));
+	void* big = cf_frame_alloc(1024 * 1024);
+	CF_MEMSET(big, 0xFF, 1024 * 1024);
+
+	cf_frame_arena_advance();
+	int* b = (int*)cf_frame_calloc(sizeof(int), 100);
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(b[i] == 0);
+	}
+	REQUIRE(!CF_STRCMP(a, "frame 1"));
+
+	// Two frames later the first frame's memory is handed out again.
+	cf_frame_arena_advance();
+	char* c = (char*)cf_frame_alloc(8);
+	REQUIRE(c == a);
+
+	// Fill up more than one block.
+	for (int i = 0; i < 1000; ++i) {
+		char* s = cf_frame_fmt("%d", i);
+		REQUIRE(s != (char*)b);
+		CF_MEMSET(cf_frame_alloc(1000), 0, 1000);
+	}
+	cf_frame_arena_advance();
+	cf_frame_arena_advance();
+
+	return true;
+}
+
+/* Rewinding an arena to a marker frees everything allocated since, and reuses the same blocks. */
+TEST_CASE(test_arena_markers)
+{
+	CF_Arena arena;
+	cf_arena_init(&arena, 8, 256);
+	void* a = cf_arena_alloc(&arena, 100);
+	REQUIRE(!((uintptr_t)a & 7));
+
+	CF_ArenaMarker marker = cf_arena_mark(&arena);
+	void* b = cf_arena_alloc(&arena, 100);
+	void* c = cf_arena_alloc_aligned(&arena, 100, 64);
+	REQUIRE(!((uintptr_t)c & 63));
+	// Bigger than a block, so it gets a block of its own.
+	char* big = (char*)cf_arena_alloc(&arena, 1000);
+	CF_MEMSET(big, 0xFF, 1000);
+	int block_count = acount(arena.blocks);
+	REQUIRE(block_count >= 2);
+
+	cf_arena_rewind(&arena, marker);
+	REQUIRE(cf_arena_alloc(&arena, 100) == b);
+	cf_arena_alloc_aligned(&arena, 100, 64);
+	REQUIRE(cf_arena_alloc(&arena, 1000) == big);
+	REQUIRE(acount(arena.blocks) == block_count);
+
+	// A zero marker rewinds everything.
+	CF_ArenaMarker start = { };
+	cf_arena_rewind(&arena, start);
+	REQUIRE(cf_arena_alloc(&arena, 100) == a);
+	cf_arena_reset(&arena);
+	REQUIRE(!arena.blocks);
+
+	return true;
+}
+
+/* Virtual arenas grow within one reserved range, and resetting keeps the memory to hand out again. */
+TEST_CASE(test_arena_virtual)
+{
+	CF_Arena arena;
+	size_t reserve_size = 16 * 1024 * 1024;
+	bool reserved = cf_arena_init_virtual(&arena, 16, reserve_size, false);
+	char* a = (char*)cf_arena_alloc(&arena, 100);
+	REQUIRE(a && !((uintptr_t)a & 15));
+
+	// Spans many commits, and stays contiguous.
+	char* big = (char*)cf_arena_alloc(&arena, 1024 * 1024);
+	CF_MEMSET(big, 0xFF, 1024 * 1024);
+	if (reserved) {
+		REQUIRE(big == a + 112);
+		REQUIRE(!cf_arena_alloc(&arena, reserve_size));
+	}
+
+	CF_ArenaMarker marker = cf_arena_mark(&arena);
+	char* b = (char*)cf_arena_alloc(&arena, 100);
+	cf_arena_rewind(&arena, marker);
+	REQUIRE(cf_arena_alloc(&arena, 100) == b);
+
+	cf_arena_reset(&arena);
+	if (reserved) REQUIRE(cf_arena_alloc(&arena, 100) == a);
+	cf_arena_destroy(&arena);
+	REQUIRE(!arena.base);
+
+	// Huge pages quietly fall back to regular ones when the system has none to give.
+	cf_arena_init_virtual(&arena, 16, reserve_size, true);
+	char* c = (char*)cf_arena_alloc(&arena, 3 * 1024 * 1024);
+	REQUIRE(c);
+	CF_MEMSET(c, 0xFF, 3 * 1024 * 1024);
+	cf_arena_destroy(&arena);
+
+	return true;
+}
+
+static CF_Allocator s_pool_allocator;
+static CF_AtomicInt s_pool_failures;
+
+static void s_pool_task(void* param)
+{
+	CF_Allocator a = s_pool_allocator;
+	void** freed_here = (void**)param;
+	char* ptrs[256];
+	for (int iter = 0; iter < 50; ++iter) {
+		for (int i = 0; i < 256; ++i) {
+			size_t size = (size_t)(i * 37 % 3000) + 1;
+			ptrs[i] = (char*)a.alloc_fn(size, NULL);
+			if ((uintptr_t)ptrs[i] & 15) cf_atomic_add(&s_pool_failures, 1);
+			CF_MEMSET(ptrs[i], i, size < 16 ? size : 16);
+		}
+		for (int i = 0; i < 256; ++i) {
+			ptrs[i] = (char*)a.realloc_fn(ptrs[i], (size_t)(i * 53 % 3000) + 16, NULL);
+			for (int j = 0; j < 16 && j < i * 37 % 3000 + 1; ++j) {
+				if (ptrs[i][j] != (char)i) cf_atomic_add(&s_pool_failures, 1);
+			}
+			a.free_fn(ptrs[i], NULL);
+		}
+	}
+	// Free memory allocated on another thread.
+	for (int i = 0; i < 64; ++i) {
+		a.free_fn(freed_here[i], NULL);
+	}
+}
+
+/* The pool allocator hands out aligned blocks from many threads at once, and handles frees from other threads. */
+TEST_CASE(test_pool_allocator)
+{
+	s_pool_allocator = cf_pool_allocator();
+	s_pool_failures = cf_atomic_zero();
+	CF_Allocator a = s_pool_allocator;
+	int large_count = cf_pool_allocator_stats().large_allocation_count;
+
+	int* zeroed = (int*)a.calloc_fn(sizeof(int), 100, NULL);
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(zeroed[i] == 0);
+	}
+	// Small reallocs that still fit stay in place.
+	REQUIRE(a.realloc_fn(zeroed, sizeof(int) * 90, NULL) == zeroed);
+	a.free_fn(zeroed, NULL);
+
+	void* cross_thread[4][64];
+	for (int i = 0; i < 4; ++i) {
+		for (int j = 0; j < 64; ++j) {
+			cross_thread[i][j] = a.alloc_fn((size_t)j * 64, NULL);
+		}
+	}
+	CF_Threadpool* pool = cf_make_threadpool(3);
+	for (int i = 0; i < 4; ++i) {
+		cf_threadpool_add_task(pool, s_pool_task, cross_thread[i]);
+	}
+	cf_threadpool_kick_and_wait(pool);
+	cf_destroy_threadpool(pool);
+	REQUIRE(cf_atomic_get(&s_pool_failures) == 0);
+
+	CF_PoolAllocatorStats stats = cf_pool_allocator_stats();
+	REQUIRE(stats.large_allocation_count == large_count);
+	REQUIRE(stats.bytes_reserved > 0);
+	REQUIRE(stats.refill_count > 0);
+
+	return true;
+}
+
+static const CF_AllocTagStats* s_find_tag(const CF_AllocTagStats* stats, int count, const char* tag)
+{
+	for (int i = 0; i < count; ++i) {
+		if (!CF_STRCMP(stats[i].tag, tag)) return stats + i;
+	}
+	return NULL;
+}
+
+/* Tracking counts live memory and per-frame allocations under each tag. */
+TEST_CASE(test_alloc_tracking)
+{
+	void* untracked = cf_alloc(16);
+	cf_alloc_tracking_enable(true);
+	REQUIRE(cf_alloc_tracking_is_enabled());
+
+	void* a;
+	void* b;
+	{
+		CF_ALLOC_TAG_SCOPE("test");
+		a = cf_alloc(100);
+		b = cf_calloc(10, 10);
+		cf_alloc_push_tag("inner");
+		void* c = cf_alloc(7);
+		cf_alloc_pop_tag();
+		cf_free(c);
+		a = cf_realloc(a, 300);
+	}
+	cf_free(untracked);
+
+	CF_AllocTagStats stats[16];
+	int count = cf_alloc_tracking_get_stats(stats, 16);
+	REQUIRE(count >= 3);
+	const CF_AllocTagStats* test = s_find_tag(stats, count, "test");
+	REQUIRE(test);
+	REQUIRE(test->live_count == 2);
+	REQUIRE(test->live_bytes == 400);
+	REQUIRE(test->peak_bytes == 400);
+	const CF_AllocTagStats* inner = s_find_tag(stats, count, "inner");
+	REQUIRE(inner);
+	REQUIRE(inner->live_count == 0);
+	REQUIRE(inner->peak_bytes == 7);
+
+	// Per-frame counters cover the last whole frame.
+	REQUIRE(test->frame_alloc_count == 0);
+	cf_frame_arena_advance();
+	cf_alloc_tracking_get_stats(stats, 16);
+	test = s_find_tag(stats, count, "test");
+	REQUIRE(test->frame_alloc_count == 3);
+	REQUIRE(test->frame_alloc_bytes == 500);
+	cf_frame_arena_advance();
+	cf_alloc_tracking_get_stats(stats, 16);
+	REQUIRE(s_find_tag(stats, count, "test")->frame_alloc_count == 0);
+
+	cf_free(a);
+	cf_free(b);
+	cf_alloc_tracking_get_stats(stats, 16);
+	test = s_find_tag(stats, count, "test");
+	REQUIRE(test->live_count == 0);
+	REQUIRE(test->live_bytes == 0);
+
+	cf_alloc_tracking_enable(false);
+	REQUIRE(!cf_alloc_tracking_is_enabled());
+
+	return true;
+}
+
+TEST_SUITE(test_alloc)
+{
+	RUN_TEST_CASE(test_frame_alloc);
+	RUN_TEST_CASE(test_arena_markers);
+	RUN_TEST_CASE(test_arena_virtual);
+	RUN_TEST_CASE(test_pool_allocator);
+	RUN_TEST_CASE(test_alloc_tracking);
+}
@@ -56,7 +56,103 @@ TEST_CASE(test_array_list_init)
 	return true;
 }
 
+TEST_CASE(test_small_array)
+{
+	SmallArray<String, 4> a;
+	REQUIRE(a.is_inline());
+	REQUIRE(a.capacity() == 4);
+	for (int i = 0; i < 4; ++i) {
+		a.add(String(i));
+	}
+	REQUIRE(a.is_inline());
+
+	// Spill to the heap, keeping every element.
+	a.add(a[0]);
+	REQUIRE(!a.is_inline());
+	REQUIRE(a.count() == 5);
+	for (int i = 0; i < 4; ++i) {
+		REQUIRE(a[i].to_int() == i);
+	}
+	REQUIRE(a.last().to_int() == 0);
+
+	// Moving a heap array steals its storage, moving an inline one moves each element.
+	SmallArray<String, 4> b = cf_move(a);
+	REQUIRE(a.count() == 0);
+	REQUIRE(a.is_inline());
+	REQUIRE(b.count() == 5);
+	REQUIRE(!b.is_inline());
+
+	SmallArray<String, 4> c = { "x", "y" };
+	SmallArray<String, 4> d = cf_move(c);
+	REQUIRE(c.count() == 0);
+	REQUIRE(d.is_inline());
+	REQUIRE(d[1] == "y");
+
+	d = b;
+	REQUIRE(d.count() == 5);
+	REQUIRE(b.count() == 5);
+	REQUIRE(d[3].to_int() == 3);
+
+	d.unordered_remove(0);
+	REQUIRE(d.count() == 4);
+	REQUIRE(d[0].to_int() == 0);
+	REQUIRE(d.pop().to_int() == 3);
+	d.set_count(1);
+	REQUIRE(d.count() == 1);
+	d.clear();
+	REQUIRE(d.empty());
+
+	return true;
+}
+
+TEST_CASE(test_typeless_array_bulk)
+{
+	typeless_array a(sizeof(int));
+	a.reserve(10, 64);
+	REQUIRE(((uintptr_t)a.data() & 63) == 0);
+
+	int ints[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	a.add_n(10, ints);
+	REQUIRE(a.count() == 10);
+	REQUIRE(*(int*)a[9] == 9);
+
+	// Growing past the reserved capacity keeps the alignment.
+	int* more = (int*)a.add_n(1000);
+	for (int i = 0; i < 1000; ++i) more[i] = 10 + i;
+	REQUIRE(((uintptr_t)a.data() & 63) == 0);
+	REQUIRE(*(int*)a[500] == 500);
+
+	a.remove_n(10, 1000);
+	REQUIRE(a.count() == 10);
+	a.remove_n(2, 3);
+	REQUIRE(a.count() == 7);
+	REQUIRE(*(int*)a[1] == 1);
+	REQUIRE(*(int*)a[2] == 5);
+	REQUIRE(*(int*)a[6] == 9);
+
+	// 0 1 5 6 7 8 9 -> 0 7 8 9
+	a.swap_remove_n(1, 3);
+	REQUIRE(a.count() == 4);
+	REQUIRE(*(int*)a[1] == 7);
+	REQUIRE(*(int*)a[3] == 9);
+
+	// 0 7 8 9 -> 0 9 8
+	a.swap_remove_n(1, 1);
+	REQUIRE(a.count() == 3);
+	REQUIRE(*(int*)a[1] == 9);
+
+	// Removing from the end moves nothing.
+	a.swap_remove_n(1, 2);
+	REQUIRE(a.count() == 1);
+	REQUIRE(*(int*)a.pop() == 0);
+	REQUIRE(a.count() == 0);
+
+	return true;
+}
+
 TEST_SUITE(test_array)
 {
 	RUN_TEST_CASE(test_array_list_init);
+	RUN_TEST_CASE(test_small_array);
+	RUN_TEST_CASE(test_typeless_array_bulk);
 }
\ No newline at end of file
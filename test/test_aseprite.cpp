@@ -27,7 +27,32 @@ TEST_CASE(test_aseprite_make_destroy)
 	return true;
 }
 
+// Hands out single-index ranges back to front, to stand in for threads finishing in any order.
+static void s_reversed_for(int count, cute_aseprite_range_fn* fn, void* udata, void* parallel_udata)
+{
+	int* calls = (int*)parallel_udata;
+	++*calls;
+	for (int i = count - 1; i >= 0; --i) fn(i, i + 1, udata);
+}
+
+/* Loading through a parallel-for gives the same frames as loading serially. */
+TEST_CASE(test_aseprite_parallel_load)
+{
+	int calls = 0;
+	ase_t* a = cute_aseprite_load_from_memory(girl_data, girl_sz, NULL);
+	ase_t* b = cute_aseprite_load_from_memory_ex(girl_data, girl_sz, NULL, s_reversed_for, &calls);
+	REQUIRE(calls > 0);
+	REQUIRE(a->frame_count == b->frame_count);
+	for (int i = 0; i < a->frame_count; ++i) {
+		REQUIRE(CF_MEMCMP(a->frames[i].pixels, b->frames[i].pixels, sizeof(ase_color_t) * a->w * a->h) == 0);
+	}
+	cute_aseprite_free(a);
+	cute_aseprite_free(b);
+	return true;
+}
+
 TEST_SUITE(test_aseprite)
 {
 	RUN_TEST_CASE(test_aseprite_make_destroy);
+	RUN_TEST_CASE(test_aseprite_parallel_load);
 }
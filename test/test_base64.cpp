@@ -69,7 +69,72 @@ TEST_CASE(test_base64_encode)
 	return true;
 }
 
+/* Large buffers take the vectorized paths, and streaming in odd sized chunks matches encoding all at once. */
+TEST_CASE(test_base64_streaming)
+{
+	const int size = 1000;
+	uint8_t raw[size];
+	for (int i = 0; i < size; ++i) raw[i] = (uint8_t)(i * 7 + (i >> 3));
+	char encoded[CF_BASE64_ENCODED_SIZE(size)];
+	uint8_t decoded[size];
+
+	for (int n = 0; n <= size; n += n < 100 ? 1 : 97) {
+		size_t encoded_size = CF_BASE64_ENCODED_SIZE(n);
+		REQUIRE(!cf_is_error(cf_base64_encode(encoded, sizeof(encoded), raw, n)));
+		REQUIRE(!cf_is_error(cf_base64_decode(decoded, n, encoded, encoded_size)));
+		REQUIRE(!CF_MEMCMP(decoded, raw, n));
+
+		// Chunks of every size from one byte up.
+		for (int chunk = 1; chunk < 70; chunk += 13) {
+			char streamed[CF_BASE64_ENCODED_SIZE(size)];
+			size_t streamed_size = 0;
+			CF_Base64Encoder e = cf_make_base64_encoder();
+			for (int i = 0; i < n; i += chunk) {
+				int count = n - i < chunk ? n - i : chunk;
+				streamed_size += cf_base64_encoder_update(&e, streamed + streamed_size, raw + i, count);
+			}
+			streamed_size += cf_base64_encoder_finish(&e, streamed + streamed_size);
+			REQUIRE(streamed_size == encoded_size);
+			REQUIRE(!CF_MEMCMP(streamed, encoded, encoded_size));
+
+			uint8_t chunk_out[CF_BASE64_DECODED_SIZE(70)];
+			size_t decoded_size = 0;
+			CF_Base64Decoder d = cf_make_base64_decoder();
+			for (size_t i = 0; i < encoded_size; i += chunk) {
+				size_t count = encoded_size - i < (size_t)chunk ? encoded_size - i : (size_t)chunk;
+				size_t out_size;
+				REQUIRE(!cf_is_error(cf_base64_decoder_update(&d, chunk_out, encoded + i, count, &out_size)));
+				REQUIRE(!CF_MEMCMP(chunk_out, raw + decoded_size, out_size));
+				decoded_size += out_size;
+			}
+			REQUIRE(!cf_is_error(cf_base64_decoder_finish(&d)));
+			REQUIRE(decoded_size == (size_t)n);
+		}
+	}
+
+	// A bad character deep within a long stream is still caught.
+	REQUIRE(!cf_is_error(cf_base64_encode(encoded, sizeof(encoded), raw, size)));
+	encoded[500] = '~';
+	REQUIRE(cf_is_error(cf_base64_decode(decoded, size, encoded, sizeof(encoded))));
+	REQUIRE(!cf_is_error(cf_base64_encode(encoded, sizeof(encoded), raw, size)));
+	REQUIRE(cf_is_error(cf_base64_decode(decoded, size - 1, encoded, sizeof(encoded))));
+
+	// Nothing may follow the padding, and the stream must end on a whole group.
+	uint8_t out[16];
+	size_t out_size;
+	CF_Base64Decoder d = cf_make_base64_decoder();
+	REQUIRE(!cf_is_error(cf_base64_decoder_update(&d, out, "Zg==", 4, &out_size)));
+	REQUIRE(cf_is_error(cf_base64_decoder_update(&d, out, "Zg==", 4, &out_size)));
+	d = cf_make_base64_decoder();
+	REQUIRE(!cf_is_error(cf_base64_decoder_update(&d, out, "Zm9vY", 5, &out_size)));
+	REQUIRE(out_size == 3);
+	REQUIRE(cf_is_error(cf_base64_decoder_finish(&d)));
+
+	return true;
+}
+
 TEST_SUITE(test_base64)
 {
 	RUN_TEST_CASE(test_base64_encode);
+	RUN_TEST_CASE(test_base64_streaming);
 }
@@ -0,0 +1,124 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_bitstream.h>
+#include <cute_c_runtime.h>
+using namespace Cute;
+
+/* Every kind of value reads back as written, packed into as few bits as promised. */
+TEST_CASE(test_bitstream_round_trip)
+{
+	uint8_t buffer[256];
+	CF_BitWriter w = cf_make_bit_writer(buffer, sizeof(buffer));
+	cf_bit_write_bool(&w, true);
+	cf_bit_write_int(&w, 77, 0, 100);
+	cf_bit_write_int(&w, -3, -10, 10);
+	REQUIRE(cf_bit_writer_bits_written(&w) == 1 + 7 + 5);
+	cf_bit_write(&w, 0xDEADBEEF, 32);
+	cf_bit_write_varint(&w, 5);
+	cf_bit_write_varint(&w, 300000);
+	cf_bit_write_varint_signed(&w, -2);
+	cf_bit_write_varint_signed(&w, INT64_MIN);
+	cf_bit_write_float(&w, 3.14159f);
+	cf_bit_write_quantized(&w, 123.456f, -1000.0f, 1000.0f, 0.01f);
+	cf_bit_write_quantized(&w, 5000.0f, -1000.0f, 1000.0f, 0.01f);
+	cf_bit_write_bytes(&w, "hello", 5);
+	cf_bit_write_bool(&w, false);
+	int size = cf_bit_writer_flush(&w);
+	REQUIRE(!cf_bit_writer_overflowed(&w));
+	REQUIRE(size == (cf_bit_writer_bits_written(&w) + 7) / 8);
+
+	CF_BitReader r = cf_make_bit_reader(buffer, size);
+	REQUIRE(cf_bit_read_bool(&r) == true);
+	REQUIRE(cf_bit_read_int(&r, 0, 100) == 77);
+	REQUIRE(cf_bit_read_int(&r, -10, 10) == -3);
+	REQUIRE(cf_bit_read(&r, 32) == 0xDEADBEEF);
+	REQUIRE(cf_bit_read_varint(&r) == 5);
+	REQUIRE(cf_bit_read_varint(&r) == 300000);
+	REQUIRE(cf_bit_read_varint_signed(&r) == -2);
+	REQUIRE(cf_bit_read_varint_signed(&r) == INT64_MIN);
+	REQUIRE(cf_bit_read_float(&r) == 3.14159f);
+	float f = cf_bit_read_quantized(&r, -1000.0f, 1000.0f, 0.01f);
+	REQUIRE(f > 123.45f && f < 123.465f);
+	REQUIRE(cf_bit_read_quantized(&r, -1000.0f, 1000.0f, 0.01f) == 1000.0f);
+	char hello[5];
+	cf_bit_read_bytes(&r, hello, 5);
+	REQUIRE(!CF_MEMCMP(hello, "hello", 5));
+	REQUIRE(cf_bit_read_bool(&r) == false);
+	REQUIRE(!cf_bit_reader_failed(&r));
+	REQUIRE(cf_bit_reader_bits_remaining(&r) < 8);
+
+	return true;
+}
+
+/* Unchanged values cost a single bit against their baseline. */
+TEST_CASE(test_bitstream_delta)
+{
+	uint8_t buffer[64];
+	CF_BitWriter w = cf_make_bit_writer(buffer, sizeof(buffer));
+	cf_bit_write_delta(&w, 1000, 1000);
+	cf_bit_write_delta_quantized(&w, 10.5f, 10.5f, -100.0f, 100.0f, 0.1f);
+	REQUIRE(cf_bit_writer_bits_written(&w) == 2);
+	cf_bit_write_delta(&w, 1003, 1000);
+	cf_bit_write_delta(&w, INT32_MIN, INT32_MAX);
+	cf_bit_write_delta_quantized(&w, 10.0f, 10.5f, -100.0f, 100.0f, 0.1f);
+	int size = cf_bit_writer_flush(&w);
+
+	CF_BitReader r = cf_make_bit_reader(buffer, size);
+	REQUIRE(cf_bit_read_delta(&r, 1000) == 1000);
+	float f = cf_bit_read_delta_quantized(&r, 10.5f, -100.0f, 100.0f, 0.1f);
+	REQUIRE(f > 10.45f && f < 10.55f);
+	REQUIRE(cf_bit_read_delta(&r, 1000) == 1003);
+	REQUIRE(cf_bit_read_delta(&r, INT32_MAX) == INT32_MIN);
+	f = cf_bit_read_delta_quantized(&r, 10.5f, -100.0f, 100.0f, 0.1f);
+	REQUIRE(f > 9.95f && f < 10.05f);
+	REQUIRE(!cf_bit_reader_failed(&r));
+
+	return true;
+}
+
+/* Writing past the end overflows, and reading past the end or out of range fails, without touching memory out of bounds. */
+TEST_CASE(test_bitstream_bounds)
+{
+	uint8_t buffer[4];
+	CF_BitWriter w = cf_make_bit_writer(buffer, sizeof(buffer));
+	cf_bit_write(&w, 0x12345678, 32);
+	REQUIRE(!cf_bit_writer_overflowed(&w));
+	cf_bit_write_bool(&w, true);
+	cf_bit_writer_flush(&w);
+	REQUIRE(cf_bit_writer_overflowed(&w));
+
+	CF_BitReader r = cf_make_bit_reader(buffer, sizeof(buffer));
+	REQUIRE(cf_bit_read(&r, 24) == 0x345678);
+	REQUIRE(cf_bit_read(&r, 16) == 0);
+	REQUIRE(cf_bit_reader_failed(&r));
+	REQUIRE(cf_bit_read(&r, 1) == 0);
+
+	// 120 is outside of [0, 100], but fits within the same seven bits.
+	w = cf_make_bit_writer(buffer, sizeof(buffer));
+	cf_bit_write(&w, 120, 7);
+	cf_bit_writer_flush(&w);
+	r = cf_make_bit_reader(buffer, sizeof(buffer));
+	REQUIRE(cf_bit_read_int(&r, 0, 100) == 0);
+	REQUIRE(cf_bit_reader_failed(&r));
+
+	char bytes[8];
+	r = cf_make_bit_reader(buffer, sizeof(buffer));
+	cf_bit_read_bytes(&r, bytes, sizeof(bytes));
+	REQUIRE(cf_bit_reader_failed(&r));
+
+	return true;
+}
+
+TEST_SUITE(test_bitstream)
+{
+	RUN_TEST_CASE(test_bitstream_round_trip);
+	RUN_TEST_CASE(test_bitstream_delta);
+	RUN_TEST_CASE(test_bitstream_bounds);
+}
@@ -0,0 +1,150 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute.h>
+using namespace Cute;
+
+static v2 s_random_v2(CF_RndState* rnd, float extent)
+{
+	return V2(cf_rnd_range_float(rnd, -extent, extent), cf_rnd_range_float(rnd, -extent, extent));
+}
+
+static bool s_same_manifold(Manifold a, Manifold b)
+{
+	if (a.count != b.count) return false;
+	if (!a.count) return true;
+	if (a.n.x != b.n.x || a.n.y != b.n.y) return false;
+	for (int i = 0; i < a.count; ++i) {
+		if (a.depths[i] != b.depths[i]) return false;
+		if (a.contact_points[i].x != b.contact_points[i].x || a.contact_points[i].y != b.contact_points[i].y) return false;
+	}
+	return true;
+}
+
+/* Batched manifolds match the one-pair-at-a-time functions exactly. */
+TEST_CASE(test_collision_manifold_batch)
+{
+	CF_RndState rnd = cf_rnd_seed(7);
+	const int count = 1003;
+	Array<Circle> circles_a, circles_b;
+	Array<Aabb> aabbs_a, aabbs_b;
+	Array<Capsule> capsules_a, capsules_b;
+	Array<Manifold> out;
+	out.ensure_count(count);
+	for (int i = 0; i < count; ++i) {
+		Circle c0 = { s_random_v2(&rnd, 10.0f), cf_rnd_range_float(&rnd, 0.1f, 2.0f) };
+		Circle c1 = { s_random_v2(&rnd, 10.0f), cf_rnd_range_float(&rnd, 0.1f, 2.0f) };
+		circles_a.add(c0);
+		circles_b.add(c1);
+		v2 p0 = s_random_v2(&rnd, 10.0f), p1 = s_random_v2(&rnd, 10.0f);
+		aabbs_a.add(make_aabb(p0, p0 + V2(1.5f, 2.0f)));
+		aabbs_b.add(make_aabb(p1, p1 + V2(2.0f, 1.0f)));
+		Capsule k0 = { p0, p0 + s_random_v2(&rnd, 2.0f), 0.5f };
+		Capsule k1 = { p1, p1 + s_random_v2(&rnd, 2.0f), 0.25f };
+		capsules_a.add(k0);
+		capsules_b.add(k1);
+	}
+
+	// Exactly touching AABBs must agree too.
+	aabbs_a[0] = make_aabb(V2(0, 0), V2(1, 1));
+	aabbs_b[0] = make_aabb(V2(1, 0), V2(2, 1));
+
+	circle_to_circle_manifold_batch(circles_a.data(), circles_b.data(), count, out.data());
+	for (int i = 0; i < count; ++i) REQUIRE(s_same_manifold(out[i], circle_to_circle_manifold(circles_a[i], circles_b[i])));
+	circle_to_aabb_manifold_batch(circles_a.data(), aabbs_b.data(), count, out.data());
+	for (int i = 0; i < count; ++i) REQUIRE(s_same_manifold(out[i], circle_to_aabb_manifold(circles_a[i], aabbs_b[i])));
+	circle_to_capsule_manifold_batch(circles_a.data(), capsules_b.data(), count, out.data());
+	for (int i = 0; i < count; ++i) REQUIRE(s_same_manifold(out[i], circle_to_capsule_manifold(circles_a[i], capsules_b[i])));
+	aabb_to_aabb_manifold_batch(aabbs_a.data(), aabbs_b.data(), count, out.data());
+	for (int i = 0; i < count; ++i) REQUIRE(s_same_manifold(out[i], aabb_to_aabb_manifold(aabbs_a[i], aabbs_b[i])));
+	REQUIRE(out[0].count == 1);
+	aabb_to_capsule_manifold_batch(aabbs_a.data(), capsules_b.data(), count, out.data());
+	for (int i = 0; i < count; ++i) REQUIRE(s_same_manifold(out[i], aabb_to_capsule_manifold(aabbs_a[i], capsules_b[i])));
+	capsule_to_capsule_manifold_batch(capsules_a.data(), capsules_b.data(), count, out.data());
+	for (int i = 0; i < count; ++i) REQUIRE(s_same_manifold(out[i], capsule_to_capsule_manifold(capsules_a[i], capsules_b[i])));
+
+	// Mixed shape types go through the generic batch.
+	const void* shapes_a[3] = { &circles_a[0], &capsules_a[0], &aabbs_a[0] };
+	const void* shapes_b[3] = { &aabbs_b[0], &circles_b[0], &capsules_b[0] };
+	ShapeType types_a[3] = { CF_SHAPE_TYPE_CIRCLE, CF_SHAPE_TYPE_CAPSULE, CF_SHAPE_TYPE_AABB };
+	ShapeType types_b[3] = { CF_SHAPE_TYPE_AABB, CF_SHAPE_TYPE_CIRCLE, CF_SHAPE_TYPE_CAPSULE };
+	collide_batch(shapes_a, NULL, types_a, shapes_b, NULL, types_b, 3, out.data());
+	for (int i = 0; i < 3; ++i) {
+		Manifold m;
+		collide(shapes_a[i], NULL, types_a[i], shapes_b[i], NULL, types_b[i], &m);
+		REQUIRE(s_same_manifold(out[i], m));
+	}
+
+	return true;
+}
+
+static Poly s_make_round_poly(v2 center, float radius)
+{
+	Poly poly;
+	poly.count = 8;
+	for (int i = 0; i < poly.count; ++i) {
+		float angle = i * (CF_PI * 2.0f / poly.count);
+		poly.verts[i] = center + V2(cosf(angle), sinf(angle)) * radius;
+	}
+	make_poly(&poly);
+	return poly;
+}
+
+/* Warm-started GJK gives the same distances in fewer iterations, and sweeps match `toi`. */
+TEST_CASE(test_collision_contact_cache)
+{
+	ContactCache cache = make_contact_cache();
+	Poly a = s_make_round_poly(V2(0, 0), 1.0f);
+	Poly b = s_make_round_poly(V2(0, 0), 1.0f);
+	int cold_iterations = 0, warm_iterations = 0;
+	for (int frame = 0; frame < 60; ++frame) {
+		Transform bx = make_transform(V2(2.5f + frame * 0.01f, 0.5f), frame * 0.01f);
+		int cold = 0, warm = 0;
+		float d0 = gjk(&a, CF_SHAPE_TYPE_POLY, NULL, &b, CF_SHAPE_TYPE_POLY, &bx, NULL, NULL, true, &cold, NULL);
+		float d1 = contact_cache_gjk(cache, 1, 2, &a, CF_SHAPE_TYPE_POLY, NULL, &b, CF_SHAPE_TYPE_POLY, &bx, NULL, NULL, true, &warm);
+		REQUIRE(CF_FABSF(d0 - d1) < 1.0e-4f);
+		cold_iterations += cold;
+		warm_iterations += warm;
+		contact_cache_next_frame(cache);
+	}
+	REQUIRE(warm_iterations < cold_iterations);
+	REQUIRE(contact_cache_count(cache) == 1);
+
+	Circle bullet = { V2(-5.0f, 0), 0.25f };
+	Circle far_bullet = { V2(-5.0f, 10.0f), 0.25f };
+	SweepPair pairs[2] = { };
+	pairs[0].id_a = 3; pairs[0].A = &bullet; pairs[0].typeA = CF_SHAPE_TYPE_CIRCLE; pairs[0].vA = V2(10.0f, 0);
+	pairs[0].id_b = 1; pairs[0].B = &a; pairs[0].typeB = CF_SHAPE_TYPE_POLY;
+	pairs[1] = pairs[0];
+	pairs[1].id_a = 4; pairs[1].A = &far_bullet;
+	ToiResult results[2];
+	contact_cache_toi_batch(cache, pairs, 2, true, results);
+	ToiResult expected = toi(&bullet, CF_SHAPE_TYPE_CIRCLE, NULL, V2(10.0f, 0), &a, CF_SHAPE_TYPE_POLY, NULL, V2(0, 0), true, NULL);
+	REQUIRE(results[0].hit == expected.hit);
+	REQUIRE(results[0].toi == expected.toi);
+	REQUIRE(results[0].hit);
+	REQUIRE(!results[1].hit);
+	REQUIRE(contact_cache_count(cache) == 3);
+
+	// Pairs no longer tested are forgotten.
+	contact_cache_next_frame(cache);
+	contact_cache_remove(cache, 3, 1);
+	REQUIRE(contact_cache_count(cache) == 1);
+	contact_cache_next_frame(cache);
+	REQUIRE(contact_cache_count(cache) == 0);
+
+	destroy_contact_cache(cache);
+	return true;
+}
+
+TEST_SUITE(test_collision)
+{
+	RUN_TEST_CASE(test_collision_manifold_batch);
+	RUN_TEST_CASE(test_collision_contact_cache);
+}
@@ -62,7 +62,111 @@ TEST_CASE(test_basic)
 	return true;
 }
 
+/* Destroyed coroutines are recycled by stack size, and small stacks work for shallow routines. */
+TEST_CASE(test_pooled)
+{
+	CF_Coroutine small = cf_make_coroutine(coroutine_func, 4096, NULL);
+	uint64_t small_id = small.id;
+	int a = 3, b = 4, c = 0;
+	cf_coroutine_push(small, &a, sizeof(a));
+	cf_coroutine_push(small, &b, sizeof(b));
+	cf_coroutine_resume(small);
+	cf_coroutine_resume(small);
+	cf_coroutine_pop(small, &c, sizeof(c));
+	REQUIRE(c == 12);
+	REQUIRE(cf_coroutine_state(small) == CF_COROUTINE_STATE_DEAD);
+	cf_destroy_coroutine(small);
+
+	// A different stack size doesn't take the small coroutine's memory, the same size does.
+	CF_Coroutine big = cf_make_coroutine(coroutine_wait_func, 0, NULL);
+	REQUIRE(big.id != small_id);
+	small = cf_make_coroutine(coroutine_func, 4096, NULL);
+	REQUIRE(small.id == small_id);
+	REQUIRE(cf_coroutine_state(small) == CF_COROUTINE_STATE_SUSPENDED);
+	REQUIRE(cf_coroutine_bytes_pushed(small) == 0);
+	a = 6; b = 7;
+	cf_coroutine_push(small, &a, sizeof(a));
+	cf_coroutine_push(small, &b, sizeof(b));
+	cf_coroutine_resume(small);
+	cf_coroutine_resume(small);
+	cf_coroutine_pop(small, &c, sizeof(c));
+	REQUIRE(c == 42);
+
+	// Suspended coroutines may be destroyed and recycled too.
+	cf_coroutine_resume(big);
+	cf_destroy_coroutine(big);
+	cf_destroy_coroutine(small);
+	cf_coroutine_release_pooled_memory();
+
+	return true;
+}
+
+static int s_steps[3];
+
+void scheduled_func(CF_Coroutine co)
+{
+	int* steps = (int*)cf_coroutine_get_udata(co);
+	cf_coroutine_wait_seconds(co, 0.5f);
+	steps[0]++;
+	cf_coroutine_wait_signal(co, 7);
+	steps[1]++;
+	cf_coroutine_yield(co);
+	steps[2]++;
+}
+
+/* The scheduler only resumes coroutines once their timer is up or their signal arrives. */
+TEST_CASE(test_scheduler)
+{
+	CF_Coroutine co = cf_make_coroutine(scheduled_func, 0, s_steps);
+	cf_coroutine_schedule(co, false);
+	REQUIRE(cf_coroutine_scheduled_count() == 1);
+
+	// Runs up to the timed wait, then sleeps through the next few updates.
+	cf_coroutine_scheduler_update(0.1f);
+	for (int i = 0; i < 3; ++i) {
+		cf_coroutine_scheduler_update(0.1f);
+		REQUIRE(s_steps[0] == 0);
+	}
+	cf_coroutine_scheduler_update(0.25f);
+	REQUIRE(s_steps[0] == 1);
+
+	// Waits on the signal for as long as it takes, and wrong signals don't wake it.
+	for (int i = 0; i < 300; ++i) {
+		cf_coroutine_scheduler_update(0.1f);
+	}
+	REQUIRE(cf_coroutine_signal(8) == 0);
+	cf_coroutine_scheduler_update(0.1f);
+	REQUIRE(s_steps[1] == 0);
+	REQUIRE(cf_coroutine_signal(7) == 1);
+	cf_coroutine_scheduler_update(0.1f);
+	REQUIRE(s_steps[1] == 1);
+
+	// A plain yield resumes on the next update, then the finished coroutine is dropped.
+	cf_coroutine_scheduler_update(0.1f);
+	REQUIRE(s_steps[2] == 1);
+	REQUIRE(cf_coroutine_scheduled_count() == 0);
+	REQUIRE(cf_coroutine_state(co) == CF_COROUTINE_STATE_DEAD);
+	cf_destroy_coroutine(co);
+
+	// Many sleepers with different timers, cleaned up by the scheduler once done.
+	static int steps[100][3];
+	for (int i = 0; i < 100; ++i) {
+		cf_coroutine_schedule(cf_make_coroutine(scheduled_func, 0, steps[i]), true);
+	}
+	cf_coroutine_scheduler_update(0.1f);
+	cf_coroutine_scheduler_update(1.0f);
+	REQUIRE(cf_coroutine_signal(7) == 100);
+	cf_coroutine_scheduler_update(0.1f);
+	cf_coroutine_scheduler_update(0.1f);
+	REQUIRE(cf_coroutine_scheduled_count() == 0);
+	REQUIRE(steps[99][2] == 1);
+
+	return true;
+}
+
 TEST_SUITE(test_coroutine)
 {
 	RUN_TEST_CASE(test_basic);
+	RUN_TEST_CASE(test_pooled);
+	RUN_TEST_CASE(test_scheduler);
 }
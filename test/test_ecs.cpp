@@ -437,6 +437,786 @@ TEST_CASE(test_ecs_change_entity_type)
 	dummy = (DummyComponent*)cf_entity_get_component(e, "DummyComponent");
 	REQUIRE(dummy == NULL);
 
+	// Change many entities at once, keeping the components both types share.
+	CF_Entity entities[100];
+	cf_make_entities("Dummy_Entity", 100, entities);
+	for (int i = 0; i < 100; ++i) {
+		((DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent"))->iters = i;
+	}
+	cf_entities_change_type(entities, 100, "Dummy_Entity2");
+	REQUIRE(dummy2_init_count == 102);
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(cf_entity_is_type(entities[i], "Dummy_Entity2"));
+		REQUIRE(((DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent"))->iters == i);
+	}
+
+	cf_destroy_app();
+
+	return true;
+}
+
+void update_dummy_double_system(CF_ComponentList component_list, int count, void* udata)
+{
+	DummyComponent* dummies = CF_GET_COMPONENTS(component_list, DummyComponent);
+	for (int i = 0; i < count; ++i) {
+		dummies[i].iters *= 2;
+	}
+}
+
+void update_dummy_destroy_system(CF_ComponentList component_list, int count, void* udata)
+{
+	CF_Entity* entities = cf_get_entities(component_list);
+	for (int i = 0; i < count; ++i) {
+		cf_destroy_entity_delayed(entities[i]);
+	}
+}
+
+/* Components fetched by ID match those fetched by name. */
+TEST_CASE(test_ecs_component_ids)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent2");
+	cf_component_set_size(sizeof(DummyComponent2));
+	cf_component_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	int id = cf_component_get_id("DummyComponent");
+	int id2 = cf_component_get_id("DummyComponent2");
+	REQUIRE(id >= 0);
+	REQUIRE(id2 >= 0);
+	REQUIRE(id != id2);
+	REQUIRE(cf_component_get_id("NotAComponent") == -1);
+
+	CF_Entity e = cf_make_entity("Dummy_Entity");
+	REQUIRE(cf_entity_has_component_by_id(e, id));
+	REQUIRE(!cf_entity_has_component_by_id(e, id2));
+	REQUIRE(!cf_entity_has_component_by_id(e, -1));
+	REQUIRE(cf_entity_get_component_by_id(e, id) == cf_entity_get_component(e, "DummyComponent"));
+	REQUIRE(cf_entity_get_component_by_id(e, id2) == NULL);
+
+	cf_destroy_app();
+
+	return true;
+}
+
+/* Parallel systems writing the same component keep their order, and delayed destruction still applies. */
+TEST_CASE(test_ecs_parallel_systems)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent2");
+	cf_component_set_size(sizeof(DummyComponent2));
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_set_optional_parallel(true);
+	cf_system_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_double_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_set_optional_parallel(true);
+	cf_system_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_destroy_system);
+	cf_system_require_component_read_only("DummyComponent2");
+	cf_system_set_optional_parallel(true);
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity2");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_add_component("DummyComponent2");
+	cf_entity_end();
+
+	CF_Entity e0 = cf_make_entity("Dummy_Entity");
+	CF_Entity e1 = cf_make_entity("Dummy_Entity2");
+	cf_run_systems();
+
+	DummyComponent* dummy = (DummyComponent*)cf_entity_get_component(e0, "DummyComponent");
+	REQUIRE(dummy->iters == 2);
+	REQUIRE(cf_entity_is_valid(e0));
+	REQUIRE(!cf_entity_is_valid(e1));
+
+	cf_destroy_app();
+
+	return true;
+}
+
+/* Collections spanning many chunks keep component addresses stable and update every entity. */
+TEST_CASE(test_ecs_chunks)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	const int count = 10000;
+	Array<CF_Entity> entities;
+	entities.add(cf_make_entity("Dummy_Entity"));
+	void* first = cf_entity_get_component(entities[0], "DummyComponent");
+	for (int i = 1; i < count; ++i) {
+		entities.add(cf_make_entity("Dummy_Entity"));
+	}
+	REQUIRE(cf_entity_get_component(entities[0], "DummyComponent") == first);
+
+	cf_run_systems();
+	for (int i = 0; i < count; ++i) {
+		DummyComponent* dummy = (DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent");
+		REQUIRE(dummy->iters == 1);
+	}
+
+	for (int i = 0; i < count; i += 2) {
+		cf_destroy_entity(entities[i]);
+	}
+	cf_run_systems();
+	for (int i = 1; i < count; i += 2) {
+		DummyComponent* dummy = (DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent");
+		REQUIRE(dummy->iters == 2);
+	}
+
+	cf_destroy_app();
+
+	return true;
+}
+
+/* Batched creation initializes every entity, and batched destruction frees them all. */
+TEST_CASE(test_ecs_batched_entities)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	const int count = 10000;
+	Array<CF_Entity> entities;
+	entities.ensure_count(count);
+	CF_Entity e = cf_make_entity("Dummy_Entity");
+	cf_make_entities("Dummy_Entity", count, entities.data());
+	cf_run_systems();
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(cf_entity_is_valid(entities[i]));
+		DummyComponent* dummy = (DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent");
+		REQUIRE(dummy->iters == 1);
+	}
+
+	cf_destroy_entities(entities.data(), count);
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(!cf_entity_is_valid(entities[i]));
+	}
+	REQUIRE(cf_entity_is_valid(e));
+	REQUIRE(((DummyComponent*)cf_entity_get_component(e, "DummyComponent"))->iters == 1);
+
+	cf_make_entities("Not_An_Entity", 1, entities.data());
+	REQUIRE(entities[0] == CF_INVALID_ENTITY);
+
+	cf_destroy_app();
+
+	return true;
+}
+
+void prefab_override(CF_ComponentList component_list, int first_instance, int count, void* udata)
+{
+	DummyComponent2* dummies = CF_GET_COMPONENTS(component_list, DummyComponent2);
+	CF_Entity* entities = cf_get_entities(component_list);
+	CF_Entity* out = (CF_Entity*)udata;
+	for (int i = 0; i < count; ++i) {
+		CF_ASSERT(entities[i] == out[first_instance + i]);
+		dummies[i].number = first_instance + i;
+	}
+}
+
+/* Prefabs copy their pre-initialized components into new entities, with optional per-instance overrides. */
+TEST_CASE(test_ecs_prefabs)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	int init_count = 0;
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent2");
+	cf_component_set_size(sizeof(DummyComponent2));
+	cf_component_set_optional_initializer(dummy2_initialize, &init_count);
+	cf_component_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_add_component("DummyComponent2");
+	cf_entity_end();
+
+	CF_Prefab prefab = cf_make_prefab("Dummy_Entity");
+	REQUIRE(init_count == 1);
+	REQUIRE(cf_prefab_get_component(prefab, "Not_A_Component") == NULL);
+	((DummyComponent*)cf_prefab_get_component(prefab, "DummyComponent"))->iters = 5;
+	REQUIRE(((DummyComponent2*)cf_prefab_get_component(prefab, "DummyComponent2"))->number == 10);
+
+	CF_Entity e = cf_make_entity("Dummy_Entity");
+	CF_Entity p = cf_make_entity_from_prefab(prefab);
+	REQUIRE(init_count == 2);
+	REQUIRE(((DummyComponent*)cf_entity_get_component(p, "DummyComponent"))->iters == 5);
+	REQUIRE(((DummyComponent2*)cf_entity_get_component(p, "DummyComponent2"))->number == 10);
+
+	// Start partway into a chunk, so the batch spans several runs.
+	const int count = 5000;
+	Array<CF_Entity> entities;
+	entities.ensure_count(count);
+	cf_make_entities_from_prefab(prefab, count, entities.data(), prefab_override, entities.data());
+	REQUIRE(init_count == 2);
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(cf_entity_is_valid(entities[i]));
+		REQUIRE(((DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent"))->iters == 5);
+		REQUIRE(((DummyComponent2*)cf_entity_get_component(entities[i], "DummyComponent2"))->number == i);
+	}
+	REQUIRE(((DummyComponent*)cf_entity_get_component(e, "DummyComponent"))->iters == 0);
+
+	cf_destroy_prefab(prefab);
+	REQUIRE(((DummyComponent*)cf_entity_get_component(p, "DummyComponent"))->iters == 5);
+
+	REQUIRE(cf_make_prefab("Not_An_Entity").id == 0);
+	cf_make_entities_from_prefab(cf_make_prefab("Not_An_Entity"), 1, entities.data(), NULL, NULL);
+	REQUIRE(entities[0] == CF_INVALID_ENTITY);
+
+	cf_destroy_app();
+
+	return true;
+}
+
+int s_dummy_cleanup_count;
+void dummy_cleanup(CF_Entity entity, void* component, void* udata)
+{
+	++s_dummy_cleanup_count;
+}
+
+/* Delayed destruction of many entities, some inactive, across collections leaves the rest intact. */
+TEST_CASE(test_ecs_delayed_destroy_batch)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_set_optional_cleanup(dummy_cleanup, NULL);
+	cf_component_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity2");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	const int count = 5000;
+	Array<CF_Entity> entities;
+	entities.ensure_count(count * 2);
+	cf_make_entities("Dummy_Entity", count, entities.data());
+	cf_make_entities("Dummy_Entity2", count, entities.data() + count);
+	for (int i = 0; i < count * 2; ++i) {
+		((DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent"))->iters = i;
+		if (i % 5 == 0) cf_entity_deactivate(entities[i]);
+	}
+
+	// Destroy every third entity, queueing some of them twice.
+	s_dummy_cleanup_count = 0;
+	int destroyed = 0;
+	for (int i = 0; i < count * 2; i += 3) {
+		cf_destroy_entity_delayed(entities[i]);
+		if (i % 2) cf_destroy_entity_delayed(entities[i]);
+		++destroyed;
+	}
+	cf_run_systems();
+	REQUIRE(s_dummy_cleanup_count == destroyed);
+
+	for (int i = 0; i < count * 2; ++i) {
+		if (i % 3 == 0) {
+			REQUIRE(!cf_entity_is_valid(entities[i]));
+			continue;
+		}
+		REQUIRE(cf_entity_is_valid(entities[i]));
+		REQUIRE(cf_entity_is_active(entities[i]) == (i % 5 != 0));
+		REQUIRE(((DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent"))->iters == i);
+	}
+
+	cf_destroy_app();
+
+	return true;
+}
+
+int s_changed_dummy_count;
+void update_changed_dummy_system(CF_ComponentList component_list, int count, void* udata)
+{
+	s_changed_dummy_count += count;
+}
+
+/* Systems with a changed filter only update entities whose component changed since their last run. */
+TEST_CASE(test_ecs_changed_filter)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_changed_dummy_system);
+	cf_system_require_component_read_only("DummyComponent");
+	cf_system_set_optional_changed_filter("DummyComponent");
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	CF_Entity e = cf_make_entity("Dummy_Entity");
+	s_changed_dummy_count = 0;
+	cf_run_systems();
+	REQUIRE(s_changed_dummy_count == 1);
+
+	s_changed_dummy_count = 0;
+	cf_run_systems();
+	REQUIRE(s_changed_dummy_count == 0);
+
+	REQUIRE(cf_entity_has_component(e, "DummyComponent"));
+	cf_run_systems();
+	REQUIRE(s_changed_dummy_count == 0);
+
+	((DummyComponent*)cf_entity_get_component(e, "DummyComponent"))->iters = 5;
+	cf_run_systems();
+	REQUIRE(s_changed_dummy_count == 1);
+
+	cf_destroy_app();
+
+	return true;
+}
+
+/* Restoring a snapshot undoes component writes, creation and destruction since the save. */
+TEST_CASE(test_ecs_world_snapshot)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	CF_Entity e0 = cf_make_entity("Dummy_Entity");
+	CF_Entity e1 = cf_make_entity("Dummy_Entity");
+	cf_run_systems();
+
+	CF_WorldSnapshot snapshot = cf_make_world_snapshot();
+	cf_world_save_snapshot(snapshot);
+
+	for (int i = 0; i < 2; ++i) {
+		cf_run_systems();
+		cf_destroy_entity(e0);
+		CF_Entity e2 = cf_make_entity("Dummy_Entity");
+		REQUIRE(((DummyComponent*)cf_entity_get_component(e1, "DummyComponent"))->iters == 2);
+
+		cf_world_restore_snapshot(snapshot);
+		REQUIRE(cf_entity_is_valid(e0));
+		REQUIRE(cf_entity_is_valid(e1));
+		REQUIRE(!cf_entity_is_valid(e2));
+		REQUIRE(((DummyComponent*)cf_entity_get_component(e0, "DummyComponent"))->iters == 1);
+		REQUIRE(((DummyComponent*)cf_entity_get_component(e1, "DummyComponent"))->iters == 1);
+	}
+
+	cf_destroy_world_snapshot(snapshot);
+	cf_destroy_app();
+
+	return true;
+}
+
+void update_dummy_destroy_at_three_system(CF_ComponentList component_list, int count, void* udata)
+{
+	DummyComponent* dummies = CF_GET_COMPONENTS(component_list, DummyComponent);
+	CF_Entity* entities = cf_get_entities(component_list);
+	for (int i = 0; i < count; ++i) {
+		if (dummies[i].iters == 3 && (i & 1)) cf_destroy_entity_delayed(entities[i]);
+	}
+}
+
+struct WorldThread
+{
+	CF_World world;
+	int entity_count;
+	Array<CF_Entity> entities;
+};
+
+static int s_world_thread(void* udata)
+{
+	WorldThread* thread = (WorldThread*)udata;
+	cf_world_bind_to_thread(thread->world);
+	thread->entities.ensure_count(thread->entity_count);
+	cf_make_entities("Dummy_Entity", thread->entity_count, thread->entities.data());
+	for (int i = 0; i < 5; ++i) {
+		cf_run_systems_world(thread->world);
+	}
+	cf_world_bind_to_thread(CF_INVALID_WORLD);
+	return 0;
+}
+
+/* Different worlds update at the same time on different threads without seeing each other. */
+TEST_CASE(test_ecs_concurrent_worlds)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_set_optional_parallel(true);
+	cf_system_end();
+
+	cf_system_begin();
+	cf_system_set_update(update_dummy_destroy_at_three_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	CF_World default_world = cf_world_peek();
+	WorldThread threads[4];
+	CF_Thread* handles[4];
+	for (int i = 0; i < 4; ++i) {
+		threads[i].world = cf_make_world();
+		threads[i].entity_count = 1000 * (i + 1);
+		handles[i] = cf_thread_create(s_world_thread, "world", threads + i);
+	}
+	for (int i = 0; i < 4; ++i) {
+		cf_thread_wait(handles[i]);
+	}
+
+	// The default world was never touched.
+	REQUIRE(cf_world_equals(cf_world_peek(), default_world));
+	CF_Query query = cf_make_query();
+	cf_query_require_component(query, "DummyComponent");
+	REQUIRE(cf_query_count(query) == 0);
+
+	for (int i = 0; i < 4; ++i) {
+		cf_world_push(threads[i].world);
+		for (int j = 0; j < threads[i].entity_count; ++j) {
+			CF_Entity e = threads[i].entities[j];
+			REQUIRE(cf_entity_is_valid(e) == !(j & 1));
+			if (cf_entity_is_valid(e)) {
+				REQUIRE(((DummyComponent*)cf_entity_get_component(e, "DummyComponent"))->iters == 5);
+			}
+		}
+		REQUIRE(cf_query_count(query) == threads[i].entity_count / 2);
+		cf_world_pop();
+		cf_destroy_world(threads[i].world);
+	}
+	cf_destroy_query(query);
+
+	cf_destroy_app();
+
+	return true;
+}
+
+/* Queries visit entities by component set from outside of systems, honoring exclusions. */
+TEST_CASE(test_ecs_queries)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent2");
+	cf_component_set_size(sizeof(DummyComponent2));
+	cf_component_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity2");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_add_component("DummyComponent2");
+	cf_entity_end();
+
+	const int count = 1000;
+	Array<CF_Entity> entities;
+	entities.ensure_count(count);
+	cf_make_entities("Dummy_Entity", count, entities.data());
+	CF_Entity e = cf_make_entity("Dummy_Entity2");
+
+	CF_Query query = cf_make_query();
+	cf_query_require_component(query, "DummyComponent");
+	REQUIRE(cf_query_count(query) == count + 1);
+
+	cf_query_exclude_component(query, "DummyComponent2");
+	REQUIRE(cf_query_count(query) == count);
+
+	cf_query_for_each(query, update_dummy_system, NULL);
+	cf_query_for_each_parallel(query, update_dummy_system, NULL);
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(((DummyComponent*)cf_entity_get_component(entities[i], "DummyComponent"))->iters == 2);
+	}
+	REQUIRE(((DummyComponent*)cf_entity_get_component(e, "DummyComponent"))->iters == 0);
+
+	cf_destroy_entities(entities.data(), count / 2);
+	REQUIRE(cf_query_count(query) == count - count / 2);
+
+	cf_destroy_query(query);
+	cf_destroy_app();
+
+	return true;
+}
+
+/* Profiling records each system's visited chunks and entities, plus the delayed operations of the frame. */
+TEST_CASE(test_ecs_system_profile)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent");
+	cf_component_set_size(sizeof(DummyComponent));
+	cf_component_set_optional_initializer(dummy_initialize, NULL);
+	cf_component_end();
+
+	cf_component_begin();
+	cf_component_set_name("DummyComponent2");
+	cf_component_set_size(sizeof(DummyComponent2));
+	cf_component_end();
+
+	cf_system_begin();
+	cf_system_set_name("dummy");
+	cf_system_set_update(update_dummy_system);
+	cf_system_require_component("DummyComponent");
+	cf_system_end();
+
+	cf_system_begin();
+	cf_system_set_name("destroy");
+	cf_system_set_update(update_dummy_destroy_system);
+	cf_system_require_component_read_only("DummyComponent2");
+	cf_system_set_optional_parallel(true);
+	cf_system_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Dummy_Entity2");
+	cf_entity_add_component("DummyComponent");
+	cf_entity_add_component("DummyComponent2");
+	cf_entity_end();
+
+	const int count = 1000;
+	Array<CF_Entity> entities;
+	entities.ensure_count(count);
+	cf_make_entities("Dummy_Entity", count, entities.data());
+	cf_make_entity("Dummy_Entity2");
+	cf_make_entity("Dummy_Entity2");
+
+	cf_run_systems();
+	REQUIRE(cf_query_system_profile().count == 0);
+
+	cf_system_profiling_enable(true);
+	cf_make_entity("Dummy_Entity2");
+	cf_run_systems();
+	CF_SystemsProfile profile = cf_query_system_profile();
+	REQUIRE(profile.count == 2);
+	REQUIRE(!CF_STRCMP(profile.systems[0].name, "dummy"));
+	REQUIRE(profile.systems[0].collection_count == 2);
+	REQUIRE(profile.systems[0].entity_count == count + 1);
+	REQUIRE(profile.systems[0].chunk_count >= 2);
+	REQUIRE(profile.systems[1].collection_count == 1);
+	REQUIRE(profile.systems[1].chunk_count == 1);
+	REQUIRE(profile.systems[1].entity_count == 1);
+	REQUIRE(profile.delayed_destroy_count == 1);
+	REQUIRE(profile.milliseconds >= profile.delayed_milliseconds);
+
+	// Both runs fall within the app's first frame, which ends with the next update.
+	cf_app_update(NULL);
+	CF_FrameStats stats = cf_app_get_frame_stats();
+	REQUIRE(stats.entities_iterated >= (count + 2) + (count + 1));
+	REQUIRE(stats.alloc_count > 0);
+	REQUIRE(stats.alloc_bytes > 0);
+	REQUIRE(stats.draw_calls == 0);
+
+	cf_destroy_app();
+
+	return true;
+}
+
+struct SavedComponent
+{
+	float p[2];
+	int hp;
+	bool alive;
+	int unsaved;
+};
+
+void sum_saved_system(CF_ComponentList component_list, int count, void* udata)
+{
+	SavedComponent* saved = CF_GET_COMPONENTS(component_list, SavedComponent);
+	for (int i = 0; i < count; ++i) {
+		*(int*)udata += saved[i].hp + (int)saved[i].p[1] + (saved[i].alive ? 1 : 0) + saved[i].unsaved;
+	}
+}
+
+/* Registered fields round-trip through both the binary and JSON world formats, including inactive entities. */
+TEST_CASE(test_ecs_serialization)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	cf_component_begin();
+	cf_component_set_name("SavedComponent");
+	cf_component_set_size(sizeof(SavedComponent));
+	cf_component_add_field("p", CF_COMPONENT_FIELD_TYPE_FLOAT, CF_OFFSET_OF(SavedComponent, p), 2);
+	cf_component_add_field("hp", CF_COMPONENT_FIELD_TYPE_INT32, CF_OFFSET_OF(SavedComponent, hp), 1);
+	cf_component_add_field("alive", CF_COMPONENT_FIELD_TYPE_BOOL, CF_OFFSET_OF(SavedComponent, alive), 1);
+	cf_component_end();
+
+	cf_entity_begin();
+	cf_entity_set_name("Saved_Entity");
+	cf_entity_add_component("SavedComponent");
+	cf_entity_end();
+
+	const int count = 1000;
+	Array<CF_Entity> entities;
+	entities.ensure_count(count);
+	cf_make_entities("Saved_Entity", count, entities.data());
+	int expected = 0;
+	for (int i = 0; i < count; ++i) {
+		SavedComponent* saved = (SavedComponent*)cf_entity_get_component(entities[i], "SavedComponent");
+		saved->p[0] = (float)i;
+		saved->p[1] = (float)(i * 2);
+		saved->hp = i - 500;
+		saved->alive = i % 3 == 0;
+		saved->unsaved = 0;
+		// The first two entities get deactivated below, so queries won't visit them.
+		if (i >= 2) expected += saved->hp + (int)saved->p[1] + (saved->alive ? 1 : 0);
+	}
+	cf_entity_deactivate(entities[0]);
+	cf_entity_deactivate(entities[1]);
+
+	size_t size = 0;
+	void* binary = cf_world_to_binary(&size);
+	CF_JDoc doc = cf_make_json(NULL, 0);
+	cf_json_set_root(doc, cf_world_to_json(doc));
+	REQUIRE(binary);
+
+	cf_destroy_entities(entities.data(), count);
+	CF_WorldSnapshot empty = cf_make_world_snapshot();
+	cf_world_save_snapshot(empty);
+
+	CF_Query query = cf_make_query();
+	cf_query_require_component(query, "SavedComponent");
+	REQUIRE(cf_query_count(query) == 0);
+
+	REQUIRE(!cf_is_error(cf_world_from_binary(binary, size)));
+	REQUIRE(cf_query_count(query) == count - 2);
+	int sum = 0;
+	cf_query_for_each(query, sum_saved_system, &sum);
+	REQUIRE(sum == expected);
+
+	cf_world_restore_snapshot(empty);
+	REQUIRE(cf_is_error(cf_world_from_binary(binary, size - 3)));
+	cf_world_restore_snapshot(empty);
+	REQUIRE(cf_query_count(query) == 0);
+
+	REQUIRE(!cf_is_error(cf_world_from_json(cf_json_get_root(doc))));
+	REQUIRE(cf_query_count(query) == count - 2);
+	sum = 0;
+	cf_query_for_each(query, sum_saved_system, &sum);
+	REQUIRE(sum == expected);
+
+	cf_destroy_world_snapshot(empty);
+	cf_destroy_query(query);
+	cf_destroy_json(doc);
+	cf_free(binary);
 	cf_destroy_app();
 
 	return true;
@@ -448,4 +1228,16 @@ TEST_SUITE(test_ecs)
 	RUN_TEST_CASE(test_ecs_basic);
 	RUN_TEST_CASE(test_ecs_activation);
 	RUN_TEST_CASE(test_ecs_change_entity_type);
+	RUN_TEST_CASE(test_ecs_parallel_systems);
+	RUN_TEST_CASE(test_ecs_component_ids);
+	RUN_TEST_CASE(test_ecs_chunks);
+	RUN_TEST_CASE(test_ecs_batched_entities);
+	RUN_TEST_CASE(test_ecs_prefabs);
+	RUN_TEST_CASE(test_ecs_delayed_destroy_batch);
+	RUN_TEST_CASE(test_ecs_changed_filter);
+	RUN_TEST_CASE(test_ecs_world_snapshot);
+	RUN_TEST_CASE(test_ecs_concurrent_worlds);
+	RUN_TEST_CASE(test_ecs_queries);
+	RUN_TEST_CASE(test_ecs_system_profile);
+	RUN_TEST_CASE(test_ecs_serialization);
 }
@@ -115,10 +115,99 @@ TEST_CASE(test_handle_alloc_too_many)
 	return true;
 }
 
+/* Bulk allocation into a pre-sized table, then copying it. */
+TEST_CASE(test_handle_reserve_and_copy)
+{
+	CF_HandleTable* table = cf_make_handle_allocator(0);
+	cf_handle_allocator_reserve(table, 4096);
+	REQUIRE(!cf_handle_allocator_handle_valid(table, CF_INVALID_HANDLE));
+
+	CF_Handle* handles = (CF_Handle*)malloc(sizeof(CF_Handle) * 3000);
+	cf_handle_allocator_alloc_many(table, 100, 3000, 7, handles);
+	for (int i = 0; i < 3000; ++i) {
+		REQUIRE(cf_handle_allocator_handle_valid(table, handles[i]));
+		REQUIRE(cf_handle_allocator_get_index(table, handles[i]) == (uint32_t)(100 + i));
+		REQUIRE(cf_handle_allocator_get_type(table, handles[i]) == 7);
+	}
+	for (int i = 0; i < 3000; i += 3) {
+		cf_handle_allocator_free(table, handles[i]);
+	}
+
+	CF_HandleTable* copy = cf_make_handle_allocator(0);
+	cf_handle_allocator_copy(copy, table);
+	for (int i = 0; i < 3000; ++i) {
+		REQUIRE(!!cf_handle_allocator_handle_valid(copy, handles[i]) == (i % 3 != 0));
+	}
+
+	// Freed entries are reused before the table grows.
+	CF_Handle h = cf_handle_allocator_alloc(copy, 5, 0);
+	REQUIRE((h >> 32) < 3000);
+	REQUIRE(cf_handle_allocator_get_index(copy, h) == 5);
+
+	cf_destroy_handle_allocator(copy);
+	cf_destroy_handle_allocator(table);
+	free(handles);
+
+	return true;
+}
+
+/* Values stay packed as they're removed, and stale handles are caught. */
+TEST_CASE(test_slot_map)
+{
+	SlotMap<int> map;
+	Handle handles[100];
+	for (int i = 0; i < 100; ++i) {
+		handles[i] = map.insert(i);
+	}
+	REQUIRE(map.count() == 100);
+
+	// Remove the even values.
+	for (int i = 0; i < 100; i += 2) {
+		REQUIRE(map.remove(handles[i]));
+	}
+	REQUIRE(map.count() == 50);
+	REQUIRE(!map.remove(handles[0]));
+	REQUIRE(!map.valid(CF_INVALID_HANDLE));
+
+	for (int i = 0; i < 100; ++i) {
+		if (i % 2) {
+			REQUIRE(map.valid(handles[i]));
+			REQUIRE(map.get(handles[i]) == i);
+		} else {
+			REQUIRE(!map.valid(handles[i]));
+			REQUIRE(map.find(handles[i]) == NULL);
+		}
+	}
+
+	// Dense iteration only sees the remaining values, each paired with its handle.
+	int sum = 0;
+	for (int i = 0; i < map.count(); ++i) {
+		REQUIRE(map.get(map.handle_of(i)) == map[i]);
+		sum += map[i];
+	}
+	REQUIRE(sum == 2500);
+
+	// Reused slots don't revive old handles.
+	Handle h = map.insert(1000);
+	REQUIRE(*map.find(h) == 1000);
+	for (int i = 0; i < 100; i += 2) {
+		REQUIRE(!map.valid(handles[i]));
+	}
+
+	map.clear();
+	REQUIRE(map.empty());
+	REQUIRE(!map.valid(h));
+	REQUIRE(!map.valid(handles[1]));
+
+	return true;
+}
+
 TEST_SUITE(test_handle)
 {
 	RUN_TEST_CASE(test_handle_basic);
 	RUN_TEST_CASE(test_handle_large_loop);
 	RUN_TEST_CASE(test_handle_large_loop_and_free);
 	RUN_TEST_CASE(test_handle_alloc_too_many);
+	RUN_TEST_CASE(test_handle_reserve_and_copy);
+	RUN_TEST_CASE(test_slot_map);
 }
\ No newline at end of file
@@ -205,7 +205,153 @@ TEST_CASE(test_hashtable_has)
     return true;
 }
 
+/* Lots of adds and removes stay findable, and the dense items/keys arrays stay in sync. */
+TEST_CASE(test_hashtable_churn)
+{
+	int* h = NULL;
+	for (int round = 0; round < 3; ++round) {
+		for (uint64_t i = 0; i < 10000; ++i) {
+			hset(h, i * 7919, (int)i);
+		}
+		for (uint64_t i = 0; i < 10000; i += 3) {
+			hdel(h, i * 7919);
+		}
+		REQUIRE(hcount(h) == 10000 - 3334);
+		for (uint64_t i = 0; i < 10000; ++i) {
+			REQUIRE(hhas(h, i * 7919) == (i % 3 != 0));
+			if (i % 3) REQUIRE(hget(h, i * 7919) == (int)i);
+		}
+		const uint64_t* keys = hkeys(h);
+		for (int i = 0; i < hcount(h); ++i) {
+			REQUIRE(h[i] == (int)(keys[i] / 7919));
+		}
+		// Re-adding the removed keys reuses deleted slots.
+		for (uint64_t i = 0; i < 10000; i += 3) {
+			hset(h, i * 7919, (int)i);
+		}
+		REQUIRE(hcount(h) == 10000);
+		if (round == 1) {
+			hclear(h);
+			REQUIRE(hcount(h) == 0);
+			REQUIRE(!hhas(h, 7919));
+		} else {
+			for (uint64_t i = 0; i < 10000; ++i) {
+				hdel(h, i * 7919);
+			}
+		}
+	}
+	hfree(h);
+
+	return true;
+}
+
+/* Reserving and building in bulk produce a table equivalent to adding one pair at a time. */
+TEST_CASE(test_hashtable_bulk)
+{
+	int* h = NULL;
+	hreserve(h, 1000);
+	const uint64_t* initial_keys = hkeys(h);
+	for (uint64_t i = 0; i < 1000; ++i) {
+		hset(h, i, (int)i);
+	}
+	// Nothing grew, so the key array never moved.
+	REQUIRE(hkeys(h) == initial_keys);
+	hfree(h);
+
+	Array<uint64_t> keys;
+	Array<int> items;
+	for (int i = 0; i < 5000; ++i) {
+		keys.add((uint64_t)i * 31 + 7);
+		items.add(i);
+	}
+	hset(h, 123456789, 1);
+	hbuild_from(h, keys.data(), items.data(), keys.count());
+	REQUIRE(hcount(h) == 5000);
+	REQUIRE(!hhas(h, 123456789));
+	for (int i = 0; i < 5000; ++i) {
+		REQUIRE(h[i] == i);
+		REQUIRE(hget(h, (uint64_t)i * 31 + 7) == i);
+	}
+	hdel(h, 7);
+	hset(h, 7, 42);
+	REQUIRE(hget(h, 7) == 42);
+	hfree(h);
+
+	Map<int, Array<int>> m;
+	for (int i = 0; i < 100; ++i) {
+		m.add(i)->add(i);
+	}
+	Map<int, Array<int>> copy = m;
+	REQUIRE(copy.count() == 100);
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(copy.get(i)[0] == i);
+		REQUIRE(copy.get(i).data() != m.get(i).data());
+	}
+
+	return true;
+}
+
+/* Sorting large tables orders the dense arrays, keeps keys paired with items, and keeps lookups working. */
+TEST_CASE(test_hashtable_sort)
+{
+	int* h = NULL;
+	uint64_t x = 12345;
+	for (int i = 0; i < 50000; ++i) {
+		x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+		uint64_t key = (i & 1) ? (x >> 40) : x;
+		if (!hhas(h, key)) hset(h, key, (int)(key & 0xFFFF));
+	}
+	hsort(h);
+	const uint64_t* keys = hkeys(h);
+	for (int i = 0; i < hcount(h); ++i) {
+		if (i) REQUIRE(keys[i - 1] < keys[i]);
+		REQUIRE(h[i] == (int)(keys[i] & 0xFFFF));
+		REQUIRE(hget(h, keys[i]) == h[i]);
+	}
+	hfree(h);
+
+	const char* names[] = { "delta", "Alpha", "charlie", "Echo", "bravo" };
+	for (int i = 0; i < 5; ++i) {
+		hset(h, sintern(names[i]), i);
+	}
+	hsisort(h);
+	const char* const* skeys = (const char* const*)hkeys(h);
+	for (int i = 0; i < 4; ++i) {
+		REQUIRE(sicmp(skeys[i], skeys[i + 1]) < 0);
+	}
+	hssort(h);
+	skeys = (const char* const*)hkeys(h);
+	for (int i = 0; i < 4; ++i) {
+		REQUIRE(scmp(skeys[i], skeys[i + 1]) < 0);
+	}
+	for (int i = 0; i < 5; ++i) {
+		REQUIRE(hget(h, sintern(names[i])) == i);
+	}
+	hfree(h);
+
+	Map<int, String> m;
+	for (int i = 0; i < 1000; ++i) {
+		m.insert((i * 7919) % 1000, String((i * 7919) % 1000));
+	}
+	m.sort_by_items([](const String& a, const String& b) { return a.to_int() > b.to_int(); });
+	for (int i = 0; i < m.count(); ++i) {
+		REQUIRE(m.items()[i].to_int() == 999 - i);
+		REQUIRE(m.keys()[i] == 999 - i);
+		REQUIRE(m.get(999 - i).to_int() == 999 - i);
+	}
+	m.sort_by_keys([](int a, int b) { return a < b; });
+	for (int i = 0; i < m.count(); ++i) {
+		REQUIRE(m.keys()[i] == i);
+	}
+
+	return true;
+}
+
 TEST_SUITE(test_hashtable)
 {
 	RUN_TEST_CASE(test_hashtable_macros);
+	RUN_TEST_CASE(test_hashtable_has);
+	RUN_TEST_CASE(test_hashtable_churn);
+	RUN_TEST_CASE(test_hashtable_bulk);
+	RUN_TEST_CASE(test_hashtable_sort);
 }
@@ -263,6 +263,288 @@ TEST_CASE(test_json_numeric)
 	return true;
 }
 
+TEST_CASE(test_json_readonly)
+{
+	const char* s =
+			"{\n"
+			"\t\"name\": \"slime\",\n"
+			"\t\"health\": 100,\n"
+			"\t\"drops\": [1, 2, 3],\n"
+			"\t\"speed\": 2.5\n"
+			"}"
+	;
+	CF_JDoc doc = cf_make_json_readonly(s, CF_STRLEN(s));
+	REQUIRE(cf_json_is_readonly(doc));
+	CF_JVal root = cf_json_get_root(doc);
+	REQUIRE(cf_json_is_object(root));
+	REQUIRE(!CF_STRCMP(cf_json_get_string(cf_json_get(root, "name")), "slime"));
+	REQUIRE(cf_json_get_int(cf_json_get(root, "health")) == 100);
+	REQUIRE(cf_json_get(root, "missing").id == 0);
+
+	CF_JVal drops = cf_json_get(root, "drops");
+	REQUIRE(cf_json_get_len(drops) == 3);
+	REQUIRE(cf_json_get_int(cf_json_array_at(drops, 2)) == 3);
+	int sum = 0;
+	for (CF_JIter iter = cf_json_iter(drops); !cf_json_iter_done(iter); iter = cf_json_iter_next(iter)) {
+		sum += cf_json_get_int(cf_json_iter_val(iter));
+	}
+	REQUIRE(sum == 6);
+
+	const char* keys[] = { "name", "health", "drops", "speed" };
+	for (CF_JIter iter = cf_json_iter(root); !cf_json_iter_done(iter); iter = cf_json_iter_next(iter)) {
+		REQUIRE(!CF_STRCMP(cf_json_iter_key(iter), keys[iter.index]));
+	}
+	CF_JIter iter = cf_json_iter(root);
+	REQUIRE(cf_json_get_float(cf_json_iter_next_by_name(&iter, "speed")) == 2.5f);
+	REQUIRE(!CF_STRCMP(cf_json_get_string(cf_json_iter_next_by_name(&iter, "name")), "slime"));
+
+	char* s0 = cf_json_to_string_minimal(doc);
+	REQUIRE(!CF_STRCMP(s0, "{\"name\":\"slime\",\"health\":100,\"drops\":[1,2,3],\"speed\":2.5}"));
+	sfree(s0);
+	cf_destroy_json(doc);
+
+	return true;
+}
+
+TEST_CASE(test_json_array_access)
+{
+	CF_JDoc doc = cf_make_json(NULL, 0);
+	CF_JVal arr = cf_json_array(doc);
+	cf_json_set_root(doc, arr);
+	for (int i = 0; i < 100; ++i) {
+		cf_json_array_add_int(doc, arr, i);
+	}
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(cf_json_get_int(cf_json_array_at(arr, i)) == i);
+	}
+	REQUIRE(cf_json_get_int(cf_json_array_at(arr, 10)) == 10);
+	REQUIRE(cf_json_array_at(arr, 100).id == 0);
+	cf_json_array_pop(arr);
+	REQUIRE(cf_json_array_at(arr, 99).id == 0);
+	int ints[128];
+	REQUIRE(cf_json_array_get_ints(arr, ints, 128) == 99);
+	REQUIRE(ints[0] == 0 && ints[98] == 98);
+
+	char* s = cf_json_to_string_minimal(doc);
+	CF_JDoc ro = cf_make_json_readonly(s, slen(s));
+	CF_JVal ro_arr = cf_json_get_root(ro);
+	float floats[4];
+	REQUIRE(cf_json_array_get_floats(ro_arr, floats, 4) == 4);
+	REQUIRE(floats[3] == 3.0f);
+	for (int i = 0; i < 99; ++i) {
+		REQUIRE(cf_json_get_int(cf_json_array_at(ro_arr, i)) == i);
+	}
+	sfree(s);
+	cf_destroy_json(ro);
+	cf_destroy_json(doc);
+
+	// Nested arrays aren't stored flat in read-only documents.
+	const char* nested = "{ \"tiles\": [[0], [1, 1], [2], [3], [4]], \"w\": 5 }";
+	ro = cf_make_json_readonly(nested, CF_STRLEN(nested));
+	CF_JVal tiles = cf_json_get(cf_json_get_root(ro), "tiles");
+	for (int i = 0; i < 5; ++i) {
+		REQUIRE(cf_json_get_int(cf_json_array_at(cf_json_array_at(tiles, i), 0)) == i);
+	}
+	REQUIRE(cf_json_get_int(cf_json_array_at(cf_json_array_at(tiles, 1), 1)) == 1);
+	cf_destroy_json(ro);
+
+	return true;
+}
+
+TEST_CASE(test_json_wide_object)
+{
+	CF_JDoc doc = cf_make_json(NULL, 0);
+	CF_JVal root = cf_json_object(doc);
+	cf_json_set_root(doc, root);
+	for (int i = 0; i < 64; ++i) {
+		char key[16];
+		CF_SNPRINTF(key, sizeof(key), "key%d", i);
+		cf_json_object_add_int(doc, root, sintern(key), i);
+	}
+	char* s = cf_json_to_string_minimal(doc);
+	cf_destroy_json(doc);
+
+	CF_JDoc ro = cf_make_json_readonly(s, slen(s));
+	sfree(s);
+	root = cf_json_get_root(ro);
+	for (int pass = 0; pass < 2; ++pass) {
+		for (int i = 0; i < 64; ++i) {
+			char key[16];
+			CF_SNPRINTF(key, sizeof(key), "key%d", i);
+			REQUIRE(cf_json_get_int(cf_json_get(root, key)) == i);
+		}
+		REQUIRE(cf_json_get(root, "key64").id == 0);
+	}
+	cf_destroy_json(ro);
+
+	return true;
+}
+
+/* The streaming writer formats text the same as serializing a document. */
+TEST_CASE(test_json_writer)
+{
+	CF_JDoc doc = cf_make_json(NULL, 0);
+	CF_JVal root = cf_json_object(doc);
+	cf_json_set_root(doc, root);
+	cf_json_object_add_string(doc, root, "name", "Slime \"King\"\n");
+	cf_json_object_add_int(doc, root, "hp", -25);
+	cf_json_object_add_float(doc, root, "speed", 2.5f);
+	cf_json_object_add_bool(doc, root, "boss", true);
+	cf_json_object_add_null(doc, root, "target");
+	CF_JVal items = cf_json_array(doc);
+	cf_json_object_add(doc, root, "items", items);
+	cf_json_array_add_int(doc, items, 1);
+	cf_json_array_add_object(doc, items);
+	cf_json_array_add_array(doc, items);
+	cf_json_object_add(doc, root, "empty", cf_json_object(doc));
+
+	for (int i = 0; i < 2; ++i) {
+		bool pretty = i == 0;
+		CF_JsonWriter w = cf_make_json_writer(pretty);
+		cf_json_write_begin_object(w);
+		cf_json_write_key(w, "name");
+		cf_json_write_string(w, "Slime \"King\"\n");
+		cf_json_write_key(w, "hp");
+		cf_json_write_int(w, -25);
+		cf_json_write_key(w, "speed");
+		cf_json_write_float(w, 2.5f);
+		cf_json_write_key(w, "boss");
+		cf_json_write_bool(w, true);
+		cf_json_write_key(w, "target");
+		cf_json_write_null(w);
+		cf_json_write_key(w, "items");
+		cf_json_write_begin_array(w);
+		cf_json_write_int(w, 1);
+		cf_json_write_begin_object(w);
+		cf_json_write_end_object(w);
+		cf_json_write_begin_array(w);
+		cf_json_write_end_array(w);
+		cf_json_write_end_array(w);
+		cf_json_write_key(w, "empty");
+		cf_json_write_begin_object(w);
+		cf_json_write_end_object(w);
+		cf_json_write_end_object(w);
+		REQUIRE(!cf_is_error(cf_json_writer_finish(w)));
+
+		char* expected = pretty ? cf_json_to_string(doc) : cf_json_to_string_minimal(doc);
+		REQUIRE(!CF_STRCMP(cf_json_writer_get_string(w), expected));
+		sfree(expected);
+		cf_destroy_json_writer(w);
+	}
+	cf_destroy_json(doc);
+
+	// Floats take the fewest digits that read back the same.
+	CF_JsonWriter w = cf_make_json_writer(false);
+	cf_json_write_begin_array(w);
+	cf_json_write_float(w, 0.1f);
+	cf_json_write_float(w, 3.0f);
+	cf_json_write_double(w, 1.0 / 3.0);
+	cf_json_write_end_array(w);
+	REQUIRE(!cf_is_error(cf_json_writer_finish(w)));
+	doc = cf_make_json(cf_json_writer_get_string(w), CF_STRLEN(cf_json_writer_get_string(w)));
+	REQUIRE(!CF_STRNCMP(cf_json_writer_get_string(w), "[0.1,3.0,", 9));
+	REQUIRE(cf_json_get_float(cf_json_array_at(cf_json_get_root(doc), 0)) == 0.1f);
+	REQUIRE(cf_json_is_float(cf_json_array_at(cf_json_get_root(doc), 1)));
+	REQUIRE(cf_json_get_double(cf_json_array_at(cf_json_get_root(doc), 2)) == 1.0 / 3.0);
+	cf_destroy_json(doc);
+	cf_destroy_json_writer(w);
+
+	// Unbalanced writes are reported when finishing.
+	w = cf_make_json_writer(false);
+	cf_json_write_begin_array(w);
+	REQUIRE(cf_is_error(cf_json_writer_finish(w)));
+	cf_destroy_json_writer(w);
+
+	return true;
+}
+
+/* The pull reader walks the same relaxed json as the DOM, token by token. */
+TEST_CASE(test_json_reader)
+{
+	const char* text =
+		"{\n"
+		"\t// Comments and trailing commas are allowed.\n"
+		"\t\"name\": \"Slime \\\"King\\\"\\u00e9\",\n"
+		"\t\"hp\": -25, \"speed\": 2.5, \"boss\": true, \"target\": null,\n"
+		"\t\"skipped\": { \"a\": [1, 2, {\"b\": []}] },\n"
+		"\t\"items\": [18446744073709551615, 1e3, \"x\",],\n"
+		"}";
+	CF_JsonReader r = cf_make_json_reader(text, CF_STRLEN(text));
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_BEGIN_OBJECT);
+	REQUIRE(cf_json_reader_depth(r) == 1);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(!CF_STRCMP(cf_json_reader_get_string(r), "name"));
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_STRING);
+	REQUIRE(!CF_STRCMP(cf_json_reader_get_string(r), "Slime \"King\"\xC3\xA9"));
+	REQUIRE(cf_json_reader_get_len(r) == 14);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_INT);
+	REQUIRE(cf_json_reader_get_i64(r) == -25);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_FLOAT);
+	REQUIRE(cf_json_reader_get_double(r) == 2.5);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_BOOL);
+	REQUIRE(cf_json_reader_get_bool(r));
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_NULL);
+
+	// Skipping a key skips its whole value.
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(!CF_STRCMP(cf_json_reader_get_string(r), "skipped"));
+	cf_json_reader_skip(r);
+	REQUIRE(cf_json_reader_depth(r) == 1);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_KEY);
+	REQUIRE(!CF_STRCMP(cf_json_reader_get_string(r), "items"));
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_BEGIN_ARRAY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_INT);
+	REQUIRE(cf_json_reader_get_u64(r) == UINT64_MAX);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_FLOAT);
+	REQUIRE(cf_json_reader_get_i64(r) == 1000);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_STRING);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_END_ARRAY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_END_OBJECT);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_END);
+	REQUIRE(!cf_is_error(cf_json_reader_result(r)));
+	cf_destroy_json_reader(r);
+
+	// Errors stick, and the reader stops.
+	const char* bad = "[1, 2 3]";
+	r = cf_make_json_reader(bad, CF_STRLEN(bad));
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_BEGIN_ARRAY);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_INT);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_INT);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_ERROR);
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_ERROR);
+	REQUIRE(cf_is_error(cf_json_reader_result(r)));
+	cf_destroy_json_reader(r);
+
+	const char* truncated = "{\"a\": [1, ";
+	r = cf_make_json_reader(truncated, CF_STRLEN(truncated));
+	while (cf_json_reader_next(r) > CF_JTOKEN_ERROR) {}
+	REQUIRE(cf_is_error(cf_json_reader_result(r)));
+	cf_destroy_json_reader(r);
+
+	// Binary blobs round trip through base64 strings.
+	uint8_t blob[5000];
+	for (int i = 0; i < (int)sizeof(blob); ++i) blob[i] = (uint8_t)(i * 31);
+	CF_JsonWriter w = cf_make_json_writer(false);
+	cf_json_write_base64(w, blob, sizeof(blob));
+	REQUIRE(!cf_is_error(cf_json_writer_finish(w)));
+	const char* written = cf_json_writer_get_string(w);
+	r = cf_make_json_reader(written, CF_STRLEN(written));
+	REQUIRE(cf_json_reader_next(r) == CF_JTOKEN_STRING);
+	uint8_t decoded[sizeof(blob)];
+	size_t decoded_size = 0;
+	REQUIRE(!cf_is_error(cf_json_reader_get_base64(r, decoded, sizeof(decoded), &decoded_size)));
+	REQUIRE(decoded_size == sizeof(blob));
+	REQUIRE(!CF_MEMCMP(decoded, blob, sizeof(blob)));
+	cf_destroy_json_reader(r);
+	cf_destroy_json_writer(w);
+
+	return true;
+}
+
 TEST_SUITE(test_json)
 {
 	RUN_TEST_CASE(test_json_basic);
@@ -273,4 +555,9 @@ TEST_SUITE(test_json)
 	RUN_TEST_CASE(test_json_iterate_object);
 	RUN_TEST_CASE(test_json_iterate_object_cpp);
 	RUN_TEST_CASE(test_json_numeric);
+	RUN_TEST_CASE(test_json_readonly);
+	RUN_TEST_CASE(test_json_array_access);
+	RUN_TEST_CASE(test_json_wide_object);
+	RUN_TEST_CASE(test_json_writer);
+	RUN_TEST_CASE(test_json_reader);
 }
@@ -0,0 +1,72 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+#include <cute_log.h>
+#include <cute_string.h>
+using namespace Cute;
+
+struct LogCapture
+{
+	Array<String> messages;
+	Array<LogLevel> levels;
+};
+
+static void s_capture(CF_LogLevel level, const char* message, void* udata)
+{
+	LogCapture* capture = (LogCapture*)udata;
+	capture->messages.add(message);
+	capture->levels.add(level);
+}
+
+/* Arguments are copied at the call and formatted later just as printf would, and filtered levels are skipped. */
+TEST_CASE(test_log_format)
+{
+	LogCapture capture;
+	cf_log_flush();
+	log_set_stdout(false);
+	log_set_sink(s_capture, &capture);
+
+	char name[16];
+	CF_STRNCPY(name, "goblin", sizeof(name));
+	cf_log(CF_LOG_LEVEL_INFO, "spawned %s #%d at (%.1f, %.1f) 100%%\n", name, 7, 1.5f, -3.0f);
+	CF_STRNCPY(name, "freed", sizeof(name));
+	cf_log(CF_LOG_LEVEL_WARNING, "%-4s|%5.2e|%llx|%c|%*d", "ab", 1234.5, 0xdeadbeefULL, 'z', 4, 9);
+	log_set_level(CF_LOG_LEVEL_WARNING);
+	cf_log(CF_LOG_LEVEL_INFO, "skipped");
+	log_set_level(CF_LOG_LEVEL_DEBUG);
+	log_flush();
+
+	REQUIRE(capture.messages.count() == 2);
+	REQUIRE(capture.messages[0] == "spawned goblin #7 at (1.5, -3.0) 100%");
+	REQUIRE(capture.levels[0] == CF_LOG_LEVEL_INFO);
+	REQUIRE(capture.messages[1] == "ab  |1.23e+03|deadbeef|z|   9");
+	REQUIRE(capture.levels[1] == CF_LOG_LEVEL_WARNING);
+
+	// Strings too long for one record are cut short and counted.
+	uint64_t truncated = log_stats().truncated_count;
+	String big;
+	for (int i = 0; i < 1000; ++i) big.add('a');
+	cf_log(CF_LOG_LEVEL_DEBUG, "%s", big.c_str());
+	log_flush();
+	REQUIRE(capture.messages.count() == 3);
+	REQUIRE(capture.messages[2].len() < 1000);
+	REQUIRE(capture.messages[2].suffix("..."));
+	REQUIRE(log_stats().truncated_count == truncated + 1);
+
+	log_set_sink(NULL);
+	log_set_stdout(true);
+	return true;
+}
+
+TEST_SUITE(test_log)
+{
+	RUN_TEST_CASE(test_log_format);
+}
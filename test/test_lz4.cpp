@@ -0,0 +1,156 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_alloc.h>
+#include <cute_c_runtime.h>
+#include <internal/cute_file_system_internal.h>
+
+#define LZ4_GUARD_SIZE 16
+#define LZ4_GUARD_BYTE 0xCD
+
+// Mostly repeating runs with a little noise, so there are plenty of matches of many lengths.
+static void s_lz4_fill(uint8_t* data, size_t size, uint32_t seed)
+{
+	for (size_t i = 0; i < size; ++i) {
+		seed = seed * 1664525u + 1013904223u;
+		data[i] = (seed >> 28) ? (uint8_t)(i % 23) : (uint8_t)(seed >> 16);
+	}
+}
+
+static bool s_lz4_guard_intact(const uint8_t* guard)
+{
+	for (int i = 0; i < LZ4_GUARD_SIZE; ++i) {
+		if (guard[i] != LZ4_GUARD_BYTE) return false;
+	}
+	return true;
+}
+
+// Decompresses into a buffer with guard bytes past `dst_size`, from an input copied to a buffer of exactly `src_size`,
+// so writing past the output is caught here and reading past the input is caught by address sanitizers.
+static bool s_lz4_decompress_guarded(const uint8_t* src, size_t src_size, size_t dst_size, uint8_t* out, bool* guard_intact)
+{
+	uint8_t* in = (uint8_t*)cf_alloc(src_size ? src_size : 1);
+	CF_MEMCPY(in, src, src_size);
+	uint8_t* dst = (uint8_t*)cf_alloc(dst_size + LZ4_GUARD_SIZE);
+	CF_MEMSET(dst + dst_size, LZ4_GUARD_BYTE, LZ4_GUARD_SIZE);
+	bool ok = cf_lz4_decompress(in, src_size, dst, dst_size);
+	*guard_intact = s_lz4_guard_intact(dst + dst_size);
+	if (out) CF_MEMCPY(out, dst, dst_size);
+	cf_free(dst);
+	cf_free(in);
+	return ok;
+}
+
+/* Round trips sizes on both sides of the match finder limit, and inputs long enough to exceed the max match offset. */
+TEST_CASE(test_lz4_round_trip)
+{
+	size_t sizes[] = { 70000, 4096, 1000, 255, 256, 270 };
+	size_t max_size = sizes[0];
+	uint8_t* raw = (uint8_t*)cf_alloc(max_size);
+	uint8_t* compressed = (uint8_t*)cf_alloc(cf_lz4_bound(max_size));
+	uint8_t* decompressed = (uint8_t*)cf_alloc(max_size);
+
+	for (int pass = 0; pass < 2; ++pass) {
+		// Every small size from empty through a few bytes past the match finder limit.
+		for (size_t n = 0; n < 40 + CF_ARRAY_SIZE(sizes); ++n) {
+			size_t size = n < 40 ? n : sizes[n - 40];
+			if (pass == 0) s_lz4_fill(raw, size, (uint32_t)size);
+			else CF_MEMSET(raw, 'a', size);
+			size_t compressed_size = cf_lz4_compress(raw, size, compressed);
+			REQUIRE(compressed_size > 0);
+			REQUIRE(compressed_size <= cf_lz4_bound(size));
+			bool guard_intact;
+			REQUIRE(s_lz4_decompress_guarded(compressed, compressed_size, size, decompressed, &guard_intact));
+			REQUIRE(guard_intact);
+			REQUIRE(!CF_MEMCMP(raw, decompressed, size));
+			if (pass == 1 && size > 1000) REQUIRE(compressed_size < size / 100);
+		}
+	}
+
+	cf_free(decompressed);
+	cf_free(compressed);
+	cf_free(raw);
+	return true;
+}
+
+/* Truncated input, the wrong output size, and hand-made bad sequences fail without touching memory out of bounds. */
+TEST_CASE(test_lz4_corrupt)
+{
+	const size_t size = 1000;
+	uint8_t raw[size];
+	uint8_t compressed[size + size / 255 + 16];
+	s_lz4_fill(raw, size, 7);
+	size_t compressed_size = cf_lz4_compress(raw, size, compressed);
+	bool guard_intact;
+
+	// Every truncation.
+	for (size_t n = 0; n < compressed_size; ++n) {
+		REQUIRE(!s_lz4_decompress_guarded(compressed, n, size, NULL, &guard_intact));
+		REQUIRE(guard_intact);
+	}
+
+	// Output buffers that are too small or too large.
+	REQUIRE(!s_lz4_decompress_guarded(compressed, compressed_size, size - 1, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+	REQUIRE(!s_lz4_decompress_guarded(compressed, compressed_size, size / 2, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+	REQUIRE(!s_lz4_decompress_guarded(compressed, compressed_size, size + 1, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Zero offset.
+	uint8_t zero_offset[] = { 0x10, 'a', 0x00, 0x00, 0x00 };
+	REQUIRE(!s_lz4_decompress_guarded(zero_offset, sizeof(zero_offset), 5, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Offset reaching back before the start of the output.
+	uint8_t far_offset[] = { 0x10, 'a', 0x02, 0x00, 0x00 };
+	REQUIRE(!s_lz4_decompress_guarded(far_offset, sizeof(far_offset), 5, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Literal length running past the end of the input.
+	uint8_t long_literals[] = { 0xF0, 0x40, 'a', 'b' };
+	REQUIRE(!s_lz4_decompress_guarded(long_literals, sizeof(long_literals), 100, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Extended length bytes cut off.
+	uint8_t cut_length[] = { 0xF0, 0xFF, 0xFF };
+	REQUIRE(!s_lz4_decompress_guarded(cut_length, sizeof(cut_length), 1000, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Match length running past the end of the output.
+	uint8_t long_match[] = { 0x1F, 'a', 0x01, 0x00, 0xFF, 0x00, 0x00 };
+	REQUIRE(!s_lz4_decompress_guarded(long_match, sizeof(long_match), 16, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Missing offset after literals that don't end the block.
+	uint8_t cut_offset[] = { 0x10, 'a', 0x01 };
+	REQUIRE(!s_lz4_decompress_guarded(cut_offset, sizeof(cut_offset), 5, NULL, &guard_intact));
+	REQUIRE(guard_intact);
+
+	// Random byte flips may happen to decode, but must never write past the output.
+	uint32_t seed = 1;
+	uint8_t corrupt[sizeof(compressed)];
+	for (int i = 0; i < 2000; ++i) {
+		CF_MEMCPY(corrupt, compressed, compressed_size);
+		for (int j = 0; j < 3; ++j) {
+			seed = seed * 1664525u + 1013904223u;
+			corrupt[(seed >> 8) % compressed_size] ^= (uint8_t)(seed >> 24) | 1;
+		}
+		s_lz4_decompress_guarded(corrupt, compressed_size, size, NULL, &guard_intact);
+		REQUIRE(guard_intact);
+	}
+
+	return true;
+}
+
+TEST_SUITE(test_lz4)
+{
+	RUN_TEST_CASE(test_lz4_round_trip);
+	RUN_TEST_CASE(test_lz4_corrupt);
+}
@@ -0,0 +1,54 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_math.h>
+#include <cute_rnd.h>
+using namespace Cute;
+
+static bool s_near(v2 a, v2 b)
+{
+	return cf_abs(a.x - b.x) < 1.0e-4f && cf_abs(a.y - b.y) < 1.0e-4f;
+}
+
+/* The batched transforms match transforming one at a time, odd counts and in-place included. */
+TEST_CASE(test_math_transform_batch)
+{
+	CF_RndState rnd = cf_rnd_seed(7);
+	M3x2 m = make_transform(V2(3, -2), V2(2, 0.5f), 0.7f);
+
+	v2 in[7];
+	v2 out[7];
+	for (int i = 0; i < 7; ++i) in[i] = V2(cf_rnd_range_float(&rnd, -100, 100), cf_rnd_range_float(&rnd, -100, 100));
+	mul_batch(m, in, out, 7);
+	for (int i = 0; i < 7; ++i) {
+		REQUIRE(s_near(out[i], mul(m, in[i])));
+	}
+	mul_batch(m, in, in, 7);
+	for (int i = 0; i < 7; ++i) {
+		REQUIRE(s_near(in[i], out[i]));
+	}
+
+	M3x2 mats[3];
+	M3x2 composed[3];
+	for (int i = 0; i < 3; ++i) mats[i] = make_transform(V2((float)i, 1), V2(1, (float)i + 1), (float)i);
+	mul_batch(m, mats, composed, 3);
+	for (int i = 0; i < 3; ++i) {
+		M3x2 expected = mul(m, mats[i]);
+		REQUIRE(s_near(composed[i].m.x, expected.m.x));
+		REQUIRE(s_near(composed[i].m.y, expected.m.y));
+		REQUIRE(s_near(composed[i].p, expected.p));
+	}
+
+	return true;
+}
+
+TEST_SUITE(test_math)
+{
+	RUN_TEST_CASE(test_math_transform_batch);
+}
@@ -0,0 +1,93 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_alloc.h>
+#include <cute_math.h>
+#include <cute_noise.h>
+using namespace Cute;
+
+/* Batched fills match sampling the noise one point at a time, with or without a threadpool. */
+TEST_CASE(test_noise_fill)
+{
+	CF_Noise noise = cf_make_noise_fbm(7, 3.0f, 2.0f, 4, 0.5f);
+	int w = 47, h = 47;
+	float* values = (float*)cf_alloc(sizeof(float) * w * h);
+	float* pooled = (float*)cf_alloc(sizeof(float) * w * h);
+
+	cf_noise_fill(noise, values, w, h, -13.5f, 100.25f, 0.37f, NULL);
+	for (int y = 0; y < h; ++y) {
+		for (int x = 0; x < w; ++x) {
+			float expected = cf_noise2(noise, -13.5f + x * 0.37f, 100.25f + y * 0.37f);
+			REQUIRE(cf_abs(values[y * w + x] - expected) < 1.0e-4f);
+		}
+	}
+	CF_Threadpool* pool = cf_make_threadpool(3);
+	cf_noise_fill(noise, pooled, w, h, -13.5f, 100.25f, 0.37f, pool);
+	REQUIRE(!CF_MEMCMP(values, pooled, sizeof(float) * w * h));
+
+	// The wrapped fill tiles seamlessly, so across the seam neighbors are as close as anywhere else.
+	cf_noise_fill_wrapped(noise, values, w, h, 1.5f, 0.25f, 0.1f, pool);
+	cf_noise_fill_wrapped(noise, pooled, w, h, 1.5f, 0.25f, 0.1f, NULL);
+	REQUIRE(!CF_MEMCMP(values, pooled, sizeof(float) * w * h));
+	float max_step = 0;
+	for (int y = 0; y < h; ++y) {
+		for (int x = 1; x < w; ++x) {
+			max_step = cf_max(max_step, cf_abs(values[y * w + x] - values[y * w + x - 1]));
+		}
+	}
+	for (int y = 0; y < h; ++y) {
+		REQUIRE(cf_abs(values[y * w] - values[y * w + w - 1]) <= max_step);
+	}
+
+	cf_destroy_threadpool(pool);
+	cf_free(values);
+	cf_free(pooled);
+	cf_destroy_noise(noise);
+	return true;
+}
+
+/* Cached tiles match the noise at grid points, interpolate seamlessly across tiles, and survive eviction. */
+TEST_CASE(test_noise_cache)
+{
+	CF_Noise noise = cf_make_noise_fbm(3, 1.0f, 2.0f, 3, 0.5f);
+	CF_Threadpool* pool = cf_make_threadpool(2);
+	float step = 0.125f;
+	CF_NoiseCache cache = cf_make_noise_cache(noise, 8, step, 4, pool);
+
+	for (int y = -20; y < 20; ++y) {
+		for (int x = -20; x < 20; ++x) {
+			REQUIRE(cf_abs(cf_noise_cache_sample(cache, x * step, y * step) - cf_noise2(noise, x * step, y * step)) < 1.0e-4f);
+		}
+	}
+
+	// Between grid points the value is interpolated, including across the edge of a tile.
+	float a = cf_noise2(noise, 7 * step, 0);
+	float b = cf_noise2(noise, 8 * step, 0);
+	REQUIRE(cf_abs(cf_noise_cache_sample(cache, 7.5f * step, 0) - (a + b) * 0.5f) < 1.0e-4f);
+	const float* left = cf_noise_cache_get_tile(cache, -1, 2);
+	float edge = left[8];
+	const float* right = cf_noise_cache_get_tile(cache, 0, 2);
+	REQUIRE(cf_abs(edge - right[0]) < 1.0e-5f);
+
+	// Prefetching on the pool fills the same values.
+	cf_noise_cache_prefetch(cache, 100.0f, -50.0f, 1.0f);
+	REQUIRE(cf_abs(cf_noise_cache_sample(cache, 100.0f, -50.0f) - cf_noise2(noise, 100.0f, -50.0f)) < 1.0e-4f);
+	cf_noise_cache_prefetch(cache, -30.0f, 30.0f, 1.0f);
+	cf_destroy_noise_cache(cache);
+
+	cf_destroy_threadpool(pool);
+	cf_destroy_noise(noise);
+	return true;
+}
+
+TEST_SUITE(test_noise)
+{
+	RUN_TEST_CASE(test_noise_fill);
+	RUN_TEST_CASE(test_noise_cache);
+}
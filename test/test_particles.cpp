@@ -0,0 +1,82 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_particles.h>
+#include <internal/cute_particles_internal.h>
+using namespace Cute;
+
+/* Particles spawn at the emitter's rate up to capacity, and expire after their lifetime. */
+TEST_CASE(test_particles_lifetime)
+{
+	ParticleParams params = particle_params_defaults();
+	params.capacity = 50;
+	params.rate = 100;
+	params.lifetime_min = 1.0f;
+	params.lifetime_max = 1.0f;
+	ParticleEmitter emitter = make_particle_emitter(params);
+
+	particle_emitter_update(emitter, 0.1f);
+	REQUIRE(particle_emitter_count(emitter) == 10);
+	particle_emitter_update(emitter, 0.4f);
+	REQUIRE(particle_emitter_count(emitter) == 50);
+
+	// Stop emitting, and everything expires once the lifetime has passed.
+	particle_emitter_set_emitting(emitter, false);
+	particle_emitter_update(emitter, 0.45f);
+	REQUIRE(particle_emitter_count(emitter) == 50);
+	particle_emitter_update(emitter, 0.6f);
+	REQUIRE(particle_emitter_count(emitter) == 0);
+
+	particle_emitter_burst(emitter, 1000);
+	REQUIRE(particle_emitter_count(emitter) == 50);
+
+	destroy_particle_emitter(emitter);
+	return true;
+}
+
+/* The batched integration matches stepping a single particle by hand, odd counts included. */
+TEST_CASE(test_particles_motion)
+{
+	ParticleParams params = particle_params_defaults();
+	params.rate = 0;
+	params.angle = 0;
+	params.spread = 0;
+	params.speed_min = params.speed_max = 10.0f;
+	params.gravity = V2(0, -20.0f);
+	params.drag = 0.5f;
+	params.lifetime_min = params.lifetime_max = 100.0f;
+	ParticleEmitter emitter = make_particle_emitter(params);
+	particle_emitter_set_position(emitter, V2(3, 4));
+	particle_emitter_burst(emitter, 7);
+
+	float x = 3, y = 4, vx = 10, vy = 0;
+	for (int i = 0; i < 10; ++i) {
+		particle_emitter_update(emitter, 0.1f);
+		vx = vx * (1.0f - 0.5f * 0.1f);
+		vy = vy * (1.0f - 0.5f * 0.1f) - 20.0f * 0.1f;
+		x += vx * 0.1f;
+		y += vy * 0.1f;
+	}
+	CF_ParticleEmitterInternal* e = cf_particle_emitter_internal(emitter);
+	REQUIRE(e->count == 7);
+	for (int i = 0; i < e->count; ++i) {
+		REQUIRE(cf_abs(e->px[i] - x) < 1.0e-3f);
+		REQUIRE(cf_abs(e->py[i] - y) < 1.0e-3f);
+		REQUIRE(cf_abs(e->age[i] - 1.0f) < 1.0e-4f);
+	}
+
+	destroy_particle_emitter(emitter);
+	return true;
+}
+
+TEST_SUITE(test_particles)
+{
+	RUN_TEST_CASE(test_particles_lifetime);
+	RUN_TEST_CASE(test_particles_motion);
+}
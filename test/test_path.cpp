@@ -192,7 +192,34 @@ TEST_CASE(test_path_c)
 	return true;
 }
 
+/* The non-allocating path views point right back into the path. */
+TEST_CASE(test_path_views)
+{
+	const char* path = "../root/file.txt";
+	REQUIRE(spfname_view(path) == path + 8);
+	REQUIRE(spext_view(path) == path + 12);
+	REQUIRE(sequ(spext_view(path), ".txt"));
+
+	int len = 0;
+	const char* s = spfname_no_ext_view(path, &len);
+	REQUIRE(s == path + 8);
+	REQUIRE(len == 4);
+	REQUIRE(sintern_range(s, s + len) == sintern("file"));
+
+	s = spfname_no_ext_view("file", &len);
+	REQUIRE(sequ(s, "file"));
+	REQUIRE(len == 4);
+
+	REQUIRE(spfname_view("/root/") == NULL);
+	REQUIRE(spfname_no_ext_view("/.txt", &len) == NULL);
+	REQUIRE(spext_view("file") == NULL);
+	REQUIRE(spext_view("file.") == NULL);
+
+	return true;
+}
+
 TEST_SUITE(test_path)
 {
 	RUN_TEST_CASE(test_path_c);
+	RUN_TEST_CASE(test_path_views);
 }
@@ -0,0 +1,119 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute.h>
+using namespace Cute;
+
+static Body s_make_ground(PhysicsWorld world)
+{
+	Aabb box = make_aabb(V2(-400, -10), V2(400, 10));
+	BodyParams params;
+	params.shape = &box;
+	params.shape_type = CF_SHAPE_TYPE_AABB;
+	return make_body(world, &params);
+}
+
+static Body s_make_box(PhysicsWorld world, v2 position, float angle = 0)
+{
+	Aabb box = make_aabb(V2(-10, -10), V2(10, 10));
+	BodyParams params;
+	params.type = CF_BODY_TYPE_DYNAMIC;
+	params.position = position;
+	params.angle = angle;
+	params.shape = &box;
+	params.shape_type = CF_SHAPE_TYPE_AABB;
+	return make_body(world, &params);
+}
+
+/* A dropped ball comes to rest on the ground and then falls asleep. */
+TEST_CASE(test_physics_rest_and_sleep)
+{
+	PhysicsWorld world = make_physics_world();
+	s_make_ground(world);
+	Circle circle = make_circle(V2(0, 0), 8);
+	BodyParams params;
+	params.type = CF_BODY_TYPE_DYNAMIC;
+	params.position = V2(0, 100);
+	params.shape = &circle;
+	params.shape_type = CF_SHAPE_TYPE_CIRCLE;
+	Body ball = make_body(world, &params);
+	REQUIRE(body_get_mass(ball) > 0);
+
+	for (int i = 0; i < 300; ++i) physics_world_step(world, 1.0f / 60.0f);
+	float y = body_get_position(ball).y;
+	REQUIRE(y > 17.0f && y < 18.5f);
+	REQUIRE(!body_is_awake(ball));
+	REQUIRE(physics_world_awake_body_count(world) == 0);
+	REQUIRE(physics_world_contact_count(world) == 1);
+
+	// Pushing it wakes it back up.
+	body_apply_impulse(ball, V2(1000, 0), body_get_position(ball));
+	REQUIRE(body_is_awake(ball));
+	physics_world_step(world, 1.0f / 60.0f);
+	REQUIRE(body_get_velocity(ball).x > 0);
+
+	destroy_physics_world(world);
+	return true;
+}
+
+/* A tilted box tips over and rests flat on one of its sides. */
+TEST_CASE(test_physics_tilted_box)
+{
+	PhysicsWorld world = make_physics_world();
+	s_make_ground(world);
+	Body box = s_make_box(world, V2(0, 60), 0.6f);
+	for (int i = 0; i < 600; ++i) physics_world_step(world, 1.0f / 60.0f);
+	REQUIRE(CF_FABSF(body_get_position(box).y - 20.0f) < 1.0f);
+	REQUIRE(CF_FMODF(CF_FABSF(body_get_angle(box)), CF_PI * 0.5f) < 0.01f);
+	destroy_physics_world(world);
+	return true;
+}
+
+static uint64_t s_simulate_piles(CF_Threadpool* pool)
+{
+	PhysicsWorldParams params;
+	params.pool = pool;
+	PhysicsWorld world = make_physics_world(&params);
+	s_make_ground(world);
+	Array<Body> boxes;
+	for (int pile = 0; pile < 8; ++pile) {
+		for (int i = 0; i < 6; ++i) {
+			boxes.add(s_make_box(world, V2(-350.0f + pile * 90.0f + (i & 1) * 3.0f, 20.0f + i * 21.0f)));
+		}
+	}
+	for (int i = 0; i < 120; ++i) physics_world_step(world, 1.0f / 60.0f);
+	uint64_t hash = 14695981039346656037ULL;
+	for (int i = 0; i < boxes.count(); ++i) {
+		Transform xf = body_get_transform(boxes[i]);
+		const unsigned char* bytes = (const unsigned char*)&xf;
+		for (int j = 0; j < (int)sizeof(xf); ++j) hash = (hash ^ bytes[j]) * 1099511628211ULL;
+	}
+	destroy_physics_world(world);
+	return hash;
+}
+
+/* Solving islands across threads gives bit-identical results to solving them on one thread. */
+TEST_CASE(test_physics_deterministic)
+{
+	CF_Threadpool* pool = cf_make_threadpool(3);
+	uint64_t a = s_simulate_piles(NULL);
+	uint64_t b = s_simulate_piles(pool);
+	uint64_t c = s_simulate_piles(pool);
+	REQUIRE(a == b);
+	REQUIRE(b == c);
+	cf_destroy_threadpool(pool);
+	return true;
+}
+
+TEST_SUITE(test_physics)
+{
+	RUN_TEST_CASE(test_physics_rest_and_sleep);
+	RUN_TEST_CASE(test_physics_tilted_box);
+	RUN_TEST_CASE(test_physics_deterministic);
+}
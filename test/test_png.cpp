@@ -0,0 +1,229 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+#include <cute_image.h>
+
+#include "white_pixel.h"
+#include "black_pixel.h"
+
+// A second copy of the decoder with the SIMD paths compiled out, as the scalar reference. The library's own copy
+// is reached through `cf_image_load_png_from_memory` and friends. The standard headers the implementation pulls
+// in are included up front so they aren't declared within the namespace.
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <assert.h>
+#ifdef _WIN32
+#	include <malloc.h>
+#else
+#	include <alloca.h>
+#endif
+#undef CUTE_PNG_H
+namespace cp_scalar
+{
+#define CUTE_PNG_NO_SIMD
+#define CUTE_PNG_IMPLEMENTATION
+#include <cute/cute_png.h>
+}
+
+using namespace Cute;
+
+static void s_put32(Array<uint8_t>* out, uint32_t v)
+{
+	out->add((uint8_t)(v >> 24));
+	out->add((uint8_t)(v >> 16));
+	out->add((uint8_t)(v >> 8));
+	out->add((uint8_t)v);
+}
+
+static uint32_t s_crc32(const uint8_t* data, int size)
+{
+	uint32_t crc = ~0u;
+	for (int i = 0; i < size; ++i) {
+		crc ^= data[i];
+		for (int j = 0; j < 8; ++j) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+	}
+	return ~crc;
+}
+
+static void s_put_chunk(Array<uint8_t>* out, const char* type, const uint8_t* data, int size)
+{
+	s_put32(out, (uint32_t)size);
+	int start = out->count();
+	for (int i = 0; i < 4; ++i) out->add((uint8_t)type[i]);
+	for (int i = 0; i < size; ++i) out->add(data[i]);
+	s_put32(out, s_crc32(out->data() + start, size + 4));
+}
+
+static uint8_t s_paeth(int a, int b, int c)
+{
+	int p = a + b - c;
+	int pa = p > a ? p - a : a - p;
+	int pb = p > b ? p - b : b - p;
+	int pc = p > c ? p - c : c - p;
+	if (pa <= pb && pa <= pc) return (uint8_t)a;
+	if (pb <= pc) return (uint8_t)b;
+	return (uint8_t)c;
+}
+
+// Encodes `raw` as a png, filtering row y with filter type `y % 5` so every filter shows up, including Paeth right
+// after a row filtered with something else. The zlib stream is made of stored blocks, so no compressor is needed.
+static void s_make_png(Array<uint8_t>* png, int w, int h, int color_type, int bpp, const uint8_t* raw, const uint8_t* plte, int plte_size, const uint8_t* trns, int trns_size)
+{
+	int stride = w * bpp;
+	Array<uint8_t> filtered;
+	for (int y = 0; y < h; ++y) {
+		const uint8_t* row = raw + y * stride;
+		const uint8_t* prev = y ? row - stride : NULL;
+		int filter = y % 5;
+		filtered.add((uint8_t)filter);
+		for (int x = 0; x < stride; ++x) {
+			int a = x >= bpp ? row[x - bpp] : 0;
+			int b = prev ? prev[x] : 0;
+			int c = prev && x >= bpp ? prev[x - bpp] : 0;
+			int predictor = 0;
+			switch (filter) {
+			case 1: predictor = a; break;
+			case 2: predictor = b; break;
+			case 3: predictor = (a + b) / 2; break;
+			case 4: predictor = s_paeth(a, b, c); break;
+			}
+			filtered.add((uint8_t)(row[x] - predictor));
+		}
+	}
+
+	Array<uint8_t> zlib;
+	zlib.add(0x78);
+	zlib.add(0x01);
+	int offset = 0;
+	do {
+		int size = min(filtered.count() - offset, 65535);
+		zlib.add(offset + size == filtered.count() ? 1 : 0);
+		zlib.add((uint8_t)size);
+		zlib.add((uint8_t)(size >> 8));
+		zlib.add((uint8_t)~size);
+		zlib.add((uint8_t)(~size >> 8));
+		for (int i = 0; i < size; ++i) zlib.add(filtered[offset + i]);
+		offset += size;
+	} while (offset < filtered.count());
+	uint32_t s1 = 1, s2 = 0;
+	for (int i = 0; i < filtered.count(); ++i) {
+		s1 = (s1 + filtered[i]) % 65521;
+		s2 = (s2 + s1) % 65521;
+	}
+	s_put32(&zlib, (s2 << 16) | s1);
+
+	png->clear();
+	const uint8_t sig[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	for (int i = 0; i < 8; ++i) png->add(sig[i]);
+	uint8_t ihdr[13] = { (uint8_t)(w >> 24), (uint8_t)(w >> 16), (uint8_t)(w >> 8), (uint8_t)w, (uint8_t)(h >> 24), (uint8_t)(h >> 16), (uint8_t)(h >> 8), (uint8_t)h, 8, (uint8_t)color_type, 0, 0, 0 };
+	s_put_chunk(png, "IHDR", ihdr, sizeof(ihdr));
+	if (plte) s_put_chunk(png, "PLTE", plte, plte_size);
+	if (trns) s_put_chunk(png, "tRNS", trns, trns_size);
+	s_put_chunk(png, "IDAT", zlib.data(), zlib.count());
+	s_put_chunk(png, "IEND", NULL, 0);
+}
+
+// Decodes with the library (SIMD where available) and the scalar copy, plain and premultiplied, and checks that all
+// of them agree with each other, with `expected`, and with `cf_image_premultiply`.
+static bool s_check_decode(const uint8_t* png, int size, const CF_Pixel* expected)
+{
+	CF_Image img;
+	REQUIRE(!cf_is_error(cf_image_load_png_from_memory(png, size, &img)));
+	cp_scalar::cp_image_t scalar = cp_scalar::cp_load_png_mem(png, size);
+	REQUIRE(scalar.pix);
+	REQUIRE(scalar.w == img.w && scalar.h == img.h);
+	int bytes = img.w * img.h * (int)sizeof(CF_Pixel);
+	REQUIRE(!CF_MEMCMP(img.pix, scalar.pix, bytes));
+	if (expected) REQUIRE(!CF_MEMCMP(img.pix, expected, bytes));
+
+	CF_Image premultiplied;
+	REQUIRE(!cf_is_error(cf_image_load_png_from_memory_premultiplied(png, size, &premultiplied)));
+	cp_scalar::cp_image_t scalar_premultiplied = cp_scalar::cp_load_png_mem_premultiplied(png, size);
+	REQUIRE(scalar_premultiplied.pix);
+	cf_image_premultiply(&img);
+	REQUIRE(!CF_MEMCMP(premultiplied.pix, img.pix, bytes));
+	REQUIRE(!CF_MEMCMP(scalar_premultiplied.pix, img.pix, bytes));
+
+	cp_scalar::cp_free_png(&scalar_premultiplied);
+	cf_image_free(&premultiplied);
+	cp_scalar::cp_free_png(&scalar);
+	cf_image_free(&img);
+	return true;
+}
+
+/* The repo's test images decode the same through the SIMD and scalar paths. */
+TEST_CASE(test_png_test_images)
+{
+	REQUIRE(s_check_decode(white_pixel_data, white_pixel_sz, NULL));
+	REQUIRE(s_check_decode(black_pixel_data, black_pixel_sz, NULL));
+	return true;
+}
+
+/* Every color type and filter, at widths around the SIMD chunk sizes, matches the source pixels on every path. */
+TEST_CASE(test_png_filters)
+{
+	int widths[] = { 1, 3, 4, 5, 17, 33, 64 };
+	const int h = 11;
+	uint32_t seed = 1;
+	for (int i = 0; i < (int)CF_ARRAY_SIZE(widths); ++i) {
+		int w = widths[i];
+		Array<uint8_t> raw;
+		raw.ensure_count(w * h * 4);
+		for (int j = 0; j < raw.count(); ++j) {
+			seed = seed * 1664525u + 1013904223u;
+			// Smooth gradients mixed with noise give the predictors something to do.
+			raw[j] = (seed >> 29) ? (uint8_t)(j * 3 + (j / (w * 4)) * 7) : (uint8_t)(seed >> 16);
+		}
+		Array<CF_Pixel> expected;
+		expected.ensure_count(w * h);
+
+		// RGBA.
+		for (int p = 0; p < w * h; ++p) expected[p] = { raw[p * 4], raw[p * 4 + 1], raw[p * 4 + 2], raw[p * 4 + 3] };
+		Array<uint8_t> png;
+		s_make_png(&png, w, h, 6, 4, raw.data(), NULL, 0, NULL, 0);
+		REQUIRE(s_check_decode(png.data(), png.count(), expected.data()));
+
+		// RGB.
+		for (int p = 0; p < w * h; ++p) expected[p] = { raw[p * 3], raw[p * 3 + 1], raw[p * 3 + 2], 255 };
+		s_make_png(&png, w, h, 2, 3, raw.data(), NULL, 0, NULL, 0);
+		REQUIRE(s_check_decode(png.data(), png.count(), expected.data()));
+
+		// Greyscale with alpha.
+		for (int p = 0; p < w * h; ++p) expected[p] = { raw[p * 2], raw[p * 2], raw[p * 2], raw[p * 2 + 1] };
+		s_make_png(&png, w, h, 4, 2, raw.data(), NULL, 0, NULL, 0);
+		REQUIRE(s_check_decode(png.data(), png.count(), expected.data()));
+
+		// Greyscale.
+		for (int p = 0; p < w * h; ++p) expected[p] = { raw[p], raw[p], raw[p], 255 };
+		s_make_png(&png, w, h, 0, 1, raw.data(), NULL, 0, NULL, 0);
+		REQUIRE(s_check_decode(png.data(), png.count(), expected.data()));
+
+		// Paletted, with a tRNS chunk shorter than the palette so later entries are opaque.
+		uint8_t plte[256 * 3];
+		uint8_t trns[100];
+		for (int c = 0; c < 256 * 3; ++c) plte[c] = (uint8_t)(c * 5 + 1);
+		for (int c = 0; c < 100; ++c) trns[c] = (uint8_t)(c * 37);
+		for (int p = 0; p < w * h; ++p) {
+			int c = raw[p];
+			expected[p] = { plte[c * 3], plte[c * 3 + 1], plte[c * 3 + 2], c < 100 ? trns[c] : (uint8_t)255 };
+		}
+		s_make_png(&png, w, h, 3, 1, raw.data(), plte, sizeof(plte), trns, sizeof(trns));
+		REQUIRE(s_check_decode(png.data(), png.count(), expected.data()));
+	}
+	return true;
+}
+
+TEST_SUITE(test_png)
+{
+	RUN_TEST_CASE(test_png_test_images);
+	RUN_TEST_CASE(test_png_filters);
+}
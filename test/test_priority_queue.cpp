@@ -0,0 +1,307 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute.h>
+#include <cute_a_star.h>
+#include <cute_priority_queue.h>
+using namespace Cute;
+
+/* Values come out in cost order, for both min and max queues. */
+TEST_CASE(test_priority_queue_order)
+{
+	PriorityQueue<int> q;
+	q.reserve(1000);
+	for (int i = 0; i < 1000; ++i) {
+		int v = (i * 7919) % 1000;
+		q.push_min(v, (float)v);
+	}
+	for (int i = 0; i < 1000; ++i) {
+		int v;
+		float cost;
+		REQUIRE(q.pop_min(&v, &cost));
+		REQUIRE(v == i);
+		REQUIRE(cost == (float)i);
+	}
+	REQUIRE(!q.pop_min());
+
+	for (int i = 0; i < 100; ++i) {
+		q.push_max(i, (float)((i * 37) % 100));
+	}
+	float last = 1000.0f;
+	for (int i = 0; i < 100; ++i) {
+		float cost;
+		REQUIRE(q.pop_max(NULL, &cost));
+		REQUIRE(cost < last);
+		last = cost;
+	}
+
+	return true;
+}
+
+/* Pushing a queued ID again lowers its cost rather than adding a duplicate. */
+TEST_CASE(test_priority_queue_decrease_key)
+{
+	IndexedPriorityQueue q;
+	q.reserve(500);
+	for (int i = 0; i < 500; ++i) {
+		q.push_or_decrease(i, 1000.0f + (float)((i * 131) % 500));
+	}
+	REQUIRE(q.count() == 500);
+	for (int i = 0; i < 500; i += 2) {
+		q.push_or_decrease(i, (float)(500 - i));
+	}
+	// Raising a cost is ignored.
+	q.push_or_decrease(1, 5000.0f);
+	REQUIRE(q.count() == 500);
+	REQUIRE(q.contains(1));
+	REQUIRE(q.cost(1) < 5000.0f);
+
+	float last = -1.0f;
+	for (int i = 0; i < 500; ++i) {
+		int id;
+		float cost;
+		REQUIRE(q.pop_min(&id, &cost));
+		REQUIRE(cost >= last);
+		REQUIRE(!q.contains(id));
+		if (i < 250) REQUIRE(id % 2 == 0);
+		last = cost;
+	}
+	REQUIRE(!q.pop_min());
+
+	q.push_or_decrease(7, 1.0f);
+	q.clear();
+	REQUIRE(!q.contains(7));
+	REQUIRE(q.count() == 0);
+
+	return true;
+}
+
+/* A* finds the shortest way around a wall. */
+TEST_CASE(test_a_star)
+{
+	const int w = 20, h = 20;
+	float costs[w * h];
+	for (int i = 0; i < w * h; ++i) costs[i] = 1.0f;
+	// A wall down the middle with a gap at the bottom.
+	for (int y = 0; y < h - 1; ++y) costs[y * w + 10] = 0;
+
+	CF_AStarGrid grid = cf_make_a_star_grid(w, h, costs);
+	CF_AStarOutput out;
+	REQUIRE(cf_a_star(grid, 0, 0, 19, 0, false, &out));
+	// 19 steps down to the gap, 19 across, and 19 back up.
+	REQUIRE(out.count == 57);
+	REQUIRE(out.x[out.count - 1] == 19 && out.y[out.count - 1] == 0);
+	for (int i = 0; i < out.count; ++i) {
+		REQUIRE(costs[out.y[i] * w + out.x[i]] > 0);
+	}
+	cf_free_a_star_output(&out);
+
+	// Closing the gap leaves no path at all.
+	costs[(h - 1) * w + 10] = 0;
+	REQUIRE(!cf_a_star(grid, 0, 0, 19, 0, true, &out));
+	cf_destroy_a_star_grid(grid);
+
+	return true;
+}
+
+/* The hierarchy finds valid paths close to optimal, and the path cache forgets paths through blocked cells. */
+TEST_CASE(test_a_star_hierarchy)
+{
+	const int w = 64, h = 64;
+	static float costs[w * h];
+	for (int i = 0; i < w * h; ++i) costs[i] = 1.0f;
+	// Walls every 8 columns, each with a single gap that alternates between top and bottom.
+	for (int x = 8; x < w; x += 8) {
+		int gap = (x / 8) % 2 ? h - 2 : 1;
+		for (int y = 0; y < h; ++y) if (y != gap) costs[y * w + x] = 0;
+	}
+
+	CF_AStarGrid exact = cf_make_a_star_grid(w, h, costs);
+	CF_AStarGrid grid = cf_make_a_star_grid(w, h, costs);
+	cf_a_star_grid_enable_hierarchy(grid, 8);
+	cf_a_star_grid_enable_path_cache(grid, 16);
+
+	CF_AStarOutput a, b;
+	REQUIRE(cf_a_star(exact, 0, 0, 63, 63, false, &a));
+	REQUIRE(cf_a_star(grid, 0, 0, 63, 63, false, &b));
+	// Like the exact search, the path leaves out the start cell.
+	REQUIRE(b.x[0] + b.y[0] == 1);
+	REQUIRE(b.x[b.count - 1] == 63 && b.y[b.count - 1] == 63);
+	for (int i = 0; i < b.count; ++i) {
+		REQUIRE(costs[b.y[i] * w + b.x[i]] > 0);
+		if (i) REQUIRE(cf_abs_int(b.x[i] - b.x[i - 1]) + cf_abs_int(b.y[i] - b.y[i - 1]) == 1);
+	}
+	REQUIRE(b.count <= a.count + a.count / 10);
+
+	// A second query comes from the cache and matches.
+	CF_AStarOutput c;
+	REQUIRE(cf_a_star(grid, 0, 0, 63, 63, false, &c));
+	REQUIRE(c.count == b.count);
+	for (int i = 0; i < c.count; ++i) REQUIRE(c.x[i] == b.x[i] && c.y[i] == b.y[i]);
+	cf_free_a_star_output(&c);
+
+	// Blocking a cell on the path forces a new route around it.
+	int mid = b.count / 2;
+	while (b.x[mid] % 8 == 0) ++mid;
+	int bx = b.x[mid], by = b.y[mid];
+	cf_a_star_grid_set_cost(grid, bx, by, 0);
+	REQUIRE(cf_a_star(grid, 0, 0, 63, 63, false, &c));
+	for (int i = 0; i < c.count; ++i) REQUIRE(!(c.x[i] == bx && c.y[i] == by));
+	cf_free_a_star_output(&c);
+
+	cf_free_a_star_output(&a);
+	cf_free_a_star_output(&b);
+	cf_destroy_a_star_grid(grid);
+	cf_destroy_a_star_grid(exact);
+
+	return true;
+}
+
+/* Batched queries match one query at a time, whether or not they're spread across threads. */
+TEST_CASE(test_a_star_batch)
+{
+	const int w = 48, h = 48;
+	static float costs[w * h];
+	for (int i = 0; i < w * h; ++i) costs[i] = (i * 7919) % 5 ? 1.0f : 0;
+	CF_AStarGrid grid = cf_make_a_star_grid(w, h, costs);
+
+	const int count = 40;
+	CF_AStarQuery queries[count];
+	for (int i = 0; i < count; ++i) {
+		queries[i].start_x = (i * 13) % w;
+		queries[i].start_y = (i * 29) % h;
+		queries[i].end_x = (i * 31 + 5) % w;
+		queries[i].end_y = (i * 17 + 3) % h;
+		queries[i].allow_diagonal_movement = i % 2;
+	}
+	// Start and end at the same cell.
+	queries[0].end_x = queries[0].start_x;
+	queries[0].end_y = queries[0].start_y;
+	costs[queries[0].start_y * w + queries[0].start_x] = 1.0f;
+
+	CF_Threadpool* pool = cf_make_threadpool(4);
+	CF_AStarOutput outs[count];
+	for (int run = 0; run < 2; ++run) {
+		int found = cf_a_star_batch(grid, queries, count, outs, run ? pool : NULL);
+		int expected_found = 0;
+		for (int i = 0; i < count; ++i) {
+			const CF_AStarQuery* q = queries + i;
+			CF_AStarOutput out;
+			bool path_found = cf_a_star(grid, q->start_x, q->start_y, q->end_x, q->end_y, q->allow_diagonal_movement, &out);
+			REQUIRE(path_found == (outs[i].count > 0));
+			if (!path_found) continue;
+			++expected_found;
+			REQUIRE(out.count == outs[i].count);
+			for (int j = 0; j < out.count; ++j) {
+				REQUIRE(out.x[j] == outs[i].x[j] && out.y[j] == outs[i].y[j]);
+			}
+			cf_free_a_star_output(&out);
+			cf_free_a_star_output(outs + i);
+		}
+		REQUIRE(found == expected_found);
+	}
+	cf_destroy_threadpool(pool);
+	cf_destroy_a_star_grid(grid);
+
+	return true;
+}
+
+/* Jump point search finds paths exactly as short as plain A*. */
+TEST_CASE(test_a_star_jump_points)
+{
+	const int w = 64, h = 64;
+	static float costs[w * h];
+	// Rooms with doorways.
+	for (int i = 0; i < w * h; ++i) {
+		int x = i % w, y = i / w;
+		costs[i] = (x % 16 == 0 && y % 16 > 2) || (y % 16 == 0 && x % 16 > 2) ? 0 : 1.0f;
+	}
+	CF_AStarGrid exact = cf_make_a_star_grid(w, h, costs);
+	CF_AStarGrid grid = cf_make_a_star_grid(w, h, costs);
+	cf_a_star_grid_enable_jump_points(grid, true);
+
+	for (int i = 0; i < 20; ++i) {
+		int sx = (i * 37 + 5) % w, sy = (i * 11 + 3) % h;
+		int ex = (i * 23 + 60) % w, ey = (i * 53 + 7) % h;
+		CF_AStarOutput a, b;
+		bool found = cf_a_star(exact, sx, sy, ex, ey, true, &a);
+		REQUIRE(found == cf_a_star(grid, sx, sy, ex, ey, true, &b));
+		if (!found) continue;
+		float cost_a = 0, cost_b = 0;
+		for (int j = 0; j < a.count; ++j) {
+			int px = j ? a.x[j - 1] : sx, py = j ? a.y[j - 1] : sy;
+			cost_a += px != a.x[j] && py != a.y[j] ? 1.4142135f : 1.0f;
+		}
+		for (int j = 0; j < b.count; ++j) {
+			int px = j ? b.x[j - 1] : sx, py = j ? b.y[j - 1] : sy;
+			REQUIRE(cf_abs_int(b.x[j] - px) <= 1 && cf_abs_int(b.y[j] - py) <= 1);
+			REQUIRE(costs[b.y[j] * w + b.x[j]] > 0);
+			cost_b += px != b.x[j] && py != b.y[j] ? 1.4142135f : 1.0f;
+		}
+		REQUIRE(b.x[b.count - 1] == ex && b.y[b.count - 1] == ey);
+		REQUIRE(cf_abs(cost_a - cost_b) < 1.0e-3f);
+		cf_free_a_star_output(&a);
+		cf_free_a_star_output(&b);
+	}
+
+	cf_destroy_a_star_grid(grid);
+	cf_destroy_a_star_grid(exact);
+
+	return true;
+}
+
+/* Following a flow field from any cell reaches the goal, as cheaply as A* would. */
+TEST_CASE(test_a_star_flow_field)
+{
+	const int w = 20, h = 20;
+	float costs[w * h];
+	for (int i = 0; i < w * h; ++i) costs[i] = 1.0f;
+	// A wall down the middle with a gap at the bottom.
+	for (int y = 0; y < h - 1; ++y) costs[y * w + 10] = 0;
+
+	CF_AStarGrid grid = cf_make_a_star_grid(w, h, costs);
+	CF_AStarFlowField field = cf_make_a_star_flow_field(grid, 19, 0, false);
+	REQUIRE(cf_a_star_flow_field_cost(field, 19, 0) == 0);
+	REQUIRE(!cf_a_star_flow_field_next(field, 19, 0, NULL, NULL));
+	REQUIRE(cf_a_star_flow_field_cost(field, 0, 0) == 57.0f);
+	for (int i = 0; i < w * h; i += 7) {
+		int x = i % w, y = i / w;
+		CF_AStarOutput out;
+		REQUIRE(cf_a_star(grid, x, y, 19, 0, false, &out));
+		REQUIRE(cf_a_star_flow_field_cost(field, x, y) == (x == 19 && y == 0 ? 0 : (float)out.count));
+		int steps = 0;
+		while (cf_a_star_flow_field_next(field, x, y, &x, &y)) ++steps;
+		REQUIRE(x == 19 && y == 0);
+		REQUIRE(steps == (out.count == 1 && out.x[0] == 19 && out.y[0] == 0 ? 0 : out.count));
+		cf_free_a_star_output(&out);
+	}
+
+	// Closing the gap cuts off the left side.
+	cf_a_star_grid_set_cost(grid, 10, h - 1, 0);
+	cf_a_star_flow_field_update(field);
+	REQUIRE(cf_a_star_flow_field_cost(field, 0, 0) < 0);
+	REQUIRE(!cf_a_star_flow_field_next(field, 0, 0, NULL, NULL));
+	REQUIRE(cf_a_star_flow_field_cost(field, 15, 15) > 0);
+
+	cf_destroy_a_star_flow_field(field);
+	cf_destroy_a_star_grid(grid);
+
+	return true;
+}
+
+TEST_SUITE(test_priority_queue)
+{
+	RUN_TEST_CASE(test_priority_queue_order);
+	RUN_TEST_CASE(test_priority_queue_decrease_key);
+	RUN_TEST_CASE(test_a_star);
+	RUN_TEST_CASE(test_a_star_hierarchy);
+	RUN_TEST_CASE(test_a_star_batch);
+	RUN_TEST_CASE(test_a_star_jump_points);
+	RUN_TEST_CASE(test_a_star_flow_field);
+}
@@ -0,0 +1,102 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+#include "internal/cute_app_internal.h"
+
+#include <cute.h>
+#include <internal/cute_replay_internal.h>
+using namespace Cute;
+
+static int s_step;
+static bool s_matched;
+
+// Fakes the input gathered for step `i`, as if it came from the OS.
+static void s_fake_input(int i)
+{
+	CF_TICKS = (uint64_t)i * 1000;
+	CF_DELTA_TIME = 1.0f / 60.0f;
+	app->keys[CF_KEY_A] = (i / 10) & 1;
+	app->mouse.x = i / 4;
+	app->input_text.clear();
+	if (i % 100 == 0) app->input_text.add('a' + i / 100);
+}
+
+static void s_check_input(void* udata)
+{
+	CF_UNUSED(udata);
+	int i = s_step++;
+	bool match = CF_TICKS == (uint64_t)i * 1000 && CF_DELTA_TIME == 1.0f / 60.0f;
+	match = match && app->keys[CF_KEY_A] == ((i / 10) & 1) && app->mouse.x == i / 4;
+	match = match && app->input_text.count() == (i % 100 == 0 ? 1 : 0);
+	if (i % 100 == 0) match = match && app->input_text[0] == 'a' + i / 100;
+	s_matched = s_matched && match;
+}
+
+/* Recorded steps play back exactly, and take up little room. */
+TEST_CASE(test_replay_record_and_play)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+	Replay replay = make_replay();
+	replay_start_recording(replay);
+	for (int i = 0; i < 1000; ++i) {
+		s_fake_input(i);
+		cf_replay_capture(app->replay_recording);
+	}
+	replay_stop_recording();
+	REQUIRE(replay_step_count(replay) == 1000);
+	REQUIRE(replay_size(replay) < 1000 * 16);
+
+	s_step = 0;
+	s_matched = true;
+	while (replay_step(replay, s_check_input)) {}
+	REQUIRE(s_step == 1000);
+	REQUIRE(s_matched);
+
+	// Again from the start.
+	replay_rewind(replay);
+	s_step = 0;
+	REQUIRE(replay_step(replay, s_check_input));
+	REQUIRE(s_step == 1);
+	REQUIRE(s_matched);
+
+	destroy_replay(replay);
+	cf_destroy_app();
+	return true;
+}
+
+/* Once over budget the oldest steps are dropped, and playback starts from the oldest one left. */
+TEST_CASE(test_replay_budget)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+	Replay replay = make_replay(16 * 1024);
+	replay_start_recording(replay);
+	for (int i = 0; i < 5000; ++i) {
+		s_fake_input(i);
+		cf_replay_capture(app->replay_recording);
+	}
+	replay_stop_recording();
+	int count = replay_step_count(replay);
+	REQUIRE(count > 0 && count < 5000);
+	REQUIRE(replay_size(replay) <= 16 * 1024);
+
+	s_step = 5000 - count;
+	s_matched = true;
+	while (replay_step(replay, s_check_input)) {}
+	REQUIRE(s_step == 5000);
+	REQUIRE(s_matched);
+
+	destroy_replay(replay);
+	cf_destroy_app();
+	return true;
+}
+
+TEST_SUITE(test_replay)
+{
+	RUN_TEST_CASE(test_replay_record_and_play);
+	RUN_TEST_CASE(test_replay_budget);
+}
@@ -0,0 +1,252 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_replication.h>
+#include <cute_interest.h>
+using namespace Cute;
+
+static ReplicationConfig s_config(int entity_capacity, int field_count)
+{
+	ReplicationConfig config = replication_config_defaults();
+	config.entity_capacity = entity_capacity;
+	config.field_count = field_count;
+	config.client_capacity = 1;
+	return config;
+}
+
+// Sends one packet from the server to the client, optionally dropping the ack on the way back.
+static int s_exchange(ReplicationServer rs, ReplicationClient rc, bool deliver_ack = true)
+{
+	uint8_t packet[1100];
+	int size = replication_server_write(rs, 0, packet, sizeof(packet));
+	if (!size) return 0;
+	uint16_t ack;
+	if (replication_client_read(rc, packet, size, &ack) && deliver_ack) {
+		replication_server_ack(rs, 0, ack);
+	}
+	return size;
+}
+
+/* Entities reach the client, and once acked, unchanged entities aren't sent again. */
+TEST_CASE(test_replication_round_trip)
+{
+	ReplicationServer rs = make_replication_server(s_config(16, 3));
+	ReplicationClient rc = make_replication_client(s_config(16, 3));
+
+	for (int i = 0; i < 16; ++i) {
+		int32_t fields[3] = { i * 100, -i, 1000000 + i };
+		replication_server_set_entity(rs, i, fields);
+	}
+	REQUIRE(s_exchange(rs, rc) > 0);
+	for (int i = 0; i < 16; ++i) {
+		REQUIRE(replication_client_has_entity(rc, i));
+		const int32_t* fields = replication_client_get_entity(rc, i);
+		REQUIRE(fields[0] == i * 100 && fields[1] == -i && fields[2] == 1000000 + i);
+	}
+	REQUIRE(s_exchange(rs, rc) == 0);
+
+	destroy_replication_server(rs);
+	destroy_replication_client(rc);
+	return true;
+}
+
+/* Small changes are delta-encoded against the acked state, and removals reach the client. */
+TEST_CASE(test_replication_delta)
+{
+	ReplicationServer rs = make_replication_server(s_config(64, 4));
+	ReplicationClient rc = make_replication_client(s_config(64, 4));
+
+	int32_t fields[4] = { 123456789, -987654321, 55555555, 7 };
+	for (int i = 0; i < 64; ++i) {
+		replication_server_set_entity(rs, i, fields);
+	}
+	int full = s_exchange(rs, rc);
+
+	// One small field change per entity costs a fraction of the full state.
+	fields[3] = 8;
+	for (int i = 0; i < 64; ++i) {
+		replication_server_set_entity(rs, i, fields);
+	}
+	int delta = s_exchange(rs, rc);
+	REQUIRE(delta > 0 && delta * 3 < full);
+	REQUIRE(replication_client_get_entity(rc, 63)[3] == 8);
+	REQUIRE(replication_client_get_entity(rc, 63)[0] == 123456789);
+
+	replication_server_remove_entity(rs, 10);
+	REQUIRE(s_exchange(rs, rc) > 0);
+	REQUIRE(!replication_client_has_entity(rc, 10));
+	REQUIRE(replication_client_has_entity(rc, 11));
+	REQUIRE(s_exchange(rs, rc) == 0);
+
+	destroy_replication_server(rs);
+	destroy_replication_client(rc);
+	return true;
+}
+
+/* Lost acks keep changes flowing, and stale or forgotten baselines fall back to full state. */
+TEST_CASE(test_replication_lost_acks)
+{
+	ReplicationServer rs = make_replication_server(s_config(4, 2));
+	ReplicationClient rc = make_replication_client(s_config(4, 2));
+
+	int32_t fields[2] = { 1, 2 };
+	replication_server_set_entity(rs, 0, fields);
+	REQUIRE(s_exchange(rs, rc) > 0);
+	REQUIRE(replication_client_has_entity(rc, 0));
+
+	// Without acks changes keep flowing, and once the acked baseline ages out of the history they're sent in full.
+	for (int i = 0; i < 40; ++i) {
+		fields[0] = i;
+		replication_server_set_entity(rs, 0, fields);
+		REQUIRE(s_exchange(rs, rc, false) > 0);
+		REQUIRE(replication_client_get_entity(rc, 0)[0] == i);
+	}
+	REQUIRE(s_exchange(rs, rc) > 0);
+	REQUIRE(s_exchange(rs, rc) == 0);
+
+	// An out of order packet doesn't roll the client back.
+	uint8_t old_packet[64];
+	fields[0] = 100;
+	replication_server_set_entity(rs, 0, fields);
+	int old_size = replication_server_write(rs, 0, old_packet, sizeof(old_packet));
+	fields[0] = 200;
+	replication_server_set_entity(rs, 0, fields);
+	REQUIRE(s_exchange(rs, rc) > 0);
+	uint16_t ack;
+	REQUIRE(replication_client_read(rc, old_packet, old_size, &ack));
+	REQUIRE(replication_client_get_entity(rc, 0)[0] == 200);
+
+	// Garbage is rejected without touching state.
+	uint8_t garbage[3] = { 0xFF, 0xFF, 0xFF };
+	REQUIRE(!replication_client_read(rc, garbage, sizeof(garbage), &ack));
+	REQUIRE(replication_client_get_entity(rc, 0)[0] == 200);
+
+	destroy_replication_server(rs);
+	destroy_replication_client(rc);
+	return true;
+}
+
+/* Packets respect the size budget, and priority decides what goes first without starving anyone. */
+TEST_CASE(test_replication_priority)
+{
+	ReplicationServer rs = make_replication_server(s_config(100, 4));
+	ReplicationClient rc = make_replication_client(s_config(100, 4));
+
+	for (int i = 0; i < 100; ++i) {
+		int32_t fields[4] = { i * 1000000, i * 2000000, i * 3000000, i * 4000000 };
+		replication_server_set_entity(rs, i, fields);
+	}
+	replication_server_set_priority(rs, 0, 99, 10.0f);
+	replication_server_set_priority(rs, 0, 98, 0);
+
+	uint8_t packet[100];
+	int size = replication_server_write(rs, 0, packet, sizeof(packet));
+	REQUIRE(size > 0 && size <= (int)sizeof(packet));
+	uint16_t ack;
+	REQUIRE(replication_client_read(rc, packet, size, &ack));
+	replication_server_ack(rs, 0, ack);
+	REQUIRE(replication_client_has_entity(rc, 99));
+	int received = 0;
+	for (int i = 0; i < 100; ++i) {
+		received += replication_client_has_entity(rc, i) ? 1 : 0;
+	}
+	REQUIRE(received < 20);
+
+	// Everything eventually arrives except the entity with zero priority.
+	for (int i = 0; i < 100; ++i) {
+		size = replication_server_write(rs, 0, packet, sizeof(packet));
+		if (!size) break;
+		REQUIRE(replication_client_read(rc, packet, size, &ack));
+		replication_server_ack(rs, 0, ack);
+	}
+	for (int i = 0; i < 100; ++i) {
+		REQUIRE(replication_client_has_entity(rc, i) == (i != 98));
+	}
+	REQUIRE(replication_client_get_entity(rc, 50)[3] == 50 * 4000000);
+
+	destroy_replication_server(rs);
+	destroy_replication_client(rc);
+	return true;
+}
+
+/* Entities enter and leave a view once each, with a margin so ones on the edge don't flicker, and drive a scoped server. */
+TEST_CASE(test_replication_interest)
+{
+	ReplicationConfig config = s_config(100, 1);
+	config.scoped = true;
+	ReplicationServer rs = make_replication_server(config);
+	ReplicationClient rc = make_replication_client(config);
+	Interest interest = make_interest(10.0f, 5.0f);
+
+	// Entities on a line, one unit apart, and a view over the first ten.
+	for (int i = 0; i < 100; ++i) {
+		int32_t fields[1] = { i };
+		replication_server_set_entity(rs, i, fields);
+		interest_set_entity(interest, i, V2((float)i, 0));
+	}
+	interest_set_view(interest, 0, make_aabb(V2(-0.5f, -1), V2(9.5f, 1)));
+
+	auto sync = [&]() {
+		interest_update(interest);
+		int count;
+		const int* entered = interest_get_entered(interest, 0, &count);
+		for (int i = 0; i < count; ++i) replication_server_scope_add(rs, 0, entered[i]);
+		const int* left = interest_get_left(interest, 0, &count);
+		for (int i = 0; i < count; ++i) replication_server_scope_remove(rs, 0, left[i]);
+		while (s_exchange(rs, rc)) {}
+	};
+
+	sync();
+	int count;
+	interest_get_entered(interest, 0, &count);
+	REQUIRE(count == 10);
+	for (int i = 0; i < 100; ++i) REQUIRE(replication_client_has_entity(rc, i) == (i < 10));
+
+	// Slide the view right by three. Entities within the margin stay.
+	interest_set_view(interest, 0, make_aabb(V2(2.5f, -1), V2(12.5f, 1)));
+	sync();
+	interest_get_entered(interest, 0, &count);
+	REQUIRE(count == 3);
+	interest_get_left(interest, 0, &count);
+	REQUIRE(count == 0);
+	for (int i = 0; i < 100; ++i) REQUIRE(replication_client_has_entity(rc, i) == (i < 13));
+
+	// Far enough that the old ones pass the margin.
+	interest_set_view(interest, 0, make_aabb(V2(50.5f, -1), V2(60.5f, 1)));
+	sync();
+	const int* left = interest_get_left(interest, 0, &count);
+	REQUIRE(count == 13 && left[0] == 0 && left[12] == 12);
+	for (int i = 0; i < 100; ++i) REQUIRE(replication_client_has_entity(rc, i) == (i >= 51 && i <= 60));
+
+	// Removed entities leave too, and nothing changes while everything holds still.
+	interest_remove_entity(interest, 55);
+	sync();
+	interest_get_left(interest, 0, &count);
+	REQUIRE(count == 1);
+	REQUIRE(!replication_client_has_entity(rc, 55));
+	interest_update(interest);
+	interest_get_entered(interest, 0, &count);
+	REQUIRE(count == 0);
+	interest_get_visible(interest, 0, &count);
+	REQUIRE(count == 9);
+
+	destroy_interest(interest);
+	destroy_replication_server(rs);
+	destroy_replication_client(rc);
+	return true;
+}
+
+TEST_SUITE(test_replication)
+{
+	RUN_TEST_CASE(test_replication_round_trip);
+	RUN_TEST_CASE(test_replication_delta);
+	RUN_TEST_CASE(test_replication_lost_acks);
+	RUN_TEST_CASE(test_replication_priority);
+	RUN_TEST_CASE(test_replication_interest);
+}
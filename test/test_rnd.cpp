@@ -0,0 +1,82 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_rnd.h>
+#include <cute_array.h>
+using namespace Cute;
+
+/* Filled arrays interleave four streams, the first of which is the generator's own sequence. */
+TEST_CASE(test_rnd_fill)
+{
+	// Small counts match calling `cf_rnd_float` in a loop.
+	Rnd a = rnd_seed(3);
+	Rnd b = rnd_seed(3);
+	float small[10];
+	rnd_fill(&a, small, 10);
+	for (int i = 0; i < 10; ++i) {
+		REQUIRE(small[i] == rnd_float(&b));
+	}
+
+	// Large counts take every fourth number from the generator's own sequence. Odd counts are fine.
+	const int count = 4099;
+	Array<float> floats;
+	floats.ensure_count(count);
+	Array<uint32_t> ints;
+	ints.ensure_count(count);
+	a = rnd_seed(5);
+	b = rnd_seed(5);
+	Rnd c = rnd_seed(5);
+	rnd_fill(&a, floats.data(), count);
+	rnd_fill(&c, ints.data(), count);
+	for (int i = 0; i < count; ++i) {
+		REQUIRE(floats[i] >= 0 && floats[i] < 1.0f);
+		if (i % 4 == 0) {
+			REQUIRE(ints[i] == (uint32_t)(rnd(&b) >> 32));
+		}
+	}
+
+	// Afterwards the generator carries on from its own sequence.
+	REQUIRE(a.state[0] == b.state[0] && a.state[1] == b.state[1]);
+
+	// Each stream is different.
+	REQUIRE(ints[0] != ints[1] && ints[1] != ints[2] && ints[2] != ints[3]);
+
+	return true;
+}
+
+/* Splitting is deterministic, and gives streams that differ from each other. */
+TEST_CASE(test_rnd_split)
+{
+	Rnd a = rnd_seed(11);
+	Rnd b = rnd_seed(11);
+	Rnd a0 = rnd_split(&a);
+	Rnd a1 = rnd_split(&a);
+	Rnd b0 = rnd_split(&b);
+	Rnd b1 = rnd_split(&b);
+	for (int i = 0; i < 100; ++i) {
+		uint64_t x0 = rnd(&a0), x1 = rnd(&a1);
+		REQUIRE(x0 == rnd(&b0));
+		REQUIRE(x1 == rnd(&b1));
+		REQUIRE(x0 != x1);
+	}
+
+	// The first split stream is the generator's own sequence.
+	Rnd c = rnd_seed(11);
+	Rnd c0 = rnd_split(&c);
+	Rnd d = rnd_seed(11);
+	REQUIRE(rnd(&c0) == rnd(&d));
+
+	return true;
+}
+
+TEST_SUITE(test_rnd)
+{
+	RUN_TEST_CASE(test_rnd_fill);
+	RUN_TEST_CASE(test_rnd_split);
+}
@@ -0,0 +1,70 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute.h>
+using namespace Cute;
+
+static Aabb s_random_aabb(CF_RndState* rnd, float size)
+{
+	v2 p = V2(cf_rnd_range_float(rnd, -100.0f, 100.0f), cf_rnd_range_float(rnd, -100.0f, 100.0f));
+	v2 e = V2(cf_rnd_range_float(rnd, 0.1f, size), cf_rnd_range_float(rnd, 0.1f, size));
+	return make_aabb(p - e, p + e);
+}
+
+static bool s_collect_leaf(Leaf leaf, Aabb aabb, void* leaf_udata, void* fn_udata)
+{
+	((Array<Leaf>*)fn_udata)->add(leaf);
+	return true;
+}
+
+/* Queries report every overlapping leaf exactly once, as objects move, come and go. */
+TEST_CASE(test_spatial_hash_query)
+{
+	CF_RndState rnd = cf_rnd_seed(31);
+	SpatialHash hash = make_spatial_hash(4.0f);
+	Array<Leaf> leaves;
+	for (int i = 0; i < 500; ++i) {
+		// A few big objects land in the list of leaves that span too many cells.
+		float size = i % 50 ? 3.0f : 30.0f;
+		leaves.add(spatial_hash_insert(hash, s_random_aabb(&rnd, size), (void*)(uintptr_t)(i + 1)));
+	}
+
+	for (int frame = 0; frame < 3; ++frame) {
+		for (int i = 0; i < leaves.count(); ++i) {
+			spatial_hash_update(hash, leaves[i], s_random_aabb(&rnd, i % 50 ? 3.0f : 30.0f));
+		}
+		spatial_hash_remove(hash, leaves.pop());
+		leaves.add(spatial_hash_insert(hash, s_random_aabb(&rnd, 3.0f)));
+
+		for (int q = 0; q < 50; ++q) {
+			// Include queries covering the whole grid, which walk occupied cells instead.
+			Aabb aabb = q % 10 ? s_random_aabb(&rnd, 20.0f) : make_aabb(V2(-200.0f, -200.0f), V2(200.0f, 200.0f));
+			Array<Leaf> found;
+			spatial_hash_query(hash, s_collect_leaf, aabb, &found);
+			int expected = 0;
+			for (int i = 0; i < leaves.count(); ++i) {
+				if (!overlaps(aabb, spatial_hash_get_aabb(hash, leaves[i]))) continue;
+				++expected;
+				int times = 0;
+				for (int j = 0; j < found.count(); ++j) times += found[j].id == leaves[i].id;
+				REQUIRE(times == 1);
+			}
+			REQUIRE(found.count() == expected);
+		}
+	}
+	REQUIRE(spatial_hash_get_udata(hash, leaves[0]) == (void*)(uintptr_t)1);
+
+	destroy_spatial_hash(hash);
+	return true;
+}
+
+TEST_SUITE(test_spatial_hash)
+{
+	RUN_TEST_CASE(test_spatial_hash_query);
+}
@@ -45,8 +45,163 @@ TEST_CASE(test_easy_sprite_unload)
 	return true;
 }
 
+/* Sub-rectangle updates of dynamic sprites are clipped, and merge into one pending upload. */
+TEST_CASE(test_dynamic_sprite)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	CF_Sprite s = cf_make_dynamic_sprite(NULL, 4, 3);
+	REQUIRE(s.w == 4 && s.h == 3);
+	CF_DynamicSprite* dynamic = app->dynamic_sprites.try_find(s.easy_sprite_id);
+	REQUIRE(dynamic);
+	REQUIRE(dynamic->pix[0].val == 0);
+
+	CF_Pixel block[4];
+	for (int i = 0; i < 4; ++i) block[i].val = 0x10 + i;
+	cf_dynamic_sprite_update_rect(&s, 1, 1, 2, 2, block);
+	REQUIRE(dynamic->pix[1 * 4 + 1].val == 0x10);
+	REQUIRE(dynamic->pix[1 * 4 + 2].val == 0x11);
+	REQUIRE(dynamic->pix[2 * 4 + 1].val == 0x12);
+	REQUIRE(dynamic->pix[2 * 4 + 2].val == 0x13);
+	REQUIRE(dynamic->pix[0].val == 0);
+
+	// Only the inside of the sprite is written.
+	cf_dynamic_sprite_update_rect(&s, 3, -1, 2, 2, block);
+	REQUIRE(dynamic->pix[3].val == 0x12);
+	REQUIRE(dynamic->pix[4 + 3].val == 0);
+	REQUIRE(app->dynamic_sprites_to_upload.count() == 1);
+
+	cf_dynamic_sprite_unload(&s);
+	REQUIRE(app->dynamic_sprites.count() == 0);
+
+	cf_destroy_app();
+	return true;
+}
+
+static CF_Sprite s_sprite(CF_Animation* animation, CF_PlayDirection direction)
+{
+	CF_Sprite sprite = cf_sprite_defaults();
+	sprite.animation = animation;
+	sprite.play_direction = direction;
+	return sprite;
+}
+
+/* Batched updates walk through as many frames as the time step covers, in every play direction. */
+TEST_CASE(test_sprites_update)
+{
+	CF_Animation animation = { };
+	for (int i = 0; i < 4; ++i) {
+		CF_Frame frame = { (uint64_t)i, 0.5f };
+		cf_animation_add_frame(&animation, frame);
+	}
+
+	CF_Sprite sprites[4] = {
+		s_sprite(&animation, CF_PLAY_DIRECTION_FORWARDS),
+		s_sprite(&animation, CF_PLAY_DIRECTION_BACKWARDS),
+		s_sprite(&animation, CF_PLAY_DIRECTION_PINGPONG),
+		s_sprite(&animation, CF_PLAY_DIRECTION_FORWARDS),
+	};
+	sprites[1].frame_index = 3;
+	sprites[3].paused = true;
+
+	// A single step covers 2.5 frames.
+	cf_sprites_update(sprites, 4, 1.25f, NULL);
+	REQUIRE(sprites[0].frame_index == 2 && sprites[0].loop_count == 0);
+	REQUIRE(sprites[0].t > 0.24f && sprites[0].t < 0.26f);
+	REQUIRE(sprites[1].frame_index == 1 && sprites[1].loop_count == 0);
+	REQUIRE(sprites[2].frame_index == 2);
+	REQUIRE(sprites[3].frame_index == 0 && sprites[3].t == 0);
+
+	// Wrap around: forwards to the start, backwards to the end, pingpong turns around.
+	cf_sprites_update(sprites, 4, 1.0f, NULL);
+	REQUIRE(sprites[0].frame_index == 0 && sprites[0].loop_count == 1);
+	REQUIRE(sprites[1].frame_index == 3 && sprites[1].loop_count == 1);
+	REQUIRE(sprites[2].frame_index == 2 && sprites[2].loop_count == 1);
+
+	// Matches stepping one frame at a time.
+	CF_Sprite stepped = s_sprite(&animation, CF_PLAY_DIRECTION_PINGPONG);
+	CF_Sprite batched = stepped;
+	for (int i = 0; i < 13; ++i) {
+		cf_sprites_update(&stepped, 1, 0.5f, NULL);
+	}
+	cf_sprites_update(&batched, 1, 6.5f, NULL);
+	REQUIRE(stepped.frame_index == batched.frame_index);
+	REQUIRE(stepped.loop_count == batched.loop_count);
+
+	afree(animation.frames);
+	return true;
+}
+
+/* Instances of a shared definition animate in step with full sprites, and can be expanded back into one. */
+TEST_CASE(test_sprite_instances)
+{
+	CHECK(cf_is_error(cf_make_app(NULL, 0, 0, 0, 0, 0, APP_OPTIONS_HIDDEN | APP_OPTIONS_NO_AUDIO | APP_OPTIONS_NO_GFX, NULL)));
+
+	CF_Sprite sprite = cf_make_sprite_from_memory("girl.aseprite", girl_data, girl_sz);
+	CF_SpriteDef def = cf_make_sprite_def_from_sprite(&sprite);
+	CF_SpriteInstance instances[3];
+	for (int i = 0; i < 3; ++i) instances[i] = cf_make_sprite_instance(def);
+	REQUIRE(cf_sprite_instance_is_playing(instances, sprite.animation->name));
+
+	const char* other = sprite.animations[hcount(sprite.animations) - 1]->name;
+	cf_sprite_play(&sprite, other);
+	cf_sprite_instance_play(instances + 1, other);
+	REQUIRE(cf_sprite_instance_is_playing(instances + 1, other));
+	instances[2].paused = true;
+
+	for (int i = 0; i < 10; ++i) {
+		cf_sprites_update(&sprite, 1, 0.07f, NULL);
+		cf_sprite_instances_update(instances, 3, 0.07f, NULL);
+	}
+	CF_Sprite expanded = cf_sprite_instance_to_sprite(instances + 1);
+	REQUIRE(expanded.animation == sprite.animation);
+	REQUIRE(expanded.frame_index == sprite.frame_index);
+	REQUIRE(expanded.loop_count == sprite.loop_count);
+	REQUIRE(expanded.w == sprite.w && expanded.h == sprite.h);
+	REQUIRE(instances[2].frame_index == 0 && instances[2].t == 0);
+
+	cf_destroy_sprite_def(def);
+	REQUIRE(cf_sprite_instance_to_sprite(instances).animation == NULL);
+	CF_SpriteDef reused = cf_make_sprite_def_from_sprite(&sprite);
+	REQUIRE(reused.id == def.id);
+
+	cf_destroy_app();
+	return true;
+}
+
+/* Atlas mips average premultiplied texels, fading edges into transparent padding. */
+TEST_CASE(test_atlas_mip_chain)
+{
+	CF_Pixel pix[4 * 4] = { };
+	CF_Pixel white = { };
+	white.val = 0xFFFFFFFF;
+	pix[0] = pix[1] = pix[4] = pix[5] = white;
+	pix[2] = white;
+
+	CF_Pixel* chain;
+	int levels = cf_atlas_mip_chain(pix, 4, 4, 8, &chain);
+	REQUIRE(levels == 3);
+	REQUIRE(!CF_MEMCMP(chain, pix, sizeof(pix)));
+	CF_Pixel* level1 = chain + 16;
+	REQUIRE(level1[0].val == 0xFFFFFFFF);
+	REQUIRE(level1[1].colors.r == 64 && level1[1].colors.a == 64);
+	REQUIRE(level1[2].val == 0 && level1[3].val == 0);
+	CF_Pixel* level2 = level1 + 4;
+	REQUIRE(level2[0].colors.a == 80 && level2[0].colors.r == level2[0].colors.a);
+	cf_free(chain);
+
+	levels = cf_atlas_mip_chain(pix, 4, 4, 2, &chain);
+	REQUIRE(levels == 2);
+	cf_free(chain);
+	return true;
+}
+
 TEST_SUITE(test_sprite)
 {
 	RUN_TEST_CASE(test_make_sprite);
 	RUN_TEST_CASE(test_easy_sprite_unload);
+	RUN_TEST_CASE(test_dynamic_sprite);
+	RUN_TEST_CASE(test_sprites_update);
+	RUN_TEST_CASE(test_sprite_instances);
+	RUN_TEST_CASE(test_atlas_mip_chain);
 }
@@ -10,6 +10,8 @@
 #include <cute.h>
 using namespace Cute;
 
+#include <internal/cute_string_internal.h>
+
 /* Basic test of apush/afree etc. */
 TEST_CASE(test_array_macros_simple)
 {
@@ -86,6 +88,45 @@ TEST_CASE(test_string_macros_simple)
 	return true;
 }
 
+/* The single pass formatter matches snprintf, including float rounding and the specs it hands off. */
+TEST_CASE(test_string_fmt)
+{
+	char expected[256];
+	char* s = NULL;
+#define CHECK_FMT(fmt, ...) \
+	snprintf(expected, sizeof(expected), fmt, __VA_ARGS__); \
+	sfmt(s, fmt, __VA_ARGS__); \
+	REQUIRE(sequ(s, expected))
+	CHECK_FMT("%d %i %u %x %X %%", -5, 0, 42u, 0xdeadu, 0xbeefu);
+	CHECK_FMT("%05d|%-5d|%+d|% d|%5s|%-5s|%.2s|%c", -42, 7, 3, 4, "ab", "cd", "xyz", 'q');
+	CHECK_FMT("%lld %llu %zu %ld %hhd %hd", (long long)INT64_MIN, (unsigned long long)UINT64_MAX, (size_t)123, -77L, 300, 70000);
+	CHECK_FMT("%f %.0f %.1f %.2f %.9f %8.3f %-8.3f|%+f % f %08.2f", 1.5, 2.5, 0.25, 0.125, 1e-9, 3.14159, -2.0, 1.0, 2.0, -3.14159);
+	CHECK_FMT("%f %f %.3f %.12f %e", 1e30, -0.0, -0.0001, 1.0 / 3.0, 1.0);
+	for (int i = 0; i < 10000; ++i) {
+		double v = (i - 5000) * 0.0125 + i * 1e-7;
+		CHECK_FMT("%.2f %.4f %f", v, v, v);
+	}
+#undef CHECK_FMT
+	sfmt(s, "%d", 10);
+	sfmt_append(s, " and %s", "more");
+	REQUIRE(sequ(s, "10 and more"));
+	REQUIRE(slen(s) == 11);
+	sfree(s);
+
+	// Formatting into the stack only goes to the heap once out of room.
+	alignas(CF_Ahdr) char buffer[sizeof(CF_Ahdr) + 16];
+	sstatic(s, buffer, sizeof(buffer));
+	sfmt(s, "%d/%d", 15, 20);
+	REQUIRE(sequ(s, "15/20"));
+	REQUIRE(CF_AHDR(s)->is_static);
+	sfmt_append(s, " %s %.1f", "is more than sixteen", 0.75);
+	REQUIRE(sequ(s, "15/20 is more than sixteen 0.8"));
+	REQUIRE(!CF_AHDR(s)->is_static);
+	sfree(s);
+
+	return true;
+}
+
 /* Test out basic use cases for all the advanced string macro functions. */
 TEST_CASE(test_string_macros_advanced)
 {
@@ -198,6 +239,112 @@ TEST_CASE(test_string_macros_advanced)
 	return true;
 }
 
+/* Short strings stay inline, and inline strings survive being moved and memcpy'd around. */
+TEST_CASE(test_string_inline)
+{
+	String a = "short";
+	REQUIRE(a.is_inline());
+	REQUIRE(a == "short");
+	REQUIRE(a.len() == 5);
+	a.append(" and sweet");
+	REQUIRE(a.is_inline());
+	a.append(", but not anymore");
+	REQUIRE(!a.is_inline());
+	REQUIRE(a == "short and sweet, but not anymore");
+
+	String b = cf_move(a);
+	REQUIRE(b == "short and sweet, but not anymore");
+	REQUIRE(a.is_inline());
+	REQUIRE(a.empty());
+
+	String c;
+	REQUIRE(c.empty());
+	REQUIRE(c.c_str() && *c.c_str() == 0);
+	c = "abc";
+	String d = cf_move(c);
+	REQUIRE(d == "abc");
+	REQUIRE(c.empty());
+	d = cf_move(b);
+	REQUIRE(d == "short and sweet, but not anymore");
+
+	char* stolen = String("stolen").steal();
+	REQUIRE(sequ(stolen, "stolen"));
+	sfree(stolen);
+
+	// Map moves its items with memcpy.
+	Map<int, String> map;
+	for (int i = 0; i < 100; ++i) {
+		map.insert(i, String(i));
+	}
+	for (int i = 0; i < 50; ++i) {
+		map.remove(i * 2);
+	}
+	for (int i = 0; i < 50; ++i) {
+		REQUIRE(map.get(i * 2 + 1).to_int() == i * 2 + 1);
+	}
+
+	return true;
+}
+
+/* Strings with storage from an arena. */
+TEST_CASE(test_string_arena)
+{
+	CF_Arena arena;
+	cf_arena_init(&arena, 8, 1024);
+	char* a = NULL;
+	sarena(a, &arena, 16);
+	REQUIRE(sempty(a));
+	REQUIRE(scap(a) >= 16);
+	sset(a, "arena string");
+	REQUIRE(sequ(a, "arena string"));
+	REQUIRE(CF_AHDR(a)->is_static);
+
+	// Grows onto the heap once out of room.
+	sappend(a, " that outgrew the arena");
+	REQUIRE(sequ(a, "arena string that outgrew the arena"));
+	REQUIRE(!CF_AHDR(a)->is_static);
+	sfree(a);
+	cf_arena_reset(&arena);
+
+	return true;
+}
+
+/* Scan for the end of ASCII runs, and decode UTF8 on both sides of the vectorized paths. */
+TEST_CASE(test_string_scan_ascii)
+{
+	char text[128];
+	for (int i = 0; i < 100; ++i) text[i] = 'a' + (i % 26);
+	text[100] = 0;
+	const char* end = text + 100;
+	REQUIRE(cf_scan_ascii(text, end, NULL, 0) == end);
+	REQUIRE(cf_scan_ascii(text, end, "z", 1) == text + 25);
+	REQUIRE(cf_scan_ascii(text + 26, end, "<z", 2) == text + 51);
+	// The nul-terminator ends a run even before `end`.
+	REQUIRE(cf_scan_ascii(text, text + 101, NULL, 0) == text + 100);
+
+	// Put a multi-byte character at every offset so it's found by both the vector and the scalar loops.
+	for (int i = 0; i < 40; ++i) {
+		char* s = NULL;
+		for (int j = 0; j < i; ++j) spush(s, 'x');
+		sappend_UTF8(s, 0x263A);
+		sappend(s, "tail");
+		REQUIRE(cf_scan_ascii(s, s + slen(s), NULL, 0) == s + i);
+		int cp;
+		const char* next = cf_decode_UTF8_fast(s + i, &cp);
+		REQUIRE(cp == 0x263A);
+		REQUIRE(next == s + i + 3);
+		next = cf_decode_UTF8_fast(next, &cp);
+		REQUIRE(cp == 't');
+		UTF8 utf8 = UTF8(s);
+		int count = 0;
+		while (utf8.next()) ++count;
+		REQUIRE(count == i + 5);
+		sfree(s);
+	}
+
+	return true;
+}
+
 /* Run the string interning API. */
 TEST_CASE(test_string_interning)
 {
@@ -233,6 +380,47 @@ TEST_CASE(test_string_interning)
 	return true;
 }
 
+/* Intern the same strings from many threads at once. */
+#define INTERN_THREAD_COUNT 4
+#define INTERN_STRING_COUNT 2000
+
+static const char* s_interned[INTERN_THREAD_COUNT][INTERN_STRING_COUNT];
+
+static void s_intern_task(void* udata)
+{
+	int thread = (int)(uintptr_t)udata;
+	char buf[64];
+	for (int i = 0; i < INTERN_STRING_COUNT; ++i) {
+		// Each thread walks the strings in a different order.
+		int index = thread & 1 ? INTERN_STRING_COUNT - 1 - i : i;
+		CF_SNPRINTF(buf, sizeof(buf), "threaded intern %d", index);
+		s_interned[thread][index] = sintern(buf);
+	}
+}
+
+TEST_CASE(test_string_interning_threaded)
+{
+	CF_Threadpool* pool = cf_make_threadpool(INTERN_THREAD_COUNT);
+	for (int i = 0; i < INTERN_THREAD_COUNT; ++i) {
+		cf_threadpool_add_task(pool, s_intern_task, (void*)(uintptr_t)i);
+	}
+	cf_threadpool_kick_and_wait(pool);
+	cf_destroy_threadpool(pool);
+
+	char buf[64];
+	for (int i = 0; i < INTERN_STRING_COUNT; ++i) {
+		CF_SNPRINTF(buf, sizeof(buf), "threaded intern %d", i);
+		const char* s = sintern(buf);
+		REQUIRE(!CF_STRCMP(s, buf));
+		REQUIRE(silen(s) == (int)CF_STRLEN(buf));
+		for (int j = 0; j < INTERN_THREAD_COUNT; ++j) {
+			REQUIRE(s_interned[j][i] == s);
+		}
+	}
+
+	return true;
+}
+
 /* Run Map<T> API and sintern API */
 TEST_CASE(test_dictionary_and_interning)
 {
@@ -266,8 +454,13 @@ TEST_SUITE(test_string)
 {
 	RUN_TEST_CASE(test_array_macros_simple);
 	RUN_TEST_CASE(test_string_macros_simple);
+	RUN_TEST_CASE(test_string_fmt);
  	RUN_TEST_CASE(test_string_macros_advanced);
+	RUN_TEST_CASE(test_string_inline);
+	RUN_TEST_CASE(test_string_arena);
+	RUN_TEST_CASE(test_string_scan_ascii);
 	RUN_TEST_CASE(test_string_interning);
+	RUN_TEST_CASE(test_string_interning_threaded);
 	RUN_TEST_CASE(test_dictionary_and_interning);
 	RUN_TEST_CASE(test_split_for_memleaks);
 }
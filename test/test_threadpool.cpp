@@ -0,0 +1,419 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_array.h>
+#include <cute_c_runtime.h>
+#include <cute_multithreading.h>
+using namespace Cute;
+
+static CF_Threadpool* s_pool;
+static CF_AtomicInt s_counter;
+
+static void s_count_task(void* param)
+{
+	cf_atomic_add(&s_counter, 1);
+}
+
+static void s_spawn_task(void* param)
+{
+	CF_Job jobs[16];
+	for (int i = 0; i < 16; ++i) {
+		jobs[i] = cf_threadpool_add_task(s_pool, s_count_task, NULL);
+	}
+	cf_threadpool_kick(s_pool);
+	for (int i = 0; i < 16; ++i) {
+		cf_threadpool_wait_job(s_pool, jobs[i]);
+	}
+	cf_atomic_add(&s_counter, 1);
+}
+
+/* CAS reports success only when the value was actually swapped. */
+TEST_CASE(test_atomic_cas)
+{
+	CF_AtomicInt atomic = { };
+	REQUIRE(cf_is_error(cf_atomic_cas(&atomic, 1, 2)));
+	REQUIRE(cf_atomic_get(&atomic) == 0);
+	REQUIRE(!cf_is_error(cf_atomic_cas(&atomic, 0, 1)));
+	REQUIRE(cf_atomic_get(&atomic) == 1);
+	REQUIRE(cf_is_error(cf_atomic_cas(&atomic, 0, 1)));
+
+	int a, b;
+	void* ptr = &a;
+	REQUIRE(cf_is_error(cf_atomic_ptr_cas(&ptr, &b, &b)));
+	REQUIRE(ptr == &a);
+	REQUIRE(!cf_is_error(cf_atomic_ptr_cas(&ptr, &a, &b)));
+	REQUIRE(ptr == &b);
+
+	return true;
+}
+
+/* Kick and wait finishes every task, including tasks added by other tasks. */
+TEST_CASE(test_threadpool_kick_and_wait)
+{
+	s_pool = cf_make_threadpool(3);
+	s_counter = cf_atomic_zero();
+	for (int i = 0; i < 10000; ++i) {
+		cf_threadpool_add_task(s_pool, s_count_task, NULL);
+	}
+	for (int i = 0; i < 100; ++i) {
+		cf_threadpool_add_task(s_pool, s_spawn_task, NULL);
+	}
+	cf_threadpool_kick_and_wait(s_pool);
+	REQUIRE(cf_atomic_get(&s_counter) == 10000 + 100 * 17);
+	cf_destroy_threadpool(s_pool);
+
+	return true;
+}
+
+/* Waiting on a job handle returns once that job is done. */
+TEST_CASE(test_threadpool_wait_job)
+{
+	s_pool = cf_make_threadpool(3);
+	s_counter = cf_atomic_zero();
+	CF_Job job = cf_threadpool_add_task(s_pool, s_spawn_task, NULL);
+	cf_threadpool_kick(s_pool);
+	cf_threadpool_wait_job(s_pool, job);
+	REQUIRE(cf_threadpool_job_is_done(s_pool, job));
+	REQUIRE(cf_atomic_get(&s_counter) == 17);
+
+	CF_Job none = { 0 };
+	REQUIRE(cf_threadpool_job_is_done(s_pool, none));
+	cf_destroy_threadpool(s_pool);
+
+	return true;
+}
+
+struct StageJob
+{
+	int stage;
+	CF_AtomicInt* stages_done;
+	bool in_order;
+};
+
+static void s_stage_task(void* param)
+{
+	StageJob* job = (StageJob*)param;
+	job->in_order = cf_atomic_get(job->stages_done) >= job->stage;
+	cf_atomic_add(job->stages_done, 1);
+}
+
+/* Dependent tasks only run once every dependency is done, and counters track groups of tasks. */
+TEST_CASE(test_threadpool_dependencies)
+{
+	s_pool = cf_make_threadpool(3);
+	for (int iter = 0; iter < 100; ++iter) {
+		// Eight tasks in the first stage, so the second stage depends on more jobs than fit inline.
+		CF_AtomicInt stages_done = cf_atomic_zero();
+		StageJob first[8];
+		CF_Job first_jobs[8];
+		for (int i = 0; i < 8; ++i) {
+			first[i] = { 0, &stages_done, false };
+			first_jobs[i] = cf_threadpool_add_task(s_pool, s_stage_task, first + i);
+		}
+		StageJob second = { 8, &stages_done, false };
+		CF_Job second_job = cf_threadpool_add_dependent_task(s_pool, s_stage_task, &second, first_jobs, 8, NULL);
+		StageJob third = { 9, &stages_done, false };
+		CF_AtomicInt counter = cf_atomic_zero();
+		cf_threadpool_add_dependent_task(s_pool, s_stage_task, &third, &second_job, 1, &counter);
+		cf_threadpool_kick(s_pool);
+		cf_threadpool_wait_counter(s_pool, &counter);
+
+		REQUIRE(cf_atomic_get(&stages_done) == 10);
+		REQUIRE(second.in_order);
+		REQUIRE(third.in_order);
+		REQUIRE(cf_threadpool_job_is_done(s_pool, second_job));
+	}
+	cf_destroy_threadpool(s_pool);
+
+	return true;
+}
+
+static void s_mark_range(int begin, int end, void* udata)
+{
+	int* marks = (int*)udata;
+	for (int i = begin; i < end; ++i) {
+		marks[i]++;
+	}
+}
+
+static void s_sum_range(int begin, int end, void* partial, void* udata)
+{
+	for (int i = begin; i < end; ++i) {
+		*(uint64_t*)partial += (uint64_t)i;
+	}
+}
+
+static void s_sum_join(void* result, const void* partial, void* udata)
+{
+	*(uint64_t*)result += *(const uint64_t*)partial;
+}
+
+/* Parallel for visits every index exactly once, and parallel reduce joins every range. */
+TEST_CASE(test_threadpool_parallel_for)
+{
+	s_pool = cf_make_threadpool(3);
+	const int count = 100000;
+	Array<int> marks;
+	marks.ensure_count(count);
+	for (int i = 0; i < 2; ++i) {
+		CF_Threadpool* pool = i ? s_pool : NULL;
+		CF_MEMSET(marks.data(), 0, sizeof(int) * count);
+		cf_parallel_for(pool, count, 16, s_mark_range, marks.data());
+		for (int j = 0; j < count; ++j) {
+			REQUIRE(marks[j] == 1);
+		}
+
+		uint64_t sum = 0;
+		cf_parallel_reduce(pool, count, 16, &sum, sizeof(sum), s_sum_range, s_sum_join, NULL);
+		REQUIRE(sum == (uint64_t)count * (count - 1) / 2);
+	}
+	cf_parallel_for(s_pool, 0, 16, s_mark_range, NULL);
+	cf_destroy_threadpool(s_pool);
+
+	return true;
+}
+
+static CF_AtomicInt s_io_pending;
+static CF_AtomicInt s_fibers_waiting;
+
+static void s_fiber_task(void* param)
+{
+	CF_AtomicInt counter = cf_atomic_zero();
+	for (int i = 0; i < 8; ++i) {
+		cf_threadpool_add_dependent_task(s_pool, s_count_task, NULL, NULL, 0, &counter);
+	}
+	cf_threadpool_kick(s_pool);
+	cf_threadpool_wait_counter(s_pool, &counter);
+	if (cf_atomic_get(&counter) == 0) cf_atomic_add(&s_counter, 1);
+
+	// Stand in for an I/O request completed by a thread outside the pool.
+	cf_atomic_add(&s_fibers_waiting, 1);
+	cf_threadpool_wait_counter(s_pool, &s_io_pending);
+	cf_atomic_add(&s_counter, 1);
+}
+
+/* Fiber tasks park while waiting, and resume once what they wait on is done. */
+TEST_CASE(test_threadpool_fibers)
+{
+	s_pool = cf_make_threadpool(2);
+	for (int iter = 0; iter < 10; ++iter) {
+		s_counter = cf_atomic_zero();
+		s_fibers_waiting = cf_atomic_zero();
+		cf_atomic_set(&s_io_pending, 1);
+		CF_Job jobs[32];
+		for (int i = 0; i < 32; ++i) {
+			jobs[i] = cf_threadpool_add_fiber_task(s_pool, s_fiber_task, NULL, NULL, 0, NULL);
+		}
+		cf_threadpool_kick(s_pool);
+
+		// Every fiber reaches its wait on only two threads, as none of them holds on to a thread.
+		while (cf_atomic_get(&s_fibers_waiting) < 32) {
+			cf_threadpool_kick(s_pool);
+		}
+		REQUIRE(cf_atomic_get(&s_counter) == 32 * 8 + 32);
+		for (int i = 0; i < 32; ++i) {
+			REQUIRE(!cf_threadpool_job_is_done(s_pool, jobs[i]));
+		}
+
+		cf_atomic_set(&s_io_pending, 0);
+		cf_threadpool_kick(s_pool);
+		for (int i = 0; i < 32; ++i) {
+			cf_threadpool_wait_job(s_pool, jobs[i]);
+		}
+		REQUIRE(cf_atomic_get(&s_counter) == 32 * 8 + 64);
+	}
+	cf_destroy_threadpool(s_pool);
+
+	return true;
+}
+
+static int s_spsc_producer(void* udata)
+{
+	CF_SPSCQueue* queue = (CF_SPSCQueue*)udata;
+	for (int i = 0; i < 100000; ++i) {
+		while (!cf_spsc_queue_push(queue, &i)) {
+		}
+	}
+	return 0;
+}
+
+struct MPMCThread
+{
+	CF_MPMCQueue* queue;
+	CF_AtomicInt* popped;
+	uint64_t sum;
+};
+
+static int s_mpmc_producer(void* udata)
+{
+	MPMCThread* thread = (MPMCThread*)udata;
+	for (int i = 0; i < 25000; ++i) {
+		int value = i + 1;
+		while (!cf_mpmc_queue_push(thread->queue, &value)) {
+		}
+	}
+	return 0;
+}
+
+static int s_mpmc_consumer(void* udata)
+{
+	MPMCThread* thread = (MPMCThread*)udata;
+	while (cf_atomic_get(thread->popped) < 100000) {
+		int value;
+		if (cf_mpmc_queue_pop(thread->queue, &value)) {
+			thread->sum += (uint64_t)value;
+			cf_atomic_add(thread->popped, 1);
+		}
+	}
+	return 0;
+}
+
+/* Lock-free queues hand over every element exactly once, and SPSC queues keep them in order. */
+TEST_CASE(test_threadpool_queues)
+{
+	CF_SPSCQueue* spsc = cf_make_spsc_queue(100, sizeof(int));
+	int value;
+	REQUIRE(!cf_spsc_queue_pop(spsc, &value));
+	for (int i = 0; i < 128; ++i) {
+		REQUIRE(cf_spsc_queue_push(spsc, &i));
+	}
+	REQUIRE(!cf_spsc_queue_push(spsc, &value));
+	REQUIRE(cf_spsc_queue_count(spsc) == 128);
+	for (int i = 0; i < 128; ++i) {
+		REQUIRE(cf_spsc_queue_pop(spsc, &value));
+		REQUIRE(value == i);
+	}
+
+	CF_Thread* producer = cf_thread_create(s_spsc_producer, "producer", spsc);
+	for (int i = 0; i < 100000; ++i) {
+		while (!cf_spsc_queue_pop(spsc, &value)) {
+		}
+		REQUIRE(value == i);
+	}
+	cf_thread_wait(producer);
+	REQUIRE(cf_spsc_queue_count(spsc) == 0);
+	cf_destroy_spsc_queue(spsc);
+
+	CF_MPMCQueue* mpmc = cf_make_mpmc_queue(64, sizeof(int));
+	CF_AtomicInt popped = cf_atomic_zero();
+	MPMCThread threads[8];
+	CF_Thread* handles[8];
+	for (int i = 0; i < 8; ++i) {
+		threads[i] = { mpmc, &popped, 0 };
+		handles[i] = cf_thread_create(i < 4 ? s_mpmc_producer : s_mpmc_consumer, "mpmc", threads + i);
+	}
+	uint64_t sum = 0;
+	for (int i = 0; i < 8; ++i) {
+		cf_thread_wait(handles[i]);
+		sum += threads[i].sum;
+	}
+	REQUIRE(sum == 4ull * 25000 * 25001 / 2);
+	REQUIRE(!cf_mpmc_queue_pop(mpmc, &value));
+	cf_destroy_mpmc_queue(mpmc);
+
+	return true;
+}
+
+/* Topology counts add up, and pools pinned to each kind of core run their tasks. */
+TEST_CASE(test_threadpool_topology)
+{
+	CF_CpuTopology topology = cf_cpu_topology();
+	REQUIRE(topology.physical_core_count >= 1 && topology.physical_core_count <= topology.logical_core_count);
+	REQUIRE(topology.performance_core_count + topology.efficiency_core_count == topology.physical_core_count);
+	REQUIRE(topology.performance_thread_count + topology.efficiency_thread_count == topology.logical_core_count);
+	REQUIRE(topology.performance_core_count >= 1);
+	REQUIRE(topology.cache_cluster_count >= 1);
+
+	CF_CoreType types[] = { CF_CORE_TYPE_ANY, CF_CORE_TYPE_PERFORMANCE, CF_CORE_TYPE_EFFICIENCY };
+	for (int i = 0; i < 3; ++i) {
+		CF_ThreadpoolParams params = cf_threadpool_params_defaults();
+		params.thread_count = 2;
+		params.core_type = types[i];
+		params.priority = (CF_ThreadPriority)i;
+		s_pool = cf_make_threadpool_with_params(&params);
+		s_counter = cf_atomic_zero();
+		for (int j = 0; j < 1000; ++j) {
+			cf_threadpool_add_task(s_pool, s_count_task, NULL);
+		}
+		cf_threadpool_kick_and_wait(s_pool);
+		REQUIRE(cf_atomic_get(&s_counter) == 1000);
+		cf_destroy_threadpool(s_pool);
+	}
+
+	return true;
+}
+
+static CF_Mutex s_mutex;
+static int s_locked_counter;
+
+static void s_lock_task(void* param)
+{
+	for (int i = 0; i < 1000; ++i) {
+		cf_mutex_lock(&s_mutex);
+		++s_locked_counter;
+		cf_mutex_unlock(&s_mutex);
+	}
+}
+
+static int s_try_lock_thread(void* udata)
+{
+	CF_UNUSED(udata);
+	return cf_mutex_try_lock(&s_mutex) ? 1 : 0;
+}
+
+/* Mutexes hold up under contention, can be re-locked by their owner, and count every lock, and semaphores count posts and waits. */
+TEST_CASE(test_mutex_and_semaphore)
+{
+	s_mutex = cf_make_mutex();
+	s_locked_counter = 0;
+	s_pool = cf_make_threadpool(4);
+	for (int i = 0; i < 64; ++i) {
+		cf_threadpool_add_task(s_pool, s_lock_task, NULL);
+	}
+	cf_threadpool_kick_and_wait(s_pool);
+	cf_destroy_threadpool(s_pool);
+
+	REQUIRE(cf_mutex_try_lock(&s_mutex));
+	REQUIRE(cf_mutex_try_lock(&s_mutex));
+	REQUIRE(cf_thread_wait(cf_thread_create(s_try_lock_thread, "try_lock", NULL)).code == 0);
+	REQUIRE(s_locked_counter == 64 * 1000);
+	CF_MutexStats stats = cf_mutex_stats(&s_mutex);
+	REQUIRE(stats.lock_count == 64 * 1000 + 2);
+	REQUIRE(stats.contended_count <= stats.lock_count);
+	REQUIRE(stats.park_count <= stats.contended_count);
+	cf_mutex_reset_stats(&s_mutex);
+	REQUIRE(cf_mutex_stats(&s_mutex).lock_count == 0);
+	cf_mutex_unlock(&s_mutex);
+	cf_mutex_unlock(&s_mutex);
+	cf_destroy_mutex(&s_mutex);
+
+	CF_Semaphore sem = cf_make_sem(2);
+	REQUIRE(cf_sem_value(&sem).code == 2);
+	REQUIRE(!cf_is_error(cf_sem_try(&sem)));
+	REQUIRE(!cf_is_error(cf_sem_wait(&sem)));
+	REQUIRE(cf_is_error(cf_sem_try(&sem)));
+	cf_sem_post(&sem);
+	REQUIRE(cf_sem_value(&sem).code == 1);
+	cf_destroy_sem(&sem);
+
+	return true;
+}
+
+TEST_SUITE(test_threadpool)
+{
+	RUN_TEST_CASE(test_atomic_cas);
+	RUN_TEST_CASE(test_threadpool_kick_and_wait);
+	RUN_TEST_CASE(test_threadpool_wait_job);
+	RUN_TEST_CASE(test_threadpool_dependencies);
+	RUN_TEST_CASE(test_threadpool_parallel_for);
+	RUN_TEST_CASE(test_threadpool_fibers);
+	RUN_TEST_CASE(test_threadpool_queues);
+	RUN_TEST_CASE(test_threadpool_topology);
+	RUN_TEST_CASE(test_mutex_and_semaphore);
+}
@@ -0,0 +1,57 @@
+/*
+	Cute Framework
+	Copyright (C) 2024 Randy Gaul https://randygaul.github.io/
+
+	This software is dual-licensed with zlib or Unlicense, check LICENSE.txt for more info
+*/
+
+#include "test_harness.h"
+
+#include <cute_tilemap.h>
+#include <internal/cute_tilemap_internal.h>
+using namespace Cute;
+
+/* Setting a tile only marks the chunk holding it for rebaking. */
+TEST_CASE(test_tilemap_dirty_chunks)
+{
+	Tilemap tilemap = make_tilemap(40, 40, V2(16, 16), 16);
+	CF_TilemapInternal* map = cf_tilemap_internal(tilemap);
+	REQUIRE(map->chunks_x == 3);
+	REQUIRE(map->chunks_y == 3);
+
+	Sprite sprite = cf_sprite_defaults();
+	int tile = tilemap_add_tile(tilemap, sprite);
+	REQUIRE(tile == 1);
+	int layer = tilemap_add_layer(tilemap);
+	REQUIRE(tilemap_layer_count(tilemap) == 1);
+	Array<CF_TilemapChunk>& chunks = map->layers[layer].chunks;
+	for (int i = 0; i < chunks.count(); ++i) chunks[i].dirty = false;
+
+	tilemap_set_tile(tilemap, layer, 20, 5, tile);
+	REQUIRE(tilemap_get_tile(tilemap, layer, 20, 5) == tile);
+	for (int i = 0; i < chunks.count(); ++i) {
+		REQUIRE(chunks[i].dirty == (i == 1));
+	}
+	REQUIRE(chunks[1].tile_count == 1);
+
+	// Nothing changes, so nothing needs rebaking.
+	chunks[1].dirty = false;
+	tilemap_set_tile(tilemap, layer, 20, 5, tile);
+	tilemap_set_tile(tilemap, layer, -1, 50, tile);
+	for (int i = 0; i < chunks.count(); ++i) {
+		REQUIRE(!chunks[i].dirty);
+	}
+	REQUIRE(tilemap_get_tile(tilemap, layer, -1, 50) == 0);
+
+	tilemap_set_tile(tilemap, layer, 20, 5, 0);
+	REQUIRE(chunks[1].dirty);
+	REQUIRE(chunks[1].tile_count == 0);
+
+	destroy_tilemap(tilemap);
+	return true;
+}
+
+TEST_SUITE(test_tilemap)
+{
+	RUN_TEST_CASE(test_tilemap_dirty_chunks);
+}
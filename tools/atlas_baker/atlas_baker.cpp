@@ -0,0 +1,65 @@
+#include <cute.h>
+using namespace Cute;
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Bakes every .png and .ase/.aseprite file within a directory into a single atlas file. Load the
+// result at runtime with `cf_load_baked_atlas`, and draw images with `cf_make_baked_sprite`.
+//
+// Usage: atlas_baker <asset_directory> <output_directory> <output_name> [page_size]
+//
+// Sub-images are named by their path relative to `asset_directory`, e.g. "/ships/red.png", which
+// is the same path the game sees if it mounts `asset_directory` as "/".
+
+static void s_gather(const char* dir, Array<const char*>* paths)
+{
+	const char** list = cf_fs_enumerate_directory(dir);
+	for (const char** i = list; *i; ++i) {
+		Path path = dir;
+		path.add(*i);
+		CF_Stat stat;
+		if (cf_is_error(cf_fs_stat(path.c_str(), &stat))) continue;
+		if (stat.type == CF_FILE_TYPE_DIRECTORY) {
+			s_gather(path.c_str(), paths);
+		} else if (path.has_ext(".png") || path.has_ext(".ase") || path.has_ext(".aseprite")) {
+			paths->add(sintern(path.c_str()));
+		}
+	}
+	cf_fs_free_enumerated_directory(list);
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 4) {
+		printf("Usage: atlas_baker <asset_directory> <output_directory> <output_name> [page_size]\n");
+		return -1;
+	}
+	int page_size = argc > 4 ? atoi(argv[4]) : 2048;
+
+	cf_fs_init(argv[0]);
+	if (cf_is_error(cf_fs_mount(argv[1], "/", true))) {
+		printf("Unable to mount %s.\n", argv[1]);
+		return -1;
+	}
+
+	Array<const char*> paths;
+	s_gather("/", &paths);
+	printf("Baking %d images.\n", paths.count());
+
+	if (cf_is_error(cf_fs_set_write_directory(argv[2]))) {
+		printf("Unable to write to %s.\n", argv[2]);
+		return -1;
+	}
+	Path out_path = "/";
+	out_path.add(argv[3]);
+
+	CF_Result result = cf_bake_atlas(out_path.c_str(), paths.data(), paths.count(), page_size, page_size);
+	if (cf_is_error(result)) {
+		printf("Failed to bake atlas: %s\n", result.details);
+		return -1;
+	}
+
+	printf("Wrote %s.\n", argv[3]);
+	return 0;
+}
@@ -0,0 +1,44 @@
+#include <cute.h>
+using namespace Cute;
+
+#include <stdio.h>
+#include <string.h>
+
+// Packs every file within a directory into a single .cfpk file. Mount the result at runtime with
+// `cf_fs_mount` like any other archive.
+//
+// Usage: cfpack <input_directory> <output_directory> <output_name> [--compress]
+//
+// Files are named by their path relative to `input_directory`, so mounting the pack as "/" sees the
+// same paths as mounting `input_directory` as "/".
+
+int main(int argc, char* argv[])
+{
+	if (argc < 4) {
+		printf("Usage: cfpack <input_directory> <output_directory> <output_name> [--compress]\n");
+		return -1;
+	}
+	bool compress = argc > 4 && !strcmp(argv[4], "--compress");
+
+	cf_fs_init(argv[0]);
+	if (cf_is_error(cf_fs_mount(argv[1], "/", true))) {
+		printf("Unable to mount %s.\n", argv[1]);
+		return -1;
+	}
+	if (cf_is_error(cf_fs_set_write_directory(argv[2]))) {
+		printf("Unable to write to %s.\n", argv[2]);
+		return -1;
+	}
+	Path out_path = "/";
+	out_path.add(argv[3]);
+
+	CF_Result result = cf_fs_write_pack("/", out_path.c_str(), compress);
+	if (cf_is_error(result)) {
+		printf("Failed to write pack: %s\n", result.details);
+		return -1;
+	}
+
+	printf("Wrote %s.\n", argv[3]);
+	cf_fs_destroy();
+	return 0;
+}